@@ -0,0 +1,23 @@
+# Find the single precision FFTW3 library
+#
+# Set FFTW_LIBRARY to the MKL single dynamic library (libmkl_rt) to use the FFTW3 interface of MKL.
+find_path(FFTW_INCLUDE_DIR fftw3.h
+          HINTS $ENV{FFTW_ROOT}/include $ENV{MKLROOT}/include/fftw)
+
+find_library(FFTW_LIBRARY fftw3f
+             HINTS $ENV{FFTW_ROOT}/lib ${FFTW_INCLUDE_DIR}/../lib)
+
+# handle the QUIETLY and REQUIRED arguments and set FFTW_FOUND to TRUE if
+# all listed variables are TRUE
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(FFTW
+                                  REQUIRED_VARS FFTW_LIBRARY FFTW_INCLUDE_DIR)
+
+if(FFTW_FOUND AND NOT TARGET FFTW::fftw3f)
+    add_library(FFTW::fftw3f UNKNOWN IMPORTED)
+    set_target_properties(FFTW::fftw3f PROPERTIES
+        IMPORTED_LOCATION "${FFTW_LIBRARY}"
+        INTERFACE_INCLUDE_DIRECTORIES "${FFTW_INCLUDE_DIR}")
+endif()
+
+mark_as_advanced(FFTW_INCLUDE_DIR FFTW_LIBRARY)
@@ -0,0 +1,17 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""HOOMD-blue benchmark suite.
+
+Configure with ``-DBUILD_BENCHMARKS=on`` and build the ``benchmark`` target to
+run every workload against the package in the build directory. To select
+workloads or the device, run the suite directly::
+
+    PYTHONPATH=build python3 -m benchmarks --device GPU \\
+        --benchmarks lj_liquid_N32768 pppm_N32768 --output gpu.json
+
+The output is a JSON document with the build information and one result per
+workload: the median time steps per second over the repeated runs, the kernel
+times of the tuned autotuner parameters, and the peak resident memory of the
+process that ran the workload.
+"""
@@ -0,0 +1,203 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Run the benchmark suite.
+
+Each workload runs in a separate process so that the peak memory and the
+autotuner state of one workload do not affect the others.
+"""
+
+import argparse
+import json
+import resource
+import statistics
+import subprocess
+import sys
+
+import hoomd
+
+from benchmarks.workloads import WORKLOADS
+
+
+def make_device(name):
+    """Make the device to benchmark."""
+    if name == 'GPU':
+        return hoomd.device.GPU()
+    return hoomd.device.CPU()
+
+
+def autotuned_objects(simulation):
+    """Iterate over the operations and their children that have autotuners."""
+    operations = list(simulation.operations)
+    integrator = simulation.operations.integrator
+    for attribute in ('forces', 'methods', 'constraints'):
+        operations.extend(getattr(integrator, attribute, []))
+
+    for force in list(operations):
+        nlist = getattr(force, 'nlist', None)
+        if nlist is not None and all(nlist is not op for op in operations):
+            operations.append(nlist)
+
+    for operation in operations:
+        cpp_obj = getattr(operation, '_cpp_obj', None)
+        if hasattr(cpp_obj, 'getAutotunerTimes'):
+            yield operation
+
+
+def total_energy(simulation):
+    """Get the total energy per particle, or None without a thermo compute."""
+    for compute in simulation.operations.computes:
+        if isinstance(compute, hoomd.md.compute.ThermodynamicQuantities):
+            energy = compute.kinetic_energy + compute.potential_energy
+            return energy / simulation.state.N_particles
+    return None
+
+
+def run_workload(name, device_name, steps, repeat, warmup):
+    """Run one workload in this process and return its result."""
+    function, argument = WORKLOADS[name]
+    device = make_device(device_name)
+    simulation = function(device, argument)
+
+    # let the autotuners converge before timing
+    simulation.run(0)
+    warmup_steps = 0
+    while (not simulation.operations.is_tuning_complete
+           and warmup_steps < warmup):
+        simulation.run(100)
+        warmup_steps += 100
+
+    N = simulation.state.N_particles
+    if steps is None:
+        steps = min(max(int(2e7 / N), 100), 5000)
+
+    initial_energy = total_energy(simulation)
+    tps = []
+    for i in range(repeat):
+        simulation.run(steps)
+        tps.append(simulation.tps)
+
+    kernel_times = {}
+    for operation in autotuned_objects(simulation):
+        for kernel, time in operation.kernel_times.items():
+            kernel_times[f'{type(operation).__name__}.{kernel}'] = time
+
+    # ru_maxrss is in kilobytes on Linux and bytes on macOS
+    peak_memory = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    if sys.platform != 'darwin':
+        peak_memory *= 1024
+
+    result = dict(name=name,
+                  device=device_name,
+                  N=N,
+                  steps=steps,
+                  repeat=repeat,
+                  warmup_steps=warmup_steps,
+                  tps=statistics.median(tps),
+                  tps_samples=tps,
+                  kernel_times_ms=kernel_times,
+                  peak_memory_bytes=peak_memory,
+                  device_description=device.device)
+
+    # constant energy workloads report the drift of the total energy per
+    # particle per time step, to compare the accuracy of builds
+    if initial_energy is not None:
+        result['energy_drift'] = ((total_energy(simulation) - initial_energy)
+                                  / (steps * repeat))
+
+    return result
+
+
+def run_mpcd_benchmark(executable, device_name):
+    """Run the MPCD benchmark executable and parse its results."""
+    command = [executable]
+    if device_name == 'GPU':
+        command.append('--gpu')
+    output = subprocess.run(command,
+                            check=True,
+                            capture_output=True,
+                            text=True).stdout
+    return [json.loads(line) for line in output.splitlines() if line]
+
+
+def build_information():
+    """Describe the build so that results can be compared across builds."""
+    return dict(version=hoomd.version.version,
+                git_sha1=hoomd.version.git_sha1,
+                git_branch=hoomd.version.git_branch,
+                compile_flags=hoomd.version.compile_flags,
+                cxx_compiler=hoomd.version.cxx_compiler,
+                gpu_platform=hoomd.version.gpu_platform,
+                floating_point_precision=hoomd.version.floating_point_precision)
+
+
+def main():
+    """Parse the command line and run the requested workloads."""
+    parser = argparse.ArgumentParser(prog='python3 -m benchmarks',
+                                     description='Run HOOMD-blue benchmarks.')
+    parser.add_argument('--device', choices=('CPU', 'GPU'), default='CPU')
+    parser.add_argument('--benchmarks',
+                        nargs='+',
+                        choices=sorted(WORKLOADS),
+                        default=sorted(WORKLOADS),
+                        metavar='NAME',
+                        help='Workloads to run (default: all).')
+    parser.add_argument('--steps',
+                        type=int,
+                        help='Time steps per timed run (default: scaled by N).')
+    parser.add_argument('--repeat',
+                        type=int,
+                        default=3,
+                        help='Number of timed runs.')
+    parser.add_argument('--warmup',
+                        type=int,
+                        default=20000,
+                        help='Maximum number of steps to wait for tuning.')
+    parser.add_argument('--output', help='JSON file to write.')
+    parser.add_argument('--mpcd-benchmark',
+                        help='Path to the mpcd_benchmark executable.')
+    parser.add_argument('--single', help=argparse.SUPPRESS)
+    args = parser.parse_args()
+
+    if args.single is not None:
+        result = run_workload(args.single, args.device, args.steps,
+                              args.repeat, args.warmup)
+        print(json.dumps(result))
+        return
+
+    results = []
+    for name in args.benchmarks:
+        print(f'Running {name}', file=sys.stderr)
+        command = [
+            sys.executable, '-m', 'benchmarks', '--single', name, '--device',
+            args.device, '--repeat',
+            str(args.repeat), '--warmup',
+            str(args.warmup)
+        ]
+        if args.steps is not None:
+            command.extend(['--steps', str(args.steps)])
+        output = subprocess.run(command,
+                                check=True,
+                                capture_output=True,
+                                text=True).stdout
+        results.append(json.loads(output.splitlines()[-1]))
+
+    if args.mpcd_benchmark is not None:
+        print('Running mpcd_benchmark', file=sys.stderr)
+        results.extend(run_mpcd_benchmark(args.mpcd_benchmark, args.device))
+
+    document = dict(schema='hoomd-benchmarks',
+                    build=build_information(),
+                    device=args.device,
+                    results=results)
+
+    if args.output is None:
+        json.dump(document, sys.stdout, indent=2)
+        print()
+    else:
+        with open(args.output, 'w') as f:
+            json.dump(document, f, indent=2)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,255 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file mpcd_benchmark.cc
+    \brief Times the MPCD streaming and collision kernels
+
+    Each workload fills a cubic box with solvent particles at a fixed density and seed, then
+    alternates streaming and SRD collision steps. The program prints one JSON object per workload
+    to standard output: the mean time per step of each phase in milliseconds and the resulting time
+    steps per second. The benchmark suite (python -m benchmarks) collects this output.
+
+    Usage: mpcd_benchmark [--gpu] [--steps N] [--warmup N]
+*/
+
+#include "hoomd/ExecutionConfiguration.h"
+#include "hoomd/RandomNumbers.h"
+#include "hoomd/SnapshotSystemData.h"
+#include "hoomd/SystemDefinition.h"
+#include "hoomd/mpcd/BulkGeometry.h"
+#include "hoomd/mpcd/CellList.h"
+#include "hoomd/mpcd/ConfinedStreamingMethod.h"
+#include "hoomd/mpcd/CosineChannelGeometry.h"
+#include "hoomd/mpcd/SRDCollisionMethod.h"
+#ifdef ENABLE_HIP
+#include "hoomd/mpcd/ConfinedStreamingMethodGPU.h"
+#include "hoomd/mpcd/SRDCollisionMethodGPU.h"
+#endif
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+using namespace hoomd;
+
+//! Parameters that define a workload
+struct Workload
+    {
+    std::string name; //!< Name reported in the output
+    Scalar L;         //!< Box length
+    bool channel;     //!< Confine the solvent in a cosine channel
+    };
+
+//! Solvent density (particles per cell)
+const Scalar density = 5.0;
+
+//! Cosine channel amplitude (in units of L)
+const Scalar channel_amplitude = 0.1;
+
+//! Cosine channel half width (in units of L)
+const Scalar channel_h = 0.2;
+
+//! Make a snapshot with solvent particles at the benchmark density
+/*! \param workload Parameters of the workload
+    \returns The snapshot
+
+    The particle positions are uniform in the box (or in the channel) and the velocities are
+    normally distributed with kT = 1. The generator seed is fixed so that every run benchmarks the
+    same configuration.
+*/
+std::shared_ptr<SnapshotSystemData<Scalar>> make_snapshot(const Workload& workload)
+    {
+    auto snap = std::make_shared<SnapshotSystemData<Scalar>>();
+    snap->global_box = std::make_shared<BoxDim>(workload.L);
+    snap->particle_data.type_mapping.push_back("A");
+    snap->mpcd_data.type_mapping.push_back("A");
+
+    const Scalar L = workload.L;
+    const Scalar A = channel_amplitude * L;
+    const Scalar h = channel_h * L;
+    const Scalar volume = workload.channel ? Scalar(2.0) * h * L * L : L * L * L;
+    const unsigned int N = (unsigned int)std::lround(density * volume);
+    snap->mpcd_data.resize(N);
+
+    RandomGenerator rng(hoomd::Seed(0, 0, 42), hoomd::Counter());
+    UniformDistribution<Scalar> uniform(-L / Scalar(2.0), L / Scalar(2.0));
+    UniformDistribution<Scalar> uniform_h(-h, h);
+    NormalDistribution<Scalar> normal(Scalar(1.0));
+    const Scalar k = Scalar(2.0 * M_PI) / L;
+    for (unsigned int i = 0; i < N; ++i)
+        {
+        const Scalar x = uniform(rng);
+        const Scalar y = uniform(rng);
+        const Scalar z = workload.channel ? A * std::cos(k * x) + uniform_h(rng) : uniform(rng);
+        snap->mpcd_data.position[i] = vec3<Scalar>(x, y, z);
+        snap->mpcd_data.velocity[i] = vec3<Scalar>(normal(rng), normal(rng), normal(rng));
+        }
+
+    return snap;
+    }
+
+//! Wait for the kernels of the previous phase to complete
+void synchronize(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+#ifdef ENABLE_HIP
+    if (exec_conf->isCUDAEnabled())
+        {
+        hipDeviceSynchronize();
+        }
+#endif
+    }
+
+//! Time a streaming method and the SRD collision method on a workload
+template<class Geometry, class SM, class CM>
+void run_workload(const Workload& workload,
+                  std::shared_ptr<ExecutionConfiguration> exec_conf,
+                  std::shared_ptr<const Geometry> geom,
+                  unsigned int warmup,
+                  unsigned int steps)
+    {
+    auto sysdef = std::make_shared<SystemDefinition>(make_snapshot(workload), exec_conf);
+    auto cl = std::make_shared<mpcd::CellList>(sysdef);
+
+    auto stream = std::make_shared<SM>(sysdef, 0, 1, 0, geom);
+    stream->setCellList(cl);
+    stream->setDeltaT(0.1);
+
+    auto collide = std::make_shared<CM>(sysdef, 0, 1, 0, 42);
+    collide->setCellList(cl);
+    collide->setRotationAngle(2.2689280275926285);
+
+    // let the autotuners settle before timing
+    uint64_t timestep = 0;
+    for (unsigned int i = 0; i < warmup; ++i, ++timestep)
+        {
+        collide->collide(timestep);
+        stream->stream(timestep);
+        }
+    synchronize(exec_conf);
+
+    std::chrono::duration<double, std::milli> stream_time(0), collide_time(0);
+    for (unsigned int i = 0; i < steps; ++i, ++timestep)
+        {
+        auto start = std::chrono::steady_clock::now();
+        collide->collide(timestep);
+        synchronize(exec_conf);
+        auto mid = std::chrono::steady_clock::now();
+        stream->stream(timestep);
+        synchronize(exec_conf);
+        auto end = std::chrono::steady_clock::now();
+
+        collide_time += mid - start;
+        stream_time += end - mid;
+        }
+
+    const double stream_ms = stream_time.count() / steps;
+    const double collide_ms = collide_time.count() / steps;
+    std::cout << "{\"name\": \"" << workload.name << "\", \"device\": \""
+              << (exec_conf->isCUDAEnabled() ? "GPU" : "CPU")
+              << "\", \"N\": " << sysdef->getMPCDParticleData()->getNGlobal()
+              << ", \"steps\": " << steps << ", \"stream_ms\": " << stream_ms
+              << ", \"collide_ms\": " << collide_ms
+              << ", \"tps\": " << 1000.0 / (stream_ms + collide_ms) << "}" << std::endl;
+    }
+
+//! Run all workloads on one device type
+template<template<class> class SM, class CM>
+void run_all(std::shared_ptr<ExecutionConfiguration> exec_conf,
+             unsigned int warmup,
+             unsigned int steps)
+    {
+    const auto bc = mpcd::detail::boundary::no_slip;
+    for (Scalar L : {Scalar(20.0), Scalar(50.0)})
+        {
+        const std::string suffix = "_L" + std::to_string(int(L));
+
+        Workload bulk {"mpcd_bulk" + suffix, L, false};
+        run_workload<mpcd::detail::BulkGeometry, SM<mpcd::detail::BulkGeometry>, CM>(
+            bulk,
+            exec_conf,
+            std::make_shared<const mpcd::detail::BulkGeometry>(),
+            warmup,
+            steps);
+
+        Workload channel {"mpcd_cosine_channel" + suffix, L, true};
+        auto geom = std::make_shared<const mpcd::detail::CosineChannel>(L,
+                                                                       channel_amplitude * L,
+                                                                       channel_h * L,
+                                                                       1,
+                                                                       bc);
+        run_workload<mpcd::detail::CosineChannel, SM<mpcd::detail::CosineChannel>, CM>(
+            channel,
+            exec_conf,
+            geom,
+            warmup,
+            steps);
+        }
+    }
+
+int main(int argc, char** argv)
+    {
+#ifdef ENABLE_MPI
+    MPI_Init(&argc, &argv);
+#endif
+
+    bool gpu = false;
+    unsigned int steps = 200;
+    unsigned int warmup = 2000;
+    for (int i = 1; i < argc; ++i)
+        {
+        if (std::strcmp(argv[i], "--gpu") == 0)
+            {
+            gpu = true;
+            }
+        else if (std::strcmp(argv[i], "--steps") == 0 && i + 1 < argc)
+            {
+            steps = (unsigned int)std::atoi(argv[++i]);
+            }
+        else if (std::strcmp(argv[i], "--warmup") == 0 && i + 1 < argc)
+            {
+            warmup = (unsigned int)std::atoi(argv[++i]);
+            }
+        else
+            {
+            std::cerr << "Usage: " << argv[0] << " [--gpu] [--steps N] [--warmup N]" << std::endl;
+            return 1;
+            }
+        }
+
+    if (steps == 0)
+        {
+        std::cerr << "--steps must be positive." << std::endl;
+        return 1;
+        }
+
+    int result = 0;
+        {
+        if (gpu)
+            {
+#ifdef ENABLE_HIP
+            auto exec_conf = std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU);
+            run_all<mpcd::ConfinedStreamingMethodGPU, mpcd::SRDCollisionMethodGPU>(exec_conf,
+                                                                                 warmup,
+                                                                                 steps);
+#else
+            std::cerr << "This build does not support GPUs." << std::endl;
+            result = 1;
+#endif
+            }
+        else
+            {
+            auto exec_conf = std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU);
+            run_all<mpcd::ConfinedStreamingMethod, mpcd::SRDCollisionMethod>(exec_conf,
+                                                                           warmup,
+                                                                           steps);
+            }
+        }
+
+#ifdef ENABLE_MPI
+    MPI_Finalize();
+#endif
+    return result;
+    }
@@ -0,0 +1,198 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Standard benchmark workloads.
+
+Each workload function takes a `hoomd.device.Device` and returns a
+`hoomd.Simulation` ready to run. The initial configurations are simple cubic
+lattices and all random number seeds are fixed, so every run of a workload
+performs the same computation.
+"""
+
+import atexit
+import os
+import shutil
+import tempfile
+
+import numpy
+
+import hoomd
+
+# number of particles per lattice side for the workloads with several sizes
+SIZES = (16, 32, 64)
+
+
+def make_lattice_snapshot(device, n, spacing, charged=False):
+    """Make a snapshot with particles on a simple cubic lattice.
+
+    Args:
+        device (hoomd.device.Device): Device to make the snapshot on.
+        n (int): Number of particles per side.
+        spacing (float): Lattice spacing.
+        charged (bool): Assign alternating charges of +1 and -1.
+    """
+    snapshot = hoomd.Snapshot(device.communicator)
+    if snapshot.communicator.rank == 0:
+        L = n * spacing
+        x = (numpy.arange(n) + 0.5) * spacing - L / 2
+        position = numpy.array(numpy.meshgrid(x, x, x, indexing='ij'))
+
+        snapshot.configuration.box = [L, L, L, 0, 0, 0]
+        snapshot.particles.N = n**3
+        snapshot.particles.types = ['A']
+        snapshot.particles.position[:] = position.reshape(3, -1).T
+        if charged:
+            snapshot.particles.charge[:] = 1 - 2 * (numpy.arange(n**3) % 2)
+
+    return snapshot
+
+
+def make_simulation(device, snapshot):
+    """Make a simulation with a fixed seed from a snapshot."""
+    simulation = hoomd.Simulation(device=device, seed=1)
+    simulation.create_state_from_snapshot(snapshot)
+    return simulation
+
+
+def make_lj_integrator(buffer=0.4, charged=False):
+    """Make an NVT integrator for the LJ liquid.
+
+    Args:
+        buffer (float): Neighbor list buffer distance.
+        charged (bool): Add PPPM Coulomb forces.
+    """
+    nlist = hoomd.md.nlist.Cell(buffer=buffer)
+    lj = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+    lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+    forces = [lj]
+
+    if charged:
+        real_space, reciprocal_space = (
+            hoomd.md.long_range.pppm.make_pppm_coulomb_forces(
+                nlist=nlist, resolution=(32, 32, 32), order=5, r_cut=2.5))
+        forces.extend([real_space, reciprocal_space])
+
+    nvt = hoomd.md.methods.ConstantVolume(
+        filter=hoomd.filter.All(),
+        thermostat=hoomd.md.methods.thermostats.Bussi(kT=1.2))
+    return hoomd.md.Integrator(dt=0.005, methods=[nvt], forces=forces)
+
+
+def lj_liquid(device, n):
+    """Lennard-Jones liquid at density 0.8."""
+    spacing = 0.8**(-1 / 3)
+    snapshot = make_lattice_snapshot(device, n, spacing)
+    simulation = make_simulation(device, snapshot)
+    simulation.state.thermalize_particle_momenta(filter=hoomd.filter.All(),
+                                                 kT=1.2)
+    simulation.operations.integrator = make_lj_integrator()
+    return simulation
+
+
+def lj_nve(device, n):
+    """Lennard-Jones liquid at constant energy.
+
+    The potential is shifted to zero at the cutoff, so the drift of the total
+    energy measures the accuracy of the integration.
+    """
+    spacing = 0.8**(-1 / 3)
+    snapshot = make_lattice_snapshot(device, n, spacing)
+    simulation = make_simulation(device, snapshot)
+    simulation.state.thermalize_particle_momenta(filter=hoomd.filter.All(),
+                                                 kT=1.2)
+
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2.5, mode='shift')
+    lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+    nve = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())
+    simulation.operations.integrator = hoomd.md.Integrator(dt=0.005,
+                                                           methods=[nve],
+                                                           forces=[lj])
+
+    thermo = hoomd.md.compute.ThermodynamicQuantities(
+        filter=hoomd.filter.All())
+    simulation.operations.computes.append(thermo)
+    return simulation
+
+
+def neighbor_list(device, n):
+    """Lennard-Jones liquid that rebuilds the neighbor list on every step."""
+    spacing = 0.8**(-1 / 3)
+    snapshot = make_lattice_snapshot(device, n, spacing)
+    simulation = make_simulation(device, snapshot)
+    simulation.state.thermalize_particle_momenta(filter=hoomd.filter.All(),
+                                                 kT=1.2)
+    simulation.operations.integrator = make_lj_integrator(buffer=0)
+    return simulation
+
+
+def pppm(device, n):
+    """Charged Lennard-Jones liquid with PPPM electrostatics."""
+    spacing = 0.8**(-1 / 3)
+    simulation = make_simulation(
+        device, make_lattice_snapshot(device, n, spacing, charged=True))
+    simulation.state.thermalize_particle_momenta(filter=hoomd.filter.All(),
+                                                 kT=1.2)
+    simulation.operations.integrator = make_lj_integrator(charged=True)
+    return simulation
+
+
+def hpmc_sphere(device, n):
+    """Hard spheres at packing fraction 0.39."""
+    simulation = make_simulation(device, make_lattice_snapshot(device, n, 1.1))
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0.1)
+    mc.shape['A'] = dict(diameter=1.0)
+    simulation.operations.integrator = mc
+    return simulation
+
+
+def hpmc_polyhedron(device, n):
+    """Hard cubes on a dilute lattice."""
+    simulation = make_simulation(device, make_lattice_snapshot(device, n, 1.8))
+    mc = hoomd.hpmc.integrate.ConvexPolyhedron(default_d=0.1, default_a=0.1)
+    mc.shape['A'] = dict(vertices=[(x, y, z) for x in (-0.5, 0.5)
+                                   for y in (-0.5, 0.5)
+                                   for z in (-0.5, 0.5)])
+    simulation.operations.integrator = mc
+    return simulation
+
+
+def gsd_write(device, n):
+    """Write a GSD frame with positions and momenta on every step.
+
+    There is no integrator, so the time step loop only executes the writer.
+    """
+    spacing = 0.8**(-1 / 3)
+    snapshot = make_lattice_snapshot(device, n, spacing)
+    simulation = make_simulation(device, snapshot)
+    directory = tempfile.mkdtemp(prefix='hoomd-benchmark-')
+    atexit.register(shutil.rmtree, directory, ignore_errors=True)
+    filename = os.path.join(directory, 'trajectory.gsd')
+    gsd = hoomd.write.GSD(trigger=hoomd.trigger.Periodic(1),
+                          filename=filename,
+                          mode='wb',
+                          dynamic=['property', 'momentum'])
+    simulation.operations.writers.append(gsd)
+    return simulation
+
+
+def _make_workloads():
+    workloads = {}
+    md = {
+        'lj_liquid': lj_liquid,
+        'neighbor_list': neighbor_list,
+    }
+    for name, function in md.items():
+        for n in SIZES:
+            workloads[f'{name}_N{n**3}'] = (function, n)
+
+    workloads[f'lj_nve_N{32**3}'] = (lj_nve, 32)
+    workloads[f'pppm_N{32**3}'] = (pppm, 32)
+    workloads[f'hpmc_sphere_N{32**3}'] = (hpmc_sphere, 32)
+    workloads[f'hpmc_polyhedron_N{32**3}'] = (hpmc_polyhedron, 32)
+    workloads[f'gsd_write_N{32**3}'] = (gsd_write, 32)
+    return workloads
+
+
+#: dict[str, tuple]: Map workload names to the function and its argument.
+WORKLOADS = _make_workloads()
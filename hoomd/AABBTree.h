@@ -8,6 +8,11 @@
 
 #include "AABB.h"
 
+#if defined(ENABLE_TBB) && !defined(__HIPCC__)
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+#endif
+
 #ifndef __AABB_TREE_H__
 #define __AABB_TREE_H__
 
@@ -31,6 +36,9 @@ namespace detail
 const unsigned int NODE_CAPACITY = 16;        //!< Maximum number of particles in a node
 const unsigned int INVALID_NODE = 0xffffffff; //!< Invalid node index sentinel
 
+//! Smallest number of AABBs for which buildTree() builds the children of a node in parallel
+const unsigned int PARALLEL_BUILD_MIN_SIZE = 4096;
+
 #ifndef __HIPCC__
 
 //! Node in an AABBTree
@@ -73,15 +81,22 @@ struct PYBIND11_EXPORT AABBNode
    periodically instead of continually updated.
     - buildTree : build an efficiently arranged tree given a complete set of AABBs, one for each
    particle.
+    - Refit : Recompute the bounds of every node from a complete set of AABBs, keeping the tree
+   topology. Runs in O(N) time. The bounds are tight, but the tree quality degrades as particles
+   move away from their original positions. Use getSurfaceArea() to decide when to rebuild.
 
     **Implementation details**
 
-    AABBTree stores all nodes in a flat array managed by std::vector. To easily locate particle leaf
-   nodes for update, a reverse mapping is stored to locate the leaf node containing a particle.
-   m_root tracks the index of the root node as the tree is built. The nodes store the indices of
-   their left and right children along with their AABB. Nodes are allocated as needed with
-   allocate(). With multiple particles per leaf node, the total number of internal nodes needed is
-   not known (but can be estimated) until build time.
+    AABBTree stores all nodes in a flat array. To easily locate particle leaf nodes for update, a
+   reverse mapping is stored to locate the leaf node containing a particle. m_root tracks the index
+   of the root node as the tree is built. The nodes store the indices of their left and right
+   children along with their AABB. With multiple particles per leaf node, the total number of
+   internal nodes needed is not known (but can be estimated) until build time, so the nodes are
+   built into a std::vector and copied into the flat array.
+
+    With TBB, buildTree() can build the two children of large nodes as parallel tasks. Each task
+   builds its subtree into its own list, and the lists are spliced in depth-first order, so the
+   tree is identical to the serial build.
 
     For performance, no recursive calls are used. Instead, each function is either turned into a
    loop if it uses tail recursion, or it uses a local stack to traverse the tree. The stack is
@@ -155,15 +170,32 @@ class PYBIND11_EXPORT AABBTree
     //! Build a tree smartly from a list of AABBs
     inline void buildTree(AABB* aabbs, unsigned int N);
 
+#ifdef ENABLE_TBB
+    //! Build a tree smartly from a list of AABBs with the threads of a task arena
+    inline void buildTree(AABB* aabbs, unsigned int N, tbb::task_arena& arena);
+#endif
+
     //! Find all particles that overlap with the query AABB
     inline unsigned int query(std::vector<unsigned int>& hits, const AABB& aabb) const;
 
     //! Update the AABB of a particle
     inline void update(unsigned int idx, const AABB& aabb);
 
+    //! Recompute the node bounds from a list of AABBs
+    inline void refit(const AABB* aabbs, unsigned int N);
+
+    //! Get the sum of the surface areas of all nodes
+    inline Scalar getSurfaceArea() const;
+
     //! Get the height of a given particle's leaf node
     inline unsigned int height(unsigned int idx);
 
+    //! Get the number of particles in the tree
+    inline unsigned int getNumParticles() const
+        {
+        return (unsigned int)m_mapping.size();
+        }
+
     //! Get the number of nodes
     inline unsigned int getNumNodes() const
         {
@@ -245,6 +277,9 @@ class PYBIND11_EXPORT AABBTree
     /// Temporary index list used to build the AABB tree.
     std::vector<unsigned int> m_idx;
 
+    /// Temporary node list used to build the AABB tree.
+    std::vector<AABBNode> m_build_nodes;
+
     /// Temporary index list used when partitioning nodes.
     std::vector<unsigned int> m_idx_right;
 
@@ -254,15 +289,37 @@ class PYBIND11_EXPORT AABBTree
     //! Initialize the tree to hold N particles
     inline void init(unsigned int N);
 
-    //! Build a node of the tree recursively
-    inline unsigned int buildNode(AABB* aabbs,
-                                  std::vector<unsigned int>& idx,
-                                  unsigned int start,
-                                  unsigned int len,
-                                  unsigned int parent);
+    //! Build a node of the tree and its children recursively
+    static inline unsigned int buildNode(std::vector<AABBNode>& nodes,
+                                         AABB* aabbs,
+                                         unsigned int* idx,
+                                         unsigned int len,
+                                         unsigned int parent,
+                                         std::vector<AABB>& aabb_right,
+                                         std::vector<unsigned int>& idx_right);
+
+#ifdef ENABLE_TBB
+    //! Build a node of the tree and its children recursively, with parallel children
+    static inline void buildNodeParallel(std::vector<AABBNode>& nodes,
+                                         AABB* aabbs,
+                                         unsigned int* idx,
+                                         unsigned int len);
+#endif
+
+    //! Add a leaf node or partition the AABBs of an internal node
+    static inline unsigned int addNode(std::vector<AABBNode>& nodes,
+                                       AABB* aabbs,
+                                       unsigned int* idx,
+                                       unsigned int len,
+                                       unsigned int parent,
+                                       std::vector<AABB>& aabb_right,
+                                       std::vector<unsigned int>& idx_right);
 
-    //! Allocate a new node
-    inline unsigned int allocateNode();
+    //! Start a build
+    inline void beginBuild(unsigned int N);
+
+    //! Finish a build by copying the nodes to the flat array
+    inline void finishBuild();
 
     //! Update the skip value for a node
     inline unsigned int updateSkip(unsigned int idx);
@@ -357,6 +414,55 @@ inline void AABBTree::update(unsigned int idx, const AABB& aabb)
         }
     }
 
+/*! \param aabbs List of AABBs for each particle
+    \param N Number of AABBs in the list (must match the number of particles in the tree)
+
+    Set the bounds of each leaf node to the merged AABBs of its particles, then set the bounds of
+   each internal node to the merged bounds of its children. buildNode() appends every node before
+   its children, so a reverse pass over the node array visits the children first. refit() does not
+   change the tree topology and does not modify \a aabbs.
+*/
+inline void AABBTree::refit(const AABB* aabbs, unsigned int N)
+    {
+    assert(N == m_mapping.size());
+
+    for (unsigned int i = m_num_nodes; i > 0; i--)
+        {
+        AABBNode& node = m_nodes[i - 1];
+        if (node.left == INVALID_NODE)
+            {
+            assert(node.num_particles > 0);
+            node.aabb = aabbs[node.particles[0]];
+            node.particle_tags[0] = aabbs[node.particles[0]].tag;
+            for (unsigned int j = 1; j < node.num_particles; j++)
+                {
+                node.aabb = merge(node.aabb, aabbs[node.particles[j]]);
+                node.particle_tags[j] = aabbs[node.particles[j]].tag;
+                }
+            }
+        else
+            {
+            node.aabb = merge(m_nodes[node.left].aabb, m_nodes[node.right].aabb);
+            }
+        }
+    }
+
+/*! \returns The total surface area of all node bounds
+
+    The cost of a query in the surface area heuristic is proportional to this sum. Compare the value
+   after refit() to the value right after buildTree() to measure how much the tree has degraded.
+*/
+inline Scalar AABBTree::getSurfaceArea() const
+    {
+    Scalar area = Scalar(0.0);
+    for (unsigned int i = 0; i < m_num_nodes; i++)
+        {
+        vec3<Scalar> d = m_nodes[i].aabb.getUpper() - m_nodes[i].aabb.getLower();
+        area += Scalar(2.0) * (d.x * d.y + d.y * d.z + d.z * d.x);
+        }
+    return area;
+    }
+
 /*! \param idx Particle to get height for
     \returns Height of the node
 */
@@ -391,75 +497,248 @@ inline unsigned int AABBTree::height(unsigned int idx)
    modified during the construction process.
 */
 inline void AABBTree::buildTree(AABB* aabbs, unsigned int N)
+    {
+    beginBuild(N);
+    buildNode(m_build_nodes, aabbs, m_idx.data(), N, INVALID_NODE, m_aabb_right, m_idx_right);
+    finishBuild();
+    }
+
+#ifdef ENABLE_TBB
+/*! \param aabbs List of AABBs for each particle (must be 32-byte aligned)
+    \param N Number of AABBs in the list
+    \param arena Task arena to build the tree in
+
+    Builds the same tree as buildTree(AABB*, unsigned int). The children of nodes with at least
+   PARALLEL_BUILD_MIN_SIZE AABBs are built as parallel tasks, so small trees are built serially.
+*/
+inline void AABBTree::buildTree(AABB* aabbs, unsigned int N, tbb::task_arena& arena)
+    {
+    if (N < PARALLEL_BUILD_MIN_SIZE || arena.max_concurrency() < 2)
+        {
+        buildTree(aabbs, N);
+        return;
+        }
+
+    beginBuild(N);
+    arena.execute([&] { buildNodeParallel(m_build_nodes, aabbs, m_idx.data(), N); });
+    finishBuild();
+    }
+#endif
+
+/*! \param N Number of AABBs to build the tree from
+ */
+inline void AABBTree::beginBuild(unsigned int N)
     {
     init(N);
 
-    m_idx.clear();
-    m_idx.reserve(N);
+    m_idx.resize(N);
     for (unsigned int i = 0; i < N; i++)
-        m_idx.push_back(i);
+        m_idx[i] = i;
+
+    m_build_nodes.clear();
+    }
+
+/*! Copies the built nodes to the flat node array, sets the reverse mapping from particle indices
+   to leaf nodes, and updates the skip values. The root node is always built first.
+*/
+inline void AABBTree::finishBuild()
+    {
+    const unsigned int num_nodes = (unsigned int)m_build_nodes.size();
+    if (num_nodes > m_node_capacity)
+        {
+        // grow the memory geometrically so that slowly growing trees rarely reallocate
+        unsigned int new_node_capacity = std::max(num_nodes, m_node_capacity * 2);
+        AABBNode* new_nodes = NULL;
+        int retval = posix_memalign((void**)&new_nodes, 32, new_node_capacity * sizeof(AABBNode));
+        if (retval != 0)
+            {
+            throw std::runtime_error("Error allocating AABBTree memory");
+            }
+
+        if (m_nodes != NULL)
+            free(m_nodes);
+        m_nodes = new_nodes;
+        m_node_capacity = new_node_capacity;
+        }
+
+    std::copy(m_build_nodes.begin(), m_build_nodes.end(), m_nodes);
+    m_num_nodes = num_nodes;
+
+    for (unsigned int i = 0; i < m_num_nodes; i++)
+        {
+        if (m_nodes[i].left == INVALID_NODE)
+            {
+            for (unsigned int j = 0; j < m_nodes[i].num_particles; j++)
+                m_mapping[m_nodes[i].particles[j]] = i;
+            }
+        }
 
-    m_root = buildNode(aabbs, m_idx, 0, N, INVALID_NODE);
+    m_root = 0;
     updateSkip(m_root);
     }
 
-/*! \param aabbs List of AABBs
-    \param idx List of indices
-    \param start Start point in aabbs and idx to examine
+/*! \param nodes List of nodes to append the new nodes to
+    \param aabbs List of AABBs of the node
+    \param idx List of particle indices of the node
     \param len Number of aabbs to examine
-    \param parent Index of the parent node
+    \param parent Index of the parent node in \a nodes
+    \param aabb_right Temporary AABB list used when partitioning nodes
+    \param idx_right Temporary index list used when partitioning nodes
+    \returns Index of the new node in \a nodes
 
     buildNode is the main driver of the smart AABB tree build algorithm. Each call produces a node,
-   given a set of AABBs. If there are fewer AABBs than fit in a leaf, a leaf is generated. If there
-   are too many, the total AABB is computed and split on the largest length axis. The total tree is
-   built by recursive splitting.
-
-    The aabbs and idx lists are passed in by reference. Each node is given a subrange of the list to
-   own (start to start + len). When building the node, it partitions its subrange into two sides
-   (like quick sort).
+   given a set of AABBs, and then builds its children. The total tree is built by recursive
+   splitting, and the nodes are appended to \a nodes in depth-first order.
 */
-inline unsigned int AABBTree::buildNode(AABB* aabbs,
-                                        std::vector<unsigned int>& idx,
-                                        unsigned int start,
+inline unsigned int AABBTree::buildNode(std::vector<AABBNode>& nodes,
+                                        AABB* aabbs,
+                                        unsigned int* idx,
                                         unsigned int len,
-                                        unsigned int parent)
+                                        unsigned int parent,
+                                        std::vector<AABB>& aabb_right,
+                                        std::vector<unsigned int>& idx_right)
+    {
+    const unsigned int my_idx = (unsigned int)nodes.size();
+    const unsigned int start_right = addNode(nodes, aabbs, idx, len, parent, aabb_right, idx_right);
+    if (start_right == 0)
+        return my_idx;
+
+    // note: calling buildNode appends to nodes, which may reallocate them. So we need to determine
+    // the left and right children, then connect our node (can't say nodes[my_idx].left =
+    // buildNode(...))
+    unsigned int new_left
+        = buildNode(nodes, aabbs, idx, start_right, my_idx, aabb_right, idx_right);
+    unsigned int new_right = buildNode(nodes,
+                                       aabbs + start_right,
+                                       idx + start_right,
+                                       len - start_right,
+                                       my_idx,
+                                       aabb_right,
+                                       idx_right);
+
+    nodes[my_idx].left = new_left;
+    nodes[my_idx].right = new_right;
+    return my_idx;
+    }
+
+#ifdef ENABLE_TBB
+/*! \param nodes List of nodes to append the new nodes to
+    \param aabbs List of AABBs of the node
+    \param idx List of particle indices of the node
+    \param len Number of aabbs to examine
+
+    Builds the same nodes as buildNode() for a node without a parent. For nodes with at least
+   PARALLEL_BUILD_MIN_SIZE AABBs, the children are built as parallel tasks into separate lists,
+   which are then appended to \a nodes with their indices offset.
+*/
+inline void AABBTree::buildNodeParallel(std::vector<AABBNode>& nodes,
+                                        AABB* aabbs,
+                                        unsigned int* idx,
+                                        unsigned int len)
+    {
+    std::vector<AABB> aabb_right;
+    std::vector<unsigned int> idx_right;
+    if (len < PARALLEL_BUILD_MIN_SIZE)
+        {
+        buildNode(nodes, aabbs, idx, len, INVALID_NODE, aabb_right, idx_right);
+        return;
+        }
+
+    const unsigned int my_idx = (unsigned int)nodes.size();
+    const unsigned int start_right
+        = addNode(nodes, aabbs, idx, len, INVALID_NODE, aabb_right, idx_right);
+
+    // free the partition lists before the children allocate their own
+    std::vector<AABB>().swap(aabb_right);
+    std::vector<unsigned int>().swap(idx_right);
+
+    std::vector<AABBNode> left_nodes, right_nodes;
+    tbb::task_group group;
+    group.run([&] { buildNodeParallel(left_nodes, aabbs, idx, start_right); });
+    buildNodeParallel(right_nodes, aabbs + start_right, idx + start_right, len - start_right);
+    group.wait();
+
+    // append the children in depth-first order after this node
+    const unsigned int left_offset = my_idx + 1;
+    const unsigned int right_offset = left_offset + (unsigned int)left_nodes.size();
+    nodes[my_idx].left = left_offset;
+    nodes[my_idx].right = right_offset;
+    nodes.reserve(nodes.size() + left_nodes.size() + right_nodes.size());
+
+    auto append = [&nodes, my_idx](const std::vector<AABBNode>& children, unsigned int offset)
+    {
+        for (AABBNode node : children)
+            {
+            node.parent = (node.parent == INVALID_NODE) ? my_idx : node.parent + offset;
+            if (node.left != INVALID_NODE)
+                {
+                node.left += offset;
+                node.right += offset;
+                }
+            nodes.push_back(node);
+            }
+    };
+    append(left_nodes, left_offset);
+    append(right_nodes, right_offset);
+    }
+#endif
+
+/*! \param nodes List of nodes to append the new node to
+    \param aabbs List of AABBs of the node
+    \param idx List of particle indices of the node
+    \param len Number of aabbs to examine
+    \param parent Index of the parent node in \a nodes
+    \param aabb_right Temporary AABB list used when partitioning nodes
+    \param idx_right Temporary index list used when partitioning nodes
+    \returns The number of AABBs in the left child, or 0 when the new node is a leaf
+
+    If there are fewer AABBs than fit in a leaf, a leaf is generated. If there are too many, the
+   total AABB is computed and split on the largest length axis.
+
+    The aabbs and idx lists are modified in place. An internal node partitions them into two sides
+   (like quick sort), which its children own.
+*/
+inline unsigned int AABBTree::addNode(std::vector<AABBNode>& nodes,
+                                      AABB* aabbs,
+                                      unsigned int* idx,
+                                      unsigned int len,
+                                      unsigned int parent,
+                                      std::vector<AABB>& aabb_right,
+                                      std::vector<unsigned int>& idx_right)
     {
     // merge all the AABBs into one
-    AABB my_aabb = aabbs[start];
+    AABB my_aabb = (len > 0) ? aabbs[0] : AABB();
     for (unsigned int i = 1; i < len; i++)
         {
-        my_aabb = merge(my_aabb, aabbs[start + i]);
+        my_aabb = merge(my_aabb, aabbs[i]);
         }
     vec3<Scalar> my_radius = my_aabb.getUpper() - my_aabb.getLower();
 
+    nodes.emplace_back();
+    AABBNode& new_node = nodes.back();
+    new_node.aabb = my_aabb;
+    new_node.parent = parent;
+
     // handle the case of a leaf node creation
     if (len <= NODE_CAPACITY)
         {
-        unsigned int new_node = allocateNode();
-        m_nodes[new_node].aabb = my_aabb;
-        m_nodes[new_node].parent = parent;
-        m_nodes[new_node].num_particles = len;
+        new_node.num_particles = len;
 
         for (unsigned int i = 0; i < len; i++)
             {
             // assign the particle indices into the leaf node
-            m_nodes[new_node].particles[i] = idx[start + i];
-            m_nodes[new_node].particle_tags[i] = aabbs[start + i].tag;
-
-            // assign the reverse mapping from particle indices to leaf node indices
-            m_mapping[idx[start + i]] = new_node;
+            new_node.particles[i] = idx[i];
+            new_node.particle_tags[i] = aabbs[i].tag;
             }
 
-        return new_node;
+        return 0;
         }
 
-    // otherwise, we are creating an internal node - allocate an index
-    unsigned int my_idx = allocateNode();
-
-    // need to split the list of aabbs into two sets for left and right
+    // otherwise, we are creating an internal node. Need to split the list of aabbs into two sets
+    // for left and right
     unsigned int left_insert_point = 0;
-    m_idx_right.clear();
-    m_aabb_right.clear();
+    idx_right.clear();
+    aabb_right.clear();
 
     // if there are only 2 aabbs, put one on each side
     if (len == 2)
@@ -477,17 +756,17 @@ inline unsigned int AABBTree::buildNode(AABB* aabbs,
             if (my_radius.x > my_radius.y && my_radius.x > my_radius.z)
                 {
                 // split on x direction
-                on_left = aabbs[start + i].getPosition().x < my_aabb.getPosition().x;
+                on_left = aabbs[i].getPosition().x < my_aabb.getPosition().x;
                 }
             else if (my_radius.y > my_radius.z)
                 {
                 // split on y direction
-                on_left = aabbs[start + i].getPosition().y < my_aabb.getPosition().y;
+                on_left = aabbs[i].getPosition().y < my_aabb.getPosition().y;
                 }
             else
                 {
                 // split on z direction
-                on_left = aabbs[start + i].getPosition().z < my_aabb.getPosition().z;
+                on_left = aabbs[i].getPosition().z < my_aabb.getPosition().z;
                 }
 
             if (on_left)
@@ -495,25 +774,25 @@ inline unsigned int AABBTree::buildNode(AABB* aabbs,
                 if (left_insert_point != i)
                     {
                     // Set the AABB and index at the insert point.
-                    aabbs[start + left_insert_point] = aabbs[start + i];
-                    idx[start + left_insert_point] = idx[start + i];
+                    aabbs[left_insert_point] = aabbs[i];
+                    idx[left_insert_point] = idx[i];
                     }
                 left_insert_point++;
                 }
             else
                 {
                 // Add the right side AABBs to a temporary list.
-                m_aabb_right.push_back(aabbs[start + i]);
-                m_idx_right.push_back(idx[start + i]);
+                aabb_right.push_back(aabbs[i]);
+                idx_right.push_back(idx[i]);
                 }
             }
 
-        assert(m_aabb_right.size() == m_idx_right.size());
-        assert(left_insert_point + m_aabb_right.size() == len);
+        assert(aabb_right.size() == idx_right.size());
+        assert(left_insert_point + aabb_right.size() == len);
 
         // Copy the right AABBs back into the list.
-        std::copy(m_aabb_right.begin(), m_aabb_right.end(), aabbs + start + left_insert_point);
-        std::copy(m_idx_right.begin(), m_idx_right.end(), idx.begin() + start + left_insert_point);
+        std::copy(aabb_right.begin(), aabb_right.end(), aabbs + left_insert_point);
+        std::copy(idx_right.begin(), idx_right.end(), idx + left_insert_point);
         }
 
     // sanity check. The left or right tree may have ended up empty. If so, just borrow one particle
@@ -524,19 +803,7 @@ inline unsigned int AABBTree::buildNode(AABB* aabbs,
     if (start_right == 0)
         start_right = 1;
 
-    // note: calling buildNode has side effects, the m_nodes array may be reallocated. So we need to
-    // determine the left and right children, then build our node (can't say m_nodes[my_idx].left =
-    // buildNode(...))
-    unsigned int new_left = buildNode(aabbs, idx, start, start_right, my_idx);
-    unsigned int new_right = buildNode(aabbs, idx, start + start_right, len - start_right, my_idx);
-
-    // now, create the children and connect them up
-    m_nodes[my_idx].aabb = my_aabb;
-    m_nodes[my_idx].parent = parent;
-    m_nodes[my_idx].left = new_left;
-    m_nodes[my_idx].right = new_right;
-
-    return my_idx;
+    return start_right;
     }
 
 /*! \param idx Index of the node to update
@@ -565,42 +832,6 @@ inline unsigned int AABBTree::updateSkip(unsigned int idx)
         }
     }
 
-/*! Allocates a new node in the tree
- */
-inline unsigned int AABBTree::allocateNode()
-    {
-    // grow the memory if needed
-    if (m_num_nodes >= m_node_capacity)
-        {
-        // determine new capacity
-        AABBNode* m_new_nodes = NULL;
-        unsigned int m_new_node_capacity = m_node_capacity * 2;
-        if (m_new_node_capacity == 0)
-            m_new_node_capacity = 16;
-
-        // allocate new memory
-        int retval
-            = posix_memalign((void**)&m_new_nodes, 32, m_new_node_capacity * sizeof(AABBNode));
-        if (retval != 0)
-            {
-            throw std::runtime_error("Error allocating AABBTree memory");
-            }
-
-        // if we have old memory, copy it over
-        if (m_nodes != NULL)
-            {
-            memcpy((void*)m_new_nodes, (void*)m_nodes, sizeof(AABBNode) * m_num_nodes);
-            free(m_nodes);
-            }
-        m_nodes = m_new_nodes;
-        m_node_capacity = m_new_node_capacity;
-        }
-
-    m_nodes[m_num_nodes] = AABBNode();
-    m_num_nodes++;
-    return m_num_nodes - 1;
-    }
-
 // end group overlap
 /*! @}*/
 
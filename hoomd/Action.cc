@@ -11,7 +11,8 @@ namespace detail
 void export_Action(pybind11::module& m)
     {
     pybind11::class_<Action, Autotuned, std::shared_ptr<Action>>(m, "Action")
-        .def(pybind11::init<std::shared_ptr<SystemDefinition>>());
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>>())
+        .def("getTimer", &Action::getTimer, pybind11::return_value_policy::reference_internal);
     }
     } // end namespace detail
 
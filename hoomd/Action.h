@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "Autotuned.h"
+#include "OperationTimer.h"
 #include "SharedSignal.h"
 #include "SystemDefinition.h"
 
@@ -25,13 +26,34 @@ namespace hoomd
     and interact with these autotuners, Action provides a pybind11 interface to get and set
     autotuner parameters for all child classes. Derived classes must add all autotuners to
     m_autotuners for the base class API to be effective.
+
+    Action also provides a timer that keeps statistics of the time spent per call. The run loop
+    times each call to Updater::update, Analyzer::analyze, and Integrator::update. Computes time
+    the calls that perform the computation (such as ForceCompute::computeForces).
 */
 class Action : public Autotuned
     {
     public:
     Action(std::shared_ptr<SystemDefinition> sysdef)
-        : m_sysdef(sysdef), m_pdata(sysdef->getParticleData()), m_exec_conf(m_pdata->getExecConf())
+        : m_sysdef(sysdef), m_pdata(sysdef->getParticleData()), m_exec_conf(m_pdata->getExecConf()),
+          m_timer(m_exec_conf)
+        {
+        }
+
+    /// Get the statistics of the time spent per call.
+    OperationTimer& getTimer()
         {
+        return m_timer;
+        }
+
+    /// Test whether the action calls into Python when it runs.
+    /*! The run loop holds the Python global interpreter lock (GIL) on time steps where such
+        actions run and releases it on other time steps. Actions that call into Python only
+        occasionally may return false, but must then acquire the GIL before each call.
+    */
+    virtual bool usesPython()
+        {
+        return false;
         }
 
     protected:
@@ -44,6 +66,9 @@ class Action : public Autotuned
     /// The simulation's execution configuration.
     std::shared_ptr<const ExecutionConfiguration> m_exec_conf;
 
+    /// Statistics of the time spent per call.
+    OperationTimer m_timer;
+
     /// Stored shared ptr to the system signals
     std::vector<std::shared_ptr<hoomd::detail::SignalSlot>> m_slots;
 
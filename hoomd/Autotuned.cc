@@ -13,6 +13,8 @@ void export_Autotuned(pybind11::module& m)
     pybind11::class_<Autotuned, std::shared_ptr<Autotuned>>(m, "Autotuned")
         .def(pybind11::init<>())
         .def("getAutotunerParameters", &Autotuned::getAutotunerParameters)
+        .def("getLockedAutotunerParameters", &Autotuned::getLockedAutotunerParameters)
+        .def("getAutotunerTimes", &Autotuned::getAutotunerTimes)
         .def("setAutotunerParameters", &Autotuned::setAutotunerParameters)
         .def("startAutotuning", &Autotuned::startAutotuning)
         .def("isAutotuningComplete", &Autotuned::isAutotuningComplete);
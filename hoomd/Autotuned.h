@@ -42,6 +42,33 @@ class PYBIND11_EXPORT Autotuned
         return params;
         }
 
+    /// Get the parameters of the autotuners that are locked.
+    pybind11::dict getLockedAutotunerParameters()
+        {
+        pybind11::dict params;
+
+        for (const auto& tuner : m_autotuners)
+            {
+            if (tuner->isLocked())
+                {
+                params[tuner->getName().c_str()] = tuner->getParameterPython();
+                }
+            }
+        return params;
+        }
+
+    /// Get the kernel times of the chosen autotuner parameters.
+    pybind11::dict getAutotunerTimes()
+        {
+        pybind11::dict times;
+
+        for (const auto& tuner : m_autotuners)
+            {
+            times[tuner->getName().c_str()] = tuner->getTunedTime();
+            }
+        return times;
+        }
+
     /// Set autotuner parameters.
     void setAutotunerParameters(pybind11::dict params)
         {
@@ -63,6 +90,15 @@ class PYBIND11_EXPORT Autotuned
             }
         }
 
+    /// Notify the autotuners of the number of elements their kernels process.
+    void setAutotunerProblemSize(uint64_t size)
+        {
+        for (const auto& tuner : m_autotuners)
+            {
+            tuner->setProblemSize(size);
+            }
+        }
+
     /// Start an autotuning sequence.
     virtual void startAutotuning()
         {
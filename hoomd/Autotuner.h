@@ -18,6 +18,8 @@
 #include <algorithm>
 #include <array>
 #include <cfloat>
+#include <cmath>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <sstream>
@@ -62,6 +64,21 @@ class PYBIND11_EXPORT AutotunerBase
         return true;
         }
 
+    /// Check if the autotuner holds a parameter that was chosen by a scan or set by the user.
+    virtual bool isLocked()
+        {
+        return true;
+        }
+
+    /// Notify the autotuner of the number of elements its kernel processes.
+    virtual void setProblemSize(uint64_t size) { }
+
+    /// Get the kernel time of the chosen parameter in milliseconds (0 when unknown).
+    virtual float getTunedTime()
+        {
+        return 0;
+        }
+
     /// Get the autotuner's name
     std::string getName()
         {
@@ -160,6 +177,25 @@ class PYBIND11_EXPORT AutotunerBase
     m_sample_center stores the current median of each set of samples. m_state lists the current
     state in the state machine.
 
+    Autotuners with several dimensions may have hundreds of valid parameters. Call
+    setMode(search_coordinate_descent) to search them with coordinate descent instead of sampling
+    every parameter: starting from the first (or current) parameter, the autotuner scans the
+    parameters that differ from the best one in a single dimension, moves to the fastest, and
+    repeats with the next dimension until a scan along every dimension keeps the same parameter.
+    After each round of samples along a line, parameters slower than m_reject_factor times the
+    fastest are rejected and not sampled again. m_candidates lists the parameter indices in the
+    current scan and m_current_element indexes into it. The exhaustive scan is the special case
+    where m_candidates holds all parameters and none are rejected.
+
+    The optimal parameter may change as the simulation evolves. When the ExecutionConfiguration
+    sets a positive autotuner drift threshold, an idle autotuner times every m_drift_interval-th
+    launch and keeps the last m_n_samples times in m_drift_samples. When the median of these exceeds
+    (1 + threshold) times m_tuned_time (the time of the parameter when the scan completed), or when
+    setProblemSize() reports a size that differs from the previous one by more than a factor of
+    about 1.4, the autotuner starts a local scan: coordinate descent from the current parameter
+    that only samples the m_local_radius nearest parameters on each side along each line. An
+    autotuner is not complete while the local scan runs.
+
     Some classes may activate some autotuners optionally based on run time parameters. Set
     *optional* to `true` and the Autotuner will report that it is complete before it starts
     scanning. This prevents the optional autotuners from flagging the whole class as not complete
@@ -195,7 +231,7 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
         m_exec_conf->msg->notice(4) << "Autotuner " << m_name << " starting scan." << std::endl;
         m_current_element = 0;
         m_current_sample = 0;
-        m_current_param = m_parameters[m_current_element];
+        m_local_scan = false;
 
         if (m_optional)
             {
@@ -205,6 +241,18 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
             {
             m_state = SCANNING;
             }
+
+        if (m_search == search_coordinate_descent)
+            {
+            startDescent();
+            }
+        else
+            {
+            m_candidates.resize(m_parameters.size());
+            for (size_t i = 0; i < m_parameters.size(); i++)
+                m_candidates[i] = i;
+            }
+        m_current_param = m_parameters[m_candidates[m_current_element]];
         }
 
     /// Call before kernel launch.
@@ -215,9 +263,21 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
             m_state = SCANNING;
             }
 
+        if (m_state == SCANNING && m_exec_conf->getTracer().isEnabled())
+            {
+            m_trace_start = m_exec_conf->getTracer().getTime();
+            }
+
+        // time an occasional launch to detect drift
+        if (m_state == IDLE && m_exec_conf->getAutotunerDriftThreshold() > 0)
+            {
+            m_drift_calls++;
+            m_drift_timing = m_drift_calls >= m_drift_interval;
+            }
+
 #ifdef ENABLE_HIP
-        // if we are scanning, record a cuda event - otherwise do nothing
-        if (m_state == SCANNING)
+        // if we are scanning or checking for drift, record a cuda event - otherwise do nothing
+        if (m_state == SCANNING || m_drift_timing)
             {
             hipEventRecord(m_start, 0);
             if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -282,6 +342,8 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
         m_current_param = cpp_param;
         m_state = IDLE;
         m_current_sample = 0;
+        m_local_scan = false;
+        resetDrift(0);
 
         m_exec_conf->msg->notice(4) << "Autotuner " << m_name << " setting user-defined parameter "
                                     << formatParam(cpp_param) << std::endl;
@@ -314,6 +376,46 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
             }
         }
 
+    /// Test if the parameter is locked.
+    /*! \returns true when a scan has completed or the user set the parameter. Optional autotuners
+        that have not started scanning are complete, but not locked.
+    */
+    virtual bool isLocked()
+        {
+        return m_state == IDLE;
+        }
+
+    /// Get the kernel time of the chosen parameter.
+    /*! \returns The median time in milliseconds that the last scan measured for the chosen
+        parameter, or 0 when no scan has completed.
+    */
+    virtual float getTunedTime()
+        {
+        return m_tuned_time;
+        }
+
+    /// Notify the autotuner of the number of elements its kernel processes.
+    /*! \param size Number of elements (such as particles) the kernel processes.
+
+        When drift detection is enabled, an idle autotuner starts a local scan when the size moves
+        to a different bucket (half steps of log2). Synchronized autotuners ignore the size because
+        it differs between ranks.
+    */
+    virtual void setProblemSize(uint64_t size)
+        {
+        int bucket = int(std::lround(2.0 * std::log2(double(std::max(size, uint64_t(1))))));
+        int previous_bucket = m_problem_bucket;
+        m_problem_bucket = bucket;
+
+        if (previous_bucket >= 0 && bucket != previous_bucket && m_state == IDLE && !m_sync
+            && m_exec_conf->getAutotunerDriftThreshold() > 0)
+            {
+            m_exec_conf->msg->notice(4) << "Autotuner " << m_name << " problem size changed to "
+                                        << size << "." << std::endl;
+            startLocalScan();
+            }
+        }
+
     /// Set flag for synchronization via MPI
     /*! \param sync If true, synchronize parameters across all MPI ranks
      */
@@ -338,9 +440,66 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
         m_mode = mode;
         }
 
+    /// Enumeration of search modes.
+    enum search_Enum
+        {
+        search_exhaustive = 0,    //!< Sample every parameter
+        search_coordinate_descent //!< Scan one dimension at a time, rejecting slow parameters
+        };
+
+    /// Set search mode
+    /*! \param search Mode to use when searching the parameter space. Restarts a scan that has not
+        completed.
+    */
+    void setMode(search_Enum search)
+        {
+        m_search = search;
+        if (m_state != IDLE)
+            startScan();
+        }
+
     protected:
+    /// Store the time of the current launch.
+    void recordSample(float sample);
+
+    /// Advance the state machine after a launch.
+    void nextSample();
+
     size_t computeOptimalParameterIndex();
 
+    /// Compute m_sample_center for the candidates from the samples taken so far.
+    bool computeSampleCenters(unsigned int n_samples);
+
+    /// Reject candidates that are much slower than the fastest.
+    void rejectSlowCandidates();
+
+    /// Choose the candidates for the next coordinate descent line.
+    void startLine();
+
+    /// Complete the scan over the current candidates.
+    void finishCandidates();
+
+    /// Start coordinate descent from the current parameter.
+    void startDescent();
+
+    /// Start a coordinate descent scan near the current parameter.
+    void startLocalScan();
+
+    /// Add a drift sample and start a local scan when the kernel has slowed down.
+    void checkDrift(float sample);
+
+    /// Reset the drift detection with the given reference time.
+    void resetDrift(float tuned_time);
+
+    /// Reset the drift detection with the time of the optimal parameter.
+    void finishScan(size_t optimal_index);
+
+    /// Test whether the current scan uses coordinate descent.
+    bool isDescending() const
+        {
+        return m_search == search_coordinate_descent || m_local_scan;
+        }
+
     /// State names
     enum State
         {
@@ -387,9 +546,60 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
     /// Sampling mode.
     mode_Enum m_mode;
 
+    /// Search mode.
+    search_Enum m_search = search_exhaustive;
+
+    /// Indices of the parameters in the current scan.
+    std::vector<size_t> m_candidates;
+
+    /// Index of the best parameter found by coordinate descent.
+    size_t m_best_index = 0;
+
+    /// Dimension of the current coordinate descent line.
+    size_t m_dimension = 0;
+
+    /// Number of coordinate descent lines scanned.
+    size_t m_n_lines = 0;
+
+    /// Number of consecutive lines that kept the best parameter.
+    size_t m_n_converged_lines = 0;
+
+    /// Candidates slower than this factor times the fastest are rejected.
+    float m_reject_factor = 1.5f;
+
+    /// True when the current scan is a local scan.
+    bool m_local_scan = false;
+
+    /// Number of parameters on each side of the best one that a local scan samples along a line.
+    size_t m_local_radius = 2;
+
+    /// Number of idle launches between drift samples.
+    unsigned int m_drift_interval = 100;
+
+    /// Number of idle launches since the last drift sample.
+    unsigned int m_drift_calls = 0;
+
+    /// True when the current launch is timed for drift detection.
+    bool m_drift_timing = false;
+
+    /// Most recent drift samples.
+    std::vector<float> m_drift_samples;
+
+    /// Time of the optimal parameter when the last scan completed (0 when unknown).
+    float m_tuned_time = 0;
+
+    /// Bucket of the last problem size (-1 when unknown).
+    int m_problem_bucket = -1;
+
     /// True when this is an optional tuner.
     bool m_optional;
 
+    /// Name of the autotuner in traces.
+    const char* m_trace_name;
+
+    /// Time at which the current sample began (for traces), -1 when not tracing.
+    int64_t m_trace_start = -1;
+
     /// Helper method to initialize multi-dimensional arrays recursively.
     void initializeParameters(
         const std::vector<std::vector<unsigned int>>& dimension_ranges,
@@ -439,7 +649,8 @@ Autotuner<n_dimensions>::Autotuner(
     bool optional,
     std::function<bool(const std::array<unsigned int, n_dimensions>&)> is_parameter_valid)
     : AutotunerBase(name), m_n_samples(n_samples), m_exec_conf(exec_conf), m_sync(false),
-      m_mode(mode_median), m_optional(optional)
+      m_mode(mode_median), m_optional(optional),
+      m_trace_name(exec_conf->getTracer().intern(name))
     {
     m_exec_conf->msg->notice(5) << "Constructing Autotuner " << name << " with " << n_samples
                                 << " samples." << std::endl;
@@ -489,6 +700,7 @@ Autotuner<n_dimensions>::Autotuner(
         {
         m_samples[i].resize(m_n_samples);
         }
+    m_current_param = m_parameters[0];
 
 // create CUDA events
 #ifdef ENABLE_HIP
@@ -508,57 +720,324 @@ template<size_t n_dimensions> void Autotuner<n_dimensions>::end()
         {
         hipEventRecord(m_stop, 0);
         hipEventSynchronize(m_stop);
-        hipEventElapsedTime(&m_samples[m_current_element][m_current_sample], m_start, m_stop);
+        float sample;
+        hipEventElapsedTime(&sample, m_start, m_stop);
+        recordSample(sample);
 
-        m_exec_conf->msg->notice(9)
-            << "Autotuner " << m_name << ": t[" << formatParam(m_current_param) << ","
-            << m_current_sample << "] = " << m_samples[m_current_element][m_current_sample]
-            << std::endl;
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+    else if (m_drift_timing)
+        {
+        hipEventRecord(m_stop, 0);
+        hipEventSynchronize(m_stop);
+        float sample;
+        hipEventElapsedTime(&sample, m_start, m_stop);
+        m_drift_timing = false;
+        m_drift_calls = 0;
 
         if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
+
+        checkDrift(sample);
         }
 #endif
 
-    // Handle state data updates and transitions.
+    nextSample();
+    }
+
+/*! \param sample Time of the current launch (in milliseconds).
+ */
+template<size_t n_dimensions> void Autotuner<n_dimensions>::recordSample(float sample)
+    {
+    m_samples[m_candidates[m_current_element]][m_current_sample] = sample;
+
+    m_exec_conf->msg->notice(9) << "Autotuner " << m_name << ": t[" << formatParam(m_current_param)
+                                << "," << m_current_sample << "] = " << sample << std::endl;
+    }
+
+/*! Move on to the next parameter or sample, and complete the scan over the candidates after the
+    last sample.
+*/
+template<size_t n_dimensions> void Autotuner<n_dimensions>::nextSample()
+    {
     if (m_state == SCANNING)
         {
+        if (m_trace_start >= 0)
+            {
+            Tracer& tracer = m_exec_conf->getTracer();
+            tracer.record(m_trace_name, "autotuner", m_trace_start, tracer.getTime());
+            m_trace_start = -1;
+            }
+
         // move on to the next element
         m_current_element++;
 
         // If we hit the end of the elements
-        if (m_current_element >= m_parameters.size())
+        if (m_current_element >= m_candidates.size())
             {
             // Move on to the next sample.
             m_current_sample++;
             m_current_element = 0;
 
-            // If this is the last sample, go to the idle state and compute the optimal parameter.
+            // If this is the last sample, choose the optimal parameter among the candidates.
             if (m_current_sample >= m_n_samples)
                 {
-                m_state = IDLE;
-                m_current_sample = 0;
-                m_current_param = m_parameters[computeOptimalParameterIndex()];
+                finishCandidates();
                 }
             else
                 {
-                m_current_param = m_parameters[m_current_element];
+                if (isDescending())
+                    rejectSlowCandidates();
+                m_current_param = m_parameters[m_candidates[m_current_element]];
                 }
             }
         else
             {
-            m_current_param = m_parameters[m_current_element];
+            m_current_param = m_parameters[m_candidates[m_current_element]];
             }
         }
     }
 
-/*! \returns The index of the optimal parameter given the current data in m_samples.
+/*! Go to the idle state with the optimal parameter after an exhaustive scan. In coordinate
+    descent, move to the optimal parameter on the current line and start the next line, or go to
+    the idle state when the lines along all dimensions keep the same parameter.
+*/
+template<size_t n_dimensions> void Autotuner<n_dimensions>::finishCandidates()
+    {
+    m_current_sample = 0;
+    size_t optimal_index = computeOptimalParameterIndex();
 
-    computeOptimalParameter computes the median, average, or maximum time among all samples for all
-    elements. It then chooses the fastest time (with the lowest index breaking a tie) and returns
-    the index of the parameter that resulted in that time.
+    if (!isDescending())
+        {
+        m_state = IDLE;
+        m_current_param = m_parameters[optimal_index];
+        finishScan(optimal_index);
+        return;
+        }
+
+    // the best parameter is now optimal along this line (or, in a local scan, only within the
+    // sampled part of the line, which must be scanned again)
+    if (optimal_index != m_best_index)
+        {
+        m_best_index = optimal_index;
+        m_n_converged_lines = m_local_scan ? 0 : 1;
+        }
+    else
+        {
+        m_n_converged_lines++;
+        }
+
+    m_dimension = (m_dimension + 1) % n_dimensions;
+    m_n_lines++;
+    startLine();
+    m_current_param = m_parameters[m_candidates[m_current_element]];
+    }
+
+/*! Set m_candidates to the parameters that differ from the best one only in m_dimension. A local
+    scan keeps only the m_local_radius parameters on each side of the best one. Lines with no other
+    valid parameter are skipped. When the lines along all dimensions keep the best parameter (or
+    after a bounded number of lines), go to the idle state.
 */
-template<size_t n_dimensions> size_t Autotuner<n_dimensions>::computeOptimalParameterIndex()
+template<size_t n_dimensions> void Autotuner<n_dimensions>::startLine()
+    {
+    const size_t max_lines = 4 * n_dimensions;
+    const auto& best = m_parameters[m_best_index];
+
+    while (m_n_converged_lines < n_dimensions && m_n_lines < max_lines)
+        {
+        m_candidates.clear();
+        for (size_t i = 0; i < m_parameters.size(); i++)
+            {
+            bool on_line = true;
+            for (size_t d = 0; d < n_dimensions; d++)
+                {
+                if (d != m_dimension && m_parameters[i][d] != best[d])
+                    on_line = false;
+                }
+            if (on_line)
+                m_candidates.push_back(i);
+            }
+
+        if (m_local_scan)
+            {
+            // the parameters on a line are ordered by their value in m_dimension
+            size_t position
+                = std::find(m_candidates.begin(), m_candidates.end(), m_best_index)
+                  - m_candidates.begin();
+            size_t first = position > m_local_radius ? position - m_local_radius : 0;
+            size_t last = std::min(position + m_local_radius + 1, m_candidates.size());
+            m_candidates.erase(m_candidates.begin() + last, m_candidates.end());
+            m_candidates.erase(m_candidates.begin(), m_candidates.begin() + first);
+            }
+
+        if (m_candidates.size() > 1)
+            {
+            m_exec_conf->msg->notice(5)
+                << "Autotuner " << m_name << " scanning dimension " << m_dimension << " from "
+                << formatParam(best) << " with " << m_candidates.size() << " parameters."
+                << std::endl;
+            return;
+            }
+
+        // there is nothing to compare along this dimension
+        m_n_converged_lines++;
+        m_dimension = (m_dimension + 1) % n_dimensions;
+        m_n_lines++;
+        }
+
+    // converged
+    m_candidates.assign(1, m_best_index);
+    m_state = IDLE;
+    m_local_scan = false;
+    m_exec_conf->msg->notice(4) << "Autotuner " << m_name << " found optimal parameter "
+                                << formatParam(best) << " after " << m_n_lines
+                                << " coordinate descent lines." << std::endl;
+    finishScan(m_best_index);
+    }
+
+/*! Find the current parameter and scan the first line from it.
+ */
+template<size_t n_dimensions> void Autotuner<n_dimensions>::startDescent()
+    {
+    auto found = std::find(m_parameters.begin(), m_parameters.end(), m_current_param);
+    m_best_index = found == m_parameters.end() ? 0 : found - m_parameters.begin();
+    m_dimension = 0;
+    m_n_lines = 0;
+    m_n_converged_lines = 0;
+    startLine();
+    }
+
+/*! Scan the parameters near the current one with coordinate descent. The scan keeps the current
+    parameter unless a nearby one is faster.
+*/
+template<size_t n_dimensions> void Autotuner<n_dimensions>::startLocalScan()
+    {
+    m_exec_conf->msg->notice(4) << "Autotuner " << m_name << " starting local scan from "
+                                << formatParam(m_current_param) << "." << std::endl;
+    m_current_element = 0;
+    m_current_sample = 0;
+    m_local_scan = true;
+    m_state = SCANNING;
+    startDescent();
+    m_current_param = m_parameters[m_candidates[m_current_element]];
+    }
+
+/*! \param sample Time of the last launch (in milliseconds).
+
+    Keep the last m_n_samples drift samples and compare their median to m_tuned_time. When the
+    reference time is not known (e.g. the user set the parameter), the first median becomes the
+    reference. Synchronized autotuners start the local scan when any rank detects drift.
+*/
+template<size_t n_dimensions> void Autotuner<n_dimensions>::checkDrift(float sample)
+    {
+    m_drift_samples.push_back(sample);
+    if (m_drift_samples.size() > m_n_samples)
+        m_drift_samples.erase(m_drift_samples.begin());
+    if (m_drift_samples.size() < m_n_samples)
+        return;
+
+    std::vector<float> v(m_drift_samples);
+    size_t n = v.size() / 2;
+    std::nth_element(v.begin(), v.begin() + n, v.end());
+    float median = v[n];
+
+    if (m_tuned_time <= 0)
+        {
+        m_tuned_time = median;
+        }
+
+    int drifted
+        = median > (1.0f + float(m_exec_conf->getAutotunerDriftThreshold())) * m_tuned_time;
+
+#ifdef ENABLE_MPI
+    if (m_sync && m_exec_conf->getNRanks() > 1)
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &drifted,
+                      1,
+                      MPI_INT,
+                      MPI_LOR,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    if (drifted)
+        {
+        m_exec_conf->msg->notice(4)
+            << "Autotuner " << m_name << " kernel time " << median << " exceeds the tuned time "
+            << m_tuned_time << "." << std::endl;
+        startLocalScan();
+        }
+    }
+
+/*! \param optimal_index Index of the parameter chosen by the scan.
+ */
+template<size_t n_dimensions> void Autotuner<n_dimensions>::finishScan(size_t optimal_index)
+    {
+    float tuned_time = m_sample_center[optimal_index];
+
+#ifdef ENABLE_MPI
+    // the sample centers are only valid on rank 0
+    if (m_sync && m_exec_conf->getNRanks() > 1)
+        bcast(tuned_time, 0, m_exec_conf->getMPICommunicator());
+#endif
+
+    resetDrift(tuned_time);
+    }
+
+/*! \param tuned_time Time of the current parameter (0 when unknown).
+ */
+template<size_t n_dimensions> void Autotuner<n_dimensions>::resetDrift(float tuned_time)
+    {
+    m_tuned_time = tuned_time;
+    m_drift_samples.clear();
+    m_drift_calls = 0;
+    m_drift_timing = false;
+    }
+
+/*! Remove the candidates whose samples so far are slower than m_reject_factor times the fastest
+    candidate, so that the remaining samples are only taken for competitive parameters.
+*/
+template<size_t n_dimensions> void Autotuner<n_dimensions>::rejectSlowCandidates()
+    {
+    if (computeSampleCenters(m_current_sample))
+        {
+        float min_value = FLT_MAX;
+        for (auto i : m_candidates)
+            min_value = std::min(min_value, m_sample_center[i]);
+
+        std::vector<size_t> kept;
+        for (auto i : m_candidates)
+            {
+            if (m_sample_center[i] <= m_reject_factor * min_value)
+                kept.push_back(i);
+            }
+
+        if (kept.size() < m_candidates.size())
+            {
+            m_exec_conf->msg->notice(5)
+                << "Autotuner " << m_name << " rejected " << m_candidates.size() - kept.size()
+                << " slow parameters." << std::endl;
+            }
+        m_candidates = kept;
+        }
+
+#ifdef ENABLE_MPI
+    if (m_sync && m_exec_conf->getNRanks() > 1)
+        bcast(m_candidates, 0, m_exec_conf->getMPICommunicator());
+#endif
+    }
+
+/*! \param n_samples Number of samples taken for each candidate.
+    \returns true on the rank that holds the sample centers.
+
+    computeSampleCenters computes the median, average, or maximum time among the first
+    \a n_samples samples of each candidate and stores it in m_sample_center. When m_sync is set,
+    it combines the samples from all ranks on rank 0.
+*/
+template<size_t n_dimensions>
+bool Autotuner<n_dimensions>::computeSampleCenters(unsigned int n_samples)
     {
     bool is_root = true;
 
@@ -571,11 +1050,10 @@ template<size_t n_dimensions> size_t Autotuner<n_dimensions>::computeOptimalPara
         }
 #endif
 
-    // Start by computing the summary for each element.
     std::vector<float> v;
-    for (unsigned int i = 0; i < m_parameters.size(); i++)
+    for (auto i : m_candidates)
         {
-        v = m_samples[i];
+        v.assign(m_samples[i].begin(), m_samples[i].begin() + n_samples);
 #ifdef ENABLE_MPI
         if (m_sync && nranks)
             {
@@ -624,16 +1102,29 @@ template<size_t n_dimensions> size_t Autotuner<n_dimensions>::computeOptimalPara
             }
         }
 
-    size_t min_idx = 0;
+    return is_root;
+    }
+
+/*! \returns The index of the optimal parameter given the current data in m_samples.
+
+    computeOptimalParameter computes the median, average, or maximum time among all samples for all
+    candidates. It then chooses the fastest time (with the lowest index breaking a tie) and returns
+    the index of the parameter that resulted in that time.
+*/
+template<size_t n_dimensions> size_t Autotuner<n_dimensions>::computeOptimalParameterIndex()
+    {
+    bool is_root = computeSampleCenters(m_n_samples);
+
+    size_t min_idx = m_candidates[0];
 
     // Report performance characteristics of Autotuning
     if (is_root)
         {
         // Now find the minimum and maximum times in the medians.
-        float min_value = m_sample_center[0];
-        float max_value = m_sample_center[0];
+        float min_value = m_sample_center[min_idx];
+        float max_value = m_sample_center[min_idx];
 
-        for (size_t i = 1; i < m_parameters.size(); i++)
+        for (auto i : m_candidates)
             {
             if (m_sample_center[i] < min_value)
                 {
@@ -650,14 +1141,14 @@ template<size_t n_dimensions> size_t Autotuner<n_dimensions>::computeOptimalPara
         unsigned int percent = int(max_value / min_value * 100.0f) - 100;
 
         // Notify user ot optimal parameter selection.
-        m_exec_conf->msg->notice(4)
+        m_exec_conf->msg->notice(isDescending() ? 5 : 4)
             << "Autotuner " << m_name << " found optimal parameter "
             << formatParam(m_parameters[min_idx]) << " with a performance spread of " << percent
             << "%." << std::endl;
         }
 
 #ifdef ENABLE_MPI
-    if (m_sync && nranks)
+    if (m_sync && m_exec_conf->getNRanks() > 1)
         bcast(min_idx, 0, m_exec_conf->getMPICommunicator());
 #endif
     return min_idx;
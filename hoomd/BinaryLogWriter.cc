@@ -0,0 +1,228 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file BinaryLogWriter.cc
+    \brief Defines the BinaryLogWriter class
+*/
+
+#include "BinaryLogWriter.h"
+
+#include <pybind11/stl.h>
+
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+/*! \param sysdef System definition
+    \param trigger Trigger that selects the timesteps to log
+    \param filename File to write
+    \param buffer_size Number of rows to buffer before writing them to the file
+
+    The file is opened when the first row is written.
+*/
+BinaryLogWriter::BinaryLogWriter(std::shared_ptr<SystemDefinition> sysdef,
+                                 std::shared_ptr<Trigger> trigger,
+                                 const std::string& filename,
+                                 unsigned int buffer_size)
+    : Analyzer(sysdef, trigger), m_filename(filename), m_buffer_size(buffer_size),
+      m_is_root(m_exec_conf->isRoot()), m_num_rows(0)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing BinaryLogWriter: " << filename << endl;
+    if (m_buffer_size == 0)
+        {
+        throw runtime_error("The buffer size must be greater than 0.");
+        }
+    }
+
+BinaryLogWriter::~BinaryLogWriter()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying BinaryLogWriter" << endl;
+    try
+        {
+        flush();
+        }
+    catch (const std::exception& e)
+        {
+        m_exec_conf->msg->error() << "Could not write " << m_filename << ": " << e.what() << endl;
+        }
+    }
+
+/*! \param name Name of the column in the file
+    \param compute Compute that provides the quantity
+    \param quantity Name of the loggable quantity of \a compute
+
+    Quantities can only be added before the first row is written.
+*/
+void BinaryLogWriter::addQuantity(const std::string& name,
+                                  std::shared_ptr<Compute> compute,
+                                  const std::string& quantity)
+    {
+    if (m_file.is_open() || m_num_rows > 0)
+        {
+        throw runtime_error("Cannot add quantities after the log has been written.");
+        }
+
+    auto evaluate = compute->getLogQuantity(quantity);
+    if (!evaluate)
+        {
+        throw runtime_error("The quantity " + name + " cannot be evaluated in C++.");
+        }
+
+    m_names.push_back(name);
+    m_computes.push_back(compute);
+    m_quantities.push_back(evaluate);
+    }
+
+/*! \param timestep Current timestep
+
+    All ranks evaluate the quantities, which may reduce values over the ranks, but only the root
+    rank stores them.
+*/
+void BinaryLogWriter::analyze(uint64_t timestep)
+    {
+    if (m_is_root && m_timesteps.size() != m_buffer_size)
+        {
+        m_timesteps.resize(m_buffer_size);
+        m_values.resize(m_quantities.size() * m_buffer_size);
+        }
+
+    for (unsigned int i = 0; i < m_quantities.size(); ++i)
+        {
+        const Scalar value = m_quantities[i](timestep);
+        if (m_is_root)
+            {
+            m_values[i * m_buffer_size + m_num_rows] = double(value);
+            }
+        }
+
+    if (m_is_root)
+        {
+        m_timesteps[m_num_rows] = timestep;
+        ++m_num_rows;
+        if (m_num_rows == m_buffer_size)
+            {
+            startWrite();
+            }
+        }
+    }
+
+/*! Write any buffered rows and wait until they are in the file.
+ */
+void BinaryLogWriter::flush()
+    {
+    if (!m_is_root)
+        return;
+
+    if (m_num_rows > 0)
+        {
+        startWrite();
+        }
+    finishWrite();
+    m_file.flush();
+    }
+
+void BinaryLogWriter::openFile()
+    {
+    m_file.open(m_filename.c_str(), ios_base::out | ios_base::binary | ios_base::trunc);
+    if (!m_file.good())
+        {
+        throw runtime_error("Error opening " + m_filename);
+        }
+
+    const uint32_t version = 1;
+    const uint32_t num_columns = uint32_t(m_names.size());
+    m_file.write("HOOMDLOG", 8);
+    m_file.write(reinterpret_cast<const char*>(&version), sizeof(uint32_t));
+    m_file.write(reinterpret_cast<const char*>(&num_columns), sizeof(uint32_t));
+    for (const auto& name : m_names)
+        {
+        const uint32_t length = uint32_t(name.size());
+        m_file.write(reinterpret_cast<const char*>(&length), sizeof(uint32_t));
+        m_file.write(name.data(), length);
+        }
+    }
+
+/*! The buffers are swapped, so the next rows fill while the write thread writes these.
+ */
+void BinaryLogWriter::startWrite()
+    {
+    finishWrite();
+    if (!m_file.is_open())
+        {
+        openFile();
+        }
+
+    m_write_timesteps.swap(m_timesteps);
+    m_write_values.swap(m_values);
+    m_timesteps.resize(m_buffer_size);
+    m_values.resize(m_quantities.size() * m_buffer_size);
+
+    const unsigned int num_rows = m_num_rows;
+    m_num_rows = 0;
+    m_write_thread = std::thread(&BinaryLogWriter::writeBlock, this, num_rows);
+    }
+
+void BinaryLogWriter::finishWrite()
+    {
+    if (m_write_thread.joinable())
+        {
+        m_write_thread.join();
+        }
+
+    if (m_write_error)
+        {
+        std::exception_ptr error = m_write_error;
+        m_write_error = nullptr;
+        std::rethrow_exception(error);
+        }
+    }
+
+/*! \param num_rows Number of rows in the write buffers
+ */
+void BinaryLogWriter::writeBlock(unsigned int num_rows)
+    {
+    try
+        {
+        const uint32_t rows = num_rows;
+        m_file.write(reinterpret_cast<const char*>(&rows), sizeof(uint32_t));
+        m_file.write(reinterpret_cast<const char*>(m_write_timesteps.data()),
+                     sizeof(uint64_t) * num_rows);
+        for (unsigned int i = 0; i < m_names.size(); ++i)
+            {
+            m_file.write(reinterpret_cast<const char*>(m_write_values.data() + i * m_buffer_size),
+                         sizeof(double) * num_rows);
+            }
+
+        if (!m_file.good())
+            {
+            throw runtime_error("Error writing " + m_filename);
+            }
+        }
+    catch (...)
+        {
+        m_write_error = std::current_exception();
+        }
+    }
+
+namespace detail
+    {
+void export_BinaryLogWriter(pybind11::module& m)
+    {
+    pybind11::class_<BinaryLogWriter, Analyzer, std::shared_ptr<BinaryLogWriter>>(
+        m,
+        "BinaryLogWriter")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::string,
+                            unsigned int>())
+        .def("addQuantity", &BinaryLogWriter::addQuantity)
+        .def("flush", &BinaryLogWriter::flush)
+        .def_property_readonly("filename", &BinaryLogWriter::getFilename)
+        .def_property_readonly("buffer_size", &BinaryLogWriter::getBufferSize)
+        .def_property_readonly("names", &BinaryLogWriter::getNames);
+    }
+    } // end namespace detail
+
+    } // end namespace hoomd
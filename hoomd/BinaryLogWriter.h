@@ -0,0 +1,119 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "Analyzer.h"
+#include "Compute.h"
+
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+/*! \file BinaryLogWriter.h
+    \brief Declares the BinaryLogWriter class
+*/
+
+namespace hoomd
+    {
+//! Writes scalar loggable quantities to a columnar binary file
+/*! Each quantity is resolved to a C++ function once by Compute::getLogQuantity() when it is added,
+    so analyze() evaluates the quantities without calling into python. The values are appended
+    to a columnar buffer that holds \a buffer_size rows. A full buffer is written to the file by a
+    background thread while the next buffer fills.
+
+    The file starts with the 8 byte magic string "HOOMDLOG", the format version and the number of
+    columns (uint32), and, for each column, the length of its name (uint32) and the name. The rows
+    follow in blocks that each hold the number of rows (uint32), the timesteps (uint64), and then
+    each column in turn (float64). Only the root rank writes the file.
+*/
+class PYBIND11_EXPORT BinaryLogWriter : public Analyzer
+    {
+    public:
+    //! Construct the writer
+    BinaryLogWriter(std::shared_ptr<SystemDefinition> sysdef,
+                    std::shared_ptr<Trigger> trigger,
+                    const std::string& filename,
+                    unsigned int buffer_size);
+
+    //! Destructor
+    virtual ~BinaryLogWriter();
+
+    //! Add a quantity to the log
+    void addQuantity(const std::string& name,
+                     std::shared_ptr<Compute> compute,
+                     const std::string& quantity);
+
+    //! Append the current values of the quantities to the buffer
+    virtual void analyze(uint64_t timestep);
+
+    //! Write the buffered rows to the file and wait for the write to finish
+    void flush();
+
+    //! Get the file name
+    std::string getFilename() const
+        {
+        return m_filename;
+        }
+
+    //! Get the number of rows in the buffer
+    unsigned int getBufferSize() const
+        {
+        return m_buffer_size;
+        }
+
+    //! Get the names of the logged quantities
+    const std::vector<std::string>& getNames() const
+        {
+        return m_names;
+        }
+
+    private:
+    std::string m_filename;     //!< File to write
+    unsigned int m_buffer_size; //!< Number of rows in the buffer
+    bool m_is_root;             //!< True on the rank that writes the file
+
+    std::vector<std::string> m_names;                             //!< Names of the quantities
+    std::vector<std::shared_ptr<Compute>> m_computes;             //!< Computes of the quantities
+    std::vector<std::function<Scalar(uint64_t)>> m_quantities;    //!< Evaluate the quantities
+
+    std::vector<uint64_t> m_timesteps; //!< Timesteps of the buffered rows
+    std::vector<double> m_values;      //!< Buffered values, one column after the other
+    unsigned int m_num_rows;           //!< Number of buffered rows
+
+    std::ofstream m_file;              //!< The open file
+    std::thread m_write_thread;        //!< Writes the previous buffer
+    std::vector<uint64_t> m_write_timesteps; //!< Timesteps being written
+    std::vector<double> m_write_values;      //!< Values being written
+    std::exception_ptr m_write_error;        //!< Error raised by the write thread
+
+    //! Open the file and write the header
+    void openFile();
+
+    //! Hand the buffered rows to the write thread
+    void startWrite();
+
+    //! Wait for the write thread and rethrow its errors
+    void finishWrite();
+
+    //! Write a block of rows, run by m_write_thread
+    void writeBlock(unsigned int num_rows);
+    };
+
+namespace detail
+    {
+//! Export BinaryLogWriter to python
+void export_BinaryLogWriter(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -11,6 +11,10 @@
 
 #include <pybind11/numpy.h>
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
 #ifdef ENABLE_HIP
 #include "BondedGroupData.cuh"
 #include "CachedAllocator.h"
@@ -41,8 +45,8 @@ char name_pair_data[] = "pair";
 template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
 BondedGroupData<group_size, Group, name, has_type_mapping>::BondedGroupData(
     std::shared_ptr<ParticleData> pdata)
-    : m_exec_conf(pdata->getExecConf()), m_pdata(pdata), m_n_groups(0), m_n_ghost(0), m_nglobal(0),
-      m_groups_dirty(true)
+    : m_exec_conf(pdata->getExecConf()), m_pdata(pdata), m_n_gpu_csr_high_degree(0), m_n_groups(0),
+      m_n_ghost(0), m_nglobal(0), m_groups_dirty(true), m_csr_dirty(true)
     {
     }
 
@@ -54,8 +58,8 @@ template<unsigned int group_size, typename Group, const char* name, bool has_typ
 BondedGroupData<group_size, Group, name, has_type_mapping>::BondedGroupData(
     std::shared_ptr<ParticleData> pdata,
     unsigned int n_group_types)
-    : m_exec_conf(pdata->getExecConf()), m_pdata(pdata), m_n_groups(0), m_n_ghost(0), m_nglobal(0),
-      m_groups_dirty(true)
+    : m_exec_conf(pdata->getExecConf()), m_pdata(pdata), m_n_gpu_csr_high_degree(0), m_n_groups(0),
+      m_n_ghost(0), m_nglobal(0), m_groups_dirty(true), m_csr_dirty(true)
     {
     m_exec_conf->msg->notice(5) << "Constructing BondedGroupData (" << name << "s, n=" << group_size
                                 << ") " << endl;
@@ -97,8 +101,8 @@ template<unsigned int group_size, typename Group, const char* name, bool has_typ
 BondedGroupData<group_size, Group, name, has_type_mapping>::BondedGroupData(
     std::shared_ptr<ParticleData> pdata,
     const Snapshot& snapshot)
-    : m_exec_conf(pdata->getExecConf()), m_pdata(pdata), m_n_groups(0), m_n_ghost(0), m_nglobal(0),
-      m_groups_dirty(true)
+    : m_exec_conf(pdata->getExecConf()), m_pdata(pdata), m_n_gpu_csr_high_degree(0), m_n_groups(0),
+      m_n_ghost(0), m_nglobal(0), m_groups_dirty(true), m_csr_dirty(true)
     {
     m_exec_conf->msg->notice(5) << "Constructing BondedGroupData (" << name << ") " << endl;
 
@@ -182,6 +186,20 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::initialize()
     GPUVector<unsigned int> n_groups(m_exec_conf);
     m_gpu_n_groups.swap(n_groups);
 
+    // Lookup by particle index table in CSR format
+    GPUVector<members_t> gpu_csr_table(m_exec_conf);
+    m_gpu_csr_table.swap(gpu_csr_table);
+
+    GPUVector<unsigned int> gpu_csr_pos_table(m_exec_conf);
+    m_gpu_csr_pos_table.swap(gpu_csr_pos_table);
+
+    GPUVector<unsigned int> gpu_csr_offsets(m_exec_conf);
+    m_gpu_csr_offsets.swap(gpu_csr_offsets);
+
+    GPUVector<unsigned int> gpu_csr_high_degree(m_exec_conf);
+    m_gpu_csr_high_degree.swap(gpu_csr_high_degree);
+    m_n_gpu_csr_high_degree = 0;
+
 #ifdef ENABLE_MPI
     if (m_pdata->getDomainDecomposition())
         {
@@ -218,6 +236,14 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::initialize()
                                           access_mode::overwrite);
     *h_condition.data = 0;
     m_next_flag = 1;
+
+    // group positions at the last build of the GPU table
+    GPUVector<members_t> gpu_table_cached_idx(m_exec_conf);
+    m_gpu_table_cached_idx.swap(gpu_table_cached_idx);
+
+    GPUVector<unsigned int> gpu_table_cached_tag(m_exec_conf);
+    m_gpu_table_cached_tag.swap(gpu_table_cached_tag);
+    m_gpu_table_cache_valid = false;
 #endif
 
     m_tag_set.clear();
@@ -324,6 +350,11 @@ unsigned int BondedGroupData<group_size, Group, name, has_type_mapping>::addBond
     // we are changing the local number of groups, so remove ghosts
     removeAllGhostGroups();
 
+#ifdef ENABLE_HIP
+    // a recycled tag may belong to a group of a different type, so the GPU table cannot be patched
+    m_gpu_table_cache_valid = false;
+#endif
+
     typeval_t typeval = g.get_typeval();
     members_t member_tags = g.get_members();
 
@@ -880,20 +911,222 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildGPUTable
         }
     }
 
+/*! The table lists the same entries as the two-dimensional table from rebuildGPUTable(), but the
+    groups of each particle are stored contiguously so that the size of the table is the total
+    number of group members instead of the number of particles times the largest number of groups
+    of any particle. The local particles that are members of more than csr_high_degree groups are
+    also listed, so that GPU kernels can process them with more than one thread.
+ */
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildGPUCSRTable()
+    {
+    const unsigned int N_local = m_pdata->getN();
+    const unsigned int N = N_local + m_pdata->getNGhosts();
+    const unsigned int ngroups_tot = m_n_groups + m_n_ghost;
+
+    m_gpu_csr_table.resize(group_size * ngroups_tot);
+    m_gpu_csr_pos_table.resize(group_size * ngroups_tot);
+    m_gpu_csr_offsets.resize(N + 1);
+    m_gpu_csr_high_degree.resize(N_local);
+
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        rebuildGPUCSRTableGPU();
+    else
+#endif
+        {
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::read);
+        ArrayHandle<unsigned int> h_offsets(m_gpu_csr_offsets,
+                                            access_location::host,
+                                            access_mode::overwrite);
+        ArrayHandle<members_t> h_csr_table(m_gpu_csr_table,
+                                           access_location::host,
+                                           access_mode::overwrite);
+        ArrayHandle<unsigned int> h_csr_pos_table(m_gpu_csr_pos_table,
+                                                  access_location::host,
+                                                  access_mode::overwrite);
+        ArrayHandle<unsigned int> h_high_degree(m_gpu_csr_high_degree,
+                                                access_location::host,
+                                                access_mode::overwrite);
+
+        // count the number of bonded groups per particle, shifted by one for the scan
+        memset(h_offsets.data, 0, sizeof(unsigned int) * (N + 1));
+        for (unsigned int cur_group = 0; cur_group < ngroups_tot; cur_group++)
+            {
+            members_t g = m_groups[cur_group];
+            for (unsigned int i = 0; i < group_size; ++i)
+                {
+                unsigned int idx = h_rtag.data[g.tag[i]];
+
+                if (idx == NOT_LOCAL)
+                    {
+                    // incomplete group
+                    std::ostringstream oss;
+                    oss << name << " ";
+                    for (unsigned int k = 0; k < group_size; ++k)
+                        oss << g.tag[k] << ((k != group_size - 1) ? ", " : " ");
+                    oss << "incomplete!";
+                    throw std::runtime_error(oss.str());
+                    }
+
+                h_offsets.data[idx + 1]++;
+                }
+            }
+
+        // list the local particles with many groups, and turn the counts into offsets
+        m_n_gpu_csr_high_degree = 0;
+        for (unsigned int idx = 0; idx < N; ++idx)
+            {
+            if (idx < N_local && h_offsets.data[idx + 1] > csr_high_degree)
+                h_high_degree.data[m_n_gpu_csr_high_degree++] = idx;
+            h_offsets.data[idx + 1] += h_offsets.data[idx];
+            }
+
+        // fill the table, using the offsets as insertion points and restoring them afterwards
+        for (unsigned int cur_group = 0; cur_group < ngroups_tot; cur_group++)
+            {
+            members_t g = m_groups[cur_group];
+
+            for (unsigned int i = 0; i < group_size; ++i)
+                {
+                unsigned int idx1 = h_rtag.data[g.tag[i]];
+                unsigned int slot = h_offsets.data[idx1]++;
+
+                members_t h;
+
+                if (has_type_mapping)
+                    {
+                    // last element = type
+                    h.idx[group_size - 1] = ((typeval_t)m_group_typeval[cur_group]).type;
+                    }
+                else
+                    {
+                    // last element = local group idx
+                    h.idx[group_size - 1] = cur_group;
+                    }
+
+                // list all group members j!=i in p.idx
+                unsigned int n = 0;
+                for (unsigned int j = 0; j < group_size; ++j)
+                    {
+                    if (j == i)
+                        continue;
+                    h.idx[n++] = h_rtag.data[g.tag[j]];
+                    }
+
+                h_csr_table.data[slot] = h;
+                h_csr_pos_table.data[slot] = i;
+                }
+            }
+
+        // each offset now points to the start of the next particle
+        for (unsigned int idx = N; idx > 0; --idx)
+            h_offsets.data[idx] = h_offsets.data[idx - 1];
+        h_offsets.data[0] = 0;
+        }
+    }
+
 #ifdef ENABLE_HIP
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildGPUCSRTableGPU()
+    {
+    const unsigned int N_local = m_pdata->getN();
+    const unsigned int N = N_local + m_pdata->getNGhosts();
+    unsigned int flag = 0;
+
+        {
+        ArrayHandle<members_t> d_groups(m_groups, access_location::device, access_mode::read);
+        ArrayHandle<typeval_t> d_group_typeval(m_group_typeval,
+                                               access_location::device,
+                                               access_mode::read);
+        ArrayHandle<unsigned int> d_rtag(m_pdata->getRTags(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<members_t> d_csr_table(m_gpu_csr_table,
+                                           access_location::device,
+                                           access_mode::overwrite);
+        ArrayHandle<unsigned int> d_csr_pos_table(m_gpu_csr_pos_table,
+                                                  access_location::device,
+                                                  access_mode::overwrite);
+        ArrayHandle<unsigned int> d_offsets(m_gpu_csr_offsets,
+                                            access_location::device,
+                                            access_mode::overwrite);
+        ArrayHandle<unsigned int> d_high_degree(m_gpu_csr_high_degree,
+                                                access_location::device,
+                                                access_mode::overwrite);
+        ArrayHandle<unsigned int> d_condition(m_condition,
+                                              access_location::device,
+                                              access_mode::readwrite);
+
+        // allocate scratch buffers
+        CachedAllocator& alloc = m_exec_conf->getCachedAllocator();
+        size_t tmp_size = m_groups.size() * group_size;
+        ScopedAllocation<unsigned int> d_scratch_g(alloc, tmp_size);
+        ScopedAllocation<unsigned int> d_scratch_idx(alloc, tmp_size);
+        ScopedAllocation<unsigned int> d_scratch_n_groups(alloc, N + 1);
+
+        gpu_update_group_csr_table<group_size, members_t>(getN() + getNGhosts(),
+                                                          N,
+                                                          N_local,
+                                                          d_groups.data,
+                                                          d_group_typeval.data,
+                                                          d_rtag.data,
+                                                          d_condition.data,
+                                                          m_next_flag,
+                                                          flag,
+                                                          d_csr_table.data,
+                                                          d_csr_pos_table.data,
+                                                          d_offsets.data,
+                                                          d_high_degree.data,
+                                                          csr_high_degree,
+                                                          m_n_gpu_csr_high_degree,
+                                                          d_scratch_g.data,
+                                                          d_scratch_idx.data,
+                                                          d_scratch_n_groups.data,
+                                                          has_type_mapping,
+                                                          alloc);
+        }
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+
+    if (flag >= m_next_flag + 1)
+        {
+        // incomplete group detected
+        unsigned int group_idx = flag - m_next_flag - 1;
+        members_t g = m_groups[group_idx];
+
+        std::ostringstream oss;
+        oss << name << " ";
+        for (unsigned int k = 0; k < group_size; ++k)
+            oss << g.tag[k] << ((k != group_size - 1) ? ", " : " ");
+        oss << "incomplete!";
+        throw std::runtime_error(oss.str());
+        }
+    }
+
 template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
 void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildGPUTableGPU()
     {
-    // resize groups counter
-    m_gpu_n_groups.resize(m_pdata->getN() + m_pdata->getNGhosts());
+    // the pitch of the table follows the capacity of the particle data, so that it does not change
+    // when particles migrate
+    const unsigned int pitch = m_pdata->getMaxN();
+
+    bool done = m_gpu_table_cache_valid && pitch == m_gpu_table_indexer.getW()
+                && getN() + getNGhosts() == m_gpu_table_cached_tag.size() && patchGPUTableGPU();
+
+    if (!done)
+        {
+        // resize groups counter
+        m_gpu_n_groups.resize(pitch);
 
-    // resize GPU table to current number of particles
-    m_gpu_table_indexer
-        = Index2D(m_pdata->getN() + m_pdata->getNGhosts(), m_gpu_table_indexer.getH());
-    m_gpu_table.resize(m_gpu_table_indexer.getNumElements());
-    m_gpu_pos_table.resize(m_gpu_table_indexer.getNumElements());
+        // resize GPU table to current number of particles
+        m_gpu_table_indexer = Index2D(pitch, m_gpu_table_indexer.getH());
+        m_gpu_table.resize(m_gpu_table_indexer.getNumElements());
+        m_gpu_pos_table.resize(m_gpu_table_indexer.getNumElements());
+        }
 
-    bool done = false;
     while (!done)
         {
         unsigned int flag = 0;
@@ -922,14 +1155,13 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildGPUTable
             // allocate scratch buffers
             CachedAllocator& alloc = m_exec_conf->getCachedAllocator();
             size_t tmp_size = m_groups.size() * group_size;
-            unsigned int nptl = m_pdata->getN() + m_pdata->getNGhosts();
             ScopedAllocation<unsigned int> d_scratch_g(alloc, tmp_size);
             ScopedAllocation<unsigned int> d_scratch_idx(alloc, tmp_size);
             ScopedAllocation<unsigned int> d_offsets(alloc, tmp_size);
 
             // fill group table on GPU
             gpu_update_group_table<group_size, members_t>(getN() + getNGhosts(),
-                                                          nptl,
+                                                          pitch,
                                                           d_groups.data,
                                                           d_group_typeval.data,
                                                           d_rtag.data,
@@ -967,8 +1199,7 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildGPUTable
         if (flag == m_next_flag)
             {
             // grow array by incrementing groups per particle
-            m_gpu_table_indexer
-                = Index2D(m_pdata->getN() + m_pdata->getNGhosts(), m_gpu_table_indexer.getH() + 1);
+            m_gpu_table_indexer = Index2D(pitch, m_gpu_table_indexer.getH() + 1);
             m_gpu_table.resize(m_gpu_table_indexer.getNumElements());
             m_gpu_pos_table.resize(m_gpu_table_indexer.getNumElements());
             m_next_flag++;
@@ -976,6 +1207,304 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildGPUTable
         else
             done = true;
         }
+
+    // remember where the groups are for the next patch
+    const unsigned int n_groups = getN() + getNGhosts();
+    m_gpu_table_cached_idx.resize(n_groups);
+    m_gpu_table_cached_tag.resize(n_groups);
+        {
+        ArrayHandle<members_t> d_groups(m_groups, access_location::device, access_mode::read);
+        ArrayHandle<unsigned int> d_group_tag(m_group_tag,
+                                              access_location::device,
+                                              access_mode::read);
+        ArrayHandle<unsigned int> d_rtag(m_pdata->getRTags(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<members_t> d_cached_idx(m_gpu_table_cached_idx,
+                                            access_location::device,
+                                            access_mode::overwrite);
+        ArrayHandle<unsigned int> d_cached_tag(m_gpu_table_cached_tag,
+                                               access_location::device,
+                                               access_mode::overwrite);
+
+        gpu_cache_group_table<group_size, members_t>(n_groups,
+                                                     d_groups.data,
+                                                     d_group_tag.data,
+                                                     d_rtag.data,
+                                                     d_cached_idx.data,
+                                                     d_cached_tag.data);
+        }
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_gpu_table_cache_valid = true;
+    }
+
+/*! When only a few particles have migrated or been reordered since the last build, only the rows
+    of the table that belong to the old and new members of the groups that have moved are refilled.
+    The patch is abandoned when more than gpu_table_patch_fraction of the groups have moved, when a
+    group is incomplete, or when a row overflows the table.
+
+    \returns True if the table was patched, false if it must be rebuilt
+ */
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+bool BondedGroupData<group_size, Group, name, has_type_mapping>::patchGPUTableGPU()
+    {
+    const unsigned int n_groups = getN() + getNGhosts();
+    const unsigned int max_n_moved
+        = static_cast<unsigned int>(gpu_table_patch_fraction * static_cast<double>(n_groups));
+    unsigned int flag = 0;
+    unsigned int n_moved = 0;
+
+        {
+        ArrayHandle<members_t> d_groups(m_groups, access_location::device, access_mode::read);
+        ArrayHandle<typeval_t> d_group_typeval(m_group_typeval,
+                                               access_location::device,
+                                               access_mode::read);
+        ArrayHandle<unsigned int> d_group_tag(m_group_tag,
+                                              access_location::device,
+                                              access_mode::read);
+        ArrayHandle<unsigned int> d_rtag(m_pdata->getRTags(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<members_t> d_cached_idx(m_gpu_table_cached_idx,
+                                            access_location::device,
+                                            access_mode::read);
+        ArrayHandle<unsigned int> d_cached_tag(m_gpu_table_cached_tag,
+                                               access_location::device,
+                                               access_mode::read);
+        ArrayHandle<unsigned int> d_n_groups(m_gpu_n_groups,
+                                             access_location::device,
+                                             access_mode::readwrite);
+        ArrayHandle<members_t> d_gpu_table(m_gpu_table,
+                                           access_location::device,
+                                           access_mode::readwrite);
+        ArrayHandle<unsigned int> d_gpu_pos_table(m_gpu_pos_table,
+                                                  access_location::device,
+                                                  access_mode::readwrite);
+        ArrayHandle<unsigned int> d_condition(m_condition,
+                                              access_location::device,
+                                              access_mode::readwrite);
+
+        // allocate scratch buffers
+        CachedAllocator& alloc = m_exec_conf->getCachedAllocator();
+        ScopedAllocation<unsigned int> d_group_moved(alloc, n_groups);
+        ScopedAllocation<unsigned int> d_row_dirty(alloc, m_gpu_table_indexer.getW());
+
+        gpu_patch_group_table<group_size, members_t>(n_groups,
+                                                     m_gpu_table_indexer.getW(),
+                                                     d_groups.data,
+                                                     d_group_typeval.data,
+                                                     d_group_tag.data,
+                                                     d_rtag.data,
+                                                     d_cached_idx.data,
+                                                     d_cached_tag.data,
+                                                     d_n_groups.data,
+                                                     m_gpu_table_indexer.getH(),
+                                                     d_condition.data,
+                                                     m_next_flag,
+                                                     flag,
+                                                     d_gpu_table.data,
+                                                     d_gpu_pos_table.data,
+                                                     m_gpu_table_indexer.getW(),
+                                                     max_n_moved,
+                                                     n_moved,
+                                                     d_group_moved.data,
+                                                     d_row_dirty.data,
+                                                     has_type_mapping,
+                                                     alloc);
+        }
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+
+    // incomplete groups are reported by the full rebuild
+    if (flag >= m_next_flag + 1)
+        return false;
+
+    if (flag == m_next_flag)
+        {
+        // grow array by incrementing groups per particle, and rebuild it
+        m_gpu_table_indexer = Index2D(m_gpu_table_indexer.getW(), m_gpu_table_indexer.getH() + 1);
+        m_gpu_table.resize(m_gpu_table_indexer.getNumElements());
+        m_gpu_pos_table.resize(m_gpu_table_indexer.getNumElements());
+        m_next_flag++;
+        return false;
+        }
+
+    return n_moved <= max_n_moved;
+    }
+#endif
+
+/*! The groups are stably sorted by the smallest local index of their members, so that groups
+    that act on nearby particles are close in memory after the particles have been sorted. Ghost
+    groups stay at the end of the table in their current order. Subscribers are notified that the
+    groups have been reordered.
+ */
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::sortByParticleIndex()
+    {
+    const unsigned int n_groups = getN() + getNGhosts();
+    if (n_groups == 0)
+        return;
+
+    // resize the alternate arrays before taking any handles
+    getAltMembersArray();
+    getAltTypeValArray();
+    getAltTags();
+#ifdef ENABLE_MPI
+    const bool has_ranks = m_pdata->getDomainDecomposition() != nullptr;
+    if (has_ranks)
+        getAltRanksArray();
+#endif
+
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        sortByParticleIndexGPU();
+        }
+    else
+#endif
+        {
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::read);
+        ArrayHandle<members_t> h_groups(m_groups, access_location::host, access_mode::read);
+
+        // sort key: the smallest index of a member (ghost groups go last)
+        std::vector<unsigned int> keys(n_groups, NOT_LOCAL);
+        for (unsigned int group_idx = 0; group_idx < getN(); ++group_idx)
+            {
+            for (unsigned int i = 0; i < group_size; ++i)
+                {
+                keys[group_idx]
+                    = std::min(keys[group_idx], h_rtag.data[h_groups.data[group_idx].tag[i]]);
+                }
+            }
+
+        std::vector<unsigned int> order(n_groups);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(),
+                         order.end(),
+                         [&keys](unsigned int a, unsigned int b) { return keys[a] < keys[b]; });
+
+        ArrayHandle<typeval_t> h_group_typeval(m_group_typeval,
+                                               access_location::host,
+                                               access_mode::read);
+        ArrayHandle<unsigned int> h_group_tag(m_group_tag,
+                                              access_location::host,
+                                              access_mode::read);
+        ArrayHandle<unsigned int> h_group_rtag(m_group_rtag,
+                                               access_location::host,
+                                               access_mode::readwrite);
+        ArrayHandle<members_t> h_groups_alt(m_groups_alt,
+                                            access_location::host,
+                                            access_mode::overwrite);
+        ArrayHandle<typeval_t> h_group_typeval_alt(m_group_typeval_alt,
+                                                   access_location::host,
+                                                   access_mode::overwrite);
+        ArrayHandle<unsigned int> h_group_tag_alt(m_group_tag_alt,
+                                                  access_location::host,
+                                                  access_mode::overwrite);
+
+        for (unsigned int group_idx = 0; group_idx < n_groups; ++group_idx)
+            {
+            const unsigned int old_idx = order[group_idx];
+            h_groups_alt.data[group_idx] = h_groups.data[old_idx];
+            h_group_typeval_alt.data[group_idx] = h_group_typeval.data[old_idx];
+            h_group_tag_alt.data[group_idx] = h_group_tag.data[old_idx];
+            h_group_rtag.data[h_group_tag.data[old_idx]] = group_idx;
+            }
+
+#ifdef ENABLE_MPI
+        if (has_ranks)
+            {
+            ArrayHandle<ranks_t> h_group_ranks(m_group_ranks,
+                                               access_location::host,
+                                               access_mode::read);
+            ArrayHandle<ranks_t> h_group_ranks_alt(m_group_ranks_alt,
+                                                   access_location::host,
+                                                   access_mode::overwrite);
+            for (unsigned int group_idx = 0; group_idx < n_groups; ++group_idx)
+                {
+                h_group_ranks_alt.data[group_idx] = h_group_ranks.data[order[group_idx]];
+                }
+            }
+#endif
+        }
+
+    swapMemberArrays();
+    swapTypeArrays();
+    swapTagArrays();
+#ifdef ENABLE_MPI
+    if (has_ranks)
+        m_group_ranks.swap(m_group_ranks_alt);
+#endif
+
+    notifyGroupReorder();
+    }
+
+#ifdef ENABLE_HIP
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::sortByParticleIndexGPU()
+    {
+    ArrayHandle<unsigned int> d_rtag(m_pdata->getRTags(),
+                                     access_location::device,
+                                     access_mode::read);
+    ArrayHandle<members_t> d_groups(m_groups, access_location::device, access_mode::read);
+    ArrayHandle<typeval_t> d_group_typeval(m_group_typeval,
+                                           access_location::device,
+                                           access_mode::read);
+    ArrayHandle<unsigned int> d_group_tag(m_group_tag, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_group_rtag(m_group_rtag,
+                                           access_location::device,
+                                           access_mode::readwrite);
+    ArrayHandle<members_t> d_groups_alt(m_groups_alt,
+                                        access_location::device,
+                                        access_mode::overwrite);
+    ArrayHandle<typeval_t> d_group_typeval_alt(m_group_typeval_alt,
+                                               access_location::device,
+                                               access_mode::overwrite);
+    ArrayHandle<unsigned int> d_group_tag_alt(m_group_tag_alt,
+                                              access_location::device,
+                                              access_mode::overwrite);
+
+    // per-member ranks are only reordered with domain decomposition
+    const members_t* d_group_ranks_ptr = nullptr;
+    members_t* d_group_ranks_alt_ptr = nullptr;
+#ifdef ENABLE_MPI
+    const bool has_ranks = m_pdata->getDomainDecomposition() != nullptr;
+    ArrayHandle<ranks_t> d_group_ranks(m_group_ranks, access_location::device, access_mode::read);
+    ArrayHandle<ranks_t> d_group_ranks_alt(m_group_ranks_alt,
+                                           access_location::device,
+                                           access_mode::overwrite);
+    if (has_ranks)
+        {
+        d_group_ranks_ptr = d_group_ranks.data;
+        d_group_ranks_alt_ptr = d_group_ranks_alt.data;
+        }
+#endif
+
+    CachedAllocator& alloc = m_exec_conf->getCachedAllocator();
+    const unsigned int n_groups = getN() + getNGhosts();
+    ScopedAllocation<unsigned int> d_keys(alloc, n_groups);
+    ScopedAllocation<unsigned int> d_order(alloc, n_groups);
+
+    gpu_sort_groups<group_size, members_t>(n_groups,
+                                           getN(),
+                                           d_rtag.data,
+                                           d_groups.data,
+                                           d_group_typeval.data,
+                                           d_group_tag.data,
+                                           d_group_ranks_ptr,
+                                           d_groups_alt.data,
+                                           d_group_typeval_alt.data,
+                                           d_group_tag_alt.data,
+                                           d_group_ranks_alt_ptr,
+                                           d_group_rtag.data,
+                                           d_keys.data,
+                                           d_order.data,
+                                           alloc);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
     }
 #endif
 
@@ -1368,6 +1897,10 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::Snapshot::repli
     unsigned int old_n_particles)
     {
     unsigned int old_size = size;
+    if (uint64_t(old_size) * n > std::numeric_limits<unsigned int>::max())
+        throw std::runtime_error(std::string("Replication would create more ") + name
+                                 + "s than HOOMD supports!");
+
     groups.resize(n * old_size);
     if (has_type_mapping)
         {
@@ -1378,29 +1911,30 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::Snapshot::repli
         val.resize(n * old_size);
         }
 
-    for (unsigned int i = 0; i < old_size; ++i)
+    // replicate bonded groups one replica at a time, offsetting the particle tags by the number
+    // of particles in the preceding replicas
+    for (unsigned int j = 1; j < n; ++j)
         {
-        typename BondedGroupData<group_size, Group, name, has_type_mapping>::members_t g;
-        g = groups[i];
-
-        // replicate bonded group
-        for (unsigned int j = 0; j < n; ++j)
+        const unsigned int offset = old_size * j;
+        const unsigned int tag_offset = old_n_particles * j;
+        for (unsigned int i = 0; i < old_size; ++i)
             {
             typename BondedGroupData<group_size, Group, name, has_type_mapping>::members_t h;
 
             // update particle tags
             for (unsigned int k = 0; k < group_size; ++k)
-                h.tag[k] = g.tag[k] + old_n_particles * j;
+                h.tag[k] = groups[i].tag[k] + tag_offset;
 
-            groups[old_size * j + i] = h;
-            if (has_type_mapping)
-                {
-                type_id[old_size * j + i] = type_id[i];
-                }
-            else
-                {
-                val[old_size * j + i] = val[i];
-                }
+            groups[offset + i] = h;
+            }
+
+        if (has_type_mapping)
+            {
+            std::copy(type_id.begin(), type_id.begin() + old_size, type_id.begin() + offset);
+            }
+        else
+            {
+            std::copy(val.begin(), val.begin() + old_size, val.begin() + offset);
             }
         }
 
@@ -8,8 +8,11 @@
 #pragma GCC diagnostic ignored "-Wconversion"
 #include <hip/hip_runtime.h>
 #include <thrust/device_ptr.h>
+#include <thrust/copy.h>
 #include <thrust/execution_policy.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
 #include <thrust/scan.h>
 #include <thrust/sort.h>
 #pragma GCC diagnostic pop
@@ -61,29 +64,27 @@ __global__ void gpu_count_groups_kernel(const unsigned int n_groups,
         }
     }
 
+//! Construct the compact representation of a group for one of its members
+/*! \param group_idx Index of the group
+    \param pidx Index of the member particle
+    \param d_members Group members
+    \param d_group_typeval Group types or constraint values
+    \param d_rtag Particle reverse-lookup table
+    \param gpos Position of \a pidx in the group (output)
+    \param has_type_mapping True if the groups have types
+
+    \returns The indices of the other members, followed by the group type (or the group index
+             without a type mapping)
+ */
 template<unsigned int group_size, typename group_t>
-__global__ void gpu_group_scatter_kernel(unsigned int n_scratch,
-                                         const unsigned int* d_scratch_g,
-                                         const unsigned int* d_scratch_idx,
-                                         const unsigned int* d_offset,
-                                         const group_t* d_members,
-                                         const typeval_union* d_group_typeval,
-                                         const unsigned int* d_rtag,
-                                         group_t* d_pidx_group_table,
-                                         unsigned int* d_pidx_gpos_table,
-                                         unsigned int pidx_group_table_pitch,
-                                         bool has_type_mapping)
+__device__ inline group_t gpu_make_pidx_group(const unsigned int group_idx,
+                                              const unsigned int pidx,
+                                              const group_t* d_members,
+                                              const typeval_union* d_group_typeval,
+                                              const unsigned int* d_rtag,
+                                              unsigned int& gpos,
+                                              bool has_type_mapping)
     {
-    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
-
-    if (i >= n_scratch)
-        return;
-
-    unsigned int pidx = d_scratch_idx[i];
-    unsigned int offset = d_offset[i] * pidx_group_table_pitch + pidx;
-
-    // load group
-    unsigned int group_idx = d_scratch_g[i];
     group_t g = d_members[group_idx];
 
     // construct compact group representation, excluding particle pidx
@@ -103,7 +104,7 @@ __global__ void gpu_group_scatter_kernel(unsigned int n_scratch,
     unsigned int j = 0;
 
     // position in group
-    unsigned int gpos = 0;
+    gpos = 0;
 
     for (unsigned int k = 0; k < group_size; ++k)
         {
@@ -118,10 +119,87 @@ __global__ void gpu_group_scatter_kernel(unsigned int n_scratch,
         p.idx[j++] = pidx_k;
         }
 
-    d_pidx_group_table[offset] = p;
+    return p;
+    }
+
+template<unsigned int group_size, typename group_t>
+__global__ void gpu_group_scatter_kernel(unsigned int n_scratch,
+                                         const unsigned int* d_scratch_g,
+                                         const unsigned int* d_scratch_idx,
+                                         const unsigned int* d_offset,
+                                         const group_t* d_members,
+                                         const typeval_union* d_group_typeval,
+                                         const unsigned int* d_rtag,
+                                         group_t* d_pidx_group_table,
+                                         unsigned int* d_pidx_gpos_table,
+                                         unsigned int pidx_group_table_pitch,
+                                         bool has_type_mapping)
+    {
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (i >= n_scratch)
+        return;
+
+    unsigned int pidx = d_scratch_idx[i];
+    unsigned int offset = d_offset[i] * pidx_group_table_pitch + pidx;
+
+    unsigned int gpos;
+    d_pidx_group_table[offset] = gpu_make_pidx_group<group_size>(d_scratch_g[i],
+                                                                 pidx,
+                                                                 d_members,
+                                                                 d_group_typeval,
+                                                                 d_rtag,
+                                                                 gpos,
+                                                                 has_type_mapping);
     d_pidx_gpos_table[offset] = gpos;
     }
 
+/*! The scratch entries are sorted by particle index, so entry \a i is already at its place in the
+    compressed sparse row table.
+ */
+template<unsigned int group_size, typename group_t>
+__global__ void gpu_group_csr_scatter_kernel(unsigned int n_scratch,
+                                             const unsigned int* d_scratch_g,
+                                             const unsigned int* d_scratch_idx,
+                                             const group_t* d_members,
+                                             const typeval_union* d_group_typeval,
+                                             const unsigned int* d_rtag,
+                                             group_t* d_csr_table,
+                                             unsigned int* d_csr_pos_table,
+                                             bool has_type_mapping)
+    {
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (i >= n_scratch)
+        return;
+
+    unsigned int gpos;
+    d_csr_table[i] = gpu_make_pidx_group<group_size>(d_scratch_g[i],
+                                                     d_scratch_idx[i],
+                                                     d_members,
+                                                     d_group_typeval,
+                                                     d_rtag,
+                                                     gpos,
+                                                     has_type_mapping);
+    d_csr_pos_table[i] = gpos;
+    }
+
+//! Predicate for particles that are members of more than a number of groups
+struct gpu_group_high_degree
+    {
+    __host__ __device__ gpu_group_high_degree(unsigned int _high_degree)
+        : high_degree(_high_degree)
+        {
+        }
+
+    __device__ bool operator()(unsigned int n) const
+        {
+        return n > high_degree;
+        }
+
+    unsigned int high_degree; //!< Largest number of groups that is not high
+    };
+
 template<unsigned int group_size, typename group_t>
 void gpu_update_group_table(const unsigned int n_groups,
                             const unsigned int N,
@@ -218,6 +296,558 @@ void gpu_update_group_table(const unsigned int n_groups,
         }
     }
 
+template<unsigned int group_size, typename group_t>
+__global__ void gpu_mark_moved_groups_kernel(const unsigned int n_groups,
+                                             const group_t* d_group_table,
+                                             const unsigned int* d_group_tag,
+                                             const unsigned int* d_rtag,
+                                             const group_t* d_cached_idx,
+                                             const unsigned int* d_cached_tag,
+                                             unsigned int* d_group_moved,
+                                             unsigned int* d_row_dirty,
+                                             unsigned int* d_condition,
+                                             unsigned int next_flag)
+    {
+    unsigned int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (group_idx >= n_groups)
+        return;
+
+    group_t g = d_group_table[group_idx];
+    group_t cached = d_cached_idx[group_idx];
+
+    // a different group in this place counts as moved
+    bool moved = d_group_tag[group_idx] != d_cached_tag[group_idx];
+    group_t cur;
+    for (unsigned int i = 0; i < group_size; ++i)
+        {
+        cur.idx[i] = d_rtag[g.tag[i]];
+
+        // detect incomplete groups
+        if (cur.idx[i] == NOT_LOCAL)
+            atomicMax(d_condition, next_flag + 1 + group_idx);
+
+        moved |= cur.idx[i] != cached.idx[i];
+        }
+    d_group_moved[group_idx] = moved;
+
+    // the rows of both the old and the new members need to be refilled
+    if (moved)
+        {
+        for (unsigned int i = 0; i < group_size; ++i)
+            {
+            d_row_dirty[cached.idx[i]] = 1;
+            if (cur.idx[i] != NOT_LOCAL)
+                d_row_dirty[cur.idx[i]] = 1;
+            }
+        }
+    }
+
+__global__ void gpu_clear_dirty_rows_kernel(const unsigned int N,
+                                            const unsigned int* d_row_dirty,
+                                            unsigned int* d_n_groups)
+    {
+    unsigned int pidx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (pidx >= N)
+        return;
+
+    if (d_row_dirty[pidx])
+        d_n_groups[pidx] = 0;
+    }
+
+template<unsigned int group_size, typename group_t>
+__global__ void gpu_fill_dirty_rows_kernel(const unsigned int n_groups,
+                                           const group_t* d_group_table,
+                                           const typeval_union* d_group_typeval,
+                                           const unsigned int* d_rtag,
+                                           const unsigned int* d_row_dirty,
+                                           unsigned int* d_n_groups,
+                                           unsigned int max_n_groups,
+                                           unsigned int* d_condition,
+                                           unsigned int next_flag,
+                                           group_t* d_pidx_group_table,
+                                           unsigned int* d_pidx_gpos_table,
+                                           const unsigned int pidx_group_table_pitch,
+                                           bool has_type_mapping)
+    {
+    unsigned int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (group_idx >= n_groups)
+        return;
+
+    group_t g = d_group_table[group_idx];
+
+    for (unsigned int i = 0; i < group_size; ++i)
+        {
+        unsigned int pidx = d_rtag[g.tag[i]];
+        if (!d_row_dirty[pidx])
+            continue;
+
+        unsigned int n = atomicInc(&d_n_groups[pidx], 0xffffffff);
+        if (n >= max_n_groups)
+            {
+            // set flag to indicate we need to grow the output array
+            atomicMax(d_condition, next_flag);
+            continue;
+            }
+
+        unsigned int offset = n * pidx_group_table_pitch + pidx;
+        unsigned int gpos;
+        d_pidx_group_table[offset] = gpu_make_pidx_group<group_size>(group_idx,
+                                                                     pidx,
+                                                                     d_group_table,
+                                                                     d_group_typeval,
+                                                                     d_rtag,
+                                                                     gpos,
+                                                                     has_type_mapping);
+        d_pidx_gpos_table[offset] = gpos;
+        }
+    }
+
+/*! \param n_groups Number of local and ghost groups
+    \param N Number of rows in the table
+    \param d_group_table Group members
+    \param d_group_typeval Group types or constraint values
+    \param d_group_tag Group tags
+    \param d_rtag Particle reverse-lookup table
+    \param d_cached_idx Member indices of the groups when the table was last built
+    \param d_cached_tag Group tags when the table was last built
+    \param d_n_groups Number of groups per particle (updated)
+    \param max_n_groups Height of the table
+    \param d_condition Condition variable, set when a group is incomplete or a row overflows
+    \param next_flag Value of the condition variable that signals an overflow
+    \param flag Value of the condition variable (output)
+    \param d_pidx_group_table Groups by particle index (updated)
+    \param d_pidx_gpos_table Position of the particle in each group (updated)
+    \param pidx_group_table_pitch Pitch of the table
+    \param max_n_moved Largest number of moved groups to patch
+    \param n_moved Number of moved groups (output)
+    \param d_group_moved Temporary storage (n_groups elements)
+    \param d_row_dirty Temporary storage (N elements)
+    \param has_type_mapping True if the groups have types
+    \param alloc Caching allocator for temporary storage
+
+    A group has moved when the index of one of its members differs from \a d_cached_idx, or when a
+    different group is stored in its place. The rows of the old and new members of the moved groups
+    are emptied and refilled from all groups, and all other rows are left as they are. Nothing is
+    patched when more than \a max_n_moved groups have moved, or when a group is incomplete. If a
+    row overflows, \a flag is set to \a next_flag and the table must be rebuilt.
+ */
+template<unsigned int group_size, typename group_t>
+void gpu_patch_group_table(const unsigned int n_groups,
+                           const unsigned int N,
+                           const group_t* d_group_table,
+                           const typeval_union* d_group_typeval,
+                           const unsigned int* d_group_tag,
+                           const unsigned int* d_rtag,
+                           const group_t* d_cached_idx,
+                           const unsigned int* d_cached_tag,
+                           unsigned int* d_n_groups,
+                           unsigned int max_n_groups,
+                           unsigned int* d_condition,
+                           unsigned int next_flag,
+                           unsigned int& flag,
+                           group_t* d_pidx_group_table,
+                           unsigned int* d_pidx_gpos_table,
+                           const unsigned int pidx_group_table_pitch,
+                           const unsigned int max_n_moved,
+                           unsigned int& n_moved,
+                           unsigned int* d_group_moved,
+                           unsigned int* d_row_dirty,
+                           bool has_type_mapping,
+                           CachedAllocator& alloc)
+    {
+    n_moved = 0;
+    if (n_groups == 0)
+        return;
+
+    unsigned int block_size = 256;
+    unsigned int n_blocks = n_groups / block_size + 1;
+
+    hipMemsetAsync(d_row_dirty, 0, sizeof(unsigned int) * N);
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_mark_moved_groups_kernel<group_size>),
+                       dim3(n_blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       n_groups,
+                       d_group_table,
+                       d_group_tag,
+                       d_rtag,
+                       d_cached_idx,
+                       d_cached_tag,
+                       d_group_moved,
+                       d_row_dirty,
+                       d_condition,
+                       next_flag);
+
+    // read back flag, incomplete groups are reported by the full rebuild
+    hipMemcpy(&flag, d_condition, sizeof(unsigned int), hipMemcpyDeviceToHost);
+    if (flag >= next_flag + 1)
+        return;
+
+    thrust::device_ptr<unsigned int> group_moved(d_group_moved);
+#ifdef __HIP_PLATFORM_HCC__
+    n_moved = thrust::reduce(thrust::hip::par(alloc),
+#else
+    n_moved = thrust::reduce(thrust::cuda::par(alloc),
+#endif
+                             group_moved,
+                             group_moved + n_groups,
+                             0u);
+    if (n_moved == 0 || n_moved > max_n_moved)
+        return;
+
+    hipLaunchKernelGGL(gpu_clear_dirty_rows_kernel,
+                       dim3(N / block_size + 1),
+                       dim3(block_size),
+                       0,
+                       0,
+                       N,
+                       d_row_dirty,
+                       d_n_groups);
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_fill_dirty_rows_kernel<group_size>),
+                       dim3(n_blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       n_groups,
+                       d_group_table,
+                       d_group_typeval,
+                       d_rtag,
+                       d_row_dirty,
+                       d_n_groups,
+                       max_n_groups,
+                       d_condition,
+                       next_flag,
+                       d_pidx_group_table,
+                       d_pidx_gpos_table,
+                       pidx_group_table_pitch,
+                       has_type_mapping);
+
+    // read back flag to check for overflowing rows
+    hipMemcpy(&flag, d_condition, sizeof(unsigned int), hipMemcpyDeviceToHost);
+    }
+
+template<unsigned int group_size, typename group_t>
+__global__ void gpu_cache_group_table_kernel(const unsigned int n_groups,
+                                             const group_t* d_group_table,
+                                             const unsigned int* d_group_tag,
+                                             const unsigned int* d_rtag,
+                                             group_t* d_cached_idx,
+                                             unsigned int* d_cached_tag)
+    {
+    unsigned int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (group_idx >= n_groups)
+        return;
+
+    group_t g = d_group_table[group_idx];
+    group_t cached;
+    for (unsigned int i = 0; i < group_size; ++i)
+        cached.idx[i] = d_rtag[g.tag[i]];
+
+    d_cached_idx[group_idx] = cached;
+    d_cached_tag[group_idx] = d_group_tag[group_idx];
+    }
+
+/*! \param n_groups Number of local and ghost groups
+    \param d_group_table Group members
+    \param d_group_tag Group tags
+    \param d_rtag Particle reverse-lookup table
+    \param d_cached_idx Member indices of the groups (output)
+    \param d_cached_tag Group tags (output)
+ */
+template<unsigned int group_size, typename group_t>
+void gpu_cache_group_table(const unsigned int n_groups,
+                           const group_t* d_group_table,
+                           const unsigned int* d_group_tag,
+                           const unsigned int* d_rtag,
+                           group_t* d_cached_idx,
+                           unsigned int* d_cached_tag)
+    {
+    unsigned int block_size = 256;
+    unsigned int n_blocks = n_groups / block_size + 1;
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_cache_group_table_kernel<group_size>),
+                       dim3(n_blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       n_groups,
+                       d_group_table,
+                       d_group_tag,
+                       d_rtag,
+                       d_cached_idx,
+                       d_cached_tag);
+    }
+
+/*! \param n_groups Number of local and ghost groups
+    \param N Number of local and ghost particles
+    \param N_local Number of local particles
+    \param d_group_table Group members
+    \param d_group_typeval Group types or constraint values
+    \param d_rtag Particle reverse-lookup table
+    \param d_condition Condition variable, set when a group is incomplete
+    \param next_flag Value of the condition variable that signals an error
+    \param flag Value of the condition variable (output)
+    \param d_csr_table Groups by particle index (output, group_size * n_groups elements)
+    \param d_csr_pos_table Position of the particle in each group (output, as \a d_csr_table)
+    \param d_csr_offsets Offset of the first group of each particle (output, N + 1 elements)
+    \param d_high_degree Local particles with more than \a high_degree groups (output, N_local
+           elements)
+    \param high_degree Largest number of groups of a particle that is not listed in
+           \a d_high_degree
+    \param n_high_degree Number of particles in \a d_high_degree (output)
+    \param d_scratch_g Temporary storage (group_size * n_groups elements)
+    \param d_scratch_idx Temporary storage (group_size * n_groups elements)
+    \param d_scratch_n_groups Temporary storage (N + 1 elements)
+    \param has_type_mapping True if the groups have types
+    \param alloc Caching allocator for temporary storage
+
+    Every group has an entry for each of its members, so the size of the table is known up front
+    and it does not need to grow like the two-dimensional table. The groups of particle \a i are
+    stored in the range [d_csr_offsets[i], d_csr_offsets[i+1]).
+ */
+template<unsigned int group_size, typename group_t>
+void gpu_update_group_csr_table(const unsigned int n_groups,
+                                const unsigned int N,
+                                const unsigned int N_local,
+                                const group_t* d_group_table,
+                                const typeval_union* d_group_typeval,
+                                const unsigned int* d_rtag,
+                                unsigned int* d_condition,
+                                unsigned int next_flag,
+                                unsigned int& flag,
+                                group_t* d_csr_table,
+                                unsigned int* d_csr_pos_table,
+                                unsigned int* d_csr_offsets,
+                                unsigned int* d_high_degree,
+                                const unsigned int high_degree,
+                                unsigned int& n_high_degree,
+                                unsigned int* d_scratch_g,
+                                unsigned int* d_scratch_idx,
+                                unsigned int* d_scratch_n_groups,
+                                bool has_type_mapping,
+                                CachedAllocator& alloc)
+    {
+    n_high_degree = 0;
+
+    // count the groups per particle, the last element stays zero so that the scan gives the total
+    unsigned int block_size = 256;
+    unsigned int n_blocks = n_groups / block_size + 1;
+    hipMemsetAsync(d_scratch_n_groups, 0, sizeof(unsigned int) * (N + 1));
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_count_groups_kernel<group_size>),
+                       dim3(n_blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       n_groups,
+                       d_group_table,
+                       d_rtag,
+                       d_scratch_idx,
+                       d_scratch_g,
+                       d_scratch_n_groups,
+                       0xffffffff,
+                       d_condition,
+                       next_flag);
+
+    // read back flag, incomplete groups are reported by the caller
+    hipMemcpy(&flag, d_condition, sizeof(unsigned int), hipMemcpyDeviceToHost);
+    if (flag >= next_flag)
+        return;
+
+    thrust::device_ptr<unsigned int> scratch_n_groups(d_scratch_n_groups);
+    thrust::device_ptr<unsigned int> csr_offsets(d_csr_offsets);
+#ifdef __HIP_PLATFORM_HCC__
+    thrust::exclusive_scan(thrust::hip::par(alloc),
+#else
+    thrust::exclusive_scan(thrust::cuda::par(alloc),
+#endif
+                           scratch_n_groups,
+                           scratch_n_groups + N + 1,
+                           csr_offsets);
+
+    if (n_groups)
+        {
+        // sort groups by particle idx, which puts them in their place in the table
+        thrust::device_ptr<unsigned int> scratch_idx(d_scratch_idx);
+        thrust::device_ptr<unsigned int> scratch_g(d_scratch_g);
+#ifdef __HIP_PLATFORM_HCC__
+        thrust::sort_by_key(thrust::hip::par(alloc),
+#else
+        thrust::sort_by_key(thrust::cuda::par(alloc),
+#endif
+                            scratch_idx,
+                            scratch_idx + group_size * n_groups,
+                            scratch_g);
+
+        n_blocks = (group_size * n_groups) / block_size + 1;
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_group_csr_scatter_kernel<group_size>),
+                           dim3(n_blocks),
+                           dim3(block_size),
+                           0,
+                           0,
+                           n_groups * group_size,
+                           d_scratch_g,
+                           d_scratch_idx,
+                           d_group_table,
+                           d_group_typeval,
+                           d_rtag,
+                           d_csr_table,
+                           d_csr_pos_table,
+                           has_type_mapping);
+        }
+
+    // list the local particles that are members of many groups
+    if (N_local)
+        {
+        thrust::device_ptr<unsigned int> high_degree_ptr(d_high_degree);
+        thrust::counting_iterator<unsigned int> pidx(0);
+#ifdef __HIP_PLATFORM_HCC__
+        thrust::device_ptr<unsigned int> last = thrust::copy_if(thrust::hip::par(alloc),
+#else
+        thrust::device_ptr<unsigned int> last = thrust::copy_if(thrust::cuda::par(alloc),
+#endif
+                                                                pidx,
+                                                                pidx + N_local,
+                                                                scratch_n_groups,
+                                                                high_degree_ptr,
+                                                                gpu_group_high_degree(high_degree));
+        n_high_degree = static_cast<unsigned int>(last - high_degree_ptr);
+        }
+    }
+
+template<unsigned int group_size, typename group_t>
+__global__ void gpu_group_sort_keys_kernel(const unsigned int n_groups,
+                                           const unsigned int n_local_groups,
+                                           const unsigned int* d_rtag,
+                                           const group_t* d_groups,
+                                           unsigned int* d_keys,
+                                           unsigned int* d_order)
+    {
+    unsigned int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (group_idx >= n_groups)
+        return;
+
+    // ghost groups keep their place at the end of the table
+    unsigned int key = NOT_LOCAL;
+    if (group_idx < n_local_groups)
+        {
+        group_t g = d_groups[group_idx];
+        for (unsigned int i = 0; i < group_size; ++i)
+            key = min(key, d_rtag[g.tag[i]]);
+        }
+
+    d_keys[group_idx] = key;
+    d_order[group_idx] = group_idx;
+    }
+
+template<typename group_t>
+__global__ void gpu_group_gather_kernel(const unsigned int n_groups,
+                                        const unsigned int* d_order,
+                                        const group_t* d_groups,
+                                        const typeval_union* d_group_typeval,
+                                        const unsigned int* d_group_tag,
+                                        const group_t* d_group_ranks,
+                                        group_t* d_groups_alt,
+                                        typeval_union* d_group_typeval_alt,
+                                        unsigned int* d_group_tag_alt,
+                                        group_t* d_group_ranks_alt,
+                                        unsigned int* d_group_rtag)
+    {
+    unsigned int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (group_idx >= n_groups)
+        return;
+
+    unsigned int old_idx = d_order[group_idx];
+    d_groups_alt[group_idx] = d_groups[old_idx];
+    d_group_typeval_alt[group_idx] = d_group_typeval[old_idx];
+
+    unsigned int group_tag = d_group_tag[old_idx];
+    d_group_tag_alt[group_idx] = group_tag;
+    d_group_rtag[group_tag] = group_idx;
+
+    if (d_group_ranks)
+        d_group_ranks_alt[group_idx] = d_group_ranks[old_idx];
+    }
+
+/*! \param n_groups Number of local and ghost groups
+    \param n_local_groups Number of local groups
+    \param d_rtag Particle reverse-lookup table
+    \param d_groups Group members
+    \param d_group_typeval Group types or constraint values
+    \param d_group_tag Group tags
+    \param d_group_ranks Group member ranks (nullptr without domain decomposition)
+    \param d_groups_alt Reordered group members (output)
+    \param d_group_typeval_alt Reordered group types or constraint values (output)
+    \param d_group_tag_alt Reordered group tags (output)
+    \param d_group_ranks_alt Reordered group member ranks (output)
+    \param d_group_rtag Group reverse-lookup table (updated)
+    \param d_keys Temporary storage for the sort keys (n_groups elements)
+    \param d_order Temporary storage for the sort order (n_groups elements)
+    \param alloc Caching allocator for temporary storage
+ */
+template<unsigned int group_size, typename group_t>
+void gpu_sort_groups(const unsigned int n_groups,
+                     const unsigned int n_local_groups,
+                     const unsigned int* d_rtag,
+                     const group_t* d_groups,
+                     const typeval_union* d_group_typeval,
+                     const unsigned int* d_group_tag,
+                     const group_t* d_group_ranks,
+                     group_t* d_groups_alt,
+                     typeval_union* d_group_typeval_alt,
+                     unsigned int* d_group_tag_alt,
+                     group_t* d_group_ranks_alt,
+                     unsigned int* d_group_rtag,
+                     unsigned int* d_keys,
+                     unsigned int* d_order,
+                     CachedAllocator& alloc)
+    {
+    unsigned int block_size = 256;
+    unsigned int n_blocks = n_groups / block_size + 1;
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_group_sort_keys_kernel<group_size>),
+                       dim3(n_blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       n_groups,
+                       n_local_groups,
+                       d_rtag,
+                       d_groups,
+                       d_keys,
+                       d_order);
+
+    thrust::device_ptr<unsigned int> keys(d_keys);
+    thrust::device_ptr<unsigned int> order(d_order);
+#ifdef __HIP_PLATFORM_HCC__
+    thrust::stable_sort_by_key(thrust::hip::par(alloc),
+#else
+    thrust::stable_sort_by_key(thrust::cuda::par(alloc),
+#endif
+                               keys,
+                               keys + n_groups,
+                               order);
+
+    hipLaunchKernelGGL(gpu_group_gather_kernel<group_t>,
+                       dim3(n_blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       n_groups,
+                       d_order,
+                       d_groups,
+                       d_group_typeval,
+                       d_group_tag,
+                       d_group_ranks,
+                       d_groups_alt,
+                       d_group_typeval_alt,
+                       d_group_tag_alt,
+                       d_group_ranks_alt,
+                       d_group_rtag);
+    }
+
 /*
  * Explicit template instantiations
  */
@@ -301,4 +931,264 @@ template void gpu_update_group_table<6>(const unsigned int n_groups,
                                         unsigned int* d_offsets,
                                         bool has_type_mapping,
                                         CachedAllocator& alloc);
+
+//! BondData
+template void gpu_patch_group_table<2>(const unsigned int n_groups,
+                                       const unsigned int N,
+                                       const group_storage<2>* d_group_table,
+                                       const typeval_union* d_group_typeval,
+                                       const unsigned int* d_group_tag,
+                                       const unsigned int* d_rtag,
+                                       const group_storage<2>* d_cached_idx,
+                                       const unsigned int* d_cached_tag,
+                                       unsigned int* d_n_groups,
+                                       unsigned int max_n_groups,
+                                       unsigned int* d_condition,
+                                       unsigned int next_flag,
+                                       unsigned int& flag,
+                                       group_storage<2>* d_pidx_group_table,
+                                       unsigned int* d_pidx_gpos_table,
+                                       const unsigned int pidx_group_table_pitch,
+                                       const unsigned int max_n_moved,
+                                       unsigned int& n_moved,
+                                       unsigned int* d_group_moved,
+                                       unsigned int* d_row_dirty,
+                                       bool has_type_mapping,
+                                       CachedAllocator& alloc);
+
+template void gpu_cache_group_table<2>(const unsigned int n_groups,
+                                       const group_storage<2>* d_group_table,
+                                       const unsigned int* d_group_tag,
+                                       const unsigned int* d_rtag,
+                                       group_storage<2>* d_cached_idx,
+                                       unsigned int* d_cached_tag);
+
+//! AngleData
+template void gpu_patch_group_table<3>(const unsigned int n_groups,
+                                       const unsigned int N,
+                                       const group_storage<3>* d_group_table,
+                                       const typeval_union* d_group_typeval,
+                                       const unsigned int* d_group_tag,
+                                       const unsigned int* d_rtag,
+                                       const group_storage<3>* d_cached_idx,
+                                       const unsigned int* d_cached_tag,
+                                       unsigned int* d_n_groups,
+                                       unsigned int max_n_groups,
+                                       unsigned int* d_condition,
+                                       unsigned int next_flag,
+                                       unsigned int& flag,
+                                       group_storage<3>* d_pidx_group_table,
+                                       unsigned int* d_pidx_gpos_table,
+                                       const unsigned int pidx_group_table_pitch,
+                                       const unsigned int max_n_moved,
+                                       unsigned int& n_moved,
+                                       unsigned int* d_group_moved,
+                                       unsigned int* d_row_dirty,
+                                       bool has_type_mapping,
+                                       CachedAllocator& alloc);
+
+template void gpu_cache_group_table<3>(const unsigned int n_groups,
+                                       const group_storage<3>* d_group_table,
+                                       const unsigned int* d_group_tag,
+                                       const unsigned int* d_rtag,
+                                       group_storage<3>* d_cached_idx,
+                                       unsigned int* d_cached_tag);
+
+//! DihedralData and ImproperData
+template void gpu_patch_group_table<4>(const unsigned int n_groups,
+                                       const unsigned int N,
+                                       const group_storage<4>* d_group_table,
+                                       const typeval_union* d_group_typeval,
+                                       const unsigned int* d_group_tag,
+                                       const unsigned int* d_rtag,
+                                       const group_storage<4>* d_cached_idx,
+                                       const unsigned int* d_cached_tag,
+                                       unsigned int* d_n_groups,
+                                       unsigned int max_n_groups,
+                                       unsigned int* d_condition,
+                                       unsigned int next_flag,
+                                       unsigned int& flag,
+                                       group_storage<4>* d_pidx_group_table,
+                                       unsigned int* d_pidx_gpos_table,
+                                       const unsigned int pidx_group_table_pitch,
+                                       const unsigned int max_n_moved,
+                                       unsigned int& n_moved,
+                                       unsigned int* d_group_moved,
+                                       unsigned int* d_row_dirty,
+                                       bool has_type_mapping,
+                                       CachedAllocator& alloc);
+
+template void gpu_cache_group_table<4>(const unsigned int n_groups,
+                                       const group_storage<4>* d_group_table,
+                                       const unsigned int* d_group_tag,
+                                       const unsigned int* d_rtag,
+                                       group_storage<4>* d_cached_idx,
+                                       unsigned int* d_cached_tag);
+
+//! MeshTriangleData
+template void gpu_patch_group_table<6>(const unsigned int n_groups,
+                                       const unsigned int N,
+                                       const group_storage<6>* d_group_table,
+                                       const typeval_union* d_group_typeval,
+                                       const unsigned int* d_group_tag,
+                                       const unsigned int* d_rtag,
+                                       const group_storage<6>* d_cached_idx,
+                                       const unsigned int* d_cached_tag,
+                                       unsigned int* d_n_groups,
+                                       unsigned int max_n_groups,
+                                       unsigned int* d_condition,
+                                       unsigned int next_flag,
+                                       unsigned int& flag,
+                                       group_storage<6>* d_pidx_group_table,
+                                       unsigned int* d_pidx_gpos_table,
+                                       const unsigned int pidx_group_table_pitch,
+                                       const unsigned int max_n_moved,
+                                       unsigned int& n_moved,
+                                       unsigned int* d_group_moved,
+                                       unsigned int* d_row_dirty,
+                                       bool has_type_mapping,
+                                       CachedAllocator& alloc);
+
+template void gpu_cache_group_table<6>(const unsigned int n_groups,
+                                       const group_storage<6>* d_group_table,
+                                       const unsigned int* d_group_tag,
+                                       const unsigned int* d_rtag,
+                                       group_storage<6>* d_cached_idx,
+                                       unsigned int* d_cached_tag);
+
+//! BondData
+template void gpu_update_group_csr_table<2>(const unsigned int n_groups,
+                                            const unsigned int N,
+                                            const unsigned int N_local,
+                                            const group_storage<2>* d_group_table,
+                                            const typeval_union* d_group_typeval,
+                                            const unsigned int* d_rtag,
+                                            unsigned int* d_condition,
+                                            unsigned int next_flag,
+                                            unsigned int& flag,
+                                            group_storage<2>* d_csr_table,
+                                            unsigned int* d_csr_pos_table,
+                                            unsigned int* d_csr_offsets,
+                                            unsigned int* d_high_degree,
+                                            const unsigned int high_degree,
+                                            unsigned int& n_high_degree,
+                                            unsigned int* d_scratch_g,
+                                            unsigned int* d_scratch_idx,
+                                            unsigned int* d_scratch_n_groups,
+                                            bool has_type_mapping,
+                                            CachedAllocator& alloc);
+
+//! AngleData
+template void gpu_update_group_csr_table<3>(const unsigned int n_groups,
+                                            const unsigned int N,
+                                            const unsigned int N_local,
+                                            const group_storage<3>* d_group_table,
+                                            const typeval_union* d_group_typeval,
+                                            const unsigned int* d_rtag,
+                                            unsigned int* d_condition,
+                                            unsigned int next_flag,
+                                            unsigned int& flag,
+                                            group_storage<3>* d_csr_table,
+                                            unsigned int* d_csr_pos_table,
+                                            unsigned int* d_csr_offsets,
+                                            unsigned int* d_high_degree,
+                                            const unsigned int high_degree,
+                                            unsigned int& n_high_degree,
+                                            unsigned int* d_scratch_g,
+                                            unsigned int* d_scratch_idx,
+                                            unsigned int* d_scratch_n_groups,
+                                            bool has_type_mapping,
+                                            CachedAllocator& alloc);
+
+//! DihedralData and ImproperData
+template void gpu_update_group_csr_table<4>(const unsigned int n_groups,
+                                            const unsigned int N,
+                                            const unsigned int N_local,
+                                            const group_storage<4>* d_group_table,
+                                            const typeval_union* d_group_typeval,
+                                            const unsigned int* d_rtag,
+                                            unsigned int* d_condition,
+                                            unsigned int next_flag,
+                                            unsigned int& flag,
+                                            group_storage<4>* d_csr_table,
+                                            unsigned int* d_csr_pos_table,
+                                            unsigned int* d_csr_offsets,
+                                            unsigned int* d_high_degree,
+                                            const unsigned int high_degree,
+                                            unsigned int& n_high_degree,
+                                            unsigned int* d_scratch_g,
+                                            unsigned int* d_scratch_idx,
+                                            unsigned int* d_scratch_n_groups,
+                                            bool has_type_mapping,
+                                            CachedAllocator& alloc);
+
+//! MeshTriangleData
+template void gpu_update_group_csr_table<6>(const unsigned int n_groups,
+                                            const unsigned int N,
+                                            const unsigned int N_local,
+                                            const group_storage<6>* d_group_table,
+                                            const typeval_union* d_group_typeval,
+                                            const unsigned int* d_rtag,
+                                            unsigned int* d_condition,
+                                            unsigned int next_flag,
+                                            unsigned int& flag,
+                                            group_storage<6>* d_csr_table,
+                                            unsigned int* d_csr_pos_table,
+                                            unsigned int* d_csr_offsets,
+                                            unsigned int* d_high_degree,
+                                            const unsigned int high_degree,
+                                            unsigned int& n_high_degree,
+                                            unsigned int* d_scratch_g,
+                                            unsigned int* d_scratch_idx,
+                                            unsigned int* d_scratch_n_groups,
+                                            bool has_type_mapping,
+                                            CachedAllocator& alloc);
+
+template void gpu_sort_groups<2>(const unsigned int n_groups,
+                                 const unsigned int n_local_groups,
+                                 const unsigned int* d_rtag,
+                                 const group_storage<2>* d_groups,
+                                 const typeval_union* d_group_typeval,
+                                 const unsigned int* d_group_tag,
+                                 const group_storage<2>* d_group_ranks,
+                                 group_storage<2>* d_groups_alt,
+                                 typeval_union* d_group_typeval_alt,
+                                 unsigned int* d_group_tag_alt,
+                                 group_storage<2>* d_group_ranks_alt,
+                                 unsigned int* d_group_rtag,
+                                 unsigned int* d_keys,
+                                 unsigned int* d_order,
+                                 CachedAllocator& alloc);
+
+template void gpu_sort_groups<3>(const unsigned int n_groups,
+                                 const unsigned int n_local_groups,
+                                 const unsigned int* d_rtag,
+                                 const group_storage<3>* d_groups,
+                                 const typeval_union* d_group_typeval,
+                                 const unsigned int* d_group_tag,
+                                 const group_storage<3>* d_group_ranks,
+                                 group_storage<3>* d_groups_alt,
+                                 typeval_union* d_group_typeval_alt,
+                                 unsigned int* d_group_tag_alt,
+                                 group_storage<3>* d_group_ranks_alt,
+                                 unsigned int* d_group_rtag,
+                                 unsigned int* d_keys,
+                                 unsigned int* d_order,
+                                 CachedAllocator& alloc);
+
+template void gpu_sort_groups<4>(const unsigned int n_groups,
+                                 const unsigned int n_local_groups,
+                                 const unsigned int* d_rtag,
+                                 const group_storage<4>* d_groups,
+                                 const typeval_union* d_group_typeval,
+                                 const unsigned int* d_group_tag,
+                                 const group_storage<4>* d_group_ranks,
+                                 group_storage<4>* d_groups_alt,
+                                 typeval_union* d_group_typeval_alt,
+                                 unsigned int* d_group_tag_alt,
+                                 group_storage<4>* d_group_ranks_alt,
+                                 unsigned int* d_group_rtag,
+                                 unsigned int* d_keys,
+                                 unsigned int* d_order,
+                                 CachedAllocator& alloc);
     } // end namespace hoomd
@@ -69,5 +69,80 @@ void gpu_update_group_table(const unsigned int n_groups,
                             bool has_type_mapping,
                             CachedAllocator& alloc);
 
+//! Patch the group-by-particle-index table for the groups whose members have moved
+template<unsigned int group_size, typename group_t>
+void gpu_patch_group_table(const unsigned int n_groups,
+                           const unsigned int N,
+                           const group_t* d_group_table,
+                           const typeval_union* d_group_typeval,
+                           const unsigned int* d_group_tag,
+                           const unsigned int* d_rtag,
+                           const group_t* d_cached_idx,
+                           const unsigned int* d_cached_tag,
+                           unsigned int* d_n_groups,
+                           unsigned int max_n_groups,
+                           unsigned int* d_condition,
+                           unsigned int next_flag,
+                           unsigned int& flag,
+                           group_t* d_pidx_group_table,
+                           unsigned int* d_pidx_gpos_table,
+                           const unsigned int pidx_group_table_pitch,
+                           const unsigned int max_n_moved,
+                           unsigned int& n_moved,
+                           unsigned int* d_group_moved,
+                           unsigned int* d_row_dirty,
+                           bool has_type_mapping,
+                           CachedAllocator& alloc);
+
+//! Record the member indices and tags of the groups in the group-by-particle-index table
+template<unsigned int group_size, typename group_t>
+void gpu_cache_group_table(const unsigned int n_groups,
+                           const group_t* d_group_table,
+                           const unsigned int* d_group_tag,
+                           const unsigned int* d_rtag,
+                           group_t* d_cached_idx,
+                           unsigned int* d_cached_tag);
+
+//! Build the group-by-particle-index table in compressed sparse row format
+template<unsigned int group_size, typename group_t>
+void gpu_update_group_csr_table(const unsigned int n_groups,
+                                const unsigned int N,
+                                const unsigned int N_local,
+                                const group_t* d_group_table,
+                                const typeval_union* d_group_typeval,
+                                const unsigned int* d_rtag,
+                                unsigned int* d_condition,
+                                unsigned int next_flag,
+                                unsigned int& flag,
+                                group_t* d_csr_table,
+                                unsigned int* d_csr_pos_table,
+                                unsigned int* d_csr_offsets,
+                                unsigned int* d_high_degree,
+                                const unsigned int high_degree,
+                                unsigned int& n_high_degree,
+                                unsigned int* d_scratch_g,
+                                unsigned int* d_scratch_idx,
+                                unsigned int* d_scratch_n_groups,
+                                bool has_type_mapping,
+                                CachedAllocator& alloc);
+
+//! Reorder the bonded groups by the smallest index of their members
+template<unsigned int group_size, typename group_t>
+void gpu_sort_groups(const unsigned int n_groups,
+                     const unsigned int n_local_groups,
+                     const unsigned int* d_rtag,
+                     const group_t* d_groups,
+                     const typeval_union* d_group_typeval,
+                     const unsigned int* d_group_tag,
+                     const group_t* d_group_ranks,
+                     group_t* d_groups_alt,
+                     typeval_union* d_group_typeval_alt,
+                     unsigned int* d_group_tag_alt,
+                     group_t* d_group_ranks_alt,
+                     unsigned int* d_group_rtag,
+                     unsigned int* d_keys,
+                     unsigned int* d_order,
+                     CachedAllocator& alloc);
+
     } // end namespace hoomd
 #endif // __BONDED_GROUP_DATA_CUH__
@@ -527,6 +527,9 @@ class BondedGroupData
         m_group_tag.swap(m_group_tag_alt);
         }
 
+    //! Reorder the groups by the indices of their member particles
+    void sortByParticleIndex();
+
 #ifdef ENABLE_MPI
     //! Swap group ranks arrays
     void swapRankArrays()
@@ -585,6 +588,81 @@ class BondedGroupData
         return m_gpu_n_groups;
         }
 
+    /*
+     * GPU group table in compressed sparse row format
+     */
+
+    //! Largest number of groups of a particle that is not listed by getGPUCSRHighDegree()
+    static const unsigned int csr_high_degree = 32;
+
+    //! Return GPU bonded groups list, stored contiguously by particle index
+    const GPUVector<members_t>& getGPUCSRTable()
+        {
+        // rebuild lookup table if necessary
+        if (m_csr_dirty)
+            {
+            rebuildGPUCSRTable();
+            m_csr_dirty = false;
+            }
+
+        return m_gpu_csr_table;
+        }
+
+    //! Return GPU list of particle in group position, stored like getGPUCSRTable()
+    const GPUVector<unsigned int>& getGPUCSRPosTable()
+        {
+        // rebuild lookup table if necessary
+        if (m_csr_dirty)
+            {
+            rebuildGPUCSRTable();
+            m_csr_dirty = false;
+            }
+
+        return m_gpu_csr_pos_table;
+        }
+
+    //! Return offsets of the groups of each particle in getGPUCSRTable()
+    /*! The groups of particle i are in the range [offsets[i], offsets[i+1]). There is one entry
+        per local and ghost particle, plus one for the end of the table.
+     */
+    const GPUVector<unsigned int>& getGPUCSROffsets()
+        {
+        // rebuild lookup table if necessary
+        if (m_csr_dirty)
+            {
+            rebuildGPUCSRTable();
+            m_csr_dirty = false;
+            }
+
+        return m_gpu_csr_offsets;
+        }
+
+    //! Return the local particles that are members of more than csr_high_degree groups
+    const GPUVector<unsigned int>& getGPUCSRHighDegree()
+        {
+        // rebuild lookup table if necessary
+        if (m_csr_dirty)
+            {
+            rebuildGPUCSRTable();
+            m_csr_dirty = false;
+            }
+
+        return m_gpu_csr_high_degree;
+        }
+
+    //! Return the number of local particles that are members of more than csr_high_degree groups
+    unsigned int getNGPUCSRHighDegree()
+        {
+        // rebuild lookup table if necessary
+        if (m_csr_dirty)
+            {
+            rebuildGPUCSRTable();
+            m_csr_dirty = false;
+            }
+
+        return m_n_gpu_csr_high_degree;
+        }
+
     /*
      * add/remove groups globally
      */
@@ -616,6 +694,7 @@ class BondedGroupData
         {
         // set flag to trigger rebuild of GPU table
         m_groups_dirty = true;
+        m_csr_dirty = true;
 
         // notify subscribers
         m_group_reorder_signal.emit();
@@ -625,6 +704,7 @@ class BondedGroupData
     void setDirty()
         {
         m_groups_dirty = true;
+        m_csr_dirty = true;
         }
 
 #ifdef ENABLE_MPI
@@ -652,6 +732,12 @@ class BondedGroupData
     GPUVector<unsigned int> m_gpu_n_groups;  //!< Number of entries in lookup table per particle
     std::vector<std::string> m_type_mapping; //!< Mapping of types of bonded groups
 
+    GPUVector<members_t> m_gpu_csr_table;          //!< Groups by particle index in CSR format
+    GPUVector<unsigned int> m_gpu_csr_pos_table;   //!< Position of particle idx in CSR group table
+    GPUVector<unsigned int> m_gpu_csr_offsets;     //!< Offset of the groups of each particle
+    GPUVector<unsigned int> m_gpu_csr_high_degree; //!< Local particles with many groups
+    unsigned int m_n_gpu_csr_high_degree;          //!< Number of local particles with many groups
+
     unsigned int m_n_groups; //!< Number of local groups
     unsigned int m_n_ghost;  //!< Number of ghost groups with no local ptl
 
@@ -680,9 +766,17 @@ class BondedGroupData
 #ifdef ENABLE_HIP
     GPUArray<unsigned int> m_condition; //!< Condition variable for rebuilding GPU table on the GPU
     unsigned int m_next_flag;           //!< Next flag value for GPU table rebuild
+
+    GPUVector<members_t> m_gpu_table_cached_idx;     //!< Member indices at the last table build
+    GPUVector<unsigned int> m_gpu_table_cached_tag; //!< Group tags at the last table build
+    bool m_gpu_table_cache_valid; //!< True if the GPU table can be patched from the cache
+
+    //! Largest fraction of the groups that may have moved for the GPU table to be patched
+    static constexpr double gpu_table_patch_fraction = 0.25;
 #endif
     private:
     bool m_groups_dirty; //!< Check if it is necessary to rebuild the lookup-by-index table
+    bool m_csr_dirty;    //!< Check if it is necessary to rebuild the CSR lookup-by-index table
 
     Nano::Signal<void()> m_group_reorder_signal; //!< Signal that is triggered when groups are added
                                                  //!< or deleted locally
@@ -693,6 +787,9 @@ class BondedGroupData
     //! Helper function to rebuild lookup by index table
     virtual void rebuildGPUTable();
 
+    //! Helper function to rebuild the CSR lookup by index table
+    void rebuildGPUCSRTable();
+
     //! Resize internal tables
     /*! \param new_size New size of local group tables, new_size = n_local + n_ghost
      */
@@ -712,6 +809,15 @@ class BondedGroupData
 #ifdef ENABLE_HIP
     //! Helper function to rebuild lookup by index table on the GPU
     virtual void rebuildGPUTableGPU();
+
+    //! Helper function to patch the rows of the lookup by index table touched by moved groups
+    bool patchGPUTableGPU();
+
+    //! Helper function to rebuild the CSR lookup by index table on the GPU
+    void rebuildGPUCSRTableGPU();
+
+    //! Helper function to reorder the groups on the GPU
+    void sortByParticleIndexGPU();
 #endif
     };
 
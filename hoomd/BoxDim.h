@@ -397,6 +397,70 @@ struct
         return vec3<Scalar>(minImage(vec_to_scalar3(v)));
         }
 
+    //! Check if the box is orthorhombic
+    /*! \returns true when all tilt factors are zero
+     */
+    HOSTDEVICE bool isOrthorhombic() const
+        {
+        return m_xy == Scalar(0.0) && m_xz == Scalar(0.0) && m_yz == Scalar(0.0);
+        }
+
+#if !defined(__HIPCC__) && !defined(HOOMD_LLVMJIT_BUILD)
+    //! Apply the minimum image convention to a batch of vectors
+    /*! \param triclinic Set to false to skip the tilt terms, which is only correct when
+            isOrthorhombic() is true
+        \param x x components of the vectors, updated in place
+        \param y y components of the vectors, updated in place
+        \param z z components of the vectors, updated in place
+        \param n Number of vectors
+
+        The vectors are given as separate arrays so that the loop over them vectorizes. It applies
+        the same branch-free method that minImage() uses on the GPU: the image along each periodic
+        direction is the rounded fractional coordinate, and the image along the other directions
+        is zero. Unlike minImage() on the CPU, it wraps vectors by any number of images. Callers
+        select the orthorhombic specialization with isOrthorhombic() outside of their inner loops.
+    */
+    template<bool triclinic = true>
+    void minImageBatch(Scalar* x, Scalar* y, Scalar* z, unsigned int n) const
+        {
+        const Scalar3 L = getL();
+        const Scalar Linv_x = m_periodic.x ? m_Linv.x : Scalar(0.0);
+        const Scalar Linv_y = m_periodic.y ? m_Linv.y : Scalar(0.0);
+        const Scalar Linv_z = m_periodic.z ? m_Linv.z : Scalar(0.0);
+        const Scalar Lz_xz = L.z * m_xz;
+        const Scalar Lz_yz = L.z * m_yz;
+        const Scalar Ly_xy = L.y * m_xy;
+
+        for (unsigned int i = 0; i < n; ++i)
+            {
+            Scalar wx = x[i];
+            Scalar wy = y[i];
+            Scalar wz = z[i];
+
+            const Scalar img_z = slow::rint(wz * Linv_z);
+            wz -= L.z * img_z;
+            if (triclinic)
+                {
+                wy -= Lz_yz * img_z;
+                wx -= Lz_xz * img_z;
+                }
+
+            const Scalar img_y = slow::rint(wy * Linv_y);
+            wy -= L.y * img_y;
+            if (triclinic)
+                {
+                wx -= Ly_xy * img_y;
+                }
+
+            wx -= L.x * slow::rint(wx * Linv_x);
+
+            x[i] = wx;
+            y[i] = wy;
+            z[i] = wz;
+            }
+        }
+#endif
+
     //! Wrap a vector back into the box
     /*! \param w Vector to wrap, updated to the minimum image obeying the periodic settings
         \param img Image of the vector, updated to reflect the new image
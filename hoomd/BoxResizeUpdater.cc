@@ -63,6 +63,15 @@ void BoxResizeUpdater::update(uint64_t timestep)
         // move the particles to be inside the new box
         scaleAndWrapParticles(cur_box, new_box);
 
+#ifdef BUILD_MPCD
+        // the MPCD particles fill the box, so they are always scaled with it. the MPCD cell list,
+        // virtual particle fillers, and streaming geometries are notified by the box change signal.
+        if (m_sysdef->getMPCDParticleData())
+            {
+            scaleAndWrapMPCDParticles(cur_box, new_box);
+            }
+#endif // BUILD_MPCD
+
         // scale the origin
         Scalar3 old_origin = m_pdata->getOrigin();
         Scalar3 fractional_old_origin = cur_box.makeFraction(old_origin);
@@ -108,6 +117,35 @@ void BoxResizeUpdater::scaleAndWrapParticles(const BoxDim& cur_box, const BoxDim
         }
     }
 
+#ifdef BUILD_MPCD
+void BoxResizeUpdater::scaleAndWrapMPCDParticles(const BoxDim& cur_box, const BoxDim& new_box)
+    {
+    auto mpcd_pdata = m_sysdef->getMPCDParticleData();
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_pos(mpcd_pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::readwrite);
+
+        for (unsigned int i = 0; i < mpcd_pdata->getN(); i++)
+            {
+            Scalar3 fractional_pos = cur_box.makeFraction(
+                make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z));
+            Scalar3 scaled_pos = new_box.makeCoordinates(fractional_pos);
+
+            // MPCD particles do not have images, and are migrated by the MPCD communicator
+            int3 image = make_int3(0, 0, 0);
+            new_box.wrap(scaled_pos, image);
+            h_pos.data[i].x = scaled_pos.x;
+            h_pos.data[i].y = scaled_pos.y;
+            h_pos.data[i].z = scaled_pos.z;
+            }
+        }
+
+    // the particles have moved, so their cells need to be recomputed
+    mpcd_pdata->invalidateCellCache();
+    }
+#endif // BUILD_MPCD
+
 namespace detail
     {
 void export_BoxResizeUpdater(pybind11::module& m)
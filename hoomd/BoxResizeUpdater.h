@@ -70,6 +70,11 @@ class PYBIND11_EXPORT BoxResizeUpdater : public Updater
     /// Scale particles to the new box and wrap any back into the box
     virtual void scaleAndWrapParticles(const BoxDim& cur_box, const BoxDim& new_box);
 
+#ifdef BUILD_MPCD
+    /// Scale the MPCD particles to the new box and wrap them back into the box
+    virtual void scaleAndWrapMPCDParticles(const BoxDim& cur_box, const BoxDim& new_box);
+#endif // BUILD_MPCD
+
     protected:
     /// Box as a function of time.
     std::shared_ptr<VectorVariantBox> m_box;
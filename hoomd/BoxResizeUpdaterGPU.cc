@@ -28,6 +28,11 @@ BoxResizeUpdaterGPU::BoxResizeUpdaterGPU(std::shared_ptr<SystemDefinition> sysde
     m_tuner_wrap.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                         m_exec_conf,
                                         "box_resize_wrap"));
+#ifdef BUILD_MPCD
+    m_tuner_scale_mpcd.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                              m_exec_conf,
+                                              "box_resize_scale_mpcd"));
+#endif // BUILD_MPCD
     }
 
 BoxResizeUpdaterGPU::~BoxResizeUpdaterGPU()
@@ -68,6 +73,32 @@ void BoxResizeUpdaterGPU::scaleAndWrapParticles(const BoxDim& cur_box, const Box
     m_tuner_wrap->end();
     }
 
+#ifdef BUILD_MPCD
+/// Scale the MPCD particles to the new box and wrap them back into the box
+void BoxResizeUpdaterGPU::scaleAndWrapMPCDParticles(const BoxDim& cur_box, const BoxDim& new_box)
+    {
+    auto mpcd_pdata = m_sysdef->getMPCDParticleData();
+        {
+        ArrayHandle<mpcd::SolventScalar4> d_pos(mpcd_pdata->getPositions(),
+                                                access_location::device,
+                                                access_mode::readwrite);
+
+        m_tuner_scale_mpcd->begin();
+        kernel::gpu_box_resize_scale_wrap_all(mpcd_pdata->getN(),
+                                              d_pos.data,
+                                              cur_box,
+                                              new_box,
+                                              m_tuner_scale_mpcd->getParam()[0]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_scale_mpcd->end();
+        }
+
+    // the particles have moved, so their cells need to be recomputed
+    mpcd_pdata->invalidateCellCache();
+    }
+#endif // BUILD_MPCD
+
 namespace detail
     {
 void export_BoxResizeUpdaterGPU(pybind11::module& m)
@@ -42,6 +42,29 @@ gpu_box_resize_wrap_kernel(unsigned int N, Scalar4* d_pos, int3* d_image, const
         }
     }
 
+#ifdef BUILD_MPCD
+/// Scale all particles to the new box and wrap them, for particles without images
+__global__ void gpu_box_resize_scale_wrap_all_kernel(unsigned int N,
+                                                     mpcd::SolventScalar4* d_pos,
+                                                     const BoxDim cur_box,
+                                                     const BoxDim new_box)
+    {
+    int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (idx < N)
+        {
+        const mpcd::SolventScalar4 pos = d_pos[idx];
+
+        Scalar3 fractional_pos = cur_box.makeFraction(make_scalar3(pos.x, pos.y, pos.z));
+        Scalar3 scaled_pos = new_box.makeCoordinates(fractional_pos);
+
+        int3 image = make_int3(0, 0, 0);
+        new_box.wrap(scaled_pos, image);
+        d_pos[idx] = mpcd::make_solvent_scalar4(scaled_pos.x, scaled_pos.y, scaled_pos.z, pos.w);
+        }
+    }
+#endif // BUILD_MPCD
+
 hipError_t gpu_box_resize_scale(Scalar4* d_pos,
                                 const BoxDim& cur_box,
                                 const BoxDim& new_box,
@@ -100,5 +123,38 @@ hipError_t gpu_box_resize_wrap(const unsigned int N,
     return hipSuccess;
     }
 
+#ifdef BUILD_MPCD
+hipError_t gpu_box_resize_scale_wrap_all(const unsigned int N,
+                                         mpcd::SolventScalar4* d_pos,
+                                         const BoxDim& cur_box,
+                                         const BoxDim& new_box,
+                                         unsigned int block_size)
+    {
+    if (N == 0)
+        return hipSuccess;
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_box_resize_scale_wrap_all_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid((N / run_block_size) + 1, 1, 1);
+    dim3 threads(run_block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_box_resize_scale_wrap_all_kernel),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       N,
+                       d_pos,
+                       cur_box,
+                       new_box);
+
+    return hipSuccess;
+    }
+#endif // BUILD_MPCD
+
     } // end namespace kernel
     } // end namespace hoomd
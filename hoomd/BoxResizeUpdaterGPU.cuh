@@ -4,6 +4,10 @@
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/ParticleData.cuh"
 
+#ifdef BUILD_MPCD
+#include "hoomd/mpcd/ParticleDataUtilities.h"
+#endif
+
 #ifndef __BOX_RESIZE_UPDATER_GPU_CUH__
 #define __BOX_RESIZE_UPDATER_GPU_CUH__
 
@@ -25,6 +29,14 @@ hipError_t gpu_box_resize_wrap(const unsigned int N,
                                const BoxDim& new_box,
                                unsigned int block_size);
 
+#ifdef BUILD_MPCD
+hipError_t gpu_box_resize_scale_wrap_all(const unsigned int N,
+                                         mpcd::SolventScalar4* d_pos,
+                                         const BoxDim& cur_box,
+                                         const BoxDim& new_box,
+                                         unsigned int block_size);
+#endif // BUILD_MPCD
+
     } // end namespace kernel
     } // end namespace hoomd
 
@@ -38,11 +38,20 @@ class PYBIND11_EXPORT BoxResizeUpdaterGPU : public BoxResizeUpdater
     /// Scale particles to the new box and wrap any others back into the box
     virtual void scaleAndWrapParticles(const BoxDim& cur_box, const BoxDim& new_box);
 
+#ifdef BUILD_MPCD
+    /// Scale the MPCD particles to the new box and wrap them back into the box
+    virtual void scaleAndWrapMPCDParticles(const BoxDim& cur_box, const BoxDim& new_box);
+#endif // BUILD_MPCD
+
     private:
     /// Autotuner for block size (scale kernel).
     std::shared_ptr<Autotuner<1>> m_tuner_scale;
     /// Autotuner for block size (wrap kernel).
     std::shared_ptr<Autotuner<1>> m_tuner_wrap;
+#ifdef BUILD_MPCD
+    /// Autotuner for block size (MPCD scale kernel).
+    std::shared_ptr<Autotuner<1>> m_tuner_scale_mpcd;
+#endif // BUILD_MPCD
     };
 
 namespace detail
@@ -11,10 +11,13 @@
 #define __CACHED_ALLOCATOR_H__
 
 #ifdef ENABLE_HIP
+#include "MemoryPool.h"
+
 #include <hip/hip_runtime.h>
 
 #include <cassert>
 #include <map>
+#include <set>
 #include <stdexcept>
 
 //! Need to define an error checking macro that can be used in .cu files
@@ -37,6 +40,9 @@
 namespace hoomd
     {
 //! CachedAllocator: a simple allocator for caching allocation requests
+/*! When a MemoryPool is set and enabled, device allocations come from the pool instead and are
+    returned to it immediately on release, so the pool does the caching.
+*/
 class __attribute__((visibility("default"))) CachedAllocator
     {
     public:
@@ -67,6 +73,12 @@ class __attribute__((visibility("default"))) CachedAllocator
         m_max_cached_bytes = max_cached_bytes;
         }
 
+    //! Set the memory pool to allocate from (ignored for managed memory)
+    void setMemoryPool(const MemoryPool* pool)
+        {
+        m_pool = pool;
+        }
+
     //! Destructor
     virtual ~CachedAllocator()
         {
@@ -92,6 +104,15 @@ class __attribute__((visibility("default"))) CachedAllocator
         if (ptr == NULL)
             return;
 
+        // return pooled blocks to the pool
+        std::set<char*>::iterator pooled = m_pooled_blocks.find(ptr);
+        if (pooled != m_pooled_blocks.end())
+            {
+            m_pooled_blocks.erase(pooled);
+            MemoryPool::deallocate((void*)ptr, true);
+            return;
+            }
+
         // erase the allocated block from the allocated blocks map
         allocated_blocks_type::iterator iter = m_allocated_blocks.find(ptr);
         assert(iter != m_allocated_blocks.end());
@@ -106,7 +127,9 @@ class __attribute__((visibility("default"))) CachedAllocator
     typedef std::multimap<std::ptrdiff_t, char*> free_blocks_type;
     typedef std::map<char*, std::ptrdiff_t> allocated_blocks_type;
 
-    bool m_managed; //! True if we use unified memory
+    bool m_managed;                     //! True if we use unified memory
+    const MemoryPool* m_pool = nullptr; //! Pool for device allocations
+    std::set<char*> m_pooled_blocks;    //! Blocks allocated from the pool
 
     size_t m_num_bytes_tot;
     size_t m_max_cached_bytes;
@@ -133,6 +156,11 @@ class __attribute__((visibility("default"))) CachedAllocator
             {
             hipFree((void*)i->first);
             }
+
+        for (char* ptr : m_pooled_blocks)
+            {
+            MemoryPool::deallocate((void*)ptr, true);
+            }
         }
     };
 
@@ -172,6 +200,27 @@ template<typename T> T* CachedAllocator::getTemporaryBuffer(size_t num_elements)
     if (!num_bytes)
         return (T*)NULL;
 
+    // allocate from the pool without synchronizing the device
+    if (!m_managed && m_pool && m_pool->isEnabled())
+        {
+        bool pooled = false;
+        hipError_t err = m_pool->allocate((void**)&result, num_bytes, pooled);
+        if (err != hipSuccess)
+            {
+            throw std::runtime_error("CUDA Error in CachedAllocator "
+                                     + std::string(hipGetErrorString(err)));
+            }
+        if (pooled)
+            {
+            m_pooled_blocks.insert(result);
+            }
+        else
+            {
+            m_allocated_blocks.insert(std::make_pair(result, num_bytes));
+            }
+        return (T*)result;
+        }
+
     size_t num_allocated_bytes = num_bytes;
 
     // search the cache for a free block
@@ -443,6 +443,9 @@ void CellList::computeCellList()
 
     for (unsigned int n = 0; n < n_tot_particles; n++)
         {
+        if (!m_type_mask.empty() && !m_type_mask[__scalar_as_int(h_pos.data[n].w)])
+            continue;
+
         Scalar3 p = make_scalar3(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z);
         if (std::isnan(p.x) || std::isnan(p.y) || std::isnan(p.z))
             {
@@ -9,6 +9,7 @@
 
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 #include <memory>
+#include <vector>
 
 /*! \file CellList.h
     \brief Declares the CellList class
@@ -208,6 +209,17 @@ class PYBIND11_EXPORT CellList : public Compute
         return m_sort_cell_list;
         }
 
+    //! Set the types to put in the cell list
+    /*! \param type_mask Flag per type that is true if the type is binned, or empty to bin all types
+
+        Particles of the other types are skipped. Only the CPU cell list supports a type mask.
+    */
+    void setTypeMask(const std::vector<bool>& type_mask)
+        {
+        m_type_mask = type_mask;
+        m_params_changed = true;
+        }
+
     //! Set the flag to compute the cell adjacency list
     void setComputeAdjList(bool compute_adj_list)
         {
@@ -391,6 +403,8 @@ class PYBIND11_EXPORT CellList : public Compute
     bool m_sort_cell_list;   //!< If true, sort cell list
     bool m_compute_adj_list; //!< If true, compute the cell adjacency lists
 
+    std::vector<bool> m_type_mask; //!< Flag per type that is true if it is binned (empty for all)
+
 #ifdef ENABLE_MPI
     /// The system's communicator.
     std::shared_ptr<Communicator> m_comm;
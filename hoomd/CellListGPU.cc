@@ -38,6 +38,11 @@ CellListGPU::CellListGPU(std::shared_ptr<SystemDefinition> sysdef)
 
 void CellListGPU::computeCellList()
     {
+    if (!m_type_mask.empty())
+        {
+        throw std::runtime_error("The GPU cell list does not support a type mask.");
+        }
+
     // acquire the particle data
     ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
     ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
@@ -0,0 +1,311 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file CheckpointReader.cc
+    \brief Defines the CheckpointReader class
+*/
+
+#include "CheckpointReader.h"
+#include "GSD.h"
+
+#ifdef ENABLE_MPI
+#include "HOOMDMPI.h"
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+using namespace std;
+using namespace hoomd::detail;
+
+namespace hoomd
+    {
+/*! \param exec_conf The execution configuration
+    \param fname File name of the checkpoint
+*/
+CheckpointReader::CheckpointReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
+                                   const std::string& fname)
+    : m_exec_conf(exec_conf), m_fname(fname), m_timestep(0), m_seed(0)
+    {
+    m_snapshot = std::make_shared<SnapshotSystemData<double>>();
+
+    if (!m_exec_conf->isRoot())
+        return;
+
+    m_exec_conf->msg->notice(3) << "Checkpoint: reading " << fname << endl;
+    int retval = gsd_open(&m_handle, fname.c_str(), GSD_OPEN_READONLY);
+    GSDUtils::checkError(retval, m_fname);
+
+    if (string(m_handle.header.schema) != string("hoomd-checkpoint")
+        || m_handle.header.schema_version >= gsd_make_version(2, 0)
+        || gsd_get_nframes(&m_handle) != 1)
+        {
+        gsd_close(&m_handle);
+        m_exec_conf->msg->error() << fname << " is not a valid checkpoint" << endl;
+        throw runtime_error("Error reading checkpoint");
+        }
+
+    try
+        {
+        readCheckpoint();
+        }
+    catch (...)
+        {
+        gsd_close(&m_handle);
+        throw;
+        }
+    gsd_close(&m_handle);
+    }
+
+uint64_t CheckpointReader::getTimeStep() const
+    {
+    uint64_t timestep = m_timestep;
+#ifdef ENABLE_MPI
+    bcast(timestep, 0, m_exec_conf->getMPICommunicator());
+#endif
+    return timestep;
+    }
+
+uint16_t CheckpointReader::getSeed() const
+    {
+    uint16_t seed = m_seed;
+#ifdef ENABLE_MPI
+    bcast(seed, 0, m_exec_conf->getMPICommunicator());
+#endif
+    return seed;
+    }
+
+/*! When the checkpoint was written with the same number of ranks, each rank gets the state it
+    wrote. Otherwise, every rank gets the state of the root rank.
+*/
+std::string CheckpointReader::getOperationState() const
+    {
+    std::string state = m_state.empty() ? std::string() : m_state[0];
+#ifdef ENABLE_MPI
+    if (m_exec_conf->getNRanks() > 1)
+        {
+        const MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+        unsigned int n_state = (unsigned int)m_state.size();
+        bcast(n_state, 0, mpi_comm);
+        if (n_state == m_exec_conf->getNRanks())
+            {
+            scatter_v(m_state, state, 0, mpi_comm);
+            }
+        else
+            {
+            bcast(state, 0, mpi_comm);
+            }
+        }
+#endif
+    return state;
+    }
+
+/*! \param data Buffer to read into
+    \param name Name of the chunk
+    \param type Expected type of the chunk
+    \param N Expected number of rows
+    \param M Expected number of columns
+    \param required Throw an error when the chunk is missing
+    \returns true when the chunk was read
+*/
+bool CheckpointReader::readChunk(void* data,
+                                 const char* name,
+                                 gsd_type type,
+                                 uint64_t N,
+                                 uint32_t M,
+                                 bool required)
+    {
+    const gsd_index_entry* entry = gsd_find_chunk(&m_handle, 0, name);
+    if (entry == NULL)
+        {
+        if (required)
+            {
+            m_exec_conf->msg->error() << "Checkpoint: " << name << " not found in " << m_fname
+                                      << endl;
+            throw runtime_error("Error reading checkpoint");
+            }
+        return false;
+        }
+
+    if (entry->type != type || entry->N != N || entry->M != M)
+        {
+        m_exec_conf->msg->error() << "Checkpoint: " << name << " has the wrong size in "
+                                  << m_fname << endl;
+        throw runtime_error("Error reading checkpoint");
+        }
+
+    m_exec_conf->msg->notice(10) << "Checkpoint: reading " << name << endl;
+    int retval = gsd_read_chunk(&m_handle, data, entry);
+    GSDUtils::checkError(retval, m_fname);
+    return true;
+    }
+
+/*! \param name Name of the chunk
+    \returns The strings stored in the chunk, empty when it is missing
+*/
+std::vector<std::string> CheckpointReader::readStrings(const char* name)
+    {
+    std::vector<std::string> strings;
+    const gsd_index_entry* entry = gsd_find_chunk(&m_handle, 0, name);
+    if (entry == NULL)
+        return strings;
+
+    if (entry->type != GSD_TYPE_UINT8)
+        {
+        m_exec_conf->msg->error() << "Checkpoint: " << name << " has the wrong type in "
+                                  << m_fname << endl;
+        throw runtime_error("Error reading checkpoint");
+        }
+
+    std::vector<char> data(entry->N * entry->M);
+    int retval = gsd_read_chunk(&m_handle, data.data(), entry);
+    GSDUtils::checkError(retval, m_fname);
+
+    for (unsigned int i = 0; i < entry->N; i++)
+        {
+        const char* begin = data.data() + i * entry->M;
+        strings.push_back(std::string(begin, strnlen(begin, entry->M)));
+        }
+    return strings;
+    }
+
+/*! \param prefix Prefix of the chunk names
+    \param snapshot Snapshot of the bonded groups to fill
+*/
+template<class Snapshot, unsigned int group_size>
+void CheckpointReader::readGroups(const std::string& prefix, Snapshot& snapshot)
+    {
+    uint32_t N = 0;
+    readChunk(&N, (prefix + "/N").c_str(), GSD_TYPE_UINT32, 1, 1);
+    snapshot.type_mapping = readStrings((prefix + "/types").c_str());
+    snapshot.resize(N);
+    if (N == 0)
+        return;
+
+    readChunk(snapshot.type_id.data(), (prefix + "/typeid").c_str(), GSD_TYPE_UINT32, N, 1, true);
+    readChunk(snapshot.groups.data(),
+              (prefix + "/group").c_str(),
+              GSD_TYPE_UINT32,
+              N,
+              group_size,
+              true);
+    }
+
+void CheckpointReader::readCheckpoint()
+    {
+    readChunk(&m_timestep, "configuration/step", GSD_TYPE_UINT64, 1, 1, true);
+    readChunk(&m_seed, "configuration/seed", GSD_TYPE_UINT16, 1, 1, true);
+
+    uint8_t dimensions = 3;
+    readChunk(&dimensions, "configuration/dimensions", GSD_TYPE_UINT8, 1, 1, true);
+    m_snapshot->dimensions = dimensions;
+
+    double box[6];
+    readChunk(box, "configuration/box", GSD_TYPE_DOUBLE, 6, 1, true);
+    m_snapshot->global_box = std::make_shared<BoxDim>(box[0], box[1], box[2]);
+    m_snapshot->global_box->setTiltFactors(box[3], box[4], box[5]);
+
+    SnapshotParticleData<double>& pdata = m_snapshot->particle_data;
+    uint32_t N = 0;
+    uint8_t is_accel_set = 0;
+    readChunk(&N, "particles/N", GSD_TYPE_UINT32, 1, 1);
+    readChunk(&is_accel_set, "particles/is_accel_set", GSD_TYPE_UINT8, 1, 1);
+    pdata.type_mapping = readStrings("particles/types");
+    pdata.resize(N);
+    pdata.is_accel_set = is_accel_set;
+    if (N > 0)
+        {
+        readChunk(pdata.pos.data(), "particles/position", GSD_TYPE_DOUBLE, N, 3, true);
+        readChunk(pdata.vel.data(), "particles/velocity", GSD_TYPE_DOUBLE, N, 3, true);
+        readChunk(pdata.accel.data(), "particles/acceleration", GSD_TYPE_DOUBLE, N, 3, true);
+        readChunk(pdata.type.data(), "particles/typeid", GSD_TYPE_UINT32, N, 1, true);
+        readChunk(pdata.mass.data(), "particles/mass", GSD_TYPE_DOUBLE, N, 1, true);
+        readChunk(pdata.charge.data(), "particles/charge", GSD_TYPE_DOUBLE, N, 1, true);
+        readChunk(pdata.diameter.data(), "particles/diameter", GSD_TYPE_DOUBLE, N, 1, true);
+        readChunk(pdata.image.data(), "particles/image", GSD_TYPE_INT32, N, 3, true);
+        readChunk(pdata.body.data(), "particles/body", GSD_TYPE_UINT32, N, 1, true);
+        readChunk(pdata.orientation.data(),
+                  "particles/orientation",
+                  GSD_TYPE_DOUBLE,
+                  N,
+                  4,
+                  true);
+        readChunk(pdata.angmom.data(), "particles/angmom", GSD_TYPE_DOUBLE, N, 4, true);
+        readChunk(pdata.inertia.data(),
+                  "particles/moment_inertia",
+                  GSD_TYPE_DOUBLE,
+                  N,
+                  3,
+                  true);
+        }
+
+    readGroups<BondData::Snapshot, 2>("bonds", m_snapshot->bond_data);
+    readGroups<AngleData::Snapshot, 3>("angles", m_snapshot->angle_data);
+    readGroups<DihedralData::Snapshot, 4>("dihedrals", m_snapshot->dihedral_data);
+    readGroups<ImproperData::Snapshot, 4>("impropers", m_snapshot->improper_data);
+    readGroups<PairData::Snapshot, 2>("pairs", m_snapshot->pair_data);
+
+    ConstraintData::Snapshot& constraints = m_snapshot->constraint_data;
+    uint32_t N_constraints = 0;
+    readChunk(&N_constraints, "constraints/N", GSD_TYPE_UINT32, 1, 1);
+    constraints.resize(N_constraints);
+    if (N_constraints > 0)
+        {
+        std::vector<double> value(N_constraints);
+        readChunk(value.data(), "constraints/value", GSD_TYPE_DOUBLE, N_constraints, 1, true);
+        std::copy(value.begin(), value.end(), constraints.val.begin());
+        readChunk(constraints.groups.data(),
+                  "constraints/group",
+                  GSD_TYPE_UINT32,
+                  N_constraints,
+                  2,
+                  true);
+        }
+
+#ifdef BUILD_MPCD
+    mpcd::ParticleDataSnapshot& mpcd_data = m_snapshot->mpcd_data;
+    uint32_t N_mpcd = 0;
+    double mpcd_mass = 1.0;
+    readChunk(&N_mpcd, "mpcd/N", GSD_TYPE_UINT32, 1, 1);
+    readChunk(&mpcd_mass, "mpcd/mass", GSD_TYPE_DOUBLE, 1, 1);
+    mpcd_data.mass = mpcd_mass;
+    mpcd_data.type_mapping = readStrings("mpcd/types");
+    mpcd_data.resize(N_mpcd);
+    if (N_mpcd > 0)
+        {
+        std::vector<double> position(3 * N_mpcd);
+        std::vector<double> velocity(3 * N_mpcd);
+        readChunk(position.data(), "mpcd/position", GSD_TYPE_DOUBLE, N_mpcd, 3, true);
+        readChunk(velocity.data(), "mpcd/velocity", GSD_TYPE_DOUBLE, N_mpcd, 3, true);
+        readChunk(mpcd_data.type.data(), "mpcd/typeid", GSD_TYPE_UINT32, N_mpcd, 1, true);
+        for (unsigned int i = 0; i < N_mpcd; i++)
+            {
+            mpcd_data.position[i]
+                = vec3<Scalar>(position[3 * i], position[3 * i + 1], position[3 * i + 2]);
+            mpcd_data.velocity[i]
+                = vec3<Scalar>(velocity[3 * i], velocity[3 * i + 1], velocity[3 * i + 2]);
+            }
+        }
+#endif
+
+    m_state = readStrings("state/operations");
+    }
+
+namespace detail
+    {
+void export_CheckpointReader(pybind11::module& m)
+    {
+    pybind11::class_<CheckpointReader, std::shared_ptr<CheckpointReader>>(m, "CheckpointReader")
+        .def(pybind11::init<std::shared_ptr<const ExecutionConfiguration>, const std::string&>())
+        .def("getTimeStep", &CheckpointReader::getTimeStep)
+        .def("getSeed", &CheckpointReader::getSeed)
+        .def("getSnapshot", &CheckpointReader::getSnapshot)
+        .def("getOperationState", &CheckpointReader::getOperationState)
+        .def("clearSnapshot", &CheckpointReader::clearSnapshot);
+    }
+
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -0,0 +1,95 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file CheckpointReader.h
+    \brief Declares the CheckpointReader class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "ExecutionConfiguration.h"
+#include "SnapshotSystemData.h"
+#include "hoomd/extern/gsd.h"
+
+#include <pybind11/pybind11.h>
+#include <string>
+#include <vector>
+
+#ifndef __CHECKPOINT_READER_H__
+#define __CHECKPOINT_READER_H__
+
+namespace hoomd
+    {
+//! Reads checkpoints written by CheckpointWriter
+/*! The root rank reads the checkpoint into a double precision snapshot. The time step, seed, and
+    operation state are available on all ranks.
+
+    \ingroup data_structs
+*/
+class PYBIND11_EXPORT CheckpointReader
+    {
+    public:
+    //! Read the checkpoint
+    CheckpointReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
+                     const std::string& fname);
+
+    //! Get the time step of the checkpoint
+    uint64_t getTimeStep() const;
+
+    //! Get the seed of the checkpoint
+    uint16_t getSeed() const;
+
+    //! Get the snapshot of the system
+    std::shared_ptr<SnapshotSystemData<double>> getSnapshot() const
+        {
+        return m_snapshot;
+        }
+
+    //! Get the operation state for this rank
+    std::string getOperationState() const;
+
+    //! Clear the snapshot
+    void clearSnapshot()
+        {
+        m_snapshot.reset();
+        }
+
+    protected:
+    std::shared_ptr<const ExecutionConfiguration> m_exec_conf; //!< The execution configuration
+    std::string m_fname;                                       //!< File name
+    uint64_t m_timestep;                                       //!< Time step of the checkpoint
+    uint16_t m_seed;                                           //!< Seed of the checkpoint
+    std::vector<std::string> m_state;                          //!< Operation state on each rank
+    std::shared_ptr<SnapshotSystemData<double>> m_snapshot;    //!< The snapshot
+    gsd_handle m_handle;                                       //!< Handle to the file
+
+    //! Read a chunk from the file
+    bool readChunk(void* data,
+                   const char* name,
+                   gsd_type type,
+                   uint64_t N,
+                   uint32_t M,
+                   bool required = false);
+
+    //! Read a list of strings from the file
+    std::vector<std::string> readStrings(const char* name);
+
+    //! Read the bonded groups into a snapshot
+    template<class Snapshot, unsigned int group_size>
+    void readGroups(const std::string& prefix, Snapshot& snapshot);
+
+    //! Read the checkpoint into the snapshot
+    void readCheckpoint();
+    };
+
+namespace detail
+    {
+//! Exports the CheckpointReader class to python
+void export_CheckpointReader(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace hoomd
+
+#endif
@@ -0,0 +1,312 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file CheckpointWriter.cc
+    \brief Defines the CheckpointWriter class
+*/
+
+#include "CheckpointWriter.h"
+#include "GSD.h"
+#include "HOOMDVersion.h"
+
+#ifdef ENABLE_MPI
+#include "HOOMDMPI.h"
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+using namespace std;
+using namespace hoomd::detail;
+
+namespace hoomd
+    {
+/*! \param sysdef SystemDefinition containing the system to checkpoint
+    \param trigger Trigger for writing checkpoints
+    \param fname File name to write
+*/
+CheckpointWriter::CheckpointWriter(std::shared_ptr<SystemDefinition> sysdef,
+                                   std::shared_ptr<Trigger> trigger,
+                                   const std::string& fname)
+    : Analyzer(sysdef, trigger), m_fname(fname), m_state_writer(pybind11::none())
+    {
+    m_exec_conf->msg->notice(5) << "Constructing CheckpointWriter: " << fname << endl;
+    }
+
+CheckpointWriter::~CheckpointWriter()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying CheckpointWriter" << endl;
+    }
+
+/*! \param timestep Current time step of the simulation
+
+    Collects the system state on the root rank and replaces the checkpoint file.
+*/
+void CheckpointWriter::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+
+    auto snapshot = m_sysdef->takeSnapshot<double>();
+
+    std::string state;
+    if (!m_state_writer.is_none())
+        {
+        pybind11::gil_scoped_acquire gil;
+        state = m_state_writer.attr("_checkpoint_state")().cast<std::string>();
+        }
+
+    std::vector<std::string> states;
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        gather_v(state, states, 0, m_exec_conf->getMPICommunicator());
+        }
+    else
+#endif
+        {
+        states.push_back(state);
+        }
+
+    if (!m_exec_conf->isRoot())
+        return;
+
+    std::ostringstream application;
+    application << "HOOMD-blue " << HOOMD_VERSION;
+
+    const std::string tmp_fname = m_fname + ".tmp";
+    m_exec_conf->msg->notice(3) << "Checkpoint: writing " << m_fname << " at step " << timestep
+                                << endl;
+
+    gsd_handle handle;
+    int retval = gsd_create_and_open(&handle,
+                                     tmp_fname.c_str(),
+                                     application.str().c_str(),
+                                     "hoomd-checkpoint",
+                                     gsd_make_version(1, 0),
+                                     GSD_OPEN_APPEND,
+                                     0);
+    GSDUtils::checkError(retval, tmp_fname);
+
+    try
+        {
+        writeCheckpoint(handle, timestep, *snapshot, states);
+        }
+    catch (...)
+        {
+        gsd_close(&handle);
+        throw;
+        }
+
+    retval = gsd_close(&handle);
+    GSDUtils::checkError(retval, tmp_fname);
+
+    // replace the previous checkpoint only after the new one is complete
+    if (std::rename(tmp_fname.c_str(), m_fname.c_str()) != 0)
+        {
+        m_exec_conf->msg->error() << "Checkpoint: unable to rename " << tmp_fname << " to "
+                                  << m_fname << ": " << strerror(errno) << endl;
+        throw runtime_error("Error writing checkpoint");
+        }
+    }
+
+/*! \param handle Handle to the open file
+    \param name Name of the chunk
+    \param type Type of the data
+    \param N Number of rows
+    \param M Number of columns
+    \param data Data to write
+
+    Empty chunks are not written.
+*/
+void CheckpointWriter::writeChunk(gsd_handle& handle,
+                                  const char* name,
+                                  gsd_type type,
+                                  uint64_t N,
+                                  uint32_t M,
+                                  const void* data)
+    {
+    if (N == 0)
+        return;
+
+    m_exec_conf->msg->notice(10) << "Checkpoint: writing " << name << endl;
+    int retval = gsd_write_chunk(&handle, name, type, N, M, 0, data);
+    GSDUtils::checkError(retval, m_fname);
+    }
+
+/*! \param handle Handle to the open file
+    \param name Name of the chunk
+    \param strings Strings to write
+
+    Each string is stored in one row of a uint8 chunk, padded with nulls to the longest length.
+*/
+void CheckpointWriter::writeStrings(gsd_handle& handle,
+                                    const char* name,
+                                    const std::vector<std::string>& strings)
+    {
+    size_t max_len = 0;
+    for (const auto& s : strings)
+        {
+        max_len = std::max(max_len, s.size());
+        }
+    max_len += 1; // for null
+
+    std::vector<char> data(max_len * strings.size(), 0);
+    for (unsigned int i = 0; i < strings.size(); i++)
+        {
+        std::copy(strings[i].begin(), strings[i].end(), data.begin() + max_len * i);
+        }
+    writeChunk(handle, name, GSD_TYPE_UINT8, strings.size(), (uint32_t)max_len, data.data());
+    }
+
+/*! \param handle Handle to the open file
+    \param prefix Prefix of the chunk names
+    \param snapshot Snapshot of the bonded groups
+*/
+template<class Snapshot, unsigned int group_size>
+void CheckpointWriter::writeGroups(gsd_handle& handle,
+                                   const std::string& prefix,
+                                   const Snapshot& snapshot)
+    {
+    uint32_t N = snapshot.size;
+    writeChunk(handle, (prefix + "/N").c_str(), GSD_TYPE_UINT32, 1, 1, &N);
+    writeStrings(handle, (prefix + "/types").c_str(), snapshot.type_mapping);
+    writeChunk(handle,
+               (prefix + "/typeid").c_str(),
+               GSD_TYPE_UINT32,
+               N,
+               1,
+               snapshot.type_id.data());
+    writeChunk(handle,
+               (prefix + "/group").c_str(),
+               GSD_TYPE_UINT32,
+               N,
+               group_size,
+               snapshot.groups.data());
+    }
+
+/*! \param handle Handle to the open file
+    \param timestep Current time step of the simulation
+    \param snapshot Snapshot of the system
+    \param state Operation state on every rank
+*/
+void CheckpointWriter::writeCheckpoint(gsd_handle& handle,
+                                       uint64_t timestep,
+                                       const SnapshotSystemData<double>& snapshot,
+                                       const std::vector<std::string>& state)
+    {
+    writeChunk(handle, "configuration/step", GSD_TYPE_UINT64, 1, 1, &timestep);
+
+    uint8_t dimensions = (uint8_t)snapshot.dimensions;
+    writeChunk(handle, "configuration/dimensions", GSD_TYPE_UINT8, 1, 1, &dimensions);
+
+    const BoxDim& box = *snapshot.global_box;
+    double box_a[6] = {box.getL().x,
+                       box.getL().y,
+                       box.getL().z,
+                       box.getTiltFactorXY(),
+                       box.getTiltFactorXZ(),
+                       box.getTiltFactorYZ()};
+    writeChunk(handle, "configuration/box", GSD_TYPE_DOUBLE, 6, 1, box_a);
+
+    uint16_t seed = m_sysdef->getSeed();
+    writeChunk(handle, "configuration/seed", GSD_TYPE_UINT16, 1, 1, &seed);
+
+    const SnapshotParticleData<double>& pdata = snapshot.particle_data;
+    uint32_t N = pdata.size;
+    uint8_t is_accel_set = pdata.is_accel_set;
+    writeChunk(handle, "particles/N", GSD_TYPE_UINT32, 1, 1, &N);
+    writeStrings(handle, "particles/types", pdata.type_mapping);
+    writeChunk(handle, "particles/position", GSD_TYPE_DOUBLE, N, 3, pdata.pos.data());
+    writeChunk(handle, "particles/velocity", GSD_TYPE_DOUBLE, N, 3, pdata.vel.data());
+    writeChunk(handle, "particles/acceleration", GSD_TYPE_DOUBLE, N, 3, pdata.accel.data());
+    writeChunk(handle, "particles/is_accel_set", GSD_TYPE_UINT8, 1, 1, &is_accel_set);
+    writeChunk(handle, "particles/typeid", GSD_TYPE_UINT32, N, 1, pdata.type.data());
+    writeChunk(handle, "particles/mass", GSD_TYPE_DOUBLE, N, 1, pdata.mass.data());
+    writeChunk(handle, "particles/charge", GSD_TYPE_DOUBLE, N, 1, pdata.charge.data());
+    writeChunk(handle, "particles/diameter", GSD_TYPE_DOUBLE, N, 1, pdata.diameter.data());
+    writeChunk(handle, "particles/image", GSD_TYPE_INT32, N, 3, pdata.image.data());
+    writeChunk(handle, "particles/body", GSD_TYPE_UINT32, N, 1, pdata.body.data());
+    writeChunk(handle,
+               "particles/orientation",
+               GSD_TYPE_DOUBLE,
+               N,
+               4,
+               pdata.orientation.data());
+    writeChunk(handle, "particles/angmom", GSD_TYPE_DOUBLE, N, 4, pdata.angmom.data());
+    writeChunk(handle, "particles/moment_inertia", GSD_TYPE_DOUBLE, N, 3, pdata.inertia.data());
+
+    writeGroups<BondData::Snapshot, 2>(handle, "bonds", snapshot.bond_data);
+    writeGroups<AngleData::Snapshot, 3>(handle, "angles", snapshot.angle_data);
+    writeGroups<DihedralData::Snapshot, 4>(handle, "dihedrals", snapshot.dihedral_data);
+    writeGroups<ImproperData::Snapshot, 4>(handle, "impropers", snapshot.improper_data);
+    writeGroups<PairData::Snapshot, 2>(handle, "pairs", snapshot.pair_data);
+
+    const ConstraintData::Snapshot& constraints = snapshot.constraint_data;
+    uint32_t N_constraints = constraints.size;
+    std::vector<double> constraint_value(constraints.val.begin(), constraints.val.end());
+    writeChunk(handle, "constraints/N", GSD_TYPE_UINT32, 1, 1, &N_constraints);
+    writeChunk(handle,
+               "constraints/value",
+               GSD_TYPE_DOUBLE,
+               N_constraints,
+               1,
+               constraint_value.data());
+    writeChunk(handle,
+               "constraints/group",
+               GSD_TYPE_UINT32,
+               N_constraints,
+               2,
+               constraints.groups.data());
+
+#ifdef BUILD_MPCD
+    const mpcd::ParticleDataSnapshot& mpcd_data = snapshot.mpcd_data;
+    uint32_t N_mpcd = mpcd_data.size;
+    double mpcd_mass = mpcd_data.mass;
+    std::vector<double> mpcd_position(3 * N_mpcd);
+    std::vector<double> mpcd_velocity(3 * N_mpcd);
+    for (unsigned int i = 0; i < N_mpcd; i++)
+        {
+        mpcd_position[3 * i] = mpcd_data.position[i].x;
+        mpcd_position[3 * i + 1] = mpcd_data.position[i].y;
+        mpcd_position[3 * i + 2] = mpcd_data.position[i].z;
+        mpcd_velocity[3 * i] = mpcd_data.velocity[i].x;
+        mpcd_velocity[3 * i + 1] = mpcd_data.velocity[i].y;
+        mpcd_velocity[3 * i + 2] = mpcd_data.velocity[i].z;
+        }
+    writeChunk(handle, "mpcd/N", GSD_TYPE_UINT32, 1, 1, &N_mpcd);
+    writeStrings(handle, "mpcd/types", mpcd_data.type_mapping);
+    writeChunk(handle, "mpcd/mass", GSD_TYPE_DOUBLE, 1, 1, &mpcd_mass);
+    writeChunk(handle, "mpcd/position", GSD_TYPE_DOUBLE, N_mpcd, 3, mpcd_position.data());
+    writeChunk(handle, "mpcd/velocity", GSD_TYPE_DOUBLE, N_mpcd, 3, mpcd_velocity.data());
+    writeChunk(handle, "mpcd/typeid", GSD_TYPE_UINT32, N_mpcd, 1, mpcd_data.type.data());
+#endif
+
+    writeStrings(handle, "state/operations", state);
+
+    int retval = gsd_end_frame(&handle);
+    GSDUtils::checkError(retval, m_fname);
+    }
+
+namespace detail
+    {
+void export_CheckpointWriter(pybind11::module& m)
+    {
+    pybind11::class_<CheckpointWriter, Analyzer, std::shared_ptr<CheckpointWriter>>(
+        m,
+        "CheckpointWriter")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            const std::string&>())
+        .def_property_readonly("filename", &CheckpointWriter::getFilename)
+        .def_property("state_writer",
+                      &CheckpointWriter::getStateWriter,
+                      &CheckpointWriter::setStateWriter);
+    }
+
+    } // end namespace detail
+
+    } // end namespace hoomd
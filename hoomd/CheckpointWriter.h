@@ -0,0 +1,114 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file CheckpointWriter.h
+    \brief Declares the CheckpointWriter class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "Analyzer.h"
+#include "SnapshotSystemData.h"
+#include "hoomd/extern/gsd.h"
+
+#include <pybind11/pybind11.h>
+#include <string>
+#include <vector>
+
+#ifndef __CHECKPOINT_WRITER_H__
+#define __CHECKPOINT_WRITER_H__
+
+namespace hoomd
+    {
+//! Writes checkpoints that restart simulations
+/*! A checkpoint is a GSD file with the "hoomd-checkpoint" schema and a single frame. It stores the
+    complete system state in double precision: the box, the particles (including their
+    accelerations), the bonded groups, the constraints, the special pairs, the MPCD particles, and
+    the seed. It also stores the state of the operations, which the Python state writer provides
+    as one string per rank.
+
+    Each checkpoint replaces the previous one. The file is written to a temporary file first and
+    then renamed, so a crash while writing leaves the previous checkpoint intact.
+
+    Read checkpoints with CheckpointReader.
+
+    \ingroup analyzers
+*/
+class PYBIND11_EXPORT CheckpointWriter : public Analyzer
+    {
+    public:
+    //! Construct the writer
+    CheckpointWriter(std::shared_ptr<SystemDefinition> sysdef,
+                     std::shared_ptr<Trigger> trigger,
+                     const std::string& fname);
+
+    //! Destructor
+    virtual ~CheckpointWriter();
+
+    //! Write a checkpoint
+    virtual void analyze(uint64_t timestep);
+
+    //! Get the file name
+    const std::string& getFilename() const
+        {
+        return m_fname;
+        }
+
+    //! Set the Python object that provides the operation state
+    /*! \param state_writer Object with a _checkpoint_state() method that returns a string
+     */
+    void setStateWriter(pybind11::object state_writer)
+        {
+        m_state_writer = state_writer;
+        }
+
+    //! Get the Python object that provides the operation state
+    pybind11::object getStateWriter()
+        {
+        return m_state_writer;
+        }
+
+    //! The state writer is a Python object
+    virtual bool usesPython()
+        {
+        return !m_state_writer.is_none();
+        }
+
+    protected:
+    std::string m_fname;             //!< File name
+    pybind11::object m_state_writer; //!< Provides the operation state
+
+    //! Write a chunk to the file
+    void writeChunk(gsd_handle& handle,
+                    const char* name,
+                    gsd_type type,
+                    uint64_t N,
+                    uint32_t M,
+                    const void* data);
+
+    //! Write a list of strings to the file
+    void
+    writeStrings(gsd_handle& handle, const char* name, const std::vector<std::string>& strings);
+
+    //! Write the bonded groups in a snapshot
+    template<class Snapshot, unsigned int group_size>
+    void writeGroups(gsd_handle& handle, const std::string& prefix, const Snapshot& snapshot);
+
+    //! Write the checkpoint
+    void writeCheckpoint(gsd_handle& handle,
+                         uint64_t timestep,
+                         const SnapshotSystemData<double>& snapshot,
+                         const std::vector<std::string>& state);
+    };
+
+namespace detail
+    {
+//! Exports the CheckpointWriter class to python
+void export_CheckpointWriter(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace hoomd
+
+#endif
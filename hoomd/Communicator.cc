@@ -1180,16 +1180,17 @@ Communicator::Communicator(std::shared_ptr<SystemDefinition> sysdef,
     : m_sysdef(sysdef), m_pdata(sysdef->getParticleData()), m_meshdef(NULL),
       m_exec_conf(m_pdata->getExecConf()), m_mpi_comm(m_exec_conf->getMPICommunicator()),
       m_decomposition(decomposition), m_is_communicating(false), m_force_migrate(false),
-      m_nneigh(0), m_n_unique_neigh(0), m_pos_copybuf(m_exec_conf), m_charge_copybuf(m_exec_conf),
-      m_diameter_copybuf(m_exec_conf), m_body_copybuf(m_exec_conf), m_image_copybuf(m_exec_conf),
-      m_velocity_copybuf(m_exec_conf), m_orientation_copybuf(m_exec_conf),
-      m_plan_copybuf(m_exec_conf), m_tag_copybuf(m_exec_conf), m_netforce_copybuf(m_exec_conf),
-      m_nettorque_copybuf(m_exec_conf), m_netvirial_copybuf(m_exec_conf),
-      m_netvirial_recvbuf(m_exec_conf), m_plan(m_exec_conf), m_plan_reverse(m_exec_conf),
-      m_tag_reverse(m_exec_conf), m_netforce_reverse_copybuf(m_exec_conf),
-      m_netforce_reverse_recvbuf(m_exec_conf), m_r_ghost_max(Scalar(0.0)), m_ghosts_added(0),
-      m_has_ghost_particles(false), m_last_flags(0), m_comm_pending(false),
-      m_bond_comm(*this, m_sysdef->getBondData()), m_angle_comm(*this, m_sysdef->getAngleData()),
+      m_exchange_pos(m_exec_conf), m_nneigh(0), m_n_unique_neigh(0), m_pos_copybuf(m_exec_conf),
+      m_charge_copybuf(m_exec_conf), m_diameter_copybuf(m_exec_conf), m_body_copybuf(m_exec_conf),
+      m_image_copybuf(m_exec_conf), m_velocity_copybuf(m_exec_conf),
+      m_orientation_copybuf(m_exec_conf), m_plan_copybuf(m_exec_conf), m_tag_copybuf(m_exec_conf),
+      m_netforce_copybuf(m_exec_conf), m_nettorque_copybuf(m_exec_conf),
+      m_netvirial_copybuf(m_exec_conf), m_netvirial_recvbuf(m_exec_conf), m_plan(m_exec_conf),
+      m_plan_reverse(m_exec_conf), m_tag_reverse(m_exec_conf),
+      m_netforce_reverse_copybuf(m_exec_conf), m_netforce_reverse_recvbuf(m_exec_conf),
+      m_r_ghost_max(Scalar(0.0)), m_ghosts_added(0), m_has_ghost_particles(false), m_last_flags(0),
+      m_comm_pending(false), m_bond_comm(*this, m_sysdef->getBondData()),
+      m_angle_comm(*this, m_sysdef->getAngleData()),
       m_dihedral_comm(*this, m_sysdef->getDihedralData()),
       m_improper_comm(*this, m_sysdef->getImproperData()),
       m_constraint_comm(*this, m_sysdef->getConstraintData()),
@@ -1512,6 +1513,13 @@ void Communicator::communicate(uint64_t timestep)
     // Guard to prevent recursive triggering of migration
     m_is_communicating = true;
 
+    Tracer& tracer = m_exec_conf->getTracer();
+    ScopedTrace communicate_trace(tracer, "communicate", "communicator");
+
+    // ghost positions must be current before they are sent again or replaced
+    finishDeferredGhostUpdate();
+    const int64_t start_time = m_clock.getTime();
+
     // update ghost communication flags
     m_flags = CommFlags(0);
     m_requested_flags.emit_accumulate([&](CommFlags f) { m_flags |= f; }, timestep);
@@ -1519,8 +1527,11 @@ void Communicator::communicate(uint64_t timestep)
     if (!m_force_migrate && !m_compute_callbacks.empty() && m_has_ghost_particles)
         {
         // do an obligatory update before determining whether to migrate
-        beginUpdateGhosts(timestep);
-        finishUpdateGhosts(timestep);
+            {
+            ScopedTrace trace(tracer, "update ghosts", "communicator");
+            beginUpdateGhosts(timestep);
+            finishUpdateGhosts(timestep);
+            }
 
         // call subscribers after ghost update, but before distance check
         m_compute_callbacks.emit(timestep);
@@ -1536,6 +1547,11 @@ void Communicator::communicate(uint64_t timestep)
         // due to SFCPackUpdater running before)
         m_migrate_requests.emit_accumulate([&](bool r) { migrate_request = migrate_request || r; },
                                            timestep);
+
+        // with a ghost shell, neighbor lists rebuild with the current ghosts until a particle
+        // leaves the shell
+        if (m_ghost_shell > Scalar(0.0) && m_has_ghost_particles)
+            migrate_request = checkGhostShell();
         }
 
     bool migrate = migrate_request || m_force_migrate || !m_has_ghost_particles;
@@ -1543,9 +1559,19 @@ void Communicator::communicate(uint64_t timestep)
     // Update ghosts if we are not migrating
     if (!migrate && m_compute_callbacks.empty())
         {
+        ScopedTrace trace(tracer, "update ghosts", "communicator");
         beginUpdateGhosts(timestep);
 
-        finishUpdateGhosts(timestep);
+        if (m_overlap_ghost_updates)
+            {
+            // the integrator completes the update after computing the interior forces
+            m_ghost_update_deferred = true;
+            m_deferred_timestep = timestep;
+            }
+        else
+            {
+            finishUpdateGhosts(timestep);
+            }
         }
 
     // Check if migration of particles is requested
@@ -1554,10 +1580,20 @@ void Communicator::communicate(uint64_t timestep)
         m_force_migrate = false;
 
         // If so, migrate atoms
-        migrateParticles();
+            {
+            ScopedTrace trace(tracer, "migrate", "communicator");
+            migrateParticles();
+            }
 
         // Construct ghost send lists, exchange ghost atom data
-        exchangeGhosts();
+            {
+            ScopedTrace trace(tracer, "exchange ghosts", "communicator");
+            exchangeGhosts();
+            }
+        m_num_ghost_exchanges++;
+
+        if (m_ghost_shell > Scalar(0.0))
+            setExchangePositions();
 
         // update particle data now that ghosts are available
         m_compute_callbacks.emit(timestep);
@@ -1565,9 +1601,110 @@ void Communicator::communicate(uint64_t timestep)
         m_has_ghost_particles = true;
         }
 
+    m_comm_time += double(m_clock.getTime() - start_time) / 1e9;
     m_is_communicating = false;
     }
 
+/*! Does nothing when no ghost update is in flight.
+ */
+void Communicator::finishDeferredGhostUpdate()
+    {
+    if (!m_ghost_update_deferred)
+        return;
+
+    ScopedTrace trace(m_exec_conf->getTracer(), "finish update ghosts", "communicator");
+    const int64_t start_time = m_clock.getTime();
+    m_ghost_update_deferred = false;
+    finishUpdateGhosts(m_deferred_timestep);
+    m_comm_time += double(m_clock.getTime() - start_time) / 1e9;
+    }
+
+/*! \param shell Extra ghost layer width
+
+    Changing the shell forces a particle migration so that the next call to communicate()
+    exchanges ghosts with the new width.
+*/
+void Communicator::setGhostShell(Scalar shell)
+    {
+    if (!(shell >= Scalar(0.0)))
+        {
+        throw std::runtime_error("The ghost shell must be non-negative.");
+        }
+
+    if (shell != m_ghost_shell)
+        {
+        m_ghost_shell = shell;
+        forceMigrate();
+        }
+    }
+
+/*! \returns true when any particle on any rank has moved more than half the ghost shell since the
+             last ghost exchange (after subtracting homogeneous dilations of the box)
+
+    The ghosts sent at the last exchange cover every particle within the requested ghost width
+    plus the shell. As long as no particle has moved more than half the shell, every pair within
+    the requested width includes a local particle and either another local particle or a ghost.
+*/
+bool Communicator::checkGhostShell()
+    {
+    bool result = m_pdata->getN() != m_exchange_pos.size();
+
+    if (!result)
+        {
+        Scalar3 lambda = m_pdata->getGlobalBox().getNearestPlaneDistance() / m_exchange_L;
+        Scalar lambda_min = std::min(std::min(lambda.x, lambda.y), lambda.z);
+        lambda_min = std::min(lambda_min, Scalar(1.0));
+
+        // a contracting box moves particles outside the requested width closer
+        const Scalar r_request = m_r_ghost_max - m_ghost_shell;
+        const Scalar delta_max = (m_r_ghost_max * lambda_min - r_request) / Scalar(2.0);
+        const Scalar maxsq = (delta_max > 0) ? delta_max * delta_max : 0;
+
+        result = checkExchangeDisplacements(lambda, maxsq);
+        }
+
+    int local_result = result ? 1 : 0;
+    int global_result = 0;
+    MPI_Allreduce(&local_result, &global_result, 1, MPI_INT, MPI_MAX, m_mpi_comm);
+    return global_result > 0;
+    }
+
+/*! \param lambda Ratio of the current to the last exchanged nearest plane distances of the box
+    \param maxsq Square of the maximum displacement
+    \returns true when a local particle has moved at least sqrt(\a maxsq) since the last exchange
+*/
+bool Communicator::checkExchangeDisplacements(const Scalar3& lambda, Scalar maxsq)
+    {
+    const BoxDim& box = m_pdata->getBox();
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_exchange_pos(m_exchange_pos, access_location::host, access_mode::read);
+
+    for (unsigned int i = 0; i < m_pdata->getN(); ++i)
+        {
+        Scalar3 dx = make_scalar3(h_pos.data[i].x - lambda.x * h_exchange_pos.data[i].x,
+                                  h_pos.data[i].y - lambda.y * h_exchange_pos.data[i].y,
+                                  h_pos.data[i].z - lambda.z * h_exchange_pos.data[i].z);
+        dx = box.minImage(dx);
+
+        if (dot(dx, dx) >= maxsq)
+            return true;
+        }
+
+    return false;
+    }
+
+void Communicator::setExchangePositions()
+    {
+    m_exchange_pos.resize(m_pdata->getN());
+    m_exchange_L = m_pdata->getGlobalBox().getNearestPlaneDistance();
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_exchange_pos(m_exchange_pos,
+                                        access_location::host,
+                                        access_mode::overwrite);
+    std::copy(h_pos.data, h_pos.data + m_pdata->getN(), h_exchange_pos.data);
+    }
+
 //! Transfer particles between neighboring domains
 void Communicator::migrateParticles()
     {
@@ -1761,6 +1898,9 @@ void Communicator::updateGhostWidth()
                         r_ghost_i = r;
                 },
                 cur_type);
+            // types without interactions need no ghosts
+            if (r_ghost_i > Scalar(0.0))
+                r_ghost_i += m_ghost_shell;
             h_r_ghost.data[cur_type] = r_ghost_i;
             if (r_ghost_i > r_ghost_max)
                 r_ghost_max = r_ghost_i;
@@ -2361,6 +2501,8 @@ void Communicator::exchangeGhosts()
     // exchange ghost constraints along with ghost particles
     m_constraint_comm.exchangeGhostGroups(m_plan, mask);
 
+    setDeltaGhostReferences(flags);
+
     m_last_flags = flags;
 
     /***********************************************************************************************************************************************************
@@ -2626,6 +2768,176 @@ void Communicator::exchangeGhosts()
         }
     }
 
+/*! \param flags The fields sent with the ghosts
+
+    Copy the ghost velocities and orientations that this rank sent in each direction, and all
+    ghost velocities and orientations that it received. Ghost updates compare against the sent
+    copies and apply the changes to the received ones.
+*/
+void Communicator::setDeltaGhostReferences(const CommFlags& flags)
+    {
+    m_delta_ref_flags.reset();
+    if (!m_delta_ghost_updates)
+        return;
+
+    unsigned int n_recv_ghosts = 0;
+    for (unsigned int dir = 0; dir < 6; dir++)
+        {
+        if (isCommunicating(dir))
+            n_recv_ghosts += m_num_recv_ghosts[dir];
+        }
+
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+
+    auto set_references = [&](const GlobalArray<Scalar4>& array,
+                              std::vector<Scalar4>* send_ref,
+                              std::vector<Scalar4>& recv_ref)
+    {
+        ArrayHandle<Scalar4> h_array(array, access_location::host, access_mode::read);
+
+        for (unsigned int dir = 0; dir < 6; dir++)
+            {
+            if (!isCommunicating(dir))
+                continue;
+
+            ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
+                                                    access_location::host,
+                                                    access_mode::read);
+            send_ref[dir].resize(m_num_copy_ghosts[dir]);
+            for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
+                {
+                send_ref[dir][ghost_idx] = h_array.data[h_rtag.data[h_copy_ghosts.data[ghost_idx]]];
+                }
+            }
+
+        const Scalar4* ghosts = h_array.data + m_pdata->getN();
+        recv_ref.assign(ghosts, ghosts + n_recv_ghosts);
+    };
+
+    if (flags[comm_flag::velocity])
+        {
+        set_references(m_pdata->getVelocities(),
+                       m_velocity_ghost_sendref,
+                       m_velocity_ghost_recvref);
+        m_delta_ref_flags[comm_flag::velocity] = 1;
+        }
+
+    if (flags[comm_flag::orientation])
+        {
+        set_references(m_pdata->getOrientationArray(),
+                       m_orientation_ghost_sendref,
+                       m_orientation_ghost_recvref);
+        m_delta_ref_flags[comm_flag::orientation] = 1;
+        }
+    }
+
+/*! \param dir Direction to send in
+    \param array Particle data array to update the ghosts of
+    \param send_ref Values last sent in this direction
+    \param recv_ref Values last received from all directions
+    \param recv_offset Index of the first ghost received in this direction
+    \param send_neighbor Rank to send to
+    \param recv_neighbor Rank to receive from
+    \param tag MPI tag of the indices, the values use \a tag + 1
+
+    Only the ghosts whose value differs from \a send_ref are sent, as their index in the send list
+    and the new value. The receiver does not know the number of changes, so it posts receives for
+    all of its ghosts and reads the number from the status. All ghosts received in this direction
+    are then overwritten with \a recv_ref, so they match the sender even if they were modified
+    locally.
+*/
+void Communicator::updateGhostsDelta(unsigned int dir,
+                                     const GlobalArray<Scalar4>& array,
+                                     std::vector<Scalar4>& send_ref,
+                                     std::vector<Scalar4>& recv_ref,
+                                     unsigned int recv_offset,
+                                     unsigned int send_neighbor,
+                                     unsigned int recv_neighbor,
+                                     int tag)
+    {
+    m_delta_idx_sendbuf.clear();
+    m_delta_val_sendbuf.clear();
+
+        {
+        ArrayHandle<Scalar4> h_array(array, access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::read);
+
+        // pack the ghosts that changed since they were last sent
+        for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
+            {
+            unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
+
+            assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
+
+            const Scalar4 value = h_array.data[idx];
+            Scalar4& ref = send_ref[ghost_idx];
+            if (value.x != ref.x || value.y != ref.y || value.z != ref.z || value.w != ref.w)
+                {
+                ref = value;
+                m_delta_idx_sendbuf.push_back(ghost_idx);
+                m_delta_val_sendbuf.push_back(value);
+                }
+            }
+        }
+
+    m_delta_idx_recvbuf.resize(m_num_recv_ghosts[dir]);
+    m_delta_val_recvbuf.resize(m_num_recv_ghosts[dir]);
+
+    m_reqs.resize(4);
+    m_stats.resize(4);
+
+    MPI_Isend(m_delta_idx_sendbuf.data(),
+              (unsigned int)(m_delta_idx_sendbuf.size() * sizeof(unsigned int)),
+              MPI_BYTE,
+              send_neighbor,
+              tag,
+              m_mpi_comm,
+              &m_reqs[0]);
+    MPI_Isend(m_delta_val_sendbuf.data(),
+              (unsigned int)(m_delta_val_sendbuf.size() * sizeof(Scalar4)),
+              MPI_BYTE,
+              send_neighbor,
+              tag + 1,
+              m_mpi_comm,
+              &m_reqs[1]);
+    MPI_Irecv(m_delta_idx_recvbuf.data(),
+              (unsigned int)(m_num_recv_ghosts[dir] * sizeof(unsigned int)),
+              MPI_BYTE,
+              recv_neighbor,
+              tag,
+              m_mpi_comm,
+              &m_reqs[2]);
+    MPI_Irecv(m_delta_val_recvbuf.data(),
+              (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
+              MPI_BYTE,
+              recv_neighbor,
+              tag + 1,
+              m_mpi_comm,
+              &m_reqs[3]);
+    MPI_Waitall(4, &m_reqs.front(), &m_stats.front());
+
+    int n_bytes;
+    MPI_Get_count(&m_stats[2], MPI_BYTE, &n_bytes);
+    const unsigned int n_changed = (unsigned int)n_bytes / (unsigned int)sizeof(unsigned int);
+
+    // apply the changes and write all ghosts received in this direction
+    for (unsigned int i = 0; i < n_changed; i++)
+        {
+        assert(m_delta_idx_recvbuf[i] < m_num_recv_ghosts[dir]);
+        recv_ref[recv_offset + m_delta_idx_recvbuf[i]] = m_delta_val_recvbuf[i];
+        }
+
+    ArrayHandle<Scalar4> h_array(array, access_location::host, access_mode::readwrite);
+    std::copy(recv_ref.begin() + recv_offset,
+              recv_ref.begin() + recv_offset + m_num_recv_ghosts[dir],
+              h_array.data + m_pdata->getN() + recv_offset);
+    }
+
 //! update positions of ghost particles
 void Communicator::beginUpdateGhosts(uint64_t timestep)
     {
@@ -2633,6 +2945,13 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
     // to send to neighboring processors
     m_exec_conf->msg->notice(7) << "Communicator: update ghosts" << std::endl;
 
+    // send only the changed velocities and orientations of fields with references
+    const CommFlags update_flags = getFlags();
+    const bool delta_velocity = m_delta_ghost_updates && update_flags[comm_flag::velocity]
+                                && m_delta_ref_flags[comm_flag::velocity];
+    const bool delta_orientation = m_delta_ghost_updates && update_flags[comm_flag::orientation]
+                                   && m_delta_ref_flags[comm_flag::orientation];
+
     // update data in these arrays
 
     unsigned int num_tot_recv_ghosts = 0; // total number of ghosts received
@@ -2671,7 +2990,7 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                 }
             }
 
-        if (flags[comm_flag::velocity])
+        if (flags[comm_flag::velocity] && !delta_velocity)
             {
             ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
                                        access_location::host,
@@ -2698,7 +3017,7 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                 }
             }
 
-        if (flags[comm_flag::orientation])
+        if (flags[comm_flag::orientation] && !delta_orientation)
             {
             ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
                                                access_location::host,
@@ -2738,6 +3057,26 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
 
         start_idx = m_pdata->getN() + num_tot_recv_ghosts;
 
+        if (delta_velocity)
+            updateGhostsDelta(dir,
+                              m_pdata->getVelocities(),
+                              m_velocity_ghost_sendref[dir],
+                              m_velocity_ghost_recvref,
+                              num_tot_recv_ghosts,
+                              send_neighbor,
+                              recv_neighbor,
+                              4);
+
+        if (delta_orientation)
+            updateGhostsDelta(dir,
+                              m_pdata->getOrientationArray(),
+                              m_orientation_ghost_sendref[dir],
+                              m_orientation_ghost_recvref,
+                              num_tot_recv_ghosts,
+                              send_neighbor,
+                              recv_neighbor,
+                              6);
+
         num_tot_recv_ghosts += m_num_recv_ghosts[dir];
 
         // only non-permanent fields (position, velocity, orientation) need to be considered here
@@ -2772,7 +3111,7 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
             MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
             }
 
-        if (flags[comm_flag::velocity])
+        if (flags[comm_flag::velocity] && !delta_velocity)
             {
             m_reqs.resize(2);
             m_stats.resize(2);
@@ -2802,7 +3141,7 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
             MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
             }
 
-        if (flags[comm_flag::orientation])
+        if (flags[comm_flag::orientation] && !delta_orientation)
             {
             m_reqs.resize(2);
             m_stats.resize(2);
@@ -3409,6 +3748,17 @@ void export_Communicator(pybind11::module& m)
         .def(pybind11::init<std::shared_ptr<SystemDefinition>,
                             std::shared_ptr<DomainDecomposition>>())
         .def("addMeshDefinition", &Communicator::addMeshDefinition)
+        .def_property("persistent_ghost_updates",
+                      &Communicator::getPersistentGhostUpdates,
+                      &Communicator::setPersistentGhostUpdates)
+        .def_property("compress_ghost_updates",
+                      &Communicator::getCompressGhostUpdates,
+                      &Communicator::setCompressGhostUpdates)
+        .def_property("delta_ghost_updates",
+                      &Communicator::getDeltaGhostUpdates,
+                      &Communicator::setDeltaGhostUpdates)
+        .def_property("ghost_shell", &Communicator::getGhostShell, &Communicator::setGhostShell)
+        .def("getNumGhostExchanges", &Communicator::getNumGhostExchanges)
         .def_property_readonly("domain_decomposition", &Communicator::getDomainDecomposition);
     }
     } // end namespace detail
@@ -11,6 +11,7 @@
 #define __COMMUNICATOR_H__
 
 #include "BondedGroupData.h"
+#include "ClockSource.h"
 #include "DomainDecomposition.h"
 #include "GPUVector.h"
 #include "GlobalArray.h"
@@ -328,6 +329,122 @@ class PYBIND11_EXPORT Communicator
         m_comm_pending = false;
         }
 
+    //! Set whether communicate() leaves ghost updates in flight
+    /*! \param overlap True to overlap ghost updates with the force computation
+     *
+     * When enabled, communicate() begins the ghost position update on steps without particle
+     * migration and returns before the update completes. The caller computes the forces on
+     * particles that do not interact with ghosts and then calls finishDeferredGhostUpdate().
+     */
+    void setOverlapGhostUpdates(bool overlap)
+        {
+        m_overlap_ghost_updates = overlap;
+        }
+
+    //! Test if communicate() leaves ghost updates in flight
+    bool getOverlapGhostUpdates() const
+        {
+        return m_overlap_ghost_updates;
+        }
+
+    //! Test if a ghost update begun by communicate() is still in flight
+    bool isGhostUpdateDeferred() const
+        {
+        return m_ghost_update_deferred;
+        }
+
+    //! Complete the ghost update left in flight by communicate()
+    void finishDeferredGhostUpdate();
+
+    //! Set whether ghost updates reuse persistent MPI requests
+    /*! \param persistent True to post ghost updates with persistent requests
+     *
+     * When enabled, the ghost update initializes its sends and receives once per ghost exchange
+     * (MPI_Send_init/MPI_Recv_init) and starts them with MPI_Startall on every update until the
+     * set of ghosts changes. Only CommunicatorGPU implements persistent ghost updates.
+     */
+    void setPersistentGhostUpdates(bool persistent)
+        {
+        m_persistent_ghost_updates = persistent;
+        }
+
+    //! Test if ghost updates reuse persistent MPI requests
+    bool getPersistentGhostUpdates() const
+        {
+        return m_persistent_ghost_updates;
+        }
+
+    //! Set whether ghost updates send positions and orientations in reduced precision
+    /*! \param compress True to compress ghost updates
+     *
+     * When enabled, the ghost update sends the positions and orientations of ghost particles as
+     * single precision offsets from the values sent by the last ghost exchange. The receiver adds
+     * the offsets to its copy of those values. Ghost exchanges and all other fields remain in full
+     * precision. Only CommunicatorGPU implements compressed ghost updates.
+     */
+    void setCompressGhostUpdates(bool compress)
+        {
+        m_compress_ghost_updates = compress;
+        }
+
+    //! Test if ghost updates send positions and orientations in reduced precision
+    bool getCompressGhostUpdates() const
+        {
+        return m_compress_ghost_updates;
+        }
+
+    //! Set whether ghost updates send only the velocities and orientations that changed
+    /*! \param delta True to send only changed values
+     *
+     * When enabled, every rank keeps a copy of the ghost velocities and orientations it sent and
+     * received since the last ghost exchange. A ghost update then sends only the indices and values
+     * of the ghosts whose velocity or orientation differs from the copy, and the receiver applies
+     * them on top of its copy. Positions and ghost exchanges are unchanged. Only the CPU
+     * Communicator implements delta ghost updates.
+     */
+    void setDeltaGhostUpdates(bool delta)
+        {
+        m_delta_ghost_updates = delta;
+        }
+
+    //! Test if ghost updates send only the velocities and orientations that changed
+    bool getDeltaGhostUpdates() const
+        {
+        return m_delta_ghost_updates;
+        }
+
+    //! Set the width of the extra shell added to the ghost layer
+    /*! \param shell Extra ghost layer width (in distance units)
+     *
+     * A positive shell widens the ghost layer requested by the neighbor lists and decouples
+     * particle migration from neighbor list rebuilds. Neighbor lists then rebuild locally with the
+     * current ghosts, and communicate() migrates particles and exchanges ghosts only when a
+     * particle has moved more than half the shell since the last exchange. With a shell of 0,
+     * particles migrate whenever a neighbor list needs to be rebuilt.
+     */
+    void setGhostShell(Scalar shell);
+
+    //! Get the width of the extra shell added to the ghost layer
+    Scalar getGhostShell() const
+        {
+        return m_ghost_shell;
+        }
+
+    //! Get the number of ghost exchanges since construction
+    uint64_t getNumGhostExchanges() const
+        {
+        return m_num_ghost_exchanges;
+        }
+
+    //! Get the wall clock time spent in communicate() since construction (in seconds)
+    /*! The time includes the time spent waiting for other ranks, so the difference between the
+     * elapsed time and the communication time estimates the work done by this rank.
+     */
+    double getCommunicationTime() const
+        {
+        return m_comm_time;
+        }
+
     /*! Communicate the net particle force
      * \parm timestep The time step
      */
@@ -467,6 +584,19 @@ class PYBIND11_EXPORT Communicator
     //! Helper function to update the shifted box for ghost particle PBC
     const BoxDim getShiftedBox() const;
 
+    //! Record the ghost velocities and orientations of the last exchange for delta updates
+    void setDeltaGhostReferences(const CommFlags& flags);
+
+    //! Send the changed ghost values of one field in one direction
+    void updateGhostsDelta(unsigned int dir,
+                           const GlobalArray<Scalar4>& array,
+                           std::vector<Scalar4>& send_ref,
+                           std::vector<Scalar4>& recv_ref,
+                           unsigned int recv_offset,
+                           unsigned int send_neighbor,
+                           unsigned int recv_neighbor,
+                           int tag);
+
     std::shared_ptr<SystemDefinition> m_sysdef;                //!< System definition
     std::shared_ptr<ParticleData> m_pdata;                     //!< Particle data
     std::shared_ptr<MeshDefinition> m_meshdef;                 //!< Mesh definition
@@ -477,6 +607,22 @@ class PYBIND11_EXPORT Communicator
     bool m_is_communicating; //!< Whether we are currently communicating
     bool m_force_migrate;    //!< True if particle migration is forced
 
+    bool m_overlap_ghost_updates = false; //!< True if communicate() defers finishing ghost updates
+    bool m_ghost_update_deferred = false; //!< True if a deferred ghost update is in flight
+    uint64_t m_deferred_timestep = 0;     //!< Time step of the deferred ghost update
+
+    bool m_persistent_ghost_updates = false; //!< True if ghost updates use persistent requests
+    bool m_compress_ghost_updates = false;   //!< True if ghost updates are compressed
+    bool m_delta_ghost_updates = false;      //!< True if ghost updates send only changed values
+
+    Scalar m_ghost_shell = Scalar(0.0);   //!< Extra ghost layer width
+    uint64_t m_num_ghost_exchanges = 0;   //!< Number of ghost exchanges since construction
+    GlobalVector<Scalar4> m_exchange_pos; //!< Local particle positions at the last exchange
+    Scalar3 m_exchange_L = make_scalar3(0, 0, 0); //!< Global box plane distances at last exchange
+
+    ClockSource m_clock;      //!< Clock to measure the communication time
+    double m_comm_time = 0.0; //!< Wall clock time spent in communicate() (in seconds)
+
     unsigned int m_is_at_boundary[6]; //!< Array of flags indicating whether this box lies at a
                                       //!< global boundary
 
@@ -508,6 +654,17 @@ class PYBIND11_EXPORT Communicator
         m_num_copy_ghosts[6]; //!< Number of local particles that are sent to neighboring processors
     unsigned int m_num_recv_ghosts[6]; //!< Number of ghosts received per direction
 
+    // references for delta ghost updates, recorded at the last ghost exchange
+    CommFlags m_delta_ref_flags;                         //!< Fields with references
+    std::vector<Scalar4> m_velocity_ghost_sendref[6];    //!< Last sent ghost velocities
+    std::vector<Scalar4> m_orientation_ghost_sendref[6]; //!< Last sent ghost orientations
+    std::vector<Scalar4> m_velocity_ghost_recvref;       //!< Last received ghost velocities
+    std::vector<Scalar4> m_orientation_ghost_recvref;    //!< Last received ghost orientations
+    std::vector<unsigned int> m_delta_idx_sendbuf;       //!< Send buffer for changed indices
+    std::vector<unsigned int> m_delta_idx_recvbuf;       //!< Receive buffer for changed indices
+    std::vector<Scalar4> m_delta_val_sendbuf;            //!< Send buffer for changed values
+    std::vector<Scalar4> m_delta_val_recvbuf;            //!< Receive buffer for changed values
+
     GlobalVector<unsigned int>
         m_plan; //!< Array of per-direction flags that determine the sending route
 
@@ -566,6 +723,15 @@ class PYBIND11_EXPORT Communicator
     //! Update the ghost width array
     void updateGhostWidth();
 
+    //! Test if any particle has moved more than half the ghost shell since the last exchange
+    bool checkGhostShell();
+
+    //! Test if any local particle has moved too far since the last exchange
+    virtual bool checkExchangeDisplacements(const Scalar3& lambda, Scalar maxsq);
+
+    //! Record the positions of the local particles at a ghost exchange
+    virtual void setExchangePositions();
+
     Nano::Signal<bool(uint64_t timestep)>
         m_migrate_requests; //!< List of functions that may request particle migration
 
@@ -48,6 +48,7 @@ CommunicatorGPU::CommunicatorGPU(std::shared_ptr<SystemDefinition> sysdef,
 CommunicatorGPU::~CommunicatorGPU()
     {
     m_exec_conf->msg->notice(5) << "Destroying CommunicatorGPU";
+    freePersistentGhostRequests();
     hipEventDestroy(m_event);
     }
 
@@ -129,6 +130,30 @@ void CommunicatorGPU::allocateBuffers()
     GlobalVector<Scalar4> orientation_ghost_recvbuf(m_exec_conf);
     m_orientation_ghost_recvbuf.swap(orientation_ghost_recvbuf);
 
+    GlobalVector<float4> pos_ghost_sendbuf_compressed(m_exec_conf);
+    m_pos_ghost_sendbuf_compressed.swap(pos_ghost_sendbuf_compressed);
+
+    GlobalVector<float4> pos_ghost_recvbuf_compressed(m_exec_conf);
+    m_pos_ghost_recvbuf_compressed.swap(pos_ghost_recvbuf_compressed);
+
+    GlobalVector<float4> orientation_ghost_sendbuf_compressed(m_exec_conf);
+    m_orientation_ghost_sendbuf_compressed.swap(orientation_ghost_sendbuf_compressed);
+
+    GlobalVector<float4> orientation_ghost_recvbuf_compressed(m_exec_conf);
+    m_orientation_ghost_recvbuf_compressed.swap(orientation_ghost_recvbuf_compressed);
+
+    GlobalVector<Scalar4> pos_ghost_sendref(m_exec_conf);
+    m_pos_ghost_sendref.swap(pos_ghost_sendref);
+
+    GlobalVector<Scalar4> pos_ghost_recvref(m_exec_conf);
+    m_pos_ghost_recvref.swap(pos_ghost_recvref);
+
+    GlobalVector<Scalar4> orientation_ghost_sendref(m_exec_conf);
+    m_orientation_ghost_sendref.swap(orientation_ghost_sendref);
+
+    GlobalVector<Scalar4> orientation_ghost_recvref(m_exec_conf);
+    m_orientation_ghost_recvref.swap(orientation_ghost_recvref);
+
     GlobalVector<Scalar4> netforce_ghost_sendbuf(m_exec_conf);
     m_netforce_ghost_sendbuf.swap(netforce_ghost_sendbuf);
 
@@ -167,6 +192,18 @@ void CommunicatorGPU::allocateBuffers()
 
     GlobalVector<unsigned int> scan(m_exec_conf);
     m_scan.swap(scan);
+
+    GlobalVector<unsigned int> neigh_send_counts(m_exec_conf);
+    m_neigh_send_counts.swap(neigh_send_counts);
+
+    GlobalArray<unsigned int> exchange_flags(1, m_exec_conf);
+    m_exchange_flags.swap(exchange_flags);
+        {
+        ArrayHandle<unsigned int> h_exchange_flags(m_exchange_flags,
+                                                   access_location::host,
+                                                   access_mode::overwrite);
+        *h_exchange_flags.data = 0;
+        }
     }
 
 void CommunicatorGPU::initializeCommunicationStages()
@@ -364,7 +401,8 @@ CommunicatorGPU::GroupCommunicatorGPU<group_data>::GroupCommunicatorGPU(
     : m_gpu_comm(gpu_comm), m_exec_conf(m_gpu_comm.m_exec_conf), m_gdata(gdata),
       m_ghost_group_begin(m_exec_conf), m_ghost_group_end(m_exec_conf),
       m_ghost_group_idx_adj(m_exec_conf), m_ghost_group_neigh(m_exec_conf),
-      m_ghost_group_plan(m_exec_conf), m_neigh_counts(m_exec_conf), m_ghost_scan(m_exec_conf)
+      m_ghost_group_plan(m_exec_conf), m_neigh_counts(m_exec_conf), m_ghost_scan(m_exec_conf),
+      m_neigh_send_counts(m_exec_conf)
     {
     GlobalVector<unsigned int> rank_mask(m_exec_conf);
     m_rank_mask.swap(rank_mask);
@@ -408,7 +446,8 @@ CommunicatorGPU::GroupCommunicatorGPU<group_data>::GroupCommunicatorGPU(Communic
     : m_gpu_comm(gpu_comm), m_exec_conf(m_gpu_comm.m_exec_conf), m_gdata(NULL),
       m_ghost_group_begin(m_exec_conf), m_ghost_group_end(m_exec_conf),
       m_ghost_group_idx_adj(m_exec_conf), m_ghost_group_neigh(m_exec_conf),
-      m_ghost_group_plan(m_exec_conf), m_neigh_counts(m_exec_conf), m_ghost_scan(m_exec_conf)
+      m_ghost_group_plan(m_exec_conf), m_neigh_counts(m_exec_conf), m_ghost_scan(m_exec_conf),
+      m_neigh_send_counts(m_exec_conf)
     {
     GlobalVector<unsigned int> rank_mask(m_exec_conf);
     m_rank_mask.swap(rank_mask);
@@ -1284,6 +1323,7 @@ void CommunicatorGPU::GroupCommunicatorGPU<group_data>::exchangeGhostGroups(
 
         m_ghost_group_begin.resize(m_gpu_comm.m_n_unique_neigh * m_gpu_comm.m_num_stages);
         m_ghost_group_end.resize(m_gpu_comm.m_n_unique_neigh * m_gpu_comm.m_num_stages);
+        m_neigh_send_counts.resize(m_gpu_comm.m_n_unique_neigh);
 
         std::vector<unsigned int> idx_offs;
         idx_offs.resize(m_gpu_comm.m_num_stages);
@@ -1335,21 +1375,48 @@ void CommunicatorGPU::GroupCommunicatorGPU<group_data>::exchangeGhostGroups(
                 ArrayHandle<unsigned int> d_ghost_scan(m_ghost_scan,
                                                        access_location::device,
                                                        access_mode::overwrite);
+                ArrayHandle<unsigned int> d_neigh_send_counts(m_neigh_send_counts,
+                                                              access_location::device,
+                                                              access_mode::overwrite);
 
-                // count number of neighbors (total and per particle) the ghost ptls are sent to
-                n_send_ghost_groups_tot[stage]
-                    = gpu_exchange_ghosts_count_neighbors(m_gdata->getN() + m_gdata->getNGhosts(),
-                                                          d_ghost_group_plan.data,
-                                                          d_adj_mask.data,
-                                                          d_neigh_counts.data,
-                                                          d_ghost_scan.data,
-                                                          m_gpu_comm.m_n_unique_neigh,
-                                                          m_exec_conf->getCachedAllocator());
+                // count number of neighbors (per group and per neighbor) the ghosts are sent to
+                gpu_exchange_ghosts_count_neighbors(m_gdata->getN() + m_gdata->getNGhosts(),
+                                                    d_ghost_group_plan.data,
+                                                    d_adj_mask.data,
+                                                    d_neigh_counts.data,
+                                                    d_ghost_scan.data,
+                                                    d_neigh_send_counts.data,
+                                                    m_gpu_comm.m_n_unique_neigh,
+                                                    m_exec_conf->getCachedAllocator());
 
                 if (m_exec_conf->isCUDAErrorCheckingEnabled())
                     CHECK_CUDA_ERROR();
                 }
 
+                {
+                // the range of each neighbor in the send list follows from the counts, as in
+                // CommunicatorGPU::exchangeGhosts
+                ArrayHandle<unsigned int> h_neigh_send_counts(m_neigh_send_counts,
+                                                              access_location::host,
+                                                              access_mode::read);
+                ArrayHandle<unsigned int> h_ghost_group_begin(m_ghost_group_begin,
+                                                              access_location::host,
+                                                              access_mode::readwrite);
+                ArrayHandle<unsigned int> h_ghost_group_end(m_ghost_group_end,
+                                                            access_location::host,
+                                                            access_mode::readwrite);
+
+                const unsigned int n_unique_neigh = m_gpu_comm.m_n_unique_neigh;
+                unsigned int n_send = 0;
+                for (unsigned int ineigh = 0; ineigh < n_unique_neigh; ++ineigh)
+                    {
+                    h_ghost_group_begin.data[ineigh + stage * n_unique_neigh] = n_send;
+                    n_send += h_neigh_send_counts.data[ineigh];
+                    h_ghost_group_end.data[ineigh + stage * n_unique_neigh] = n_send;
+                    }
+                n_send_ghost_groups_tot[stage] = n_send;
+                }
+
             // compute offset into ghost idx list
             idx_offs[stage] = 0;
             for (unsigned int i = 0; i < stage; ++i)
@@ -1395,15 +1462,8 @@ void CommunicatorGPU::GroupCommunicatorGPU<group_data>::exchangeGhostGroups(
                 ArrayHandle<unsigned int> d_ghost_group_neigh(m_ghost_group_neigh,
                                                               access_location::device,
                                                               access_mode::overwrite);
-                ArrayHandle<unsigned int> d_ghost_group_begin(m_ghost_group_begin,
-                                                              access_location::device,
-                                                              access_mode::overwrite);
-                ArrayHandle<unsigned int> d_ghost_group_end(m_ghost_group_end,
-                                                            access_location::device,
-                                                            access_mode::overwrite);
 
-                //! Fill ghost send list and compute start and end indices per unique neighbor in
-                //! list
+                //! Fill ghost send list sorted by unique neighbor
                 gpu_exchange_ghosts_make_indices(
                     m_gdata->getN() + m_gdata->getNGhosts(),
                     d_ghost_group_plan.data,
@@ -1414,8 +1474,6 @@ void CommunicatorGPU::GroupCommunicatorGPU<group_data>::exchangeGhostGroups(
                     d_ghost_scan.data,
                     d_ghost_group_idx_adj.data + idx_offs[stage],
                     d_ghost_group_neigh.data + idx_offs[stage],
-                    d_ghost_group_begin.data + stage * m_gpu_comm.m_n_unique_neigh,
-                    d_ghost_group_end.data + stage * m_gpu_comm.m_n_unique_neigh,
                     m_gpu_comm.m_n_unique_neigh,
                     n_send_ghost_groups_tot[stage],
                     m_gpu_comm.m_comm_mask[stage],
@@ -2069,6 +2127,12 @@ void CommunicatorGPU::exchangeGhosts()
 
     m_exec_conf->msg->notice(7) << "CommunicatorGPU: ghost exchange" << std::endl;
 
+    // the persistent ghost update requests refer to the old set of ghosts
+    freePersistentGhostRequests();
+
+    // the references for compressed ghost updates are recorded below
+    m_ghost_ref_flags.reset();
+
     // update the subscribed ghost layer width
     updateGhostWidth();
 
@@ -2090,6 +2154,7 @@ void CommunicatorGPU::exchangeGhosts()
 
     m_ghost_begin.resize(m_n_unique_neigh * m_num_stages);
     m_ghost_end.resize(m_n_unique_neigh * m_num_stages);
+    m_neigh_send_counts.resize(m_n_unique_neigh);
 
     m_idx_offs.resize(m_num_stages);
 
@@ -2178,21 +2243,49 @@ void CommunicatorGPU::exchangeGhosts()
             ArrayHandle<unsigned int> d_scan(m_scan,
                                              access_location::device,
                                              access_mode::overwrite);
+            ArrayHandle<unsigned int> d_neigh_send_counts(m_neigh_send_counts,
+                                                          access_location::device,
+                                                          access_mode::overwrite);
 
-            // count number of neighbors (total and per particle) the ghost ptls are sent to
-            m_n_send_ghosts_tot[stage]
-                = gpu_exchange_ghosts_count_neighbors(m_pdata->getN() + m_pdata->getNGhosts(),
-                                                      d_ghost_plan.data,
-                                                      d_adj_mask.data,
-                                                      d_neigh_counts.data,
-                                                      d_scan.data,
-                                                      m_n_unique_neigh,
-                                                      m_exec_conf->getCachedAllocator());
+            // count number of neighbors (per particle and per neighbor) the ghost ptls are sent to
+            gpu_exchange_ghosts_count_neighbors(m_pdata->getN() + m_pdata->getNGhosts(),
+                                                d_ghost_plan.data,
+                                                d_adj_mask.data,
+                                                d_neigh_counts.data,
+                                                d_scan.data,
+                                                d_neigh_send_counts.data,
+                                                m_n_unique_neigh,
+                                                m_exec_conf->getCachedAllocator());
 
             if (m_exec_conf->isCUDAErrorCheckingEnabled())
                 CHECK_CUDA_ERROR();
             }
 
+            {
+            // The send list is sorted by neighbor rank, and the unique neighbors are in ascending
+            // order, so the range of each neighbor in the send list follows from the counts. This
+            // is the only readback needed to size the send buffers and the messages. The begin and
+            // end indices are only used on the host.
+            ArrayHandle<unsigned int> h_neigh_send_counts(m_neigh_send_counts,
+                                                          access_location::host,
+                                                          access_mode::read);
+            ArrayHandle<unsigned int> h_ghost_begin(m_ghost_begin,
+                                                    access_location::host,
+                                                    access_mode::readwrite);
+            ArrayHandle<unsigned int> h_ghost_end(m_ghost_end,
+                                                  access_location::host,
+                                                  access_mode::readwrite);
+
+            unsigned int n_send = 0;
+            for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ++ineigh)
+                {
+                h_ghost_begin.data[ineigh + stage * m_n_unique_neigh] = n_send;
+                n_send += h_neigh_send_counts.data[ineigh];
+                h_ghost_end.data[ineigh + stage * m_n_unique_neigh] = n_send;
+                }
+            m_n_send_ghosts_tot[stage] = n_send;
+            }
+
         // compute offset into ghost idx list
         m_idx_offs[stage] = 0;
         for (unsigned int i = 0; i < stage; ++i)
@@ -2227,6 +2320,22 @@ void CommunicatorGPU::exchangeGhosts()
             m_orientation_ghost_sendbuf.resize(n_max);
             }
 
+        if (m_compress_ghost_updates)
+            {
+            // the references of all stages are kept
+            unsigned int n_ref = m_idx_offs[stage] + m_n_send_ghosts_tot[stage];
+            if (flags[comm_flag::position])
+                {
+                m_pos_ghost_sendbuf_compressed.resize(n_max);
+                m_pos_ghost_sendref.resize(n_ref);
+                }
+            if (flags[comm_flag::orientation])
+                {
+                m_orientation_ghost_sendbuf_compressed.resize(n_max);
+                m_orientation_ghost_sendref.resize(n_ref);
+                }
+            }
+
             {
             ArrayHandle<unsigned int> d_ghost_plan(m_ghost_plan,
                                                    access_location::device,
@@ -2252,14 +2361,8 @@ void CommunicatorGPU::exchangeGhosts()
             ArrayHandle<unsigned int> d_ghost_neigh(m_ghost_neigh,
                                                     access_location::device,
                                                     access_mode::overwrite);
-            ArrayHandle<unsigned int> d_ghost_begin(m_ghost_begin,
-                                                    access_location::device,
-                                                    access_mode::overwrite);
-            ArrayHandle<unsigned int> d_ghost_end(m_ghost_end,
-                                                  access_location::device,
-                                                  access_mode::overwrite);
 
-            //! Fill ghost send list and compute start and end indices per unique neighbor in list
+            //! Fill ghost send list sorted by unique neighbor
             gpu_exchange_ghosts_make_indices(m_pdata->getN() + m_pdata->getNGhosts(),
                                              d_ghost_plan.data,
                                              d_tag.data,
@@ -2269,8 +2372,6 @@ void CommunicatorGPU::exchangeGhosts()
                                              d_scan.data,
                                              d_ghost_idx_adj.data + m_idx_offs[stage],
                                              d_ghost_neigh.data + m_idx_offs[stage],
-                                             d_ghost_begin.data + stage * m_n_unique_neigh,
-                                             d_ghost_end.data + stage * m_n_unique_neigh,
                                              m_n_unique_neigh,
                                              m_n_send_ghosts_tot[stage],
                                              m_comm_mask[stage],
@@ -2380,6 +2481,34 @@ void CommunicatorGPU::exchangeGhosts()
                 CHECK_CUDA_ERROR();
             }
 
+        // keep the sent values as references for compressed ghost updates
+        if (m_compress_ghost_updates && flags[comm_flag::position])
+            {
+            ArrayHandle<Scalar4> d_pos_ghost_sendbuf(m_pos_ghost_sendbuf,
+                                                     access_location::device,
+                                                     access_mode::read);
+            ArrayHandle<Scalar4> d_pos_ghost_sendref(m_pos_ghost_sendref,
+                                                     access_location::device,
+                                                     access_mode::readwrite);
+            hipMemcpy(d_pos_ghost_sendref.data + m_idx_offs[stage],
+                      d_pos_ghost_sendbuf.data,
+                      sizeof(Scalar4) * m_n_send_ghosts_tot[stage],
+                      hipMemcpyDeviceToDevice);
+            }
+        if (m_compress_ghost_updates && flags[comm_flag::orientation])
+            {
+            ArrayHandle<Scalar4> d_orientation_ghost_sendbuf(m_orientation_ghost_sendbuf,
+                                                             access_location::device,
+                                                             access_mode::read);
+            ArrayHandle<Scalar4> d_orientation_ghost_sendref(m_orientation_ghost_sendref,
+                                                             access_location::device,
+                                                             access_mode::readwrite);
+            hipMemcpy(d_orientation_ghost_sendref.data + m_idx_offs[stage],
+                      d_orientation_ghost_sendbuf.data,
+                      sizeof(Scalar4) * m_n_send_ghosts_tot[stage],
+                      hipMemcpyDeviceToDevice);
+            }
+
         /*
          * Ghost particle communication
          */
@@ -2480,6 +2609,10 @@ void CommunicatorGPU::exchangeGhosts()
             m_diameter_ghost_recvbuf.resize(n_max);
         if (flags[comm_flag::orientation])
             m_orientation_ghost_recvbuf.resize(n_max);
+        if (m_compress_ghost_updates && flags[comm_flag::position])
+            m_pos_ghost_recvbuf_compressed.resize(n_max);
+        if (m_compress_ghost_updates && flags[comm_flag::orientation])
+            m_orientation_ghost_recvbuf_compressed.resize(n_max);
 
         // first ghost ptl index
         unsigned int first_idx = m_pdata->getN() + m_pdata->getNGhosts();
@@ -2917,6 +3050,44 @@ void CommunicatorGPU::exchangeGhosts()
 
     m_ghosts_added = m_pdata->getNGhosts();
 
+    // keep the received values as references for compressed ghost updates
+    if (m_compress_ghost_updates)
+        {
+        const unsigned int n_ghosts = m_pdata->getNGhosts();
+        if (flags[comm_flag::position])
+            {
+            m_pos_ghost_recvref.resize(n_ghosts);
+
+            ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                       access_location::device,
+                                       access_mode::read);
+            ArrayHandle<Scalar4> d_pos_ghost_recvref(m_pos_ghost_recvref,
+                                                     access_location::device,
+                                                     access_mode::overwrite);
+            hipMemcpy(d_pos_ghost_recvref.data,
+                      d_pos.data + m_pdata->getN(),
+                      sizeof(Scalar4) * n_ghosts,
+                      hipMemcpyDeviceToDevice);
+            m_ghost_ref_flags[comm_flag::position] = 1;
+            }
+        if (flags[comm_flag::orientation])
+            {
+            m_orientation_ghost_recvref.resize(n_ghosts);
+
+            ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
+                                               access_location::device,
+                                               access_mode::read);
+            ArrayHandle<Scalar4> d_orientation_ghost_recvref(m_orientation_ghost_recvref,
+                                                             access_location::device,
+                                                             access_mode::overwrite);
+            hipMemcpy(d_orientation_ghost_recvref.data,
+                      d_orientation.data + m_pdata->getN(),
+                      sizeof(Scalar4) * n_ghosts,
+                      hipMemcpyDeviceToDevice);
+            m_ghost_ref_flags[comm_flag::orientation] = 1;
+            }
+        }
+
     // exchange ghost constraints along with ghost particles
     m_constraint_comm.exchangeGhostGroups(m_ghost_plan);
 
@@ -2930,6 +3101,12 @@ void CommunicatorGPU::beginUpdateGhosts(uint64_t timestep)
 
     CommFlags flags = getFlags();
 
+    // compress only the fields with references from the last ghost exchange
+    m_compress_update_pos = m_compress_ghost_updates && flags[comm_flag::position]
+                            && m_ghost_ref_flags[comm_flag::position];
+    m_compress_update_orientation = m_compress_ghost_updates && flags[comm_flag::orientation]
+                                    && m_ghost_ref_flags[comm_flag::orientation];
+
     // main communication loop
     for (unsigned int stage = 0; stage < m_num_stages; ++stage)
         {
@@ -2954,15 +3131,23 @@ void CommunicatorGPU::beginUpdateGhosts(uint64_t timestep)
             ArrayHandle<unsigned int> d_tag_ghost_sendbuf(m_tag_ghost_sendbuf,
                                                           access_location::device,
                                                           access_mode::overwrite);
-            ArrayHandle<Scalar4> d_pos_ghost_sendbuf(m_pos_ghost_sendbuf,
-                                                     access_location::device,
-                                                     access_mode::overwrite);
             ArrayHandle<Scalar4> d_vel_ghost_sendbuf(m_vel_ghost_sendbuf,
                                                      access_location::device,
                                                      access_mode::overwrite);
-            ArrayHandle<Scalar4> d_orientation_ghost_sendbuf(m_orientation_ghost_sendbuf,
-                                                             access_location::device,
-                                                             access_mode::overwrite);
+
+            // leave the full precision buffers of compressed fields untouched so that they are
+            // not copied between host and device
+            std::unique_ptr<ArrayHandle<Scalar4>> d_pos_ghost_sendbuf;
+            if (!m_compress_update_pos)
+                d_pos_ghost_sendbuf.reset(new ArrayHandle<Scalar4>(m_pos_ghost_sendbuf,
+                                                                   access_location::device,
+                                                                   access_mode::overwrite));
+            std::unique_ptr<ArrayHandle<Scalar4>> d_orientation_ghost_sendbuf;
+            if (!m_compress_update_orientation)
+                d_orientation_ghost_sendbuf.reset(
+                    new ArrayHandle<Scalar4>(m_orientation_ghost_sendbuf,
+                                             access_location::device,
+                                             access_mode::overwrite));
 
             const BoxDim global_box = m_pdata->getGlobalBox();
             const Index3D& di = m_pdata->getDomainDecomposition()->getDomainIndexer();
@@ -2980,25 +3165,74 @@ void CommunicatorGPU::beginUpdateGhosts(uint64_t timestep)
                                      NULL,
                                      d_orientation.data,
                                      NULL,
-                                     d_pos_ghost_sendbuf.data,
+                                     d_pos_ghost_sendbuf ? d_pos_ghost_sendbuf->data : NULL,
                                      d_vel_ghost_sendbuf.data,
                                      NULL,
                                      NULL,
                                      NULL,
                                      NULL,
-                                     d_orientation_ghost_sendbuf.data,
+                                     d_orientation_ghost_sendbuf ? d_orientation_ghost_sendbuf->data
+                                                                 : NULL,
                                      false,
-                                     flags[comm_flag::position],
+                                     flags[comm_flag::position] && !m_compress_update_pos,
                                      flags[comm_flag::velocity],
                                      false,
                                      false,
                                      false,
                                      false,
-                                     flags[comm_flag::orientation],
+                                     flags[comm_flag::orientation]
+                                         && !m_compress_update_orientation,
                                      di,
                                      my_pos,
                                      global_box);
 
+            if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+
+            // pack the compressed fields as offsets from their references
+            if (m_compress_update_pos)
+                {
+                ArrayHandle<Scalar4> d_pos_ghost_sendref(m_pos_ghost_sendref,
+                                                         access_location::device,
+                                                         access_mode::read);
+                ArrayHandle<float4> d_pos_ghost_sendbuf_compressed(
+                    m_pos_ghost_sendbuf_compressed,
+                    access_location::device,
+                    access_mode::overwrite);
+
+                gpu_exchange_ghosts_pack_compressed(m_n_send_ghosts_tot[stage],
+                                                    d_ghost_idx_adj.data + m_idx_offs[stage],
+                                                    d_pos.data,
+                                                    d_pos_ghost_sendref.data + m_idx_offs[stage],
+                                                    d_pos_ghost_sendbuf_compressed.data,
+                                                    true,
+                                                    di,
+                                                    my_pos,
+                                                    global_box);
+                }
+
+            if (m_compress_update_orientation)
+                {
+                ArrayHandle<Scalar4> d_orientation_ghost_sendref(m_orientation_ghost_sendref,
+                                                                 access_location::device,
+                                                                 access_mode::read);
+                ArrayHandle<float4> d_orientation_ghost_sendbuf_compressed(
+                    m_orientation_ghost_sendbuf_compressed,
+                    access_location::device,
+                    access_mode::overwrite);
+
+                gpu_exchange_ghosts_pack_compressed(
+                    m_n_send_ghosts_tot[stage],
+                    d_ghost_idx_adj.data + m_idx_offs[stage],
+                    d_orientation.data,
+                    d_orientation_ghost_sendref.data + m_idx_offs[stage],
+                    d_orientation_ghost_sendbuf_compressed.data,
+                    false,
+                    di,
+                    my_pos,
+                    global_box);
+                }
+
             if (m_exec_conf->isCUDAErrorCheckingEnabled())
                 CHECK_CUDA_ERROR();
             }
@@ -3017,29 +3251,73 @@ void CommunicatorGPU::beginUpdateGhosts(uint64_t timestep)
             }
 
             {
-            unsigned int offs = 0;
-            // access particle data
-            // recv buffers
-            ArrayHandle<Scalar4> pos_ghost_recvbuf_handle(m_pos_ghost_recvbuf,
-                                                          access_location::host,
-                                                          access_mode::overwrite);
-            ArrayHandle<Scalar4> vel_ghost_recvbuf_handle(m_vel_ghost_recvbuf,
-                                                          access_location::host,
-                                                          access_mode::overwrite);
-            ArrayHandle<Scalar4> orientation_ghost_recvbuf_handle(m_orientation_ghost_recvbuf,
-                                                                  access_location::host,
-                                                                  access_mode::overwrite);
+            // collect the host buffers of the fields to send, the full precision buffers of
+            // compressed fields are not accessed
+            GhostUpdateBuffers buffers;
+            buffers.send[0] = flags[comm_flag::position];
+            buffers.send[1] = flags[comm_flag::velocity];
+            buffers.send[2] = flags[comm_flag::orientation];
+            if (m_compress_update_pos)
+                {
+                ArrayHandleAsync<float4> h_sendbuf(m_pos_ghost_sendbuf_compressed,
+                                                   access_location::host,
+                                                   access_mode::read);
+                ArrayHandle<float4> h_recvbuf(m_pos_ghost_recvbuf_compressed,
+                                              access_location::host,
+                                              access_mode::overwrite);
+                buffers.sendbuf[0] = (char*)h_sendbuf.data;
+                buffers.recvbuf[0] = (char*)h_recvbuf.data;
+                buffers.size[0] = sizeof(float4);
+                }
+            else
+                {
+                ArrayHandleAsync<Scalar4> h_sendbuf(m_pos_ghost_sendbuf,
+                                                    access_location::host,
+                                                    access_mode::read);
+                ArrayHandle<Scalar4> h_recvbuf(m_pos_ghost_recvbuf,
+                                               access_location::host,
+                                               access_mode::overwrite);
+                buffers.sendbuf[0] = (char*)h_sendbuf.data;
+                buffers.recvbuf[0] = (char*)h_recvbuf.data;
+                buffers.size[0] = sizeof(Scalar4);
+                }
 
-            // send buffers
-            ArrayHandleAsync<Scalar4> pos_ghost_sendbuf_handle(m_pos_ghost_sendbuf,
-                                                               access_location::host,
-                                                               access_mode::read);
-            ArrayHandleAsync<Scalar4> vel_ghost_sendbuf_handle(m_vel_ghost_sendbuf,
-                                                               access_location::host,
-                                                               access_mode::read);
-            ArrayHandleAsync<Scalar4> orientation_ghost_sendbuf_handle(m_orientation_ghost_sendbuf,
-                                                                       access_location::host,
-                                                                       access_mode::read);
+                {
+                ArrayHandleAsync<Scalar4> h_sendbuf(m_vel_ghost_sendbuf,
+                                                    access_location::host,
+                                                    access_mode::read);
+                ArrayHandle<Scalar4> h_recvbuf(m_vel_ghost_recvbuf,
+                                               access_location::host,
+                                               access_mode::overwrite);
+                buffers.sendbuf[1] = (char*)h_sendbuf.data;
+                buffers.recvbuf[1] = (char*)h_recvbuf.data;
+                buffers.size[1] = sizeof(Scalar4);
+                }
+
+            if (m_compress_update_orientation)
+                {
+                ArrayHandleAsync<float4> h_sendbuf(m_orientation_ghost_sendbuf_compressed,
+                                                   access_location::host,
+                                                   access_mode::read);
+                ArrayHandle<float4> h_recvbuf(m_orientation_ghost_recvbuf_compressed,
+                                              access_location::host,
+                                              access_mode::overwrite);
+                buffers.sendbuf[2] = (char*)h_sendbuf.data;
+                buffers.recvbuf[2] = (char*)h_recvbuf.data;
+                buffers.size[2] = sizeof(float4);
+                }
+            else
+                {
+                ArrayHandleAsync<Scalar4> h_sendbuf(m_orientation_ghost_sendbuf,
+                                                    access_location::host,
+                                                    access_mode::read);
+                ArrayHandle<Scalar4> h_recvbuf(m_orientation_ghost_recvbuf,
+                                               access_location::host,
+                                               access_mode::overwrite);
+                buffers.sendbuf[2] = (char*)h_sendbuf.data;
+                buffers.recvbuf[2] = (char*)h_recvbuf.data;
+                buffers.size[2] = sizeof(Scalar4);
+                }
 
             ArrayHandleAsync<unsigned int> h_unique_neighbors(m_unique_neighbors,
                                                               access_location::host,
@@ -3052,112 +3330,32 @@ void CommunicatorGPU::beginUpdateGhosts(uint64_t timestep)
             hipEventRecord(m_event);
             hipEventSynchronize(m_event);
 
-            // access send buffers
-            m_reqs.clear();
-            MPI_Request req;
-
-            unsigned int send_bytes = 0;
-            unsigned int recv_bytes = 0;
-
-            // loop over neighbors
-            for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ineigh++)
+            m_persistent_update = m_persistent_ghost_updates;
+            if (m_persistent_update)
                 {
-                // rank of neighbor processor
-                unsigned int neighbor = h_unique_neighbors.data[ineigh];
-
-                if (flags[comm_flag::position])
+                // the requests stay valid until the ghosts or buffers change
+                if (!m_persistent_reqs_valid || !(buffers == m_persistent_buffers))
                     {
-                    if (m_n_send_ghosts[stage][ineigh])
-                        {
-                        MPI_Isend(pos_ghost_sendbuf_handle.data
-                                      + h_ghost_begin.data[ineigh + stage * m_n_unique_neigh],
-                                  int(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4)),
-                                  MPI_BYTE,
-                                  neighbor,
-                                  2,
-                                  m_mpi_comm,
-                                  &req);
-                        m_reqs.push_back(req);
-                        }
-                    send_bytes += (unsigned int)(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4));
-
-                    if (m_n_recv_ghosts[stage][ineigh])
-                        {
-                        MPI_Irecv(pos_ghost_recvbuf_handle.data + m_ghost_offs[stage][ineigh]
-                                      + offs,
-                                  int(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4)),
-                                  MPI_BYTE,
-                                  neighbor,
-                                  2,
-                                  m_mpi_comm,
-                                  &req);
-                        m_reqs.push_back(req);
-                        }
-                    recv_bytes += (unsigned int)(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4));
+                    initPersistentGhostRequests(buffers,
+                                                h_unique_neighbors.data,
+                                                h_ghost_begin.data);
                     }
 
-                if (flags[comm_flag::velocity])
-                    {
-                    if (m_n_send_ghosts[stage][ineigh])
-                        {
-                        MPI_Isend(vel_ghost_sendbuf_handle.data
-                                      + h_ghost_begin.data[ineigh + stage * m_n_unique_neigh],
-                                  int(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4)),
-                                  MPI_BYTE,
-                                  neighbor,
-                                  3,
-                                  m_mpi_comm,
-                                  &req);
-                        m_reqs.push_back(req);
-                        }
-                    send_bytes += (unsigned int)(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4));
-
-                    if (m_n_recv_ghosts[stage][ineigh])
-                        {
-                        MPI_Irecv(vel_ghost_recvbuf_handle.data + m_ghost_offs[stage][ineigh]
-                                      + offs,
-                                  int(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4)),
-                                  MPI_BYTE,
-                                  neighbor,
-                                  3,
-                                  m_mpi_comm,
-                                  &req);
-                        m_reqs.push_back(req);
-                        }
-                    recv_bytes += (unsigned int)(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4));
-                    }
-
-                if (flags[comm_flag::orientation])
-                    {
-                    if (m_n_send_ghosts[stage][ineigh])
-                        {
-                        MPI_Isend(orientation_ghost_sendbuf_handle.data
-                                      + h_ghost_begin.data[ineigh + stage * m_n_unique_neigh],
-                                  int(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4)),
-                                  MPI_BYTE,
-                                  neighbor,
-                                  6,
-                                  m_mpi_comm,
-                                  &req);
-                        m_reqs.push_back(req);
-                        }
-                    send_bytes += (unsigned int)(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4));
-
-                    if (m_n_recv_ghosts[stage][ineigh])
-                        {
-                        MPI_Irecv(orientation_ghost_recvbuf_handle.data
-                                      + m_ghost_offs[stage][ineigh] + offs,
-                                  int(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4)),
-                                  MPI_BYTE,
-                                  neighbor,
-                                  6,
-                                  m_mpi_comm,
-                                  &req);
-                        m_reqs.push_back(req);
-                        }
-                    recv_bytes += (unsigned int)(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4));
-                    }
-                } // end neighbor loop
+                unsigned int begin = m_persistent_reqs_begin[stage];
+                unsigned int n_reqs = m_persistent_reqs_begin[stage + 1] - begin;
+                if (n_reqs)
+                    MPI_Startall(int(n_reqs), &m_persistent_reqs[begin]);
+                }
+            else
+                {
+                m_reqs.clear();
+                postGhostUpdateRequests(stage,
+                                        buffers,
+                                        h_unique_neighbors.data,
+                                        h_ghost_begin.data,
+                                        false,
+                                        m_reqs);
+                }
 
             if (m_num_stages == 1)
                 {
@@ -3167,66 +3365,13 @@ void CommunicatorGPU::beginUpdateGhosts(uint64_t timestep)
             else
                 {
                 // complete communication
-                std::vector<MPI_Status> stats(m_reqs.size());
-                MPI_Waitall((unsigned int)m_reqs.size(), &m_reqs.front(), &stats.front());
+                waitGhostUpdateRequests(stage);
                 }
             } // end ArrayHandle scope
 
         if (!m_comm_pending)
             {
-                // only unpack in non-CUDA MPI builds
-                {
-                // access receive buffers
-                ArrayHandle<Scalar4> d_pos_ghost_recvbuf(m_pos_ghost_recvbuf,
-                                                         access_location::device,
-                                                         access_mode::read);
-                ArrayHandle<Scalar4> d_vel_ghost_recvbuf(m_vel_ghost_recvbuf,
-                                                         access_location::device,
-                                                         access_mode::read);
-                ArrayHandle<Scalar4> d_orientation_ghost_recvbuf(m_orientation_ghost_recvbuf,
-                                                                 access_location::device,
-                                                                 access_mode::read);
-                // access particle data
-                ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
-                                           access_location::device,
-                                           access_mode::readwrite);
-                ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
-                                           access_location::device,
-                                           access_mode::readwrite);
-                ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
-                                                   access_location::device,
-                                                   access_mode::readwrite);
-
-                // copy recv buf into particle data
-                gpu_exchange_ghosts_copy_buf(m_n_recv_ghosts_tot[stage],
-                                             NULL,
-                                             d_pos_ghost_recvbuf.data,
-                                             d_vel_ghost_recvbuf.data,
-                                             NULL,
-                                             NULL,
-                                             NULL,
-                                             NULL,
-                                             d_orientation_ghost_recvbuf.data,
-                                             NULL,
-                                             d_pos.data + first_idx,
-                                             d_vel.data + first_idx,
-                                             NULL,
-                                             NULL,
-                                             NULL,
-                                             NULL,
-                                             d_orientation.data + first_idx,
-                                             false,
-                                             flags[comm_flag::position],
-                                             flags[comm_flag::velocity],
-                                             false,
-                                             false,
-                                             false,
-                                             false,
-                                             flags[comm_flag::orientation]);
-
-                if (m_exec_conf->isCUDAErrorCheckingEnabled())
-                    CHECK_CUDA_ERROR();
-                }
+            unpackGhostUpdate(stage, first_idx, flags);
             }
         } // end main communication loop
     }
@@ -3242,68 +3387,308 @@ void CommunicatorGPU::finishUpdateGhosts(uint64_t timestep)
         m_comm_pending = false;
 
         // complete communication
-        std::vector<MPI_Status> stats(m_reqs.size());
-        MPI_Waitall((unsigned int)m_reqs.size(), &m_reqs.front(), &stats.front());
+        waitGhostUpdateRequests(0);
 
         // only unpack in non-CUDA-MPI builds
         assert(m_num_stages == 1);
-        unsigned int stage = 0;
-        unsigned int first_idx = m_pdata->getN();
-        CommFlags flags = m_last_flags;
+        unpackGhostUpdate(0, m_pdata->getN(), m_last_flags);
+        }
+    }
 
-            {
-            // access receive buffers
-            ArrayHandle<Scalar4> d_pos_ghost_recvbuf(m_pos_ghost_recvbuf,
-                                                     access_location::device,
-                                                     access_mode::read);
-            ArrayHandle<Scalar4> d_vel_ghost_recvbuf(m_vel_ghost_recvbuf,
-                                                     access_location::device,
-                                                     access_mode::read);
-            ArrayHandle<Scalar4> d_orientation_ghost_recvbuf(m_orientation_ghost_recvbuf,
-                                                             access_location::device,
-                                                             access_mode::read);
-            // access particle data
-            ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
-                                       access_location::device,
-                                       access_mode::readwrite);
-            ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+/*! \param stage The communication stage
+    \param first_idx Index of the first ghost received in this stage
+    \param flags Fields sent by the ghost update
+*/
+void CommunicatorGPU::unpackGhostUpdate(unsigned int stage,
+                                        unsigned int first_idx,
+                                        const CommFlags& flags)
+    {
+    // access receive buffers, the full precision buffers of compressed fields hold no data
+    ArrayHandle<Scalar4> d_vel_ghost_recvbuf(m_vel_ghost_recvbuf,
+                                             access_location::device,
+                                             access_mode::read);
+    std::unique_ptr<ArrayHandle<Scalar4>> d_pos_ghost_recvbuf;
+    if (!m_compress_update_pos)
+        d_pos_ghost_recvbuf.reset(new ArrayHandle<Scalar4>(m_pos_ghost_recvbuf,
+                                                           access_location::device,
+                                                           access_mode::read));
+    std::unique_ptr<ArrayHandle<Scalar4>> d_orientation_ghost_recvbuf;
+    if (!m_compress_update_orientation)
+        d_orientation_ghost_recvbuf.reset(new ArrayHandle<Scalar4>(m_orientation_ghost_recvbuf,
+                                                                   access_location::device,
+                                                                   access_mode::read));
+    // access particle data
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                               access_location::device,
+                               access_mode::readwrite);
+    ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                               access_location::device,
+                               access_mode::readwrite);
+    ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
                                        access_location::device,
                                        access_mode::readwrite);
-            ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
-                                               access_location::device,
-                                               access_mode::readwrite);
 
-            // copy recv buf into particle data
-            gpu_exchange_ghosts_copy_buf(m_n_recv_ghosts_tot[stage],
-                                         NULL,
-                                         d_pos_ghost_recvbuf.data,
-                                         d_vel_ghost_recvbuf.data,
-                                         NULL,
-                                         NULL,
-                                         NULL,
-                                         NULL,
-                                         d_orientation_ghost_recvbuf.data,
-                                         NULL,
-                                         d_pos.data + first_idx,
-                                         d_vel.data + first_idx,
-                                         NULL,
-                                         NULL,
-                                         NULL,
-                                         NULL,
-                                         d_orientation.data + first_idx,
-                                         false,
-                                         flags[comm_flag::position],
-                                         flags[comm_flag::velocity],
-                                         false,
-                                         false,
-                                         false,
-                                         false,
-                                         flags[comm_flag::orientation]);
+    // copy recv buf into particle data
+    gpu_exchange_ghosts_copy_buf(m_n_recv_ghosts_tot[stage],
+                                 NULL,
+                                 d_pos_ghost_recvbuf ? d_pos_ghost_recvbuf->data : NULL,
+                                 d_vel_ghost_recvbuf.data,
+                                 NULL,
+                                 NULL,
+                                 NULL,
+                                 NULL,
+                                 d_orientation_ghost_recvbuf ? d_orientation_ghost_recvbuf->data
+                                                             : NULL,
+                                 NULL,
+                                 d_pos.data + first_idx,
+                                 d_vel.data + first_idx,
+                                 NULL,
+                                 NULL,
+                                 NULL,
+                                 NULL,
+                                 d_orientation.data + first_idx,
+                                 false,
+                                 flags[comm_flag::position] && !m_compress_update_pos,
+                                 flags[comm_flag::velocity],
+                                 false,
+                                 false,
+                                 false,
+                                 false,
+                                 flags[comm_flag::orientation] && !m_compress_update_orientation);
+
+    // the references are indexed by ghost
+    const unsigned int first_ghost = first_idx - m_pdata->getN();
+
+    if (m_compress_update_pos)
+        {
+        ArrayHandle<float4> d_pos_ghost_recvbuf_compressed(m_pos_ghost_recvbuf_compressed,
+                                                           access_location::device,
+                                                           access_mode::read);
+        ArrayHandle<Scalar4> d_pos_ghost_recvref(m_pos_ghost_recvref,
+                                                 access_location::device,
+                                                 access_mode::read);
 
-            if (m_exec_conf->isCUDAErrorCheckingEnabled())
-                CHECK_CUDA_ERROR();
+        gpu_exchange_ghosts_decompress(m_n_recv_ghosts_tot[stage],
+                                       d_pos_ghost_recvbuf_compressed.data,
+                                       d_pos_ghost_recvref.data + first_ghost,
+                                       d_pos.data + first_idx,
+                                       true);
+        }
+
+    if (m_compress_update_orientation)
+        {
+        ArrayHandle<float4> d_orientation_ghost_recvbuf_compressed(
+            m_orientation_ghost_recvbuf_compressed,
+            access_location::device,
+            access_mode::read);
+        ArrayHandle<Scalar4> d_orientation_ghost_recvref(m_orientation_ghost_recvref,
+                                                         access_location::device,
+                                                         access_mode::read);
+
+        gpu_exchange_ghosts_decompress(m_n_recv_ghosts_tot[stage],
+                                       d_orientation_ghost_recvbuf_compressed.data,
+                                       d_orientation_ghost_recvref.data + first_ghost,
+                                       d_orientation.data + first_idx,
+                                       false);
+        }
+
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    }
+
+/*! \param stage The communication stage
+    \param buffers Host pointers to the buffers of the fields to send
+    \param h_unique_neighbors Ranks of the unique neighbors
+    \param h_ghost_begin Begin index in the send buffers for every stage and neighbor
+    \param persistent True to initialize persistent requests instead of posting them
+    \param reqs Vector to append the requests to
+*/
+void CommunicatorGPU::postGhostUpdateRequests(unsigned int stage,
+                                              const GhostUpdateBuffers& buffers,
+                                              const unsigned int* h_unique_neighbors,
+                                              const unsigned int* h_ghost_begin,
+                                              bool persistent,
+                                              std::vector<MPI_Request>& reqs)
+    {
+    const int field_tag[3] = {2, 3, 6};
+
+    // loop over neighbors
+    for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ineigh++)
+        {
+        // rank of neighbor processor
+        unsigned int neighbor = h_unique_neighbors[ineigh];
+
+        for (unsigned int field = 0; field < 3; ++field)
+            {
+            if (!buffers.send[field])
+                continue;
+
+            const unsigned int size = buffers.size[field];
+            MPI_Request req;
+            if (m_n_send_ghosts[stage][ineigh])
+                {
+                char* sendbuf = buffers.sendbuf[field]
+                                + size * h_ghost_begin[ineigh + stage * m_n_unique_neigh];
+                int count = int(m_n_send_ghosts[stage][ineigh] * size);
+                if (persistent)
+                    MPI_Send_init(sendbuf,
+                                  count,
+                                  MPI_BYTE,
+                                  neighbor,
+                                  field_tag[field],
+                                  m_mpi_comm,
+                                  &req);
+                else
+                    MPI_Isend(sendbuf,
+                              count,
+                              MPI_BYTE,
+                              neighbor,
+                              field_tag[field],
+                              m_mpi_comm,
+                              &req);
+                reqs.push_back(req);
+                }
+
+            if (m_n_recv_ghosts[stage][ineigh])
+                {
+                char* recvbuf = buffers.recvbuf[field] + size * m_ghost_offs[stage][ineigh];
+                int count = int(m_n_recv_ghosts[stage][ineigh] * size);
+                if (persistent)
+                    MPI_Recv_init(recvbuf,
+                                  count,
+                                  MPI_BYTE,
+                                  neighbor,
+                                  field_tag[field],
+                                  m_mpi_comm,
+                                  &req);
+                else
+                    MPI_Irecv(recvbuf,
+                              count,
+                              MPI_BYTE,
+                              neighbor,
+                              field_tag[field],
+                              m_mpi_comm,
+                              &req);
+                reqs.push_back(req);
+                }
             }
+        } // end neighbor loop
+    }
+
+/*! \param buffers Host pointers to the buffers of the fields to send
+    \param h_unique_neighbors Ranks of the unique neighbors
+    \param h_ghost_begin Begin index in the send buffers for every stage and neighbor
+
+    Persistent requests are initialized in the same order in which beginUpdateGhosts() posts
+    ordinary ones, so the two modes match messages identically.
+*/
+void CommunicatorGPU::initPersistentGhostRequests(const GhostUpdateBuffers& buffers,
+                                                  const unsigned int* h_unique_neighbors,
+                                                  const unsigned int* h_ghost_begin)
+    {
+    freePersistentGhostRequests();
+
+    m_exec_conf->msg->notice(7) << "CommunicatorGPU: initializing persistent ghost update"
+                                << std::endl;
+
+    m_persistent_reqs_begin.resize(m_num_stages + 1);
+    for (unsigned int stage = 0; stage < m_num_stages; ++stage)
+        {
+        m_persistent_reqs_begin[stage] = (unsigned int)m_persistent_reqs.size();
+        postGhostUpdateRequests(stage,
+                                buffers,
+                                h_unique_neighbors,
+                                h_ghost_begin,
+                                true,
+                                m_persistent_reqs);
         }
+    m_persistent_reqs_begin[m_num_stages] = (unsigned int)m_persistent_reqs.size();
+
+    m_persistent_buffers = buffers;
+    m_persistent_reqs_valid = true;
+    }
+
+/*! The requests must not be active.
+ */
+void CommunicatorGPU::freePersistentGhostRequests()
+    {
+    assert(!(m_comm_pending && m_persistent_update));
+
+    for (auto& req : m_persistent_reqs)
+        {
+        MPI_Request_free(&req);
+        }
+    m_persistent_reqs.clear();
+    m_persistent_reqs_begin.clear();
+    m_persistent_reqs_valid = false;
+    }
+
+/*! \param stage The communication stage
+ */
+void CommunicatorGPU::waitGhostUpdateRequests(unsigned int stage)
+    {
+    if (m_persistent_update)
+        {
+        unsigned int begin = m_persistent_reqs_begin[stage];
+        unsigned int n_reqs = m_persistent_reqs_begin[stage + 1] - begin;
+        if (n_reqs)
+            MPI_Waitall(int(n_reqs), &m_persistent_reqs[begin], MPI_STATUSES_IGNORE);
+        }
+    else
+        {
+        std::vector<MPI_Status> stats(m_reqs.size());
+        MPI_Waitall((unsigned int)m_reqs.size(), &m_reqs.front(), &stats.front());
+        }
+    }
+
+/*! \param lambda Ratio of the current to the last exchanged nearest plane distances of the box
+    \param maxsq Square of the maximum displacement
+    \returns true when a local particle has moved at least sqrt(\a maxsq) since the last exchange
+*/
+bool CommunicatorGPU::checkExchangeDisplacements(const Scalar3& lambda, Scalar maxsq)
+    {
+        {
+        ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+        ArrayHandle<Scalar4> d_exchange_pos(m_exchange_pos,
+                                            access_location::device,
+                                            access_mode::read);
+        ArrayHandle<unsigned int> d_exchange_flags(m_exchange_flags,
+                                                   access_location::device,
+                                                   access_mode::readwrite);
+
+        gpu_check_exchange_displacements(d_exchange_flags.data,
+                                         d_pos.data,
+                                         d_exchange_pos.data,
+                                         m_pdata->getN(),
+                                         m_pdata->getBox(),
+                                         lambda,
+                                         maxsq,
+                                         ++m_exchange_checkn);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+    ArrayHandle<unsigned int> h_exchange_flags(m_exchange_flags,
+                                               access_location::host,
+                                               access_mode::read);
+    return *h_exchange_flags.data == m_exchange_checkn;
+    }
+
+void CommunicatorGPU::setExchangePositions()
+    {
+    m_exchange_pos.resize(m_pdata->getN());
+    m_exchange_L = m_pdata->getGlobalBox().getNearestPlaneDistance();
+
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_exchange_pos(m_exchange_pos,
+                                        access_location::device,
+                                        access_mode::overwrite);
+    hipMemcpy(d_exchange_pos.data,
+              d_pos.data,
+              sizeof(Scalar4) * m_pdata->getN(),
+              hipMemcpyDeviceToDevice);
     }
 
 //! Perform ghosts update
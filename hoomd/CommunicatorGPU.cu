@@ -500,29 +500,48 @@ void gpu_make_ghost_group_exchange_plan(unsigned int* d_ghost_group_plan,
     }
 
 //! Apply adjacency masks to plan and return number of matching neighbors
+/*! The number of particles sent to each neighbor is also accumulated in shared memory and added
+    to \a d_neigh_send_counts once per block, which needs \a nneigh unsigned ints of shared memory.
+*/
 __global__ void gpu_ghost_neighbor_counts(unsigned int N,
                                           const unsigned int* d_ghost_plan,
                                           unsigned int* d_counts,
+                                          unsigned int* d_neigh_send_counts,
                                           const unsigned int* d_adj,
                                           unsigned int nneigh)
     {
+    extern __shared__ unsigned int s_neigh_send_counts[];
+    for (unsigned int i = threadIdx.x; i < nneigh; i += blockDim.x)
+        s_neigh_send_counts[i] = 0;
+    __syncthreads();
+
     unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
-    if (idx >= N)
-        return;
+    if (idx < N)
+        {
+        unsigned int plan = d_ghost_plan[idx];
+        unsigned int count = 0;
+        unsigned int mask = get_direction_mask(plan);
 
-    unsigned int plan = d_ghost_plan[idx];
-    unsigned int count = 0;
-    unsigned int mask = get_direction_mask(plan);
+        for (unsigned int i = 0; i < nneigh; i++)
+            {
+            unsigned int adj = d_adj[i];
 
-    for (unsigned int i = 0; i < nneigh; i++)
-        {
-        unsigned int adj = d_adj[i];
+            if (adj & mask)
+                {
+                count++;
+                atomicAdd(&s_neigh_send_counts[i], 1);
+                }
+            }
 
-        if (adj & mask)
-            count++;
+        d_counts[idx] = count;
         }
+    __syncthreads();
 
-    d_counts[idx] = count;
+    for (unsigned int i = threadIdx.x; i < nneigh; i += blockDim.x)
+        {
+        if (s_neigh_send_counts[i])
+            atomicAdd(&d_neigh_send_counts[i], s_neigh_send_counts[i]);
+        }
     };
 
 //! Apply adjacency masks to plan and integer and return nth matching neighbor rank
@@ -559,16 +578,21 @@ struct get_neighbor_rank_n
         }
     };
 
-unsigned int gpu_exchange_ghosts_count_neighbors(unsigned int N,
-                                                 const unsigned int* d_ghost_plan,
-                                                 const unsigned int* d_adj,
-                                                 unsigned int* d_counts,
-                                                 unsigned int* d_scan,
-                                                 unsigned int nneigh,
-                                                 CachedAllocator& alloc)
+/*! The total number of ghosts to send follows from \a d_neigh_send_counts, so it is not reduced
+    and copied to the host here. The caller reads back the counts once to size the send buffers.
+*/
+void gpu_exchange_ghosts_count_neighbors(unsigned int N,
+                                         const unsigned int* d_ghost_plan,
+                                         const unsigned int* d_adj,
+                                         unsigned int* d_counts,
+                                         unsigned int* d_scan,
+                                         unsigned int* d_neigh_send_counts,
+                                         unsigned int nneigh,
+                                         CachedAllocator& alloc)
     {
+    hipMemsetAsync(d_neigh_send_counts, 0, sizeof(unsigned int) * nneigh);
     if (!N)
-        return 0;
+        return;
 
     assert(d_ghost_plan);
     assert(d_adj);
@@ -581,16 +605,15 @@ unsigned int gpu_exchange_ghosts_count_neighbors(unsigned int N,
     hipLaunchKernelGGL(gpu_ghost_neighbor_counts,
                        dim3(n_blocks),
                        dim3(block_size),
-                       0,
+                       sizeof(unsigned int) * nneigh,
                        0,
                        N,
                        d_ghost_plan,
                        d_counts,
+                       d_neigh_send_counts,
                        d_adj,
                        nneigh);
 
-    // determine output size
-    unsigned int total;
     assert(d_scan);
 
     void* d_temp_storage = NULL;
@@ -602,21 +625,6 @@ unsigned int gpu_exchange_ghosts_count_neighbors(unsigned int N,
     d_temp_storage = alloc.getTemporaryBuffer<char>(temp_storage_bytes);
     hipcub::DeviceScan::ExclusiveSum(d_temp_storage, temp_storage_bytes, d_counts, d_scan, N);
     alloc.deallocate((char*)d_temp_storage);
-
-    // determine total number of ghosts
-    d_temp_storage = NULL;
-    temp_storage_bytes = 0;
-    unsigned int* d_total = alloc.getTemporaryBuffer<unsigned int>(1);
-    assert(d_total);
-    hipcub::DeviceReduce::Sum(d_temp_storage, temp_storage_bytes, d_counts, d_total, N);
-    d_temp_storage = alloc.allocate(temp_storage_bytes);
-    hipcub::DeviceReduce::Sum(d_temp_storage, temp_storage_bytes, d_counts, d_total, N);
-    alloc.deallocate((char*)d_temp_storage);
-
-    hipMemcpy(&total, d_total, sizeof(unsigned int), hipMemcpyDeviceToHost);
-    alloc.deallocate((char*)d_total);
-
-    return total;
     }
 
 __global__ void gpu_expand_neighbors_kernel(const unsigned int n_out,
@@ -656,8 +664,6 @@ void gpu_exchange_ghosts_make_indices(unsigned int N,
                                       const unsigned int* d_scan,
                                       uint2* d_ghost_idx_adj,
                                       unsigned int* d_ghost_neigh,
-                                      unsigned int* d_ghost_begin,
-                                      unsigned int* d_ghost_end,
                                       unsigned int n_unique_neigh,
                                       unsigned int n_out,
                                       unsigned int mask,
@@ -671,8 +677,6 @@ void gpu_exchange_ghosts_make_indices(unsigned int N,
     assert(d_scan);
     assert(d_ghost_idx_adj);
     assert(d_ghost_neigh);
-    assert(d_ghost_begin);
-    assert(d_ghost_end);
 
     /*
      * expand each tag by the number of neighbors to send the corresponding ptl to
@@ -751,27 +755,6 @@ void gpu_exchange_ghosts_make_indices(unsigned int N,
                             ghost_neigh,
                             ghost_neigh + n_out,
                             ghost_idx_adj);
-
-        thrust::device_ptr<const unsigned int> unique_neighbors(d_unique_neighbors);
-        thrust::device_ptr<unsigned int> ghost_begin(d_ghost_begin);
-        thrust::device_ptr<unsigned int> ghost_end(d_ghost_end);
-
-        thrust::lower_bound(ghost_neigh,
-                            ghost_neigh + n_out,
-                            unique_neighbors,
-                            unique_neighbors + n_unique_neigh,
-                            ghost_begin);
-
-        thrust::upper_bound(ghost_neigh,
-                            ghost_neigh + n_out,
-                            unique_neighbors,
-                            unique_neighbors + n_unique_neigh,
-                            ghost_end);
-        }
-    else
-        {
-        hipMemset(d_ghost_begin, 0, sizeof(unsigned int) * n_unique_neigh);
-        hipMemset(d_ghost_end, 0, sizeof(unsigned int) * n_unique_neigh);
         }
     }
 
@@ -786,28 +769,18 @@ gpu_pack_kernel(unsigned int n_out, const uint2* d_ghost_idx_adj, const T* in, T
     out[buf_idx] = in[idx];
     }
 
-__global__ void gpu_pack_wrap_kernel(unsigned int n_out,
-                                     const uint2* d_ghost_idx_adj,
-                                     const Scalar4* d_postype,
-                                     const int3* d_img,
-                                     Scalar4* out_pos,
-                                     int3* out_img,
-                                     Index3D di,
-                                     uint3 my_pos,
-                                     BoxDim box)
+//! Get the periodic image shift of a ghost sent along the given adjacency
+/*! \param adj Adjacency bitfield of the ghost
+    \param di Domain indexer
+    \param my_pos Position of this rank in the domain grid
+    \param periodic Set to 1 along the directions that cross the global boundary
+    \param wrap Set to the image shift along the directions that cross the global boundary
+*/
+__device__ inline void
+get_ghost_wrap(unsigned int adj, const Index3D& di, uint3 my_pos, uchar3& periodic, char3& wrap)
     {
-    unsigned int buf_idx = blockIdx.x * blockDim.x + threadIdx.x;
-    if (buf_idx >= n_out)
-        return;
-
-    uint2 idx_adj = d_ghost_idx_adj[buf_idx];
-    unsigned int idx = idx_adj.x;
-    unsigned int adj = idx_adj.y;
-
-    // get direction triple from adjacency element
-    // wrap
-    uchar3 periodic = make_uchar3(0, 0, 0);
-    char3 wrap = make_char3(0, 0, 0);
+    periodic = make_uchar3(0, 0, 0);
+    wrap = make_char3(0, 0, 0);
 
     const unsigned int mask_east
         = 1 << 2 | 1 << 5 | 1 << 8 | 1 << 11 | 1 << 14 | 1 << 17 | 1 << 20 | 1 << 23 | 1 << 26;
@@ -858,6 +831,31 @@ __global__ void gpu_pack_wrap_kernel(unsigned int n_out,
             periodic.z = 1;
             }
         }
+    }
+
+__global__ void gpu_pack_wrap_kernel(unsigned int n_out,
+                                     const uint2* d_ghost_idx_adj,
+                                     const Scalar4* d_postype,
+                                     const int3* d_img,
+                                     Scalar4* out_pos,
+                                     int3* out_img,
+                                     Index3D di,
+                                     uint3 my_pos,
+                                     BoxDim box)
+    {
+    unsigned int buf_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (buf_idx >= n_out)
+        return;
+
+    uint2 idx_adj = d_ghost_idx_adj[buf_idx];
+    unsigned int idx = idx_adj.x;
+    unsigned int adj = idx_adj.y;
+
+    // get direction triple from adjacency element
+    // wrap
+    uchar3 periodic;
+    char3 wrap;
+    get_ghost_wrap(adj, di, my_pos, periodic, wrap);
 
     box.setPeriodic(periodic);
     int3 img = make_int3(0, 0, 0);
@@ -1264,6 +1262,200 @@ void gpu_exchange_ghosts_copy_buf(unsigned int n_recv,
         }
     }
 
+//! Kernel to pack ghost positions or orientations as offsets from reference values
+/*! \param n_out Number of ghosts to pack
+    \param d_ghost_idx_adj Indices and adjacencies of the ghosts
+    \param d_in Positions or orientations of all particles
+    \param d_ref Reference values of the ghosts
+    \param d_out Compressed values
+    \param postype True for positions, which are wrapped like in gpu_pack_wrap_kernel and whose
+           w component (the type) is sent as is
+    \param di Domain indexer
+    \param my_pos Position of this rank in the domain grid
+    \param box Global box
+*/
+__global__ void gpu_exchange_ghosts_pack_compressed_kernel(unsigned int n_out,
+                                                           const uint2* d_ghost_idx_adj,
+                                                           const Scalar4* d_in,
+                                                           const Scalar4* d_ref,
+                                                           float4* d_out,
+                                                           bool postype,
+                                                           Index3D di,
+                                                           uint3 my_pos,
+                                                           BoxDim box)
+    {
+    unsigned int buf_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (buf_idx >= n_out)
+        return;
+
+    uint2 idx_adj = d_ghost_idx_adj[buf_idx];
+    Scalar4 in = d_in[idx_adj.x];
+    Scalar4 ref = d_ref[buf_idx];
+
+    if (postype)
+        {
+        uchar3 periodic;
+        char3 wrap;
+        get_ghost_wrap(idx_adj.y, di, my_pos, periodic, wrap);
+        box.setPeriodic(periodic);
+        int3 img = make_int3(0, 0, 0);
+        box.wrap(in, img, wrap);
+        }
+
+    float4 out;
+    out.x = float(in.x - ref.x);
+    out.y = float(in.y - ref.y);
+    out.z = float(in.z - ref.z);
+    out.w = postype ? __int_as_float(__scalar_as_int(in.w)) : float(in.w - ref.w);
+    d_out[buf_idx] = out;
+    }
+
+//! Kernel to reconstruct ghost positions or orientations
+/*! \param n Number of elements
+    \param d_in Compressed values
+    \param d_ref Reference values
+    \param d_out Reconstructed values
+    \param postype True if the values are positions, whose w component (the type) is sent as is
+*/
+__global__ void gpu_exchange_ghosts_decompress_kernel(unsigned int n,
+                                                      const float4* d_in,
+                                                      const Scalar4* d_ref,
+                                                      Scalar4* d_out,
+                                                      bool postype)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= n)
+        return;
+
+    float4 in = d_in[idx];
+    Scalar4 ref = d_ref[idx];
+
+    Scalar4 out;
+    out.x = ref.x + Scalar(in.x);
+    out.y = ref.y + Scalar(in.y);
+    out.z = ref.z + Scalar(in.z);
+    out.w = postype ? __int_as_scalar(__float_as_int(in.w)) : ref.w + Scalar(in.w);
+    d_out[idx] = out;
+    }
+
+void gpu_exchange_ghosts_pack_compressed(unsigned int n_out,
+                                         const uint2* d_ghost_idx_adj,
+                                         const Scalar4* d_in,
+                                         const Scalar4* d_ref,
+                                         float4* d_out,
+                                         bool postype,
+                                         const Index3D& di,
+                                         uint3 my_pos,
+                                         const BoxDim& box)
+    {
+    assert(d_ghost_idx_adj);
+    assert(d_in);
+    assert(d_ref);
+    assert(d_out);
+
+    unsigned int block_size = 256;
+    unsigned int n_blocks = n_out / block_size + 1;
+    hipLaunchKernelGGL(gpu_exchange_ghosts_pack_compressed_kernel,
+                       dim3(n_blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       n_out,
+                       d_ghost_idx_adj,
+                       d_in,
+                       d_ref,
+                       d_out,
+                       postype,
+                       di,
+                       my_pos,
+                       box);
+    }
+
+void gpu_exchange_ghosts_decompress(unsigned int n,
+                                    const float4* d_in,
+                                    const Scalar4* d_ref,
+                                    Scalar4* d_out,
+                                    bool postype)
+    {
+    assert(d_in);
+    assert(d_ref);
+    assert(d_out);
+
+    unsigned int block_size = 256;
+    unsigned int n_blocks = n / block_size + 1;
+    hipLaunchKernelGGL(gpu_exchange_ghosts_decompress_kernel,
+                       dim3(n_blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       n,
+                       d_in,
+                       d_ref,
+                       d_out,
+                       postype);
+    }
+
+/*! \param d_result Set to \a checkn when a particle has moved too far
+    \param d_pos Current particle positions
+    \param d_exchange_pos Particle positions at the last ghost exchange
+    \param N Number of local particles
+    \param box Local box
+    \param lambda Ratio of the current to the last exchanged nearest plane distances of the box
+    \param maxsq Square of the maximum displacement
+    \param checkn Value that identifies this check
+*/
+__global__ void gpu_check_exchange_displacements_kernel(unsigned int* d_result,
+                                                        const Scalar4* d_pos,
+                                                        const Scalar4* d_exchange_pos,
+                                                        unsigned int N,
+                                                        const BoxDim box,
+                                                        Scalar3 lambda,
+                                                        Scalar maxsq,
+                                                        unsigned int checkn)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    Scalar4 pos = d_pos[idx];
+    Scalar4 exchange_pos = d_exchange_pos[idx];
+    Scalar3 dx = make_scalar3(pos.x - lambda.x * exchange_pos.x,
+                              pos.y - lambda.y * exchange_pos.y,
+                              pos.z - lambda.z * exchange_pos.z);
+    dx = box.minImage(dx);
+
+    if (dot(dx, dx) >= maxsq)
+        atomicMax(d_result, checkn);
+    }
+
+void gpu_check_exchange_displacements(unsigned int* d_result,
+                                      const Scalar4* d_pos,
+                                      const Scalar4* d_exchange_pos,
+                                      unsigned int N,
+                                      const BoxDim& box,
+                                      Scalar3 lambda,
+                                      Scalar maxsq,
+                                      unsigned int checkn)
+    {
+    assert(d_result);
+
+    unsigned int block_size = 256;
+    unsigned int n_blocks = N / block_size + 1;
+    hipLaunchKernelGGL(gpu_check_exchange_displacements_kernel,
+                       dim3(n_blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       d_result,
+                       d_pos,
+                       d_exchange_pos,
+                       N,
+                       box,
+                       lambda,
+                       maxsq,
+                       checkn);
+    }
+
 void gpu_exchange_ghosts_copy_netforce_buf(unsigned int n_recv,
                                            const Scalar4* d_netforce_recvbuf,
                                            Scalar4* d_netforce)
@@ -89,14 +89,15 @@ void gpu_make_ghost_exchange_plan(unsigned int* d_plan,
                                   unsigned int ntypes,
                                   unsigned int mask);
 
-//! Get neighbor counts
-unsigned int gpu_exchange_ghosts_count_neighbors(unsigned int N,
-                                                 const unsigned int* d_ghost_plan,
-                                                 const unsigned int* d_adj,
-                                                 unsigned int* d_counts,
-                                                 unsigned int* d_scan,
-                                                 unsigned int nneigh,
-                                                 CachedAllocator& alloc);
+//! Get neighbor counts per particle and per neighbor
+void gpu_exchange_ghosts_count_neighbors(unsigned int N,
+                                         const unsigned int* d_ghost_plan,
+                                         const unsigned int* d_adj,
+                                         unsigned int* d_counts,
+                                         unsigned int* d_scan,
+                                         unsigned int* d_neigh_send_counts,
+                                         unsigned int nneigh,
+                                         CachedAllocator& alloc);
 
 //! Construct tag lists per ghost particle
 void gpu_exchange_ghosts_make_indices(unsigned int N,
@@ -108,8 +109,6 @@ void gpu_exchange_ghosts_make_indices(unsigned int N,
                                       const unsigned int* d_scan,
                                       uint2* d_ghost_idx,
                                       unsigned int* d_ghost_neigh,
-                                      unsigned int* d_ghost_begin,
-                                      unsigned int* d_ghost_end,
                                       unsigned int n_unique_neigh,
                                       unsigned int n_out,
                                       unsigned int mask,
@@ -173,6 +172,34 @@ void gpu_exchange_ghosts_copy_buf(unsigned int n_recv,
                                   bool send_image,
                                   bool send_orientation);
 
+//! Pack ghost positions or orientations as single precision offsets from reference values
+void gpu_exchange_ghosts_pack_compressed(unsigned int n_out,
+                                         const uint2* d_ghost_idx_adj,
+                                         const Scalar4* d_in,
+                                         const Scalar4* d_ref,
+                                         float4* d_out,
+                                         bool postype,
+                                         const Index3D& di,
+                                         uint3 my_pos,
+                                         const BoxDim& box);
+
+//! Reconstruct ghost positions or orientations from compressed offsets
+void gpu_exchange_ghosts_decompress(unsigned int n,
+                                    const float4* d_in,
+                                    const Scalar4* d_ref,
+                                    Scalar4* d_out,
+                                    bool postype);
+
+//! Flag local particles that have moved too far since the last ghost exchange
+void gpu_check_exchange_displacements(unsigned int* d_result,
+                                      const Scalar4* d_pos,
+                                      const Scalar4* d_exchange_pos,
+                                      unsigned int N,
+                                      const BoxDim& box,
+                                      Scalar3 lambda,
+                                      Scalar maxsq,
+                                      unsigned int checkn);
+
 //! Compute ghost rtags
 void gpu_compute_ghost_rtags(unsigned int first_idx,
                              unsigned int n_ghost,
@@ -157,11 +157,19 @@ class PYBIND11_EXPORT CommunicatorGPU : public Communicator
             m_neigh_counts; //!< List of number of neighbors to send ghost to (temp array)
         GlobalVector<unsigned int>
             m_ghost_scan; //!< Prefix sum of number of neighbors to send ghost to (temp array)
+        GlobalVector<unsigned int>
+            m_neigh_send_counts; //!< Number of ghosts to send to each unique neighbor (temp array)
         };
 
     //! Remove tags of ghost particles
     virtual void removeGhostParticleTags();
 
+    //! Test if any local particle has moved too far since the last exchange
+    virtual bool checkExchangeDisplacements(const Scalar3& lambda, Scalar maxsq);
+
+    //! Record the positions of the local particles at a ghost exchange
+    virtual void setExchangePositions();
+
     private:
     /* General communication */
     unsigned int m_max_stages;             //!< Maximum number of (dependent) communication stages
@@ -229,6 +237,23 @@ class PYBIND11_EXPORT CommunicatorGPU : public Communicator
     GlobalVector<Scalar4> m_orientation_ghost_sendbuf; //<! Buffer for sending ghost orientations
     GlobalVector<Scalar4> m_orientation_ghost_recvbuf; //<! Buffer for receiving ghost orientations
 
+    GlobalVector<float4> m_pos_ghost_sendbuf_compressed; //!< Compressed ghost position send buffer
+    GlobalVector<float4> m_pos_ghost_recvbuf_compressed; //!< Compressed ghost position recv buffer
+    GlobalVector<float4>
+        m_orientation_ghost_sendbuf_compressed; //!< Compressed ghost orientation send buffer
+    GlobalVector<float4>
+        m_orientation_ghost_recvbuf_compressed; //!< Compressed ghost orientation recv buffer
+
+    GlobalVector<Scalar4> m_pos_ghost_sendref; //!< Sent ghost positions at the last exchange
+    GlobalVector<Scalar4> m_pos_ghost_recvref; //!< Received ghost positions at the last exchange
+    GlobalVector<Scalar4>
+        m_orientation_ghost_sendref; //!< Sent ghost orientations at the last exchange
+    GlobalVector<Scalar4>
+        m_orientation_ghost_recvref; //!< Received ghost orientations at the last exchange
+    CommFlags m_ghost_ref_flags;                //!< Fields with references from the last exchange
+    bool m_compress_update_pos = false;         //!< True if the update compresses positions
+    bool m_compress_update_orientation = false; //!< True if the update compresses orientations
+
     GlobalVector<Scalar4> m_netforce_ghost_sendbuf; //!< Send buffer for netforce
     GlobalVector<Scalar4> m_netforce_ghost_recvbuf; //!< Recv buffer for netforce
 
@@ -251,6 +276,8 @@ class PYBIND11_EXPORT CommunicatorGPU : public Communicator
         m_neigh_counts; //!< List of number of neighbors to send ghost to (temp array)
     GlobalVector<unsigned int>
         m_scan; //!< exclusive prefix sum of number of neighbors to send ghost to (temp array)
+    GlobalVector<unsigned int>
+        m_neigh_send_counts; //!< Number of ghosts to send to each unique neighbor (temp array)
 
     std::vector<std::vector<unsigned int>>
         m_n_send_ghosts; //!< Number of ghosts to send per stage and neighbor
@@ -264,9 +291,61 @@ class PYBIND11_EXPORT CommunicatorGPU : public Communicator
 
     hipEvent_t m_event; //!< CUDA event for synchronization
 
+    GlobalArray<unsigned int> m_exchange_flags; //!< Flag set when particles leave the ghost shell
+    unsigned int m_exchange_checkn = 0;         //!< Counter of ghost shell checks
+
+    //! Buffers of the fields (position, velocity, orientation) sent by a ghost update
+    struct GhostUpdateBuffers
+        {
+        bool send[3];         //!< True for the fields to send
+        char* sendbuf[3];     //!< Send buffer of each field
+        char* recvbuf[3];     //!< Receive buffer of each field
+        unsigned int size[3]; //!< Size of one ghost in each buffer (in bytes)
+
+        //! Test if two sets of buffers are identical
+        bool operator==(const GhostUpdateBuffers& other) const
+            {
+            for (unsigned int field = 0; field < 3; ++field)
+                {
+                if (send[field] != other.send[field] || sendbuf[field] != other.sendbuf[field]
+                    || recvbuf[field] != other.recvbuf[field] || size[field] != other.size[field])
+                    return false;
+                }
+            return true;
+            }
+        };
+
+    std::vector<MPI_Request> m_persistent_reqs;        //!< Persistent ghost update requests
+    std::vector<unsigned int> m_persistent_reqs_begin; //!< First persistent request per stage
+    GhostUpdateBuffers m_persistent_buffers;           //!< Buffers the persistent requests use
+    bool m_persistent_reqs_valid = false;              //!< True if the persistent requests exist
+    bool m_persistent_update = false;                  //!< True if the ghost update is persistent
+
     //! Helper function to allocate various buffers
     void allocateBuffers();
 
+    //! Post the sends and receives of a ghost update stage
+    void postGhostUpdateRequests(unsigned int stage,
+                                 const GhostUpdateBuffers& buffers,
+                                 const unsigned int* h_unique_neighbors,
+                                 const unsigned int* h_ghost_begin,
+                                 bool persistent,
+                                 std::vector<MPI_Request>& reqs);
+
+    //! Set up the persistent requests of the ghost update for all stages
+    void initPersistentGhostRequests(const GhostUpdateBuffers& buffers,
+                                     const unsigned int* h_unique_neighbors,
+                                     const unsigned int* h_ghost_begin);
+
+    //! Release the persistent requests of the ghost update
+    void freePersistentGhostRequests();
+
+    //! Wait for the requests of a ghost update stage
+    void waitGhostUpdateRequests(unsigned int stage);
+
+    //! Copy the received fields of a ghost update stage into the particle data
+    void unpackGhostUpdate(unsigned int stage, unsigned int first_idx, const CommFlags& flags);
+
     //! Helper function to set up communication stages
     void initializeCommunicationStages();
     };
@@ -3,6 +3,7 @@
 
 #include "Action.h"
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -85,6 +86,19 @@ class PYBIND11_EXPORT Compute : public Action
     /// Python will notify C++ objects when they are detached from Simulation
     virtual void notifyDetach() {};
 
+    //! Get a function that evaluates a scalar loggable quantity in C++
+    /*! \param quantity Name of the loggable quantity in python
+        \returns A function of the timestep that returns the value of \a quantity, or an empty
+            function when the compute does not provide \a quantity in C++.
+
+        Writers that log on the hot path resolve their quantities once with this method and then
+        evaluate them without calling into python.
+    */
+    virtual std::function<Scalar(uint64_t)> getLogQuantity(const std::string& quantity)
+        {
+        return std::function<Scalar(uint64_t)>();
+        }
+
     protected:
     bool m_force_compute;     //!< true if calculation is enforced
     uint64_t m_last_computed; //!< Stores the last timestep compute was called
@@ -13,6 +13,7 @@
 #include "Communicator.h"
 #endif
 
+#include <algorithm>
 #include <limits>
 #include <stdexcept>
 
@@ -80,7 +81,6 @@ DCDDumpWriter::DCDDumpWriter(std::shared_ptr<SystemDefinition> sysdef,
 //! Initializes the output file for writing
 void DCDDumpWriter::initFileIO(uint64_t timestep)
     {
-    m_staging_buffer = new float[m_pdata->getNGlobal()];
     m_is_initialized = true;
 
     m_nglobal = m_pdata->getNGlobal();
@@ -137,7 +137,6 @@ DCDDumpWriter::~DCDDumpWriter()
     if (m_is_initialized)
         {
         m_file.close();
-        delete[] m_staging_buffer;
         }
     }
 
@@ -149,10 +148,18 @@ DCDDumpWriter::~DCDDumpWriter()
 void DCDDumpWriter::analyze(uint64_t timestep)
     {
     Analyzer::analyze(timestep);
-    // take particle data snapshot
-    SnapshotParticleData<Scalar> snapshot;
 
-    m_pdata->takeSnapshot(snapshot);
+    // rigid body unwrapping needs the images of central particles outside the group
+    bool use_snapshot = m_unwrap_rigid && !m_unwrap_full;
+    SnapshotParticleData<Scalar> snapshot;
+    if (use_snapshot)
+        {
+        m_pdata->takeSnapshot(snapshot);
+        }
+    else
+        {
+        gatherPositions();
+        }
 
 #ifdef ENABLE_MPI
     // if we are not the root processor, do not perform file I/O
@@ -192,7 +199,11 @@ void DCDDumpWriter::analyze(uint64_t timestep)
     // write the data for the current time step
     m_file.seekp(0, std::ios_base::end);
     write_frame_header(m_file);
-    write_frame_data(m_file, snapshot);
+    if (use_snapshot)
+        {
+        stageSnapshot(snapshot);
+        }
+    write_frame_data(m_file);
 
     // update the header with the number of frames written
     m_num_frames_written++;
@@ -308,29 +319,188 @@ void DCDDumpWriter::write_frame_header(std::fstream& file)
         }
     }
 
-/*! \param file File to write to
-    \param snapshot Snapshot to write
-    Writes the actual particle positions for all particles at the current time step
+/*! Each rank packs the positions of its local group members and the root gathers them into
+    m_staging_buffer in tag order. The positions are unwrapped and the orientation angle is
+    substituted on the owning rank, so only three floats per particle are communicated.
+*/
+void DCDDumpWriter::gatherPositions()
+    {
+    const BoxDim& box = m_pdata->getGlobalBox();
+    const unsigned int n_local = m_group->getNumMembers();
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+
+    // the plan holds while every rank sends the same tags in the same order
+    bool plan_changed = m_plan_tags.size() != n_local;
+    m_plan_tags.resize(n_local);
+    m_send_buffer.resize(3 * n_local);
+    for (unsigned int group_idx = 0; group_idx < n_local; group_idx++)
+        {
+        unsigned int j = m_group->getMemberIndex(group_idx);
+        unsigned int tag = h_tag.data[j];
+        if (m_plan_tags[group_idx] != tag)
+            {
+            m_plan_tags[group_idx] = tag;
+            plan_changed = true;
+            }
+
+        vec3<Scalar> pos(h_pos.data[j]);
+        if (m_unwrap_full)
+            {
+            pos = box.shift(pos, h_image.data[j]);
+            }
+
+        m_send_buffer[3 * group_idx] = float(pos.x);
+        m_send_buffer[3 * group_idx + 1] = float(pos.y);
+        m_send_buffer[3 * group_idx + 2] = float(pos.z);
+
+        // m_angle set to True turns on a hack where the particle orientation angle is written out
+        // to the z component this only works in 2D simulations, obviously
+        if (m_angle)
+            {
+            quat<Scalar> orientation(h_orientation.data[j]);
+            m_send_buffer[3 * group_idx + 2] = float(atan2(orientation.v.z, orientation.s) * 2);
+            }
+        }
+
+    const float* recv_buffer = m_send_buffer.data();
+#ifdef ENABLE_MPI
+    MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE, &plan_changed, 1, MPI_C_BOOL, MPI_LOR, mpi_comm);
+        }
+#endif
+
+    if (plan_changed)
+        {
+        buildGatherPlan();
+        }
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        m_recv_buffer.resize(m_plan_order.size() * 3);
+        MPI_Gatherv(m_send_buffer.data(),
+                    3 * n_local,
+                    MPI_FLOAT,
+                    m_recv_buffer.data(),
+                    m_recv_counts.data(),
+                    m_recv_displs.data(),
+                    MPI_FLOAT,
+                    0,
+                    mpi_comm);
+        recv_buffer = m_recv_buffer.data();
+        }
+#endif
+
+    if (!m_exec_conf->isRoot())
+        return;
+
+    // place the gathered positions in tag order, one block per component
+    const unsigned int nparticles = (unsigned int)m_plan_order.size();
+    m_staging_buffer.resize(3 * nparticles);
+    for (unsigned int k = 0; k < nparticles; k++)
+        {
+        unsigned int group_idx = m_plan_order[k];
+        m_staging_buffer[group_idx] = recv_buffer[3 * k];
+        m_staging_buffer[nparticles + group_idx] = recv_buffer[3 * k + 1];
+        m_staging_buffer[2 * nparticles + group_idx] = recv_buffer[3 * k + 2];
+        }
+    }
+
+/*! Collects the local member tags on the root and records where each gathered particle goes in
+    the tag ordered output.
 */
-void DCDDumpWriter::write_frame_data(std::fstream& file,
-                                     const SnapshotParticleData<Scalar>& snapshot)
+void DCDDumpWriter::buildGatherPlan()
     {
-    // we need to unsort the positions and write in tag order
-    assert(m_staging_buffer);
+    m_exec_conf->msg->notice(6) << "DCD: building gather plan" << endl;
 
+    std::vector<unsigned int> tags;
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+        unsigned int nranks = m_exec_conf->getNRanks();
+        int n_local = (int)m_plan_tags.size();
+
+        std::vector<int> counts(nranks);
+        MPI_Gather(&n_local, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, mpi_comm);
+
+        std::vector<int> displs(nranks, 0);
+        m_recv_counts.resize(nranks);
+        m_recv_displs.resize(nranks);
+        for (unsigned int r = 0; r < nranks; r++)
+            {
+            if (r > 0)
+                displs[r] = displs[r - 1] + counts[r - 1];
+            m_recv_counts[r] = 3 * counts[r];
+            m_recv_displs[r] = 3 * displs[r];
+            }
+
+        if (m_exec_conf->isRoot())
+            tags.resize(displs[nranks - 1] + counts[nranks - 1]);
+
+        MPI_Gatherv(m_plan_tags.data(),
+                    n_local,
+                    MPI_UNSIGNED,
+                    tags.data(),
+                    counts.data(),
+                    displs.data(),
+                    MPI_UNSIGNED,
+                    0,
+                    mpi_comm);
+        }
+    else
+#endif
+        {
+        tags = m_plan_tags;
+        }
+
+    if (!m_exec_conf->isRoot())
+        return;
+
+    // group member tags are sorted, so the position of a tag is found by bisection
+    const unsigned int nparticles = (unsigned int)tags.size();
+    std::vector<unsigned int> group_tags(nparticles);
+    for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
+        {
+        group_tags[group_idx] = m_group->getMemberTag(group_idx);
+        }
+
+    m_plan_order.resize(nparticles);
+    for (unsigned int k = 0; k < nparticles; k++)
+        {
+        m_plan_order[k] = (unsigned int)(std::lower_bound(group_tags.begin(),
+                                                          group_tags.end(),
+                                                          tags[k])
+                                         - group_tags.begin());
+        }
+    }
+
+/*! \param snapshot Snapshot to stage
+    Unwraps the positions in the snapshot and places them in m_staging_buffer in tag order.
+*/
+void DCDDumpWriter::stageSnapshot(const SnapshotParticleData<Scalar>& snapshot)
+    {
     BoxDim box = m_pdata->getGlobalBox();
 
     unsigned int nparticles = m_group->getNumMembersGlobal();
+    m_staging_buffer.resize(3 * nparticles);
 
-    // Create a tmp copy of the particle data and unwrap particles
-    std::vector<vec3<Scalar>> tmp_pos(snapshot.pos);
     for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
         {
         unsigned int i = m_group->getMemberTag(group_idx);
+        vec3<Scalar> pos = snapshot.pos[i];
 
         if (m_unwrap_full)
             {
-            tmp_pos[i] = box.shift(tmp_pos[i], snapshot.image[i]);
+            pos = box.shift(pos, snapshot.image[i]);
             }
         else if (m_unwrap_rigid && snapshot.body[i] < MIN_FLOPPY)
             {
@@ -343,53 +513,38 @@ void DCDDumpWriter::write_frame_data(std::fstream& file,
                                       particle_img.y - body_iy,
                                       particle_img.z - body_iz);
 
-            tmp_pos[i] = box.shift(tmp_pos[i], img_diff);
+            pos = box.shift(pos, img_diff);
             }
-        }
-
-    // prepare x coords for writing, looping in tag order
-    for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
-        {
-        unsigned int i = m_group->getMemberTag(group_idx);
-        m_staging_buffer[group_idx] = float(tmp_pos[i].x);
-        }
-
-    // write x coords
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-    file.write((char*)m_staging_buffer, nparticles * sizeof(float));
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-
-    // prepare y coords for writing
-    for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
-        {
-        unsigned int i = m_group->getMemberTag(group_idx);
-        m_staging_buffer[group_idx] = float(tmp_pos[i].y);
-        }
 
-    // write y coords
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-    file.write((char*)m_staging_buffer, nparticles * sizeof(float));
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-
-    // prepare z coords for writing
-    for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
-        {
-        unsigned int i = m_group->getMemberTag(group_idx);
-        m_staging_buffer[group_idx] = float(tmp_pos[i].z);
+        m_staging_buffer[group_idx] = float(pos.x);
+        m_staging_buffer[nparticles + group_idx] = float(pos.y);
+        m_staging_buffer[2 * nparticles + group_idx] = float(pos.z);
 
         // m_angle set to True turns on a hack where the particle orientation angle is written out
         // to the z component this only works in 2D simulations, obviously
         if (m_angle)
             {
-            m_staging_buffer[group_idx]
+            m_staging_buffer[2 * nparticles + group_idx]
                 = float(atan2(snapshot.orientation[i].v.z, snapshot.orientation[i].s) * 2);
             }
         }
+    }
 
-    // write z coords
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-    file.write((char*)m_staging_buffer, nparticles * sizeof(float));
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
+/*! \param file File to write to
+    Writes the staged particle positions for all particles at the current time step
+*/
+void DCDDumpWriter::write_frame_data(std::fstream& file)
+    {
+    unsigned int nparticles = (unsigned int)(m_staging_buffer.size() / 3);
+    unsigned int block_size = (unsigned int)(nparticles * sizeof(float));
+
+    // write the x, y, and z blocks
+    for (unsigned int component = 0; component < 3; component++)
+        {
+        detail::write_int(file, block_size);
+        file.write((char*)(m_staging_buffer.data() + component * nparticles), block_size);
+        detail::write_int(file, block_size);
+        }
 
     // check for errors
     if (!file.good())
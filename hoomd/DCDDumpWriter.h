@@ -10,6 +10,7 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <vector>
 
 /*! \file DCDDumpWriter.h
     \brief Declares the DCDDumpWriter class
@@ -45,6 +46,14 @@ namespace hoomd
     Due to a limitation in the DCD format, the time step period between calls to
     analyze() \b must be specified up front. If analyze() detects that this period is
     not being maintained, it will print a warning but continue.
+
+    Each rank converts the positions of its local group members to single precision (unwrapping
+    them first when requested) and the root rank gathers only these coordinates. The gather places
+    each received particle at its position in tag order with a plan that is built from the tags
+    of the local members. The plan is reused as long as no rank changes its local members or their
+    order, so frames between particle sorts and migrations send no tags. Unwrapping rigid bodies
+    needs the image of each body's central particle, which may not be in the group, so it takes a
+    particle data snapshot instead.
     \ingroup analyzers
 */
 class PYBIND11_EXPORT DCDDumpWriter : public Analyzer
@@ -118,8 +127,17 @@ class PYBIND11_EXPORT DCDDumpWriter : public Analyzer
     bool m_is_initialized;  //!< True if file IO has been initialized
     unsigned int m_nglobal; //!< Initial number of particles
 
-    float* m_staging_buffer; //!< Buffer for staging particle positions in tag order
-    std::fstream m_file;     //!< The file object
+    std::vector<float> m_staging_buffer; //!< Positions in tag order, one block per component
+    std::fstream m_file;                 //!< The file object
+
+    std::vector<unsigned int> m_plan_tags;  //!< Tags of the local members when the plan was built
+    std::vector<unsigned int> m_plan_order; //!< Tag order position of each gathered particle
+    std::vector<float> m_send_buffer;       //!< Local member positions to gather
+    std::vector<float> m_recv_buffer;       //!< Gathered positions in plan order
+#ifdef ENABLE_MPI
+    std::vector<int> m_recv_counts; //!< Number of floats received from each rank
+    std::vector<int> m_recv_displs; //!< Offset of the floats received from each rank
+#endif
 
     // helper functions
 
@@ -128,7 +146,13 @@ class PYBIND11_EXPORT DCDDumpWriter : public Analyzer
     //! Writes the frame header
     void write_frame_header(std::fstream& file);
     //! Writes the particle positions for a frame
-    void write_frame_data(std::fstream& file, const SnapshotParticleData<Scalar>& snapshot);
+    void write_frame_data(std::fstream& file);
+    //! Gathers the positions of the group members into the staging buffer
+    void gatherPositions();
+    //! Builds the plan that places gathered positions in tag order
+    void buildGatherPlan();
+    //! Stages the positions from a snapshot, unwrapping rigid bodies
+    void stageSnapshot(const SnapshotParticleData<Scalar>& snapshot);
     //! Updates the file header
     void write_updated_header(std::fstream& file, uint64_t timestep);
     //! Initializes the output file for writing
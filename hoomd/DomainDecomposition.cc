@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <string>
 
 using namespace std;
 
@@ -131,33 +132,33 @@ void DomainDecomposition::initializeDomainGrid(Scalar3 L,
     unsigned int nx_node = 0, ny_node = 0, nz_node = 0;
     unsigned int nx_intra = 0, ny_intra = 0, nz_intra = 0;
 
-    if (nx || ny || nz)
-        m_twolevel = false;
-
     if (rank == 0)
         {
+        bool found_decomposition = findDecomposition(nranks, L, nx, ny, nz);
+        if (!found_decomposition)
+            {
+            throw std::invalid_argument(
+                "Unable to find a decomposition with the requested dimensions.");
+            }
+
         if (m_twolevel)
             {
             // every node has the same number of ranks, so nranks == num_nodes * num_ranks_per_node
             unsigned int n_nodes = (unsigned int)(m_nodes.size());
 
-            // subdivide the global grid
-            findDecomposition(nranks, L, nx, ny, nz);
-
-            // subdivide the local grid
-            subdivide(nranks / n_nodes, L, nx, ny, nz, nx_intra, ny_intra, nz_intra);
-
-            nx_node = nx / nx_intra;
-            ny_node = ny / ny_intra;
-            nz_node = nz / nz_intra;
-            }
-        else
-            {
-            bool found_decomposition = findDecomposition(nranks, L, nx, ny, nz);
-            if (!found_decomposition)
+            // subdivide the global grid into blocks of domains that are on the same node
+            if (subdivide(nranks / n_nodes, L, nx, ny, nz, nx_intra, ny_intra, nz_intra))
                 {
-                throw std::invalid_argument(
-                    "Unable to find a decomposition with the requested dimensions.");
+                nx_node = nx / nx_intra;
+                ny_node = ny / ny_intra;
+                nz_node = nz / nz_intra;
+                }
+            else
+                {
+                m_exec_conf->msg->notice(2)
+                    << "The domain grid cannot be divided into blocks of " << nranks / n_nodes
+                    << " ranks per node, ranks are not reordered." << std::endl;
+                m_twolevel = false;
                 }
             }
         m_nx = nx;
@@ -169,6 +170,7 @@ void DomainDecomposition::initializeDomainGrid(Scalar3 L,
     bcast(m_nx, 0, m_mpi_comm);
     bcast(m_ny, 0, m_mpi_comm);
     bcast(m_nz, 0, m_mpi_comm);
+    bcast(m_twolevel, 0, m_mpi_comm);
 
     // Initialize domain indexer
     m_index = Index3D(m_nx, m_ny, m_nz);
@@ -277,6 +279,48 @@ void DomainDecomposition::initializeDomainGrid(Scalar3 L,
         m_exec_conf->msg->notice(2) << nx_intra << " x " << ny_intra << " x " << nz_intra
                                     << " local grid on " << m_nodes.size() << " nodes" << std::endl;
 
+    // report how much of the ghost traffic stays on a node with this placement of the ranks
+    if (m_nodes.size() > 1)
+        {
+        std::vector<std::string> rank_node(nranks);
+        for (auto it = m_node_map.begin(); it != m_node_map.end(); ++it)
+            {
+            rank_node[it->second] = it->first;
+            }
+
+        const unsigned int n_grid[] = {m_nx, m_ny, m_nz};
+        unsigned int n_reordered = 0;
+        unsigned int n_neighbors = 0;
+        unsigned int n_intra_node = 0;
+        for (unsigned int iglob = 0; iglob < nranks; ++iglob)
+            {
+            if (h_cart_ranks.data[iglob] != iglob)
+                ++n_reordered;
+
+            // count each pair of face neighbors once through the neighbor above it
+            const uint3 pos = m_index.getTriple(iglob);
+            const unsigned int p[] = {pos.x, pos.y, pos.z};
+            for (unsigned int dim = 0; dim < 3; ++dim)
+                {
+                if (n_grid[dim] == 1 || (n_grid[dim] == 2 && p[dim] == 1))
+                    continue;
+
+                unsigned int q[] = {p[0], p[1], p[2]};
+                q[dim] = (q[dim] + 1) % n_grid[dim];
+                const unsigned int neighbor = h_cart_ranks.data[m_index(q[0], q[1], q[2])];
+
+                ++n_neighbors;
+                if (rank_node[neighbor] == rank_node[h_cart_ranks.data[iglob]])
+                    ++n_intra_node;
+                }
+            }
+
+        m_exec_conf->msg->notice(2) << n_reordered << " of " << nranks
+                                    << " ranks reordered, " << n_intra_node << " of "
+                                    << n_neighbors << " neighboring domains on the same node"
+                                    << std::endl;
+        }
+
     // compute position of this box in the domain grid by reverse look-up
     m_grid_pos = m_index.getTriple(h_cart_ranks_inv.data[rank]);
     }
@@ -408,7 +452,13 @@ bool DomainDecomposition::findDecomposition(unsigned int nranks,
     }
 
 //! Find a two-level decomposition of the global grid
-void DomainDecomposition::subdivide(unsigned int n_node_ranks,
+/*!
+ * The global grid is divided into blocks of \a n_node_ranks domains that each go on one node. The
+ * block that minimizes the surface area between the nodes is chosen.
+ *
+ * \returns true if the global grid can be divided into blocks of \a n_node_ranks domains
+ */
+bool DomainDecomposition::subdivide(unsigned int n_node_ranks,
                                     Scalar3 L,
                                     unsigned int nx,
                                     unsigned int ny,
@@ -419,13 +469,16 @@ void DomainDecomposition::subdivide(unsigned int n_node_ranks,
     {
     assert(L.x > 0);
     assert(L.y > 0);
-    assert(L.z > 0);
 
     // initial guess
     nx_intra = 1;
     ny_intra = 1;
     nz_intra = n_node_ranks;
 
+    bool is2D = L.z == 0.0;
+    bool found_decomposition = false;
+    double min_surface_area = 0;
+
     for (unsigned int nx_intra_try = 1; nx_intra_try <= n_node_ranks; nx_intra_try++)
         for (unsigned int ny_intra_try = 1; nx_intra_try * ny_intra_try <= n_node_ranks;
              ny_intra_try++)
@@ -438,10 +491,31 @@ void DomainDecomposition::subdivide(unsigned int n_node_ranks,
                 if (nx % nx_intra_try || ny % ny_intra_try || nz % nz_intra_try)
                     continue;
 
-                nx_intra = nx_intra_try;
-                ny_intra = ny_intra_try;
-                nz_intra = nz_intra_try;
+                // surface area between the nodes
+                const double nx_node = nx / nx_intra_try;
+                const double ny_node = ny / ny_intra_try;
+                const double nz_node = nz / nz_intra_try;
+                double surface_area;
+                if (is2D)
+                    {
+                    surface_area = L.x * (ny_node - 1) + L.y * (nx_node - 1);
+                    }
+                else
+                    {
+                    surface_area = L.x * L.y * (nz_node - 1) + L.x * L.z * (ny_node - 1)
+                                   + L.y * L.z * (nx_node - 1);
+                    }
+                if (surface_area < min_surface_area || !found_decomposition)
+                    {
+                    nx_intra = nx_intra_try;
+                    ny_intra = ny_intra_try;
+                    nz_intra = nz_intra_try;
+                    min_surface_area = surface_area;
+                    found_decomposition = true;
+                    }
                 }
+
+    return found_decomposition;
     }
 
 /*! \param dir Spatial direction to find neighbor in
@@ -566,6 +640,116 @@ void DomainDecomposition::setCumulativeFractions(unsigned int dir,
         }
     }
 
+namespace
+    {
+//! Recursively bisect a cumulative particle histogram
+/*!
+ * \param cum Cumulative histogram (cum[i] is the number of particles in the bins below bin i)
+ * \param c_lo Number of particles below the range to bisect
+ * \param c_hi Number of particles below the end of the range to bisect
+ * \param first Index of the first domain in the range
+ * \param n Number of domains in the range
+ * \param cum_frac Cumulative fractions to set at the interior boundaries of the range
+ *
+ * The range is cut so that the lower n/2 domains hold n/2 / n of its particles, and both halves
+ * are bisected again until every range holds a single domain.
+ */
+void bisectHistogram(const std::vector<double>& cum,
+                     double c_lo,
+                     double c_hi,
+                     unsigned int first,
+                     unsigned int n,
+                     std::vector<Scalar>& cum_frac)
+    {
+    if (n < 2)
+        return;
+
+    const unsigned int n_lo = n / 2;
+    const double c = c_lo + (c_hi - c_lo) * double(n_lo) / double(n);
+
+    // place the cut inside the bin that holds it assuming the particles are uniform in the bin
+    const size_t nbins = cum.size() - 1;
+    const size_t bin = std::lower_bound(cum.begin(), cum.end(), c) - cum.begin();
+    double f = 0;
+    if (bin > 0)
+        {
+        const double w = cum[bin] - cum[bin - 1];
+        f = double(bin - 1) + (w > 0 ? (c - cum[bin - 1]) / w : 0.0);
+        }
+    cum_frac[first + n_lo] = Scalar(f / double(nbins));
+
+    bisectHistogram(cum, c_lo, c, first, n_lo, cum_frac);
+    bisectHistogram(cum, c, c_hi, first + n_lo, n - n_lo, cum_frac);
+    }
+    } // end anonymous namespace
+
+/*!
+ * \param global_box The global simulation box
+ * \param snapshot Particles to balance (only those on the root rank, unless it is distributed)
+ *
+ * The grid is not changed. Along every dimension with more than one domain, the histogram of the
+ * fractional particle coordinates is reduced over all ranks and recursively bisected so that all
+ * slabs hold the same number of particles. Each slab is kept at least a quarter of the uniform
+ * width so that empty regions of the box do not produce domains thinner than the interactions.
+ * This function must be called collectively on all ranks before the particles are distributed.
+ */
+template<class Real>
+void DomainDecomposition::bisectParticles(const BoxDim& global_box,
+                                          const SnapshotParticleData<Real>& snapshot)
+    {
+    const bool has_particles = m_exec_conf->getRank() == 0 || snapshot.is_distributed;
+    const uint3 grid = getGridSize();
+    const unsigned int n_dir[3] = {grid.x, grid.y, grid.z};
+
+    for (unsigned int dir = 0; dir < 3; ++dir)
+        {
+        const unsigned int n = n_dir[dir];
+        if (n < 2)
+            continue;
+
+        // histogram the fractional coordinates, resolving each uniform slab into many bins
+        const unsigned int nbins = 64 * n;
+        std::vector<double> hist(nbins, 0.0);
+        if (has_particles)
+            {
+            for (const auto& p : snapshot.pos)
+                {
+                const vec3<Scalar> f = global_box.makeFraction(vec3<Scalar>(p));
+                const Scalar f_dir = dir == 0 ? f.x : (dir == 1 ? f.y : f.z);
+                const int bin = int(f_dir * Scalar(nbins));
+                hist[std::min(std::max(bin, 0), int(nbins) - 1)] += 1.0;
+                }
+            }
+        MPI_Allreduce(MPI_IN_PLACE, hist.data(), nbins, MPI_DOUBLE, MPI_SUM, m_mpi_comm);
+
+        std::vector<double> cum(nbins + 1, 0.0);
+        std::partial_sum(hist.begin(), hist.end(), cum.begin() + 1);
+        if (cum.back() == 0)
+            continue;
+
+        std::vector<Scalar> cum_frac = getCumulativeFractions(dir);
+        bisectHistogram(cum, 0.0, cum.back(), 0, n, cum_frac);
+
+        // enforce the minimum width from both ends of the box
+        const Scalar min_frac = Scalar(0.25) / Scalar(n);
+        for (unsigned int i = 1; i < n; ++i)
+            {
+            cum_frac[i] = std::max(cum_frac[i], cum_frac[i - 1] + min_frac);
+            }
+        for (unsigned int i = n - 1; i >= 1; --i)
+            {
+            cum_frac[i] = std::min(cum_frac[i], cum_frac[i + 1] - min_frac);
+            }
+
+        setCumulativeFractions(dir, cum_frac, 0);
+        }
+    }
+
+template void DomainDecomposition::bisectParticles<float>(const BoxDim& global_box,
+                                                          const SnapshotParticleData<float>&);
+template void DomainDecomposition::bisectParticles<double>(const BoxDim& global_box,
+                                                           const SnapshotParticleData<double>&);
+
 /*!
  * \param global_box The global simulation box
  * \returns The local simulation box for the current rank
@@ -662,13 +846,19 @@ unsigned int DomainDecomposition::placeParticle(const BoxDim& global_box,
     return rank;
     }
 
+/*!
+ * The ranks that share memory are on the same node. Each node is named by the lowest rank on it,
+ * which rank 0 of the node communicator has.
+ */
 void DomainDecomposition::findCommonNodes()
     {
-    // get MPI node name
-    char procname[MPI_MAX_PROCESSOR_NAME];
-    int len;
-    MPI_Get_processor_name(procname, &len);
-    std::string s(procname, len);
+    unsigned int node_leader = m_exec_conf->getRank();
+    MPI_Bcast(&node_leader,
+              1,
+              MPI_UNSIGNED,
+              0,
+              m_exec_conf->getMPIConfig()->getNodeCommunicator());
+    std::string s = std::to_string(node_leader);
 
     // collect node names from all ranks on rank zero
     std::vector<std::string> nodes;
@@ -710,6 +900,10 @@ void DomainDecomposition::initializeTwoLevel()
         if (n_node > m_max_n_node)
             m_max_n_node = n_node;
         }
+
+    if (!m_twolevel)
+        m_exec_conf->msg->notice(2)
+            << "Nodes have different numbers of ranks, ranks are not reordered." << std::endl;
     }
 
 namespace detail
@@ -731,7 +925,9 @@ void export_DomainDecomposition(pybind11::module& m)
                             const std::vector<Scalar>&,
                             const std::vector<Scalar>&,
                             const std::vector<Scalar>&>())
-        .def("getCumulativeFractions", &DomainDecomposition::getCumulativeFractions);
+        .def("getCumulativeFractions", &DomainDecomposition::getCumulativeFractions)
+        .def("bisectParticles", &DomainDecomposition::bisectParticles<float>)
+        .def("bisectParticles", &DomainDecomposition::bisectParticles<double>);
     }
     } // end namespace detail
 
@@ -26,6 +26,8 @@
 
 namespace hoomd
     {
+template<class Real> struct SnapshotParticleData;
+
 //! Class that initializes every processor using spatial domain-decomposition
 /*! This class is used to divide the global simulation box into sub-domains and to assign a box to
  * every processor.
@@ -44,6 +46,9 @@ namespace hoomd
  * box is covered. If the specified number of ranks does not match the number that is available,
  * behavior is reverted to the normal default with uniform cuts along each dimension.
  *
+ *  The cuts can also be derived from the particles themselves with bisectParticles(), which
+ * recursively bisects the particle distribution along each dimension of the grid.
+ *
  *  The initialization of the domain decomposition scheme is performed in the constructor.
  */
 class PYBIND11_EXPORT DomainDecomposition
@@ -155,6 +160,10 @@ class PYBIND11_EXPORT DomainDecomposition
                                 const std::vector<Scalar>& cum_frac,
                                 unsigned int root);
 
+    //! Place the domain boundaries so that each slab holds the same number of particles
+    template<class Real>
+    void bisectParticles(const BoxDim& global_box, const SnapshotParticleData<Real>& snapshot);
+
     //! Get the dimensions of the local simulation box
     const BoxDim calculateLocalBox(const BoxDim& global_box);
 
@@ -195,7 +204,7 @@ class PYBIND11_EXPORT DomainDecomposition
                            unsigned int& nz);
 
     //! Find a two-level decomposition of the global grid
-    void subdivide(unsigned int n_node_ranks,
+    bool subdivide(unsigned int n_node_ranks,
                    Scalar3 L,
                    unsigned int nx,
                    unsigned int ny,
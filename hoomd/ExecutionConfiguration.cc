@@ -17,6 +17,7 @@
 #endif
 
 #include <algorithm>
+#include <chrono>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -76,10 +77,25 @@ ExecutionConfiguration::ExecutionConfiguration(executionMode mode,
     msg->notice(5) << "Constructing ExecutionConfiguration: ( " << s.str() << ") " << endl;
     exec_mode = mode;
 
+    // time the stages of the construction for the startup notice
+    auto stage_start = std::chrono::steady_clock::now();
+    std::vector<std::pair<std::string, double>> stage_times;
+    auto end_stage = [&](const std::string& name)
+    {
+        auto now = std::chrono::steady_clock::now();
+        stage_times.push_back({name, std::chrono::duration<double>(now - stage_start).count()});
+        stage_start = now;
+    };
+
 #if defined(ENABLE_HIP)
-    // scan the available GPUs
-    scanGPUs();
-    unsigned int dev_count = (unsigned int)s_capable_gpu_ids.size();
+    // scan the available GPUs, which initializes the GPU runtime, unless they cannot be used
+    unsigned int dev_count = 0;
+    if (exec_mode != CPU)
+        {
+        scanGPUs();
+        dev_count = (unsigned int)s_capable_gpu_ids.size();
+        end_stage("GPU scan");
+        }
 
     // auto select a mode
     if (exec_mode == AUTO)
@@ -139,6 +155,7 @@ ExecutionConfiguration::ExecutionConfiguration(executionMode mode,
             for (auto it = gpu_id.begin(); it != gpu_id.end(); ++it)
                 initializeGPU(*it);
             }
+        end_stage("GPU initialization");
         }
 #else
     if (exec_mode == GPU)
@@ -152,6 +169,9 @@ ExecutionConfiguration::ExecutionConfiguration(executionMode mode,
 
     setupStats();
 
+    m_tracer = std::make_unique<Tracer>(exec_mode == GPU);
+    end_stage("device properties");
+
     s.clear();
     s << "Device is running on ";
     for (const auto& device_description : m_active_device_descriptions)
@@ -203,11 +223,15 @@ ExecutionConfiguration::ExecutionConfiguration(executionMode mode,
         hipError_t err_sync = hipPeekAtLastError();
         handleHIPError(err_sync, __FILE__, __LINE__);
 
+        m_memory_pool.reset(new MemoryPool(m_gpu_id[0]));
+
         // initialize cached allocator, max allocation 0.5*global mem
         m_cached_alloc.reset(
             new CachedAllocator(false, (unsigned int)(0.5f * (float)dev_prop.totalGlobalMem)));
+        m_cached_alloc->setMemoryPool(m_memory_pool.get());
         m_cached_alloc_managed.reset(
             new CachedAllocator(true, (unsigned int)(0.5f * (float)dev_prop.totalGlobalMem)));
+        end_stage("allocators");
         }
 #endif
 
@@ -229,6 +253,7 @@ ExecutionConfiguration::ExecutionConfiguration(executionMode mode,
             {
             throw runtime_error("Ranks have different execution configurations.");
             }
+        end_stage("MPI check");
         }
 #endif
 
@@ -244,6 +269,7 @@ ExecutionConfiguration::ExecutionConfiguration(executionMode mode,
         }
 
     setNumThreads(num_threads);
+    end_stage("TBB threads");
 #endif
 
 #if defined(ENABLE_HIP)
@@ -254,7 +280,20 @@ ExecutionConfiguration::ExecutionConfiguration(executionMode mode,
         hipSetDevice(m_gpu_id[idev]);
         hipEventCreateWithFlags(&m_events[idev], hipEventDisableTiming);
         }
+    if (m_gpu_id.size() > 0)
+        end_stage("GPU events");
 #endif
+
+    double total_time = 0;
+    s.str("");
+    s << "ExecutionConfiguration startup:";
+    for (const auto& stage : stage_times)
+        {
+        s << " " << stage.first << " " << stage.second << " s,";
+        total_time += stage.second;
+        }
+    s << " total " << total_time << " s" << endl;
+    msg->notice(4) << s.str();
     }
 
 ExecutionConfiguration::~ExecutionConfiguration()
@@ -270,11 +309,33 @@ ExecutionConfiguration::~ExecutionConfiguration()
 
 #if defined(ENABLE_HIP)
     // the destructors of these objects can issue hip calls, so free them before the device reset
+    m_tracer.reset();
     m_cached_alloc.reset();
     m_cached_alloc_managed.reset();
+    m_memory_pool.reset();
 #endif
     }
 
+#if defined(ENABLE_HIP)
+/*! \param enable Set to true to allocate device memory from the pool
+
+    The setting applies to new allocations. Existing allocations are freed the way they were
+    allocated.
+*/
+void ExecutionConfiguration::setMemoryPool(bool enable)
+    {
+    if (!m_memory_pool)
+        {
+        throw std::runtime_error("Memory pools require a GPU.");
+        }
+    if (enable && getNumActiveGPUs() > 1)
+        {
+        throw std::runtime_error("Memory pools do not support multiple GPUs.");
+        }
+    m_memory_pool->setEnabled(enable);
+    }
+#endif
+
 #if defined(ENABLE_HIP)
 
 std::pair<unsigned int, unsigned int>
@@ -693,6 +754,11 @@ void export_ExecutionConfiguration(pybind11::module& m)
         .def("getComputeCapability", &ExecutionConfiguration::getComputeCapability)
         .def("hipProfileStart", &ExecutionConfiguration::hipProfileStart)
         .def("hipProfileStop", &ExecutionConfiguration::hipProfileStop)
+        .def("setMemoryPool", &ExecutionConfiguration::setMemoryPool)
+        .def("memoryPoolEnabled", &ExecutionConfiguration::memoryPoolEnabled)
+        .def("getMemoryPool",
+             &ExecutionConfiguration::getMemoryPool,
+             pybind11::return_value_policy::reference_internal)
 #endif
         .def("getPartition", &ExecutionConfiguration::getPartition)
         .def("getNRanks", &ExecutionConfiguration::getNRanks)
@@ -703,6 +769,16 @@ void export_ExecutionConfiguration(pybind11::module& m)
         .def("getNumThreads", &ExecutionConfiguration::getNumThreads)
         .def("setMemoryTracing", &ExecutionConfiguration::setMemoryTracing)
         .def("memoryTracingEnabled", &ExecutionConfiguration::memoryTracingEnabled)
+        .def("setOperationGPUTiming", &ExecutionConfiguration::setOperationGPUTiming)
+        .def("operationGPUTimingEnabled", &ExecutionConfiguration::operationGPUTimingEnabled)
+        .def("setAutotunerDriftThreshold", &ExecutionConfiguration::setAutotunerDriftThreshold)
+        .def("getAutotunerDriftThreshold", &ExecutionConfiguration::getAutotunerDriftThreshold)
+        .def("getTracer",
+             &ExecutionConfiguration::getTracer,
+             pybind11::return_value_policy::reference_internal)
+        .def("getMemoryTracker",
+             &ExecutionConfiguration::getMemoryTracker,
+             pybind11::return_value_policy::reference_internal)
         .def_static("getCapableDevices", &ExecutionConfiguration::getCapableDevices)
         .def_static("getScanMessages", &ExecutionConfiguration::getScanMessages)
         .def("getActiveDevices", &ExecutionConfiguration::getActiveDevices);
@@ -712,6 +788,30 @@ void export_ExecutionConfiguration(pybind11::module& m)
         .value("CPU", ExecutionConfiguration::executionMode::CPU)
         .value("AUTO", ExecutionConfiguration::executionMode::AUTO)
         .export_values();
+
+    pybind11::class_<MemoryUsage>(m, "MemoryUsage")
+        .def_readonly("host", &MemoryUsage::host)
+        .def_readonly("device", &MemoryUsage::device)
+        .def_readonly("peak_host", &MemoryUsage::peak_host)
+        .def_readonly("peak_device", &MemoryUsage::peak_device);
+
+    pybind11::class_<MemoryTracker>(m, "MemoryTracker")
+        .def("getUsage", &MemoryTracker::getUsage)
+        .def("getTotal", &MemoryTracker::getTotal)
+        .def("resetPeak", &MemoryTracker::resetPeak);
+
+#if defined(ENABLE_HIP)
+    pybind11::class_<MemoryPool>(m, "MemoryPool")
+        .def("isSupported", &MemoryPool::isSupported)
+        .def("setReleaseThreshold", &MemoryPool::setReleaseThreshold)
+        .def("getReleaseThreshold", &MemoryPool::getReleaseThreshold)
+        .def("getReservedBytes", &MemoryPool::getReservedBytes)
+        .def("getUsedBytes", &MemoryPool::getUsedBytes)
+        .def("getPeakReservedBytes", &MemoryPool::getPeakReservedBytes)
+        .def("getPeakUsedBytes", &MemoryPool::getPeakUsedBytes)
+        .def("getFragmentation", &MemoryPool::getFragmentation)
+        .def("resetPeak", &MemoryPool::resetPeak);
+#endif
     }
     } // end namespace detail
 
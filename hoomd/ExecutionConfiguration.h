@@ -12,12 +12,16 @@
 #endif
 
 #include "MPIConfiguration.h"
+#include "MemoryTracker.h"
+#include "Tracer.h"
 
 #include <memory>
 #include <string>
 #include <vector>
 
 #ifdef ENABLE_HIP
+#include "MemoryPool.h"
+
 #include <hip/hip_runtime.h>
 #ifdef ENABLE_ROCTRACER
 #ifdef __HIP_PLATFORM_HCC__
@@ -292,6 +296,21 @@ class PYBIND11_EXPORT ExecutionConfiguration
         {
         return *m_cached_alloc_managed;
         }
+
+    //! Returns the pool for device allocations
+    MemoryPool& getMemoryPool() const
+        {
+        return *m_memory_pool;
+        }
+
+    //! Set whether device allocations come from the memory pool
+    void setMemoryPool(bool enable);
+
+    //! Test whether device allocations come from the memory pool
+    bool memoryPoolEnabled() const
+        {
+        return m_memory_pool && m_memory_pool->isEnabled();
+        }
 #endif
 
     //! Set up memory tracing
@@ -305,6 +324,42 @@ class PYBIND11_EXPORT ExecutionConfiguration
         return m_memory_tracing;
         }
 
+    //! Set whether operations time their calls on the GPU
+    void setOperationGPUTiming(bool enable)
+        {
+        m_operation_gpu_timing = enable;
+        }
+
+    //! Test whether operations time their calls on the GPU
+    bool operationGPUTimingEnabled() const
+        {
+        return m_operation_gpu_timing;
+        }
+
+    //! Set the relative kernel slowdown that makes idle autotuners scan again (0 disables)
+    void setAutotunerDriftThreshold(double threshold)
+        {
+        m_autotuner_drift_threshold = threshold;
+        }
+
+    //! Get the relative kernel slowdown that makes idle autotuners scan again
+    double getAutotunerDriftThreshold() const
+        {
+        return m_autotuner_drift_threshold;
+        }
+
+    //! Get the tracer that records the time spent in the run loop
+    Tracer& getTracer() const
+        {
+        return *m_tracer;
+        }
+
+    //! Get the registry of the memory held by GPUArray and GlobalArray allocations
+    MemoryTracker& getMemoryTracker() const
+        {
+        return m_memory_tracker;
+        }
+
     //! Returns true if we are in a multi-GPU block
     bool inMultiGPUBlock() const
         {
@@ -396,6 +451,7 @@ class PYBIND11_EXPORT ExecutionConfiguration
     mutable bool m_in_multigpu_block; //!< Tracks whether we are in a multi-GPU block
 
 #if defined(ENABLE_HIP)
+    std::unique_ptr<MemoryPool> m_memory_pool;       //!< Pool for device allocations
     std::unique_ptr<CachedAllocator> m_cached_alloc; //!< Cached allocator for temporary allocations
     std::unique_ptr<CachedAllocator>
         m_cached_alloc_managed; //!< Cached allocator for temporary allocations in managed memory
@@ -410,6 +466,13 @@ class PYBIND11_EXPORT ExecutionConfiguration
     void setupStats();
 
     bool m_memory_tracing = false;
+
+    std::unique_ptr<Tracer> m_tracer; //!< Records the time spent in the run loop
+
+    mutable MemoryTracker m_memory_tracker; //!< Records the memory held by each array owner
+
+    bool m_operation_gpu_timing = false;    //!< True when operations time their calls on the GPU
+    double m_autotuner_drift_threshold = 0; //!< Slowdown that starts a local autotuner scan
     };
 
 #if defined(ENABLE_HIP)
@@ -0,0 +1,76 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __HOOMD_FIXED_POINT_H__
+#define __HOOMD_FIXED_POINT_H__
+
+/*! \file FixedPoint.h
+    \brief Conversions to and from the 64-bit fixed-point format used for reproducible sums
+
+    Floating point addition is not associative, so a sum computed with atomic operations or with a
+    reduction whose shape depends on a tuned block size changes in the last bits from run to run.
+    A value in fixed point is a 64-bit signed integer with 32 fractional bits. Integer addition is
+    associative, so a sum of fixed-point values is the same in any order. The sum is exact as long
+    as its magnitude stays below 2^31, and each value is rounded to a multiple of 2^-32 when it is
+    converted.
+*/
+
+#include "HOOMDMath.h"
+
+#ifndef __HIPCC__
+#include <cmath>
+#endif
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__ inline
+#else
+#define HOSTDEVICE inline
+#endif
+
+namespace hoomd
+    {
+namespace detail
+    {
+//! Number of fractional bits in the fixed-point format
+const unsigned int fixed_point_bits = 32;
+
+//! Convert a value to fixed point
+HOSTDEVICE long long toFixedPoint(double x)
+    {
+    const double scale = double(1ull << fixed_point_bits);
+#ifdef __HIP_DEVICE_COMPILE__
+    return __double2ll_rn(x * scale);
+#else
+    return std::llrint(x * scale);
+#endif
+    }
+
+//! Convert a value from fixed point
+HOSTDEVICE double fromFixedPoint(long long x)
+    {
+    const double scale = double(1ull << fixed_point_bits);
+    return double(x) / scale;
+    }
+
+#ifdef __HIPCC__
+//! Atomically add a value to a fixed-point sum
+/*!
+ * \param address Fixed-point sum
+ * \param x Value to add, which is converted to fixed point
+ *
+ * Signed integers add as unsigned integers in two's complement, so the unsigned 64-bit atomic
+ * that all GPUs support is used.
+ */
+__device__ inline void atomicAddFixedPoint(long long* address, double x)
+    {
+    atomicAdd(reinterpret_cast<unsigned long long*>(address),
+              static_cast<unsigned long long>(toFixedPoint(x)));
+    }
+#endif // __HIPCC__
+
+    } // end namespace detail
+    } // end namespace hoomd
+
+#undef HOSTDEVICE
+
+#endif // __HOOMD_FIXED_POINT_H__
@@ -26,7 +26,8 @@ namespace hoomd
     \post All forces are initialized to 0
 */
 ForceCompute::ForceCompute(std::shared_ptr<SystemDefinition> sysdef)
-    : Compute(sysdef), m_particles_sorted(false), m_buffers_writeable(false)
+    : Compute(sysdef), m_particles_sorted(false), m_interior_computed(false),
+      m_buffers_writeable(false), m_timestep_multiple(1)
     {
     assert(m_pdata);
     assert(m_pdata->getMaxN() > 0);
@@ -208,6 +209,24 @@ ForceCompute::~ForceCompute()
         this);
     }
 
+/*! \param quantity Name of the loggable quantity in python
+    \returns A function that computes the forces and returns the value of \a quantity
+
+    The total potential energy is available as "energy".
+*/
+std::function<Scalar(uint64_t)> ForceCompute::getLogQuantity(const std::string& quantity)
+    {
+    if (quantity == "energy")
+        {
+        return [this](uint64_t timestep)
+        {
+            compute(timestep);
+            return calcEnergySum();
+        };
+        }
+    return Compute::getLogQuantity(quantity);
+    }
+
 /*! Sums the total potential energy calculated by the last call to compute() and returns it.
  */
 Scalar ForceCompute::calcEnergySum()
@@ -566,13 +585,36 @@ void ForceCompute::compute(uint64_t timestep)
     // flags do not match
     if (m_particles_sorted || shouldCompute(timestep) || m_pdata->getFlags() != m_computed_flags)
         {
+        ScopedTrace trace(m_exec_conf->getTracer(), typeid(*this), "compute");
+        ScopedTimer timer(m_timer);
+        setAutotunerProblemSize(m_pdata->getN() + m_pdata->getNGhosts());
         computeForces(timestep);
         }
 
     m_particles_sorted = false;
+    m_interior_computed = false;
     m_computed_flags = m_pdata->getFlags();
     }
 
+/*! \param timestep Current time step
+    \returns true when the forces on the interior particles have been computed
+
+    The integrator calls computeInterior() while ghost particle positions are in flight, and then
+    calls compute() at the same time step after the ghost update completes. Forces
+    that do not implement computeInteriorForces() compute all particles in compute().
+*/
+bool ForceCompute::computeInterior(uint64_t timestep)
+    {
+    // only compute when the following call to compute() will compute forces
+    if (m_particles_sorted || peekCompute(timestep) || m_pdata->getFlags() != m_computed_flags)
+        {
+        ScopedTrace trace(m_exec_conf->getTracer(), typeid(*this), "compute interior");
+        ScopedTimer timer(m_timer);
+        m_interior_computed = computeInteriorForces(timestep);
+        }
+    return m_interior_computed;
+    }
+
 /*! \param tag Global particle tag
     \returns Torque of particle referenced by tag
  */
@@ -690,7 +732,10 @@ void export_ForceCompute(pybind11::module& m)
         .def("getEnergies", &ForceCompute::getEnergiesPython)
         .def("getForces", &ForceCompute::getForcesPython)
         .def("getTorques", &ForceCompute::getTorquesPython)
-        .def("getVirials", &ForceCompute::getVirialsPython);
+        .def("getVirials", &ForceCompute::getVirialsPython)
+        .def_property("timestep_multiple",
+                      &ForceCompute::getTimestepMultiple,
+                      &ForceCompute::setTimestepMultiple);
     }
     } // end namespace detail
 
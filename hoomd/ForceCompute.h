@@ -18,6 +18,7 @@
 
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 #include <memory>
+#include <stdexcept>
 
 /*! \file ForceCompute.h
     \brief Declares the ForceCompute class
@@ -76,9 +77,15 @@ class PYBIND11_EXPORT ForceCompute : public Compute
     //! Computes the forces
     virtual void compute(uint64_t timestep);
 
+    //! Computes the forces on particles that do not interact with ghost particles
+    bool computeInterior(uint64_t timestep);
+
     //! Total the potential energy
     Scalar calcEnergySum();
 
+    //! Get a function that evaluates a scalar loggable quantity in C++
+    virtual std::function<Scalar(uint64_t)> getLogQuantity(const std::string& quantity);
+
     //! Sum the potential energy of a group
     Scalar calcEnergyGroup(std::shared_ptr<ParticleGroup> group);
 
@@ -179,8 +186,25 @@ class PYBIND11_EXPORT ForceCompute : public Compute
         return m_buffers_writeable;
         }
 
+    /// Set the number of timesteps between applications of this force by the integrator
+    void setTimestepMultiple(unsigned int multiple)
+        {
+        if (multiple == 0)
+            {
+            throw std::invalid_argument("timestep_multiple must be positive");
+            }
+        m_timestep_multiple = multiple;
+        }
+
+    /// Get the number of timesteps between applications of this force by the integrator
+    unsigned int getTimestepMultiple() const
+        {
+        return m_timestep_multiple;
+        }
+
     protected:
-    bool m_particles_sorted; //!< Flag set to true when particles are resorted in memory
+    bool m_particles_sorted;  //!< Flag set to true when particles are resorted in memory
+    bool m_interior_computed; //!< True when only the boundary particles remain to be computed
 
     //! Helper function called when particles are sorted
     /*! setParticlesSorted() is passed as a slot to the particle sort signal.
@@ -237,6 +261,9 @@ class PYBIND11_EXPORT ForceCompute : public Compute
     // whether the local force buffers exposed by this class should be read-only
     bool m_buffers_writeable;
 
+    /// Number of timesteps between applications of this force by the integrator
+    unsigned int m_timestep_multiple;
+
 #ifdef ENABLE_MPI
     /// Helper class to gather particle forces, energies, and virials
     GatherTagOrder m_gather_tag_order;
@@ -251,6 +278,18 @@ class PYBIND11_EXPORT ForceCompute : public Compute
         \param timestep Current time step
     */
     virtual void computeForces(uint64_t timestep) { }
+
+    //! Compute the forces on particles that do not interact with ghost particles
+    /*! Sub-classes may implement this function to compute forces while the ghost particle
+        positions are being updated. When it returns true, the next call to computeForces() at the
+        same time step must compute the forces on the remaining (boundary) particles only.
+        \param timestep Current time step
+        \returns true when the interior forces have been computed
+    */
+    virtual bool computeInteriorForces(uint64_t timestep)
+        {
+        return false;
+        }
     };
 
 /** Make the local particle data available to python via zero-copy access
@@ -21,6 +21,7 @@
 
 #include "ExecutionConfiguration.h"
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
@@ -79,18 +80,35 @@ template<class T> class device_deleter
     {
     public:
     //! Default constructor
-    device_deleter() : m_use_device(false), m_N(0), m_mapped(false) { }
+    device_deleter() : m_use_device(false), m_N(0), m_mapped(false), m_pooled(false) { }
 
     //! Ctor
     /*! \param exec_conf Execution configuration
         \param use_device whether the array is managed or on the host
+        \param pooled whether the array was allocated from the memory pool
+        \param tag Name of the array
+
+        Records the allocation in the memory tracker, unless it is mapped host memory.
      */
     device_deleter(std::shared_ptr<const ExecutionConfiguration> exec_conf,
                    bool use_device,
                    const size_t N,
-                   bool mapped)
-        : m_exec_conf(exec_conf), m_use_device(use_device), m_N(N), m_mapped(mapped)
+                   bool mapped,
+                   bool pooled = false,
+                   const std::string& tag = std::string())
+        : m_exec_conf(exec_conf), m_use_device(use_device), m_N(N), m_mapped(mapped),
+          m_pooled(pooled), m_tag(tag)
+        {
+        if (isTracked())
+            m_exec_conf->getMemoryTracker().allocate(m_tag, m_N * sizeof(T), true);
+        }
+
+    //! Set the tag
+    void setTag(const std::string& tag)
         {
+        if (isTracked())
+            m_exec_conf->getMemoryTracker().retag(m_tag, tag, m_N * sizeof(T), true);
+        m_tag = tag;
         }
 
     //! Delete the host array
@@ -108,8 +126,10 @@ template<class T> class device_deleter
                 << "Freeing " << m_N * sizeof(T) << " bytes of CUDA memory." << std::endl;
 
 #ifdef ENABLE_HIP
-            hipFree(ptr);
+            MemoryPool::deallocate(ptr, m_pooled);
 #endif
+            if (isTracked())
+                m_exec_conf->getMemoryTracker().deallocate(m_tag, m_N * sizeof(T), true);
             }
         }
 
@@ -117,7 +137,15 @@ template<class T> class device_deleter
     std::shared_ptr<const ExecutionConfiguration> m_exec_conf; //!< The execution configuration
     bool m_use_device;                                         //!< Whether to use cudaMallocManaged
     size_t m_N;                                                //!< Number of elements in array
-    bool m_mapped; //!< True if this is host-mapped memory
+    bool m_mapped;     //!< True if this is host-mapped memory
+    bool m_pooled;     //!< True if this was allocated from the memory pool
+    std::string m_tag; //!< Name of the array
+
+    //! Test whether the memory tracker records this allocation
+    bool isTracked() const
+        {
+        return m_exec_conf && m_use_device && !m_mapped && m_N > 0;
+        }
     };
 
 template<class T> class host_deleter
@@ -132,9 +160,20 @@ template<class T> class host_deleter
      */
     host_deleter(std::shared_ptr<const ExecutionConfiguration> exec_conf,
                  bool use_device,
-                 const size_t N)
-        : m_exec_conf(exec_conf), m_use_device(use_device), m_N(N)
+                 const size_t N,
+                 const std::string& tag = std::string())
+        : m_exec_conf(exec_conf), m_use_device(use_device), m_N(N), m_tag(tag)
         {
+        if (m_exec_conf && m_N > 0)
+            m_exec_conf->getMemoryTracker().allocate(m_tag, m_N * sizeof(T), false);
+        }
+
+    //! Set the tag
+    void setTag(const std::string& tag)
+        {
+        if (m_exec_conf && m_N > 0)
+            m_exec_conf->getMemoryTracker().retag(m_tag, tag, m_N * sizeof(T), false);
+        m_tag = tag;
         }
 
     //! Delete the CUDA array
@@ -146,8 +185,12 @@ template<class T> class host_deleter
             return;
 
         if (m_exec_conf)
+            {
             m_exec_conf->msg->notice(10)
                 << "Freeing " << m_N * sizeof(T) << " bytes of host memory." << std::endl;
+            if (m_N > 0)
+                m_exec_conf->getMemoryTracker().deallocate(m_tag, m_N * sizeof(T), false);
+            }
 
         if (m_use_device)
             {
@@ -167,6 +210,7 @@ template<class T> class host_deleter
     std::shared_ptr<const ExecutionConfiguration> m_exec_conf; //!< The execution configuration
     bool m_use_device;                                         //!< Whether to use hostMallocManaged
     size_t m_N;                                                //!< Number of elements in array
+    std::string m_tag;                                         //!< Name of the array
     };
     } // end namespace detail
 
@@ -525,6 +569,22 @@ template<class T> class GPUArray : public GPUArrayBase<T, GPUArray<T>>
     //! Resize a 2D GPUArray
     void resize(size_t width, size_t height);
 
+    //! Set an optional tag for memory profiling
+    /*! \param tag The name of this allocation
+     */
+    void setTag(const std::string& tag)
+        {
+        m_tag = tag;
+
+        // the deleters record the allocation in the memory tracker under the tag
+        if (h_data)
+            h_data.get_deleter().setTag(tag);
+#ifdef ENABLE_HIP
+        if (d_data)
+            d_data.get_deleter().setTag(tag);
+#endif
+        }
+
     //! Return a string representation of this array
     std::string getRepresentation() const
         {
@@ -587,6 +647,16 @@ template<class T> class GPUArray : public GPUArrayBase<T, GPUArray<T>>
         return m_acquired;
         }
 
+    //! Get the modification count
+    /*! The count increases whenever the contents of the array may have changed: on every acquire
+        with a writable access mode, on swap, resize, and assignment. Compare two values to test
+        whether data derived from the array is stale.
+    */
+    uint64_t getVersion() const
+        {
+        return m_version;
+        }
+
     //! Need to be friend with dispatch
     friend class ArrayHandleDispatch<T>;
     friend class GPUArrayDispatch<T>;
@@ -603,9 +673,11 @@ template<class T> class GPUArray : public GPUArrayBase<T, GPUArray<T>>
 
     mutable bool m_acquired;                     //!< Tracks whether the data has been acquired
     mutable data_location::Enum m_data_location; //!< Tracks the current location of the data
+    mutable uint64_t m_version = 0;              //!< Modification count
 #ifdef ENABLE_HIP
     bool m_mapped; //!< True if we are using mapped memory
 #endif
+    std::string m_tag; //!< Name of the array (optional)
 
     // ok, this looks weird, but I want m_exec_conf to be protected and not have to go reorder all
     // of the initializers
@@ -813,7 +885,7 @@ GPUArray<T>::GPUArray(const GPUArray& from) noexcept
 #ifdef ENABLE_HIP
       m_mapped(from.m_mapped),
 #endif
-      m_exec_conf(from.m_exec_conf)
+      m_tag(from.m_tag), m_exec_conf(from.m_exec_conf)
     {
     // allocate and clear new memory the same size as the data in from
     allocate();
@@ -833,6 +905,7 @@ template<class T> GPUArray<T>& GPUArray<T>::operator=(const GPUArray& rhs) noexc
         {
         // sanity check
         assert(!m_acquired && !rhs.m_acquired);
+        m_version++;
 
         // copy over basic elements
         m_num_elements = rhs.m_num_elements;
@@ -842,6 +915,7 @@ template<class T> GPUArray<T>& GPUArray<T>::operator=(const GPUArray& rhs) noexc
 #ifdef ENABLE_HIP
         m_mapped = rhs.m_mapped;
 #endif
+        m_tag = rhs.m_tag;
         // initialize state variables
         m_data_location = data_location::host;
 
@@ -875,7 +949,11 @@ GPUArray<T>::GPUArray(GPUArray&& from) noexcept
       m_height(std::move(from.m_height)), m_acquired(std::move(from.m_acquired)),
       m_data_location(std::move(from.m_data_location)),
 #ifdef ENABLE_HIP
-      m_mapped(std::move(from.m_mapped)), d_data(std::move(from.d_data)),
+      m_mapped(std::move(from.m_mapped)),
+#endif
+      m_tag(std::move(from.m_tag)),
+#ifdef ENABLE_HIP
+      d_data(std::move(from.d_data)),
 #endif
       h_data(std::move(from.h_data)), m_exec_conf(std::move(from.m_exec_conf))
     {
@@ -895,8 +973,10 @@ template<class T> GPUArray<T>& GPUArray<T>::operator=(GPUArray&& rhs) noexcept
         d_data = std::move(rhs.d_data);
 #endif
         h_data = std::move(rhs.h_data);
+        m_tag = std::move(rhs.m_tag);
         m_data_location = std::move(rhs.m_data_location);
         m_acquired = std::move(rhs.m_acquired);
+        m_version++;
         }
 
     return *this;
@@ -932,6 +1012,11 @@ template<class T> void GPUArray<T>::swap(GPUArray& from)
     std::swap(m_mapped, from.m_mapped);
 #endif
     std::swap(h_data, from.h_data);
+    std::swap(m_tag, from.m_tag);
+
+    // the modification count belongs to the array object, not to its contents
+    m_version++;
+    from.m_version++;
     }
 
 /*! \pre m_num_elements is set
@@ -995,7 +1080,7 @@ template<class T> void GPUArray<T>::allocate()
 #endif
 
     // store in smart ptr with custom deleter
-    hoomd::detail::host_deleter<T> host_deleter(m_exec_conf, use_device, m_num_elements);
+    hoomd::detail::host_deleter<T> host_deleter(m_exec_conf, use_device, m_num_elements, m_tag);
     h_data = std::unique_ptr<T, hoomd::detail::host_deleter<T>>(reinterpret_cast<T*>(host_ptr),
                                                                 host_deleter);
 
@@ -1006,6 +1091,7 @@ template<class T> void GPUArray<T>::allocate()
         CHECK_CUDA_ERROR();
 
         // allocate and/or map host memory
+        bool pooled = false;
         if (m_mapped)
             {
 #ifdef ENABLE_HIP
@@ -1023,7 +1109,10 @@ template<class T> void GPUArray<T>::allocate()
         else
             {
 #ifdef ENABLE_HIP
-            hipError_t error = hipMalloc(&device_ptr, m_num_elements * sizeof(T));
+            hipError_t error
+                = m_exec_conf->getMemoryPool().allocate(&device_ptr,
+                                                        m_num_elements * sizeof(T),
+                                                        pooled);
             if (error == hipErrorMemoryAllocation)
                 {
                 throw std::bad_alloc();
@@ -1039,7 +1128,9 @@ template<class T> void GPUArray<T>::allocate()
         hoomd::detail::device_deleter<T> device_deleter(m_exec_conf,
                                                         use_device,
                                                         m_num_elements,
-                                                        m_mapped);
+                                                        m_mapped,
+                                                        pooled,
+                                                        m_tag);
         d_data
             = std::unique_ptr<T, hoomd::detail::device_deleter<T>>(reinterpret_cast<T*>(device_ptr),
                                                                    device_deleter);
@@ -1174,6 +1265,8 @@ ArrayHandleDispatch<T> GPUArray<T>::acquire(const access_location::Enum location
         throw std::runtime_error("Cannot acquire access to array in use.");
         }
     m_acquired = true;
+    if (mode != access_mode::read)
+        m_version++;
 
     // base case - handle acquiring a NULL GPUArray by simply returning NULL to prevent any memcpys
     // from being attempted
@@ -1366,7 +1459,7 @@ template<class T> T* GPUArray<T>::resizeHostArray(size_t num_elements)
 
     // update smart pointer
     bool use_device = m_exec_conf && m_exec_conf->isCUDAEnabled();
-    hoomd::detail::host_deleter<T> host_deleter(m_exec_conf, use_device, num_elements);
+    hoomd::detail::host_deleter<T> host_deleter(m_exec_conf, use_device, num_elements, m_tag);
     h_data = std::unique_ptr<T, hoomd::detail::host_deleter<T>>(h_tmp, host_deleter);
 
 #ifdef ENABLE_HIP
@@ -1434,7 +1527,10 @@ T* GPUArray<T>::resize2DHostArray(size_t pitch, size_t new_pitch, size_t height,
 
     // update smart pointer
     bool use_device = m_exec_conf && m_exec_conf->isCUDAEnabled();
-    hoomd::detail::host_deleter<T> host_deleter(m_exec_conf, use_device, new_pitch * new_height);
+    hoomd::detail::host_deleter<T> host_deleter(m_exec_conf,
+                                                use_device,
+                                                new_pitch * new_height,
+                                                m_tag);
     h_data = std::unique_ptr<T, hoomd::detail::host_deleter<T>>(h_tmp, host_deleter);
 
 #ifdef ENABLE_HIP
@@ -1475,8 +1571,10 @@ template<class T> T* GPUArray<T>::resizeDeviceArray(size_t num_elements)
 
     // allocate resized array
     T* d_tmp;
+    bool pooled = false;
 #ifdef ENABLE_HIP
-    hipError_t error = hipMalloc(&d_tmp, num_elements * sizeof(T));
+    hipError_t error
+        = m_exec_conf->getMemoryPool().allocate((void**)&d_tmp, num_elements * sizeof(T), pooled);
     if (error == hipErrorMemoryAllocation)
         {
         throw std::bad_alloc();
@@ -1506,7 +1604,9 @@ template<class T> T* GPUArray<T>::resizeDeviceArray(size_t num_elements)
     hoomd::detail::device_deleter<T> device_deleter(m_exec_conf,
                                                     m_exec_conf->isCUDAEnabled(),
                                                     num_elements,
-                                                    m_mapped);
+                                                    m_mapped,
+                                                    pooled,
+                                                    m_tag);
     d_data = std::unique_ptr<T, hoomd::detail::device_deleter<T>>(d_tmp, device_deleter);
 
     return d_data.get();
@@ -1534,8 +1634,11 @@ T* GPUArray<T>::resize2DDeviceArray(size_t pitch,
 
     // allocate resized array
     T* d_tmp;
+    bool pooled = false;
 #ifdef ENABLE_HIP
-    hipError_t error = hipMalloc(&d_tmp, new_pitch * new_height * sizeof(T));
+    hipError_t error = m_exec_conf->getMemoryPool().allocate((void**)&d_tmp,
+                                                             new_pitch * new_height * sizeof(T),
+                                                             pooled);
     if (error == hipErrorMemoryAllocation)
         {
         throw std::bad_alloc();
@@ -1573,7 +1676,9 @@ T* GPUArray<T>::resize2DDeviceArray(size_t pitch,
     hoomd::detail::device_deleter<T> device_deleter(m_exec_conf,
                                                     m_exec_conf->isCUDAEnabled(),
                                                     new_pitch * new_height,
-                                                    m_mapped);
+                                                    m_mapped,
+                                                    pooled,
+                                                    m_tag);
     d_data = std::unique_ptr<T, hoomd::detail::device_deleter<T>>(d_tmp, device_deleter);
 
     return d_data.get();
@@ -1592,6 +1697,7 @@ template<class T> void GPUArray<T>::resize(size_t num_elements)
     {
     assert(!m_acquired);
     assert(num_elements > 0);
+    m_version++;
 
     // if not allocated, simply allocate
     if (isNull())
@@ -1632,6 +1738,7 @@ template<class T> void GPUArray<T>::resize(size_t num_elements)
 template<class T> void GPUArray<T>::resize(size_t width, size_t height)
     {
     assert(!m_acquired);
+    m_version++;
 
     // make m_pitch the next multiple of 16 larger or equal to the given width
     size_t new_pitch = (width + (16 - (width & 15)));
@@ -4,6 +4,10 @@
 #include "GSDDequeWriter.h"
 #include "hoomd/GSDDumpWriter.h"
 
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
 namespace hoomd
     {
 GSDDequeWriter::GSDDequeWriter(std::shared_ptr<SystemDefinition> sysdef,
@@ -14,9 +18,25 @@ GSDDequeWriter::GSDDequeWriter(std::shared_ptr<SystemDefinition> sysdef,
                                int queue_size,
                                std::string mode,
                                bool write_at_init,
-                               uint64_t timestep)
-    : GSDDumpWriter(sysdef, trigger, fname, group, mode), m_queue_size(queue_size)
+                               uint64_t timestep,
+                               bool device_buffer)
+    : GSDDumpWriter(sysdef, trigger, fname, group, mode), m_queue_size(queue_size),
+      m_device_buffer(device_buffer)
     {
+    if (m_device_buffer)
+        {
+        if (m_queue_size <= 0)
+            {
+            throw std::runtime_error("The device buffer requires a positive max_burst_size.");
+            }
+        m_device_frames.resize(m_queue_size);
+        for (unsigned int i = 0; i < m_device_frames.size(); ++i)
+            {
+            allocateDeviceFrame(m_device_frames[i]);
+            m_free_slots.push_back(static_cast<unsigned int>(m_device_frames.size()) - 1 - i);
+            }
+        }
+
     setLogWriter(logger);
     bool file_empty = true;
 #ifdef ENABLE_MPI
@@ -49,6 +69,28 @@ GSDDequeWriter::GSDDequeWriter(std::shared_ptr<SystemDefinition> sysdef,
 
 void GSDDequeWriter::analyze(uint64_t timestep)
     {
+    pybind11::gil_scoped_acquire gil;
+    if (m_device_buffer)
+        {
+        // reuse the slot of the oldest frame when all slots are full
+        unsigned int slot;
+        if (m_free_slots.empty())
+            {
+            slot = m_device_queue.back();
+            m_device_queue.pop_back();
+            m_log_queue.pop_back();
+            }
+        else
+            {
+            slot = m_free_slots.back();
+            m_free_slots.pop_back();
+            }
+        captureDeviceFrame(m_device_frames[slot], timestep);
+        m_device_queue.push_front(slot);
+        m_log_queue.push_front(getLogData());
+        return;
+        }
+
     m_frame_queue.emplace_front();
     populateLocalFrame(m_frame_queue.front(), timestep);
     m_log_queue.push_front(getLogData());
@@ -61,6 +103,18 @@ void GSDDequeWriter::analyze(uint64_t timestep)
 
 void GSDDequeWriter::dump()
     {
+    if (m_device_buffer)
+        {
+        for (auto i {static_cast<long int>(m_device_queue.size()) - 1}; i >= 0; --i)
+            {
+            writeDeviceFrame(m_device_frames[m_device_queue[i]], m_log_queue[i]);
+            m_free_slots.push_back(m_device_queue[i]);
+            }
+        m_device_queue.clear();
+        m_log_queue.clear();
+        return;
+        }
+
     for (auto i {static_cast<long int>(m_frame_queue.size()) - 1}; i >= 0; --i)
         {
         write(m_frame_queue[i], m_log_queue[i]);
@@ -76,11 +130,46 @@ int GSDDequeWriter::getMaxQueueSize() const
 
 size_t GSDDequeWriter::getCurrentQueueSize() const
     {
+    if (m_device_buffer)
+        {
+        return m_device_queue.size();
+        }
     return m_frame_queue.size();
     }
 
 void GSDDequeWriter::setMaxQueueSize(int new_max_size)
     {
+    if (m_device_buffer)
+        {
+        if (new_max_size <= 0)
+            {
+            throw std::runtime_error("The device buffer requires a positive max_burst_size.");
+            }
+        m_queue_size = new_max_size;
+        while (static_cast<size_t>(m_queue_size) < m_device_queue.size())
+            {
+            m_free_slots.push_back(m_device_queue.back());
+            m_device_queue.pop_back();
+            m_log_queue.pop_back();
+            }
+
+        // move the stored frames to the first slots and allocate the rest
+        std::vector<DeviceFrame> frames(m_queue_size);
+        for (unsigned int i = 0; i < m_device_queue.size(); ++i)
+            {
+            frames[i] = std::move(m_device_frames[m_device_queue[i]]);
+            m_device_queue[i] = i;
+            }
+        m_free_slots.clear();
+        for (unsigned int i = m_queue_size; i > m_device_queue.size(); --i)
+            {
+            allocateDeviceFrame(frames[i - 1]);
+            m_free_slots.push_back(i - 1);
+            }
+        m_device_frames.swap(frames);
+        return;
+        }
+
     m_queue_size = new_max_size;
     if (m_queue_size == -1)
         {
@@ -93,6 +182,176 @@ void GSDDequeWriter::setMaxQueueSize(int new_max_size)
         }
     }
 
+/*! \param device_frame Frame slot to allocate
+
+    Only the arrays of the fields that the next frame writes are allocated. The arrays grow when
+    a frame with more particles is captured.
+*/
+void GSDDequeWriter::allocateDeviceFrame(DeviceFrame& device_frame)
+    {
+    const unsigned int max_N = m_pdata->getMaxN();
+    auto allocate = [&](auto& array, bool needed)
+    {
+        if (needed && array.getNumElements() < max_N)
+            {
+            std::remove_reference_t<decltype(array)> tmp(max_N, m_exec_conf);
+            array.swap(tmp);
+            }
+    };
+
+    allocate(device_frame.tag, true);
+    const bool write_postype = isFieldWritten(gsd_flag::particles_position)
+                               || isFieldWritten(gsd_flag::particles_type)
+                               || isFieldWritten(gsd_flag::particles_image);
+    allocate(device_frame.postype, write_postype);
+    allocate(device_frame.image, write_postype);
+    allocate(device_frame.orientation, isFieldWritten(gsd_flag::particles_orientation));
+    allocate(device_frame.vel,
+             isFieldWritten(gsd_flag::particles_velocity)
+                 || isFieldWritten(gsd_flag::particles_mass));
+    allocate(device_frame.charge, isFieldWritten(gsd_flag::particles_charge));
+    allocate(device_frame.diameter, isFieldWritten(gsd_flag::particles_diameter));
+    allocate(device_frame.body, isFieldWritten(gsd_flag::particles_body));
+    allocate(device_frame.inertia, isFieldWritten(gsd_flag::particles_inertia));
+    allocate(device_frame.angmom, isFieldWritten(gsd_flag::particles_angmom));
+    }
+
+/*! \param src Particle array to copy
+    \param dst Array of a frame slot to copy to, which grows to hold \a N elements
+    \param N Number of elements to copy
+*/
+template<class T, class Array>
+void GSDDequeWriter::copyToSlot(const Array& src, GPUArray<T>& dst, unsigned int N)
+    {
+    if (dst.getNumElements() < N)
+        {
+        GPUArray<T> tmp(N, m_exec_conf);
+        dst.swap(tmp);
+        }
+    if (N == 0)
+        return;
+
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        ArrayHandle<T> d_src(src, access_location::device, access_mode::read);
+        ArrayHandle<T> d_dst(dst, access_location::device, access_mode::overwrite);
+        hipMemcpy(d_dst.data, d_src.data, sizeof(T) * N, hipMemcpyDeviceToDevice);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        return;
+        }
+#endif
+
+    ArrayHandle<T> h_src(src, access_location::host, access_mode::read);
+    ArrayHandle<T> h_dst(dst, access_location::host, access_mode::overwrite);
+    std::copy(h_src.data, h_src.data + N, h_dst.data);
+    }
+
+/*! \param device_frame Frame slot to copy the particle arrays to
+    \param timestep Current timestep
+
+    Only the arrays of the fields that the frame writes are copied.
+*/
+void GSDDequeWriter::captureDeviceFrame(DeviceFrame& device_frame, uint64_t timestep)
+    {
+    const unsigned int N = m_pdata->getN();
+    device_frame.timestep = timestep;
+    device_frame.global_box = m_pdata->getGlobalBox();
+    device_frame.origin = m_pdata->getOrigin();
+    device_frame.N = N;
+
+    copyToSlot(m_pdata->getTags(), device_frame.tag, N);
+    if (isFieldWritten(gsd_flag::particles_position) || isFieldWritten(gsd_flag::particles_type)
+        || isFieldWritten(gsd_flag::particles_image))
+        {
+        copyToSlot(m_pdata->getPositions(), device_frame.postype, N);
+        copyToSlot(m_pdata->getImages(), device_frame.image, N);
+        }
+    if (isFieldWritten(gsd_flag::particles_orientation))
+        {
+        copyToSlot(m_pdata->getOrientationArray(), device_frame.orientation, N);
+        }
+    if (isFieldWritten(gsd_flag::particles_velocity) || isFieldWritten(gsd_flag::particles_mass))
+        {
+        copyToSlot(m_pdata->getVelocities(), device_frame.vel, N);
+        }
+    if (isFieldWritten(gsd_flag::particles_charge))
+        {
+        copyToSlot(m_pdata->getCharges(), device_frame.charge, N);
+        }
+    if (isFieldWritten(gsd_flag::particles_diameter))
+        {
+        copyToSlot(m_pdata->getDiameters(), device_frame.diameter, N);
+        }
+    if (isFieldWritten(gsd_flag::particles_body))
+        {
+        copyToSlot(m_pdata->getBodies(), device_frame.body, N);
+        }
+    if (isFieldWritten(gsd_flag::particles_inertia))
+        {
+        copyToSlot(m_pdata->getMomentsOfInertiaArray(), device_frame.inertia, N);
+        }
+    if (isFieldWritten(gsd_flag::particles_angmom))
+        {
+        copyToSlot(m_pdata->getAngularMomentumArray(), device_frame.angmom, N);
+        }
+    }
+
+/*! \param device_frame Frame slot to write
+    \param log_data Logged quantities of the frame
+*/
+void GSDDequeWriter::writeDeviceFrame(const DeviceFrame& device_frame, pybind11::dict log_data)
+    {
+    const unsigned int N = device_frame.N;
+    LocalParticleArrays arrays;
+    arrays.N = N;
+    arrays.origin = device_frame.origin;
+
+    ArrayHandle<unsigned int> h_tag(device_frame.tag, access_location::host, access_mode::read);
+    arrays.tag = h_tag.data;
+
+    // map the tags of the group at the time of the dump to the particles in the frame
+    std::vector<unsigned int> rtag(m_pdata->getRTags().getNumElements(), NOT_LOCAL);
+    for (unsigned int i = 0; i < N; ++i)
+        {
+        if (h_tag.data[i] >= rtag.size())
+            {
+            rtag.resize(h_tag.data[i] + 1, NOT_LOCAL);
+            }
+        rtag[h_tag.data[i]] = i;
+        }
+    arrays.rtag = rtag.data();
+
+    // the fields that were not copied have no elements and are not read
+    ArrayHandle<Scalar4> h_postype(device_frame.postype, access_location::host, access_mode::read);
+    ArrayHandle<int3> h_image(device_frame.image, access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(device_frame.orientation,
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<Scalar4> h_vel(device_frame.vel, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(device_frame.charge, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_diameter(device_frame.diameter,
+                                   access_location::host,
+                                   access_mode::read);
+    ArrayHandle<unsigned int> h_body(device_frame.body, access_location::host, access_mode::read);
+    ArrayHandle<Scalar3> h_inertia(device_frame.inertia, access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_angmom(device_frame.angmom, access_location::host, access_mode::read);
+    arrays.postype = h_postype.data;
+    arrays.image = h_image.data;
+    arrays.orientation = h_orientation.data;
+    arrays.vel = h_vel.data;
+    arrays.charge = h_charge.data;
+    arrays.diameter = h_diameter.data;
+    arrays.body = h_body.data;
+    arrays.inertia = h_inertia.data;
+    arrays.angmom = h_angmom.data;
+
+    GSDFrame frame;
+    populateLocalFrame(frame, device_frame.timestep, device_frame.global_box, arrays);
+    write(frame, log_data);
+    }
+
 namespace detail
     {
 void export_GSDDequeWriter(pybind11::module& m)
@@ -108,10 +367,12 @@ void export_GSDDequeWriter(pybind11::module& m)
                             int,
                             std::string,
                             bool,
-                            uint64_t>())
+                            uint64_t,
+                            bool>())
         .def_property("max_burst_size",
                       &GSDDequeWriter::getMaxQueueSize,
                       &GSDDequeWriter::setMaxQueueSize)
+        .def_property_readonly("device_buffer", &GSDDequeWriter::getDeviceBuffer)
         .def("__len__", &GSDDequeWriter::getCurrentQueueSize)
         .def("dump", &GSDDequeWriter::dump);
     }
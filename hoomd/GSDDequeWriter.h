@@ -8,13 +8,24 @@
 #endif
 
 #include <deque>
+#include <vector>
 
 #include <pybind11/pybind11.h>
 
+#include "GPUArray.h"
 #include "GSDDumpWriter.h"
 
 namespace hoomd
     {
+/// Store the last frames in a buffer and write them to a GSD file on demand
+/** By default, each frame is captured as a host-side GSDFrame. With the device buffer, the
+    particle arrays that the frames write are instead copied into a fixed number of preallocated
+    slots in device memory, and the frames are only copied to the host and written in dump(). The
+    logged quantities are still kept on the host.
+
+    The device buffer holds the local particles unsorted, so the frames are sorted by tag (and
+    filtered by the group) in dump().
+*/
 class PYBIND11_EXPORT GSDDequeWriter : public GSDDumpWriter
     {
     public:
@@ -26,7 +37,8 @@ class PYBIND11_EXPORT GSDDequeWriter : public GSDDumpWriter
                    int queue_size,
                    std::string mode,
                    bool write_on_init,
-                   uint64_t timestep);
+                   uint64_t timestep,
+                   bool device_buffer = false);
     ~GSDDequeWriter() = default;
 
     void analyze(uint64_t timestep) override;
@@ -38,10 +50,60 @@ class PYBIND11_EXPORT GSDDequeWriter : public GSDDumpWriter
 
     size_t getCurrentQueueSize() const;
 
+    /// Check whether the frames are buffered in device memory
+    bool getDeviceBuffer() const
+        {
+        return m_device_buffer;
+        }
+
     protected:
     int m_queue_size;
     std::deque<GSDDumpWriter::GSDFrame> m_frame_queue;
     std::deque<pybind11::dict> m_log_queue;
+
+    /// Copies of the local particle arrays of one frame
+    struct DeviceFrame
+        {
+        uint64_t timestep = 0;
+        BoxDim global_box;
+        Scalar3 origin = make_scalar3(0, 0, 0);
+        unsigned int N = 0;
+        GPUArray<unsigned int> tag;
+        GPUArray<Scalar4> postype;
+        GPUArray<int3> image;
+        GPUArray<Scalar4> orientation;
+        GPUArray<Scalar4> vel;
+        GPUArray<Scalar> charge;
+        GPUArray<Scalar> diameter;
+        GPUArray<unsigned int> body;
+        GPUArray<Scalar3> inertia;
+        GPUArray<Scalar4> angmom;
+        };
+
+    /// True when the frames are buffered in device memory
+    bool m_device_buffer;
+
+    /// Preallocated frame slots of the device buffer
+    std::vector<DeviceFrame> m_device_frames;
+
+    /// Slots that hold frames, newest first
+    std::deque<unsigned int> m_device_queue;
+
+    /// Slots that hold no frame
+    std::vector<unsigned int> m_free_slots;
+
+    /// Allocate the arrays of a frame slot of the device buffer
+    void allocateDeviceFrame(DeviceFrame& device_frame);
+
+    /// Copy the current particle arrays into a slot of the device buffer
+    void captureDeviceFrame(DeviceFrame& device_frame, uint64_t timestep);
+
+    /// Copy the first N elements of a particle array into an array of a frame slot
+    template<class T, class Array>
+    void copyToSlot(const Array& src, GPUArray<T>& dst, unsigned int N);
+
+    /// Write a frame held in the device buffer
+    void writeDeviceFrame(const DeviceFrame& device_frame, pybind11::dict log_data);
     };
 
 namespace detail
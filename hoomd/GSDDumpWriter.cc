@@ -13,8 +13,10 @@
 #include <pybind11/numpy.h>
 #include <pybind11/stl_bind.h>
 
+#include <cmath>
 #include <limits>
 #include <list>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string.h>
@@ -23,6 +25,21 @@ using namespace hoomd::detail;
 
 namespace hoomd
     {
+namespace
+    {
+/// Get the power of two grid spacing for values written with a given precision (0 for none)
+Scalar getQuantizationStep(Scalar precision)
+    {
+    return precision > 0 ? std::exp2(std::floor(std::log2(precision))) : Scalar(0);
+    }
+
+/// Round \a x to the nearest multiple of \a step
+inline Scalar quantize(Scalar x, Scalar step)
+    {
+    return std::round(x / step) * step;
+    }
+    } // end namespace
+
 std::list<std::string> GSDDumpWriter::particle_chunks {"particles/position",
                                                        "particles/typeid",
                                                        "particles/mass",
@@ -148,6 +165,9 @@ pybind11::tuple GSDDumpWriter::getDynamic()
 
 void GSDDumpWriter::setDynamic(pybind11::object dynamic)
     {
+    // the background thread reads the dynamic flags
+    finishAsyncWrites();
+
     pybind11::list dynamic_list = dynamic;
     m_dynamic.reset();
     m_write_topology = false;
@@ -220,6 +240,8 @@ void GSDDumpWriter::setDynamic(pybind11::object dynamic)
 
 void GSDDumpWriter::flush()
     {
+    finishAsyncWrites();
+
     if (m_exec_conf->isRoot())
         {
         m_exec_conf->msg->notice(5) << "GSD: flush gsd file " << m_fname << endl;
@@ -230,6 +252,8 @@ void GSDDumpWriter::flush()
 
 void GSDDumpWriter::setMaximumWriteBufferSize(uint64_t size)
     {
+    finishAsyncWrites();
+
     if (m_exec_conf->isRoot())
         {
         int retval = gsd_set_maximum_write_buffer_size(&m_handle, size);
@@ -243,6 +267,8 @@ void GSDDumpWriter::setMaximumWriteBufferSize(uint64_t size)
 
 uint64_t GSDDumpWriter::getMaximumWriteBufferSize()
     {
+    finishAsyncWrites();
+
     if (m_exec_conf->isRoot())
         {
         return gsd_get_maximum_write_buffer_size(&m_handle);
@@ -325,6 +351,15 @@ GSDDumpWriter::~GSDDumpWriter()
     {
     m_exec_conf->msg->notice(5) << "Destroying GSDDumpWriter" << endl;
 
+    try
+        {
+        stopAsyncThread();
+        }
+    catch (const std::exception& e)
+        {
+        m_exec_conf->msg->error() << "GSD: error writing " << m_fname << ": " << e.what() << endl;
+        }
+
     if (m_exec_conf->isRoot())
         {
         m_exec_conf->msg->notice(5) << "GSD: close gsd file " << m_fname << endl;
@@ -351,11 +386,14 @@ pybind11::dict GSDDumpWriter::getLogData() const
 void GSDDumpWriter::analyze(uint64_t timestep)
     {
     Analyzer::analyze(timestep);
+    pybind11::gil_scoped_acquire gil;
     int retval;
 
     // truncate the file if requested
     if (m_truncate)
         {
+        finishAsyncWrites();
+
         if (m_exec_conf->isRoot())
             {
             m_exec_conf->msg->notice(10) << "GSD: truncating file" << endl;
@@ -368,57 +406,283 @@ void GSDDumpWriter::analyze(uint64_t timestep)
 
     populateLocalFrame(m_local_frame, timestep);
     auto log_data = getLogData();
-    write(m_local_frame, log_data);
+
+    // the first frame determines the non-default quantities that populateLocalFrame checks
+    bool parallel_io = false;
+#ifdef ENABLE_MPI
+    parallel_io = m_parallel_io && m_sysdef->isDomainDecomposed();
+#endif
+    if (m_async_queue_size > 0 && m_nframes > 0 && !parallel_io)
+        {
+        queueFrame(log_data);
+        }
+    else
+        {
+        write(m_local_frame, log_data);
+        }
     }
 
 void GSDDumpWriter::write(GSDDumpWriter::GSDFrame& frame, pybind11::dict log_data)
     {
+    // write frames in order
+    finishAsyncWrites();
+
+    frame.frame_number = m_nframes;
+    frame.N = m_group->getNumMembersGlobal();
+
+    // topology is only meaningful if this is the all group
+    bool write_topology = m_group->getNumMembersGlobal() == m_pdata->getNGlobal()
+                          && (m_write_topology || m_nframes == 0);
+
 #ifdef ENABLE_MPI
-    if (m_sysdef->isDomainDecomposed())
+    if (m_sysdef->isDomainDecomposed() && m_parallel_io)
+        {
+        writeParallelFrame(frame, log_data, write_topology);
+        }
+    else if (m_sysdef->isDomainDecomposed())
         {
         gatherGlobalFrame(frame);
 
         if (m_exec_conf->isRoot())
             {
-            writeFrameHeader(m_global_frame);
-            writeAttributes(m_global_frame);
-            writeProperties(m_global_frame);
-            writeMomenta(m_global_frame);
-            writeLogQuantities(log_data);
+            // the topology in the local frame is global
+            std::swap(m_global_frame.bond_data, frame.bond_data);
+            std::swap(m_global_frame.angle_data, frame.angle_data);
+            std::swap(m_global_frame.dihedral_data, frame.dihedral_data);
+            std::swap(m_global_frame.improper_data, frame.improper_data);
+            std::swap(m_global_frame.constraint_data, frame.constraint_data);
+            std::swap(m_global_frame.pair_data, frame.pair_data);
+
+            writeFrame(m_global_frame, getLogChunks(log_data), write_topology);
             }
         }
     else
 #endif
         {
-        writeFrameHeader(frame);
-        writeAttributes(frame);
-        writeProperties(frame);
-        writeMomenta(frame);
-        writeLogQuantities(log_data);
+        writeFrame(frame, getLogChunks(log_data), write_topology);
         }
-    // topology is only meaningful if this is the all group
-    if (m_group->getNumMembersGlobal() == m_pdata->getNGlobal()
-        && (m_write_topology || m_nframes == 0))
+
+    m_nframes++;
+    }
+
+/*! \param frame Frame to write, in ascending tag order over the whole group
+    \param log_chunks Logged quantities to write in the frame
+    \param write_topology True when the topology should be written
+
+    Only the root rank may call writeFrame().
+*/
+void GSDDumpWriter::writeFrame(GSDDumpWriter::GSDFrame& frame,
+                               const std::vector<GSDLogChunk>& log_chunks,
+                               bool write_topology)
+    {
+    writeFrameHeader(frame);
+    writeAttributes(frame);
+    writeProperties(frame);
+    writeMomenta(frame);
+    writeLogChunks(log_chunks);
+
+    if (write_topology)
+        {
+        writeTopology(frame.bond_data,
+                      frame.angle_data,
+                      frame.dihedral_data,
+                      frame.improper_data,
+                      frame.constraint_data,
+                      frame.pair_data);
+        }
+
+    m_exec_conf->msg->notice(10) << "GSD: ending frame" << endl;
+    int retval = gsd_end_frame(&m_handle);
+    GSDUtils::checkError(retval, m_fname);
+    }
+
+/*! \param log_data Logged quantities of the frame in m_local_frame
+
+    Gather m_local_frame on the calling thread, then move it (on the root rank) to the queue. Block
+    while the queue is full.
+*/
+void GSDDumpWriter::queueFrame(pybind11::dict log_data)
+    {
+    rethrowAsyncError();
+
+    GSDAsyncFrame async_frame;
+    async_frame.write_topology = m_group->getNumMembersGlobal() == m_pdata->getNGlobal()
+                                 && (m_write_topology || m_nframes == 0);
+    m_local_frame.frame_number = m_nframes;
+    m_local_frame.N = m_group->getNumMembersGlobal();
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
         {
+        gatherGlobalFrame(m_local_frame);
+
         if (m_exec_conf->isRoot())
             {
-            writeTopology(frame.bond_data,
-                          frame.angle_data,
-                          frame.dihedral_data,
-                          frame.improper_data,
-                          frame.constraint_data,
-                          frame.pair_data);
+            // the topology in the local frame is global
+            std::swap(m_global_frame.bond_data, m_local_frame.bond_data);
+            std::swap(m_global_frame.angle_data, m_local_frame.angle_data);
+            std::swap(m_global_frame.dihedral_data, m_local_frame.dihedral_data);
+            std::swap(m_global_frame.improper_data, m_local_frame.improper_data);
+            std::swap(m_global_frame.constraint_data, m_local_frame.constraint_data);
+            std::swap(m_global_frame.pair_data, m_local_frame.pair_data);
+            std::swap(async_frame.frame, m_global_frame);
             }
         }
-
-    if (m_exec_conf->isRoot())
+    else
+#endif
         {
-        m_exec_conf->msg->notice(10) << "GSD: ending frame" << endl;
-        int retval = gsd_end_frame(&m_handle);
-        GSDUtils::checkError(retval, m_fname);
+        std::swap(async_frame.frame, m_local_frame);
         }
 
     m_nframes++;
+
+    if (!m_exec_conf->isRoot())
+        return;
+
+    async_frame.log_chunks = getLogChunks(log_data);
+
+    if (!m_async_thread.joinable())
+        {
+        m_async_stop = false;
+        m_async_thread = std::thread(&GSDDumpWriter::asyncWriteLoop, this);
+        }
+
+        {
+        std::unique_lock<std::mutex> lock(m_async_mutex);
+        m_async_cv.wait(lock,
+                        [this]
+                        { return m_async_queue.size() < m_async_queue_size || m_async_error; });
+        if (!m_async_error)
+            {
+            m_async_queue.push_back(std::move(async_frame));
+            }
+        }
+    m_async_cv.notify_all();
+
+    rethrowAsyncError();
+    }
+
+void GSDDumpWriter::asyncWriteLoop()
+    {
+    std::unique_lock<std::mutex> lock(m_async_mutex);
+    while (true)
+        {
+        m_async_cv.wait(lock, [this] { return m_async_stop || !m_async_queue.empty(); });
+        if (m_async_queue.empty())
+            {
+            return;
+            }
+
+        // the front frame stays in the queue while it is written so that the queue size bounds
+        // the memory in use
+        GSDAsyncFrame& async_frame = m_async_queue.front();
+        bool failed = bool(m_async_error);
+        lock.unlock();
+
+        std::exception_ptr error;
+        if (!failed)
+            {
+            try
+                {
+                writeFrame(async_frame.frame, async_frame.log_chunks, async_frame.write_topology);
+                }
+            catch (...)
+                {
+                error = std::current_exception();
+                }
+            }
+
+        lock.lock();
+        if (error)
+            {
+            m_async_error = error;
+            }
+        m_async_queue.pop_front();
+        m_async_cv.notify_all();
+        }
+    }
+
+void GSDDumpWriter::finishAsyncWrites()
+    {
+    if (!m_async_thread.joinable())
+        return;
+
+        {
+        std::unique_lock<std::mutex> lock(m_async_mutex);
+        m_async_cv.wait(lock, [this] { return m_async_queue.empty(); });
+        }
+
+    rethrowAsyncError();
+    }
+
+void GSDDumpWriter::stopAsyncThread()
+    {
+    if (!m_async_thread.joinable())
+        return;
+
+        {
+        std::lock_guard<std::mutex> lock(m_async_mutex);
+        m_async_stop = true;
+        }
+    m_async_cv.notify_all();
+    m_async_thread.join();
+
+    rethrowAsyncError();
+    }
+
+void GSDDumpWriter::rethrowAsyncError()
+    {
+    std::exception_ptr error;
+        {
+        std::lock_guard<std::mutex> lock(m_async_mutex);
+        std::swap(error, m_async_error);
+        }
+
+    if (error)
+        {
+        std::rethrow_exception(error);
+        }
+    }
+
+/*! \param size Maximum number of frames waiting for the background thread. 0 writes the frames
+        synchronously in analyze().
+*/
+void GSDDumpWriter::setAsyncQueueSize(unsigned int size)
+    {
+    if (size == 0)
+        {
+        stopAsyncThread();
+        }
+    m_async_queue_size = size;
+    }
+
+/*! \param precision Maximum spacing between the written values. 0 writes full precision.
+
+    Rounding to a power of two zeroes the trailing mantissa bits, so the error is at most half of
+    \a precision.
+*/
+void GSDDumpWriter::setPositionPrecision(Scalar precision)
+    {
+    if (precision < 0)
+        {
+        m_exec_conf->msg->error() << "GSD: position precision must be non-negative" << endl;
+        throw std::invalid_argument("Invalid GSD position precision");
+        }
+    m_position_precision = precision;
+    m_position_step = getQuantizationStep(precision);
+    }
+
+/*! \param precision Maximum spacing between the written values. 0 writes full precision.
+ */
+void GSDDumpWriter::setVelocityPrecision(Scalar precision)
+    {
+    if (precision < 0)
+        {
+        m_exec_conf->msg->error() << "GSD: velocity precision must be non-negative" << endl;
+        throw std::invalid_argument("Invalid GSD velocity precision");
+        }
+    m_velocity_precision = precision;
+    m_velocity_step = getQuantizationStep(precision);
     }
 
 void GSDDumpWriter::writeTypeMapping(std::string chunk, std::vector<std::string> type_mapping)
@@ -462,7 +726,7 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
                              (void*)&frame.timestep);
     GSDUtils::checkError(retval, m_fname);
 
-    if (m_nframes == 0)
+    if (frame.frame_number == 0)
         {
         m_exec_conf->msg->notice(10) << "GSD: writing configuration/dimensions" << endl;
         uint8_t dimensions = (uint8_t)m_sysdef->getNDimensions();
@@ -476,7 +740,7 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
         GSDUtils::checkError(retval, m_fname);
         }
 
-    if (m_nframes == 0 || m_dynamic[gsd_flag::configuration_box])
+    if (frame.frame_number == 0 || m_dynamic[gsd_flag::configuration_box])
         {
         m_exec_conf->msg->notice(10) << "GSD: writing configuration/box" << endl;
         float box_a[6];
@@ -496,10 +760,10 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
         GSDUtils::checkError(retval, m_fname);
         }
 
-    if (m_nframes == 0 || m_dynamic[gsd_flag::particles_N])
+    if (frame.frame_number == 0 || m_dynamic[gsd_flag::particles_N])
         {
         m_exec_conf->msg->notice(10) << "GSD: writing particles/N" << endl;
-        uint32_t N = m_group->getNumMembersGlobal();
+        uint32_t N = frame.N;
         retval = gsd_write_chunk(&m_handle, "particles/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
         GSDUtils::checkError(retval, m_fname);
         }
@@ -510,10 +774,10 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
 */
 void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
     {
-    uint32_t N = m_group->getNumMembersGlobal();
+    uint32_t N = frame.N;
     int retval;
 
-    if (m_dynamic[gsd_flag::particles_types] || m_nframes == 0)
+    if (m_dynamic[gsd_flag::particles_types] || frame.frame_number == 0)
         {
         writeTypeMapping("particles/types", frame.particle_data.type_mapping);
         }
@@ -531,7 +795,7 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.type.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.frame_number == 0)
             m_nondefault["particles/typeid"] = true;
         }
 
@@ -548,7 +812,7 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.mass.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.frame_number == 0)
             m_nondefault["particles/mass"] = true;
         }
 
@@ -565,7 +829,7 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.charge.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.frame_number == 0)
             m_nondefault["particles/charge"] = true;
         }
 
@@ -584,7 +848,7 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
                                      0,
                                      (void*)frame.particle_data.diameter.data());
             GSDUtils::checkError(retval, m_fname);
-            if (m_nframes == 0)
+            if (frame.frame_number == 0)
                 m_nondefault["particles/diameter"] = true;
             }
         }
@@ -602,7 +866,7 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.body.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.frame_number == 0)
             m_nondefault["particles/body"] = true;
         }
 
@@ -619,7 +883,7 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.inertia.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.frame_number == 0)
             m_nondefault["particles/moment_inertia"] = true;
         }
     }
@@ -628,7 +892,7 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
  */
 void GSDDumpWriter::writeProperties(const GSDDumpWriter::GSDFrame& frame)
     {
-    uint32_t N = m_group->getNumMembersGlobal();
+    uint32_t N = frame.N;
     int retval;
 
     if (frame.particle_data.pos.size() != 0)
@@ -644,7 +908,7 @@ void GSDDumpWriter::writeProperties(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.pos.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.frame_number == 0)
             m_nondefault["particles/position"] = true;
         }
 
@@ -661,7 +925,7 @@ void GSDDumpWriter::writeProperties(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.orientation.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.frame_number == 0)
             m_nondefault["particles/orientation"] = true;
         }
     }
@@ -670,7 +934,7 @@ void GSDDumpWriter::writeProperties(const GSDDumpWriter::GSDFrame& frame)
  */
 void GSDDumpWriter::writeMomenta(const GSDDumpWriter::GSDFrame& frame)
     {
-    uint32_t N = m_group->getNumMembersGlobal();
+    uint32_t N = frame.N;
     int retval;
 
     if (frame.particle_data.vel.size() != 0)
@@ -686,7 +950,7 @@ void GSDDumpWriter::writeMomenta(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.vel.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.frame_number == 0)
             m_nondefault["particles/velocity"] = true;
         }
 
@@ -703,7 +967,7 @@ void GSDDumpWriter::writeMomenta(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.angmom.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.frame_number == 0)
             m_nondefault["particles/angmom"] = true;
         }
 
@@ -720,7 +984,7 @@ void GSDDumpWriter::writeMomenta(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.image.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.frame_number == 0)
             m_nondefault["particles/image"] = true;
         }
     }
@@ -927,10 +1191,19 @@ void GSDDumpWriter::writeTopology(BondData::Snapshot& bond,
 
 void GSDDumpWriter::writeLogQuantities(pybind11::dict dict)
     {
+    writeLogChunks(getLogChunks(dict));
+    }
+
+/*! \param dict Logged quantities, keyed by chunk name
+
+    Copy the data so that the GSD chunks can be written without holding the GIL.
+*/
+std::vector<GSDDumpWriter::GSDLogChunk> GSDDumpWriter::getLogChunks(pybind11::dict dict)
+    {
+    std::vector<GSDLogChunk> log_chunks;
     for (auto key_iter = dict.begin(); key_iter != dict.end(); ++key_iter)
         {
         std::string name = pybind11::cast<std::string>(key_iter->first);
-        m_exec_conf->msg->notice(10) << "GSD: writing " << name << endl;
 
         pybind11::array arr = pybind11::array::ensure(key_iter->second, pybind11::array::c_style);
         gsd_type type = GSD_TYPE_UINT8;
@@ -1012,8 +1285,31 @@ void GSDDumpWriter::writeLogQuantities(pybind11::dict dict)
             throw invalid_argument("Invalid numpy dimension in gsd log data [" + name + "]");
             }
 
-        int retval
-            = gsd_write_chunk(&m_handle, name.c_str(), type, N, (uint32_t)M, 0, (void*)arr.data());
+        GSDLogChunk chunk;
+        chunk.name = name;
+        chunk.type = type;
+        chunk.N = N;
+        chunk.M = (uint32_t)M;
+        const char* data = static_cast<const char*>(arr.data());
+        chunk.data.assign(data, data + arr.nbytes());
+        log_chunks.push_back(std::move(chunk));
+        }
+
+    return log_chunks;
+    }
+
+void GSDDumpWriter::writeLogChunks(const std::vector<GSDLogChunk>& log_chunks)
+    {
+    for (const auto& chunk : log_chunks)
+        {
+        m_exec_conf->msg->notice(10) << "GSD: writing " << chunk.name << endl;
+        int retval = gsd_write_chunk(&m_handle,
+                                     chunk.name.c_str(),
+                                     chunk.type,
+                                     chunk.N,
+                                     chunk.M,
+                                     0,
+                                     (void*)chunk.data.data());
         GSDUtils::checkError(retval, m_fname);
         }
     }
@@ -1056,8 +1352,102 @@ void GSDDumpWriter::populateNonDefault()
 
 void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t timestep)
     {
+    // only access the arrays that the frame reads so that the others stay on the device
+    const bool write_postype = isFieldWritten(gsd_flag::particles_position)
+                               || isFieldWritten(gsd_flag::particles_type)
+                               || isFieldWritten(gsd_flag::particles_image);
+    const bool write_vel = isFieldWritten(gsd_flag::particles_velocity)
+                           || isFieldWritten(gsd_flag::particles_mass);
+
+    LocalParticleArrays arrays;
+    arrays.N = m_pdata->getN();
+    arrays.origin = m_pdata->getOrigin();
+
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+    arrays.rtag = h_rtag.data;
+    arrays.tag = h_tag.data;
+
+    std::optional<ArrayHandle<Scalar4>> h_postype;
+    std::optional<ArrayHandle<int3>> h_image;
+    if (write_postype)
+        {
+        h_postype.emplace(m_pdata->getPositions(), access_location::host, access_mode::read);
+        h_image.emplace(m_pdata->getImages(), access_location::host, access_mode::read);
+        arrays.postype = h_postype->data;
+        arrays.image = h_image->data;
+        }
+
+    std::optional<ArrayHandle<Scalar4>> h_orientation;
+    if (isFieldWritten(gsd_flag::particles_orientation))
+        {
+        h_orientation.emplace(m_pdata->getOrientationArray(),
+                              access_location::host,
+                              access_mode::read);
+        arrays.orientation = h_orientation->data;
+        }
+
+    std::optional<ArrayHandle<Scalar4>> h_vel;
+    if (write_vel)
+        {
+        h_vel.emplace(m_pdata->getVelocities(), access_location::host, access_mode::read);
+        arrays.vel = h_vel->data;
+        }
+
+    std::optional<ArrayHandle<Scalar>> h_charge;
+    if (isFieldWritten(gsd_flag::particles_charge))
+        {
+        h_charge.emplace(m_pdata->getCharges(), access_location::host, access_mode::read);
+        arrays.charge = h_charge->data;
+        }
+
+    std::optional<ArrayHandle<Scalar>> h_diameter;
+    if (isFieldWritten(gsd_flag::particles_diameter))
+        {
+        h_diameter.emplace(m_pdata->getDiameters(), access_location::host, access_mode::read);
+        arrays.diameter = h_diameter->data;
+        }
+
+    std::optional<ArrayHandle<unsigned int>> h_body;
+    if (isFieldWritten(gsd_flag::particles_body))
+        {
+        h_body.emplace(m_pdata->getBodies(), access_location::host, access_mode::read);
+        arrays.body = h_body->data;
+        }
+
+    std::optional<ArrayHandle<Scalar3>> h_inertia;
+    if (isFieldWritten(gsd_flag::particles_inertia))
+        {
+        h_inertia.emplace(m_pdata->getMomentsOfInertiaArray(),
+                          access_location::host,
+                          access_mode::read);
+        arrays.inertia = h_inertia->data;
+        }
+
+    std::optional<ArrayHandle<Scalar4>> h_angmom;
+    if (isFieldWritten(gsd_flag::particles_angmom))
+        {
+        h_angmom.emplace(m_pdata->getAngularMomentumArray(),
+                         access_location::host,
+                         access_mode::read);
+        arrays.angmom = h_angmom->data;
+        }
+
+    populateLocalFrame(frame, timestep, m_pdata->getGlobalBox(), arrays);
+    }
+
+/*! \param frame Frame to populate
+    \param timestep Timestep of the frame
+    \param global_box Global box of the frame
+    \param arrays Local particle arrays to read, only the fields written in the frame are read
+*/
+void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame,
+                                       uint64_t timestep,
+                                       const BoxDim& global_box,
+                                       const LocalParticleArrays& arrays)
+    {
     frame.timestep = timestep;
-    frame.global_box = m_pdata->getGlobalBox();
+    frame.global_box = global_box;
 
     frame.particle_data.type_mapping = m_pdata->getTypeMapping();
 
@@ -1068,27 +1458,24 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
     all_default.set();
     frame.clear();
 
-    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
 
     if (N > 0)
         {
-        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
-                                        access_location::host,
-                                        access_mode::read);
 
         m_index.resize(0);
 
         for (unsigned int group_tag_index = 0; group_tag_index < N; group_tag_index++)
             {
             unsigned int tag = m_group->getMemberTag(group_tag_index);
-            unsigned int index = h_rtag.data[tag];
-            if (index >= m_pdata->getN())
+            unsigned int index = arrays.rtag[tag];
+            if (index >= arrays.N)
                 {
                 continue;
                 }
 
-            frame.particle_tags.push_back(h_tag.data[index]);
+            frame.particle_tags.push_back(arrays.tag[index]);
             m_index.push_back(index);
+            frame.particle_group_index.push_back(group_tag_index);
             }
         }
 
@@ -1096,10 +1483,6 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
         && (m_dynamic[gsd_flag::particles_position] || m_dynamic[gsd_flag::particles_type]
             || m_dynamic[gsd_flag::particles_image] || m_nframes == 0))
         {
-        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
-                                       access_location::host,
-                                       access_mode::read);
-        ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
 
         if (m_dynamic[gsd_flag::particles_position] || m_nframes == 0)
             {
@@ -1117,17 +1500,26 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
         for (unsigned int index : m_index)
             {
             vec3<Scalar> position
-                = vec3<Scalar>(h_postype.data[index]) - vec3<Scalar>(m_pdata->getOrigin());
-            unsigned int type = __scalar_as_int(h_postype.data[index].w);
+                = vec3<Scalar>(arrays.postype[index]) - vec3<Scalar>(arrays.origin);
+            unsigned int type = __scalar_as_int(arrays.postype[index].w);
             int3 image = make_int3(0, 0, 0);
 
             if (m_dynamic[gsd_flag::particles_image] || m_nframes == 0)
                 {
-                image = h_image.data[index];
+                image = arrays.image[index];
                 }
 
             frame.global_box.wrap(position, image);
 
+            if (m_position_step > 0)
+                {
+                // a value rounded up to the box boundary belongs to the next image
+                position = vec3<Scalar>(quantize(position.x, m_position_step),
+                                        quantize(position.y, m_position_step),
+                                        quantize(position.z, m_position_step));
+                frame.global_box.wrap(position, image);
+                }
+
             if (m_dynamic[gsd_flag::particles_position] || m_nframes == 0)
                 {
                 if (position != vec3<Scalar>(0, 0, 0))
@@ -1162,14 +1554,11 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 
     if (N > 0 && (m_dynamic[gsd_flag::particles_orientation] || m_nframes == 0))
         {
-        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
-                                           access_location::host,
-                                           access_mode::read);
         frame.particle_data_present[gsd_flag::particles_orientation] = true;
 
         for (unsigned int index : m_index)
             {
-            quat<Scalar> orientation(h_orientation.data[index]);
+            quat<Scalar> orientation(arrays.orientation[index]);
             if (orientation.s != Scalar(1.0) || orientation.v.x != Scalar(0.0)
                 || orientation.v.y != Scalar(0.0) || orientation.v.z != Scalar(0.0))
                 {
@@ -1184,9 +1573,6 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
         && (m_dynamic[gsd_flag::particles_velocity] || m_dynamic[gsd_flag::particles_mass]
             || m_nframes == 0))
         {
-        ArrayHandle<Scalar4> h_velocity_mass(m_pdata->getVelocities(),
-                                             access_location::host,
-                                             access_mode::read);
 
         if (m_dynamic[gsd_flag::particles_mass] || m_nframes == 0)
             {
@@ -1199,10 +1585,17 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 
         for (unsigned int index : m_index)
             {
-            vec3<float> velocity = vec3<float>(static_cast<float>(h_velocity_mass.data[index].x),
-                                               static_cast<float>(h_velocity_mass.data[index].y),
-                                               static_cast<float>(h_velocity_mass.data[index].z));
-            float mass = static_cast<float>(h_velocity_mass.data[index].w);
+            vec3<Scalar> velocity_full(arrays.vel[index].x,
+                                       arrays.vel[index].y,
+                                       arrays.vel[index].z);
+            if (m_velocity_step > 0)
+                {
+                velocity_full = vec3<Scalar>(quantize(velocity_full.x, m_velocity_step),
+                                             quantize(velocity_full.y, m_velocity_step),
+                                             quantize(velocity_full.z, m_velocity_step));
+                }
+            vec3<float> velocity = vec3<float>(velocity_full);
+            float mass = static_cast<float>(arrays.vel[index].w);
 
             if (m_dynamic[gsd_flag::particles_mass] || m_nframes == 0)
                 {
@@ -1228,15 +1621,12 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 
     if (N > 0 && (m_dynamic[gsd_flag::particles_charge] || m_nframes == 0))
         {
-        ArrayHandle<Scalar> h_charge(m_pdata->getCharges(),
-                                     access_location::host,
-                                     access_mode::read);
 
         frame.particle_data_present[gsd_flag::particles_charge] = true;
 
         for (unsigned int index : m_index)
             {
-            float charge = static_cast<float>(h_charge.data[index]);
+            float charge = static_cast<float>(arrays.charge[index]);
             if (charge != 0.0f)
                 {
                 all_default[gsd_flag::particles_charge] = false;
@@ -1248,15 +1638,12 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 
     if (N > 0 && (m_dynamic[gsd_flag::particles_diameter] || m_nframes == 0))
         {
-        ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
-                                       access_location::host,
-                                       access_mode::read);
 
         frame.particle_data_present[gsd_flag::particles_diameter] = true;
 
         for (unsigned int index : m_index)
             {
-            float diameter = static_cast<float>(h_diameter.data[index]);
+            float diameter = static_cast<float>(arrays.diameter[index]);
 
             if (diameter != 1.0f)
                 {
@@ -1269,15 +1656,12 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 
     if (N > 0 && (m_dynamic[gsd_flag::particles_body] || m_nframes == 0))
         {
-        ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
-                                         access_location::host,
-                                         access_mode::read);
 
         frame.particle_data_present[gsd_flag::particles_body] = true;
 
         for (unsigned int index : m_index)
             {
-            unsigned int body = h_body.data[index];
+            unsigned int body = arrays.body[index];
 
             if (body != NO_BODY)
                 {
@@ -1290,15 +1674,12 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 
     if (N > 0 && (m_dynamic[gsd_flag::particles_inertia] || m_nframes == 0))
         {
-        ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(),
-                                       access_location::host,
-                                       access_mode::read);
 
         frame.particle_data_present[gsd_flag::particles_inertia] = true;
 
         for (unsigned int index : m_index)
             {
-            vec3<float> inertia = vec3<float>(h_inertia.data[index]);
+            vec3<float> inertia = vec3<float>(arrays.inertia[index]);
 
             if (inertia != vec3<float>(0, 0, 0))
                 {
@@ -1311,15 +1692,12 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 
     if (N > 0 && (m_dynamic[gsd_flag::particles_angmom] || m_nframes == 0))
         {
-        ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(),
-                                      access_location::host,
-                                      access_mode::read);
 
         frame.particle_data_present[gsd_flag::particles_angmom] = true;
 
         for (unsigned int index : m_index)
             {
-            quat<float> angmom = quat<float>(h_angmom.data[index]);
+            quat<float> angmom = quat<float>(arrays.angmom[index]);
 
             if (angmom.s != 0.0f || angmom.v.x != 0.0f || angmom.v.y != 0.0f || angmom.v.z != 0.0f)
                 {
@@ -1458,6 +1836,8 @@ void GSDDumpWriter::gatherGlobalFrame(const GSDFrame& local_frame)
     m_global_frame.clear();
 
     m_global_frame.timestep = local_frame.timestep;
+    m_global_frame.frame_number = local_frame.frame_number;
+    m_global_frame.N = local_frame.N;
     m_global_frame.global_box = local_frame.global_box;
     m_global_frame.particle_data.type_mapping = local_frame.particle_data.type_mapping;
     m_global_frame.particle_data_present = local_frame.particle_data_present;
@@ -1522,6 +1902,167 @@ void GSDDumpWriter::gatherGlobalFrame(const GSDFrame& local_frame)
         }
     }
 
+/*! \param frame Frame populated on this rank, with frame_number and N set
+    \param log_data Logged quantities (only used on the root rank)
+    \param write_topology True when the topology should be written
+
+    All ranks must call writeParallelFrame(). The root rank writes the frame header, the logged
+    quantities, and the topology through its GSD handle. The per-particle chunks are written in the
+    same order as writeAttributes(), writeProperties(), and writeMomenta() so that the files match.
+*/
+void GSDDumpWriter::writeParallelFrame(GSDFrame& frame,
+                                       pybind11::dict log_data,
+                                       bool write_topology)
+    {
+    const bool root = m_exec_conf->isRoot();
+    if (root)
+        {
+        writeFrameHeader(frame);
+        if (m_dynamic[gsd_flag::particles_types] || frame.frame_number == 0)
+            {
+            writeTypeMapping("particles/types", frame.particle_data.type_mapping);
+            }
+        }
+
+    // the local particles are in ascending tag order, so their offsets in the group increase
+    m_file_displacements.assign(frame.particle_group_index.begin(),
+                                frame.particle_group_index.end());
+
+    MPI_File fh;
+    int retval = MPI_File_open(m_exec_conf->getMPICommunicator(),
+                               m_fname.c_str(),
+                               MPI_MODE_WRONLY,
+                               MPI_INFO_NULL,
+                               &fh);
+    if (retval != MPI_SUCCESS)
+        {
+        m_exec_conf->msg->error() << "GSD: unable to open " << m_fname << " with MPI-IO" << endl;
+        throw runtime_error("Error opening GSD file");
+        }
+
+    const std::bitset<n_gsd_flags>& present = frame.particle_data_present;
+    const SnapshotParticleData<float>& pdata = frame.particle_data;
+    if (present[gsd_flag::particles_type])
+        writeParallelChunk(fh, frame, "particles/typeid", GSD_TYPE_UINT32, 1, pdata.type.data());
+    if (present[gsd_flag::particles_mass])
+        writeParallelChunk(fh, frame, "particles/mass", GSD_TYPE_FLOAT, 1, pdata.mass.data());
+    if (present[gsd_flag::particles_charge])
+        writeParallelChunk(fh, frame, "particles/charge", GSD_TYPE_FLOAT, 1, pdata.charge.data());
+    if (m_write_diameter && present[gsd_flag::particles_diameter])
+        writeParallelChunk(fh,
+                           frame,
+                           "particles/diameter",
+                           GSD_TYPE_FLOAT,
+                           1,
+                           pdata.diameter.data());
+    if (present[gsd_flag::particles_body])
+        writeParallelChunk(fh, frame, "particles/body", GSD_TYPE_INT32, 1, pdata.body.data());
+    if (present[gsd_flag::particles_inertia])
+        writeParallelChunk(fh,
+                           frame,
+                           "particles/moment_inertia",
+                           GSD_TYPE_FLOAT,
+                           3,
+                           pdata.inertia.data());
+    if (present[gsd_flag::particles_position])
+        writeParallelChunk(fh, frame, "particles/position", GSD_TYPE_FLOAT, 3, pdata.pos.data());
+    if (present[gsd_flag::particles_orientation])
+        writeParallelChunk(fh,
+                           frame,
+                           "particles/orientation",
+                           GSD_TYPE_FLOAT,
+                           4,
+                           pdata.orientation.data());
+    if (present[gsd_flag::particles_velocity])
+        writeParallelChunk(fh, frame, "particles/velocity", GSD_TYPE_FLOAT, 3, pdata.vel.data());
+    if (present[gsd_flag::particles_angmom])
+        writeParallelChunk(fh, frame, "particles/angmom", GSD_TYPE_FLOAT, 4, pdata.angmom.data());
+    if (present[gsd_flag::particles_image])
+        writeParallelChunk(fh, frame, "particles/image", GSD_TYPE_INT32, 3, pdata.image.data());
+
+    // closing the file completes the writes before the root rank writes the index
+    MPI_File_close(&fh);
+
+    if (root)
+        {
+        writeLogChunks(getLogChunks(log_data));
+
+        if (write_topology)
+            {
+            writeTopology(frame.bond_data,
+                          frame.angle_data,
+                          frame.dihedral_data,
+                          frame.improper_data,
+                          frame.constraint_data,
+                          frame.pair_data);
+            }
+
+        m_exec_conf->msg->notice(10) << "GSD: ending frame" << endl;
+        retval = gsd_end_frame(&m_handle);
+        GSDUtils::checkError(retval, m_fname);
+        }
+    }
+
+/*! \param fh File opened with MPI-IO on all ranks
+    \param frame Frame populated on this rank
+    \param name Name of the chunk
+    \param type Type of the chunk
+    \param M Number of columns in the chunk
+    \param data Local data, with one row of \a M values per local particle in ascending tag order
+
+    The root rank reserves N * M values at the end of the file and broadcasts their location. Each
+    rank then writes its rows at the offsets in m_file_displacements with one collective call.
+*/
+void GSDDumpWriter::writeParallelChunk(MPI_File fh,
+                                       const GSDFrame& frame,
+                                       const char* name,
+                                       gsd_type type,
+                                       uint32_t M,
+                                       const void* data)
+    {
+    m_exec_conf->msg->notice(10) << "GSD: writing " << name << " in parallel" << endl;
+
+    uint64_t location = 0;
+    if (m_exec_conf->isRoot())
+        {
+        int retval = gsd_reserve_chunk(&m_handle, name, type, frame.N, M, 0, &location);
+        GSDUtils::checkError(retval, m_fname);
+        }
+    MPI_Bcast(&location, 1, MPI_UINT64_T, 0, m_exec_conf->getMPICommunicator());
+
+    MPI_Datatype row_type;
+    MPI_Type_contiguous(static_cast<int>(M * gsd_sizeof_type(type)), MPI_BYTE, &row_type);
+    MPI_Type_commit(&row_type);
+
+    const int n_local = static_cast<int>(m_file_displacements.size());
+    MPI_Datatype file_type;
+    MPI_Type_create_indexed_block(n_local, 1, m_file_displacements.data(), row_type, &file_type);
+    MPI_Type_commit(&file_type);
+
+    MPI_File_set_view(fh,
+                      static_cast<MPI_Offset>(location),
+                      row_type,
+                      file_type,
+                      "native",
+                      MPI_INFO_NULL);
+    MPI_Status status;
+    int retval = MPI_File_write_all(fh, data, n_local, row_type, &status);
+
+    MPI_Type_free(&file_type);
+    MPI_Type_free(&row_type);
+
+    if (retval != MPI_SUCCESS)
+        {
+        m_exec_conf->msg->error() << "GSD: unable to write " << name << " to " << m_fname
+                                  << " with MPI-IO" << endl;
+        throw runtime_error("Error writing GSD file");
+        }
+
+    // every rank tracks the non-default quantities because they all populate frames
+    if (frame.frame_number == 0)
+        m_nondefault[name] = true;
+    }
+
 #endif
 
 namespace detail
@@ -1551,7 +2092,17 @@ void export_GSDDumpWriter(pybind11::module& m)
         .def("flush", &GSDDumpWriter::flush)
         .def_property("maximum_write_buffer_size",
                       &GSDDumpWriter::getMaximumWriteBufferSize,
-                      &GSDDumpWriter::setMaximumWriteBufferSize);
+                      &GSDDumpWriter::setMaximumWriteBufferSize)
+        .def_property("async_queue_size",
+                      &GSDDumpWriter::getAsyncQueueSize,
+                      &GSDDumpWriter::setAsyncQueueSize)
+        .def_property("parallel_io", &GSDDumpWriter::getParallelIO, &GSDDumpWriter::setParallelIO)
+        .def_property("position_precision",
+                      &GSDDumpWriter::getPositionPrecision,
+                      &GSDDumpWriter::setPositionPrecision)
+        .def_property("velocity_precision",
+                      &GSDDumpWriter::getVelocityPrecision,
+                      &GSDDumpWriter::setVelocityPrecision);
     }
 
     } // end namespace detail
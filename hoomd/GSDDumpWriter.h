@@ -8,8 +8,13 @@
 #include "SharedSignal.h"
 
 #include "hoomd/extern/gsd.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 /*! \file GSDDumpWriter.h
     \brief Declares the GSDDumpWriter class
@@ -30,6 +35,23 @@ namespace hoomd
 
     The file is not opened until the first call to analyze().
 
+    When the asynchronous queue size is greater than 0, analyze() gathers the frame and then moves
+    it to a queue. A background thread on the root rank writes the queued frames to the file, and
+    analyze() blocks only when the queue is full. The first frame in the file is always written
+    synchronously because it determines which quantities later frames must write. Operations that
+    access the file (flush, buffer size, truncation) wait until the queue is empty.
+
+    In domain decomposed simulations, the frame is gathered onto the root rank by default. When
+    parallel IO is enabled, the root rank instead reserves space for each per-particle chunk and
+    every rank writes its particles into that space with collective MPI-IO. The offset of a
+    particle in a chunk is its index in the group, so the file is identical to one written through
+    the root rank. Parallel frames are always written synchronously.
+
+    Positions and velocities may be written with a reduced precision. They are rounded to the
+    nearest multiple of the largest power of two that does not exceed the precision. The chunks
+    keep their float type so that any GSD reader can read them, but the trailing bits of each value
+    are zero, which lets file system or external compression shrink them several fold.
+
     \ingroup analyzers
 */
 class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
@@ -46,6 +68,7 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     //! Control topology writes
     void setWriteTopology(bool b)
         {
+        finishAsyncWrites();
         m_write_topology = b;
         }
 
@@ -94,6 +117,12 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
         return m_log_writer;
         }
 
+    /// The log writer and the log data are Python objects
+    virtual bool usesPython()
+        {
+        return true;
+        }
+
     /// Get needed pdata flags
     virtual PDataFlags getRequestedPDataFlags()
         {
@@ -116,6 +145,8 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     /// Set the write_diameter flag
     void setWriteDiameter(bool write_diameter)
         {
+        // the background thread reads the flag
+        finishAsyncWrites();
         m_write_diameter = write_diameter;
         }
 
@@ -128,6 +159,46 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     /// Get the maximum write buffer size (in bytes)
     uint64_t getMaximumWriteBufferSize();
 
+    /// Set the number of frames that may wait for the background thread (0 writes synchronously)
+    void setAsyncQueueSize(unsigned int size);
+
+    /// Get the number of frames that may wait for the background thread
+    unsigned int getAsyncQueueSize()
+        {
+        return m_async_queue_size;
+        }
+
+    /// Set the precision of the written positions (0 writes them at full precision)
+    void setPositionPrecision(Scalar precision);
+
+    /// Get the precision of the written positions
+    Scalar getPositionPrecision()
+        {
+        return m_position_precision;
+        }
+
+    /// Set the precision of the written velocities (0 writes them at full precision)
+    void setVelocityPrecision(Scalar precision);
+
+    /// Get the precision of the written velocities
+    Scalar getVelocityPrecision()
+        {
+        return m_velocity_precision;
+        }
+
+    /// Set whether all ranks write the per-particle chunks with MPI-IO
+    void setParallelIO(bool parallel_io)
+        {
+        finishAsyncWrites();
+        m_parallel_io = parallel_io;
+        }
+
+    /// Get whether all ranks write the per-particle chunks with MPI-IO
+    bool getParallelIO()
+        {
+        return m_parallel_io;
+        }
+
     protected:
     gsd_handle m_handle; //!< Handle to the file
 
@@ -170,9 +241,15 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     struct GSDFrame
         {
         uint64_t timestep;
+        /// Index of the frame in the file, set when the frame is written
+        uint64_t frame_number;
+        /// Number of particles in the frame, set when the frame is written
+        uint32_t N;
         BoxDim global_box;
 
         std::vector<unsigned int> particle_tags;
+        /// Index in the group of each particle, used by parallel IO
+        std::vector<unsigned int> particle_group_index;
 
         SnapshotParticleData<float> particle_data;
         BondData::Snapshot bond_data;
@@ -188,6 +265,7 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
         void clear()
             {
             particle_tags.resize(0);
+            particle_group_index.resize(0);
             particle_data.resize(0);
             bond_data.resize(0);
             angle_data.resize(0);
@@ -209,21 +287,72 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     //! Write a frame to the GSD file buffer
     void write(GSDFrame& frame, pybind11::dict log_data);
 
+    /// Wait for the background thread to write all queued frames
+    void finishAsyncWrites();
+
     //! Check and raise an exception if an error occurs
     void checkError(int retval);
 
     //! Populate the non-default map
     void populateNonDefault();
 
+    /// Host pointers to the local particle arrays that a frame is populated from
+    /** Arrays of fields that are not written in the frame may be null. rtag maps every tag in
+        the group to its index in the arrays, or to an index of at least N when the particle is
+        not in them.
+    */
+    struct LocalParticleArrays
+        {
+        unsigned int N = 0;
+        Scalar3 origin = make_scalar3(0, 0, 0);
+        const unsigned int* tag = nullptr;
+        const unsigned int* rtag = nullptr;
+        const Scalar4* postype = nullptr;
+        const int3* image = nullptr;
+        const Scalar4* orientation = nullptr;
+        const Scalar4* vel = nullptr;
+        const Scalar* charge = nullptr;
+        const Scalar* diameter = nullptr;
+        const unsigned int* body = nullptr;
+        const Scalar3* inertia = nullptr;
+        const Scalar4* angmom = nullptr;
+        };
+
+    /// Check whether a particle field is written in the next frame
+    bool isFieldWritten(gsd_flag::Enum flag) const
+        {
+        return m_dynamic[flag] || m_nframes == 0;
+        }
+
     /// Populate local frame with data.
     void populateLocalFrame(GSDFrame& frame, uint64_t timestep);
 
+    /// Populate local frame with data from copies of the particle arrays.
+    void populateLocalFrame(GSDFrame& frame,
+                            uint64_t timestep,
+                            const BoxDim& global_box,
+                            const LocalParticleArrays& arrays);
+
 #ifdef ENABLE_MPI
     /// Copy of the state properties on all ranks, in ascending tag order globally.
     GSDFrame m_global_frame;
     GatherTagOrder m_gather_tag_order;
 
     void gatherGlobalFrame(const GSDFrame& local_frame);
+
+    /// Write a frame with every rank writing its particles to the file
+    void writeParallelFrame(GSDFrame& frame, pybind11::dict log_data, bool write_topology);
+
+    /// Reserve a per-particle chunk on the root rank and write the local particles into it
+    void writeParallelChunk(MPI_File fh,
+                            const GSDFrame& frame,
+                            const char* name,
+                            gsd_type type,
+                            uint32_t M,
+                            const void* data);
+
+    /// Offset of each local particle in the per-particle chunks
+    std::vector<int> m_file_displacements;
 #endif
 
     private:
@@ -244,6 +373,56 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     /// Callback to write log quantities to file
     pybind11::object m_log_writer;
 
+    /// A logged quantity converted to a GSD chunk
+    struct GSDLogChunk
+        {
+        std::string name;
+        gsd_type type;
+        uint64_t N;
+        uint32_t M;
+        std::vector<char> data;
+        };
+
+    /// A frame waiting for the background thread
+    struct GSDAsyncFrame
+        {
+        GSDFrame frame;
+        std::vector<GSDLogChunk> log_chunks;
+        bool write_topology;
+        };
+
+    /// Maximum number of frames in m_async_queue (0 writes synchronously)
+    unsigned int m_async_queue_size = 0;
+
+    /// Frames waiting for the background thread, the front frame is being written
+    std::deque<GSDAsyncFrame> m_async_queue;
+
+    /// Background thread that writes the queued frames
+    std::thread m_async_thread;
+
+    /// Protects m_async_queue, m_async_stop, and m_async_error
+    std::mutex m_async_mutex;
+
+    /// Signals changes to m_async_queue and m_async_stop
+    std::condition_variable m_async_cv;
+
+    /// Set to make the background thread exit once the queue is empty
+    bool m_async_stop = false;
+
+    /// Error raised on the background thread, rethrown on the main thread
+    std::exception_ptr m_async_error;
+
+    /// True when all ranks write the per-particle chunks with MPI-IO
+    bool m_parallel_io = false;
+
+    /// Precision of the written positions and velocities set by the user
+    Scalar m_position_precision = 0;
+    Scalar m_velocity_precision = 0;
+
+    /// Grid spacing that positions and velocities are rounded to (0 for no rounding)
+    Scalar m_position_step = 0;
+    Scalar m_velocity_step = 0;
+
     std::shared_ptr<ParticleGroup> m_group; //!< Group to write out to the file
     std::unordered_map<std::string, bool>
         m_nondefault; //!< Map of quantities (true when non-default in frame 0)
@@ -257,6 +436,29 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     //! Write a type mapping out to the file
     void writeTypeMapping(std::string chunk, std::vector<std::string> type_mapping);
 
+    /// Convert logged quantities to GSD chunks
+    std::vector<GSDLogChunk> getLogChunks(pybind11::dict dict);
+
+    /// Write logged quantities converted to GSD chunks
+    void writeLogChunks(const std::vector<GSDLogChunk>& log_chunks);
+
+    /// Write all chunks of a frame and end the frame
+    void writeFrame(GSDFrame& frame,
+                    const std::vector<GSDLogChunk>& log_chunks,
+                    bool write_topology);
+
+    /// Move a populated frame to the queue of the background thread
+    void queueFrame(pybind11::dict log_data);
+
+    /// Write the queued frames until stopped, run by m_async_thread
+    void asyncWriteLoop();
+
+    /// Write all queued frames and join the background thread
+    void stopAsyncThread();
+
+    /// Rethrow an error from the background thread on the calling thread
+    void rethrowAsyncError();
+
     //! Write frame header
     void writeFrameHeader(const GSDFrame& frame);
 
@@ -19,22 +19,30 @@ namespace hoomd
     \param name File name to read
     \param frame Frame index to read from the file
     \param from_end Count frames back from the end of the file
+    \param distributed Read a range of the particles on every rank (MPI only)
 
     The GSDReader constructor opens the GSD file, initializes an empty snapshot, and reads the file
-   into memory (on the root rank).
+   into memory (on the root rank). When \a distributed is true in an MPI simulation, every rank
+   reads a range of the particles and the root rank reads the rest of the file.
 */
 GSDReader::GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
                      const std::string& name,
                      const uint64_t frame,
-                     bool from_end)
-    : m_exec_conf(exec_conf), m_timestep(0), m_name(name), m_frame(frame)
+                     bool from_end,
+                     bool distributed)
+    : m_exec_conf(exec_conf), m_timestep(0), m_name(name), m_frame(frame),
+      m_distributed(distributed && exec_conf->getNRanks() > 1), m_n_particles(0)
     {
     m_snapshot = std::shared_ptr<SnapshotSystemData<float>>(new SnapshotSystemData<float>);
 
 #ifdef ENABLE_MPI
-    // if we are not the root processor, do not perform file I/O
+    // if we are not the root processor, only read the particles
     if (!m_exec_conf->isRoot())
         {
+        if (m_distributed)
+            {
+            readParticlesDistributed();
+            }
         return;
         }
 #endif
@@ -73,7 +81,16 @@ GSDReader::GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
         }
 
     readHeader();
-    readParticles();
+#ifdef ENABLE_MPI
+    if (m_distributed)
+        {
+        readParticlesDistributed();
+        }
+    else
+#endif
+        {
+        readParticles();
+        }
     readTopology();
     }
 
@@ -90,25 +107,21 @@ GSDReader::~GSDReader()
     gsd_close(&m_handle);
     }
 
-/*! \param data Pointer to data to read into
-    \param frame Frame index to read from
+/*! \param frame Frame index to read from
     \param name Name of the data chunk
     \param expected_size Expected size of the data chunk in bytes.
     \param cur_n N in the current frame.
 
-    Attempts to read the data chunk of the given name at the given frame. If it is not present at
-   this frame, attempt to read from frame 0. If it is also not present at frame 0, return false. If
+    Attempts to find the data chunk of the given name at the given frame. If it is not present at
+   this frame, attempt to find it at frame 0. If it is also not present at frame 0, return NULL. If
    the found data chunk is not the expected size, throw an exception.
 
     Per the GSD spec, keep the default when the frame 0 N does not match the current N.
-
-    Return true if data is actually read from the file.
 */
-bool GSDReader::readChunk(void* data,
-                          uint64_t frame,
-                          const char* name,
-                          size_t expected_size,
-                          unsigned int cur_n)
+const gsd_index_entry* GSDReader::findChunk(uint64_t frame,
+                                            const char* name,
+                                            size_t expected_size,
+                                            unsigned int cur_n)
     {
     const struct gsd_index_entry* entry = gsd_find_chunk(&m_handle, frame, name);
     if (entry == NULL && frame != 0)
@@ -117,24 +130,47 @@ bool GSDReader::readChunk(void* data,
     if (entry == NULL || (cur_n != 0 && entry->N != cur_n))
         {
         m_exec_conf->msg->notice(10) << "data.gsd_snapshot: chunk not found " << name << endl;
-        return false;
+        return NULL;
         }
-    else
+
+    size_t actual_size = entry->N * entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
+    if (actual_size != expected_size)
         {
-        m_exec_conf->msg->notice(7) << "data.gsd_snapshot: reading chunk " << name << endl;
-        size_t actual_size = entry->N * entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
-        if (actual_size != expected_size)
-            {
-            std::ostringstream s;
-            s << "Expecting " << expected_size << " bytes in " << name << " but found "
-              << actual_size << ".";
-            throw runtime_error(s.str());
-            }
-        int retval = gsd_read_chunk(&m_handle, data, entry);
-        GSDUtils::checkError(retval, m_name);
+        std::ostringstream s;
+        s << "Expecting " << expected_size << " bytes in " << name << " but found " << actual_size
+          << ".";
+        throw runtime_error(s.str());
+        }
+    return entry;
+    }
+
+/*! \param data Pointer to data to read into
+    \param frame Frame index to read from
+    \param name Name of the data chunk
+    \param expected_size Expected size of the data chunk in bytes.
+    \param cur_n N in the current frame.
+
+    Reads the data chunk found by findChunk().
 
-        return true;
+    Return true if data is actually read from the file.
+*/
+bool GSDReader::readChunk(void* data,
+                          uint64_t frame,
+                          const char* name,
+                          size_t expected_size,
+                          unsigned int cur_n)
+    {
+    const struct gsd_index_entry* entry = findChunk(frame, name, expected_size, cur_n);
+    if (entry == NULL)
+        {
+        return false;
         }
+
+    m_exec_conf->msg->notice(7) << "data.gsd_snapshot: reading chunk " << name << endl;
+    int retval = gsd_read_chunk(&m_handle, data, entry);
+    GSDUtils::checkError(retval, m_name);
+
+    return true;
     }
 
 /*! \param frame Frame index to read from
@@ -210,14 +246,15 @@ void GSDReader::readHeader()
         s << "Cannot read a file with 0 particles.";
         throw runtime_error(s.str());
         }
-    m_snapshot->particle_data.resize(N);
+    m_n_particles = N;
     }
 
 /*! Read the same data chunks for particles
  */
 void GSDReader::readParticles()
     {
-    unsigned int N = m_snapshot->particle_data.size;
+    unsigned int N = m_n_particles;
+    m_snapshot->particle_data.resize(N);
     m_snapshot->particle_data.type_mapping = readTypes(m_frame, "particles/types");
 
     // the snapshot already has default values, if a chunk is not found, the value
@@ -243,6 +280,118 @@ void GSDReader::readParticles()
     readChunk(&m_snapshot->particle_data.image[0], m_frame, "particles/image", N * 12, N);
     }
 
+#ifdef ENABLE_MPI
+/*! Read the same data chunks as readParticles(), with every rank reading the contiguous range
+    [N*rank/n_ranks, N*(rank+1)/n_ranks) of the particles. The root rank finds the chunks and
+    broadcasts their locations in the file, then all ranks read their rows with MPI-IO.
+
+    Must be called on all ranks.
+*/
+void GSDReader::readParticlesDistributed()
+    {
+    const MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+    const unsigned int n_chunks = 11;
+    const char* names[n_chunks] = {"particles/typeid",
+                                   "particles/mass",
+                                   "particles/charge",
+                                   "particles/diameter",
+                                   "particles/body",
+                                   "particles/moment_inertia",
+                                   "particles/position",
+                                   "particles/orientation",
+                                   "particles/velocity",
+                                   "particles/angmom",
+                                   "particles/image"};
+    const unsigned int row_sizes[n_chunks] = {4, 4, 4, 4, 4, 12, 12, 16, 12, 16, 12};
+
+    // location 0 is the file header, so it marks the chunks that are not in the file
+    std::vector<uint64_t> locations(n_chunks, 0);
+    std::vector<std::string> type_mapping;
+    if (m_exec_conf->isRoot())
+        {
+        type_mapping = readTypes(m_frame, "particles/types");
+        for (unsigned int i = 0; i < n_chunks; i++)
+            {
+            const gsd_index_entry* entry
+                = findChunk(m_frame, names[i], size_t(m_n_particles) * row_sizes[i], m_n_particles);
+            if (entry != NULL)
+                {
+                m_exec_conf->msg->notice(7)
+                    << "data.gsd_snapshot: reading chunk " << names[i] << " on all ranks" << endl;
+                locations[i] = entry->location;
+                }
+            }
+        }
+
+    bcast(m_n_particles, 0, mpi_comm);
+    bcast(type_mapping, 0, mpi_comm);
+    bcast(locations, 0, mpi_comm);
+
+    const uint64_t rank = m_exec_conf->getRank();
+    const uint64_t n_ranks = m_exec_conf->getNRanks();
+    const uint64_t first = uint64_t(m_n_particles) * rank / n_ranks;
+    const unsigned int n_local
+        = static_cast<unsigned int>(uint64_t(m_n_particles) * (rank + 1) / n_ranks - first);
+
+    SnapshotParticleData<float>& snap = m_snapshot->particle_data;
+    snap.resize(n_local);
+    snap.type_mapping = type_mapping;
+    snap.is_distributed = true;
+
+    void* data[n_chunks] = {snap.type.data(),
+                            snap.mass.data(),
+                            snap.charge.data(),
+                            snap.diameter.data(),
+                            snap.body.data(),
+                            snap.inertia.data(),
+                            snap.pos.data(),
+                            snap.orientation.data(),
+                            snap.vel.data(),
+                            snap.angmom.data(),
+                            snap.image.data()};
+
+    MPI_File fh;
+    int retval = MPI_File_open(mpi_comm, m_name.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fh);
+    if (retval != MPI_SUCCESS)
+        {
+        m_exec_conf->msg->error() << "data.gsd_snapshot: unable to open " << m_name
+                                  << " with MPI-IO" << endl;
+        throw runtime_error("Error reading GSD file");
+        }
+
+    for (unsigned int i = 0; i < n_chunks; i++)
+        {
+        if (locations[i] == 0)
+            {
+            continue;
+            }
+
+        MPI_Datatype row_type;
+        MPI_Type_contiguous(static_cast<int>(row_sizes[i]), MPI_BYTE, &row_type);
+        MPI_Type_commit(&row_type);
+
+        MPI_Status status;
+        retval = MPI_File_read_at_all(fh,
+                                      static_cast<MPI_Offset>(locations[i] + first * row_sizes[i]),
+                                      data[i],
+                                      static_cast<int>(n_local),
+                                      row_type,
+                                      &status);
+        MPI_Type_free(&row_type);
+
+        if (retval != MPI_SUCCESS)
+            {
+            MPI_File_close(&fh);
+            m_exec_conf->msg->error() << "data.gsd_snapshot: unable to read " << names[i]
+                                      << " from " << m_name << " with MPI-IO" << endl;
+            throw runtime_error("Error reading GSD file");
+            }
+        }
+
+    MPI_File_close(&fh);
+    }
+#endif
+
 /*! Read the same data chunks for topology
  */
 void GSDReader::readTopology()
@@ -331,6 +480,7 @@ void export_GSDReader(pybind11::module& m)
         .def(pybind11::init<std::shared_ptr<const ExecutionConfiguration>,
                             const string&,
                             const uint64_t,
+                            bool,
                             bool>())
         .def("getTimeStep", &GSDReader::getTimeStep)
         .def("getSnapshot", &GSDReader::getSnapshot)
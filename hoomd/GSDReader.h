@@ -24,6 +24,13 @@ template<class Real> struct SnapshotSystemData;
 /*! Read an input GSD file and generate a system snapshot. GSDReader can read any frame from a GSD
     file into the snapshot. For information on the GSD specification, see http://gsd.readthedocs.io/
 
+    In MPI simulations, GSDReader can read the particles in parallel. Each rank then reads a
+    contiguous range of the particles with MPI-IO and the snapshot on each rank holds only that
+    range (see SnapshotParticleData::is_distributed). ParticleData places the particles in their
+    domains without collecting them on the root rank, which avoids the memory and time cost of the
+    full snapshot on the root rank when restarting large systems. The topology is always read on
+    the root rank.
+
     \ingroup data_structs
 */
 class PYBIND11_EXPORT GSDReader
@@ -33,7 +40,8 @@ class PYBIND11_EXPORT GSDReader
     GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
               const std::string& name,
               const uint64_t frame,
-              bool from_end);
+              bool from_end,
+              bool distributed = false);
 
     //! Destructor
     ~GSDReader();
@@ -90,15 +98,24 @@ class PYBIND11_EXPORT GSDReader
     uint64_t m_timestep;                                       //!< Timestep at the selected frame
     std::string m_name;                                        //!< Cached file name
     uint64_t m_frame;                                          //!< Cached frame
+    bool m_distributed;                                        //!< Read particles on all ranks
+    unsigned int m_n_particles;                                //!< Number of particles in frame
     std::shared_ptr<SnapshotSystemData<float>> m_snapshot;     //!< The snapshot to read
     gsd_handle m_handle;                                       //!< Handle to the file
 
+    //! Helper function to find a chunk in the file
+    const gsd_index_entry*
+    findChunk(uint64_t frame, const char* name, size_t expected_size, unsigned int cur_n);
+
     //! Helper function to read a type list from the file
     std::vector<std::string> readTypes(uint64_t frame, const char* name);
 
     // helper functions to read sections of the file
     void readHeader();
     void readParticles();
+#ifdef ENABLE_MPI
+    void readParticlesDistributed();
+#endif
     void readTopology();
     };
 
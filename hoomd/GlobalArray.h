@@ -8,7 +8,8 @@
 /*! GlobalArray internally uses managed memory to store data, to allow buffers being accessed from
     multiple devices.
 
-    hipMemAdvise() can be called on GlobalArray's data, which is obtained using ::get().
+    hipMemAdvise() can be called on GlobalArray's data, which is obtained using ::get(). Pages
+    written by the host can be migrated ahead of the kernels that read them with prefetch().
 
     GlobalArray<> supports all functionality that GPUArray<> does, and should eventually replace
    GPUArray. In fact, for performance considerations in single GPU situations, GlobalArray
@@ -43,9 +44,10 @@
 #include <unistd.h>
 #include <vector>
 
-#define TAG_ALLOCATION(array)              \
-        {                                  \
-        array.setTag(std::string(#array)); \
+//! Name an array after its owner (the enclosing class) and its member name
+#define TAG_ALLOCATION(array)                                                               \
+        {                                                                                   \
+        array.setTag(hoomd::detail::allocation_owner(__PRETTY_FUNCTION__) + "::" + #array); \
         }
 
 namespace hoomd
@@ -89,20 +91,28 @@ template<class T> class managed_deleter
         \param N number of elements
         \param allocation_ptr true start of allocation, before alignment
         \param allocation_bytes Size of allocation
+        \param tag Name of the array
+
+        Records the allocation in the memory tracker.
      */
     managed_deleter(std::shared_ptr<const ExecutionConfiguration> exec_conf,
                     bool use_device,
                     std::size_t N,
                     void* allocation_ptr,
-                    size_t allocation_bytes)
+                    size_t allocation_bytes,
+                    const std::string& tag = std::string())
         : m_exec_conf(exec_conf), m_use_device(use_device), m_N(N),
-          m_allocation_ptr(allocation_ptr), m_allocation_bytes(allocation_bytes)
+          m_allocation_ptr(allocation_ptr), m_allocation_bytes(allocation_bytes), m_tag(tag)
         {
+        if (m_exec_conf && m_allocation_ptr)
+            m_exec_conf->getMemoryTracker().allocate(m_tag, m_allocation_bytes, m_use_device);
         }
 
     //! Set the tag
     void setTag(const std::string& tag)
         {
+        if (m_exec_conf && m_allocation_ptr)
+            m_exec_conf->getMemoryTracker().retag(m_tag, tag, m_allocation_bytes, m_use_device);
         m_tag = tag;
         }
 
@@ -131,6 +141,8 @@ template<class T> class managed_deleter
             ptr[i].~T();
             }
 
+        m_exec_conf->getMemoryTracker().deallocate(m_tag, m_allocation_bytes, m_use_device);
+
 #ifdef ENABLE_HIP
         if (m_use_device)
             {
@@ -237,7 +249,10 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
         {
 #ifndef ALWAYS_USE_MANAGED_MEMORY
         if (!(m_is_managed))
+            {
+            m_fallback.setTag(tag);
             return;
+            }
 #endif
 
         assert(this->m_exec_conf);
@@ -297,6 +312,7 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
 
         if (&rhs != this)
             {
+            m_version++;
             m_num_elements = rhs.m_num_elements;
             m_pitch = rhs.m_pitch;
             m_height = rhs.m_height;
@@ -370,6 +386,7 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
 #ifdef ENABLE_HIP
             m_event = std::move(other.m_event);
 #endif
+            m_version++;
             }
 
         return *this;
@@ -442,6 +459,8 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
 #ifndef ALWAYS_USE_MANAGED_MEMORY
         m_fallback.swap(from.m_fallback);
 #endif
+        m_version++;
+        from.m_version++;
         }
 
     //! Get the underlying raw pointer
@@ -458,6 +477,27 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
         return m_data.get();
         }
 
+#ifdef ENABLE_HIP
+    //! Prefetch the data to a device asynchronously
+    /*! \param device Device to migrate the pages to
+        \param stream Stream to order the prefetch on
+
+        Operations call this ahead of the kernels that will read the array on \a stream, so that
+        the pages written by the host migrate before the kernels run instead of faulting inside
+        them. Arrays that are not in managed memory are copied by ArrayHandle on access, so this
+        does nothing for them.
+    */
+    void prefetch(int device, hipStream_t stream = 0) const
+        {
+#ifdef __HIP_PLATFORM_NVCC__
+        if (m_is_managed && m_data)
+            {
+            cudaMemPrefetchAsync(m_data.get(), m_num_elements * sizeof(T), device, stream);
+            }
+#endif
+        }
+#endif
+
     //! Get the number of elements
     /*!
      - For 1-D allocated GPUArrays, this is the number of elements allocated.
@@ -535,6 +575,7 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
             {
             throw std::runtime_error("Cannot resize array in use.");
             }
+        m_version++;
 
 #ifdef ENABLE_HIP
         if (this->m_exec_conf && this->m_exec_conf->isCUDAEnabled())
@@ -587,6 +628,7 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
             {
             throw std::runtime_error("Cannot resize array in use.");
             }
+        m_version++;
 
         // make m_pitch the next multiple of 16 larger or equal to the given width
         size_t pitch = (width + (16 - (width & 15)));
@@ -636,10 +678,15 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
         // update the tag
         m_tag = tag;
 
-        // set tag on deleter so it can be displayed upon free
+        // set tag on deleter so it can be displayed upon free and the memory tracker can
+        // attribute the allocation
         if (!isNull() && m_data)
             m_data.get_deleter().setTag(tag);
 
+#ifndef ALWAYS_USE_MANAGED_MEMORY
+        m_fallback.setTag(tag);
+#endif
+
         // for debugging
         this->outputRepresentation();
         }
@@ -714,6 +761,21 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
         return m_acquired;
         }
 
+    public:
+    //! Get the modification count
+    /*! \sa GPUArray::getVersion()
+     */
+    uint64_t getVersion() const
+        {
+#ifndef ALWAYS_USE_MANAGED_MEMORY
+        // both counts only increase, so their sum changes whenever either changes
+        return m_version + m_fallback.getVersion();
+#else
+        return m_version;
+#endif
+        }
+
+    protected:
     //! Need to be friends with ArrayHandle
     friend class ArrayHandle<T>;
     friend class ArrayHandleAsync<T>;
@@ -738,7 +800,8 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
     size_t m_pitch;        //!< Pitch of 2D array
     size_t m_height;       //!< Height of 2D array
 
-    mutable bool m_acquired; //!< Tracks if the array is already acquired
+    mutable bool m_acquired;        //!< Tracks if the array is already acquired
+    mutable uint64_t m_version = 0; //!< Modification count of the managed array
 
     std::string m_tag; //!< Name tag of this buffer (optional)
 
@@ -838,8 +901,8 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
                                                   use_device,
                                                   m_num_elements,
                                                   allocation_ptr,
-                                                  allocation_bytes);
-        deleter.setTag(m_tag);
+                                                  allocation_bytes,
+                                                  m_tag);
         m_data = std::unique_ptr<T, decltype(deleter)>(reinterpret_cast<T*>(ptr), deleter);
 
         // construct objects explicitly using placement new
@@ -904,6 +967,8 @@ inline ArrayHandleDispatch<T> GlobalArray<T>::acquire(const access_location::Enu
         throw std::runtime_error("Cannot acquire access to array in use [" + this->m_tag + "]");
         }
     m_acquired = true;
+    if (mode != access_mode::read)
+        m_version++;
 
     // make sure a null array can be acquired
     if (!this->m_exec_conf || isNull())
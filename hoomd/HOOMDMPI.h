@@ -24,6 +24,7 @@
 #include <queue>
 #include <sstream>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 
 #include <cereal/archives/binary.hpp>
@@ -450,6 +451,142 @@ void all_gather_v(const T& in_value, std::vector<T>& out_values, const MPI_Comm
     delete[] rbuf;
     }
 
+//! Wrapper around MPI_Bcast that broadcasts a vector of plain data values
+/*! \param values Values to broadcast (resized on the other ranks)
+    \param root The rank to send from
+    \param mpi_comm The MPI communicator
+
+    The values are sent as raw bytes without serialization, one MPI datatype element per value, so
+    vectors larger than 2 GB can be broadcast.
+*/
+template<typename T>
+void bcast_raw(std::vector<T>& values, unsigned int root, const MPI_Comm mpi_comm)
+    {
+    static_assert(std::is_standard_layout<T>::value, "T must have a standard layout");
+
+    int rank;
+    MPI_Comm_rank(mpi_comm, &rank);
+
+    unsigned int count = (unsigned int)values.size();
+    MPI_Bcast(&count, 1, MPI_UNSIGNED, root, mpi_comm);
+    if (rank != (int)root)
+        values.resize(count);
+
+    MPI_Datatype value_type;
+    MPI_Type_contiguous((int)sizeof(T), MPI_BYTE, &value_type);
+    MPI_Type_commit(&value_type);
+    MPI_Bcast(values.data(), (int)count, value_type, root, mpi_comm);
+    MPI_Type_free(&value_type);
+    }
+
+//! Wrapper around MPI_Scatterv that scatters plain data values from the root rank
+/*! \param in_values Values to send, ordered by destination rank (root rank only)
+    \param send_counts Number of values to send to each rank (root rank only)
+    \param out_values Values received from the root rank
+    \param root The rank to send from
+    \param mpi_comm The MPI communicator
+
+    The values are sent as raw bytes without serialization, one MPI datatype element per value.
+*/
+template<typename T>
+void scatter_v(const std::vector<T>& in_values,
+               const std::vector<int>& send_counts,
+               std::vector<T>& out_values,
+               unsigned int root,
+               const MPI_Comm mpi_comm)
+    {
+    static_assert(std::is_standard_layout<T>::value, "T must have a standard layout");
+
+    int rank;
+    int size;
+    MPI_Comm_rank(mpi_comm, &rank);
+    MPI_Comm_size(mpi_comm, &size);
+
+    std::vector<int> displs;
+    if (rank == (int)root)
+        {
+        assert(send_counts.size() == (unsigned int)size);
+        displs.resize(size);
+        for (int i = 0; i < size; i++)
+            {
+            displs[i] = (i > 0) ? displs[i - 1] + send_counts[i - 1] : 0;
+            }
+        }
+
+    // scatter the number of values
+    int recv_count;
+    MPI_Scatter(send_counts.data(), 1, MPI_INT, &recv_count, 1, MPI_INT, root, mpi_comm);
+    out_values.resize(recv_count);
+
+    MPI_Datatype value_type;
+    MPI_Type_contiguous((int)sizeof(T), MPI_BYTE, &value_type);
+    MPI_Type_commit(&value_type);
+
+    MPI_Scatterv(in_values.data(),
+                 send_counts.data(),
+                 displs.data(),
+                 value_type,
+                 out_values.data(),
+                 recv_count,
+                 value_type,
+                 root,
+                 mpi_comm);
+
+    MPI_Type_free(&value_type);
+    }
+
+//! Wrapper around MPI_Alltoallv that exchanges plain data values between all ranks
+/*! \param in_values Values to send, ordered by destination rank
+    \param send_counts Number of values to send to each rank
+    \param out_values Values received from all ranks, in rank order
+    \param mpi_comm The MPI communicator
+
+    The values are sent as raw bytes without serialization, one MPI datatype element per value.
+*/
+template<typename T>
+void all_to_all_v(const std::vector<T>& in_values,
+                  const std::vector<int>& send_counts,
+                  std::vector<T>& out_values,
+                  const MPI_Comm mpi_comm)
+    {
+    static_assert(std::is_standard_layout<T>::value, "T must have a standard layout");
+
+    int size;
+    MPI_Comm_size(mpi_comm, &size);
+
+    assert(send_counts.size() == (unsigned int)size);
+
+    std::vector<int> send_displs(size);
+    std::vector<int> recv_counts(size);
+    std::vector<int> recv_displs(size);
+
+    // exchange the number of values
+    MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, mpi_comm);
+
+    for (int i = 0; i < size; i++)
+        {
+        send_displs[i] = (i > 0) ? send_displs[i - 1] + send_counts[i - 1] : 0;
+        recv_displs[i] = (i > 0) ? recv_displs[i - 1] + recv_counts[i - 1] : 0;
+        }
+    out_values.resize(recv_displs[size - 1] + recv_counts[size - 1]);
+
+    MPI_Datatype value_type;
+    MPI_Type_contiguous((int)sizeof(T), MPI_BYTE, &value_type);
+    MPI_Type_commit(&value_type);
+
+    MPI_Alltoallv(in_values.data(),
+                  send_counts.data(),
+                  send_displs.data(),
+                  value_type,
+                  out_values.data(),
+                  recv_counts.data(),
+                  recv_displs.data(),
+                  value_type,
+                  mpi_comm);
+
+    MPI_Type_free(&value_type);
+    }
+
 //! Wrapper around MPI_Send that handles any serializable object
 template<typename T> void send(const T& val, const unsigned int dest, const MPI_Comm mpi_comm)
     {
@@ -41,6 +41,18 @@ std::string BuildInfo::getCompileFlags()
     o << "[DOUBLE] ";
 #endif
 
+#ifdef HOOMD_COMPENSATED_INTEGRATION
+    o << "COMPENSATED ";
+#endif
+
+#ifdef HOOMD_FIXED_POINT_ACCUMULATION
+    o << "FIXED_POINT ";
+#endif
+
+#ifdef HOOMD_MPCD_SINGLE_PRECISION
+    o << "MPCD_SINGLE ";
+#endif
+
 #ifdef ENABLE_MPI
     o << "MPI ";
 #endif
@@ -54,6 +54,9 @@ Integrator::~Integrator()
 
         m_comm->getComputeCallbackSignal().disconnect<Integrator, &Integrator::computeCallback>(
             this);
+
+        if (m_overlap_ghost_updates)
+            m_comm->setOverlapGhostUpdates(false);
         }
 #endif
     }
@@ -157,6 +160,83 @@ vec3<double> Integrator::computeLinearMomentum()
     return p_total;
     }
 
+/** @param force The force
+    @param timestep Current time step of the simulation
+    @param scale Set to the factor that scales the force and torque in the net force
+
+    @returns True if the force is evaluated on this timestep
+
+    A force with a timestep multiple n > 1 applies the impulse n * F every n timesteps (and no force
+    in between). With a velocity Verlet integration method, this is the reversible RESPA splitting:
+    the kick at the end of one inner step and the kick at the start of the next together apply
+    (n dt / 2) F twice at the boundary of each outer step. Between the impulses, the force is
+    evaluated only on timesteps that need the potential energy or the virial, so that the logged
+    quantities include it.
+*/
+bool Integrator::isForceEvaluated(const ForceCompute& force, uint64_t timestep, Scalar& scale)
+    {
+    const unsigned int multiple = force.getTimestepMultiple();
+    if (timestep % multiple == 0)
+        {
+        scale = Scalar(multiple);
+        return true;
+        }
+
+    scale = Scalar(0.0);
+    PDataFlags flags = m_pdata->getFlags();
+    return flags[pdata_flag::potential_energy] || flags[pdata_flag::pressure_tensor];
+    }
+
+/** @param overlap True to compute interior forces while ghost positions are communicated
+
+    When enabled, the communicator returns from the ghost position update before it completes.
+    computeForces() then computes the forces on particles that do not interact with ghosts,
+    completes the ghost update, and computes the forces on the remaining particles.
+*/
+void Integrator::setOverlapGhostUpdates(bool overlap)
+    {
+    m_overlap_ghost_updates = overlap;
+#ifdef ENABLE_MPI
+    if (m_comm)
+        m_comm->setOverlapGhostUpdates(overlap);
+#endif
+    }
+
+/** @param timestep Current time step of the simulation
+    \post The forces evaluated on this timestep are computed and listed in m_evaluated_forces
+*/
+void Integrator::computeForces(uint64_t timestep)
+    {
+    m_evaluated_forces.clear();
+    m_force_scales.clear();
+
+#ifdef ENABLE_MPI
+    if (m_comm && m_comm->isGhostUpdateDeferred())
+        {
+        // compute interior forces while the ghost positions are in flight
+        for (auto& force : m_forces)
+            {
+            Scalar scale;
+            if (isForceEvaluated(*force, timestep, scale))
+                force->computeInterior(timestep);
+            }
+
+        m_comm->finishDeferredGhostUpdate();
+        }
+#endif
+
+    for (auto& force : m_forces)
+        {
+        Scalar scale;
+        if (isForceEvaluated(*force, timestep, scale))
+            {
+            force->compute(timestep);
+            m_evaluated_forces.push_back(force);
+            m_force_scales.push_back(scale);
+            }
+        }
+    }
+
 /** @param timestep Current time step of the simulation
     \post All added force computes in \a m_forces are computed and totaled up in \a m_net_force and
    \a m_net_virial \note The summation step is performed <b>on the CPU</b> and will result in a lot
@@ -165,10 +245,7 @@ vec3<double> Integrator::computeLinearMomentum()
 */
 void Integrator::computeNetForce(uint64_t timestep)
     {
-    for (auto& force : m_forces)
-        {
-        force->compute(timestep);
-        }
+    computeForces(timestep);
 
     Scalar external_virial[6];
     Scalar external_energy;
@@ -202,8 +279,10 @@ void Integrator::computeNetForce(uint64_t timestep)
         assert(6 * nparticles <= net_virial.getNumElements());
         assert(nparticles <= net_torque.getNumElements());
 
-        for (const auto& force : m_forces)
+        for (size_t i = 0; i < m_evaluated_forces.size(); ++i)
             {
+            const auto& force = m_evaluated_forces[i];
+            const Scalar scale = m_force_scales[i];
             const GlobalArray<Scalar4>& h_force_array = force->getForceArray();
             const GlobalArray<Scalar>& h_virial_array = force->getVirialArray();
             const GlobalArray<Scalar4>& h_torque_array = force->getTorqueArray();
@@ -219,14 +298,14 @@ void Integrator::computeNetForce(uint64_t timestep)
             size_t virial_pitch = h_virial_array.getPitch();
             for (unsigned int j = 0; j < nparticles; j++)
                 {
-                h_net_force.data[j].x += h_force.data[j].x;
-                h_net_force.data[j].y += h_force.data[j].y;
-                h_net_force.data[j].z += h_force.data[j].z;
+                h_net_force.data[j].x += scale * h_force.data[j].x;
+                h_net_force.data[j].y += scale * h_force.data[j].y;
+                h_net_force.data[j].z += scale * h_force.data[j].z;
                 h_net_force.data[j].w += h_force.data[j].w;
 
-                h_net_torque.data[j].x += h_torque.data[j].x;
-                h_net_torque.data[j].y += h_torque.data[j].y;
-                h_net_torque.data[j].z += h_torque.data[j].z;
+                h_net_torque.data[j].x += scale * h_torque.data[j].x;
+                h_net_torque.data[j].y += scale * h_torque.data[j].y;
+                h_net_torque.data[j].z += scale * h_torque.data[j].z;
                 h_net_torque.data[j].w += h_torque.data[j].w;
 
                 for (unsigned int k = 0; k < 6; k++)
@@ -350,10 +429,7 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
 
     // compute all the normal forces first
 
-    for (auto& force : m_forces)
-        {
-        force->compute(timestep);
-        }
+    computeForces(timestep);
 
     Scalar external_virial[6];
     Scalar external_energy;
@@ -390,7 +466,7 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
         // there is no need to zero out the initial net force and virial here, the first call to the
         // addition kernel will do that ahh!, but we do need to zer out the net force and virial if
         // there are 0 forces!
-        if (m_forces.size() == 0)
+        if (m_evaluated_forces.size() == 0)
             {
             // start by zeroing the net force and virial arrays
             hipMemset(d_net_force.data, 0, sizeof(Scalar4) * net_force.getNumElements());
@@ -403,20 +479,23 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
         // now, add up the accelerations
         // sum all the forces into the net force
         // perform the sum in groups of 6 to avoid kernel launch and memory access overheads
-        for (unsigned int cur_force = 0; cur_force < m_forces.size(); cur_force += 6)
+        for (unsigned int cur_force = 0; cur_force < m_evaluated_forces.size(); cur_force += 6)
             {
             // grab the device pointers for the current set
             kernel::gpu_force_list force_list;
 
-            const GlobalArray<Scalar4>& d_force_array0 = m_forces[cur_force]->getForceArray();
+            const GlobalArray<Scalar4>& d_force_array0
+                = m_evaluated_forces[cur_force]->getForceArray();
             ArrayHandle<Scalar4> d_force0(d_force_array0,
                                           access_location::device,
                                           access_mode::read);
-            const GlobalArray<Scalar>& d_virial_array0 = m_forces[cur_force]->getVirialArray();
+            const GlobalArray<Scalar>& d_virial_array0
+                = m_evaluated_forces[cur_force]->getVirialArray();
             ArrayHandle<Scalar> d_virial0(d_virial_array0,
                                           access_location::device,
                                           access_mode::read);
-            const GlobalArray<Scalar4>& d_torque_array0 = m_forces[cur_force]->getTorqueArray();
+            const GlobalArray<Scalar4>& d_torque_array0
+                = m_evaluated_forces[cur_force]->getTorqueArray();
             ArrayHandle<Scalar4> d_torque0(d_torque_array0,
                                            access_location::device,
                                            access_mode::read);
@@ -424,21 +503,22 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
             force_list.v0 = d_virial0.data;
             force_list.vpitch0 = d_virial_array0.getPitch();
             force_list.t0 = d_torque0.data;
+        force_list.s0 = m_force_scales[cur_force];
 
-            if (cur_force + 1 < m_forces.size())
+            if (cur_force + 1 < m_evaluated_forces.size())
                 {
                 const GlobalArray<Scalar4>& d_force_array1
-                    = m_forces[cur_force + 1]->getForceArray();
+                    = m_evaluated_forces[cur_force + 1]->getForceArray();
                 ArrayHandle<Scalar4> d_force1(d_force_array1,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar>& d_virial_array1
-                    = m_forces[cur_force + 1]->getVirialArray();
+                    = m_evaluated_forces[cur_force + 1]->getVirialArray();
                 ArrayHandle<Scalar> d_virial1(d_virial_array1,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar4>& d_torque_array1
-                    = m_forces[cur_force + 1]->getTorqueArray();
+                    = m_evaluated_forces[cur_force + 1]->getTorqueArray();
                 ArrayHandle<Scalar4> d_torque1(d_torque_array1,
                                                access_location::device,
                                                access_mode::read);
@@ -446,21 +526,22 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
                 force_list.v1 = d_virial1.data;
                 force_list.vpitch1 = d_virial_array1.getPitch();
                 force_list.t1 = d_torque1.data;
+                force_list.s1 = m_force_scales[cur_force + 1];
                 }
-            if (cur_force + 2 < m_forces.size())
+            if (cur_force + 2 < m_evaluated_forces.size())
                 {
                 const GlobalArray<Scalar4>& d_force_array2
-                    = m_forces[cur_force + 2]->getForceArray();
+                    = m_evaluated_forces[cur_force + 2]->getForceArray();
                 ArrayHandle<Scalar4> d_force2(d_force_array2,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar>& d_virial_array2
-                    = m_forces[cur_force + 2]->getVirialArray();
+                    = m_evaluated_forces[cur_force + 2]->getVirialArray();
                 ArrayHandle<Scalar> d_virial2(d_virial_array2,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar4>& d_torque_array2
-                    = m_forces[cur_force + 2]->getTorqueArray();
+                    = m_evaluated_forces[cur_force + 2]->getTorqueArray();
                 ArrayHandle<Scalar4> d_torque2(d_torque_array2,
                                                access_location::device,
                                                access_mode::read);
@@ -468,21 +549,22 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
                 force_list.v2 = d_virial2.data;
                 force_list.vpitch2 = d_virial_array2.getPitch();
                 force_list.t2 = d_torque2.data;
+                force_list.s2 = m_force_scales[cur_force + 2];
                 }
-            if (cur_force + 3 < m_forces.size())
+            if (cur_force + 3 < m_evaluated_forces.size())
                 {
                 const GlobalArray<Scalar4>& d_force_array3
-                    = m_forces[cur_force + 3]->getForceArray();
+                    = m_evaluated_forces[cur_force + 3]->getForceArray();
                 ArrayHandle<Scalar4> d_force3(d_force_array3,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar>& d_virial_array3
-                    = m_forces[cur_force + 3]->getVirialArray();
+                    = m_evaluated_forces[cur_force + 3]->getVirialArray();
                 ArrayHandle<Scalar> d_virial3(d_virial_array3,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar4>& d_torque_array3
-                    = m_forces[cur_force + 3]->getTorqueArray();
+                    = m_evaluated_forces[cur_force + 3]->getTorqueArray();
                 ArrayHandle<Scalar4> d_torque3(d_torque_array3,
                                                access_location::device,
                                                access_mode::read);
@@ -490,21 +572,22 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
                 force_list.v3 = d_virial3.data;
                 force_list.vpitch3 = d_virial_array3.getPitch();
                 force_list.t3 = d_torque3.data;
+                force_list.s3 = m_force_scales[cur_force + 3];
                 }
-            if (cur_force + 4 < m_forces.size())
+            if (cur_force + 4 < m_evaluated_forces.size())
                 {
                 const GlobalArray<Scalar4>& d_force_array4
-                    = m_forces[cur_force + 4]->getForceArray();
+                    = m_evaluated_forces[cur_force + 4]->getForceArray();
                 ArrayHandle<Scalar4> d_force4(d_force_array4,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar>& d_virial_array4
-                    = m_forces[cur_force + 4]->getVirialArray();
+                    = m_evaluated_forces[cur_force + 4]->getVirialArray();
                 ArrayHandle<Scalar> d_virial4(d_virial_array4,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar4>& d_torque_array4
-                    = m_forces[cur_force + 4]->getTorqueArray();
+                    = m_evaluated_forces[cur_force + 4]->getTorqueArray();
                 ArrayHandle<Scalar4> d_torque4(d_torque_array4,
                                                access_location::device,
                                                access_mode::read);
@@ -512,21 +595,22 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
                 force_list.v4 = d_virial4.data;
                 force_list.vpitch4 = d_virial_array4.getPitch();
                 force_list.t4 = d_torque4.data;
+                force_list.s4 = m_force_scales[cur_force + 4];
                 }
-            if (cur_force + 5 < m_forces.size())
+            if (cur_force + 5 < m_evaluated_forces.size())
                 {
                 const GlobalArray<Scalar4>& d_force_array5
-                    = m_forces[cur_force + 5]->getForceArray();
+                    = m_evaluated_forces[cur_force + 5]->getForceArray();
                 ArrayHandle<Scalar4> d_force5(d_force_array5,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar>& d_virial_array5
-                    = m_forces[cur_force + 5]->getVirialArray();
+                    = m_evaluated_forces[cur_force + 5]->getVirialArray();
                 ArrayHandle<Scalar> d_virial5(d_virial_array5,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar4>& d_torque_array5
-                    = m_forces[cur_force + 5]->getTorqueArray();
+                    = m_evaluated_forces[cur_force + 5]->getTorqueArray();
                 ArrayHandle<Scalar4> d_torque5(d_torque_array5,
                                                access_location::device,
                                                access_mode::read);
@@ -534,6 +618,7 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
                 force_list.v5 = d_virial5.data;
                 force_list.vpitch5 = d_virial_array5.getPitch();
                 force_list.t5 = d_torque5.data;
+                force_list.s5 = m_force_scales[cur_force + 5];
                 }
 
             // clear on the first iteration only
@@ -562,7 +647,7 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
         }
 
     // add up external virials and energies
-    for (const auto& force : m_forces)
+    for (const auto& force : m_evaluated_forces)
         {
         for (unsigned int k = 0; k < 6; k++)
             external_virial[k] += force->getExternalVirial(k);
@@ -751,7 +836,7 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
                 }
 
             // clear only on the first iteration AND if there are zero forces
-            bool clear = (cur_force == 0) && (m_forces.size() == 0);
+            bool clear = (cur_force == 0) && (m_evaluated_forces.size() == 0);
 
             // access flags
             PDataFlags flags = this->m_pdata->getFlags();
@@ -865,7 +950,11 @@ void Integrator::computeCallback(uint64_t timestep)
     // pre-compute all active forces
     for (auto& force : m_forces)
         {
-        force->preCompute(timestep);
+        Scalar scale;
+        if (isForceEvaluated(*force, timestep, scale))
+            {
+            force->preCompute(timestep);
+            }
         }
     }
 #endif
@@ -897,6 +986,9 @@ void export_Integrator(pybind11::module& m)
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
         .def("updateGroupDOF", &Integrator::updateGroupDOF)
         .def_property("dt", &Integrator::getDeltaT, &Integrator::setDeltaT)
+        .def_property("overlap_ghost_updates",
+                      &Integrator::getOverlapGhostUpdates,
+                      &Integrator::setOverlapGhostUpdates)
         .def_property_readonly("forces", &Integrator::getForces)
         .def_property_readonly("constraints", &Integrator::getConstraintForces)
         .def("computeLinearMomentum", &Integrator::computeLinearMomentum);
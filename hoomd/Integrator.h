@@ -99,6 +99,15 @@ class PYBIND11_EXPORT Integrator : public Updater
     /// Return the timestep
     Scalar getDeltaT();
 
+    /// Set whether to compute interior forces while ghost positions are communicated
+    void setOverlapGhostUpdates(bool overlap);
+
+    /// Test if interior forces are computed while ghost positions are communicated
+    bool getOverlapGhostUpdates()
+        {
+        return m_overlap_ghost_updates;
+        }
+
     /// Update the number of degrees of freedom for a group
     /** @param group Group to set the degrees of freedom for.
      */
@@ -180,6 +189,9 @@ class PYBIND11_EXPORT Integrator : public Updater
     /// The step size
     Scalar m_deltaT;
 
+    /// True when interior forces are computed while ghost positions are communicated
+    bool m_overlap_ghost_updates = false;
+
     /// List of all the force computes
     std::vector<std::shared_ptr<ForceCompute>> m_forces;
 
@@ -189,6 +201,18 @@ class PYBIND11_EXPORT Integrator : public Updater
     /// The HalfStepHook, if active
     std::shared_ptr<HalfStepHook> m_half_step_hook;
 
+    /// Forces evaluated on the current timestep
+    std::vector<std::shared_ptr<ForceCompute>> m_evaluated_forces;
+
+    /// Factor that scales the force and torque of each evaluated force in the net force
+    std::vector<Scalar> m_force_scales;
+
+    /// Check if a force is evaluated on a timestep
+    bool isForceEvaluated(const ForceCompute& force, uint64_t timestep, Scalar& scale);
+
+    /// Compute the forces evaluated on a timestep
+    void computeForces(uint64_t timestep);
+
     /// helper function to compute initial accelerations
     void computeAccelerations(uint64_t timestep);
 
@@ -34,8 +34,10 @@ LoadBalancer::LoadBalancer(std::shared_ptr<SystemDefinition> sysdef,
 #endif
       m_max_imbalance(Scalar(1.0)), m_recompute_max_imbalance(true), m_needs_migrate(false),
       m_needs_recount(false), m_tolerance(Scalar(1.05)), m_maxiter(1), m_max_scale(Scalar(0.05)),
-      m_N_own(m_pdata->getN()), m_max_max_imbalance(1.0), m_total_max_imbalance(0.0), m_n_calls(0),
-      m_n_iterations(0), m_n_rebalances(0)
+      m_time_objective(false), m_damping(Scalar(0.5)), m_cost(Scalar(0.0)), m_has_cost(false),
+      m_has_time_sample(false), m_last_time(0), m_last_comm_time(0.0),
+      m_last_max_imbalance(Scalar(1.0)), m_N_own(m_pdata->getN()), m_max_max_imbalance(1.0),
+      m_total_max_imbalance(0.0), m_n_calls(0), m_n_iterations(0), m_n_rebalances(0)
     {
     m_exec_conf->msg->notice(5) << "Constructing LoadBalancer" << endl;
 
@@ -82,7 +84,10 @@ void LoadBalancer::update(uint64_t timestep)
         return;
 
     // no adjustment has been made yet, so set m_N_own to the number of particles on the rank
-    resetNOwn(m_pdata->getN());
+    resetNOwn(getNLocal());
+
+    if (m_time_objective)
+        measureCost();
 
     // figure out which rank is the reduction root for broadcasting
     const Index3D& di = m_decomposition->getDomainIndexer();
@@ -100,8 +105,9 @@ void LoadBalancer::update(uint64_t timestep)
     const Scalar3 min_domain_frac
         = Scalar(2.0) * m_comm->getGhostLayerMaxWidth() / box.getNearestPlaneDistance();
 
-    // compute the current imbalance always for the average in printed stats
-    m_total_max_imbalance += getMaxImbalance();
+    // compute the current imbalance always for the average in the stats
+    m_last_max_imbalance = getMaxImbalance();
+    m_total_max_imbalance += m_last_max_imbalance;
     ++m_n_calls;
 
     // attempt load balancing
@@ -139,17 +145,17 @@ void LoadBalancer::update(uint64_t timestep)
                 min_frac_i = min_domain_frac.z;
                 }
 
-            vector<unsigned int> N_i;
+            vector<Scalar> load_i;
             bool adjusted = false;
 
-            // reduce the number of particles in the slice along dim
-            bool active = reduce(N_i, dim, reduce_root);
+            // reduce the load in the slice along dim
+            bool active = reduce(load_i, dim, reduce_root);
 
             // attempt an adjustment
             vector<Scalar> cum_frac = m_decomposition->getCumulativeFractions(dim);
             if (active)
                 {
-                adjusted = adjust(cum_frac, N_i, L_i, min_frac_i);
+                adjusted = adjust(cum_frac, load_i, L_i, min_frac_i);
                 }
 
             // broadcast if an adjustment has been made on the root
@@ -167,30 +173,112 @@ void LoadBalancer::update(uint64_t timestep)
         // force a particle migration if one is needed
         if (m_needs_migrate)
             {
-            m_comm->forceMigrate();
-            m_comm->communicate(timestep);
-            resetNOwn(m_pdata->getN());
+            migrateParticles(timestep);
+            resetNOwn(getNLocal());
             m_needs_migrate = false;
 
             // increment the number of rebalances actually performed
             ++m_n_rebalances;
             }
         }
+
+    // start the next measurement after balancing so that migration is not counted as work
+    if (m_time_objective)
+        {
+        m_last_time = m_clock.getTime();
+        m_last_comm_time = m_comm->getCommunicationTime();
+        m_has_time_sample = true;
+        }
 #endif // ENABLE_MPI
     }
 
+/*!
+ * \param objective Load balancing objective ("particles" or "time")
+ */
+void LoadBalancer::setObjective(const std::string& objective)
+    {
+    if (objective == "particles")
+        {
+        m_time_objective = false;
+        }
+    else if (objective == "time")
+        {
+        m_time_objective = true;
+        }
+    else
+        {
+        throw std::invalid_argument("LoadBalancer: unknown objective " + objective);
+        }
+
+    // start a new measurement
+    m_has_cost = false;
+    m_has_time_sample = false;
+    m_recompute_max_imbalance = true;
+    }
+
+/*!
+ * \param damping Weight of the previous cost per particle in the moving average
+ */
+void LoadBalancer::setDamping(Scalar damping)
+    {
+    if (!(damping >= Scalar(0.0) && damping < Scalar(1.0)))
+        {
+        throw std::invalid_argument("LoadBalancer: damping must be in the range [0, 1)");
+        }
+    m_damping = damping;
+    }
+
 #ifdef ENABLE_MPI
 
 /*!
- * Computes the imbalance factor I = N / <N> for each rank, and computes the maximum among all
- * ranks.
+ * The cost per particle is the wall clock time that elapsed since the end of the previous
+ * balancing step less the time spent in the communicator, divided by the number of particles on
+ * the rank. Time spent waiting for other ranks is part of the communication time, so the
+ * difference estimates the work done by this rank. The first balancing step of a run only starts
+ * a measurement.
+ *
+ * All ranks measure on the same steps, so either all or none of them have a cost.
+ */
+void LoadBalancer::measureCost()
+    {
+    if (!m_has_time_sample)
+        return;
+
+    const double elapsed = double(m_clock.getTime() - m_last_time) / 1e9;
+    const double work = elapsed - (m_comm->getCommunicationTime() - m_last_comm_time);
+    const unsigned int N = getNLocal();
+    if (N > 0 && work > 0)
+        {
+        const Scalar cost = Scalar(work / double(N));
+        m_cost = m_has_cost ? m_damping * m_cost + (Scalar(1.0) - m_damping) * cost : cost;
+        }
+
+    m_has_cost = true;
+    m_recompute_max_imbalance = true;
+    }
+
+/*!
+ * Computes the imbalance factor I = W / <W> of the load W for each rank, and computes the maximum
+ * among all ranks.
  */
 Scalar LoadBalancer::getMaxImbalance()
     {
     if (m_recompute_max_imbalance)
         {
-        Scalar cur_imb = Scalar(getNOwn())
-                         / (Scalar(m_pdata->getNGlobal()) / Scalar(m_exec_conf->getNRanks()));
+        Scalar load = getLoad();
+        Scalar total_load(0.0);
+        if (m_time_objective && m_has_cost)
+            {
+            MPI_Allreduce(&load, &total_load, 1, MPI_HOOMD_SCALAR, MPI_SUM, m_mpi_comm);
+            }
+        else
+            {
+            total_load = Scalar(getNGlobal());
+            }
+
+        Scalar cur_imb = (total_load > Scalar(0.0))
+                             ? load / (total_load / Scalar(m_exec_conf->getNRanks()))
+                             : Scalar(1.0);
         Scalar max_imb(0.0);
         MPI_Allreduce(&cur_imb, &max_imb, 1, MPI_HOOMD_SCALAR, MPI_MAX, m_mpi_comm);
 
@@ -205,37 +293,42 @@ Scalar LoadBalancer::getMaxImbalance()
     }
 
 /*!
- * \param N_i Vector holding the total number of particles in each slice (will be allocated on call)
+ * \param load_i Vector holding the total load in each slice (will be allocated on call)
  * \param dim The dimension of the slices (x=0, y=1, z=2)
  * \param reduce_root The rank to perform the reduction on
- * \returns true if the current rank holds the active \a N_i
+ * \returns true if the current rank holds the active \a load_i
  *
- * \post \a N_i holds the number of particles in each slice along \a dim
+ * \post \a load_i holds the load in each slice along \a dim
  *
  * \note reduce() relies on collective MPI calls, and so all ranks must call it. However, for
  * efficiency the data will be active only on Cartesian rank \a reduce_root, as indicated by the
- * return value. As a result, only \a reduce_root actually needs to allocate memory for \a N_i.
+ * return value. As a result, only \a reduce_root actually needs to allocate memory for \a load_i.
  *
  * The reduction is performed by performing an all-to-one gather, followed by summation on \a
  * reduce_root. This operation may be suboptimal for very large numbers of processors, and could be
  * replaced by cascading send operations down dimensions. Generally, load balancing should not be
  * performed too frequently, and so we do not pursue this optimization right now.
  */
-bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
-                          unsigned int dim,
-                          unsigned int reduce_root)
+bool LoadBalancer::reduce(std::vector<Scalar>& load_i, unsigned int dim, unsigned int reduce_root)
     {
     // do nothing if there is only one rank
-    if (N_i.size() == 1)
+    if (load_i.size() == 1)
         return false;
 
     const Index3D& di = m_decomposition->getDomainIndexer();
-    std::vector<unsigned int> N_per_rank(di.getNumElements());
+    std::vector<Scalar> load_per_rank(di.getNumElements());
 
-    // get the number of particles the current rank owns (the quantity to be reduced)
-    unsigned int N_own = getNOwn();
+    // get the load of the particles the current rank owns (the quantity to be reduced)
+    Scalar load = getLoad();
 
-    MPI_Gather(&N_own, 1, MPI_UNSIGNED, &N_per_rank[0], 1, MPI_UNSIGNED, reduce_root, m_mpi_comm);
+    MPI_Gather(&load,
+               1,
+               MPI_HOOMD_SCALAR,
+               &load_per_rank[0],
+               1,
+               MPI_HOOMD_SCALAR,
+               reduce_root,
+               m_mpi_comm);
 
     // only the root rank performs the reduction
     if (m_exec_conf->getRank() != reduce_root)
@@ -245,57 +338,57 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
     ArrayHandle<unsigned int> h_cart_ranks_inv(m_decomposition->getInverseCartRanks(),
                                                access_location::host,
                                                access_mode::read);
-    std::vector<unsigned int> N_per_cart_rank(di.getNumElements());
+    std::vector<Scalar> load_per_cart_rank(di.getNumElements());
     for (unsigned int cur_rank = 0; cur_rank < di.getNumElements(); ++cur_rank)
         {
-        N_per_cart_rank[h_cart_ranks_inv.data[cur_rank]] = N_per_rank[cur_rank];
+        load_per_cart_rank[h_cart_ranks_inv.data[cur_rank]] = load_per_rank[cur_rank];
         }
 
     // perform the summation along dim in as cache friendly of a way as we can manage
     if (dim == 0) // to x
         {
-        N_i.clear();
-        N_i.resize(di.getW());
+        load_i.clear();
+        load_i.resize(di.getW());
         for (unsigned int i = 0; i < di.getW(); ++i)
             {
-            N_i[i] = 0;
+            load_i[i] = 0;
             for (unsigned int k = 0; k < di.getD(); ++k)
                 {
                 for (unsigned int j = 0; j < di.getH(); ++j)
                     {
-                    N_i[i] += N_per_cart_rank[di(i, j, k)];
+                    load_i[i] += load_per_cart_rank[di(i, j, k)];
                     }
                 }
             }
         }
     else if (dim == 1) // to y
         {
-        N_i.clear();
-        N_i.resize(di.getH());
+        load_i.clear();
+        load_i.resize(di.getH());
         for (unsigned int j = 0; j < di.getH(); ++j)
             {
-            N_i[j] = 0;
+            load_i[j] = 0;
             for (unsigned int k = 0; k < di.getD(); ++k)
                 {
                 for (unsigned int i = 0; i < di.getW(); ++i)
                     {
-                    N_i[j] += N_per_cart_rank[di(i, j, k)];
+                    load_i[j] += load_per_cart_rank[di(i, j, k)];
                     }
                 }
             }
         }
     else if (dim == 2) // to z
         {
-        N_i.clear();
-        N_i.resize(di.getD());
+        load_i.clear();
+        load_i.resize(di.getD());
         for (unsigned int k = 0; k < di.getD(); ++k)
             {
-            N_i[k] = 0;
+            load_i[k] = 0;
             for (unsigned int j = 0; j < di.getH(); ++j)
                 {
                 for (unsigned int i = 0; i < di.getW(); ++i)
                     {
-                    N_i[k] += N_per_cart_rank[di(i, j, k)];
+                    load_i[k] += load_per_cart_rank[di(i, j, k)];
                     }
                 }
             }
@@ -310,7 +403,7 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
 
 /*!
  * \param cum_frac_i The cumulative fraction array to write output into
- * \param N_i The reduced number of particles along the dimension
+ * \param load_i The reduced load along the dimension
  * \param L_i The global box length along the dimension
  * \param min_frac_i The minimum fractional width of a domain
  *
@@ -329,31 +422,32 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
  * minimization was successful, apply the adjustment to \a cum_frac_i.
  */
 bool LoadBalancer::adjust(vector<Scalar>& cum_frac_i,
-                          const vector<unsigned int>& N_i,
+                          const vector<Scalar>& load_i,
                           Scalar L_i,
                           Scalar min_frac_i)
     {
-    if (N_i.size() == 1)
+    if (load_i.size() == 1)
         return false;
 
-    // target particles per rank is uniform distribution
-    const Scalar target = Scalar(m_pdata->getNGlobal()) / Scalar(N_i.size());
+    // target load per slice is uniform distribution
+    const Scalar target
+        = std::accumulate(load_i.begin(), load_i.end(), Scalar(0.0)) / Scalar(load_i.size());
 
     // make the minimum domain slightly bigger so that the optimization won't fail at equality
     const Scalar min_domain_size = Scalar(1.00001) * min_frac_i * L_i;
     // if system is overconstrained (exactly decomposed) don't do any adjusting
-    if (min_domain_size * Scalar(N_i.size()) >= L_i)
+    if (min_domain_size * Scalar(load_i.size()) >= L_i)
         {
         return false;
         }
 
     // imbalance factors for each rank
-    vector<Scalar> new_widths(N_i.size());
-    for (unsigned int i = 0; i < N_i.size(); ++i)
+    vector<Scalar> new_widths(load_i.size());
+    for (unsigned int i = 0; i < load_i.size(); ++i)
         {
-        const Scalar imb_factor = Scalar(N_i[i]) / target;
+        const Scalar imb_factor = load_i[i] / target;
         Scalar scale_factor
-            = (N_i[i] > 0)
+            = (load_i[i] > 0)
                   ? Scalar(1.0) / imb_factor
                   : (Scalar(1.0)
                      + m_max_scale); // as in gromacs, use half the imbalance factor to scale
@@ -378,7 +472,7 @@ bool LoadBalancer::adjust(vector<Scalar>& cum_frac_i,
     // setup the augmented A matrix, with scale factor eps for the actual least squares part (to
     // enforce the inequality constraints correctly)
     const Scalar eps(0.001);
-    unsigned int m = (unsigned int)N_i.size();
+    unsigned int m = (unsigned int)load_i.size();
     unsigned int n = m - 1;
     Eigen::MatrixXd A = Eigen::MatrixXd::Zero(2 * m, n + m);
     A(0, 0) = 1.0;
@@ -457,12 +551,38 @@ bool LoadBalancer::adjust(vector<Scalar>& cum_frac_i,
     return false;
     }
 
+/*!
+ * \param timestep Current time step of the simulation
+ */
+void LoadBalancer::migrateParticles(uint64_t timestep)
+    {
+    m_comm->forceMigrate();
+    m_comm->communicate(timestep);
+    }
+
 /*!
  * \param cnts Map holding result of number of particles on each rank that neighbors the local rank
  */
 void LoadBalancer::countParticlesOffRank(std::map<unsigned int, unsigned int>& cnts)
     {
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    countPositionsOffRank(cnts, h_pos.data, m_pdata->getN());
+    }
+
+/*!
+ * \param cnts Map holding result of number of positions on each rank that neighbors the local rank
+ * \param h_pos Positions to count
+ * \param N Number of positions
+ *
+ * The ranks that own the positions are accumulated into \a cnts, so that multiple sets of
+ * positions can be counted. \a PosType is Scalar4 for the MD particles, but the MPCD particles
+ * may be stored in float4.
+ */
+template<class PosType>
+void LoadBalancer::countPositionsOffRank(std::map<unsigned int, unsigned int>& cnts,
+                                         const PosType* h_pos,
+                                         unsigned int N)
+    {
     ArrayHandle<unsigned int> h_cart_ranks(m_decomposition->getCartRanks(),
                                            access_location::host,
                                            access_mode::read);
@@ -471,9 +591,9 @@ void LoadBalancer::countParticlesOffRank(std::map<unsigned int, unsigned int>& c
     const Index3D& di = m_decomposition->getDomainIndexer();
     const uint3 rank_pos = m_decomposition->getGridPos();
 
-    for (unsigned int cur_p = 0; cur_p < m_pdata->getN(); ++cur_p)
+    for (unsigned int cur_p = 0; cur_p < N; ++cur_p)
         {
-        const Scalar4 cur_postype = h_pos.data[cur_p];
+        const PosType cur_postype = h_pos[cur_p];
         const Scalar3 cur_pos = make_scalar3(cur_postype.x, cur_postype.y, cur_postype.z);
         const Scalar3 f = box.makeFraction(cur_pos);
 
@@ -536,6 +656,15 @@ void LoadBalancer::countParticlesOffRank(std::map<unsigned int, unsigned int>& c
         }
     }
 
+template void LoadBalancer::countPositionsOffRank<Scalar4>(std::map<unsigned int, unsigned int>&,
+                                                           const Scalar4*,
+                                                           unsigned int);
+#if HOOMD_LONGREAL_SIZE == 64
+template void LoadBalancer::countPositionsOffRank<float4>(std::map<unsigned int, unsigned int>&,
+                                                          const float4*,
+                                                          unsigned int);
+#endif
+
 /*!
  * Each rank calls countParticlesOffRank() to count the number of particles to send to other ranks.
  * Neighboring ranks then perform send/receive calls, and count the new number of particles they own
@@ -593,7 +722,7 @@ void LoadBalancer::computeOwnedParticles()
     MPI_Waitall(nreq, req, stat);
 
     // reduce the particles sent to me
-    int N_own = m_pdata->getN();
+    int N_own = getNLocal();
     for (unsigned int cur_neigh = 0; cur_neigh < m_comm->getNUniqueNeighbors(); ++cur_neigh)
         {
         N_own += n_recv_ptls[cur_neigh];
@@ -614,6 +743,10 @@ void LoadBalancer::resetStats()
     m_n_calls = m_n_iterations = m_n_rebalances = 0;
     m_total_max_imbalance = 0.0;
     m_max_max_imbalance = Scalar(1.0);
+    m_last_max_imbalance = Scalar(1.0);
+
+    // do not measure the time between runs
+    m_has_time_sample = false;
     }
 
 namespace detail
@@ -628,7 +761,13 @@ void export_LoadBalancer(pybind11::module& m)
                       &LoadBalancer::setMaxIterations)
         .def_property("x", &LoadBalancer::getEnableX, &LoadBalancer::setEnableX)
         .def_property("y", &LoadBalancer::getEnableY, &LoadBalancer::setEnableY)
-        .def_property("z", &LoadBalancer::getEnableZ, &LoadBalancer::setEnableZ);
+        .def_property("z", &LoadBalancer::getEnableZ, &LoadBalancer::setEnableZ)
+        .def_property("objective", &LoadBalancer::getObjective, &LoadBalancer::setObjective)
+        .def_property("damping", &LoadBalancer::getDamping, &LoadBalancer::setDamping)
+        .def_property_readonly("imbalance", &LoadBalancer::getImbalance)
+        .def_property_readonly("average_imbalance", &LoadBalancer::getAverageImbalance)
+        .def_property_readonly("peak_imbalance", &LoadBalancer::getPeakImbalance)
+        .def_property_readonly("rebalances", &LoadBalancer::getNumRebalances);
     }
 
     } // end namespace detail
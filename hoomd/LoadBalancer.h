@@ -10,6 +10,7 @@
 #endif
 
 #pragma once
+#include "ClockSource.h"
 #include "Trigger.h"
 #include "Tuner.h"
 
@@ -24,8 +25,15 @@ namespace hoomd
 //! Updates domain decompositions to balance the load
 /*!
  * Adjusts the boundaries of the processor domains to distribute the load close to evenly between
- * them. The load imbalance is defined as the number of particles owned by a rank divided by the
- * average number of particles per rank if the particles had a uniform distribution.
+ * them. The load imbalance is defined as the load of a rank divided by the average load per rank.
+ * The load is set by the objective:
+ *  - particles: The load is the number of particles owned by the rank.
+ *  - time: The load is the number of particles owned by the rank times the measured cost per
+ *    particle on that rank. The cost per particle is the wall clock time that the rank spent
+ *    outside of the communicator between balancing steps divided by the number of particles it
+ *    owned. Successive measurements are averaged with an exponential moving average (controlled by
+ *    the damping factor) to prevent oscillations. Particles that move to another domain are assumed
+ *    to take on the cost per particle of the receiving rank.
  *
  * At each load balancing step, we attempt to rescale the domain size by the inverse of the load
  * balance, subject to the following constraints that are imposed to both maintain a stable
@@ -136,6 +144,55 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
         return m_enable_z;
         }
 
+    //! Set the load balancing objective
+    /*!
+     * \param objective "particles" to balance particle counts, "time" to balance measured time
+     */
+    void setObjective(const std::string& objective);
+
+    //! Get the load balancing objective
+    std::string getObjective() const
+        {
+        return m_time_objective ? "time" : "particles";
+        }
+
+    //! Set the damping of the measured cost per particle
+    /*!
+     * \param damping Weight of the previous cost per particle in the moving average (0 <= damping
+     * < 1)
+     */
+    void setDamping(Scalar damping);
+
+    //! Get the damping of the measured cost per particle
+    Scalar getDamping() const
+        {
+        return m_damping;
+        }
+
+    //! Get the maximum load imbalance at the last balancing step (before adjustment)
+    Scalar getImbalance() const
+        {
+        return m_last_max_imbalance;
+        }
+
+    //! Get the average maximum load imbalance over the balancing steps since the last reset
+    Scalar getAverageImbalance() const
+        {
+        return m_n_calls > 0 ? Scalar(m_total_max_imbalance / double(m_n_calls)) : Scalar(1.0);
+        }
+
+    //! Get the largest load imbalance since the last reset
+    Scalar getPeakImbalance() const
+        {
+        return m_max_max_imbalance;
+        }
+
+    //! Get the number of rebalances (migrations) performed since the last reset
+    uint64_t getNumRebalances() const
+        {
+        return m_n_rebalances;
+        }
+
     //! Take one timestep forward
     virtual void update(uint64_t timestep);
 
@@ -155,8 +212,8 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
     //! Computes the maximum imbalance factor
     Scalar getMaxImbalance();
 
-    //! Reduce the particle numbers per rank down to one dimension
-    bool reduce(std::vector<unsigned int>& N_i, unsigned int dim, unsigned int reduce_root);
+    //! Reduce the loads per rank down to one dimension
+    bool reduce(std::vector<Scalar>& load_i, unsigned int dim, unsigned int reduce_root);
 
     //! Set flags within the class that a resize has been performed
     void signalResize()
@@ -168,16 +225,50 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
 
     //! Adjust the partitioning along a single dimension
     bool adjust(std::vector<Scalar>& cum_frac_i,
-                const std::vector<unsigned int>& N_i,
+                const std::vector<Scalar>& load_i,
                 Scalar L_i,
                 Scalar min_domain_frac);
 
+    //! Measure the cost per particle since the last balancing step
+    void measureCost();
+
     //! Compute the number of particles on each rank after an adjustment
     void computeOwnedParticles();
 
+    //! Migrate the particles onto the adjusted domains
+    virtual void migrateParticles(uint64_t timestep);
+
     //! Count the number of particles that have gone off the rank
     virtual void countParticlesOffRank(std::map<unsigned int, unsigned int>& cnts);
 
+    //! Count the number of positions that have gone off the rank
+    template<class PosType>
+    void countPositionsOffRank(std::map<unsigned int, unsigned int>& cnts,
+                               const PosType* h_pos,
+                               unsigned int N);
+
+    //! Get the number of particles currently on the rank
+    /*!
+     * \returns Number of particles to balance that are on the rank
+     *
+     * Derived classes can override this method (together with getNGlobal() and
+     * countParticlesOffRank()) to balance additional particles.
+     */
+    virtual unsigned int getNLocal()
+        {
+        return m_pdata->getN();
+        }
+
+    //! Get the total number of particles to balance
+    /*!
+     * \note This method is called on the reduction root only during an adjustment, so it must not
+     * make collective MPI calls.
+     */
+    virtual unsigned int getNGlobal()
+        {
+        return m_pdata->getNGlobal();
+        }
+
     //! Gets the number of owned particles, updating if necessary
     unsigned int getNOwn()
         {
@@ -185,6 +276,13 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
         return m_N_own;
         }
 
+    //! Gets the load of the owned particles, updating if necessary
+    Scalar getLoad()
+        {
+        Scalar N_own = Scalar(getNOwn());
+        return m_time_objective && m_has_cost ? m_cost * N_own : N_own;
+        }
+
     //! Force a reset of the number of owned particles without counting
     /*!
      * \param N number of particles owned by the rank
@@ -211,6 +309,17 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
 
     const Scalar m_max_scale; //!< Maximum fraction to rescale either direction (5%)
 
+    bool m_time_objective; //!< True to balance the measured time instead of particle counts
+    Scalar m_damping;      //!< Weight of the previous cost in the moving average
+    Scalar m_cost;         //!< Measured cost (time) per particle on this rank
+    bool m_has_cost;       //!< True once the cost has been measured (on all ranks)
+
+    ClockSource m_clock;         //!< Clock to measure the time between balancing steps
+    bool m_has_time_sample;      //!< True if the previous step recorded the times below
+    int64_t m_last_time;         //!< Wall clock time at the end of the previous step
+    double m_last_comm_time;     //!< Communication time at the end of the previous step
+    Scalar m_last_max_imbalance; //!< Maximum imbalance at the last step before adjustment
+
     private:
     unsigned int m_N_own; //!< Number of particles owned by this rank
 
@@ -5,11 +5,16 @@
 
 #ifdef ENABLE_MPI
 #include "HOOMDMPI.h"
+#if defined(OPEN_MPI) && OPEN_MPI
+#include <mpi-ext.h>
+#endif
 #endif
 
+#include <cstdlib>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
+#include <string>
 
 /*! \file MPIConfiguration.cc
     \brief Defines MPIConfiguration and related classes
@@ -23,7 +28,7 @@ MPIConfiguration::MPIConfiguration(
     MPI_Comm hoomd_world
 #endif
     )
-    : m_rank(0), m_n_rank(1)
+    : m_rank(0), m_n_rank(1), m_gpu_aware_mpi(detectGPUAwareMPI())
     {
 #ifdef ENABLE_MPI
     m_mpi_comm = m_hoomd_world = hoomd_world;
@@ -36,6 +41,8 @@ MPIConfiguration::MPIConfiguration(
     int rank;
     MPI_Comm_rank(m_mpi_comm, &rank);
     m_rank = rank;
+
+    splitNodes();
 #endif
     }
 
@@ -68,6 +75,21 @@ void MPIConfiguration::splitPartitions(unsigned int nrank)
 
     MPI_Comm_rank(m_mpi_comm, &rank);
     m_rank = rank;
+
+    // the node communicator must only contain ranks of the new partition
+    MPI_Comm_free(&m_node_comm);
+    splitNodes();
+#endif
+    }
+
+/*! The ranks are ordered by their rank in the partition, so rank 0 of the node communicator is
+    the lowest rank of the partition on each node. MPI_Comm_split_type groups the ranks by shared
+    memory, which identifies the node more reliably than comparing processor names.
+*/
+void MPIConfiguration::splitNodes()
+    {
+#ifdef ENABLE_MPI
+    MPI_Comm_split_type(m_mpi_comm, MPI_COMM_TYPE_SHARED, m_rank, MPI_INFO_NULL, &m_node_comm);
 #endif
     }
 
@@ -82,6 +104,59 @@ unsigned int MPIConfiguration::getNRanks() const
 #endif
     }
 
+unsigned int MPIConfiguration::getNodeRank() const
+    {
+#ifdef ENABLE_MPI
+    int rank;
+    MPI_Comm_rank(m_node_comm, &rank);
+    return rank;
+#else
+    return 0;
+#endif
+    }
+
+unsigned int MPIConfiguration::getNNodeRanks() const
+    {
+#ifdef ENABLE_MPI
+    int size;
+    MPI_Comm_size(m_node_comm, &size);
+    return size;
+#else
+    return 1;
+#endif
+    }
+
+/*! \returns True if MPI can communicate GPU device buffers directly
+
+    Open MPI is queried for CUDA and ROCm support with its extensions. Other implementations
+    cannot be queried, so Cray MPICH is detected from MPICH_GPU_SUPPORT_ENABLED. The environment
+    variable HOOMD_GPU_AWARE_MPI takes precedence over the detection when it is set.
+*/
+bool MPIConfiguration::detectGPUAwareMPI()
+    {
+    const char* env_override = std::getenv("HOOMD_GPU_AWARE_MPI");
+    if (env_override)
+        {
+        return std::string(env_override) != "0";
+        }
+
+#ifdef ENABLE_MPI
+#if defined(MPIX_CUDA_AWARE_SUPPORT) && MPIX_CUDA_AWARE_SUPPORT
+    if (MPIX_Query_cuda_support())
+        return true;
+#endif
+#if defined(MPIX_ROCM_AWARE_SUPPORT) && MPIX_ROCM_AWARE_SUPPORT
+    if (MPIX_Query_rocm_support())
+        return true;
+#endif
+    const char* env_cray = std::getenv("MPICH_GPU_SUPPORT_ENABLED");
+    if (env_cray && std::string(env_cray) == "1")
+        return true;
+#endif
+
+    return false;
+    }
+
 namespace detail
     {
 void export_MPIConfiguration(pybind11::module& m)
@@ -95,10 +170,13 @@ void export_MPIConfiguration(pybind11::module& m)
         .def("getNPartitions", &MPIConfiguration::getNPartitions)
         .def("getNRanks", &MPIConfiguration::getNRanks)
         .def("getRank", &MPIConfiguration::getRank)
+        .def("getNodeRank", &MPIConfiguration::getNodeRank)
+        .def("getNNodeRanks", &MPIConfiguration::getNNodeRanks)
         .def("barrier", &MPIConfiguration::barrier)
         .def("getNRanksGlobal", &MPIConfiguration::getNRanksGlobal)
         .def("getRankGlobal", &MPIConfiguration::getRankGlobal)
         .def("getWalltime", &MPIConfiguration::getWalltime)
+        .def("isGPUAwareMPI", &MPIConfiguration::isGPUAwareMPI)
 #ifdef ENABLE_MPI
         .def_static("_make_mpi_conf_mpi_comm",
                     [](pybind11::object mpi_comm) -> std::shared_ptr<MPIConfiguration>
@@ -63,6 +63,12 @@ class PYBIND11_EXPORT MPIConfiguration
         {
         return m_hoomd_world;
         }
+
+    //! Returns the communicator of the ranks in this partition that share memory with this rank
+    MPI_Comm getNodeCommunicator() const
+        {
+        return m_node_comm;
+        }
 #endif
 
     //!< Partition the communicator
@@ -116,6 +122,22 @@ class PYBIND11_EXPORT MPIConfiguration
     //! Return the number of ranks in this partition
     unsigned int getNRanks() const;
 
+    //! Return the rank of this processor among the ranks of the partition on the same node
+    unsigned int getNodeRank() const;
+
+    //! Return the number of ranks of the partition on the same node
+    unsigned int getNNodeRanks() const;
+
+    //! Returns true if MPI can communicate GPU device buffers directly
+    /*! The MPI library is queried for CUDA or ROCm support when it is constructed if the
+        implementation supports it. The detection can be overridden by setting the environment
+        variable HOOMD_GPU_AWARE_MPI to 0 or 1.
+    */
+    bool isGPUAwareMPI() const
+        {
+        return m_gpu_aware_mpi;
+        }
+
     //! Returns true if this is the root processor
     bool isRoot() const
         {
@@ -143,9 +165,17 @@ class PYBIND11_EXPORT MPIConfiguration
 #ifdef ENABLE_MPI
     MPI_Comm m_mpi_comm;    //!< The MPI communicator
     MPI_Comm m_hoomd_world; //!< The HOOMD world communicator
+    MPI_Comm m_node_comm;   //!< Ranks of the partition that share memory with this rank
 #endif
     unsigned int m_rank;   //!< Rank of this processor (0 if running in single-processor mode)
     unsigned int m_n_rank; //!< Ranks per partition
+    bool m_gpu_aware_mpi;  //!< True if MPI supports GPU device buffers
+
+    //! Detect whether MPI supports GPU device buffers
+    static bool detectGPUAwareMPI();
+
+    //! Split the partition into the ranks that share memory
+    void splitNodes();
 
     /// Clock to provide rank synchronized walltime.
     ClockSource m_clock;
@@ -0,0 +1,215 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MemoryPool.h
+    \brief Declares a stream-ordered pool for device memory allocations
+*/
+
+#ifndef __MEMORY_POOL_H__
+#define __MEMORY_POOL_H__
+
+#ifdef ENABLE_HIP
+#include <hip/hip_runtime.h>
+
+#include <cstdint>
+#include <stdexcept>
+
+// stream-ordered allocation is available since CUDA 11.2 and HIP 5.3
+#if (defined(__HIP_PLATFORM_NVCC__) && CUDART_VERSION >= 11020) \
+    || (defined(__HIP_PLATFORM_HCC__) && HIP_VERSION >= 50300000)
+#define HOOMD_HAS_MEMORY_POOL
+#endif
+
+namespace hoomd
+    {
+//! Stream-ordered pool for device memory allocations
+/*! When enabled, MemoryPool allocates device memory from the default memory pool of the device
+    with hipMallocAsync and returns it with hipFreeAsync, both ordered on the default stream.
+    Freed memory stays in the pool up to the release threshold so that later allocations (such as
+    GPUVector resizes and temporary buffers) do not call into the driver. When disabled, or when
+    the device does not support memory pools, it falls back to hipMalloc and hipFree.
+
+    Every allocation records whether it came from the pool so that it is freed correctly even
+    when the pool is toggled while the allocation is alive.
+
+    \ingroup utils
+*/
+class __attribute__((visibility("default"))) MemoryPool
+    {
+    public:
+    //! Constructor
+    /*! \param device Device to allocate memory on
+     */
+    MemoryPool(int device)
+        {
+#ifdef HOOMD_HAS_MEMORY_POOL
+        int supported = 0;
+        hipDeviceGetAttribute(&supported, hipDeviceAttributeMemoryPoolsSupported, device);
+        m_supported = supported != 0;
+        if (m_supported)
+            hipDeviceGetDefaultMemPool(&m_pool, device);
+#endif
+        }
+
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
+    //! Test whether the device supports memory pools
+    bool isSupported() const
+        {
+        return m_supported;
+        }
+
+    //! Set whether new allocations come from the pool
+    void setEnabled(bool enable)
+        {
+        if (enable && !m_supported)
+            {
+            throw std::runtime_error("The device does not support memory pools.");
+            }
+        m_enabled = enable;
+        }
+
+    //! Test whether new allocations come from the pool
+    bool isEnabled() const
+        {
+        return m_enabled;
+        }
+
+    //! Allocate device memory
+    /*! \param ptr Pointer to the allocation (output)
+        \param num_bytes Number of bytes to allocate
+        \param pooled Set to true when the allocation comes from the pool (output)
+        \returns The error code of the allocation
+    */
+    hipError_t allocate(void** ptr, size_t num_bytes, bool& pooled) const
+        {
+#ifdef HOOMD_HAS_MEMORY_POOL
+        if (m_enabled)
+            {
+            pooled = true;
+            return hipMallocAsync(ptr, num_bytes, 0);
+            }
+#endif
+        pooled = false;
+        return hipMalloc(ptr, num_bytes);
+        }
+
+    //! Free device memory
+    /*! \param ptr Allocation to free
+        \param pooled True when the allocation came from the pool
+    */
+    static void deallocate(void* ptr, bool pooled)
+        {
+#ifdef HOOMD_HAS_MEMORY_POOL
+        if (pooled)
+            {
+            hipFreeAsync(ptr, 0);
+            return;
+            }
+#endif
+        hipFree(ptr);
+        }
+
+    //! Set the number of unused bytes the pool keeps before releasing memory to the device
+    void setReleaseThreshold(uint64_t threshold)
+        {
+        m_release_threshold = threshold;
+#ifdef HOOMD_HAS_MEMORY_POOL
+        if (m_supported)
+            hipMemPoolSetAttribute(m_pool, hipMemPoolAttrReleaseThreshold, &threshold);
+#endif
+        }
+
+    //! Get the release threshold (in bytes)
+    uint64_t getReleaseThreshold() const
+        {
+        return m_release_threshold;
+        }
+
+    //! Get the number of bytes the pool currently holds from the device
+    uint64_t getReservedBytes() const
+        {
+#ifdef HOOMD_HAS_MEMORY_POOL
+        return getAttribute(hipMemPoolAttrReservedMemCurrent);
+#else
+        return 0;
+#endif
+        }
+
+    //! Get the number of bytes currently allocated from the pool
+    uint64_t getUsedBytes() const
+        {
+#ifdef HOOMD_HAS_MEMORY_POOL
+        return getAttribute(hipMemPoolAttrUsedMemCurrent);
+#else
+        return 0;
+#endif
+        }
+
+    //! Get the largest number of bytes the pool has held since the last reset
+    uint64_t getPeakReservedBytes() const
+        {
+#ifdef HOOMD_HAS_MEMORY_POOL
+        return getAttribute(hipMemPoolAttrReservedMemHigh);
+#else
+        return 0;
+#endif
+        }
+
+    //! Get the largest number of bytes allocated from the pool since the last reset
+    uint64_t getPeakUsedBytes() const
+        {
+#ifdef HOOMD_HAS_MEMORY_POOL
+        return getAttribute(hipMemPoolAttrUsedMemHigh);
+#else
+        return 0;
+#endif
+        }
+
+    //! Get the fraction of the reserved memory that is not allocated
+    double getFragmentation() const
+        {
+        uint64_t reserved = getReservedBytes();
+        if (reserved == 0)
+            return 0;
+        return 1.0 - double(getUsedBytes()) / double(reserved);
+        }
+
+    //! Reset the peak statistics
+    void resetPeak()
+        {
+#ifdef HOOMD_HAS_MEMORY_POOL
+        if (m_supported)
+            {
+            uint64_t zero = 0;
+            hipMemPoolSetAttribute(m_pool, hipMemPoolAttrReservedMemHigh, &zero);
+            hipMemPoolSetAttribute(m_pool, hipMemPoolAttrUsedMemHigh, &zero);
+            }
+#endif
+        }
+
+    private:
+    bool m_supported = false;         //!< True when the device supports memory pools
+    bool m_enabled = false;           //!< True when new allocations come from the pool
+    uint64_t m_release_threshold = 0; //!< Unused bytes kept in the pool
+
+#ifdef HOOMD_HAS_MEMORY_POOL
+    hipMemPool_t m_pool; //!< The default memory pool of the device
+
+    //! Query a memory pool attribute
+    uint64_t getAttribute(hipMemPoolAttr attr) const
+        {
+        if (!m_supported)
+            return 0;
+        uint64_t value = 0;
+        hipMemPoolGetAttribute(m_pool, attr, &value);
+        return value;
+        }
+#endif
+    };
+
+    } // end namespace hoomd
+
+#endif // ENABLE_HIP
+#endif // __MEMORY_POOL_H__
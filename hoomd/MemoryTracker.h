@@ -0,0 +1,190 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MemoryTracker.h
+    \brief Declares a registry of the memory held by GPUArray and GlobalArray allocations
+*/
+
+#ifndef __MEMORY_TRACKER_H__
+#define __MEMORY_TRACKER_H__
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace hoomd
+    {
+//! Memory held by one owner
+struct MemoryUsage
+    {
+    size_t host = 0;        //!< Bytes of host memory currently allocated
+    size_t device = 0;      //!< Bytes of device (or managed) memory currently allocated
+    size_t peak_host = 0;   //!< Largest value of host
+    size_t peak_device = 0; //!< Largest value of device
+
+    //! Add an allocation
+    void add(size_t bytes, bool on_device)
+        {
+        if (on_device)
+            {
+            device += bytes;
+            peak_device = std::max(peak_device, device);
+            }
+        else
+            {
+            host += bytes;
+            peak_host = std::max(peak_host, host);
+            }
+        }
+
+    //! Remove an allocation
+    void remove(size_t bytes, bool on_device)
+        {
+        size_t& current = on_device ? device : host;
+        current -= std::min(current, bytes);
+        }
+    };
+
+//! Registry of the memory held by GPUArray and GlobalArray allocations
+/*! The deleters of GPUArray, GlobalArray, and the GPUVector classes built on them record every
+    allocation with the tag of the array (see TAG_ALLOCATION) and remove it when the memory is
+    freed. Arrays that have no tag are recorded under the empty string. When an array is tagged
+    after it allocates, its bytes move to the new tag.
+
+    MemoryTracker keeps the current and peak number of bytes of each tag and of all tags together,
+    separately for host and device memory. Managed memory counts as device memory. Mapped pinned
+    memory counts only as host memory. The tracker does not see temporary buffers from
+    CachedAllocator, the memory pool reserve, or memory that external libraries allocate.
+
+    Allocations are infrequent, so every method takes a lock. Replicas in a hoomd.Ensemble share
+    the execution configuration and may allocate concurrently.
+
+    \ingroup utils
+*/
+class MemoryTracker
+    {
+    public:
+    //! Record an allocation
+    /*! \param tag Owner of the allocation
+        \param bytes Size of the allocation
+        \param on_device True for device or managed memory, false for host memory
+    */
+    void allocate(const std::string& tag, size_t bytes, bool on_device)
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_usage[tag].add(bytes, on_device);
+        m_total.add(bytes, on_device);
+        }
+
+    //! Record that an allocation is freed
+    /*! \param tag Owner of the allocation
+        \param bytes Size of the allocation
+        \param on_device True for device or managed memory, false for host memory
+    */
+    void deallocate(const std::string& tag, size_t bytes, bool on_device)
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_usage[tag].remove(bytes, on_device);
+        m_total.remove(bytes, on_device);
+        }
+
+    //! Move an allocation to a different owner
+    /*! \param old_tag Previous owner of the allocation
+        \param new_tag New owner of the allocation
+        \param bytes Size of the allocation
+        \param on_device True for device or managed memory, false for host memory
+
+        The total is unchanged.
+    */
+    void retag(const std::string& old_tag,
+               const std::string& new_tag,
+               size_t bytes,
+               bool on_device)
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_usage[old_tag].remove(bytes, on_device);
+        m_usage[new_tag].add(bytes, on_device);
+        }
+
+    //! Get the memory held by each owner
+    std::map<std::string, MemoryUsage> getUsage() const
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_usage;
+        }
+
+    //! Get the memory held by all owners
+    MemoryUsage getTotal() const
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_total;
+        }
+
+    //! Reset the peak values to the current values
+    void resetPeak()
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& item : m_usage)
+            {
+            item.second.peak_host = item.second.host;
+            item.second.peak_device = item.second.device;
+            }
+        m_total.peak_host = m_total.host;
+        m_total.peak_device = m_total.device;
+        }
+
+    private:
+    mutable std::mutex m_mutex;                 //!< Protects the usage
+    std::map<std::string, MemoryUsage> m_usage; //!< Memory held by each owner
+    MemoryUsage m_total;                        //!< Memory held by all owners
+    };
+
+namespace detail
+    {
+//! Get the name of the class from a function signature
+/*! \param signature Signature of a member function, as given by __PRETTY_FUNCTION__
+    \returns The name of the class without namespaces or template arguments, or an empty string
+    when \a signature is not a member function.
+
+    TAG_ALLOCATION uses this to name each array after the class that owns it.
+*/
+inline std::string allocation_owner(const std::string& signature)
+    {
+    // drop the argument list (and the template arguments gcc appends after it)
+    std::string name = signature.substr(0, signature.find('('));
+
+    // drop the function name
+    size_t pos = name.rfind("::");
+    if (pos == std::string::npos)
+        return std::string();
+    name.erase(pos);
+
+    // drop the template arguments of the class
+    if (!name.empty() && name.back() == '>')
+        {
+        int depth = 0;
+        size_t i = name.size();
+        while (i > 0)
+            {
+            --i;
+            if (name[i] == '>')
+                depth++;
+            else if (name[i] == '<' && --depth == 0)
+                break;
+            }
+        name.erase(i);
+        }
+
+    // drop the namespaces and the return type
+    pos = name.find_last_of(": ");
+    if (pos != std::string::npos)
+        name.erase(0, pos + 1);
+    return name;
+    }
+    } // end namespace detail
+
+    } // end namespace hoomd
+
+#endif // __MEMORY_TRACKER_H__
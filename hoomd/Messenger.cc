@@ -6,7 +6,6 @@
 */
 
 #include "Messenger.h"
-#include "ClockSource.h"
 #include "ExecutionConfiguration.h"
 
 #ifdef ENABLE_MPI
@@ -25,6 +24,52 @@ namespace hoomd
     {
 namespace detail
     {
+//! Stream buffer that writes each flushed message to the target stream at once
+/*! Messages from several ranks that write to the same stream interleave at the granularity of the
+    writes. Buffering the characters until the stream is flushed makes every message one write.
+*/
+class message_buffer : public std::streambuf
+    {
+    public:
+    //! Set the stream to write to
+    void setTarget(std::ostream* target)
+        {
+        m_target = target;
+        }
+
+    protected:
+    //! Buffer a character
+    virtual int overflow(int ch)
+        {
+        if (ch != traits_type::eof())
+            m_buffer.push_back(char(ch));
+        return 0;
+        }
+
+    //! Buffer a string of characters
+    virtual std::streamsize xsputn(const char* s, std::streamsize n)
+        {
+        m_buffer.append(s, size_t(n));
+        return n;
+        }
+
+    //! Write the buffered message
+    virtual int sync()
+        {
+        if (m_target && !m_buffer.empty())
+            {
+            m_target->write(m_buffer.data(), m_buffer.size());
+            m_target->flush();
+            }
+        m_buffer.clear();
+        return 0;
+        }
+
+    private:
+    std::ostream* m_target = nullptr; //!< Stream to write to
+    std::string m_buffer;             //!< Buffered message
+    };
+
 #ifdef ENABLE_MPI
 //! Class that supports writing to a shared log file using MPI-IO
 class mpi_io : public std::streambuf
@@ -70,6 +115,8 @@ Messenger::Messenger(std::shared_ptr<MPIConfiguration> mpi_config) : m_mpi_confi
     m_notice_stream = &cout;
 
     m_nullstream = std::shared_ptr<detail::nullstream>(new detail::nullstream());
+    m_err_all_ranks_buf = std::make_shared<detail::message_buffer>();
+    m_err_all_ranks_stream = std::make_shared<std::ostream>(m_err_all_ranks_buf.get());
     m_notice_level = 2;
     m_err_prefix = "**ERROR**";
     m_warning_prefix = "*Warning*";
@@ -95,6 +142,8 @@ Messenger::Messenger(const Messenger& msg)
     m_streambuf_out = msg.m_streambuf_out;
     m_streambuf_err = msg.m_streambuf_err;
     m_nullstream = msg.m_nullstream;
+    m_err_all_ranks_buf = msg.m_err_all_ranks_buf;
+    m_err_all_ranks_stream = msg.m_err_all_ranks_stream;
     m_file_out = msg.m_file_out;
     m_file_err = msg.m_file_err;
     m_err_prefix = msg.m_err_prefix;
@@ -113,6 +162,8 @@ Messenger& Messenger::operator=(Messenger& msg)
     m_streambuf_out = msg.m_streambuf_out;
     m_streambuf_err = msg.m_streambuf_err;
     m_nullstream = msg.m_nullstream;
+    m_err_all_ranks_buf = msg.m_err_all_ranks_buf;
+    m_err_all_ranks_stream = msg.m_err_all_ranks_stream;
     m_file_out = msg.m_file_out;
     m_file_err = msg.m_file_err;
     m_err_prefix = msg.m_err_prefix;
@@ -163,23 +214,23 @@ std::ostream& Messenger::error()
 
     errorAllRanks() is intended to be used when only one or a small number of ranks report an error.
    All ranks that call will errorAllRanks() will write output. Callers should flush the stream.
+
+    The message is buffered until the stream is flushed and then written to the error stream at
+   once, so that the messages of different ranks do not interleave within a message.
 */
 std::ostream& Messenger::errorAllRanks()
     {
     assert(m_err_stream);
 
     reopenPythonIfNeeded();
-
-    // Delay so that multiple ranks calling this have a good chance of writing non-overlapping
-    // messages
-    Sleep(m_mpi_config->getRank() * 10);
+    m_err_all_ranks_buf->setTarget(m_err_stream);
 
     if (m_err_prefix != string(""))
-        *m_err_stream << m_err_prefix << ": ";
+        *m_err_all_ranks_stream << m_err_prefix << ": ";
     if (m_mpi_config->getNRanks() > 1)
-        *m_err_stream << " (Rank " << m_mpi_config->getRank() << "): ";
+        *m_err_all_ranks_stream << " (Rank " << m_mpi_config->getRank() << "): ";
 
-    return *m_err_stream;
+    return *m_err_all_ranks_stream;
     }
 
 /*! \param msg Message to print
@@ -243,52 +294,64 @@ std::ostream& Messenger::notice(unsigned int level)
 
  \param level The notice level
  \param msg Content of the notice
+
+ The notices are combined in a binary tree. Every rank merges the runs of identical notices of its
+ subtree before it sends them on, so an identical notice is sent only once per subtree and rank 0
+ receives one message for every run of ranks instead of one for every rank.
  */
 void Messenger::collectiveNoticeStr(unsigned int level, const std::string& msg)
     {
-    std::vector<std::string> rank_notices;
+    // first rank and notice of every run of ranks with identical notices
+    std::vector<std::pair<unsigned int, std::string>> runs;
+    runs.push_back(std::make_pair(m_mpi_config->getRank(), msg));
 
 #ifdef ENABLE_MPI
-    gather_v(msg, rank_notices, 0, m_mpi_config->getCommunicator());
-#else
-    rank_notices.push_back(msg);
-#endif
+    const unsigned int rank = m_mpi_config->getRank();
+    const unsigned int n_ranks = m_mpi_config->getNRanks();
+    const MPI_Comm comm = m_mpi_config->getCommunicator();
 
-#ifdef ENABLE_MPI
-    if (m_mpi_config->getRank() == 0)
+    // the subtree of a rank covers the ranks [rank, rank + 2*step), so appending keeps rank order
+    for (unsigned int step = 1; step < n_ranks; step *= 2)
         {
-        if (rank_notices.size() > 1)
+        if (rank % (2 * step) != 0)
+            {
+            send(runs, rank - step, comm);
+            break;
+            }
+        else if (rank + step < n_ranks)
+            {
+            std::vector<std::pair<unsigned int, std::string>> recv_runs;
+            recv(recv_runs, rank + step, comm);
+
+            auto it = recv_runs.begin();
+            if (it != recv_runs.end() && it->second == runs.back().second)
+                ++it;
+            runs.insert(runs.end(), it, recv_runs.end());
+            }
+        }
+
+    if (rank == 0)
+        {
+        if (n_ranks > 1)
             {
             // Output notices in rank order, combining similar ones
-            std::vector<std::string>::iterator notice_it;
-            std::string last_msg = rank_notices[0];
-            int last_output_rank = -1;
-            for (notice_it = rank_notices.begin(); notice_it != rank_notices.end() + 1; notice_it++)
+            for (auto it = runs.begin(); it != runs.end(); ++it)
                 {
-                if (notice_it == rank_notices.end() || *notice_it != last_msg)
-                    {
-                    int rank = int(notice_it - rank_notices.begin());
-                    // output message for accumulated ranks
-                    if (last_output_rank + 1 == rank - 1)
-                        notice(level)
-                            << "Rank " << last_output_rank + 1 << ": " << last_msg << std::flush;
-                    else
-                        notice(level) << "Ranks " << last_output_rank + 1 << "-" << rank - 1 << ": "
-                                      << last_msg << std::flush;
-
-                    if (notice_it != rank_notices.end())
-                        {
-                        last_msg = *notice_it;
-                        last_output_rank = rank - 1;
-                        }
-                    }
+                const unsigned int first = it->first;
+                const unsigned int last
+                    = (it + 1 != runs.end()) ? (it + 1)->first - 1 : n_ranks - 1;
+                if (first == last)
+                    notice(level) << "Rank " << first << ": " << it->second << std::flush;
+                else
+                    notice(level) << "Ranks " << first << "-" << last << ": " << it->second
+                                  << std::flush;
                 }
             }
         else
 #endif
             {
             // output without prefix
-            notice(level) << rank_notices[0] << std::flush;
+            notice(level) << runs[0].second << std::flush;
             }
 #ifdef ENABLE_MPI
         }
@@ -376,6 +439,8 @@ void Messenger::reopenPythonIfNeeded()
     // and python is initialized
     if (m_python_open && Py_IsInitialized())
         {
+        pybind11::gil_scoped_acquire gil;
+
         // flush and reopen the streams if sys.stdout or sys.stderr change
         pybind11::object new_pystdout = m_sys.attr("stdout");
         pybind11::object new_pystderr = m_sys.attr("stderr");
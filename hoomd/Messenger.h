@@ -35,6 +35,8 @@ struct PYBIND11_EXPORT nullstream : std::ostream
     nullstream() : std::ios(0), std::ostream(0) { }
     };
 
+class message_buffer;
+
     } // end namespace detail
 
 //! Utility class for controlling message printing
@@ -271,6 +273,10 @@ class PYBIND11_EXPORT Messenger
     std::shared_ptr<std::ostream> m_file_out;         //!< File stream (stdout)
     std::shared_ptr<std::ostream> m_file_err;         //!< File stream (stderr)
 
+    //! Buffers each message of errorAllRanks() so it is written at once
+    std::shared_ptr<detail::message_buffer> m_err_all_ranks_buf;
+    std::shared_ptr<std::ostream> m_err_all_ranks_stream; //!< Stream for errorAllRanks()
+
     std::string m_err_prefix;     //!< Prefix for error messages
     std::string m_warning_prefix; //!< Prefix for warning messages
     std::string m_notice_prefix;  //!< Prefix for notice messages
@@ -0,0 +1,182 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file OperationTimer.cc
+    \brief Defines the OperationTimer class
+*/
+
+#include "OperationTimer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+namespace hoomd
+    {
+namespace
+    {
+//! Get the number of valid samples in a ring buffer
+size_t numValid(uint64_t num_samples)
+    {
+    return size_t(std::min<uint64_t>(num_samples, OperationTimer::window_size));
+    }
+
+//! Compute the mean of the valid samples in a ring buffer
+double mean(const std::vector<double>& samples, uint64_t num_samples)
+    {
+    size_t n = numValid(num_samples);
+    if (n == 0)
+        return 0;
+    return std::accumulate(samples.begin(), samples.begin() + n, 0.0) / double(n);
+    }
+    } // end anonymous namespace
+
+OperationTimer::OperationTimer(std::shared_ptr<const ExecutionConfiguration> exec_conf)
+    : m_exec_conf(exec_conf), m_samples(window_size), m_gpu_samples(window_size)
+    {
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        hipEventCreate(&m_gpu_start);
+        hipEventCreate(&m_gpu_stop);
+        }
+#endif
+    }
+
+OperationTimer::~OperationTimer()
+    {
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        hipEventDestroy(m_gpu_start);
+        hipEventDestroy(m_gpu_stop);
+        }
+#endif
+    }
+
+void OperationTimer::begin()
+    {
+#ifdef ENABLE_HIP
+    m_gpu_timing = m_exec_conf->isCUDAEnabled() && m_exec_conf->operationGPUTimingEnabled();
+    if (m_gpu_timing)
+        {
+        collectGPUSample();
+        // a sample still in flight is dropped when its events are reused
+        m_gpu_pending = false;
+        hipEventRecord(m_gpu_start, 0);
+        }
+#endif
+
+    m_start = m_clock.getTime();
+    }
+
+void OperationTimer::end()
+    {
+    const double elapsed = double(m_clock.getTime() - m_start) / 1e9;
+    m_samples[m_num_calls % window_size] = elapsed;
+    m_total += elapsed;
+    m_num_calls++;
+
+#ifdef ENABLE_HIP
+    if (m_gpu_timing)
+        {
+        hipEventRecord(m_gpu_stop, 0);
+        m_gpu_pending = true;
+        }
+#endif
+    }
+
+void OperationTimer::reset()
+    {
+    m_num_calls = 0;
+    m_total = 0;
+    m_num_gpu_samples = 0;
+    m_gpu_total = 0;
+#ifdef ENABLE_HIP
+    m_gpu_pending = false;
+#endif
+    }
+
+double OperationTimer::getMean() const
+    {
+    return mean(m_samples, m_num_calls);
+    }
+
+/*! \param percentile Percentile to compute (0 to 100)
+    \returns The smallest sample that is larger than or equal to \a percentile percent of the
+             samples (0 when there are no samples)
+*/
+double OperationTimer::getPercentile(double percentile) const
+    {
+    if (!(percentile >= 0 && percentile <= 100))
+        {
+        throw std::invalid_argument("Percentile must be in the range [0, 100].");
+        }
+
+    size_t n = numValid(m_num_calls);
+    if (n == 0)
+        return 0;
+
+    std::vector<double> sorted(m_samples.begin(), m_samples.begin() + n);
+    size_t rank = size_t(std::ceil(percentile / 100.0 * double(n)));
+    size_t index = rank > 0 ? rank - 1 : 0;
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    return sorted[index];
+    }
+
+double OperationTimer::getGPUMean()
+    {
+#ifdef ENABLE_HIP
+    collectGPUSample();
+#endif
+    return mean(m_gpu_samples, m_num_gpu_samples);
+    }
+
+uint64_t OperationTimer::getNumGPUSamples()
+    {
+#ifdef ENABLE_HIP
+    collectGPUSample();
+#endif
+    return m_num_gpu_samples;
+    }
+
+double OperationTimer::getGPUTotal()
+    {
+#ifdef ENABLE_HIP
+    collectGPUSample();
+#endif
+    return m_gpu_total;
+    }
+
+#ifdef ENABLE_HIP
+void OperationTimer::collectGPUSample()
+    {
+    if (!m_gpu_pending || hipEventQuery(m_gpu_stop) != hipSuccess)
+        return;
+
+    float elapsed = 0;
+    hipEventElapsedTime(&elapsed, m_gpu_start, m_gpu_stop);
+    m_gpu_samples[m_num_gpu_samples % window_size] = double(elapsed) / 1e3;
+    m_gpu_total += double(elapsed) / 1e3;
+    m_num_gpu_samples++;
+    m_gpu_pending = false;
+    }
+#endif
+
+namespace detail
+    {
+void export_OperationTimer(pybind11::module& m)
+    {
+    pybind11::class_<OperationTimer>(m, "OperationTimer")
+        .def("getNumCalls", &OperationTimer::getNumCalls)
+        .def("getMean", &OperationTimer::getMean)
+        .def("getPercentile", &OperationTimer::getPercentile)
+        .def("getGPUMean", &OperationTimer::getGPUMean)
+        .def("getTotal", &OperationTimer::getTotal)
+        .def("getGPUTotal", &OperationTimer::getGPUTotal)
+        .def("reset", &OperationTimer::reset);
+    }
+    } // end namespace detail
+
+    } // end namespace hoomd
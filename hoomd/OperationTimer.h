@@ -0,0 +1,140 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file OperationTimer.h
+    \brief Declares the OperationTimer and ScopedTimer classes
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#ifndef __OPERATION_TIMER_H__
+#define __OPERATION_TIMER_H__
+
+#include "ClockSource.h"
+#include "ExecutionConfiguration.h"
+
+#include <memory>
+#include <vector>
+
+namespace hoomd
+    {
+//! Rolling statistics of the time an operation takes per call
+/*! OperationTimer keeps the wall clock times of the most recent calls (up to window_size) and
+    reports their mean and percentiles. When GPU operation timing is enabled in the execution
+    configuration, it also brackets each call with GPU events. The GPU time of a call is collected
+    at the start of a later call (or when queried) once the GPU has completed it, so timing never
+    synchronizes the GPU. GPU samples that are not complete by then are dropped.
+
+    \ingroup utils
+*/
+class PYBIND11_EXPORT OperationTimer
+    {
+    public:
+    //! Number of calls kept in the rolling window
+    static const unsigned int window_size = 1000;
+
+    //! Construct the timer
+    OperationTimer(std::shared_ptr<const ExecutionConfiguration> exec_conf);
+
+    //! Destructor
+    ~OperationTimer();
+
+    OperationTimer(const OperationTimer&) = delete;
+    OperationTimer& operator=(const OperationTimer&) = delete;
+
+    //! Start timing a call
+    void begin();
+
+    //! Stop timing a call
+    void end();
+
+    //! Discard all samples
+    void reset();
+
+    //! Get the number of calls timed since construction or the last reset
+    uint64_t getNumCalls() const
+        {
+        return m_num_calls;
+        }
+
+    //! Get the mean wall clock time per call in the window (in seconds)
+    double getMean() const;
+
+    //! Get a percentile of the wall clock time per call in the window (in seconds)
+    double getPercentile(double percentile) const;
+
+    //! Get the mean GPU time per call in the window (in seconds)
+    double getGPUMean();
+
+    //! Get the total wall clock time of all calls since construction or the last reset
+    double getTotal() const
+        {
+        return m_total;
+        }
+
+    //! Get the number of GPU times collected since construction or the last reset
+    uint64_t getNumGPUSamples();
+
+    //! Get the total of the GPU times collected since construction or the last reset
+    double getGPUTotal();
+
+    private:
+    std::shared_ptr<const ExecutionConfiguration> m_exec_conf; //!< Execution configuration
+    ClockSource m_clock;                                       //!< Source of wall clock times
+    int64_t m_start = 0;                                       //!< Start time of the current call
+    uint64_t m_num_calls = 0;                                  //!< Number of calls timed
+    std::vector<double> m_samples;     //!< Ring buffer of wall clock times
+    double m_total = 0;                //!< Total wall clock time of all calls
+    uint64_t m_num_gpu_samples = 0;    //!< Number of GPU times collected
+    std::vector<double> m_gpu_samples; //!< Ring buffer of GPU times
+    double m_gpu_total = 0;            //!< Total of the collected GPU times
+
+#ifdef ENABLE_HIP
+    bool m_gpu_timing = false;  //!< True when the current call records GPU events
+    bool m_gpu_pending = false; //!< True when a recorded GPU sample has not been collected
+    hipEvent_t m_gpu_start;     //!< GPU event recorded at the start of a call
+    hipEvent_t m_gpu_stop;      //!< GPU event recorded at the end of a call
+
+    //! Collect the GPU time of the last call if the GPU has completed it
+    void collectGPUSample();
+#endif
+    };
+
+//! Times a call to an operation while in scope
+/*! \code
+    ScopedTimer timer(m_timer);
+    \endcode
+*/
+class ScopedTimer
+    {
+    public:
+    //! Start timing
+    ScopedTimer(OperationTimer& timer) : m_timer(timer)
+        {
+        m_timer.begin();
+        }
+
+    //! Stop timing
+    ~ScopedTimer()
+        {
+        m_timer.end();
+        }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+    OperationTimer& m_timer; //!< The timer
+    };
+
+namespace detail
+    {
+//! Exports the OperationTimer class to python
+void export_OperationTimer(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace hoomd
+
+#endif
@@ -22,6 +22,7 @@
 #include <cassert>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <stdlib.h>
@@ -47,6 +48,27 @@ std::string getDefaultTypeName(unsigned int id)
     return result;
     }
 
+#ifdef ENABLE_MPI
+//! Number of snapshot particles placed and sent at a time by ParticleData::initializeFromSnapshot
+const unsigned int snapshot_chunk_size = 65536;
+
+//! Packed particle data sent from a snapshot to the rank that owns the particle
+struct snapshot_element
+    {
+    Scalar4 pos;         //!< Position and type
+    Scalar4 vel;         //!< Velocity and mass
+    Scalar3 accel;       //!< Acceleration
+    Scalar charge;       //!< Charge
+    Scalar diameter;     //!< Diameter
+    int3 image;          //!< Image
+    unsigned int body;   //!< Body id
+    Scalar4 orientation; //!< Orientation
+    Scalar4 angmom;      //!< Angular momentum
+    Scalar3 inertia;     //!< Principal moments of inertia
+    unsigned int tag;    //!< Global tag
+    };
+#endif
+
     } // end namespace detail
 
 ////////////////////////////////////////////////////////////////////////////
@@ -81,6 +103,9 @@ ParticleData::ParticleData(unsigned int N,
     {
     m_exec_conf->msg->notice(5) << "Constructing ParticleData" << endl;
 
+    // the potential energy is computed unless it is turned off
+    m_flags[pdata_flag::potential_energy] = 1;
+
     // initialize snapshot with default values
     SnapshotParticleData<Scalar> snap(N);
 
@@ -143,6 +168,9 @@ ParticleData::ParticleData(const SnapshotParticleData<Real>& snapshot,
     {
     m_exec_conf->msg->notice(5) << "Constructing ParticleData" << endl;
 
+    // the potential energy is computed unless it is turned off
+    m_flags[pdata_flag::potential_energy] = 1;
+
 #ifdef ENABLE_MPI
     // Set up domain decomposition information
     if (decomposition)
@@ -930,12 +958,51 @@ void ParticleData::maybe_rebuild_tag_cache()
     m_invalid_cached_tags = false;
     }
 
+/*! Copy the positions and types of the local and ghost particles into the structure of arrays
+    mirror when m_pos has been written since the last copy.
+*/
+void ParticleData::updatePositionsSoA()
+    {
+    const unsigned int n = getN() + getNGhosts();
+    if (m_pos_soa_valid && m_pos_soa_version == m_pos.getVersion() && m_pos_soa_n == n)
+        return;
+
+    if (m_pos_soa.isNull() || m_pos_soa.getPitch() < n || m_type_soa.getNumElements() < n)
+        {
+        GPUArray<Scalar> pos_soa(m_max_nparticles, 3, m_exec_conf);
+        m_pos_soa.swap(pos_soa);
+        GPUArray<unsigned int> type_soa(m_max_nparticles, m_exec_conf);
+        m_type_soa.swap(type_soa);
+        }
+
+    ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_pos_soa(m_pos_soa, access_location::host, access_mode::overwrite);
+    ArrayHandle<unsigned int> h_type_soa(m_type_soa, access_location::host, access_mode::overwrite);
+
+    const size_t pitch = m_pos_soa.getPitch();
+    Scalar* x = h_pos_soa.data;
+    Scalar* y = h_pos_soa.data + pitch;
+    Scalar* z = h_pos_soa.data + 2 * pitch;
+    for (unsigned int i = 0; i < n; i++)
+        {
+        const Scalar4 postype = h_pos.data[i];
+        x[i] = postype.x;
+        y[i] = postype.y;
+        z[i] = postype.z;
+        h_type_soa.data[i] = __scalar_as_int(postype.w);
+        }
+
+    m_pos_soa_version = m_pos.getVersion();
+    m_pos_soa_n = n;
+    m_pos_soa_valid = true;
+    }
+
 /*! \return true If and only if all particles are in the simulation box
  */
 template<class Real> bool ParticleData::inBox(const SnapshotParticleData<Real>& snap)
     {
     bool in_box = true;
-    if (m_exec_conf->getRank() == 0)
+    if (m_exec_conf->getRank() == 0 || snap.is_distributed)
         {
         Scalar3 lo = m_global_box->getLo();
         Scalar3 hi = m_global_box->getHi();
@@ -961,7 +1028,16 @@ template<class Real> bool ParticleData::inBox(const SnapshotParticleData<Real>&
             }
         }
 #ifdef ENABLE_MPI
-    if (m_decomposition)
+    if (m_decomposition && snap.is_distributed)
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &in_box,
+                      1,
+                      MPI_C_BOOL,
+                      MPI_LAND,
+                      m_exec_conf->getMPICommunicator());
+        }
+    else if (m_decomposition)
         {
         bcast(in_box, 0, m_exec_conf->getMPICommunicator());
         }
@@ -977,6 +1053,10 @@ template<class Real> bool ParticleData::inBox(const SnapshotParticleData<Real>&
 
     \pre In parallel simulations, the local box size must be set before a call to
    initializeFromSnapshot().
+
+    When the snapshot is distributed (SnapshotParticleData::is_distributed), every rank places the
+   particles in its part of the snapshot into domains and the particles are exchanged between all
+   ranks. The tags follow the order of the particles in the snapshot, in rank order.
  */
 template<class Real>
 void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snapshot,
@@ -994,7 +1074,7 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
     removeAllGhostParticles();
 
     // check that all fields in the snapshot have correct length
-    if (m_exec_conf->getRank() == 0)
+    if (m_exec_conf->getRank() == 0 || snapshot.is_distributed)
         {
         snapshot.validate();
         }
@@ -1011,150 +1091,146 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
     unsigned int max_typeid = 0;
 
 #ifdef ENABLE_MPI
-    if (m_decomposition)
+    if (snapshot.is_distributed && !m_decomposition)
         {
-        // gather box information from all processors
-        unsigned int root = 0;
-
-        // Define per-processor particle data
-        std::vector<std::vector<Scalar3>> pos_proc;       // Position array of every processor
-        std::vector<std::vector<Scalar3>> vel_proc;       // Velocities array of every processor
-        std::vector<std::vector<Scalar3>> accel_proc;     // Accelerations array of every processor
-        std::vector<std::vector<unsigned int>> type_proc; // Particle types array of every processor
-        std::vector<std::vector<Scalar>> mass_proc;   // Particle masses array of every processor
-        std::vector<std::vector<Scalar>> charge_proc; // Particle charges array of every processor
-        std::vector<std::vector<Scalar>>
-            diameter_proc;                         // Particle diameters array of every processor
-        std::vector<std::vector<int3>> image_proc; // Particle images array of every processor
-        std::vector<std::vector<unsigned int>> body_proc;   // Body ids of every processor
-        std::vector<std::vector<Scalar4>> orientation_proc; // Orientations of every processor
-        std::vector<std::vector<Scalar4>> angmom_proc;      // Angular momenta of every processor
-        std::vector<std::vector<Scalar3>> inertia_proc;     // Angular momenta of every processor
-        std::vector<std::vector<unsigned int>> tag_proc;    // Global tags of every processor
-        std::vector<unsigned int> N_proc; // Number of particles on every processor
+        m_exec_conf->msg->error() << "A distributed snapshot requires a domain decomposition."
+                                  << std::endl;
+        throw std::runtime_error("Error initializing ParticleData");
+        }
 
-        // resize to number of ranks in communicator
+    if (m_decomposition)
+        {
+        const unsigned int root = 0;
         const MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
-        unsigned int size = m_exec_conf->getNRanks();
-        unsigned int my_rank = m_exec_conf->getRank();
+        const unsigned int size = m_exec_conf->getNRanks();
+        const unsigned int my_rank = m_exec_conf->getRank();
 
-        pos_proc.resize(size);
-        vel_proc.resize(size);
-        accel_proc.resize(size);
-        type_proc.resize(size);
-        mass_proc.resize(size);
-        charge_proc.resize(size);
-        diameter_proc.resize(size);
-        image_proc.resize(size);
-        body_proc.resize(size);
-        orientation_proc.resize(size);
-        angmom_proc.resize(size);
-        inertia_proc.resize(size);
-        tag_proc.resize(size);
-        N_proc.resize(size, 0);
+        // the ranks that send particles: the root rank, or all ranks for a distributed snapshot
+        const bool send = my_rank == root || snapshot.is_distributed;
+
+        ArrayHandle<unsigned int> h_cart_ranks(m_decomposition->getCartRanks(),
+                                               access_location::host,
+                                               access_mode::read);
+        const Index3D& di = m_decomposition->getDomainIndexer();
 
-        if (my_rank == 0)
+        // a distributed snapshot holds the particles that follow those on the lower ranks: offset
+        // the snapshot indices by the number of particles on the lower ranks
+        unsigned int snap_offset = 0;
+        if (snapshot.is_distributed)
             {
-            ArrayHandle<unsigned int> h_cart_ranks(m_decomposition->getCartRanks(),
-                                                   access_location::host,
-                                                   access_mode::read);
+            MPI_Exscan(&snapshot.size, &snap_offset, 1, MPI_UNSIGNED, MPI_SUM, mpi_comm);
+            if (my_rank == 0)
+                snap_offset = 0;
+            }
 
-            const Index3D& di = m_decomposition->getDomainIndexer();
-            unsigned int n_ranks = m_exec_conf->getNRanks();
+        // if requested, do not initialize constituent particles of bodies
+        auto skip_particle = [&](unsigned int snap_idx)
+        {
+            return ignore_bodies && snapshot.body[snap_idx] < MIN_FLOPPY
+                   && snapshot.body[snap_idx] != snap_offset + snap_idx;
+        };
 
-            BoxDim global_box = *m_global_box;
+        // determine the domain a particle is placed into, wrapping it into the box if needed
+        auto place_particle = [&](unsigned int snap_idx, Scalar3& pos, int3& img)
+        {
+            pos = vec_to_scalar3(snapshot.pos[snap_idx]);
+            img = snapshot.image[snap_idx];
+            Scalar3 f = m_global_box->makeFraction(pos);
+            int i = int(f.x * ((Scalar)di.getW()));
+            int j = int(f.y * ((Scalar)di.getH()));
+            int k = int(f.z * ((Scalar)di.getD()));
+
+            // wrap particles that are exactly on a boundary
+            // we only need to wrap in the negative direction, since
+            // processor ids are rounded toward zero
+            char3 flags = make_char3(0, 0, 0);
+            if (i == (int)di.getW())
+                {
+                i = 0;
+                flags.x = 1;
+                }
 
-            // loop over particles in snapshot, place them into domains
-            for (typename std::vector<vec3<Real>>::const_iterator it = snapshot.pos.begin();
-                 it != snapshot.pos.end();
-                 it++)
+            if (j == (int)di.getH())
                 {
-                unsigned int snap_idx = (unsigned int)(it - snapshot.pos.begin());
+                j = 0;
+                flags.y = 1;
+                }
 
-                // if requested, do not initialize constituent particles of bodies
-                if (ignore_bodies && snapshot.body[snap_idx] < MIN_FLOPPY
-                    && snapshot.body[snap_idx] != snap_idx)
-                    {
-                    continue;
-                    }
+            if (k == (int)di.getD())
+                {
+                k = 0;
+                flags.z = 1;
+                }
 
-                // determine domain the particle is placed into
-                Scalar3 pos = vec_to_scalar3(*it);
-                Scalar3 f = m_global_box->makeFraction(pos);
-                int i = int(f.x * ((Scalar)di.getW()));
-                int j = int(f.y * ((Scalar)di.getH()));
-                int k = int(f.z * ((Scalar)di.getD()));
-
-                // wrap particles that are exactly on a boundary
-                // we only need to wrap in the negative direction, since
-                // processor ids are rounded toward zero
-                char3 flags = make_char3(0, 0, 0);
-                if (i == (int)di.getW())
-                    {
-                    i = 0;
-                    flags.x = 1;
-                    }
+            // only wrap if the particles is on one of the boundaries
+            BoxDim global_box = *m_global_box;
+            uchar3 periodic = make_uchar3(flags.x, flags.y, flags.z);
+            global_box.setPeriodic(periodic);
+            global_box.wrap(pos, img, flags);
 
-                if (j == (int)di.getH())
-                    {
-                    j = 0;
-                    flags.y = 1;
-                    }
+            // place particle using actual domain fractions, not global box fraction
+            unsigned int rank = m_decomposition->placeParticle(global_box, pos, h_cart_ranks.data);
 
-                if (k == (int)di.getD())
-                    {
-                    k = 0;
-                    flags.z = 1;
-                    }
+            if (rank >= size)
+                {
+                ostringstream s;
+                s << "init.*: Particle " << snap_offset + snap_idx << " out of bounds."
+                  << std::endl;
+                s << "Cartesian coordinates: " << std::endl;
+                s << "x: " << pos.x << " y: " << pos.y << " z: " << pos.z << std::endl;
+                s << "Fractional coordinates: " << std::endl;
+                s << "f.x: " << f.x << " f.y: " << f.y << " f.z: " << f.z << std::endl;
+                Scalar3 lo = m_global_box->getLo();
+                Scalar3 hi = m_global_box->getHi();
+                s << "Global box lo: (" << lo.x << ", " << lo.y << ", " << lo.z << ")"
+                  << std::endl;
+                s << "           hi: (" << hi.x << ", " << hi.y << ", " << hi.z << ")"
+                  << std::endl;
+
+                throw std::runtime_error(s.str());
+                }
+            return rank;
+        };
 
-                int3 img = snapshot.image[snap_idx];
+        // count the particles sent to every rank, so that each rank allocates its arrays once
+        std::vector<int> N_send(size, 0);
+        unsigned int n_keep = 0;
+        if (send)
+            {
+            for (unsigned int snap_idx = 0; snap_idx < snapshot.size; snap_idx++)
+                {
+                if (skip_particle(snap_idx))
+                    continue;
 
-                // only wrap if the particles is on one of the boundaries
-                uchar3 periodic = make_uchar3(flags.x, flags.y, flags.z);
-                global_box.setPeriodic(periodic);
-                global_box.wrap(pos, img, flags);
+                Scalar3 pos;
+                int3 img;
+                N_send[place_particle(snap_idx, pos, img)]++;
+                n_keep++;
 
-                // place particle using actual domain fractions, not global box fraction
-                unsigned int rank
-                    = m_decomposition->placeParticle(global_box, pos, h_cart_ranks.data);
+                // determine max typeid
+                max_typeid = std::max(max_typeid, snapshot.type[snap_idx]);
+                }
+            }
 
-                if (rank >= n_ranks)
-                    {
-                    ostringstream s;
-                    s << "init.*: Particle " << snap_idx << " out of bounds." << std::endl;
-                    s << "Cartesian coordinates: " << std::endl;
-                    s << "x: " << pos.x << " y: " << pos.y << " z: " << pos.z << std::endl;
-                    s << "Fractional coordinates: " << std::endl;
-                    s << "f.x: " << f.x << " f.y: " << f.y << " f.z: " << f.z << std::endl;
-                    Scalar3 lo = m_global_box->getLo();
-                    Scalar3 hi = m_global_box->getHi();
-                    s << "Global box lo: (" << lo.x << ", " << lo.y << ", " << lo.z << ")"
-                      << std::endl;
-                    s << "           hi: (" << hi.x << ", " << hi.y << ", " << hi.z << ")"
-                      << std::endl;
+        // the tags follow the order of the particles in the snapshot
+        unsigned int tag_offset = 0;
+        if (snapshot.is_distributed)
+            {
+            MPI_Exscan(&n_keep, &tag_offset, 1, MPI_UNSIGNED, MPI_SUM, mpi_comm);
+            if (my_rank == 0)
+                tag_offset = 0;
 
-                    throw std::runtime_error(s.str());
-                    }
+            MPI_Allreduce(&n_keep, &nglobal, 1, MPI_UNSIGNED, MPI_SUM, mpi_comm);
 
-                // fill up per-processor data structures
-                pos_proc[rank].push_back(pos);
-                image_proc[rank].push_back(img);
-                vel_proc[rank].push_back(vec_to_scalar3(snapshot.vel[snap_idx]));
-                accel_proc[rank].push_back(vec_to_scalar3(snapshot.accel[snap_idx]));
-                type_proc[rank].push_back(snapshot.type[snap_idx]);
-                mass_proc[rank].push_back(snapshot.mass[snap_idx]);
-                charge_proc[rank].push_back(snapshot.charge[snap_idx]);
-                diameter_proc[rank].push_back(snapshot.diameter[snap_idx]);
-                body_proc[rank].push_back(snapshot.body[snap_idx]);
-                orientation_proc[rank].push_back(quat_to_scalar4(snapshot.orientation[snap_idx]));
-                angmom_proc[rank].push_back(quat_to_scalar4(snapshot.angmom[snap_idx]));
-                inertia_proc[rank].push_back(vec_to_scalar3(snapshot.inertia[snap_idx]));
-                tag_proc[rank].push_back(nglobal++);
-                N_proc[rank]++;
-
-                // determine max typeid on root rank
-                max_typeid = std::max(max_typeid, snapshot.type[snap_idx]);
-                }
+            std::vector<int> N_recv(size);
+            MPI_Alltoall(N_send.data(), 1, MPI_INT, N_recv.data(), 1, MPI_INT, mpi_comm);
+            m_nparticles = std::accumulate(N_recv.begin(), N_recv.end(), 0u);
+            }
+        else
+            {
+            nglobal = n_keep;
+            bcast(nglobal, root, mpi_comm);
+            MPI_Scatter(N_send.data(), 1, MPI_INT, &m_nparticles, 1, MPI_INT, root, mpi_comm);
             }
 
         // get type mapping
@@ -1168,45 +1244,9 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         // broadcast type mapping
         bcast(m_type_mapping, root, mpi_comm);
 
-        // broadcast global number of particles
-        bcast(nglobal, root, mpi_comm);
-
         // resize array for reverse-lookup tags
         m_rtag.resize(nglobal);
 
-        // Local particle data
-        std::vector<Scalar3> pos;
-        std::vector<Scalar3> vel;
-        std::vector<Scalar3> accel;
-        std::vector<unsigned int> type;
-        std::vector<Scalar> mass;
-        std::vector<Scalar> charge;
-        std::vector<Scalar> diameter;
-        std::vector<int3> image;
-        std::vector<unsigned int> body;
-        std::vector<Scalar4> orientation;
-        std::vector<Scalar4> angmom;
-        std::vector<Scalar3> inertia;
-        std::vector<unsigned int> tag;
-
-        // distribute particle data
-        scatter_v(pos_proc, pos, root, mpi_comm);
-        scatter_v(vel_proc, vel, root, mpi_comm);
-        scatter_v(accel_proc, accel, root, mpi_comm);
-        scatter_v(type_proc, type, root, mpi_comm);
-        scatter_v(mass_proc, mass, root, mpi_comm);
-        scatter_v(charge_proc, charge, root, mpi_comm);
-        scatter_v(diameter_proc, diameter, root, mpi_comm);
-        scatter_v(image_proc, image, root, mpi_comm);
-        scatter_v(body_proc, body, root, mpi_comm);
-        scatter_v(orientation_proc, orientation, root, mpi_comm);
-        scatter_v(angmom_proc, angmom, root, mpi_comm);
-        scatter_v(inertia_proc, inertia, root, mpi_comm);
-        scatter_v(tag_proc, tag, root, mpi_comm);
-
-        // distribute number of particles
-        scatter_v(N_proc, m_nparticles, root, mpi_comm);
-
             {
             // reset all reverse lookup tags to NOT_LOCAL flag
             ArrayHandle<unsigned int> h_rtag(getRTags(),
@@ -1250,24 +1290,105 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
                                               access_mode::overwrite);
         ArrayHandle<unsigned int> h_rtag(m_rtag, access_location::host, access_mode::readwrite);
 
-        for (unsigned int idx = 0; idx < m_nparticles; idx++)
+        // send the particles in chunks of the snapshot so the buffers have a bounded size
+        const unsigned int chunk_size = detail::snapshot_chunk_size;
+        unsigned int n_chunks = (snapshot.size + chunk_size - 1) / chunk_size;
+        if (snapshot.is_distributed)
             {
-            h_pos.data[idx]
-                = make_scalar4(pos[idx].x, pos[idx].y, pos[idx].z, __int_as_scalar(type[idx]));
-            h_vel.data[idx] = make_scalar4(vel[idx].x, vel[idx].y, vel[idx].z, mass[idx]);
-            h_accel.data[idx] = accel[idx];
-            h_charge.data[idx] = charge[idx];
-            h_diameter.data[idx] = diameter[idx];
-            h_image.data[idx] = image[idx];
-            h_tag.data[idx] = tag[idx];
-            h_rtag.data[tag[idx]] = idx;
-            h_body.data[idx] = body[idx];
-            h_orientation.data[idx] = orientation[idx];
-            h_angmom.data[idx] = angmom[idx];
-            h_inertia.data[idx] = inertia[idx];
-
-            h_comm_flag.data[idx] = 0; // initialize with zero
+            MPI_Allreduce(MPI_IN_PLACE, &n_chunks, 1, MPI_UNSIGNED, MPI_MAX, mpi_comm);
             }
+        else
+            {
+            bcast(n_chunks, root, mpi_comm);
+            }
+
+        std::vector<unsigned int> dest;
+        std::vector<detail::snapshot_element> placed;
+        std::vector<detail::snapshot_element> send_buf;
+        std::vector<detail::snapshot_element> recv_buf;
+        std::vector<int> send_counts(size);
+        std::vector<int> send_offsets(size);
+        unsigned int next_tag = tag_offset;
+        unsigned int idx = 0;
+
+        for (unsigned int chunk = 0; chunk < n_chunks; chunk++)
+            {
+            std::fill(send_counts.begin(), send_counts.end(), 0);
+            dest.clear();
+            placed.clear();
+
+            // place the particles in this chunk of the snapshot into domains
+            const unsigned int begin = send ? std::min(chunk * chunk_size, snapshot.size) : 0;
+            const unsigned int end = send ? std::min(begin + chunk_size, snapshot.size) : 0;
+            for (unsigned int snap_idx = begin; snap_idx < end; snap_idx++)
+                {
+                if (skip_particle(snap_idx))
+                    continue;
+
+                detail::snapshot_element p;
+                Scalar3 pos;
+                unsigned int rank = place_particle(snap_idx, pos, p.image);
+                p.pos = make_scalar4(pos.x, pos.y, pos.z, __int_as_scalar(snapshot.type[snap_idx]));
+                p.vel = make_scalar4(snapshot.vel[snap_idx].x,
+                                     snapshot.vel[snap_idx].y,
+                                     snapshot.vel[snap_idx].z,
+                                     snapshot.mass[snap_idx]);
+                p.accel = vec_to_scalar3(snapshot.accel[snap_idx]);
+                p.charge = snapshot.charge[snap_idx];
+                p.diameter = snapshot.diameter[snap_idx];
+                p.body = snapshot.body[snap_idx];
+                p.orientation = quat_to_scalar4(snapshot.orientation[snap_idx]);
+                p.angmom = quat_to_scalar4(snapshot.angmom[snap_idx]);
+                p.inertia = vec_to_scalar3(snapshot.inertia[snap_idx]);
+                p.tag = next_tag++;
+
+                dest.push_back(rank);
+                placed.push_back(p);
+                send_counts[rank]++;
+                }
+
+            // order the particles by destination rank
+            send_offsets[0] = 0;
+            for (unsigned int rank = 1; rank < size; rank++)
+                {
+                send_offsets[rank] = send_offsets[rank - 1] + send_counts[rank - 1];
+                }
+            send_buf.resize(placed.size());
+            for (unsigned int i = 0; i < placed.size(); i++)
+                {
+                send_buf[send_offsets[dest[i]]++] = placed[i];
+                }
+
+            if (snapshot.is_distributed)
+                {
+                all_to_all_v(send_buf, send_counts, recv_buf, mpi_comm);
+                }
+            else
+                {
+                scatter_v(send_buf, send_counts, recv_buf, root, mpi_comm);
+                }
+
+            // store the received particles in the particle data arrays
+            for (const detail::snapshot_element& p : recv_buf)
+                {
+                h_pos.data[idx] = p.pos;
+                h_vel.data[idx] = p.vel;
+                h_accel.data[idx] = p.accel;
+                h_charge.data[idx] = p.charge;
+                h_diameter.data[idx] = p.diameter;
+                h_image.data[idx] = p.image;
+                h_tag.data[idx] = p.tag;
+                h_rtag.data[p.tag] = idx;
+                h_body.data[idx] = p.body;
+                h_orientation.data[idx] = p.orientation;
+                h_angmom.data[idx] = p.angmom;
+                h_inertia.data[idx] = p.inertia;
+
+                h_comm_flag.data[idx] = 0; // initialize with zero
+                idx++;
+                }
+            }
+        assert(idx == m_nparticles);
         }
     else
 #endif
@@ -1362,7 +1483,13 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
 // As a convenience, broadcast the values needed to evaluate the condition the same on all
 // ranks.
 #ifdef ENABLE_MPI
-    if (m_decomposition)
+    if (m_decomposition && snapshot.is_distributed)
+        {
+        MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+        MPI_Allreduce(MPI_IN_PLACE, &max_typeid, 1, MPI_UNSIGNED, MPI_MAX, mpi_comm);
+        MPI_Allreduce(MPI_IN_PLACE, &snapshot_size, 1, MPI_UNSIGNED, MPI_SUM, mpi_comm);
+        }
+    else if (m_decomposition)
         {
         bcast(max_typeid, 0, m_exec_conf->getMPICommunicator());
         bcast(snapshot_size, 0, m_exec_conf->getMPICommunicator());
@@ -2529,6 +2656,9 @@ unsigned int ParticleData::addParticle(unsigned int type)
         h_comm_flag.data[idx] = 0;
         }
 
+    // notify listeners of the new tag before the global particle number changes
+    m_particle_added_signal.emit(tag);
+
     // update global number of particles
     setNGlobal(getNGlobal() + 1);
 
@@ -2586,6 +2716,9 @@ void ParticleData::removeParticle(unsigned int tag)
         throw runtime_error(s.str());
         }
 
+    // notify listeners while the particle is still present
+    m_particle_removed_signal.emit(tag);
+
     // delete from map
     m_rtag[tag] = NOT_LOCAL;
 
@@ -2810,6 +2943,7 @@ void export_ParticleData(pybind11::module& m)
         .def("setAngularMomentum", &ParticleData::setAngularMomentum)
         .def("setMomentsOfInertia", &ParticleData::setMomentsOfInertia)
         .def("setPressureFlag", &ParticleData::setPressureFlag)
+        .def("setEnergyFlag", &ParticleData::setEnergyFlag)
         .def("getMaximumTag", &ParticleData::getMaximumTag)
         .def("addParticle", &ParticleData::addParticle)
         .def("removeParticle", &ParticleData::removeParticle)
@@ -2825,7 +2959,8 @@ void export_ParticleData(pybind11::module& m)
 
 //! Constructor for SnapshotParticleData
 template<class Real>
-SnapshotParticleData<Real>::SnapshotParticleData(unsigned int N) : size(N), is_accel_set(false)
+SnapshotParticleData<Real>::SnapshotParticleData(unsigned int N)
+    : size(N), is_accel_set(false), is_distributed(false)
     {
     resize(N);
     }
@@ -3745,34 +3880,43 @@ void SnapshotParticleData<Real>::replicate(unsigned int nx,
                                            const BoxDim& old_box,
                                            const BoxDim& new_box)
     {
-    unsigned int old_size = size;
-
-    // resize snapshot
-    resize(old_size * nx * ny * nz);
-
+    const unsigned int old_size = size;
+    const uint64_t new_size = uint64_t(old_size) * nx * ny * nz;
+    if (new_size > std::numeric_limits<unsigned int>::max())
+        throw std::runtime_error("Replication would create more particles than HOOMD supports!");
+
+    // unwrap the positions of the original particles in the old box using image flags before
+    // the first replica overwrites them
+    std::vector<vec3<Real>> f(old_size);
     for (unsigned int i = 0; i < old_size; ++i)
         {
-        // unwrap position of particle i in old box using image flags
-        vec3<Real> p = pos[i];
-        int3 img = image[i];
-
         // need to cast to a scalar and back because the Box is in Scalars, but we might be in a
         // different type
-        p = vec3<Real>(old_box.shift(vec3<Scalar>(p), img));
-        vec3<Real> f = old_box.makeFraction(p);
+        vec3<Real> p = vec3<Real>(old_box.shift(vec3<Scalar>(pos[i]), image[i]));
+        f[i] = old_box.makeFraction(p);
+        }
+
+    // resize snapshot
+    resize((unsigned int)new_size);
+
+    // fill one replica at a time so that the properties that are copied unchanged are copied as
+    // contiguous blocks
+    for (unsigned int l = 0; l < nx; l++)
+        for (unsigned int m = 0; m < ny; m++)
+            for (unsigned int n = 0; n < nz; n++)
+                {
+                const unsigned int j = (l * ny + m) * nz + n;
+                const unsigned int offset = j * old_size;
 
-        unsigned int j = 0;
-        for (unsigned int l = 0; l < nx; l++)
-            for (unsigned int m = 0; m < ny; m++)
-                for (unsigned int n = 0; n < nz; n++)
+                for (unsigned int i = 0; i < old_size; ++i)
                     {
-                    Scalar3 f_new;
                     // replicate particle
-                    f_new.x = f.x / (Real)nx + (Real)l / (Real)nx;
-                    f_new.y = f.y / (Real)ny + (Real)m / (Real)ny;
-                    f_new.z = f.z / (Real)nz + (Real)n / (Real)nz;
+                    Scalar3 f_new;
+                    f_new.x = f[i].x / (Real)nx + (Real)l / (Real)nx;
+                    f_new.y = f[i].y / (Real)ny + (Real)m / (Real)ny;
+                    f_new.z = f[i].z / (Real)nz + (Real)n / (Real)nz;
 
-                    unsigned int k = j * old_size + i;
+                    const unsigned int k = offset + i;
 
                     // coordinates in new box
                     Scalar3 q = new_box.makeCoordinates(f_new);
@@ -3784,29 +3928,34 @@ void SnapshotParticleData<Real>::replicate(unsigned int nx,
 
                     // rewrap using wrap so that rounding is consistent
                     new_box.wrap(q, image[k]);
-
                     pos[k] = vec3<Real>(q);
-                    vel[k] = vel[i];
-                    accel[k] = accel[i];
-                    type[k] = type[i];
-                    mass[k] = mass[i];
-                    charge[k] = charge[i];
-                    diameter[k] = diameter[i];
+
                     // This math also accounts for floppy bodies since body[i]
                     // is already greater than MIN_FLOPPY, so the new body id
                     // body[k] is guaranteed to be so as well. However, we
                     // check to ensure that something that wasn't originally a
                     // floppy body doesn't overflow into the floppy body tags.
-                    body[k] = (body[i] != NO_BODY ? j * old_size + body[i] : NO_BODY);
+                    body[k] = (body[i] != NO_BODY ? offset + body[i] : NO_BODY);
                     if (body[i] < MIN_FLOPPY && body[k] >= MIN_FLOPPY)
                         throw std::runtime_error("Replication would create more distinct rigid "
                                                  "bodies than HOOMD supports!");
-                    orientation[k] = orientation[i];
-                    angmom[k] = angmom[i];
-                    inertia[k] = inertia[i];
-                    j++;
                     }
-        }
+
+                if (j == 0)
+                    continue;
+
+                auto copy_block = [old_size, offset](auto& v)
+                { std::copy(v.begin(), v.begin() + old_size, v.begin() + offset); };
+                copy_block(vel);
+                copy_block(accel);
+                copy_block(type);
+                copy_block(mass);
+                copy_block(charge);
+                copy_block(diameter);
+                copy_block(orientation);
+                copy_block(angmom);
+                copy_block(inertia);
+                }
     }
 
 template<class Real>
@@ -4028,18 +4177,18 @@ template<class Real> void SnapshotParticleData<Real>::setTypes(pybind11::list ty
 template<class Real> void SnapshotParticleData<Real>::bcast(unsigned int root, MPI_Comm mpi_comm)
     {
     // broadcast all member quantities
-    hoomd::bcast(pos, root, mpi_comm);
-    hoomd::bcast(vel, root, mpi_comm);
-    hoomd::bcast(accel, root, mpi_comm);
-    hoomd::bcast(type, root, mpi_comm);
-    hoomd::bcast(mass, root, mpi_comm);
-    hoomd::bcast(charge, root, mpi_comm);
-    hoomd::bcast(diameter, root, mpi_comm);
-    hoomd::bcast(image, root, mpi_comm);
-    hoomd::bcast(body, root, mpi_comm);
-    hoomd::bcast(orientation, root, mpi_comm);
-    hoomd::bcast(angmom, root, mpi_comm);
-    hoomd::bcast(inertia, root, mpi_comm);
+    hoomd::bcast_raw(pos, root, mpi_comm);
+    hoomd::bcast_raw(vel, root, mpi_comm);
+    hoomd::bcast_raw(accel, root, mpi_comm);
+    hoomd::bcast_raw(type, root, mpi_comm);
+    hoomd::bcast_raw(mass, root, mpi_comm);
+    hoomd::bcast_raw(charge, root, mpi_comm);
+    hoomd::bcast_raw(diameter, root, mpi_comm);
+    hoomd::bcast_raw(image, root, mpi_comm);
+    hoomd::bcast_raw(body, root, mpi_comm);
+    hoomd::bcast_raw(orientation, root, mpi_comm);
+    hoomd::bcast_raw(angmom, root, mpi_comm);
+    hoomd::bcast_raw(inertia, root, mpi_comm);
 
     hoomd::bcast(size, root, mpi_comm);
     hoomd::bcast(type_mapping, root, mpi_comm);
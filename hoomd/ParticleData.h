@@ -74,8 +74,9 @@ struct pdata_flag
         {
         pressure_tensor = 0,       //!< Bit id in PDataFlags for the full virial
         rotational_kinetic_energy, //!< Bit id in PDataFlags for the rotational kinetic energy
-        external_field_virial      //!< Bit id in PDataFlags for the external virial contribution of
+        external_field_virial,     //!< Bit id in PDataFlags for the external virial contribution of
                                    //!< volume change
+        potential_energy           //!< Bit id in PDataFlags for the potential energy
         };
     };
 
@@ -133,7 +134,7 @@ std::string getDefaultTypeName(unsigned int id);
 template<class Real> struct PYBIND11_EXPORT SnapshotParticleData
     {
     //! Empty snapshot
-    SnapshotParticleData() : size(0), is_accel_set(false) { }
+    SnapshotParticleData() : size(0), is_accel_set(false), is_distributed(false) { }
 
     //! constructor
     /*! \param N number of particles to allocate memory for
@@ -239,6 +240,12 @@ template<class Real> struct PYBIND11_EXPORT SnapshotParticleData
     std::vector<std::string> type_mapping; //!< Mapping between particle type ids and names
 
     bool is_accel_set; //!< Flag indicating if accel is set
+
+    //! Flag indicating that the particles are split over the ranks
+    /*! When set, each rank holds a contiguous range of the particles in tag order with the ranges
+        in rank order (see GSDReader). Otherwise, only the snapshot on the root rank is used.
+    */
+    bool is_distributed;
     };
 
 namespace detail
@@ -314,6 +321,8 @@ struct pdata_element
     These fields are:
      - pdata_flag::pressure_tensor - specify that the full virial tensor is valid
      - pdata_flag::external_field_virial - specify that an external virial contribution is valid
+     - pdata_flag::potential_energy - specify that the per particle potential energy is valid (set
+       by default)
 
     If these flags are not set, these arrays can still be read but their values may be incorrect.
 
@@ -645,6 +654,30 @@ class PYBIND11_EXPORT ParticleData
         return m_body;
         }
 
+    //! Return positions as a structure of arrays
+    /*! The returned 2D array holds the x, y, and z coordinates of the local and ghost particles in
+        rows 0, 1, and 2. Use getPitch() on the array to index the rows. CPU loops that only read
+        coordinates can access them with unit stride, which lets the compiler vectorize them.
+
+        The arrays are allocated on first use and mirror getPositions() on the host. They are
+        refreshed lazily whenever the positions have been modified since the last call, so the
+        reference is only valid until the positions are next written.
+    */
+    const GPUArray<Scalar>& getPositionsSoA()
+        {
+        updatePositionsSoA();
+        return m_pos_soa;
+        }
+
+    //! Return types as a contiguous array
+    /*! \sa getPositionsSoA()
+     */
+    const GPUArray<unsigned int>& getTypesSoA()
+        {
+        updatePositionsSoA();
+        return m_type_soa;
+        }
+
     /*!
      * Access methods to stand-by arrays for fast swapping in of reordered particle data
      *
@@ -855,6 +888,24 @@ class PYBIND11_EXPORT ParticleData
         return m_global_particle_num_signal;
         }
 
+    //! Connects a function to be called every time addParticle() adds a particle
+    /*! The slot receives the tag of the new particle. The signal fires before the global particle
+        number change signal that follows the addition.
+    */
+    Nano::Signal<void(unsigned int)>& getParticleAddedSignal()
+        {
+        return m_particle_added_signal;
+        }
+
+    //! Connects a function to be called every time removeParticle() removes a particle
+    /*! The slot receives the tag of the particle while it is still present in the particle data.
+        The signal fires before the global particle number change signal that follows the removal.
+    */
+    Nano::Signal<void(unsigned int)>& getParticleRemovedSignal()
+        {
+        return m_particle_removed_signal;
+        }
+
     //! Connects a function to be called every time the local maximum particle number changes
     Nano::Signal<void()>& getMaxParticleNumberChangeSignal()
         {
@@ -1093,6 +1144,12 @@ class PYBIND11_EXPORT ParticleData
         m_flags[pdata_flag::pressure_tensor] = 1;
         }
 
+    /// Enable energy computations
+    void setEnergyFlag()
+        {
+        m_flags[pdata_flag::potential_energy] = 1;
+        }
+
     //! Set the external contribution to the virial
     void setExternalVirial(unsigned int i, Scalar v)
         {
@@ -1269,6 +1326,10 @@ class PYBIND11_EXPORT ParticleData
                                                            //!< particles are removed
     Nano::Signal<void()> m_global_particle_num_signal; //!< Signal that is triggered when the global
                                                        //!< number of particles changes
+    Nano::Signal<void(unsigned int)>
+        m_particle_added_signal; //!< Signal that is triggered when a single particle is added
+    Nano::Signal<void(unsigned int)>
+        m_particle_removed_signal; //!< Signal that is triggered when a single particle is removed
 
 #ifdef ENABLE_MPI
     Nano::Signal<void(unsigned int, unsigned int, unsigned int)>
@@ -1297,6 +1358,12 @@ class PYBIND11_EXPORT ParticleData
     GlobalArray<Scalar3> m_inertia;         //!< Principal moments of inertia for each particle
     GlobalArray<unsigned int> m_comm_flags; //!< Array of communication flags
 
+    GPUArray<Scalar> m_pos_soa;        //!< x, y, z rows mirroring m_pos (allocated on demand)
+    GPUArray<unsigned int> m_type_soa; //!< types mirroring m_pos (allocated on demand)
+    uint64_t m_pos_soa_version = 0;    //!< Version of m_pos when the mirror was filled
+    unsigned int m_pos_soa_n = 0;      //!< Number of particles in the mirror
+    bool m_pos_soa_valid = false;      //!< True when the mirror has been filled
+
     std::stack<unsigned int> m_recycled_tags; //!< Global tags of removed particles
     std::set<unsigned int> m_tag_set;         //!< Lookup table for tags by active index
     std::vector<unsigned int>
@@ -1364,6 +1431,9 @@ class PYBIND11_EXPORT ParticleData
     //! Helper function to rebuild the active tag cache if necessary
     void maybe_rebuild_tag_cache();
 
+    //! Helper function to refresh the structure of arrays positions if necessary
+    void updatePositionsSoA();
+
     //! Helper function to check that particles of a snapshot are in the box
     /*! \return true If and only if all particles are in the simulation box
      * \param Snapshot to check
@@ -44,16 +44,8 @@ ParticleGroup::ParticleGroup(std::shared_ptr<SystemDefinition> sysdef,
     // update member tag arrays
     updateMemberTags(true);
 
-    // connect to the particle sort signal
-    m_pdata->getParticleSortSignal().connect<ParticleGroup, &ParticleGroup::slotParticleSort>(this);
-
-    // connect reallocate() method to maximum particle number change signal
-    m_pdata->getMaxParticleNumberChangeSignal()
-        .connect<ParticleGroup, &ParticleGroup::slotReallocate>(this);
-
-    // connect updateMemberTags() method to maximum particle number change signal
-    m_pdata->getGlobalParticleNumberChangeSignal()
-        .connect<ParticleGroup, &ParticleGroup::slotGlobalParticleNumChange>(this);
+    // connect to the particle data signals
+    connectSignals();
 
     // update GPU memory hints
     updateGPUAdvice();
@@ -142,16 +134,8 @@ ParticleGroup::ParticleGroup(std::shared_ptr<SystemDefinition> sysdef,
     // list
     rebuildIndexList();
 
-    // connect to the particle sort signal
-    m_pdata->getParticleSortSignal().connect<ParticleGroup, &ParticleGroup::slotParticleSort>(this);
-
-    // connect reallocate() method to maximum particle number change signal
-    m_pdata->getMaxParticleNumberChangeSignal()
-        .connect<ParticleGroup, &ParticleGroup::slotReallocate>(this);
-
-    // connect updateMemberTags() method to maximum particle number change signal
-    m_pdata->getGlobalParticleNumberChangeSignal()
-        .connect<ParticleGroup, &ParticleGroup::slotGlobalParticleNumChange>(this);
+    // connect to the particle data signals
+    connectSignals();
 
     // update GPU memory hints
     updateGPUAdvice();
@@ -169,13 +153,43 @@ ParticleGroup::~ParticleGroup()
             .disconnect<ParticleGroup, &ParticleGroup::slotReallocate>(this);
         m_pdata->getGlobalParticleNumberChangeSignal()
             .disconnect<ParticleGroup, &ParticleGroup::slotGlobalParticleNumChange>(this);
+        m_pdata->getParticleAddedSignal()
+            .disconnect<ParticleGroup, &ParticleGroup::slotParticleAdded>(this);
+        m_pdata->getParticleRemovedSignal()
+            .disconnect<ParticleGroup, &ParticleGroup::slotParticleRemoved>(this);
         }
     }
 
+void ParticleGroup::connectSignals()
+    {
+    // connect to the particle sort signal
+    m_pdata->getParticleSortSignal().connect<ParticleGroup, &ParticleGroup::slotParticleSort>(this);
+
+    // connect reallocate() method to maximum particle number change signal
+    m_pdata->getMaxParticleNumberChangeSignal()
+        .connect<ParticleGroup, &ParticleGroup::slotReallocate>(this);
+
+    // connect updateMemberTags() method to global particle number change signal
+    m_pdata->getGlobalParticleNumberChangeSignal()
+        .connect<ParticleGroup, &ParticleGroup::slotGlobalParticleNumChange>(this);
+
+    // track single particle additions and removals to update the members incrementally
+    m_pdata->getParticleAddedSignal().connect<ParticleGroup, &ParticleGroup::slotParticleAdded>(
+        this);
+    m_pdata->getParticleRemovedSignal()
+        .connect<ParticleGroup, &ParticleGroup::slotParticleRemoved>(this);
+    }
+
 /*! \param force_update If true, always update member tags
  */
 void ParticleGroup::updateMemberTags(bool force_update)
     {
+    // a full update supersedes any pending single particle changes
+    m_membership_changed = false;
+    m_added_tags.clear();
+    m_removed_tags.clear();
+    m_removed_central_and_free = 0;
+
     if (m_selector && !(m_update_tags || force_update) && !m_warning_printed)
         {
         m_pdata->getExecConf()->msg->warning()
@@ -305,6 +319,167 @@ void ParticleGroup::reallocate()
         }
     }
 
+/*! \param tag Tag of the particle that is about to be removed
+ */
+void ParticleGroup::slotParticleRemoved(unsigned int tag)
+    {
+    m_removed_tags.push_back(tag);
+    m_tag_change_pending = true;
+
+    // the particle is still present, count it if it is a local central or free member
+    if (tag >= m_is_member_tag.getNumElements())
+        return;
+
+    unsigned int idx = m_pdata->getRTag(tag);
+    if (idx >= m_pdata->getN())
+        return;
+
+    ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                     access_location::host,
+                                     access_mode::read);
+    ArrayHandle<unsigned int> h_is_member_tag(m_is_member_tag,
+                                              access_location::host,
+                                              access_mode::read);
+    unsigned int body = h_body.data[idx];
+    if (h_is_member_tag.data[tag] && (body == tag || body > MIN_FLOPPY))
+        {
+        m_removed_central_and_free++;
+        }
+    }
+
+/*! Apply the additions and removals recorded since the last update to the member tags. Only the
+    added particles are passed through the filter, so the cost scales with the number of changes
+    instead of with the number of particles. The index list is rebuilt afterwards, when the sort
+    signal that follows every addition and removal is handled.
+*/
+void ParticleGroup::updateMembership()
+    {
+    m_pdata->getExecConf()->msg->notice(7) << "ParticleGroup: updating tags" << std::endl;
+
+    // grow the tag hash to cover new tags
+    size_t n_old_tags = m_is_member_tag.getNumElements();
+    size_t n_tags = m_pdata->getRTags().size();
+    if (n_tags > n_old_tags)
+        {
+        m_is_member_tag.resize(n_tags);
+
+        ArrayHandle<unsigned int> h_is_member_tag(m_is_member_tag,
+                                                  access_location::host,
+                                                  access_mode::readwrite);
+        memset(h_is_member_tag.data + n_old_tags, 0, sizeof(unsigned int) * (n_tags - n_old_tags));
+        }
+
+    // only tags that still exist are candidates, a tag may have been removed after it was added
+    std::vector<unsigned int> candidates;
+    for (auto tag : m_added_tags)
+        {
+        if (m_pdata->isTagActive(tag))
+            candidates.push_back(tag);
+        }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    std::vector<unsigned int> added = m_selector->getSelectedTagsFrom(m_sysdef, candidates);
+
+    // count the local central and free particles among the new members
+    int delta_central_and_free = -m_removed_central_and_free;
+        {
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::read);
+        ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                         access_location::host,
+                                         access_mode::read);
+        for (auto tag : added)
+            {
+            unsigned int idx = h_rtag.data[tag];
+            if (idx >= m_pdata->getN())
+                continue;
+            unsigned int body = h_body.data[idx];
+            if (body == tag || body > MIN_FLOPPY)
+                delta_central_and_free++;
+            }
+        }
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        // combine lists from all processors
+        std::vector<std::vector<unsigned int>> added_proc(m_exec_conf->getNRanks());
+        all_gather_v(added, added_proc, m_exec_conf->getMPICommunicator());
+
+        std::set<unsigned int> tag_set;
+        for (auto& tags : added_proc)
+            {
+            tag_set.insert(tags.begin(), tags.end());
+            }
+        added.assign(tag_set.begin(), tag_set.end());
+
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &delta_central_and_free,
+                      1,
+                      MPI_INT,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+    m_n_central_and_free_global += delta_central_and_free;
+
+    // update the tag hash and the sorted list of member tags
+    std::vector<unsigned int> member_tags;
+        {
+        ArrayHandle<unsigned int> h_is_member_tag(m_is_member_tag,
+                                                  access_location::host,
+                                                  access_mode::readwrite);
+        for (auto tag : m_removed_tags)
+            {
+            if (tag < n_tags)
+                h_is_member_tag.data[tag] = 0;
+            }
+
+        ArrayHandle<unsigned int> h_member_tags(m_member_tags,
+                                                access_location::host,
+                                                access_mode::read);
+        size_t num_members = m_member_tags.getNumElements();
+        member_tags.reserve(num_members + added.size());
+        for (size_t member = 0; member < num_members; member++)
+            {
+            unsigned int tag = h_member_tags.data[member];
+            if (tag < n_tags && h_is_member_tag.data[tag])
+                member_tags.push_back(tag);
+            }
+
+        size_t n_kept = member_tags.size();
+        for (auto tag : added)
+            {
+            if (!h_is_member_tag.data[tag])
+                {
+                h_is_member_tag.data[tag] = 1;
+                member_tags.push_back(tag);
+                }
+            }
+        std::inplace_merge(member_tags.begin(), member_tags.begin() + n_kept, member_tags.end());
+        }
+
+    GlobalArray<unsigned int> member_tags_array(member_tags.size(), m_exec_conf);
+    m_member_tags.swap(member_tags_array);
+    TAG_ALLOCATION(m_member_tags);
+
+        {
+        ArrayHandle<unsigned int> h_member_tags(m_member_tags,
+                                                access_location::host,
+                                                access_mode::overwrite);
+        std::copy(member_tags.begin(), member_tags.end(), h_member_tags.data);
+        }
+
+    GlobalArray<unsigned int> member_idx(member_tags.size(), m_exec_conf);
+    m_member_idx.swap(member_idx);
+    TAG_ALLOCATION(m_member_idx);
+
+    // the index list depends on the members
+    m_particles_sorted = true;
+    }
+
 /*! \returns Total mass of all particles in the group
     \note This method acquires the ParticleData internally
 */
@@ -298,6 +298,12 @@ class PYBIND11_EXPORT ParticleGroup
     mutable bool m_particles_sorted;      //!< True if particle have been sorted since last rebuild
     mutable bool m_reallocated;           //!< True if particle data arrays have been reallocated
     mutable bool m_global_ptl_num_change; //!< True if the global particle number changed
+    bool m_membership_changed = false;    //!< True if single particles were added or removed
+    bool m_tag_change_pending = false;    //!< True if the next global number change is expected
+
+    std::vector<unsigned int> m_added_tags;   //!< Tags added since the last update
+    std::vector<unsigned int> m_removed_tags; //!< Tags removed since the last update
+    int m_removed_central_and_free = 0; //!< Local central and free members removed since then
 
     mutable GlobalArray<unsigned int>
         m_is_member_tag; //!< One byte per particle, == 1 if tag is a member of the group
@@ -331,11 +337,24 @@ class PYBIND11_EXPORT ParticleGroup
         {
         // carry out rebuild in correct order
         bool update_gpu_advice = false;
+        if (m_membership_changed && !(m_selector && m_update_tags))
+            {
+            // static groups handle additions and removals like any other particle number change
+            m_global_ptl_num_change = true;
+            }
         if (m_global_ptl_num_change)
             {
             updateMemberTags(false);
             m_global_ptl_num_change = false;
             }
+        else if (m_membership_changed)
+            {
+            updateMembership();
+            m_membership_changed = false;
+            m_added_tags.clear();
+            m_removed_tags.clear();
+            m_removed_central_and_free = 0;
+            }
         if (m_reallocated)
             {
             reallocate();
@@ -371,9 +390,34 @@ class PYBIND11_EXPORT ParticleGroup
     //! Helper function to be called when particles are added/removed
     void slotGlobalParticleNumChange()
         {
-        m_global_ptl_num_change = true;
+        if (m_tag_change_pending)
+            {
+            // the change is due to a single particle addition or removal
+            m_tag_change_pending = false;
+            m_membership_changed = true;
+            }
+        else
+            {
+            m_global_ptl_num_change = true;
+            }
+        }
+
+    //! Helper function to be called when a single particle is added
+    void slotParticleAdded(unsigned int tag)
+        {
+        m_added_tags.push_back(tag);
+        m_tag_change_pending = true;
         }
 
+    //! Helper function to be called when a single particle is removed
+    void slotParticleRemoved(unsigned int tag);
+
+    //! Update the member tags after single particles have been added or removed
+    void updateMembership();
+
+    //! Connect to the particle data signals
+    void connectSignals();
+
     //! Helper function to build the 1:1 hash for tag membership
     void buildTagHash();
 
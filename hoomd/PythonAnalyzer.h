@@ -20,6 +20,11 @@ class PYBIND11_EXPORT PythonAnalyzer : public Analyzer
 
     PDataFlags getRequestedPDataFlags();
 
+    bool usesPython()
+        {
+        return true;
+        }
+
     void setAnalyzer(pybind11::object analyzer);
 
     pybind11::object getAnalyzer()
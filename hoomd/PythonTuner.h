@@ -20,6 +20,11 @@ class PYBIND11_EXPORT PythonTuner : public Tuner
 
     PDataFlags getRequestedPDataFlags();
 
+    bool usesPython()
+        {
+        return true;
+        }
+
     void setTuner(pybind11::object tuner);
 
     pybind11::object getTuner()
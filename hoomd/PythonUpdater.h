@@ -20,6 +20,11 @@ class PYBIND11_EXPORT PythonUpdater : public Updater
 
     PDataFlags getRequestedPDataFlags();
 
+    bool usesPython()
+        {
+        return true;
+        }
+
     void setUpdater(pybind11::object updater);
 
     pybind11::object getUpdater()
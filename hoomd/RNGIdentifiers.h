@@ -70,6 +70,15 @@ struct RNGIdentifier
     static const uint8_t HPMCShapeMoveUpdateOrder = 44;
     static const uint8_t BussiThermostat = 45;
     static const uint8_t ConstantPressure = 46;
+    static const uint8_t CosineChannelFiller = 47;
+    static const uint8_t CosineExpansionContractionFiller = 48;
+    static const uint8_t SDFGeometryFiller = 49;
+    static const uint8_t VirtualParticleFiller = 50;
+    static const uint8_t ReplicaExchangeUpdater = 51;
+    static const uint8_t HPMCMonoPair = 52;
+    static const uint8_t HPMCMonoCheckerboard = 53;
+    static const uint8_t ParticleInitializer = 54;
+    static const uint8_t HPMCMonoExternalField = 55;
     };
 
     } // namespace hoomd
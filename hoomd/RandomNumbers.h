@@ -269,6 +269,127 @@ DEVICE inline r123::Philox4x32::ctr_type RandomGenerator::operator()()
     return u;
     }
 
+#if !defined(__HIPCC__) && !defined(__CUDACC_RTC__)
+//! Philox random number generators for a batch of streams
+/*! RandomGeneratorBatch evaluates the first B blocks of W streams at once on the CPU. Each lane
+    holds its own key and counter, and the Philox4x32 rounds loop over the lanes with no
+    dependencies between them, so the compiler vectorizes them with the widest vector instructions
+    the build targets. The blocks are identical to those the scalar RandomGenerator draws from the
+    same Seed and Counter.
+
+    Set the stream of every lane with setStream(), call generate(), then draw from the Generator
+    of each lane. Draws beyond the first B blocks are evaluated by the scalar path.
+
+    \tparam B Number of blocks to evaluate per stream
+    \tparam W Number of streams in the batch
+*/
+template<unsigned int B, unsigned int W = 8> class RandomGeneratorBatch
+    {
+    public:
+    //! Number of streams in the batch
+    static constexpr unsigned int width = W;
+
+    //! Generator that replays the blocks of one lane
+    class Generator
+        {
+        public:
+        Generator(const RandomGeneratorBatch& batch, unsigned int lane)
+            : m_batch(batch), m_lane(lane), m_block(0)
+            {
+            }
+
+        //! Generate uniformly distributed 128-bit values
+        r123::Philox4x32::ctr_type operator()()
+            {
+            if (m_block < B)
+                {
+                return m_batch.getBlock(m_lane, m_block++);
+                }
+
+            r123::Philox4x32::ctr_type ctr = m_batch.m_ctr[m_lane];
+            ctr.v[0] += m_block++;
+            r123::Philox4x32 rng;
+            return rng(ctr, m_batch.m_key[m_lane]);
+            }
+
+        private:
+        const RandomGeneratorBatch& m_batch; //!< Batch holding the blocks
+        const unsigned int m_lane;           //!< Lane of the stream
+        unsigned int m_block;                //!< Number of blocks drawn
+        };
+
+    //! Set the seed and counter of a lane
+    void setStream(unsigned int lane, const Seed& seed, const Counter& counter)
+        {
+        m_key[lane] = seed.getKey();
+        m_ctr[lane] = counter.getCounter();
+        }
+
+    //! Evaluate the first B blocks of every lane
+    void generate()
+        {
+        for (unsigned int b = 0; b < B; ++b)
+            {
+            uint32_t c0[W], c1[W], c2[W], c3[W], k0[W], k1[W];
+            for (unsigned int i = 0; i < W; ++i)
+                {
+                c0[i] = m_ctr[i].v[0] + b;
+                c1[i] = m_ctr[i].v[1];
+                c2[i] = m_ctr[i].v[2];
+                c3[i] = m_ctr[i].v[3];
+                k0[i] = m_key[i].v[0];
+                k1[i] = m_key[i].v[1];
+                }
+
+            for (unsigned int r = 0; r < PHILOX4x32_DEFAULT_ROUNDS; ++r)
+                {
+                for (unsigned int i = 0; i < W; ++i)
+                    {
+                    const uint64_t p0 = uint64_t(PHILOX_M4x32_0) * c0[i];
+                    const uint64_t p1 = uint64_t(PHILOX_M4x32_1) * c2[i];
+                    c0[i] = uint32_t(p1 >> 32) ^ c1[i] ^ k0[i];
+                    c1[i] = uint32_t(p1);
+                    c2[i] = uint32_t(p0 >> 32) ^ c3[i] ^ k1[i];
+                    c3[i] = uint32_t(p0);
+                    k0[i] += PHILOX_W32_0;
+                    k1[i] += PHILOX_W32_1;
+                    }
+                }
+
+            for (unsigned int i = 0; i < W; ++i)
+                {
+                m_blocks[b][0][i] = c0[i];
+                m_blocks[b][1][i] = c1[i];
+                m_blocks[b][2][i] = c2[i];
+                m_blocks[b][3][i] = c3[i];
+                }
+            }
+        }
+
+    //! Get a block of a lane
+    r123::Philox4x32::ctr_type getBlock(unsigned int lane, unsigned int block) const
+        {
+        return {{m_blocks[block][0][lane],
+                 m_blocks[block][1][lane],
+                 m_blocks[block][2][lane],
+                 m_blocks[block][3][lane]}};
+        }
+
+    //! Get the generator of a lane
+    /*! \pre generate() has been called since the stream of the lane was set.
+     */
+    Generator getGenerator(unsigned int lane) const
+        {
+        return Generator(*this, lane);
+        }
+
+    private:
+    r123::Philox4x32::key_type m_key[W] = {}; //!< Key of each lane
+    r123::Philox4x32::ctr_type m_ctr[W] = {}; //!< Initial counter of each lane
+    uint32_t m_blocks[B][4][W];               //!< Blocks evaluated by generate()
+    };
+#endif
+
 namespace detail
     {
 //! Generate a uniform random uint32_t
@@ -9,6 +9,7 @@
 #include "Communicator.h"
 
 #include <algorithm>
+#include <climits>
 #include <fstream>
 #include <iostream>
 #include <math.h>
@@ -96,6 +97,7 @@ void SFCPackTuner::update(uint64_t timestep)
 #endif
 
     // figure out the sort order we need to apply
+    computeSortKeys();
     if (m_sysdef->getNDimensions() == 2)
         getSortedOrder2D();
     else
@@ -104,6 +106,9 @@ void SFCPackTuner::update(uint64_t timestep)
     // apply that sort order to the particles
     applySortOrder();
 
+    if (m_sort_groups)
+        sortBondedGroups();
+
     // trigger sort signal (this also forces particle migration)
     m_pdata->notifyParticleSort();
 
@@ -116,6 +121,30 @@ void SFCPackTuner::update(uint64_t timestep)
 #endif
     }
 
+void SFCPackTuner::computeSortKeys()
+    {
+    m_n_sort_keys = 0;
+    if (!m_sort_key_provider)
+        return;
+
+    m_n_sort_keys = m_sort_key_provider->computeSortKeys(m_sort_keys);
+    if (m_n_sort_keys == 0)
+        return;
+
+    if (m_sort_keys.size() < m_pdata->getN())
+        {
+        throw std::runtime_error("SortKeyProvider did not compute a key for every particle.");
+        }
+
+    // the keys are combined with the bins on the curve into one unsigned int
+    const unsigned int n_bins = (m_sysdef->getNDimensions() == 2) ? m_grid * m_grid
+                                                                  : m_grid * m_grid * m_grid;
+    if (m_n_sort_keys > UINT_MAX - n_bins)
+        {
+        throw std::runtime_error("Too many sort keys for the particle sorter grid.");
+        }
+    }
+
 void SFCPackTuner::applySortOrder()
     {
     assert(m_pdata);
@@ -524,7 +553,7 @@ void SFCPackTuner::getSortedOrder2D()
             // record its bin
             unsigned int bin = ib * m_grid + jb;
 
-            m_particle_bins[n] = std::pair<unsigned int, unsigned int>(bin, n);
+            m_particle_bins[n] = std::pair<unsigned int, unsigned int>(getSortBin(n, bin), n);
             }
         }
 
@@ -636,7 +665,8 @@ void SFCPackTuner::getSortedOrder3D()
         // record its bin
         unsigned int bin = ib * (m_grid * m_grid) + jb * m_grid + kb;
 
-        m_particle_bins[n] = std::pair<unsigned int, unsigned int>(h_traversal_order.data[bin], n);
+        m_particle_bins[n]
+            = std::pair<unsigned int, unsigned int>(getSortBin(n, h_traversal_order.data[bin]), n);
         }
 
     // sort the tuples
@@ -682,13 +712,31 @@ void SFCPackTuner::writeTraversalOrder(const std::string& fname,
         }
     }
 
+void SFCPackTuner::sortBondedGroups()
+    {
+    m_sysdef->getBondData()->sortByParticleIndex();
+    m_sysdef->getAngleData()->sortByParticleIndex();
+    m_sysdef->getDihedralData()->sortByParticleIndex();
+    m_sysdef->getImproperData()->sortByParticleIndex();
+    m_sysdef->getConstraintData()->sortByParticleIndex();
+    m_sysdef->getPairData()->sortByParticleIndex();
+    }
+
 namespace detail
     {
 void export_SFCPackTuner(pybind11::module& m)
     {
     pybind11::class_<SFCPackTuner, Tuner, std::shared_ptr<SFCPackTuner>>(m, "SFCPackTuner")
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<Trigger>>())
-        .def_property("grid", &SFCPackTuner::getGrid, &SFCPackTuner::setGridPython);
+        .def_property("grid", &SFCPackTuner::getGrid, &SFCPackTuner::setGridPython)
+        .def_property("sort_groups", &SFCPackTuner::getSortGroups, &SFCPackTuner::setSortGroups)
+        .def("setSortKeyProvider", &SFCPackTuner::setSortKeyProvider)
+        .def("removeSortKeyProvider", &SFCPackTuner::removeSortKeyProvider);
+    }
+
+void export_SortKeyProvider(pybind11::module& m)
+    {
+    pybind11::class_<SortKeyProvider, std::shared_ptr<SortKeyProvider>>(m, "SortKeyProvider");
     }
 
     } // end namespace detail
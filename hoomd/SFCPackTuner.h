@@ -10,6 +10,7 @@
 #endif
 
 #include "GPUVector.h"
+#include "SortKeyProvider.h"
 #include "Tuner.h"
 
 #include <memory>
@@ -38,6 +39,14 @@ namespace hoomd
    set to reasonable defaults, which is as high as it can possibly go without consuming a
    significant amount of memory. The grid dimension can be changed by calling setGrid().
 
+    After the particles, the bonded groups are reordered by the index of their members so that
+   loops and GPU table rebuilds over the groups access the particles in order. This can be disabled
+   with setSortGroups().
+
+    A SortKeyProvider can be set to order some of the particles by its own keys instead of the
+   space-filling curve. These particles are placed first, followed by the others along the curve.
+   The MPCD cell list uses this to order the embedded particles by their MPCD cell.
+
     Implementation details:<br>
     The rearranging is done by computing bins for the particles, and then ordering the particles
    based on the order in which those bins appear along a hilbert curve. It is very efficient, even
@@ -80,11 +89,66 @@ class PYBIND11_EXPORT SFCPackTuner : public Tuner
         return m_grid;
         }
 
+    //! Set whether the bonded groups are reordered along with the particles
+    void setSortGroups(bool sort_groups)
+        {
+        m_sort_groups = sort_groups;
+        }
+
+    //! Get whether the bonded groups are reordered along with the particles
+    bool getSortGroups()
+        {
+        return m_sort_groups;
+        }
+
+    //! Set the provider of the keys that override the space-filling curve order
+    void setSortKeyProvider(std::shared_ptr<SortKeyProvider> provider)
+        {
+        m_sort_key_provider = provider;
+        }
+
+    //! Get the provider of the keys that override the space-filling curve order
+    std::shared_ptr<SortKeyProvider> getSortKeyProvider() const
+        {
+        return m_sort_key_provider;
+        }
+
+    //! Order all particles along the space-filling curve
+    void removeSortKeyProvider()
+        {
+        m_sort_key_provider.reset();
+        }
+
     protected:
     unsigned int m_grid;                      //!< Grid dimension to use
     unsigned int m_last_grid;                 //!< The last value of MMax
     unsigned int m_last_dim;                  //!< Check the last dimension we ran at
     GPUArray<unsigned int> m_traversal_order; //!< Generated traversal order of bins
+    bool m_sort_groups = true;                //!< True if bonded groups are reordered
+
+    std::shared_ptr<SortKeyProvider> m_sort_key_provider; //!< Keys overriding the curve order
+    std::vector<unsigned int> m_sort_keys;                //!< Key of each particle
+    unsigned int m_n_sort_keys = 0; //!< Number of keys, 0 if the curve orders all particles
+
+    //! Get the keys of the particles from the SortKeyProvider
+    void computeSortKeys();
+
+    //! Combine the key of a particle with its bin on the space-filling curve
+    /*! \param idx Particle index
+        \param bin Bin of the particle on the space-filling curve
+
+        The particles with a key are ordered by it before all other particles.
+    */
+    unsigned int getSortBin(unsigned int idx, unsigned int bin) const
+        {
+        if (m_n_sort_keys == 0)
+            return bin;
+        const unsigned int key = m_sort_keys[idx];
+        return (key < m_n_sort_keys) ? key : m_n_sort_keys + bin;
+        }
+
+    //! Reorder the bonded groups by the new particle order
+    void sortBondedGroups();
 
     //! Helper function that actually performs the sort
     virtual void getSortedOrder2D();
@@ -126,6 +190,9 @@ namespace detail
 //! Export the SFCPackTuner class to python
 void export_SFCPackTuner(pybind11::module& m);
 
+//! Export the SortKeyProvider class to python
+void export_SortKeyProvider(pybind11::module& m);
+
     } // end namespace detail
 
     } // end namespace hoomd
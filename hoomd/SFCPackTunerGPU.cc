@@ -120,6 +120,22 @@ void SFCPackTunerGPU::getSortedOrder3D()
     // sanity checks
     assert(m_gpu_particle_bins.getNumElements() >= m_pdata->getN());
 
+    // copy the keys of the particles to the device
+    if (m_n_sort_keys > 0)
+        {
+        if (m_gpu_sort_keys.getNumElements() < m_pdata->getN())
+            {
+            GlobalArray<unsigned int> gpu_sort_keys(m_pdata->getMaxN(), m_exec_conf);
+            m_gpu_sort_keys.swap(gpu_sort_keys);
+            TAG_ALLOCATION(m_gpu_sort_keys);
+            }
+
+        ArrayHandle<unsigned int> h_gpu_sort_keys(m_gpu_sort_keys,
+                                                  access_location::host,
+                                                  access_mode::overwrite);
+        std::copy(m_sort_keys.begin(), m_sort_keys.begin() + m_pdata->getN(), h_gpu_sort_keys.data);
+        }
+
     // access arrays
     ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
     ArrayHandle<unsigned int> d_gpu_particle_bins(m_gpu_particle_bins,
@@ -131,6 +147,9 @@ void SFCPackTunerGPU::getSortedOrder3D()
     ArrayHandle<unsigned int> d_traversal_order(m_traversal_order,
                                                 access_location::device,
                                                 access_mode::read);
+    ArrayHandle<unsigned int> d_gpu_sort_keys(m_gpu_sort_keys,
+                                              access_location::device,
+                                              access_mode::read);
 
     // put the particles in the bins and sort
     kernel::gpu_generate_sorted_order(m_pdata->getN(),
@@ -141,6 +160,8 @@ void SFCPackTunerGPU::getSortedOrder3D()
                                       d_gpu_sort_order.data,
                                       box,
                                       m_sysdef->getNDimensions() == 2,
+                                      (m_n_sort_keys > 0) ? d_gpu_sort_keys.data : nullptr,
+                                      m_n_sort_keys,
                                       m_exec_conf->getCachedAllocator());
 
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -29,7 +29,9 @@ __global__ void gpu_sfc_bin_particles_kernel(unsigned int N,
                                              const unsigned int* d_traversal_order,
                                              unsigned int n_grid,
                                              unsigned int* d_sorted_order,
-                                             const BoxDim box)
+                                             const BoxDim box,
+                                             const unsigned int* d_sort_keys,
+                                             const unsigned int n_sort_keys)
     {
     unsigned int idx = blockDim.x * blockIdx.x + threadIdx.x;
 
@@ -75,6 +77,13 @@ __global__ void gpu_sfc_bin_particles_kernel(unsigned int N,
         d_particle_bins[idx] = d_traversal_order[bin];
         }
 
+    // particles with a key are placed first in the order of their keys
+    if (d_sort_keys)
+        {
+        const unsigned int key = d_sort_keys[idx];
+        d_particle_bins[idx] = (key < n_sort_keys) ? key : n_sort_keys + d_particle_bins[idx];
+        }
+
     // store index of ptl
     d_sorted_order[idx] = idx;
     }
@@ -87,6 +96,8 @@ __global__ void gpu_sfc_bin_particles_kernel(unsigned int N,
     \param d_sorted_order Sorted order of particles
     \param box Box dimensions
     \param twod If true, bin particles in two dimensions
+    \param d_sort_keys Key of each particle overriding the curve order, or nullptr if none
+    \param n_sort_keys Number of keys
     */
 void gpu_generate_sorted_order(unsigned int N,
                                const Scalar4* d_pos,
@@ -96,6 +107,8 @@ void gpu_generate_sorted_order(unsigned int N,
                                unsigned int* d_sorted_order,
                                const BoxDim& box,
                                bool twod,
+                               const unsigned int* d_sort_keys,
+                               unsigned int n_sort_keys,
                                CachedAllocator& alloc)
     {
     // maybe need to autotune, but SFCPackTuner is called infrequently
@@ -114,7 +127,9 @@ void gpu_generate_sorted_order(unsigned int N,
                            d_traversal_order,
                            n_grid,
                            d_sorted_order,
-                           box);
+                           box,
+                           d_sort_keys,
+                           n_sort_keys);
     else
         hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_sfc_bin_particles_kernel<false>),
                            dim3(n_blocks),
@@ -127,7 +142,9 @@ void gpu_generate_sorted_order(unsigned int N,
                            d_traversal_order,
                            n_grid,
                            d_sorted_order,
-                           box);
+                           box,
+                           d_sort_keys,
+                           n_sort_keys);
 
     // Sort particles
     if (N)
@@ -26,6 +26,8 @@ void gpu_generate_sorted_order(unsigned int N,
                                unsigned int* d_sorted_order,
                                const BoxDim& box,
                                bool twod,
+                               const unsigned int* d_sort_keys,
+                               unsigned int n_sort_keys,
                                CachedAllocator& alloc);
 
 //! Reorder particle data (GPU driver function)
@@ -48,6 +48,7 @@ class PYBIND11_EXPORT SFCPackTunerGPU : public SFCPackTuner
     private:
     GlobalArray<unsigned int> m_gpu_particle_bins; //!< Particle bins
     GlobalArray<unsigned int> m_gpu_sort_order;    //!< Generated sort order of the particles
+    GlobalArray<unsigned int> m_gpu_sort_keys;     //!< Keys from the SortKeyProvider
 
     //! Helper function that actually performs the sort
     virtual void getSortedOrder2D();
@@ -43,16 +43,18 @@ void SnapshotSystemData<Real>::replicate(unsigned int nx, unsigned int ny, unsig
 
 template<class Real> void SnapshotSystemData<Real>::wrap()
     {
+    const BoxDim& box = *global_box;
+    auto modulus_positive
+        = [](Real x) { return std::fmod(std::fmod(x, Real(1.0)) + Real(1.0), Real(1.0)); };
+
     // HOOMD particles
     for (unsigned int i = 0; i < particle_data.size; i++)
         {
-        auto const frac = global_box->makeFraction(particle_data.pos[i]);
-        auto modulus_positive
-            = [](Real x) { return std::fmod(std::fmod(x, Real(1.0)) + Real(1.0), Real(1.0)); };
+        auto const frac = box.makeFraction(particle_data.pos[i]);
         auto const wrapped = vec3<Real>(modulus_positive(static_cast<Real>(frac.x)),
                                         modulus_positive(static_cast<Real>(frac.y)),
                                         modulus_positive(static_cast<Real>(frac.z)));
-        particle_data.pos[i] = global_box->makeCoordinates(wrapped);
+        particle_data.pos[i] = box.makeCoordinates(wrapped);
         auto const img = make_int3(static_cast<int>(std::floor(frac.x)),
                                    static_cast<int>(std::floor(frac.y)),
                                    static_cast<int>(std::floor(frac.z)));
@@ -61,15 +63,15 @@ template<class Real> void SnapshotSystemData<Real>::wrap()
 
 #ifdef BUILD_MPCD
     // MPCD particles
+    auto modulus_positive_mpcd = [](Scalar x)
+    { return std::fmod(std::fmod(x, Scalar(1.0)) + Scalar(1.0), Scalar(1.0)); };
     for (unsigned int i = 0; i < mpcd_data.size; ++i)
         {
-        auto const frac = global_box->makeFraction(mpcd_data.position[i]);
-        auto modulus_positive = [](Scalar x)
-        { return std::fmod(std::fmod(x, Scalar(1.0)) + Scalar(1.0), Scalar(1.0)); };
-        auto const wrapped = vec3<Scalar>(modulus_positive(static_cast<Scalar>(frac.x)),
-                                          modulus_positive(static_cast<Scalar>(frac.y)),
-                                          modulus_positive(static_cast<Scalar>(frac.z)));
-        mpcd_data.position[i] = global_box->makeCoordinates(wrapped);
+        auto const frac = box.makeFraction(mpcd_data.position[i]);
+        auto const wrapped = vec3<Scalar>(modulus_positive_mpcd(static_cast<Scalar>(frac.x)),
+                                          modulus_positive_mpcd(static_cast<Scalar>(frac.y)),
+                                          modulus_positive_mpcd(static_cast<Scalar>(frac.z)));
+        mpcd_data.position[i] = box.makeCoordinates(wrapped);
         }
 #endif
     }
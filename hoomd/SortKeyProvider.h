@@ -0,0 +1,44 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __SORTKEYPROVIDER_H__
+#define __SORTKEYPROVIDER_H__
+
+/*! \file SortKeyProvider.h
+    \brief Declares the SortKeyProvider class
+    This is an abstract base class to enable other components to choose the order that
+    SFCPackTuner sorts some of the particles into.
+*/
+
+#include "HOOMDMath.h"
+
+#include <vector>
+
+namespace hoomd
+    {
+//! Provides the keys that SFCPackTuner sorts a subset of the particles by
+/*! Components that bin particles on their own grid (e.g., the MPCD cell list with embedded
+    particles) can make SFCPackTuner order these particles by their bins, so that the particles in
+    the same bin are next to each other in memory.
+
+    SFCPackTuner places the particles with a key first, in the order of their keys, followed by the
+    other particles in the order of the space-filling curve.
+*/
+class PYBIND11_EXPORT SortKeyProvider
+    {
+    public:
+    //! Compute the sort keys of the local particles
+    /*! \param keys Key of each local particle (output), resized to the number of local particles
+        \returns Number of keys, or 0 if no particle has a key
+
+        Particles with a key that is not smaller than the returned number are sorted along the
+        space-filling curve. The keys are not used when 0 is returned.
+    */
+    virtual unsigned int computeSortKeys(std::vector<unsigned int>& keys) = 0;
+
+    virtual ~SortKeyProvider() {};
+    };
+
+    } // namespace hoomd
+
+#endif
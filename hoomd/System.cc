@@ -14,6 +14,7 @@
 #include <pybind11/cast.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl_bind.h>
+#include <optional>
 #include <stdexcept>
 #include <time.h>
 
@@ -41,6 +42,9 @@ System::System(std::shared_ptr<SystemDefinition> sysdef, uint64_t initial_tstep)
     assert(m_sysdef);
     m_exec_conf = m_sysdef->getParticleData()->getExecConf();
 
+    // compute the potential energy on every step by default
+    m_default_flags[pdata_flag::potential_energy] = 1;
+
 #ifdef ENABLE_MPI
     // the initial time step is defined on the root processor
     if (m_sysdef->getParticleData()->getDomainDecomposition())
@@ -118,22 +122,64 @@ void System::run(uint64_t nsteps, bool write_at_start)
     m_sysdef->getParticleData()->setFlags(determineFlags(m_cur_tstep));
 
     // execute analyzers on initial step if requested
+    Tracer& tracer = m_exec_conf->getTracer();
+
     if (write_at_start)
         {
         for (auto& analyzer : m_analyzers)
             {
             if ((*analyzer->getTrigger())(m_cur_tstep))
+                {
+                ScopedTrace trace(tracer, typeid(*analyzer), "analyzer");
+                ScopedTimer timer(analyzer->getTimer());
                 analyzer->analyze(m_cur_tstep);
+                }
             }
         }
 
+    // Release the GIL in windows of steps where no action calls into Python so that the run loop
+    // does not contend with other Python threads. Each window is limited in length and in wall
+    // time so that signals are checked regularly.
+    std::optional<pybind11::gil_scoped_release> release_gil;
+    const bool can_release_gil = Py_IsInitialized() && PyGILState_Check();
+    const uint64_t max_window_steps = 1000;
+    const int64_t max_window_time = 100000000; // 0.1 seconds in nanoseconds
+    uint64_t window_end = m_cur_tstep;
+    int64_t window_start_time = 0;
+
     // run the steps
     for (uint64_t count = 0; count < nsteps; count++)
         {
+        if (m_cur_tstep >= window_end
+            || (release_gil && m_clk.getTime() - window_start_time > max_window_time))
+            {
+            release_gil.reset();
+
+            // propagate Python exceptions related to signals
+            if (PyErr_CheckSignals() != 0)
+                {
+                throw pybind11::error_already_set();
+                }
+
+            window_end = m_cur_tstep
+                         + countStepsWithoutPython(std::min(nsteps - count, max_window_steps));
+            if (can_release_gil && window_end > m_cur_tstep)
+                {
+                release_gil.emplace();
+                window_start_time = m_clk.getTime();
+                }
+            }
+
+        ScopedTrace step_trace(tracer, "step", "run");
+
         for (auto& tuner : m_tuners)
             {
             if ((*tuner->getTrigger())(m_cur_tstep))
+                {
+                ScopedTrace trace(tracer, typeid(*tuner), "tuner");
+                ScopedTimer timer(tuner->getTimer());
                 tuner->update(m_cur_tstep);
+                }
             }
 
         // execute updaters
@@ -141,6 +187,8 @@ void System::run(uint64_t nsteps, bool write_at_start)
             {
             if ((*updater->getTrigger())(m_cur_tstep))
                 {
+                ScopedTrace trace(tracer, typeid(*updater), "updater");
+                ScopedTimer timer(updater->getTimer());
                 updater->update(m_cur_tstep);
                 m_update_group_dof_next_step |= updater->mayChangeDegreesOfFreedom(m_cur_tstep);
                 }
@@ -159,7 +207,11 @@ void System::run(uint64_t nsteps, bool write_at_start)
 
         // execute the integrator
         if (m_integrator)
+            {
+            ScopedTrace trace(tracer, typeid(*m_integrator), "integrator");
+            ScopedTimer timer(m_integrator->getTimer());
             m_integrator->update(m_cur_tstep);
+            }
 
         m_cur_tstep++;
 
@@ -167,16 +219,22 @@ void System::run(uint64_t nsteps, bool write_at_start)
         for (auto& analyzer : m_analyzers)
             {
             if ((*analyzer->getTrigger())(m_cur_tstep))
+                {
+                ScopedTrace trace(tracer, typeid(*analyzer), "analyzer");
+                ScopedTimer timer(analyzer->getTimer());
                 analyzer->analyze(m_cur_tstep);
+                }
             }
 
         updateTPS();
+        }
 
-        // propagate Python exceptions related to signals
-        if (PyErr_CheckSignals() != 0)
-            {
-            throw pybind11::error_already_set();
-            }
+    release_gil.reset();
+
+    // propagate Python exceptions related to signals
+    if (PyErr_CheckSignals() != 0)
+        {
+        throw pybind11::error_already_set();
         }
     }
 
@@ -203,6 +261,10 @@ void System::resetStats()
     for (auto& updater : m_updaters)
         updater->resetStats();
 
+    // tuners
+    for (auto& tuner : m_tuners)
+        tuner->resetStats();
+
     // computes
     for (auto compute : m_computes)
         compute->resetStats();
@@ -240,6 +302,58 @@ PDataFlags System::determineFlags(uint64_t tstep)
     return flags;
     }
 
+/*! \param max_steps Maximum number of steps to count
+    \returns The number of consecutive steps, starting with the current one, that do not run an
+        action that calls into Python.
+
+    Tuners and updaters run on the current step and analyzers after the step counter increments.
+    Deterministic triggers are evaluated ahead of time, jumping from each step where they are
+    evaluated to the next step on which they may activate. The count stops at the first step where
+    an action that calls into Python may run, which is every step when its trigger is not
+    deterministic.
+*/
+uint64_t System::countStepsWithoutPython(uint64_t max_steps)
+    {
+    if (m_integrator && m_integrator->usesPython())
+        return 0;
+
+    // triggers of the actions that call into Python and the offset of the step they are
+    // evaluated on
+    std::vector<std::pair<Trigger*, uint64_t>> triggers;
+    auto add_actions = [&triggers](auto& actions, uint64_t offset)
+    {
+        for (auto& action : actions)
+            {
+            if (action->usesPython())
+                triggers.push_back(std::make_pair(action->getTrigger().get(), offset));
+            }
+    };
+    add_actions(m_tuners, 0);
+    add_actions(m_updaters, 0);
+    add_actions(m_analyzers, 1);
+
+    for (const auto& trigger : triggers)
+        {
+        if (!trigger.first->isDeterministic())
+            return 0;
+        }
+
+    uint64_t n = 0;
+    while (n < max_steps)
+        {
+        uint64_t skip = max_steps - n;
+        for (const auto& trigger : triggers)
+            {
+            const uint64_t timestep = m_cur_tstep + n + trigger.second;
+            if ((*trigger.first)(timestep))
+                return n;
+            skip = std::min(skip, trigger.first->getNextTimestep(timestep + 1) - timestep);
+            }
+        n += skip;
+        }
+    return max_steps;
+    }
+
 /*! Apply the degrees of freedom given by the integrator to all groups in the cache.
  */
 void System::updateGroupDOF()
@@ -279,6 +393,8 @@ void export_System(pybind11::module& m)
         .def("getCurrentTimeStep", &System::getCurrentTimeStep)
         .def("setPressureFlag", &System::setPressureFlag)
         .def("getPressureFlag", &System::getPressureFlag)
+        .def("setEnergyFlag", &System::setEnergyFlag)
+        .def("getEnergyFlag", &System::getEnergyFlag)
         .def_property_readonly("walltime", &System::getCurrentWalltime)
         .def_property_readonly("final_timestep", &System::getEndStep)
         .def_property_readonly("initial_timestep", &System::getStartStep)
@@ -176,6 +176,18 @@ class PYBIND11_EXPORT System
         return m_default_flags[pdata_flag::pressure_tensor];
         }
 
+    /// Set energy computation particle data flag
+    void setEnergyFlag(bool flag)
+        {
+        m_default_flags[pdata_flag::potential_energy] = flag;
+        }
+
+    /// Get the energy computation particle data flag
+    bool getEnergyFlag()
+        {
+        return m_default_flags[pdata_flag::potential_energy];
+        }
+
     /// Get the particle group cache.
     std::vector<std::shared_ptr<ParticleGroup>>& getGroupCache()
         {
@@ -225,6 +237,9 @@ class PYBIND11_EXPORT System
     //! Get the flags needed for a particular step
     PDataFlags determineFlags(uint64_t tstep);
 
+    /// Count the steps from the current one that do not run actions that call into Python
+    uint64_t countStepsWithoutPython(uint64_t max_steps);
+
     /// Record the initial time of the last run
     int64_t m_initial_time = 0;
 
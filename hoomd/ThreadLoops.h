@@ -0,0 +1,130 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __THREAD_LOOPS_H__
+#define __THREAD_LOOPS_H__
+
+#include "hoomd/ExecutionConfiguration.h"
+
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <cstdint>
+#include <vector>
+
+/*! \file ThreadLoops.h
+    \brief Declares helpers that split CPU loops over the TBB threads
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace detail
+    {
+//! Run a loop whose iterations write to separate outputs on the TBB threads
+/*! \param exec_conf Execution configuration that holds the task arena
+    \param n Number of iterations
+    \param f Function called as f(begin, end) for a range of iterations
+
+    Use this for loops where each iteration only writes its own output, such as the loop over
+    particles of a pair force with a full neighbor list. Each output is then computed in the same
+    order as in a serial loop, so the result does not depend on the number of threads.
+*/
+template<class Func>
+void parallelForEach(const ExecutionConfiguration& exec_conf, unsigned int n, const Func& f)
+    {
+#ifdef ENABLE_TBB
+    if (exec_conf.getNumThreads() > 1 && n > 1)
+        {
+        exec_conf.getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  { f(r.begin(), r.end()); });
+            });
+        return;
+        }
+#endif
+    f(0, n);
+    }
+
+//! Get the number of contiguous chunks to split a loop into, one per TBB thread
+/*! \param exec_conf Execution configuration that holds the task arena
+    \param n Number of iterations
+
+    Loops that are too short to give each thread at least two iterations are not split.
+*/
+inline unsigned int getNumThreadChunks(const ExecutionConfiguration& exec_conf, unsigned int n)
+    {
+    const unsigned int n_threads = exec_conf.getNumThreads();
+    if (n_threads <= 1 || n < 2 * n_threads)
+        return 1;
+    return n_threads;
+    }
+
+//! Get the first iteration of a chunk of a loop
+inline unsigned int getThreadChunkBegin(unsigned int chunk, unsigned int n_chunks, unsigned int n)
+    {
+    return static_cast<unsigned int>(uint64_t(n) * chunk / n_chunks);
+    }
+
+//! Run a loop that accumulates into a value on the TBB threads
+/*! \param exec_conf Execution configuration that holds the task arena
+    \param n Number of iterations
+    \param init Value that each chunk starts to accumulate from
+    \param f Function called as f(begin, end, value) for a range of iterations, which adds its
+             contribution to value
+    \returns The sum of the values of all chunks
+
+    The loop is split into one contiguous chunk per TBB thread, and each chunk accumulates into its
+    own buffer. The buffers are summed with \a T::operator+ once the loop is done, in order of the
+    chunks, so the result is deterministic for a given number of threads.
+*/
+template<class T, class Func>
+T parallelAccumulate(const ExecutionConfiguration& exec_conf,
+                     unsigned int n,
+                     const T& init,
+                     const Func& f)
+    {
+    const unsigned int n_chunks = getNumThreadChunks(exec_conf, n);
+    if (n_chunks == 1)
+        {
+        T value = init;
+        f(0, n, value);
+        return value;
+        }
+
+    std::vector<T> buffers(n_chunks, init);
+#ifdef ENABLE_TBB
+    exec_conf.getTaskArena()->execute(
+        [&]
+        {
+            tbb::parallel_for(0u,
+                              n_chunks,
+                              [&](unsigned int chunk)
+                              {
+                                  f(getThreadChunkBegin(chunk, n_chunks, n),
+                                    getThreadChunkBegin(chunk + 1, n_chunks, n),
+                                    buffers[chunk]);
+                              });
+        });
+#endif
+
+    T value = buffers[0];
+    for (unsigned int chunk = 1; chunk < n_chunks; ++chunk)
+        {
+        value = value + buffers[chunk];
+        }
+    return value;
+    }
+
+    } // end namespace detail
+    } // end namespace hoomd
+
+#endif // __THREAD_LOOPS_H__
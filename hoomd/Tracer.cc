@@ -0,0 +1,394 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file Tracer.cc
+    \brief Defines the Tracer class
+*/
+
+#include "Tracer.h"
+
+#include <algorithm>
+#include <cxxabi.h>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+#ifdef ENABLE_NVTOOLS
+#include <nvToolsExt.h>
+#endif
+
+#if defined(ENABLE_ROCTRACER) && defined(__HIP_PLATFORM_HCC__)
+#include <roctracer/roctx.h>
+#endif
+
+namespace hoomd
+    {
+std::atomic<uint64_t> Tracer::s_generation {0};
+
+Tracer::Tracer(bool gpu) : m_gpu(gpu)
+    {
+#ifdef ENABLE_HIP
+    if (m_gpu)
+        hipEventCreate(&m_gpu_reference);
+#endif
+    }
+
+Tracer::~Tracer()
+    {
+    freeBuffers();
+#ifdef ENABLE_HIP
+    if (m_gpu)
+        hipEventDestroy(m_gpu_reference);
+#endif
+    }
+
+/*! \param capacity Number of events each thread's ring buffer holds
+    \param gpu_events Set to true to also time each span on the GPU
+
+    Previously recorded events are discarded. GPU events are ignored on the CPU.
+*/
+void Tracer::start(unsigned int capacity, bool gpu_events)
+    {
+    if (capacity == 0)
+        {
+        throw std::invalid_argument("Trace capacity must be positive.");
+        }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    freeBuffers();
+
+    m_capacity = capacity;
+    m_gpu_events = gpu_events && m_gpu;
+    m_generation = ++s_generation;
+
+#ifdef ENABLE_HIP
+    if (m_gpu_events)
+        {
+        hipEventRecord(m_gpu_reference, 0);
+        m_gpu_reference_time = getTime();
+        }
+#endif
+
+    m_enabled = true;
+    }
+
+void Tracer::stop()
+    {
+    m_enabled = false;
+    }
+
+/*! \param name Name to intern
+    \returns A pointer to a copy of \a name that is valid for the lifetime of the tracer
+*/
+const char* Tracer::intern(const std::string& name)
+    {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_names.insert(name).first->c_str();
+    }
+
+/*! \param type Type to name
+    \returns The demangled name of \a type without the hoomd namespace
+*/
+const char* Tracer::getTypeName(const std::type_info& type)
+    {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_type_names.find(std::type_index(type));
+    if (it != m_type_names.end())
+        return it->second;
+
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+    std::string name = (status == 0 && demangled) ? demangled : type.name();
+    std::free(demangled);
+    const std::string prefix("hoomd::");
+    if (name.compare(0, prefix.size(), prefix) == 0)
+        name = name.substr(prefix.size());
+
+    const char* result = m_names.insert(name).first->c_str();
+    m_type_names[std::type_index(type)] = result;
+    return result;
+    }
+
+/*! The first call from each thread (after each start()) allocates that thread's buffer. Later
+    calls only read thread local variables.
+*/
+Tracer::ThreadBuffer& Tracer::getThreadBuffer()
+    {
+    thread_local uint64_t t_generation = 0;
+    thread_local ThreadBuffer* t_buffer = nullptr;
+
+    // generations are unique across tracers, so the cached buffer belongs to this tracer
+    if (t_generation == m_generation)
+        return *t_buffer;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->events.resize(m_capacity, Event {nullptr, nullptr, 0, -1});
+    buffer->thread_id = (unsigned int)m_buffers.size();
+#ifdef ENABLE_HIP
+    if (m_gpu_events)
+        {
+        buffer->gpu_start.resize(m_capacity);
+        buffer->gpu_end.resize(m_capacity);
+        for (unsigned int i = 0; i < m_capacity; ++i)
+            {
+            hipEventCreate(&buffer->gpu_start[i]);
+            hipEventCreate(&buffer->gpu_end[i]);
+            }
+        }
+#endif
+
+    t_buffer = buffer.get();
+    t_generation = m_generation;
+    m_buffers.push_back(std::move(buffer));
+    return *t_buffer;
+    }
+
+void Tracer::freeBuffers()
+    {
+#ifdef ENABLE_HIP
+    for (auto& buffer : m_buffers)
+        {
+        for (unsigned int i = 0; i < buffer->gpu_start.size(); ++i)
+            {
+            hipEventDestroy(buffer->gpu_start[i]);
+            hipEventDestroy(buffer->gpu_end[i]);
+            }
+        }
+#endif
+    m_buffers.clear();
+    }
+
+/*! \param name Name of the span
+    \param category Category of the span
+    \returns The slot to pass to end()
+*/
+uint64_t Tracer::begin(const char* name, const char* category)
+    {
+    ThreadBuffer& buffer = getThreadBuffer();
+    uint64_t slot = buffer.head.load(std::memory_order_relaxed);
+    Event& event = buffer.events[slot % m_capacity];
+    event.name = name;
+    event.category = category;
+    event.start = getTime();
+    event.end = -1;
+    buffer.head.store(slot + 1, std::memory_order_release);
+
+#ifdef ENABLE_HIP
+    if (m_gpu_events)
+        hipEventRecord(buffer.gpu_start[slot % m_capacity], 0);
+#endif
+
+#ifdef ENABLE_NVTOOLS
+    nvtxRangePushA(name);
+#elif defined(ENABLE_ROCTRACER) && defined(__HIP_PLATFORM_HCC__)
+    roctxRangePush(name);
+#endif
+
+    return slot;
+    }
+
+/*! \param slot Value returned by the matching call to begin()
+
+    Spans that were overwritten while open are not recorded.
+*/
+void Tracer::end(uint64_t slot)
+    {
+#ifdef ENABLE_NVTOOLS
+    nvtxRangePop();
+#elif defined(ENABLE_ROCTRACER) && defined(__HIP_PLATFORM_HCC__)
+    roctxRangePop();
+#endif
+
+    ThreadBuffer& buffer = getThreadBuffer();
+    uint64_t head = buffer.head.load(std::memory_order_relaxed);
+    if (slot >= head || head - slot > m_capacity)
+        return;
+
+#ifdef ENABLE_HIP
+    if (m_gpu_events)
+        hipEventRecord(buffer.gpu_end[slot % m_capacity], 0);
+#endif
+
+    buffer.events[slot % m_capacity].end = getTime();
+    }
+
+/*! \param name Name of the span
+    \param category Category of the span
+    \param start Start time (from getTime())
+    \param end End time (from getTime())
+*/
+void Tracer::record(const char* name, const char* category, int64_t start, int64_t end)
+    {
+    if (!m_enabled)
+        return;
+
+    ThreadBuffer& buffer = getThreadBuffer();
+    uint64_t slot = buffer.head.load(std::memory_order_relaxed);
+    buffer.events[slot % m_capacity] = Event {name, category, start, end};
+#ifdef ENABLE_HIP
+    if (m_gpu_events)
+        {
+        // there is no GPU time for this span, mark it empty
+        hipEventRecord(buffer.gpu_start[slot % m_capacity], 0);
+        hipEventRecord(buffer.gpu_end[slot % m_capacity], 0);
+        }
+#endif
+    buffer.head.store(slot + 1, std::memory_order_release);
+    }
+
+unsigned int Tracer::getNumEvents()
+    {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    uint64_t n = 0;
+    for (auto& buffer : m_buffers)
+        {
+        n += std::min<uint64_t>(buffer->head.load(std::memory_order_acquire), m_capacity);
+        }
+    return (unsigned int)n;
+    }
+
+namespace
+    {
+//! Write a string as a JSON string literal
+void writeJSONString(std::ostream& out, const char* s)
+    {
+    out << '"';
+    for (; *s; ++s)
+        {
+        if (*s == '"' || *s == '\\')
+            out << '\\';
+        out << *s;
+        }
+    out << '"';
+    }
+
+//! Write a complete event in the Chrome trace event format
+void writeCompleteEvent(std::ostream& out,
+                        const char* name,
+                        const char* category,
+                        double ts,
+                        double dur,
+                        unsigned int pid,
+                        unsigned int tid)
+    {
+    out << ",\n{\"ph\":\"X\",\"name\":";
+    writeJSONString(out, name);
+    out << ",\"cat\":";
+    writeJSONString(out, category);
+    out << ",\"ts\":" << ts << ",\"dur\":" << dur << ",\"pid\":" << pid << ",\"tid\":" << tid
+        << "}";
+    }
+
+//! Write a metadata event that names a process or thread
+void writeNameEvent(std::ostream& out,
+                    const char* kind,
+                    const std::string& name,
+                    unsigned int pid,
+                    unsigned int tid)
+    {
+    out << ",\n{\"ph\":\"M\",\"name\":\"" << kind << "\",\"pid\":" << pid << ",\"tid\":" << tid
+        << ",\"args\":{\"name\":";
+    writeJSONString(out, name.c_str());
+    out << "}}";
+    }
+    } // end anonymous namespace
+
+/*! \param filename File to write
+    \param rank MPI rank (used as the process id in the trace)
+
+    Timestamps are in microseconds since the construction of the tracer. Each thread's spans are
+    written to a separate track. When GPU events are enabled, the GPU time of each span is written
+    to a second track per thread. Spans that are still open are not written.
+
+    Writing the trace synchronizes the GPU when GPU events are enabled.
+*/
+void Tracer::writeChromeTrace(const std::string& filename, unsigned int rank)
+    {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::ofstream out(filename);
+    if (!out.good())
+        {
+        throw std::runtime_error("Unable to open trace file " + filename);
+        }
+    out << std::fixed << std::setprecision(3);
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    out << "{\"ph\":\"M\",\"name\":\"process_sort_index\",\"pid\":" << rank
+        << ",\"args\":{\"sort_index\":" << rank << "}}";
+    writeNameEvent(out, "process_name", "rank " + std::to_string(rank), rank, 0);
+
+#ifdef ENABLE_HIP
+    if (m_gpu_events)
+        hipDeviceSynchronize();
+#endif
+
+    for (auto& buffer : m_buffers)
+        {
+        const unsigned int tid = buffer->thread_id;
+        const unsigned int gpu_tid = (unsigned int)m_buffers.size() + tid;
+        writeNameEvent(out, "thread_name", "thread " + std::to_string(tid), rank, tid);
+#ifdef ENABLE_HIP
+        if (m_gpu_events)
+            writeNameEvent(out, "thread_name", "GPU " + std::to_string(tid), rank, gpu_tid);
+#endif
+
+        uint64_t head = buffer->head.load(std::memory_order_acquire);
+        uint64_t first = head > m_capacity ? head - m_capacity : 0;
+        for (uint64_t slot = first; slot < head; ++slot)
+            {
+            const Event& event = buffer->events[slot % m_capacity];
+            if (event.end < 0)
+                continue;
+
+            writeCompleteEvent(out,
+                               event.name,
+                               event.category,
+                               double(event.start) / 1e3,
+                               double(event.end - event.start) / 1e3,
+                               rank,
+                               tid);
+
+#ifdef ENABLE_HIP
+            if (m_gpu_events)
+                {
+                float gpu_start = 0, gpu_end = 0;
+                const unsigned int i = (unsigned int)(slot % m_capacity);
+                hipEventElapsedTime(&gpu_start, m_gpu_reference, buffer->gpu_start[i]);
+                hipEventElapsedTime(&gpu_end, m_gpu_reference, buffer->gpu_end[i]);
+                if (gpu_end > gpu_start)
+                    {
+                    writeCompleteEvent(out,
+                                       event.name,
+                                       event.category,
+                                       double(m_gpu_reference_time) / 1e3 + gpu_start * 1e3,
+                                       (gpu_end - gpu_start) * 1e3,
+                                       rank,
+                                       gpu_tid);
+                    }
+                }
+#endif
+            }
+        }
+
+    out << "\n]}\n";
+    }
+
+namespace detail
+    {
+void export_Tracer(pybind11::module& m)
+    {
+    pybind11::class_<Tracer>(m, "Tracer")
+        .def("start", &Tracer::start)
+        .def("stop", &Tracer::stop)
+        .def("isEnabled", &Tracer::isEnabled)
+        .def("gpuEventsEnabled", &Tracer::gpuEventsEnabled)
+        .def("getCapacity", &Tracer::getCapacity)
+        .def("getNumEvents", &Tracer::getNumEvents)
+        .def("writeChromeTrace", &Tracer::writeChromeTrace);
+    }
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -0,0 +1,211 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file Tracer.h
+    \brief Declares the Tracer and ScopedTrace classes
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#ifndef __TRACER_H__
+#define __TRACER_H__
+
+#include "ClockSource.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#ifdef ENABLE_HIP
+#include <hip/hip_runtime.h>
+#endif
+
+namespace hoomd
+    {
+//! Records the time spent in the stages of the run loop
+/*! Tracer records spans of wall clock time (and optionally GPU time) that ScopedTrace markers
+    place around computes, updaters, communication phases, autotuner scans, and MPCD stages.
+    The trace is written in the Chrome trace event format, which chrome://tracing and
+    https://ui.perfetto.dev display as a timeline.
+
+    Each thread that records events owns a ring buffer of fixed capacity. A thread registers its
+    buffer once (under a lock) and then records events without locking or allocating memory.
+    When a buffer is full, new events overwrite the oldest ones.
+
+    Tracing is disabled by default. When disabled, a ScopedTrace costs one branch. Call start()
+    and stop() between runs; they must not be called while another thread records events.
+
+    When HOOMD is built with ENABLE_NVTOOLS (or ENABLE_ROCTRACER on AMD GPUs), enabled tracers
+    also push NVTX (or ROCTX) ranges so that external profilers show the same markers.
+
+    \ingroup utils
+*/
+class PYBIND11_EXPORT Tracer
+    {
+    public:
+    //! A recorded span of time
+    struct Event
+        {
+        const char* name;     //!< Name of the span (interned)
+        const char* category; //!< Category of the span (a string literal)
+        int64_t start;        //!< Start time in nanoseconds
+        int64_t end;          //!< End time in nanoseconds, -1 until the span closes
+        };
+
+    //! Construct a disabled tracer
+    /*! \param gpu True when the execution configuration runs on the GPU
+     */
+    Tracer(bool gpu);
+
+    //! Destructor
+    ~Tracer();
+
+    //! Enable tracing
+    void start(unsigned int capacity, bool gpu_events);
+
+    //! Disable tracing (recorded events remain available to write)
+    void stop();
+
+    //! Test if tracing is enabled
+    bool isEnabled() const
+        {
+        return m_enabled;
+        }
+
+    //! Test if GPU events are recorded
+    bool gpuEventsEnabled() const
+        {
+        return m_gpu_events;
+        }
+
+    //! Get the capacity of each thread's buffer
+    unsigned int getCapacity() const
+        {
+        return m_capacity;
+        }
+
+    //! Get the current time in nanoseconds
+    int64_t getTime() const
+        {
+        return m_clock.getTime();
+        }
+
+    //! Get a name with a lifetime that matches the tracer
+    const char* intern(const std::string& name);
+
+    //! Get the human readable name of a type
+    const char* getTypeName(const std::type_info& type);
+
+    //! Open a span
+    uint64_t begin(const char* name, const char* category);
+
+    //! Close a span opened by begin()
+    void end(uint64_t slot);
+
+    //! Record a span that has already completed
+    void record(const char* name, const char* category, int64_t start, int64_t end);
+
+    //! Get the number of recorded events (including incomplete ones)
+    unsigned int getNumEvents();
+
+    //! Write the trace in the Chrome trace event format
+    void writeChromeTrace(const std::string& filename, unsigned int rank);
+
+    private:
+    //! Events recorded by one thread
+    struct ThreadBuffer
+        {
+        std::vector<Event> events;     //!< Ring buffer of events
+        std::atomic<uint64_t> head{0}; //!< Number of slots reserved since start()
+        unsigned int thread_id = 0;    //!< Index of the thread that owns the buffer
+#ifdef ENABLE_HIP
+        std::vector<hipEvent_t> gpu_start; //!< GPU event recorded when each span opens
+        std::vector<hipEvent_t> gpu_end;   //!< GPU event recorded when each span closes
+#endif
+        };
+
+    ClockSource m_clock;                   //!< Source of the timestamps
+    bool m_gpu;                            //!< True when running on the GPU
+    bool m_enabled = false;                //!< True when tracing is enabled
+    bool m_gpu_events = false;             //!< True when GPU events are recorded
+    unsigned int m_capacity = 0;           //!< Capacity of each thread buffer
+    uint64_t m_generation = 0;             //!< Identifies the buffers created by start()
+    static std::atomic<uint64_t> s_generation; //!< Source of unique generations
+
+    std::mutex m_mutex;                                  //!< Protects the members below
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers; //!< Per-thread buffers
+    std::unordered_set<std::string> m_names;             //!< Interned names
+    std::unordered_map<std::type_index, const char*> m_type_names; //!< Demangled type names
+
+#ifdef ENABLE_HIP
+    hipEvent_t m_gpu_reference;      //!< GPU event recorded at start()
+    int64_t m_gpu_reference_time = 0; //!< Time at which m_gpu_reference was recorded
+#endif
+
+    //! Get the buffer of the calling thread
+    ThreadBuffer& getThreadBuffer();
+
+    //! Free the per-thread buffers
+    void freeBuffers();
+    };
+
+//! Records a span of time while in scope
+/*! Place a ScopedTrace at the start of the block to trace:
+    \code
+    ScopedTrace trace(m_exec_conf->getTracer(), typeid(*this), "updater");
+    \endcode
+
+    The name must be a string literal, a name returned by Tracer::intern, or a type.
+*/
+class ScopedTrace
+    {
+    public:
+    //! Open a span with the given name
+    ScopedTrace(Tracer& tracer, const char* name, const char* category)
+        : m_tracer(tracer), m_enabled(tracer.isEnabled())
+        {
+        if (m_enabled)
+            m_slot = m_tracer.begin(name, category);
+        }
+
+    //! Open a span named after a type
+    ScopedTrace(Tracer& tracer, const std::type_info& type, const char* category)
+        : m_tracer(tracer), m_enabled(tracer.isEnabled())
+        {
+        if (m_enabled)
+            m_slot = m_tracer.begin(m_tracer.getTypeName(type), category);
+        }
+
+    //! Close the span
+    ~ScopedTrace()
+        {
+        if (m_enabled)
+            m_tracer.end(m_slot);
+        }
+
+    ScopedTrace(const ScopedTrace&) = delete;
+    ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+    private:
+    Tracer& m_tracer;        //!< The tracer to record to
+    bool m_enabled;          //!< True when the tracer was enabled when the span opened
+    uint64_t m_slot = 0;     //!< Slot of the span in the thread's buffer
+    };
+
+namespace detail
+    {
+//! Exports the Tracer class to python
+void export_Tracer(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace hoomd
+
+#endif
@@ -7,6 +7,8 @@
 
 namespace hoomd
     {
+uint64_t Trigger::s_schedule_generation = 0;
+
 //* Trampoline for classes inherited in python
 class TriggerPy : public Trigger
     {
@@ -23,6 +25,43 @@ class TriggerPy : public Trigger
                                timestep // Argument(s)
         );
         }
+
+    // trampoline method
+    uint64_t getNextTimestep(uint64_t timestep) override
+        {
+        // look up the override once, so that subclasses without it do not pay for the lookup
+        // after every call to compute
+        if (!m_checked_next_timestep)
+            {
+            pybind11::gil_scoped_acquire acquire;
+            m_has_next_timestep
+                = bool(pybind11::get_overload(static_cast<const Trigger*>(this), "next_timestep"));
+            m_checked_next_timestep = true;
+            }
+        if (!m_has_next_timestep)
+            {
+            return Trigger::getNextTimestep(timestep);
+            }
+
+        // the run loop relies on the next time step not preceding timestep
+        pybind11::gil_scoped_acquire acquire;
+        pybind11::function override
+            = pybind11::get_overload(static_cast<const Trigger*>(this), "next_timestep");
+        return std::max(timestep, override(timestep).cast<uint64_t>());
+        }
+
+    private:
+    /// True after the python override of getNextTimestep has been looked up
+    bool m_checked_next_timestep = false;
+    /// True when the python subclass overrides getNextTimestep
+    bool m_has_next_timestep = false;
+    };
+
+//* Exposes the protected methods of Trigger to python subclasses
+class TriggerPublicist : public Trigger
+    {
+    public:
+    using Trigger::invalidateSchedule;
     };
 
 namespace detail
@@ -38,7 +77,10 @@ void export_Trigger(pybind11::module& m)
     pybind11::class_<Trigger, TriggerPy, std::shared_ptr<Trigger>>(m, "Trigger")
         .def(pybind11::init<>())
         .def("__call__", &Trigger::operator())
-        .def("compute", &Trigger::compute);
+        .def("isDeterministic", &Trigger::isDeterministic)
+        .def("next_timestep", &Trigger::getNextTimestep)
+        .def("compute", &Trigger::compute)
+        .def("invalidate_schedule", &TriggerPublicist::invalidateSchedule);
 
     pybind11::class_<PeriodicTrigger, Trigger, std::shared_ptr<PeriodicTrigger>>(m,
                                                                                  "PeriodicTrigger")
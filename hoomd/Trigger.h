@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <pybind11/iostream.h>
 #include <pybind11/pybind11.h>
@@ -25,7 +26,7 @@ class PYBIND11_EXPORT Trigger
     {
     public:
     /// Construct a Trigger
-    Trigger() : m_last_timestep(-1), m_last_trigger(false) { }
+    Trigger() : m_last_timestep(-1), m_last_trigger(false), m_skip_begin(0), m_skip_end(0) { }
 
     virtual ~Trigger() { }
 
@@ -33,28 +34,102 @@ class PYBIND11_EXPORT Trigger
      *
      *  @param timestep Time step to query
      *  @returns `true` if the operation should occur, `false` if not
+     *
+     *  After each call to compute(), the trigger asks getNextTimestep() for the next time step on
+     *  which it may activate, and skips compute() on the time steps before it.
      */
     bool operator()(uint64_t timestep)
         {
+        // a trigger changed its parameters, possibly one that this trigger combines
+        if (m_schedule_generation != s_schedule_generation)
+            {
+            clearSchedule();
+            }
+
         if (m_last_timestep == timestep)
             {
             return m_last_trigger;
             }
-        else
+
+        m_last_timestep = timestep;
+        if (timestep >= m_skip_begin && timestep < m_skip_end)
             {
-            m_last_timestep = timestep;
-            m_last_trigger = compute(timestep);
+            m_last_trigger = false;
             return m_last_trigger;
             }
+
+        m_last_trigger = compute(timestep);
+        if (timestep < std::numeric_limits<uint64_t>::max())
+            {
+            m_skip_begin = timestep + 1;
+            m_skip_end = getNextTimestep(m_skip_begin);
+            }
+        return m_last_trigger;
         }
 
     virtual bool compute(uint64_t timestep) = 0;
 
+    /** Find the next time step on which the trigger may activate
+     *
+     *  @param timestep First time step to consider
+     *  @returns A time step no later than the first time step at or after *timestep* on which the
+     *      trigger activates, or the largest time step when it never activates again.
+     *
+     *  The run loop does not evaluate the trigger on the time steps before the one returned, so the
+     *  result may only depend on the time step. Returning *timestep* is always valid.
+     */
+    virtual uint64_t getNextTimestep(uint64_t timestep)
+        {
+        return timestep;
+        }
+
+    /** Test whether the trigger depends only on the time step
+     *
+     *  @returns `true` when compute() is a function of the time step alone that does not call into
+     *      Python. The run loop evaluates such triggers ahead of time. Python subclasses are never
+     *      deterministic.
+     */
+    virtual bool isDeterministic() const
+        {
+        return false;
+        }
+
+    protected:
+    /** Discard the cached schedule
+     *
+     *  Call after changing a parameter that changes when the trigger activates. This clears the
+     *  skipped time steps and the result cached for the last time step. Triggers that combine this
+     *  one discard their caches before their next evaluation.
+     */
+    void invalidateSchedule()
+        {
+        ++s_schedule_generation;
+        clearSchedule();
+        }
+
     private:
+    /// Clear the cached results and mark them current with the schedule generation
+    void clearSchedule()
+        {
+        m_last_timestep = std::numeric_limits<uint64_t>::max();
+        m_skip_begin = 0;
+        m_skip_end = 0;
+        m_schedule_generation = s_schedule_generation;
+        }
+
+    /// Incremented whenever a trigger invalidates its schedule
+    static uint64_t s_schedule_generation;
+
+    /// Value of s_schedule_generation when the cached results were computed
+    uint64_t m_schedule_generation = s_schedule_generation;
     /// Caches the last time step at which the trigger was computed
     uint64_t m_last_timestep;
     /// Caches whether the trigger was activated on m_last_timestep
     bool m_last_trigger;
+    /// First time step on which the trigger is known to be inactive
+    uint64_t m_skip_begin;
+    /// Time step after the last one on which the trigger is known to be inactive
+    uint64_t m_skip_end;
     };
 
 /** Periodic trigger
@@ -83,10 +158,38 @@ class PYBIND11_EXPORT PeriodicTrigger : public Trigger
         return (timestep - m_phase) % m_period == 0;
         }
 
+    uint64_t getNextTimestep(uint64_t timestep)
+        {
+        const uint64_t remainder = (timestep - m_phase) % m_period;
+        if (remainder == 0)
+            {
+            return timestep;
+            }
+
+        // the difference to the phase wraps around below the phase, so the phase itself may come
+        // first
+        const uint64_t delta = m_period - remainder;
+        if (timestep < m_phase && m_phase - timestep <= delta)
+            {
+            return m_phase;
+            }
+        if (delta > std::numeric_limits<uint64_t>::max() - timestep)
+            {
+            return std::numeric_limits<uint64_t>::max();
+            }
+        return timestep + delta;
+        }
+
+    bool isDeterministic() const
+        {
+        return true;
+        }
+
     /// Set the period
     void setPeriod(uint64_t period)
         {
         m_period = period;
+        invalidateSchedule();
         }
 
     /// Get the period
@@ -99,6 +202,7 @@ class PYBIND11_EXPORT PeriodicTrigger : public Trigger
     void setPhase(uint64_t phase)
         {
         m_phase = phase;
+        invalidateSchedule();
         }
 
     /// Get the phase
@@ -128,6 +232,16 @@ class PYBIND11_EXPORT BeforeTrigger : public Trigger
         return timestep < m_timestep;
         }
 
+    uint64_t getNextTimestep(uint64_t timestep)
+        {
+        return (timestep < m_timestep) ? timestep : std::numeric_limits<uint64_t>::max();
+        }
+
+    bool isDeterministic() const
+        {
+        return true;
+        }
+
     /// Get the timestep before which the trigger is active.
     uint64_t getTimestep() const
         {
@@ -140,6 +254,7 @@ class PYBIND11_EXPORT BeforeTrigger : public Trigger
         setTimestep(uint64_t timestep)
         {
         m_timestep = timestep;
+        invalidateSchedule();
         }
 
     protected:
@@ -160,6 +275,16 @@ class PYBIND11_EXPORT OnTrigger : public Trigger
         return timestep == m_timestep;
         }
 
+    uint64_t getNextTimestep(uint64_t timestep)
+        {
+        return (timestep <= m_timestep) ? m_timestep : std::numeric_limits<uint64_t>::max();
+        }
+
+    bool isDeterministic() const
+        {
+        return true;
+        }
+
     /// Get the timestep when the trigger is active.
     uint64_t getTimestep() const
         {
@@ -172,6 +297,7 @@ class PYBIND11_EXPORT OnTrigger : public Trigger
         setTimestep(uint64_t timestep)
         {
         m_timestep = timestep;
+        invalidateSchedule();
         }
 
     protected:
@@ -192,6 +318,20 @@ class PYBIND11_EXPORT AfterTrigger : public Trigger
         return timestep > m_timestep;
         }
 
+    uint64_t getNextTimestep(uint64_t timestep)
+        {
+        if (timestep > m_timestep || m_timestep == std::numeric_limits<uint64_t>::max())
+            {
+            return std::max(timestep, m_timestep);
+            }
+        return m_timestep + 1;
+        }
+
+    bool isDeterministic() const
+        {
+        return true;
+        }
+
     /// Get the timestep after which the trigger is active.
     uint64_t getTimestep() const
         {
@@ -204,6 +344,7 @@ class PYBIND11_EXPORT AfterTrigger : public Trigger
         setTimestep(uint64_t timestep)
         {
         m_timestep = timestep;
+        invalidateSchedule();
         }
 
     protected:
@@ -224,6 +365,11 @@ class PYBIND11_EXPORT NotTrigger : public Trigger
         return !(m_trigger->operator()(timestep));
         }
 
+    bool isDeterministic() const
+        {
+        return m_trigger->isDeterministic();
+        }
+
     /// Get the trigger that is negated
     std::shared_ptr<Trigger> getTrigger() const
         {
@@ -234,6 +380,7 @@ class PYBIND11_EXPORT NotTrigger : public Trigger
     void setTrigger(std::shared_ptr<Trigger> trigger)
         {
         m_trigger = trigger;
+        invalidateSchedule();
         }
 
     protected:
@@ -266,12 +413,45 @@ class PYBIND11_EXPORT AndTrigger : public Trigger
                            { return t->operator()(timestep); });
         }
 
+    /** Find the next time step on which the trigger may activate
+     *
+     *  All triggers activate together no earlier than the latest of their next time steps. The
+     *  search is repeated from there a limited number of times.
+     */
+    uint64_t getNextTimestep(uint64_t timestep)
+        {
+        for (unsigned int i = 0; i < max_search; ++i)
+            {
+            uint64_t next = timestep;
+            for (auto& t : m_triggers)
+                {
+                next = std::max(next, t->getNextTimestep(timestep));
+                }
+            if (next == timestep)
+                {
+                break;
+                }
+            timestep = next;
+            }
+        return timestep;
+        }
+
+    bool isDeterministic() const
+        {
+        return std::all_of(m_triggers.begin(),
+                           m_triggers.end(),
+                           [](const std::shared_ptr<Trigger>& t) { return t->isDeterministic(); });
+        }
+
     const std::vector<std::shared_ptr<Trigger>>& getTriggers() const
         {
         return m_triggers;
         }
 
     protected:
+    /// Maximum number of times to repeat the search for the next time step
+    static const unsigned int max_search = 16;
+
     /// Vector of triggers to do a n-way AND
     std::vector<std::shared_ptr<Trigger>> m_triggers;
     };
@@ -302,6 +482,23 @@ class PYBIND11_EXPORT OrTrigger : public Trigger
                            { return t->operator()(timestep); });
         }
 
+    uint64_t getNextTimestep(uint64_t timestep)
+        {
+        uint64_t next = std::numeric_limits<uint64_t>::max();
+        for (auto& t : m_triggers)
+            {
+            next = std::min(next, t->getNextTimestep(timestep));
+            }
+        return next;
+        }
+
+    bool isDeterministic() const
+        {
+        return std::all_of(m_triggers.begin(),
+                           m_triggers.end(),
+                           [](const std::shared_ptr<Trigger>& t) { return t->isDeterministic(); });
+        }
+
     const std::vector<std::shared_ptr<Trigger>>& getTriggers() const
         {
         return m_triggers;
@@ -0,0 +1,162 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "UpdaterRemoveDriftGPU.cuh"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#include <hipcub/hipcub.hpp>
+#pragma GCC diagnostic pop
+
+/*! \file UpdaterRemoveDriftGPU.cu
+    \brief Defines GPU kernel code for UpdaterRemoveDriftGPU
+*/
+
+namespace hoomd
+    {
+namespace kernel
+    {
+//! Kernel to compute the displacement of each particle from its reference position
+/*! \param d_displacement Displacements of the particles (output)
+    \param d_postype Particle positions
+    \param d_tag Particle tags
+    \param d_ref_positions Reference positions indexed by tag
+    \param box Global simulation box
+    \param origin Origin of the particle positions
+    \param N Number of local particles
+
+    The position is unwrapped from the origin and wrapped into the box before the minimum image
+    of the displacement is taken, like in UpdaterRemoveDrift.
+*/
+__global__ void gpu_remove_drift_displacement_kernel(Scalar3* d_displacement,
+                                                     const Scalar4* d_postype,
+                                                     const unsigned int* d_tag,
+                                                     const Scalar3* d_ref_positions,
+                                                     const BoxDim box,
+                                                     const Scalar3 origin,
+                                                     const unsigned int N)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    const Scalar4 postype = d_postype[idx];
+    Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z) - origin;
+    int3 image = make_int3(0, 0, 0);
+    box.wrap(pos, image);
+    d_displacement[idx] = box.minImage(pos - d_ref_positions[d_tag[idx]]);
+    }
+
+//! Kernel to shift the particles by the mean drift and wrap them into the box
+/*! \param d_postype Particle positions
+    \param d_image Particle images
+    \param box Global simulation box
+    \param shift Mean drift to subtract
+    \param N Number of local particles
+*/
+__global__ void gpu_remove_drift_shift_kernel(Scalar4* d_postype,
+                                              int3* d_image,
+                                              const BoxDim box,
+                                              const Scalar3 shift,
+                                              const unsigned int N)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    Scalar4 postype = d_postype[idx];
+    postype.x -= shift.x;
+    postype.y -= shift.y;
+    postype.z -= shift.z;
+    int3 image = d_image[idx];
+    box.wrap(postype, image);
+    d_postype[idx] = postype;
+    d_image[idx] = image;
+    }
+
+hipError_t gpu_remove_drift_displacement(Scalar3* d_displacement,
+                                         const Scalar4* d_postype,
+                                         const unsigned int* d_tag,
+                                         const Scalar3* d_ref_positions,
+                                         const BoxDim& box,
+                                         const Scalar3 origin,
+                                         const unsigned int N,
+                                         const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_remove_drift_displacement_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid((N / run_block_size) + 1, 1, 1);
+    dim3 threads(run_block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_remove_drift_displacement_kernel),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       d_displacement,
+                       d_postype,
+                       d_tag,
+                       d_ref_positions,
+                       box,
+                       origin,
+                       N);
+
+    return hipSuccess;
+    }
+
+/*! \param d_sum Sum of the displacements (output on second call)
+    \param d_tmp Temporary storage for the reduction (output on first call)
+    \param tmp_bytes Number of bytes of temporary storage (output on first call)
+    \param d_displacement Displacements of the particles
+    \param N Number of local particles
+
+    This is a wrapper to hipcub::DeviceReduce::Sum, and as such requires two calls. The first call
+    sizes the temporary storage, which the caller must then allocate into \a d_tmp before calling
+    a second time.
+*/
+hipError_t gpu_remove_drift_sum(Scalar3* d_sum,
+                                void* d_tmp,
+                                size_t& tmp_bytes,
+                                const Scalar3* d_displacement,
+                                const unsigned int N)
+    {
+    hipcub::DeviceReduce::Sum(d_tmp, tmp_bytes, d_displacement, d_sum, N);
+    return hipSuccess;
+    }
+
+hipError_t gpu_remove_drift_shift(Scalar4* d_postype,
+                                  int3* d_image,
+                                  const BoxDim& box,
+                                  const Scalar3 shift,
+                                  const unsigned int N,
+                                  const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_remove_drift_shift_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid((N / run_block_size) + 1, 1, 1);
+    dim3 threads(run_block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_remove_drift_shift_kernel),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       d_postype,
+                       d_image,
+                       box,
+                       shift,
+                       N);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace hoomd
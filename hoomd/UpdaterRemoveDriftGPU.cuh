@@ -0,0 +1,46 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/ParticleData.cuh"
+
+#ifndef _REMOVE_DRIFT_UPDATER_GPU_CUH_
+#define _REMOVE_DRIFT_UPDATER_GPU_CUH_
+
+/*! \file UpdaterRemoveDriftGPU.cuh
+    \brief Declares GPU kernel code for UpdaterRemoveDriftGPU
+*/
+
+namespace hoomd
+    {
+namespace kernel
+    {
+//! Kernel driver to compute the displacement of each particle from its reference position
+hipError_t gpu_remove_drift_displacement(Scalar3* d_displacement,
+                                         const Scalar4* d_postype,
+                                         const unsigned int* d_tag,
+                                         const Scalar3* d_ref_positions,
+                                         const BoxDim& box,
+                                         const Scalar3 origin,
+                                         const unsigned int N,
+                                         const unsigned int block_size);
+
+//! Sum the displacements of the particles
+hipError_t gpu_remove_drift_sum(Scalar3* d_sum,
+                                void* d_tmp,
+                                size_t& tmp_bytes,
+                                const Scalar3* d_displacement,
+                                const unsigned int N);
+
+//! Kernel driver to shift the particles by the mean drift and wrap them into the box
+hipError_t gpu_remove_drift_shift(Scalar4* d_postype,
+                                  int3* d_image,
+                                  const BoxDim& box,
+                                  const Scalar3 shift,
+                                  const unsigned int N,
+                                  const unsigned int block_size);
+
+    } // end namespace kernel
+    } // end namespace hoomd
+
+#endif // _REMOVE_DRIFT_UPDATER_GPU_CUH_
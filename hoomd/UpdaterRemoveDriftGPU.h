@@ -0,0 +1,213 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file UpdaterRemoveDriftGPU.h
+    \brief Declares an updater that removes the average drift from the particles on the GPU
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#ifndef _REMOVE_DRIFT_UPDATER_GPU_H_
+#define _REMOVE_DRIFT_UPDATER_GPU_H_
+
+#include "hoomd/Autotuner.h"
+#include "hoomd/CachedAllocator.h"
+#include "hoomd/GPUArray.h"
+#include "hoomd/GPUFlags.h"
+#include "hoomd/UpdaterRemoveDrift.h"
+#include "hoomd/UpdaterRemoveDriftGPU.cuh"
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+/** Removes the average particle drift from the reference positions on the GPU.
+ * The reference positions are kept on the device. The displacements are summed with a device
+ * reduction, so only the mean drift is copied to the host (and reduced across ranks) before the
+ * particles are shifted in place.
+ */
+class UpdaterRemoveDriftGPU : public UpdaterRemoveDrift
+    {
+    public:
+    //! Constructor
+    UpdaterRemoveDriftGPU(std::shared_ptr<SystemDefinition> sysdef,
+                          std::shared_ptr<Trigger> trigger,
+                          pybind11::array_t<double> ref_positions)
+        : UpdaterRemoveDrift(sysdef, trigger, ref_positions), m_sum(m_exec_conf)
+        {
+        if (!m_exec_conf->isCUDAEnabled())
+            {
+            throw std::runtime_error("Cannot initialize UpdaterRemoveDriftGPU on a CPU device.");
+            }
+
+        copyReferencePositions();
+
+        m_tuner_displacement.reset(
+            new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                             m_exec_conf,
+                             "remove_drift_displacement"));
+        m_tuner_shift.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                             m_exec_conf,
+                                             "remove_drift_shift"));
+        m_autotuners.insert(m_autotuners.end(), {m_tuner_displacement, m_tuner_shift});
+        }
+
+    //! Set reference positions from a (N_particles, 3) numpy array
+    void setReferencePositions(const pybind11::array_t<double> ref_pos)
+        {
+        UpdaterRemoveDrift::setReferencePositions(ref_pos);
+        copyReferencePositions();
+        }
+
+    //! Take one timestep forward
+    virtual void update(uint64_t timestep)
+        {
+        const unsigned int N = this->m_pdata->getN();
+        const BoxDim box = this->m_pdata->getGlobalBox();
+        Scalar3 rshift = make_scalar3(0, 0, 0);
+
+        if (N > 0)
+            {
+            if (m_displacement.getNumElements() < N)
+                {
+                GPUArray<Scalar3> displacement(N, m_exec_conf);
+                m_displacement.swap(displacement);
+                }
+
+            ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
+                                           access_location::device,
+                                           access_mode::read);
+            ArrayHandle<unsigned int> d_tag(this->m_pdata->getTags(),
+                                            access_location::device,
+                                            access_mode::read);
+            ArrayHandle<Scalar3> d_ref_positions(m_ref_positions_gpu,
+                                                 access_location::device,
+                                                 access_mode::read);
+            ArrayHandle<Scalar3> d_displacement(m_displacement,
+                                                access_location::device,
+                                                access_mode::overwrite);
+
+            m_tuner_displacement->begin();
+            kernel::gpu_remove_drift_displacement(d_displacement.data,
+                                                  d_postype.data,
+                                                  d_tag.data,
+                                                  d_ref_positions.data,
+                                                  box,
+                                                  this->m_pdata->getOrigin(),
+                                                  N,
+                                                  m_tuner_displacement->getParam()[0]);
+            if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            m_tuner_displacement->end();
+
+            void* d_tmp = NULL;
+            size_t tmp_bytes = 0;
+            kernel::gpu_remove_drift_sum(m_sum.getDeviceFlags(),
+                                         d_tmp,
+                                         tmp_bytes,
+                                         d_displacement.data,
+                                         N);
+            ScopedAllocation<unsigned char> d_tmp_alloc(m_exec_conf->getCachedAllocator(),
+                                                        (tmp_bytes > 0) ? tmp_bytes : 1);
+            d_tmp = (void*)d_tmp_alloc();
+            kernel::gpu_remove_drift_sum(m_sum.getDeviceFlags(),
+                                         d_tmp,
+                                         tmp_bytes,
+                                         d_displacement.data,
+                                         N);
+            if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+
+            rshift = m_sum.readFlags();
+            }
+
+#ifdef ENABLE_MPI
+        if (this->m_pdata->getDomainDecomposition())
+            {
+            Scalar r[3] = {rshift.x, rshift.y, rshift.z};
+            MPI_Allreduce(MPI_IN_PLACE,
+                          &r[0],
+                          3,
+                          MPI_HOOMD_SCALAR,
+                          MPI_SUM,
+                          m_exec_conf->getMPICommunicator());
+            rshift.x = r[0];
+            rshift.y = r[1];
+            rshift.z = r[2];
+            }
+#endif
+
+        rshift /= Scalar(this->m_pdata->getNGlobal());
+
+        if (N > 0)
+            {
+            ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
+                                           access_location::device,
+                                           access_mode::readwrite);
+            ArrayHandle<int3> d_image(this->m_pdata->getImages(),
+                                      access_location::device,
+                                      access_mode::readwrite);
+
+            m_tuner_shift->begin();
+            kernel::gpu_remove_drift_shift(d_postype.data,
+                                           d_image.data,
+                                           box,
+                                           rshift,
+                                           N,
+                                           m_tuner_shift->getParam()[0]);
+            if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            m_tuner_shift->end();
+            }
+        }
+
+    protected:
+    GPUArray<Scalar3> m_ref_positions_gpu; //!< Reference positions indexed by tag
+    GPUArray<Scalar3> m_displacement;      //!< Displacements of the local particles
+    GPUFlags<Scalar3> m_sum;               //!< Sum of the displacements
+
+    /// Autotuner for block size (displacement kernel).
+    std::shared_ptr<Autotuner<1>> m_tuner_displacement;
+    /// Autotuner for block size (shift kernel).
+    std::shared_ptr<Autotuner<1>> m_tuner_shift;
+
+    //! Copy the reference positions to the device
+    void copyReferencePositions()
+        {
+        GPUArray<Scalar3> ref_positions(m_ref_positions.size(), m_exec_conf);
+            {
+            ArrayHandle<Scalar3> h_ref_positions(ref_positions,
+                                                 access_location::host,
+                                                 access_mode::overwrite);
+            for (size_t i = 0; i < m_ref_positions.size(); i++)
+                {
+                h_ref_positions.data[i] = vec_to_scalar3(m_ref_positions[i]);
+                }
+            }
+        m_ref_positions_gpu.swap(ref_positions);
+        }
+    };
+
+namespace detail
+    {
+/// Export the UpdaterRemoveDriftGPU to python
+void export_UpdaterRemoveDriftGPU(pybind11::module& m)
+    {
+    pybind11::class_<UpdaterRemoveDriftGPU,
+                     UpdaterRemoveDrift,
+                     std::shared_ptr<UpdaterRemoveDriftGPU>>(m, "UpdaterRemoveDriftGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            pybind11::array_t<double>>())
+        .def_property("reference_positions",
+                      &UpdaterRemoveDriftGPU::getReferencePositions,
+                      &UpdaterRemoveDriftGPU::setReferencePositions);
+    }
+
+    } // end namespace detail
+
+    } // end namespace hoomd
+
+#endif // _REMOVE_DRIFT_UPDATER_GPU_H_
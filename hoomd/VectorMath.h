@@ -701,6 +701,7 @@ template<class Real> struct rotmat3;
         - norm2(quat)
         - conj(quat)
         - rotate(quat, vec3)
+        - rotate_batch(quat, x, y, z, n) (host only)
 
     For more info on this representation and its relation to rotation, see:
     http://people.csail.mit.edu/bkph/articles/Quaternions.pdf
@@ -984,6 +985,44 @@ template<class Real> DEVICE inline vec2<Real> rotate(const quat<Real>& a, const
     return vec2<Real>(b3.x, b3.y);
     }
 
+#ifndef __HIPCC__
+//! rotate a batch of vec3s by the same quaternion
+/*! \param a quat (should be a unit quaternion (Cos(theta/2), Sin(theta/2)*axis_unit_vector))
+    \param x x components of the vectors, updated in place
+    \param y y components of the vectors, updated in place
+    \param z z components of the vectors, updated in place
+    \param n Number of vectors
+
+    Gives the same result as rotate(a, b) for every vector. The vectors are given as separate
+    arrays, and the rotation is expanded once into a matrix, so every vector costs 9 multiply-adds
+    and the loop over the vectors vectorizes.
+*/
+template<class Real>
+inline void rotate_batch(const quat<Real>& a, Real* x, Real* y, Real* z, unsigned int n)
+    {
+    // (a.s^2 - a.v.a.v) b + 2 a.s (a.v x b) + 2 (a.v.b) a.v, as a matrix
+    const Real d = a.s * a.s - dot(a.v, a.v);
+    const Real two_s = Real(2) * a.s;
+    const Real xx = Real(2) * a.v.x * a.v.x, yy = Real(2) * a.v.y * a.v.y;
+    const Real zz = Real(2) * a.v.z * a.v.z, xy = Real(2) * a.v.x * a.v.y;
+    const Real xz = Real(2) * a.v.x * a.v.z, yz = Real(2) * a.v.y * a.v.z;
+
+    const Real r00 = d + xx, r01 = xy - two_s * a.v.z, r02 = xz + two_s * a.v.y;
+    const Real r10 = xy + two_s * a.v.z, r11 = d + yy, r12 = yz - two_s * a.v.x;
+    const Real r20 = xz - two_s * a.v.y, r21 = yz + two_s * a.v.x, r22 = d + zz;
+
+    for (unsigned int i = 0; i < n; ++i)
+        {
+        const Real bx = x[i];
+        const Real by = y[i];
+        const Real bz = z[i];
+        x[i] = r00 * bx + r01 * by + r02 * bz;
+        y[i] = r10 * bx + r11 * by + r12 * bz;
+        z[i] = r20 * bx + r21 * by + r22 * bz;
+        }
+    }
+#endif
+
 //! Convenience function for converting a quat to a Scalar4
 /*! \param a quat to convert
     \returns a Scalar4 in hoomd format
@@ -27,6 +27,10 @@ methods, and variables in the API.
 * `hoomd.hpmc` - Hard particle Monte Carlo.
 * `hoomd.md` - Molecular dynamics.
 
+`hoomd` imports these subpackages (and loads their compiled extension modules)
+the first time that they are accessed, so scripts that do not use them start
+faster.
+
 See Also:
     Tutorial: :doc:`tutorial/00-Introducing-HOOMD-blue/00-index`
 
@@ -41,6 +45,7 @@ import sys
 import pathlib
 import os
 import signal
+import importlib
 
 if ((pathlib.Path(__file__).parent / 'CMakeLists.txt').exists()
         and 'SPHINX' not in os.environ):
@@ -75,20 +80,27 @@ from hoomd import _hoomd
 from hoomd import tune
 from hoomd import logging
 from hoomd import custom
-if version.md_built:
-    from hoomd import md
-if version.hpmc_built:
-    from hoomd import hpmc
 # if version.metal_built:
 #     from hoomd import metal
 # if version.mpcd_built:
 #     from hoomd import mpcd
 
 from hoomd.simulation import Simulation
+from hoomd.ensemble import Ensemble
 from hoomd.state import State
 from hoomd.operations import Operations
 from hoomd.snapshot import Snapshot
 
+_lazy_subpackages = {'md': version.md_built, 'hpmc': version.hpmc_built}
+
+
+def __getattr__(name):
+    """Import subpackages on first access."""
+    if _lazy_subpackages.get(name, False):
+        return importlib.import_module('hoomd.' + name)
+    raise AttributeError(f"module 'hoomd' has no attribute '{name}'")
+
+
 _default_excepthook = sys.excepthook
 
 
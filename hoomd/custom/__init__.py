@@ -7,6 +7,8 @@
 via an `Action` subclass that executes during the simulation's run loop.
 Use this to prototype new simulation methods in Python, analyze the system state
 while the simulation progresses, or write output to custom file formats.
+`DeviceAction` passes the local particle data to user GPU kernels without
+synchronizing the host with the device.
 
 See Also:
     `hoomd.tune.CustomTuner`
@@ -19,5 +21,6 @@ See Also:
 """
 
 from hoomd.custom.custom_action import Action, _InternalAction
+from hoomd.custom.device_action import DeviceAction
 from hoomd.custom.custom_operation import (CustomOperation,
                                            _InternalCustomOperation)
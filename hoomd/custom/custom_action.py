@@ -43,7 +43,8 @@ class Action(metaclass=_AbstractLoggable):
                     self.com = snapshot.particles.position.mean(axis=0)
 
     To request that HOOMD-blue compute virials, pressure, the rotational kinetic
-    energy, or the external field virial, set the flags attribute with the
+    energy, the external field virial, or the potential energy (see
+    `hoomd.Simulation.always_compute_energy`), set the flags attribute with the
     appropriate flags from the internal `Action.Flags` enumeration:
 
     .. code-block:: python
@@ -84,10 +85,12 @@ class Action(metaclass=_AbstractLoggable):
         * PRESSURE_TENSOR = 0
         * ROTATIONAL_KINETIC_ENERGY = 1
         * EXTERNAL_FIELD_VIRIAL = 2
+        * POTENTIAL_ENERGY = 3
         """
         PRESSURE_TENSOR = 0
         ROTATIONAL_KINETIC_ENERGY = 1
         EXTERNAL_FIELD_VIRIAL = 2
+        POTENTIAL_ENERGY = 3
 
     flags = []
     log_quantities = {}
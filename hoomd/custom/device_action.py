@@ -0,0 +1,148 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement DeviceAction.
+
+.. invisible-code-block: python
+
+    simulation = hoomd.util.make_example_simulation()
+"""
+
+from abc import abstractmethod
+
+import hoomd
+from hoomd.custom.custom_action import Action
+
+
+class DeviceAction(Action):
+    """Base class for user-defined actions that launch GPU kernels.
+
+    `DeviceAction` hands the local particle data to user code on the GPU
+    without synchronizing the host with the device. Subclass `DeviceAction` and
+    implement :meth:`~.launch` to enqueue kernels that read (or modify) the
+    local particle arrays. Wrap the action in `hoomd.write.CustomWriter`,
+    `hoomd.update.CustomUpdater`, or `hoomd.tune.CustomTuner` to add it to the
+    run loop.
+
+    On each call, `DeviceAction` exports the particle fields named in `fields`
+    from `hoomd.State.gpu_local_snapshot` as DLPack capsules and passes them to
+    :meth:`~.launch` with the handle of the stream that HOOMD-blue enqueues its
+    own kernels on. Kernels launched on `stream` run in order with the
+    simulation's kernels, so there is no need to synchronize before or after
+    the launch. The kernels complete asynchronously while the run loop
+    continues.
+
+    .. rubric:: Example:
+
+    .. skip: next if(gpu_not_available or cupy_not_available)
+
+    .. code-block:: python
+
+        import cupy
+
+        kernel = cupy.RawKernel(
+            r'''
+            extern "C" __global__
+            void count_upper(const double* position,
+                             unsigned int N,
+                             unsigned int* count)
+                {
+                unsigned int i = blockDim.x * blockIdx.x + threadIdx.x;
+                if (i < N && position[3 * i + 2] > 0)
+                    atomicAdd(count, 1);
+                }
+            ''', 'count_upper')
+
+        class CountUpper(hoomd.custom.DeviceAction):
+            fields = ('position',)
+
+            def __init__(self):
+                self.count = cupy.zeros(1, dtype=cupy.uint32)
+
+            def launch(self, timestep, arrays, stream):
+                position = cupy.from_dlpack(arrays['position'])
+                N = position.shape[0]
+                with cupy.cuda.ExternalStream(stream):
+                    self.count.fill(0)
+                    kernel(((N + 255) // 256,), (256,),
+                           (position, cupy.uint32(N), self.count))
+
+    Note:
+        The capsules are valid only during :meth:`~.launch`. HOOMD-blue may
+        reorder, resize, or reallocate the arrays between calls, so do not
+        keep references to the data in the capsules beyond :meth:`~.launch`.
+        Kernels enqueued on `stream` during :meth:`~.launch` may still read
+        the arrays after it returns: HOOMD-blue's subsequent kernels on the
+        same stream wait for them.
+
+    Note:
+        `DeviceAction` requires a `hoomd.device.GPU` and CuPy, which provides
+        the DLPack export of the local arrays.
+
+    Attributes:
+        fields (tuple[str]): Names of the local particle arrays to pass to
+            :meth:`~.launch`. Valid names are those of the arrays in
+            `hoomd.data.LocalSnapshotGPU.particles` (for example
+            ``'position'``, ``'velocity'``, or ``'typeid'``).
+
+        include_ghosts (bool): When True, pass arrays that include the ghost
+            particles after the local particles.
+    """
+
+    fields = ('position',)
+    include_ghosts = False
+
+    stream = 0
+    """int: Handle of the stream that HOOMD-blue launches kernels on.
+
+    HOOMD-blue launches all of its kernels on the default stream, so this is
+    the null stream handle (``0``).
+    """
+
+    def attach(self, simulation):
+        """Attaches the action to the `hoomd.Simulation`.
+
+        Args:
+            simulation (hoomd.Simulation): The simulation to attach the action
+                to.
+
+        Raises:
+            RuntimeError: When the simulation does not run on a GPU.
+        """
+        if not isinstance(simulation.device, hoomd.device.GPU):
+            raise RuntimeError(
+                f"{type(self).__name__} requires a hoomd.device.GPU.")
+        super().attach(simulation)
+
+    def act(self, timestep):
+        """Export the local arrays and call :meth:`~.launch`.
+
+        Args:
+            timestep (int): The current timestep in a simulation.
+        """
+        suffix = '_with_ghost' if self.include_ghosts else ''
+        with self._state.gpu_local_snapshot as data:
+            arrays = {}
+            for field in self.fields:
+                array = getattr(data.particles, field + suffix)
+                if not hasattr(array, '__dlpack__'):
+                    raise RuntimeError(
+                        f"{type(self).__name__} requires CuPy to export "
+                        "arrays through DLPack.")
+                arrays[field] = array.__dlpack__(stream=None)
+            self.launch(timestep, arrays, self.stream)
+
+    @abstractmethod
+    def launch(self, timestep, arrays, stream):
+        """Enqueue the kernels that implement the action.
+
+        Args:
+            timestep (int): The current timestep in a simulation.
+            arrays (dict[str, PyCapsule]): DLPack capsules of the local
+                particle arrays named in `fields`, keyed by those names.
+            stream (int): Handle of the stream to launch the kernels on.
+
+        Do not synchronize the device in :meth:`~.launch` unless the action
+        requires the results on the host.
+        """
+        pass
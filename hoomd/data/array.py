@@ -440,6 +440,20 @@ class HOOMDArray(metaclass=_wrap_class_factory(_wrap_list)):
         arr = self._coerce_to_ndarray()
         return getattr(arr, item)
 
+    def __dlpack__(self, stream=None):
+        """Export the underlying buffer through the DLPack protocol.
+
+        The DLPack capsule refers to the internal buffer without a copy, so
+        use the consumer (e.g. ``torch.from_dlpack``) only inside the context
+        manager. DLPack cannot mark data as read only, so read only arrays
+        raise a ``BufferError``.
+        """
+        return self._coerce_to_ndarray().__dlpack__(stream=stream)
+
+    def __dlpack_device__(self):
+        """tuple[int, int]: The DLPack device type and id."""
+        return self._coerce_to_ndarray().__dlpack_device__()
+
     @property
     def __array_interface__(self):
         """Returns the information for a copy of the underlying data buffer.
@@ -655,6 +669,17 @@ if hoomd.version.gpu_enabled:
                     arr = self._coerce_to_ndarray()[index]
                 return HOOMDGPUArray(arr, self._callback, self.read_only)
 
+            def __dlpack__(self, stream=None):
+                """Export the underlying buffer through the DLPack protocol.
+
+                Use the consumer only inside the context manager.
+                """
+                return self._coerce_to_ndarray().__dlpack__(stream=stream)
+
+            def __dlpack_device__(self):
+                """tuple[int, int]: The DLPack device type and id."""
+                return self._coerce_to_ndarray().__dlpack_device__()
+
             @property
             def shape(self):
                 """tuple: Array shape."""
@@ -115,7 +115,7 @@ class Device:
     HOOMD will use this value. You can also set `num_cpu_threads` explicitly.
 
     Note:
-        At this time **very few** features use TBB for threading. Most users
+        At this time **few** features use TBB for threading. Most users
         should employ MPI for parallel simulations. See `features` for more
         information.
     """
@@ -249,6 +249,102 @@ class Device:
         else:
             self._cpp_exec_conf.setNumThreads(int(num_cpu_threads))
 
+    @property
+    def memory_usage(self):
+        """dict[str, dict[str, int]]: Memory held by each array owner.
+
+        HOOMD-blue records the memory allocated by its data arrays on this MPI
+        rank. The keys of `memory_usage` name the owner of the array as
+        ``Class::member`` (for example ``NeighborList::m_nlist``). Arrays
+        without a name are grouped under ``anonymous``. Each value is a dict
+        with the keys:
+
+        * ``host`` - Bytes of host memory currently allocated.
+        * ``device`` - Bytes of device memory currently allocated.
+        * ``peak_host`` - Largest value of ``host``.
+        * ``peak_device`` - Largest value of ``device``.
+
+        Managed memory counts as device memory. `memory_usage` does not include
+        temporary buffers, memory reserved by the memory pool, or memory
+        allocated by external libraries (such as cuFFT).
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            nlist_bytes = device.memory_usage.get(
+                'NeighborList::m_nlist', {}).get('device', 0)
+        """
+        usage = {}
+        tracker = self._cpp_exec_conf.getMemoryTracker()
+        for tag, value in tracker.getUsage().items():
+            usage[tag if tag else 'anonymous'] = dict(
+                host=value.host,
+                device=value.device,
+                peak_host=value.peak_host,
+                peak_device=value.peak_device)
+        return usage
+
+    @property
+    def memory_total(self):
+        """dict[str, int]: Memory held by all arrays [bytes].
+
+        `memory_total` has the same keys as the values of `memory_usage`. The
+        peaks are the largest totals, which may be less than the sum of the
+        peaks of the owners.
+        """
+        value = self._cpp_exec_conf.getMemoryTracker().getTotal()
+        return dict(host=value.host,
+                    device=value.device,
+                    peak_host=value.peak_host,
+                    peak_device=value.peak_device)
+
+    def reset_memory_peaks(self):
+        """Reset the peak values in `memory_usage` to the current values.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            device.reset_memory_peaks()
+        """
+        self._cpp_exec_conf.getMemoryTracker().resetPeak()
+
+    def memory_report(self, limit=None):
+        """Summarize the memory held by each array owner.
+
+        Args:
+            limit (int): Number of owners to include (`None` includes all).
+
+        Returns:
+            str: A table of the current and peak memory of each owner in MiB,
+            sorted by the peak device memory and then the peak host memory.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            device.notice(device.memory_report(limit=10))
+        """
+        def peaks(item):
+            return item[1]['peak_device'], item[1]['peak_host']
+
+        mib = 1024**2
+        usage = sorted(self.memory_usage.items(), key=peaks, reverse=True)
+        if limit is not None:
+            usage = usage[:limit]
+
+        width = max([len(tag) for tag, _ in usage] + [len('total')])
+        header = (f"{'owner':<{width}} {'host':>10} {'peak host':>10} "
+                  f"{'device':>10} {'peak device':>11}")
+        lines = [header, '-' * len(header)]
+        for tag, value in usage + [('total', self.memory_total)]:
+            lines.append(f"{tag:<{width}} {value['host'] / mib:>10.2f} "
+                         f"{value['peak_host'] / mib:>10.2f} "
+                         f"{value['device'] / mib:>10.2f} "
+                         f"{value['peak_device'] / mib:>11.2f}")
+        return '\n'.join(lines)
+
     def notice(self, message, level=1):
         """Write a notice message.
 
@@ -273,6 +369,61 @@ class Device:
         """
         self._cpp_msg.notice(level, str(message) + "\n")
 
+    @contextlib.contextmanager
+    def enable_tracing(self, filename, capacity=65536, gpu_events=False):
+        """Trace the time spent in each stage of the run loop.
+
+        Args:
+            filename (str): Name of the trace file to write. Format the name
+                with ``rank`` and ``partition`` to set the file for each MPI
+                rank (required when the communicator has more than one rank).
+            capacity (int): Number of spans to keep per thread. When more spans
+                are recorded, the oldest are discarded.
+            gpu_events (bool): When `True`, also time each span on the GPU
+                (ignored on the CPU).
+
+        While the context manager is open, HOOMD-blue records the time spent in
+        each tuner, updater, integrator, analyzer, force compute,
+        communication phase, autotuner sample, and MPCD stage. When the context
+        manager closes, each rank writes its trace as JSON in the Chrome trace
+        event format. View the trace at https://ui.perfetto.dev or
+        chrome://tracing.
+
+        When HOOMD-blue is built with NVTX (``ENABLE_NVTOOLS``) or ROCTX
+        (``ENABLE_ROCTRACER``) support, open spans are also marked as ranges
+        for external profilers.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation = hoomd.util.make_example_simulation(device=device)
+            with device.enable_tracing(
+                    filename=str(path / 'trace.{rank}.json')):
+                simulation.run(10)
+
+        Note:
+            Timing the spans on the GPU records two GPU events per span, which
+            adds a small overhead to each span. Writing the trace synchronizes
+            the GPU.
+        """
+        if (self.communicator.num_ranks > 1
+                and filename.format(rank=0, partition=0) == filename.format(
+                    rank=1, partition=0)):
+            raise ValueError("Format filename with rank to write one trace "
+                             "file per MPI rank.")
+
+        rank = self.communicator.rank
+        filename = filename.format(rank=rank,
+                                   partition=self.communicator.partition)
+        tracer = self._cpp_exec_conf.getTracer()
+        tracer.start(int(capacity), bool(gpu_events))
+        try:
+            yield None
+        finally:
+            tracer.stop()
+            tracer.writeChromeTrace(filename, rank)
+
 
 def _create_messenger(mpi_config, notice_level, message_filename):
     msg = _hoomd.Messenger(mpi_config)
@@ -398,6 +549,71 @@ class GPU(Device):
         if num_cpu_threads is not None:
             self.num_cpu_threads = num_cpu_threads
 
+        self._autotuner_cache = None
+
+    @property
+    def autotuner_cache(self):
+        """str: Name of the file that caches tuned kernel parameters.
+
+        When set, `hoomd.Simulation.run` looks up the kernel parameters of the
+        autotuned operations in this file before it starts and skips the
+        autotuner scans for the parameters it finds. After each run, it adds
+        the parameters that completed tuning to the file. Use the same file in
+        chained jobs so that only the first job spends time steps tuning.
+
+        Entries are keyed by the GPU model, the HOOMD-blue version, the
+        position and class of the operation, the autotuner name, and a bucket
+        of the problem size (number of particles, number of types, and
+        density). Parameters in the file that are no longer valid are ignored
+        and tuned again. MPI rank 0 writes the file. Set to `None` (the
+        default) to disable the cache.
+
+        .. rubric:: Example:
+
+        .. skip: next if(gpu_not_available)
+
+        .. code-block:: python
+
+            gpu.autotuner_cache = 'autotuner_cache.json'
+        """
+        return self._autotuner_cache
+
+    @autotuner_cache.setter
+    def autotuner_cache(self, filename):
+        self._autotuner_cache = None if filename is None else str(filename)
+
+    @property
+    def autotuner_drift_threshold(self):
+        """float: Relative slowdown that makes autotuners tune again.
+
+        After an autotuner completes its scan, it times one in every 100 kernel
+        launches. When the median of the recent times exceeds the time measured
+        during the scan by more than this fraction, or when the number of
+        particles the kernel processes changes by more than a factor of about
+        1.4, the autotuner scans the parameters near its current values and
+        moves to a faster one if it finds one.
+        `hoomd.operation.AutotunedObject.is_tuning_complete` is `False` during
+        these short scans. The check also applies to parameters set with
+        `hoomd.operation.AutotunedObject.kernel_parameters`. Set to 0 (the
+        default) to disable.
+
+        .. rubric:: Example:
+
+        .. skip: next if(gpu_not_available)
+
+        .. code-block:: python
+
+            gpu.autotuner_drift_threshold = 0.2
+        """
+        return self._cpp_exec_conf.getAutotunerDriftThreshold()
+
+    @autotuner_drift_threshold.setter
+    def autotuner_drift_threshold(self, value):
+        value = float(value)
+        if value < 0:
+            raise ValueError("autotuner_drift_threshold must be >= 0.")
+        self._cpp_exec_conf.setAutotunerDriftThreshold(value)
+
     @property
     def gpu_error_checking(self):
         """bool: Whether to check for GPU error conditions after every call.
@@ -420,6 +636,92 @@ class GPU(Device):
     def gpu_error_checking(self, new_bool):
         self._cpp_exec_conf.setCUDAErrorChecking(new_bool)
 
+    @property
+    def operation_gpu_timing(self):
+        """bool: Whether operations time their calls on the GPU.
+
+        When `True`, operations record GPU events around each timed call and
+        report the GPU time in `hoomd.operation.Operation.call_gpu_time_mean`.
+        Recording the events does not synchronize the GPU. Defaults to
+        `False`.
+
+        .. rubric:: Example:
+
+        .. skip: next if(gpu_not_available)
+
+        .. code-block:: python
+
+            gpu.operation_gpu_timing = True
+        """
+        return self._cpp_exec_conf.operationGPUTimingEnabled()
+
+    @operation_gpu_timing.setter
+    def operation_gpu_timing(self, value):
+        self._cpp_exec_conf.setOperationGPUTiming(bool(value))
+
+    @property
+    def memory_pool(self):
+        """bool: Whether to allocate device memory from a stream-ordered pool.
+
+        When `True`, new device allocations for particle data, GPU arrays, and
+        temporary buffers come from the device's memory pool. Freed memory
+        returns to the pool, so resizing arrays and allocating temporaries
+        does not call into the driver. The pool keeps up to
+        `memory_pool_release_threshold` bytes of unused memory. Requires a
+        single GPU that supports memory pools. Defaults to `False`.
+
+        .. rubric:: Example:
+
+        .. skip: next if(gpu_not_available)
+
+        .. code-block:: python
+
+            gpu.memory_pool = True
+        """
+        return self._cpp_exec_conf.memoryPoolEnabled()
+
+    @memory_pool.setter
+    def memory_pool(self, value):
+        self._cpp_exec_conf.setMemoryPool(bool(value))
+
+    @property
+    def memory_pool_release_threshold(self):
+        """int: Number of unused bytes the memory pool keeps.
+
+        The pool returns unused memory above this threshold to the device when
+        the GPU synchronizes. Defaults to 0.
+        """
+        return self._cpp_exec_conf.getMemoryPool().getReleaseThreshold()
+
+    @memory_pool_release_threshold.setter
+    def memory_pool_release_threshold(self, value):
+        value = int(value)
+        if value < 0:
+            raise ValueError("memory_pool_release_threshold must be >= 0.")
+        self._cpp_exec_conf.getMemoryPool().setReleaseThreshold(value)
+
+    @property
+    def memory_pool_stats(self):
+        """dict: Memory pool usage statistics.
+
+        The keys are:
+
+        * ``reserved`` - Bytes the pool holds from the device.
+        * ``used`` - Bytes allocated from the pool.
+        * ``peak_reserved`` - Largest value of ``reserved``.
+        * ``peak_used`` - Largest value of ``used``.
+        * ``fragmentation`` - Fraction of the reserved memory that is not
+          allocated.
+
+        The values are 0 when the device does not support memory pools.
+        """
+        pool = self._cpp_exec_conf.getMemoryPool()
+        return dict(reserved=pool.getReservedBytes(),
+                    used=pool.getUsedBytes(),
+                    peak_reserved=pool.getPeakReservedBytes(),
+                    peak_used=pool.getPeakUsedBytes(),
+                    fragmentation=pool.getFragmentation())
+
     @property
     def compute_capability(self):
         """tuple(int, int): Compute capability of the device.
@@ -0,0 +1,116 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement Ensemble.
+
+.. invisible-code-block: python
+
+    replicas = [
+        hoomd.util.make_example_simulation(device=hoomd.device.CPU())
+        for i in range(4)
+    ]
+"""
+
+from concurrent.futures import ThreadPoolExecutor
+
+import hoomd
+
+
+class Ensemble:
+    """Advance many independent simulations concurrently.
+
+    Args:
+        simulations (list[hoomd.Simulation]): The replicas to advance.
+
+    Small systems (a few thousand particles) cannot keep a GPU busy: the time
+    to launch kernels and perform host-side bookkeeping dominates each time
+    step. `Ensemble` runs each replica in its own thread so that the host work
+    of one replica overlaps with the GPU work of the others. `Simulation.run`
+    releases the Python global interpreter lock while its time step loop
+    executes C++ operations, so the replicas advance in parallel.
+
+    Each replica must have its own `hoomd.device.Device` instance (the
+    instances may select the same GPU) and a `hoomd.communicator.Communicator`
+    with a single rank. Use ``ranks_per_partition=1`` to run one ensemble on
+    each MPI rank.
+
+    Note:
+        Custom Python operations hold the global interpreter lock while they
+        execute, which serializes the replicas on those time steps.
+
+    Note:
+        Kernel timings include the work of the other replicas that share the
+        GPU. The autotuners still converge to good parameters, but they may
+        differ from those tuned in a single simulation.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        ensemble = hoomd.Ensemble(replicas)
+    """
+
+    def __init__(self, simulations):
+        simulations = tuple(simulations)
+        if len(simulations) == 0:
+            raise ValueError("An ensemble needs at least one simulation.")
+
+        for simulation in simulations:
+            if not isinstance(simulation, hoomd.Simulation):
+                raise TypeError(f"{simulation} is not a hoomd.Simulation.")
+            if simulation.device.communicator.num_ranks != 1:
+                raise ValueError("Each simulation in an ensemble must have a "
+                                 "communicator with a single rank.")
+
+        if len({id(simulation.device) for simulation in simulations
+               }) != len(simulations):
+            raise ValueError("Each simulation in an ensemble must have its "
+                             "own device.")
+
+        self._simulations = simulations
+
+    @property
+    def simulations(self):
+        """tuple[hoomd.Simulation]: The replicas in the ensemble."""
+        return self._simulations
+
+    def run(self, steps, write_at_start=False, max_workers=None):
+        """Advance every replica a number of steps.
+
+        Args:
+            steps (int): Number of steps to advance each replica.
+
+            write_at_start (bool): When `True`, writers with triggers that
+                evaluate `True` for the initial step of a replica will be
+                executed before its time step loop.
+
+            max_workers (int): Maximum number of replicas to advance at the
+                same time. Defaults to the number of replicas.
+
+        `run` calls `Simulation.run` on each replica in a separate thread and
+        returns when all replicas complete. When a replica raises an exception,
+        the other replicas complete their steps and then `run` raises the first
+        exception.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            ensemble.run(1_000)
+        """
+        if max_workers is None:
+            max_workers = len(self._simulations)
+
+        with ThreadPoolExecutor(max_workers=max_workers) as executor:
+            futures = [
+                executor.submit(simulation.run, steps, write_at_start)
+                for simulation in self._simulations
+            ]
+
+        for future in futures:
+            future.result()
+
+    @property
+    def timesteps(self):
+        """list[int]: The current time step of each replica."""
+        return [simulation.timestep for simulation in self._simulations]
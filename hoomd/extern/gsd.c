@@ -2136,6 +2136,72 @@ int gsd_write_chunk(struct gsd_handle* handle,
     return GSD_SUCCESS;
     }
 
+int gsd_reserve_chunk(struct gsd_handle* handle,
+                      const char* name,
+                      enum gsd_type type,
+                      uint64_t N,
+                      uint32_t M,
+                      uint8_t flags,
+                      uint64_t* location)
+    {
+    // validate input
+    if (handle == NULL || location == NULL)
+        {
+        return GSD_ERROR_INVALID_ARGUMENT;
+        }
+    if (M == 0)
+        {
+        return GSD_ERROR_INVALID_ARGUMENT;
+        }
+    if (handle->open_flags == GSD_OPEN_READONLY)
+        {
+        return GSD_ERROR_FILE_MUST_BE_WRITABLE;
+        }
+    if (flags != 0)
+        {
+        return GSD_ERROR_INVALID_ARGUMENT;
+        }
+
+    uint16_t id = gsd_name_id_map_find(&handle->name_map, name);
+    if (id == UINT16_MAX)
+        {
+        // not found, append to the index
+        int retval = gsd_append_name(&id, handle, name);
+        if (retval != GSD_SUCCESS)
+            {
+            return retval;
+            }
+
+        if (id == UINT16_MAX)
+            {
+            // this should never happen
+            return GSD_ERROR_NAMELIST_FULL;
+            }
+        }
+
+    // reserved chunks are never buffered, so they go in the frame index like large chunks
+    struct gsd_index_entry* index_entry;
+    int retval = gsd_index_buffer_add(&handle->frame_index, &index_entry);
+    if (retval != GSD_SUCCESS)
+        {
+        return retval;
+        }
+
+    gsd_util_zero_memory(index_entry, sizeof(struct gsd_index_entry));
+    index_entry->frame = handle->cur_frame;
+    index_entry->id = id;
+    index_entry->type = (uint8_t)type;
+    index_entry->N = N;
+    index_entry->M = M;
+    index_entry->location = handle->file_size;
+
+    *location = handle->file_size;
+    handle->file_size += N * M * gsd_sizeof_type(type);
+
+    handle->pending_index_entries++;
+    return GSD_SUCCESS;
+    }
+
 uint64_t gsd_get_nframes(struct gsd_handle* handle)
     {
     if (handle == NULL)
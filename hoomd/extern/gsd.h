@@ -529,6 +529,42 @@ extern "C"
                         uint8_t flags,
                         const void* data);
 
+    /** Reserve space for a data chunk in the current frame without writing its data.
+
+        @param handle Handle to an open GSD file.
+        @param name Name of the data chunk.
+        @param type type ID that identifies the type of data in the chunk.
+        @param N Number of rows in the data.
+        @param M Number of columns in the data.
+        @param flags set to 0, non-zero values reserved for future use.
+        @param location Set to the offset in the file where the caller must write the data.
+
+        @pre *handle* was opened by gsd_open().
+        @pre *name* is a unique name for data chunks in the given frame.
+
+        @post The index entry is present in the buffer, and `N * M * gsd_sizeof_type(type)` bytes
+              are reserved at the end of the file.
+
+        @note This is a HOOMD-blue extension that allows several processes to write the data of one
+        chunk in parallel (e.g. with MPI-IO). The caller must write the data before the next call
+        to gsd_end_frame().
+
+        @return
+          - GSD_SUCCESS (0) on success. Negative value on failure:
+          - GSD_ERROR_INVALID_ARGUMENT: *handle* is NULL, *M* == 0, *location* is NULL, or
+            *flags* != 0.
+          - GSD_ERROR_FILE_MUST_BE_WRITABLE: The file was opened read-only.
+          - GSD_ERROR_NAMELIST_FULL: The file cannot store any additional unique chunk names.
+          - GSD_ERROR_MEMORY_ALLOCATION_FAILED: failed to allocate memory.
+    */
+    int gsd_reserve_chunk(struct gsd_handle* handle,
+                          const char* name,
+                          enum gsd_type type,
+                          uint64_t N,
+                          uint32_t M,
+                          uint8_t flags,
+                          uint64_t* location);
+
     /** Find a chunk in the GSD file.
 
         @param handle Handle to an open GSD file
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "../SystemDefinition.h"
+#include <algorithm>
 #include <memory>
 #include <pybind11/pybind11.h>
 #include <vector>
@@ -31,6 +32,11 @@ namespace hoomd
     rank.
 
     The base class getSelectedTags() method returns an empty vector.
+
+    getSelectedTagsFrom() applies the filter to a given set of candidate tags,
+    which lets ParticleGroup update its members when only a few particles are
+    added. Filters that can test a single particle override it so that the
+    cost scales with the number of candidates.
 */
 class PYBIND11_EXPORT ParticleFilter
     {
@@ -47,6 +53,63 @@ class PYBIND11_EXPORT ParticleFilter
         {
         return std::vector<unsigned int>();
         }
+
+    /** Test which of the candidate particles meet the selection criteria.
+     *  sysdef: the System Definition
+     *  candidates: sorted tags to test
+     *
+     *  Returns:
+     *  the sorted candidates that getSelectedTags() would return
+     *
+     *  The base case evaluates getSelectedTags() and intersects the result
+     *  with the candidates.
+     */
+    virtual std::vector<unsigned int>
+    getSelectedTagsFrom(std::shared_ptr<SystemDefinition> sysdef,
+                        const std::vector<unsigned int>& candidates) const
+        {
+        auto X = getSelectedTags(sysdef);
+        std::sort(X.begin(), X.end());
+
+        auto tags = std::vector<unsigned int>(std::min(X.size(), candidates.size()));
+        auto it = std::set_intersection(X.begin(),
+                                        X.end(),
+                                        candidates.begin(),
+                                        candidates.end(),
+                                        tags.begin());
+        tags.resize(it - tags.begin());
+        return tags;
+        }
+
+    protected:
+    /** Select the rank local candidates that satisfy a predicate
+     *  sysdef: the System Definition
+     *  candidates: sorted tags to test
+     *  pred: callable taking the local index of a candidate
+     */
+    template<class Predicate>
+    static std::vector<unsigned int> selectLocal(std::shared_ptr<SystemDefinition> sysdef,
+                                                 const std::vector<unsigned int>& candidates,
+                                                 Predicate pred)
+        {
+        const auto pdata = sysdef->getParticleData();
+        const ArrayHandle<unsigned int> h_rtag(pdata->getRTags(),
+                                               access_location::host,
+                                               access_mode::read);
+        const auto N = pdata->getN();
+        const auto n_rtag = pdata->getRTags().size();
+
+        std::vector<unsigned int> member_tags;
+        for (auto tag : candidates)
+            {
+            if (tag >= n_rtag)
+                continue;
+            unsigned int idx = h_rtag.data[tag];
+            if (idx < N && pred(idx))
+                member_tags.push_back(tag);
+            }
+        return member_tags;
+        }
     };
 
     } // end namespace hoomd
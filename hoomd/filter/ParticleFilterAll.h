@@ -38,6 +38,20 @@ class PYBIND11_EXPORT ParticleFilterAll : public ParticleFilter
         std::copy_n(h_tag.data, N, member_tags.begin());
         return member_tags;
         }
+
+    /** Args:
+     *  sysdef: the System Definition
+     *  candidates: sorted tags to test
+     *
+     *  Returns:
+     *  the candidates in the local rank
+     */
+    virtual std::vector<unsigned int>
+    getSelectedTagsFrom(std::shared_ptr<SystemDefinition> sysdef,
+                        const std::vector<unsigned int>& candidates) const
+        {
+        return selectLocal(sysdef, candidates, [](unsigned int idx) { return true; });
+        }
     };
 
     } // end namespace hoomd
@@ -50,6 +50,28 @@ class PYBIND11_EXPORT ParticleFilterIntersection : public ParticleFilter
         return tags;
         }
 
+    /** Test which of the candidate particles meet the selection criteria
+     *  Args:
+     *  sysdef: the System Definition
+     *  candidates: sorted tags to test
+     *
+     *  Returns:
+     *  the candidates that are in filter m_f and filter
+     *  m_g
+     */
+    virtual std::vector<unsigned int>
+    getSelectedTagsFrom(std::shared_ptr<SystemDefinition> sysdef,
+                        const std::vector<unsigned int>& candidates) const
+        {
+        auto X = m_f->getSelectedTagsFrom(sysdef, candidates);
+        auto Y = m_g->getSelectedTagsFrom(sysdef, candidates);
+
+        auto tags = std::vector<unsigned int>(std::min(X.size(), Y.size()));
+        auto it = std::set_intersection(X.begin(), X.end(), Y.begin(), Y.end(), tags.begin());
+        tags.resize(it - tags.begin());
+        return tags;
+        }
+
     protected:
     std::shared_ptr<ParticleFilter> m_f;
     std::shared_ptr<ParticleFilter> m_g;
@@ -27,6 +27,20 @@ class PYBIND11_EXPORT ParticleFilterNull : public ParticleFilter
         std::vector<unsigned int> member_tags;
         return member_tags;
         }
+
+    /** Args:
+     *  sysdef: the System Definition
+     *  candidates: sorted tags to test
+     *
+     *  Returns:
+     *  an empty list
+     */
+    virtual std::vector<unsigned int>
+    getSelectedTagsFrom(std::shared_ptr<SystemDefinition> sysdef,
+                        const std::vector<unsigned int>& candidates) const
+        {
+        return std::vector<unsigned int>();
+        }
     };
 
     } // end namespace hoomd
@@ -90,26 +90,7 @@ class PYBIND11_EXPORT ParticleFilterRigid : public ParticleFilter
         for (unsigned int idx = 0; idx < pdata->getN(); ++idx)
             {
             unsigned int tag = h_tag.data[idx];
-
-            // get position of particle
-            unsigned int body = h_body.data[idx];
-
-            // see if it matches the criteria
-            bool include_particle = false;
-            if (toBool(m_current_selection & RigidBodySelection::CENTERS))
-                {
-                include_particle = include_particle || (tag == body);
-                }
-            if (toBool(m_current_selection & RigidBodySelection::CONSTITUENT))
-                {
-                include_particle = include_particle || (body < MIN_FLOPPY && body != tag);
-                }
-            if (toBool(m_current_selection & RigidBodySelection::FREE))
-                {
-                include_particle = include_particle || (body == NO_BODY);
-                }
-
-            if (include_particle)
+            if (isSelected(tag, h_body.data[idx]))
                 {
                 member_tags.push_back(tag);
                 }
@@ -117,10 +98,50 @@ class PYBIND11_EXPORT ParticleFilterRigid : public ParticleFilter
         return member_tags;
         }
 
+    /** Test which of the candidate particles meet the selection criteria.
+     *  sysdef: the System Definition
+     *  candidates: sorted tags to test
+     */
+    virtual std::vector<unsigned int>
+    getSelectedTagsFrom(std::shared_ptr<SystemDefinition> sysdef,
+                        const std::vector<unsigned int>& candidates) const
+        {
+        auto pdata = sysdef->getParticleData();
+
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_body(pdata->getBodies(),
+                                         access_location::host,
+                                         access_mode::read);
+
+        return selectLocal(sysdef,
+                           candidates,
+                           [&](unsigned int idx)
+                           { return isSelected(h_tag.data[idx], h_body.data[idx]); });
+        }
+
     private:
     /// Current selection of particles to chose from rigid body center, constituent particles,
     /// and free bodies.
     RigidBodySelection m_current_selection;
+
+    /// Test if a particle with the given tag and body id matches the criteria
+    bool isSelected(unsigned int tag, unsigned int body) const
+        {
+        bool include_particle = false;
+        if (toBool(m_current_selection & RigidBodySelection::CENTERS))
+            {
+            include_particle = include_particle || (tag == body);
+            }
+        if (toBool(m_current_selection & RigidBodySelection::CONSTITUENT))
+            {
+            include_particle = include_particle || (body < MIN_FLOPPY && body != tag);
+            }
+        if (toBool(m_current_selection & RigidBodySelection::FREE))
+            {
+            include_particle = include_particle || (body == NO_BODY);
+            }
+        return include_particle;
+        }
     };
 
     } // end namespace hoomd
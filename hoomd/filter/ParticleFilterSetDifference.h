@@ -51,6 +51,28 @@ class PYBIND11_EXPORT ParticleFilterSetDifference : public ParticleFilter
         return tags;
         }
 
+    /** Test which of the candidate particles meet the selection criteria
+     *  Args:
+     *  sysdef: the System Definition
+     *  candidates: sorted tags to test
+     *
+     *  Returns:
+     *  the candidates that are in filter m_f but not in
+     *  filter m_g
+     */
+    virtual std::vector<unsigned int>
+    getSelectedTagsFrom(std::shared_ptr<SystemDefinition> sysdef,
+                        const std::vector<unsigned int>& candidates) const
+        {
+        auto X = m_f->getSelectedTagsFrom(sysdef, candidates);
+        auto Y = m_g->getSelectedTagsFrom(sysdef, candidates);
+
+        auto tags = std::vector<unsigned int>(X.size());
+        auto it = std::set_difference(X.begin(), X.end(), Y.begin(), Y.end(), tags.begin());
+        tags.resize(it - tags.begin());
+        return tags;
+        }
+
     protected:
     std::shared_ptr<ParticleFilter> m_f;
     std::shared_ptr<ParticleFilter> m_g;
@@ -43,6 +43,30 @@ class PYBIND11_EXPORT ParticleFilterTags : public ParticleFilter
         return m_tags;
         }
 
+    /** Args:
+     *  sysdef System Definition
+     *  candidates: sorted tags to test
+     *
+     *  Returns:
+     *  the candidates in m_tags
+     */
+    virtual std::vector<unsigned int>
+    getSelectedTagsFrom(std::shared_ptr<SystemDefinition> sysdef,
+                        const std::vector<unsigned int>& candidates) const
+        {
+        std::vector<unsigned int> X = m_tags;
+        std::sort(X.begin(), X.end());
+
+        auto tags = std::vector<unsigned int>(std::min(X.size(), candidates.size()));
+        auto it = std::set_intersection(X.begin(),
+                                        X.end(),
+                                        candidates.begin(),
+                                        candidates.end(),
+                                        tags.begin());
+        tags.resize(it - tags.begin());
+        return tags;
+        }
+
     protected:
     std::vector<unsigned int> m_tags; //< Tags to use for filter
     };
@@ -69,6 +69,34 @@ class PYBIND11_EXPORT ParticleFilterType : public ParticleFilter
         return member_tags;
         }
 
+    /** Test which of the candidate particles meet the selection criteria
+     *  sysdef: system definition to find tags for
+     *  candidates: sorted tags to test
+     *
+     *  Returns:
+     *  the rank local candidates of types in m_types
+     */
+    virtual std::vector<unsigned int>
+    getSelectedTagsFrom(std::shared_ptr<SystemDefinition> sysdef,
+                        const std::vector<unsigned int>& candidates) const
+        {
+        const auto pdata = sysdef->getParticleData();
+        const ArrayHandle<Scalar4> h_postype(pdata->getPositions(),
+                                             access_location::host,
+                                             access_mode::read);
+
+        std::unordered_set<unsigned int> types(m_types.size());
+        for (auto type_str : m_types)
+            {
+            types.insert(pdata->getTypeByName(type_str));
+            }
+
+        return selectLocal(sysdef,
+                           candidates,
+                           [&](unsigned int idx)
+                           { return types.count(__scalar_as_int(h_postype.data[idx].w)) > 0; });
+        }
+
     protected:
     std::unordered_set<std::string> m_types; ///< Set of types to select
     };
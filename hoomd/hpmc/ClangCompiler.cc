@@ -2,6 +2,7 @@
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 #include "ClangCompiler.h"
+#include "JITCache.h"
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
@@ -17,6 +18,9 @@
 #include <clang/Lex/HeaderSearch.h>
 #include <clang/Lex/PreprocessorOptions.h>
 #include <clang/Tooling/Tooling.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Config/llvm-config.h>
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
 #include <llvm/InitializePasses.h>
@@ -25,6 +29,7 @@
 #include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/raw_os_ostream.h>
+#include <llvm/Support/raw_ostream.h>
 
 #pragma GCC diagnostic pop
 
@@ -227,5 +232,69 @@ std::unique_ptr<llvm::Module> ClangCompiler::compileCode(const std::string& code
     return module;
     }
 
+/** @param code The C++ code to compile.
+    @param user_args The arguments to pass to the compiler.
+    @param out Stream to write compiler messages to.
+
+    @returns The LLVM bitcode of the compiled module, or an empty string on error.
+
+    When the HOOMD_JIT_CACHE_DIR environment variable is set, look up the bitcode in the on-disk
+    cache before compiling and store newly compiled bitcode there.
+*/
+std::string ClangCompiler::compileBitcode(const std::string& code,
+                                          const std::vector<std::string>& user_args,
+                                          std::ostringstream& out)
+    {
+    // The key includes the host CPU because user arguments such as -march=native emit bitcode
+    // specific to it.
+    JITCache cache(std::string("LLVM ") + LLVM_VERSION_STRING + " "
+                   + llvm::sys::getDefaultTargetTriple() + " "
+                   + llvm::sys::getHostCPUName().str());
+
+    std::string bitcode;
+    if (cache.load(code, user_args, bitcode))
+        {
+        out << "Loaded bitcode from the JIT cache." << std::endl;
+        return bitcode;
+        }
+
+    llvm::LLVMContext context;
+    auto module = compileCode(code, user_args, context, out);
+    if (!module)
+        {
+        return std::string();
+        }
+
+    llvm::raw_string_ostream bitcode_stream(bitcode);
+    llvm::WriteBitcodeToFile(*module, bitcode_stream);
+    bitcode_stream.flush();
+
+    cache.store(code, user_args, bitcode);
+    return bitcode;
+    }
+
+/** @param bitcode LLVM bitcode produced by compileBitcode().
+    @param context LLVM context that owns the module.
+    @param out Stream to write error messages to.
+
+    @returns The LLVM module, or nullptr on error.
+*/
+std::unique_ptr<llvm::Module> ClangCompiler::loadBitcode(const std::string& bitcode,
+                                                         llvm::LLVMContext& context,
+                                                         std::ostringstream& out)
+    {
+    auto module_or_error = llvm::parseBitcodeFile(
+        llvm::MemoryBufferRef(llvm::StringRef(bitcode), "_hoomd_llvm_code.bc"),
+        context);
+    if (!module_or_error)
+        {
+        out << "Error loading bitcode: " << llvm::toString(module_or_error.takeError())
+            << std::endl;
+        return nullptr;
+        }
+
+    return std::move(module_or_error.get());
+    }
+
     } // end namespace hpmc
     } // end namespace hoomd
@@ -43,6 +43,15 @@ class ClangCompiler
                                               llvm::LLVMContext& context,
                                               std::ostringstream& out);
 
+    /// Compile the provided C++ code and return the LLVM bitcode, using the on-disk cache
+    std::string compileBitcode(const std::string& code,
+                               const std::vector<std::string>& user_args,
+                               std::ostringstream& out);
+
+    /// Load a LLVM module from bitcode
+    std::unique_ptr<llvm::Module>
+    loadBitcode(const std::string& bitcode, llvm::LLVMContext& context, std::ostringstream& out);
+
     protected:
     ClangCompiler();
 
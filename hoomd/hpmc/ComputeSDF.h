@@ -176,7 +176,7 @@ template<class Shape> class ComputeSDF : public Compute
     void zeroHistogram();
 
     //! Add to histogram counts
-    void countHistogram(uint64_t timestep);
+    virtual void countHistogram(uint64_t timestep);
     void countHistogramBinarySearch(uint64_t timestep);
     void countHistogramLinearSearch(uint64_t timestep);
 
@@ -0,0 +1,359 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/Index1D.h"
+#include "hoomd/VectorMath.h"
+#include <hip/hip_runtime.h>
+
+#include "GPUHelpers.cuh"
+
+/*! \file ComputeSDFGPU.cuh
+    \brief Declares the driver for the scale distribution function histogram kernel
+*/
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+namespace gpu
+    {
+//! Wraps arguments to hpmc_sdf_histogram
+/*! \ingroup hpmc_data_structs */
+struct hpmc_sdf_args_t
+    {
+    //! Construct a hpmc_sdf_args_t
+    hpmc_sdf_args_t(const Scalar4* _d_postype,
+                    const Scalar4* _d_orientation,
+                    const unsigned int* _d_excell_idx,
+                    const unsigned int* _d_excell_size,
+                    const Index2D& _excli,
+                    const Index3D& _ci,
+                    const uint3& _cell_dim,
+                    const Scalar3& _ghost_width,
+                    const unsigned int _N,
+                    const unsigned int _num_types,
+                    const BoxDim& _box,
+                    const Scalar _dx,
+                    const unsigned int _n_bins,
+                    unsigned int* _d_hist,
+                    const unsigned int _block_size,
+                    const unsigned int _group_size,
+                    const hipDeviceProp_t& _devprop)
+        : d_postype(_d_postype), d_orientation(_d_orientation), d_excell_idx(_d_excell_idx),
+          d_excell_size(_d_excell_size), excli(_excli), ci(_ci), cell_dim(_cell_dim),
+          ghost_width(_ghost_width), N(_N), num_types(_num_types), box(_box), dx(_dx),
+          n_bins(_n_bins), d_hist(_d_hist), block_size(_block_size), group_size(_group_size),
+          devprop(_devprop)
+        {
+        }
+
+    const Scalar4* d_postype;          //!< postype array
+    const Scalar4* d_orientation;      //!< orientation array
+    const unsigned int* d_excell_idx;  //!< Expanded cell list
+    const unsigned int* d_excell_size; //!< Size of expanded cells
+    const Index2D& excli;              //!< Excell indexer
+    const Index3D& ci;                 //!< Cell indexer
+    const uint3& cell_dim;             //!< Cell dimensions
+    const Scalar3& ghost_width;        //!< Width of the ghost layer
+    const unsigned int N;              //!< Number of particles
+    const unsigned int num_types;      //!< Number of particle types
+    const BoxDim box;                  //!< Current simulation box
+    const Scalar dx;                   //!< Histogram bin width
+    const unsigned int n_bins;         //!< Number of histogram bins
+    unsigned int* d_hist;              //!< Histogram counts (output)
+    const unsigned int block_size;     //!< Block size to execute
+    const unsigned int group_size;     //!< Threads per particle
+    const hipDeviceProp_t& devprop;    //!< CUDA device properties
+    };
+
+//! Kernel driver for kernel::hpmc_sdf_histogram()
+template<class Shape>
+void hpmc_sdf_histogram(const hpmc_sdf_args_t& args, const typename Shape::param_type* params);
+
+#ifdef __HIPCC__
+namespace kernel
+    {
+//! Test whether two shapes overlap when their separation is scaled by 1 - lambda
+template<class Shape>
+__device__ inline bool test_scaled_overlap(const vec3<Scalar>& r_ij,
+                                           const Shape& shape_i,
+                                           const Shape& shape_j,
+                                           const Scalar lambda,
+                                           unsigned int& err_count)
+    {
+    vec3<Scalar> r_ij_scaled = r_ij * (Scalar(1.0) - lambda);
+    return check_circumsphere_overlap(r_ij_scaled, shape_i, shape_j)
+           && test_overlap(r_ij_scaled, shape_i, shape_j, err_count);
+    }
+
+//! Determine the histogram bin of the smallest compression that makes two shapes overlap
+/*! \returns The bin index, or n_bins when the shapes already overlap or do not overlap within the
+             histogram range.
+
+    Performs the same binary search as ComputeSDF::computeBin().
+*/
+template<class Shape>
+__device__ inline unsigned int computeSDFBin(const vec3<Scalar>& r_ij,
+                                             const Shape& shape_i,
+                                             const Shape& shape_j,
+                                             const Scalar dx,
+                                             const unsigned int n_bins,
+                                             unsigned int& err_count)
+    {
+    unsigned int L = 0;
+    unsigned int R = n_bins;
+
+    if (test_scaled_overlap(r_ij, shape_i, shape_j, Scalar(L) * dx, err_count))
+        return n_bins;
+
+    if (!test_scaled_overlap(r_ij, shape_i, shape_j, Scalar(R) * dx, err_count))
+        return n_bins;
+
+    // progressively narrow the search window by halves
+    do
+        {
+        unsigned int m = (L + R) / 2;
+
+        if (test_scaled_overlap(r_ij, shape_i, shape_j, Scalar(m) * dx, err_count))
+            R = m;
+        else
+            L = m;
+        } while ((R - L) > 1);
+
+    return L;
+    }
+
+//! Accumulate the scale distribution function histogram
+/*! Each group of threads handles one particle i and splits the particles in the expanded cell of
+    i among its threads. The group reduces the bin of the first overlap of i in shared memory and
+    adds it to a shared memory histogram. The block then adds its histogram to global memory.
+
+    When the histogram does not fit in shared memory, the groups add directly to global memory.
+*/
+template<class Shape>
+__global__ void hpmc_sdf_histogram(const Scalar4* d_postype,
+                                   const Scalar4* d_orientation,
+                                   const unsigned int* d_excell_idx,
+                                   const unsigned int* d_excell_size,
+                                   const Index2D excli,
+                                   const Index3D ci,
+                                   const uint3 cell_dim,
+                                   const Scalar3 ghost_width,
+                                   const unsigned int N,
+                                   const unsigned int num_types,
+                                   const BoxDim box,
+                                   const Scalar dx,
+                                   const unsigned int n_bins,
+                                   unsigned int* d_hist,
+                                   const bool shared_hist,
+                                   const typename Shape::param_type* d_params,
+                                   unsigned int max_extra_bytes)
+    {
+    unsigned int group = threadIdx.y;
+    unsigned int offset = threadIdx.x;
+    unsigned int group_size = blockDim.x;
+    unsigned int n_groups = blockDim.y;
+    bool master = (offset == 0);
+
+    unsigned int tidx = threadIdx.x + blockDim.x * threadIdx.y;
+    unsigned int block_size = blockDim.x * blockDim.y;
+
+    HIP_DYNAMIC_SHARED(char, s_data)
+    typename Shape::param_type* s_params = (typename Shape::param_type*)(&s_data[0]);
+    unsigned int* s_min_bin = (unsigned int*)(s_params + num_types);
+    unsigned int* s_hist = (unsigned int*)(s_min_bin + n_groups);
+
+        // copy over parameters one int per thread for fast loads
+        {
+        unsigned int param_size = num_types * sizeof(typename Shape::param_type) / sizeof(int);
+
+        for (unsigned int cur_offset = 0; cur_offset < param_size; cur_offset += block_size)
+            {
+            if (cur_offset + tidx < param_size)
+                {
+                ((int*)s_params)[cur_offset + tidx] = ((int*)d_params)[cur_offset + tidx];
+                }
+            }
+        }
+
+    if (shared_hist)
+        {
+        for (unsigned int cur_offset = 0; cur_offset < n_bins; cur_offset += block_size)
+            {
+            if (cur_offset + tidx < n_bins)
+                s_hist[cur_offset + tidx] = 0;
+            }
+        }
+
+    __syncthreads();
+
+    // initialize extra shared mem
+    char* s_extra = shared_hist ? (char*)(s_hist + n_bins) : (char*)(s_hist);
+
+    unsigned int available_bytes = max_extra_bytes;
+    for (unsigned int cur_type = 0; cur_type < num_types; ++cur_type)
+        s_params[cur_type].load_shared(s_extra, available_bytes);
+
+    if (master)
+        s_min_bin[group] = n_bins;
+
+    __syncthreads();
+
+    unsigned int i = blockIdx.x * n_groups + group;
+
+    if (i < N)
+        {
+        Scalar4 postype_i = d_postype[i];
+        unsigned int typ_i = __scalar_as_int(postype_i.w);
+        Shape shape_i(quat<Scalar>(), s_params[typ_i]);
+        if (shape_i.hasOrientation())
+            shape_i.orientation = quat<Scalar>(d_orientation[i]);
+        vec3<Scalar> pos_i(postype_i);
+
+        unsigned int my_cell = computeParticleCell(vec_to_scalar3(pos_i),
+                                                   box,
+                                                   ghost_width,
+                                                   cell_dim,
+                                                   ci,
+                                                   false);
+
+        unsigned int excell_size = d_excell_size[my_cell];
+        unsigned int min_bin = n_bins;
+        unsigned int err_count = 0;
+
+        for (unsigned int k = offset; k < excell_size; k += group_size)
+            {
+            unsigned int j = d_excell_idx[excli(k, my_cell)];
+            if (j == i)
+                continue;
+
+            Scalar4 postype_j = d_postype[j];
+            unsigned int typ_j = __scalar_as_int(postype_j.w);
+            Shape shape_j(quat<Scalar>(), s_params[typ_j]);
+            if (shape_j.hasOrientation())
+                shape_j.orientation = quat<Scalar>(d_orientation[j]);
+
+            // put particle j into the coordinate system of particle i
+            vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i;
+            r_ij = vec3<Scalar>(box.minImage(vec_to_scalar3(r_ij)));
+
+            unsigned int bin = computeSDFBin(r_ij, shape_i, shape_j, dx, n_bins, err_count);
+            min_bin = min(min_bin, bin);
+            }
+
+        if (min_bin < n_bins)
+            atomicMin(&s_min_bin[group], min_bin);
+        }
+
+    __syncthreads();
+
+    if (master && s_min_bin[group] < n_bins)
+        {
+        if (shared_hist)
+            atomicAdd(&s_hist[s_min_bin[group]], 1);
+        else
+            atomicAdd(&d_hist[s_min_bin[group]], 1);
+        }
+
+    if (shared_hist)
+        {
+        __syncthreads();
+
+        // final tally into global mem
+        for (unsigned int cur_offset = 0; cur_offset < n_bins; cur_offset += block_size)
+            {
+            unsigned int bin = cur_offset + tidx;
+            if (bin < n_bins && s_hist[bin] > 0)
+                atomicAdd(&d_hist[bin], s_hist[bin]);
+            }
+        }
+    }
+
+    } // end namespace kernel
+
+//! Kernel driver for kernel::hpmc_sdf_histogram()
+template<class Shape>
+void hpmc_sdf_histogram(const hpmc_sdf_args_t& args, const typename Shape::param_type* params)
+    {
+    assert(args.d_postype);
+    assert(args.d_orientation);
+    assert(args.d_hist);
+    assert(args.group_size >= 1);
+
+    // reset the histogram
+    hipMemsetAsync(args.d_hist, 0, sizeof(unsigned int) * args.n_bins);
+
+    if (args.N == 0)
+        return;
+
+    // determine the maximum block size and clamp the input block size down
+    int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(kernel::hpmc_sdf_histogram<Shape>));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int block_size = min(args.block_size, (unsigned int)max_block_size);
+    unsigned int group_size = min(args.group_size, block_size);
+    unsigned int n_groups = block_size / group_size;
+
+    size_t shared_bytes
+        = args.num_types * sizeof(typename Shape::param_type) + n_groups * sizeof(unsigned int);
+
+    if (shared_bytes + attr.sharedSizeBytes >= args.devprop.sharedMemPerBlock)
+        throw std::runtime_error("hpmc::kernel::sdf_histogram() exceeds shared memory limits");
+
+    // keep the histogram in shared memory when it fits
+    bool shared_hist = shared_bytes + args.n_bins * sizeof(unsigned int) + attr.sharedSizeBytes
+                       < args.devprop.sharedMemPerBlock;
+    if (shared_hist)
+        shared_bytes += args.n_bins * sizeof(unsigned int);
+
+    unsigned int max_extra_bytes = static_cast<unsigned int>(args.devprop.sharedMemPerBlock
+                                                             - attr.sharedSizeBytes - shared_bytes);
+
+    // determine dynamically requested shared memory
+    char* ptr = (char*)nullptr;
+    unsigned int available_bytes = max_extra_bytes;
+    for (unsigned int i = 0; i < args.num_types; ++i)
+        {
+        params[i].allocate_shared(ptr, available_bytes);
+        }
+    const unsigned int extra_bytes = max_extra_bytes - available_bytes;
+
+    shared_bytes += extra_bytes;
+
+    dim3 threads(group_size, n_groups, 1);
+    dim3 grid(args.N / n_groups + 1, 1, 1);
+
+    hipLaunchKernelGGL((kernel::hpmc_sdf_histogram<Shape>),
+                       grid,
+                       threads,
+                       shared_bytes,
+                       0,
+                       args.d_postype,
+                       args.d_orientation,
+                       args.d_excell_idx,
+                       args.d_excell_size,
+                       args.excli,
+                       args.ci,
+                       args.cell_dim,
+                       args.ghost_width,
+                       args.N,
+                       args.num_types,
+                       args.box,
+                       args.dx,
+                       args.n_bins,
+                       args.d_hist,
+                       shared_hist,
+                       params,
+                       max_extra_bytes);
+    }
+#endif
+
+    } // end namespace gpu
+    } // end namespace hpmc
+    } // end namespace hoomd
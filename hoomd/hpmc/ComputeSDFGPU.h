@@ -0,0 +1,342 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#ifdef ENABLE_HIP
+
+#include "hoomd/Autotuner.h"
+#include "hoomd/CellList.h"
+#include "hoomd/GlobalArray.h"
+
+#include "ComputeSDF.h"
+#include "ComputeSDFGPU.cuh"
+#include "IntegratorHPMCMonoGPUTypes.cuh"
+
+/*! \file ComputeSDFGPU.h
+    \brief Defines the template class for an sdf compute on the GPU
+    \note This header cannot be compiled by nvcc
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+//! SDF analysis on the GPU
+/*! ComputeSDFGPU evaluates the binary search of ComputeSDF for all pairs in a cell list based
+    kernel and accumulates the histogram in shared memory. The cell list is usually the one of the
+    GPU integrator. ComputeSDFGPU increases its nominal width when needed to cover the search
+    range of the scaled particles, and never decreases it.
+
+    Shapes and interactions that require the linear search (pair potentials or expansive
+    perturbations) and boxes that are too small for the minimum image convention fall back to the
+    CPU implementation.
+
+    \ingroup hpmc_computes
+*/
+template<class Shape> class ComputeSDFGPU : public ComputeSDF<Shape>
+    {
+    public:
+    //! Construct the compute
+    ComputeSDFGPU(std::shared_ptr<SystemDefinition> sysdef,
+                  std::shared_ptr<IntegratorHPMCMono<Shape>> mc,
+                  std::shared_ptr<CellList> cl,
+                  double xmax,
+                  double dx);
+
+    //! Destructor
+    virtual ~ComputeSDFGPU() { }
+
+    protected:
+    std::shared_ptr<CellList> m_cl; //!< Cell list
+    uint3 m_last_dim;               //!< Dimensions of the cell list on the last call to compute
+    unsigned int m_last_nmax;       //!< Last cell list NMax value allocated in excell
+
+    GlobalArray<unsigned int> m_excell_idx;  //!< Particle indices in expanded cells
+    GlobalArray<unsigned int> m_excell_size; //!< Number of particles in each expanded cell
+    Index2D m_excell_list_indexer;           //!< Indexer to access elements of the excell_idx list
+
+    GlobalArray<unsigned int> m_hist_device; //!< Histogram counts computed on the device
+
+    /// Autotuner for the histogram kernel
+    std::shared_ptr<Autotuner<2>> m_tuner_sdf;
+
+    /// Autotuner for excell block_size
+    std::shared_ptr<Autotuner<1>> m_tuner_excell_block_size;
+
+    //! Add to histogram counts
+    virtual void countHistogram(uint64_t timestep);
+
+    //! Set up excell_list
+    void initializeExcellMem();
+    };
+
+template<class Shape>
+ComputeSDFGPU<Shape>::ComputeSDFGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                    std::shared_ptr<IntegratorHPMCMono<Shape>> mc,
+                                    std::shared_ptr<CellList> cl,
+                                    double xmax,
+                                    double dx)
+    : ComputeSDF<Shape>(sysdef, mc, xmax, dx), m_cl(cl)
+    {
+    this->m_cl->setRadius(1);
+    this->m_cl->setComputeTypeBody(false);
+    this->m_cl->setFlagType();
+    this->m_cl->setComputeIdx(true);
+
+    // set last dim to a bogus value so that it will re-init on the first call
+    m_last_dim = make_uint3(0xffffffff, 0xffffffff, 0xffffffff);
+    m_last_nmax = 0xffffffff;
+
+    GlobalArray<unsigned int> excell_size(0, this->m_exec_conf);
+    m_excell_size.swap(excell_size);
+    TAG_ALLOCATION(m_excell_size);
+
+    GlobalArray<unsigned int> excell_idx(0, this->m_exec_conf);
+    m_excell_idx.swap(excell_idx);
+    TAG_ALLOCATION(m_excell_idx);
+
+    GlobalArray<unsigned int> hist_device(0, this->m_exec_conf);
+    m_hist_device.swap(hist_device);
+    TAG_ALLOCATION(m_hist_device);
+
+    // Autotuner parameters:
+    // 0: block size
+    // 1: threads per particle
+    std::function<bool(const std::array<unsigned int, 2>&)> is_parameter_valid
+        = [](const std::array<unsigned int, 2>& parameter) -> bool
+    {
+        unsigned int block_size = parameter[0];
+        unsigned int group_size = parameter[1];
+        return (group_size <= block_size) && (block_size % group_size) == 0;
+    };
+
+    m_tuner_sdf.reset(new Autotuner<2>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf),
+                                        AutotunerBase::getTppListPow2(this->m_exec_conf)},
+                                       this->m_exec_conf,
+                                       "hpmc_sdf",
+                                       5,
+                                       false,
+                                       is_parameter_valid));
+
+    m_tuner_excell_block_size.reset(
+        new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
+                         this->m_exec_conf,
+                         "hpmc_sdf_excell_block_size"));
+
+    this->m_autotuners.insert(this->m_autotuners.end(), {m_tuner_sdf, m_tuner_excell_block_size});
+    }
+
+/*! \param timestep current timestep
+
+    Compute the histogram on the GPU when the binary search applies, otherwise fall back on the
+    CPU implementation.
+*/
+template<class Shape> void ComputeSDFGPU<Shape>::countHistogram(uint64_t timestep)
+    {
+    if (this->m_mc->hasPairInteractions() || this->m_shape_requires_expansion_moves)
+        {
+        ComputeSDF<Shape>::countHistogram(timestep);
+        return;
+        }
+
+    // the cells must cover the largest circumsphere and the range of the scaled separation
+    Scalar extra_width = this->m_xmax / (1 - this->m_xmax) * this->m_last_max_diam;
+    Scalar nominal_width = this->m_last_max_diam + extra_width;
+
+    // the kernel applies the minimum image convention
+    BoxDim global_box = this->m_pdata->getGlobalBox();
+    Scalar3 npd = global_box.getNearestPlaneDistance();
+    if ((global_box.getPeriodic().x && npd.x <= nominal_width * 2)
+        || (global_box.getPeriodic().y && npd.y <= nominal_width * 2)
+        || (this->m_sysdef->getNDimensions() == 3 && global_box.getPeriodic().z
+            && npd.z <= nominal_width * 2))
+        {
+        ComputeSDF<Shape>::countHistogram(timestep);
+        return;
+        }
+
+    if (this->m_cl->getNominalWidth() < nominal_width)
+        this->m_cl->setNominalWidth(nominal_width);
+
+    // compute cell list
+    this->m_cl->compute(timestep);
+
+    // if the cell list is a different size than last time, reinitialize expanded cell list
+    uint3 cur_dim = this->m_cl->getDim();
+    if (this->m_last_dim.x != cur_dim.x || this->m_last_dim.y != cur_dim.y
+        || this->m_last_dim.z != cur_dim.z || this->m_last_nmax != this->m_cl->getNmax())
+        {
+        this->initializeExcellMem();
+        m_last_dim = cur_dim;
+        m_last_nmax = this->m_cl->getNmax();
+        }
+
+    const unsigned int n_bins = static_cast<unsigned int>(this->m_hist_compression.size());
+    if (m_hist_device.getNumElements() != n_bins)
+        {
+        GlobalArray<unsigned int> hist_device(n_bins, this->m_exec_conf);
+        m_hist_device.swap(hist_device);
+        TAG_ALLOCATION(m_hist_device);
+        }
+
+    if (n_bins == 0)
+        return;
+
+        {
+        // access the cell list data
+        ArrayHandle<unsigned int> d_cell_size(this->m_cl->getCellSizeArray(),
+                                              access_location::device,
+                                              access_mode::read);
+        ArrayHandle<unsigned int> d_cell_idx(this->m_cl->getIndexArray(),
+                                             access_location::device,
+                                             access_mode::read);
+        ArrayHandle<unsigned int> d_cell_adj(this->m_cl->getCellAdjArray(),
+                                             access_location::device,
+                                             access_mode::read);
+
+        // per-device cell list data
+        const ArrayHandle<unsigned int>& d_cell_size_per_device
+            = this->m_cl->getPerDevice()
+                  ? ArrayHandle<unsigned int>(this->m_cl->getCellSizeArrayPerDevice(),
+                                              access_location::device,
+                                              access_mode::read)
+                  : ArrayHandle<unsigned int>(GlobalArray<unsigned int>(),
+                                              access_location::device,
+                                              access_mode::read);
+        const ArrayHandle<unsigned int>& d_cell_idx_per_device
+            = this->m_cl->getPerDevice()
+                  ? ArrayHandle<unsigned int>(this->m_cl->getIndexArrayPerDevice(),
+                                              access_location::device,
+                                              access_mode::read)
+                  : ArrayHandle<unsigned int>(GlobalArray<unsigned int>(),
+                                              access_location::device,
+                                              access_mode::read);
+
+        ArrayHandle<unsigned int> d_excell_idx(m_excell_idx,
+                                               access_location::device,
+                                               access_mode::overwrite);
+        ArrayHandle<unsigned int> d_excell_size(m_excell_size,
+                                                access_location::device,
+                                                access_mode::overwrite);
+
+        // update the expanded cells
+        m_tuner_excell_block_size->begin();
+        gpu::hpmc_excell(d_excell_idx.data,
+                         d_excell_size.data,
+                         m_excell_list_indexer,
+                         this->m_cl->getPerDevice() ? d_cell_idx_per_device.data : d_cell_idx.data,
+                         this->m_cl->getPerDevice() ? d_cell_size_per_device.data
+                                                    : d_cell_size.data,
+                         d_cell_adj.data,
+                         this->m_cl->getCellIndexer(),
+                         this->m_cl->getCellListIndexer(),
+                         this->m_cl->getCellAdjIndexer(),
+                         this->m_cl->getPerDevice() ? this->m_exec_conf->getNumActiveGPUs() : 1,
+                         m_tuner_excell_block_size->getParam()[0]);
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_excell_block_size->end();
+        }
+
+        {
+        // access the particle data
+        ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
+                                       access_location::device,
+                                       access_mode::read);
+        ArrayHandle<Scalar4> d_orientation(this->m_pdata->getOrientationArray(),
+                                           access_location::device,
+                                           access_mode::read);
+        ArrayHandle<unsigned int> d_excell_idx(m_excell_idx,
+                                               access_location::device,
+                                               access_mode::read);
+        ArrayHandle<unsigned int> d_excell_size(m_excell_size,
+                                                access_location::device,
+                                                access_mode::read);
+        ArrayHandle<unsigned int> d_hist(m_hist_device,
+                                         access_location::device,
+                                         access_mode::overwrite);
+
+        m_tuner_sdf->begin();
+        auto param = m_tuner_sdf->getParam();
+        const Scalar3 ghost_width = this->m_cl->getGhostWidth();
+
+        gpu::hpmc_sdf_args_t args(d_postype.data,
+                                  d_orientation.data,
+                                  d_excell_idx.data,
+                                  d_excell_size.data,
+                                  m_excell_list_indexer,
+                                  this->m_cl->getCellIndexer(),
+                                  cur_dim,
+                                  ghost_width,
+                                  this->m_pdata->getN(),
+                                  this->m_pdata->getNTypes(),
+                                  this->m_pdata->getBox(),
+                                  this->m_dx,
+                                  n_bins,
+                                  d_hist.data,
+                                  param[0],
+                                  param[1],
+                                  this->m_exec_conf->dev_prop);
+
+        gpu::hpmc_sdf_histogram<Shape>(args, this->m_mc->getParams().data());
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_sdf->end();
+        }
+
+    ArrayHandle<unsigned int> h_hist(m_hist_device, access_location::host, access_mode::read);
+    for (unsigned int bin = 0; bin < n_bins; bin++)
+        {
+        this->m_hist_compression[bin] += h_hist.data[bin];
+        }
+    }
+
+template<class Shape> void ComputeSDFGPU<Shape>::initializeExcellMem()
+    {
+    this->m_exec_conf->msg->notice(4) << "hpmc resizing expanded cells" << std::endl;
+
+    // get the current cell dimensions
+    unsigned int num_cells = this->m_cl->getCellIndexer().getNumElements();
+    unsigned int num_adj = this->m_cl->getCellAdjIndexer().getW();
+    unsigned int n_cell_list
+        = this->m_cl->getPerDevice() ? this->m_exec_conf->getNumActiveGPUs() : 1;
+    unsigned int num_max = this->m_cl->getNmax() * n_cell_list;
+
+    // make the excell dimensions the same, but with room for Nmax*Nadj in each cell
+    m_excell_list_indexer = Index2D(num_max * num_adj, num_cells);
+
+    // reallocate memory
+    m_excell_idx.resize(m_excell_list_indexer.getNumElements());
+    m_excell_size.resize(num_cells);
+    }
+
+namespace detail
+    {
+//! Export this hpmc compute to python
+/*! \param name Name of the class in the exported python module
+    \tparam Shape An instantiation of ComputeSDFGPU<Shape> will be exported
+*/
+template<class Shape> void export_ComputeSDFGPU(pybind11::module& m, const std::string& name)
+    {
+    pybind11::class_<ComputeSDFGPU<Shape>,
+                     ComputeSDF<Shape>,
+                     std::shared_ptr<ComputeSDFGPU<Shape>>>(m, name.c_str())
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<IntegratorHPMCMono<Shape>>,
+                            std::shared_ptr<CellList>,
+                            double,
+                            double>());
+    }
+
+    } // end namespace detail
+    } // end namespace hpmc
+    } // end namespace hoomd
+
+#endif // ENABLE_HIP
@@ -26,10 +26,10 @@ namespace hoomd
     {
 namespace hpmc
     {
-//! C'tor
-EvalFactory::EvalFactory(const std::string& cpp_code,
-                         const std::vector<std::string>& compiler_args,
-                         bool is_union)
+/*! \param bitcode LLVM bitcode produced by ClangCompiler::compileBitcode().
+    \param error Compiler messages to report when the bitcode is empty.
+*/
+EvalFactory::EvalFactory(const std::string& bitcode, const std::string& error, bool is_union)
     {
     std::ostringstream sstream;
     m_eval = nullptr;
@@ -48,8 +48,15 @@ EvalFactory::EvalFactory(const std::string& cpp_code,
 
     llvm::LLVMContext Context;
 
-    // compile the module
-    auto module = clang_compiler->compileCode(cpp_code, compiler_args, Context, sstream);
+    if (bitcode.empty())
+        {
+        // the code did not compile, report the compiler messages
+        m_error_msg = error;
+        return;
+        }
+
+    // load the module
+    auto module = clang_compiler->loadBitcode(bitcode, Context, sstream);
 
     if (!module)
         {
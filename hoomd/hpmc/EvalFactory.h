@@ -28,9 +28,7 @@ class EvalFactory
                                float charge_j);
 
     //! Constructor
-    EvalFactory(const std::string& cpp_code,
-                const std::vector<std::string>& compiler_args,
-                bool is_union);
+    EvalFactory(const std::string& bitcode, const std::string& error, bool is_union);
 
     //! Return the evaluator
     EvalFnPtr getEval()
@@ -14,6 +14,11 @@
 
 #include "HPMCCounters.h" // do we need this to keep track of the statistics?
 
+#ifdef ENABLE_HIP
+#include "hoomd/GPUPartition.cuh"
+#include <hip/hip_runtime.h>
+#endif
+
 #ifndef __HIPCC__
 #include <pybind11/pybind11.h>
 #endif
@@ -22,11 +27,80 @@ namespace hoomd
     {
 namespace hpmc
     {
+namespace detail
+    {
+#ifdef ENABLE_HIP
+//! Wraps arguments to the external field kernels that accept or reject the trial moves
+struct hpmc_external_field_args_t
+    {
+    //! Construct a hpmc_external_field_args_t
+    hpmc_external_field_args_t(const Scalar4* _d_postype,
+                               const Scalar4* _d_orientation,
+                               const Scalar4* _d_trial_postype,
+                               const Scalar4* _d_trial_orientation,
+                               const unsigned int* _d_trial_move_type,
+                               const Scalar* _d_charge,
+                               const Scalar* _d_diameter,
+                               const unsigned int* _d_reject_out_of_cell,
+                               unsigned int* _d_reject_out,
+                               const uint16_t _seed,
+                               const unsigned int _rank,
+                               const uint64_t _timestep,
+                               const unsigned int _select,
+                               const BoxDim& _global_box,
+                               const Scalar3& _origin,
+                               const GPUPartition& _gpu_partition)
+        : d_postype(_d_postype), d_orientation(_d_orientation), d_trial_postype(_d_trial_postype),
+          d_trial_orientation(_d_trial_orientation), d_trial_move_type(_d_trial_move_type),
+          d_charge(_d_charge), d_diameter(_d_diameter),
+          d_reject_out_of_cell(_d_reject_out_of_cell), d_reject_out(_d_reject_out), seed(_seed),
+          rank(_rank), timestep(_timestep), select(_select), global_box(_global_box),
+          origin(_origin), gpu_partition(_gpu_partition)
+        {
+        }
+
+    const Scalar4* d_postype;                 //!< postype array
+    const Scalar4* d_orientation;             //!< orientation array
+    const Scalar4* d_trial_postype;           //!< New positions (and type) of particles
+    const Scalar4* d_trial_orientation;       //!< New orientations of particles
+    const unsigned int* d_trial_move_type;    //!< 0=no move, 1/2 = translate/rotate
+    const Scalar* d_charge;                   //!< Particle charges
+    const Scalar* d_diameter;                 //!< Particle diameters
+    const unsigned int* d_reject_out_of_cell; //!< Moves that were rejected a priori
+    unsigned int* d_reject_out;               //!< New reject flags
+    const uint16_t seed;                      //!< RNG seed
+    const unsigned int rank;                  //!< MPI Rank
+    const uint64_t timestep;                  //!< Current timestep
+    const unsigned int select;                //!< Current selection within the sweep
+    const BoxDim global_box;                  //!< Global simulation box
+    const Scalar3 origin;                     //!< Origin of the global box
+    const GPUPartition& gpu_partition;        //!< split particles among GPUs
+    };
+#endif
+    } // end namespace detail
+
 class ExternalField : public Compute
     {
     public:
     ExternalField(std::shared_ptr<SystemDefinition> sysdef) : Compute(sysdef) { }
 
+#ifdef ENABLE_HIP
+    //! A struct that contains the kernel arguments
+    typedef detail::hpmc_external_field_args_t gpu_args_t;
+
+    //! Asynchronously launch the kernel that applies the field to the trial moves
+    /*! \param args Kernel arguments
+        \param hStream stream to execute on
+
+        The kernel rejects the trial moves with the Metropolis criterion on the change in the
+        field energy.
+    */
+    virtual void computeExternalFieldGPU(const gpu_args_t& args, hipStream_t hStream)
+        {
+        throw std::runtime_error("This external field does not support execution on the GPU.");
+        }
+#endif
+
     /*! Calculate deltaE for the whole system
         Used for box resizing
     */
@@ -94,6 +168,14 @@ template<class Shape> class ExternalFieldMono : public ExternalField
         return 0;
         }
 
+    //! Notify the field that the move last evaluated by energydiff() was accepted
+    /*! \param index Index of the particle that moved.
+
+        Fields that cache per-particle energies update them here instead of re-evaluating the
+        particle the next time its energy is needed.
+    */
+    virtual void acceptMove(unsigned int index) { }
+
     virtual void reset(uint64_t timestep) { }
     };
 
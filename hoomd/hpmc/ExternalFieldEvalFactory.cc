@@ -26,9 +26,11 @@ namespace hoomd
     {
 namespace hpmc
     {
-//! C'tor
-ExternalFieldEvalFactory::ExternalFieldEvalFactory(const std::string& cpp_code,
-                                                   const std::vector<std::string>& compiler_args)
+/*! \param bitcode LLVM bitcode produced by ClangCompiler::compileBitcode().
+    \param error Compiler messages to report when the bitcode is empty.
+*/
+ExternalFieldEvalFactory::ExternalFieldEvalFactory(const std::string& bitcode,
+                                                   const std::string& error)
     {
     std::ostringstream sstream;
     m_eval = nullptr;
@@ -46,8 +48,15 @@ ExternalFieldEvalFactory::ExternalFieldEvalFactory(const std::string& cpp_code,
 
     llvm::LLVMContext Context;
 
-    // compile the module
-    auto module = clang_compiler->compileCode(cpp_code, compiler_args, Context, sstream);
+    if (bitcode.empty())
+        {
+        // the code did not compile, report the compiler messages
+        m_error_msg = error;
+        return;
+        }
+
+    // load the module
+    auto module = clang_compiler->loadBitcode(bitcode, Context, sstream);
 
     if (!module)
         {
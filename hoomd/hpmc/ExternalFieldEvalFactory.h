@@ -28,8 +28,7 @@ class ExternalFieldEvalFactory
                                             Scalar charge);
 
     //! Constructor
-    ExternalFieldEvalFactory(const std::string& cpp_code,
-                             const std::vector<std::string>& compiler_args);
+    ExternalFieldEvalFactory(const std::string& bitcode, const std::string& error);
 
     //! Return the evaluator
     ExternalFieldEvalFnPtr getEval()
@@ -43,6 +43,8 @@ template<class Shape> class ExternalFieldHarmonic : public ExternalFieldMono<Sha
         setReferencePositions(r0);
         setReferenceOrientations(q0);
         setSymmetricallyEquivalentOrientations(symRotations); // TODO: check for identity?
+        m_energy_cache.terms.resize(m_pdata->getNGlobal());
+        m_trial_energy_cache.terms.resize(m_pdata->getNGlobal());
 
         // connect updateMemberTags() method to maximum particle number change signal
         m_pdata->getGlobalParticleNumberChangeSignal()
@@ -92,6 +94,7 @@ template<class Shape> class ExternalFieldHarmonic : public ExternalFieldMono<Sha
             bcast(m_reference_positions, 0, m_exec_conf->getMPICommunicator());
             }
 #endif
+        invalidateEnergyCache();
         } // end setReferencePositions
 
     //! Set reference orientations from a (N_particles, 4) numpy array
@@ -126,6 +129,7 @@ template<class Shape> class ExternalFieldHarmonic : public ExternalFieldMono<Sha
             bcast(m_reference_orientations, 0, m_exec_conf->getMPICommunicator());
             }
 #endif
+        invalidateEnergyCache();
         } // end setReferenceOrientations
 
     //! Set symmetrically equivalent orientations from a (N_symmetry, 4) numpy array
@@ -158,6 +162,7 @@ template<class Shape> class ExternalFieldHarmonic : public ExternalFieldMono<Sha
             bcast(m_symmetry, 0, m_exec_conf->getMPICommunicator());
             }
 #endif
+        invalidateEnergyCache();
         } // end setSymmetricallyEquivalentOrientations
 
     //! Get reference positions as a (N_particles, 3) numpy array
@@ -251,10 +256,9 @@ template<class Shape> class ExternalFieldHarmonic : public ExternalFieldMono<Sha
 
     /** Calculate the change in energy for trial moves
      *
-     * This function currently ignores any information associated with box changes.
-     * However, this function only gets called in the box updater, so it should not ignore box
-     * changes. But why would you have a lattice field and a box updater active in the same
-     * simulation?
+     * The old configuration is evaluated in box_old, from the cache when possible. The terms of
+     * the new configuration are kept so that the next call after an accepted box move finds them
+     * cached.
      */
     double calculateDeltaE(uint64_t timestep,
                            const Scalar4* const position_old_arg,
@@ -277,19 +281,33 @@ template<class Shape> class ExternalFieldHarmonic : public ExternalFieldMono<Sha
         if (!orientation_old)
             orientation_old = orientation_new;
 
-        double dE = 0.0;
+        ArrayHandle<unsigned int> h_tags(m_pdata->getTags(),
+                                         access_location::host,
+                                         access_mode::read);
+
+        selectEnergyCache(box_old, origin_old);
+        m_trial_energy_cache.box = m_pdata->getGlobalBox();
+        m_trial_energy_cache.origin = m_pdata->getOrigin();
+        m_trial_energy_cache.frame = ++m_energy_frame;
+
+        Scalar d_translational = 0.0;
+        Scalar d_rotational = 0.0;
         for (unsigned int i = 0; i < m_pdata->getN(); i++)
             {
-            Scalar old_E = calcE(timestep,
-                                 i,
-                                 vec3<Scalar>(*(position_old + i)),
-                                 quat<Scalar>(*(orientation_old + i)));
-            Scalar new_E = calcE(timestep,
-                                 i,
-                                 vec3<Scalar>(*(position_new + i)),
-                                 quat<Scalar>(*(orientation_new + i)));
-            dE += new_E - old_E;
+            const unsigned int tag = h_tags.data[i];
+            const EnergyTerms& old_terms = getEnergyTerms(tag,
+                                                          vec3<Scalar>(position_old[i]),
+                                                          quat<Scalar>(orientation_old[i]));
+            EnergyTerms& new_terms = m_trial_energy_cache.terms[tag];
+            new_terms = computeEnergyTerms(tag,
+                                           vec3<Scalar>(position_new[i]),
+                                           quat<Scalar>(orientation_new[i]),
+                                           m_trial_energy_cache);
+            d_translational += new_terms.translational - old_terms.translational;
+            d_rotational += new_terms.rotational - old_terms.rotational;
             }
+        double dE = (*m_k_translational)(timestep) * d_translational
+                    + (*m_k_rotational)(timestep) * d_rotational;
 
 #ifdef ENABLE_MPI
         if (this->m_sysdef->isDomainDecomposed())
@@ -309,7 +327,8 @@ template<class Shape> class ExternalFieldHarmonic : public ExternalFieldMono<Sha
     /** Compute the total external energy on the system from the external field
      *
      * The return valueis a std::pair, where the 0th item is the translational energy and the
-     * last item is the rotational energy
+     * last item is the rotational energy. Only particles that moved since their terms were cached
+     * are evaluated.
      */
     std::pair<Scalar, Scalar> getEnergies(uint64_t timestep)
         {
@@ -322,13 +341,21 @@ template<class Shape> class ExternalFieldHarmonic : public ExternalFieldMono<Sha
         ArrayHandle<Scalar4> h_orient(m_pdata->getOrientationArray(),
                                       access_location::host,
                                       access_mode::read);
+        ArrayHandle<unsigned int> h_tags(m_pdata->getTags(),
+                                         access_location::host,
+                                         access_mode::read);
+
+        selectEnergyCache(m_pdata->getGlobalBox(), m_pdata->getOrigin());
         for (unsigned int i = 0; i < m_pdata->getN(); i++)
             {
-            vec3<Scalar> position(h_postype.data[i]);
-            quat<Scalar> orientation(h_orient.data[i]);
-            energy_translational += calcE_trans(timestep, i, position);
-            energy_rotational += calcE_rot(timestep, i, orientation);
+            const EnergyTerms& terms = getEnergyTerms(h_tags.data[i],
+                                                      vec3<Scalar>(h_postype.data[i]),
+                                                      quat<Scalar>(h_orient.data[i]));
+            energy_translational += terms.translational;
+            energy_rotational += terms.rotational;
             }
+        energy_translational *= (*m_k_translational)(timestep);
+        energy_rotational *= (*m_k_rotational)(timestep);
 
 #ifdef ENABLE_MPI
         if (this->m_sysdef->isDomainDecomposed())
@@ -356,40 +383,74 @@ template<class Shape> class ExternalFieldHarmonic : public ExternalFieldMono<Sha
                       const vec3<Scalar>& position_new,
                       const Shape& shape_new) override
         {
-        double old_U = calcE(timestep, index, position_old, shape_old),
-               new_U = calcE(timestep, index, position_new, shape_new);
-        return new_U - old_U;
-        }
-
-    protected:
-    //! Calculate the energy associated with the deviation of a single particle from its reference
-    //! position
-    Scalar calcE_trans(uint64_t timestep, const unsigned int& index, const vec3<Scalar>& position)
-        {
         ArrayHandle<unsigned int> h_tags(m_pdata->getTags(),
                                          access_location::host,
                                          access_mode::read);
-        int3 dummy = make_int3(0, 0, 0);
-        vec3<Scalar> origin(m_pdata->getOrigin());
-        const BoxDim box = this->m_pdata->getGlobalBox();
-        vec3<Scalar> r0 = m_reference_positions[h_tags.data[index]];
-        Scalar3 t = vec_to_scalar3(position - origin);
-        box.wrap(t, dummy);
-        vec3<Scalar> shifted_pos(t);
-        vec3<Scalar> dr = vec3<Scalar>(box.minImage(vec_to_scalar3(r0 - position + origin)));
-        Scalar k = (*m_k_translational)(timestep);
-        return Scalar(0.5) * k * dot(dr, dr);
+        const unsigned int tag = h_tags.data[index];
+
+        selectEnergyCache(m_pdata->getGlobalBox(), m_pdata->getOrigin());
+        const EnergyTerms& old_terms = getEnergyTerms(tag, position_old, shape_old.orientation);
+        m_trial_terms
+            = computeEnergyTerms(tag, position_new, shape_new.orientation, m_energy_cache);
+        m_trial_index = index;
+
+        Scalar k_translational = (*m_k_translational)(timestep);
+        Scalar k_rotational = (*m_k_rotational)(timestep);
+        return k_translational * (m_trial_terms.translational - old_terms.translational)
+               + k_rotational * (m_trial_terms.rotational - old_terms.rotational);
+        }
+
+    //! Keep the terms of an accepted single particle move
+    void acceptMove(unsigned int index) override
+        {
+        if (index == m_trial_index && m_trial_terms.frame == m_energy_cache.frame)
+            {
+            ArrayHandle<unsigned int> h_tags(m_pdata->getTags(),
+                                             access_location::host,
+                                             access_mode::read);
+            m_energy_cache.terms[h_tags.data[index]] = m_trial_terms;
+            }
+        m_trial_index = UINT_MAX;
         }
 
-    //! Calculate the energy associated with the deviation of a single particle from its reference
-    //! orientation
-    Scalar calcE_rot(uint64_t timestep, const unsigned int& index, const quat<Scalar>& orientation)
+    protected:
+    //! Energy of one particle without the spring constant factors
+    struct EnergyTerms
+        {
+        vec3<Scalar> position;    //!< Position the terms were evaluated at
+        quat<Scalar> orientation; //!< Orientation the terms were evaluated at
+        Scalar translational = 0; //!< 1/2 |dr|^2
+        Scalar rotational = 0;    //!< 1/2 min |dq|^2 over the symmetry-equivalent orientations
+        uint64_t frame = 0;       //!< Frame of the cache the terms were evaluated in
+        };
+
+    //! Per-particle energy terms evaluated in one box and origin
+    struct EnergyCache
+        {
+        std::vector<EnergyTerms> terms;         //!< Terms indexed by tag
+        BoxDim box;                             //!< Box the terms were evaluated in
+        Scalar3 origin = make_scalar3(0, 0, 0); //!< Origin the terms were evaluated with
+        uint64_t frame = 0;                     //!< Terms with a different frame are stale
+        };
+
+    //! Evaluate the energy terms of the particle with the given tag
+    EnergyTerms computeEnergyTerms(unsigned int tag,
+                                   const vec3<Scalar>& position,
+                                   const quat<Scalar>& orientation,
+                                   const EnergyCache& cache) const
         {
+        EnergyTerms terms;
+        terms.position = position;
+        terms.orientation = orientation;
+        terms.frame = cache.frame;
+
+        vec3<Scalar> origin(cache.origin);
+        vec3<Scalar> dr = vec3<Scalar>(
+            cache.box.minImage(vec_to_scalar3(m_reference_positions[tag] - position + origin)));
+        terms.translational = Scalar(0.5) * dot(dr, dr);
+
         assert(m_symmetry.size());
-        ArrayHandle<unsigned int> h_tags(m_pdata->getTags(),
-                                         access_location::host,
-                                         access_mode::read);
-        quat<Scalar> q0 = m_reference_orientations[h_tags.data[index]];
+        const quat<Scalar>& q0 = m_reference_orientations[tag];
         Scalar dqmin = 0.0;
         for (size_t i = 0; i < m_symmetry.size(); i++)
             {
@@ -397,33 +458,58 @@ template<class Shape> class ExternalFieldHarmonic : public ExternalFieldMono<Sha
             quat<Scalar> dq = q0 - equiv_orientation;
             dqmin = (i == 0) ? norm2(dq) : fmin(dqmin, norm2(dq));
             }
-        Scalar k = (*m_k_rotational)(timestep);
-        return Scalar(0.5) * k * dqmin;
+        terms.rotational = Scalar(0.5) * dqmin;
+        return terms;
         }
 
-    /** Calculate the total energy associated with the deviation of a single particle from its ref.
-     * pos. and orientation
-     *
-     * This function _should_ only be used for logging purposes and not for calculating move
-     * acceptance criteria, since it's the energy difference that matters for the latter.
+    //! Get the energy terms of a particle, evaluating them only if it moved since they were cached
+    /*! selectEnergyCache() must be called first.
      */
-    Scalar calcE(uint64_t timestep,
-                 const unsigned int& index,
-                 const vec3<Scalar>& position,
-                 const quat<Scalar>& orientation)
+    const EnergyTerms& getEnergyTerms(unsigned int tag,
+                                      const vec3<Scalar>& position,
+                                      const quat<Scalar>& orientation)
+        {
+        EnergyTerms& terms = m_energy_cache.terms[tag];
+        if (terms.frame != m_energy_cache.frame || terms.position != position
+            || terms.orientation.s != orientation.s || terms.orientation.v != orientation.v)
+            {
+            terms = computeEnergyTerms(tag, position, orientation, m_energy_cache);
+            }
+        return terms;
+        }
+
+    //! Make the energy cache hold terms evaluated in the given box and origin
+    void selectEnergyCache(const BoxDim& box, const Scalar3& origin)
+        {
+        auto matches = [&box, &origin](const EnergyCache& cache)
         {
-        Scalar energy = 0.0;
-        energy += calcE_trans(timestep, index, position);
-        energy += calcE_rot(timestep, index, orientation);
-        return energy;
+            return cache.box == box && cache.origin.x == origin.x && cache.origin.y == origin.y
+                   && cache.origin.z == origin.z;
+        };
+
+        if (matches(m_energy_cache))
+            {
+            return;
+            }
+
+        // the last box trial move was accepted
+        if (matches(m_trial_energy_cache))
+            {
+            std::swap(m_energy_cache, m_trial_energy_cache);
+            return;
+            }
+
+        m_energy_cache.box = box;
+        m_energy_cache.origin = origin;
+        m_energy_cache.frame = ++m_energy_frame;
         }
 
-    Scalar calcE(uint64_t timestep,
-                 const unsigned int& index,
-                 const vec3<Scalar>& position,
-                 const Shape& shape)
+    //! Mark all cached energy terms stale
+    void invalidateEnergyCache()
         {
-        return calcE(timestep, index, position, shape.orientation);
+        m_energy_cache.frame = ++m_energy_frame;
+        m_trial_energy_cache.frame = ++m_energy_frame;
+        m_trial_index = UINT_MAX;
         }
 
     private:
@@ -432,6 +518,12 @@ template<class Shape> class ExternalFieldHarmonic : public ExternalFieldMono<Sha
     std::vector<quat<Scalar>> m_symmetry;               // symmetry-equivalent orientations
     std::shared_ptr<Variant> m_k_translational;         // translational spring constant
     std::shared_ptr<Variant> m_k_rotational;            // rotational spring constant
+
+    EnergyCache m_energy_cache;            // terms of the current configuration
+    EnergyCache m_trial_energy_cache;      // terms of the last box trial move
+    uint64_t m_energy_frame = 0;           // last frame handed out to a cache
+    EnergyTerms m_trial_terms;             // terms of the last single particle trial move
+    unsigned int m_trial_index = UINT_MAX; // index of the particle in m_trial_terms
     };
 
 namespace detail
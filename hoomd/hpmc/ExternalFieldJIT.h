@@ -10,6 +10,7 @@
 #include "hoomd/VectorMath.h"
 #include "hoomd/hpmc/ExternalField.h"
 
+#include "ClangCompiler.h"
 #include "ExternalFieldEvalFactory.h"
 
 #define EXTERNAL_FIELD_JIT_LOG_NAME "jit_energy"
@@ -51,8 +52,25 @@ template<class Shape> class ExternalFieldJIT : public hpmc::ExternalFieldMono<Sh
                         param_array.data() + param_array.size(),
                         hoomd::detail::managed_allocator<float>(m_exec_conf->isCUDAEnabled()))
         {
+        // compile on the root rank and broadcast the LLVM bitcode to the other ranks
+        std::string bitcode, error;
+        if (m_exec_conf->isRoot())
+            {
+            std::ostringstream out;
+            bitcode
+                = ClangCompiler::getClangCompiler()->compileBitcode(cpu_code, compiler_args, out);
+            error = out.str();
+            }
+#ifdef ENABLE_MPI
+        if (m_exec_conf->getNRanks() > 1)
+            {
+            bcast(bitcode, 0, m_exec_conf->getMPICommunicator());
+            bcast(error, 0, m_exec_conf->getMPICommunicator());
+            }
+#endif
+
         // build the JIT.
-        ExternalFieldEvalFactory* factory = new ExternalFieldEvalFactory(cpu_code, compiler_args);
+        ExternalFieldEvalFactory* factory = new ExternalFieldEvalFactory(bitcode, error);
 
         // get the evaluator
         m_eval = factory->getEval();
@@ -0,0 +1,155 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef _EXTERNAL_FIELD_JIT_GPU_H_
+#define _EXTERNAL_FIELD_JIT_GPU_H_
+
+#ifdef ENABLE_HIP
+
+#include "ExternalFieldJIT.h"
+#include "GPUEvalFactory.h"
+#include <pybind11/stl.h>
+
+#include <vector>
+
+#include "hoomd/Autotuner.h"
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+//! Evaluate external fields via runtime generated code, GPU version
+/*! The CPU code is compiled as in ExternalFieldJIT and evaluates the total energy of the field.
+    The GPU code is compiled with NVRTC into a kernel that rejects the trial moves of
+    IntegratorHPMCMonoGPU with the Metropolis criterion on the change in the field energy.
+*/
+template<class Shape> class ExternalFieldJITGPU : public ExternalFieldJIT<Shape>
+    {
+    public:
+    //! Constructor
+    ExternalFieldJITGPU(std::shared_ptr<SystemDefinition> sysdef,
+                        std::shared_ptr<ExecutionConfiguration> exec_conf,
+                        const std::string& cpu_code,
+                        const std::vector<std::string>& compiler_args,
+                        pybind11::array_t<float> param_array,
+                        const std::string& gpu_code,
+                        const std::string& kernel_name,
+                        const std::vector<std::string>& options,
+                        const std::string& cuda_devrt_library_path,
+                        unsigned int compute_arch)
+        : ExternalFieldJIT<Shape>(sysdef, exec_conf, cpu_code, compiler_args, param_array),
+          m_gpu_factory(exec_conf,
+                        gpu_code,
+                        kernel_name,
+                        options,
+                        cuda_devrt_library_path,
+                        compute_arch)
+        {
+        m_gpu_factory.setAlphaPtr(&this->m_param_array.front(), false);
+
+        m_tuner.reset(new Autotuner<1>({m_gpu_factory.getLaunchBounds()},
+                                       this->m_exec_conf,
+                                       "hpmc_external_field"));
+        this->m_autotuners.push_back(m_tuner);
+        }
+
+    //! Asynchronously launch the JIT kernel
+    /*! \param args Kernel arguments
+        \param hStream stream to execute on
+        */
+    virtual void computeExternalFieldGPU(const ExternalField::gpu_args_t& args, hipStream_t hStream)
+        {
+#ifdef __HIP_PLATFORM_NVCC__
+        // the kernel processes one particle per thread
+        const unsigned int eval_threads = 1;
+        const unsigned int block_size = m_tuner->getParam()[0];
+
+        this->m_exec_conf->beginMultiGPU();
+        m_tuner->begin();
+
+        const unsigned int run_block_size
+            = std::min(block_size,
+                       m_gpu_factory.getKernelMaxThreads(0, eval_threads, block_size));
+
+        auto& gpu_partition = args.gpu_partition;
+        for (int idev = gpu_partition.getNumActiveGPUs() - 1; idev >= 0; --idev)
+            {
+            auto range = gpu_partition.getRangeAndSetGPU(idev);
+            const unsigned int nwork = range.second - range.first;
+            if (nwork == 0)
+                continue;
+
+            dim3 grid((nwork + run_block_size - 1) / run_block_size, 1, 1);
+            dim3 threads(run_block_size, 1, 1);
+
+            auto launcher = m_gpu_factory.configureKernel(idev,
+                                                          grid,
+                                                          threads,
+                                                          0,
+                                                          hStream,
+                                                          eval_threads,
+                                                          block_size);
+
+            CUresult res = launcher(args.d_postype,
+                                    args.d_orientation,
+                                    args.d_trial_postype,
+                                    args.d_trial_orientation,
+                                    args.d_trial_move_type,
+                                    args.d_charge,
+                                    args.d_diameter,
+                                    args.d_reject_out_of_cell,
+                                    args.d_reject_out,
+                                    (unsigned int)args.seed,
+                                    args.timestep,
+                                    args.select,
+                                    args.rank,
+                                    args.global_box,
+                                    args.origin,
+                                    range.first,
+                                    nwork);
+
+            if (res != CUDA_SUCCESS)
+                {
+                char* error;
+                cuGetErrorString(res, const_cast<const char**>(&error));
+                throw std::runtime_error("Error launching NVRTC kernel: " + std::string(error));
+                }
+            }
+
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner->end();
+        this->m_exec_conf->endMultiGPU();
+#endif
+        }
+
+    protected:
+    /// Autotuner for the block size of the kernel.
+    std::shared_ptr<Autotuner<1>> m_tuner;
+
+    private:
+    GPUEvalFactory m_gpu_factory; //!< JIT implementation
+    };
+
+//! Exports the ExternalFieldJITGPU class to python
+template<class Shape> void export_ExternalFieldJITGPU(pybind11::module& m, std::string name)
+    {
+    pybind11::class_<ExternalFieldJITGPU<Shape>,
+                     ExternalFieldJIT<Shape>,
+                     std::shared_ptr<ExternalFieldJITGPU<Shape>>>(m, name.c_str())
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<ExecutionConfiguration>,
+                            const std::string&,
+                            const std::vector<std::string>&,
+                            pybind11::array_t<float>,
+                            const std::string&,
+                            const std::string&,
+                            const std::vector<std::string>&,
+                            const std::string&,
+                            unsigned int>());
+    }
+
+    } // end namespace hpmc
+    } // end namespace hoomd
+#endif
+#endif // _EXTERNAL_FIELD_JIT_GPU_H_
@@ -22,7 +22,11 @@
 #endif
 
 #ifndef __HIPCC__
+#include <map>
 #include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
 #endif
 
 #include "hoomd/ManagedArray.h"
@@ -134,6 +138,69 @@ class GPUTree
 
         m_ancestors[idx] = ancestors;
         }
+
+    //! Recompute the node bounding volumes after particles move, keeping the tree topology
+    /*! \param obbs OBBs of the particles, indexed by particle
+        \param sphere_tree True if the tree was built with bounding spheres for internal nodes
+
+        Children are always stored at larger indices than their parents, so a single reverse sweep
+        visits every child before its parent. Refitting avoids the full build, but the quality of
+        the tree degrades when the particles move far from the arrangement it was built for.
+     */
+    void refit(const OBB* obbs, bool sphere_tree = false)
+        {
+        for (unsigned int i = m_num_nodes; i-- > 0;)
+            {
+            std::vector<OBB> children;
+            if (isLeaf(i))
+                {
+                for (unsigned int j = m_leaf_ptr[i]; j < m_leaf_ptr[i + 1]; ++j)
+                    children.push_back(obbs[m_particles[j]]);
+                }
+            else
+                {
+                // the escape index of the left child is the right child
+                children.push_back(getOBB(m_left[i]));
+                children.push_back(getOBB(m_escape[m_left[i]]));
+                }
+
+            if (children.empty())
+                continue;
+
+            // merge the children as the tree build does
+            OBB node_obb = children[0];
+            if (children.size() > 1)
+                {
+                std::vector<vec3<ShortReal>> pts;
+                std::vector<ShortReal> vertex_radii;
+                unsigned int mask = 0;
+                for (const OBB& child : children)
+                    {
+                    if (child.isSphere())
+                        {
+                        pts.push_back(child.getPosition());
+                        vertex_radii.push_back(child.lengths.x);
+                        }
+                    else
+                        {
+                        std::vector<vec3<ShortReal>> corners = child.getCorners();
+                        pts.insert(pts.end(), corners.begin(), corners.end());
+                        vertex_radii.insert(vertex_radii.end(), corners.size(), ShortReal(0.0));
+                        }
+                    mask |= child.mask;
+                    }
+
+                node_obb = compute_obb(pts, vertex_radii, sphere_tree);
+                node_obb.mask = mask;
+                }
+
+            m_center[i] = node_obb.center;
+            m_lengths[i] = node_obb.lengths;
+            m_rotation[i] = node_obb.rotation;
+            m_mask[i] = node_obb.mask;
+            m_is_sphere[i] = node_obb.is_sphere;
+            }
+        }
 #endif
 
     //! Fetch the next node in the tree and test against overlap
@@ -639,6 +706,55 @@ DEVICE inline bool traverseBinaryStackIntersection(const GPUTree& a,
     return leaf;
     }
 
+#ifndef __HIPCC__
+//! Build a GPUTree over a set of OBBs, reusing previous builds of identical sets
+/*! \param obbs OBBs of the particles
+    \param N Number of particles
+    \param leaf_capacity Capacity of the leaf nodes
+    \param managed True if we use CUDA managed memory
+
+    Shape-polydisperse systems define many types with identical member bounding volumes, and the
+    OBBTree build (a convex hull and covariance fit per node) dominates the cost of setting their
+    parameters. Completed builds are cached on the host, keyed on the exact OBB data, so that
+    identical member sets are only built once.
+*/
+inline GPUTree
+buildCachedGPUTree(const OBB* obbs, unsigned int N, unsigned int leaf_capacity, bool managed)
+    {
+    static std::map<std::string, OBBTree> tree_cache;
+    const size_t max_cached_trees = 16384;
+
+    // key on the raw bytes of the build inputs
+    std::string key(reinterpret_cast<const char*>(&leaf_capacity), sizeof(unsigned int));
+    for (unsigned int i = 0; i < N; ++i)
+        {
+        key.append(reinterpret_cast<const char*>(&obbs[i].lengths), sizeof(vec3<ShortReal>));
+        key.append(reinterpret_cast<const char*>(&obbs[i].center), sizeof(vec3<ShortReal>));
+        key.append(reinterpret_cast<const char*>(&obbs[i].rotation), sizeof(quat<ShortReal>));
+        key.append(reinterpret_cast<const char*>(&obbs[i].mask), sizeof(unsigned int));
+        key.append(reinterpret_cast<const char*>(&obbs[i].is_sphere), sizeof(unsigned int));
+        }
+
+    auto it = tree_cache.find(key);
+    if (it == tree_cache.end())
+        {
+        if (tree_cache.size() >= max_cached_trees)
+            tree_cache.clear();
+
+        // OBBTree is not copyable, construct it in place
+        it = tree_cache
+                 .emplace(std::piecewise_construct, std::forward_as_tuple(key), std::tuple<>())
+                 .first;
+
+        // the build reorders its input
+        std::vector<OBB> build_obbs(obbs, obbs + N);
+        it->second.buildTree(build_obbs.data(), N, leaf_capacity, false);
+        }
+
+    return GPUTree(it->second, managed);
+    }
+#endif
+
     } // end namespace detail
 
     } // end namespace hpmc
@@ -126,33 +126,11 @@ bool IntegratorHPMC::checkParticleOrientations()
 */
 bool IntegratorHPMC::attemptBoxResize(uint64_t timestep, const BoxDim& new_box)
     {
-    unsigned int N = m_pdata->getN();
-
     // Get old and new boxes;
     BoxDim curBox = m_pdata->getGlobalBox();
 
-        // Use lexical scope block to make sure ArrayHandles get cleaned up
-        {
-        // Get particle positions
-        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
-                                   access_location::host,
-                                   access_mode::readwrite);
-
-        // move the particles to be inside the new box
-        for (unsigned int i = 0; i < N; i++)
-            {
-            Scalar3 old_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-
-            // obtain scaled coordinates in the old global box
-            Scalar3 f = curBox.makeFraction(old_pos);
-
-            // scale particles
-            Scalar3 scaled_pos = new_box.makeCoordinates(f);
-            h_pos.data[i].x = scaled_pos.x;
-            h_pos.data[i].y = scaled_pos.y;
-            h_pos.data[i].z = scaled_pos.z;
-            }
-        } // end lexical scope
+    // move the particles to be inside the new box
+    scaleParticles(curBox, new_box);
 
     m_pdata->setGlobalBox(new_box);
 
@@ -166,7 +144,34 @@ bool IntegratorHPMC::attemptBoxResize(uint64_t timestep, const BoxDim& new_box)
     this->communicate(false);
 
     // check overlaps
-    return !this->countOverlaps(true);
+    return !this->checkBoxResizeOverlaps(curBox);
+    }
+
+/*! \param old_box Global box that the positions are in
+    \param new_box Global box to scale the positions to
+
+    Each particle keeps its fractional coordinates in the global box.
+*/
+void IntegratorHPMC::scaleParticles(const BoxDim& old_box, const BoxDim& new_box)
+    {
+    unsigned int N = m_pdata->getN();
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                               access_location::host,
+                               access_mode::readwrite);
+
+    for (unsigned int i = 0; i < N; i++)
+        {
+        Scalar3 old_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+
+        // obtain scaled coordinates in the old global box
+        Scalar3 f = old_box.makeFraction(old_pos);
+
+        // scale particles
+        Scalar3 scaled_pos = new_box.makeCoordinates(f);
+        h_pos.data[i].x = scaled_pos.x;
+        h_pos.data[i].y = scaled_pos.y;
+        h_pos.data[i].z = scaled_pos.z;
+        }
     }
 
 /*! \param mode 0 -> Absolute count, 1 -> relative to the start of the run, 2 -> relative to the
@@ -260,6 +265,7 @@ void export_IntegratorHPMC(pybind11::module& m)
         .def("countOverlaps", &IntegratorHPMC::countOverlaps)
         .def("checkParticleOrientations", &IntegratorHPMC::checkParticleOrientations)
         .def("getMPS", &IntegratorHPMC::getMPS)
+        .def("getUpdateWalltime", &IntegratorHPMC::getUpdateWalltime)
         .def("getCounters", &IntegratorHPMC::getCounters)
         .def("communicate", &IntegratorHPMC::communicate)
         .def("computeTotalPairEnergy", &IntegratorHPMC::computeTotalPairEnergy)
@@ -211,6 +211,7 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
                                                 access_location::host,
                                                 access_mode::read);
         m_count_step_start = h_counters.data[0];
+        m_update_start_time = m_clock.getTime();
         }
 
     //! Change maximum displacement
@@ -337,6 +338,12 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
         return m_mps;
         }
 
+    /// Get the total wall clock time spent in update() since construction (in seconds)
+    double getUpdateWalltime()
+        {
+        return m_update_walltime;
+        }
+
     //! Reset statistics counters
     virtual void resetStats()
         {
@@ -363,6 +370,17 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
         return 0;
         }
 
+    //! Test whether particles scaled from old_box into the current box overlap
+    /*! \param old_box Box the particles were scaled from
+
+        The default implementation counts overlaps with an early exit. Subclasses may decide from
+        cheaper tests first.
+    */
+    virtual bool checkBoxResizeOverlaps(const BoxDim& old_box)
+        {
+        return this->countOverlaps(true);
+        }
+
     //! Get the number of degrees of freedom granted to a given group
     /*! \param group Group over which to count degrees of freedom.
         \return a non-zero dummy value to suppress warnings.
@@ -558,6 +576,16 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
     /// Moves-per-second value last recorded
     double m_mps = 0;
 
+    /** Add the time since the start of the current update() to the total update wall time
+
+        Derived classes call this at the end of update() after they read the counters, which
+        synchronizes with the GPU.
+    */
+    void recordUpdateWalltime()
+        {
+        m_update_walltime += double(m_clock.getTime() - m_update_start_time) / 1e9;
+        }
+
     ExternalField* m_external_base; //! This is a cast of the derived class's m_external that can be
                                     //! used in a more general setting.
 
@@ -574,6 +602,9 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
         return Scalar(0.0);
         }
 
+    //! Scale the local particle positions from one global box to another
+    virtual void scaleParticles(const BoxDim& old_box, const BoxDim& new_box);
+
 #ifdef ENABLE_MPI
     //! Return the requested communication flags for ghost particles
     virtual CommFlags getCommFlags(uint64_t timestep)
@@ -594,6 +625,9 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
     private:
     hpmc_counters_t m_count_run_start;  //!< Count saved at run() start
     hpmc_counters_t m_count_step_start; //!< Count saved at the start of the last step
+
+    int64_t m_update_start_time = 0; //!< Clock time at the start of the last step
+    double m_update_walltime = 0;    //!< Total wall time spent in update() (in seconds)
     };
 
 namespace detail
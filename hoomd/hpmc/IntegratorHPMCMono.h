@@ -9,6 +9,7 @@
     \brief Declaration of IntegratorHPMC
 */
 
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -16,6 +17,7 @@
 #include "hoomd/Integrator.h"
 #include "IntegratorHPMC.h"
 #include "Moves.h"
+#include "SeparatingAxisCache.h"
 #include "hoomd/AABBTree.h"
 #include "GSDHPMCSchema.h"
 #include "hoomd/Index1D.h"
@@ -253,6 +255,19 @@ class IntegratorHPMCMono : public IntegratorHPMC
             this->m_external_base = (ExternalField*)external.get();
             }
 
+        //! Set whether to cache separating axes between sweeps
+        void setCacheSeparatingAxes(bool cache_separating_axes)
+            {
+            m_cache_separating_axes = cache_separating_axes;
+            m_separating_axis_cache.clear();
+            }
+
+        //! Get whether to cache separating axes between sweeps
+        bool getCacheSeparatingAxes() const
+            {
+            return m_cache_separating_axes;
+            }
+
         //! Get the particle parameters
         virtual std::vector<param_type, hoomd::detail::managed_allocator<param_type> >& getParams()
             {
@@ -274,6 +289,9 @@ class IntegratorHPMCMono : public IntegratorHPMC
         //! Count overlaps with the option to exit early at the first detected overlap
         virtual unsigned int countOverlaps(bool early_exit);
 
+        //! Test for overlaps after a box resize, trying the shortcuts first
+        virtual bool checkBoxResizeOverlaps(const BoxDim& old_box);
+
         //! Return a vector that is an unwrapped overlap map
         virtual std::vector<std::pair<unsigned int, unsigned int> > mapOverlaps();
 
@@ -445,9 +463,36 @@ class IntegratorHPMCMono : public IntegratorHPMC
         hoomd::detail::AABB* m_aabbs;                      //!< list of AABBs, one per particle
         unsigned int m_aabbs_capacity;              //!< Capacity of m_aabbs list
         bool m_aabb_tree_invalid;                   //!< Flag if the aabb tree has been invalidated
+        bool m_aabb_tree_moved;                     //!< Flag if particles moved since the last build or refit
+        Scalar m_aabb_tree_build_area;              //!< Surface area of the tree when it was built
+
+        //! Rebuild the tree when a refit grows its surface area by more than this factor
+        static constexpr Scalar m_aabb_tree_rebuild_factor = Scalar(1.5);
 
         Scalar m_extra_image_width;                 //! Extra width to extend the image list
 
+        std::vector<std::pair<unsigned int, unsigned int> > m_overlap_hints; //!< Tags of recently overlapping pairs, newest first
+
+        //! Number of recently overlapping pairs tested before the full overlap check
+        static constexpr unsigned int m_max_overlap_hints = 8;
+
+        //! Remember an overlapping pair to test first on the next box resize
+        void addOverlapHint(unsigned int tag_i, unsigned int tag_j);
+
+        //! Test whether any recently overlapping pair overlaps in the current configuration
+        bool checkOverlapHints();
+
+        bool m_cache_separating_axes;                         //!< True to seed overlap tests with cached axes
+        detail::SeparatingAxisCache m_separating_axis_cache;  //!< Last separating axis of each pair
+
+        uint3 m_checkerboard_dim;                                //!< Number of checkerboard cells along each direction
+        Scalar3 m_checkerboard_shift;                            //!< Fractional shift of the cell grid in this sweep
+        std::vector<unsigned int> m_checkerboard_colors;         //!< Order of the cell colors in this sweep
+        std::vector<unsigned int> m_checkerboard_cell;           //!< Cell of each local particle
+        std::vector<unsigned int> m_checkerboard_cell_start;     //!< First entry of each cell in the particle list
+        std::vector<unsigned int> m_checkerboard_cell_insert;    //!< Insertion point of each cell (temporary)
+        std::vector<unsigned int> m_checkerboard_particles;      //!< Local particles grouped by cell in update order
+
         Index2D m_overlap_idx;                      //!!< Indexer for interaction matrix
 
         /// Cached maximum pair additive cutoff by type.
@@ -478,6 +523,39 @@ class IntegratorHPMCMono : public IntegratorHPMC
         //! Grow the m_aabbs list
         virtual void growAABBList(unsigned int N);
 
+        //! Choose the checkerboard cell grid for parallel sweeps
+        bool setupCheckerboard(const BoxDim& box, unsigned int ndim);
+
+        //! Assign particles to checkerboard cells for one sweep
+        void assignCheckerboardCells(uint64_t timestep, unsigned int select, const BoxDim& box,
+            const Scalar4 *h_postype, const Scalar *h_d);
+
+        //! Get the checkerboard cell that contains a position
+        unsigned int computeCheckerboardCell(const vec3<Scalar>& pos, const BoxDim& box) const;
+
+        //! Test for overlap, seeded with the separating axis from the last test of the same pair
+        bool testOverlapCached(const vec3<Scalar>& r_ij, const Shape& shape_i, const Shape& shape_j,
+            unsigned int tag_i, unsigned int tag_j, unsigned int& err_count)
+            {
+            vec3<ShortReal> axis = m_separating_axis_cache.lookup(tag_i, tag_j);
+            bool overlap = test_overlap_cached(r_ij, shape_i, shape_j, axis, err_count);
+            if (!overlap)
+                m_separating_axis_cache.store(tag_i, tag_j, axis);
+            return overlap;
+            }
+
+        //! Test if particle j is in a different cell of the same color as particle i
+        bool inOtherActiveCell(unsigned int i, unsigned int j) const
+            {
+            // ghost particles never move
+            if (j >= m_checkerboard_cell.size())
+                return false;
+
+            unsigned int cell_i = m_checkerboard_cell[i];
+            unsigned int cell_j = m_checkerboard_cell[j];
+            return cell_i != cell_j && (cell_i & 7) == (cell_j & 7);
+            }
+
         //! Limit the maximum move distances
         virtual void limitMoveDistances();
 
@@ -506,6 +584,7 @@ IntegratorHPMCMono<Shape>::IntegratorHPMCMono(std::shared_ptr<SystemDefinition>
               m_image_list_valid(false),
               m_hasOrientation(true),
               m_extra_image_width(0.0),
+              m_cache_separating_axes(false),
               m_fugacity(m_exec_conf),
               m_ntrial(m_exec_conf)
     {
@@ -535,6 +614,11 @@ IntegratorHPMCMono<Shape>::IntegratorHPMCMono(std::shared_ptr<SystemDefinition>
     m_aabbs = NULL;
     m_aabbs_capacity = 0;
     m_aabb_tree_invalid = true;
+    m_aabb_tree_moved = false;
+    m_aabb_tree_build_area = Scalar(0.0);
+
+    m_checkerboard_dim = make_uint3(0, 0, 0);
+    m_checkerboard_shift = make_scalar3(0, 0, 0);
 
     m_fugacity.resize(this->m_pdata->getNTypes(), 0.0);
     m_ntrial.resize(m_fugacity.getNumElements(), 1);
@@ -645,6 +729,19 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
             }
         }
 
+    // Move particles in independent checkerboard cells concurrently when threads are available.
+    // Depletants and external fields are not thread safe, so they require the serial sweep.
+    bool use_checkerboard = false;
+    #ifdef ENABLE_TBB
+    use_checkerboard = m_exec_conf->getNumThreads() > 1 && !has_depletants && !m_external
+                       && setupCheckerboard(box, ndim);
+    #endif
+
+    // The separating axis cache is not thread safe
+    const bool cache_axes = m_cache_separating_axes && !use_checkerboard;
+    if (cache_axes)
+        m_separating_axis_cache.reserve(m_pdata->getN() + m_pdata->getNGhosts());
+
     // Combine the three seeds to generate RNG for poisson distribution
     hoomd::RandomGenerator rng_depletants(hoomd::Seed(hoomd::RNGIdentifier::HPMCDepletants,
                                                       timestep,
@@ -685,11 +782,9 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
         ArrayHandle<Scalar> h_d(m_d, access_location::host, access_mode::read);
         ArrayHandle<Scalar> h_a(m_a, access_location::host, access_mode::read);
 
-        // loop through N particles in a shuffled order
-        for (unsigned int cur_particle = 0; cur_particle < m_pdata->getN(); cur_particle++)
+        // attempt a trial move of particle i
+        auto trial_move = [&](unsigned int i, hpmc_counters_t& counters)
             {
-            unsigned int i = m_update_order[cur_particle];
-
             // read in the current position and orientation
             Scalar4 postype_i = h_postype.data[i];
             vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
@@ -699,7 +794,7 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                 {
                 // only move particle if active
                 if (!isActive(make_scalar3(postype_i.x, postype_i.y, postype_i.z), box, ghost_fraction))
-                    continue;
+                    return;
                 }
             #endif
 
@@ -721,7 +816,7 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                     {
                     if (!shape_i.ignoreStatistics())
                         counters.translate_accept_count++;
-                    continue;
+                    return;
                     }
 
                 move_translate(pos_i, rng_i, h_d.data[typ_i], ndim);
@@ -731,9 +826,13 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                     {
                     // check if particle has moved into the ghost layer, and skip if it is
                     if (!isActive(vec_to_scalar3(pos_i), box, ghost_fraction))
-                        continue;
+                        return;
                     }
                 #endif
+
+                // skip moves that leave the checkerboard cell
+                if (use_checkerboard && computeCheckerboardCell(pos_i, box) != m_checkerboard_cell[i])
+                    return;
                 }
             else
                 {
@@ -741,7 +840,7 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                     {
                     if (!shape_i.ignoreStatistics())
                         counters.rotate_accept_count++;
-                    continue;
+                    return;
                     }
 
                 if (ndim == 2)
@@ -789,6 +888,10 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                                 // read in its position and orientation
                                 unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
 
+                                // particles in other active cells are out of range and may be moving
+                                if (use_checkerboard && inOtherActiveCell(i, j))
+                                    continue;
+
                                 Scalar4 postype_j;
                                 quat<LongReal> orientation_j;
 
@@ -826,7 +929,9 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                                 counters.overlap_checks++;
                                 if (h_overlaps.data[m_overlap_idx(typ_i, typ_j)]
                                     && r_squared < max_overlap_distance * max_overlap_distance
-                                    && test_overlap(r_ij, shape_i, shape_j, counters.overlap_err_count))
+                                    && (cache_axes ? testOverlapCached(r_ij, shape_i, shape_j, h_tag.data[i],
+                                                                       h_tag.data[j], counters.overlap_err_count)
+                                                   : test_overlap(r_ij, shape_i, shape_j, counters.overlap_err_count)))
                                     {
                                     overlap = true;
                                     break;
@@ -880,6 +985,10 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                                     // read in its position and orientation
                                     unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
 
+                                    // particles in other active cells are out of range and may be moving
+                                    if (use_checkerboard && inOtherActiveCell(i, j))
+                                        continue;
+
                                     Scalar4 postype_j;
                                     quat<LongReal> orientation_j;
 
@@ -956,6 +1065,9 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
             // trial move and update positions  and/or orientations.
             if (accept)
                 {
+                if (m_external)
+                    m_external->acceptMove(i);
+
                 // increment accept counter and assign new position
                 if (!shape_i.ignoreStatistics())
                     {
@@ -965,20 +1077,24 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                         counters.rotate_accept_count++;
                     }
 
-                // update the position of the particle in the tree for future updates
-                hoomd::detail::AABB aabb;
-                if (!hasPairInteractions())
-                    {
-                    aabb = shape_i.getAABB(pos_i);
-                    }
-                else
+                // update the position of the particle in the tree for future updates. Checkerboard
+                // sweeps cannot modify the shared tree, which already bounds every possible move.
+                if (!use_checkerboard)
                     {
-                    Scalar radius = std::max(m_shape_circumsphere_radius[typ_i],
-                        LongReal(0.5) * m_max_pair_additive_cutoff[typ_i]);
-                    aabb = hoomd::detail::AABB(pos_i, radius);
-                    }
+                    hoomd::detail::AABB aabb;
+                    if (!hasPairInteractions())
+                        {
+                        aabb = shape_i.getAABB(pos_i);
+                        }
+                    else
+                        {
+                        Scalar radius = std::max(m_shape_circumsphere_radius[typ_i],
+                            LongReal(0.5) * m_max_pair_additive_cutoff[typ_i]);
+                        aabb = hoomd::detail::AABB(pos_i, radius);
+                        }
 
-                m_aabb_tree.update(i, aabb);
+                    m_aabb_tree.update(i, aabb);
+                    }
 
                 // update position of particle
                 h_postype.data[i] = make_scalar4(pos_i.x,pos_i.y,pos_i.z,postype_i.w);
@@ -1003,7 +1119,47 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                         counters.rotate_reject_count++;
                     }
                 }
-            } // end loop over all particles
+            };
+
+        #ifdef ENABLE_TBB
+        if (use_checkerboard)
+            {
+            assignCheckerboardCells(timestep, i_nselect, box, h_postype.data, h_d.data);
+
+            // cells of one color are independent, visit the colors one after another
+            const unsigned int n_cells = (unsigned int)m_checkerboard_cell_start.size() - 1;
+            tbb::enumerable_thread_specific<hpmc_counters_t> thread_counters;
+            m_exec_conf->getTaskArena()->execute([&]{
+            for (unsigned int color : m_checkerboard_colors)
+                {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_cells / 8),
+                    [&](const tbb::blocked_range<unsigned int>& r)
+                    {
+                    hpmc_counters_t& local_counters = thread_counters.local();
+                    for (unsigned int sub = r.begin(); sub != r.end(); ++sub)
+                        {
+                        unsigned int cell = (sub << 3) | color;
+                        for (unsigned int k = m_checkerboard_cell_start[cell];
+                             k < m_checkerboard_cell_start[cell + 1]; k++)
+                            {
+                            trial_move(m_checkerboard_particles[k], local_counters);
+                            }
+                        }
+                    });
+                }
+            });
+
+            for (const auto& local_counters : thread_counters)
+                counters = counters + local_counters;
+            continue;
+            }
+        #endif
+
+        // loop through N particles in a shuffled order
+        for (unsigned int cur_particle = 0; cur_particle < m_pdata->getN(); cur_particle++)
+            {
+            trial_move(m_update_order[cur_particle], counters);
+            }
         } // end loop over nselect
 
         {
@@ -1050,13 +1206,14 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
     // migrate and exchange particles
     communicate(true);
 
-    // all particle have been moved, the aabb tree is now invalid
-    m_aabb_tree_invalid = true;
+    // all particle have been moved, refit the aabb tree before the next use
+    m_aabb_tree_moved = true;
 
     // set current MPS value
     hpmc_counters_t run_counters = getCounters(1);
     double cur_time = double(m_clock.getTime()) / Scalar(1e9);
     m_mps = double(run_counters.getNMoves()) / cur_time;
+    recordUpdateWalltime();
     }
 
 /*! \param timestep current step
@@ -1136,6 +1293,8 @@ unsigned int IntegratorHPMCMono<Shape>::countOverlaps(bool early_exit)
                                 overlap_count++;
                                 if (early_exit)
                                     {
+                                    addOverlapHint(h_tag.data[i], h_tag.data[j]);
+
                                     // exit early from loop over neighbor particles
                                     break;
                                     }
@@ -1179,6 +1338,134 @@ unsigned int IntegratorHPMCMono<Shape>::countOverlaps(bool early_exit)
     return overlap_count;
     }
 
+/*! Uniform expansions of shapes that stay apart under expansion need no test at all, and most
+    rejected compressions are blocked by a pair that overlapped in a previous attempt, so those are
+    tested before the full overlap check.
+
+    \param old_box Box the particles were scaled from
+    \returns true if there are overlaps in the current configuration
+*/
+template<class Shape>
+bool IntegratorHPMCMono<Shape>::checkBoxResizeOverlaps(const BoxDim& old_box)
+    {
+    const BoxDim box = m_pdata->getGlobalBox();
+
+    // an expansion of an untilted box scales every separation by a diagonal matrix >= 1
+    if (expansion_preserves_separation<Shape>())
+        {
+        Scalar3 L_old = old_box.getL();
+        Scalar3 L_new = box.getL();
+        bool expanded = L_new.x >= L_old.x && L_new.y >= L_old.y && L_new.z >= L_old.z;
+        bool untilted = old_box.getTiltFactorXY() == 0 && old_box.getTiltFactorXZ() == 0
+            && old_box.getTiltFactorYZ() == 0 && box.getTiltFactorXY() == 0
+            && box.getTiltFactorXZ() == 0 && box.getTiltFactorYZ() == 0;
+        if (expanded && untilted)
+            {
+            return false;
+            }
+        }
+
+    if (checkOverlapHints())
+        {
+        return true;
+        }
+
+    return countOverlaps(true);
+    }
+
+template<class Shape>
+void IntegratorHPMCMono<Shape>::addOverlapHint(unsigned int tag_i, unsigned int tag_j)
+    {
+    auto hint = std::make_pair(tag_i, tag_j);
+    auto it = std::find(m_overlap_hints.begin(), m_overlap_hints.end(), hint);
+    if (it != m_overlap_hints.end())
+        {
+        m_overlap_hints.erase(it);
+        }
+    else if (m_overlap_hints.size() == m_max_overlap_hints)
+        {
+        m_overlap_hints.pop_back();
+        }
+    m_overlap_hints.insert(m_overlap_hints.begin(), hint);
+    }
+
+/*! Pairs are tested at their minimum image separation. Pairs with a particle that is neither local
+    nor a ghost on this rank are skipped.
+
+    Hints are recorded only on the rank that found the overlap, so with domain decomposition the
+    ranks first agree whether any of them holds hints. Every rank then takes the same path and
+    reaches the same collectives.
+
+    \returns true if any pair overlaps
+*/
+template<class Shape>
+bool IntegratorHPMCMono<Shape>::checkOverlapHints()
+    {
+    if (m_pdata->getNGlobal() == 0)
+        return false;
+
+    unsigned int has_hints = m_overlap_hints.size() > 0;
+    #ifdef ENABLE_MPI
+    if (this->m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE, &has_hints, 1, MPI_UNSIGNED, MPI_MAX, m_exec_conf->getMPICommunicator());
+        }
+    #endif
+
+    if (!has_hints)
+        return false;
+
+    const BoxDim box = m_pdata->getGlobalBox();
+    const unsigned int N_total = m_pdata->getN() + m_pdata->getNGhosts();
+    const unsigned int max_tag = m_pdata->getMaximumTag();
+    unsigned int err_count = 0;
+    unsigned int overlap = 0;
+
+        {
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_overlaps(m_overlaps, access_location::host, access_mode::read);
+
+        for (const auto& hint : m_overlap_hints)
+            {
+            if (hint.first > max_tag || hint.second > max_tag)
+                continue;
+
+            unsigned int i = h_rtag.data[hint.first];
+            unsigned int j = h_rtag.data[hint.second];
+            if (i >= N_total || j >= N_total)
+                continue;
+
+            Scalar4 postype_i = h_postype.data[i];
+            Scalar4 postype_j = h_postype.data[j];
+            unsigned int typ_i = __scalar_as_int(postype_i.w);
+            unsigned int typ_j = __scalar_as_int(postype_j.w);
+            Shape shape_i(quat<Scalar>(h_orientation.data[i]), m_params[typ_i]);
+            Shape shape_j(quat<Scalar>(h_orientation.data[j]), m_params[typ_j]);
+
+            vec3<Scalar> r_ij(box.minImage(vec_to_scalar3(vec3<Scalar>(postype_j) - vec3<Scalar>(postype_i))));
+            if (h_overlaps.data[m_overlap_idx(typ_i,typ_j)]
+                && check_circumsphere_overlap(r_ij, shape_i, shape_j)
+                && test_overlap(r_ij, shape_i, shape_j, err_count)
+                && test_overlap(-r_ij, shape_j, shape_i, err_count))
+                {
+                overlap = 1;
+                break;
+                }
+            }
+        }
+
+    #ifdef ENABLE_MPI
+    if (this->m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE, &overlap, 1, MPI_UNSIGNED, MPI_MAX, m_exec_conf->getMPICommunicator());
+        }
+    #endif
+
+    return overlap;
+    }
+
 template<class Shape>
 double IntegratorHPMCMono<Shape>::computeTotalPairEnergy(uint64_t timestep)
     {
@@ -1697,28 +1984,173 @@ void IntegratorHPMCMono<Shape>::growAABBList(unsigned int N)
         }
     }
 
+/*! \param box Local simulation box
+    \param ndim Number of dimensions
+    \returns true when the box holds at least two cells along every direction
+
+    Checkerboard sweeps split the local box into an even number of cells along each direction and color
+    each cell by the parity of its coordinates. Moves that leave a cell are rejected, so particles in two
+    cells of the same color are always separated by at least one cell width. The cells are wider than
+    twice the interaction range plus the largest move size, which keeps the fraction of rejected
+    out-of-cell moves small. The cell width is also at least the volume per particle, which bounds the
+    number of cells for small particles.
+*/
+template <class Shape>
+bool IntegratorHPMCMono<Shape>::setupCheckerboard(const BoxDim& box, unsigned int ndim)
+    {
+    const unsigned int N = m_pdata->getN();
+    if (N == 0)
+        return false;
+
+    Scalar d_max(0.0);
+        {
+        ArrayHandle<Scalar> h_d(m_d, access_location::host, access_mode::read);
+        for (unsigned int typ = 0; typ < m_pdata->getNTypes(); typ++)
+            d_max = std::max(d_max, h_d.data[typ]);
+        }
+
+    Scalar width = Scalar(2.0) * m_nominal_width + d_max;
+    width = std::max(width, slow::pow(box.getVolume(ndim == 2) / Scalar(N), Scalar(1.0) / Scalar(ndim)));
+    if (!(width > Scalar(0.0)))
+        return false;
+
+    // the number of cells must be even so that periodic neighbors have different colors
+    auto n_cells = [width](Scalar L)
+        {
+        unsigned int n = (unsigned int)(L / width);
+        return n - n % 2;
+        };
+
+    Scalar3 npd = box.getNearestPlaneDistance();
+    m_checkerboard_dim = make_uint3(n_cells(npd.x), n_cells(npd.y), ndim == 2 ? 1 : n_cells(npd.z));
+
+    return m_checkerboard_dim.x >= 2 && m_checkerboard_dim.y >= 2
+           && (ndim == 2 || m_checkerboard_dim.z >= 2);
+    }
+
+/*! \param timestep Current time step
+    \param select Index of the sweep within the time step
+    \param box Local simulation box
+    \param h_postype Particle positions and types
+    \param h_d Maximum move displacement by type
+
+    Randomly shift the cell grid and the order of the colors, then group the local particles by cell
+    while keeping the shuffled update order within each cell. The random shift and color order
+    restore the balance condition that a fixed set of cells would break.
+
+    Refit the AABB tree to boxes that enclose every position each particle may reach in the sweep,
+    so the concurrent moves do not need to update the shared tree.
+*/
+template <class Shape>
+void IntegratorHPMCMono<Shape>::assignCheckerboardCells(uint64_t timestep, unsigned int select,
+    const BoxDim& box, const Scalar4 *h_postype, const Scalar *h_d)
+    {
+    hoomd::RandomGenerator rng(hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoCheckerboard, timestep,
+                                           m_sysdef->getSeed()),
+                               hoomd::Counter(m_exec_conf->getRank(), select));
+    hoomd::UniformDistribution<Scalar> uniform(Scalar(0.0), Scalar(1.0));
+    m_checkerboard_shift.x = uniform(rng);
+    m_checkerboard_shift.y = uniform(rng);
+    m_checkerboard_shift.z = m_checkerboard_dim.z > 1 ? uniform(rng) : Scalar(0.0);
+
+    unsigned int n_colors = m_checkerboard_dim.z > 1 ? 8 : 4;
+    m_checkerboard_colors.resize(n_colors);
+    for (unsigned int color = 0; color < n_colors; color++)
+        m_checkerboard_colors[color] = color;
+    for (unsigned int k = n_colors - 1; k > 0; k--)
+        std::swap(m_checkerboard_colors[k], m_checkerboard_colors[hoomd::UniformIntDistribution(k)(rng)]);
+
+    // the low 3 bits of the cell index hold the color
+    const unsigned int n_cells = 8 * (m_checkerboard_dim.x / 2) * (m_checkerboard_dim.y / 2)
+                                 * std::max(m_checkerboard_dim.z / 2, 1u);
+    const unsigned int N = m_pdata->getN();
+    m_checkerboard_cell.resize(N);
+    m_checkerboard_cell_start.assign(n_cells + 1, 0);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        unsigned int cell = computeCheckerboardCell(vec3<Scalar>(h_postype[i]), box);
+        m_checkerboard_cell[i] = cell;
+        m_checkerboard_cell_start[cell + 1]++;
+        }
+    for (unsigned int cell = 0; cell < n_cells; cell++)
+        m_checkerboard_cell_start[cell + 1] += m_checkerboard_cell_start[cell];
+
+    m_checkerboard_cell_insert.assign(m_checkerboard_cell_start.begin(), m_checkerboard_cell_start.end() - 1);
+    m_checkerboard_particles.resize(N);
+    for (unsigned int cur_particle = 0; cur_particle < N; cur_particle++)
+        {
+        unsigned int i = m_update_order[cur_particle];
+        m_checkerboard_particles[m_checkerboard_cell_insert[m_checkerboard_cell[i]]++] = i;
+        }
+
+    // each particle moves at most once and by at most h_d in a sweep, ghosts do not move
+    const unsigned int n_aabb = N + m_pdata->getNGhosts();
+    assert(m_aabb_tree.getNumParticles() == n_aabb);
+    for (unsigned int i = 0; i < n_aabb; i++)
+        {
+        unsigned int typ_i = __scalar_as_int(h_postype[i].w);
+        Scalar radius = m_shape_circumsphere_radius[typ_i];
+        if (hasPairInteractions())
+            radius = std::max(radius, Scalar(LongReal(0.5) * m_max_pair_additive_cutoff[typ_i]));
+        if (i < N)
+            radius += h_d[typ_i];
+        m_aabbs[i] = hoomd::detail::AABB(vec3<Scalar>(h_postype[i]), radius);
+        }
+    m_aabb_tree.refit(m_aabbs, n_aabb);
+    m_aabb_tree_moved = true;
+    }
+
+/*! \param pos Position in the local box
+    \param box Local simulation box
+    \returns Index of the cell with the color in the low 3 bits
+*/
+template <class Shape>
+unsigned int IntegratorHPMCMono<Shape>::computeCheckerboardCell(const vec3<Scalar>& pos,
+    const BoxDim& box) const
+    {
+    Scalar3 f = box.makeFraction(vec_to_scalar3(pos)) + m_checkerboard_shift;
+
+    auto wrap = [](Scalar f, unsigned int n)
+        {
+        int c = int(slow::floor(f * Scalar(n))) % int(n);
+        return (unsigned int)(c < 0 ? c + int(n) : c);
+        };
+
+    unsigned int x = wrap(f.x, m_checkerboard_dim.x);
+    unsigned int y = wrap(f.y, m_checkerboard_dim.y);
+    unsigned int z = m_checkerboard_dim.z > 1 ? wrap(f.z, m_checkerboard_dim.z) : 0;
+
+    unsigned int color = (x & 1) | ((y & 1) << 1) | ((z & 1) << 2);
+    unsigned int sub = (x >> 1) + (m_checkerboard_dim.x / 2) * ((y >> 1) + (m_checkerboard_dim.y / 2) * (z >> 1));
+    return (sub << 3) | color;
+    }
+
 
 /*! Call any time an up to date AABB tree is needed. IntegratorHPMCMono internally tracks whether
     the tree needs to be rebuilt or if the current tree can be used.
 
-    buildAABBTree() relies on the member variable m_aabb_tree_invalid to work correctly. Any time particles
-    are moved (and not updated with m_aabb_tree->update()) or the particle list changes order, m_aabb_tree_invalid
-    needs to be set to true. Then buildAABBTree() will know to rebuild the tree from scratch on the next call. Typically
-    this is on the next timestep. But in some cases (i.e. NPT), the tree may need to be rebuilt several times in a
-    single step because of box volume moves.
+    buildAABBTree() relies on the member variable m_aabb_tree_invalid to work correctly. Any time the particle list
+    changes order, m_aabb_tree_invalid needs to be set to true. Then buildAABBTree() will know to rebuild the tree
+    from scratch on the next call. Typically this is on the next timestep. But in some cases (i.e. NPT), the tree may
+    need to be rebuilt several times in a single step because of box volume moves.
+
+    When particles move (and are not updated with m_aabb_tree->update()) but keep their order, set m_aabb_tree_moved
+    instead. buildAABBTree() then refits the existing tree to the new AABBs, which is much cheaper than a build for
+    the small moves of a typical sweep. The refit keeps the topology of the original build, so buildAABBTree()
+    rebuilds the tree when the refit grows the total node surface area beyond m_aabb_tree_rebuild_factor times its
+    value after the last build.
 
-    Subclasses that override update() or other methods must be user to set m_aabb_tree_invalid appropriately, or
-    erroneous simulations will result.
+    Subclasses that override update() or other methods must be user to set m_aabb_tree_invalid or m_aabb_tree_moved
+    appropriately, or erroneous simulations will result.
 
     \returns A reference to the tree.
 */
 template <class Shape>
 const hoomd::detail::AABBTree& IntegratorHPMCMono<Shape>::buildAABBTree()
     {
-    if (m_aabb_tree_invalid)
+    if (m_aabb_tree_invalid || m_aabb_tree_moved)
         {
-        m_exec_conf->msg->notice(8) << "Building AABB tree: " << m_pdata->getN() << " ptls " << m_pdata->getNGhosts() << " ghosts" << std::endl;
-        // build the AABB tree
+        // build or refit the AABB tree
             {
             ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
             ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::read);
@@ -1754,13 +2186,33 @@ const hoomd::detail::AABBTree& IntegratorHPMCMono<Shape>::buildAABBTree()
                         m_aabbs[i] = hoomd::detail::AABB(vec3<Scalar>(h_postype.data[i]), radius);
                         }
                     }
-                m_aabb_tree.buildTree(m_aabbs, n_aabb);
+
+                // refit when the particles have only moved and the tree quality is still acceptable
+                bool rebuild = m_aabb_tree_invalid || m_aabb_tree.getNumParticles() != n_aabb;
+                if (!rebuild)
+                    {
+                    m_aabb_tree.refit(m_aabbs, n_aabb);
+                    rebuild = m_aabb_tree.getSurfaceArea()
+                              > m_aabb_tree_rebuild_factor * m_aabb_tree_build_area;
+                    }
+
+                if (rebuild)
+                    {
+                    m_exec_conf->msg->notice(8) << "Building AABB tree: " << m_pdata->getN() << " ptls " << m_pdata->getNGhosts() << " ghosts" << std::endl;
+                    #ifdef ENABLE_TBB
+                    m_aabb_tree.buildTree(m_aabbs, n_aabb, *m_exec_conf->getTaskArena());
+                    #else
+                    m_aabb_tree.buildTree(m_aabbs, n_aabb);
+                    #endif
+                    m_aabb_tree_build_area = m_aabb_tree.getSurfaceArea();
+                    }
                 }
             }
 
         }
 
     m_aabb_tree_invalid = false;
+    m_aabb_tree_moved = false;
     return m_aabb_tree;
     }
 
@@ -2247,6 +2699,17 @@ inline bool IntegratorHPMCMono<Shape>::checkDepletantOverlap(unsigned int i, vec
                     if (shape_test_a.hasOrientation())
                         shape_test_a.orientation = o;
 
+                    // Depletants in the excluded volume of both the old and the new configuration of
+                    // particle i contribute equally to the numerator and the denominator. Only sample
+                    // the symmetric difference of the two excluded volumes and discard the
+                    // depletants inside the insphere of the other configuration before any overlap check.
+                    vec3<Scalar> r_i_test_other = pos_test - (new_config ? pos_i_old : pos_i);
+                    const Shape& shape_other = new_config ? shape_old : shape_i;
+                    if (check_insphere_overlap(r_i_test_other, shape_other, shape_test_a))
+                        {
+                        continue;
+                        }
+
                     // Check if the new (old) configuration of particle i generates an overlap
                     bool overlap_i_a = false;
                     vec3<Scalar> r_i_test = pos_test - (new_config ? pos_i : pos_i_old);
@@ -2266,8 +2729,9 @@ inline bool IntegratorHPMCMono<Shape>::checkDepletantOverlap(unsigned int i, vec
                             #endif
 
                             unsigned int err = 0;
-                            if (circumsphere_overlap &&
-                                test_overlap(r_i_test, shape, shape_test_a, err))
+                            if (check_insphere_overlap(r_i_test, shape, shape_test_a) ||
+                                (circumsphere_overlap &&
+                                 test_overlap(r_i_test, shape, shape_test_a, err)))
                                 {
                                 overlap_i_a = true;
                                 }
@@ -2286,6 +2750,29 @@ inline bool IntegratorHPMCMono<Shape>::checkDepletantOverlap(unsigned int i, vec
                         continue;
                         }
 
+                    // reject if the other configuration of particle i overlaps, too
+                        {
+                        #ifdef ENABLE_TBB
+                        thread_counters.local().overlap_checks++;
+                        #else
+                        counters.overlap_checks++;
+                        #endif
+
+                        unsigned int err = 0;
+                        bool overlap_i_other_a = check_circumsphere_overlap(r_i_test_other, shape_other, shape_test_a)
+                            && test_overlap(r_i_test_other, shape_other, shape_test_a, err);
+
+                        if (err)
+                        #ifdef ENABLE_TBB
+                            thread_counters.local().overlap_err_count++;
+                        #else
+                            counters.overlap_err_count++;
+                        #endif
+
+                        if (overlap_i_other_a)
+                            continue;
+                        }
+
                     unsigned int n_overlap = 0;
                     unsigned int tag_i = h_tag[i];
                     for (size_t m = 0; m < n_intersect; ++m)
@@ -2734,6 +3221,9 @@ template < class Shape > void export_IntegratorHPMCMono(pybind11::module& m, con
           .def("getShape", &IntegratorHPMCMono<Shape>::getShape)
           .def("setShape", &IntegratorHPMCMono<Shape>::setShape)
           .def("computePairEnergy", &IntegratorHPMCMono<Shape>::computePairEnergy)
+          .def_property("cache_separating_axes",
+                        &IntegratorHPMCMono<Shape>::getCacheSeparatingAxes,
+                        &IntegratorHPMCMono<Shape>::setCacheSeparatingAxes)
           ;
     }
 
@@ -71,6 +71,114 @@ __global__ void hpmc_excell(unsigned int* d_excell_idx,
     d_excell_size[my_cell] = my_cell_size;
     }
 
+//! Kernel to generate expanded cells for each size class of particles
+/*! \param d_excell_idx Output array to list the particle indices in the expanded cells
+    \param d_excell_size Output array to list the number of particles in each expanded cell
+    \param excli Indexer for the expanded cells
+    \param d_cell_idx Particle indices in the normal cells
+    \param d_cell_size Number of particles in each cell
+    \param d_cell_adj Cell adjacency list
+    \param ci Cell indexer
+    \param cli Cell list indexer
+    \param cadji Cell adjacency indexer
+    \param ngpu Number of active devices
+    \param d_postype Particle positions and types
+    \param d_type_class Size class of each type
+    \param d_class_range Search range, indexed by the classes of the neighbor and of the cell
+    \param class_idx Indexer for the search ranges
+    \param box Local box
+    \param ghost_width Width of the ghost layer
+    \param cell_width Distance between the planes of the cells in each direction
+    \param euclidean True if the gaps to a cell can be combined into a Euclidean distance
+
+    hpmc_excell_size_classes executes one thread per cell and size class of the particles in the
+    cell. It gathers the particle indices from all neighboring cells that are within the search
+    range of the class to the cell, so that small particles in large cells skip most of the
+    expanded cell. Expanded cell c of class a is stored at c + a * ci.getNumElements().
+*/
+__global__ void hpmc_excell_size_classes(unsigned int* d_excell_idx,
+                                         unsigned int* d_excell_size,
+                                         const Index2D excli,
+                                         const unsigned int* d_cell_idx,
+                                         const unsigned int* d_cell_size,
+                                         const unsigned int* d_cell_adj,
+                                         const Index3D ci,
+                                         const Index2D cli,
+                                         const Index2D cadji,
+                                         const unsigned int ngpu,
+                                         const Scalar4* d_postype,
+                                         const unsigned int* d_type_class,
+                                         const Scalar* d_class_range,
+                                         const Index2D class_idx,
+                                         const BoxDim box,
+                                         const Scalar3 ghost_width,
+                                         const Scalar3 cell_width,
+                                         const bool euclidean)
+    {
+    const unsigned int n_cells = ci.getNumElements();
+    const unsigned int my_excell = blockDim.x * blockIdx.x + threadIdx.x;
+    if (my_excell >= n_cells * class_idx.getW())
+        return;
+    const unsigned int my_cell = my_excell % n_cells;
+    const unsigned int my_class = my_excell / n_cells;
+
+    // center of this cell in cell units
+    const uint3 my_cell_ijk = ci.getTriple(my_cell);
+    const Scalar3 my_center = make_scalar3(Scalar(my_cell_ijk.x) + Scalar(0.5),
+                                           Scalar(my_cell_ijk.y) + Scalar(0.5),
+                                           Scalar(my_cell_ijk.z) + Scalar(0.5));
+    const Scalar3 dim = make_scalar3(Scalar(ci.getW()), Scalar(ci.getH()), Scalar(ci.getD()));
+    const uchar3 periodic = box.getPeriodic();
+
+    unsigned int my_cell_size = 0;
+
+    // loop over neighboring cells and build up the expanded cell list
+    for (unsigned int offset = 0; offset < cadji.getW(); offset++)
+        {
+        unsigned int neigh_cell = d_cell_adj[cadji(offset, my_cell)];
+
+        // iterate over per-device cell lists
+        for (unsigned int igpu = 0; igpu < ngpu; ++igpu)
+            {
+            unsigned int neigh_cell_size = d_cell_size[neigh_cell + igpu * n_cells];
+
+            for (unsigned int k = 0; k < neigh_cell_size; k++)
+                {
+                unsigned int new_idx = d_cell_idx[cli(k, neigh_cell) + igpu * cli.getNumElements()];
+                const Scalar4 postype = d_postype[new_idx];
+                const unsigned int new_class = d_type_class[__scalar_as_int(postype.w)];
+
+                // gap between the particle and this cell along each direction
+                const Scalar3 f = box.makeFraction(make_scalar3(postype.x, postype.y, postype.z),
+                                                   ghost_width);
+                Scalar3 d = make_scalar3(f.x * dim.x, f.y * dim.y, f.z * dim.z) - my_center;
+                if (periodic.x)
+                    d.x -= dim.x * rint(d.x / dim.x);
+                if (periodic.y)
+                    d.y -= dim.y * rint(d.y / dim.y);
+                if (periodic.z)
+                    d.z -= dim.z * rint(d.z / dim.z);
+                const Scalar3 gap
+                    = make_scalar3(max(fabs(d.x) - Scalar(0.5), Scalar(0.0)) * cell_width.x,
+                                   max(fabs(d.y) - Scalar(0.5), Scalar(0.0)) * cell_width.y,
+                                   max(fabs(d.z) - Scalar(0.5), Scalar(0.0)) * cell_width.z);
+                const Scalar range = d_class_range[class_idx(new_class, my_class)];
+                const bool in_range
+                    = euclidean ? dot(gap, gap) < range * range
+                                : max(gap.x, max(gap.y, gap.z)) < range;
+                if (in_range)
+                    {
+                    d_excell_idx[excli(my_cell_size, my_excell)] = new_idx;
+                    my_cell_size++;
+                    }
+                }
+            }
+        }
+
+    // write out the final size
+    d_excell_size[my_excell] = my_cell_size;
+    }
+
 //! Kernel for grid shift
 /*! \param d_postype postype of each particle
     \param d_image Image flags for each particle
@@ -111,6 +219,30 @@ __global__ void hpmc_shift(Scalar4* d_postype,
     d_image[my_pidx] = image;
     }
 
+/*! \param d_postype Particle positions and types by index
+    \param N number of particles
+    \param old_box Global box that the positions are in
+    \param new_box Global box to scale the positions to
+
+    Scale all the particles so that they keep their fractional coordinates in the global box.
+
+    \ingroup hpmc_kernels
+*/
+__global__ void hpmc_scale(Scalar4* d_postype,
+                           const unsigned int N,
+                           const BoxDim old_box,
+                           const BoxDim new_box)
+    {
+    unsigned int my_pidx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (my_pidx >= N)
+        return;
+
+    Scalar4 postype = d_postype[my_pidx];
+    Scalar3 f = old_box.makeFraction(make_scalar3(postype.x, postype.y, postype.z));
+    Scalar3 pos = new_box.makeCoordinates(f);
+    d_postype[my_pidx] = make_scalar4(pos.x, pos.y, pos.z, postype.w);
+    }
+
 //!< Kernel to evaluate convergence
 __global__ void hpmc_check_convergence(const unsigned int* d_trial_move_type,
                                        const unsigned int* d_reject_out_of_cell,
@@ -195,6 +327,73 @@ void __attribute__((visibility("default"))) hpmc_excell(unsigned int* d_excell_i
                        ngpu);
     }
 
+//! Driver for kernel::hpmc_excell_size_classes()
+void __attribute__((visibility("default")))
+hpmc_excell_size_classes(unsigned int* d_excell_idx,
+                         unsigned int* d_excell_size,
+                         const Index2D& excli,
+                         const unsigned int* d_cell_idx,
+                         const unsigned int* d_cell_size,
+                         const unsigned int* d_cell_adj,
+                         const Index3D& ci,
+                         const Index2D& cli,
+                         const Index2D& cadji,
+                         const unsigned int ngpu,
+                         const Scalar4* d_postype,
+                         const unsigned int* d_type_class,
+                         const Scalar* d_class_range,
+                         const Index2D& class_idx,
+                         const BoxDim& box,
+                         const Scalar3& ghost_width,
+                         const Scalar3& cell_width,
+                         const bool euclidean,
+                         const unsigned int block_size)
+    {
+    assert(d_excell_idx);
+    assert(d_excell_size);
+    assert(d_cell_idx);
+    assert(d_cell_size);
+    assert(d_cell_adj);
+    assert(d_postype);
+    assert(d_type_class);
+    assert(d_class_range);
+
+    // determine the maximum block size and clamp the input block size down
+    int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(kernel::hpmc_excell_size_classes));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    // setup the grid to run the kernel
+    unsigned int run_block_size = min(block_size, (unsigned int)max_block_size);
+    dim3 threads(run_block_size, 1, 1);
+    dim3 grid(ci.getNumElements() * class_idx.getW() / run_block_size + 1, 1, 1);
+
+    hipLaunchKernelGGL(kernel::hpmc_excell_size_classes,
+                       dim3(grid),
+                       dim3(threads),
+                       0,
+                       0,
+                       d_excell_idx,
+                       d_excell_size,
+                       excli,
+                       d_cell_idx,
+                       d_cell_size,
+                       d_cell_adj,
+                       ci,
+                       cli,
+                       cadji,
+                       ngpu,
+                       d_postype,
+                       d_type_class,
+                       d_class_range,
+                       class_idx,
+                       box,
+                       ghost_width,
+                       cell_width,
+                       euclidean);
+    }
+
 //! Kernel driver for kernel::hpmc_shift()
 void __attribute__((visibility("default"))) hpmc_shift(Scalar4* d_postype,
                                                        int3* d_image,
@@ -225,6 +424,32 @@ void __attribute__((visibility("default"))) hpmc_shift(Scalar4* d_postype,
     hipDeviceSynchronize();
     }
 
+//! Kernel driver for kernel::hpmc_scale()
+void __attribute__((visibility("default"))) hpmc_scale(Scalar4* d_postype,
+                                                       const unsigned int N,
+                                                       const BoxDim& old_box,
+                                                       const BoxDim& new_box,
+                                                       const unsigned int block_size)
+    {
+    assert(d_postype);
+
+    dim3 threads(block_size, 1, 1);
+    dim3 grid(N / block_size + 1, 1, 1);
+
+    hipLaunchKernelGGL(kernel::hpmc_scale,
+                       dim3(grid),
+                       dim3(threads),
+                       0,
+                       0,
+                       d_postype,
+                       N,
+                       old_box,
+                       new_box);
+
+    // after this kernel we return control of cuda managed memory to the host
+    hipDeviceSynchronize();
+    }
+
 void __attribute__((visibility("default")))
 hpmc_check_convergence(const unsigned int* d_trial_move_type,
                        const unsigned int* d_reject_out_of_cell,
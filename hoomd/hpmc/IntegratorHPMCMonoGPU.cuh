@@ -54,6 +54,7 @@ __launch_bounds__(max_threads)
                                       const unsigned int* d_excell_idx,
                                       const unsigned int* d_excell_size,
                                       const Index2D excli,
+                                      const unsigned int* d_excell_type_class,
                                       hpmc_counters_t* d_counters,
                                       const unsigned int num_types,
                                       const BoxDim box,
@@ -197,6 +198,9 @@ __launch_bounds__(max_threads)
     // true if we are checking against the old configuration
     if (active)
         {
+        // with size classes, each class of particles has its own expanded cells
+        if (d_excell_type_class)
+            my_cell += ci.getNumElements() * d_excell_type_class[s_type_group[group]];
         excell_size = d_excell_size[my_cell];
         overlap_checks += excell_size;
         }
@@ -490,6 +494,7 @@ void narrow_phase_launcher(const hpmc_args_t& args,
                                args.d_excell_idx,
                                args.d_excell_size,
                                args.excli,
+                               args.d_excell_type_class,
                                args.d_counters + idev * args.counters_pitch,
                                args.num_types,
                                args.box,
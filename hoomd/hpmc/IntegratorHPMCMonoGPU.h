@@ -8,6 +8,7 @@
 #include "hoomd/hpmc/IntegratorHPMCMono.h"
 #include "hoomd/hpmc/IntegratorHPMCMonoGPUDepletantsAuxilliaryTypes.cuh"
 #include "hoomd/hpmc/IntegratorHPMCMonoGPUDepletantsTypes.cuh"
+#include "hoomd/hpmc/IntegratorHPMCMonoGPUPair.cuh"
 #include "hoomd/hpmc/IntegratorHPMCMonoGPUTypes.cuh"
 
 #include "hoomd/Autotuner.h"
@@ -18,7 +19,10 @@
 
 #include "hoomd/GPUPartition.cuh"
 
+#include <algorithm>
 #include <hip/hip_runtime.h>
+#include <numeric>
+#include <vector>
 
 #ifdef ENABLE_MPI
 #include "hoomd/MPIConfiguration.h"
@@ -166,6 +170,9 @@ template<class Shape> class IntegratorHPMCMonoGPU : public IntegratorHPMCMono<Sh
     //! Take one timestep forward
     virtual void update(uint64_t timestep);
 
+    //! Count overlaps with the option to exit early at the first detected overlap
+    virtual unsigned int countOverlaps(bool early_exit);
+
 #ifdef ENABLE_MPI
     void setNtrialCommunicator(std::shared_ptr<MPIConfiguration> mpi_conf)
         {
@@ -184,11 +191,18 @@ template<class Shape> class IntegratorHPMCMonoGPU : public IntegratorHPMCMono<Sh
     std::shared_ptr<CellList> m_cl; //!< Cell list
     uint3 m_last_dim;               //!< Dimensions of the cell list on the last call to update
     unsigned int m_last_nmax;       //!< Last cell list NMax value allocated in excell
+    uint64_t m_last_timestep = 0;   //!< Timestep of the last call to update
 
     GlobalArray<unsigned int> m_excell_idx;  //!< Particle indices in expanded cells
     GlobalArray<unsigned int> m_excell_size; //!< Number of particles in each expanded cell
     Index2D m_excell_list_indexer;           //!< Indexer to access elements of the excell_idx list
 
+    static constexpr Scalar size_class_ratio = 2.0; //!< Largest ratio of diameters in a class
+    unsigned int m_excell_num_classes = 1;          //!< Number of size classes in the excells
+    GlobalArray<unsigned int> m_excell_type_class;  //!< Size class of each type
+    GlobalArray<Scalar> m_excell_class_range;       //!< Search range of each pair of classes
+    std::vector<Scalar> m_excell_class_range_host;  //!< Host copy of the search ranges
+
     /// Autotuner for proposing moves.
     std::shared_ptr<Autotuner<1>> m_tuner_moves;
 
@@ -222,6 +236,9 @@ template<class Shape> class IntegratorHPMCMonoGPU : public IntegratorHPMCMono<Sh
     /// Tuner for depletants with ntrial, acceptance kernel
     std::shared_ptr<Autotuner<1>> m_tuner_depletants_accept;
 
+    /// Autotuner for the pair potential kernel.
+    std::shared_ptr<Autotuner<3>> m_tuner_narrow_pair;
+
     GlobalArray<Scalar4> m_trial_postype;           //!< New positions (and type) of particles
     GlobalArray<Scalar4> m_trial_orientation;       //!< New orientations
     GlobalArray<Scalar4> m_trial_vel;               //!< New velocities (auxilliary variables)
@@ -242,11 +259,23 @@ template<class Shape> class IntegratorHPMCMonoGPU : public IntegratorHPMCMono<Sh
     GlobalArray<unsigned int> m_req_len; //!< Requested length of shared mem per group
 
     detail::UpdateOrderGPU m_update_order; //!< Particle update order
-    GlobalArray<unsigned int> m_condition; //!< Condition of convergence check
+    GlobalArray<unsigned int> m_condition; //!< Condition of convergence check, per iteration
+
+    //! Maximum number of convergence iterations launched between host reads of m_condition
+    static constexpr unsigned int m_max_convergence_batch = 8;
+
+    //! Number of iterations the last sweep needed to converge
+    unsigned int m_convergence_iterations = 1;
 
     //! For energy evaluation
     GlobalArray<Scalar> m_additive_cutoff; //!< Per-type additive cutoffs from patch potential
 
+    PairPotentialGPUData m_pair_data; //!< Host copy of the flattened pair potentials
+    GlobalArray<detail::PairPotentialNode> m_pair_nodes; //!< Nodes of the pair potentials
+    GlobalArray<LongReal> m_pair_params;                 //!< Parameters of the pair potentials
+    GlobalArray<unsigned int> m_pair_index;              //!< Parameter tables of pair potentials
+    unsigned int m_pair_r_cut_max_offset = 0; //!< Largest r_cut squared in m_pair_params
+
     GlobalArray<hpmc_counters_t> m_counters; //!< Per-device counters
     GlobalArray<hpmc_implicit_counters_t>
         m_implicit_counters; //!< Per-device counters for depletants
@@ -275,11 +304,28 @@ template<class Shape> class IntegratorHPMCMonoGPU : public IntegratorHPMCMono<Sh
     //! Set up excell_list
     virtual void initializeExcellMem();
 
+    //! Split the types into size classes for the expanded cells
+    bool updateExcellClasses();
+
+    //! Build the expanded cells
+    void buildExcell(unsigned int* d_excell_idx,
+                     unsigned int* d_excell_size,
+                     const unsigned int* d_cell_idx,
+                     const unsigned int* d_cell_size,
+                     const unsigned int* d_cell_adj,
+                     const unsigned int* d_excell_type_class);
+
     //! Set the nominal width appropriate for looped moves
     virtual void updateCellWidth();
 
+    //! Scale the local particle positions from one global box to another on the GPU
+    virtual void scaleParticles(const BoxDim& old_box, const BoxDim& new_box);
+
     //! Update GPU memory hints
     virtual void updateGPUAdvice();
+
+    //! Flatten the pair potentials and copy them to the device
+    void updatePairPotentialData();
     };
 
 template<class Shape>
@@ -368,6 +414,30 @@ IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefini
                          5,
                          true));
 
+    // Tuning parameters for the pair potential kernel:
+    // 0: block size
+    // 1: threads per particle
+    // 2: energy evaluation threads
+    std::function<bool(const std::array<unsigned int, 3>&)> is_pair_parameter_valid
+        = [](const std::array<unsigned int, 3>& parameter) -> bool
+    {
+        unsigned int block_size = parameter[0];
+        unsigned int threads_per_particle = parameter[1];
+        unsigned int eval_threads = parameter[2];
+        return (threads_per_particle * eval_threads <= block_size)
+               && (block_size % (threads_per_particle * eval_threads)) == 0;
+    };
+
+    m_tuner_narrow_pair.reset(
+        new Autotuner<3>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf),
+                          AutotunerBase::getTppListPow2(this->m_exec_conf, narrow_phase_max_tpp),
+                          AutotunerBase::getTppListPow2(this->m_exec_conf)},
+                         this->m_exec_conf,
+                         "hpmc_narrow_pair",
+                         3,
+                         true,
+                         is_pair_parameter_valid));
+
     // Tuning parameters for depletants:
     // 0: block size
     // 1: depletants per thread
@@ -412,6 +482,17 @@ IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefini
                          true,
                          is_depletant_parameter_valid));
 
+    // The three dimensional tuners have hundreds of valid parameters, search them one dimension at
+    // a time.
+    for (auto tuner : {m_tuner_narrow,
+                       m_tuner_narrow_pair,
+                       m_tuner_depletants,
+                       m_tuner_depletants_phase1,
+                       m_tuner_depletants_phase2})
+        {
+        tuner->setMode(Autotuner<3>::search_coordinate_descent);
+        }
+
     this->m_autotuners.insert(this->m_autotuners.end(),
                               {m_tuner_moves,
                                m_tuner_update_pdata,
@@ -423,7 +504,8 @@ IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefini
                                m_tuner_depletants,
                                m_tuner_depletants_phase1,
                                m_tuner_depletants_phase2,
-                               m_tuner_narrow});
+                               m_tuner_narrow,
+                               m_tuner_narrow_pair});
 
     // initialize memory
     GlobalArray<Scalar4>(1, this->m_exec_conf).swap(m_trial_postype);
@@ -447,7 +529,7 @@ IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefini
     GlobalArray<unsigned int>(1, this->m_exec_conf).swap(m_reject_out);
     TAG_ALLOCATION(m_reject_out);
 
-    GlobalArray<unsigned int>(1, this->m_exec_conf).swap(m_condition);
+    GlobalArray<unsigned int>(m_max_convergence_batch, this->m_exec_conf).swap(m_condition);
     TAG_ALLOCATION(m_condition);
 
     GlobalArray<unsigned int>(1, this->m_exec_conf).swap(m_req_len);
@@ -469,15 +551,17 @@ IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefini
         // set memory hints
         auto gpu_map = this->m_exec_conf->getGPUIds();
         cudaMemAdvise(m_condition.get(),
-                      sizeof(unsigned int),
+                      sizeof(unsigned int) * m_condition.getNumElements(),
                       cudaMemAdviseSetPreferredLocation,
                       cudaCpuDeviceId);
-        cudaMemPrefetchAsync(m_condition.get(), sizeof(unsigned int), cudaCpuDeviceId);
+        cudaMemPrefetchAsync(m_condition.get(),
+                             sizeof(unsigned int) * m_condition.getNumElements(),
+                             cudaCpuDeviceId);
 
         for (unsigned int idev = 0; idev < this->m_exec_conf->getNumActiveGPUs(); ++idev)
             {
             cudaMemAdvise(m_condition.get(),
-                          sizeof(unsigned int),
+                          sizeof(unsigned int) * m_condition.getNumElements(),
                           cudaMemAdviseSetAccessedBy,
                           gpu_map[idev]);
             }
@@ -619,6 +703,16 @@ IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefini
     // patch
     GlobalArray<Scalar>(this->m_pdata->getNTypes(), this->m_exec_conf).swap(m_additive_cutoff);
     TAG_ALLOCATION(m_additive_cutoff);
+
+    // pair potentials
+    GlobalArray<detail::PairPotentialNode>(1, this->m_exec_conf).swap(m_pair_nodes);
+    TAG_ALLOCATION(m_pair_nodes);
+
+    GlobalArray<LongReal>(1, this->m_exec_conf).swap(m_pair_params);
+    TAG_ALLOCATION(m_pair_params);
+
+    GlobalArray<unsigned int>(1, this->m_exec_conf).swap(m_pair_index);
+    TAG_ALLOCATION(m_pair_index);
     }
 
 template<class Shape> IntegratorHPMCMonoGPU<Shape>::~IntegratorHPMCMonoGPU()
@@ -804,6 +898,7 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::updateGPUAdvice()
 template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timestep)
     {
     IntegratorHPMC::update(timestep);
+    m_last_timestep = timestep;
 
     if (this->m_patch)
         {
@@ -816,6 +911,11 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
             }
         }
 
+    if (this->m_pair_potentials.size() > 0)
+        {
+        updatePairPotentialData();
+        }
+
     // rng for shuffle and grid shift
     hoomd::RandomGenerator rng(
         hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoShift, timestep, this->m_sysdef->getSeed()),
@@ -856,10 +956,12 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
         // update the cell list
         this->m_cl->compute(timestep);
 
-        // if the cell list is a different size than last time, reinitialize the expanded cell list
+        // if the cell list or the size classes changed since last time, reinitialize the expanded
+        // cell list
+        bool classes_changed = updateExcellClasses();
         uint3 cur_dim = this->m_cl->getDim();
         if (m_last_dim.x != cur_dim.x || m_last_dim.y != cur_dim.y || m_last_dim.z != cur_dim.z
-            || m_last_nmax != this->m_cl->getNmax())
+            || m_last_nmax != this->m_cl->getNmax() || classes_changed)
             {
             initializeExcellMem();
 
@@ -1045,19 +1147,18 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                                                 access_location::device,
                                                 access_mode::overwrite);
 
+        ArrayHandle<unsigned int> d_excell_type_class(m_excell_type_class,
+                                                      access_location::device,
+                                                      access_mode::read);
+
         // update the expanded cells
         this->m_tuner_excell_block_size->begin();
-        gpu::hpmc_excell(d_excell_idx.data,
-                         d_excell_size.data,
-                         m_excell_list_indexer,
-                         m_cl->getPerDevice() ? d_cell_idx_per_device.data : d_cell_idx.data,
-                         m_cl->getPerDevice() ? d_cell_size_per_device.data : d_cell_size.data,
-                         d_cell_adj.data,
-                         this->m_cl->getCellIndexer(),
-                         this->m_cl->getCellListIndexer(),
-                         this->m_cl->getCellAdjIndexer(),
-                         this->m_exec_conf->getNumActiveGPUs(),
-                         this->m_tuner_excell_block_size->getParam()[0]);
+        buildExcell(d_excell_idx.data,
+                    d_excell_size.data,
+                    m_cl->getPerDevice() ? d_cell_idx_per_device.data : d_cell_idx.data,
+                    m_cl->getPerDevice() ? d_cell_size_per_device.data : d_cell_size.data,
+                    d_cell_adj.data,
+                    d_excell_type_class.data);
         if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
         this->m_tuner_excell_block_size->end();
@@ -1164,6 +1265,15 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
 
             bool converged = false;
 
+            // Without depletants, the iterations need no input from the host. Launch as many
+            // iterations as the last sweep needed before reading back the convergence flags. The
+            // converged reject flags are a fixed point of an iteration, so iterations that run
+            // past convergence do not change the result.
+            unsigned int batch_size
+                = have_depletants ? 1
+                                  : std::min(m_convergence_iterations, m_max_convergence_batch);
+            unsigned int n_iterations = 0;
+
                 {
                 // initialize reject flags
                 ArrayHandle<unsigned int> d_reject_out_of_cell(m_reject_out_of_cell,
@@ -1205,7 +1315,9 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                                                           access_location::device,
                                                           access_mode::overwrite);
                     // reset condition flag
-                    hipMemsetAsync(d_condition.data, 0, sizeof(unsigned int));
+                    hipMemsetAsync(d_condition.data + n_iterations % batch_size,
+                                   0,
+                                   sizeof(unsigned int));
                     if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
                         CHECK_CUDA_ERROR();
                     }
@@ -1379,6 +1491,8 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                     args.block_size = param[0];
                     args.tpp = param[1];
                     args.overlap_threads = param[2];
+                    args.d_excell_type_class
+                        = m_excell_num_classes > 1 ? d_excell_type_class.data : nullptr;
                     gpu::hpmc_narrow_phase<Shape>(args, params.data());
                     if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
                         CHECK_CUDA_ERROR();
@@ -1614,17 +1728,21 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                     this->m_exec_conf->endMultiGPU();
 
                     // did the dynamically allocated shared memory overflow during kernel execution?
-                    ArrayHandle<unsigned int> h_req_len(m_req_len,
-                                                        access_location::host,
-                                                        access_mode::read);
-
-                    if (*h_req_len.data > m_max_len)
+                    // Only the auxilliary variable depletant kernels use it.
+                    if (have_auxilliary_variables)
                         {
-                        this->m_exec_conf->msg->notice(9)
-                            << "Increasing shared mem list size per group " << m_max_len << "->"
-                            << *h_req_len.data << std::endl;
-                        m_max_len = *h_req_len.data;
-                        continue; // rerun kernels
+                        ArrayHandle<unsigned int> h_req_len(m_req_len,
+                                                            access_location::host,
+                                                            access_mode::read);
+
+                        if (*h_req_len.data > m_max_len)
+                            {
+                            this->m_exec_conf->msg->notice(9)
+                                << "Increasing shared mem list size per group " << m_max_len
+                                << "->" << *h_req_len.data << std::endl;
+                            m_max_len = *h_req_len.data;
+                            continue; // rerun kernels
+                            }
                         }
 
                     reallocate_smem = false;
@@ -1712,6 +1830,57 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                     this->m_exec_conf->endMultiGPU();
                     }
 
+                if (this->m_external)
+                    {
+                    ArrayHandle<Scalar4> d_trial_postype(m_trial_postype,
+                                                         access_location::device,
+                                                         access_mode::read);
+                    ArrayHandle<Scalar4> d_trial_orientation(m_trial_orientation,
+                                                             access_location::device,
+                                                             access_mode::read);
+                    ArrayHandle<unsigned int> d_trial_move_type(m_trial_move_type,
+                                                                access_location::device,
+                                                                access_mode::read);
+                    ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
+                                                   access_location::device,
+                                                   access_mode::read);
+                    ArrayHandle<Scalar4> d_orientation(this->m_pdata->getOrientationArray(),
+                                                       access_location::device,
+                                                       access_mode::read);
+                    ArrayHandle<Scalar> d_charge(this->m_pdata->getCharges(),
+                                                 access_location::device,
+                                                 access_mode::read);
+                    ArrayHandle<Scalar> d_diameter(this->m_pdata->getDiameters(),
+                                                   access_location::device,
+                                                   access_mode::read);
+                    ArrayHandle<unsigned int> d_reject_out_of_cell(m_reject_out_of_cell,
+                                                                   access_location::device,
+                                                                   access_mode::read);
+                    ArrayHandle<unsigned int> d_reject_out(m_reject_out,
+                                                           access_location::device,
+                                                           access_mode::readwrite);
+
+                    // reject moves on the change in the field energy before evaluating the
+                    // more expensive pair energies
+                    ExternalField::gpu_args_t external_args(d_postype.data,
+                                                            d_orientation.data,
+                                                            d_trial_postype.data,
+                                                            d_trial_orientation.data,
+                                                            d_trial_move_type.data,
+                                                            d_charge.data,
+                                                            d_diameter.data,
+                                                            d_reject_out_of_cell.data,
+                                                            d_reject_out.data,
+                                                            this->m_sysdef->getSeed(),
+                                                            this->m_exec_conf->getRank(),
+                                                            timestep,
+                                                            i,
+                                                            this->m_pdata->getGlobalBox(),
+                                                            this->m_pdata->getOrigin(),
+                                                            this->m_pdata->getGPUPartition());
+                    this->m_external->computeExternalFieldGPU(external_args, 0);
+                    } // end external field
+
                 if (this->m_patch)
                     {
                     // access data for proposed moves
@@ -1793,6 +1962,91 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                     this->m_patch->computePatchEnergyGPU(patch_args, 0);
                     } // end patch energy
 
+                if (this->m_pair_potentials.size() > 0)
+                    {
+                    ArrayHandle<Scalar4> d_trial_postype(m_trial_postype,
+                                                         access_location::device,
+                                                         access_mode::read);
+                    ArrayHandle<Scalar4> d_trial_orientation(m_trial_orientation,
+                                                             access_location::device,
+                                                             access_mode::read);
+                    ArrayHandle<unsigned int> d_trial_move_type(m_trial_move_type,
+                                                                access_location::device,
+                                                                access_mode::read);
+                    ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
+                                                   access_location::device,
+                                                   access_mode::read);
+                    ArrayHandle<Scalar4> d_orientation(this->m_pdata->getOrientationArray(),
+                                                       access_location::device,
+                                                       access_mode::read);
+                    ArrayHandle<unsigned int> d_update_order_by_ptl(m_update_order.get(),
+                                                                    access_location::device,
+                                                                    access_mode::read);
+                    ArrayHandle<unsigned int> d_reject_out_of_cell(m_reject_out_of_cell,
+                                                                   access_location::device,
+                                                                   access_mode::read);
+                    ArrayHandle<unsigned int> d_reject(m_reject,
+                                                       access_location::device,
+                                                       access_mode::read);
+                    ArrayHandle<unsigned int> d_reject_out(m_reject_out,
+                                                           access_location::device,
+                                                           access_mode::readwrite);
+
+                    ArrayHandle<detail::PairPotentialNode> d_pair_nodes(m_pair_nodes,
+                                                                        access_location::device,
+                                                                        access_mode::read);
+                    ArrayHandle<LongReal> d_pair_params(m_pair_params,
+                                                        access_location::device,
+                                                        access_mode::read);
+                    ArrayHandle<unsigned int> d_pair_index(m_pair_index,
+                                                           access_location::device,
+                                                           access_mode::read);
+
+                    detail::pair_potential_data_t pair_data;
+                    pair_data.nodes = d_pair_nodes.data;
+                    pair_data.params = d_pair_params.data;
+                    pair_data.index = d_pair_index.data;
+                    pair_data.r_cut_squared_max = d_pair_params.data + m_pair_r_cut_max_offset;
+                    pair_data.n_roots = static_cast<unsigned int>(this->m_pair_potentials.size());
+                    pair_data.type_param_index = Index2D(this->m_pdata->getNTypes());
+
+                    this->m_exec_conf->beginMultiGPU();
+                    m_tuner_narrow_pair->begin();
+                    auto param = m_tuner_narrow_pair->getParam();
+                    gpu::hpmc_pair_args_t pair_args(d_postype.data,
+                                                    d_orientation.data,
+                                                    d_trial_postype.data,
+                                                    d_trial_orientation.data,
+                                                    d_trial_move_type.data,
+                                                    this->m_cl->getCellIndexer(),
+                                                    this->m_cl->getDim(),
+                                                    ghost_width,
+                                                    this->m_pdata->getN(),
+                                                    this->m_sysdef->getSeed(),
+                                                    this->m_exec_conf->getRank(),
+                                                    timestep,
+                                                    i,
+                                                    box,
+                                                    d_excell_idx.data,
+                                                    d_excell_size.data,
+                                                    m_excell_list_indexer,
+                                                    d_update_order_by_ptl.data,
+                                                    d_reject.data,
+                                                    d_reject_out.data,
+                                                    d_reject_out_of_cell.data,
+                                                    pair_data,
+                                                    param[0],
+                                                    param[1],
+                                                    param[2],
+                                                    this->m_exec_conf->dev_prop,
+                                                    this->m_pdata->getGPUPartition());
+                    gpu::hpmc_narrow_phase_pair(pair_args);
+                    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                        CHECK_CUDA_ERROR();
+                    m_tuner_narrow_pair->end();
+                    this->m_exec_conf->endMultiGPU();
+                    } // end pair potential energy
+
                     {
                     ArrayHandle<unsigned int> d_reject_out_of_cell(m_reject_out_of_cell,
                                                                    access_location::device,
@@ -1816,7 +2070,7 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                                                 d_reject_out_of_cell.data,
                                                 d_reject.data,
                                                 d_reject_out.data,
-                                                d_condition.data,
+                                                d_condition.data + n_iterations % batch_size,
                                                 this->m_pdata->getGPUPartition(),
                                                 m_tuner_convergence->getParam()[0]);
                     if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -1827,13 +2081,23 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
 
                 // flip reject flags
                 std::swap(m_reject, m_reject_out);
+                n_iterations++;
 
+                if (n_iterations % batch_size == 0)
                     {
                     ArrayHandle<unsigned int> h_condition(m_condition,
                                                           access_location::host,
                                                           access_mode::read);
-                    if (*h_condition.data == 0)
+                    if (h_condition.data[batch_size - 1] == 0)
+                        {
                         converged = true;
+
+                        // record how many iterations this sweep actually needed
+                        unsigned int first_converged = 0;
+                        while (h_condition.data[first_converged] != 0)
+                            first_converged++;
+                        m_convergence_iterations = n_iterations - batch_size + first_converged + 1;
+                        }
                     }
                 } // end while (!converged)
 
@@ -1965,13 +2229,344 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
 
     this->communicate(true);
 
-    // all particle have been moved, the aabb tree is now invalid
-    this->m_aabb_tree_invalid = true;
+    // all particle have been moved, refit the aabb tree before the next use
+    this->m_aabb_tree_moved = true;
 
     // set current MPS value
     hpmc_counters_t run_counters = this->getCounters(1);
     double cur_time = double(this->m_clock.getTime()) / Scalar(1e9);
     this->m_mps = double(run_counters.getNMoves()) / cur_time;
+    this->recordUpdateWalltime();
+    }
+
+/*! \param old_box Global box that the positions are in
+    \param new_box Global box to scale the positions to
+
+    The positions stay on the device, so box resizes do not copy the particle data.
+*/
+template<class Shape>
+void IntegratorHPMCMonoGPU<Shape>::scaleParticles(const BoxDim& old_box, const BoxDim& new_box)
+    {
+    if (this->m_pdata->getN() > 0)
+        {
+        ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
+                                       access_location::device,
+                                       access_mode::readwrite);
+        gpu::hpmc_scale(d_postype.data, this->m_pdata->getN(), old_box, new_box, 128);
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+    }
+
+/*! \param early_exit exit at first overlap found if true
+    \returns number of overlaps if early_exit=false, 1 if early_exit=true
+
+    With early_exit, run the narrow phase kernel with the current configuration as the trial
+    configuration of every particle and reduce the reject flags with the convergence kernel. Only a
+    single flag is read back to the host, so shape trial moves do not copy the particle data.
+
+    The exact overlap count (early_exit=false), boxes too small for the minimum image convention,
+    and calls before update() has allocated the per-particle flags use the CPU implementation.
+*/
+template<class Shape> unsigned int IntegratorHPMCMonoGPU<Shape>::countOverlaps(bool early_exit)
+    {
+    BoxDim global_box = this->m_pdata->getGlobalBox();
+    Scalar3 npd = global_box.getNearestPlaneDistance();
+    bool box_too_small
+        = (global_box.getPeriodic().x && npd.x <= this->m_nominal_width * 2)
+          || (global_box.getPeriodic().y && npd.y <= this->m_nominal_width * 2)
+          || (this->m_sysdef->getNDimensions() == 3 && global_box.getPeriodic().z
+              && npd.z <= this->m_nominal_width * 2);
+
+    if (!early_exit || box_too_small || m_reject.getNumElements() < this->m_pdata->getMaxN())
+        {
+        return IntegratorHPMCMono<Shape>::countOverlaps(early_exit);
+        }
+
+    unsigned int overlap_count = 0;
+
+    if (this->m_pdata->getN() > 0)
+        {
+        // the shape parameters may have changed since the last step, rebuild the cell list with
+        // the current nominal width
+        this->m_cl->forceCompute(m_last_timestep);
+
+        bool classes_changed = updateExcellClasses();
+        uint3 cur_dim = this->m_cl->getDim();
+        if (m_last_dim.x != cur_dim.x || m_last_dim.y != cur_dim.y || m_last_dim.z != cur_dim.z
+            || m_last_nmax != this->m_cl->getNmax() || classes_changed)
+            {
+            initializeExcellMem();
+
+            m_last_dim = cur_dim;
+            m_last_nmax = this->m_cl->getNmax();
+            }
+
+        m_update_order.resize(this->m_pdata->getN());
+
+            {
+            // access the cell list data
+            ArrayHandle<unsigned int> d_cell_size(this->m_cl->getCellSizeArray(),
+                                                  access_location::device,
+                                                  access_mode::read);
+            ArrayHandle<unsigned int> d_cell_idx(this->m_cl->getIndexArray(),
+                                                 access_location::device,
+                                                 access_mode::read);
+            ArrayHandle<unsigned int> d_cell_adj(this->m_cl->getCellAdjArray(),
+                                                 access_location::device,
+                                                 access_mode::read);
+
+            // per-device cell list data
+            const ArrayHandle<unsigned int>& d_cell_size_per_device
+                = m_cl->getPerDevice()
+                      ? ArrayHandle<unsigned int>(m_cl->getCellSizeArrayPerDevice(),
+                                                  access_location::device,
+                                                  access_mode::read)
+                      : ArrayHandle<unsigned int>(GlobalArray<unsigned int>(),
+                                                  access_location::device,
+                                                  access_mode::read);
+            const ArrayHandle<unsigned int>& d_cell_idx_per_device
+                = m_cl->getPerDevice()
+                      ? ArrayHandle<unsigned int>(m_cl->getIndexArrayPerDevice(),
+                                                  access_location::device,
+                                                  access_mode::read)
+                      : ArrayHandle<unsigned int>(GlobalArray<unsigned int>(),
+                                                  access_location::device,
+                                                  access_mode::read);
+
+            ArrayHandle<unsigned int> d_excell_idx(m_excell_idx,
+                                                   access_location::device,
+                                                   access_mode::overwrite);
+            ArrayHandle<unsigned int> d_excell_size(m_excell_size,
+                                                    access_location::device,
+                                                    access_mode::overwrite);
+
+            ArrayHandle<unsigned int> d_excell_type_class(m_excell_type_class,
+                                                          access_location::device,
+                                                          access_mode::read);
+
+            this->m_tuner_excell_block_size->begin();
+            buildExcell(d_excell_idx.data,
+                        d_excell_size.data,
+                        m_cl->getPerDevice() ? d_cell_idx_per_device.data : d_cell_idx.data,
+                        m_cl->getPerDevice() ? d_cell_size_per_device.data : d_cell_size.data,
+                        d_cell_adj.data,
+                        d_excell_type_class.data);
+            if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            this->m_tuner_excell_block_size->end();
+            }
+
+            {
+            // every particle is checked once against the unchanged configuration
+            ArrayHandle<unsigned int> d_trial_move_type(m_trial_move_type,
+                                                        access_location::device,
+                                                        access_mode::overwrite);
+            ArrayHandle<unsigned int> d_reject_out_of_cell(m_reject_out_of_cell,
+                                                           access_location::device,
+                                                           access_mode::overwrite);
+            ArrayHandle<unsigned int> d_reject(m_reject,
+                                               access_location::device,
+                                               access_mode::overwrite);
+            ArrayHandle<unsigned int> d_reject_out(m_reject_out,
+                                                   access_location::device,
+                                                   access_mode::overwrite);
+            ArrayHandle<unsigned int> d_condition(m_condition,
+                                                  access_location::device,
+                                                  access_mode::overwrite);
+
+            hipMemsetAsync(d_condition.data, 0, sizeof(unsigned int));
+
+            this->m_exec_conf->beginMultiGPU();
+            for (int idev = this->m_exec_conf->getNumActiveGPUs() - 1; idev >= 0; --idev)
+                {
+                hipSetDevice(this->m_exec_conf->getGPUIds()[idev]);
+
+                auto range = this->m_pdata->getGPUPartition().getRange(idev);
+                size_t n_bytes = sizeof(unsigned int) * (range.second - range.first);
+                if (n_bytes != 0)
+                    {
+                    // any nonzero move type marks the particle as active in the convergence check
+                    hipMemsetAsync(d_trial_move_type.data + range.first, 1, n_bytes);
+                    hipMemsetAsync(d_reject_out_of_cell.data + range.first, 0, n_bytes);
+                    hipMemsetAsync(d_reject.data + range.first, 0, n_bytes);
+                    hipMemsetAsync(d_reject_out.data + range.first, 0, n_bytes);
+                    }
+                if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                    CHECK_CUDA_ERROR();
+                }
+            this->m_exec_conf->endMultiGPU();
+            }
+
+            {
+            auto& params = this->getParams();
+
+            ArrayHandle<unsigned int> d_overlaps(this->m_overlaps,
+                                                 access_location::device,
+                                                 access_mode::read);
+            ArrayHandle<Scalar> d_d(this->m_d, access_location::device, access_mode::read);
+            ArrayHandle<Scalar> d_a(this->m_a, access_location::device, access_mode::read);
+
+            ArrayHandle<unsigned int> d_update_order_by_ptl(m_update_order.get(),
+                                                            access_location::device,
+                                                            access_mode::read);
+            ArrayHandle<unsigned int> d_trial_move_type(m_trial_move_type,
+                                                        access_location::device,
+                                                        access_mode::read);
+            ArrayHandle<unsigned int> d_reject_out_of_cell(m_reject_out_of_cell,
+                                                           access_location::device,
+                                                           access_mode::read);
+            ArrayHandle<unsigned int> d_reject(m_reject,
+                                               access_location::device,
+                                               access_mode::readwrite);
+            ArrayHandle<unsigned int> d_reject_out(m_reject_out,
+                                                   access_location::device,
+                                                   access_mode::readwrite);
+            ArrayHandle<unsigned int> d_excell_idx(m_excell_idx,
+                                                   access_location::device,
+                                                   access_mode::read);
+            ArrayHandle<unsigned int> d_excell_size(m_excell_size,
+                                                    access_location::device,
+                                                    access_mode::read);
+            ArrayHandle<unsigned int> d_excell_type_class(m_excell_type_class,
+                                                          access_location::device,
+                                                          access_mode::read);
+
+            ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
+                                           access_location::device,
+                                           access_mode::read);
+            ArrayHandle<Scalar4> d_orientation(this->m_pdata->getOrientationArray(),
+                                               access_location::device,
+                                               access_mode::read);
+            ArrayHandle<Scalar4> d_vel(this->m_pdata->getVelocities(),
+                                       access_location::device,
+                                       access_mode::read);
+
+            // the per-device counters are reset at the start of every step, overlap checks
+            // counted here do not enter the integrator statistics
+            ArrayHandle<hpmc_counters_t> d_counters_per_device(this->m_counters,
+                                                               access_location::device,
+                                                               access_mode::readwrite);
+
+            bool domain_decomposition = false;
+#ifdef ENABLE_MPI
+            if (this->m_sysdef->isDomainDecomposed())
+                domain_decomposition = true;
+#endif
+
+            BoxDim box = this->m_pdata->getBox();
+            Scalar3 ghost_fraction = this->m_nominal_width / box.getNearestPlaneDistance();
+
+            // the trial configuration is the current configuration
+            gpu::hpmc_args_t args(d_postype.data,
+                                  d_orientation.data,
+                                  d_vel.data,
+                                  d_counters_per_device.data,
+                                  (unsigned int)this->m_counters.getPitch(),
+                                  this->m_cl->getCellIndexer(),
+                                  this->m_cl->getDim(),
+                                  this->m_cl->getGhostWidth(),
+                                  this->m_pdata->getN(),
+                                  this->m_pdata->getNTypes(),
+                                  this->m_sysdef->getSeed(),
+                                  this->m_exec_conf->getRank(),
+                                  d_d.data,
+                                  d_a.data,
+                                  d_overlaps.data,
+                                  this->m_overlap_idx,
+                                  this->m_translation_move_probability,
+                                  m_last_timestep,
+                                  this->m_sysdef->getNDimensions(),
+                                  box,
+                                  0, // select
+                                  ghost_fraction,
+                                  domain_decomposition,
+                                  0, // block size
+                                  0, // tpp
+                                  0, // overlap threads
+                                  false,
+                                  d_reject_out_of_cell.data,
+                                  d_postype.data,
+                                  d_orientation.data,
+                                  d_vel.data,
+                                  d_trial_move_type.data,
+                                  d_update_order_by_ptl.data,
+                                  d_excell_idx.data,
+                                  d_excell_size.data,
+                                  m_excell_list_indexer,
+                                  d_reject.data,
+                                  d_reject_out.data,
+                                  this->m_exec_conf->dev_prop,
+                                  this->m_pdata->getGPUPartition(),
+                                  &m_narrow_phase_streams.front());
+
+            this->m_exec_conf->beginMultiGPU();
+            m_tuner_narrow->begin();
+            auto param = m_tuner_narrow->getParam();
+            args.block_size = param[0];
+            args.tpp = param[1];
+            args.overlap_threads = param[2];
+            args.d_excell_type_class
+                = m_excell_num_classes > 1 ? d_excell_type_class.data : nullptr;
+            gpu::hpmc_narrow_phase<Shape>(args, params.data());
+            if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            m_tuner_narrow->end();
+            this->m_exec_conf->endMultiGPU();
+            }
+
+            {
+            // reduce the reject flags to a single overlap flag
+            ArrayHandle<unsigned int> d_trial_move_type(m_trial_move_type,
+                                                        access_location::device,
+                                                        access_mode::read);
+            ArrayHandle<unsigned int> d_reject_out_of_cell(m_reject_out_of_cell,
+                                                           access_location::device,
+                                                           access_mode::read);
+            ArrayHandle<unsigned int> d_reject(m_reject,
+                                               access_location::device,
+                                               access_mode::readwrite);
+            ArrayHandle<unsigned int> d_reject_out(m_reject_out,
+                                                   access_location::device,
+                                                   access_mode::readwrite);
+            ArrayHandle<unsigned int> d_condition(m_condition,
+                                                  access_location::device,
+                                                  access_mode::readwrite);
+
+            this->m_exec_conf->beginMultiGPU();
+            gpu::hpmc_check_convergence(d_trial_move_type.data,
+                                        d_reject_out_of_cell.data,
+                                        d_reject.data,
+                                        d_reject_out.data,
+                                        d_condition.data,
+                                        this->m_pdata->getGPUPartition(),
+                                        m_tuner_convergence->getParam()[0]);
+            if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            this->m_exec_conf->endMultiGPU();
+            }
+
+        ArrayHandle<unsigned int> h_condition(m_condition,
+                                              access_location::host,
+                                              access_mode::read);
+        overlap_count = h_condition.data[0] ? 1 : 0;
+        }
+
+#ifdef ENABLE_MPI
+    if (this->m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &overlap_count,
+                      1,
+                      MPI_UNSIGNED,
+                      MPI_SUM,
+                      this->m_exec_conf->getMPICommunicator());
+        if (overlap_count > 1)
+            overlap_count = 1;
+        }
+#endif
+
+    return overlap_count;
     }
 
 template<class Shape> void IntegratorHPMCMonoGPU<Shape>::initializeExcellMem()
@@ -1985,12 +2580,13 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::initializeExcellMem()
         = this->m_cl->getPerDevice() ? this->m_exec_conf->getNumActiveGPUs() : 1;
     unsigned int num_max = this->m_cl->getNmax() * n_cell_list;
 
-    // make the excell dimensions the same, but with room for Nmax*Nadj in each cell
-    m_excell_list_indexer = Index2D(num_max * num_adj, num_cells);
+    // make the excell dimensions the same, but with room for Nmax*Nadj in each cell, and one
+    // expanded cell per size class
+    m_excell_list_indexer = Index2D(num_max * num_adj, num_cells * m_excell_num_classes);
 
     // reallocate memory
     m_excell_idx.resize(m_excell_list_indexer.getNumElements());
-    m_excell_size.resize(num_cells);
+    m_excell_size.resize(num_cells * m_excell_num_classes);
 
 #if defined(__HIP_PLATFORM_NVCC__) \
     && 0 // excell is currently not multi-GPU optimized, let the CUDA driver figure this out
@@ -2014,6 +2610,270 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::initializeExcellMem()
 #endif
     }
 
+/*! The types are sorted by their circumsphere diameters, and a new class is started whenever a
+    diameter exceeds size_class_ratio times the smallest diameter in the current class. Each class
+    gets its own expanded cells, which only hold the particles that can overlap with a particle of
+    the class in the cell: those within half the sum of the largest diameters of both classes,
+    plus the distance that the neighbor can move in the m_nselect sweeps over one expanded cell
+    list. The cells themselves stay sized for the largest particles, so moves are not rejected more
+    often.
+
+    The depletant and pair kernels search the expanded cells with their own ranges, so they use a
+    single class.
+
+    \returns True when the number of classes changed
+*/
+template<class Shape> bool IntegratorHPMCMonoGPU<Shape>::updateExcellClasses()
+    {
+    const unsigned int n_types = this->m_pdata->getNTypes();
+
+    bool have_depletants = false;
+    for (unsigned int type = 0; type < n_types; ++type)
+        {
+        if (this->m_fugacity[type] != Scalar(0.0))
+            have_depletants = true;
+        }
+
+    std::vector<Scalar> diameter(n_types);
+    for (unsigned int type = 0; type < n_types; ++type)
+        {
+        Shape shape(quat<Scalar>(), this->m_params[type]);
+        diameter[type] = Scalar(shape.getCircumsphereDiameter());
+        }
+
+    std::vector<unsigned int> type_class(n_types, 0);
+    std::vector<Scalar> class_diameter;
+    if (!have_depletants && !this->hasPairInteractions())
+        {
+        std::vector<unsigned int> order(n_types);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(),
+                  order.end(),
+                  [&diameter](unsigned int a, unsigned int b)
+                  { return diameter[a] < diameter[b]; });
+
+        Scalar class_min(0.0);
+        for (unsigned int type : order)
+            {
+            if (class_diameter.empty() || diameter[type] > size_class_ratio * class_min)
+                {
+                class_min = diameter[type];
+                class_diameter.push_back(diameter[type]);
+                }
+            class_diameter.back() = std::max(class_diameter.back(), diameter[type]);
+            type_class[type] = static_cast<unsigned int>(class_diameter.size() - 1);
+            }
+        }
+
+    const unsigned int n_classes = std::max(static_cast<unsigned int>(class_diameter.size()), 1u);
+    const bool changed = n_classes != m_excell_num_classes;
+    if (changed)
+        {
+        this->m_exec_conf->msg->notice(4)
+            << "hpmc: using " << n_classes << " size classes in the expanded cells" << std::endl;
+        }
+    m_excell_num_classes = n_classes;
+    if (n_classes == 1)
+        return changed;
+
+    // largest move of each class
+    std::vector<Scalar> class_move(n_classes, Scalar(0.0));
+        {
+        ArrayHandle<Scalar> h_d(this->m_d, access_location::host, access_mode::read);
+        for (unsigned int type = 0; type < n_types; ++type)
+            {
+            class_move[type_class[type]]
+                = std::max(class_move[type_class[type]], h_d.data[type]);
+            }
+        }
+
+    // search range indexed by (neighbor class, cell class), padded for round off
+    Index2D class_idx(n_classes);
+    std::vector<Scalar> class_range(class_idx.getNumElements());
+    for (unsigned int a = 0; a < n_classes; ++a)
+        {
+        for (unsigned int b = 0; b < n_classes; ++b)
+            {
+            const Scalar range = Scalar(0.5) * (class_diameter[a] + class_diameter[b])
+                                 + Scalar(this->m_nselect) * class_move[b];
+            class_range[class_idx(b, a)] = range * Scalar(1.0001);
+            }
+        }
+
+    if (m_excell_type_class.getNumElements() != n_types)
+        {
+        GlobalArray<unsigned int> excell_type_class(n_types, this->m_exec_conf);
+        m_excell_type_class.swap(excell_type_class);
+        TAG_ALLOCATION(m_excell_type_class);
+        }
+        {
+        ArrayHandle<unsigned int> h_excell_type_class(m_excell_type_class,
+                                                      access_location::host,
+                                                      access_mode::overwrite);
+        std::copy(type_class.begin(), type_class.end(), h_excell_type_class.data);
+        }
+
+    if (class_range != m_excell_class_range_host)
+        {
+        if (m_excell_class_range.getNumElements() != class_range.size())
+            {
+            GlobalArray<Scalar> excell_class_range(class_range.size(), this->m_exec_conf);
+            m_excell_class_range.swap(excell_class_range);
+            TAG_ALLOCATION(m_excell_class_range);
+            }
+        ArrayHandle<Scalar> h_excell_class_range(m_excell_class_range,
+                                                 access_location::host,
+                                                 access_mode::overwrite);
+        std::copy(class_range.begin(), class_range.end(), h_excell_class_range.data);
+        m_excell_class_range_host = class_range;
+        }
+
+    return changed;
+    }
+
+/*! \param d_excell_idx Output particle indices in the expanded cells
+    \param d_excell_size Output number of particles in each expanded cell
+    \param d_cell_idx Particle indices in the cells
+    \param d_cell_size Number of particles in each cell
+    \param d_cell_adj Cell adjacency list
+    \param d_excell_type_class Size class of each type
+
+    The caller measures the kernel with m_tuner_excell_block_size.
+*/
+template<class Shape>
+void IntegratorHPMCMonoGPU<Shape>::buildExcell(unsigned int* d_excell_idx,
+                                               unsigned int* d_excell_size,
+                                               const unsigned int* d_cell_idx,
+                                               const unsigned int* d_cell_size,
+                                               const unsigned int* d_cell_adj,
+                                               const unsigned int* d_excell_type_class)
+    {
+    if (m_excell_num_classes == 1)
+        {
+        gpu::hpmc_excell(d_excell_idx,
+                         d_excell_size,
+                         m_excell_list_indexer,
+                         d_cell_idx,
+                         d_cell_size,
+                         d_cell_adj,
+                         this->m_cl->getCellIndexer(),
+                         this->m_cl->getCellListIndexer(),
+                         this->m_cl->getCellAdjIndexer(),
+                         this->m_exec_conf->getNumActiveGPUs(),
+                         this->m_tuner_excell_block_size->getParam()[0]);
+        return;
+        }
+
+    ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+    ArrayHandle<Scalar> d_excell_class_range(m_excell_class_range,
+                                             access_location::device,
+                                             access_mode::read);
+
+    // the gaps along the cell directions only add up to a distance in an orthorhombic box
+    const BoxDim box = this->m_pdata->getBox();
+    const bool euclidean = box.getTiltFactorXY() == Scalar(0.0)
+                           && box.getTiltFactorXZ() == Scalar(0.0)
+                           && box.getTiltFactorYZ() == Scalar(0.0);
+    gpu::hpmc_excell_size_classes(d_excell_idx,
+                                  d_excell_size,
+                                  m_excell_list_indexer,
+                                  d_cell_idx,
+                                  d_cell_size,
+                                  d_cell_adj,
+                                  this->m_cl->getCellIndexer(),
+                                  this->m_cl->getCellListIndexer(),
+                                  this->m_cl->getCellAdjIndexer(),
+                                  this->m_exec_conf->getNumActiveGPUs(),
+                                  d_postype.data,
+                                  d_excell_type_class,
+                                  d_excell_class_range.data,
+                                  Index2D(m_excell_num_classes),
+                                  box,
+                                  this->m_cl->getGhostWidth(),
+                                  this->m_cl->getCellWidth(),
+                                  euclidean,
+                                  this->m_tuner_excell_block_size->getParam()[0]);
+    }
+
+template<class Shape> void IntegratorHPMCMonoGPU<Shape>::updatePairPotentialData()
+    {
+    // Flatten the top level potentials into the first nodes, followed by their children.
+    PairPotentialGPUData data;
+    const unsigned int n_roots = static_cast<unsigned int>(this->m_pair_potentials.size());
+    data.nodes.resize(n_roots);
+    for (unsigned int root = 0; root < n_roots; root++)
+        {
+        detail::PairPotentialNode node = this->m_pair_potentials[root]->makeGPUNode(data);
+        data.nodes[root] = node;
+        }
+
+    // The excell search uses the largest cutoff of any top level potential.
+    const unsigned int n_types = this->m_pdata->getNTypes();
+    Index2D type_param_index(n_types);
+    const unsigned int r_cut_max_offset = static_cast<unsigned int>(data.params.size());
+    data.params.resize(data.params.size() + type_param_index.getNumElements(), 0);
+    for (const auto& pair : this->m_pair_potentials)
+        {
+        for (unsigned int type_i = 0; type_i < n_types; type_i++)
+            {
+            for (unsigned int type_j = 0; type_j < n_types; type_j++)
+                {
+                LongReal& r_cut_squared
+                    = data.params[r_cut_max_offset + type_param_index(type_i, type_j)];
+                r_cut_squared = std::max(r_cut_squared, pair->getRCutSquaredTotal(type_i, type_j));
+                }
+            }
+        }
+
+    // Copy to the device only when the parameters change.
+    if (data.nodes.size() == m_pair_data.nodes.size() && data.params == m_pair_data.params
+        && data.index == m_pair_data.index
+        && std::equal(data.nodes.begin(),
+                      data.nodes.end(),
+                      m_pair_data.nodes.begin(),
+                      [](const detail::PairPotentialNode& a, const detail::PairPotentialNode& b)
+                      {
+                          return a.kind == b.kind && a.mode == b.mode && a.child == b.child
+                                 && a.r_cut_offset == b.r_cut_offset
+                                 && a.param_offset == b.param_offset
+                                 && a.index_offset == b.index_offset;
+                      }))
+        {
+        return;
+        }
+
+    m_pair_data = data;
+    m_pair_r_cut_max_offset = r_cut_max_offset;
+
+    if (m_pair_nodes.getNumElements() < data.nodes.size())
+        {
+        m_pair_nodes.resize(data.nodes.size());
+        }
+    if (m_pair_params.getNumElements() < data.params.size())
+        {
+        m_pair_params.resize(data.params.size());
+        }
+    if (m_pair_index.getNumElements() < data.index.size())
+        {
+        m_pair_index.resize(data.index.size());
+        }
+
+    ArrayHandle<detail::PairPotentialNode> h_pair_nodes(m_pair_nodes,
+                                                        access_location::host,
+                                                        access_mode::overwrite);
+    ArrayHandle<LongReal> h_pair_params(m_pair_params,
+                                        access_location::host,
+                                        access_mode::overwrite);
+    ArrayHandle<unsigned int> h_pair_index(m_pair_index,
+                                           access_location::host,
+                                           access_mode::overwrite);
+    std::copy(data.nodes.begin(), data.nodes.end(), h_pair_nodes.data);
+    std::copy(data.params.begin(), data.params.end(), h_pair_params.data);
+    std::copy(data.index.begin(), data.index.end(), h_pair_index.data);
+    }
+
 template<class Shape> void IntegratorHPMCMonoGPU<Shape>::updateCellWidth()
     {
     // call base class method
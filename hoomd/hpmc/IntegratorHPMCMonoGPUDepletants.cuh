@@ -262,23 +262,36 @@ __launch_bounds__(max_threads)
             if (shape_test_a.hasOrientation())
                 shape_test_a.orientation = o;
 
+            // Only depletants in the symmetric difference of the old and new excluded volumes of
+            // particle i are relevant. Depletants in the excluded volume of the configuration that
+            // is not sampled are discarded first, using the inspheres to skip the full overlap
+            // check where possible.
             Shape shape_i(quat<Scalar>(), s_params[s_type_i]);
-            if (shape_i.hasOrientation())
-                shape_i.orientation = quat<Scalar>(s_orientation_i_old);
-            vec3<Scalar> r_ij = vec3<Scalar>(s_pos_i_old) - pos_test;
-            bool overlap_old_a = (s_check_overlaps[overlap_idx(s_type_i, depletant_type_a)]
-                                  && check_circumsphere_overlap(r_ij, shape_test_a, shape_i)
-                                  && test_overlap(r_ij, shape_test_a, shape_i, err_count));
+            bool check_overlaps_ia = s_check_overlaps[overlap_idx(s_type_i, depletant_type_a)];
 
             if (shape_i.hasOrientation())
-                shape_i.orientation = quat<Scalar>(s_orientation_i_new);
-            r_ij = vec3<Scalar>(s_pos_i_new) - pos_test;
-            bool overlap_new_a = (s_check_overlaps[overlap_idx(s_type_i, depletant_type_a)]
-                                  && check_circumsphere_overlap(r_ij, shape_test_a, shape_i)
-                                  && test_overlap(r_ij, shape_test_a, shape_i, err_count));
-
-            bool add_to_queue = (!repulsive && (overlap_old_a && !overlap_new_a))
-                                || (repulsive && (overlap_new_a && !overlap_old_a));
+                shape_i.orientation
+                    = quat<Scalar>(repulsive ? s_orientation_i_old : s_orientation_i_new);
+            vec3<Scalar> r_ij = vec3<Scalar>(repulsive ? s_pos_i_old : s_pos_i_new) - pos_test;
+            bool overlap_other_a
+                = check_overlaps_ia
+                  && (check_insphere_overlap(r_ij, shape_test_a, shape_i)
+                      || (check_circumsphere_overlap(r_ij, shape_test_a, shape_i)
+                          && test_overlap(r_ij, shape_test_a, shape_i, err_count)));
+
+            bool add_to_queue = false;
+            if (!overlap_other_a)
+                {
+                if (shape_i.hasOrientation())
+                    shape_i.orientation
+                        = quat<Scalar>(repulsive ? s_orientation_i_new : s_orientation_i_old);
+                r_ij = vec3<Scalar>(repulsive ? s_pos_i_new : s_pos_i_old) - pos_test;
+                add_to_queue
+                    = check_overlaps_ia
+                      && (check_insphere_overlap(r_ij, shape_test_a, shape_i)
+                          || (check_circumsphere_overlap(r_ij, shape_test_a, shape_i)
+                              && test_overlap(r_ij, shape_test_a, shape_i, err_count)));
+                }
 
             if (add_to_queue)
                 {
@@ -0,0 +1,435 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "GPUHelpers.cuh"
+#include "HPMCMiscFunctions.h"
+#include "IntegratorHPMCMonoGPUPair.cuh"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+#include "hoomd/WarpTools.cuh"
+
+/*! \file IntegratorHPMCMonoGPUPair.cu
+    \brief Evaluates the built-in pair potentials in the HPMC narrow phase
+*/
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+namespace gpu
+    {
+namespace kernel
+    {
+//! Compute energy in old and new configuration of every particle and apply the Metropolis criterion
+/*! This kernel follows hpmc_narrow_phase_patch (IntegratorHPMCMonoGPUJIT.inc), with the energy
+    given by the flattened built-in pair potentials instead of the JIT compiled function. Groups
+    of eval_threads threads evaluate one pair of particles. Union potentials split the
+    constituent pairs among these threads.
+
+    Energies accumulate in single precision, as in hpmc_narrow_phase_patch.
+*/
+template<unsigned int eval_threads>
+__global__ void hpmc_narrow_phase_pair(const Scalar4* d_postype,
+                                       const Scalar4* d_orientation,
+                                       const Scalar4* d_trial_postype,
+                                       const Scalar4* d_trial_orientation,
+                                       const unsigned* d_trial_move_type,
+                                       const unsigned int* d_excell_idx,
+                                       const unsigned int* d_excell_size,
+                                       const Index2D excli,
+                                       const unsigned int* d_update_order_by_ptl,
+                                       const unsigned int* d_reject_in,
+                                       unsigned int* d_reject_out,
+                                       const unsigned int seed,
+                                       const uint64_t timestep,
+                                       const unsigned int select,
+                                       const unsigned int rank,
+                                       const BoxDim box,
+                                       const Scalar3 ghost_width,
+                                       const uint3 cell_dim,
+                                       const Index3D ci,
+                                       const unsigned int N_local,
+                                       const hpmc::detail::pair_potential_data_t pair,
+                                       const unsigned int* d_reject_out_of_cell,
+                                       const unsigned int max_queue_size,
+                                       const unsigned int work_offset,
+                                       const unsigned int nwork)
+    {
+    __shared__ unsigned int s_queue_size;
+    __shared__ unsigned int s_still_searching;
+
+    unsigned int group = threadIdx.y;
+    unsigned int offset = threadIdx.z;
+    unsigned int group_size = blockDim.z;
+    bool master = (offset == 0) && threadIdx.x == 0;
+    unsigned int n_groups = blockDim.y;
+
+    extern __shared__ char s_data[];
+
+    Scalar4* s_orientation_group_old = (Scalar4*)(&s_data[0]);
+    Scalar4* s_orientation_group_new = (Scalar4*)(s_orientation_group_old + n_groups);
+    Scalar3* s_pos_group_old = (Scalar3*)(s_orientation_group_new + n_groups);
+    Scalar3* s_pos_group_new = (Scalar3*)(s_pos_group_old + n_groups);
+    float* s_energy_old_group = (float*)(s_pos_group_new + n_groups);
+    float* s_energy_new_group = (float*)(s_energy_old_group + n_groups);
+    unsigned int* s_queue_j = (unsigned int*)(s_energy_new_group + n_groups);
+    unsigned int* s_queue_gid = (unsigned int*)(s_queue_j + max_queue_size);
+    unsigned int* s_type_group = (unsigned int*)(s_queue_gid + max_queue_size);
+
+    if (master && group == 0)
+        {
+        s_queue_size = 0;
+        s_still_searching = 1;
+        }
+
+    bool active = true;
+    unsigned int idx = blockIdx.x * n_groups + group;
+    if (idx >= nwork)
+        active = false;
+    idx += work_offset;
+
+    __syncthreads();
+
+    unsigned int my_cell;
+
+    // early exit
+    if (active && (d_reject_out_of_cell[idx] || d_reject_out[idx]))
+        active = false;
+
+    unsigned int update_order_i;
+    if (active)
+        {
+        // load particle i
+        Scalar4 postype_i_old(d_postype[idx]);
+        Scalar4 postype_i_new(d_trial_postype[idx]);
+        unsigned int type_i = __scalar_as_int(postype_i_old.w);
+
+        // find the cell this particle should be in
+        vec3<Scalar> pos_i_old(postype_i_old);
+        my_cell
+            = computeParticleCell(vec_to_scalar3(pos_i_old), box, ghost_width, cell_dim, ci, false);
+
+        // load order in update sequence
+        update_order_i = d_update_order_by_ptl[idx];
+
+        if (master)
+            {
+            s_pos_group_old[group]
+                = make_scalar3(postype_i_old.x, postype_i_old.y, postype_i_old.z);
+            s_pos_group_new[group]
+                = make_scalar3(postype_i_new.x, postype_i_new.y, postype_i_new.z);
+            s_type_group[group] = type_i;
+            s_orientation_group_old[group] = d_orientation[idx];
+            s_orientation_group_new[group] = d_trial_orientation[idx];
+
+            // shared variables to accumulate energy
+            s_energy_old_group[group] = 0.0f;
+            s_energy_new_group[group] = 0.0f;
+            }
+        }
+
+    // sync so that the group data is available before other threads might process energy
+    // evaluations
+    __syncthreads();
+
+    // counters to track progress through the loop over potential neighbors
+    unsigned int excell_size;
+    unsigned int k = offset;
+
+    if (active)
+        {
+        excell_size = d_excell_size[my_cell];
+        }
+
+    // only the first thread of every group of eval_threads threads adds to the queue
+    active &= threadIdx.x == 0;
+
+    while (s_still_searching)
+        {
+        // stage 1, fill the queue.
+        // loop through particles in the excell list and add them to the queue if they are within
+        // the largest cutoff of the pair potentials
+        if (active)
+            {
+            // prefetch j
+            unsigned int j, next_j = 0;
+            if ((k >> 1) < excell_size)
+                {
+                next_j = __ldg(&d_excell_idx[excli(k >> 1, my_cell)]);
+                }
+
+            // add to the queue as long as the queue is not full, and we have not yet reached the
+            // end of our own list every thread can add at most one element to the neighbor list
+            while (s_queue_size < max_queue_size && (k >> 1) < excell_size)
+                {
+                bool old_i = k & 1;
+
+                vec3<Scalar> pos_i(old_i ? s_pos_group_old[group] : s_pos_group_new[group]);
+                unsigned int type_i = s_type_group[group];
+                // prefetch next j
+                j = next_j;
+                k += group_size;
+                if ((k >> 1) < excell_size)
+                    {
+                    next_j = __ldg(&d_excell_idx[excli(k >> 1, my_cell)]);
+                    }
+
+                bool j_has_been_updated = j < N_local && d_update_order_by_ptl[j] < update_order_i
+                                          && !d_reject_in[j] && d_trial_move_type[j];
+
+                // true if particle j is in the old configuration
+                bool old_j = !j_has_been_updated;
+
+                // load particle j (always load ghosts from particle data)
+                const Scalar4 postype_j
+                    = (old_j || j >= N_local) ? d_postype[j] : d_trial_postype[j];
+                unsigned int type_j = __scalar_as_int(postype_j.w);
+                vec3<Scalar> pos_j(postype_j);
+
+                // place ourselves into the minimum image
+                vec3<Scalar> r_ij = pos_j - pos_i;
+                r_ij = box.minImage(r_ij);
+
+                LongReal rsq = dot(r_ij, r_ij);
+                LongReal r_cut_squared
+                    = __ldg(&pair.r_cut_squared_max[pair.type_param_index(type_i, type_j)]);
+
+                if (idx != j && (old_j || j < N_local) && (rsq < r_cut_squared))
+                    {
+                    // add this particle to the queue
+                    unsigned int insert_point = atomicAdd(&s_queue_size, 1);
+
+                    if (insert_point < max_queue_size)
+                        {
+                        s_queue_gid[insert_point] = (group << 1) | (old_i ? 1 : 0);
+                        s_queue_j[insert_point] = (j << 1) | (old_j ? 1 : 0);
+                        }
+                    else
+                        {
+                        // or back up if the queue is already full
+                        // we will recheck and insert this on the next time through
+                        k -= group_size;
+                        }
+                    }
+                } // end while (s_queue_size < max_queue_size && (k>>1) < excell_size)
+            } // end if active
+
+        // sync to make sure all threads in the block are caught up
+        __syncthreads();
+
+        // when we get here, all threads have either finished their list, or encountered a full
+        // queue either way, it is time to process energy evaluations need to clear the still
+        // searching flag and sync first
+        if (master && group == 0)
+            s_still_searching = 0;
+
+        unsigned int tidx_1d = offset + group_size * group;
+
+        // max_queue_size is always <= block size, so we just need an if here
+        if (tidx_1d < min(s_queue_size, max_queue_size))
+            {
+            // need to extract the energy evaluation to perform out of the shared mem queue
+            unsigned int check_group_flag = s_queue_gid[tidx_1d];
+            unsigned int check_j_flag = s_queue_j[tidx_1d];
+            bool check_old_i = check_group_flag & 1;
+            bool check_old_j = check_j_flag & 1;
+            unsigned int check_group = check_group_flag >> 1;
+            unsigned int check_j = check_j_flag >> 1;
+
+            // build particle i from shared memory
+            Scalar3 pos_i
+                = check_old_i ? s_pos_group_old[check_group] : s_pos_group_new[check_group];
+            unsigned int type_i = s_type_group[check_group];
+            Scalar4 orientation_i = check_old_i ? s_orientation_group_old[check_group]
+                                                : s_orientation_group_new[check_group];
+
+            // build particle j from global memory
+            Scalar4 postype_j = check_old_j ? d_postype[check_j] : d_trial_postype[check_j];
+            Scalar4 orientation_j
+                = check_old_j ? d_orientation[check_j] : d_trial_orientation[check_j];
+            unsigned int type_j = __scalar_as_int(postype_j.w);
+
+            // put particle j into the coordinate system of particle i
+            vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - vec3<Scalar>(pos_i);
+            r_ij = vec3<Scalar>(box.minImage(vec_to_scalar3(r_ij)));
+
+            float energy = float(hpmc::detail::pair_energy(pair,
+                                                           vec3<LongReal>(r_ij),
+                                                           type_i,
+                                                           quat<LongReal>(orientation_i),
+                                                           type_j,
+                                                           quat<LongReal>(orientation_j),
+                                                           threadIdx.x,
+                                                           eval_threads));
+
+            // sum up energy from logical warp
+            energy = hoomd::detail::WarpReduce<float, eval_threads>().Sum(energy);
+
+            if (threadIdx.x == 0)
+                {
+                if (check_old_i)
+                    {
+                    atomicAdd(&s_energy_old_group[check_group], energy);
+                    }
+                else
+                    {
+                    atomicAdd(&s_energy_new_group[check_group], energy);
+                    }
+                }
+            }
+
+        // threads that need to do more looking set the still_searching flag
+        __syncthreads();
+        if (master && group == 0)
+            s_queue_size = 0;
+
+        if (active && (k >> 1) < excell_size)
+            atomicAdd(&s_still_searching, 1);
+
+        __syncthreads();
+        } // end while (s_still_searching)
+
+    if (active && master)
+        {
+        float beta_delta_U = s_energy_new_group[group] - s_energy_old_group[group];
+
+        // Metropolis-Hastings. Use a separate stream from hpmc_narrow_phase_patch so that the two
+        // acceptance tests are independent when both kinds of potentials are present.
+        hoomd::RandomGenerator rng_i(
+            hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoPair, timestep, seed),
+            hoomd::Counter(idx, select, rank));
+        bool accept = hoomd::detail::generate_canonical<double>(rng_i) < slow::exp(-beta_delta_U);
+
+        // update device memory
+        if (!accept)
+            atomicAdd(&d_reject_out[idx], 1);
+        }
+    }
+
+//! Terminate the recursion over eval_threads
+inline void narrow_phase_pair_launcher(const hpmc_pair_args_t& args, detail::int2type<0>) { }
+
+//! Launcher for the pair potential kernel with templated eval_threads
+template<unsigned int cur_eval_threads>
+void narrow_phase_pair_launcher(const hpmc_pair_args_t& args,
+                                detail::int2type<cur_eval_threads>)
+    {
+    if (args.eval_threads == cur_eval_threads)
+        {
+        // determine the maximum block size and clamp the input block size down
+        hipFuncAttributes attr;
+        hipFuncGetAttributes(&attr,
+                             reinterpret_cast<const void*>(
+                                 kernel::hpmc_narrow_phase_pair<cur_eval_threads>));
+        unsigned int run_block_size = min(args.block_size, (unsigned int)attr.maxThreadsPerBlock);
+
+        unsigned int eval_threads = cur_eval_threads;
+        unsigned int tpp = min(args.tpp, run_block_size);
+        while (eval_threads * tpp > run_block_size || run_block_size % (eval_threads * tpp) != 0)
+            {
+            tpp--;
+            }
+        tpp = std::min((unsigned int)args.devprop.maxThreadsDim[2], tpp); // clamp blockDim.z
+
+        unsigned int n_groups = run_block_size / (tpp * eval_threads);
+        unsigned int max_queue_size = n_groups * tpp;
+
+        size_t shared_bytes
+            = n_groups
+                  * (sizeof(unsigned int) + 2 * sizeof(Scalar4) + 2 * sizeof(Scalar3)
+                     + 2 * sizeof(float))
+              + max_queue_size * 2 * sizeof(unsigned int);
+
+        while (shared_bytes + attr.sharedSizeBytes >= args.devprop.sharedMemPerBlock)
+            {
+            run_block_size -= args.devprop.warpSize;
+            if (run_block_size == 0)
+                throw std::runtime_error("Insufficient shared memory for HPMC kernel");
+
+            tpp = min(tpp, run_block_size);
+            while (eval_threads * tpp > run_block_size
+                   || run_block_size % (eval_threads * tpp) != 0)
+                {
+                tpp--;
+                }
+            tpp = std::min((unsigned int)args.devprop.maxThreadsDim[2], tpp); // clamp blockDim.z
+
+            n_groups = run_block_size / (tpp * eval_threads);
+            max_queue_size = n_groups * tpp;
+
+            shared_bytes = n_groups
+                               * (sizeof(unsigned int) + 2 * sizeof(Scalar4)
+                                  + 2 * sizeof(Scalar3) + 2 * sizeof(float))
+                           + max_queue_size * 2 * sizeof(unsigned int);
+            }
+
+        dim3 thread(eval_threads, n_groups, tpp);
+
+        for (int idev = args.gpu_partition.getNumActiveGPUs() - 1; idev >= 0; --idev)
+            {
+            auto range = args.gpu_partition.getRangeAndSetGPU(idev);
+
+            unsigned int nwork = range.second - range.first;
+            const unsigned int num_blocks = (nwork + n_groups - 1) / n_groups;
+
+            dim3 grid(num_blocks, 1, 1);
+
+            hipLaunchKernelGGL((hpmc_narrow_phase_pair<cur_eval_threads>),
+                               grid,
+                               thread,
+                               shared_bytes,
+                               0,
+                               args.d_postype,
+                               args.d_orientation,
+                               args.d_trial_postype,
+                               args.d_trial_orientation,
+                               args.d_trial_move_type,
+                               args.d_excell_idx,
+                               args.d_excell_size,
+                               args.excli,
+                               args.d_update_order_by_ptl,
+                               args.d_reject_in,
+                               args.d_reject_out,
+                               args.seed,
+                               args.timestep,
+                               args.select,
+                               args.rank,
+                               args.box,
+                               args.ghost_width,
+                               args.cell_dim,
+                               args.ci,
+                               args.N,
+                               args.pair,
+                               args.d_reject_out_of_cell,
+                               max_queue_size,
+                               range.first,
+                               nwork);
+            }
+        }
+    else
+        {
+        narrow_phase_pair_launcher(args, detail::int2type<cur_eval_threads / 2>());
+        }
+    }
+
+    } // end namespace kernel
+
+//! Kernel driver for kernel::hpmc_narrow_phase_pair
+/*! The kernel executes on the default stream after the hard particle overlap checks.
+ */
+void hpmc_narrow_phase_pair(const hpmc_pair_args_t& args)
+    {
+    assert(args.d_postype);
+    assert(args.d_orientation);
+
+    // eval_threads is a power of two no larger than the warp size
+#ifdef __HIP_PLATFORM_NVCC__
+    kernel::narrow_phase_pair_launcher(args, detail::int2type<32>());
+#else
+    kernel::narrow_phase_pair_launcher(args, detail::int2type<64>());
+#endif
+    }
+
+    } // end namespace gpu
+    } // end namespace hpmc
+    } // end namespace hoomd
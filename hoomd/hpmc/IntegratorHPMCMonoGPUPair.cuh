@@ -0,0 +1,103 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/GPUPartition.cuh"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/Index1D.h"
+#include "hoomd/hpmc/PairPotentialGPU.cuh"
+
+#include <hip/hip_runtime.h>
+
+/*! \file IntegratorHPMCMonoGPUPair.cuh
+    \brief Declares the driver for the pair potential energy kernel
+*/
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+namespace gpu
+    {
+//! Wraps arguments to hpmc_narrow_phase_pair
+/*! \ingroup hpmc_data_structs */
+struct hpmc_pair_args_t
+    {
+    //! Construct a hpmc_pair_args_t
+    hpmc_pair_args_t(const Scalar4* _d_postype,
+                     const Scalar4* _d_orientation,
+                     const Scalar4* _d_trial_postype,
+                     const Scalar4* _d_trial_orientation,
+                     const unsigned int* _d_trial_move_type,
+                     const Index3D& _ci,
+                     const uint3& _cell_dim,
+                     const Scalar3& _ghost_width,
+                     const unsigned int _N,
+                     const uint16_t _seed,
+                     const unsigned int _rank,
+                     const uint64_t _timestep,
+                     const unsigned int _select,
+                     const BoxDim& _box,
+                     const unsigned int* _d_excell_idx,
+                     const unsigned int* _d_excell_size,
+                     const Index2D& _excli,
+                     const unsigned int* _d_update_order_by_ptl,
+                     const unsigned int* _d_reject_in,
+                     unsigned int* _d_reject_out,
+                     const unsigned int* _d_reject_out_of_cell,
+                     const hpmc::detail::pair_potential_data_t& _pair,
+                     const unsigned int _block_size,
+                     const unsigned int _tpp,
+                     const unsigned int _eval_threads,
+                     const hipDeviceProp_t& _devprop,
+                     const GPUPartition& _gpu_partition)
+        : d_postype(_d_postype), d_orientation(_d_orientation), d_trial_postype(_d_trial_postype),
+          d_trial_orientation(_d_trial_orientation), d_trial_move_type(_d_trial_move_type), ci(_ci),
+          cell_dim(_cell_dim), ghost_width(_ghost_width), N(_N), seed(_seed), rank(_rank),
+          timestep(_timestep), select(_select), box(_box), d_excell_idx(_d_excell_idx),
+          d_excell_size(_d_excell_size), excli(_excli),
+          d_update_order_by_ptl(_d_update_order_by_ptl), d_reject_in(_d_reject_in),
+          d_reject_out(_d_reject_out), d_reject_out_of_cell(_d_reject_out_of_cell), pair(_pair),
+          block_size(_block_size), tpp(_tpp), eval_threads(_eval_threads), devprop(_devprop),
+          gpu_partition(_gpu_partition)
+        {
+        }
+
+    const Scalar4* d_postype;                  //!< postype array
+    const Scalar4* d_orientation;              //!< orientation array
+    const Scalar4* d_trial_postype;            //!< New positions (and type) of particles
+    const Scalar4* d_trial_orientation;        //!< New orientations of particles
+    const unsigned int* d_trial_move_type;     //!< 0=no move, 1/2 = translate/rotate
+    const Index3D& ci;                         //!< Cell indexer
+    const uint3& cell_dim;                     //!< Cell dimensions
+    const Scalar3& ghost_width;                //!< Width of the ghost layer
+    const unsigned int N;                      //!< Number of particles
+    const uint16_t seed;                       //!< RNG seed
+    const unsigned int rank;                   //!< MPI Rank
+    const uint64_t timestep;                   //!< Current timestep
+    const unsigned int select;                 //!< Current sweep within the timestep
+    const BoxDim box;                          //!< Current simulation box
+    const unsigned int* d_excell_idx;          //!< Expanded cell list
+    const unsigned int* d_excell_size;         //!< Size of expanded cells
+    const Index2D& excli;                      //!< Excell indexer
+    const unsigned int* d_update_order_by_ptl; //!< Order of the update sequence
+    const unsigned int* d_reject_in;           //!< Previous reject flags
+    unsigned int* d_reject_out;                //!< New reject flags
+    const unsigned int*
+        d_reject_out_of_cell; //!< Flag if a particle move has been rejected a priori
+    const hpmc::detail::pair_potential_data_t& pair; //!< Flattened pair potentials
+    const unsigned int block_size;                   //!< Block size to execute
+    const unsigned int tpp;                          //!< Threads per particle
+    const unsigned int eval_threads;                 //!< Threads per energy evaluation
+    const hipDeviceProp_t& devprop;                  //!< CUDA device properties
+    const GPUPartition& gpu_partition;               //!< split particles among GPUs
+    };
+
+//! Kernel driver for kernel::hpmc_narrow_phase_pair()
+void hpmc_narrow_phase_pair(const hpmc_pair_args_t& args);
+
+    } // end namespace gpu
+    } // end namespace hpmc
+    } // end namespace hoomd
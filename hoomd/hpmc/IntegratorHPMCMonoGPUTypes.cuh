@@ -121,6 +121,7 @@ struct hpmc_args_t
     const hipDeviceProp_t& devprop;            //!< CUDA device properties
     const GPUPartition& gpu_partition;         //!< Multi-GPU partition
     const hipStream_t* streams;                //!< kernel streams
+    const unsigned int* d_excell_type_class = nullptr; //!< Size class of each type (or nullptr)
     };
 
 //! Wraps arguments for hpmc_update_pdata
@@ -189,6 +190,27 @@ void hpmc_excell(unsigned int* d_excell_idx,
                  const unsigned int ngpu,
                  const unsigned int block_size);
 
+//! Driver for kernel::hpmc_excell_size_classes()
+void hpmc_excell_size_classes(unsigned int* d_excell_idx,
+                              unsigned int* d_excell_size,
+                              const Index2D& excli,
+                              const unsigned int* d_cell_idx,
+                              const unsigned int* d_cell_size,
+                              const unsigned int* d_cell_adj,
+                              const Index3D& ci,
+                              const Index2D& cli,
+                              const Index2D& cadji,
+                              const unsigned int ngpu,
+                              const Scalar4* d_postype,
+                              const unsigned int* d_type_class,
+                              const Scalar* d_class_range,
+                              const Index2D& class_idx,
+                              const BoxDim& box,
+                              const Scalar3& ghost_width,
+                              const Scalar3& cell_width,
+                              const bool euclidean,
+                              const unsigned int block_size);
+
 //! Kernel driver for kernel::hpmc_shift()
 void hpmc_shift(Scalar4* d_postype,
                 int3* d_image,
@@ -197,6 +219,13 @@ void hpmc_shift(Scalar4* d_postype,
                 const Scalar3 shift,
                 const unsigned int block_size);
 
+//! Kernel driver for kernel::hpmc_scale()
+void hpmc_scale(Scalar4* d_postype,
+                const unsigned int N,
+                const BoxDim& old_box,
+                const BoxDim& new_box,
+                const unsigned int block_size);
+
 //! Kernel to evaluate convergence
 void hpmc_check_convergence(const unsigned int* d_trial_move_type,
                             const unsigned int* d_reject_out_of_cell,
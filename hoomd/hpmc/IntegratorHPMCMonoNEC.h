@@ -41,10 +41,11 @@ template<class Shape> class IntegratorHPMCMonoNEC : public IntegratorHPMCMono<Sh
     Scalar count_pressurevirial;
     Scalar count_movelength;
 
-    private:
-    hpmc_nec_counters_t m_nec_count_run_start;  //!< Count saved at run() start
     hpmc_nec_counters_t m_nec_count_step_start; //!< Count saved at the start of the last step
 
+    private:
+    hpmc_nec_counters_t m_nec_count_run_start; //!< Count saved at run() start
+
     public:
     //! Construct the integrator
     IntegratorHPMCMonoNEC(std::shared_ptr<SystemDefinition> sysdef);
@@ -632,8 +633,8 @@ template<class Shape> void IntegratorHPMCMonoNEC<Shape>::update(uint64_t timeste
     // migrate and exchange particles
     this->communicate(true);
 
-    // all particle have been moved, the aabb tree is now invalid
-    this->m_aabb_tree_invalid = true;
+    // all particle have been moved, refit the aabb tree before the next use
+    this->m_aabb_tree_moved = true;
 
     hpmc_counters_t run_counters = this->getCounters(1);
     hpmc_nec_counters_t run_nec_counters = getNECCounters(1);
@@ -642,6 +643,7 @@ template<class Shape> void IntegratorHPMCMonoNEC<Shape>::update(uint64_t timeste
         = run_counters.rotate_accept_count + run_counters.rotate_reject_count
           + run_nec_counters.chain_at_collision_count + run_nec_counters.chain_no_collision_count;
     this->m_mps = double(sum_of_moves) / cur_time;
+    this->recordUpdateWalltime();
     }
 
 template<class Shape>
@@ -0,0 +1,723 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/Index1D.h"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+#include "hoomd/VectorMath.h"
+#include "hoomd/hpmc/HPMCCounters.h"
+#include "hoomd/hpmc/Moves.h"
+#include <hip/hip_runtime.h>
+
+#include "GPUHelpers.cuh"
+
+/*! \file IntegratorHPMCMonoNECGPU.cuh
+    \brief Declares the driver for the Newtonian event chain kernel
+*/
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+namespace gpu
+    {
+//! Wraps arguments to hpmc_nec_chains
+/*! \ingroup hpmc_data_structs */
+struct hpmc_nec_args_t
+    {
+    //! Construct a hpmc_nec_args_t
+    hpmc_nec_args_t(Scalar4* _d_postype,
+                    Scalar4* _d_orientation,
+                    Scalar4* _d_vel,
+                    const unsigned int* _d_cell_idx,
+                    const unsigned int* _d_cell_size,
+                    const Index3D& _ci,
+                    const Index2D& _cli,
+                    const uint3& _cell_dim,
+                    const uint3 _color,
+                    const unsigned int* _d_excell_idx,
+                    const unsigned int* _d_excell_size,
+                    const Index2D& _excli,
+                    const unsigned int _num_types,
+                    const uint16_t _seed,
+                    const unsigned int _rank,
+                    const uint64_t _timestep,
+                    const unsigned int _select,
+                    const unsigned int _dim,
+                    const BoxDim& _box,
+                    const Scalar* _d_d,
+                    const Scalar* _d_a,
+                    const unsigned int* _d_check_overlaps,
+                    const Index2D& _overlap_idx,
+                    const Scalar _chain_time,
+                    const unsigned int _chain_probability,
+                    const Scalar _update_fraction,
+                    hpmc_counters_t* _d_counters,
+                    hpmc_nec_counters_t* _d_nec_counters,
+                    Scalar2* _d_virial,
+                    const unsigned int _block_size,
+                    const hipDeviceProp_t& _devprop)
+        : d_postype(_d_postype), d_orientation(_d_orientation), d_vel(_d_vel),
+          d_cell_idx(_d_cell_idx), d_cell_size(_d_cell_size), ci(_ci), cli(_cli),
+          cell_dim(_cell_dim), color(_color), d_excell_idx(_d_excell_idx),
+          d_excell_size(_d_excell_size), excli(_excli), num_types(_num_types), seed(_seed),
+          rank(_rank), timestep(_timestep), select(_select), dim(_dim), box(_box), d_d(_d_d),
+          d_a(_d_a), d_check_overlaps(_d_check_overlaps), overlap_idx(_overlap_idx),
+          chain_time(_chain_time), chain_probability(_chain_probability),
+          update_fraction(_update_fraction), d_counters(_d_counters),
+          d_nec_counters(_d_nec_counters), d_virial(_d_virial), block_size(_block_size),
+          devprop(_devprop)
+        {
+        }
+
+    Scalar4* d_postype;                   //!< postype array
+    Scalar4* d_orientation;               //!< orientation array
+    Scalar4* d_vel;                       //!< velocities array (the chain directions)
+    const unsigned int* d_cell_idx;       //!< Index data for each cell
+    const unsigned int* d_cell_size;      //!< Number of particles in each cell
+    const Index3D& ci;                    //!< Cell indexer
+    const Index2D& cli;                   //!< Indexer for d_cell_idx
+    const uint3& cell_dim;                //!< Cell dimensions
+    const uint3 color;                    //!< Offset of the active cells (0 or 1 per direction)
+    const unsigned int* d_excell_idx;     //!< Expanded cell list
+    const unsigned int* d_excell_size;    //!< Size of expanded cells
+    const Index2D& excli;                 //!< Excell indexer
+    const unsigned int num_types;         //!< Number of particle types
+    const uint16_t seed;                  //!< RNG seed
+    const unsigned int rank;              //!< MPI Rank
+    const uint64_t timestep;              //!< Current timestep
+    const unsigned int select;            //!< Current sweep within the timestep
+    const unsigned int dim;               //!< Number of dimensions
+    const BoxDim box;                     //!< Current simulation box
+    const Scalar* d_d;                    //!< Collision search distance by type
+    const Scalar* d_a;                    //!< Maximum rotation move by type
+    const unsigned int* d_check_overlaps; //!< Interaction matrix
+    const Index2D& overlap_idx;           //!< Indexer into interaction matrix
+    const Scalar chain_time;              //!< Length of a chain
+    const unsigned int chain_probability; //!< Probability of a chain (in units of 1/65536)
+    const Scalar update_fraction;         //!< Number of chains per particle in the cell
+    hpmc_counters_t* d_counters;          //!< Move counters per cell
+    hpmc_nec_counters_t* d_nec_counters;  //!< Chain counters per cell
+    Scalar2* d_virial;                    //!< Pressure virial and move length per cell
+    const unsigned int block_size;        //!< Block size to execute
+    const hipDeviceProp_t& devprop;       //!< CUDA device properties
+    };
+
+//! Kernel driver for kernel::hpmc_nec_chains()
+template<class Shape>
+void hpmc_nec_chains(const hpmc_nec_args_t& args, const typename Shape::param_type* params);
+
+#ifdef __HIPCC__
+namespace kernel
+    {
+//! Limit a sweep so that the moving particle stays inside its cell
+/*! \param sweep Sweep distance (in/out)
+    \param f Fractional coordinate of the particle
+    \param df Change of the fractional coordinate per unit sweep distance
+    \param lo Fractional coordinate of the lower cell boundary
+    \param hi Fractional coordinate of the upper cell boundary
+    \returns true when the cell boundary limits the sweep
+*/
+__device__ inline bool
+limitSweepToCell(Scalar& sweep, const Scalar f, const Scalar df, const Scalar lo, const Scalar hi)
+    {
+    // keep a small margin so that the particle remains strictly inside the cell
+    const Scalar margin = Scalar(1e-6) * (hi - lo);
+    Scalar s;
+    if (df > Scalar(0.0))
+        s = (hi - margin - f) / df;
+    else if (df < Scalar(0.0))
+        s = (lo + margin - f) / df;
+    else
+        return false;
+
+    if (s < sweep)
+        {
+        sweep = s > Scalar(0.0) ? s : Scalar(0.0);
+        return true;
+        }
+    return false;
+    }
+
+//! Run Newtonian event chains in the active cells of one checkerboard color
+/*! One block handles one active cell and runs its chains one after another. The threads in the
+    block split the particles in the expanded cell when searching for the next collision and reduce
+    the collision distances in shared memory. Thread 0 moves the particles and updates the chain.
+
+    Active cells of the same color are separated by at least one cell that is wider than the
+    largest particle, so particles in different active cells never interact. Particles in the
+    neighboring cells do not move. A chain ends when its particle reaches the boundary of the cell
+    or collides with a particle outside of the cell.
+*/
+template<class Shape, unsigned int dim>
+__global__ void hpmc_nec_chains(Scalar4* d_postype,
+                                Scalar4* d_orientation,
+                                Scalar4* d_vel,
+                                const unsigned int* d_cell_idx,
+                                const unsigned int* d_cell_size,
+                                const Index3D ci,
+                                const Index2D cli,
+                                const uint3 cell_dim,
+                                const uint3 color,
+                                const unsigned int* d_excell_idx,
+                                const unsigned int* d_excell_size,
+                                const Index2D excli,
+                                const unsigned int num_types,
+                                const uint16_t seed,
+                                const unsigned int rank,
+                                const uint64_t timestep,
+                                const unsigned int select,
+                                const BoxDim box,
+                                const Scalar* d_d,
+                                const Scalar* d_a,
+                                const unsigned int* d_check_overlaps,
+                                const Index2D overlap_idx,
+                                const Scalar chain_time,
+                                const unsigned int chain_probability,
+                                const Scalar update_fraction,
+                                hpmc_counters_t* d_counters,
+                                hpmc_nec_counters_t* d_nec_counters,
+                                Scalar2* d_virial,
+                                const typename Shape::param_type* d_params)
+    {
+    // load the per type parameters into shared memory
+    HIP_DYNAMIC_SHARED(char, s_data)
+
+    typename Shape::param_type* s_params = (typename Shape::param_type*)(&s_data[0]);
+    Scalar* s_d = (Scalar*)(s_params + num_types);
+    Scalar* s_a = (Scalar*)(s_d + num_types);
+    Scalar* s_sweep = (Scalar*)(s_a + num_types);
+    int* s_next = (int*)(s_sweep + blockDim.x);
+    unsigned int* s_check_overlaps = (unsigned int*)(s_next + blockDim.x);
+    unsigned int ntyppairs = overlap_idx.getNumElements();
+
+    // state of the current chain, written by thread 0
+    __shared__ int s_chain_particle;
+    __shared__ Scalar3 s_direction;
+    __shared__ Scalar s_velocity;
+    __shared__ Scalar s_chain_time;
+    __shared__ Scalar3 s_collision_plane;
+    __shared__ unsigned int s_overlap;
+
+    // statistics gathered by all threads
+    __shared__ unsigned long long int s_distance_queries;
+    __shared__ unsigned long long int s_overlap_checks;
+    __shared__ unsigned int s_sweep_err_count;
+    __shared__ unsigned int s_overlap_err_count;
+
+    const bool master = threadIdx.x == 0;
+
+        // copy over parameters one int per thread for fast loads
+        {
+        unsigned int tidx = threadIdx.x;
+        unsigned int block_size = blockDim.x;
+        unsigned int param_size = num_types * sizeof(typename Shape::param_type) / sizeof(int);
+
+        for (unsigned int cur_offset = 0; cur_offset < param_size; cur_offset += block_size)
+            {
+            if (cur_offset + tidx < param_size)
+                {
+                ((int*)s_params)[cur_offset + tidx] = ((int*)d_params)[cur_offset + tidx];
+                }
+            }
+
+        for (unsigned int cur_offset = 0; cur_offset < num_types; cur_offset += block_size)
+            {
+            if (cur_offset + tidx < num_types)
+                {
+                s_a[cur_offset + tidx] = d_a[cur_offset + tidx];
+                s_d[cur_offset + tidx] = d_d[cur_offset + tidx];
+                }
+            }
+
+        for (unsigned int cur_offset = 0; cur_offset < ntyppairs; cur_offset += block_size)
+            {
+            if (cur_offset + tidx < ntyppairs)
+                {
+                s_check_overlaps[cur_offset + tidx] = d_check_overlaps[cur_offset + tidx];
+                }
+            }
+        }
+
+    if (master)
+        {
+        s_distance_queries = 0;
+        s_overlap_checks = 0;
+        s_sweep_err_count = 0;
+        s_overlap_err_count = 0;
+        }
+
+    __syncthreads();
+
+    // identify the active cell that this block handles
+    Index3D active_ci(cell_dim.x / 2, cell_dim.y / 2, dim == 3 ? cell_dim.z / 2 : 1);
+    uint3 active_cell = active_ci.getTriple(blockIdx.x);
+    uint3 c = make_uint3(2 * active_cell.x + color.x,
+                         2 * active_cell.y + color.y,
+                         dim == 3 ? 2 * active_cell.z + color.z : 0);
+    const unsigned int cell = ci(c.x, c.y, c.z);
+    const unsigned int n_cell = d_cell_size[cell];
+    const unsigned int excell_size = d_excell_size[cell];
+
+    if (n_cell == 0)
+        return;
+
+    // fractional coordinates of the cell boundaries
+    const Scalar3 f_lo = make_scalar3(Scalar(c.x) / Scalar(cell_dim.x),
+                                      Scalar(c.y) / Scalar(cell_dim.y),
+                                      Scalar(c.z) / Scalar(cell_dim.z));
+    const Scalar3 f_hi = make_scalar3(Scalar(c.x + 1) / Scalar(cell_dim.x),
+                                      Scalar(c.y + 1) / Scalar(cell_dim.y),
+                                      Scalar(c.z + 1) / Scalar(cell_dim.z));
+
+    // All threads draw the same random numbers, so they make the same choices without
+    // communication.
+    hoomd::RandomGenerator rng(hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoChainMove, timestep, seed),
+                               hoomd::Counter(cell, rank, select));
+
+    // stochastically round the number of chains in this cell
+    Scalar n_chains_real = update_fraction * Scalar(n_cell);
+    unsigned int n_chains = (unsigned int)n_chains_real;
+    if (hoomd::detail::generate_canonical<Scalar>(rng) < n_chains_real - Scalar(n_chains))
+        n_chains++;
+
+    // statistics accumulated by thread 0
+    hpmc_counters_t counters;
+    hpmc_nec_counters_t nec_counters;
+    Scalar count_pressurevirial(0.0);
+    Scalar count_movelength(0.0);
+
+    // statistics accumulated by each thread
+    unsigned long long int distance_queries = 0;
+    unsigned long long int overlap_checks = 0;
+    unsigned int sweep_err_count = 0;
+    unsigned int overlap_err_count = 0;
+
+    const Scalar3 ghost_width = make_scalar3(0, 0, 0);
+    const unsigned int debug_max_chain = 100000;
+
+    for (unsigned int cur_chain = 0; cur_chain < n_chains; ++cur_chain)
+        {
+        unsigned int i = d_cell_idx[cli(hoomd::UniformIntDistribution(n_cell - 1)(rng), cell)];
+        unsigned int move_type_select = hoomd::UniformIntDistribution(0xffff)(rng);
+
+        // wait for the previous chain to finish writing the particle data
+        __syncthreads();
+
+        Scalar4 postype_i = d_postype[i];
+        unsigned int typ_i = __scalar_as_int(postype_i.w);
+        Shape shape_i(quat<Scalar>(), s_params[typ_i]);
+        if (shape_i.hasOrientation())
+            shape_i.orientation = quat<Scalar>(d_orientation[i]);
+
+        bool move_type_translate
+            = !shape_i.hasOrientation() || (move_type_select < chain_probability);
+
+        if (move_type_translate)
+            {
+            if (master)
+                {
+                nec_counters.chain_start_count++;
+
+                // take the particle's velocity as direction and normalize the direction vector
+                vec3<Scalar> v(d_vel[i]);
+                Scalar velocity = fast::sqrt(dot(v, v));
+                s_velocity = velocity;
+                s_direction = velocity > Scalar(0.0) ? vec_to_scalar3(v / velocity)
+                                                     : make_scalar3(0, 0, 0);
+                s_chain_time = chain_time;
+
+                // chains of particles at rest have no direction
+                s_chain_particle = velocity > Scalar(0.0) ? int(i) : -1;
+                }
+
+            __syncthreads();
+
+            for (unsigned int count_chain = 0; count_chain < debug_max_chain; ++count_chain)
+                {
+                // k is the current particle, which is to be moved
+                int k = s_chain_particle;
+                if (k < 0)
+                    break;
+
+                vec3<Scalar> direction(s_direction);
+
+                Scalar4 postype_k = d_postype[k];
+                unsigned int typ_k = __scalar_as_int(postype_k.w);
+                vec3<Scalar> pos_k(postype_k);
+                Shape shape_k(quat<Scalar>(), s_params[typ_k]);
+                if (shape_k.hasOrientation())
+                    shape_k.orientation = quat<Scalar>(d_orientation[k]);
+
+                // each thread searches part of the expanded cell for the nearest collision within
+                // the search distance
+                Scalar sweep = s_d[typ_k];
+                int next = -1;
+                vec3<Scalar> collision_plane;
+
+                for (unsigned int m = threadIdx.x; m < excell_size; m += blockDim.x)
+                    {
+                    unsigned int j = d_excell_idx[excli(m, cell)];
+                    if (j == (unsigned int)k)
+                        continue;
+
+                    Scalar4 postype_j = d_postype[j];
+                    unsigned int typ_j = __scalar_as_int(postype_j.w);
+                    Shape shape_j(quat<Scalar>(), s_params[typ_j]);
+                    if (shape_j.hasOrientation())
+                        shape_j.orientation = quat<Scalar>(d_orientation[j]);
+
+                    // put particle j into the coordinate system of particle k
+                    vec3<Scalar> r_kj = vec3<Scalar>(postype_j) - pos_k;
+                    r_kj = vec3<Scalar>(box.minImage(vec_to_scalar3(r_kj)));
+
+                    distance_queries++;
+
+                    if (!s_check_overlaps[overlap_idx(typ_k, typ_j)])
+                        continue;
+
+                    Scalar max_r = Scalar(0.5)
+                                       * (shape_k.getCircumsphereDiameter()
+                                          + shape_j.getCircumsphereDiameter())
+                                   + sweep;
+                    if (dot(r_kj, r_kj) >= max_r * max_r)
+                        continue;
+
+                    vec3<Scalar> new_collision_plane = r_kj;
+                    Scalar new_sweep = sweep_distance(r_kj,
+                                                      shape_k,
+                                                      shape_j,
+                                                      direction,
+                                                      sweep_err_count,
+                                                      new_collision_plane);
+
+                    // resultOverlapping = -3.0, treat overlapping particles ahead of k as an
+                    // immediate collision
+                    if (new_sweep < Scalar(-3.5) && dot(r_kj, direction) > Scalar(0.0))
+                        new_sweep = Scalar(0.0);
+
+                    bool tie = new_sweep == sweep && next >= 0 && int(j) < next;
+                    if (new_sweep >= Scalar(0.0) && (new_sweep < sweep || tie))
+                        {
+                        sweep = new_sweep;
+                        next = j;
+                        collision_plane = new_collision_plane;
+                        }
+                    }
+
+                // find the nearest collision in the block, break ties by particle index
+                s_sweep[threadIdx.x] = sweep;
+                s_next[threadIdx.x] = next;
+                __syncthreads();
+
+                for (unsigned int offset = 1; offset < blockDim.x; offset *= 2)
+                    {
+                    if (threadIdx.x % (2 * offset) == 0 && threadIdx.x + offset < blockDim.x)
+                        {
+                        Scalar other_sweep = s_sweep[threadIdx.x + offset];
+                        int other_next = s_next[threadIdx.x + offset];
+                        if (other_sweep < s_sweep[threadIdx.x]
+                            || (other_sweep == s_sweep[threadIdx.x]
+                                && other_next < s_next[threadIdx.x]))
+                            {
+                            s_sweep[threadIdx.x] = other_sweep;
+                            s_next[threadIdx.x] = other_next;
+                            }
+                        }
+                    __syncthreads();
+                    }
+
+                if (next >= 0 && next == s_next[0])
+                    s_collision_plane = vec_to_scalar3(collision_plane);
+                __syncthreads();
+
+                if (master)
+                    {
+                    sweep = s_sweep[0];
+                    next = s_next[0];
+                    collision_plane = vec3<Scalar>(s_collision_plane);
+                    Scalar velocity = s_velocity;
+                    Scalar chain_time_left = s_chain_time;
+
+                    // If there is no collision within the search distance, move the particle by
+                    // the search distance and continue with it in the next iteration.
+                    if (next < 0)
+                        next = k;
+
+                    // stop the chain at the boundary of the cell
+                    Scalar3 f = box.makeFraction(vec_to_scalar3(pos_k));
+                    Scalar3 df = box.makeFraction(vec_to_scalar3(pos_k + direction)) - f;
+                    bool at_boundary = limitSweepToCell(sweep, f.x, df.x, f_lo.x, f_hi.x);
+                    at_boundary |= limitSweepToCell(sweep, f.y, df.y, f_lo.y, f_hi.y);
+                    if (dim == 3)
+                        at_boundary |= limitSweepToCell(sweep, f.z, df.z, f_lo.z, f_hi.z);
+                    if (at_boundary)
+                        next = -1;
+
+                    // if we go further than what is left: stop
+                    if (sweep > chain_time_left * velocity)
+                        {
+                        sweep = chain_time_left * velocity;
+                        next = -1;
+                        }
+
+                    // statistics for pressure  -1-
+                    count_movelength += sweep;
+
+                    pos_k += sweep * direction;
+                    chain_time_left -= sweep / velocity;
+
+                    // Counters are used as in IntegratorHPMCMonoNEC, so the move size tuners treat
+                    // collisions as rejections.
+                    if (!shape_i.ignoreStatistics())
+                        {
+                        if (next != k && next > -1)
+                            {
+                            counters.translate_reject_count++;
+                            nec_counters.chain_at_collision_count++;
+                            }
+                        else
+                            {
+                            if (next != -1)
+                                {
+                                counters.translate_accept_count++;
+                                }
+                            nec_counters.chain_no_collision_count++;
+                            }
+                        }
+
+                    // update position of particle, it remains inside the cell and the box
+                    d_postype[k] = make_scalar4(pos_k.x, pos_k.y, pos_k.z, postype_k.w);
+
+                    if (next != k && next > -1)
+                        {
+                        vec3<Scalar> pos_n(d_postype[next]);
+                        vec3<Scalar> delta_pos(box.minImage(vec_to_scalar3(pos_n - pos_k)));
+
+                        // statistics for pressure  -2-
+                        count_pressurevirial += dot(delta_pos, direction);
+
+                        unsigned int cell_n = computeParticleCell(vec_to_scalar3(pos_n),
+                                                                  box,
+                                                                  ghost_width,
+                                                                  cell_dim,
+                                                                  ci,
+                                                                  false);
+
+                        if (cell_n == cell)
+                            {
+                            // Update Velocities (fully elastic)
+                            Scalar4 vel4_n = d_vel[next];
+                            Scalar4 vel4_k = d_vel[k];
+                            vec3<Scalar> vel_n(vel4_n);
+                            vec3<Scalar> vel_k(vel4_k);
+                            vec3<Scalar> delta_vel = vel_n - vel_k;
+                            vec3<Scalar> vel_change
+                                = collision_plane
+                                  * (dot(delta_vel, collision_plane)
+                                     / dot(collision_plane, collision_plane));
+
+                            vel_n -= vel_change;
+                            vel_k += vel_change;
+
+                            d_vel[next] = make_scalar4(vel_n.x, vel_n.y, vel_n.z, vel4_n.w);
+                            d_vel[k] = make_scalar4(vel_k.x, vel_k.y, vel_k.z, vel4_k.w);
+
+                            velocity = fast::sqrt(dot(vel_n, vel_n));
+                            if (velocity == Scalar(0.0))
+                                {
+                                next = -1;
+                                }
+                            else
+                                {
+                                s_direction = vec_to_scalar3(vel_n / velocity);
+                                }
+                            }
+                        else
+                            {
+                            // Particles outside of the active cell may not move, and chains in
+                            // other active cells may collide with them concurrently.
+                            next = -1;
+                            }
+                        }
+
+                    s_chain_particle = next;
+                    s_velocity = velocity;
+                    s_chain_time = chain_time_left;
+                    }
+
+                __syncthreads();
+                } // end loop over chain elements
+            }
+        else
+            {
+            // all threads generate the same trial orientation
+            quat<Scalar> orientation_new = shape_i.orientation;
+            move_rotate<dim>(orientation_new, rng, s_a[typ_i]);
+            Shape shape_new(orientation_new, s_params[typ_i]);
+            vec3<Scalar> pos_i(postype_i);
+
+            if (master)
+                s_overlap = 0;
+            __syncthreads();
+
+            for (unsigned int m = threadIdx.x; m < excell_size; m += blockDim.x)
+                {
+                unsigned int j = d_excell_idx[excli(m, cell)];
+                if (j == i)
+                    continue;
+
+                Scalar4 postype_j = d_postype[j];
+                unsigned int typ_j = __scalar_as_int(postype_j.w);
+                Shape shape_j(quat<Scalar>(), s_params[typ_j]);
+                if (shape_j.hasOrientation())
+                    shape_j.orientation = quat<Scalar>(d_orientation[j]);
+
+                // put particle j into the coordinate system of particle i
+                vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i;
+                r_ij = vec3<Scalar>(box.minImage(vec_to_scalar3(r_ij)));
+
+                overlap_checks++;
+                ShortReal rsq = ShortReal(dot(r_ij, r_ij));
+                ShortReal DaDb
+                    = shape_new.getCircumsphereDiameter() + shape_j.getCircumsphereDiameter();
+
+                if (s_check_overlaps[overlap_idx(typ_i, typ_j)]
+                    && rsq * ShortReal(4.0) <= DaDb * DaDb
+                    && test_overlap(r_ij, shape_new, shape_j, overlap_err_count))
+                    {
+                    atomicAdd(&s_overlap, 1);
+                    break;
+                    }
+                }
+
+            __syncthreads();
+
+            if (master)
+                {
+                if (!s_overlap)
+                    {
+                    d_orientation[i] = quat_to_scalar4(orientation_new);
+                    if (!shape_i.ignoreStatistics())
+                        counters.rotate_accept_count++;
+                    }
+                else if (!shape_i.ignoreStatistics())
+                    {
+                    counters.rotate_reject_count++;
+                    }
+                }
+            }
+        } // end loop over chains
+
+    // final tally into global mem
+    atomicAdd(&s_distance_queries, distance_queries);
+    atomicAdd(&s_overlap_checks, overlap_checks);
+    atomicAdd(&s_sweep_err_count, sweep_err_count);
+    atomicAdd(&s_overlap_err_count, overlap_err_count);
+    __syncthreads();
+
+    if (master)
+        {
+        counters.overlap_checks = s_overlap_checks;
+        counters.overlap_err_count = s_overlap_err_count;
+        nec_counters.distance_queries = s_distance_queries;
+        nec_counters.overlap_err_count = s_sweep_err_count;
+
+        // each cell is active once per color sweep, so no other block writes to its entries
+        d_counters[cell] = d_counters[cell] + counters;
+        d_nec_counters[cell] = d_nec_counters[cell] + nec_counters;
+        Scalar2 virial = d_virial[cell];
+        d_virial[cell] = make_scalar2(virial.x + count_pressurevirial, virial.y + count_movelength);
+        }
+    }
+
+    } // end namespace kernel
+
+//! Launch kernel::hpmc_nec_chains() for the given dimension
+template<class Shape, unsigned int dim>
+void hpmc_nec_chains_launcher(const hpmc_nec_args_t& args,
+                              const typename Shape::param_type* params)
+    {
+    // determine the maximum block size and clamp the input block size down
+    int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(kernel::hpmc_nec_chains<Shape, dim>));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int block_size = min(args.block_size, (unsigned int)max_block_size);
+    size_t shared_bytes = args.num_types * (sizeof(typename Shape::param_type) + 2 * sizeof(Scalar))
+                          + block_size * (sizeof(Scalar) + sizeof(int))
+                          + args.overlap_idx.getNumElements() * sizeof(unsigned int);
+
+    if (shared_bytes + attr.sharedSizeBytes >= args.devprop.sharedMemPerBlock)
+        throw std::runtime_error("hpmc::kernel::nec_chains() exceeds shared memory limits");
+
+    // one block per active cell
+    unsigned int n_active_cells = (args.cell_dim.x / 2) * (args.cell_dim.y / 2)
+                                  * (dim == 3 ? args.cell_dim.z / 2 : 1);
+    if (n_active_cells == 0)
+        return;
+
+    dim3 threads(block_size, 1, 1);
+    dim3 grid(n_active_cells, 1, 1);
+
+    hipLaunchKernelGGL((kernel::hpmc_nec_chains<Shape, dim>),
+                       grid,
+                       threads,
+                       shared_bytes,
+                       0,
+                       args.d_postype,
+                       args.d_orientation,
+                       args.d_vel,
+                       args.d_cell_idx,
+                       args.d_cell_size,
+                       args.ci,
+                       args.cli,
+                       args.cell_dim,
+                       args.color,
+                       args.d_excell_idx,
+                       args.d_excell_size,
+                       args.excli,
+                       args.num_types,
+                       args.seed,
+                       args.rank,
+                       args.timestep,
+                       args.select,
+                       args.box,
+                       args.d_d,
+                       args.d_a,
+                       args.d_check_overlaps,
+                       args.overlap_idx,
+                       args.chain_time,
+                       args.chain_probability,
+                       args.update_fraction,
+                       args.d_counters,
+                       args.d_nec_counters,
+                       args.d_virial,
+                       params);
+    }
+
+//! Kernel driver for kernel::hpmc_nec_chains()
+template<class Shape>
+void hpmc_nec_chains(const hpmc_nec_args_t& args, const typename Shape::param_type* params)
+    {
+    assert(args.d_postype);
+    assert(args.d_orientation);
+    assert(args.d_vel);
+    assert(args.d_d);
+    assert(args.d_a);
+
+    if (args.dim == 2)
+        hpmc_nec_chains_launcher<Shape, 2>(args, params);
+    else
+        hpmc_nec_chains_launcher<Shape, 3>(args, params);
+    }
+#endif
+
+    } // end namespace gpu
+    } // end namespace hpmc
+    } // end namespace hoomd
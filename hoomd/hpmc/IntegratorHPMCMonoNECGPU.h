@@ -0,0 +1,489 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#ifdef ENABLE_HIP
+
+#include "hoomd/hpmc/IntegratorHPMCMonoGPUTypes.cuh"
+#include "hoomd/hpmc/IntegratorHPMCMonoNEC.h"
+#include "hoomd/hpmc/IntegratorHPMCMonoNECGPU.cuh"
+
+#include "hoomd/Autotuner.h"
+#include "hoomd/CellList.h"
+#include "hoomd/GlobalArray.h"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+
+#include <algorithm>
+#include <array>
+#include <sstream>
+
+/*! \file IntegratorHPMCMonoNECGPU.h
+    \brief Declaration of IntegratorHPMCMonoNECGPU
+    \note This header cannot be compiled by nvcc
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+//! Template class for HPMC update with Newtonian event chains on the GPU
+/*! The box is divided into cells at least as wide as the largest particle with an even number of
+    cells in each direction. The cells are split into 2^d colors so that no two cells of the same
+    color are adjacent. One kernel launch runs the chains of all cells of one color in parallel,
+    one block per cell.
+
+    A chain ends when its particle reaches the boundary of its cell, or when it collides with a
+    particle in a different cell. The cell grid is shifted by a random vector before each sweep so
+    that all particles eventually cross cell boundaries.
+
+    \ingroup hpmc_integrators
+*/
+template<class Shape> class IntegratorHPMCMonoNECGPU : public IntegratorHPMCMonoNEC<Shape>
+    {
+    public:
+    //! Construct the integrator
+    IntegratorHPMCMonoNECGPU(std::shared_ptr<SystemDefinition> sysdef,
+                             std::shared_ptr<CellList> cl);
+
+    //! Destructor
+    virtual ~IntegratorHPMCMonoNECGPU() { }
+
+    //! Take one timestep forward
+    virtual void update(uint64_t timestep);
+
+    protected:
+    std::shared_ptr<CellList> m_cl; //!< Cell list
+    uint3 m_last_dim;               //!< Dimensions of the cell list on the last call to update
+    unsigned int m_last_nmax;       //!< Last cell list NMax value allocated in excell
+
+    GlobalArray<unsigned int> m_excell_idx;  //!< Particle indices in expanded cells
+    GlobalArray<unsigned int> m_excell_size; //!< Number of particles in each expanded cell
+    Index2D m_excell_list_indexer;           //!< Indexer to access elements of the excell_idx list
+
+    GlobalArray<hpmc_counters_t> m_cell_counters;         //!< Move counters per cell
+    GlobalArray<hpmc_nec_counters_t> m_cell_nec_counters; //!< Chain counters per cell
+    GlobalArray<Scalar2> m_cell_virial; //!< Pressure virial and move length per cell
+
+    /// Autotuner for the chain kernel block size
+    std::shared_ptr<Autotuner<1>> m_tuner_chains;
+
+    /// Autotuner for excell block_size
+    std::shared_ptr<Autotuner<1>> m_tuner_excell_block_size;
+
+    //! Set up excell_list and the per cell accumulators
+    virtual void initializeExcellMem();
+
+    //! Set the nominal width of the cell list
+    virtual void updateCellWidth();
+    };
+
+template<class Shape>
+IntegratorHPMCMonoNECGPU<Shape>::IntegratorHPMCMonoNECGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                                          std::shared_ptr<CellList> cl)
+    : IntegratorHPMCMonoNEC<Shape>(sysdef), m_cl(cl)
+    {
+    this->m_cl->setRadius(1);
+    this->m_cl->setComputeTypeBody(false);
+    this->m_cl->setFlagType();
+    this->m_cl->setComputeIdx(true);
+
+    // the checkerboard needs an even number of cells in every direction
+    this->m_cl->setMultiple(2);
+
+    // set last dim to a bogus value so that it will re-init on the first call
+    m_last_dim = make_uint3(0xffffffff, 0xffffffff, 0xffffffff);
+    m_last_nmax = 0xffffffff;
+
+    GlobalArray<unsigned int> excell_size(0, this->m_exec_conf);
+    m_excell_size.swap(excell_size);
+    TAG_ALLOCATION(m_excell_size);
+
+    GlobalArray<unsigned int> excell_idx(0, this->m_exec_conf);
+    m_excell_idx.swap(excell_idx);
+    TAG_ALLOCATION(m_excell_idx);
+
+    GlobalArray<hpmc_counters_t> cell_counters(0, this->m_exec_conf);
+    m_cell_counters.swap(cell_counters);
+    TAG_ALLOCATION(m_cell_counters);
+
+    GlobalArray<hpmc_nec_counters_t> cell_nec_counters(0, this->m_exec_conf);
+    m_cell_nec_counters.swap(cell_nec_counters);
+    TAG_ALLOCATION(m_cell_nec_counters);
+
+    GlobalArray<Scalar2> cell_virial(0, this->m_exec_conf);
+    m_cell_virial.swap(cell_virial);
+    TAG_ALLOCATION(m_cell_virial);
+
+    m_tuner_chains.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
+                                          this->m_exec_conf,
+                                          "hpmc_nec_chains"));
+
+    m_tuner_excell_block_size.reset(
+        new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
+                         this->m_exec_conf,
+                         "hpmc_nec_excell_block_size"));
+
+    this->m_autotuners.insert(this->m_autotuners.end(),
+                              {m_tuner_chains, m_tuner_excell_block_size});
+    }
+
+template<class Shape> void IntegratorHPMCMonoNECGPU<Shape>::update(uint64_t timestep)
+    {
+    this->m_exec_conf->msg->notice(10) << "HPMCMonoNECGPU update: " << timestep << std::endl;
+    IntegratorHPMC::update(timestep);
+
+    // save the counters at the start of the step
+        {
+        ArrayHandle<hpmc_nec_counters_t> h_nec_counters(this->m_nec_count_total,
+                                                        access_location::host,
+                                                        access_mode::read);
+        this->m_nec_count_step_start = h_nec_counters.data[0];
+        }
+
+    // reset pressure statistics
+    this->count_pressurevirial = 0.0;
+    this->count_movelength = 0.0;
+
+    // limit m_d entries so that particles cannot possibly wander more than one box image in one
+    // time step
+    this->limitMoveDistances();
+
+    const unsigned int ndim = this->m_sysdef->getNDimensions();
+
+    if (this->m_pdata->getN() > 0)
+        {
+        // check if we are below a minimum image convention box size
+        const BoxDim& box = this->m_pdata->getBox();
+        Scalar3 nearest_plane_distance = box.getNearestPlaneDistance();
+
+        if ((box.getPeriodic().x && nearest_plane_distance.x <= this->m_nominal_width * 2)
+            || (box.getPeriodic().y && nearest_plane_distance.y <= this->m_nominal_width * 2)
+            || (ndim == 3 && box.getPeriodic().z
+                && nearest_plane_distance.z <= this->m_nominal_width * 2))
+            {
+            std::ostringstream oss;
+
+            oss << "Simulation box too small for GPU accelerated HPMC execution - increase it so "
+                   "the minimum image convention may be applied."
+                << std::endl;
+
+            oss << "nominal_width = " << this->m_nominal_width << std::endl;
+            if (box.getPeriodic().x)
+                oss << "nearest_plane_distance.x=" << nearest_plane_distance.x << std::endl;
+            if (box.getPeriodic().y)
+                oss << "nearest_plane_distance.y=" << nearest_plane_distance.y << std::endl;
+            if (ndim == 3 && box.getPeriodic().z)
+                oss << "nearest_plane_distance.z=" << nearest_plane_distance.z << std::endl;
+            throw std::runtime_error(oss.str());
+            }
+
+        // rng for the grid shift and the order of the colors
+        hoomd::RandomGenerator rng(hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoCheckerboard,
+                                               timestep,
+                                               this->m_sysdef->getSeed()),
+                                   hoomd::Counter(this->m_exec_conf->getRank()));
+
+        for (unsigned int i_nselect = 0; i_nselect < this->m_nselect; i_nselect++)
+            {
+            // shift the particles by a random vector so that the cell boundaries move
+            this->m_cl->compute(timestep);
+            Scalar3 cell_width = this->m_cl->getCellWidth();
+            Scalar3 shift = make_scalar3(0, 0, 0);
+            shift.x = hoomd::UniformDistribution<Scalar>(-cell_width.x / Scalar(2.0),
+                                                         cell_width.x / Scalar(2.0))(rng);
+            shift.y = hoomd::UniformDistribution<Scalar>(-cell_width.y / Scalar(2.0),
+                                                         cell_width.y / Scalar(2.0))(rng);
+            if (ndim == 3)
+                {
+                shift.z = hoomd::UniformDistribution<Scalar>(-cell_width.z / Scalar(2.0),
+                                                             cell_width.z / Scalar(2.0))(rng);
+                }
+
+                {
+                ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
+                                               access_location::device,
+                                               access_mode::readwrite);
+                ArrayHandle<int3> d_image(this->m_pdata->getImages(),
+                                          access_location::device,
+                                          access_mode::readwrite);
+
+                gpu::hpmc_shift(d_postype.data,
+                                d_image.data,
+                                this->m_pdata->getN(),
+                                box,
+                                shift,
+                                128);
+                if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                    CHECK_CUDA_ERROR();
+                }
+
+            // update the particle data origin
+            this->m_pdata->translateOrigin(shift);
+
+            // the particles moved, rebuild the cell list
+            this->m_cl->forceCompute(timestep);
+
+            const uint3 cell_dim = this->m_cl->getDim();
+            if (cell_dim.x < 2 || cell_dim.y < 2 || (ndim == 3 && cell_dim.z < 2))
+                {
+                throw std::runtime_error("Simulation box too small for GPU accelerated NEC "
+                                         "execution - it needs at least two cells per direction.");
+                }
+
+            // if the cell list is a different size than last time, reinitialize the expanded cell
+            // list
+            if (m_last_dim.x != cell_dim.x || m_last_dim.y != cell_dim.y
+                || m_last_dim.z != cell_dim.z || m_last_nmax != this->m_cl->getNmax())
+                {
+                initializeExcellMem();
+
+                m_last_dim = cell_dim;
+                m_last_nmax = this->m_cl->getNmax();
+                }
+
+            ArrayHandle<unsigned int> d_cell_size(this->m_cl->getCellSizeArray(),
+                                                  access_location::device,
+                                                  access_mode::read);
+            ArrayHandle<unsigned int> d_cell_idx(this->m_cl->getIndexArray(),
+                                                 access_location::device,
+                                                 access_mode::read);
+            ArrayHandle<unsigned int> d_cell_adj(this->m_cl->getCellAdjArray(),
+                                                 access_location::device,
+                                                 access_mode::read);
+
+            ArrayHandle<unsigned int> d_excell_idx(m_excell_idx,
+                                                   access_location::device,
+                                                   access_mode::overwrite);
+            ArrayHandle<unsigned int> d_excell_size(m_excell_size,
+                                                    access_location::device,
+                                                    access_mode::overwrite);
+
+            // update the expanded cells
+            m_tuner_excell_block_size->begin();
+            gpu::hpmc_excell(d_excell_idx.data,
+                             d_excell_size.data,
+                             m_excell_list_indexer,
+                             d_cell_idx.data,
+                             d_cell_size.data,
+                             d_cell_adj.data,
+                             this->m_cl->getCellIndexer(),
+                             this->m_cl->getCellListIndexer(),
+                             this->m_cl->getCellAdjIndexer(),
+                             1,
+                             m_tuner_excell_block_size->getParam()[0]);
+            if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            m_tuner_excell_block_size->end();
+
+            // access the particle data
+            ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
+                                           access_location::device,
+                                           access_mode::readwrite);
+            ArrayHandle<Scalar4> d_orientation(this->m_pdata->getOrientationArray(),
+                                               access_location::device,
+                                               access_mode::readwrite);
+            ArrayHandle<Scalar4> d_vel(this->m_pdata->getVelocities(),
+                                       access_location::device,
+                                       access_mode::readwrite);
+
+            // access the parameters and interaction matrix
+            ArrayHandle<Scalar> d_d(this->m_d, access_location::device, access_mode::read);
+            ArrayHandle<Scalar> d_a(this->m_a, access_location::device, access_mode::read);
+            ArrayHandle<unsigned int> d_overlaps(this->m_overlaps,
+                                                 access_location::device,
+                                                 access_mode::read);
+
+            // per cell accumulators, reset on every cell list rebuild
+            ArrayHandle<hpmc_counters_t> d_cell_counters(m_cell_counters,
+                                                         access_location::device,
+                                                         access_mode::readwrite);
+            ArrayHandle<hpmc_nec_counters_t> d_cell_nec_counters(m_cell_nec_counters,
+                                                                 access_location::device,
+                                                                 access_mode::readwrite);
+            ArrayHandle<Scalar2> d_cell_virial(m_cell_virial,
+                                               access_location::device,
+                                               access_mode::readwrite);
+
+            // visit the colors in a random order
+            const unsigned int n_colors = ndim == 3 ? 8 : 4;
+            std::array<unsigned int, 8> colors = {0, 1, 2, 3, 4, 5, 6, 7};
+            for (unsigned int i = n_colors - 1; i > 0; --i)
+                {
+                unsigned int j = hoomd::UniformIntDistribution(i)(rng);
+                std::swap(colors[i], colors[j]);
+                }
+
+            for (unsigned int i_color = 0; i_color < n_colors; ++i_color)
+                {
+                uint3 color = make_uint3(colors[i_color] & 1,
+                                         (colors[i_color] >> 1) & 1,
+                                         (colors[i_color] >> 2) & 1);
+
+                m_tuner_chains->begin();
+                gpu::hpmc_nec_args_t args(d_postype.data,
+                                          d_orientation.data,
+                                          d_vel.data,
+                                          d_cell_idx.data,
+                                          d_cell_size.data,
+                                          this->m_cl->getCellIndexer(),
+                                          this->m_cl->getCellListIndexer(),
+                                          cell_dim,
+                                          color,
+                                          d_excell_idx.data,
+                                          d_excell_size.data,
+                                          m_excell_list_indexer,
+                                          this->m_pdata->getNTypes(),
+                                          this->m_sysdef->getSeed(),
+                                          this->m_exec_conf->getRank(),
+                                          timestep,
+                                          i_nselect * n_colors + i_color,
+                                          ndim,
+                                          box,
+                                          d_d.data,
+                                          d_a.data,
+                                          d_overlaps.data,
+                                          this->m_overlap_idx,
+                                          this->m_chain_time,
+                                          this->m_chain_probability,
+                                          this->m_update_fraction,
+                                          d_cell_counters.data,
+                                          d_cell_nec_counters.data,
+                                          d_cell_virial.data,
+                                          m_tuner_chains->getParam()[0],
+                                          this->m_exec_conf->dev_prop);
+
+                gpu::hpmc_nec_chains<Shape>(args, this->m_params.data());
+                if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                    CHECK_CUDA_ERROR();
+                m_tuner_chains->end();
+                }
+            } // end loop over nselect
+
+        // sum the per cell statistics
+        ArrayHandle<hpmc_counters_t> h_cell_counters(m_cell_counters,
+                                                     access_location::host,
+                                                     access_mode::readwrite);
+        ArrayHandle<hpmc_nec_counters_t> h_cell_nec_counters(m_cell_nec_counters,
+                                                             access_location::host,
+                                                             access_mode::readwrite);
+        ArrayHandle<Scalar2> h_cell_virial(m_cell_virial,
+                                           access_location::host,
+                                           access_mode::readwrite);
+        ArrayHandle<hpmc_counters_t> h_counters(this->m_count_total,
+                                                access_location::host,
+                                                access_mode::readwrite);
+        ArrayHandle<hpmc_nec_counters_t> h_nec_counters(this->m_nec_count_total,
+                                                        access_location::host,
+                                                        access_mode::readwrite);
+
+        for (unsigned int cell = 0; cell < m_cell_counters.getNumElements(); ++cell)
+            {
+            h_counters.data[0] = h_counters.data[0] + h_cell_counters.data[cell];
+            h_nec_counters.data[0] = h_nec_counters.data[0] + h_cell_nec_counters.data[cell];
+            this->count_pressurevirial += h_cell_virial.data[cell].x;
+            this->count_movelength += h_cell_virial.data[cell].y;
+
+            h_cell_counters.data[cell] = hpmc_counters_t();
+            h_cell_nec_counters.data[cell] = hpmc_nec_counters_t();
+            h_cell_virial.data[cell] = make_scalar2(0, 0);
+            }
+        }
+
+    // migrate and exchange particles
+    this->communicate(true);
+
+    // all particle have been moved, refit the aabb tree before the next use
+    this->m_aabb_tree_moved = true;
+
+    hpmc_counters_t run_counters = this->getCounters(1);
+    hpmc_nec_counters_t run_nec_counters = this->getNECCounters(1);
+    double cur_time = double(this->m_clock.getTime()) / Scalar(1e9);
+    unsigned long long sum_of_moves
+        = run_counters.rotate_accept_count + run_counters.rotate_reject_count
+          + run_nec_counters.chain_at_collision_count + run_nec_counters.chain_no_collision_count;
+    this->m_mps = double(sum_of_moves) / cur_time;
+    this->recordUpdateWalltime();
+    }
+
+template<class Shape> void IntegratorHPMCMonoNECGPU<Shape>::initializeExcellMem()
+    {
+    this->m_exec_conf->msg->notice(4) << "hpmc resizing expanded cells" << std::endl;
+
+    // get the current cell dimensions
+    unsigned int num_cells = this->m_cl->getCellIndexer().getNumElements();
+    unsigned int num_adj = this->m_cl->getCellAdjIndexer().getW();
+    unsigned int num_max = this->m_cl->getNmax();
+
+    // make the excell dimensions the same, but with room for Nmax*Nadj in each cell
+    m_excell_list_indexer = Index2D(num_max * num_adj, num_cells);
+
+    // reallocate memory
+    m_excell_idx.resize(m_excell_list_indexer.getNumElements());
+    m_excell_size.resize(num_cells);
+
+    // the accumulators are summed and cleared at the end of every step, so they are empty here
+    GlobalArray<hpmc_counters_t> cell_counters(num_cells, this->m_exec_conf);
+    m_cell_counters.swap(cell_counters);
+    TAG_ALLOCATION(m_cell_counters);
+
+    GlobalArray<hpmc_nec_counters_t> cell_nec_counters(num_cells, this->m_exec_conf);
+    m_cell_nec_counters.swap(cell_nec_counters);
+    TAG_ALLOCATION(m_cell_nec_counters);
+
+    GlobalArray<Scalar2> cell_virial(num_cells, this->m_exec_conf);
+    m_cell_virial.swap(cell_virial);
+    TAG_ALLOCATION(m_cell_virial);
+
+    ArrayHandle<hpmc_counters_t> h_cell_counters(m_cell_counters,
+                                                 access_location::host,
+                                                 access_mode::overwrite);
+    ArrayHandle<hpmc_nec_counters_t> h_cell_nec_counters(m_cell_nec_counters,
+                                                         access_location::host,
+                                                         access_mode::overwrite);
+    ArrayHandle<Scalar2> h_cell_virial(m_cell_virial,
+                                       access_location::host,
+                                       access_mode::overwrite);
+    std::fill(h_cell_counters.data, h_cell_counters.data + num_cells, hpmc_counters_t());
+    std::fill(h_cell_nec_counters.data,
+              h_cell_nec_counters.data + num_cells,
+              hpmc_nec_counters_t());
+    std::fill(h_cell_virial.data, h_cell_virial.data + num_cells, make_scalar2(0, 0));
+    }
+
+template<class Shape> void IntegratorHPMCMonoNECGPU<Shape>::updateCellWidth()
+    {
+    // call base class method
+    IntegratorHPMCMonoNEC<Shape>::updateCellWidth();
+
+    // update the cell list
+    this->m_cl->setNominalWidth(this->m_nominal_width);
+    }
+
+namespace detail
+    {
+//! Export the IntegratorHPMCMonoNECGPU class to python
+/*! \param name Name of the class in the exported python module
+    \tparam Shape An instantiation of IntegratorHPMCMonoNECGPU<Shape> will be exported
+*/
+template<class Shape>
+void export_IntegratorHPMCMonoNECGPU(pybind11::module& m, const std::string& name)
+    {
+    pybind11::class_<IntegratorHPMCMonoNECGPU<Shape>,
+                     IntegratorHPMCMonoNEC<Shape>,
+                     std::shared_ptr<IntegratorHPMCMonoNECGPU<Shape>>>(m, name.c_str())
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<CellList>>());
+    }
+
+    } // end namespace detail
+    } // end namespace hpmc
+    } // end namespace hoomd
+
+#endif // ENABLE_HIP
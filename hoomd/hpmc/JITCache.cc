@@ -0,0 +1,164 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "JITCache.h"
+#include "hoomd/HOOMDVersion.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+/** @param compiler_id String that identifies the compiler, its version, and the target.
+ */
+JITCache::JITCache(const std::string& compiler_id) : m_compiler_id(compiler_id)
+    {
+    const char* directory = std::getenv("HOOMD_JIT_CACHE_DIR");
+    if (directory == nullptr || directory[0] == 0)
+        {
+        return;
+        }
+
+    // create the directory when needed, disable the cache when that is not possible
+    struct stat buffer;
+    if (stat(directory, &buffer) != 0 && mkdir(directory, 0755) != 0 && errno != EEXIST)
+        {
+        return;
+        }
+
+    m_directory = directory;
+    }
+
+/** @param code The code to compile.
+    @param args The compiler arguments.
+
+    @returns The key identifying the entry.
+*/
+std::string JITCache::makeKey(const std::string& code, const std::vector<std::string>& args) const
+    {
+    std::ostringstream key;
+    key << "HOOMD-blue " << HOOMD_VERSION << '\n';
+    key << m_compiler_id << '\n';
+    for (const auto& arg : args)
+        {
+        key << arg << '\n';
+        }
+    key << '\n' << code;
+    return key.str();
+    }
+
+/** @param key The key identifying the entry.
+
+    @returns The path of the file that stores the entry.
+*/
+std::string JITCache::getPath(const std::string& key) const
+    {
+    // 64-bit FNV-1a hash
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : key)
+        {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+        }
+
+    std::ostringstream path;
+    path << m_directory << "/" << std::hex << std::setw(16) << std::setfill('0') << hash
+         << ".jit";
+    return path.str();
+    }
+
+/** @param code The code to compile.
+    @param args The compiler arguments.
+    @param data Set to the compiled code when the entry is found.
+
+    @returns true when the entry is found.
+*/
+bool JITCache::load(const std::string& code,
+                    const std::vector<std::string>& args,
+                    std::string& data) const
+    {
+    if (!isEnabled())
+        {
+        return false;
+        }
+
+    std::string key = makeKey(code, args);
+    std::ifstream file(getPath(key), std::ios::binary);
+    if (!file)
+        {
+        return false;
+        }
+
+    // the file stores the size of the key, the key, and the data
+    size_t key_size = 0;
+    file >> key_size;
+    if (!file || file.get() != '\n' || key_size != key.size())
+        {
+        return false;
+        }
+
+    std::string stored_key(key_size, 0);
+    file.read(&stored_key[0], key_size);
+    if (!file || stored_key != key)
+        {
+        return false;
+        }
+
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    data = contents.str();
+    return !data.empty();
+    }
+
+/** @param code The code to compile.
+    @param args The compiler arguments.
+    @param data The compiled code.
+
+    @returns true when the entry is written.
+*/
+bool JITCache::store(const std::string& code,
+                     const std::vector<std::string>& args,
+                     const std::string& data) const
+    {
+    if (!isEnabled() || data.empty())
+        {
+        return false;
+        }
+
+    std::string key = makeKey(code, args);
+    std::string path = getPath(key);
+    std::string temporary_path = path + "." + std::to_string(getpid()) + ".tmp";
+
+        {
+        std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+        file << key.size() << '\n';
+        file.write(key.data(), key.size());
+        file.write(data.data(), data.size());
+        if (!file)
+            {
+            file.close();
+            std::remove(temporary_path.c_str());
+            return false;
+            }
+        }
+
+    if (std::rename(temporary_path.c_str(), path.c_str()) != 0)
+        {
+        std::remove(temporary_path.c_str());
+        return false;
+        }
+
+    return true;
+    }
+
+    } // end namespace hpmc
+    } // end namespace hoomd
@@ -0,0 +1,63 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+// do not include python headers
+#include <string>
+#include <vector>
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+/** Persistent on-disk cache of compiled JIT code.
+
+    Set the environment variable HOOMD_JIT_CACHE_DIR to a directory to enable the cache. Each entry
+    is keyed by the code, the compiler arguments, the HOOMD-blue version, and a string that
+    identifies the compiler and target (provided by the caller). The file name is a hash of the
+    key and the file stores the full key, so hash collisions are detected on load and treated as
+    misses.
+
+    Entries are written to a temporary file and renamed into place so that concurrent jobs sharing
+    a cache directory never read partially written entries. The cache is best effort: failures to
+    read or write entries fall back to compiling the code.
+*/
+class JITCache
+    {
+    public:
+    /// Construct the cache
+    JITCache(const std::string& compiler_id);
+
+    /// Test if the cache is enabled
+    bool isEnabled() const
+        {
+        return !m_directory.empty();
+        }
+
+    /// Look up an entry in the cache
+    bool load(const std::string& code,
+              const std::vector<std::string>& args,
+              std::string& data) const;
+
+    /// Store an entry in the cache
+    bool store(const std::string& code,
+               const std::vector<std::string>& args,
+               const std::string& data) const;
+
+    private:
+    /// Directory holding the cache entries, empty when the cache is disabled
+    std::string m_directory;
+
+    /// Identifies the compiler, its version, and the target
+    std::string m_compiler_id;
+
+    /// Build the key that identifies an entry
+    std::string makeKey(const std::string& code, const std::vector<std::string>& args) const;
+
+    /// Get the file name of the entry with the given key
+    std::string getPath(const std::string& key) const;
+    };
+
+    } // end namespace hpmc
+    } // end namespace hoomd
@@ -6,10 +6,25 @@
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/SystemDefinition.h"
 
+#include "PairPotentialGPU.cuh"
+
 namespace hoomd
     {
 namespace hpmc
     {
+/// Pair potentials flattened for evaluation on the GPU (see PairPotentialGPU.cuh)
+struct PairPotentialGPUData
+    {
+    /// Nodes of the tree.
+    std::vector<detail::PairPotentialNode> nodes;
+
+    /// Parameters.
+    std::vector<LongReal> params;
+
+    /// Parameter tables.
+    std::vector<unsigned int> index;
+    };
+
 /*** Functor that computes pair interactions between particles
 
     PairPotential allows energetic interactions to be included in an HPMC simulation. This
@@ -137,6 +152,37 @@ class PairPotential
         return 0;
         }
 
+    /*** Flatten this potential for evaluation on the GPU
+
+        Appends the parameters of this potential and the nodes of its children to data.
+
+        @param data Flattened potentials.
+        @returns The node that represents this potential.
+    */
+    detail::PairPotentialNode makeGPUNode(PairPotentialGPUData& data) const
+        {
+        detail::PairPotentialNode node = {};
+        node.r_cut_offset = static_cast<unsigned int>(data.params.size());
+        data.params.insert(data.params.end(),
+                           m_r_cut_squared_total.begin(),
+                           m_r_cut_squared_total.end());
+
+        fillGPUNode(node, data);
+        return node;
+        }
+
+    /*** Flatten this potential and append its node to data.
+
+        @param data Flattened potentials.
+        @returns The index of the node in data.nodes.
+    */
+    unsigned int appendGPUNode(PairPotentialGPUData& data) const
+        {
+        detail::PairPotentialNode node = makeGPUNode(data);
+        data.nodes.push_back(node);
+        return static_cast<unsigned int>(data.nodes.size() - 1);
+        }
+
     protected:
     /// The system definition.
     std::shared_ptr<SystemDefinition> m_sysdef;
@@ -144,6 +190,19 @@ class PairPotential
     /// Indexer to access arrays by pairs of type parameters
     Index2D m_type_param_index;
 
+    /*** Set the kind and parameters of the GPU node
+
+        Subclasses that can be evaluated on the GPU set node.kind and the fields that the kind
+        uses, and append their parameters to data. The base implementation throws.
+
+        @param node Node to fill. makeGPUNode sets node.r_cut_offset.
+        @param data Flattened potentials.
+    */
+    virtual void fillGPUNode(detail::PairPotentialNode& node, PairPotentialGPUData& data) const
+        {
+        throw std::runtime_error("This pair potential is not implemented on the GPU.");
+        }
+
     /// Notify all parents that r_cut has changed.
     void notifyRCutChanged()
         {
@@ -113,6 +113,32 @@ LongReal PairPotentialAngularStep::energy(const LongReal r_squared,
     return 0;
     }
 
+void PairPotentialAngularStep::fillGPUNode(detail::PairPotentialNode& node,
+                                           PairPotentialGPUData& data) const
+    {
+    node.kind = detail::pair_angular_step;
+    node.child = m_isotropic_potential->appendGPUNode(data);
+    unsigned int child_kind = data.nodes[node.child].kind;
+    if (child_kind != detail::pair_lennard_jones && child_kind != detail::pair_step)
+        {
+        throw std::runtime_error("AngularStep supports only LennardJones and Step isotropic "
+                                 "potentials on the GPU.");
+        }
+
+    node.index_offset = static_cast<unsigned int>(data.index.size());
+    for (unsigned int type = 0; type < m_directors.size(); type++)
+        {
+        data.index.push_back(static_cast<unsigned int>(data.params.size()));
+        data.index.push_back(static_cast<unsigned int>(m_directors[type].size()));
+        for (size_t m = 0; m < m_directors[type].size(); m++)
+            {
+            const vec3<LongReal>& director = m_directors[type][m];
+            data.params.insert(data.params.end(),
+                               {director.x, director.y, director.z, m_cos_deltas[type][m]});
+            }
+        }
+    }
+
 namespace detail
     {
 void exportPairPotentialAngularStep(pybind11::module& m)
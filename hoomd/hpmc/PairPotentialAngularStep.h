@@ -94,6 +94,9 @@ class PairPotentialAngularStep : public hpmc::PairPotential
     /// Type pair parameters of potential
     std::vector<std::vector<vec3<LongReal>>> m_directors;
     std::vector<std::vector<LongReal>> m_cos_deltas;
+
+    /// Set the kind and parameters of the GPU node.
+    virtual void fillGPUNode(detail::PairPotentialNode& node, PairPotentialGPUData& data) const;
     };
 
     } // end namespace hpmc
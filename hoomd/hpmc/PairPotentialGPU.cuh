@@ -0,0 +1,366 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/Index1D.h"
+#include "hoomd/VectorMath.h"
+
+/*! \file PairPotentialGPU.cuh
+    \brief Evaluate the built-in HPMC pair potentials on the GPU
+
+    PairPotential subclasses are virtual and hold their parameters in std::vector, so the GPU
+    cannot call them. Instead, IntegratorHPMCMonoGPU flattens the tree of pair potentials into
+    an array of nodes and two parameter arrays (see PairPotential::makeGPUNode). The functions in
+    this file evaluate the flattened tree with the same expressions as the CPU implementations.
+*/
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__
+#else
+#define HOSTDEVICE
+#endif
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+namespace detail
+    {
+//! Kinds of pair potential nodes
+enum pair_potential_kind
+    {
+    pair_lennard_jones = 0,
+    pair_step,
+    pair_angular_step,
+    pair_union
+    };
+
+//! One pair potential in the flattened tree
+/*! All offsets index the params or index arrays of pair_potential_data_t. Every node stores the
+    total r_cut squared of each type pair at params[r_cut_offset + type_param_index(type_i,
+    type_j)]. The remaining fields depend on the kind:
+
+    - pair_lennard_jones: mode is the energy shift mode. params[param_offset + 4 * p] holds
+      sigma_6, epsilon_x_4, r_cut_squared, and r_on_squared of type pair p.
+    - pair_step: index[index_offset + 2 * p] is the first element in params of type pair p and
+      index[index_offset + 2 * p + 1] is the number of steps n. params holds the n squared radii
+      followed by the n energies.
+    - pair_angular_step: child is the isotropic potential. index[index_offset + 2 * type] is the
+      first element in params of the patches of type and index[index_offset + 2 * type + 1] is the
+      number of patches. params holds 4 values per patch: the director and cos(delta).
+    - pair_union: child is the constituent potential. index[index_offset + 3 * type] is the first
+      element in params, index[index_offset + 3 * type + 1] is the first element in index of the
+      constituent types, and index[index_offset + 3 * type + 2] is the number of constituents.
+      params holds 7 values per constituent: the position and the orientation.
+*/
+struct PairPotentialNode
+    {
+    unsigned int kind;         //!< Kind of potential (pair_potential_kind)
+    unsigned int mode;         //!< Energy shift mode (pair_lennard_jones)
+    unsigned int child;        //!< Index of the child node (pair_angular_step, pair_union)
+    unsigned int r_cut_offset; //!< First element of the total r_cut squared in params
+    unsigned int param_offset; //!< First element of the parameters in params
+    unsigned int index_offset; //!< First element of the parameter table in index
+    };
+
+//! Flattened pair potentials in device memory
+/*! The top level potentials (the ones IntegratorHPMC sums) are the first n_roots nodes.
+    r_cut_squared_max holds the largest total r_cut squared of any top level potential per type
+    pair.
+*/
+struct pair_potential_data_t
+    {
+    const PairPotentialNode* nodes;    //!< Nodes of the tree
+    const LongReal* params;            //!< Parameters
+    const unsigned int* index;         //!< Parameter tables
+    const LongReal* r_cut_squared_max; //!< Largest r_cut squared per type pair
+    unsigned int n_roots;              //!< Number of top level potentials
+    Index2D type_param_index;          //!< Indexes type pairs
+    };
+
+//! Evaluate a Lennard-Jones pair potential (see PairPotentialLennardJones::energy)
+HOSTDEVICE inline LongReal pair_energy_lennard_jones(const PairPotentialNode& node,
+                                                      const pair_potential_data_t& data,
+                                                      const LongReal r_squared,
+                                                      const unsigned int param_index)
+    {
+    // the values of PairPotentialLennardJones::EnergyShiftMode
+    const unsigned int shift = 1;
+    const unsigned int xplor = 2;
+
+    const LongReal* param = data.params + node.param_offset + 4 * param_index;
+    const LongReal sigma_6 = param[0];
+    const LongReal epsilon_x_4 = param[1];
+    const LongReal r_cut_squared = param[2];
+    const LongReal r_on_squared = param[3];
+
+    LongReal lj2 = epsilon_x_4 * sigma_6;
+    LongReal lj1 = lj2 * sigma_6;
+
+    LongReal r_2_inverse = LongReal(1.0) / r_squared;
+    LongReal r_6_inverse = r_2_inverse * r_2_inverse * r_2_inverse;
+
+    LongReal energy = r_6_inverse * (lj1 * r_6_inverse - lj2);
+
+    if (node.mode == shift || (node.mode == xplor && r_on_squared >= r_cut_squared))
+        {
+        LongReal r_cut_2_inverse = LongReal(1.0) / r_cut_squared;
+        LongReal r_cut_6_inverse = r_cut_2_inverse * r_cut_2_inverse * r_cut_2_inverse;
+        energy -= r_cut_6_inverse * (lj1 * r_cut_6_inverse - lj2);
+        }
+
+    if (node.mode == xplor && r_squared > r_on_squared)
+        {
+        LongReal a = r_cut_squared - r_on_squared;
+        LongReal denominator = a * a * a;
+
+        LongReal b = r_cut_squared - r_squared;
+        LongReal numerator
+            = b * b * (r_cut_squared + LongReal(2.0) * r_squared - LongReal(3.0) * r_on_squared);
+        energy *= numerator / denominator;
+        }
+
+    return energy;
+    }
+
+//! Evaluate a step function pair potential (see PairPotentialStep::energy)
+HOSTDEVICE inline LongReal pair_energy_step(const PairPotentialNode& node,
+                                             const pair_potential_data_t& data,
+                                             const LongReal r_squared,
+                                             const unsigned int param_index)
+    {
+    const unsigned int N = data.index[node.index_offset + 2 * param_index + 1];
+    if (N == 0)
+        {
+        return 0;
+        }
+
+    const LongReal* r_squared_step = data.params + data.index[node.index_offset + 2 * param_index];
+    const LongReal* epsilon = r_squared_step + N;
+
+    // Perform a binary search based on r_squared to find the relevant potential value.
+    unsigned int L = 0;
+    unsigned int R = N;
+
+    while (L < R)
+        {
+        unsigned int m = (L + R) / 2;
+
+        if (r_squared_step[m] <= r_squared)
+            {
+            L = m + 1;
+            }
+        else
+            {
+            R = m;
+            }
+        }
+
+    if (L < N)
+        {
+        return epsilon[L];
+        }
+    else
+        {
+        return 0;
+        }
+    }
+
+//! Evaluate an isotropic pair potential
+HOSTDEVICE inline LongReal pair_energy_isotropic(const PairPotentialNode& node,
+                                                  const pair_potential_data_t& data,
+                                                  const LongReal r_squared,
+                                                  const unsigned int type_i,
+                                                  const unsigned int type_j)
+    {
+    const unsigned int param_index = data.type_param_index(type_i, type_j);
+    if (node.kind == pair_lennard_jones)
+        {
+        return pair_energy_lennard_jones(node, data, r_squared, param_index);
+        }
+    else
+        {
+        return pair_energy_step(node, data, r_squared, param_index);
+        }
+    }
+
+//! Test whether any pair of patches faces the other particle (see PairPotentialAngularStep)
+HOSTDEVICE inline bool pair_angular_mask(const PairPotentialNode& node,
+                                         const pair_potential_data_t& data,
+                                         const LongReal r_squared,
+                                         const vec3<LongReal>& r_ij,
+                                         const unsigned int type_i,
+                                         const quat<LongReal>& q_i,
+                                         const unsigned int type_j,
+                                         const quat<LongReal>& q_j)
+    {
+    vec3<LongReal> rhat_ij = r_ij / fast::sqrt(r_squared);
+
+    const LongReal* patch_i = data.params + data.index[node.index_offset + 2 * type_i];
+    const unsigned int n_patch_i = data.index[node.index_offset + 2 * type_i + 1];
+    const LongReal* patch_j = data.params + data.index[node.index_offset + 2 * type_j];
+    const unsigned int n_patch_j = data.index[node.index_offset + 2 * type_j + 1];
+
+    for (unsigned int m = 0; m < n_patch_i; m++)
+        {
+        const LongReal* p_m = patch_i + 4 * m;
+        vec3<LongReal> ehat_m = rotate(q_i, vec3<LongReal>(p_m[0], p_m[1], p_m[2]));
+
+        if (dot(ehat_m, rhat_ij) < p_m[3])
+            {
+            continue;
+            }
+
+        for (unsigned int n = 0; n < n_patch_j; n++)
+            {
+            const LongReal* p_n = patch_j + 4 * n;
+            vec3<LongReal> ehat_n = rotate(q_j, vec3<LongReal>(p_n[0], p_n[1], p_n[2]));
+
+            if (dot(ehat_n, -rhat_ij) >= p_n[3])
+                {
+                return true;
+                }
+            }
+        }
+    return false;
+    }
+
+//! Evaluate a pair potential that is not a union
+/*! The caller must check r_squared against the r_cut of the node.
+ */
+HOSTDEVICE inline LongReal pair_energy_leaf(const PairPotentialNode& node,
+                                             const pair_potential_data_t& data,
+                                             const LongReal r_squared,
+                                             const vec3<LongReal>& r_ij,
+                                             const unsigned int type_i,
+                                             const quat<LongReal>& q_i,
+                                             const unsigned int type_j,
+                                             const quat<LongReal>& q_j)
+    {
+    if (node.kind == pair_angular_step)
+        {
+        if (pair_angular_mask(node, data, r_squared, r_ij, type_i, q_i, type_j, q_j))
+            {
+            return pair_energy_isotropic(data.nodes[node.child], data, r_squared, type_i, type_j);
+            }
+        return 0;
+        }
+
+    return pair_energy_isotropic(node, data, r_squared, type_i, type_j);
+    }
+
+//! Evaluate a subset of the constituent pairs of a union pair potential
+/*! \param first First constituent pair to evaluate
+    \param stride Evaluate every stride-th constituent pair
+
+    Evaluates all N_i * N_j pairs of constituents like PairPotentialUnion::energyAll. Threads
+    that cooperate on one particle pair pass their rank as \a first and their count as \a stride.
+*/
+HOSTDEVICE inline LongReal pair_energy_union(const PairPotentialNode& node,
+                                              const pair_potential_data_t& data,
+                                              const vec3<LongReal>& r_ij,
+                                              const unsigned int type_i,
+                                              const quat<LongReal>& q_i,
+                                              const unsigned int type_j,
+                                              const quat<LongReal>& q_j,
+                                              const unsigned int first,
+                                              const unsigned int stride)
+    {
+    const PairPotentialNode& constituent = data.nodes[node.child];
+
+    const unsigned int* table_i = data.index + node.index_offset + 3 * type_i;
+    const unsigned int* table_j = data.index + node.index_offset + 3 * type_j;
+    const unsigned int N_i = table_i[2];
+    const unsigned int N_j = table_j[2];
+
+    const quat<LongReal> conj_q_j(conj(q_j));
+    const quat<LongReal> conj_q_j_q_i(conj_q_j * q_i);
+    const vec3<LongReal> r_ij_rotated = rotate(conj_q_j, r_ij);
+
+    LongReal energy = 0.0;
+    for (unsigned int k = first; k < N_i * N_j; k += stride)
+        {
+        const unsigned int i = k / N_j;
+        const unsigned int j = k % N_j;
+
+        // Rotate and translate the constituent of i to j's body frame.
+        const LongReal* p_i = data.params + table_i[0] + 7 * i;
+        unsigned int constituent_type_i = data.index[table_i[1] + i];
+        quat<LongReal> constituent_orientation_i
+            = conj_q_j_q_i * quat<LongReal>(p_i[3], vec3<LongReal>(p_i[4], p_i[5], p_i[6]));
+        vec3<LongReal> constituent_position_i(
+            rotate(conj_q_j_q_i, vec3<LongReal>(p_i[0], p_i[1], p_i[2])) - r_ij_rotated);
+
+        const LongReal* p_j = data.params + table_j[0] + 7 * j;
+        unsigned int constituent_type_j = data.index[table_j[1] + j];
+        quat<LongReal> constituent_orientation_j(p_j[3], vec3<LongReal>(p_j[4], p_j[5], p_j[6]));
+        vec3<LongReal> constituent_r_ij
+            = vec3<LongReal>(p_j[0], p_j[1], p_j[2]) - constituent_position_i;
+
+        LongReal rsq = dot(constituent_r_ij, constituent_r_ij);
+        unsigned int param_index = data.type_param_index(constituent_type_i, constituent_type_j);
+        if (rsq < data.params[constituent.r_cut_offset + param_index])
+            {
+            energy += pair_energy_leaf(constituent,
+                                       data,
+                                       rsq,
+                                       constituent_r_ij,
+                                       constituent_type_i,
+                                       constituent_orientation_i,
+                                       constituent_type_j,
+                                       constituent_orientation_j);
+            }
+        }
+    return energy;
+    }
+
+//! Evaluate the sum of all top level pair potentials
+/*! \param first Rank of the calling thread among the threads that evaluate this pair
+    \param stride Number of threads that evaluate this pair
+
+    Each thread returns a partial sum. The caller sums the partial sums of the \a stride threads.
+    Unions split their constituent pairs among the threads, and the first thread evaluates the
+    remaining potentials.
+
+    The built-in potentials do not depend on the charges, so the GPU does not pass them.
+*/
+HOSTDEVICE inline LongReal pair_energy(const pair_potential_data_t& data,
+                                        const vec3<LongReal>& r_ij,
+                                        const unsigned int type_i,
+                                        const quat<LongReal>& q_i,
+                                        const unsigned int type_j,
+                                        const quat<LongReal>& q_j,
+                                        const unsigned int first,
+                                        const unsigned int stride)
+    {
+    const LongReal r_squared = dot(r_ij, r_ij);
+    const unsigned int param_index = data.type_param_index(type_i, type_j);
+
+    LongReal energy = 0.0;
+    for (unsigned int root = 0; root < data.n_roots; root++)
+        {
+        const PairPotentialNode& node = data.nodes[root];
+        if (r_squared >= data.params[node.r_cut_offset + param_index])
+            {
+            continue;
+            }
+
+        if (node.kind == pair_union)
+            {
+            energy += pair_energy_union(node, data, r_ij, type_i, q_i, type_j, q_j, first, stride);
+            }
+        else if (first == 0)
+            {
+            energy += pair_energy_leaf(node, data, r_squared, r_ij, type_i, q_i, type_j, q_j);
+            }
+        }
+    return energy;
+    }
+
+    } // end namespace detail
+    } // end namespace hpmc
+    } // end namespace hoomd
+
+#undef HOSTDEVICE
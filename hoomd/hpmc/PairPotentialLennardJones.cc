@@ -55,6 +55,20 @@ LongReal PairPotentialLennardJones::energy(const LongReal r_squared,
     return energy;
     }
 
+void PairPotentialLennardJones::fillGPUNode(detail::PairPotentialNode& node,
+                                            PairPotentialGPUData& data) const
+    {
+    node.kind = detail::pair_lennard_jones;
+    node.mode = m_mode;
+    node.param_offset = static_cast<unsigned int>(data.params.size());
+    for (const auto& param : m_params)
+        {
+        data.params.insert(
+            data.params.end(),
+            {param.sigma_6, param.epsilon_x_4, param.r_cut_squared, param.r_on_squared});
+        }
+    }
+
 void PairPotentialLennardJones::setParamsPython(pybind11::tuple typ, pybind11::dict params)
     {
     auto pdata = m_sysdef->getParticleData();
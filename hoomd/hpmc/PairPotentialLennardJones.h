@@ -132,6 +132,9 @@ class PairPotentialLennardJones : public hpmc::PairPotential
     std::vector<ParamType> m_params;
 
     EnergyShiftMode m_mode = no_shift;
+
+    /// Set the kind and parameters of the GPU node.
+    virtual void fillGPUNode(detail::PairPotentialNode& node, PairPotentialGPUData& data) const;
     };
 
     } // end namespace hpmc
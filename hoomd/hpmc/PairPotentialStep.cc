@@ -80,6 +80,20 @@ LongReal PairPotentialStep::energy(const LongReal r_squared,
         }
     }
 
+void PairPotentialStep::fillGPUNode(detail::PairPotentialNode& node,
+                                    PairPotentialGPUData& data) const
+    {
+    node.kind = detail::pair_step;
+    node.index_offset = static_cast<unsigned int>(data.index.size());
+    for (const auto& param : m_params)
+        {
+        data.index.push_back(static_cast<unsigned int>(data.params.size()));
+        data.index.push_back(static_cast<unsigned int>(param.m_epsilon.size()));
+        data.params.insert(data.params.end(), param.m_r_squared.begin(), param.m_r_squared.end());
+        data.params.insert(data.params.end(), param.m_epsilon.begin(), param.m_epsilon.end());
+        }
+    }
+
 void PairPotentialStep::setParamsPython(pybind11::tuple typ, pybind11::object params)
     {
     auto pdata = m_sysdef->getParticleData();
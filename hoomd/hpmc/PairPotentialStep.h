@@ -56,6 +56,9 @@ class PairPotentialStep : public hpmc::PairPotential
 
     /// Parameters per type pair.
     std::vector<ParamType> m_params;
+
+    /// Set the kind and parameters of the GPU node.
+    virtual void fillGPUNode(detail::PairPotentialNode& node, PairPotentialGPUData& data) const;
     };
 
     } // end namespace hpmc
@@ -300,6 +300,37 @@ LongReal PairPotentialUnion::energy(const LongReal r_squared,
         }
     }
 
+void PairPotentialUnion::fillGPUNode(detail::PairPotentialNode& node,
+                                     PairPotentialGPUData& data) const
+    {
+    // The GPU evaluates all pairs of constituents (like energyAll) and ignores the leaf capacity.
+    node.kind = detail::pair_union;
+    node.child = m_constituent_potential->appendGPUNode(data);
+    if (data.nodes[node.child].kind == detail::pair_union)
+        {
+        throw std::runtime_error("Nested Union potentials are not implemented on the GPU.");
+        }
+
+    const unsigned int n_types = static_cast<unsigned int>(m_position.size());
+    node.index_offset = static_cast<unsigned int>(data.index.size());
+    data.index.resize(data.index.size() + 3 * n_types);
+    for (unsigned int type = 0; type < n_types; type++)
+        {
+        data.index[node.index_offset + 3 * type] = static_cast<unsigned int>(data.params.size());
+        data.index[node.index_offset + 3 * type + 1] = static_cast<unsigned int>(data.index.size());
+        data.index[node.index_offset + 3 * type + 2]
+            = static_cast<unsigned int>(m_position[type].size());
+
+        for (size_t i = 0; i < m_position[type].size(); i++)
+            {
+            const vec3<LongReal>& r = m_position[type][i];
+            const quat<LongReal>& q = m_orientation[type][i];
+            data.params.insert(data.params.end(), {r.x, r.y, r.z, q.s, q.v.x, q.v.y, q.v.z});
+            }
+        data.index.insert(data.index.end(), m_type[type].begin(), m_type[type].end());
+        }
+    }
+
 namespace detail
     {
 void exportPairPotentialUnion(pybind11::module& m)
@@ -103,6 +103,9 @@ class PairPotentialUnion : public hpmc::PairPotential
     /// Builds OBB tree based on geometric properties of the constituent particles.
     void buildOBBTree(unsigned int type_id);
 
+    /// Set the kind and parameters of the GPU node.
+    virtual void fillGPUNode(detail::PairPotentialNode& node, PairPotentialGPUData& data) const;
+
     /// Compute the energy of two overlapping leaf nodes.
     LongReal compute_leaf_leaf_energy(vec3<LongReal> dr,
                                       unsigned int type_a,
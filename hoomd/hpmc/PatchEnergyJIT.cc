@@ -2,6 +2,7 @@
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 #include "PatchEnergyJIT.h"
+#include "ClangCompiler.h"
 #include "EvalFactory.h"
 
 #include <sstream>
@@ -32,8 +33,24 @@ PatchEnergyJIT::PatchEnergyJIT(std::shared_ptr<SystemDefinition> sysdef,
                     hoomd::detail::managed_allocator<float>(m_exec_conf->isCUDAEnabled())),
       m_is_union(is_union)
     {
+    // compile on the root rank and broadcast the LLVM bitcode to the other ranks
+    std::string bitcode, error;
+    if (m_exec_conf->isRoot())
+        {
+        std::ostringstream out;
+        bitcode = ClangCompiler::getClangCompiler()->compileBitcode(cpu_code, compiler_args, out);
+        error = out.str();
+        }
+#ifdef ENABLE_MPI
+    if (m_exec_conf->getNRanks() > 1)
+        {
+        bcast(bitcode, 0, m_exec_conf->getMPICommunicator());
+        bcast(error, 0, m_exec_conf->getMPICommunicator());
+        }
+#endif
+
     // build the JIT.
-    EvalFactory* factory = new EvalFactory(cpu_code, compiler_args, this->m_is_union);
+    EvalFactory* factory = new EvalFactory(bitcode, error, this->m_is_union);
 
     // get the evaluator
     m_eval = factory->getEval();
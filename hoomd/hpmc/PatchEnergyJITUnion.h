@@ -4,6 +4,7 @@
 #ifndef _PATCH_ENERGY_JIT_UNION_H_
 #define _PATCH_ENERGY_JIT_UNION_H_
 
+#include "ClangCompiler.h"
 #include "PatchEnergyJIT.h"
 #include "hoomd/SystemDefinition.h"
 #include "hoomd/hpmc/GPUTree.h"
@@ -43,9 +44,26 @@ class PatchEnergyJITUnion : public PatchEnergyJIT
               param_array_constituent.data() + param_array_constituent.size(),
               hoomd::detail::managed_allocator<float>(m_exec_conf->isCUDAEnabled()))
         {
+        // compile on the root rank and broadcast the LLVM bitcode to the other ranks
+        std::string bitcode, error;
+        if (m_exec_conf->isRoot())
+            {
+            std::ostringstream out;
+            bitcode = ClangCompiler::getClangCompiler()->compileBitcode(cpu_code_constituent,
+                                                                        compiler_args,
+                                                                        out);
+            error = out.str();
+            }
+#ifdef ENABLE_MPI
+        if (m_exec_conf->getNRanks() > 1)
+            {
+            bcast(bitcode, 0, m_exec_conf->getMPICommunicator());
+            bcast(error, 0, m_exec_conf->getMPICommunicator());
+            }
+#endif
+
         // build the JIT.
-        EvalFactory* factory_constituent
-            = new EvalFactory(cpu_code_constituent, compiler_args, this->m_is_union);
+        EvalFactory* factory_constituent = new EvalFactory(bitcode, error, this->m_is_union);
 
         // get the evaluator and check for errors
         m_eval_constituent = factory_constituent->getEval();
@@ -0,0 +1,131 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/VectorMath.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/*! \file SeparatingAxisCache.h
+    \brief Declares a table of separating directions between pairs of particles
+*/
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+namespace detail
+    {
+//! Table of the last separating direction found between pairs of particles
+/*! The narrow phase overlap tests of convex shapes find a direction that separates two disjoint
+    shapes. During a sweep with small moves, the same direction usually still separates the pair
+    in the next test, which test_overlap_cached() verifies with a single support function
+    evaluation.
+
+    SeparatingAxisCache stores one direction per pair of particle tags in a direct mapped hash
+    table. A new entry replaces any entry that maps to the same slot, so the table uses a fixed
+    amount of memory and lookups never probe. The direction stored for the pair (a, b) points from
+    a towards b and lookup() flips it for (b, a). A replaced or stale entry only costs a failed
+    check, because test_overlap_cached() verifies every direction before it trusts it.
+
+    SeparatingAxisCache is not thread safe.
+*/
+class SeparatingAxisCache
+    {
+    public:
+    //! Ensure that the table has room for the pairs of \a N particles
+    /*! \param N Number of particles (including ghosts)
+
+        The table holds 8 slots per particle, rounded up to a power of two. Growing the table clears
+        all entries.
+    */
+    void reserve(unsigned int N)
+        {
+        size_t capacity = 1;
+        unsigned int bits = 0;
+        while (capacity < size_t(8) * N)
+            {
+            capacity *= 2;
+            bits++;
+            }
+
+        if (capacity > m_entries.size())
+            {
+            m_entries.assign(capacity, Entry());
+            m_shift = 64 - bits;
+            }
+        }
+
+    //! Remove all entries
+    void clear()
+        {
+        m_entries.assign(m_entries.size(), Entry());
+        }
+
+    //! Find the direction that separated two particles
+    /*! \param tag_a Tag of the first particle
+        \param tag_b Tag of the second particle
+        \returns The direction from a towards b, or a zero vector when there is no entry
+    */
+    vec3<ShortReal> lookup(unsigned int tag_a, unsigned int tag_b) const
+        {
+        if (m_entries.empty())
+            return vec3<ShortReal>(0, 0, 0);
+
+        const Entry& entry = m_entries[slot(tag_a, tag_b)];
+        if (entry.key != key(tag_a, tag_b))
+            return vec3<ShortReal>(0, 0, 0);
+
+        return tag_a <= tag_b ? entry.axis : -entry.axis;
+        }
+
+    //! Record the direction that separates two particles
+    /*! \param tag_a Tag of the first particle
+        \param tag_b Tag of the second particle
+        \param axis Direction from a towards b
+    */
+    void store(unsigned int tag_a, unsigned int tag_b, const vec3<ShortReal>& axis)
+        {
+        if (m_entries.empty())
+            return;
+
+        Entry& entry = m_entries[slot(tag_a, tag_b)];
+        entry.key = key(tag_a, tag_b);
+        entry.axis = tag_a <= tag_b ? axis : -axis;
+        }
+
+    private:
+    //! One slot of the table
+    struct Entry
+        {
+        uint64_t key = UINT64_MAX; //!< Pair of tags, UINT64_MAX marks an empty slot
+        vec3<ShortReal> axis;      //!< Direction from the lower to the higher tag
+        };
+
+    std::vector<Entry> m_entries; //!< The table
+    unsigned int m_shift = 64;    //!< Shift that maps a hash to a slot
+
+    //! Combine two tags into a key independent of their order
+    static uint64_t key(unsigned int tag_a, unsigned int tag_b)
+        {
+        if (tag_a > tag_b)
+            std::swap(tag_a, tag_b);
+        return (uint64_t(tag_a) << 32) | tag_b;
+        }
+
+    //! Get the slot of a pair (Fibonacci hashing)
+    size_t slot(unsigned int tag_a, unsigned int tag_b) const
+        {
+        if (m_shift >= 64)
+            return 0;
+        return size_t((key(tag_a, tag_b) * UINT64_C(0x9E3779B97F4A7C15)) >> m_shift);
+        }
+    };
+
+    } // end namespace detail
+    } // end namespace hpmc
+    } // end namespace hoomd
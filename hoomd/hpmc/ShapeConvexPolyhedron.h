@@ -39,10 +39,23 @@ namespace detail
     vertex farthest from the origin. Convex polyhedra may have sweep radius greater than 0 which
     makes them rounded convex polyhedra. Coordinates are stored with x, y, and z in separate arrays
     to support vector intrinsics on the CPU. These arrays are stored in ManagedArray to support
-    arbitrary numbers of verticles.
+    arbitrary numbers of verticles. Each array is zero padded to a multiple of simd_width and
+    aligned to the vector width so that the support function can load full vectors without a
+    remainder loop.
 */
 struct PolyhedronVertices : ShapeParams
     {
+#if !defined(__HIPCC__) && defined(__AVX512F__) && HOOMD_SHORTREAL_SIZE == 32
+    /// Number of vertices processed per vector in the support function
+    static constexpr unsigned int simd_width = 16;
+#else
+    /// Number of vertices processed per vector in the support function
+    static constexpr unsigned int simd_width = 8;
+#endif
+
+    /// Alignment of the vertex arrays in bytes
+    static constexpr unsigned int simd_alignment = simd_width * 4;
+
     /// Default constructor initializes zero values.
     DEVICE PolyhedronVertices()
         : n_hull_verts(0), N(0), diameter(ShortReal(0)), sweep_radius(ShortReal(0)), ignore(0)
@@ -84,11 +97,10 @@ struct PolyhedronVertices : ShapeParams
         diameter = 0;
         sweep_radius = sweep_radius_;
 
-        unsigned int align_size = 8; // for AVX
-        unsigned int N_align = ((N + align_size - 1) / align_size) * align_size;
-        x = ManagedArray<ShortReal>(N_align, managed, 32); // 32byte alignment for AVX
-        y = ManagedArray<ShortReal>(N_align, managed, 32);
-        z = ManagedArray<ShortReal>(N_align, managed, 32);
+        unsigned int N_align = ((N + simd_width - 1) / simd_width) * simd_width;
+        x = ManagedArray<ShortReal>(N_align, managed, simd_alignment);
+        y = ManagedArray<ShortReal>(N_align, managed, simd_alignment);
+        z = ManagedArray<ShortReal>(N_align, managed, simd_alignment);
         for (unsigned int i = 0; i < N_align; ++i)
             {
             x[i] = y[i] = z[i] = ShortReal(0.0);
@@ -286,14 +298,52 @@ class SupportFuncConvexPolyhedron
 
         if (verts.N > 0)
             {
-#if !defined(__HIPCC__) && defined(__AVX__) && HOOMD_SHORTREAL_SIZE == 32
-            // process dot products with AVX 8 at a time on the CPU when working with more than
-            // 4 verts
+#if !defined(__HIPCC__) && defined(__AVX512F__) && HOOMD_SHORTREAL_SIZE == 32
+            // process dot products with AVX-512 16 at a time on the CPU. Each lane keeps the
+            // largest dot product it has seen and the index of that vertex so that a single pass
+            // finds the support vertex.
+            __m512 nx_v = _mm512_set1_ps(n.x);
+            __m512 ny_v = _mm512_set1_ps(n.y);
+            __m512 nz_v = _mm512_set1_ps(n.z);
+            __m512 max_dot_v = _mm512_set1_ps(max_dot);
+            __m512i max_idx_v = _mm512_setzero_si512();
+            __m512i idx_v
+                = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            const __m512i step_v = _mm512_set1_epi32(16);
+
+            for (unsigned int i = 0; i < verts.N; i += 16)
+                {
+                __m512 x_v = _mm512_load_ps(verts.x.get() + i);
+                __m512 y_v = _mm512_load_ps(verts.y.get() + i);
+                __m512 z_v = _mm512_load_ps(verts.z.get() + i);
+
+                __m512 d_v = _mm512_fmadd_ps(nx_v,
+                                             x_v,
+                                             _mm512_fmadd_ps(ny_v, y_v, _mm512_mul_ps(nz_v, z_v)));
+
+                // strictly greater keeps the first occurrence of the maximum in each lane
+                __mmask16 greater = _mm512_cmp_ps_mask(d_v, max_dot_v, _CMP_GT_OQ);
+                max_dot_v = _mm512_mask_mov_ps(max_dot_v, greater, d_v);
+                max_idx_v = _mm512_mask_mov_epi32(max_idx_v, greater, idx_v);
+                idx_v = _mm512_add_epi32(idx_v, step_v);
+                }
+
+            // the support vertex is the lowest index among the lanes that hold the maximum
+            max_dot = _mm512_reduce_max_ps(max_dot_v);
+            __mmask16 is_max = _mm512_cmp_ps_mask(max_dot_v, _mm512_set1_ps(max_dot), _CMP_EQ_OQ);
+            max_idx = (unsigned int)_mm512_mask_reduce_min_epi32(is_max, max_idx_v);
+#elif !defined(__HIPCC__) && defined(__AVX__) && HOOMD_SHORTREAL_SIZE == 32
+            // process dot products with AVX 8 at a time on the CPU. Each lane keeps the largest
+            // dot product it has seen and the index of that vertex (as a float, which is exact
+            // for any realistic number of vertices) so that a single pass finds the support
+            // vertex.
             __m256 nx_v = _mm256_broadcast_ss(&n.x);
             __m256 ny_v = _mm256_broadcast_ss(&n.y);
             __m256 nz_v = _mm256_broadcast_ss(&n.z);
             __m256 max_dot_v = _mm256_broadcast_ss(&max_dot);
-            float d_s[verts.x.size()] __attribute__((aligned(32)));
+            __m256 max_idx_v = _mm256_setzero_ps();
+            __m256 idx_v = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7);
+            const __m256 step_v = _mm256_set1_ps(8);
 
             for (unsigned int i = 0; i < verts.N; i += 8)
                 {
@@ -301,42 +351,39 @@ class SupportFuncConvexPolyhedron
                 __m256 y_v = _mm256_load_ps(verts.y.get() + i);
                 __m256 z_v = _mm256_load_ps(verts.z.get() + i);
 
+#ifdef __FMA__
+                __m256 d_v = _mm256_fmadd_ps(nx_v,
+                                             x_v,
+                                             _mm256_fmadd_ps(ny_v, y_v, _mm256_mul_ps(nz_v, z_v)));
+#else
                 __m256 d_v = _mm256_add_ps(
                     _mm256_mul_ps(nx_v, x_v),
                     _mm256_add_ps(_mm256_mul_ps(ny_v, y_v), _mm256_mul_ps(nz_v, z_v)));
+#endif
 
-                // determine a maximum in each of the 8 channels as we go
-                max_dot_v = _mm256_max_ps(max_dot_v, d_v);
-
-                _mm256_store_ps(d_s + i, d_v);
+                // strictly greater keeps the first occurrence of the maximum in each lane
+                __m256 greater = _mm256_cmp_ps(d_v, max_dot_v, _CMP_GT_OQ);
+                max_dot_v = _mm256_blendv_ps(max_dot_v, d_v, greater);
+                max_idx_v = _mm256_blendv_ps(max_idx_v, idx_v, greater);
+                idx_v = _mm256_add_ps(idx_v, step_v);
                 }
 
-            // find the maximum of the 8 channels
-            // http://stackoverflow.com/questions/17638487/minimum-of-4-sp-values-in-m128
-            max_dot_v
-                = _mm256_max_ps(max_dot_v,
-                                _mm256_shuffle_ps(max_dot_v, max_dot_v, _MM_SHUFFLE(2, 1, 0, 3)));
-            max_dot_v
-                = _mm256_max_ps(max_dot_v,
-                                _mm256_shuffle_ps(max_dot_v, max_dot_v, _MM_SHUFFLE(1, 0, 3, 2)));
-            // shuffles work only within the two 128b segments, so right now we have two separate
-            // max values swap the left and right hand sides and max again to get the final max
-            max_dot_v = _mm256_max_ps(max_dot_v, _mm256_permute2f128_ps(max_dot_v, max_dot_v, 1));
+            // the support vertex is the lowest index among the lanes that hold the maximum
+            float lane_dot[8] __attribute__((aligned(32)));
+            float lane_idx[8] __attribute__((aligned(32)));
+            _mm256_store_ps(lane_dot, max_dot_v);
+            _mm256_store_ps(lane_idx, max_idx_v);
 
-            // loop again and find the max. The reason this is in a 2nd loop is because branch
-            // mis-predictions and the extra max calls kill performance if this is in the first loop
-            // Use BSF to find the first index of the max element
-            // https://software.intel.com/en-us/forums/topic/285956
-            for (unsigned int i = 0; i < verts.N; i += 8)
+            max_dot = lane_dot[0];
+            max_idx = (unsigned int)lane_idx[0];
+            for (unsigned int lane = 1; lane < 8; lane++)
                 {
-                __m256 d_v = _mm256_load_ps(d_s + i);
-
-                int id = __builtin_ffs(_mm256_movemask_ps(_mm256_cmp_ps(max_dot_v, d_v, 0)));
-
-                if (id)
+                unsigned int lane_max_idx = (unsigned int)lane_idx[lane];
+                if (lane_dot[lane] > max_dot
+                    || (lane_dot[lane] == max_dot && lane_max_idx < max_idx))
                     {
-                    max_idx = i + id - 1;
-                    break;
+                    max_dot = lane_dot[lane];
+                    max_idx = lane_max_idx;
                     }
                 }
 #elif !defined(__HIPCC__) && defined(__SSE__) && HOOMD_SHORTREAL_SIZE == 32
@@ -817,6 +864,42 @@ DEVICE inline bool test_overlap(const vec3<Scalar>& r_ab,
     */
     }
 
+/** Convex polyhedron overlap test seeded with a cached separating axis
+
+    @param r_ab Vector defining the position of shape b relative to shape a (r_b - r_a)
+    @param a first shape
+    @param b second shape
+    @param axis in/out separating direction in the space frame (see test_overlap_cached)
+    @param err in/out variable incremented when error conditions occur in the overlap test
+    @returns true when *a* and *b* overlap, and false when they are disjoint
+*/
+template<>
+DEVICE inline bool test_overlap_cached(const vec3<Scalar>& r_ab,
+                                       const ShapeConvexPolyhedron& a,
+                                       const ShapeConvexPolyhedron& b,
+                                       vec3<ShortReal>& axis,
+                                       unsigned int& err)
+    {
+    vec3<ShortReal> dr(r_ab);
+
+    ShortReal DaDb = a.getCircumsphereDiameter() + b.getCircumsphereDiameter();
+
+    const detail::SupportFuncConvexPolyhedron sa(a.verts);
+    const detail::SupportFuncConvexPolyhedron sb(b.verts);
+    const quat<ShortReal> q_a(a.orientation);
+    const vec3<ShortReal> ab_t = rotate(conj(q_a), dr);
+    const quat<ShortReal> q = conj(q_a) * quat<ShortReal>(b.orientation);
+
+    vec3<ShortReal> axis_a = rotate(conj(q_a), axis);
+    if (detail::separates_3d(sa, sb, ab_t, q, axis_a))
+        return false;
+
+    bool overlap = detail::xenocollide_3d(sa, sb, ab_t, q, DaDb / ShortReal(2.0), err, &axis_a);
+    if (!overlap)
+        axis = rotate(q_a, axis_a);
+    return overlap;
+    }
+
 //! Convex polyhedron sweep distance
 /*! \param r_ab Vector defining the position of shape b relative to shape a (r_b - r_a)
     \param a first shape
@@ -264,6 +264,25 @@ check_circumsphere_overlap(const vec3<LongReal>& r_ab, const ShapeA& a, const Sh
     return (r_squared * LongReal(4.0) <= diameter_sum * diameter_sum);
     }
 
+//! Check if inspheres overlap
+/*! \param r_ab Vector defining the position of shape b relative to shape a (r_b - r_a)
+    \param a first shape
+    \param b second shape
+    \returns true if the inspheres of both shapes overlap, which implies that the shapes overlap
+
+    Shapes that do not implement getInsphereRadius() return 0 and never pass this test.
+
+    \ingroup shape
+*/
+template<class ShapeA, class ShapeB>
+DEVICE inline bool
+check_insphere_overlap(const vec3<LongReal>& r_ab, const ShapeA& a, const ShapeB& b)
+    {
+    LongReal r_squared = dot(r_ab, r_ab);
+    LongReal radius_sum = a.getInsphereRadius() + b.getInsphereRadius();
+    return (r_squared < radius_sum * radius_sum);
+    }
+
 //! Define the general overlap function
 /*! This is just a convenient spot to put this to make sure it is defined early
     \param r_ab Vector defining the position of shape b relative to shape a (r_b - r_a)
@@ -280,6 +299,29 @@ test_overlap(const vec3<Scalar>& r_ab, const ShapeA& a, const ShapeB& b, unsigne
     return true;
     }
 
+//! Overlap test seeded with a separating axis from a previous test of the same pair
+/*! \param r_ab Vector defining the position of shape b relative to shape a (r_b - r_a)
+    \param a first shape
+    \param b second shape
+    \param axis in/out separating direction in the space frame. Shapes that implement this test
+    return false without a full overlap check when *axis* still separates them. When a full
+    check finds that the shapes are disjoint, it replaces *axis* with the separating direction it
+    found. A zero vector means that no axis is known.
+    \param err Incremented if there is an error condition. Left unchanged otherwise.
+    \returns true when *a* and *b* overlap, and false when they are disjoint
+
+    The default implementation ignores *axis* and calls test_overlap().
+*/
+template<class ShapeA, class ShapeB>
+DEVICE inline bool test_overlap_cached(const vec3<Scalar>& r_ab,
+                                       const ShapeA& a,
+                                       const ShapeB& b,
+                                       vec3<ShortReal>& axis,
+                                       unsigned int& err)
+    {
+    return test_overlap(r_ab, a, b, err);
+    }
+
 //! Sphere-Sphere overlap
 /*! \param r_ab Vector defining the position of shape b relative to shape a (r_b - r_a)
     \param a first shape
@@ -310,6 +352,25 @@ DEVICE inline bool test_overlap<ShapeSphere, ShapeSphere>(const vec3<Scalar>& r_
         }
     }
 
+//! Test whether expanding the box keeps non-overlapping shapes apart
+/*! \returns true when scaling the separation of any two non-overlapping shapes by a diagonal
+    matrix with entries >= 1 cannot make them overlap
+
+    This holds for spheres, whose overlap depends only on the separation distance. Other shapes
+    may overlap after an anisotropic expansion and return false.
+
+    \ingroup shape
+*/
+template<class Shape> inline bool expansion_preserves_separation()
+    {
+    return false;
+    }
+
+template<> inline bool expansion_preserves_separation<ShapeSphere>()
+    {
+    return true;
+    }
+
 //! sphere sweep distance
 /*! \param r_ab Vector defining the position of shape b relative to shape a (r_b - r_a)
     \param a first shape
@@ -175,6 +175,43 @@ DEVICE inline bool test_overlap(const vec3<Scalar>& r_ab,
     */
     }
 
+//! Convex spheropolyhedron overlap test seeded with a cached separating axis
+/*! \param r_ab Vector defining the position of shape b relative to shape a (r_b - r_a)
+    \param a first shape
+    \param b second shape
+    \param axis in/out separating direction in the space frame (see test_overlap_cached)
+    \param err in/out variable incremented when error conditions occur in the overlap test
+    \returns true when *a* and *b* overlap, and false when they are disjoint
+
+    \ingroup shape
+*/
+template<>
+DEVICE inline bool test_overlap_cached(const vec3<Scalar>& r_ab,
+                                       const ShapeSpheropolyhedron& a,
+                                       const ShapeSpheropolyhedron& b,
+                                       vec3<ShortReal>& axis,
+                                       unsigned int& err)
+    {
+    vec3<ShortReal> dr = r_ab;
+
+    ShortReal DaDb = a.getCircumsphereDiameter() + b.getCircumsphereDiameter();
+
+    const detail::SupportFuncConvexPolyhedron sa(a.verts, a.verts.sweep_radius);
+    const detail::SupportFuncConvexPolyhedron sb(b.verts, b.verts.sweep_radius);
+    const quat<ShortReal> q_a(a.orientation);
+    const vec3<ShortReal> ab_t = rotate(conj(q_a), dr);
+    const quat<ShortReal> q = conj(q_a) * quat<ShortReal>(b.orientation);
+
+    vec3<ShortReal> axis_a = rotate(conj(q_a), axis);
+    if (detail::separates_3d(sa, sb, ab_t, q, axis_a))
+        return false;
+
+    bool overlap = xenocollide_3d(sa, sb, ab_t, q, DaDb / ShortReal(2.0), err, &axis_a);
+    if (!overlap)
+        axis = rotate(q_a, axis_a);
+    return overlap;
+    }
+
 #ifndef __HIPCC__
 template<> inline std::string getShapeSpec(const ShapeSpheropolyhedron& spoly)
     {
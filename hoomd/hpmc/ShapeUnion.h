@@ -188,17 +188,7 @@ template<class Shape> struct ShapeUnionParams : ShapeParams
             overlap_list = pybind11::list(overlap);
             }
 
-        hpmc::detail::OBB* obbs = new hpmc::detail::OBB[N];
-
-        std::vector<std::vector<vec3<ShortReal>>> internal_coordinates;
-
-        // extract member parameters, positions, and orientations and compute the radius along the
-        // way
-        diameter = ShortReal(0.0);
-
-        // compute a tight fitting AABB in the body frame
-        hoomd::detail::AABB local_aabb(vec3<ShortReal>(0, 0, 0), ShortReal(0.0));
-
+        // extract member parameters, positions, and orientations
         for (unsigned int i = 0; i < N; i++)
             {
             typename Shape::param_type param(shapes[i], managed);
@@ -240,8 +230,44 @@ template<class Shape> struct ShapeUnionParams : ShapeParams
                 {
                 moverlap[i] = pybind11::cast<unsigned int>(overlap_list[i]);
                 }
+            }
+
+        // build tree and store GPU accessible version in parameter structure, identical member
+        // sets share the build
+        std::vector<detail::OBB> obbs = computeMemberBounds();
+        tree = detail::buildCachedGPUTree(obbs.data(), N, leaf_capacity, managed);
+        }
+
+    /** Update the tree after member positions or orientations change
+
+        Keeps the topology of the tree and only recomputes the node bounding volumes, which is much
+        cheaper than a rebuild when the members move by small amounts. The number of members and
+        their overlap masks must not change.
+    */
+    void updateTree()
+        {
+        std::vector<detail::OBB> obbs = computeMemberBounds();
+        tree.refit(obbs.data(), false);
+        }
 
-            Shape dummy(morientation[i], param);
+    /** Compute the bounding volumes of the members
+
+        Also sets the circumsphere diameter and the local AABB of the union.
+
+        @returns The bounding volume of each member in the body frame
+    */
+    std::vector<detail::OBB> computeMemberBounds()
+        {
+        std::vector<detail::OBB> obbs(N);
+        diameter = ShortReal(0.0);
+
+        // compute a tight fitting AABB in the body frame
+        hoomd::detail::AABB local_aabb(vec3<ShortReal>(0, 0, 0), ShortReal(0.0));
+
+        for (unsigned int i = 0; i < N; i++)
+            {
+            Shape dummy(morientation[i], mparams[i]);
+            vec3<ShortReal> pos = mpos[i];
             Scalar d = sqrt(dot(pos, pos));
             diameter = max(diameter, ShortReal(2 * d + dummy.getCircumsphereDiameter()));
 
@@ -262,17 +288,11 @@ template<class Shape> struct ShapeUnionParams : ShapeParams
             local_aabb = merge(local_aabb, my_aabb);
             }
 
-        // set the diameter
-
-        // build tree and store GPU accessible version in parameter structure
-        OBBTree tree_obb;
-        tree_obb.buildTree(obbs, N, leaf_capacity, false);
-        delete[] obbs;
-        tree = GPUTree(tree_obb, managed);
-
         // store local AABB
         lower = local_aabb.getLower();
         upper = local_aabb.getUpper();
+
+        return obbs;
         }
 
     /// Convert parameters to a python dictionary
@@ -12,13 +12,19 @@
 #include "hoomd/RandomNumbers.h"
 #include "hoomd/RNGIdentifiers.h"
 
+#include <algorithm>
 #include <set>
 #include <list>
+#include <unordered_map>
 
 #include "Moves.h"
 #include "HPMCCounters.h"
 #include "IntegratorHPMCMono.h"
 
+#ifdef ENABLE_MPI
+#include "hoomd/DomainDecomposition.h"
+#endif
+
 #ifdef ENABLE_TBB
 #include <tbb/concurrent_unordered_map.h>
 #include <tbb/concurrent_unordered_set.h>
@@ -267,6 +273,62 @@ void Graph::addEdge(unsigned int v, unsigned int w)
     {
     adj.insert(std::make_pair(v,w));
     }
+
+//! Disjoint sets of particle tags, each labelled by the smallest tag in the set
+class TagUnionFind
+    {
+    public:
+        //! Find the label of the set containing tag (the tag itself when it is in no set)
+        unsigned int find(unsigned int tag)
+            {
+            auto it = m_parent.find(tag);
+            if (it == m_parent.end())
+                return tag;
+
+            unsigned int root = it->second;
+            while (m_parent[root] != root)
+                root = m_parent[root];
+
+            // path compression
+            while (tag != root)
+                {
+                unsigned int& parent = m_parent[tag];
+                tag = parent;
+                parent = root;
+                }
+            return root;
+            }
+
+        //! Merge the sets containing a and b
+        void merge(unsigned int a, unsigned int b)
+            {
+            m_parent.emplace(a, a);
+            m_parent.emplace(b, b);
+            unsigned int root_a = find(a);
+            unsigned int root_b = find(b);
+            if (root_a < root_b)
+                m_parent[root_b] = root_a;
+            else if (root_b < root_a)
+                m_parent[root_a] = root_b;
+            }
+
+        //! Test if tag is in any set
+        bool contains(unsigned int tag) const
+            {
+            return m_parent.count(tag) > 0;
+            }
+
+    private:
+        std::unordered_map<unsigned int, unsigned int> m_parent; //!< Parent of every tag in a set
+    };
+
+//! Transformed particle sent to the rank that owns its new position
+struct transformed_particle_t
+    {
+    Scalar4 postype;     //!< Transformed position and type
+    Scalar4 orientation; //!< Transformed orientation
+    unsigned int tag;    //!< Particle tag
+    };
 } // end namespace detail
 
 /*! A generic cluster move for attractive interactions.
@@ -343,6 +405,17 @@ class UpdaterClusters : public Updater
             else
                 result = m_count_total - m_count_step_start;
 
+            #ifdef ENABLE_MPI
+            if (m_sysdef->isDomainDecomposed())
+                {
+                // clusters and their particles are counted on the ranks that own them
+                MPI_Allreduce(MPI_IN_PLACE, &result.n_clusters, 1, MPI_LONG_LONG_INT, MPI_SUM,
+                    m_exec_conf->getMPICommunicator());
+                MPI_Allreduce(MPI_IN_PLACE, &result.n_particles_in_clusters, 1, MPI_LONG_LONG_INT,
+                    MPI_SUM, m_exec_conf->getMPICommunicator());
+                }
+            #endif
+
             return result;
             }
 
@@ -415,6 +488,15 @@ class UpdaterClusters : public Updater
 
         //! Flip clusters randomly
         virtual void flip(uint64_t timestep);
+
+        #ifdef ENABLE_MPI
+        //! Perform the cluster move with spatial domain decomposition
+        void updateDomainDecomposition(uint64_t timestep, const quat<Scalar>& q,
+            const vec3<Scalar>& pivot, bool line);
+
+        //! Count the local particles outside of the local domain, summed over all ranks
+        unsigned int countParticlesOutsideDomain();
+        #endif
     };
 
 template< class Shape >
@@ -1544,11 +1626,6 @@ template< class Shape >
 void UpdaterClusters<Shape>::update(uint64_t timestep)
     {
     Updater::update(timestep);
-    #ifdef ENABLE_MPI
-    if (this->m_pdata->getDomainDecomposition())
-        throw std::runtime_error("UpdaterClusters does not work with spatial domain decomposition.");
-    #endif
-
     m_exec_conf->msg->notice(10) << timestep << " UpdaterClusters" << std::endl;
 
     m_count_step_start = m_count_total;
@@ -1614,6 +1691,14 @@ void UpdaterClusters<Shape>::update(uint64_t timestep)
         pivot.z = 0.0;
         }
 
+    #ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        updateDomainDecomposition(timestep, q, pivot, line);
+        return;
+        }
+    #endif
+
     // store backup of particle data
     backupState();
 
@@ -1734,6 +1819,348 @@ void UpdaterClusters<Shape>::update(uint64_t timestep)
     m_mc->invalidateAABBTree();
     }
 
+#ifdef ENABLE_MPI
+/*! The image of a particle under the pivot or line reflection generally lies in the domain of
+    another rank. Every rank sends its transformed particles to the ranks that own their new
+    positions, and these check them against the old configuration of their local and ghost
+    particles. Each rank labels the connected components of the edges it found with a union-find
+    on particle tags. The ranks then exchange the labels of the particles that may be part of the
+    edges found on other ranks, so that every rank can merge the components globally.
+
+    This path supports hard particle overlaps only.
+*/
+template< class Shape >
+void UpdaterClusters<Shape>::updateDomainDecomposition(uint64_t timestep, const quat<Scalar>& q,
+    const vec3<Scalar>& pivot, bool line)
+    {
+    if (m_mc->hasPairInteractions())
+        throw std::runtime_error("UpdaterClusters does not support pair interactions with spatial domain decomposition.");
+
+    for (unsigned int type = 0; type < m_pdata->getNTypes(); ++type)
+        {
+        if (m_mc->getDepletantFugacity(type) != 0.0)
+            throw std::runtime_error("UpdaterClusters does not support depletants with spatial domain decomposition.");
+        }
+
+    MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+    const unsigned int my_rank = m_exec_conf->getRank();
+    const unsigned int n_ranks = m_exec_conf->getNRanks();
+    const uint16_t seed = m_sysdef->getSeed();
+
+    const BoxDim global_box = m_pdata->getGlobalBox();
+    const BoxDim local_box = m_pdata->getBox();
+    auto decomposition = m_pdata->getDomainDecomposition();
+    const uint3 grid = decomposition->getGridSize();
+
+    auto& params = m_mc->getParams();
+    auto& image_list = m_mc->updateImageList();
+    const unsigned int n_images = (unsigned int) image_list.size();
+    Index2D overlap_idx = m_mc->getOverlapIndexer();
+
+    const unsigned int nptl = m_pdata->getN();
+
+    // locality data of the old configuration, including ghosts
+    m_aabb_tree_old = m_mc->buildAABBTree();
+
+    std::vector<detail::transformed_particle_t> transformed(nptl);
+    std::vector<int3> transformed_image(nptl);
+    std::vector<unsigned int> dest_rank(nptl);
+    std::vector<int> send_bytes(n_ranks, 0);
+
+        {
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::read);
+        ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_cart_ranks(decomposition->getCartRanks(), access_location::host, access_mode::read);
+
+        for (unsigned int i = 0; i < nptl; ++i)
+            {
+            vec3<Scalar> new_pos(h_postype.data[i]);
+            quat<Scalar> new_orientation(h_orientation.data[i]);
+            if (!line)
+                {
+                // point reflection
+                new_pos = pivot-(new_pos-pivot);
+                }
+            else
+                {
+                // line reflection
+                new_pos = lineReflection(new_pos, pivot, q);
+                Shape shape_i(new_orientation, params[__scalar_as_int(h_postype.data[i].w)]);
+                if (shape_i.hasOrientation())
+                    new_orientation = q*new_orientation;
+                }
+
+            // wrap particle back into box, incrementing image flags
+            int3 img = global_box.getImage(new_pos);
+            new_pos = global_box.shift(new_pos,-img);
+
+            transformed[i].postype = make_scalar4(new_pos.x, new_pos.y, new_pos.z, h_postype.data[i].w);
+            transformed[i].orientation = quat_to_scalar4(new_orientation);
+            transformed[i].tag = h_tag.data[i];
+            transformed_image[i] = h_image.data[i] + img;
+
+            dest_rank[i] = decomposition->placeParticle(global_box, vec_to_scalar3(new_pos), h_cart_ranks.data);
+            send_bytes[dest_rank[i]] += (int) sizeof(detail::transformed_particle_t);
+            }
+        }
+
+    // send the transformed particles to the ranks that own their new positions
+    std::vector<int> send_displs(n_ranks, 0);
+    for (unsigned int rank = 1; rank < n_ranks; ++rank)
+        send_displs[rank] = send_displs[rank-1] + send_bytes[rank-1];
+
+    std::vector<detail::transformed_particle_t> send_buf(nptl);
+        {
+        std::vector<int> offset(send_displs);
+        for (unsigned int i = 0; i < nptl; ++i)
+            {
+            send_buf[offset[dest_rank[i]] / sizeof(detail::transformed_particle_t)] = transformed[i];
+            offset[dest_rank[i]] += (int) sizeof(detail::transformed_particle_t);
+            }
+        }
+
+    std::vector<int> recv_bytes(n_ranks, 0);
+    MPI_Alltoall(send_bytes.data(), 1, MPI_INT, recv_bytes.data(), 1, MPI_INT, mpi_comm);
+
+    std::vector<int> recv_displs(n_ranks, 0);
+    for (unsigned int rank = 1; rank < n_ranks; ++rank)
+        recv_displs[rank] = recv_displs[rank-1] + recv_bytes[rank-1];
+
+    const unsigned int n_recv = (unsigned int)
+        ((recv_displs[n_ranks-1] + recv_bytes[n_ranks-1]) / sizeof(detail::transformed_particle_t));
+    std::vector<detail::transformed_particle_t> recv_buf(n_recv);
+
+    MPI_Alltoallv(send_buf.data(), send_bytes.data(), send_displs.data(), MPI_BYTE,
+        recv_buf.data(), recv_bytes.data(), recv_displs.data(), MPI_BYTE, mpi_comm);
+
+    // find the overlaps of the received particles with the old configuration, as pairs of tags
+    m_overlap.clear();
+
+        {
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_overlaps(m_mc->getInteractionMatrix(), access_location::host, access_mode::read);
+
+        #ifdef ENABLE_TBB_TASK
+        this->m_exec_conf->getTaskArena()->execute([&]{
+        tbb::parallel_for((unsigned int)0,n_recv, [&](unsigned int k)
+        #else
+        for (unsigned int k = 0; k < n_recv; ++k)
+        #endif
+            {
+            const detail::transformed_particle_t& p = recv_buf[k];
+            unsigned int typ_i = __scalar_as_int(p.postype.w);
+            vec3<Scalar> pos_i_new(p.postype);
+            Shape shape_i(quat<Scalar>(p.orientation), params[typ_i]);
+            Scalar r_excl_i = shape_i.getCircumsphereDiameter()/Scalar(2.0);
+            hoomd::detail::AABB aabb_i_local = shape_i.getAABB(vec3<Scalar>(0,0,0));
+
+            for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+                {
+                vec3<Scalar> pos_i_image = pos_i_new + image_list[cur_image];
+
+                hoomd::detail::AABB aabb_i_image = aabb_i_local;
+                aabb_i_image.translate(pos_i_image);
+
+                // stackless search
+                for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree_old.getNumNodes(); cur_node_idx++)
+                    {
+                    if (aabb_i_image.overlaps(m_aabb_tree_old.getNodeAABB(cur_node_idx)))
+                        {
+                        if (m_aabb_tree_old.isNodeLeaf(cur_node_idx))
+                            {
+                            for (unsigned int cur_p = 0; cur_p < m_aabb_tree_old.getNodeNumParticles(cur_node_idx); cur_p++)
+                                {
+                                unsigned int j = m_aabb_tree_old.getNodeParticle(cur_node_idx, cur_p);
+                                unsigned int tag_j = h_tag.data[j];
+
+                                if (tag_j == p.tag) continue;
+
+                                vec3<Scalar> pos_j = vec3<Scalar>(h_postype.data[j]);
+                                unsigned int typ_j = __scalar_as_int(h_postype.data[j].w);
+                                Shape shape_j(quat<Scalar>(h_orientation.data[j]), params[typ_j]);
+
+                                // put particles in coordinate system of particle i
+                                vec3<Scalar> r_ij = pos_j - pos_i_image;
+
+                                // check for circumsphere overlap
+                                Scalar r_excl_j = shape_j.getCircumsphereDiameter()/Scalar(2.0);
+                                Scalar RaRb = r_excl_i + r_excl_j;
+                                Scalar rsq_ij = dot(r_ij, r_ij);
+
+                                unsigned int err = 0;
+                                if (rsq_ij <= RaRb*RaRb
+                                    && h_overlaps.data[overlap_idx(typ_i,typ_j)]
+                                    && test_overlap(r_ij, shape_i, shape_j, err))
+                                    {
+                                    m_overlap.insert(std::make_pair(p.tag, tag_j));
+                                    }
+                                } // end loop over AABB tree leaf
+                            } // end is leaf
+                        } // end if overlap
+                    else
+                        {
+                        // skip ahead
+                        cur_node_idx += m_aabb_tree_old.getNodeSkip(cur_node_idx);
+                        }
+                    } // end loop over nodes
+                } // end loop over images
+            } // end loop over received particles
+        #ifdef ENABLE_TBB_TASK
+            );
+        }); // end task arena execute()
+        #endif
+        }
+
+    // label the connected components of the local edges
+    detail::TagUnionFind local_sets;
+    for (auto it = m_overlap.begin(); it != m_overlap.end(); ++it)
+        local_sets.merge(it->first, it->second);
+
+    /* Collect (tag, label) pairs for the particles that may be part of edges on other ranks: the
+       ghosts and received particles in the local edges, and the local particles whose transformed
+       copies were sent away or that are within an overlap distance of the domain boundary.
+    */
+    std::vector<unsigned int> labels;
+
+        {
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+
+        std::vector<unsigned int> remote_tags;
+        for (auto it = m_overlap.begin(); it != m_overlap.end(); ++it)
+            {
+            if (h_rtag.data[it->first] >= nptl)
+                remote_tags.push_back(it->first);
+            if (h_rtag.data[it->second] >= nptl)
+                remote_tags.push_back(it->second);
+            }
+        std::sort(remote_tags.begin(), remote_tags.end());
+        remote_tags.erase(std::unique(remote_tags.begin(), remote_tags.end()), remote_tags.end());
+
+        for (auto tag : remote_tags)
+            {
+            labels.push_back(tag);
+            labels.push_back(local_sets.find(tag));
+            }
+
+        const Scalar3 npd = local_box.getNearestPlaneDistance();
+        const Scalar max_d = m_mc->getMaxCoreDiameter();
+
+        for (unsigned int i = 0; i < nptl; ++i)
+            {
+            unsigned int tag = h_tag.data[i];
+            unsigned int label = local_sets.find(tag);
+            if (label == tag)
+                continue;
+
+            Scalar3 f = local_box.makeFraction(make_scalar3(h_postype.data[i].x, h_postype.data[i].y, h_postype.data[i].z));
+            bool near_boundary = (grid.x > 1 && (f.x*npd.x < max_d || (Scalar(1.0)-f.x)*npd.x < max_d))
+                || (grid.y > 1 && (f.y*npd.y < max_d || (Scalar(1.0)-f.y)*npd.y < max_d))
+                || (grid.z > 1 && (f.z*npd.z < max_d || (Scalar(1.0)-f.z)*npd.z < max_d));
+
+            if (near_boundary || dest_rank[i] != my_rank)
+                {
+                labels.push_back(tag);
+                labels.push_back(label);
+                }
+            }
+        }
+
+    // exchange the labels and merge the components across ranks
+    int n_labels = (int) labels.size();
+    std::vector<int> n_labels_rank(n_ranks);
+    MPI_Allgather(&n_labels, 1, MPI_INT, n_labels_rank.data(), 1, MPI_INT, mpi_comm);
+
+    std::vector<int> labels_displs(n_ranks, 0);
+    for (unsigned int rank = 1; rank < n_ranks; ++rank)
+        labels_displs[rank] = labels_displs[rank-1] + n_labels_rank[rank-1];
+
+    std::vector<unsigned int> all_labels(labels_displs[n_ranks-1] + n_labels_rank[n_ranks-1]);
+    MPI_Allgatherv(labels.data(), n_labels, MPI_UNSIGNED, all_labels.data(), n_labels_rank.data(),
+        labels_displs.data(), MPI_UNSIGNED, mpi_comm);
+
+    detail::TagUnionFind global_sets;
+    for (unsigned int k = 0; k < all_labels.size(); k += 2)
+        global_sets.merge(all_labels[k], all_labels[k+1]);
+
+    // flip clusters randomly, every rank draws the same decision for a cluster
+        {
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::readwrite);
+        ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::readwrite);
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+
+        for (unsigned int i = 0; i < nptl; ++i)
+            {
+            unsigned int tag = h_tag.data[i];
+            unsigned int cluster = global_sets.find(local_sets.find(tag));
+
+            // every cluster is counted on the rank that owns its smallest tag
+            if (cluster == tag)
+                m_count_total.n_clusters++;
+
+            // seed by the smallest tag in the cluster to make independent of the decomposition
+            hoomd::RandomGenerator rng_i(hoomd::Seed(hoomd::RNGIdentifier::UpdaterClusters2, timestep, seed),
+                                         hoomd::Counter(cluster));
+
+            if (hoomd::detail::generate_canonical<LongReal>(rng_i) <= m_flip_probability)
+                {
+                h_postype.data[i] = transformed[i].postype;
+                h_orientation.data[i] = transformed[i].orientation;
+                h_image.data[i] = transformed_image[i];
+                }
+            }
+
+        m_count_total.n_particles_in_clusters += nptl;
+        }
+
+    // migrate the flipped particles, which may need to pass through several domains
+    unsigned int max_hops = std::max(grid.x, std::max(grid.y, grid.z));
+    unsigned int n_hops = 0;
+    do
+        {
+        if (n_hops++ > max_hops)
+            throw std::runtime_error("UpdaterClusters failed to migrate particles.");
+
+        m_mc->communicate(true);
+        } while (countParticlesOutsideDomain() > 0);
+
+    m_mc->invalidateAABBTree();
+    }
+
+template< class Shape >
+unsigned int UpdaterClusters<Shape>::countParticlesOutsideDomain()
+    {
+    const BoxDim box = m_pdata->getBox();
+    const uint3 grid = m_pdata->getDomainDecomposition()->getGridSize();
+
+    unsigned int n_outside = 0;
+
+        {
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+
+        for (unsigned int i = 0; i < m_pdata->getN(); ++i)
+            {
+            Scalar3 f = box.makeFraction(make_scalar3(h_postype.data[i].x, h_postype.data[i].y, h_postype.data[i].z));
+            if ((grid.x > 1 && (f.x < Scalar(0.0) || f.x >= Scalar(1.0)))
+                || (grid.y > 1 && (f.y < Scalar(0.0) || f.y >= Scalar(1.0)))
+                || (grid.z > 1 && (f.z < Scalar(0.0) || f.z >= Scalar(1.0))))
+                {
+                n_outside++;
+                }
+            }
+        }
+
+    MPI_Allreduce(MPI_IN_PLACE, &n_outside, 1, MPI_UNSIGNED, MPI_SUM, m_exec_conf->getMPICommunicator());
+    return n_outside;
+    }
+#endif
+
 namespace detail {
 
 template < class Shape> void export_UpdaterClusters(pybind11::module& m, const std::string& name)
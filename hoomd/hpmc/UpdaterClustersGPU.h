@@ -218,6 +218,7 @@ UpdaterClustersGPU<Shape>::UpdaterClustersGPU(std::shared_ptr<SystemDefinition>
                          3,
                          true,
                          is_depletant_parameter_valid));
+    m_tuner_depletants->setMode(Autotuner<3>::search_coordinate_descent);
 
     // Tuning parameters for nlist concatenation kernel:
     // 0: block size
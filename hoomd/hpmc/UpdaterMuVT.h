@@ -147,6 +147,22 @@ template<class Shape> class UpdaterMuVT : public Updater
         return m_n_trial;
         }
 
+    //! Set the number of insertion/removal trials per step in the grand canonical ensemble
+    void setTransferTrials(unsigned int transfer_trials)
+        {
+        if (transfer_trials == 0)
+            {
+            throw std::runtime_error("transfer_trials must be at least 1.");
+            }
+        m_transfer_trials = transfer_trials;
+        }
+
+    //! Get the number of insertion/removal trials per step
+    unsigned int getTransferTrials()
+        {
+        return m_transfer_trials;
+        }
+
     //! Get the current counter values
     hpmc_muvt_counters_t getCounters(unsigned int mode = 0);
 
@@ -179,6 +195,9 @@ template<class Shape> class UpdaterMuVT : public Updater
 
     unsigned int m_n_trial;
 
+    /// Number of insertion/removal trials per step in the grand canonical ensemble
+    unsigned int m_transfer_trials;
+
     /*! Check for overlaps of a fictitious particle
      * \param timestep Current time step
      * \param type Type of particle to test
@@ -334,7 +353,8 @@ UpdaterMuVT<Shape>::UpdaterMuVT(std::shared_ptr<SystemDefinition> sysdef,
                                 std::shared_ptr<IntegratorHPMCMono<Shape>> mc,
                                 unsigned int npartition)
     : Updater(sysdef, trigger), m_mc(mc), m_npartition(npartition), m_gibbs(false),
-      m_max_vol_rescale(0.1), m_volume_move_probability(0.5), m_gibbs_other(0), m_n_trial(1)
+      m_max_vol_rescale(0.1), m_volume_move_probability(0.5), m_gibbs_other(0), m_n_trial(1),
+      m_transfer_trials(1)
     {
     m_fugacity.resize(m_pdata->getNTypes(), std::shared_ptr<Variant>(new VariantConstant(0.0)));
     m_type_map.resize(m_pdata->getNTypes());
@@ -960,8 +980,33 @@ template<class Shape> void UpdaterMuVT<Shape>::update(uint64_t timestep)
         }
 #endif
 
-    if (active && !volume_move)
+    // The Gibbs ensemble performs one transfer between a pair of boxes per step
+    unsigned int n_transfer_trials = m_gibbs ? 1 : m_transfer_trials;
+
+    if (n_transfer_trials > 1)
         {
+        // the depletant random number streams depend only on the timestep
+        for (unsigned int type_d = 0; type_d < m_pdata->getNTypes(); ++type_d)
+            {
+            if (m_mc->getDepletantFugacity(type_d) != 0.0)
+                {
+                throw std::runtime_error(
+                    "UpdaterMuVT does not support transfer_trials > 1 with depletants.");
+                }
+            }
+        }
+
+    for (unsigned int trial = 0; active && !volume_move && trial < n_transfer_trials; trial++)
+        {
+        if (trial > 0)
+            {
+            // draw every trial from an independent stream
+            rng = hoomd::RandomGenerator(hoomd::Seed(hoomd::RNGIdentifier::UpdaterMuVT,
+                                                     timestep,
+                                                     this->m_sysdef->getSeed()),
+                                         hoomd::Counter(group, trial));
+            }
+
 #ifdef ENABLE_MPI
         if (m_gibbs)
             {
@@ -1194,7 +1239,7 @@ template<class Shape> void UpdaterMuVT<Shape>::update(uint64_t timestep)
             hoomd::RandomGenerator rng_local(hoomd::Seed(hoomd::RNGIdentifier::UpdaterMuVTBox1,
                                                          timestep,
                                                          this->m_sysdef->getSeed()),
-                                             hoomd::Counter(group));
+                                             hoomd::Counter(group, trial));
 
             // choose a random particle type out of those being transferred
             assert(m_transfer_types.size() > 0);
@@ -3113,6 +3158,9 @@ template<class Shape> void export_UpdaterMuVT(pybind11::module& m, const std::st
                       &UpdaterMuVT<Shape>::getTransferTypes,
                       &UpdaterMuVT<Shape>::setTransferTypes)
         .def_property("ntrial", &UpdaterMuVT<Shape>::getNTrial, &UpdaterMuVT<Shape>::setNTrial)
+        .def_property("transfer_trials",
+                      &UpdaterMuVT<Shape>::getTransferTrials,
+                      &UpdaterMuVT<Shape>::setTransferTrials)
         .def_property_readonly("N", &UpdaterMuVT<Shape>::getN)
         .def("getCounters", &UpdaterMuVT<Shape>::getCounters);
     }
@@ -0,0 +1,678 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef _UPDATER_MUVT_GPU_H_
+#define _UPDATER_MUVT_GPU_H_
+
+/*! \file UpdaterMuVTGPU.h
+    \brief Declaration of UpdaterMuVTGPU
+    \note This header cannot be compiled by nvcc
+*/
+
+#ifdef ENABLE_HIP
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "hoomd/Autotuner.h"
+#include "hoomd/CellList.h"
+
+#include "IntegratorHPMCMonoGPU.cuh"
+#include "UpdaterMuVT.h"
+#include "UpdaterMuVTGPU.cuh"
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+/*!
+ * Implementation of UpdaterMuVT on the GPU.
+ *
+ * All insertion candidates of a step are drawn up front from the same random number streams that
+ * UpdaterMuVT uses and checked for overlaps with the current configuration in a single kernel
+ * launch. The trials are then resolved in order on the host: a candidate is also checked against
+ * the particles inserted earlier in the same step, and the kernel is relaunched for the remaining
+ * candidates after a removal is accepted. This reproduces the trajectory of UpdaterMuVT.
+ *
+ * Only hard particle systems without external fields and depletants in a single box on one rank
+ * use the batched trials. All other cases fall back to UpdaterMuVT::update().
+ */
+template<class Shape> class UpdaterMuVTGPU : public UpdaterMuVT<Shape>
+    {
+    public:
+    //! Constructor
+    UpdaterMuVTGPU(std::shared_ptr<SystemDefinition> sysdef,
+                   std::shared_ptr<Trigger> trigger,
+                   std::shared_ptr<IntegratorHPMCMono<Shape>> mc,
+                   unsigned int npartition,
+                   std::shared_ptr<CellList> cl);
+
+    //! Destructor
+    virtual ~UpdaterMuVTGPU();
+
+    //! The entry method for this updater
+    /*! \param timestep Current simulation step
+     */
+    virtual void update(uint64_t timestep);
+
+    protected:
+    std::shared_ptr<CellList> m_cl; //!< Cell list
+    uint3 m_last_dim;               //!< Dimensions of the cell list on the last call to update
+    unsigned int m_last_nmax;       //!< Last cell list NMax value allocated in excell
+
+    GPUArray<unsigned int> m_excell_idx;  //!< Particle indices in expanded cells
+    GPUArray<unsigned int> m_excell_size; //!< Number of particles in each expanded cell
+    Index2D m_excell_list_indexer;        //!< Indexer to access elements of the excell_idx list
+
+    GPUArray<Scalar4> m_insert_postype;      //!< Positions and types of the insertion candidates
+    GPUArray<Scalar4> m_insert_orientation;  //!< Orientations of the insertion candidates
+    GPUArray<unsigned int> m_insert_overlap; //!< Overlap flags of the insertion candidates
+
+    /// Autotuner for the insertion overlap check
+    std::shared_ptr<Autotuner<3>> m_tuner_insert;
+
+    /// Autotuner for excell block_size
+    std::shared_ptr<Autotuner<1>> m_tuner_excell_block_size;
+
+    //! Test whether the batched insertion trials apply to the current state
+    bool canBatchTrials();
+
+    //! Check insertion candidates for overlaps with the current configuration on the GPU
+    void checkInsertOverlaps(uint64_t timestep,
+                             unsigned int first,
+                             unsigned int n_insert,
+                             bool force_cell_list);
+
+    void initializeExcellMem();
+    };
+
+template<class Shape>
+UpdaterMuVTGPU<Shape>::UpdaterMuVTGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                      std::shared_ptr<Trigger> trigger,
+                                      std::shared_ptr<IntegratorHPMCMono<Shape>> mc,
+                                      unsigned int npartition,
+                                      std::shared_ptr<CellList> cl)
+    : UpdaterMuVT<Shape>(sysdef, trigger, mc, npartition), m_cl(cl)
+    {
+    this->m_cl->setRadius(1);
+    this->m_cl->setComputeTypeBody(false);
+    this->m_cl->setFlagType();
+    this->m_cl->setComputeIdx(true);
+
+    // Autotuner parameters:
+    // 0: block size
+    // 1: stride
+    // 2: group size
+
+    // Only widen the parallelism if the shape supports it, and limit parallelism to fit within the
+    // warp.
+    std::function<bool(const std::array<unsigned int, 3>&)> is_parameter_valid
+        = [](const std::array<unsigned int, 3>& parameter) -> bool
+    {
+        unsigned int block_size = parameter[0];
+        unsigned int stride = parameter[1];
+        unsigned int group_size = parameter[2];
+        return (stride == 1 || Shape::isParallel()) && (stride * group_size <= block_size)
+               && (block_size % (stride * group_size)) == 0;
+    };
+
+    m_tuner_insert.reset(new Autotuner<3>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf),
+                                           AutotunerBase::getTppListPow2(this->m_exec_conf),
+                                           AutotunerBase::getTppListPow2(this->m_exec_conf)},
+                                          this->m_exec_conf,
+                                          "hpmc_muvt_insert",
+                                          3,
+                                          false,
+                                          is_parameter_valid));
+
+    GPUArray<unsigned int> excell_size(0, this->m_exec_conf);
+    m_excell_size.swap(excell_size);
+
+    GPUArray<unsigned int> excell_idx(0, this->m_exec_conf);
+    m_excell_idx.swap(excell_idx);
+
+    GPUArray<Scalar4> insert_postype(0, this->m_exec_conf);
+    m_insert_postype.swap(insert_postype);
+
+    GPUArray<Scalar4> insert_orientation(0, this->m_exec_conf);
+    m_insert_orientation.swap(insert_orientation);
+
+    GPUArray<unsigned int> insert_overlap(0, this->m_exec_conf);
+    m_insert_overlap.swap(insert_overlap);
+
+    // set last dim to a bogus value so that it will re-init on the first call
+    m_last_dim = make_uint3(0xffffffff, 0xffffffff, 0xffffffff);
+    m_last_nmax = 0xffffffff;
+
+    m_tuner_excell_block_size.reset(
+        new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
+                         this->m_exec_conf,
+                         "hpmc_muvt_excell_block_size"));
+
+    this->m_autotuners.insert(this->m_autotuners.end(),
+                              {m_tuner_insert, m_tuner_excell_block_size});
+    }
+
+template<class Shape> UpdaterMuVTGPU<Shape>::~UpdaterMuVTGPU() { }
+
+/*! The batched trials evaluate only hard particle overlaps in the local box.
+ */
+template<class Shape> bool UpdaterMuVTGPU<Shape>::canBatchTrials()
+    {
+    if (this->m_gibbs || this->m_sysdef->isDomainDecomposed() || this->m_mc->hasPairInteractions()
+        || this->m_mc->getExternalField())
+        {
+        return false;
+        }
+
+    for (unsigned int type_d = 0; type_d < this->m_pdata->getNTypes(); ++type_d)
+        {
+        if (this->m_mc->getDepletantFugacity(type_d) != 0.0)
+            {
+            return false;
+            }
+        }
+
+    // candidates must not overlap with their own periodic images
+    Scalar nominal_width = this->m_mc->getMaxCoreDiameter();
+    const BoxDim box = this->m_pdata->getBox();
+    Scalar3 npd = box.getNearestPlaneDistance();
+
+    if ((box.getPeriodic().x && npd.x <= nominal_width * 2)
+        || (box.getPeriodic().y && npd.y <= nominal_width * 2)
+        || (this->m_sysdef->getNDimensions() == 3 && box.getPeriodic().z
+            && npd.z <= nominal_width * 2))
+        {
+        return false;
+        }
+
+    return true;
+    }
+
+template<class Shape> void UpdaterMuVTGPU<Shape>::update(uint64_t timestep)
+    {
+    if (!canBatchTrials())
+        {
+        UpdaterMuVT<Shape>::update(timestep);
+        return;
+        }
+
+    Updater::update(timestep);
+    this->m_count_step_start = this->m_count_total;
+    unsigned int ndim = this->m_sysdef->getNDimensions();
+
+    this->m_exec_conf->msg->notice(10) << "UpdaterMuVTGPU update: " << timestep << std::endl;
+
+    unsigned int group = (this->m_exec_conf->getPartition() / this->m_npartition);
+    unsigned int n_trials = this->m_transfer_trials;
+    const BoxDim global_box = this->m_pdata->getGlobalBox();
+    auto& params = this->m_mc->getParams();
+
+    assert(this->m_transfer_types.size() > 0);
+
+    // Draw the insertion candidates in the same order as UpdaterMuVT::update() and keep the
+    // random number generators to evaluate the acceptance criteria.
+    std::vector<hoomd::RandomGenerator> trial_rng;
+    std::vector<unsigned int> trial_candidate(n_trials, UINT_MAX);
+    std::vector<unsigned int> candidate_type;
+    std::vector<vec3<Scalar>> candidate_pos;
+    std::vector<quat<Scalar>> candidate_orientation;
+
+    for (unsigned int trial = 0; trial < n_trials; trial++)
+        {
+        hoomd::RandomGenerator rng(hoomd::Seed(hoomd::RNGIdentifier::UpdaterMuVT,
+                                               timestep,
+                                               this->m_sysdef->getSeed()),
+                                   hoomd::Counter(group, trial));
+
+        bool insert = hoomd::UniformIntDistribution(1)(rng);
+
+        if (insert)
+            {
+            unsigned int type = this->m_transfer_types[hoomd::UniformIntDistribution(
+                (unsigned int)(this->m_transfer_types.size() - 1))(rng)];
+
+            Scalar3 f;
+            f.x = hoomd::detail::generate_canonical<Scalar>(rng);
+            f.y = hoomd::detail::generate_canonical<Scalar>(rng);
+            if (ndim == 2)
+                {
+                f.z = Scalar(0.5);
+                }
+            else
+                {
+                f.z = hoomd::detail::generate_canonical<Scalar>(rng);
+                }
+
+            Shape shape_test(quat<Scalar>(), params[type]);
+            if (shape_test.hasOrientation())
+                {
+                shape_test.orientation = generateRandomOrientation(rng, ndim);
+                }
+
+            trial_candidate[trial] = (unsigned int)candidate_type.size();
+            candidate_type.push_back(type);
+            candidate_pos.push_back(vec3<Scalar>(global_box.makeCoordinates(f)));
+            candidate_orientation.push_back(shape_test.orientation);
+            }
+
+        trial_rng.push_back(rng);
+        }
+
+    unsigned int n_candidates = (unsigned int)candidate_type.size();
+
+    if (n_candidates > 0)
+        {
+        if (m_insert_postype.getNumElements() < n_candidates)
+            {
+            m_insert_postype.resize(n_candidates);
+            m_insert_orientation.resize(n_candidates);
+            m_insert_overlap.resize(n_candidates);
+            }
+
+        ArrayHandle<Scalar4> h_insert_postype(m_insert_postype,
+                                              access_location::host,
+                                              access_mode::overwrite);
+        ArrayHandle<Scalar4> h_insert_orientation(m_insert_orientation,
+                                                  access_location::host,
+                                                  access_mode::overwrite);
+        for (unsigned int i = 0; i < n_candidates; ++i)
+            {
+            h_insert_postype.data[i] = make_scalar4(candidate_pos[i].x,
+                                                    candidate_pos[i].y,
+                                                    candidate_pos[i].z,
+                                                    __int_as_scalar(candidate_type[i]));
+            h_insert_orientation.data[i] = quat_to_scalar4(candidate_orientation[i]);
+            }
+        }
+
+    // candidates accepted since the last overlap check on the GPU
+    std::vector<unsigned int> inserted_candidates;
+    bool check_candidates = true;
+    bool removed = false;
+
+    const Index2D& overlap_idx = this->m_mc->getOverlapIndexer();
+
+    for (unsigned int trial = 0; trial < n_trials; trial++)
+        {
+        Scalar V = global_box.getVolume();
+
+        if (trial_candidate[trial] != UINT_MAX)
+            {
+            // Try inserting a particle
+            unsigned int candidate = trial_candidate[trial];
+            unsigned int type = candidate_type[candidate];
+
+            if (check_candidates)
+                {
+                checkInsertOverlaps(timestep, candidate, n_candidates - candidate, removed);
+                inserted_candidates.clear();
+                check_candidates = false;
+                }
+
+            // number of particles of that type
+            unsigned int nptl_type = this->getNumParticlesType(type);
+
+            // get fugacity value
+            Scalar fugacity = (*this->m_fugacity[type])(timestep);
+
+            // sanity check
+            if (fugacity <= Scalar(0.0))
+                {
+                this->m_exec_conf->msg->error()
+                    << "Fugacity has to be greater than zero." << std::endl;
+                throw std::runtime_error("Error in UpdaterMuVT");
+                }
+
+            // acceptance probability
+            Scalar lnboltzmann = log(fugacity * V / (Scalar)(nptl_type + 1));
+
+            unsigned int overlap;
+                {
+                ArrayHandle<unsigned int> h_insert_overlap(m_insert_overlap,
+                                                           access_location::host,
+                                                           access_mode::read);
+                overlap = h_insert_overlap.data[candidate];
+                }
+
+            // check against the particles inserted since the last check on the GPU
+            Shape shape_test(candidate_orientation[candidate], params[type]);
+            if (!overlap && inserted_candidates.size())
+                {
+                ArrayHandle<unsigned int> h_overlaps(this->m_mc->getInteractionMatrix(),
+                                                     access_location::host,
+                                                     access_mode::read);
+
+                for (unsigned int j : inserted_candidates)
+                    {
+                    unsigned int type_j = candidate_type[j];
+                    Shape shape_j(candidate_orientation[j], params[type_j]);
+                    vec3<Scalar> r_ij = candidate_pos[j] - candidate_pos[candidate];
+                    r_ij = vec3<Scalar>(global_box.minImage(vec_to_scalar3(r_ij)));
+
+                    unsigned int err_count = 0;
+                    if (h_overlaps.data[overlap_idx(type_j, type)]
+                        && check_circumsphere_overlap(r_ij, shape_test, shape_j)
+                        && test_overlap(r_ij, shape_test, shape_j, err_count))
+                        {
+                        overlap = 1;
+                        break;
+                        }
+                    }
+                }
+
+            // apply acceptance criterion
+            bool accept = false;
+            if (!overlap)
+                {
+                accept = (hoomd::detail::generate_canonical<double>(trial_rng[trial])
+                          < exp(lnboltzmann));
+                }
+
+            if (accept)
+                {
+                // insertion was successful
+                unsigned int tag = this->m_pdata->addParticle(type);
+
+                // setPosition() takes into account the grid shift, so subtract that one
+                Scalar3 p = vec_to_scalar3(candidate_pos[candidate]) - this->m_pdata->getOrigin();
+                int3 tmp = make_int3(0, 0, 0);
+                global_box.wrap(p, tmp);
+                this->m_pdata->setPosition(tag, p);
+                if (shape_test.hasOrientation())
+                    {
+                    this->m_pdata->setOrientation(tag, quat_to_scalar4(shape_test.orientation));
+                    }
+                inserted_candidates.push_back(candidate);
+                this->m_count_total.insert_accept_count++;
+                }
+            else
+                {
+                this->m_count_total.insert_reject_count++;
+                }
+            }
+        else
+            {
+            // try removing a particle
+            unsigned int tag = UINT_MAX;
+
+            hoomd::RandomGenerator rng_local(hoomd::Seed(hoomd::RNGIdentifier::UpdaterMuVTBox1,
+                                                         timestep,
+                                                         this->m_sysdef->getSeed()),
+                                             hoomd::Counter(group, trial));
+
+            // choose a random particle type out of those being transferred
+            unsigned int type = this->m_transfer_types[hoomd::UniformIntDistribution(
+                (unsigned int)(this->m_transfer_types.size() - 1))(rng_local)];
+
+            // choose a random particle of that type
+            unsigned int nptl_type = this->getNumParticlesType(type);
+
+            if (nptl_type)
+                {
+                // get random tag of given type
+                unsigned int type_offset = hoomd::UniformIntDistribution(nptl_type - 1)(rng_local);
+                tag = this->getNthTypeTag(type, type_offset);
+                }
+
+            // get fugacity value
+            Scalar fugacity = (*this->m_fugacity[type])(timestep);
+
+            // sanity check
+            if (fugacity <= Scalar(0.0))
+                {
+                this->m_exec_conf->msg->error()
+                    << "Fugacity has to be greater than zero." << std::endl;
+                throw std::runtime_error("Error in UpdaterMuVT");
+                }
+
+            Scalar lnboltzmann = -log(fugacity);
+
+            // acceptance probability
+            unsigned int nonzero = 1;
+            if (nptl_type)
+                {
+                lnboltzmann += log((Scalar)nptl_type / V);
+                }
+            else
+                {
+                nonzero = 0;
+                }
+
+            // get weight for removal
+            Scalar lnb(0.0);
+            if (this->tryRemoveParticle(timestep, tag, lnb))
+                {
+                lnboltzmann += lnb;
+                }
+            else
+                {
+                nonzero = 0;
+                }
+
+            // apply acceptance criterion
+            bool accept = false;
+            if (nonzero)
+                {
+                accept = (hoomd::detail::generate_canonical<double>(rng_local) < exp(lnboltzmann));
+                }
+
+            if (accept)
+                {
+                // remove particle
+                this->m_pdata->removeParticle(tag);
+                this->m_count_total.remove_accept_count++;
+
+                // the removed particle may have blocked the remaining candidates
+                check_candidates = true;
+                removed = true;
+                }
+            else
+                {
+                this->m_count_total.remove_reject_count++;
+                }
+            }
+        }
+    }
+
+/*! \param timestep Current time step
+    \param first Index of the first candidate to check
+    \param n_insert Number of candidates to check
+    \param force_cell_list Recompute the cell list even if it was computed at this time step
+*/
+template<class Shape>
+void UpdaterMuVTGPU<Shape>::checkInsertOverlaps(uint64_t timestep,
+                                                unsigned int first,
+                                                unsigned int n_insert,
+                                                bool force_cell_list)
+    {
+    if (this->m_pdata->getN() == 0)
+        {
+        // there is nothing to overlap with
+        ArrayHandle<unsigned int> h_insert_overlap(m_insert_overlap,
+                                                   access_location::host,
+                                                   access_mode::readwrite);
+        memset(h_insert_overlap.data + first, 0, sizeof(unsigned int) * n_insert);
+        return;
+        }
+
+    // set nominal width
+    Scalar nominal_width = this->m_mc->getMaxCoreDiameter();
+
+    if (this->m_cl->getNominalWidth() != nominal_width)
+        this->m_cl->setNominalWidth(nominal_width);
+
+    // compute cell list
+    if (force_cell_list)
+        this->m_cl->forceCompute(timestep);
+    else
+        this->m_cl->compute(timestep);
+
+    // if the cell list is a different size than last time, reinitialize expanded cell list
+    uint3 cur_dim = this->m_cl->getDim();
+    if (this->m_last_dim.x != cur_dim.x || this->m_last_dim.y != cur_dim.y
+        || this->m_last_dim.z != cur_dim.z || this->m_last_nmax != this->m_cl->getNmax())
+        {
+        this->initializeExcellMem();
+        m_last_dim = cur_dim;
+        m_last_nmax = this->m_cl->getNmax();
+        }
+
+    // access the cell list data
+    ArrayHandle<unsigned int> d_cell_size(this->m_cl->getCellSizeArray(),
+                                          access_location::device,
+                                          access_mode::read);
+    ArrayHandle<unsigned int> d_cell_idx(this->m_cl->getIndexArray(),
+                                         access_location::device,
+                                         access_mode::read);
+    ArrayHandle<unsigned int> d_cell_adj(this->m_cl->getCellAdjArray(),
+                                         access_location::device,
+                                         access_mode::read);
+
+    // per-device cell list data
+    const ArrayHandle<unsigned int>& d_cell_size_per_device
+        = this->m_cl->getPerDevice()
+              ? ArrayHandle<unsigned int>(this->m_cl->getCellSizeArrayPerDevice(),
+                                          access_location::device,
+                                          access_mode::read)
+              : ArrayHandle<unsigned int>(GlobalArray<unsigned int>(),
+                                          access_location::device,
+                                          access_mode::read);
+    const ArrayHandle<unsigned int>& d_cell_idx_per_device
+        = this->m_cl->getPerDevice()
+              ? ArrayHandle<unsigned int>(this->m_cl->getIndexArrayPerDevice(),
+                                          access_location::device,
+                                          access_mode::read)
+              : ArrayHandle<unsigned int>(GlobalArray<unsigned int>(),
+                                          access_location::device,
+                                          access_mode::read);
+
+    ArrayHandle<unsigned int> d_excell_idx(this->m_excell_idx,
+                                           access_location::device,
+                                           access_mode::readwrite);
+    ArrayHandle<unsigned int> d_excell_size(this->m_excell_size,
+                                            access_location::device,
+                                            access_mode::readwrite);
+
+    // update the expanded cells
+    this->m_tuner_excell_block_size->begin();
+    gpu::hpmc_excell(d_excell_idx.data,
+                     d_excell_size.data,
+                     m_excell_list_indexer,
+                     this->m_cl->getPerDevice() ? d_cell_idx_per_device.data : d_cell_idx.data,
+                     this->m_cl->getPerDevice() ? d_cell_size_per_device.data : d_cell_size.data,
+                     d_cell_adj.data,
+                     this->m_cl->getCellIndexer(),
+                     this->m_cl->getCellListIndexer(),
+                     this->m_cl->getCellAdjIndexer(),
+                     this->m_cl->getPerDevice() ? this->m_exec_conf->getNumActiveGPUs() : 1,
+                     this->m_tuner_excell_block_size->getParam()[0]);
+    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    this->m_tuner_excell_block_size->end();
+
+    // access the particle data
+    ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+    ArrayHandle<Scalar4> d_orientation(this->m_pdata->getOrientationArray(),
+                                       access_location::device,
+                                       access_mode::read);
+    ArrayHandle<unsigned int> d_overlaps(this->m_mc->getInteractionMatrix(),
+                                         access_location::device,
+                                         access_mode::read);
+
+    // access the candidates
+    ArrayHandle<Scalar4> d_insert_postype(m_insert_postype,
+                                          access_location::device,
+                                          access_mode::read);
+    ArrayHandle<Scalar4> d_insert_orientation(m_insert_orientation,
+                                              access_location::device,
+                                              access_mode::read);
+    ArrayHandle<unsigned int> d_insert_overlap(m_insert_overlap,
+                                               access_location::device,
+                                               access_mode::readwrite);
+
+    // access the parameters
+    auto& params = this->m_mc->getParams();
+
+    m_tuner_insert->begin();
+    auto param = m_tuner_insert->getParam();
+    unsigned int block_size = param[0];
+    unsigned int stride = param[1];
+    unsigned int group_size = param[2];
+
+    detail::hpmc_muvt_insert_args_t insert_args(n_insert,
+                                                d_insert_postype.data + first,
+                                                d_insert_orientation.data + first,
+                                                d_insert_overlap.data + first,
+                                                d_postype.data,
+                                                d_orientation.data,
+                                                this->m_cl->getCellIndexer(),
+                                                d_excell_idx.data,
+                                                d_excell_size.data,
+                                                this->m_excell_list_indexer,
+                                                this->m_cl->getDim(),
+                                                this->m_pdata->getNTypes(),
+                                                this->m_pdata->getBox(),
+                                                block_size,
+                                                stride,
+                                                group_size,
+                                                this->m_cl->getGhostWidth(),
+                                                d_overlaps.data,
+                                                this->m_mc->getOverlapIndexer(),
+                                                this->m_exec_conf->dev_prop);
+
+    detail::gpu_hpmc_muvt_insert<Shape>(insert_args, params.data());
+
+    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+
+    m_tuner_insert->end();
+    }
+
+template<class Shape> void UpdaterMuVTGPU<Shape>::initializeExcellMem()
+    {
+    this->m_exec_conf->msg->notice(4) << "hpmc resizing expanded cells" << std::endl;
+
+    // get the current cell dimensions
+    unsigned int num_cells = this->m_cl->getCellIndexer().getNumElements();
+    unsigned int num_adj = this->m_cl->getCellAdjIndexer().getW();
+    unsigned int num_max = this->m_cl->getNmax();
+
+    // make the excell dimensions the same, but with room for Nmax*Nadj in each cell
+    m_excell_list_indexer = Index2D(num_max * num_adj, num_cells);
+
+    // reallocate memory
+    m_excell_idx.resize(m_excell_list_indexer.getNumElements());
+    m_excell_size.resize(num_cells);
+    }
+
+namespace detail
+    {
+//! Export the UpdaterMuVTGPU class to python
+/*! \param name Name of the class in the exported python module
+    \tparam Shape An instantiation of UpdaterMuVTGPU<Shape> will be exported
+*/
+template<class Shape> void export_UpdaterMuVTGPU(pybind11::module& m, const std::string& name)
+    {
+    pybind11::class_<UpdaterMuVTGPU<Shape>,
+                     UpdaterMuVT<Shape>,
+                     std::shared_ptr<UpdaterMuVTGPU<Shape>>>(m, name.c_str())
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<IntegratorHPMCMono<Shape>>,
+                            unsigned int,
+                            std::shared_ptr<CellList>>());
+    }
+
+    } // end namespace detail
+    } // end namespace hpmc
+    } // end namespace hoomd
+
+#endif // ENABLE_HIP
+
+#endif // _UPDATER_MUVT_GPU_H_
@@ -44,8 +44,8 @@ void UpdaterQuickCompress::update(uint64_t timestep)
     Updater::update(timestep);
     m_exec_conf->msg->notice(10) << "UpdaterQuickCompress: " << timestep << std::endl;
 
-    // count the number of overlaps in the current configuration
-    auto n_overlaps = m_mc->countOverlaps(false);
+    // only the presence of overlaps matters here, so stop at the first one
+    auto n_overlaps = m_mc->countOverlaps(true);
     BoxDim current_box = m_pdata->getGlobalBox();
     BoxDim target_box = BoxDim((*m_target_box)(timestep));
     if (n_overlaps == 0 && current_box != target_box)
@@ -60,46 +60,131 @@ void UpdaterQuickCompress::update(uint64_t timestep)
         m_is_complete = false;
     }
 
+/** Scale the box toward the target.
+
+    When the randomly chosen scale generates too many overlaps, the scale is bisected between it
+    and 1 for up to max_bisection_steps trials, and the most compressed accepted box is kept. When
+    the integrator runs on the GPU, the positions are scaled, backed up, and restored on the device.
+*/
 void UpdaterQuickCompress::performBoxScale(uint64_t timestep, const BoxDim& target_box)
     {
-    auto new_box = getNewBox(timestep, target_box);
-    auto old_box = m_pdata->getGlobalBox();
-
-    Scalar3 old_origin = m_pdata->getOrigin();
+    const double scale = getScale(timestep);
+    const BoxDim old_box = m_pdata->getGlobalBox();
+    const Scalar3 old_origin = m_pdata->getOrigin();
 
     // Make a backup copy of position data
-    unsigned int N_backup = m_pdata->getN();
+    backupPositions();
+
+    if (!resizeHasTooManyOverlaps(timestep, scaleBox(old_box, target_box, scale)))
+        return;
+
+    double rejected_scale = scale;
+    double accepted_scale = 1.0;
+    bool accepted_is_set = false;
+    for (unsigned int i = 0; i < m_max_bisection_steps; ++i)
         {
-        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
-                                   access_location::host,
+        const double trial_scale = 0.5 * (rejected_scale + accepted_scale);
+        restoreBox(old_box, old_origin);
+        accepted_is_set
+            = !resizeHasTooManyOverlaps(timestep, scaleBox(old_box, target_box, trial_scale));
+        if (accepted_is_set)
+            accepted_scale = trial_scale;
+        else
+            rejected_scale = trial_scale;
+        }
+
+    // the box move generated too many overlaps, go back to the most compressed accepted box
+    if (!accepted_is_set)
+        {
+        restoreBox(old_box, old_origin);
+        if (accepted_scale < 1.0)
+            {
+            m_mc->attemptBoxResize(timestep, scaleBox(old_box, target_box, accepted_scale));
+            }
+        }
+    }
+
+/** Resize the box and check the overlaps in it.
+
+    @param timestep Current time step.
+    @param new_box Box to set.
+
+    @returns true when the new box has more overlaps than allowed.
+*/
+bool UpdaterQuickCompress::resizeHasTooManyOverlaps(uint64_t timestep, const BoxDim& new_box)
+    {
+    // attemptBoxResize checks for any overlap, which is enough unless some are allowed
+    if (m_mc->attemptBoxResize(timestep, new_box))
+        return false;
+
+    const double max_overlaps = m_max_overlaps_per_particle * m_pdata->getNGlobal();
+    if (max_overlaps < 1.0)
+        return true;
+
+    return m_mc->countOverlaps(false) > max_overlaps;
+    }
+
+void UpdaterQuickCompress::backupPositions()
+    {
+    const unsigned int N = m_pdata->getN();
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                   access_location::device,
                                    access_mode::read);
-        ArrayHandle<Scalar4> h_pos_backup(m_pos_backup,
-                                          access_location::host,
+        ArrayHandle<Scalar4> d_pos_backup(m_pos_backup,
+                                          access_location::device,
                                           access_mode::overwrite);
-        memcpy(h_pos_backup.data, h_pos.data, sizeof(Scalar4) * N_backup);
+        hipMemcpy(d_pos_backup.data, d_pos.data, sizeof(Scalar4) * N, hipMemcpyDeviceToDevice);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        return;
         }
+#endif
 
-    m_mc->attemptBoxResize(timestep, new_box);
-    Scalar3 new_origin = m_pdata->getOrigin();
-    Scalar3 origin_shift = new_origin - old_origin;
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_pos_backup(m_pos_backup, access_location::host, access_mode::overwrite);
+    memcpy(h_pos_backup.data, h_pos.data, sizeof(Scalar4) * N);
+    }
+
+/** Restore the backed up positions and the box.
 
-    auto n_overlaps = m_mc->countOverlaps(false);
-    if (n_overlaps > m_max_overlaps_per_particle * m_pdata->getNGlobal())
+    @param old_box Box to restore.
+    @param old_origin Origin to restore.
+*/
+void UpdaterQuickCompress::restoreBox(const BoxDim& old_box, const Scalar3& old_origin)
+    {
+    const unsigned int N = m_pdata->getN();
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::overwrite);
+        ArrayHandle<Scalar4> d_pos_backup(m_pos_backup,
+                                          access_location::device,
+                                          access_mode::read);
+        hipMemcpy(d_pos.data, d_pos_backup.data, sizeof(Scalar4) * N, hipMemcpyDeviceToDevice);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+    else
+#endif
         {
-        // the box move generated too many overlaps, undo the move
         ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
                                    access_location::host,
-                                   access_mode::readwrite);
+                                   access_mode::overwrite);
         ArrayHandle<Scalar4> h_pos_backup(m_pos_backup, access_location::host, access_mode::read);
-        unsigned int N = m_pdata->getN();
-        assert(N == N_backup);
         memcpy(h_pos.data, h_pos_backup.data, sizeof(Scalar4) * N);
-        m_pdata->setGlobalBox(old_box);
-        m_pdata->translateOrigin(-origin_shift);
-
-        // we have moved particles, communicate those changes
-        m_mc->communicate(false);
         }
+
+    Scalar3 origin_shift = m_pdata->getOrigin() - old_origin;
+    m_pdata->setGlobalBox(old_box);
+    m_pdata->translateOrigin(-origin_shift);
+
+    // we have moved particles, communicate those changes
+    m_mc->communicate(false);
     }
 
 /** Adjust a value by the scale.
@@ -139,7 +224,7 @@ static inline double scaleTilt(double current, double target, double s)
         }
     }
 
-BoxDim UpdaterQuickCompress::getNewBox(uint64_t timestep, const BoxDim& target_box)
+double UpdaterQuickCompress::getScale(uint64_t timestep)
     {
     // compute the current MC translate acceptance ratio
     auto current_counters = m_mc->getCounters();
@@ -181,10 +266,12 @@ BoxDim UpdaterQuickCompress::getNewBox(uint64_t timestep, const BoxDim& target_b
 
     // choose a scale randomly between min_scale and 1.0
     hoomd::UniformDistribution<double> uniform(min_scale, 1.0);
-    double scale = uniform(rng);
+    return uniform(rng);
+    }
 
-    // construct the scaled box
-    BoxDim current_box = m_pdata->getGlobalBox();
+BoxDim
+UpdaterQuickCompress::scaleBox(const BoxDim& current_box, const BoxDim& target_box, double scale)
+    {
     Scalar3 new_L;
     Scalar new_xy, new_xz, new_yz;
     if (m_sysdef->getNDimensions() == 3)
@@ -242,7 +329,10 @@ void export_UpdaterQuickCompress(pybind11::module& m)
                       &UpdaterQuickCompress::setInstance)
         .def_property("allow_unsafe_resize",
                       &UpdaterQuickCompress::getAllowUnsafeResize,
-                      &UpdaterQuickCompress::setAllowUnsafeResize);
+                      &UpdaterQuickCompress::setAllowUnsafeResize)
+        .def_property("max_bisection_steps",
+                      &UpdaterQuickCompress::getMaxBisectionSteps,
+                      &UpdaterQuickCompress::setMaxBisectionSteps);
     }
     } // end namespace detail
     } // end namespace hpmc
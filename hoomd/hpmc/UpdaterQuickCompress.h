@@ -85,6 +85,18 @@ class UpdaterQuickCompress : public Updater
         m_max_overlaps_per_particle = max_overlaps_per_particle;
         }
 
+    /// Get the maximum number of bisection steps after a rejected box move
+    unsigned int getMaxBisectionSteps()
+        {
+        return m_max_bisection_steps;
+        }
+
+    /// Set the maximum number of bisection steps after a rejected box move
+    void setMaxBisectionSteps(unsigned int max_bisection_steps)
+        {
+        m_max_bisection_steps = max_bisection_steps;
+        }
+
     /// Get the minimum scale factor
     double getMinScale()
         {
@@ -153,11 +165,26 @@ class UpdaterQuickCompress : public Updater
     /// Flag whether unsafe box resizes are allowed
     bool m_allow_unsafe_resize = false;
 
+    /// Maximum number of bisection steps after a rejected box move
+    unsigned int m_max_bisection_steps = 0;
+
     /// Perform the box scale move
     void performBoxScale(uint64_t timestep, const BoxDim& target_box);
 
-    /// Get the new box to set
-    BoxDim getNewBox(uint64_t timestep, const BoxDim& target_box);
+    /// Choose the scale factor for a box move
+    double getScale(uint64_t timestep);
+
+    /// Scale a box toward the target box
+    BoxDim scaleBox(const BoxDim& current_box, const BoxDim& target_box, double scale);
+
+    /// Resize the box and check if it has too many overlaps
+    bool resizeHasTooManyOverlaps(uint64_t timestep, const BoxDim& new_box);
+
+    /// Copy the particle positions to m_pos_backup
+    void backupPositions();
+
+    /// Restore the particle positions from m_pos_backup and set the box
+    void restoreBox(const BoxDim& old_box, const Scalar3& old_origin);
 
     /// Store the last HPMC counters
     hpmc_counters_t m_last_move_counters;
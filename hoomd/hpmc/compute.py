@@ -302,7 +302,12 @@ class SDF(Compute):
         values and step discontinuities.
 
     Note:
-        `SDF` always runs on the CPU.
+        On GPUs, `SDF` computes the histogram on the device for the
+        `hoomd.hpmc.integrate` shapes ``Sphere``, ``ConvexPolygon``,
+        ``ConvexSpheropolygon``, ``Ellipsoid``, ``FacetedEllipsoid``,
+        ``ConvexPolyhedron``, and ``ConvexSpheropolyhedron`` without pair
+        potentials in boxes that satisfy the minimum image convention. `SDF`
+        runs on the CPU in all other cases.
 
     .. rubric:: Mixed precision
 
@@ -338,14 +343,27 @@ class SDF(Compute):
         # Extract 'Shape' from '<hoomd.hpmc.integrate.Shape object>'
         integrator_name = integrator.__class__.__name__
 
-        cpp_cls = getattr(_hpmc, 'ComputeSDF' + integrator_name)
+        sys_def = self._simulation.state._cpp_sys_def
+        if (isinstance(self._simulation.device, hoomd.device.GPU)
+                and ('ComputeSDF' + integrator_name + 'GPU') in _hpmc.__dict__):
+            cpp_cls = getattr(_hpmc, 'ComputeSDF' + integrator_name + 'GPU')
 
-        self._cpp_obj = cpp_cls(
-            self._simulation.state._cpp_sys_def,
-            integrator._cpp_obj,
-            self.xmax,
-            self.dx,
-        )
+            # share the cell list with the integrator when it has one
+            cl = integrator._cpp_cell
+            if cl is None:
+                cl = _hoomd.CellListGPU(sys_def)
+
+            self._cpp_obj = cpp_cls(sys_def, integrator._cpp_obj, cl,
+                                    self.xmax, self.dx)
+        else:
+            cpp_cls = getattr(_hpmc, 'ComputeSDF' + integrator_name)
+
+            self._cpp_obj = cpp_cls(
+                sys_def,
+                integrator._cpp_obj,
+                self.xmax,
+                self.dx,
+            )
 
     @log(category='sequence', requires_run=True)
     def sdf_compression(self):
@@ -88,6 +88,14 @@ class CPPExternalPotential(ExternalField):
     .. _BoxDim.h: https://github.com/glotzerlab/hoomd-blue/blob/\
             v4.7.0/hoomd/BoxDim.h
 
+    .. rubric:: Compilation cache
+
+    The root MPI rank compiles the CPU code and broadcasts the result to the
+    other ranks. Set the environment variable ``HOOMD_JIT_CACHE_DIR`` to a
+    directory to store the compiled code on disk and reuse it in later jobs
+    that compile the same code with the same compiler arguments, HOOMD-blue
+    version, and LLVM version.
+
     .. rubric:: Example:
 
     .. skip: next if(llvm_not_available)
@@ -102,8 +110,12 @@ class CPPExternalPotential(ExternalField):
             code=gravity_code, param_array=[9.8])
         hpmc_integrator.external_potential = cpp_external_potential
 
-    Note:
-        `CPPExternalPotential` does not support execution on GPUs.
+    .. rubric:: GPU execution
+
+    On the GPU, the same code is compiled at runtime with NVRTC into a kernel
+    that evaluates the change in the field energy of every trial move. The code
+    must then also be valid CUDA device code. `CPPExternalPotential` supports
+    GPU execution only on NVIDIA GPUs.
 
     Warning:
         ``CPPExternalPotential`` is **experimental** and subject to change in
@@ -187,6 +199,40 @@ class CPPExternalPotential(ExternalField):
                         """
         return cpp_function
 
+    def _wrap_gpu_code(self, code):
+        """Convert the provided code into a device function with the expected \
+                signature.
+
+        Args:
+            code (`str`): Body of the C++ function
+        """
+        cpp_function = """
+                        #include "hoomd/HOOMDMath.h"
+                        #include "hoomd/VectorMath.h"
+                        #include "hoomd/BoxDim.h"
+
+                        using namespace hoomd;
+
+                        // param_array is allocated by the library
+                        __device__ float *param_array;
+
+                        __device__ inline float eval(const BoxDim& box,
+                        unsigned int type_i,
+                        const vec3<Scalar>& r_i,
+                        const quat<Scalar>& q_i,
+                        Scalar diameter,
+                        Scalar charge
+                        )
+                            {
+                        """
+        cpp_function += code
+        cpp_function += """
+                            }
+                        """
+        cpp_function += ('#include '
+                         '"hoomd/hpmc/IntegratorHPMCMonoGPUExternalJIT.inc"\n')
+        return cpp_function
+
     def _attach_hook(self):
         integrator_pairs = {
             integrate.Sphere:
@@ -215,21 +261,37 @@ class CPPExternalPotential(ExternalField):
         if not isinstance(integrator, integrate.HPMCIntegrator):
             raise RuntimeError("The integrator must be a HPMC integrator.")
 
-        if (isinstance(self._simulation.device, hoomd.device.GPU)):
-            msg = 'User-defined external fields are not supported on the GPU.'
-            raise NotImplementedError(msg)
-
         cpp_cls = integrator_pairs.get(
             self._simulation.operations.integrator.__class__, None)
         if cpp_cls is None:
             raise RuntimeError("Unsupported integrator.\n")
 
+        device = self._simulation.device
         cpu_code = self._wrap_cpu_code(self.code)
         cpu_include_options = _compile.get_cpu_compiler_arguments()
 
-        self._cpp_obj = cpp_cls(self._simulation.state._cpp_sys_def,
-                                self._simulation.device._cpp_exec_conf,
-                                cpu_code, cpu_include_options, self.param_array)
+        if isinstance(device, hoomd.device.GPU):
+            gpu_settings = _compile.get_gpu_compilation_settings(device)
+            gpu_code = self._wrap_gpu_code(self.code)
+            cpp_cls = getattr(_jit,
+                              cpp_cls.__name__.replace('JIT', 'JITGPU', 1))
+
+            self._cpp_obj = cpp_cls(
+                self._simulation.state._cpp_sys_def,
+                device._cpp_exec_conf,
+                cpu_code,
+                cpu_include_options,
+                self.param_array,
+                gpu_code,
+                "hpmc::gpu::kernel::hpmc_external_field",
+                gpu_settings["includes"],
+                gpu_settings["cuda_devrt_lib_path"],
+                gpu_settings["max_arch"],
+            )
+        else:
+            self._cpp_obj = cpp_cls(self._simulation.state._cpp_sys_def,
+                                    device._cpp_exec_conf, cpu_code,
+                                    cpu_include_options, self.param_array)
         super()._attach_hook()
 
     @log(requires_run=True)
@@ -254,7 +254,10 @@ Note:
 Set `HPMCIntegrator.depletant_fugacity` to activate the implicit depletant code
 path. This inerts depletant particles during every trial move and modifies the
 acceptance criterion accordingly. See `Glaser 2015
-<https://dx.doi.org/10.1063/1.4935175>`_ for details.
+<https://dx.doi.org/10.1063/1.4935175>`_ for details. Only the depletants in
+the symmetric difference of the excluded volumes of the moved particle before
+and after the trial move contribute to the acceptance criterion, the others are
+discarded before testing them against the neighboring particles.
 
 .. deprecated:: 4.4.0
 
@@ -313,12 +316,23 @@ class HPMCIntegrator(Integrator):
 
     .. rubric:: Threading
 
-    HPMC integrators use threaded execution on multiple CPU cores only when
-    placing implicit depletants (``depletant_fugacity != 0``).
+    When ``num_cpu_threads > 1``, HPMC integrators on the CPU split the local
+    box into a checkerboard of cells wider than twice the interaction range
+    plus the largest move size. Each sweep shifts the cells randomly and moves
+    the particles in cells of the same color concurrently. Trial moves that
+    would leave a cell are skipped. The results do not depend on the number of
+    threads, but differ from the serial sweep that ``num_cpu_threads = 1``
+    performs. HPMC falls back to the serial sweep when the box is too small to
+    hold two cells along each direction or when the integrator has implicit
+    depletants or an external potential.
+
+    HPMC integrators also use threaded execution when placing implicit
+    depletants (``depletant_fugacity != 0``).
 
     .. deprecated:: 4.4.0
 
-        ``num_cpu_threads >= 1`` is deprecated. Set ``num_cpu_threads = 1``.
+        ``num_cpu_threads >= 1`` with implicit depletants is deprecated. Set
+        ``num_cpu_threads = 1``.
 
     .. rubric:: Mixed precision
 
@@ -1194,6 +1208,9 @@ class ConvexPolyhedron(HPMCIntegrator):
             translation moves.
         nselect (int): Number of trial moves to perform per particle per
             timestep.
+        cache_separating_axes (bool): Set to `True` to seed each overlap check
+            with the separating axis found in the previous check of the same
+            pair.
 
     Perform hard particle Monte Carlo of convex polyhedra. The shape :math:`S`
     of a convex polyhedron includes the points inside and on the surface of the
@@ -1219,6 +1236,16 @@ class ConvexPolyhedron(HPMCIntegrator):
         print('vertices = ', mc.shape["A"]["vertices"])
 
     Attributes:
+        cache_separating_axes (bool): When `True`, remember the direction
+            that separated each pair of particles in its last overlap check and
+            test that direction first in the next check of the same pair. With
+            small moves in dense systems, the direction usually still separates
+            the pair and the check finishes after a single support function
+            evaluation. The cache holds 8 entries per particle and a new entry
+            replaces any entry that maps to the same slot. It applies only to
+            serial sweeps on the CPU and does not change the result of any
+            overlap check.
+
         shape (`TypeParameter` [``particle type``, `dict`]):
             The shape parameters for each particle type. The dictionary has the
             following keys.
@@ -1248,12 +1275,16 @@ class ConvexPolyhedron(HPMCIntegrator):
                  default_d=0.1,
                  default_a=0.1,
                  translation_move_probability=0.5,
-                 nselect=4):
+                 nselect=4,
+                 cache_separating_axes=False):
 
         # initialize base class
         super().__init__(default_d, default_a, translation_move_probability,
                          nselect)
 
+        self._param_dict.update(
+            ParameterDict(cache_separating_axes=bool(cache_separating_axes)))
+
         typeparam_shape = TypeParameter('shape',
                                         type_kind='particle_types',
                                         param_dict=TypeParameterDict(
@@ -1485,6 +1516,9 @@ class ConvexSpheropolyhedron(HPMCIntegrator):
             translation moves.
         nselect (int): Number of trial moves to perform per particle per
             timestep.
+        cache_separating_axes (bool): Set to `True` to seed each overlap check
+            with the separating axis found in the previous check of the same
+            pair.
 
     Perform hard particle Monte Carlo of convex spheropolyhedra. The shape
     :math:`S` of a convex spheropolyhedron includes the points inside and on the
@@ -1525,6 +1559,16 @@ class ConvexSpheropolyhedron(HPMCIntegrator):
         mc.depletant_fugacity["SphericalDepletant"] = 3.0
 
     Attributes:
+        cache_separating_axes (bool): When `True`, remember the direction
+            that separated each pair of particles in its last overlap check and
+            test that direction first in the next check of the same pair. With
+            small moves in dense systems, the direction usually still separates
+            the pair and the check finishes after a single support function
+            evaluation. The cache holds 8 entries per particle and a new entry
+            replaces any entry that maps to the same slot. It applies only to
+            serial sweeps on the CPU and does not change the result of any
+            overlap check.
+
         shape (`TypeParameter` [``particle type``, `dict`]):
             The shape parameters for each particle type. The dictionary has the
             following keys:
@@ -1555,12 +1599,16 @@ class ConvexSpheropolyhedron(HPMCIntegrator):
                  default_d=0.1,
                  default_a=0.1,
                  translation_move_probability=0.5,
-                 nselect=4):
+                 nselect=4,
+                 cache_separating_axes=False):
 
         # initialize base class
         super().__init__(default_d, default_a, translation_move_probability,
                          nselect)
 
+        self._param_dict.update(
+            ParameterDict(cache_separating_axes=bool(cache_separating_axes)))
+
         typeparam_shape = TypeParameter('shape',
                                         type_kind='particle_types',
                                         param_dict=TypeParameterDict(
@@ -20,6 +20,7 @@
 #include <string>
 
 #ifdef ENABLE_HIP
+#include "ExternalFieldJITGPU.h"
 #include "PatchEnergyJITGPU.h"
 #include "PatchEnergyJITUnionGPU.h"
 #endif
@@ -53,5 +54,16 @@ PYBIND11_MODULE(_jit, m)
 #if defined(ENABLE_HIP) && defined(__HIP_PLATFORM_NVCC__)
     export_PatchEnergyJITGPU(m);
     export_PatchEnergyJITUnionGPU(m);
+
+    export_ExternalFieldJITGPU<ShapeSphere>(m, "ExternalFieldJITGPUSphere");
+    export_ExternalFieldJITGPU<ShapeConvexPolygon>(m, "ExternalFieldJITGPUConvexPolygon");
+    export_ExternalFieldJITGPU<ShapePolyhedron>(m, "ExternalFieldJITGPUPolyhedron");
+    export_ExternalFieldJITGPU<ShapeConvexPolyhedron>(m, "ExternalFieldJITGPUConvexPolyhedron");
+    export_ExternalFieldJITGPU<ShapeSpheropolyhedron>(m, "ExternalFieldJITGPUSpheropolyhedron");
+    export_ExternalFieldJITGPU<ShapeSpheropolygon>(m, "ExternalFieldJITGPUSpheropolygon");
+    export_ExternalFieldJITGPU<ShapeSimplePolygon>(m, "ExternalFieldJITGPUSimplePolygon");
+    export_ExternalFieldJITGPU<ShapeEllipsoid>(m, "ExternalFieldJITGPUEllipsoid");
+    export_ExternalFieldJITGPU<ShapeFacetedEllipsoid>(m, "ExternalFieldJITGPUFacetedEllipsoid");
+    export_ExternalFieldJITGPU<ShapeSphinx>(m, "ExternalFieldJITGPUSphinx");
 #endif
     }
@@ -19,8 +19,10 @@
 
 #ifdef ENABLE_HIP
 #include "ComputeFreeVolumeGPU.h"
+#include "ComputeSDFGPU.h"
 #include "IntegratorHPMCMonoGPU.h"
 #include "UpdaterClustersGPU.h"
+#include "UpdaterMuVTGPU.h"
 #endif
 
 namespace hoomd
@@ -45,7 +47,9 @@ void export_convex_polygon(pybind11::module& m)
 #ifdef ENABLE_HIP
     export_IntegratorHPMCMonoGPU<ShapeConvexPolygon>(m, "IntegratorHPMCMonoConvexPolygonGPU");
     export_ComputeFreeVolumeGPU<ShapeConvexPolygon>(m, "ComputeFreeVolumeConvexPolygonGPU");
+    export_ComputeSDFGPU<ShapeConvexPolygon>(m, "ComputeSDFConvexPolygonGPU");
     export_UpdaterClustersGPU<ShapeConvexPolygon>(m, "UpdaterClustersConvexPolygonGPU");
+    export_UpdaterMuVTGPU<ShapeConvexPolygon>(m, "UpdaterMuVTConvexPolygonGPU");
 #endif
     }
 
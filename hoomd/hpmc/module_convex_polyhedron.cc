@@ -24,8 +24,11 @@
 
 #ifdef ENABLE_HIP
 #include "ComputeFreeVolumeGPU.h"
+#include "ComputeSDFGPU.h"
 #include "IntegratorHPMCMonoGPU.h"
+#include "IntegratorHPMCMonoNECGPU.h"
 #include "UpdaterClustersGPU.h"
+#include "UpdaterMuVTGPU.h"
 #endif
 
 namespace hoomd
@@ -60,8 +63,13 @@ void export_convex_polyhedron(pybind11::module& m)
 #ifdef ENABLE_HIP
 
     export_IntegratorHPMCMonoGPU<ShapeConvexPolyhedron>(m, "IntegratorHPMCMonoConvexPolyhedronGPU");
+    export_IntegratorHPMCMonoNECGPU<ShapeConvexPolyhedron>(
+        m,
+        "IntegratorHPMCMonoNECConvexPolyhedronGPU");
     export_ComputeFreeVolumeGPU<ShapeConvexPolyhedron>(m, "ComputeFreeVolumeConvexPolyhedronGPU");
+    export_ComputeSDFGPU<ShapeConvexPolyhedron>(m, "ComputeSDFConvexPolyhedronGPU");
     export_UpdaterClustersGPU<ShapeConvexPolyhedron>(m, "UpdaterClustersConvexPolyhedronGPU");
+    export_UpdaterMuVTGPU<ShapeConvexPolyhedron>(m, "UpdaterMuVTConvexPolyhedronGPU");
 
 #endif
     }
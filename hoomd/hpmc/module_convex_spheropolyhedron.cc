@@ -22,8 +22,10 @@
 
 #ifdef ENABLE_HIP
 #include "ComputeFreeVolumeGPU.h"
+#include "ComputeSDFGPU.h"
 #include "IntegratorHPMCMonoGPU.h"
 #include "UpdaterClustersGPU.h"
+#include "UpdaterMuVTGPU.h"
 #endif
 
 namespace hoomd
@@ -55,7 +57,9 @@ void export_convex_spheropolyhedron(pybind11::module& m)
 
     export_IntegratorHPMCMonoGPU<ShapeSpheropolyhedron>(m, "IntegratorHPMCMonoSpheropolyhedronGPU");
     export_ComputeFreeVolumeGPU<ShapeSpheropolyhedron>(m, "ComputeFreeVolumeSpheropolyhedronGPU");
+    export_ComputeSDFGPU<ShapeSpheropolyhedron>(m, "ComputeSDFConvexSpheropolyhedronGPU");
     export_UpdaterClustersGPU<ShapeSpheropolyhedron>(m, "UpdaterClustersConvexSpheropolyhedronGPU");
+    export_UpdaterMuVTGPU<ShapeSpheropolyhedron>(m, "UpdaterMuVTConvexSpheropolyhedronGPU");
 
 #endif
     }
@@ -22,8 +22,10 @@
 
 #ifdef ENABLE_HIP
 #include "ComputeFreeVolumeGPU.h"
+#include "ComputeSDFGPU.h"
 #include "IntegratorHPMCMonoGPU.h"
 #include "UpdaterClustersGPU.h"
+#include "UpdaterMuVTGPU.h"
 #endif
 
 namespace hoomd
@@ -55,7 +57,9 @@ void export_ellipsoid(pybind11::module& m)
 #ifdef ENABLE_HIP
     export_IntegratorHPMCMonoGPU<ShapeEllipsoid>(m, "IntegratorHPMCMonoEllipsoidGPU");
     export_ComputeFreeVolumeGPU<ShapeEllipsoid>(m, "ComputeFreeVolumeEllipsoidGPU");
+    export_ComputeSDFGPU<ShapeEllipsoid>(m, "ComputeSDFEllipsoidGPU");
     export_UpdaterClustersGPU<ShapeEllipsoid>(m, "UpdaterClustersEllipsoidGPU");
+    export_UpdaterMuVTGPU<ShapeEllipsoid>(m, "UpdaterMuVTEllipsoidGPU");
 #endif
     }
 
@@ -18,8 +18,10 @@
 
 #ifdef ENABLE_HIP
 #include "ComputeFreeVolumeGPU.h"
+#include "ComputeSDFGPU.h"
 #include "IntegratorHPMCMonoGPU.h"
 #include "UpdaterClustersGPU.h"
+#include "UpdaterMuVTGPU.h"
 #endif
 
 namespace hoomd
@@ -44,7 +46,9 @@ void export_faceted_ellipsoid(pybind11::module& m)
 #ifdef ENABLE_HIP
     export_IntegratorHPMCMonoGPU<ShapeFacetedEllipsoid>(m, "IntegratorHPMCMonoFacetedEllipsoidGPU");
     export_ComputeFreeVolumeGPU<ShapeFacetedEllipsoid>(m, "ComputeFreeVolumeFacetedEllipsoidGPU");
+    export_ComputeSDFGPU<ShapeFacetedEllipsoid>(m, "ComputeSDFFacetedEllipsoidGPU");
     export_UpdaterClustersGPU<ShapeFacetedEllipsoid>(m, "UpdaterClustersFacetedEllipsoidGPU");
+    export_UpdaterMuVTGPU<ShapeFacetedEllipsoid>(m, "UpdaterMuVTFacetedEllipsoidGPU");
 #endif
     }
 
@@ -20,8 +20,11 @@
 
 #ifdef ENABLE_HIP
 #include "ComputeFreeVolumeGPU.h"
+#include "ComputeSDFGPU.h"
 #include "IntegratorHPMCMonoGPU.h"
+#include "IntegratorHPMCMonoNECGPU.h"
 #include "UpdaterClustersGPU.h"
+#include "UpdaterMuVTGPU.h"
 #endif
 
 namespace hoomd
@@ -46,8 +49,11 @@ void export_sphere(pybind11::module& m)
 
 #ifdef ENABLE_HIP
     export_IntegratorHPMCMonoGPU<ShapeSphere>(m, "IntegratorHPMCMonoSphereGPU");
+    export_IntegratorHPMCMonoNECGPU<ShapeSphere>(m, "IntegratorHPMCMonoNECSphereGPU");
     export_ComputeFreeVolumeGPU<ShapeSphere>(m, "ComputeFreeVolumeSphereGPU");
+    export_ComputeSDFGPU<ShapeSphere>(m, "ComputeSDFSphereGPU");
     export_UpdaterClustersGPU<ShapeSphere>(m, "UpdaterClustersSphereGPU");
+    export_UpdaterMuVTGPU<ShapeSphere>(m, "UpdaterMuVTSphereGPU");
 #endif
     }
 
@@ -19,8 +19,10 @@
 
 #ifdef ENABLE_HIP
 #include "ComputeFreeVolumeGPU.h"
+#include "ComputeSDFGPU.h"
 #include "IntegratorHPMCMonoGPU.h"
 #include "UpdaterClustersGPU.h"
+#include "UpdaterMuVTGPU.h"
 #endif
 
 namespace hoomd
@@ -45,7 +47,9 @@ void export_spheropolygon(pybind11::module& m)
 #ifdef ENABLE_HIP
     export_IntegratorHPMCMonoGPU<ShapeSpheropolygon>(m, "IntegratorHPMCMonoSpheropolygonGPU");
     export_ComputeFreeVolumeGPU<ShapeSpheropolygon>(m, "ComputeFreeVolumeSpheropolygonGPU");
+    export_ComputeSDFGPU<ShapeSpheropolygon>(m, "ComputeSDFConvexSpheropolygonGPU");
     export_UpdaterClustersGPU<ShapeSpheropolygon>(m, "UpdaterClustersConvexSpheropolygonGPU");
+    export_UpdaterMuVTGPU<ShapeSpheropolygon>(m, "UpdaterMuVTConvexSpheropolygonGPU");
 #endif
     }
 
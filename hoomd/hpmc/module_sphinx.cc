@@ -21,6 +21,7 @@
 #include "ComputeFreeVolumeGPU.h"
 #include "IntegratorHPMCMonoGPU.h"
 #include "UpdaterClustersGPU.h"
+#include "UpdaterMuVTGPU.h"
 #endif
 
 namespace hoomd
@@ -48,6 +49,7 @@ void export_sphinx(pybind11::module& m)
     export_IntegratorHPMCMonoGPU<ShapeSphinx>(m, "IntegratorHPMCMonoSphinxGPU");
     export_ComputeFreeVolumeGPU<ShapeSphinx>(m, "ComputeFreeVolumeSphinxGPU");
     export_UpdaterClustersGPU<ShapeSphinx>(m, "UpdaterClustersSphinxGPU");
+    export_UpdaterMuVTGPU<ShapeSphinx>(m, "UpdaterMuVTSphinxGPU");
 
 #endif
 #endif
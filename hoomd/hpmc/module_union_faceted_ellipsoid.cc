@@ -21,6 +21,7 @@
 #include "ComputeFreeVolumeGPU.h"
 #include "IntegratorHPMCMonoGPU.h"
 #include "UpdaterClustersGPU.h"
+#include "UpdaterMuVTGPU.h"
 #endif
 
 namespace hoomd
@@ -63,6 +64,9 @@ void export_union_faceted_ellipsoid(pybind11::module& m)
     export_UpdaterClustersGPU<ShapeUnion<ShapeFacetedEllipsoid>>(
         m,
         "UpdaterClustersFacetedEllipsoidUnionGPU");
+    export_UpdaterMuVTGPU<ShapeUnion<ShapeFacetedEllipsoid>>(
+        m,
+        "UpdaterMuVTFacetedEllipsoidUnionGPU");
 
 #endif
     }
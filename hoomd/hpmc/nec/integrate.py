@@ -152,8 +152,11 @@ class Sphere(HPMCNECIntegrator):
 
     `Sphere` does not support ``pair_potential`` or ``external_potential``.
 
-    Attention:
-        `Sphere` does not support execution on GPUs.
+    Note:
+        On GPUs, `Sphere` runs chains in parallel in a checkerboard of cells
+        that are at least as wide as the largest particle. A chain ends when
+        its particle reaches the boundary of its cell or collides with a
+        particle in another cell, so the chains are shorter than on the CPU.
 
     Attention:
         `Sphere` does not support MPI parallel simulations.
@@ -246,8 +249,12 @@ class ConvexPolyhedron(HPMCNECIntegrator):
     `ConvexPolyhedron` does not support ``pair_potential`` or
     ``external_potential``.
 
-    Attention:
-        `ConvexPolyhedron` does not support execution on GPUs.
+    Note:
+        On GPUs, `ConvexPolyhedron` runs chains in parallel in a checkerboard
+        of cells that are at least as wide as the largest particle. A chain
+        ends when its particle reaches the boundary of its cell or collides
+        with a particle in another cell, so the chains are shorter than on the
+        CPU.
 
     Attention:
         `ConvexPolyhedron` does not support MPI parallel simulations.
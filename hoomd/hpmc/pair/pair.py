@@ -50,11 +50,6 @@ class Pair(hoomd.operation._HOOMDBaseObject):
         if not integrator._attached:
             raise RuntimeError("Integrator is not attached yet.")
 
-        device = self._simulation.device
-
-        if isinstance(device, hoomd.device.GPU):
-            raise RuntimeError("Not implemented on the GPU")
-
         self._cpp_obj = self._make_cpp_obj()
 
         super()._attach_hook()
@@ -81,6 +81,14 @@ class CPPPotentialBase(AutotunedObject):
     Note:
         Your code *must* return a value.
 
+    .. rubric:: Compilation cache
+
+    The root MPI rank compiles the CPU code and broadcasts the result to the
+    other ranks. Set the environment variable ``HOOMD_JIT_CACHE_DIR`` to a
+    directory to store the compiled code on disk and reuse it in later jobs
+    that compile the same code with the same compiler arguments, HOOMD-blue
+    version, and LLVM version.
+
     .. rubric:: Mixed precision
 
     `CPPPotentialBase` uses 32-bit precision floating point arithmetic when
@@ -290,6 +290,49 @@ def test_counters(box_move, simulation_factory, lattice_snapshot_factory,
             assert ctr[0] + ctr[1] == 10
 
 
+def test_overlap_hints_one_rank(simulation_factory, device):
+    """Test box resizes when only one rank holds an overlapping pair."""
+    if device.communicator.num_ranks != 2:
+        pytest.skip("Test supports only 2 ranks")
+
+    # place a pair that blocks compressions along x on the rank with x > 0 and
+    # a sparse lattice elsewhere, so only that rank records the blocking pair
+    snap = hoomd.Snapshot(device.communicator)
+    if snap.communicator.rank == 0:
+        x, y, z = np.meshgrid(np.arange(-9, 10, 2),
+                              np.arange(-4, 5, 2),
+                              np.arange(-4, 5, 2),
+                              indexing='ij')
+        lattice = np.column_stack((x.ravel(), y.ravel(), z.ravel()))
+        pair = np.array([[4.0, 1.0, 1.0], [5.0005, 1.0, 1.0]])
+        position = np.concatenate((lattice, pair))
+        snap.configuration.box = [20, 10, 10, 0, 0, 0]
+        snap.particles.N = len(position)
+        snap.particles.types = ['A']
+        snap.particles.position[:] = position
+
+    sim = simulation_factory(snap, domain_decomposition=(2, 1, 1))
+    initial_box = sim.state.box
+
+    # trials that shrink Lx are blocked by the pair, while trials that only
+    # shrink Ly or Lz are not, so the ranks disagree about their hints
+    boxmc = hoomd.hpmc.update.BoxMC(betaP=100, trigger=1)
+    boxmc.length = dict(weight=1, delta=[0.5] * 3)
+    sim.operations.updaters.append(boxmc)
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0)
+    mc.shape['A'] = dict(diameter=1)
+    sim.operations.integrator = mc
+
+    sim.run(50)
+
+    assert mc.overlaps == 0
+    accepted, rejected = boxmc.volume_moves
+    assert accepted > 0
+    assert rejected > 0
+    assert sim.state.box.Lx >= initial_box.Lx / 1.0005
+    assert sim.state.box != initial_box
+
+
 @pytest.mark.parametrize("box_move", box_moves_attrs)
 def test_pickling(box_move, simulation_factory, two_particle_snapshot_factory):
     boxmc = hoomd.hpmc.update.BoxMC(betaP=3, trigger=1)
@@ -159,6 +159,39 @@ def test_pivot_moves(device, simulation_factory, lattice_snapshot_factory):
     assert avg > 0
 
 
+def test_pivot_moves_domain_decomposition(device, simulation_factory,
+                                          lattice_snapshot_factory):
+    """Test that Clusters moves particles without overlaps on all ranks."""
+    if (isinstance(device, hoomd.device.GPU)
+            and hoomd.version.gpu_platform == 'ROCm'):
+        pytest.xfail("Clusters fails on ROCm (#1605)")
+
+    sim = simulation_factory(
+        lattice_snapshot_factory(particle_types=['A'],
+                                 dimensions=3,
+                                 a=1.3,
+                                 n=10,
+                                 r=0.1))
+
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0.1, default_a=0.1)
+    mc.shape['A'] = dict(diameter=1.0)
+    sim.operations.integrator = mc
+
+    cl = hoomd.hpmc.update.Clusters(trigger=hoomd.trigger.Periodic(1),
+                                    pivot_move_probability=1.0,
+                                    flip_probability=0.5)
+    sim.operations.updaters.append(cl)
+
+    sim.run(10)
+
+    assert cl.avg_cluster_size > 1
+    assert mc.overlaps == 0
+
+    snapshot = sim.state.get_snapshot()
+    if snapshot.communicator.rank == 0:
+        assert snapshot.particles.N == 1000
+
+
 def test_pickling(simulation_factory, two_particle_snapshot_factory):
     """Test that Cluster objects are picklable."""
     sim = simulation_factory(two_particle_snapshot_factory())
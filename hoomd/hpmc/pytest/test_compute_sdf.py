@@ -241,8 +241,29 @@ def test_values(simulation_factory, lattice_snapshot_factory):
         assert numpy.sum(invalid) == 0
 
 
+def test_binary_search_path(simulation_factory, two_particle_snapshot_factory):
+    """Test that the hard overlap is found in the expected bin.
+
+    This runs on both devices to check that the GPU histogram matches the CPU
+    binary search.
+    """
+    sim = simulation_factory(two_particle_snapshot_factory(d=1.001101081081081))
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0.0)
+    mc.shape['A'] = {'diameter': 1.0}
+    sim.operations.add(mc)
+
+    sdf = hoomd.hpmc.compute.SDF(xmax=0.02, dx=1e-3)
+    sim.operations.add(sdf)
+
+    sim.run(0)
+    sdf_result = sdf.sdf_compression
+    if sim.device.communicator.rank == 0:
+        assert sdf_result[1] == 1 / sdf.dx
+        assert numpy.count_nonzero(sdf_result) == 1
+
+
 @pytest.mark.skipif(llvm_disabled, reason='LLVM not enabled')
-@pytest.mark.cpu  # SDF runs on the CPU only, no need to test on the GPU
+@pytest.mark.cpu  # the linear search with patches always runs on the CPU
 def test_linear_search_path(simulation_factory, two_particle_snapshot_factory):
     """Test that adding patches changes the pressure calculation.
 
@@ -155,3 +155,37 @@ def test_harmonic_displacement(simulation_factory,
         new_positions = snapshot.particles.position
         dx = np.linalg.norm(new_positions - lattice.reference_positions, axis=1)
         assert np.all(np.less(dx, particle_diameter / 2))
+
+
+@pytest.mark.cpu
+def test_harmonic_energy_tracks_moves(simulation_factory,
+                                      two_particle_snapshot_factory,
+                                      add_default_integrator):
+    """Ensure the cached energies follow trial moves and external changes."""
+    sim = simulation_factory(two_particle_snapshot_factory())
+    mc, lattice = add_default_integrator(sim)
+    mc.shape['A'] = dict(diameter=0)
+
+    def expected_energy():
+        snapshot = sim.state.get_snapshot()
+        if snapshot.communicator.rank != 0:
+            return None
+        dr = snapshot.particles.position - lattice.reference_positions
+        k_translational = lattice.k_translational(sim.timestep)
+        return 0.5 * k_translational * np.sum(dr * dr)
+
+    sim.run(10)
+    energy = lattice.energy_translational
+    expected = expected_energy()
+    if expected is not None:
+        assert energy == pytest.approx(expected)
+
+    # particles moved outside of the integrator are evaluated again
+    snapshot = sim.state.get_snapshot()
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.position[0] += [0.1, 0, 0]
+    sim.state.set_snapshot(snapshot)
+    energy = lattice.energy_translational
+    expected = expected_energy()
+    if expected is not None:
+        assert energy == pytest.approx(expected)
@@ -54,7 +54,6 @@ def test_valid_construction_cpp_external(device, constructor_args):
         assert getattr(ext, attr) == value
 
 
-@pytest.mark.cpu
 @pytest.mark.skipif(llvm_disabled, reason='LLVM not enabled')
 @pytest.mark.parametrize("constructor_args", valid_constructor_args)
 def test_attaching(device, simulation_factory, two_particle_snapshot_factory,
@@ -180,7 +179,6 @@ def test_change_param_array_values(device, simulation_factory,
         assert ext.energy / N == _n
 
 
-@pytest.mark.cpu
 @pytest.mark.parametrize("orientations,charge, result", electric_field_params)
 @pytest.mark.skipif(llvm_disabled, reason='LLVM not enabled')
 def test_electric_field(device, orientations, charge, result,
@@ -220,7 +218,6 @@ def test_electric_field(device, orientations, charge, result,
     assert np.isclose(energy, result)
 
 
-@pytest.mark.cpu
 @pytest.mark.validate
 @pytest.mark.skipif(llvm_disabled, reason='LLVM not enabled')
 def test_z_bias(device, simulation_factory, lattice_snapshot_factory):
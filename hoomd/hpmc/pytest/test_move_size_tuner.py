@@ -7,6 +7,7 @@ import pytest
 from hoomd import hpmc
 from hoomd.conftest import operation_pickling_check
 from hoomd.hpmc.tune.move_size import (_MoveSizeTuneDefinition, MoveSize)
+from hoomd.hpmc.tune.move_size_msd import _MSDTuneDefinition, MoveSizeMSD
 
 
 @pytest.fixture
@@ -202,3 +203,45 @@ class TestMoveSize:
 
     def test_pickling(self, move_size_tuner, simulation):
         operation_pickling_check(move_size_tuner, simulation)
+
+
+class TestMoveSizeMSD:
+
+    def test_getting_rate(self, move_definition_dict, simulation):
+        integrator = simulation.operations.integrator
+        definition = _MSDTuneDefinition(**move_definition_dict)
+        definition.integrator = integrator
+        simulation.run(0)
+        # needed to set the previous values to calculate the rate
+        assert definition.y is None
+
+        accepted = integrator._cpp_obj.getCounters(0).translate[0]
+        walltime = integrator._cpp_obj.getUpdateWalltime()
+        simulation.run(10)
+        delta_accepted = (integrator._cpp_obj.getCounters(0).translate[0]
+                          - accepted)
+        delta_walltime = integrator._cpp_obj.getUpdateWalltime() - walltime
+        assert delta_walltime > 0
+        rate = delta_accepted * integrator.d['A']**2 / delta_walltime
+        assert isclose(definition.y, rate)
+        # The value does not change when the step does not.
+        assert isclose(definition.y, rate)
+
+    def test_act(self, simulation):
+        move_size_tuner = MoveSizeMSD.grid_optimizer(trigger=100,
+                                                     moves=['d'],
+                                                     max_translation_move=0.5,
+                                                     n_bins=3,
+                                                     n_rounds=2)
+        simulation.operations.tuners.append(move_size_tuner)
+        # the grid optimizer needs 9 tuner calls to finish
+        simulation.run(2000)
+        assert move_size_tuner.tuned
+        d = simulation.operations.integrator.d['A']
+        assert 0 < d <= 0.5
+
+    def test_pickling(self, simulation):
+        move_size_tuner = MoveSizeMSD.grid_optimizer(trigger=100,
+                                                     moves=['d'],
+                                                     max_translation_move=0.5)
+        operation_pickling_check(move_size_tuner, simulation)
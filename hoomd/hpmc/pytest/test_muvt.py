@@ -18,6 +18,9 @@ valid_constructor_args = [
         volume_move_probability=0.5,
     ),
     dict(trigger=hoomd.trigger.After(100), transfer_types=["A", "B"]),
+    dict(trigger=hoomd.trigger.Periodic(10),
+         transfer_types=["A"],
+         transfer_trials=5),
 ]
 
 valid_attrs = [
@@ -29,6 +32,7 @@ valid_attrs = [
     ("transfer_types", ["A"]),
     ("transfer_types", ["B"]),
     ("transfer_types", ["A", "B"]),
+    ("transfer_trials", 10),
 ]
 
 
@@ -172,6 +176,36 @@ def test_insertion_removal(device, simulation_factory,
     assert muvt.N["B"] > 0
 
 
+def test_transfer_trials(device, simulation_factory, lattice_snapshot_factory):
+    """Test that MuVT performs transfer_trials trials per timestep."""
+    sim = simulation_factory(
+        lattice_snapshot_factory(particle_types=["A", "B"],
+                                 dimensions=3,
+                                 a=4,
+                                 n=7,
+                                 r=0.1))
+
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0.1, default_a=0.1)
+    mc.shape["A"] = dict(diameter=1.1)
+    mc.shape["B"] = dict(diameter=1.3)
+    sim.operations.integrator = mc
+
+    muvt = hoomd.hpmc.update.MuVT(trigger=hoomd.trigger.Periodic(1),
+                                  transfer_types=["B"],
+                                  transfer_trials=20)
+    muvt.fugacity["B"] = 1
+    sim.operations.updaters.append(muvt)
+
+    sim.run(10)
+    assert sum(muvt.insert_moves) + sum(muvt.remove_moves) == 10 * 20
+
+    # every accepted insertion adds a particle, every removal takes one away
+    assert muvt.N["B"] == muvt.insert_moves[0] - muvt.remove_moves[0]
+
+    # the inserted particles do not overlap
+    assert mc.overlaps == 0
+
+
 @pytest.mark.cpu
 @pytest.mark.skipif(not hoomd.version.llvm_enabled, reason="LLVM not enabled")
 def test_jit_remove_insert(device, simulation_factory,
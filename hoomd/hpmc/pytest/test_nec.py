@@ -0,0 +1,65 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Test hoomd.hpmc.nec integrators."""
+
+import hoomd
+import hoomd.hpmc.nec
+import numpy
+import pytest
+
+
+@pytest.mark.serial
+@pytest.mark.parametrize("dimensions", [2, 3])
+def test_sphere_chains(simulation_factory, lattice_snapshot_factory,
+                       dimensions):
+    """Check that sphere chains move particles without creating overlaps."""
+    snap = lattice_snapshot_factory(dimensions=dimensions, a=1.5, n=8)
+    if snap.communicator.rank == 0:
+        rng = numpy.random.default_rng(42)
+        velocity = rng.normal(size=(snap.particles.N, 3))
+        if dimensions == 2:
+            velocity[:, 2] = 0
+        snap.particles.velocity[:] = velocity
+
+    sim = simulation_factory(snap)
+    mc = hoomd.hpmc.nec.integrate.Sphere(default_d=0.3,
+                                         chain_time=2.0,
+                                         update_fraction=0.5)
+    mc.shape['A'] = dict(diameter=1.0)
+    sim.operations.integrator = mc
+
+    sim.run(10)
+
+    assert mc.overlaps == 0
+    assert sum(mc.translate_moves) > 0
+    assert mc.particles_per_chain > 0
+
+    initial = numpy.array([p for p in snap.particles.position])
+    final = sim.state.get_snapshot().particles.position
+    assert numpy.any(final != initial)
+
+
+@pytest.mark.serial
+def test_convex_polyhedron_chains(simulation_factory, lattice_snapshot_factory):
+    """Check that convex polyhedron chains and rotations avoid overlaps."""
+    snap = lattice_snapshot_factory(a=1.5, n=8)
+    if snap.communicator.rank == 0:
+        rng = numpy.random.default_rng(42)
+        snap.particles.velocity[:] = rng.normal(size=(snap.particles.N, 3))
+
+    sim = simulation_factory(snap)
+    mc = hoomd.hpmc.nec.integrate.ConvexPolyhedron(default_d=0.3,
+                                                   default_a=0.1,
+                                                   chain_probability=0.5,
+                                                   chain_time=2.0,
+                                                   update_fraction=0.5)
+    mc.shape['A'] = dict(vertices=[(0.5, 0.5, 0.5), (0.5, -0.5, -0.5),
+                                   (-0.5, 0.5, -0.5), (-0.5, -0.5, 0.5)])
+    sim.operations.integrator = mc
+
+    sim.run(10)
+
+    assert mc.overlaps == 0
+    assert sum(mc.translate_moves) > 0
+    assert sum(mc.rotate_moves) > 0
@@ -160,6 +160,36 @@ def test_energy(mc_simulation_factory, params, d, expected_energy):
     assert step.energy == pytest.approx(expected=expected_energy, rel=1e-5)
 
 
+@pytest.mark.parametrize('wrapper', [None, 'AngularStep', 'Union'])
+def test_hard_core(simulation_factory, lattice_snapshot_factory, wrapper):
+    """Test that trial moves never enter a large repulsive step.
+
+    Point particles with the step behave as hard spheres, so the energy remains
+    zero. This evaluates the pair potential during trial moves on all devices.
+    """
+    step = hoomd.hpmc.pair.Step()
+    step.params[('A', 'A')] = dict(epsilon=[10000], r=[1.5])
+
+    pair = step
+    if wrapper == 'AngularStep':
+        pair = hoomd.hpmc.pair.AngularStep(isotropic_potential=step)
+        pair.mask['A'] = dict(directors=[(1, 0, 0)], deltas=[3.14159])
+    elif wrapper == 'Union':
+        pair = hoomd.hpmc.pair.Union(constituent_potential=step)
+        pair.body['A'] = dict(types=['A'], positions=[(0, 0, 0)])
+
+    simulation = simulation_factory(lattice_snapshot_factory(a=1.6, n=4))
+    sphere = hoomd.hpmc.integrate.Sphere(default_d=0.1)
+    sphere.shape['A'] = dict(diameter=0)
+    sphere.pair_potentials = [pair]
+    simulation.operations.integrator = sphere
+
+    simulation.run(100)
+
+    assert sphere.translate_moves[0] > 0
+    assert pair.energy == 0
+
+
 def test_logging():
     hoomd.conftest.logging_check(
         hoomd.hpmc.pair.Step, ('hpmc', 'pair'), {
@@ -367,3 +367,63 @@ def test_cpp_potential_sticky_spheres(device, simulation_factory,
             dist = np.linalg.norm(snap.particles.position[0]
                                   - snap.particles.position[1])
             assert dist > max_r_interact
+
+
+@pytest.mark.validate
+@pytest.mark.skipif(llvm_disabled, reason='LLVM not enabled')
+def test_jit_cache(device, simulation_factory, two_particle_snapshot_factory,
+                   tmp_path, monkeypatch):
+    """Test that the on-disk cache reuses compiled code until the code changes.
+
+    The root rank compiles the code and writes each cache miss to a new file
+    that is renamed into place. A cache hit leaves the file untouched.
+    """
+    cache_dir = tmp_path / 'jit_cache'
+    monkeypatch.setenv('HOOMD_JIT_CACHE_DIR', str(cache_dir))
+
+    def attach(code):
+        sim = simulation_factory(two_particle_snapshot_factory(d=1))
+        patch = hoomd.hpmc.pair.user.CPPPotential(r_cut=3,
+                                                  param_array=[],
+                                                  code=code)
+        mc = hoomd.hpmc.integrate.Sphere()
+        mc.shape['A'] = dict(diameter=0)
+        mc.pair_potential = patch
+        sim.operations.integrator = mc
+        sim.run(0)
+        return sim, patch.energy
+
+    def entries():
+        return {
+            path.name: (path.stat().st_ino, path.stat().st_mtime_ns)
+            for path in cache_dir.glob('*.jit')
+        }
+
+    # the first compile misses and stores one entry
+    sim, energy = attach('return -1.0f;')
+    assert energy == -1
+    is_root = sim.device.communicator.rank == 0
+    if is_root:
+        first = entries()
+        assert len(first) == 1
+
+    # compiling the same code again is served from the cache
+    sim, energy = attach('return -1.0f;')
+    assert energy == -1
+    if is_root:
+        assert entries() == first
+
+    # changing the code forces a recompile and stores a second entry
+    sim, energy = attach('return -2.0f;')
+    assert energy == -2
+    if is_root:
+        second = entries()
+        assert len(second) == 2
+        assert all(second[name] == first[name] for name in first)
+
+    # with the cache disabled, nothing is read or written
+    monkeypatch.delenv('HOOMD_JIT_CACHE_DIR')
+    sim, energy = attach('return -3.0f;')
+    assert energy == -3
+    if is_root:
+        assert entries().keys() == second.keys()
@@ -50,6 +50,9 @@ valid_constructor_args = [
              hoomd.Box.from_box([10, 20, 30]), 3000, 10, 100),
          max_overlaps_per_particle=0.2,
          min_scale=0.999),
+    dict(trigger=hoomd.trigger.Periodic(10),
+         target_box=hoomd.Box.from_box([10, 10, 10]),
+         max_bisection_steps=4),
 ]
 
 valid_attrs = [
@@ -75,6 +78,7 @@ valid_attrs = [
     ('min_scale', 0.5),
     ('min_scale', 0.9999),
     ('allow_unsafe_resize', True),
+    ('max_bisection_steps', 8),
 ]
 
 
@@ -201,9 +205,10 @@ def test_sphere_compression_triclinic(xy, xz, yz, phi, simulation_factory,
 
 @pytest.mark.parametrize("phi", [0.2, 0.3, 0.4, 0.5, 0.55, 0.58, 0.6])
 @pytest.mark.parametrize("allow_unsafe_resize", [False, True])
+@pytest.mark.parametrize("max_bisection_steps", [0, 4])
 @pytest.mark.validate
-def test_sphere_compression(phi, allow_unsafe_resize, simulation_factory,
-                            lattice_snapshot_factory):
+def test_sphere_compression(phi, allow_unsafe_resize, max_bisection_steps,
+                            simulation_factory, lattice_snapshot_factory):
     """Test that QuickCompress can compress (and expand) simulation boxes."""
     if allow_unsafe_resize and phi > math.pi / 6:
         pytest.skip("Skipped impossible compression.")
@@ -216,7 +221,8 @@ def test_sphere_compression(phi, allow_unsafe_resize, simulation_factory,
     qc = hoomd.hpmc.update.QuickCompress(
         trigger=hoomd.trigger.Periodic(10),
         target_box=target_box,
-        allow_unsafe_resize=allow_unsafe_resize)
+        allow_unsafe_resize=allow_unsafe_resize,
+        max_bisection_steps=max_bisection_steps)
 
     sim = simulation_factory(snap)
     sim.operations.updaters.append(qc)
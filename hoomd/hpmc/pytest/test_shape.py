@@ -762,3 +762,59 @@ def test_fugacity(simulation_factory, two_particle_snapshot_factory,
     sim = simulation_factory(two_particle_snapshot_factory())
     sim.operations.integrator = mc
     sim.run(2)
+
+
+@pytest.mark.cpu
+@pytest.mark.skipif(not hoomd.version.tbb_enabled, reason="TBB not enabled")
+def test_threaded_sweeps(device, simulation_factory, lattice_snapshot_factory):
+    """Check that checkerboard sweeps are valid and independent of threads."""
+    snap = lattice_snapshot_factory(n=10, a=1.2, dimensions=3)
+    num_cpu_threads = device.num_cpu_threads
+
+    positions = []
+    try:
+        for threads in (2, 4, 4):
+            device.num_cpu_threads = threads
+            sim = simulation_factory(snap)
+            mc = hoomd.hpmc.integrate.Sphere(default_d=0.1)
+            mc.shape['A'] = dict(diameter=1.0)
+            sim.operations.integrator = mc
+            sim.run(20)
+
+            assert mc.overlaps == 0
+            assert mc.translate_moves[0] > 0
+            snapshot = sim.state.get_snapshot()
+            if snapshot.communicator.rank == 0:
+                positions.append(snapshot.particles.position)
+    finally:
+        device.num_cpu_threads = num_cpu_threads
+
+    if len(positions) > 0:
+        np.testing.assert_array_equal(positions[1], positions[0])
+        np.testing.assert_array_equal(positions[2], positions[1])
+
+
+@pytest.mark.parametrize("integrator", [
+    hoomd.hpmc.integrate.ConvexPolyhedron,
+    hoomd.hpmc.integrate.ConvexSpheropolyhedron
+])
+def test_cache_separating_axes(simulation_factory, lattice_snapshot_factory,
+                               integrator):
+    """Check that cached separating axes keep the system free of overlaps."""
+    mc = integrator(default_d=0.05, default_a=0.05, cache_separating_axes=True)
+    mc.shape['A'] = dict(vertices=[(-0.5, -0.5, -0.5), (-0.5, -0.5, 0.5),
+                                   (-0.5, 0.5, -0.5), (-0.5, 0.5, 0.5),
+                                   (0.5, -0.5, -0.5), (0.5, -0.5, 0.5),
+                                   (0.5, 0.5, -0.5), (0.5, 0.5, 0.5)])
+    assert mc.cache_separating_axes
+
+    sim = simulation_factory(lattice_snapshot_factory(n=6, a=1.1))
+    sim.operations.integrator = mc
+    sim.run(20)
+    assert mc.cache_separating_axes
+    assert mc.overlaps == 0
+    assert mc.translate_moves[0] > 0
+
+    mc.cache_separating_axes = False
+    sim.run(5)
+    assert mc.overlaps == 0
@@ -105,3 +105,115 @@ UP_TEST(bigger)
         UP_ASSERT(in(i, hits));
         }
     }
+
+UP_TEST(refit)
+    {
+    const unsigned int N = 1000;
+    hoomd::RandomGenerator rng(hoomd::Seed(0, 1, 2), hoomd::Counter(4, 5, 6));
+
+    std::vector<vec3<Scalar>> points(N);
+    AABB aabbs[N];
+    for (unsigned int i = 0; i < N; i++)
+        {
+        points[i] = vec3<Scalar>(hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng))
+                    * Scalar(1000);
+        aabbs[i] = AABB(points[i], Scalar(1.0));
+        }
+
+    AABBTree tree;
+    tree.buildTree(aabbs, N);
+    UP_ASSERT_EQUAL(tree.getNumParticles(), N);
+    Scalar build_area = tree.getSurfaceArea();
+
+    // move all the points and refit the tree to the new AABBs
+    for (unsigned int i = 0; i < N; i++)
+        {
+        points[i] += vec3<Scalar>(hoomd::detail::generate_canonical<float>(rng),
+                                  hoomd::detail::generate_canonical<float>(rng),
+                                  hoomd::detail::generate_canonical<float>(rng));
+        aabbs[i] = AABB(points[i], Scalar(1.0));
+        }
+    tree.refit(aabbs, N);
+
+    // every particle is still found and small moves barely change the tree quality
+    std::vector<unsigned int> hits;
+    for (unsigned int i = 0; i < N; i++)
+        {
+        hits.clear();
+        tree.query(hits, AABB(points[i], Scalar(0.01)));
+        UP_ASSERT(in(i, hits));
+        }
+    UP_ASSERT(tree.getSurfaceArea() < Scalar(1.1) * build_area);
+
+    // the bounds are tight: a query far from every moved AABB finds nothing
+    hits.clear();
+    tree.query(hits, AABB(vec3<Scalar>(-10, -10, -10), Scalar(1.0)));
+    UP_ASSERT_EQUAL(hits.size(), 0);
+
+    // moving the points to random places degrades the tree
+    for (unsigned int i = 0; i < N; i++)
+        {
+        points[i] = vec3<Scalar>(hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng))
+                    * Scalar(1000);
+        aabbs[i] = AABB(points[i], Scalar(1.0));
+        }
+    tree.refit(aabbs, N);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        hits.clear();
+        tree.query(hits, AABB(points[i], Scalar(0.01)));
+        UP_ASSERT(in(i, hits));
+        }
+    UP_ASSERT(tree.getSurfaceArea() > Scalar(2.0) * build_area);
+    }
+
+#ifdef ENABLE_TBB
+UP_TEST(parallel_build)
+    {
+    const unsigned int N = 20000;
+    hoomd::RandomGenerator rng(hoomd::Seed(0, 1, 2), hoomd::Counter(4, 5, 6));
+
+    std::vector<vec3<Scalar>> points(N);
+    std::vector<AABB> aabbs(N);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        points[i] = vec3<Scalar>(hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng))
+                    * Scalar(1000);
+        aabbs[i] = AABB(points[i], Scalar(1.0));
+        }
+    std::vector<AABB> aabbs_parallel(aabbs);
+
+    AABBTree tree;
+    tree.buildTree(aabbs.data(), N);
+
+    tbb::task_arena arena(4);
+    AABBTree tree_parallel;
+    tree_parallel.buildTree(aabbs_parallel.data(), N, arena);
+
+    // the parallel build produces the same tree
+    UP_ASSERT_EQUAL(tree_parallel.getNumNodes(), tree.getNumNodes());
+    for (unsigned int i = 0; i < tree.getNumNodes(); i++)
+        {
+        UP_ASSERT_EQUAL(tree_parallel.getNodeSkip(i), tree.getNodeSkip(i));
+        UP_ASSERT_EQUAL(tree_parallel.getNodeLeft(i), tree.getNodeLeft(i));
+        UP_ASSERT_EQUAL(tree_parallel.getNodeNumParticles(i), tree.getNodeNumParticles(i));
+        for (unsigned int j = 0; j < tree.getNodeNumParticles(i); j++)
+            UP_ASSERT_EQUAL(tree_parallel.getNodeParticle(i, j), tree.getNodeParticle(i, j));
+        }
+
+    std::vector<unsigned int> hits;
+    for (unsigned int i = 0; i < N; i++)
+        {
+        hits.clear();
+        tree_parallel.query(hits, AABB(points[i], Scalar(0.01)));
+        UP_ASSERT(in(i, hits));
+        UP_ASSERT_EQUAL(tree_parallel.height(i), tree.height(i));
+        }
+    }
+#endif
@@ -84,6 +84,41 @@ UP_TEST(support)
     UP_ASSERT(v1 == v2);
     }
 
+UP_TEST(support_many_verts)
+    {
+    // Compare the support function to a brute force search for vertex counts that are and are not
+    // multiples of the vector width
+    for (unsigned int n_verts = 4; n_verts <= 64; n_verts++)
+        {
+        // points on a Fibonacci sphere with a varying radius
+        vector<vec3<ShortReal>> vlist;
+        for (unsigned int i = 0; i < n_verts; i++)
+            {
+            ShortReal z = ShortReal(1.0) - ShortReal(2 * i + 1) / ShortReal(n_verts);
+            ShortReal r = sqrt(ShortReal(1.0) - z * z);
+            ShortReal phi = ShortReal(2.399963) * ShortReal(i);
+            ShortReal scale = ShortReal(1.0) + ShortReal(0.1) * ShortReal(i % 3);
+            vlist.push_back(scale * vec3<ShortReal>(r * cos(phi), r * sin(phi), z));
+            }
+        PolyhedronVertices verts(vlist, 0, 0);
+        UP_ASSERT_EQUAL(verts.x.size() % PolyhedronVertices::simd_width, 0);
+
+        SupportFuncConvexPolyhedron sa(verts);
+        for (unsigned int k = 0; k < 50; k++)
+            {
+            vec3<ShortReal> n(cos(ShortReal(0.7) * ShortReal(k)),
+                              sin(ShortReal(1.3) * ShortReal(k)),
+                              cos(ShortReal(2.1) * ShortReal(k) + ShortReal(0.5)));
+
+            ShortReal max_dot = dot(n, vlist[0]);
+            for (unsigned int i = 1; i < n_verts; i++)
+                max_dot = std::max(max_dot, dot(n, vlist[i]));
+
+            MY_CHECK_CLOSE(dot(n, sa(n)), max_dot, tol);
+            }
+        }
+    }
+
 UP_TEST(overlap_octahedron_no_rot)
     {
     // first set of simple overlap checks is two octahedra at unit orientation
@@ -603,3 +638,50 @@ UP_TEST(closest_pt_cube_no_rot)
     MY_CHECK_CLOSE(p.y, 0.5, tol);
     MY_CHECK_CLOSE(p.z, 0.5, tol);
     }
+
+UP_TEST(overlap_cached_axis)
+    {
+    // build a cube
+    vector<vec3<ShortReal>> vlist;
+    vlist.push_back(vec3<ShortReal>(-0.5, -0.5, -0.5));
+    vlist.push_back(vec3<ShortReal>(0.5, -0.5, -0.5));
+    vlist.push_back(vec3<ShortReal>(0.5, 0.5, -0.5));
+    vlist.push_back(vec3<ShortReal>(-0.5, 0.5, -0.5));
+    vlist.push_back(vec3<ShortReal>(-0.5, -0.5, 0.5));
+    vlist.push_back(vec3<ShortReal>(0.5, -0.5, 0.5));
+    vlist.push_back(vec3<ShortReal>(0.5, 0.5, 0.5));
+    vlist.push_back(vec3<ShortReal>(-0.5, 0.5, 0.5));
+    PolyhedronVertices verts(vlist, 0, 0);
+
+    quat<Scalar> o_a = quat<Scalar>::fromAxisAngle(vec3<Scalar>(1, 2, 3) / sqrt(Scalar(14)), 0.3);
+    ShapeConvexPolyhedron a(o_a, verts);
+
+    // the cached test agrees with the full test, with and without a cached axis
+    unsigned int n_separated = 0;
+    for (unsigned int k = 0; k < 200; k++)
+        {
+        Scalar t = Scalar(k) / Scalar(200);
+        vec3<Scalar> r_ij(0.6 + 1.2 * t, 0.4 * sin(13 * t), 0.4 * cos(7 * t));
+        quat<Scalar> o_b = quat<Scalar>::fromAxisAngle(vec3<Scalar>(0, 0, 1), 5 * t);
+        ShapeConvexPolyhedron b(o_b, verts);
+
+        vec3<ShortReal> axis;
+        bool overlap = test_overlap(r_ij, a, b, err_count);
+        UP_ASSERT_EQUAL(test_overlap_cached(r_ij, a, b, axis, err_count), overlap);
+        if (overlap)
+            continue;
+
+        // the stored axis separates the pair and still gives the right answer after a small move
+        n_separated++;
+        UP_ASSERT(dot(axis, axis) > ShortReal(0.0));
+        UP_ASSERT(!test_overlap_cached(r_ij, a, b, axis, err_count));
+
+        vec3<Scalar> r_moved = r_ij - vec3<Scalar>(0.05, 0, 0);
+        UP_ASSERT_EQUAL(test_overlap_cached(r_moved, a, b, axis, err_count),
+                        test_overlap(r_moved, a, b, err_count));
+        }
+
+    UP_ASSERT(n_separated > 0);
+    UP_ASSERT(n_separated < 200);
+    UP_ASSERT_EQUAL(err_count, 0);
+    }
@@ -240,3 +240,48 @@ UP_TEST(overlapping_dumbbells)
     UP_ASSERT(test_overlap(r_b - r_a, a, b, err_count));
     UP_ASSERT(test_overlap(r_a - r_b, b, a, err_count));
     }
+
+UP_TEST(tree_refit)
+    {
+    quat<Scalar> o;
+
+    // three spheres of radius 0.25 in a row, one member per leaf
+    ShapeSphere::param_type par;
+    par.radius = ShortReal(0.25);
+    par.ignore = 0;
+
+    ShapeUnion<ShapeSphere>::param_type params_a(3);
+    for (unsigned int i = 0; i < 3; ++i)
+        {
+        params_a.mpos[i] = vec3<Scalar>(-0.5 + 0.5 * i, 0, 0);
+        params_a.morientation[i] = o;
+        params_a.mparams[i] = par;
+        params_a.moverlap[i] = 1;
+        }
+    params_a.ignore = 0;
+
+    ShapeUnion<ShapeSphere>::param_type params_b(params_a);
+
+    std::vector<OBB> obbs = params_a.computeMemberBounds();
+    params_a.tree = buildCachedGPUTree(obbs.data(), 3, 1, false);
+    obbs = params_b.computeMemberBounds();
+    params_b.tree = buildCachedGPUTree(obbs.data(), 3, 1, false);
+    MY_CHECK_CLOSE(params_a.diameter, 1.5, tol);
+
+    // identical member sets share the build
+    UP_ASSERT_EQUAL(params_a.tree.getNumNodes(), params_b.tree.getNumNodes());
+    MY_CHECK_CLOSE(params_a.tree.getOBB(0).lengths.x, params_b.tree.getOBB(0).lengths.x, tol);
+
+    ShapeUnion<ShapeSphere> a(o, params_a);
+    ShapeUnion<ShapeSphere> b(o, params_b);
+    vec3<Scalar> r_ab(2.5, 0, 0);
+    UP_ASSERT(!test_overlap(r_ab, a, b, err_count));
+    UP_ASSERT(!test_overlap(-r_ab, b, a, err_count));
+
+    // move the last member of a into b, the refit tree must find the overlap
+    params_a.mpos[2] = vec3<Scalar>(1.6, 0, 0);
+    params_a.updateTree();
+    MY_CHECK_CLOSE(params_a.diameter, 3.7, tol);
+    UP_ASSERT(test_overlap(r_ab, a, b, err_count));
+    UP_ASSERT(test_overlap(-r_ab, b, a, err_count));
+    }
@@ -4,4 +4,5 @@
 """Tuners for HPMC."""
 
 from hoomd.hpmc.tune.move_size import MoveSize
+from hoomd.hpmc.tune.move_size_msd import MoveSizeMSD
 from hoomd.hpmc.tune.boxmc_move_size import BoxMCMoveSize
@@ -74,6 +74,7 @@ class _MCTuneDefinition(_TuneDefinition):
 class _TuneMCMove(_InternalAction):
     """Internal class for the MoveSize tuner."""
     _min_move_size = 1e-7
+    _solver_type = RootSolver
 
     def __init__(self, target, solver):
         self._tunables = []
@@ -92,7 +93,7 @@ class _TuneMCMove(_InternalAction):
         # attributes. However, these are simply forwarding a change along.
         param_dict = ParameterDict(target=OnlyTypes(
             float, postprocess=self._target_postprocess),
-                                   solver=RootSolver)
+                                   solver=self._solver_type)
 
         self._param_dict.update(param_dict)
         self.target = target
@@ -51,6 +51,7 @@ class _MoveSizeTuneDefinition(mc_move_tune._MCTuneDefinition):
 
 class _InternalMoveSize(mc_move_tune._TuneMCMove):
     """Internal class for the MoveSize tuner."""
+    _tune_definition = _MoveSizeTuneDefinition
 
     def __init__(self,
                  moves,
@@ -153,7 +154,7 @@ class _InternalMoveSize(mc_move_tune._TuneMCMove):
                     max_move_size = self.max_rotation_move[new_type]
                 else:
                     max_move_size = self.max_translation_move[new_type]
-                move_definition = _MoveSizeTuneDefinition(
+                move_definition = self._tune_definition(
                     move, new_type, self.target,
                     (self._min_move_size, max_move_size))
                 if move_definition not in tune_definitions:
@@ -0,0 +1,177 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement MoveSizeMSD."""
+
+from hoomd.tune import _InternalCustomTuner
+from hoomd.tune import GridOptimizer, Optimizer
+from hoomd.hpmc.tune.move_size import (_MoveSizeTuneDefinition,
+                                       _InternalMoveSize)
+
+
+class _MSDTuneDefinition(_MoveSizeTuneDefinition):
+    """Encapsulates getting the sampling rate and getting/setting move size.
+
+    This class should only be used for the _InternalMoveSizeMSD class to tune
+    HPMC move sizes. For this class 'x' is the move size and 'y' is the number
+    of accepted moves times the square of the move size per second of wall time
+    spent in the integrator.
+    """
+    _attr_counter = {'a': 'rotate', 'd': 'translate'}
+
+    def __init__(self, attr, type, target, domain=None):
+        self.previous_walltime = None
+        self.previous_rate = None
+        super().__init__(attr, type, target, domain)
+
+    def _get_y(self):
+        cpp_integrator = self.integrator._cpp_obj
+        counters = getattr(cpp_integrator.getCounters(0),
+                           self._attr_counter[self.attr])
+        accepted_moves = counters[0]
+        walltime = cpp_integrator.getUpdateWalltime()
+
+        # Called twice in the same step, return the computed value.
+        if walltime == self.previous_walltime:
+            return self.previous_rate
+
+        # We return None on the first call and after the integrator is
+        # reattached (which resets the counters and the wall time) since there
+        # is no interval to measure the rate over.
+        if (self.previous_walltime is None or walltime < self.previous_walltime
+                or accepted_moves < self.previous_accepted_moves):
+            self.previous_accepted_moves = accepted_moves
+            self.previous_walltime = walltime
+            self.previous_rate = None
+            return None
+
+        # The optimizers change x only after they read y, so x is the move
+        # size used in the measured interval.
+        rate = ((accepted_moves - self.previous_accepted_moves) * self.x**2
+                / (walltime - self.previous_walltime))
+
+        self.previous_accepted_moves = accepted_moves
+        self.previous_walltime = walltime
+        self.previous_rate = rate
+        return rate
+
+
+class _InternalMoveSizeMSD(_InternalMoveSize):
+    """Internal class for the MoveSizeMSD tuner."""
+    _tune_definition = _MSDTuneDefinition
+    _solver_type = Optimizer
+
+    def __init__(self,
+                 moves,
+                 solver,
+                 types=None,
+                 max_translation_move=None,
+                 max_rotation_move=None):
+        # The target is not used by optimizers.
+        super().__init__(moves, 0.0, solver, types, max_translation_move,
+                         max_rotation_move)
+
+
+class MoveSizeMSD(_InternalCustomTuner):
+    r"""Tunes HPMCIntegrator move sizes to maximize sampling per wall second.
+
+    `MoveSize` adjusts the move sizes toward a target acceptance rate. The
+    acceptance rate that samples configuration space most efficiently depends
+    on the system and on how the cost of the overlap checks depends on the move
+    size. `MoveSizeMSD` instead maximizes an estimate of the mean squared
+    displacement (or rotation) of the particles per second of wall time:
+
+    .. math::
+
+        \frac{N_\mathrm{accepted} \delta^2}{\Delta t}
+
+    where :math:`N_\mathrm{accepted}` is the number of accepted translation
+    (rotation) trial moves and :math:`\Delta t` is the wall time spent in the
+    integrator since the last time the tuner ran and :math:`\delta` is the
+    current translation (rotation) move size ``d`` (``a``). The mean squared
+    displacement of the accepted moves is proportional to :math:`\delta^2` with
+    a geometric prefactor that does not change the location of the maximum.
+
+    Tip:
+        Direct instantiation of this class requires a `hoomd.tune.Optimizer`
+        that determines how move sizes are updated. `MoveSizeMSD.grid_optimizer`
+        creates a `MoveSizeMSD` tuner with a `hoomd.tune.GridOptimizer`.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): ``Trigger`` to determine when to
+            run the tuner.
+        moves (list[str]): A list of types of moves to tune. Available options
+            are ``'a'`` and ``'d'``.
+        solver (`hoomd.tune.Optimizer`): An optimizer that maximizes the
+            sampling rate.
+        types (list[str]): A list of string particle types to tune the move
+            size for, defaults to None which upon attaching will tune all types
+            in the system currently.
+        max_translation_move (float): The maximum value of a translational move
+            size to attempt :math:`[\mathrm{length}]`.
+        max_rotation_move (float): The maximum value of a rotational move size
+            to attempt.
+
+    Attributes:
+        trigger (hoomd.trigger.Trigger): ``Trigger`` to determine when to
+            run the tuner.
+        moves (list[str]): A list of types of moves to tune. Available options
+            are ``'a'`` and ``'d'``.
+        solver (hoomd.tune.Optimizer): An optimizer that maximizes the sampling
+            rate.
+        types (list[str]): A list of string particle types to tune the move
+            size for, defaults to None which upon attaching will tune all types
+            in the system currently.
+        max_translation_move (float): The maximum value of a translational move
+            size to attempt :math:`[\mathrm{length}]`.
+        max_rotation_move (float): The maximum value of a rotational move size
+            to attempt.
+
+    Note:
+        The tuner measures the wall time that the integrator spends in each
+        step, which includes the time spent waiting on the GPU with
+        `hoomd.device.GPU`. Other operations do not contribute. The measured
+        rate is noisy on busy machines and with short intervals between tuner
+        calls. Run the tuner with a trigger period of at least a few hundred
+        steps.
+
+    Note:
+        The accepted move counts are summed over all particle types. To tune
+        the move sizes of different types independently, set ``types`` to one
+        type at a time and set the ``ignore_statistics`` flag of the shape
+        property of the HPMC integrator for all other types to ``True``.
+    """
+    _internal_class = _InternalMoveSizeMSD
+    _wrap_methods = ("tuned",)
+
+    @classmethod
+    def grid_optimizer(cls,
+                       trigger,
+                       moves,
+                       max_translation_move=None,
+                       max_rotation_move=None,
+                       types=None,
+                       n_bins=5,
+                       n_rounds=3):
+        r"""Create a `MoveSizeMSD` tuner with a `hoomd.tune.GridOptimizer`.
+
+        Args:
+            trigger (hoomd.trigger.trigger_like): ``Trigger`` to determine when
+                to run the tuner.
+            moves (list[str]): A list of types of moves to tune. Available
+                options are ``'a'`` and ``'d'``.
+            max_translation_move (float): The maximum value of a translational
+                move size to attempt :math:`[\mathrm{length}]`. Required when
+                tuning ``'d'``.
+            max_rotation_move (float): The maximum value of a rotational move
+                size to attempt. Required when tuning ``'a'``.
+            types (list[str]): A list of string particle types to tune the
+                move size for, defaults to None which upon attaching will tune
+                all types in the system currently.
+            n_bins (int): The number of move sizes to test in each round.
+            n_rounds (int): The number of rounds of narrowing the range of move
+                sizes.
+        """
+        solver = GridOptimizer(n_bins, n_rounds, maximize=True)
+        return cls(trigger, moves, solver, types, max_translation_move,
+                   max_rotation_move)
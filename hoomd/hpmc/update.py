@@ -379,6 +379,8 @@ class MuVT(Updater):
           ensemble)
         move_ratio (float): (if set) Set the ratio between volume and
           exchange/transfer moves (applies to Gibbs ensemble)
+        transfer_trials (int): Number of insertion/removal trials per
+          timestep (applies to the grand canonical ensemble)
 
     The muVT (or grand-canonical) ensemble simulates a system at constant
     fugacity.
@@ -389,6 +391,21 @@ class MuVT(Updater):
     ``ranks_per_partition`` argument of `hoomd.communicator.Communicator` to
     enable partitioned simulations.
 
+    Each insertion/removal trial chooses an insertion or removal with equal
+    probability. Set ``transfer_trials`` to perform many trials on each
+    triggered timestep. Gibbs ensemble simulations always perform one transfer
+    per timestep.
+
+    .. rubric:: GPU implementation
+
+    On the GPU, `MuVT` draws all insertion candidates of a timestep at once and
+    checks them for overlaps in parallel. It then applies the acceptance
+    criteria in the order of the trials, which generates the same sequence of
+    states as the CPU implementation. The GPU implementation applies to hard
+    particle simulations on a single rank without pair potentials, external
+    potentials or depletants. In all other cases, `MuVT` performs the trials on
+    the CPU.
+
     .. rubric:: Mixed precision
 
     `MuVT` uses reduced precision floating point arithmetic when checking
@@ -409,17 +426,22 @@ class MuVT(Updater):
           (applies to Gibbs ensemble)
         ntrial (float): (**default**: 1) Number of configurational bias attempts
           to swap depletants
+        transfer_trials (int): (**default**: 1) Number of insertion/removal
+          trials per timestep (applies to the grand canonical ensemble)
         fugacity (`TypeParameter` [ ``particle type``, `float`]):
             Particle fugacity
             :math:`[\mathrm{volume}^{-1}]` (**default:** 0).
     """
+    _remove_for_pickling = Updater._remove_for_pickling + ('_cpp_cell',)
+    _skip_for_equality = Updater._skip_for_equality | {'_cpp_cell'}
 
     def __init__(self,
                  transfer_types,
                  ngibbs=1,
                  max_volume_rescale=0.1,
                  volume_move_probability=0.5,
-                 trigger=1):
+                 trigger=1,
+                 transfer_trials=1):
         super().__init__(trigger)
 
         self.ngibbs = int(ngibbs)
@@ -429,6 +451,7 @@ class MuVT(Updater):
             transfer_types=list(transfer_types),
             max_volume_rescale=float(max_volume_rescale),
             volume_move_probability=float(volume_move_probability),
+            transfer_trials=int(transfer_trials),
             **_default_dict)
         self._param_dict.update(param_dict)
 
@@ -447,10 +470,21 @@ class MuVT(Updater):
 
         cpp_cls_name = "UpdaterMuVT"
         cpp_cls_name += integrator.__class__.__name__
+        use_gpu = (isinstance(self._simulation.device, hoomd.device.GPU)
+                   and (cpp_cls_name + 'GPU') in _hpmc.__dict__)
+        if use_gpu:
+            cpp_cls_name += "GPU"
         cpp_cls = getattr(_hpmc, cpp_cls_name)
 
-        self._cpp_obj = cpp_cls(self._simulation.state._cpp_sys_def,
-                                self.trigger, integrator._cpp_obj, self.ngibbs)
+        if use_gpu:
+            sys_def = self._simulation.state._cpp_sys_def
+            self._cpp_cell = _hoomd.CellListGPU(sys_def)
+            self._cpp_obj = cpp_cls(sys_def, self.trigger, integrator._cpp_obj,
+                                    self.ngibbs, self._cpp_cell)
+        else:
+            self._cpp_obj = cpp_cls(self._simulation.state._cpp_sys_def,
+                                    self.trigger, integrator._cpp_obj,
+                                    self.ngibbs)
 
     @log(category='sequence', requires_run=True)
     def insert_moves(self):
@@ -533,6 +567,14 @@ class Shape(Updater):
 
     See `hoomd.hpmc.shape_move` for supported shapes.
 
+    .. rubric:: GPU implementation
+
+    With `hoomd.device.GPU`, the overlap check of each trial shape runs in the
+    integrator's narrow phase kernel, with the current configuration as the
+    trial configuration of every particle. The check runs on the CPU until the
+    integrator has run at least one step and when the box is too small for the
+    minimum image convention on the GPU.
+
     Example::
 
         mc = hoomd.hpmc.integrate.ConvexPolyhedron()
@@ -661,6 +703,15 @@ class Clusters(Updater):
     algorithm is then no longer ergodic for those and needs to be combined with
     local moves.
 
+    .. rubric:: Domain decomposition
+
+    With MPI domain decomposition, each rank checks the transformed particles
+    that land in its domain for overlaps with the old configuration. The ranks
+    then merge their partial clusters into global clusters. This mode supports
+    hard particle overlaps only. Pair potentials and implicit depletants raise
+    an error under domain decomposition. With `hoomd.device.GPU`, the cluster
+    move runs on the CPU when the system is domain decomposed.
+
     .. rubric:: Mixed precision
 
     `Clusters` uses reduced precision floating point arithmetic when checking
@@ -749,6 +800,9 @@ class QuickCompress(Updater):
         allow_unsafe_resize (bool): When `True`, box moves are proposed
             independent of particle translational move sizes.
 
+        max_bisection_steps (int): The maximum number of box moves to try
+            after a rejected box move by bisecting its scale factor.
+
     Use `QuickCompress` in conjunction with an HPMC integrator to scale the
     system to a target box size. `QuickCompress` can typically compress dilute
     systems to near random close packing densities in tens of thousands of time
@@ -838,6 +892,12 @@ class QuickCompress(Updater):
     `QuickCompress` then waits until `hoomd.hpmc.integrate.HPMCIntegrator` makes
     local MC trial moves that remove all overlaps.
 
+    When `max_bisection_steps` is positive and the box move is rejected,
+    `QuickCompress` bisects the scale factor between the rejected value and 1.0
+    for up to `max_bisection_steps` more box moves, and sets the most
+    compressed box that it accepts. This finds a large box move in every update
+    when the randomly chosen :math:`s` compresses the system too much.
+
     `QuickCompress` adjusts the value of :math:`s` based on the particle and
     translational trial move sizes to ensure that the trial moves will be able
     to remove the overlaps. It randomly chooses a value of :math:`s` uniformly
@@ -883,6 +943,13 @@ class QuickCompress(Updater):
     `QuickCompress` uses reduced precision floating point arithmetic when
     checking for particle overlaps in the local particle reference frame.
 
+    .. rubric:: GPU
+
+    On the GPU, `QuickCompress` scales, backs up, and restores the particle
+    positions on the device. Checks that only need to know whether there is
+    any overlap (including all checks when ``max_overlaps_per_particle *
+    N_particles < 1``) stop at the first overlap on the device.
+
     Attributes:
         trigger (Trigger): Update the box dimensions on triggered time steps.
 
@@ -902,6 +969,9 @@ class QuickCompress(Updater):
             different streams of random numbers.
 
         allow_unsafe_resize (bool): Flag that determines whether
+
+        max_bisection_steps (int): The maximum number of box moves to try
+            after a rejected box move by bisecting its scale factor.
     """
 
     def __init__(self,
@@ -909,20 +979,23 @@ class QuickCompress(Updater):
                  target_box,
                  max_overlaps_per_particle=0.25,
                  min_scale=0.99,
-                 allow_unsafe_resize=False):
+                 allow_unsafe_resize=False,
+                 max_bisection_steps=0):
         super().__init__(trigger)
 
         param_dict = ParameterDict(max_overlaps_per_particle=float,
                                    min_scale=float,
                                    target_box=hoomd.variant.box.BoxVariant,
                                    instance=int,
-                                   allow_unsafe_resize=bool)
+                                   allow_unsafe_resize=bool,
+                                   max_bisection_steps=int)
         if isinstance(target_box, hoomd.Box):
             target_box = hoomd.variant.box.Constant(target_box)
         param_dict['max_overlaps_per_particle'] = max_overlaps_per_particle
         param_dict['min_scale'] = min_scale
         param_dict['target_box'] = target_box
         param_dict['allow_unsafe_resize'] = allow_unsafe_resize
+        param_dict['max_bisection_steps'] = max_bisection_steps
 
         self._param_dict.update(param_dict)
 
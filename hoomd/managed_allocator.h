@@ -181,6 +181,28 @@ template<class T> class managed_allocator
             }
         }
 
+#ifdef ENABLE_HIP
+    //! Prefetch elements to a device asynchronously
+    /*! \param ptr First element to prefetch
+        \param n Number of elements to prefetch
+        \param device Device to migrate the pages to
+        \param stream Stream to order the prefetch on
+
+        Host writes to managed memory leave the pages on the host, and the first kernel that reads
+        them would fault on each page. Prefetching them ahead of the kernel migrates them while the
+        host continues. Nothing is done when this allocator uses host memory.
+    */
+    void prefetch(const value_type* ptr, std::size_t n, int device, hipStream_t stream = 0) const
+        {
+#ifdef __HIP_PLATFORM_NVCC__
+        if (m_use_device && ptr && n > 0)
+            {
+            cudaMemPrefetchAsync(ptr, n * sizeof(T), device, stream);
+            }
+#endif
+        }
+#endif
+
     //! Static version, also destroys objects
     /*! \param ptr Start of aligned memory allocation
         \param N Number elements allocated
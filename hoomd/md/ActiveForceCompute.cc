@@ -20,7 +20,8 @@ namespace md
 ActiveForceCompute::ActiveForceCompute(std::shared_ptr<SystemDefinition> sysdef,
                                        std::shared_ptr<ParticleGroup> group)
 
-    : ForceCompute(sysdef), m_group(group)
+    : ForceCompute(sysdef), m_group(group), m_diffusion_pending(false),
+      m_pending_rotational_diffusion(0), m_pending_diffusion_timestep(0)
     {
     // allocate memory for the per-type active_force storage and initialize them to (1.0,0,0)
     GlobalVector<Scalar4> tmp_f_activeVec(m_pdata->getNTypes(), m_exec_conf);
@@ -301,12 +302,61 @@ void ActiveForceCompute::rotationalDiffusion(Scalar rotational_diffusion, uint64
         }
     }
 
+/*! \param rotational_diffusion Rotational diffusion constant
+    \param timestep Timestep that seeds the random rotations
+
+    Applies rotational diffusion followed by setForces(). Subclasses override this to walk the group
+    once.
+*/
+void ActiveForceCompute::setForcesWithDiffusion(Scalar rotational_diffusion, uint64_t timestep)
+    {
+    rotationalDiffusion(rotational_diffusion, timestep);
+    setForces();
+    }
+
+/*! \param rotational_diffusion Rotational diffusion constant
+    \param timestep Current timestep
+
+    ActiveRotationalDiffusionUpdater runs before the integrator. When the forces for \a timestep are
+    already computed, the next force computation is the one in the first half of this step, so the
+    diffusion is deferred to computeForces() and fused with setting the forces. Otherwise, the
+    orientations are updated immediately.
+*/
+void ActiveForceCompute::requestRotationalDiffusion(Scalar rotational_diffusion, uint64_t timestep)
+    {
+    // apply an earlier request that no force computation consumed
+    if (m_diffusion_pending)
+        {
+        m_diffusion_pending = false;
+        rotationalDiffusion(m_pending_rotational_diffusion, m_pending_diffusion_timestep);
+        }
+
+    if (!m_first_compute && m_last_computed == timestep)
+        {
+        m_diffusion_pending = true;
+        m_pending_rotational_diffusion = rotational_diffusion;
+        m_pending_diffusion_timestep = timestep;
+        }
+    else
+        {
+        rotationalDiffusion(rotational_diffusion, timestep);
+        }
+    }
+
 /*! This function applies rotational diffusion and sets forces for all active particles
     \param timestep Current timestep
 */
 void ActiveForceCompute::computeForces(uint64_t timestep)
     {
-    setForces(); // set forces for particles
+    if (m_diffusion_pending)
+        {
+        m_diffusion_pending = false;
+        setForcesWithDiffusion(m_pending_rotational_diffusion, m_pending_diffusion_timestep);
+        }
+    else
+        {
+        setForces(); // set forces for particles
+        }
 
 #ifdef ENABLE_HIP
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -75,6 +75,12 @@ class PYBIND11_EXPORT ActiveForceCompute : public ForceCompute
     //! Orientational diffusion for spherical particles
     virtual void rotationalDiffusion(Scalar rotational_diffusion, uint64_t timestep);
 
+    //! Apply rotational diffusion and set forces for particles in one pass
+    virtual void setForcesWithDiffusion(Scalar rotational_diffusion, uint64_t timestep);
+
+    //! Apply rotational diffusion now or defer it to the next force computation
+    void requestRotationalDiffusion(Scalar rotational_diffusion, uint64_t timestep);
+
     std::shared_ptr<ParticleGroup> m_group; //!< Group of particles on which this force is applied
     GlobalVector<Scalar4>
         m_f_activeVec; //! active force unit vectors and magnitudes for each particle type
@@ -82,10 +88,14 @@ class PYBIND11_EXPORT ActiveForceCompute : public ForceCompute
     GlobalVector<Scalar4>
         m_t_activeVec; //! active torque unit vectors and magnitudes for each particle type
 
+    bool m_diffusion_pending;              //!< True when rotational diffusion has been deferred
+    Scalar m_pending_rotational_diffusion; //!< Rotational diffusion of the deferred request
+    uint64_t m_pending_diffusion_timestep; //!< Timestep of the deferred request
+
     private:
     // Allow ActiveRotationalDiffusionUpdater to access internal methods and members of
     // ActiveForceCompute classes/subclasses. This is necessary to allow
-    // ActiveRotationalDiffusionUpdater to call rotationalDiffusion.
+    // ActiveRotationalDiffusionUpdater to call requestRotationalDiffusion.
     friend class ActiveRotationalDiffusionUpdater;
     };
 
@@ -4,6 +4,9 @@
 #include "hip/hip_runtime.h"
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/ParticleData.cuh"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+#include "hoomd/VectorMath.h"
 
 /*! \file ActiveForceComputeGPU.cuh
     \brief Declares GPU kernel code for calculating active forces forces on the GPU. Used by
@@ -42,6 +45,103 @@ hipError_t gpu_compute_active_force_rotational_diffusion(const unsigned int grou
                                                          const uint16_t seed,
                                                          unsigned int block_size);
 
+hipError_t gpu_compute_active_force_set_forces_rotational_diffusion(const unsigned int group_size,
+                                                                    unsigned int* d_tag,
+                                                                    unsigned int* d_index_array,
+                                                                    Scalar4* d_force,
+                                                                    Scalar4* d_torque,
+                                                                    const Scalar4* d_pos,
+                                                                    Scalar4* d_orientation,
+                                                                    const Scalar4* d_f_act,
+                                                                    const Scalar4* d_t_act,
+                                                                    const unsigned int N,
+                                                                    bool is2D,
+                                                                    const Scalar rotationDiff,
+                                                                    const uint64_t timestep,
+                                                                    const uint16_t seed,
+                                                                    unsigned int block_size);
+
+#ifdef __HIPCC__
+
+//! Set the active force and torque on one particle
+/*! \param idx particle index
+    \param quati particle orientation
+    \param fact active force unit vector and magnitude of the particle's type
+    \param tact active torque unit vector and magnitude of the particle's type
+    \param d_force particle force on device
+    \param d_torque particle torque on device
+*/
+__device__ inline void active_force_set_particle_force(unsigned int idx,
+                                                       const quat<Scalar>& quati,
+                                                       const Scalar4& fact,
+                                                       const Scalar4& tact,
+                                                       Scalar4* d_force,
+                                                       Scalar4* d_torque)
+    {
+    vec3<Scalar> f(fact.w * fact.x, fact.w * fact.y, fact.w * fact.z);
+    vec3<Scalar> fi = rotate(quati, f);
+    d_force[idx] = vec_to_scalar4(fi, 0);
+
+    vec3<Scalar> t(tact.w * tact.x, tact.w * tact.y, tact.w * tact.z);
+    vec3<Scalar> ti = rotate(quati, t);
+    d_torque[idx] = vec_to_scalar4(ti, 0);
+    }
+
+//! Apply rotational diffusion to the orientation of one active particle
+/*! \param quati particle orientation (updated in place)
+    \param fact active force unit vector and magnitude of the particle's type
+    \param ptag particle tag
+    \param is2D check if simulation is 2D or 3D
+    \param rotationConst particle rotational diffusion constant
+    \param timestep current timestep
+    \param seed seed for random number generator
+*/
+__device__ inline void active_force_rotational_diffusion_particle(quat<Scalar>& quati,
+                                                                  const Scalar4& fact,
+                                                                  unsigned int ptag,
+                                                                  bool is2D,
+                                                                  const Scalar rotationConst,
+                                                                  const uint64_t timestep,
+                                                                  const uint16_t seed)
+    {
+    hoomd::RandomGenerator rng(
+        hoomd::Seed(hoomd::RNGIdentifier::ActiveForceCompute, timestep, seed),
+        hoomd::Counter(ptag));
+
+    if (is2D) // 2D
+        {
+        Scalar delta_theta = hoomd::NormalDistribution<Scalar>(rotationConst)(rng);
+
+        vec3<Scalar> b(0, 0, 1.0);
+        quat<Scalar> rot_quat = quat<Scalar>::fromAxisAngle(b, delta_theta);
+
+        quati = rot_quat * quati;
+        quati = quati * (Scalar(1.0) / slow::sqrt(norm2(quati)));
+        // in 2D there is only one meaningful direction for torque
+        }
+    else // 3D: Following Stenhammar, Soft Matter, 2014
+        {
+        hoomd::SpherePointGenerator<Scalar> unit_vec;
+        vec3<Scalar> rand_vec;
+        unit_vec(rng, rand_vec);
+
+        vec3<Scalar> f(fact.x, fact.y, fact.z);
+        vec3<Scalar> fi = rotate(quati, f);
+
+        vec3<Scalar> aux_vec = cross(fi, rand_vec); // rotation axis
+        Scalar aux_vec_mag = slow::rsqrt(dot(aux_vec, aux_vec));
+        aux_vec *= aux_vec_mag;
+
+        Scalar delta_theta = hoomd::NormalDistribution<Scalar>(rotationConst)(rng);
+        quat<Scalar> rot_quat = quat<Scalar>::fromAxisAngle(aux_vec, delta_theta);
+
+        quati = rot_quat * quati;
+        quati = quati * (Scalar(1.0) / slow::sqrt(norm2(quati)));
+        }
+    }
+
+#endif
+
     } // end namespace kernel
     } // end namespace md
     } // end namespace hoomd
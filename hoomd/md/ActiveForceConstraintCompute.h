@@ -47,6 +47,10 @@ class PYBIND11_EXPORT ActiveForceConstraintCompute : public ActiveForceCompute
     //! Set constraints if particles confined to a surface
     virtual void setConstraint();
 
+    //! Set constraints and forces, applying rotational diffusion first when requested
+    virtual void
+    setConstrainedForces(bool diffuse, Scalar rotational_diffusion, uint64_t timestep);
+
     //! Helper function to be called when box changes
     void setBoxChange()
         {
@@ -184,6 +188,23 @@ template<class Manifold> void ActiveForceConstraintCompute<Manifold>::setConstra
         }
     }
 
+/*! \param diffuse Set to true to apply rotational diffusion before the constraints
+    \param rotational_diffusion Rotational diffusion constant
+    \param timestep Timestep that seeds the random rotations
+*/
+template<class Manifold>
+void ActiveForceConstraintCompute<Manifold>::setConstrainedForces(bool diffuse,
+                                                                  Scalar rotational_diffusion,
+                                                                  uint64_t timestep)
+    {
+    if (diffuse)
+        rotationalDiffusion(rotational_diffusion, timestep);
+
+    setConstraint(); // apply manifold constraints to active particles active force vectors
+
+    setForces(); // set forces for particles
+    }
+
 /*! This function applies constraints, rotational diffusion, and sets forces for all active
    particles \param timestep Current timestep
 */
@@ -199,9 +220,10 @@ void ActiveForceConstraintCompute<Manifold>::computeForces(uint64_t timestep)
         m_box_changed = false;
         }
 
-    setConstraint(); // apply manifold constraints to active particles active force vectors
-
-    setForces(); // set forces for particles
+    setConstrainedForces(m_diffusion_pending,
+                         m_pending_rotational_diffusion,
+                         m_pending_diffusion_timestep);
+    m_diffusion_pending = false;
 
 #ifdef ENABLE_HIP
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -1,6 +1,7 @@
 // Copyright (c) 2009-2024 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "ActiveForceComputeGPU.cuh"
 #include "hip/hip_runtime.h"
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/ParticleData.cuh"
@@ -23,13 +24,22 @@ namespace md
 namespace kernel
     {
 template<class Manifold>
-hipError_t gpu_compute_active_force_set_constraints(const unsigned int group_size,
-                                                    unsigned int* d_index_array,
-                                                    const Scalar4* d_pos,
-                                                    Scalar4* d_orientation,
-                                                    const Scalar4* d_f_act,
-                                                    Manifold manifold,
-                                                    unsigned int block_size);
+hipError_t gpu_compute_active_force_constraint_set_forces(const unsigned int group_size,
+                                                          unsigned int* d_tag,
+                                                          unsigned int* d_index_array,
+                                                          Scalar4* d_force,
+                                                          Scalar4* d_torque,
+                                                          const Scalar4* d_pos,
+                                                          Scalar4* d_orientation,
+                                                          const Scalar4* d_f_act,
+                                                          const Scalar4* d_t_act,
+                                                          Manifold manifold,
+                                                          const unsigned int N,
+                                                          bool diffuse,
+                                                          const Scalar rotationDiff,
+                                                          const uint64_t timestep,
+                                                          const uint16_t seed,
+                                                          unsigned int block_size);
 
 template<class Manifold>
 hipError_t gpu_compute_active_force_constraint_rotational_diffusion(const unsigned int group_size,
@@ -46,21 +56,40 @@ hipError_t gpu_compute_active_force_constraint_rotational_diffusion(const unsign
 
 #ifdef __HIPCC__
 
-//! Kernel for adjusting active force vectors to align parallel to an
-//  manifold surface constraint on the GPU
+//! Kernel for constraining active force vectors to a manifold and setting the forces on the GPU
 /*! \param group_size number of particles
+    \param d_tag particle tags on device
     \param d_index_array stores list to convert group index to global tag
+    \param d_force particle force on device
+    \param d_torque particle torque on device
     \param d_pos particle positions on device
+    \param d_orientation particle orientation on device
     \param d_f_act particle active force unit vector
+    \param d_t_act particle active torque unit vector
     \param manifold constraint
+    \param diffuse apply rotational diffusion before the constraint
+    \param rotationConst particle rotational diffusion constant
+    \param timestep current timestep
+    \param seed seed for random number generator
+
+    Rotational diffusion about the manifold normal, alignment of the active force vector parallel
+    to the manifold, and setting the force and torque are applied in one pass over the group.
 */
 template<class Manifold>
-__global__ void gpu_compute_active_force_set_constraints_kernel(const unsigned int group_size,
-                                                                unsigned int* d_index_array,
-                                                                const Scalar4* d_pos,
-                                                                Scalar4* d_orientation,
-                                                                const Scalar4* d_f_act,
-                                                                Manifold manifold)
+__global__ void gpu_compute_active_force_constraint_set_forces_kernel(const unsigned int group_size,
+                                                                      unsigned int* d_tag,
+                                                                      unsigned int* d_index_array,
+                                                                      Scalar4* d_force,
+                                                                      Scalar4* d_torque,
+                                                                      const Scalar4* d_pos,
+                                                                      Scalar4* d_orientation,
+                                                                      const Scalar4* d_f_act,
+                                                                      const Scalar4* d_t_act,
+                                                                      Manifold manifold,
+                                                                      bool diffuse,
+                                                                      const Scalar rotationConst,
+                                                                      const uint64_t timestep,
+                                                                      const uint16_t seed)
     {
     unsigned int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
     if (group_idx >= group_size)
@@ -71,39 +100,59 @@ __global__ void gpu_compute_active_force_set_constraints_kernel(const unsigned i
     unsigned int type = __scalar_as_int(posidx.w);
 
     Scalar4 fact = __ldg(d_f_act + type);
+    Scalar4 tact = __ldg(d_t_act + type);
+    quat<Scalar> quati(d_orientation[idx]);
 
-    if (fact.w != 0)
+    if (diffuse || fact.w != 0)
         {
         Scalar3 current_pos = make_scalar3(posidx.x, posidx.y, posidx.z);
-
         vec3<Scalar> norm = normalize(vec3<Scalar>(manifold.derivative(current_pos)));
 
-        vec3<Scalar> f(fact.x, fact.y, fact.z);
-        quat<Scalar> quati(__ldg(d_orientation + idx));
-        vec3<Scalar> fi = rotate(quati, f);
+        if (diffuse)
+            {
+            hoomd::RandomGenerator rng(
+                hoomd::Seed(hoomd::RNGIdentifier::ActiveForceCompute, timestep, seed),
+                hoomd::Counter(d_tag[idx]));
+
+            Scalar delta_theta = hoomd::NormalDistribution<Scalar>(rotationConst)(rng);
+
+            quat<Scalar> rot_quat = quat<Scalar>::fromAxisAngle(norm, delta_theta);
 
-        Scalar dot_prod = fi.x * norm.x + fi.y * norm.y + fi.z * norm.z;
+            quati = rot_quat * quati;
+            quati = quati * (Scalar(1.0) / slow::sqrt(norm2(quati)));
+            }
 
-        Scalar dot_perp_prod = slow::rsqrt(1 - dot_prod * dot_prod);
+        if (fact.w != 0)
+            {
+            vec3<Scalar> f(fact.x, fact.y, fact.z);
+            vec3<Scalar> fi = rotate(quati, f);
 
-        Scalar phi = slow::atan(dot_prod * dot_perp_prod);
+            Scalar dot_prod = fi.x * norm.x + fi.y * norm.y + fi.z * norm.z;
 
-        fi.x -= norm.x * dot_prod;
-        fi.y -= norm.y * dot_prod;
-        fi.z -= norm.z * dot_prod;
+            Scalar dot_perp_prod = slow::rsqrt(1 - dot_prod * dot_prod);
 
-        Scalar new_norm = slow::rsqrt(fi.x * fi.x + fi.y * fi.y + fi.z * fi.z);
+            Scalar phi = slow::atan(dot_prod * dot_perp_prod);
 
-        fi *= new_norm;
+            fi.x -= norm.x * dot_prod;
+            fi.y -= norm.y * dot_prod;
+            fi.z -= norm.z * dot_prod;
 
-        vec3<Scalar> rot_vec = cross(norm, fi);
+            Scalar new_norm = slow::rsqrt(fi.x * fi.x + fi.y * fi.y + fi.z * fi.z);
 
-        quat<Scalar> rot_quat = quat<Scalar>::fromAxisAngle(rot_vec, phi);
+            fi *= new_norm;
+
+            vec3<Scalar> rot_vec = cross(norm, fi);
+
+            quat<Scalar> rot_quat = quat<Scalar>::fromAxisAngle(rot_vec, phi);
+
+            quati = rot_quat * quati;
+            quati = quati * (Scalar(1.0) / slow::sqrt(norm2(quati)));
+            }
 
-        quati = rot_quat * quati;
-        quati = quati * (Scalar(1.0) / slow::sqrt(norm2(quati)));
         d_orientation[idx] = quat_to_scalar4(quati);
         }
+
+    active_force_set_particle_force(idx, quati, fact, tact, d_force, d_torque);
     }
 
 //! Kernel for applying rotational diffusion to active force vectors on the GPU
@@ -135,7 +184,7 @@ gpu_compute_active_force_constraint_rotational_diffusion_kernel(const unsigned i
     unsigned int idx = d_index_array[group_idx];
     Scalar4 posidx = __ldg(d_pos + idx);
     unsigned int type = __scalar_as_int(posidx.w);
-    unsigned int ptag = d_tag[group_idx];
+    unsigned int ptag = d_tag[idx];
 
     quat<Scalar> quati(__ldg(d_orientation + idx));
 
@@ -156,30 +205,48 @@ gpu_compute_active_force_constraint_rotational_diffusion_kernel(const unsigned i
     }
 
 template<class Manifold>
-hipError_t gpu_compute_active_force_set_constraints(const unsigned int group_size,
-                                                    unsigned int* d_index_array,
-                                                    const Scalar4* d_pos,
-                                                    Scalar4* d_orientation,
-                                                    const Scalar4* d_f_act,
-                                                    Manifold manifold,
-                                                    unsigned int block_size)
+hipError_t gpu_compute_active_force_constraint_set_forces(const unsigned int group_size,
+                                                          unsigned int* d_tag,
+                                                          unsigned int* d_index_array,
+                                                          Scalar4* d_force,
+                                                          Scalar4* d_torque,
+                                                          const Scalar4* d_pos,
+                                                          Scalar4* d_orientation,
+                                                          const Scalar4* d_f_act,
+                                                          const Scalar4* d_t_act,
+                                                          Manifold manifold,
+                                                          const unsigned int N,
+                                                          bool diffuse,
+                                                          const Scalar rotationConst,
+                                                          const uint64_t timestep,
+                                                          const uint16_t seed,
+                                                          unsigned int block_size)
     {
     // setup the grid to run the kernel
     dim3 grid(group_size / block_size + 1, 1, 1);
     dim3 threads(block_size, 1, 1);
 
     // run the kernel
-    hipLaunchKernelGGL((gpu_compute_active_force_set_constraints_kernel<Manifold>),
+    hipMemset(d_force, 0, sizeof(Scalar4) * N);
+    hipLaunchKernelGGL((gpu_compute_active_force_constraint_set_forces_kernel<Manifold>),
                        dim3(grid),
                        dim3(threads),
                        0,
                        0,
                        group_size,
+                       d_tag,
                        d_index_array,
+                       d_force,
+                       d_torque,
                        d_pos,
                        d_orientation,
                        d_f_act,
-                       manifold);
+                       d_t_act,
+                       manifold,
+                       diffuse,
+                       rotationConst,
+                       timestep,
+                       seed);
     return hipSuccess;
     }
 
@@ -39,18 +39,15 @@ class PYBIND11_EXPORT ActiveForceConstraintComputeGPU
                                     Manifold manifold);
 
     protected:
-    std::shared_ptr<Autotuner<1>> m_tuner_force;      //!< Autotuner for block size (force kernel)
-    std::shared_ptr<Autotuner<1>> m_tuner_diffusion;  //!< Autotuner for block size (diff kernel)
-    std::shared_ptr<Autotuner<1>> m_tuner_constraint; //!< Autotuner for block size (constr kernel)
-
-    //! Set forces for particles
-    virtual void setForces();
+    std::shared_ptr<Autotuner<1>> m_tuner_force;     //!< Autotuner for block size (force kernel)
+    std::shared_ptr<Autotuner<1>> m_tuner_diffusion; //!< Autotuner for block size (diff kernel)
 
     //! Orientational diffusion for spherical particles
     virtual void rotationalDiffusion(Scalar rotational_diffusion, uint64_t timestep);
 
-    //! Set constraints if particles confined to a surface
-    virtual void setConstraint();
+    //! Set constraints and forces in one kernel, applying rotational diffusion when requested
+    virtual void
+    setConstrainedForces(bool diffuse, Scalar rotational_diffusion, uint64_t timestep);
     };
 
 /*! \file ActiveForceConstraintComputeGPU.cc
@@ -85,15 +82,13 @@ ActiveForceConstraintComputeGPU<Manifold>::ActiveForceConstraintComputeGPU(
     m_tuner_force.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
                                          this->m_exec_conf,
                                          "active_constraint_force"));
+    // Rotational diffusion is usually fused into the force kernel, so its own kernel may not run.
     m_tuner_diffusion.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
                                              this->m_exec_conf,
-                                             "active_constraint_diffusion"));
-    m_tuner_constraint.reset(
-        new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
-                         this->m_exec_conf,
-                         "active_constraint_constraint"));
-    this->m_autotuners.insert(this->m_autotuners.end(),
-                              {m_tuner_force, m_tuner_diffusion, m_tuner_constraint});
+                                             "active_constraint_diffusion",
+                                             5,
+                                             true));
+    this->m_autotuners.insert(this->m_autotuners.end(), {m_tuner_force, m_tuner_diffusion});
 
     unsigned int type = this->m_pdata->getNTypes();
     GlobalVector<Scalar4> tmp_f_activeVec(type, this->m_exec_conf);
@@ -119,60 +114,6 @@ ActiveForceConstraintComputeGPU<Manifold>::ActiveForceConstraintComputeGPU(
     this->m_t_activeVec.swap(tmp_t_activeVec);
     }
 
-/*! This function sets appropriate active forces and torques on all active particles.
- */
-template<class Manifold> void ActiveForceConstraintComputeGPU<Manifold>::setForces()
-    {
-    //  array handles
-    ArrayHandle<Scalar4> d_f_actVec(this->m_f_activeVec,
-                                    access_location::device,
-                                    access_mode::read);
-    ArrayHandle<Scalar4> d_force(this->m_force, access_location::device, access_mode::overwrite);
-
-    ArrayHandle<Scalar4> d_t_actVec(this->m_t_activeVec,
-                                    access_location::device,
-                                    access_mode::read);
-    ArrayHandle<Scalar4> d_torque(this->m_torque, access_location::device, access_mode::overwrite);
-
-    ArrayHandle<Scalar4> d_pos(this->m_pdata->getPositions(),
-                               access_location::device,
-                               access_mode::read);
-    ArrayHandle<Scalar4> d_orientation(this->m_pdata->getOrientationArray(),
-                                       access_location::device,
-                                       access_mode::read);
-    ArrayHandle<unsigned int> d_index_array(this->m_group->getIndexArray(),
-                                            access_location::device,
-                                            access_mode::read);
-
-    // sanity check
-    assert(d_force.data != NULL);
-    assert(d_f_actVec.data != NULL);
-    assert(d_t_actVec.data != NULL);
-    assert(d_pos.data != NULL);
-    assert(d_orientation.data != NULL);
-    assert(d_index_array.data != NULL);
-    unsigned int group_size = this->m_group->getNumMembers();
-    unsigned int N = this->m_pdata->getN();
-
-    // compute the forces on the GPU
-    this->m_tuner_force->begin();
-    kernel::gpu_compute_active_force_set_forces(group_size,
-                                                d_index_array.data,
-                                                d_force.data,
-                                                d_torque.data,
-                                                d_pos.data,
-                                                d_orientation.data,
-                                                d_f_actVec.data,
-                                                d_t_actVec.data,
-                                                N,
-                                                this->m_tuner_force->getParam()[0]);
-
-    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
-        CHECK_CUDA_ERROR();
-
-    this->m_tuner_force->end();
-    }
-
 /*! This function applies rotational diffusion to all active particles. The angle between the torque
  vector and
  * force vector does not change
@@ -224,14 +165,28 @@ void ActiveForceConstraintComputeGPU<Manifold>::rotationalDiffusion(Scalar rotat
     this->m_tuner_diffusion->end();
     }
 
-/*! This function sets an ellipsoid surface constraint for all active particles
- */
-template<class Manifold> void ActiveForceConstraintComputeGPU<Manifold>::setConstraint()
+/*! This function applies rotational diffusion when requested, aligns the active force vectors with
+    the manifold, and sets the active forces and torques on all active particles in one kernel.
+    \param diffuse Set to true to apply rotational diffusion
+    \param rotational_diffusion Rotational diffusion constant
+    \param timestep Timestep that seeds the random rotations
+*/
+template<class Manifold>
+void ActiveForceConstraintComputeGPU<Manifold>::setConstrainedForces(bool diffuse,
+                                                                     Scalar rotational_diffusion,
+                                                                     uint64_t timestep)
     {
     //  array handles
     ArrayHandle<Scalar4> d_f_actVec(this->m_f_activeVec,
                                     access_location::device,
-                                    access_mode::readwrite);
+                                    access_mode::read);
+    ArrayHandle<Scalar4> d_force(this->m_force, access_location::device, access_mode::overwrite);
+
+    ArrayHandle<Scalar4> d_t_actVec(this->m_t_activeVec,
+                                    access_location::device,
+                                    access_mode::read);
+    ArrayHandle<Scalar4> d_torque(this->m_torque, access_location::device, access_mode::overwrite);
+
     ArrayHandle<Scalar4> d_pos(this->m_pdata->getPositions(),
                                access_location::device,
                                access_mode::read);
@@ -241,27 +196,40 @@ template<class Manifold> void ActiveForceConstraintComputeGPU<Manifold>::setCons
     ArrayHandle<unsigned int> d_index_array(this->m_group->getIndexArray(),
                                             access_location::device,
                                             access_mode::read);
-
-    assert(d_pos.data != NULL);
+    ArrayHandle<unsigned int> d_tag(this->m_pdata->getTags(),
+                                    access_location::device,
+                                    access_mode::read);
 
     unsigned int group_size = this->m_group->getNumMembers();
+    unsigned int N = this->m_pdata->getN();
 
-    // perform the update on the GPU
-    this->m_tuner_constraint->begin();
+    const auto rotation_constant = slow::sqrt(2.0 * rotational_diffusion * this->m_deltaT);
 
-    kernel::gpu_compute_active_force_set_constraints<Manifold>(
+    // compute the forces on the GPU
+    this->m_tuner_force->begin();
+
+    kernel::gpu_compute_active_force_constraint_set_forces<Manifold>(
         group_size,
+        d_tag.data,
         d_index_array.data,
+        d_force.data,
+        d_torque.data,
         d_pos.data,
         d_orientation.data,
         d_f_actVec.data,
+        d_t_actVec.data,
         this->m_manifold,
-        this->m_tuner_constraint->getParam()[0]);
+        N,
+        diffuse,
+        rotation_constant,
+        timestep,
+        this->m_sysdef->getSeed(),
+        this->m_tuner_force->getParam()[0]);
 
     if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
 
-    this->m_tuner_constraint->end();
+    this->m_tuner_force->end();
     }
 
 namespace detail
@@ -44,7 +44,8 @@ ActiveRotationalDiffusionUpdater::~ActiveRotationalDiffusionUpdater()
 */
 void ActiveRotationalDiffusionUpdater::update(uint64_t timestep)
     {
-    m_active_force->rotationalDiffusion(m_rotational_diffusion->operator()(timestep), timestep);
+    m_active_force->requestRotationalDiffusion(m_rotational_diffusion->operator()(timestep),
+                                               timestep);
     }
 
 namespace detail
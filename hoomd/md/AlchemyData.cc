@@ -3,6 +3,8 @@
 
 #include "AlchemyData.h"
 
+#include <pybind11/stl.h>
+
 PYBIND11_MAKE_OPAQUE(std::vector<std::shared_ptr<hoomd::md::AlchemicalMDParticle>>);
 
 namespace hoomd
@@ -28,7 +30,8 @@ void export_AlchemicalMDParticles(pybind11::module& m)
 
     pybind11::class_<AlchemicalPairParticle,
                      AlchemicalMDParticle,
-                     std::shared_ptr<AlchemicalPairParticle>>(m, "AlchemicalPairParticle");
+                     std::shared_ptr<AlchemicalPairParticle>>(m, "AlchemicalPairParticle")
+        .def_readwrite("alpha_samples", &AlchemicalPairParticle::alpha_samples);
 
     pybind11::class_<AlchemicalNormalizedPairParticle,
                      AlchemicalPairParticle,
@@ -15,6 +15,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <pybind11/stl_bind.h>
 
@@ -138,6 +139,7 @@ struct AlchemicalPairParticle : AlchemicalMDParticle
                            int3 type_pair_param)
         : AlchemicalMDParticle(exec_conf), m_type_pair_param(type_pair_param) {};
     int3 m_type_pair_param;
+    std::vector<Scalar> alpha_samples; //!< Values of alpha to evaluate the pair energy at
     };
 
 struct AlchemicalNormalizedPairParticle : AlchemicalPairParticle
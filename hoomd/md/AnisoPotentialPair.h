@@ -13,6 +13,7 @@
 #include <hip/hip_runtime.h>
 #endif
 
+#include "ForceThreadBuffers.h"
 #include "NeighborList.h"
 #include "hoomd/ForceCompute.h"
 
@@ -201,6 +202,9 @@ template<class aniso_evaluator> class AnisoPotentialPair : public ForceCompute
         return true;
         }
 
+    /// Get the fraction of the neighbor pairs within r_cut that the evaluator culls
+    Scalar getCulledPairFraction();
+
     /// Start autotuning kernel launch parameters
     virtual void startAutotuning()
         {
@@ -234,6 +238,9 @@ template<class aniso_evaluator> class AnisoPotentialPair : public ForceCompute
     /// r_cut (not squared) given to the neighbor list
     std::shared_ptr<GlobalArray<Scalar>> m_r_cut_nlist;
 
+    /// Per-thread force buffers for the CPU force loop with a half neighbor list
+    detail::ForceThreadBuffers m_thread_buffers;
+
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
     };
@@ -513,157 +520,185 @@ void AnisoPotentialPair<aniso_evaluator>::computeForces(uint64_t timestep)
         PDataFlags flags = this->m_pdata->getFlags();
         bool compute_virial = flags[pdata_flag::pressure_tensor];
 
-        // for each particle
-        for (int i = 0; i < (int)m_pdata->getN(); i++)
-            {
-            // access the particle's position and type (MEM TRANSFER: 4 scalars)
-            Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-            Scalar4 quat_i = h_orientation.data[i];
-
-            // sanity check
-            assert(typei < m_pdata->getNTypes());
-
-            // access charge (if needed)
-            Scalar qi = Scalar(0.0);
-            if (aniso_evaluator::needsCharge())
-                qi = h_charge.data[i];
-
-            // initialize current particle force, torque, potential energy, and virial to 0
-            Scalar fxi = Scalar(0.0);
-            Scalar fyi = Scalar(0.0);
-            Scalar fzi = Scalar(0.0);
-            Scalar txi = Scalar(0.0);
-            Scalar tyi = Scalar(0.0);
-            Scalar tzi = Scalar(0.0);
-            Scalar pei = Scalar(0.0);
-            Scalar virialxxi = 0.0;
-            Scalar virialxyi = 0.0;
-            Scalar virialxzi = 0.0;
-            Scalar virialyyi = 0.0;
-            Scalar virialyzi = 0.0;
-            Scalar virialzzi = 0.0;
-
-            // loop over all of the neighbors of this particle
-            const size_t myHead = h_head_list.data[i];
-            const unsigned int size = (unsigned int)h_n_neigh.data[i];
-            for (unsigned int k = 0; k < size; k++)
+        // loop over the particles in [begin, end) and add their forces to the given arrays
+        auto compute_range
+            = [&](unsigned int begin, unsigned int end, const detail::ForceOutput& out)
+        {
+            for (unsigned int i = begin; i < end; i++)
                 {
-                // access the index of this neighbor (MEM TRANSFER: 1 scalar)
-                unsigned int j = h_nlist.data[myHead + k];
-                assert(j < m_pdata->getN() + m_pdata->getNGhosts());
+                // access the particle's position and type (MEM TRANSFER: 4 scalars)
+                Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+                unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+                Scalar4 quat_i = h_orientation.data[i];
 
-                // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
-                Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
-                Scalar3 dx = pi - pj;
-                Scalar4 quat_j = h_orientation.data[j];
-
-                // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
-                unsigned int typej = __scalar_as_int(h_pos.data[j].w);
-                assert(typej < m_pdata->getNTypes());
+                // sanity check
+                assert(typei < m_pdata->getNTypes());
 
                 // access charge (if needed)
-                Scalar qj = Scalar(0.0);
-                if (aniso_evaluator::needsCharge())
-                    qj = h_charge.data[j];
-
-                // apply periodic boundary conditions
-                dx = box.minImage(dx);
-
-                // get parameters for this type pair
-                unsigned int typpair_idx = m_typpair_idx(typei, typej);
-                const param_type& param = m_params[typpair_idx];
-                Scalar rcutsq = h_rcutsq.data[typpair_idx];
-
-                // design specifies that energies are shifted if
-                // shift mode is set to shift
-                bool energy_shift = false;
-                if (m_shift_mode == shift)
-                    energy_shift = true;
-
-                // compute the force and potential energy
-                Scalar3 force = make_scalar3(0.0, 0.0, 0.0);
-                Scalar3 torque_i = make_scalar3(0.0, 0.0, 0.0);
-                Scalar3 torque_j = make_scalar3(0.0, 0.0, 0.0);
-
-                Scalar pair_eng = Scalar(0.0);
-
-                aniso_evaluator eval(dx, quat_i, quat_j, rcutsq, param);
-
+                Scalar qi = Scalar(0.0);
                 if (aniso_evaluator::needsCharge())
-                    eval.setCharge(qi, qj);
-                if (aniso_evaluator::needsShape())
-                    eval.setShape(&m_shape_params[typei], &m_shape_params[typej]);
-                if (aniso_evaluator::needsTags())
-                    eval.setTags(h_tag.data[i], h_tag.data[j]);
-
-                bool evaluated = eval.evaluate(force, pair_eng, energy_shift, torque_i, torque_j);
-
-                if (evaluated)
+                    qi = h_charge.data[i];
+
+                // initialize current particle force, torque, potential energy, and virial to 0
+                Scalar fxi = Scalar(0.0);
+                Scalar fyi = Scalar(0.0);
+                Scalar fzi = Scalar(0.0);
+                Scalar txi = Scalar(0.0);
+                Scalar tyi = Scalar(0.0);
+                Scalar tzi = Scalar(0.0);
+                Scalar pei = Scalar(0.0);
+                Scalar virialxxi = 0.0;
+                Scalar virialxyi = 0.0;
+                Scalar virialxzi = 0.0;
+                Scalar virialyyi = 0.0;
+                Scalar virialyzi = 0.0;
+                Scalar virialzzi = 0.0;
+
+                // loop over all of the neighbors of this particle
+                const size_t myHead = h_head_list.data[i];
+                const unsigned int size = (unsigned int)h_n_neigh.data[i];
+                for (unsigned int k = 0; k < size; k++)
                     {
-                    Scalar3 force2 = Scalar(0.5) * force;
-
-                    // add the force, potential energy and virial to the particle i
-                    // (FLOPS: 8)
-                    fxi += force.x;
-                    fyi += force.y;
-                    fzi += force.z;
-                    txi += torque_i.x;
-                    tyi += torque_i.y;
-                    tzi += torque_i.z;
-                    pei += pair_eng * Scalar(0.5);
-
-                    if (compute_virial)
+                    // access the index of this neighbor (MEM TRANSFER: 1 scalar)
+                    unsigned int j = h_nlist.data[myHead + k];
+                    assert(j < m_pdata->getN() + m_pdata->getNGhosts());
+
+                    // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
+                    Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+                    Scalar3 dx = pi - pj;
+                    Scalar4 quat_j = h_orientation.data[j];
+
+                    // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
+                    unsigned int typej = __scalar_as_int(h_pos.data[j].w);
+                    assert(typej < m_pdata->getNTypes());
+
+                    // access charge (if needed)
+                    Scalar qj = Scalar(0.0);
+                    if (aniso_evaluator::needsCharge())
+                        qj = h_charge.data[j];
+
+                    // apply periodic boundary conditions
+                    dx = box.minImage(dx);
+
+                    // get parameters for this type pair
+                    unsigned int typpair_idx = m_typpair_idx(typei, typej);
+                    const param_type& param = m_params[typpair_idx];
+                    Scalar rcutsq = h_rcutsq.data[typpair_idx];
+
+                    // design specifies that energies are shifted if
+                    // shift mode is set to shift
+                    bool energy_shift = false;
+                    if (m_shift_mode == shift)
+                        energy_shift = true;
+
+                    // compute the force and potential energy
+                    Scalar3 force = make_scalar3(0.0, 0.0, 0.0);
+                    Scalar3 torque_i = make_scalar3(0.0, 0.0, 0.0);
+                    Scalar3 torque_j = make_scalar3(0.0, 0.0, 0.0);
+
+                    Scalar pair_eng = Scalar(0.0);
+
+                    aniso_evaluator eval(dx, quat_i, quat_j, rcutsq, param);
+
+                    if (aniso_evaluator::needsCharge())
+                        eval.setCharge(qi, qj);
+                    if (aniso_evaluator::needsShape())
+                        eval.setShape(&m_shape_params[typei], &m_shape_params[typej]);
+                    if (aniso_evaluator::needsTags())
+                        eval.setTags(h_tag.data[i], h_tag.data[j]);
+
+                    bool evaluated
+                        = eval.evaluate(force, pair_eng, energy_shift, torque_i, torque_j);
+
+                    if (evaluated)
                         {
-                        virialxxi += dx.x * force2.x;
-                        virialxyi += dx.y * force2.x;
-                        virialxzi += dx.z * force2.x;
-                        virialyyi += dx.y * force2.y;
-                        virialyzi += dx.z * force2.y;
-                        virialzzi += dx.z * force2.z;
-                        }
+                        Scalar3 force2 = Scalar(0.5) * force;
+
+                        // add the force, potential energy and virial to the particle i
+                        // (FLOPS: 8)
+                        fxi += force.x;
+                        fyi += force.y;
+                        fzi += force.z;
+                        txi += torque_i.x;
+                        tyi += torque_i.y;
+                        tzi += torque_i.z;
+                        pei += pair_eng * Scalar(0.5);
 
-                    // add the force to particle j if we are using the third law (MEM TRANSFER: 10
-                    // scalars / FLOPS: 8)
-                    if (third_law)
-                        {
-                        h_force.data[j].x -= force.x;
-                        h_force.data[j].y -= force.y;
-                        h_force.data[j].z -= force.z;
-                        h_torque.data[j].x += torque_j.x;
-                        h_torque.data[j].y += torque_j.y;
-                        h_torque.data[j].z += torque_j.z;
-                        h_force.data[j].w += pair_eng * Scalar(0.5);
                         if (compute_virial)
                             {
-                            h_virial.data[0 * m_virial_pitch + j] += dx.x * force2.x;
-                            h_virial.data[1 * m_virial_pitch + j] += dx.y * force2.x;
-                            h_virial.data[2 * m_virial_pitch + j] += dx.z * force2.x;
-                            h_virial.data[3 * m_virial_pitch + j] += dx.y * force2.y;
-                            h_virial.data[4 * m_virial_pitch + j] += dx.z * force2.y;
-                            h_virial.data[5 * m_virial_pitch + j] += dx.z * force2.z;
+                            virialxxi += dx.x * force2.x;
+                            virialxyi += dx.y * force2.x;
+                            virialxzi += dx.z * force2.x;
+                            virialyyi += dx.y * force2.y;
+                            virialyzi += dx.z * force2.y;
+                            virialzzi += dx.z * force2.z;
+                            }
+
+                        // add the force to particle j if we are using the third law (MEM TRANSFER:
+                        // 10 scalars / FLOPS: 8)
+                        if (third_law)
+                            {
+                            out.force[j].x -= force.x;
+                            out.force[j].y -= force.y;
+                            out.force[j].z -= force.z;
+                            out.torque[j].x += torque_j.x;
+                            out.torque[j].y += torque_j.y;
+                            out.torque[j].z += torque_j.z;
+                            out.force[j].w += pair_eng * Scalar(0.5);
+                            if (compute_virial)
+                                {
+                                out.virial[0 * out.virial_pitch + j] += dx.x * force2.x;
+                                out.virial[1 * out.virial_pitch + j] += dx.y * force2.x;
+                                out.virial[2 * out.virial_pitch + j] += dx.z * force2.x;
+                                out.virial[3 * out.virial_pitch + j] += dx.y * force2.y;
+                                out.virial[4 * out.virial_pitch + j] += dx.z * force2.y;
+                                out.virial[5 * out.virial_pitch + j] += dx.z * force2.z;
+                                }
                             }
                         }
                     }
-                }
 
-            // finally, increment the force, potential energy and virial for particle i
-            h_force.data[i].x += fxi;
-            h_force.data[i].y += fyi;
-            h_force.data[i].z += fzi;
-            h_torque.data[i].x += txi;
-            h_torque.data[i].y += tyi;
-            h_torque.data[i].z += tzi;
-            h_force.data[i].w += pei;
-            if (compute_virial)
-                {
-                h_virial.data[0 * m_virial_pitch + i] += virialxxi;
-                h_virial.data[1 * m_virial_pitch + i] += virialxyi;
-                h_virial.data[2 * m_virial_pitch + i] += virialxzi;
-                h_virial.data[3 * m_virial_pitch + i] += virialyyi;
-                h_virial.data[4 * m_virial_pitch + i] += virialyzi;
-                h_virial.data[5 * m_virial_pitch + i] += virialzzi;
+                // finally, increment the force, potential energy and virial for particle i
+                out.force[i].x += fxi;
+                out.force[i].y += fyi;
+                out.force[i].z += fzi;
+                out.torque[i].x += txi;
+                out.torque[i].y += tyi;
+                out.torque[i].z += tzi;
+                out.force[i].w += pei;
+                if (compute_virial)
+                    {
+                    out.virial[0 * out.virial_pitch + i] += virialxxi;
+                    out.virial[1 * out.virial_pitch + i] += virialxyi;
+                    out.virial[2 * out.virial_pitch + i] += virialxzi;
+                    out.virial[3 * out.virial_pitch + i] += virialyyi;
+                    out.virial[4 * out.virial_pitch + i] += virialyzi;
+                    out.virial[5 * out.virial_pitch + i] += virialzzi;
+                    }
                 }
+        };
+
+        // with a full list, each particle only adds to its own force, so the particles are split
+        // over the threads directly. with a half list, each thread accumulates into its own
+        // buffer.
+        const detail::ForceOutput out = {h_force.data,
+                                         h_torque.data,
+                                         compute_virial ? h_virial.data : nullptr,
+                                         m_virial_pitch};
+        if (third_law)
+            {
+            m_thread_buffers.run(*m_exec_conf,
+                                 m_pdata->getN(),
+                                 m_pdata->getN() + m_pdata->getNGhosts(),
+                                 out,
+                                 compute_range);
+            }
+        else
+            {
+            hoomd::detail::parallelForEach(*m_exec_conf,
+                                    m_pdata->getN(),
+                                    [&](unsigned int begin, unsigned int end)
+                                    { compute_range(begin, end, out); });
             }
         }
     }
@@ -691,6 +726,86 @@ CommFlags AnisoPotentialPair<aniso_evaluator>::getRequestedCommFlags(uint64_t ti
     }
 #endif
 
+/*! Evaluators return false for pairs that do not interact. Pairs within r_cut that the evaluator
+    rejects without a full evaluation, such as the pairs beyond contact range that
+    EvaluatorPairALJ culls with its oriented bounding boxes, are counted over the current neighbor
+    list. Every pair is evaluated on the host, so this is meant for occasional logging only.
+
+    \returns The fraction of the pairs within r_cut that the evaluator culls, summed over all ranks
+*/
+template<class aniso_evaluator> Scalar AnisoPotentialPair<aniso_evaluator>::getCulledPairFraction()
+    {
+    ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
+                                        access_location::host,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
+                                    access_location::host,
+                                    access_mode::read);
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_rcutsq(m_rcutsq, access_location::host, access_mode::read);
+
+    const BoxDim box = m_pdata->getBox();
+    unsigned long long n_pairs[2] = {0, 0};
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+        Scalar4 quat_i = h_orientation.data[i];
+
+        const size_t myHead = h_head_list.data[i];
+        const unsigned int size = (unsigned int)h_n_neigh.data[i];
+        for (unsigned int k = 0; k < size; k++)
+            {
+            unsigned int j = h_nlist.data[myHead + k];
+            Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+            Scalar3 dx = box.minImage(pi - pj);
+            Scalar4 quat_j = h_orientation.data[j];
+            unsigned int typej = __scalar_as_int(h_pos.data[j].w);
+
+            unsigned int typpair_idx = m_typpair_idx(typei, typej);
+            Scalar rcutsq = h_rcutsq.data[typpair_idx];
+            if (dot(dx, dx) >= rcutsq)
+                continue;
+
+            aniso_evaluator eval(dx, quat_i, quat_j, rcutsq, m_params[typpair_idx]);
+            if (aniso_evaluator::needsCharge())
+                eval.setCharge(h_charge.data[i], h_charge.data[j]);
+            if (aniso_evaluator::needsShape())
+                eval.setShape(&m_shape_params[typei], &m_shape_params[typej]);
+            if (aniso_evaluator::needsTags())
+                eval.setTags(h_tag.data[i], h_tag.data[j]);
+
+            Scalar3 force, torque_i, torque_j;
+            Scalar pair_eng;
+            n_pairs[0]++;
+            if (!eval.evaluate(force, pair_eng, m_shift_mode == shift, torque_i, torque_j))
+                n_pairs[1]++;
+            }
+        }
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      n_pairs,
+                      2,
+                      MPI_UNSIGNED_LONG_LONG,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    return n_pairs[0] > 0 ? Scalar(n_pairs[1]) / Scalar(n_pairs[0]) : Scalar(0);
+    }
+
 namespace detail
     {
 //! Export this pair potential to python
@@ -712,7 +827,8 @@ template<class T> void export_AnisoPotentialPair(pybind11::module& m, const std:
         .def_property("mode",
                       &AnisoPotentialPair<T>::getShiftMode,
                       &AnisoPotentialPair<T>::setShiftModePython)
-        .def("getTypeShapesPy", &AnisoPotentialPair<T>::getTypeShapesPy);
+        .def("getTypeShapesPy", &AnisoPotentialPair<T>::getTypeShapesPy)
+        .def("getCulledPairFraction", &AnisoPotentialPair<T>::getCulledPairFraction);
     }
 
     } // end namespace detail
@@ -119,15 +119,23 @@ struct a_pair_args_t
     \param d_nlist Device memory array containing the neighbor list contents
     \param d_head_list Device memory array listing beginning of each particle's neighbors
     \param d_params Parameters for the potential, stored per type pair
+    \param d_shape_params Shape parameters for the potential, stored per type
     \param d_rcutsq rcut squared, stored per type pair
     \param ntypes Number of types in the simulation
+    \param offset Index of the first particle
+    \param max_extra_bytes Size of the shared memory available for the dynamic parameter data
+    \param shape_in_shared If true, \a d_shape_params are cached in shared memory
     \param tpp Number of threads per particle
 
     \a d_params and \a d_rcutsq must be indexed with an Index2DUpperTriangular(typei, typej) to
    access the unique value for that type pair. These values are all cached into shared memory for
    quick access, so a dynamic amount of shared memory must be allocated for this kernel launch. The
    amount is (2*sizeof(Scalar) + sizeof(typename evaluator::param_type)) *
-   typpair_idx.getNumElements()
+   typpair_idx.getNumElements(), plus sizeof(typename evaluator::shape_type) * ntypes when
+   \a shape_in_shared is true. The dynamic data of the parameters (such as the vertices of the ALJ
+   shapes) is then loaded into the remaining \a max_extra_bytes for as many types as fit, and
+   arrays that do not fit are read from global memory. When the shape parameters do not fit in
+   shared memory at all, they are read from global memory with their dynamic data.
 
     Certain options are controlled via template parameters to avoid the performance hit when they
    are not enabled. \tparam evaluator EvaluatorPair class to evaluate V(r) and -delta V(r)/r \tparam
@@ -160,7 +168,8 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
                                      const Scalar* d_rcutsq,
                                      const unsigned int ntypes,
                                      const unsigned int offset,
-                                     unsigned int max_extra_bytes)
+                                     unsigned int max_extra_bytes,
+                                     const bool shape_in_shared)
     {
     Index2D typpair_idx(ntypes);
     const unsigned int num_typ_parameters = typpair_idx.getNumElements();
@@ -171,7 +180,8 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
     Scalar* s_rcutsq
         = (Scalar*)(&s_data[num_typ_parameters * sizeof(typename evaluator::param_type)]);
     typename evaluator::shape_type* s_shape_params
-        = (typename evaluator::shape_type*)(&s_rcutsq[num_typ_parameters]);
+        = shape_in_shared ? (typename evaluator::shape_type*)(&s_rcutsq[num_typ_parameters])
+                          : const_cast<typename evaluator::shape_type*>(d_shape_params);
 
     // load in the per type pair parameters
     for (unsigned int cur_offset = 0; cur_offset < num_typ_parameters; cur_offset += blockDim.x)
@@ -192,7 +202,8 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
             }
         }
 
-    unsigned int shape_param_size = sizeof(typename evaluator::shape_type) * ntypes / sizeof(int);
+    unsigned int shape_param_size
+        = shape_in_shared ? sizeof(typename evaluator::shape_type) * ntypes / sizeof(int) : 0;
     for (unsigned int cur_offset = 0; cur_offset < shape_param_size; cur_offset += blockDim.x)
         {
         if (cur_offset + threadIdx.x < shape_param_size)
@@ -204,14 +215,21 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
     __syncthreads();
 
     // initialize extra shared mem
-    char* s_extra = (char*)(s_shape_params + ntypes);
+    char* s_extra = (char*)(&s_rcutsq[num_typ_parameters]);
+    if (shape_in_shared)
+        s_extra = (char*)(s_shape_params + ntypes);
 
     unsigned int available_bytes = max_extra_bytes;
     for (unsigned int cur_pair = 0; cur_pair < typpair_idx.getNumElements(); ++cur_pair)
         s_params[cur_pair].load_shared(s_extra, available_bytes);
 
-    for (unsigned int cur_type = 0; cur_type < ntypes; ++cur_type)
-        s_shape_params[cur_type].load_shared(s_extra, available_bytes);
+    // shape parameters in global memory are shared by all blocks and must not be redirected
+    if (shape_in_shared)
+        {
+        for (unsigned int cur_type = 0; cur_type < ntypes; ++cur_type)
+            s_shape_params[cur_type].load_shared(s_extra, available_bytes);
+        }
+    __syncthreads();
 
     // start by identifying which particle we are to handle
     unsigned int idx;
@@ -421,8 +439,8 @@ struct AnisoPairForceComputeKernel
 
             Index2D typpair_idx(pair_args.ntypes);
             size_t shared_bytes = (2 * sizeof(Scalar) + sizeof(typename evaluator::param_type))
-                                      * typpair_idx.getNumElements()
-                                  + sizeof(typename evaluator::shape_type) * pair_args.ntypes;
+                                  * typpair_idx.getNumElements();
+            const size_t shape_bytes = sizeof(typename evaluator::shape_type) * pair_args.ntypes;
 
             unsigned int max_block_size;
             hipFuncAttributes attr;
@@ -436,6 +454,13 @@ struct AnisoPairForceComputeKernel
             // number of threads has to be multiple of warp size
             max_block_size = max_threads - max_threads % gpu_aniso_pair_force_max_tpp;
 
+            // cache the shape parameters only if they fit next to the pair parameters, and
+            // otherwise read them from global memory
+            bool shape_in_shared = shared_bytes + shape_bytes + attr.sharedSizeBytes
+                                   <= pair_args.devprop.sharedMemPerBlock;
+            if (shape_in_shared)
+                shared_bytes += shape_bytes;
+
             unsigned int base_shared_bytes;
             base_shared_bytes = (unsigned int)(shared_bytes + attr.sharedSizeBytes);
 
@@ -455,7 +480,7 @@ struct AnisoPairForceComputeKernel
                 {
                 params[i].allocate_shared(ptr, available_bytes);
                 }
-            for (unsigned int i = 0; i < pair_args.ntypes; ++i)
+            for (unsigned int i = 0; shape_in_shared && i < pair_args.ntypes; ++i)
                 {
                 shape_params[i].allocate_shared(ptr, available_bytes);
                 }
@@ -490,7 +515,8 @@ struct AnisoPairForceComputeKernel
                 pair_args.d_rcutsq,
                 pair_args.ntypes,
                 offset,
-                max_extra_bytes);
+                max_extra_bytes,
+                shape_in_shared);
             }
         else
             {
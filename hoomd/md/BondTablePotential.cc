@@ -21,7 +21,8 @@ namespace md
 */
 BondTablePotential::BondTablePotential(std::shared_ptr<SystemDefinition> sysdef,
                                        unsigned int table_width)
-    : ForceCompute(sysdef), m_table_width(table_width)
+    : ForceCompute(sysdef), m_table_width(table_width),
+      m_interpolation(detail::table_interpolation::linear)
     {
     m_exec_conf->msg->notice(5) << "Constructing BondTablePotential" << endl;
 
@@ -179,6 +180,10 @@ void BondTablePotential::computeForces(uint64_t timestep)
     // access the table data
     ArrayHandle<Scalar2> h_tables(m_tables, access_location::host, access_mode::read);
     ArrayHandle<Scalar4> h_params(m_params, access_location::host, access_mode::read);
+    const detail::TableInterpolator interpolator(h_tables.data,
+                                                 m_table_value,
+                                                 m_table_width,
+                                                 m_interpolation);
 
     // for each of the bonds
     const unsigned int size = (unsigned int)m_bond_data->getN();
@@ -231,24 +236,9 @@ void BondTablePotential::computeForces(uint64_t timestep)
             // precomputed term
             Scalar value_f = (r - rmin) / delta_r;
 
-            // compute index into the table and read in values
-
-            /// Here we use the table!!
-            unsigned int value_i = (unsigned int)floor(value_f);
-            Scalar2 VF0 = h_tables.data[m_table_value(value_i, type)];
-            Scalar2 VF1 = h_tables.data[m_table_value(value_i + 1, type)];
-            // unpack the data
-            Scalar V0 = VF0.x;
-            Scalar V1 = VF1.x;
-            Scalar F0 = VF0.y;
-            Scalar F1 = VF1.y;
-
-            // compute the linear interpolation coefficient
-            Scalar f = value_f - Scalar(value_i);
-
-            // interpolate to get V and F;
-            Scalar V = V0 + f * (V1 - V0);
-            Scalar F = F0 + f * (F1 - F0);
+            // interpolate to get V and F
+            Scalar V, F;
+            interpolator.evaluate(V, F, value_f, type, delta_r);
 
             // convert to standard variables used by the other pair computes in HOOMD-blue
             Scalar force_divr = Scalar(0.0);
@@ -299,6 +289,9 @@ void export_BondTablePotential(pybind11::module& m)
         "BondTablePotential")
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, unsigned int>())
         .def_property_readonly("width", &BondTablePotential::getWidth)
+        .def_property("interpolation",
+                      &BondTablePotential::getInterpolation,
+                      &BondTablePotential::setInterpolation)
         .def("setParams", &BondTablePotential::setParamsPython)
         .def("getParams", &BondTablePotential::getParams);
     }
@@ -94,6 +94,7 @@ void BondTablePotentialGPU::computeForces(uint64_t timestep)
                                              d_params.data,
                                              m_table_width,
                                              m_table_value,
+                                             m_interpolation,
                                              d_flags.data,
                                              m_tuner->getParam()[0],
                                              m_exec_conf->dev_prop);
@@ -34,7 +34,7 @@ namespace kernel
     \param n_bonds_list List of numbers of bonds stored on the GPU
     \param n_bond_type number of bond types
     \param d_params Parameters for each table associated with a type pair
-    \param table_value index helper function
+    \param interpolator Interpolator of the tables
     \param d_flags Flag allocated on the device for use in checking for bonds that cannot be
    evaluated
 
@@ -50,9 +50,8 @@ __global__ void gpu_compute_bondtable_forces_kernel(Scalar4* d_force,
                                                     size_t pitch,
                                                     const unsigned int* n_bonds_list,
                                                     const unsigned int n_bond_type,
-                                                    const Scalar2* d_tables,
                                                     const Scalar4* d_params,
-                                                    const Index2D table_value,
+                                                    const detail::TableInterpolator interpolator,
                                                     unsigned int* d_flags)
     {
     // read in params for easy and fast access in the kernel
@@ -118,23 +117,9 @@ __global__ void gpu_compute_bondtable_forces_kernel(Scalar4* d_force,
             // precomputed term
             Scalar value_f = (r - rmin) / delta_r;
 
-            // compute index into the table and read in values
-            unsigned int value_i = floor(value_f);
-
-            Scalar2 VF0 = __ldg(d_tables + table_value(value_i, cur_bond_type));
-            Scalar2 VF1 = __ldg(d_tables + table_value(value_i + 1, cur_bond_type));
-            // unpack the data
-            Scalar V0 = VF0.x;
-            Scalar V1 = VF1.x;
-            Scalar F0 = VF0.y;
-            Scalar F1 = VF1.y;
-
-            // compute the linear interpolation coefficient
-            Scalar f = value_f - Scalar(value_i);
-
-            // interpolate to get V and F;
-            Scalar V = V0 + f * (V1 - V0);
-            Scalar F = F0 + f * (F1 - F0);
+            // interpolate to get V and F
+            Scalar V, F;
+            interpolator.evaluate(V, F, value_f, cur_bond_type, delta_r);
 
             // convert to standard variables used by the other pair computes in HOOMD-blue
             Scalar forcemag_divr = 0.0f;
@@ -182,6 +167,7 @@ __global__ void gpu_compute_bondtable_forces_kernel(Scalar4* d_force,
     \param d_params Parameters for each table associated with a type pair
     \param table_width Number of entries in the table
     \param table_value indexer helper
+    \param interpolation Interpolation between table points
     \param d_flags flags on the device - a 1 will be written if evaluation
                    of forces failed for any bond
     \param block_size Block size at which to run the kernel
@@ -203,6 +189,7 @@ hipError_t gpu_compute_bondtable_forces(Scalar4* d_force,
                                         const Scalar4* d_params,
                                         const unsigned int table_width,
                                         const Index2D& table_value,
+                                        const detail::table_interpolation interpolation,
                                         unsigned int* d_flags,
                                         const unsigned int block_size,
                                         const hipDeviceProp_t& devprop)
@@ -245,9 +232,8 @@ hipError_t gpu_compute_bondtable_forces(Scalar4* d_force,
                        pitch,
                        n_bonds_list,
                        n_bond_type,
-                       d_tables,
                        d_params,
-                       table_value,
+                       detail::TableInterpolator(d_tables, table_value, table_width, interpolation),
                        d_flags);
 
     return hipSuccess;
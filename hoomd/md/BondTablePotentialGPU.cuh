@@ -11,6 +11,8 @@
 #include "hoomd/Index1D.h"
 #include "hoomd/ParticleData.cuh"
 
+#include "TableInterpolator.h"
+
 #ifndef __BONDTABLEPOTENTIALGPU_CUH__
 #define __BONDTABLEPOTENTIALGPU_CUH__
 
@@ -35,6 +37,7 @@ hipError_t gpu_compute_bondtable_forces(Scalar4* d_force,
                                         const Scalar4* d_params,
                                         const unsigned int table_width,
                                         const Index2D& table_value,
+                                        const detail::table_interpolation interpolation,
                                         unsigned int* d_flags,
                                         const unsigned int block_size,
                                         const hipDeviceProp_t& devprop);
@@ -202,7 +202,62 @@ template<typename T> void CommunicatorGrid<T>::initGridComm()
     m_recv_buf.swap(recv_buf);
     }
 
-template<typename T> void CommunicatorGrid<T>::communicate(const GlobalArray<T>& grid)
+/*! The buffers are accessed on the host only while the messages are posted. Nothing else accesses
+    them until waitMessages() returns, so their host memory stays valid while the messages are in
+    flight.
+ */
+template<typename T> void CommunicatorGrid<T>::postMessages()
+    {
+    assert(m_reqs.empty());
+
+    // access send and recv buffers
+    ArrayHandle<T> h_send_buf(m_send_buf, access_location::host, access_mode::read);
+    ArrayHandle<T> h_recv_buf(m_recv_buf, access_location::host, access_mode::overwrite);
+
+    typedef std::map<unsigned int, unsigned int>::iterator it_t;
+    m_reqs.resize(2 * m_neighbors.size());
+
+    unsigned int n = 0;
+    for (std::set<unsigned int>::iterator it = m_neighbors.begin(); it != m_neighbors.end(); it++)
+        {
+        it_t b = m_begin.find(*it);
+        assert(b != m_begin.end());
+        it_t e = m_end.find(*it);
+        assert(e != m_end.end());
+
+        unsigned int offs = b->second;
+        unsigned int n_elem = e->second - b->second;
+
+        MPI_Isend(&h_send_buf.data[offs],
+                  int(n_elem * sizeof(T)),
+                  MPI_BYTE,
+                  *it,
+                  0,
+                  m_exec_conf->getMPICommunicator(),
+                  &m_reqs[n++]);
+        MPI_Irecv(&h_recv_buf.data[offs],
+                  int(n_elem * sizeof(T)),
+                  MPI_BYTE,
+                  *it,
+                  0,
+                  m_exec_conf->getMPICommunicator(),
+                  &m_reqs[n++]);
+        }
+    }
+
+template<typename T> void CommunicatorGrid<T>::waitMessages()
+    {
+    if (!m_reqs.empty())
+        {
+        std::vector<MPI_Status> stat(m_reqs.size());
+        MPI_Waitall((unsigned int)m_reqs.size(), &m_reqs.front(), &stat.front());
+        }
+    m_reqs.clear();
+    }
+
+/*! \param grid Grid to communicate
+ */
+template<typename T> void CommunicatorGrid<T>::beginCommunicate(const GlobalArray<T>& grid)
     {
     assert(grid.getNumElements() >= m_embed.x * m_embed.y * m_embed.z);
 
@@ -217,45 +272,14 @@ template<typename T> void CommunicatorGrid<T>::communicate(const GlobalArray<T>&
             h_send_buf.data[i] = h_grid.data[h_send_idx.data[i]];
         }
 
-        {
-        // access send and recv buffers
-        ArrayHandle<T> h_send_buf(m_send_buf, access_location::host, access_mode::read);
-        ArrayHandle<T> h_recv_buf(m_recv_buf, access_location::host, access_mode::overwrite);
-
-        typedef std::map<unsigned int, unsigned int>::iterator it_t;
-        std::vector<MPI_Request> reqs(2 * m_neighbors.size());
-
-        unsigned int n = 0;
-        for (std::set<unsigned int>::iterator it = m_neighbors.begin(); it != m_neighbors.end();
-             it++)
-            {
-            it_t b = m_begin.find(*it);
-            assert(b != m_begin.end());
-            it_t e = m_end.find(*it);
-            assert(e != m_end.end());
-
-            unsigned int offs = b->second;
-            unsigned int n_elem = e->second - b->second;
-
-            MPI_Isend(&h_send_buf.data[offs],
-                      int(n_elem * sizeof(T)),
-                      MPI_BYTE,
-                      *it,
-                      0,
-                      m_exec_conf->getMPICommunicator(),
-                      &reqs[n++]);
-            MPI_Irecv(&h_recv_buf.data[offs],
-                      int(n_elem * sizeof(T)),
-                      MPI_BYTE,
-                      *it,
-                      0,
-                      m_exec_conf->getMPICommunicator(),
-                      &reqs[n++]);
-            }
-
-        std::vector<MPI_Status> stat(reqs.size());
-        MPI_Waitall((unsigned int)reqs.size(), &reqs.front(), &stat.front());
-        }
+    postMessages();
+    }
+
+/*! \param grid Grid to communicate, the same that was passed to beginCommunicate()
+ */
+template<typename T> void CommunicatorGrid<T>::finishCommunicate(const GlobalArray<T>& grid)
+    {
+    waitMessages();
 
         {
         ArrayHandle<T> h_recv_buf(m_recv_buf, access_location::host, access_mode::read);
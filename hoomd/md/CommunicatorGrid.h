@@ -8,6 +8,7 @@
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/SystemDefinition.h"
 #include <memory>
+#include <vector>
 
 #ifdef ENABLE_MPI
 
@@ -16,6 +17,12 @@ namespace hoomd
 namespace md
     {
 /*! Class to communicate the boundary layer of a regular grid
+
+    The communication can be split into two phases, so that the caller can do work that does not
+    depend on the boundary layer while the messages are in flight. beginCommunicate() gathers the
+    boundary layer and posts the non-blocking sends and receives, and finishCommunicate() waits for
+    them and scatters the received cells into the grid. The grid must not be accessed between the
+    two calls, and only one communication per CommunicatorGrid can be in flight at a time.
  */
 template<typename T> class CommunicatorGrid
     {
@@ -30,7 +37,17 @@ template<typename T> class CommunicatorGrid
     virtual ~CommunicatorGrid() { }
 
     //! Communicate grid
-    virtual void communicate(const GlobalArray<T>& grid);
+    virtual void communicate(const GlobalArray<T>& grid)
+        {
+        beginCommunicate(grid);
+        finishCommunicate(grid);
+        }
+
+    //! Start communicating the grid
+    virtual void beginCommunicate(const GlobalArray<T>& grid);
+
+    //! Complete the communication started by beginCommunicate()
+    virtual void finishCommunicate(const GlobalArray<T>& grid);
 
     protected:
     std::shared_ptr<SystemDefinition> m_sysdef;                //!< System definition
@@ -49,9 +66,16 @@ template<typename T> class CommunicatorGrid
     GlobalArray<unsigned int> m_recv_idx;         //!< Indices of grid cells in recv buf
     std::map<unsigned int, unsigned int> m_begin; //!< Begin offset of every rank in send/recv buf
     std::map<unsigned int, unsigned int> m_end;   //!< End offset of every rank in send/recv buf
+    std::vector<MPI_Request> m_reqs;              //!< Requests of the communication in flight
 
     //! Initialize grid communication
     virtual void initGridComm();
+
+    //! Post the sends of the send buffer and the receives into the recv buffer
+    void postMessages();
+
+    //! Wait for the messages posted by postMessages()
+    void waitMessages();
     };
 
     } // end namespace md
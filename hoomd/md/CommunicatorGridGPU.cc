@@ -109,7 +109,9 @@ template<typename T> void CommunicatorGridGPU<T>::initGridCommGPU()
         }
     }
 
-template<typename T> void CommunicatorGridGPU<T>::communicate(const GlobalArray<T>& grid)
+/*! \param grid Grid to communicate
+ */
+template<typename T> void CommunicatorGridGPU<T>::beginCommunicate(const GlobalArray<T>& grid)
     {
     assert(grid.getNumElements() >= this->m_embed.x * this->m_embed.y * this->m_embed.z);
 
@@ -130,47 +132,14 @@ template<typename T> void CommunicatorGridGPU<T>::communicate(const GlobalArray<
             CHECK_CUDA_ERROR();
         }
 
-        {
-        // access send and recv buffers
-        ArrayHandle<T> send_buf_handle(this->m_send_buf, access_location::host, access_mode::read);
-        ArrayHandle<T> recv_buf_handle(this->m_recv_buf,
-                                       access_location::host,
-                                       access_mode::overwrite);
-        typedef std::map<unsigned int, unsigned int>::iterator it_t;
-        std::vector<MPI_Request> reqs(2 * this->m_neighbors.size());
-
-        unsigned int n = 0;
-        for (std::set<unsigned int>::iterator it = this->m_neighbors.begin();
-             it != this->m_neighbors.end();
-             it++)
-            {
-            it_t b = this->m_begin.find(*it);
-            assert(b != this->m_begin.end());
-            it_t e = this->m_end.find(*it);
-            assert(e != this->m_end.end());
-
-            unsigned int offs = b->second;
-            unsigned int n_elem = e->second - b->second;
-
-            MPI_Isend(&send_buf_handle.data[offs],
-                      int(n_elem * sizeof(T)),
-                      MPI_BYTE,
-                      *it,
-                      0,
-                      this->m_exec_conf->getMPICommunicator(),
-                      &reqs[n++]);
-            MPI_Irecv(&recv_buf_handle.data[offs],
-                      int(n_elem * sizeof(T)),
-                      MPI_BYTE,
-                      *it,
-                      0,
-                      this->m_exec_conf->getMPICommunicator(),
-                      &reqs[n++]);
-            }
+    this->postMessages();
+    }
 
-        std::vector<MPI_Status> stat(reqs.size());
-        MPI_Waitall((unsigned int)reqs.size(), &reqs.front(), &stat.front());
-        }
+/*! \param grid Grid to communicate, the same that was passed to beginCommunicate()
+ */
+template<typename T> void CommunicatorGridGPU<T>::finishCommunicate(const GlobalArray<T>& grid)
+    {
+    this->waitMessages();
 
         {
         ArrayHandle<T> d_recv_buf(this->m_recv_buf, access_location::device, access_mode::read);
@@ -24,8 +24,11 @@ template<typename T> class CommunicatorGridGPU : public CommunicatorGrid<T>
                         uint3 offset,
                         bool add_outer_layer_to_inner);
 
-    //! Communicate grid
-    virtual void communicate(const GlobalArray<T>& grid);
+    //! Start communicating the grid
+    virtual void beginCommunicate(const GlobalArray<T>& grid);
+
+    //! Complete the communication started by beginCommunicate()
+    virtual void finishCommunicate(const GlobalArray<T>& grid);
 
     protected:
     unsigned int m_n_unique_recv_cells; //!< Number of unique receiving cells
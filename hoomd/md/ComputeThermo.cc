@@ -25,7 +25,8 @@ namespace md
 */
 ComputeThermo::ComputeThermo(std::shared_ptr<SystemDefinition> sysdef,
                              std::shared_ptr<ParticleGroup> group)
-    : Compute(sysdef), m_group(group)
+    : Compute(sysdef), m_group(group), m_kinetic_energy_only(false),
+      m_computed_kinetic_energy_only(false)
     {
     m_exec_conf->msg->notice(5) << "Constructing ComputeThermo" << endl;
 
@@ -50,12 +51,17 @@ ComputeThermo::ComputeThermo(std::shared_ptr<SystemDefinition> sysdef,
 
 #ifdef ENABLE_MPI
     m_properties_reduced = true;
+    m_reduce_pending = false;
 #endif
     }
 
 ComputeThermo::~ComputeThermo()
     {
     m_exec_conf->msg->notice(5) << "Destroying ComputeThermo" << endl;
+
+#ifdef ENABLE_MPI
+    finishReduceProperties();
+#endif
     }
 
 /*! Calls computeProperties if the properties need updating
@@ -66,9 +72,89 @@ void ComputeThermo::compute(uint64_t timestep)
     Compute::compute(timestep);
     if (shouldCompute(timestep))
         {
+#ifdef ENABLE_MPI
+        // the reduction in flight writes to m_properties
+        finishReduceProperties();
+#endif
+
+        // the HMA sums need the potential energy
+        m_computed_kinetic_energy_only = m_kinetic_energy_only && !m_hma_lattice_site;
         computeProperties();
-        m_computed_flags = m_pdata->getFlags();
+        m_computed_flags = getComputeFlags();
+        }
+    }
+
+/*! \param quantity Name of the loggable quantity in python
+    \returns A function that computes the properties when needed and returns the value of
+        \a quantity
+
+    The scalar quantities that ThermodynamicQuantities logs are available.
+*/
+std::function<Scalar(uint64_t)> ComputeThermo::getLogQuantity(const std::string& quantity)
+    {
+    std::function<Scalar()> value;
+    bool needs_compute = true;
+    if (quantity == "kinetic_temperature")
+        value = [this]() { return getTemperature(); };
+    else if (quantity == "pressure")
+        value = [this]() { return getPressure(); };
+    else if (quantity == "kinetic_energy")
+        value = [this]() { return getKineticEnergy(); };
+    else if (quantity == "translational_kinetic_energy")
+        value = [this]() { return getTranslationalKineticEnergy(); };
+    else if (quantity == "rotational_kinetic_energy")
+        value = [this]() { return getRotationalKineticEnergy(); };
+    else if (quantity == "potential_energy")
+        value = [this]() { return getPotentialEnergy(); };
+    else
+        {
+        // these are available without computing the properties
+        needs_compute = false;
+        if (quantity == "degrees_of_freedom")
+            value = [this]() { return Scalar(getNDOF()); };
+        else if (quantity == "translational_degrees_of_freedom")
+            value = [this]() { return Scalar(getTranslationalDOF()); };
+        else if (quantity == "rotational_degrees_of_freedom")
+            value = [this]() { return Scalar(getRotationalDOF()); };
+        else if (quantity == "num_particles")
+            value = [this]() { return Scalar(getNumParticles()); };
+        else if (quantity == "volume")
+            value = [this]() { return getVolume(); };
+        else
+            return Compute::getLogQuantity(quantity);
+        }
+
+    return [this, value, needs_compute](uint64_t timestep)
+    {
+        if (needs_compute)
+            compute(timestep);
+        return value();
+    };
+    }
+
+/*! \returns The particle data flags, without the pressure tensor when only the kinetic energy is
+    computed
+*/
+PDataFlags ComputeThermo::getComputeFlags()
+    {
+    PDataFlags flags = m_pdata->getFlags();
+    if (m_computed_kinetic_energy_only)
+        {
+        flags[pdata_flag::pressure_tensor] = false;
         }
+    return flags;
+    }
+
+/*! The kinetic energies are the first entries of m_properties, followed by the potential energy
+    and the pressure.
+*/
+unsigned int ComputeThermo::getNumReducedQuantities()
+    {
+    if (m_computed_kinetic_energy_only)
+        {
+        return thermo_index::rotational_kinetic_energy + 1;
+        }
+    return thermo_index::num_quantities;
     }
 
 /*! Computes all thermodynamic properties of the system in one fell swoop.
@@ -99,7 +185,7 @@ void ComputeThermo::computeProperties()
     // total kinetic energy
     double ke_trans_total = 0.0;
 
-    PDataFlags flags = m_pdata->getFlags();
+    PDataFlags flags = getComputeFlags();
 
     double pressure_kinetic_xx = 0.0;
     double pressure_kinetic_xy = 0.0;
@@ -198,18 +284,51 @@ void ComputeThermo::computeProperties()
 
     // total potential energy
     double pe_total = 0.0;
-    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+    if (!m_computed_kinetic_energy_only)
         {
-        unsigned int j = m_group->getMemberIndex(group_idx);
-
-        // ignore rigid body constituent particles in the sum
-        if (h_body.data[j] >= MIN_FLOPPY || h_body.data[j] == h_tag.data[j])
+        for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
             {
-            pe_total += (double)h_net_force.data[j].w;
+            unsigned int j = m_group->getMemberIndex(group_idx);
+
+            // ignore rigid body constituent particles in the sum
+            if (h_body.data[j] >= MIN_FLOPPY || h_body.data[j] == h_tag.data[j])
+                {
+                pe_total += (double)h_net_force.data[j].w;
+                }
             }
+
+        pe_total += m_pdata->getExternalEnergy();
         }
 
-    pe_total += m_pdata->getExternalEnergy();
+    // sum of the force dotted with the displacement from the lattice site for HMA
+    double fdr_total = 0.0;
+    if (m_hma_lattice_site && !m_computed_kinetic_energy_only)
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+        ArrayHandle<Scalar3> h_lattice_site(*m_hma_lattice_site,
+                                            access_location::host,
+                                            access_mode::read);
+        const BoxDim& box = m_pdata->getGlobalBox();
+
+        for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+            {
+            unsigned int j = m_group->getMemberIndex(group_idx);
+
+            // ignore rigid body constituent particles in the sum
+            if (h_body.data[j] >= MIN_FLOPPY || h_body.data[j] == h_tag.data[j])
+                {
+                Scalar3 pos = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+                Scalar3 dr
+                    = box.shift(pos, h_image.data[j]) - h_lattice_site.data[h_tag.data[j]];
+                fdr_total += (double)h_net_force.data[j].x * dr.x
+                             + (double)h_net_force.data[j].y * dr.y
+                             + (double)h_net_force.data[j].z * dr.z;
+                }
+            }
+        }
 
     double W = 0.0;
     double virial_xx = m_pdata->getExternalVirial(0);
@@ -284,10 +403,15 @@ void ComputeThermo::computeProperties()
     h_properties.data[thermo_index::pressure_yy] = pressure_yy;
     h_properties.data[thermo_index::pressure_yz] = pressure_yz;
     h_properties.data[thermo_index::pressure_zz] = pressure_zz;
+    h_properties.data[thermo_index::hma_force_displacement] = Scalar(fdr_total);
 
 #ifdef ENABLE_MPI
-    // in MPI, reduce extensive quantities only when they're needed
+    // in MPI, reduce extensive quantities in the background and wait when they're needed
     m_properties_reduced = !m_pdata->getDomainDecomposition();
+    if (!m_properties_reduced)
+        {
+        startReduceProperties();
+        }
 #endif // ENABLE_MPI
     }
 
@@ -297,17 +421,49 @@ void ComputeThermo::reduceProperties()
     if (m_properties_reduced)
         return;
 
+    if (m_reduce_pending)
+        {
+        finishReduceProperties();
+        return;
+        }
+
     // reduce properties
     ArrayHandle<Scalar> h_properties(m_properties, access_location::host, access_mode::readwrite);
     MPI_Allreduce(MPI_IN_PLACE,
                   h_properties.data,
-                  thermo_index::num_quantities,
+                  getNumReducedQuantities(),
                   MPI_HOOMD_SCALAR,
                   MPI_SUM,
                   m_exec_conf->getMPICommunicator());
 
     m_properties_reduced = true;
     }
+
+/*! computeProperties() calls this with the local values of the quantities computed with the
+    current flags. m_properties must not be accessed until finishReduceProperties() returns.
+*/
+void ComputeThermo::startReduceProperties()
+    {
+    ArrayHandle<Scalar> h_properties(m_properties, access_location::host, access_mode::readwrite);
+    MPI_Iallreduce(MPI_IN_PLACE,
+                   h_properties.data,
+                   getNumReducedQuantities(),
+                   MPI_HOOMD_SCALAR,
+                   MPI_SUM,
+                   m_exec_conf->getMPICommunicator(),
+                   &m_reduce_request);
+    m_reduce_pending = true;
+    }
+
+void ComputeThermo::finishReduceProperties()
+    {
+    if (!m_reduce_pending)
+        return;
+
+    MPI_Wait(&m_reduce_request, MPI_STATUS_IGNORE);
+    m_reduce_pending = false;
+    m_properties_reduced = true;
+    }
 #endif
 
 namespace detail
@@ -330,7 +486,10 @@ void export_ComputeThermo(pybind11::module& m)
         .def_property_readonly("rotational_kinetic_energy",
                                &ComputeThermo::getRotationalKineticEnergy)
         .def_property_readonly("potential_energy", &ComputeThermo::getPotentialEnergy)
-        .def_property_readonly("volume", &ComputeThermo::getVolume);
+        .def_property_readonly("volume", &ComputeThermo::getVolume)
+        .def_property("kinetic_energy_only",
+                      &ComputeThermo::getKineticEnergyOnly,
+                      &ComputeThermo::setKineticEnergyOnly);
     }
 
     } // end namespace detail
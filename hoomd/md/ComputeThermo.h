@@ -51,6 +51,20 @@ namespace md
    the number of degrees of freedom from the integrators and sets that value for each ComputeThermo
    so that it is always correct.
 
+    Consumers that only need the temperature (such as thermostats) call setKineticEnergyOnly(). The
+    compute then skips the pressure tensor and the potential energy, even on steps where the
+    particle data flags request them for other consumers, and reduces only the kinetic energies
+    over MPI. The potential energy and pressure getters return NaN.
+
+    When ComputeThermoHMA is fused with this compute (see setHMALatticeSites()), the sum of the
+    force dotted with the displacement from the lattice site is accumulated in the same pass over
+    the group and reduced in the same MPI reduction as the other properties. The potential energy
+    is then always computed.
+
+    In MPI simulations on the CPU, computeProperties() starts a nonblocking reduction of the
+    properties. It completes when a property is first read, so that work between compute() and the
+    first read overlaps with the communication.
+
     \ingroup computes
 */
 class PYBIND11_EXPORT ComputeThermo : public Compute
@@ -65,6 +79,51 @@ class PYBIND11_EXPORT ComputeThermo : public Compute
     //! Compute the temperature
     virtual void compute(uint64_t timestep);
 
+    //! Get a function that evaluates a scalar loggable quantity in C++
+    virtual std::function<Scalar(uint64_t)> getLogQuantity(const std::string& quantity);
+
+    /// Set whether to compute only the kinetic energy
+    void setKineticEnergyOnly(bool kinetic_energy_only)
+        {
+        m_kinetic_energy_only = kinetic_energy_only;
+        }
+
+    /// Get whether to compute only the kinetic energy
+    bool getKineticEnergyOnly()
+        {
+        return m_kinetic_energy_only;
+        }
+
+    /// Set the lattice sites to compute the HMA sums with (null to stop computing them)
+    void setHMALatticeSites(std::shared_ptr<const GlobalArray<Scalar3>> lattice_site)
+        {
+        m_hma_lattice_site = lattice_site;
+        }
+
+    /// Get the group that the properties are computed for
+    std::shared_ptr<ParticleGroup> getGroup()
+        {
+        return m_group;
+        }
+
+    //! Returns the sum of the force dotted with the lattice displacement last computed by compute()
+    /*! \returns The sum over the group, or NaN if no lattice sites are set
+     */
+    Scalar getHMAForceDisplacement()
+        {
+        if (!m_hma_lattice_site || m_computed_kinetic_energy_only)
+            {
+            return std::numeric_limits<Scalar>::quiet_NaN();
+            }
+#ifdef ENABLE_MPI
+        if (!m_properties_reduced)
+            reduceProperties();
+#endif
+
+        ArrayHandle<Scalar> h_properties(m_properties, access_location::host, access_mode::read);
+        return h_properties.data[thermo_index::hma_force_displacement];
+        }
+
     //! Returns the overall temperature last computed by compute()
     /*! \returns Instantaneous overall temperature of the system
      */
@@ -226,6 +285,11 @@ class PYBIND11_EXPORT ComputeThermo : public Compute
      */
     Scalar getPotentialEnergy()
         {
+        if (m_computed_kinetic_energy_only)
+            {
+            return std::numeric_limits<Scalar>::quiet_NaN();
+            }
+
 #ifdef ENABLE_MPI
         if (!m_properties_reduced)
             reduceProperties();
@@ -336,14 +400,38 @@ class PYBIND11_EXPORT ComputeThermo : public Compute
     /// Store the particle data flags used during the last computation
     PDataFlags m_computed_flags;
 
+    /// True when only the kinetic energy is computed
+    bool m_kinetic_energy_only;
+
+    /// Value of m_kinetic_energy_only during the last computation
+    bool m_computed_kinetic_energy_only;
+
+    /// Lattice sites of the fused HMA computation, indexed by tag
+    std::shared_ptr<const GlobalArray<Scalar3>> m_hma_lattice_site;
+
     //! Does the actual computation
     virtual void computeProperties();
 
+    /// Get the particle data flags that apply to this compute
+    PDataFlags getComputeFlags();
+
+    /// Get the number of leading entries in m_properties that hold computed extensive values
+    unsigned int getNumReducedQuantities();
+
 #ifdef ENABLE_MPI
     bool m_properties_reduced; //!< True if properties have been reduced across MPI
 
+    MPI_Request m_reduce_request; //!< Request of the pending nonblocking reduction
+    bool m_reduce_pending;        //!< True while a nonblocking reduction is in flight
+
     //! Reduce properties over MPI
     virtual void reduceProperties();
+
+    /// Start reducing the properties over MPI without waiting for the result
+    void startReduceProperties();
+
+    /// Wait for the pending nonblocking reduction (if any) to complete
+    void finishReduceProperties();
 #endif
     };
 
@@ -15,6 +15,7 @@
 #endif
 
 #include <iostream>
+#include <optional>
 using namespace std;
 
 namespace hoomd
@@ -123,7 +124,7 @@ void ComputeThermoGPU::computeProperties()
     ArrayHandle<unsigned int> d_tag(m_pdata->getTags(), access_location::device, access_mode::read);
     BoxDim box = m_pdata->getGlobalBox();
 
-    PDataFlags flags = m_pdata->getFlags();
+    PDataFlags flags = getComputeFlags();
 
         { // scope these array handles so they are released before the additional terms are added
         // access the net force, pe, and virial
@@ -151,6 +152,20 @@ void ComputeThermoGPU::computeProperties()
                                          access_location::device,
                                          access_mode::overwrite);
 
+        // the HMA sums need the positions and the lattice sites
+        const bool compute_hma = m_hma_lattice_site && !m_computed_kinetic_energy_only;
+        std::optional<ArrayHandle<Scalar4>> d_pos;
+        std::optional<ArrayHandle<int3>> d_image;
+        std::optional<ArrayHandle<Scalar3>> d_lattice_site;
+        if (compute_hma)
+            {
+            d_pos.emplace(m_pdata->getPositions(), access_location::device, access_mode::read);
+            d_image.emplace(m_pdata->getImages(), access_location::device, access_mode::read);
+            d_lattice_site.emplace(*m_hma_lattice_site,
+                                   access_location::device,
+                                   access_mode::read);
+            }
+
         // access the group
         ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
                                                 access_location::device,
@@ -180,6 +195,9 @@ void ComputeThermoGPU::computeProperties()
         args.external_virial_yz = m_pdata->getExternalVirial(4);
         args.external_virial_zz = m_pdata->getExternalVirial(5);
         args.external_energy = m_pdata->getExternalEnergy();
+        args.d_pos = compute_hma ? d_pos->data : nullptr;
+        args.d_image = compute_hma ? d_image->data : nullptr;
+        args.d_lattice_site = compute_hma ? d_lattice_site->data : nullptr;
 
         // perform the computation on the GPU(s)
         gpu_compute_thermo_partial(d_properties.data,
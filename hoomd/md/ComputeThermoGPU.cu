@@ -32,15 +32,21 @@ namespace kernel
     \param offset Offset of this GPU in list of group members
     \param block_offset Offset of this GPU in the array of partial sums
 
+    \param box Box the particles are in
+    \param d_pos Particle positions
+    \param d_image Particle images
+    \param d_lattice_site Lattice sites indexed by tag, or null to skip the HMA sum
+
     All partial sums are packaged up in a Scalar4 to keep pointer management down.
      - 2*Kinetic energy is summed in .x
      - Potential energy is summed in .y
      - W is summed in .z
+     - The force dotted with the displacement from the lattice site (for HMA) is summed in .w
 
     One thread is executed per group member. That thread reads in the values for its member into
    shared memory and then the block performs a reduction in parallel to produce a partial sum output
    for the block. These partial sums are written to d_scratch[blockIdx.x].
-   sizeof(Scalar3)*block_size of dynamic shared memory are needed for this kernel to run.
+   sizeof(Scalar4)*block_size of dynamic shared memory are needed for this kernel to run.
 */
 
 __global__ void gpu_compute_thermo_partial_sums(Scalar4* d_scratch,
@@ -53,17 +59,21 @@ __global__ void gpu_compute_thermo_partial_sums(Scalar4* d_scratch,
                                                 unsigned int* d_group_members,
                                                 unsigned int work_size,
                                                 unsigned int offset,
-                                                unsigned int block_offset)
+                                                unsigned int block_offset,
+                                                const BoxDim box,
+                                                const Scalar4* d_pos,
+                                                const int3* d_image,
+                                                const Scalar3* d_lattice_site)
     {
-    extern __shared__ Scalar3 compute_thermo_sdata[];
+    extern __shared__ Scalar4 compute_thermo_sdata[];
 
     // determine which particle this thread works on
     int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
 
-    Scalar3 my_element; // element of scratch space read in
+    Scalar4 my_element; // element of scratch space read in
 
     // non-participating thread: contribute 0 to the sum
-    my_element = make_scalar3(0, 0, 0);
+    my_element = make_scalar4(0, 0, 0, 0);
 
     if (group_idx < work_size)
         {
@@ -89,6 +99,14 @@ __global__ void gpu_compute_thermo_partial_sums(Scalar4* d_scratch,
             my_element.x = mass * (vel.x * vel.x + vel.y * vel.y + vel.z * vel.z);
             my_element.y = net_force.w;
             my_element.z = net_isotropic_virial;
+
+            if (d_lattice_site)
+                {
+                Scalar4 postype = d_pos[idx];
+                Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+                Scalar3 dr = box.shift(pos, d_image[idx]) - d_lattice_site[tag];
+                my_element.w = net_force.x * dr.x + net_force.y * dr.y + net_force.z * dr.z;
+                }
             }
         }
 
@@ -104,6 +122,7 @@ __global__ void gpu_compute_thermo_partial_sums(Scalar4* d_scratch,
             compute_thermo_sdata[threadIdx.x].x += compute_thermo_sdata[threadIdx.x + offs].x;
             compute_thermo_sdata[threadIdx.x].y += compute_thermo_sdata[threadIdx.x + offs].y;
             compute_thermo_sdata[threadIdx.x].z += compute_thermo_sdata[threadIdx.x + offs].z;
+            compute_thermo_sdata[threadIdx.x].w += compute_thermo_sdata[threadIdx.x + offs].w;
             }
         offs >>= 1;
         __syncthreads();
@@ -112,8 +131,7 @@ __global__ void gpu_compute_thermo_partial_sums(Scalar4* d_scratch,
     // write out our partial sum
     if (threadIdx.x == 0)
         {
-        Scalar3 res = compute_thermo_sdata[0];
-        d_scratch[block_offset + blockIdx.x] = make_scalar4(res.x, res.y, res.z, 0);
+        d_scratch[block_offset + blockIdx.x] = compute_thermo_sdata[0];
         }
     }
 
@@ -315,13 +333,15 @@ __global__ void gpu_compute_rotational_ke_partial_sums(Scalar* d_scratch,
     \param num_partial_sums Number of partial sums in \a d_scratch
     \param external_virial External contribution to virial (1/3 trace)
     \param external_energy External contribution to potential energy
+    \param compute_hma Whether to reduce the HMA sum
 
 
     Only one block is executed. In that block, the partial sums are read in and reduced to final
    values. From the final sums, the thermodynamic properties are computed and written to
    d_properties.
 
-    sizeof(Scalar4)*block_size bytes of shared memory are needed for this kernel to run.
+    sizeof(Scalar4)*block_size bytes of shared memory are needed for this kernel to run, plus
+    sizeof(Scalar)*block_size bytes when \a compute_hma is set.
 */
 __global__ void gpu_compute_thermo_final_sums(Scalar* d_properties,
                                               Scalar4* d_scratch,
@@ -332,11 +352,14 @@ __global__ void gpu_compute_thermo_final_sums(Scalar* d_properties,
                                               unsigned int group_size,
                                               unsigned int num_partial_sums,
                                               Scalar external_virial,
-                                              Scalar external_energy)
+                                              Scalar external_energy,
+                                              bool compute_hma)
     {
     extern __shared__ Scalar4 compute_thermo_final_sdata[];
+    Scalar* compute_thermo_final_hma_sdata = (Scalar*)&compute_thermo_final_sdata[blockDim.x];
 
     Scalar4 final_sum = make_scalar4(Scalar(0.0), Scalar(0.0), Scalar(0.0), Scalar(0.0));
+    Scalar final_hma_sum = Scalar(0.0);
 
     // sum up the values in the partial sum via a sliding window
     for (int start = 0; start < num_partial_sums; start += blockDim.x)
@@ -349,10 +372,16 @@ __global__ void gpu_compute_thermo_final_sums(Scalar* d_properties,
 
             compute_thermo_final_sdata[threadIdx.x]
                 = make_scalar4(scratch.x, scratch.y, scratch.z, scratch_rot);
+            if (compute_hma)
+                compute_thermo_final_hma_sdata[threadIdx.x] = scratch.w;
             }
         else
+            {
             compute_thermo_final_sdata[threadIdx.x]
                 = make_scalar4(Scalar(0.0), Scalar(0.0), Scalar(0.0), Scalar(0.0));
+            if (compute_hma)
+                compute_thermo_final_hma_sdata[threadIdx.x] = Scalar(0.0);
+            }
         __syncthreads();
 
         // reduce the sum in parallel
@@ -369,6 +398,9 @@ __global__ void gpu_compute_thermo_final_sums(Scalar* d_properties,
                     += compute_thermo_final_sdata[threadIdx.x + offs].z;
                 compute_thermo_final_sdata[threadIdx.x].w
                     += compute_thermo_final_sdata[threadIdx.x + offs].w;
+                if (compute_hma)
+                    compute_thermo_final_hma_sdata[threadIdx.x]
+                        += compute_thermo_final_hma_sdata[threadIdx.x + offs];
                 }
             offs >>= 1;
             __syncthreads();
@@ -380,6 +412,8 @@ __global__ void gpu_compute_thermo_final_sums(Scalar* d_properties,
             final_sum.y += compute_thermo_final_sdata[0].y;
             final_sum.z += compute_thermo_final_sdata[0].z;
             final_sum.w += compute_thermo_final_sdata[0].w;
+            if (compute_hma)
+                final_hma_sum += compute_thermo_final_hma_sdata[0];
             }
         }
 
@@ -417,6 +451,7 @@ __global__ void gpu_compute_thermo_final_sums(Scalar* d_properties,
         d_properties[thermo_index::rotational_kinetic_energy] = Scalar(ke_rot_total);
         d_properties[thermo_index::potential_energy] = Scalar(pe_total);
         d_properties[thermo_index::pressure] = pressure;
+        d_properties[thermo_index::hma_force_displacement] = final_hma_sum;
         }
     }
 
@@ -563,7 +598,7 @@ hipError_t gpu_compute_thermo_partial(Scalar* d_properties,
         dim3 grid(nwork / args.block_size + 1, 1, 1);
         dim3 threads(args.block_size, 1, 1);
 
-        size_t shared_bytes = sizeof(Scalar3) * args.block_size;
+        size_t shared_bytes = sizeof(Scalar4) * args.block_size;
 
         hipLaunchKernelGGL(gpu_compute_thermo_partial_sums,
                            dim3(grid),
@@ -580,7 +615,11 @@ hipError_t gpu_compute_thermo_partial(Scalar* d_properties,
                            d_group_members,
                            nwork,
                            range.first,
-                           block_offset);
+                           block_offset,
+                           box,
+                           args.d_pos,
+                           args.d_image,
+                           args.d_lattice_site);
 
         if (compute_pressure_tensor)
             {
@@ -680,7 +719,10 @@ hipError_t gpu_compute_thermo_final(Scalar* d_properties,
     dim3 grid = dim3(1, 1, 1);
     dim3 threads = dim3(final_block_size, 1, 1);
 
+    const bool compute_hma = args.d_lattice_site != nullptr;
     size_t shared_bytes = sizeof(Scalar4) * final_block_size;
+    if (compute_hma)
+        shared_bytes += sizeof(Scalar) * final_block_size;
 
     Scalar external_virial
         = Scalar(1.0 / 3.0)
@@ -701,7 +743,8 @@ hipError_t gpu_compute_thermo_final(Scalar* d_properties,
                        group_size,
                        args.n_blocks,
                        external_virial,
-                       args.external_energy);
+                       args.external_energy,
+                       compute_hma);
 
     if (compute_pressure_tensor)
         {
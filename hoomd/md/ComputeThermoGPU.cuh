@@ -43,6 +43,9 @@ struct compute_thermo_args
     Scalar external_virial_yz; //!< yz component of the external virial
     Scalar external_virial_zz; //!< zz component of the external virial
     Scalar external_energy;    //!< External potential energy
+    Scalar4* d_pos;            //!< Particle positions for the HMA sums
+    int3* d_image;             //!< Particle images for the HMA sums
+    Scalar3* d_lattice_site;   //!< Lattice sites indexed by tag (null to skip the HMA sums)
     };
 
 //! Computes the partial sums of thermodynamic properties for ComputeThermo
@@ -59,10 +59,9 @@ ComputeThermoHMA::ComputeThermoHMA(std::shared_ptr<SystemDefinition> sysdef,
         }
 #endif
 
-    GlobalArray<Scalar3> lat(snapshot.size, m_exec_conf);
-    m_lattice_site.swap(lat);
-    TAG_ALLOCATION(m_lattice_site);
-    ArrayHandle<Scalar3> h_lattice_site(m_lattice_site,
+    m_lattice_site = std::make_shared<GlobalArray<Scalar3>>(snapshot.size, m_exec_conf);
+    m_lattice_site->setTag(detail::allocation_owner(__PRETTY_FUNCTION__) + "::m_lattice_site");
+    ArrayHandle<Scalar3> h_lattice_site(*m_lattice_site,
                                         access_location::host,
                                         access_mode::overwrite);
 
@@ -79,6 +78,32 @@ ComputeThermoHMA::ComputeThermoHMA(std::shared_ptr<SystemDefinition> sysdef,
 ComputeThermoHMA::~ComputeThermoHMA()
     {
     m_exec_conf->msg->notice(5) << "Destroying ComputeThermoHMA" << endl;
+
+    if (m_thermo)
+        {
+        m_thermo->setHMALatticeSites(nullptr);
+        }
+    }
+
+/*! \param thermo ComputeThermo of the same group, or null to compute the HMA sums separately
+ */
+void ComputeThermoHMA::setThermo(std::shared_ptr<ComputeThermo> thermo)
+    {
+    if (thermo && thermo->getGroup() != m_group)
+        {
+        throw std::invalid_argument("ThermodynamicQuantities must compute the same group as "
+                                    "HarmonicAveragedThermodynamicQuantities.");
+        }
+
+    if (m_thermo)
+        {
+        m_thermo->setHMALatticeSites(nullptr);
+        }
+    m_thermo = thermo;
+    if (m_thermo)
+        {
+        m_thermo->setHMALatticeSites(m_lattice_site);
+        }
     }
 
 /*! Calls computeProperties if the properties need updating
@@ -90,9 +115,43 @@ void ComputeThermoHMA::compute(uint64_t timestep)
     if (!shouldCompute(timestep))
         return;
 
+    if (m_thermo)
+        {
+        m_thermo->compute(timestep);
+        return;
+        }
+
     computeProperties();
     }
 
+/*! The sums are reduced over all ranks, so the HMA quantities are evaluated with the global
+    number of particles.
+*/
+void ComputeThermoHMA::computeFusedProperties()
+    {
+    const double N = m_group->getNumMembersGlobal();
+    const unsigned int D = m_sysdef->getNDimensions();
+    const double volume = m_thermo->getVolume();
+    const double fdr = m_thermo->getHMAForceDisplacement();
+
+    double pe_total = m_thermo->getPotentialEnergy();
+    pe_total += 1.5 * (N - 1) * m_temperature + 0.5 * fdr;
+
+    // the pressure of ComputeThermo is (2 K / D + W) / V
+    double W_over_V = m_thermo->getPressure()
+                      - 2.0 * m_thermo->getTranslationalKineticEnergy() / (D * volume);
+    double fV = (m_harmonicPressure / m_temperature - N / volume) / (D * (N - 1));
+    Scalar p_total = Scalar(m_harmonicPressure + W_over_V + fV * fdr);
+
+    ArrayHandle<Scalar> h_properties(m_properties, access_location::host, access_mode::overwrite);
+    h_properties.data[thermoHMA_index::potential_energyHMA] = Scalar(pe_total);
+    h_properties.data[thermoHMA_index::pressureHMA] = p_total;
+
+#ifdef ENABLE_MPI
+    m_properties_reduced = true;
+#endif
+    }
+
 /*! Computes all thermodynamic properties of the system in one fell swoop.
  */
 void ComputeThermoHMA::computeProperties()
@@ -113,7 +172,7 @@ void ComputeThermoHMA::computeProperties()
     ArrayHandle<Scalar> h_net_virial(net_virial, access_location::host, access_mode::read);
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
     ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
-    ArrayHandle<Scalar3> h_lattice_site(m_lattice_site, access_location::host, access_mode::read);
+    ArrayHandle<Scalar3> h_lattice_site(*m_lattice_site, access_location::host, access_mode::read);
     ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
 
     // total potential energy
@@ -199,6 +258,7 @@ void export_ComputeThermoHMA(pybind11::module& m)
                             std::shared_ptr<ParticleGroup>,
                             const double,
                             const double>())
+        .def("setThermo", &ComputeThermoHMA::setThermo)
         .def_property("kT", &ComputeThermoHMA::getTemperature, &ComputeThermoHMA::setTemperature)
         .def_property("harmonic_pressure",
                       &ComputeThermoHMA::getHarmonicPressure,
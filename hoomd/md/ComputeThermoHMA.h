@@ -1,6 +1,7 @@
 // Copyright (c) 2009-2024 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "ComputeThermo.h"
 #include "ComputeThermoHMATypes.h"
 #include "hoomd/Compute.h"
 #include "hoomd/GPUArray.h"
@@ -38,6 +39,11 @@ namespace md
 
     All quantities are made available in Python as properties.
 
+    When a ComputeThermo of the same group is set with setThermo(), the HMA sums are accumulated by
+    that ComputeThermo in its pass over the group and reduced with its properties over MPI. The HMA
+    quantities are then evaluated on the host from the reduced sums, and this compute makes no pass
+    of its own.
+
     \ingroup computes
 */
 class PYBIND11_EXPORT ComputeThermoHMA : public Compute
@@ -60,6 +66,8 @@ class PYBIND11_EXPORT ComputeThermoHMA : public Compute
      */
     Scalar getPotentialEnergyHMA()
         {
+        if (m_thermo)
+            computeFusedProperties();
 #ifdef ENABLE_MPI
         if (!m_properties_reduced)
             reduceProperties();
@@ -79,7 +87,9 @@ class PYBIND11_EXPORT ComputeThermoHMA : public Compute
         PDataFlags flags = m_pdata->getFlags();
         if (flags[pdata_flag::pressure_tensor])
             {
-// return the pressure
+            // return the pressure
+            if (m_thermo)
+                computeFusedProperties();
 #ifdef ENABLE_MPI
             if (!m_properties_reduced)
                 reduceProperties();
@@ -99,6 +109,8 @@ class PYBIND11_EXPORT ComputeThermoHMA : public Compute
     //! Get the gpu array of properties
     const GPUArray<Scalar>& getProperties()
         {
+        if (m_thermo)
+            computeFusedProperties();
 #ifdef ENABLE_MPI
         if (!m_properties_reduced)
             reduceProperties();
@@ -138,6 +150,15 @@ class PYBIND11_EXPORT ComputeThermoHMA : public Compute
     //! Method to be called when particles are added/removed/sorted
     void slotParticleSort();
 
+    /// Set the ComputeThermo that accumulates the HMA sums (null to compute them separately)
+    void setThermo(std::shared_ptr<ComputeThermo> thermo);
+
+    /// Get the ComputeThermo that accumulates the HMA sums
+    std::shared_ptr<ComputeThermo> getThermo()
+        {
+        return m_thermo;
+        }
+
     protected:
     std::shared_ptr<ParticleGroup> m_group; //!< Group to compute properties for
     GPUArray<Scalar> m_properties;          //!< Stores the computed properties
@@ -153,7 +174,13 @@ class PYBIND11_EXPORT ComputeThermoHMA : public Compute
 #endif
 
     Scalar m_temperature, m_harmonicPressure;
-    GlobalArray<Scalar3> m_lattice_site;
+    std::shared_ptr<GlobalArray<Scalar3>> m_lattice_site;
+
+    /// ComputeThermo that accumulates the HMA sums
+    std::shared_ptr<ComputeThermo> m_thermo;
+
+    /// Evaluate the HMA quantities from the sums of m_thermo
+    void computeFusedProperties();
     };
 
     } // end namespace md
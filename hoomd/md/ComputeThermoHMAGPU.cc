@@ -53,8 +53,8 @@ ComputeThermoHMAGPU::ComputeThermoHMAGPU(std::shared_ptr<SystemDefinition> sysde
             // only optimize access for those fields used in force computation
             // (i.e. no net_force/virial/torque, also angmom and inertia are only used by the
             // integrator)
-            cudaMemAdvise(m_lattice_site.get(),
-                          sizeof(Scalar3) * m_lattice_site.getNumElements(),
+            cudaMemAdvise(m_lattice_site->get(),
+                          sizeof(Scalar3) * m_lattice_site->getNumElements(),
                           cudaMemAdviseSetAccessedBy,
                           gpu_map[idev]);
             }
@@ -123,7 +123,9 @@ void ComputeThermoHMAGPU::computeProperties()
                                      access_location::device,
                                      access_mode::read);
     ArrayHandle<unsigned int> d_tag(m_pdata->getTags(), access_location::device, access_mode::read);
-    ArrayHandle<Scalar3> d_lattice_site(m_lattice_site, access_location::device, access_mode::read);
+    ArrayHandle<Scalar3> d_lattice_site(*m_lattice_site,
+                                        access_location::device,
+                                        access_mode::read);
     ArrayHandle<int3> d_image(m_pdata->getImages(), access_location::device, access_mode::read);
     BoxDim box = m_pdata->getGlobalBox();
 
@@ -29,7 +29,8 @@ struct thermo_index
         pressure_yy,   //!< Index for the yy component of the pressure tensor in the GPUArray
         pressure_yz,   //!< Index for the yz component of the pressure tensor in the GPUArray
         pressure_zz,   //!< Index for the zz component of the pressure tensor in the GPUArray
-        num_quantities // final element to count number of quantities
+        hma_force_displacement, //!< Sum of the force dotted with the lattice displacement
+        num_quantities          // final element to count number of quantities
         };
     };
 
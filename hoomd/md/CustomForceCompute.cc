@@ -21,7 +21,7 @@ namespace md
 CustomForceCompute::CustomForceCompute(std::shared_ptr<SystemDefinition> sysdef,
                                        pybind11::object py_setForces,
                                        bool aniso)
-    : ForceCompute(sysdef), m_aniso(aniso)
+    : ForceCompute(sysdef), m_aniso(aniso), m_function(nullptr), m_function_device(false)
     {
     m_exec_conf->msg->notice(5) << "Constructing ConstForceCompute" << endl;
     m_setForces = py_setForces;
@@ -33,11 +33,42 @@ CustomForceCompute::~CustomForceCompute()
     m_exec_conf->msg->notice(5) << "Destroying ConstForceCompute" << endl;
     }
 
-/*! This function calls the python set_forces method.
+/*! \param address Address of a function with the CustomForceFunction signature
+    \param device True when the function takes device arrays
+
+    The function is called from C++ on every step without holding the python global interpreter
+    lock, so it must not call into python.
+*/
+void CustomForceCompute::setFunction(uintptr_t address, bool device)
+    {
+    if (address == 0)
+        {
+        throw std::runtime_error("The address of the custom force function cannot be 0.");
+        }
+#ifdef ENABLE_HIP
+    if (device && !m_exec_conf->isCUDAEnabled())
+#else
+    if (device)
+#endif
+        {
+        throw std::runtime_error("Cannot use a GPU custom force function in a CPU simulation.");
+        }
+
+    m_function = reinterpret_cast<CustomForceFunction>(address);
+    m_function_device = device;
+    }
+
+/*! This function calls the python set_forces method, or the compiled function when one is set.
     \param timestep Current timestep
 */
 void CustomForceCompute::computeForces(uint64_t timestep)
     {
+    if (m_function)
+        {
+        callFunction(timestep);
+        return;
+        }
+
         // zero necessary arrays
         {
         ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
@@ -55,9 +86,80 @@ void CustomForceCompute::computeForces(uint64_t timestep)
         memset(h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
         }
     // execute python callback to update the forces, if present
+    pybind11::gil_scoped_acquire gil;
     m_setForces(timestep);
     }
 
+/*! \param timestep Current timestep
+*/
+void CustomForceCompute::callFunction(uint64_t timestep)
+    {
+    const BoxDim& global_box = m_pdata->getGlobalBox();
+    const Scalar3 L = global_box.getL();
+    const Scalar box[6] = {L.x,
+                           L.y,
+                           L.z,
+                           global_box.getTiltFactorXY(),
+                           global_box.getTiltFactorXZ(),
+                           global_box.getTiltFactorYZ()};
+    const unsigned int N = m_pdata->getN();
+    const bool compute_virial = m_pdata->getFlags()[pdata_flag::pressure_tensor];
+#ifdef ENABLE_HIP
+    const access_location::Enum location
+        = m_function_device ? access_location::device : access_location::host;
+#else
+    const access_location::Enum location = access_location::host;
+#endif
+
+    ArrayHandle<Scalar4> pos(m_pdata->getPositions(), location, access_mode::read);
+    ArrayHandle<Scalar4> vel(m_pdata->getVelocities(), location, access_mode::read);
+    ArrayHandle<Scalar4> orientation(m_pdata->getOrientationArray(), location, access_mode::read);
+    ArrayHandle<unsigned int> tag(m_pdata->getTags(), location, access_mode::read);
+    ArrayHandle<Scalar4> force(m_force, location, access_mode::overwrite);
+    ArrayHandle<Scalar4> torque(m_torque, location, access_mode::overwrite);
+    ArrayHandle<Scalar> virial(m_virial, location, access_mode::overwrite);
+
+    // zero necessary arrays
+#ifdef ENABLE_HIP
+    if (m_function_device)
+        {
+        hipMemset(force.data, 0, sizeof(Scalar4) * N);
+        if (m_aniso)
+            hipMemset(torque.data, 0, sizeof(Scalar4) * N);
+        if (compute_virial)
+            hipMemset(virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+    else
+#endif
+        {
+        memset(force.data, 0, sizeof(Scalar4) * N);
+        if (m_aniso)
+            memset(torque.data, 0, sizeof(Scalar4) * N);
+        if (compute_virial)
+            memset(virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+        }
+
+    m_function(timestep,
+               N,
+               box,
+               pos.data,
+               vel.data,
+               orientation.data,
+               tag.data,
+               force.data,
+               m_aniso ? torque.data : nullptr,
+               compute_virial ? virial.data : nullptr,
+               m_virial_pitch,
+               nullptr);
+
+#ifdef ENABLE_HIP
+    if (m_function_device && m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+#endif
+    }
+
 namespace detail
     {
 void export_CustomForceCompute(py::module& m)
@@ -65,7 +167,8 @@ void export_CustomForceCompute(py::module& m)
     py::class_<CustomForceCompute, ForceCompute, std::shared_ptr<CustomForceCompute>>(
         m,
         "CustomForceCompute")
-        .def(py::init<std::shared_ptr<SystemDefinition>, pybind11::object, bool>());
+        .def(py::init<std::shared_ptr<SystemDefinition>, pybind11::object, bool>())
+        .def("setFunction", &CustomForceCompute::setFunction);
     }
 
     } // end namespace detail
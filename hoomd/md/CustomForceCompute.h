@@ -23,6 +23,36 @@ namespace hoomd
     {
 namespace md
     {
+//! Signature of a compiled function that computes custom forces
+/*! \param timestep Current timestep
+    \param N Number of local particles
+    \param box Lx, Ly, Lz, xy, xz, and yz of the global box (always a host array)
+    \param position Particle positions and types
+    \param velocity Particle velocities and masses
+    \param orientation Particle orientations
+    \param tag Particle tags
+    \param force Forces and potential energies (output)
+    \param torque Torques (output), or NULL when the force is not anisotropic
+    \param virial Virials (output), or NULL when the virial is not needed on this step
+    \param virial_pitch Number of elements between the components of the virial
+    \param stream Stream to launch kernels on, always the default stream
+
+    The particle and force arrays are device arrays when the function is registered for the GPU
+    and host arrays otherwise. The outputs are zeroed before the call.
+*/
+typedef void (*CustomForceFunction)(uint64_t timestep,
+                                    unsigned int N,
+                                    const Scalar* box,
+                                    const Scalar4* position,
+                                    const Scalar4* velocity,
+                                    const Scalar4* orientation,
+                                    const unsigned int* tag,
+                                    Scalar4* force,
+                                    Scalar4* torque,
+                                    Scalar* virial,
+                                    size_t virial_pitch,
+                                    void* stream);
+
 //! Adds a custom force
 /*! \ingroup computes
  */
@@ -42,16 +72,28 @@ class PYBIND11_EXPORT CustomForceCompute : public ForceCompute
         return m_aniso;
         }
 
+    //! Compute the forces with a compiled function instead of the python callback
+    void setFunction(uintptr_t address, bool device);
+
     protected:
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
 
+    //! Zero the output arrays and call the compiled function
+    void callFunction(uint64_t timestep);
+
     private:
     //! A python callback when the force is updated
     pybind11::object m_setForces;
 
     //! flag for anisotropic python custom forces
     bool m_aniso;
+
+    //! Compiled function that computes the forces, or NULL to call m_setForces
+    CustomForceFunction m_function;
+
+    //! True when m_function takes device arrays
+    bool m_function_device;
     };
 
     } // end namespace md
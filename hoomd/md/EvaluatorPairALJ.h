@@ -5,6 +5,7 @@
 #define __EVALUATOR_PAIR_ALJ_H__
 
 #ifndef __HIPCC__
+#include <algorithm>
 #include <sstream>
 #include <string>
 #endif
@@ -291,6 +292,7 @@ template<unsigned int ndim> class EvaluatorPairALJ
                 faces[0] = 0;
                 face_offsets = ManagedArray<unsigned int>(1, managed);
                 face_offsets[0] = 0;
+                setBoundingBox();
                 return;
                 }
 
@@ -311,6 +313,8 @@ template<unsigned int ndim> class EvaluatorPairALJ
                                         pybind11::cast<Scalar>(vertices_tmp[2]));
                 }
 
+            setBoundingBox();
+
             // If no faces exist i.e. 2D then we make an empty array and return.
             if (N_faces == 0)
                 {
@@ -396,6 +400,23 @@ template<unsigned int ndim> class EvaluatorPairALJ
                 }
             }
 
+        //! Set the bounding box of the vertices, expanded by the rounding radii
+        void setBoundingBox()
+            {
+            vec3<Scalar> lo = verts[0], hi = verts[0];
+            for (unsigned int i = 1; i < verts.size(); ++i)
+                {
+                lo.x = std::min(lo.x, verts[i].x);
+                lo.y = std::min(lo.y, verts[i].y);
+                lo.z = std::min(lo.z, verts[i].z);
+                hi.x = std::max(hi.x, verts[i].x);
+                hi.y = std::max(hi.y, verts[i].y);
+                hi.z = std::max(hi.z, verts[i].z);
+                }
+            box_center = Scalar(0.5) * (lo + hi);
+            box_half_extents = Scalar(0.5) * (hi - lo) + rounding_radii;
+            }
+
 #endif
 
         //! Load dynamic data members into shared memory and increase pointer
@@ -432,6 +453,8 @@ template<unsigned int ndim> class EvaluatorPairALJ
         ManagedArray<unsigned int> face_offsets; //! Index where each faces starts.
         vec3<Scalar> rounding_radii;             //! The semimajor axes of the rounding ellipse.
         bool has_rounding;                       //! Whether or not the shape has rounding radii.
+        vec3<Scalar> box_center;       //! Center of the bounding box in the particle frame.
+        vec3<Scalar> box_half_extents; //! Half extents of the bounding box in the particle frame.
         };
 
     //! Constructs the pair potential evaluator.
@@ -509,6 +532,10 @@ template<unsigned int ndim> class EvaluatorPairALJ
        \param torque_j The torque
        exterted on the j^th particle. \return True if they are evaluated or false if they are not
        because we are beyond the cutoff.
+
+       When both branches of the potential are purely repulsive (alpha = 0), pairs whose centers
+       are beyond the central WCA cutoff and whose oriented bounding boxes are separated by more
+       than the contact WCA cutoff do not interact. They are culled before GJK and return false.
     */
     HOSTDEVICE bool evaluate(Scalar3& force,
                              Scalar& pair_eng,
@@ -534,6 +561,20 @@ template<unsigned int ndim> class EvaluatorPairALJ
             quat2mat(qi, mati);
             quat2mat(qj, matj);
 
+            if (_params.alpha == 0)
+                {
+                Scalar sigma12 = Scalar(0.5) * (_params.sigma_i + _params.sigma_j);
+                Scalar contact_sphere_diameter
+                    = Scalar(0.5) * (_params.contact_sigma_i + _params.contact_sigma_j);
+                Scalar separation = getBoxSeparation(mati, matj);
+                if (rsq >= TWO_P_13 * sigma12 * sigma12 && separation > Scalar(0)
+                    && separation * separation
+                           >= TWO_P_13 * contact_sphere_diameter * contact_sphere_diameter)
+                    {
+                    return false;
+                    }
+                }
+
             // Call GJK. In order to ensure that Newton's third law is
             // obeyed, we must avoid any imbalance caused by numerical
             // errors leading to GJK(i, j) returning different results from
@@ -727,6 +768,62 @@ template<unsigned int ndim> class EvaluatorPairALJ
 #endif
 
     protected:
+    //! Compute a lower bound on the distance between the shapes from their bounding boxes.
+    /*! The bounding boxes are projected onto their ndim face normals and onto the line between
+     *  their centers. The gap along any axis is a lower bound on the distance between the shapes.
+     *
+     *  \param mati The orientation of particle i as a rotation matrix.
+     *  \param matj The orientation of particle j as a rotation matrix.
+     *  \returns The largest gap between the projected boxes, which is negative if they overlap
+     *  along all axes.
+     */
+    HOSTDEVICE inline Scalar getBoxSeparation(const Scalar (&mati)[3][3],
+                                              const Scalar (&matj)[3][3]) const
+        {
+        // the box axes in the space frame are the columns of the rotation matrices
+        vec3<Scalar> axes_i[3], axes_j[3];
+        for (unsigned int k = 0; k < 3; ++k)
+            {
+            axes_i[k] = vec3<Scalar>(mati[0][k], mati[1][k], mati[2][k]);
+            axes_j[k] = vec3<Scalar>(matj[0][k], matj[1][k], matj[2][k]);
+            }
+        const Scalar h_i[3] = {shape_i->box_half_extents.x,
+                               shape_i->box_half_extents.y,
+                               shape_i->box_half_extents.z};
+        const Scalar h_j[3] = {shape_j->box_half_extents.x,
+                               shape_j->box_half_extents.y,
+                               shape_j->box_half_extents.z};
+
+        // vector from the center of box i to the center of box j
+        const vec3<Scalar> t
+            = rotate(matj, shape_j->box_center) - rotate(mati, shape_i->box_center) - dr;
+
+        vec3<Scalar> axes[2 * ndim + 1];
+        unsigned int n_axes = 0;
+        for (unsigned int k = 0; k < ndim; ++k)
+            {
+            axes[n_axes++] = axes_i[k];
+            axes[n_axes++] = axes_j[k];
+            }
+        const Scalar t_sq = dot(t, t);
+        if (t_sq > Scalar(0))
+            axes[n_axes++] = t / sqrt(t_sq);
+
+        Scalar separation(0);
+        for (unsigned int n = 0; n < n_axes; ++n)
+            {
+            Scalar gap = fabs(dot(t, axes[n]));
+            for (unsigned int k = 0; k < 3; ++k)
+                {
+                gap -= h_i[k] * fabs(dot(axes[n], axes_i[k]))
+                       + h_j[k] * fabs(dot(axes[n], axes_j[k]));
+                }
+            if (n == 0 || gap > separation)
+                separation = gap;
+            }
+        return separation;
+        }
+
     //! Calculate contact interaction between two simplices.
     /*! This method takes two faces of polytopes and computes all requisite
      * pairwise interactions between them. It must be specialized for each
@@ -0,0 +1,276 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PAIR_EVALUATOR_COMPOSITE_H__
+#define __PAIR_EVALUATOR_COMPOSITE_H__
+
+#ifndef __HIPCC__
+#include <string>
+#endif
+
+#include "hoomd/HOOMDMath.h"
+
+/*! \file EvaluatorPairComposite.h
+    \brief Defines an evaluator class that sums two pair potentials
+*/
+
+// need to declare these class methods with __device__ qualifiers when building in nvcc
+// DEVICE is __host__ __device__ when included in nvcc and blank when included into the host
+// compiler
+#ifdef __HIPCC__
+#define DEVICE __device__
+#define HOSTDEVICE __host__ __device__
+#else
+#define DEVICE
+#define HOSTDEVICE
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Class for evaluating the sum of two pair potentials
+/*! <b>General Overview</b>
+
+    See EvaluatorPairLJ
+
+    <b>Composite specifics</b>
+
+    EvaluatorPairComposite evaluates \f$ V(r) = V_A(r) + V_B(r) \f$ for two pair evaluators
+    \a EvaluatorA and \a EvaluatorB. PotentialPair and PotentialPairGPU treat it like any other
+    evaluator, so a system with several isotropic pair potentials on the same neighbor list reads
+    the list and the particle data once and writes the forces once, instead of once per force
+    compute. More than two potentials can be combined by nesting composites, e.g.
+    EvaluatorPairComposite<A, EvaluatorPairComposite<B, C>>.
+
+    Both terms share the cutoff of the type pair. Each term applies its own energy shift, and the
+    smoothing of the xplor mode is applied to the sum by PotentialPair.
+
+    The parameters of each term are set from a sub-dictionary keyed by the name of its evaluator.
+
+    When \a EvaluatorA is a DPD thermostat evaluator (e.g. EvaluatorPairDPDThermoDPD), the composite
+    can also be used by PotentialPairDPDThermo and PotentialPairDPDThermoGPU. The thermostat state
+    and the random stream of the pair are passed on to \a EvaluatorA, and \a EvaluatorB adds only
+    a conservative force, so the random and dissipative forces are computed in the same sweep as
+    the conservative terms.
+*/
+template<class EvaluatorA, class EvaluatorB> class EvaluatorPairComposite
+    {
+    public:
+    //! Define the parameter type used by this pair potential evaluator
+    struct param_type
+        {
+        typename EvaluatorA::param_type a; //!< Parameters of the first term
+        typename EvaluatorB::param_type b; //!< Parameters of the second term
+
+        DEVICE void load_shared(char*& ptr, unsigned int& available_bytes)
+            {
+            a.load_shared(ptr, available_bytes);
+            b.load_shared(ptr, available_bytes);
+            }
+
+        HOSTDEVICE void allocate_shared(char*& ptr, unsigned int& available_bytes) const
+            {
+            a.allocate_shared(ptr, available_bytes);
+            b.allocate_shared(ptr, available_bytes);
+            }
+
+#ifdef ENABLE_HIP
+        //! Set CUDA memory hints
+        void set_memory_hint() const
+            {
+            a.set_memory_hint();
+            b.set_memory_hint();
+            }
+#endif
+
+#ifndef __HIPCC__
+        param_type() : a(), b() { }
+
+        param_type(pybind11::dict v, bool managed = false)
+            : a(v[EvaluatorA::getName().c_str()].template cast<pybind11::dict>(), managed),
+              b(v[EvaluatorB::getName().c_str()].template cast<pybind11::dict>(), managed)
+            {
+            }
+
+        pybind11::dict asDict()
+            {
+            pybind11::dict v;
+            v[EvaluatorA::getName().c_str()] = a.asDict();
+            v[EvaluatorB::getName().c_str()] = b.asDict();
+            return v;
+            }
+#endif
+        };
+
+    //! Constructs the pair potential evaluator
+    /*! \param _rsq Squared distance between the particles
+        \param _rcutsq Squared distance at which the potential goes to 0
+        \param _params Per type pair parameters of this potential
+    */
+    DEVICE EvaluatorPairComposite(Scalar _rsq, Scalar _rcutsq, const param_type& _params)
+        : eval_a(_rsq, _rcutsq, _params.a), eval_b(_rsq, _rcutsq, _params.b)
+        {
+        }
+
+    //! The composite uses charge if either term does
+    DEVICE static bool needsCharge()
+        {
+        return EvaluatorA::needsCharge() || EvaluatorB::needsCharge();
+        }
+
+    //! Accept the optional charge values.
+    /*! \param qi Charge of particle i
+        \param qj Charge of particle j
+    */
+    DEVICE void setCharge(Scalar qi, Scalar qj)
+        {
+        eval_a.setCharge(qi, qj);
+        eval_b.setCharge(qi, qj);
+        }
+
+    //! Set the seed, tags, and timestep of the thermostat random numbers
+    /*! \param seed User seed of the random numbers
+        \param i Tag of particle i
+        \param j Tag of particle j
+        \param timestep Current timestep
+    */
+    DEVICE void
+    set_seed_ij_timestep(uint16_t seed, unsigned int i, unsigned int j, uint64_t timestep)
+        {
+        eval_a.set_seed_ij_timestep(seed, i, j, timestep);
+        }
+
+    //! Set the timestep size of the thermostat
+    DEVICE void setDeltaT(Scalar dt)
+        {
+        eval_a.setDeltaT(dt);
+        }
+
+    //! Set the dot product of the separation and the relative velocity
+    DEVICE void setRDotV(Scalar dot)
+        {
+        eval_a.setRDotV(dot);
+        }
+
+    //! Set the temperature of the thermostat
+    DEVICE void setT(Scalar Temp)
+        {
+        eval_a.setT(Temp);
+        }
+
+    //! Evaluate the force and energy
+    /*! \param force_divr Output parameter to write the computed force divided by r.
+        \param pair_eng Output parameter to write the computed pair energy
+        \param energy_shift If true, each term is shifted so that it is continuous at the cutoff
+
+        \return True if either term is evaluated, or false if neither is
+    */
+    DEVICE bool evalForceAndEnergy(Scalar& force_divr, Scalar& pair_eng, bool energy_shift)
+        {
+        force_divr = Scalar(0.0);
+        pair_eng = Scalar(0.0);
+
+        Scalar force_divr_term = Scalar(0.0);
+        Scalar pair_eng_term = Scalar(0.0);
+        const bool evaluated_a
+            = eval_a.evalForceAndEnergy(force_divr_term, pair_eng_term, energy_shift);
+        if (evaluated_a)
+            {
+            force_divr += force_divr_term;
+            pair_eng += pair_eng_term;
+            }
+
+        force_divr_term = Scalar(0.0);
+        pair_eng_term = Scalar(0.0);
+        const bool evaluated_b
+            = eval_b.evalForceAndEnergy(force_divr_term, pair_eng_term, energy_shift);
+        if (evaluated_b)
+            {
+            force_divr += force_divr_term;
+            pair_eng += pair_eng_term;
+            }
+
+        return evaluated_a || evaluated_b;
+        }
+
+    //! Evaluate the force and energy with the thermostat of the first term
+    /*! \param force_divr Output parameter to write the total force divided by r.
+        \param force_divr_cons Output parameter to write the conservative force divided by r.
+        \param pair_eng Output parameter to write the computed pair energy
+        \param energy_shift If true, each term is shifted so that it is continuous at the cutoff
+
+        \return True if either term is evaluated, or false if neither is
+    */
+    DEVICE bool evalForceEnergyThermo(Scalar& force_divr,
+                                      Scalar& force_divr_cons,
+                                      Scalar& pair_eng,
+                                      bool energy_shift)
+        {
+        force_divr = Scalar(0.0);
+        force_divr_cons = Scalar(0.0);
+        pair_eng = Scalar(0.0);
+
+        Scalar force_divr_cons_term = Scalar(0.0);
+        const bool evaluated_a = eval_a.evalForceEnergyThermo(force_divr,
+                                                              force_divr_cons_term,
+                                                              pair_eng,
+                                                              energy_shift);
+        if (evaluated_a)
+            {
+            force_divr_cons = force_divr_cons_term;
+            }
+        else
+            {
+            force_divr = Scalar(0.0);
+            pair_eng = Scalar(0.0);
+            }
+
+        Scalar force_divr_term = Scalar(0.0);
+        Scalar pair_eng_term = Scalar(0.0);
+        const bool evaluated_b
+            = eval_b.evalForceAndEnergy(force_divr_term, pair_eng_term, energy_shift);
+        if (evaluated_b)
+            {
+            force_divr += force_divr_term;
+            force_divr_cons += force_divr_term;
+            pair_eng += pair_eng_term;
+            }
+
+        return evaluated_a || evaluated_b;
+        }
+
+    DEVICE Scalar evalPressureLRCIntegral()
+        {
+        return eval_a.evalPressureLRCIntegral() + eval_b.evalPressureLRCIntegral();
+        }
+
+    DEVICE Scalar evalEnergyLRCIntegral()
+        {
+        return eval_a.evalEnergyLRCIntegral() + eval_b.evalEnergyLRCIntegral();
+        }
+
+#ifndef __HIPCC__
+    //! Get the name of this potential
+    /*! \returns The potential name.
+     */
+    static std::string getName()
+        {
+        return EvaluatorA::getName() + "_" + EvaluatorB::getName();
+        }
+
+    std::string getShapeSpec() const
+        {
+        throw std::runtime_error("Shape definition not supported for this pair potential.");
+        }
+#endif
+
+    protected:
+    EvaluatorA eval_a; //!< Evaluator of the first term
+    EvaluatorB eval_b; //!< Evaluator of the second term
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PAIR_EVALUATOR_COMPOSITE_H__
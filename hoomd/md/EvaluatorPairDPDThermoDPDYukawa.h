@@ -0,0 +1,26 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PAIR_EVALUATOR_DPD_THERMO_DPD_YUKAWA_H__
+#define __PAIR_EVALUATOR_DPD_THERMO_DPD_YUKAWA_H__
+
+#include "EvaluatorPairComposite.h"
+#include "EvaluatorPairDPDThermoDPD.h"
+#include "EvaluatorPairYukawa.h"
+
+/*! \file EvaluatorPairDPDThermoDPDYukawa.h
+    \brief Defines the pair evaluator for the DPD thermostat combined with the Yukawa potential
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Evaluates the DPD thermostat and the Yukawa potential in one pass over the neighbor list
+typedef EvaluatorPairComposite<EvaluatorPairDPDThermoDPD, EvaluatorPairYukawa>
+    EvaluatorPairDPDThermoDPDYukawa;
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PAIR_EVALUATOR_DPD_THERMO_DPD_YUKAWA_H__
@@ -0,0 +1,25 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PAIR_EVALUATOR_LJ_YUKAWA_H__
+#define __PAIR_EVALUATOR_LJ_YUKAWA_H__
+
+#include "EvaluatorPairComposite.h"
+#include "EvaluatorPairLJ.h"
+#include "EvaluatorPairYukawa.h"
+
+/*! \file EvaluatorPairLJYukawa.h
+    \brief Defines the pair evaluator for the sum of the LJ and Yukawa potentials
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Evaluates the LJ and Yukawa potentials in one pass over the neighbor list
+typedef EvaluatorPairComposite<EvaluatorPairLJ, EvaluatorPairYukawa> EvaluatorPairLJYukawa;
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PAIR_EVALUATOR_LJ_YUKAWA_H__
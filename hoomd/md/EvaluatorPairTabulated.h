@@ -0,0 +1,343 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PAIR_EVALUATOR_TABULATED_H__
+#define __PAIR_EVALUATOR_TABULATED_H__
+
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/ManagedArray.h"
+
+#ifndef __HIPCC__
+#include <cmath>
+#include <limits>
+#include <pybind11/pybind11.h>
+#include <string>
+#endif
+
+/*! \file EvaluatorPairTabulated.h
+    \brief Defines an evaluator class that tabulates another pair potential
+*/
+
+// need to declare these class methods with __device__ qualifiers when building in nvcc
+// DEVICE is __host__ __device__ when included in nvcc and blank when included into the host
+// compiler
+#ifdef __HIPCC__
+#define DEVICE __device__
+#define HOSTDEVICE __host__ __device__
+#else
+#define DEVICE
+#define HOSTDEVICE
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Class for evaluating a pair potential from a cubic spline table
+/*! <b>General Overview</b>
+
+    See EvaluatorPairLJ
+
+    <b>Tabulated specifics</b>
+
+    EvaluatorPairTabulated wraps an analytic pair evaluator that is expensive to evaluate (e.g. one
+    that calls pow or exp). When the parameters of a type pair are set, the energy V and the force
+    F = -dV/dr of the wrapped evaluator are sampled at evenly spaced distances between \a r_min and
+    \a r_max. Each interval is interpolated with a cubic Hermite spline through the energy and its
+    derivative at both ends, and the force is the derivative of the spline, so the interpolated
+    force and energy are consistent. The number of intervals is doubled, starting from 16, until the
+    spline matches the analytic energy and force to within \a tolerance at the points of each
+    interval where the interpolation error is largest. The tolerance is relative to the magnitude
+    of the value, or absolute for values smaller than 1.
+
+    Like EvaluatorPairTable, the table is a ManagedArray that PotentialPairGPU loads into shared
+    memory when it fits.
+
+    Pairs closer than \a r_min or farther than \a r_max are evaluated with the wrapped evaluator.
+    When the energy is shifted and the cutoff is beyond \a r_max, all pairs are evaluated with the
+    wrapped evaluator, because the shift cannot be taken from the table. The table is sampled with
+    a cutoff of \a r_max, so set \a r_max to the pair cutoff for evaluators whose force depends on
+    the cutoff.
+
+    Evaluators that need the particle charges cannot be tabulated.
+*/
+template<class Evaluator> class EvaluatorPairTabulated
+    {
+    public:
+    //! Define the parameter type used by this pair potential evaluator
+    struct param_type
+        {
+        typename Evaluator::param_type params; //!< Parameters of the wrapped evaluator
+        Scalar r_min;                          //!< Distance of the first point of the table
+        Scalar r_max;                          //!< Distance of the last point of the table
+        Scalar dr_inv;                         //!< Inverse of the spacing between points
+        Scalar tolerance;                      //!< Tolerance used to build the table
+        ManagedArray<Scalar2> table;           //!< Energy and force at each point
+
+        //! Load dynamic data members into shared memory and increase pointer
+        /*! \param ptr Pointer to load data to (will be incremented)
+            \param available_bytes Size of remaining shared memory allocation
+         */
+        DEVICE void load_shared(char*& ptr, unsigned int& available_bytes)
+            {
+            params.load_shared(ptr, available_bytes);
+            table.load_shared(ptr, available_bytes);
+            }
+
+        HOSTDEVICE void allocate_shared(char*& ptr, unsigned int& available_bytes) const
+            {
+            params.allocate_shared(ptr, available_bytes);
+            table.allocate_shared(ptr, available_bytes);
+            }
+
+#ifdef ENABLE_HIP
+        //! Attach managed memory to CUDA stream
+        void set_memory_hint() const
+            {
+            params.set_memory_hint();
+            table.set_memory_hint();
+            }
+#endif
+
+#ifndef __HIPCC__
+        param_type() : params(), r_min(0.0), r_max(0.0), dr_inv(0.0), tolerance(0.0) { }
+
+        param_type(pybind11::dict v, bool managed = false) : params(v, managed)
+            {
+            if (Evaluator::needsCharge())
+                {
+                throw std::runtime_error("Pair potentials that use charge cannot be tabulated.");
+                }
+
+            r_min = v["r_min"].cast<Scalar>();
+            r_max = v["r_max"].cast<Scalar>();
+            tolerance = v["tolerance"].cast<Scalar>();
+            if (!(r_min >= Scalar(0.0) && r_max > r_min))
+                {
+                throw std::runtime_error("The table requires 0 <= r_min < r_max.");
+                }
+            if (!(tolerance > Scalar(0.0)))
+                {
+                throw std::runtime_error("The table tolerance must be positive.");
+                }
+
+            buildTable(managed);
+            }
+
+        pybind11::dict asDict()
+            {
+            pybind11::dict v = params.asDict();
+            v["r_min"] = r_min;
+            v["r_max"] = r_max;
+            v["tolerance"] = tolerance;
+            return v;
+            }
+
+        private:
+        //! Sample the wrapped evaluator and set the number of points to meet the tolerance
+        void buildTable(bool managed)
+            {
+            // sample with a cutoff just beyond r_max so that the last point is inside it
+            const Scalar rcutsq = std::nextafter(r_max * r_max, std::numeric_limits<Scalar>::max());
+            const unsigned int max_intervals = 1 << 16;
+            for (unsigned int n = 16; n <= max_intervals; n *= 2)
+                {
+                const Scalar dr = (r_max - r_min) / Scalar(n);
+                dr_inv = Scalar(1.0) / dr;
+                table = ManagedArray<Scalar2>(n + 1, managed);
+                for (unsigned int i = 0; i <= n; ++i)
+                    {
+                    table[i] = sample(r_min + Scalar(i) * dr, rcutsq);
+                    }
+
+                // the error of the energy is largest at the midpoint of an interval, and the error
+                // of the force is largest at 1/2 -+ 1/(2 sqrt(3))
+                const Scalar offsets[] = {Scalar(0.5), Scalar(0.2113248654), Scalar(0.7886751346)};
+                bool converged = true;
+                for (unsigned int i = 0; i < n && converged; ++i)
+                    {
+                    for (const Scalar offset : offsets)
+                        {
+                        const Scalar r = r_min + (Scalar(i) + offset) * dr;
+                        const Scalar2 exact = sample(r, rcutsq);
+                        Scalar V, F;
+                        interpolate(table.get(), n, r_min, dr_inv, r, V, F);
+                        converged = converged && isClose(V, exact.x) && isClose(F, exact.y);
+                        }
+                    }
+                if (converged)
+                    {
+                    return;
+                    }
+                }
+
+            throw std::runtime_error("The pair potential could not be tabulated to within "
+                                     + std::to_string(tolerance) + " with "
+                                     + std::to_string(max_intervals) + " intervals.");
+            }
+
+        //! Evaluate the energy and force of the wrapped evaluator at a distance
+        Scalar2 sample(Scalar r, Scalar rcutsq) const
+            {
+            Evaluator eval(r * r, rcutsq, params);
+            Scalar force_divr = Scalar(0.0);
+            Scalar pair_eng = Scalar(0.0);
+            if (!eval.evalForceAndEnergy(force_divr, pair_eng, false))
+                {
+                return make_scalar2(0.0, 0.0);
+                }
+            return make_scalar2(pair_eng, force_divr * r);
+            }
+
+        //! Check if an interpolated value is within the tolerance (false for NaN and inf)
+        bool isClose(Scalar value, Scalar exact) const
+            {
+            const Scalar scale = std::abs(exact) > Scalar(1.0) ? std::abs(exact) : Scalar(1.0);
+            return std::abs(value - exact) <= tolerance * scale;
+            }
+#endif
+        }
+#if HOOMD_LONGREAL_SIZE == 32
+        __attribute__((aligned(8)));
+#else
+        __attribute__((aligned(16)));
+#endif
+
+    //! Constructs the pair potential evaluator
+    /*! \param _rsq Squared distance between the particles
+        \param _rcutsq Squared distance at which the potential goes to 0
+        \param _params Per type pair parameters of this potential
+    */
+    DEVICE EvaluatorPairTabulated(Scalar _rsq, Scalar _rcutsq, const param_type& _params)
+        : rsq(_rsq), rcutsq(_rcutsq), params(_params)
+        {
+        }
+
+    //! Tabulated potentials don't use charge
+    DEVICE static bool needsCharge()
+        {
+        return false;
+        }
+
+    //! Accept the optional charge values.
+    /*! \param qi Charge of particle i
+        \param qj Charge of particle j
+    */
+    DEVICE void setCharge(Scalar qi, Scalar qj) { }
+
+    //! Evaluate the force and energy
+    /*! \param force_divr Output parameter to write the computed force divided by r.
+        \param pair_eng Output parameter to write the computed pair energy
+        \param energy_shift If true, the potential must be shifted so that V(r) is continuous at the
+        cutoff
+
+        \return True if they are evaluated or false if they are not because we are beyond the cutoff
+    */
+    DEVICE bool evalForceAndEnergy(Scalar& force_divr, Scalar& pair_eng, bool energy_shift)
+        {
+        if (rsq >= rcutsq)
+            return false;
+
+        const Scalar r = fast::sqrt(rsq);
+        const Scalar rcut = fast::sqrt(rcutsq);
+        if (r < params.r_min || r >= params.r_max || (energy_shift && rcut > params.r_max))
+            {
+            Evaluator eval(rsq, rcutsq, params.params);
+            return eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+            }
+
+        const unsigned int n = params.table.size() - 1;
+        Scalar F;
+        interpolate(params.table.get(), n, params.r_min, params.dr_inv, r, pair_eng, F);
+        if (rsq > Scalar(0.0))
+            {
+            force_divr = F / r;
+            }
+
+        if (energy_shift)
+            {
+            Scalar V_cut, F_cut;
+            interpolate(params.table.get(), n, params.r_min, params.dr_inv, rcut, V_cut, F_cut);
+            pair_eng -= V_cut;
+            }
+        return true;
+        }
+
+    DEVICE Scalar evalPressureLRCIntegral()
+        {
+        Evaluator eval(rsq, rcutsq, params.params);
+        return eval.evalPressureLRCIntegral();
+        }
+
+    DEVICE Scalar evalEnergyLRCIntegral()
+        {
+        Evaluator eval(rsq, rcutsq, params.params);
+        return eval.evalEnergyLRCIntegral();
+        }
+
+#ifndef __HIPCC__
+    //! Get the name of this potential
+    /*! \returns The potential name.
+     */
+    static std::string getName()
+        {
+        return std::string("tabulated_") + Evaluator::getName();
+        }
+
+    std::string getShapeSpec() const
+        {
+        throw std::runtime_error("Shape definition not supported for this pair potential.");
+        }
+#endif
+
+    //! Interpolate the energy and force from the table
+    /*! \param table Energy and force at each point
+        \param n Number of intervals in the table
+        \param r_min Distance of the first point
+        \param dr_inv Inverse of the spacing between points
+        \param r Distance to interpolate at (r_min <= r <= r_max)
+        \param V Interpolated energy (output)
+        \param F Interpolated force, the negative derivative of V (output)
+    */
+    HOSTDEVICE static void interpolate(const Scalar2* table,
+                                       unsigned int n,
+                                       Scalar r_min,
+                                       Scalar dr_inv,
+                                       Scalar r,
+                                       Scalar& V,
+                                       Scalar& F)
+        {
+        const Scalar x = (r - r_min) * dr_inv;
+        unsigned int i = static_cast<unsigned int>(x);
+        if (i >= n)
+            i = n - 1;
+        const Scalar t = x - Scalar(i);
+        const Scalar2 p0 = table[i];
+        const Scalar2 p1 = table[i + 1];
+
+        // slopes of the energy with respect to t at both ends of the interval
+        const Scalar dr = Scalar(1.0) / dr_inv;
+        const Scalar m0 = -p0.y * dr;
+        const Scalar m1 = -p1.y * dr;
+
+        const Scalar t2 = t * t;
+        const Scalar t3 = t2 * t;
+        V = (Scalar(2.0) * t3 - Scalar(3.0) * t2 + Scalar(1.0)) * p0.x
+            + (t3 - Scalar(2.0) * t2 + t) * m0 + (Scalar(3.0) * t2 - Scalar(2.0) * t3) * p1.x
+            + (t3 - t2) * m1;
+        const Scalar dV_dt = Scalar(6.0) * (t2 - t) * (p0.x - p1.x)
+                             + (Scalar(3.0) * t2 - Scalar(4.0) * t + Scalar(1.0)) * m0
+                             + (Scalar(3.0) * t2 - Scalar(2.0) * t) * m1;
+        F = -dV_dt * dr_inv;
+        }
+
+    protected:
+    Scalar rsq;                //!< Stored rsq from the constructor
+    Scalar rcutsq;             //!< Stored rcutsq from the constructor
+    const param_type& params; //!< Parameters and table of the type pair
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PAIR_EVALUATOR_TABULATED_H__
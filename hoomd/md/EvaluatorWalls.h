@@ -16,6 +16,7 @@
 #include "WallData.h"
 #include "hoomd/BoxDim.h"
 #include "hoomd/HOOMDMath.h"
+#include "hoomd/Index1D.h"
 #include "hoomd/VectorMath.h"
 
 #undef DEVICE
@@ -102,6 +103,47 @@ DEVICE inline Scalar3 onWallForceDirection(const PlaneWall& wall)
     return vec_to_scalar3(-wall.normal);
     }
 
+/// Function for getting the force direction for particle on the wall with r_extrap
+DEVICE inline Scalar3 onWallForceDirection(const vec3<Scalar>& position, const PlaneWall& wall)
+    {
+    return onWallForceDirection(wall);
+    }
+
+//! Lists the walls near each cell of a grid over the local box
+/*! Walls are numbered with the spheres first, followed by the cylinders and then the planes. Cell
+    \a c holds \a cell_size[c] walls, given by \a cell_walls[cli(k, c)]. A wall is listed in every
+    cell that comes within the largest interaction range of the wall potential of the wall surface,
+    so the walls that are not listed contribute no force to the particles in the cell. An empty
+    list (\a cell_size == nullptr) selects all walls. The cell lists are built by WallCellList.
+*/
+struct wall_cell_list_t
+    {
+    const unsigned int* cell_size = nullptr;  //!< Number of walls in each cell
+    const unsigned int* cell_walls = nullptr; //!< Walls in each cell
+    Index3D ci;                               //!< Indexer of the cells
+    Index2D cli;                              //!< Indexer of the walls in the cells
+    BoxDim box;                               //!< Box the cells divide
+
+    //! Get the cell that contains a position
+    DEVICE inline unsigned int getCell(const Scalar3& pos) const
+        {
+        const Scalar3 f = box.makeFraction(pos);
+        return ci(getCellIndex(f.x, ci.getW()),
+                  getCellIndex(f.y, ci.getH()),
+                  getCellIndex(f.z, ci.getD()));
+        }
+
+    //! Get the cell index of a fractional coordinate along one direction
+    DEVICE inline static unsigned int getCellIndex(Scalar f, unsigned int n)
+        {
+        // particles that moved just outside of the box use the nearest cell
+        if (f <= Scalar(0.0))
+            return 0;
+        unsigned int i = (unsigned int)(f * Scalar(n));
+        return i < n ? i : n - 1;
+        }
+    };
+
 //! Applys a wall force from all walls in the field parameter
 /*! \ingroup computes
  */
@@ -139,8 +181,21 @@ template<class evaluator> class EvaluatorWalls
                           const BoxDim& box,
                           const param_type& p,
                           const field_type& f)
-        : m_pos(pos), m_field(f), m_params(p)
+        : m_pos(pos), m_field(f), m_params(p), m_walls(nullptr), m_n_walls(0)
+        {
+        }
+
+    //! Evaluate only the walls listed for the cell of the particle
+    /*! \param cells Walls near each cell of the local box
+     */
+    DEVICE void setWallCellList(const wall_cell_list_t& cells)
         {
+        if (cells.cell_size)
+            {
+            const unsigned int cell = cells.getCell(m_pos);
+            m_walls = cells.cell_walls + cells.cli(0, cell);
+            m_n_walls = cells.cell_size[cell];
+            }
         }
 
     DEVICE static bool isAnisotropic()
@@ -237,6 +292,49 @@ template<class evaluator> class EvaluatorWalls
             }
         }
 
+    //! Adds the force and energy of a single wall
+    template<class wall_geometry>
+    DEVICE inline void evalWall(Scalar3& F,
+                                Scalar& energy,
+                                const vec3<Scalar>& position,
+                                const wall_geometry& wall)
+        {
+        bool in_active_space = false;
+        Scalar3 drv = distVectorWallToPoint(wall, position, in_active_space);
+        if (m_params.rextrap > 0.0) // extrapolated mode
+            {
+            Scalar rextrapsq = m_params.rextrap * m_params.rextrap;
+            Scalar rsq = dot(drv, drv);
+            if (in_active_space && rsq >= rextrapsq)
+                {
+                callEvaluator(F, energy, drv);
+                }
+            // Need to use extrapolated potential
+            else
+                {
+                Scalar r = fast::sqrt(rsq);
+                // Normalize distance vectors
+                if (rsq == 0.0)
+                    {
+                    in_active_space = true; // just in case
+                    drv = onWallForceDirection(position, wall);
+                    }
+                else
+                    {
+                    drv *= 1 / r;
+                    }
+                // Recompute r and distance vector in terms of r_extrap
+                r = in_active_space ? m_params.rextrap - r : m_params.rextrap + r;
+                drv *= in_active_space ? r : -r;
+                extrapEvaluator(F, energy, drv, rextrapsq, r);
+                }
+            }
+        else if (in_active_space) // normal mode
+            {
+            callEvaluator(F, energy, drv);
+            }
+        }
+
     //! Generates force and energy from standard evaluators using wall geometry functions
     DEVICE void
     evalForceTorqueEnergyAndVirial(Scalar3& F, Scalar3& T, Scalar& energy, Scalar* virial)
@@ -256,118 +354,29 @@ template<class evaluator> class EvaluatorWalls
 
         // convert type as little as possible
         vec3<Scalar> position = vec3<Scalar>(m_pos);
-        Scalar3 drv;
-        bool in_active_space = false;
-        if (m_params.rextrap > 0.0) // extrapolated mode
+        if (m_walls)
             {
-            Scalar rextrapsq = m_params.rextrap * m_params.rextrap;
-            Scalar rsq;
-            for (unsigned int k = 0; k < m_field.numSpheres; k++)
-                {
-                drv = distVectorWallToPoint(m_field.Spheres[k], position, in_active_space);
-                rsq = dot(drv, drv);
-                if (in_active_space && rsq >= rextrapsq)
-                    {
-                    callEvaluator(F, energy, drv);
-                    }
-                // Need to use extrapolated potential
-                else
-                    {
-                    Scalar r = fast::sqrt(rsq);
-                    // Normalize distance vectors
-                    if (rsq == 0.0)
-                        {
-                        in_active_space = true; // just in case
-                        drv = onWallForceDirection(position, m_field.Spheres[k]);
-                        }
-                    else
-                        {
-                        drv *= 1 / r;
-                        }
-                    // Recompute r and distance vector in terms of r_extrap
-                    r = in_active_space ? m_params.rextrap - r : m_params.rextrap + r;
-                    drv *= in_active_space ? r : -r;
-                    extrapEvaluator(F, energy, drv, rextrapsq, r);
-                    }
-                }
-            vec3<Scalar> intermediate_distance_vector;
-            for (unsigned int k = 0; k < m_field.numCylinders; k++)
-                {
-                drv = distVectorWallToPoint(m_field.Cylinders[k], position, in_active_space);
-                rsq = dot(drv, drv);
-                if (in_active_space && rsq >= rextrapsq)
-                    {
-                    callEvaluator(F, energy, drv);
-                    }
-                else
-                    {
-                    Scalar r = fast::sqrt(rsq);
-                    if (rsq == 0.0)
-                        {
-                        in_active_space = true; // just in case
-                        drv = onWallForceDirection(position, m_field.Cylinders[k]);
-                        }
-                    else
-                        {
-                        drv *= 1 / r;
-                        }
-                    r = (in_active_space) ? m_params.rextrap - r : m_params.rextrap + r;
-                    drv *= (in_active_space) ? r : -r;
-                    extrapEvaluator(F, energy, drv, rextrapsq, r);
-                    }
-                }
-            for (unsigned int k = 0; k < m_field.numPlanes; k++)
+            // the walls are listed in the order of the full loop below
+            const unsigned int n_spheres_cylinders = m_field.numSpheres + m_field.numCylinders;
+            for (unsigned int w = 0; w < m_n_walls; w++)
                 {
-                drv = distVectorWallToPoint(m_field.Planes[k], position, in_active_space);
-                rsq = dot(drv, drv);
-                if (in_active_space && rsq >= rextrapsq)
-                    {
-                    callEvaluator(F, energy, drv);
-                    }
+                const unsigned int k = m_walls[w];
+                if (k < m_field.numSpheres)
+                    evalWall(F, energy, position, m_field.Spheres[k]);
+                else if (k < n_spheres_cylinders)
+                    evalWall(F, energy, position, m_field.Cylinders[k - m_field.numSpheres]);
                 else
-                    {
-                    Scalar r = fast::sqrt(rsq);
-                    if (rsq == 0.0)
-                        {
-                        in_active_space = true; // just in case
-                        drv = onWallForceDirection(m_field.Planes[k]);
-                        }
-                    else
-                        {
-                        drv *= 1 / r;
-                        }
-                    r = (in_active_space) ? m_params.rextrap - r : m_params.rextrap + r;
-                    drv *= (in_active_space) ? r : -r;
-                    extrapEvaluator(F, energy, drv, rextrapsq, r);
-                    }
+                    evalWall(F, energy, position, m_field.Planes[k - n_spheres_cylinders]);
                 }
             }
-        else // normal mode
+        else
             {
             for (unsigned int k = 0; k < m_field.numSpheres; k++)
-                {
-                drv = distVectorWallToPoint(m_field.Spheres[k], position, in_active_space);
-                if (in_active_space)
-                    {
-                    callEvaluator(F, energy, drv);
-                    }
-                }
+                evalWall(F, energy, position, m_field.Spheres[k]);
             for (unsigned int k = 0; k < m_field.numCylinders; k++)
-                {
-                drv = distVectorWallToPoint(m_field.Cylinders[k], position, in_active_space);
-                if (in_active_space)
-                    {
-                    callEvaluator(F, energy, drv);
-                    }
-                }
+                evalWall(F, energy, position, m_field.Cylinders[k]);
             for (unsigned int k = 0; k < m_field.numPlanes; k++)
-                {
-                drv = distVectorWallToPoint(m_field.Planes[k], position, in_active_space);
-                if (in_active_space)
-                    {
-                    callEvaluator(F, energy, drv);
-                    }
-                }
+                evalWall(F, energy, position, m_field.Planes[k]);
             }
 
         // evaluate virial
@@ -394,8 +403,25 @@ template<class evaluator> class EvaluatorWalls
     const field_type& m_field; //!< contains all information about the walls.
     param_type m_params;
     Scalar qi;
+    const unsigned int* m_walls; //!< Walls to evaluate, all walls when nullptr
+    unsigned int m_n_walls;      //!< Number of walls to evaluate
     };
 
+//! Restricts the walls evaluated for a particle to the walls near its cell
+/*! External potentials that are not wall potentials evaluate their field as is.
+ */
+template<class evaluator>
+DEVICE inline void selectNearbyWalls(evaluator& eval, const wall_cell_list_t& cells)
+    {
+    }
+
+//! Restricts the walls evaluated for a particle to the walls near its cell
+template<class evaluator>
+DEVICE inline void selectNearbyWalls(EvaluatorWalls<evaluator>& eval, const wall_cell_list_t& cells)
+    {
+    eval.setWallCellList(cells);
+    }
+
     } // end namespace md
     } // end namespace hoomd
 
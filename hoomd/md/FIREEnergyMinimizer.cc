@@ -135,6 +135,17 @@ void FIREEnergyMinimizer::update(uint64_t timestep)
     if (m_converged)
         return;
 
+    for (auto& force : m_forces)
+        {
+        if (force->getTimestepMultiple() != 1)
+            {
+            m_exec_conf->msg->error()
+                << "FIRE energy minimization does not support forces with timestep_multiple > 1"
+                << endl;
+            throw runtime_error("Error updating FIREEnergyMinimizer");
+            }
+        }
+
     IntegratorTwoStep::update(timestep);
 
     Scalar Pt(0.0); // translational power
@@ -27,16 +27,12 @@ FIREEnergyMinimizerGPU::FIREEnergyMinimizerGPU(std::shared_ptr<SystemDefinition>
         throw std::runtime_error("FIREEnergyMinimizerGPU requires a GPU device.");
         }
 
-    // allocate the sum arrays
-    GPUArray<Scalar> sum(1, m_exec_conf);
+    // allocate the sum array
+    GPUArray<Scalar> sum(kernel::fire_sum::count, m_exec_conf);
     m_sum.swap(sum);
-    GPUArray<Scalar> sum3(3, m_exec_conf);
-    m_sum3.swap(sum3);
 
-    // initialize the partial sum arrays
-    m_partial_sum1 = GPUVector<Scalar>(m_exec_conf);
-    m_partial_sum2 = GPUVector<Scalar>(m_exec_conf);
-    m_partial_sum3 = GPUVector<Scalar>(m_exec_conf);
+    // initialize the partial sum array
+    m_partial_sum = GPUVector<Scalar>(m_exec_conf);
 
     reset();
     }
@@ -58,11 +54,9 @@ void FIREEnergyMinimizerGPU::resizePartialSumArrays()
 
     num_blocks = num_blocks / m_block_size + 1;
 
-    if (num_blocks != m_partial_sum1.size())
+    if (kernel::fire_sum::count * num_blocks != m_partial_sum.size())
         {
-        m_partial_sum1.resize(num_blocks);
-        m_partial_sum2.resize(num_blocks);
-        m_partial_sum3.resize(num_blocks);
+        m_partial_sum.resize(kernel::fire_sum::count * num_blocks);
         }
     }
 
@@ -76,76 +70,100 @@ void FIREEnergyMinimizerGPU::update(uint64_t timestep)
 
     IntegratorTwoStep::update(timestep);
 
-    Scalar Pt(0.0); // translational power
-    Scalar Pr(0.0); // rotational power
-    Scalar vnorm(0.0);
-    Scalar fnorm(0.0);
-    Scalar energy(0.0);
-    Scalar tnorm(0.0);
-    Scalar wnorm(0.0);
-
     // update partial sum memory space if needed
     resizePartialSumArrays();
 
-    // compute the total energy on the GPU
-    // CPU version is Scalar energy = computePotentialEnergy(timesteps)/Scalar(group_size);
+    // accumulate the energy, power, and norms of all groups on the GPU with one pass over each
+    // group, then copy all sums to the host at once
     unsigned int total_group_size = 0;
+    bool accumulate = false;
 
     for (auto method = m_methods.begin(); method != m_methods.end(); ++method)
         {
         std::shared_ptr<ParticleGroup> current_group = (*method)->getGroup();
 
         unsigned int group_size = current_group->getNumMembers();
-        total_group_size += group_size;
+        total_group_size += current_group->getNumMembersGlobal();
 
         ArrayHandle<unsigned int> d_index_array(current_group->getIndexArray(),
                                                 access_location::device,
                                                 access_mode::read);
+        ArrayHandle<Scalar4> d_net_force(m_pdata->getNetForce(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                                   access_location::device,
+                                   access_mode::read);
+        ArrayHandle<Scalar3> d_accel(m_pdata->getAccelerations(),
+                                     access_location::device,
+                                     access_mode::read);
+        ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
+                                           access_location::device,
+                                           access_mode::read);
+        ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(),
+                                       access_location::device,
+                                       access_mode::read);
+        ArrayHandle<Scalar4> d_angmom(m_pdata->getAngularMomentumArray(),
+                                      access_location::device,
+                                      access_mode::read);
+        ArrayHandle<Scalar4> d_net_torque(m_pdata->getNetTorqueArray(),
+                                          access_location::device,
+                                          access_mode::read);
+        ArrayHandle<Scalar> d_partial_sum(m_partial_sum,
+                                          access_location::device,
+                                          access_mode::overwrite);
+        ArrayHandle<Scalar> d_sum(m_sum, access_location::device, access_mode::readwrite);
+
+        unsigned int num_blocks = group_size / m_block_size + 1;
+        kernel::gpu_fire_compute_sums(d_index_array.data,
+                                      group_size,
+                                      d_net_force.data,
+                                      d_vel.data,
+                                      d_accel.data,
+                                      d_orientation.data,
+                                      d_inertia.data,
+                                      d_angmom.data,
+                                      d_net_torque.data,
+                                      (*method)->getAnisotropic(),
+                                      d_sum.data,
+                                      d_partial_sum.data,
+                                      accumulate,
+                                      m_block_size,
+                                      num_blocks);
 
-            {
-            ArrayHandle<Scalar4> d_net_force(m_pdata->getNetForce(),
-                                             access_location::device,
-                                             access_mode::read);
-            ArrayHandle<Scalar> d_partial_sumE(m_partial_sum1,
-                                               access_location::device,
-                                               access_mode::overwrite);
-            ArrayHandle<Scalar> d_sumE(m_sum, access_location::device, access_mode::overwrite);
-
-            unsigned int num_blocks = group_size / m_block_size + 1;
-            kernel::gpu_fire_compute_sum_pe(d_index_array.data,
-                                            group_size,
-                                            d_net_force.data,
-                                            d_sumE.data,
-                                            d_partial_sumE.data,
-                                            m_block_size,
-                                            num_blocks);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
 
-            if (m_exec_conf->isCUDAErrorCheckingEnabled())
-                CHECK_CUDA_ERROR();
-            }
+        accumulate = true;
+        }
 
-        ArrayHandle<Scalar> h_sumE(m_sum, access_location::host, access_mode::read);
-        energy += h_sumE.data[0];
+    Scalar sums[kernel::fire_sum::count] = {};
+    if (accumulate)
+        {
+        ArrayHandle<Scalar> h_sum(m_sum, access_location::host, access_mode::read);
+        std::copy(h_sum.data, h_sum.data + kernel::fire_sum::count, sums);
         }
 
 #ifdef ENABLE_MPI
     if (m_pdata->getDomainDecomposition())
         {
         MPI_Allreduce(MPI_IN_PLACE,
-                      &energy,
-                      1,
+                      sums,
+                      kernel::fire_sum::count,
                       MPI_HOOMD_SCALAR,
                       MPI_SUM,
                       m_exec_conf->getMPICommunicator());
-        MPI_Allreduce(MPI_IN_PLACE,
-                      &total_group_size,
-                      1,
-                      MPI_INT,
-                      MPI_SUM,
-                      m_exec_conf->getMPICommunicator());
         }
 #endif
 
+    Scalar energy = sums[kernel::fire_sum::pe];
+    Scalar Pt = sums[kernel::fire_sum::P];  // translational power
+    Scalar Pr = sums[kernel::fire_sum::Pr]; // rotational power
+    Scalar vnorm = sums[kernel::fire_sum::vsq];
+    Scalar fnorm = sums[kernel::fire_sum::asq];
+    Scalar wnorm = sums[kernel::fire_sum::wsq];
+    Scalar tnorm = sums[kernel::fire_sum::tsq];
+
     m_energy_total = energy;
     energy /= (Scalar)total_group_size;
 
@@ -155,164 +173,6 @@ void FIREEnergyMinimizerGPU::update(uint64_t timestep)
         m_old_energy = energy + Scalar(100000) * m_etol;
         }
 
-    // sum P, vnorm, fnorm
-
-#ifdef ENABLE_MPI
-    bool aniso = false;
-#endif
-
-    for (auto method = m_methods.begin(); method != m_methods.end(); ++method)
-        {
-        std::shared_ptr<ParticleGroup> current_group = (*method)->getGroup();
-
-        unsigned int group_size = current_group->getNumMembers();
-        ArrayHandle<unsigned int> d_index_array(current_group->getIndexArray(),
-                                                access_location::device,
-                                                access_mode::read);
-
-            {
-            ArrayHandle<Scalar> d_partial_sum_P(m_partial_sum1,
-                                                access_location::device,
-                                                access_mode::overwrite);
-            ArrayHandle<Scalar> d_partial_sum_vsq(m_partial_sum2,
-                                                  access_location::device,
-                                                  access_mode::overwrite);
-            ArrayHandle<Scalar> d_partial_sum_fsq(m_partial_sum3,
-                                                  access_location::device,
-                                                  access_mode::overwrite);
-            ArrayHandle<Scalar> d_sum(m_sum3, access_location::device, access_mode::overwrite);
-            ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
-                                       access_location::device,
-                                       access_mode::read);
-            ArrayHandle<Scalar3> d_accel(m_pdata->getAccelerations(),
-                                         access_location::device,
-                                         access_mode::read);
-
-            unsigned int num_blocks = group_size / m_block_size + 1;
-
-            kernel::gpu_fire_compute_sum_all(m_pdata->getN(),
-                                             d_vel.data,
-                                             d_accel.data,
-                                             d_index_array.data,
-                                             group_size,
-                                             d_sum.data,
-                                             d_partial_sum_P.data,
-                                             d_partial_sum_vsq.data,
-                                             d_partial_sum_fsq.data,
-                                             m_block_size,
-                                             num_blocks);
-
-            if (m_exec_conf->isCUDAErrorCheckingEnabled())
-                CHECK_CUDA_ERROR();
-            }
-
-        ArrayHandle<Scalar> h_sum(m_sum3, access_location::host, access_mode::read);
-        Pt += h_sum.data[0];
-        vnorm += h_sum.data[1];
-        fnorm += h_sum.data[2];
-
-        if ((*method)->getAnisotropic())
-            {
-#ifdef ENABLE_MPI
-            aniso = true;
-#endif
-
-                {
-                ArrayHandle<Scalar> d_partial_sum_Pr(m_partial_sum1,
-                                                     access_location::device,
-                                                     access_mode::overwrite);
-                ArrayHandle<Scalar> d_partial_sum_wnorm(m_partial_sum2,
-                                                        access_location::device,
-                                                        access_mode::overwrite);
-                ArrayHandle<Scalar> d_partial_sum_tsq(m_partial_sum3,
-                                                      access_location::device,
-                                                      access_mode::overwrite);
-                ArrayHandle<Scalar> d_sum(m_sum3, access_location::device, access_mode::overwrite);
-                ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
-                                                   access_location::device,
-                                                   access_mode::read);
-                ArrayHandle<Scalar4> d_angmom(m_pdata->getAngularMomentumArray(),
-                                              access_location::device,
-                                              access_mode::read);
-                ArrayHandle<Scalar4> d_net_torque(m_pdata->getNetTorqueArray(),
-                                                  access_location::device,
-                                                  access_mode::read);
-                ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(),
-                                               access_location::device,
-                                               access_mode::read);
-
-                unsigned int num_blocks = group_size / m_block_size + 1;
-
-                kernel::gpu_fire_compute_sum_all_angular(m_pdata->getN(),
-                                                         d_orientation.data,
-                                                         d_inertia.data,
-                                                         d_angmom.data,
-                                                         d_net_torque.data,
-                                                         d_index_array.data,
-                                                         group_size,
-                                                         d_sum.data,
-                                                         d_partial_sum_Pr.data,
-                                                         d_partial_sum_wnorm.data,
-                                                         d_partial_sum_tsq.data,
-                                                         m_block_size,
-                                                         num_blocks);
-
-                if (m_exec_conf->isCUDAErrorCheckingEnabled())
-                    CHECK_CUDA_ERROR();
-                }
-            ArrayHandle<Scalar> h_sum(m_sum3, access_location::host, access_mode::read);
-            Pr += h_sum.data[0];
-            wnorm += h_sum.data[1];
-            tnorm += h_sum.data[2];
-            }
-        }
-
-#ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
-        {
-        MPI_Allreduce(MPI_IN_PLACE,
-                      &fnorm,
-                      1,
-                      MPI_HOOMD_SCALAR,
-                      MPI_SUM,
-                      m_exec_conf->getMPICommunicator());
-        MPI_Allreduce(MPI_IN_PLACE,
-                      &vnorm,
-                      1,
-                      MPI_HOOMD_SCALAR,
-                      MPI_SUM,
-                      m_exec_conf->getMPICommunicator());
-        MPI_Allreduce(MPI_IN_PLACE,
-                      &Pt,
-                      1,
-                      MPI_HOOMD_SCALAR,
-                      MPI_SUM,
-                      m_exec_conf->getMPICommunicator());
-
-        if (aniso)
-            {
-            MPI_Allreduce(MPI_IN_PLACE,
-                          &tnorm,
-                          1,
-                          MPI_HOOMD_SCALAR,
-                          MPI_SUM,
-                          m_exec_conf->getMPICommunicator());
-            MPI_Allreduce(MPI_IN_PLACE,
-                          &wnorm,
-                          1,
-                          MPI_HOOMD_SCALAR,
-                          MPI_SUM,
-                          m_exec_conf->getMPICommunicator());
-            MPI_Allreduce(MPI_IN_PLACE,
-                          &Pr,
-                          1,
-                          MPI_HOOMD_SCALAR,
-                          MPI_SUM,
-                          m_exec_conf->getMPICommunicator());
-            }
-        }
-#endif
-
     vnorm = sqrt(vnorm);
     fnorm = sqrt(fnorm);
     wnorm = sqrt(wnorm);
@@ -333,7 +193,9 @@ void FIREEnergyMinimizerGPU::update(uint64_t timestep)
         return;
         }
 
-    // update velocities
+    // update velocities, mixing in the force direction while the power is positive and zeroing
+    // them otherwise, with one kernel per group either way
+    Scalar P = Pt + Pr;
 
     Scalar factor_t;
     if (fabs(fnorm) > 0)
@@ -360,51 +222,65 @@ void FIREEnergyMinimizerGPU::update(uint64_t timestep)
         ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
                                    access_location::device,
                                    access_mode::readwrite);
-        ArrayHandle<Scalar3> d_accel(m_pdata->getAccelerations(),
-                                     access_location::device,
-                                     access_mode::read);
 
-        kernel::gpu_fire_update_v(d_vel.data,
-                                  d_accel.data,
-                                  d_index_array.data,
-                                  group_size,
-                                  m_alpha,
-                                  factor_t);
+        if (P > Scalar(0.0))
+            {
+            ArrayHandle<Scalar3> d_accel(m_pdata->getAccelerations(),
+                                         access_location::device,
+                                         access_mode::read);
+
+            kernel::gpu_fire_update_v(d_vel.data,
+                                      d_accel.data,
+                                      d_index_array.data,
+                                      group_size,
+                                      m_alpha,
+                                      factor_t);
+            }
+        else
+            {
+            kernel::gpu_fire_zero_v(d_vel.data, d_index_array.data, group_size);
+            }
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
 
         if ((*method)->getAnisotropic())
             {
-            ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
-                                               access_location::device,
-                                               access_mode::read);
-            ArrayHandle<Scalar4> d_net_torque(m_pdata->getNetTorqueArray(),
-                                              access_location::device,
-                                              access_mode::read);
             ArrayHandle<Scalar4> d_angmom(m_pdata->getAngularMomentumArray(),
                                           access_location::device,
                                           access_mode::readwrite);
-            ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(),
-                                           access_location::device,
-                                           access_mode::read);
 
-            kernel::gpu_fire_update_angmom(d_net_torque.data,
-                                           d_orientation.data,
-                                           d_inertia.data,
-                                           d_angmom.data,
-                                           d_index_array.data,
-                                           group_size,
-                                           m_alpha,
-                                           factor_r);
+            if (P > Scalar(0.0))
+                {
+                ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
+                                                   access_location::device,
+                                                   access_mode::read);
+                ArrayHandle<Scalar4> d_net_torque(m_pdata->getNetTorqueArray(),
+                                                  access_location::device,
+                                                  access_mode::read);
+                ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(),
+                                               access_location::device,
+                                               access_mode::read);
+
+                kernel::gpu_fire_update_angmom(d_net_torque.data,
+                                               d_orientation.data,
+                                               d_inertia.data,
+                                               d_angmom.data,
+                                               d_index_array.data,
+                                               group_size,
+                                               m_alpha,
+                                               factor_r);
+                }
+            else
+                {
+                kernel::gpu_fire_zero_angmom(d_angmom.data, d_index_array.data, group_size);
+                }
 
             if (m_exec_conf->isCUDAErrorCheckingEnabled())
                 CHECK_CUDA_ERROR();
             }
         }
 
-    Scalar P = Pt + Pr;
-
     if (P > Scalar(0.0))
         {
         m_n_since_negative++;
@@ -414,39 +290,12 @@ void FIREEnergyMinimizerGPU::update(uint64_t timestep)
             m_alpha *= m_falpha;
             }
         }
-    else if (P <= Scalar(0.0))
+    else
         {
         IntegratorTwoStep::setDeltaT(m_deltaT * m_fdec);
         m_alpha = m_alpha_start;
         m_n_since_negative = 0;
         m_exec_conf->msg->notice(6) << "FIRE zero velocities" << std::endl;
-
-        for (auto method = m_methods.begin(); method != m_methods.end(); ++method)
-            {
-            std::shared_ptr<ParticleGroup> current_group = (*method)->getGroup();
-            unsigned int group_size = current_group->getNumMembers();
-            ArrayHandle<unsigned int> d_index_array(current_group->getIndexArray(),
-                                                    access_location::device,
-                                                    access_mode::read);
-
-            ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
-                                       access_location::device,
-                                       access_mode::readwrite);
-
-            kernel::gpu_fire_zero_v(d_vel.data, d_index_array.data, group_size);
-            if (m_exec_conf->isCUDAErrorCheckingEnabled())
-                CHECK_CUDA_ERROR();
-
-            if ((*method)->getAnisotropic())
-                {
-                ArrayHandle<Scalar4> d_angmom(m_pdata->getAngularMomentumArray(),
-                                              access_location::device,
-                                              access_mode::readwrite);
-                kernel::gpu_fire_zero_angmom(d_angmom.data, d_index_array.data, group_size);
-                if (m_exec_conf->isCUDAErrorCheckingEnabled())
-                    CHECK_CUDA_ERROR();
-                }
-            }
         }
 
     m_n_since_start++;
@@ -42,11 +42,8 @@ class PYBIND11_EXPORT FIREEnergyMinimizerGPU : public FIREEnergyMinimizer
     protected:
     unsigned int m_block_size; //!< block size for partial sum memory
 
-    GPUVector<Scalar> m_partial_sum1; //!< memory space for partial sum over P and E
-    GPUVector<Scalar> m_partial_sum2; //!< memory space for partial sum over vsq
-    GPUVector<Scalar> m_partial_sum3; //!< memory space for partial sum over asq
-    GPUArray<Scalar> m_sum;           //!< memory space for sum over E
-    GPUArray<Scalar> m_sum3;          //!< memory space for the sum over P, vsq, asq
+    GPUVector<Scalar> m_partial_sum; //!< memory space for the partial sums of all FIRE quantities
+    GPUArray<Scalar> m_sum;          //!< memory space for the sums of all FIRE quantities
 
     private:
     //! allocate the memory needed to store partial sums
@@ -4,6 +4,8 @@
 #include "ForceCompositeGPU.h"
 #include "hoomd/VectorMath.h"
 
+#include <algorithm>
+
 #include "ForceCompositeGPU.cuh"
 
 /*! \file ForceCompositeGPU.cc
@@ -19,16 +21,31 @@ namespace md
 ForceCompositeGPU::ForceCompositeGPU(std::shared_ptr<SystemDefinition> sysdef)
     : ForceComposite(sysdef)
     {
+    // Bodies larger than the threshold are summed by one block each, smaller bodies share blocks
+    m_large_body_thresholds = {0, 64, 128, 256, 512, 1024};
+
+    // With one body per block, the large body threshold has no effect
+    auto is_parameter_valid = [](const std::array<unsigned int, 3>& parameter) -> bool
+    { return parameter[1] != 1 || parameter[2] == 0; };
+
     // Initialize autotuners.
-    m_tuner_force.reset(new Autotuner<2>({AutotunerBase::makeBlockSizeRange(m_exec_conf),
-                                          AutotunerBase::getTppListPow2(m_exec_conf)},
+    m_tuner_force.reset(new Autotuner<3>({AutotunerBase::makeBlockSizeRange(m_exec_conf),
+                                          AutotunerBase::getTppListPow2(m_exec_conf),
+                                          m_large_body_thresholds},
                                          m_exec_conf,
-                                         "force_composite"));
-
-    m_tuner_virial.reset(new Autotuner<2>({AutotunerBase::makeBlockSizeRange(m_exec_conf),
-                                           AutotunerBase::getTppListPow2(m_exec_conf)},
+                                         "force_composite",
+                                         5,
+                                         false,
+                                         is_parameter_valid));
+
+    m_tuner_virial.reset(new Autotuner<3>({AutotunerBase::makeBlockSizeRange(m_exec_conf),
+                                           AutotunerBase::getTppListPow2(m_exec_conf),
+                                           m_large_body_thresholds},
                                           m_exec_conf,
-                                          "virial_composite"));
+                                          "virial_composite",
+                                          5,
+                                          false,
+                                          is_parameter_valid));
 
     m_tuner_update.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                           m_exec_conf,
@@ -50,6 +67,12 @@ ForceCompositeGPU::ForceCompositeGPU(std::shared_ptr<SystemDefinition> sysdef)
     m_lookup_center.swap(lookup_center);
     TAG_ALLOCATION(m_lookup_center);
 
+    GlobalVector<unsigned int> rigid_center_size(m_exec_conf);
+    m_rigid_center_size.swap(rigid_center_size);
+    TAG_ALLOCATION(m_rigid_center_size);
+
+    m_n_small_bodies.resize(m_large_body_thresholds.size(), 0);
+
 #ifdef __HIP_PLATFORM_NVCC__
     if (m_exec_conf->allConcurrentManagedAccess())
         {
@@ -177,32 +200,41 @@ void ForceCompositeGPU::computeForces(uint64_t timestep)
         unsigned int block_size = param[0];
         unsigned int n_bodies_per_block = param[1];
 
-        // launch GPU kernel
-        kernel::gpu_rigid_force(d_force.data,
-                                d_torque.data,
-                                d_molecule_length.data,
-                                d_molecule_list.data,
-                                d_molecule_idx.data,
-                                d_rigid_center.data,
-                                molecule_indexer,
-                                d_postype.data,
-                                d_orientation.data,
-                                m_body_idx,
-                                d_body_pos.data,
-                                d_body_orientation.data,
-                                d_body_len.data,
-                                d_body.data,
-                                d_tag.data,
-                                d_flag.data,
-                                d_net_force.data,
-                                d_net_torque.data,
-                                nmol,
-                                m_pdata->getN(),
-                                n_bodies_per_block,
-                                block_size,
-                                m_exec_conf->dev_prop,
-                                !compute_virial,
-                                m_gpu_partition);
+        GPUPartition partition_small, partition_large;
+        unsigned int n_large = getBodyPartitions(param[2], partition_small, partition_large);
+
+        // launch GPU kernel, the large bodies get one block each
+        for (unsigned int large = 0; large < 2; ++large)
+            {
+            if (large && n_large == 0)
+                break;
+
+            kernel::gpu_rigid_force(d_force.data,
+                                    d_torque.data,
+                                    d_molecule_length.data,
+                                    d_molecule_list.data,
+                                    d_molecule_idx.data,
+                                    d_rigid_center.data,
+                                    molecule_indexer,
+                                    d_postype.data,
+                                    d_orientation.data,
+                                    m_body_idx,
+                                    d_body_pos.data,
+                                    d_body_orientation.data,
+                                    d_body_len.data,
+                                    d_body.data,
+                                    d_tag.data,
+                                    d_flag.data,
+                                    d_net_force.data,
+                                    d_net_torque.data,
+                                    nmol,
+                                    m_pdata->getN(),
+                                    large ? 1 : n_bodies_per_block,
+                                    block_size,
+                                    m_exec_conf->dev_prop,
+                                    !compute_virial,
+                                    large ? partition_large : partition_small);
+            }
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
@@ -258,30 +290,39 @@ void ForceCompositeGPU::computeForces(uint64_t timestep)
         unsigned int block_size = param[0];
         unsigned int n_bodies_per_block = param[1];
 
-        // launch GPU kernel
-        kernel::gpu_rigid_virial(d_virial.data,
-                                 d_molecule_length.data,
-                                 d_molecule_list.data,
-                                 d_molecule_idx.data,
-                                 d_rigid_center.data,
-                                 molecule_indexer,
-                                 d_postype.data,
-                                 d_orientation.data,
-                                 m_body_idx,
-                                 d_body_pos.data,
-                                 d_body_orientation.data,
-                                 d_net_force.data,
-                                 d_net_virial.data,
-                                 d_body.data,
-                                 d_tag.data,
-                                 nmol,
-                                 m_pdata->getN(),
-                                 n_bodies_per_block,
-                                 m_pdata->getNetVirial().getPitch(),
-                                 m_virial_pitch,
-                                 block_size,
-                                 m_exec_conf->dev_prop,
-                                 m_gpu_partition);
+        GPUPartition partition_small, partition_large;
+        unsigned int n_large = getBodyPartitions(param[2], partition_small, partition_large);
+
+        // launch GPU kernel, the large bodies get one block each
+        for (unsigned int large = 0; large < 2; ++large)
+            {
+            if (large && n_large == 0)
+                break;
+
+            kernel::gpu_rigid_virial(d_virial.data,
+                                     d_molecule_length.data,
+                                     d_molecule_list.data,
+                                     d_molecule_idx.data,
+                                     d_rigid_center.data,
+                                     molecule_indexer,
+                                     d_postype.data,
+                                     d_orientation.data,
+                                     m_body_idx,
+                                     d_body_pos.data,
+                                     d_body_orientation.data,
+                                     d_net_force.data,
+                                     d_net_virial.data,
+                                     d_body.data,
+                                     d_tag.data,
+                                     nmol,
+                                     m_pdata->getN(),
+                                     large ? 1 : n_bodies_per_block,
+                                     m_pdata->getNetVirial().getPitch(),
+                                     m_virial_pitch,
+                                     block_size,
+                                     m_exec_conf->dev_prop,
+                                     large ? partition_large : partition_small);
+            }
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
@@ -465,6 +506,68 @@ void ForceCompositeGPU::findRigidCenters()
     // distribute rigid body centers over GPUs
     m_gpu_partition = GPUPartition(m_exec_conf->getGPUIds());
     m_gpu_partition.setN(n_rigid);
+    m_n_rigid = n_rigid;
+
+    // sort the bodies by size so that the large bodies are at the end of the list
+    m_rigid_center_size.resize(m_rigid_center.size());
+        {
+        ArrayHandle<unsigned int> d_rigid_center_size(m_rigid_center_size,
+                                                      access_location::device,
+                                                      access_mode::overwrite);
+        ArrayHandle<Scalar4> d_postype(m_pdata->getPositions(),
+                                       access_location::device,
+                                       access_mode::read);
+        ArrayHandle<unsigned int> d_body_len(m_body_len,
+                                             access_location::device,
+                                             access_mode::read);
+
+        kernel::gpu_sort_rigid_centers_by_size(d_rigid_center.data,
+                                               d_rigid_center_size.data,
+                                               n_rigid,
+                                               d_postype.data,
+                                               d_body_len.data);
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+    // count the small bodies for each threshold
+    ArrayHandle<unsigned int> h_rigid_center_size(m_rigid_center_size,
+                                                  access_location::host,
+                                                  access_mode::read);
+    for (unsigned int i = 0; i < m_large_body_thresholds.size(); ++i)
+        {
+        unsigned int threshold = m_large_body_thresholds[i];
+        m_n_small_bodies[i]
+            = threshold == 0 ? n_rigid
+                             : (unsigned int)(std::upper_bound(h_rigid_center_size.data,
+                                                               h_rigid_center_size.data + n_rigid,
+                                                               threshold)
+                                              - h_rigid_center_size.data);
+        }
+    }
+
+/*! \param threshold Bodies with more particles than this are large, 0 makes all bodies small
+    \param partition_small Set to the partition of the small bodies over the GPUs
+    \param partition_large Set to the partition of the large bodies over the GPUs
+    \returns The number of large bodies
+*/
+unsigned int ForceCompositeGPU::getBodyPartitions(unsigned int threshold,
+                                                  GPUPartition& partition_small,
+                                                  GPUPartition& partition_large)
+    {
+    unsigned int i = (unsigned int)(std::find(m_large_body_thresholds.begin(),
+                                              m_large_body_thresholds.end(),
+                                              threshold)
+                                    - m_large_body_thresholds.begin());
+    unsigned int n_small = m_n_small_bodies[i];
+
+    // small bodies come first in m_rigid_center
+    partition_small = GPUPartition(m_exec_conf->getGPUIds());
+    partition_small.setN(n_small);
+    partition_large = GPUPartition(m_exec_conf->getGPUIds());
+    partition_large.setN(m_n_rigid - n_small, n_small);
+    return m_n_rigid - n_small;
     }
 
 namespace detail
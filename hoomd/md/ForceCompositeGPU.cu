@@ -18,6 +18,7 @@
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 #pragma GCC diagnostic pop
@@ -868,6 +869,43 @@ hipError_t gpu_find_rigid_centers(const unsigned int* d_body,
     return hipSuccess;
     }
 
+// number of particles in the rigid body with the given central particle
+struct body_size_op : thrust::unary_function<unsigned int, unsigned int>
+    {
+    __host__ __device__ body_size_op(const Scalar4* _d_postype, const unsigned int* _d_body_len)
+        : d_postype(_d_postype), d_body_len(_d_body_len)
+        {
+        }
+
+    __device__ unsigned int operator()(const unsigned int& center)
+        {
+        return d_body_len[__scalar_as_int(d_postype[center].w)] + 1;
+        }
+
+    const Scalar4* d_postype;
+    const unsigned int* d_body_len;
+    };
+
+hipError_t gpu_sort_rigid_centers_by_size(unsigned int* d_rigid_center,
+                                          unsigned int* d_rigid_center_size,
+                                          unsigned int n_rigid,
+                                          const Scalar4* d_postype,
+                                          const unsigned int* d_body_len)
+    {
+    thrust::device_ptr<unsigned int> rigid_center(d_rigid_center);
+    thrust::device_ptr<unsigned int> rigid_center_size(d_rigid_center_size);
+
+    thrust::transform(rigid_center,
+                      rigid_center + n_rigid,
+                      rigid_center_size,
+                      body_size_op(d_postype, d_body_len));
+
+    // the stable sort preserves the spatial order of bodies of the same size
+    thrust::stable_sort_by_key(rigid_center_size, rigid_center_size + n_rigid, rigid_center);
+
+    return hipSuccess;
+    }
+
     } // end namespace kernel
     } // end namespace md
     } // end namespace hoomd
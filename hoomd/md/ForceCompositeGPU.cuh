@@ -93,6 +93,13 @@ hipError_t gpu_find_rigid_centers(const unsigned int* d_body,
                                   unsigned int* d_lookup_center,
                                   unsigned int& n_rigid);
 
+//! Sort the central particles by the number of particles in their body
+hipError_t gpu_sort_rigid_centers_by_size(unsigned int* d_rigid_center,
+                                          unsigned int* d_rigid_center_size,
+                                          unsigned int n_rigid,
+                                          const Scalar4* d_postype,
+                                          const unsigned int* d_body_len);
+
     } // end namespace kernel
     } // end namespace md
     } // end namespace hoomd
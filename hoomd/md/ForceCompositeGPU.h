@@ -57,11 +57,11 @@ class PYBIND11_EXPORT ForceCompositeGPU : public ForceComposite
         MolecularForceCompute::checkParticlesSorted();
         }
 
-    /// Autotuner for block size and threads per body.
-    std::shared_ptr<Autotuner<2>> m_tuner_force;
+    /// Autotuner for block size, bodies per block, and large body threshold.
+    std::shared_ptr<Autotuner<3>> m_tuner_force;
 
-    /// Autotuner for block size and threads per body.
-    std::shared_ptr<Autotuner<2>> m_tuner_virial;
+    /// Autotuner for block size, bodies per block, and large body threshold.
+    std::shared_ptr<Autotuner<3>> m_tuner_virial;
 
     /// Autotuner for block size of update kernel.
     std::shared_ptr<Autotuner<1>> m_tuner_update;
@@ -72,6 +72,23 @@ class PYBIND11_EXPORT ForceCompositeGPU : public ForceComposite
     GlobalVector<unsigned int>
         m_rigid_center; //!< Contains particle indices of all central particles
     GlobalVector<unsigned int> m_lookup_center; //!< Lookup particle index -> central particle index
+
+    /// Number of particles in each body in m_rigid_center, in ascending order
+    GlobalVector<unsigned int> m_rigid_center_size;
+
+    /// Candidate body sizes above which one block sums each body (0 disables)
+    std::vector<unsigned int> m_large_body_thresholds;
+
+    /// Number of central particles in m_rigid_center
+    unsigned int m_n_rigid = 0;
+
+    /// Number of bodies at or below each of the large body thresholds
+    std::vector<unsigned int> m_n_small_bodies;
+
+    /// Get the partitions of the small and the large bodies over the GPUs
+    unsigned int getBodyPartitions(unsigned int threshold,
+                                   GPUPartition& partition_small,
+                                   GPUPartition& partition_large);
     };
 
     } // end namespace md
@@ -3,6 +3,7 @@
 
 #include "ForceDistanceConstraint.h"
 
+#include <cmath>
 #include <string.h>
 using namespace Eigen;
 
@@ -20,7 +21,8 @@ ForceDistanceConstraint::ForceDistanceConstraint(std::shared_ptr<SystemDefinitio
     : MolecularForceCompute(sysdef), m_cdata(m_sysdef->getConstraintData()), m_cmatrix(m_exec_conf),
       m_cvec(m_exec_conf), m_lagrange(m_exec_conf), m_rel_tol(1e-3),
       m_constraint_violated(m_exec_conf), m_condition(m_exec_conf), m_sparse_idxlookup(m_exec_conf),
-      m_constraint_reorder(true), m_constraints_added_removed(true), m_d_max(0.0)
+      m_constraint_reorder(true), m_constraints_added_removed(true), m_d_max(0.0),
+      m_solver("direct"), m_solver_tol(1e-8), m_solver_max_iterations(1000), m_warm_start(false)
     {
     m_constraint_violated.resetFlags(0);
 
@@ -70,6 +72,44 @@ ForceDistanceConstraint::~ForceDistanceConstraint()
 #endif
     }
 
+/*! \param solver "direct" to solve the constraint equation with a sparse LU decomposition or
+        "iterative" to solve it with the matrix free BiCGSTAB method
+*/
+void ForceDistanceConstraint::setSolver(const std::string& solver)
+    {
+    if (solver != "direct" && solver != "iterative")
+        {
+        m_exec_conf->msg->error()
+            << "constrain.distance(): solver must be direct or iterative, got " << solver << "."
+            << std::endl;
+        throw std::invalid_argument("Error setting constraint solver");
+        }
+
+    if (solver == "direct" && m_solver != "direct")
+        {
+        // the sparse matrix has not been kept up to date
+        m_constraint_reorder = true;
+        m_condition.resetFlags(1);
+        }
+
+    m_solver = solver;
+    }
+
+/*! \param solver_tol Norm of the residual relative to the norm of the right hand side at which the
+        iterative solver stops
+*/
+void ForceDistanceConstraint::setSolverTolerance(Scalar solver_tol)
+    {
+    if (!(solver_tol > Scalar(0.0)))
+        {
+        m_exec_conf->msg->error()
+            << "constrain.distance(): solver_tolerance must be positive." << std::endl;
+        throw std::invalid_argument("Error setting constraint solver tolerance");
+        }
+
+    m_solver_tol = solver_tol;
+    }
+
 Scalar ForceDistanceConstraint::getNDOFRemoved(std::shared_ptr<ParticleGroup> query)
     {
     // the distance constraint removes half a degree of freedom for each particle that is part
@@ -116,6 +156,19 @@ void ForceDistanceConstraint::computeForces(uint64_t timestep)
         throw std::runtime_error("No constraints in the system.");
         }
 
+    if (m_solver == "iterative")
+        {
+        // populate the RHS and the terms of the matrix
+        fillVector(timestep);
+
+        checkConstraints(timestep);
+
+        solveConstraintsIterative(timestep);
+
+        computeConstraintForces(timestep);
+        return;
+        }
+
     // reallocate through amortized resizin
     unsigned int n_constraint = m_cdata->getN() + m_cdata->getNGhosts();
     m_cmatrix.resize(n_constraint * n_constraint);
@@ -296,6 +349,230 @@ void ForceDistanceConstraint::fillMatrixVector(uint64_t timestep)
         }
     }
 
+/*! Computes the same RHS as fillMatrixVector. Instead of the matrix, store the separations and
+    particle indices of the constraints that multiplyMatrix needs to apply the matrix.
+*/
+void ForceDistanceConstraint::fillVector(uint64_t timestep)
+    {
+    unsigned int n_constraint = m_cdata->getN() + m_cdata->getNGhosts();
+    unsigned int max_local = m_pdata->getN() + m_pdata->getNGhosts();
+
+    m_cvec.resize(n_constraint);
+    m_constraint_idx.resize(n_constraint);
+    m_constraint_r.resize(n_constraint);
+    m_constraint_q.resize(n_constraint);
+    m_constraint_work.resize(max_local);
+
+    // access particle data
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_netforce(m_pdata->getNetForce(),
+                                    access_location::host,
+                                    access_mode::read);
+
+    ArrayHandle<double> h_cvec(m_cvec, access_location::host, access_mode::overwrite);
+
+    const BoxDim& box = m_pdata->getBox();
+
+    for (unsigned int n = 0; n < n_constraint; ++n)
+        {
+        const ConstraintData::members_t constraint = m_cdata->getMembersByIndex(n);
+        assert(constraint.tag[0] <= m_pdata->getMaximumTag());
+        assert(constraint.tag[1] <= m_pdata->getMaximumTag());
+
+        unsigned int idx_a = h_rtag.data[constraint.tag[0]];
+        unsigned int idx_b = h_rtag.data[constraint.tag[1]];
+
+        if (idx_a >= max_local || idx_b >= max_local)
+            {
+            this->m_exec_conf->msg->error()
+                << "constrain.distance(): constraint " << constraint.tag[0] << " "
+                << constraint.tag[1] << " incomplete." << std::endl
+                << std::endl;
+            throw std::runtime_error("Error in constraint calculation");
+            }
+
+        vec3<Scalar> rn = box.minImage(vec3<Scalar>(h_pos.data[idx_a])
+                                       - vec3<Scalar>(h_pos.data[idx_b]));
+
+        Scalar ma(h_vel.data[idx_a].w);
+        Scalar mb(h_vel.data[idx_b].w);
+        vec3<Scalar> rndot(vec3<Scalar>(h_vel.data[idx_a]) - vec3<Scalar>(h_vel.data[idx_b]));
+        vec3<Scalar> qn(rn + rndot * m_deltaT);
+
+        m_constraint_idx[n] = make_uint2(idx_a, idx_b);
+        m_constraint_r[n] = vec3<double>(rn);
+        m_constraint_q[n] = vec3<double>(qn);
+
+        // get constraint distance
+        Scalar d = m_cdata->getValueByIndex(n);
+
+        // check distance violation
+        if (fast::sqrt(dot(rn, rn)) - d >= m_rel_tol * d || std::isnan(dot(rn, rn)))
+            {
+            m_constraint_violated.resetFlags(n + 1);
+            }
+
+        // fill vector component
+        h_cvec.data[n] = (dot(qn, qn) - d * d) / m_deltaT / m_deltaT;
+        h_cvec.data[n] += double(2.0)
+                          * dot(qn,
+                                vec3<Scalar>(h_netforce.data[idx_a]) / ma
+                                    - vec3<Scalar>(h_netforce.data[idx_b]) / mb);
+        }
+    }
+
+/*! \param x Vector of length n_constraint
+    \param y Set to the product of the constraint matrix with \a x
+
+    The element A_nm of the matrix built in fillMatrixVector is 4 q_n . r_m times the sum of
+    +-1/mass over the particles shared by constraints n and m. Accumulate the sum over m per
+    particle, then project it onto q_n.
+*/
+void ForceDistanceConstraint::multiplyMatrix(const double* x, double* y)
+    {
+    unsigned int n_constraint = (unsigned int)m_constraint_idx.size();
+
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::read);
+
+    for (unsigned int m = 0; m < n_constraint; ++m)
+        {
+        m_constraint_work[m_constraint_idx[m].x] = vec3<double>(0.0, 0.0, 0.0);
+        m_constraint_work[m_constraint_idx[m].y] = vec3<double>(0.0, 0.0, 0.0);
+        }
+
+    for (unsigned int m = 0; m < n_constraint; ++m)
+        {
+        vec3<double> xr = x[m] * m_constraint_r[m];
+        m_constraint_work[m_constraint_idx[m].x] += xr;
+        m_constraint_work[m_constraint_idx[m].y] -= xr;
+        }
+
+    for (unsigned int n = 0; n < n_constraint; ++n)
+        {
+        unsigned int idx_a = m_constraint_idx[n].x;
+        unsigned int idx_b = m_constraint_idx[n].y;
+        double ma(h_vel.data[idx_a].w);
+        double mb(h_vel.data[idx_b].w);
+
+        y[n] = double(4.0)
+               * dot(m_constraint_q[n],
+                     m_constraint_work[idx_a] / ma - m_constraint_work[idx_b] / mb);
+        }
+    }
+
+/*! Solve the constraint equation with the Jacobi preconditioned BiCGSTAB method, starting from the
+    Lagrange multipliers of the previous step when the constraints have not been reordered.
+*/
+void ForceDistanceConstraint::solveConstraintsIterative(uint64_t timestep)
+    {
+    typedef Matrix<double, Dynamic, 1> vec_t;
+    typedef Map<vec_t> vec_map_t;
+
+    unsigned int n_constraint = m_cdata->getN() + m_cdata->getNGhosts();
+
+    // skip if zero constraints
+    if (n_constraint == 0)
+        return;
+
+    // reallocate array of constraint forces, keeping the previous solution
+    bool warm_start = m_warm_start && m_lagrange.size() == n_constraint;
+    m_lagrange.resize(n_constraint);
+
+    ArrayHandle<double> h_cvec(m_cvec, access_location::host, access_mode::read);
+    ArrayHandle<double> h_lagrange(m_lagrange, access_location::host, access_mode::readwrite);
+    vec_map_t b(h_cvec.data, n_constraint, 1);
+    vec_map_t x(h_lagrange.data, n_constraint, 1);
+
+    if (!warm_start)
+        x.setZero();
+
+    // inverse of the diagonal of the matrix
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::read);
+    vec_t inv_diag(n_constraint);
+    for (unsigned int n = 0; n < n_constraint; ++n)
+        {
+        double inv_mass_sum = double(1.0) / h_vel.data[m_constraint_idx[n].x].w
+                              + double(1.0) / h_vel.data[m_constraint_idx[n].y].w;
+        double diag = double(4.0) * dot(m_constraint_q[n], m_constraint_r[n]) * inv_mass_sum;
+        inv_diag[n] = diag != double(0.0) ? double(1.0) / diag : double(1.0);
+        }
+
+    double b_norm = b.norm();
+    if (b_norm == double(0.0))
+        {
+        x.setZero();
+        m_warm_start = true;
+        return;
+        }
+    double tol = m_solver_tol * b_norm;
+
+    vec_t r(n_constraint), r0(n_constraint), p(n_constraint), v(n_constraint), s(n_constraint),
+        t(n_constraint), y(n_constraint), z(n_constraint);
+
+    multiplyMatrix(x.data(), v.data());
+    r = b - v;
+    r0 = r;
+    p.setZero();
+    v.setZero();
+
+    double rho = 1.0, alpha = 1.0, omega = 1.0;
+    unsigned int iteration = 0;
+    bool converged = r.norm() <= tol;
+    while (!converged && iteration < m_solver_max_iterations)
+        {
+        iteration++;
+
+        double rho_new = r0.dot(r);
+        if (rho_new == double(0.0))
+            {
+            // the shadow residual is orthogonal to the residual, restart from the current solution
+            r0 = r;
+            rho_new = r0.dot(r);
+            p.setZero();
+            v.setZero();
+            rho = alpha = omega = 1.0;
+            }
+
+        double beta = (rho_new / rho) * (alpha / omega);
+        p = r + beta * (p - omega * v);
+        y = inv_diag.cwiseProduct(p);
+        multiplyMatrix(y.data(), v.data());
+        alpha = rho_new / r0.dot(v);
+        s = r - alpha * v;
+
+        if (s.norm() <= tol)
+            {
+            x += alpha * y;
+            converged = true;
+            break;
+            }
+
+        z = inv_diag.cwiseProduct(s);
+        multiplyMatrix(z.data(), t.data());
+        omega = t.dot(s) / t.dot(t);
+        x += alpha * y + omega * z;
+        r = s - omega * t;
+        rho = rho_new;
+
+        converged = r.norm() <= tol;
+        }
+
+    if (!converged || !std::isfinite(x.norm()))
+        {
+        m_exec_conf->msg->error()
+            << "constrain.distance(): iterative solver did not converge in "
+            << m_solver_max_iterations << " iterations." << std::endl;
+        throw std::runtime_error("Could not solve linear system of constraint equations.");
+        }
+
+    m_exec_conf->msg->notice(10) << "ForceDistanceConstraint: iterative solver converged in "
+                                 << iteration << " iterations" << std::endl;
+
+    m_warm_start = true;
+    }
+
 void ForceDistanceConstraint::checkConstraints(uint64_t timestep)
     {
     unsigned int n = m_constraint_violated.readFlags();
@@ -658,7 +935,16 @@ void export_ForceDistanceConstraint(pybind11::module& m)
         .def(pybind11::init<std::shared_ptr<SystemDefinition>>())
         .def_property("tolerance",
                       &ForceDistanceConstraint::getRelativeTolerance,
-                      &ForceDistanceConstraint::setRelativeTolerance);
+                      &ForceDistanceConstraint::setRelativeTolerance)
+        .def_property("solver",
+                      &ForceDistanceConstraint::getSolver,
+                      &ForceDistanceConstraint::setSolver)
+        .def_property("solver_tolerance",
+                      &ForceDistanceConstraint::getSolverTolerance,
+                      &ForceDistanceConstraint::setSolverTolerance)
+        .def_property("solver_max_iterations",
+                      &ForceDistanceConstraint::getSolverMaxIterations,
+                      &ForceDistanceConstraint::setSolverMaxIterations);
     }
 
     } // end namespace detail
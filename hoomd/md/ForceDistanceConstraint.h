@@ -18,10 +18,14 @@
 
 #include "hoomd/GPUFlags.h"
 #include "hoomd/GPUVector.h"
+#include "hoomd/VectorMath.h"
 
 #include <Eigen/Dense>
 #include <Eigen/SparseLU>
 
+#include <string>
+#include <vector>
+
 namespace hoomd
     {
 namespace md
@@ -33,6 +37,11 @@ namespace md
    M. Yoneya, “A Generalized Non-iterative Matrix Method for Constraint Molecular Dynamics
    Simulations,” J. Comput. Phys., vol. 172, no. 1, pp. 188–197, Sep. 2001.
 
+    The constraint equation A lambda = b is solved either with a sparse LU decomposition of A
+    ("direct") or with the Jacobi preconditioned BiCGSTAB method ("iterative"). A is not symmetric.
+    The iterative solver never forms A: it applies A from the constraint list in O(N_constraints)
+    operations and starts from the Lagrange multipliers of the previous step.
+
     See Integrator for detailed documentation on constraint force implementation.
     \ingroup computes
 */
@@ -63,6 +72,36 @@ class PYBIND11_EXPORT ForceDistanceConstraint : public MolecularForceCompute
         return m_rel_tol;
         }
 
+    /// Set the method that solves the constraint equation ("direct" or "iterative")
+    void setSolver(const std::string& solver);
+
+    /// Get the method that solves the constraint equation
+    std::string getSolver()
+        {
+        return m_solver;
+        }
+
+    /// Set the residual of the iterative solver relative to the norm of the RHS
+    void setSolverTolerance(Scalar solver_tol);
+
+    /// Get the residual of the iterative solver relative to the norm of the RHS
+    Scalar getSolverTolerance()
+        {
+        return m_solver_tol;
+        }
+
+    /// Set the maximum number of iterations of the iterative solver
+    void setSolverMaxIterations(unsigned int max_iterations)
+        {
+        m_solver_max_iterations = max_iterations;
+        }
+
+    /// Get the maximum number of iterations of the iterative solver
+    unsigned int getSolverMaxIterations()
+        {
+        return m_solver_max_iterations;
+        }
+
 #ifdef ENABLE_MPI
     //! Get ghost particle fields requested by this pair potential
     virtual CommFlags getRequestedCommFlags(uint64_t timestep);
@@ -95,6 +134,16 @@ class PYBIND11_EXPORT ForceDistanceConstraint : public MolecularForceCompute
 
     Scalar m_d_max; //!< Maximum constraint extension
 
+    std::string m_solver;                 //!< Method that solves the constraint equation
+    Scalar m_solver_tol;                  //!< Relative residual of the iterative solver
+    unsigned int m_solver_max_iterations; //!< Maximum number of iterations of the iterative solver
+    bool m_warm_start; //!< True if m_lagrange holds the solution for the current constraint order
+
+    std::vector<uint2> m_constraint_idx;         //!< Particle indices of each constraint
+    std::vector<vec3<double>> m_constraint_r;    //!< Separation of each constraint at t
+    std::vector<vec3<double>> m_constraint_q;    //!< Predicted separation of each constraint
+    std::vector<vec3<double>> m_constraint_work; //!< Per particle work space of multiplyMatrix
+
     //! Compute the forces
     virtual void computeForces(uint64_t timestep);
 
@@ -107,6 +156,15 @@ class PYBIND11_EXPORT ForceDistanceConstraint : public MolecularForceCompute
     //! Solve the constraint matrix equation
     virtual void solveConstraints(uint64_t timestep);
 
+    //! Populate the vector in the constraint-force equation and the terms that make up the matrix
+    void fillVector(uint64_t timestep);
+
+    //! Solve the constraint equation with the matrix free iterative solver
+    void solveConstraintsIterative(uint64_t timestep);
+
+    //! Multiply a vector with the constraint matrix
+    void multiplyMatrix(const double* x, double* y);
+
     //! Solve the linear matrix-vector equation
     virtual void computeConstraintForces(uint64_t timestep);
 
@@ -114,12 +172,14 @@ class PYBIND11_EXPORT ForceDistanceConstraint : public MolecularForceCompute
     virtual void slotConstraintReorder()
         {
         m_constraint_reorder = true;
+        m_warm_start = false;
         }
 
     //! Method called when constraint order changes
     virtual void slotConstraintsAddedRemoved()
         {
         m_constraints_added_removed = true;
+        m_warm_start = false;
         }
 
     //! Returns the requested ghost layer width for all types
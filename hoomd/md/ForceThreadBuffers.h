@@ -0,0 +1,177 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __FORCE_THREAD_BUFFERS_H__
+#define __FORCE_THREAD_BUFFERS_H__
+
+#include "hoomd/ExecutionConfiguration.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/ThreadLoops.h"
+
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <vector>
+
+/*! \file ForceThreadBuffers.h
+    \brief Declares helpers that split the CPU force loops over the TBB threads
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace detail
+    {
+//! Output arrays of a CPU force loop
+struct ForceOutput
+    {
+    Scalar4* force;      //!< Force and energy of each particle
+    Scalar4* torque;     //!< Torque of each particle (nullptr if not computed)
+    Scalar* virial;      //!< Virial of each particle (nullptr if not computed)
+    size_t virial_pitch; //!< Pitch of the virial array
+    };
+
+//! Per-thread force, energy, and virial buffers for CPU force loops with write conflicts
+/*! Loops such as the one over bonds, or over particles with a half neighbor list, add forces to
+    more than one particle per iteration. ForceThreadBuffers splits such a loop into one contiguous
+    chunk per TBB thread. The first chunk writes to the output arrays of the force compute, and each
+    other chunk writes to its own zeroed buffers. The buffers are then added to the output arrays in
+    order of the chunks, so the result is deterministic for a given number of threads.
+
+    The buffers are kept between calls so they are only reallocated when the number of particles
+    grows.
+*/
+class ForceThreadBuffers
+    {
+    public:
+    //! Run a loop with write conflicts on the TBB threads
+    /*! \param exec_conf Execution configuration that holds the task arena
+        \param n Number of iterations
+        \param N Number of particles that can receive forces
+        \param out Output arrays of the force compute
+        \param f Function called as f(begin, end, out) for a range of iterations, which adds its
+                 forces to the arrays in out
+
+        \pre The output arrays are zeroed or hold the forces to add to.
+    */
+    template<class Func>
+    void run(const ExecutionConfiguration& exec_conf,
+             unsigned int n,
+             unsigned int N,
+             const ForceOutput& out,
+             const Func& f)
+        {
+        const unsigned int n_chunks = hoomd::detail::getNumThreadChunks(exec_conf, n);
+        if (n_chunks == 1)
+            {
+            f(0, n, out);
+            return;
+            }
+
+#ifdef ENABLE_TBB
+        const size_t n_buffers = n_chunks - 1;
+        m_force.resize(n_buffers * N);
+        m_torque.resize(out.torque ? n_buffers * N : 0);
+        m_virial.resize(out.virial ? n_buffers * 6 * N : 0);
+        exec_conf.getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(0u,
+                                  n_chunks,
+                                  [&](unsigned int chunk)
+                                  { runChunk(chunk, n_chunks, n, N, out, f); });
+
+                // add the buffers to the output in order of the chunks
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  { addBuffers(r.begin(), r.end(), n_chunks, N, out); });
+            });
+#endif
+        }
+
+    private:
+    std::vector<Scalar4> m_force;  //!< Force and energy of each chunk after the first
+    std::vector<Scalar4> m_torque; //!< Torque of each chunk after the first
+    std::vector<Scalar> m_virial;  //!< Virial of each chunk after the first (pitch N)
+
+    //! Run one chunk of a loop
+    template<class Func>
+    void runChunk(unsigned int chunk,
+                  unsigned int n_chunks,
+                  unsigned int n,
+                  unsigned int N,
+                  const ForceOutput& out,
+                  const Func& f)
+        {
+        const unsigned int begin = hoomd::detail::getThreadChunkBegin(chunk, n_chunks, n);
+        const unsigned int end = hoomd::detail::getThreadChunkBegin(chunk + 1, n_chunks, n);
+        if (chunk == 0)
+            {
+            f(begin, end, out);
+            return;
+            }
+
+        // the other chunks start from zeroed buffers
+        const size_t offset = size_t(chunk - 1) * N;
+        ForceOutput chunk_out = {m_force.data() + offset, nullptr, nullptr, N};
+        std::fill(chunk_out.force, chunk_out.force + N, make_scalar4(0, 0, 0, 0));
+        if (out.torque)
+            {
+            chunk_out.torque = m_torque.data() + offset;
+            std::fill(chunk_out.torque, chunk_out.torque + N, make_scalar4(0, 0, 0, 0));
+            }
+        if (out.virial)
+            {
+            chunk_out.virial = m_virial.data() + 6 * offset;
+            std::fill(chunk_out.virial, chunk_out.virial + 6 * N, Scalar(0.0));
+            }
+        f(begin, end, chunk_out);
+        }
+
+    //! Add the buffers of the chunks after the first to the output for a range of particles
+    void addBuffers(unsigned int begin,
+                    unsigned int end,
+                    unsigned int n_chunks,
+                    unsigned int N,
+                    const ForceOutput& out) const
+        {
+        for (unsigned int i = begin; i < end; ++i)
+            {
+            for (size_t c = 0; c < n_chunks - 1; ++c)
+                {
+                const Scalar4 fc = m_force[c * N + i];
+                out.force[i].x += fc.x;
+                out.force[i].y += fc.y;
+                out.force[i].z += fc.z;
+                out.force[i].w += fc.w;
+                if (out.torque)
+                    {
+                    const Scalar4 tc = m_torque[c * N + i];
+                    out.torque[i].x += tc.x;
+                    out.torque[i].y += tc.y;
+                    out.torque[i].z += tc.z;
+                    }
+                if (out.virial)
+                    {
+                    const Scalar* vc = m_virial.data() + c * 6 * N;
+                    for (unsigned int l = 0; l < 6; ++l)
+                        out.virial[l * out.virial_pitch + i] += vc[l * N + i];
+                    }
+                }
+            }
+        }
+    };
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __FORCE_THREAD_BUFFERS_H__
@@ -72,15 +72,15 @@ void HarmonicAngleForceComputeGPU::computeForces(uint64_t timestep)
     ArrayHandle<Scalar> d_virial(m_virial, access_location::device, access_mode::overwrite);
     ArrayHandle<Scalar2> d_params(m_params, access_location::device, access_mode::read);
 
-    ArrayHandle<AngleData::members_t> d_gpu_anglelist(m_angle_data->getGPUTable(),
+    ArrayHandle<AngleData::members_t> d_gpu_anglelist(m_angle_data->getGPUCSRTable(),
                                                       access_location::device,
                                                       access_mode::read);
-    ArrayHandle<unsigned int> d_gpu_angle_pos_list(m_angle_data->getGPUPosTable(),
+    ArrayHandle<unsigned int> d_gpu_angle_pos_list(m_angle_data->getGPUCSRPosTable(),
                                                    access_location::device,
                                                    access_mode::read);
-    ArrayHandle<unsigned int> d_gpu_n_angles(m_angle_data->getNGroupsArray(),
-                                             access_location::device,
-                                             access_mode::read);
+    ArrayHandle<unsigned int> d_gpu_angle_offsets(m_angle_data->getGPUCSROffsets(),
+                                                  access_location::device,
+                                                  access_mode::read);
 
     // run the kernel on the GPU
     m_tuner->begin();
@@ -92,8 +92,7 @@ void HarmonicAngleForceComputeGPU::computeForces(uint64_t timestep)
                                               box,
                                               d_gpu_anglelist.data,
                                               d_gpu_angle_pos_list.data,
-                                              m_angle_data->getGPUTableIndexer().getW(),
-                                              d_gpu_n_angles.data,
+                                              d_gpu_angle_offsets.data,
                                               d_params.data,
                                               m_angle_data->getNTypes(),
                                               m_tuner->getParam()[0]);
@@ -32,9 +32,9 @@ namespace kernel
     \param d_pos device array of particle positions
     \param d_params Parameters for the angle force
     \param box Box dimensions for periodic boundary condition handling
-    \param alist Angle data to use in calculating the forces
-    \param pitch Pitch of 2D angles list
-    \param n_angles_list List of numbers of angles stored on the GPU
+    \param alist Angle data to use in calculating the forces, in CSR format
+    \param apos_list Position of the particle in each angle
+    \param angle_offsets Offset of the angles of each particle in \a alist
 */
 __global__ void gpu_compute_harmonic_angle_forces_kernel(Scalar4* d_force,
                                                          Scalar* d_virial,
@@ -45,8 +45,7 @@ __global__ void gpu_compute_harmonic_angle_forces_kernel(Scalar4* d_force,
                                                          BoxDim box,
                                                          const group_storage<3>* alist,
                                                          const unsigned int* apos_list,
-                                                         const unsigned int pitch,
-                                                         const unsigned int* n_angles_list)
+                                                         const unsigned int* angle_offsets)
     {
     // start by identifying which particle we are to handle
     int idx = blockIdx.x * blockDim.x + threadIdx.x;
@@ -54,8 +53,9 @@ __global__ void gpu_compute_harmonic_angle_forces_kernel(Scalar4* d_force,
     if (idx >= N)
         return;
 
-    // load in the length of the list for this thread (MEM TRANSFER: 4 bytes)
-    int n_angles = n_angles_list[idx];
+    // load in the range of the list for this thread (MEM TRANSFER: 8 bytes)
+    const unsigned int first_angle = angle_offsets[idx];
+    const unsigned int last_angle = angle_offsets[idx + 1];
 
     // read in the position of our b-particle from the a-b-c triplet. (MEM TRANSFER: 16 bytes)
     Scalar4 idx_postype = d_pos[idx]; // we can be either a, b, or c in the a-b-c triplet
@@ -73,15 +73,15 @@ __global__ void gpu_compute_harmonic_angle_forces_kernel(Scalar4* d_force,
         virial[i] = Scalar(0.0);
 
     // loop over all angles
-    for (int angle_idx = 0; angle_idx < n_angles; angle_idx++)
+    for (unsigned int angle_idx = first_angle; angle_idx < last_angle; angle_idx++)
         {
-        group_storage<3> cur_angle = alist[pitch * angle_idx + idx];
+        group_storage<3> cur_angle = alist[angle_idx];
 
         int cur_angle_x_idx = cur_angle.idx[0];
         int cur_angle_y_idx = cur_angle.idx[1];
         int cur_angle_type = cur_angle.idx[2];
 
-        int cur_angle_abc = apos_list[pitch * angle_idx + idx];
+        int cur_angle_abc = apos_list[angle_idx];
 
         // get the a-particle's position (MEM TRANSFER: 16 bytes)
         Scalar4 x_postype = d_pos[cur_angle_x_idx];
@@ -208,9 +208,9 @@ __global__ void gpu_compute_harmonic_angle_forces_kernel(Scalar4* d_force,
     \param N number of particles
     \param d_pos device array of particle positions
     \param box Box dimensions (in GPU format) to use for periodic boundary conditions
-    \param atable List of angles stored on the GPU
-    \param pitch Pitch of 2D angles list
-    \param n_angles_list List of numbers of angles stored on the GPU
+    \param atable List of angles stored on the GPU, in CSR format
+    \param apos_list Position of the particle in each angle
+    \param angle_offsets Offset of the angles of each particle in \a atable
     \param d_params K and t_0 params packed as Scalar2 variables
     \param n_angle_types Number of angle types in d_params
     \param block_size Block size to use when performing calculations
@@ -230,8 +230,7 @@ hipError_t gpu_compute_harmonic_angle_forces(Scalar4* d_force,
                                              const BoxDim& box,
                                              const group_storage<3>* atable,
                                              const unsigned int* apos_list,
-                                             const unsigned int pitch,
-                                             const unsigned int* n_angles_list,
+                                             const unsigned int* angle_offsets,
                                              Scalar2* d_params,
                                              unsigned int n_angle_types,
                                              int block_size)
@@ -264,8 +263,7 @@ hipError_t gpu_compute_harmonic_angle_forces(Scalar4* d_force,
                        box,
                        atable,
                        apos_list,
-                       pitch,
-                       n_angles_list);
+                       angle_offsets);
 
     return hipSuccess;
     }
@@ -28,8 +28,7 @@ hipError_t gpu_compute_harmonic_angle_forces(Scalar4* d_force,
                                              const BoxDim& box,
                                              const group_storage<3>* atable,
                                              const unsigned int* apos_list,
-                                             const unsigned int pitch,
-                                             const unsigned int* n_angles_list,
+                                             const unsigned int* angle_offsets,
                                              Scalar2* d_params,
                                              unsigned int n_angle_types,
                                              int block_size);
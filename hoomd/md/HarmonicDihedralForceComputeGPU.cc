@@ -72,13 +72,13 @@ void HarmonicDihedralForceComputeGPU::setParams(unsigned int type,
 */
 void HarmonicDihedralForceComputeGPU::computeForces(uint64_t timestep)
     {
-    ArrayHandle<DihedralData::members_t> d_gpu_dihedral_list(m_dihedral_data->getGPUTable(),
+    ArrayHandle<DihedralData::members_t> d_gpu_dihedral_list(m_dihedral_data->getGPUCSRTable(),
                                                              access_location::device,
                                                              access_mode::read);
-    ArrayHandle<unsigned int> d_n_dihedrals(m_dihedral_data->getNGroupsArray(),
-                                            access_location::device,
-                                            access_mode::read);
-    ArrayHandle<unsigned int> d_dihedrals_ABCD(m_dihedral_data->getGPUPosTable(),
+    ArrayHandle<unsigned int> d_dihedral_offsets(m_dihedral_data->getGPUCSROffsets(),
+                                                 access_location::device,
+                                                 access_mode::read);
+    ArrayHandle<unsigned int> d_dihedrals_ABCD(m_dihedral_data->getGPUCSRPosTable(),
                                                access_location::device,
                                                access_mode::read);
 
@@ -100,8 +100,7 @@ void HarmonicDihedralForceComputeGPU::computeForces(uint64_t timestep)
                                                  box,
                                                  d_gpu_dihedral_list.data,
                                                  d_dihedrals_ABCD.data,
-                                                 m_dihedral_data->getGPUTableIndexer().getW(),
-                                                 d_n_dihedrals.data,
+                                                 d_dihedral_offsets.data,
                                                  d_params.data,
                                                  m_dihedral_data->getNTypes(),
                                                  this->m_tuner->getParam()[0],
@@ -31,10 +31,9 @@ namespace kernel
     \param d_pos particle positions on the device
     \param d_params Parameters for the angle force
     \param box Box dimensions for periodic boundary condition handling
-    \param tlist Dihedral data to use in calculating the forces
+    \param tlist Dihedral data to use in calculating the forces, in CSR format
     \param dihedral_ABCD List of relative atom positions in the dihedrals
-    \param pitch Pitch of 2D dihedral list
-    \param n_dihedrals_list List of numbers of dihedrals per atom
+    \param dihedral_offsets Offset of the dihedrals of each particle in \a tlist
 */
 __global__ void gpu_compute_harmonic_dihedral_forces_kernel(Scalar4* d_force,
                                                             Scalar* d_virial,
@@ -45,8 +44,7 @@ __global__ void gpu_compute_harmonic_dihedral_forces_kernel(Scalar4* d_force,
                                                             BoxDim box,
                                                             const group_storage<4>* tlist,
                                                             const unsigned int* dihedral_ABCD,
-                                                            const unsigned int pitch,
-                                                            const unsigned int* n_dihedrals_list)
+                                                            const unsigned int* dihedral_offsets)
     {
     // start by identifying which particle we are to handle
     int idx = blockIdx.x * blockDim.x + threadIdx.x;
@@ -54,8 +52,9 @@ __global__ void gpu_compute_harmonic_dihedral_forces_kernel(Scalar4* d_force,
     if (idx >= N)
         return;
 
-    // load in the length of the list for this thread (MEM TRANSFER: 4 bytes)
-    int n_dihedrals = n_dihedrals_list[idx];
+    // load in the range of the list for this thread (MEM TRANSFER: 8 bytes)
+    const unsigned int first_dihedral = dihedral_offsets[idx];
+    const unsigned int last_dihedral = dihedral_offsets[idx + 1];
 
     // read in the position of our b-particle from the a-b-c-d set. (MEM TRANSFER: 16 bytes)
     Scalar4 idx_postype = d_pos[idx]; // we can be either a, b, or c in the a-b-c-d quartet
@@ -72,10 +71,10 @@ __global__ void gpu_compute_harmonic_dihedral_forces_kernel(Scalar4* d_force,
         virial_idx[i] = Scalar(0.0);
 
     // loop over all dihedrals
-    for (int dihedral_idx = 0; dihedral_idx < n_dihedrals; dihedral_idx++)
+    for (unsigned int dihedral_idx = first_dihedral; dihedral_idx < last_dihedral; dihedral_idx++)
         {
-        group_storage<4> cur_dihedral = tlist[pitch * dihedral_idx + idx];
-        unsigned int cur_ABCD = dihedral_ABCD[pitch * dihedral_idx + idx];
+        group_storage<4> cur_dihedral = tlist[dihedral_idx];
+        unsigned int cur_ABCD = dihedral_ABCD[dihedral_idx];
 
         int cur_dihedral_x_idx = cur_dihedral.idx[0];
         int cur_dihedral_y_idx = cur_dihedral.idx[1];
@@ -308,10 +307,9 @@ __global__ void gpu_compute_harmonic_dihedral_forces_kernel(Scalar4* d_force,
     \param N number of particles
     \param d_pos particle positions on the GPU
     \param box Box dimensions (in GPU format) to use for periodic boundary conditions
-    \param tlist Dihedral data to use in calculating the forces
+    \param tlist Dihedral data to use in calculating the forces, in CSR format
     \param dihedral_ABCD List of relative atom positions in the dihedrals
-    \param pitch Pitch of 2D dihedral list
-    \param n_dihedrals_list List of numbers of dihedrals per atom
+    \param dihedral_offsets Offset of the dihedrals of each particle in \a tlist
     \param d_params K, sign,multiplicity params packed as padded Scalar4 variables
     \param n_dihedral_types Number of dihedral types in d_params
     \param block_size Block size to use when performing calculations
@@ -331,8 +329,7 @@ hipError_t gpu_compute_harmonic_dihedral_forces(Scalar4* d_force,
                                                 const BoxDim& box,
                                                 const group_storage<4>* tlist,
                                                 const unsigned int* dihedral_ABCD,
-                                                const unsigned int pitch,
-                                                const unsigned int* n_dihedrals_list,
+                                                const unsigned int* dihedral_offsets,
                                                 Scalar4* d_params,
                                                 unsigned int n_dihedral_types,
                                                 int block_size,
@@ -369,8 +366,7 @@ hipError_t gpu_compute_harmonic_dihedral_forces(Scalar4* d_force,
                        box,
                        tlist,
                        dihedral_ABCD,
-                       pitch,
-                       n_dihedrals_list);
+                       dihedral_offsets);
 
     return hipSuccess;
     }
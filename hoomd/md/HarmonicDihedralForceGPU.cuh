@@ -29,8 +29,7 @@ hipError_t gpu_compute_harmonic_dihedral_forces(Scalar4* d_force,
                                                 const BoxDim& box,
                                                 const group_storage<4>* tlist,
                                                 const unsigned int* dihedral_ABCD,
-                                                const unsigned int pitch,
-                                                const unsigned int* n_dihedrals_list,
+                                                const unsigned int* dihedral_offsets,
                                                 Scalar4* d_params,
                                                 unsigned int n_dihedral_types,
                                                 int block_size,
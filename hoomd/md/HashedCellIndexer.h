@@ -0,0 +1,208 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __HASHED_CELL_INDEXER_H__
+#define __HASHED_CELL_INDEXER_H__
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+
+#include <stdint.h>
+
+/*! \file HashedCellIndexer.h
+    \brief Defines the cell keys and hash table used by the hashed neighbor lists
+*/
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__
+#else
+#define HOSTDEVICE
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Key of an empty slot in the hash table of occupied cells
+const uint64_t HashedCellEmptyKey = 0xffffffffffffffffULL;
+
+//! Indexes the cells of a sparse cell list by Morton key
+/*! The local box is divided into cells that are at least as wide as the largest list cutoff,
+    but the cells are never allocated. Instead, each cell is identified by a 63-bit Morton key of
+    its coordinates, so that sorting particles by key orders them along a space-filling curve and
+    the particles in a cell are contiguous. The occupied cells are then stored in a hash table that
+    maps the key to the range of sorted particles in the cell.
+
+    Cell coordinates are wrapped along periodic directions of the box. Ghost particles along
+    nonperiodic (domain decomposed) directions can lie in cells outside the box, which is why the
+    coordinates are signed and offset before they are encoded.
+*/
+struct HashedCellIndexer
+    {
+    //! Default constructor (one cell)
+    HOSTDEVICE HashedCellIndexer()
+        : dim(make_uint3(1, 1, 1)), periodic(make_uchar3(0, 0, 0)), two_d(false)
+        {
+        }
+
+    //! Constructor
+    /*! \param box Local simulation box
+        \param width Minimum width of a cell
+        \param two_d_ If true, the simulation is 2D and there is one cell along z
+    */
+    HOSTDEVICE HashedCellIndexer(const BoxDim& box, const Scalar width, bool two_d_)
+        : periodic(box.getPeriodic()), two_d(two_d_)
+        {
+        const Scalar3 L = box.getNearestPlaneDistance();
+        dim = make_uint3(getNumCells(L.x, width), getNumCells(L.y, width), getNumCells(L.z, width));
+        if (two_d)
+            dim.z = 1;
+        }
+
+    //! Get the cell that contains a fractional coordinate
+    /*! \param f Fractional coordinate in the local box
+        \returns Cell coordinates, wrapped along periodic directions
+    */
+    HOSTDEVICE int3 getCell(const Scalar3& f) const
+        {
+        int3 cell = make_int3(int(slow::floor(f.x * Scalar(dim.x))),
+                              int(slow::floor(f.y * Scalar(dim.y))),
+                              int(slow::floor(f.z * Scalar(dim.z))));
+        if (two_d)
+            cell.z = 0;
+        return wrap(cell);
+        }
+
+    //! Wrap cell coordinates along periodic directions
+    /*! This also handles a particle that is exactly at the upper edge of the box.
+     */
+    HOSTDEVICE int3 wrap(int3 cell) const
+        {
+        if (periodic.x)
+            cell.x = wrapOne(cell.x, dim.x);
+        if (periodic.y)
+            cell.y = wrapOne(cell.y, dim.y);
+        if (periodic.z && !two_d)
+            cell.z = wrapOne(cell.z, dim.z);
+        return cell;
+        }
+
+    //! Get the range of offsets to the neighboring cells
+    /*! \param lo Lowest offset along each direction (output)
+        \param hi Highest offset along each direction (output)
+
+        Periodic directions with fewer than three cells are narrowed so that each neighboring cell
+        is only visited once.
+    */
+    HOSTDEVICE void getStencil(int3& lo, int3& hi) const
+        {
+        getStencilOne(lo.x, hi.x, dim.x, periodic.x);
+        getStencilOne(lo.y, hi.y, dim.y, periodic.y);
+        if (two_d)
+            {
+            lo.z = hi.z = 0;
+            }
+        else
+            {
+            getStencilOne(lo.z, hi.z, dim.z, periodic.z);
+            }
+        }
+
+    //! Check if the neighboring cells are all distinct images
+    /*! When this is true, a particle in a neighboring cell is at its minimum image if the cell
+        offset is applied without wrapping, so distances can be computed from cell coordinates.
+    */
+    HOSTDEVICE bool hasDistinctNeighbors() const
+        {
+        return !((periodic.x && dim.x < 3) || (periodic.y && dim.y < 3)
+                 || (!two_d && periodic.z && dim.z < 3));
+        }
+
+    //! Get the Morton key of a cell
+    HOSTDEVICE uint64_t getKey(const int3& cell) const
+        {
+        const int offset = 1 << 20;
+        return (spreadBits(uint64_t(cell.x + offset)) << 2)
+               | (spreadBits(uint64_t(cell.y + offset)) << 1)
+               | spreadBits(uint64_t(cell.z + offset));
+        }
+
+    //! Get the first slot of the hash table to probe for a key
+    /*! \param key Key of the cell
+        \param mask Size of the table minus 1 (the size must be a power of 2)
+    */
+    HOSTDEVICE static unsigned int hash(uint64_t key, unsigned int mask)
+        {
+        // finalizer of the splitmix64 generator, which mixes nearby keys into different slots
+        key ^= key >> 30;
+        key *= 0xbf58476d1ce4e5b9ULL;
+        key ^= key >> 27;
+        key *= 0x94d049bb133111ebULL;
+        key ^= key >> 31;
+        return static_cast<unsigned int>(key) & mask;
+        }
+
+    //! Get the size of a hash table that holds a number of cells
+    /*! The table is kept at most half full so that probes are short.
+     */
+    HOSTDEVICE static unsigned int getTableSize(unsigned int N)
+        {
+        unsigned int size = 1;
+        while (size < 2 * N)
+            size <<= 1;
+        return size;
+        }
+
+    uint3 dim;       //!< Number of cells along each lattice vector
+    uchar3 periodic; //!< Periodic flags of the local box
+    bool two_d;      //!< If true, the simulation is 2D
+
+    private:
+    //! Get the number of cells along a direction
+    HOSTDEVICE static unsigned int getNumCells(const Scalar L, const Scalar width)
+        {
+        // the number of cells is capped so that the keys of ghost cells do not overflow
+        const Scalar max_cells = Scalar(1u << 19);
+        const Scalar n = (L / width < max_cells) ? L / width : max_cells;
+        return (n >= Scalar(1)) ? static_cast<unsigned int>(n) : 1;
+        }
+
+    //! Wrap one cell coordinate into [0, n)
+    HOSTDEVICE static int wrapOne(int c, unsigned int n)
+        {
+        const int ni = static_cast<int>(n);
+        c %= ni;
+        return (c < 0) ? c + ni : c;
+        }
+
+    //! Get the range of offsets along one direction
+    HOSTDEVICE static void getStencilOne(int& lo, int& hi, unsigned int n, unsigned char periodic)
+        {
+        lo = -1;
+        hi = 1;
+        if (periodic && n < 3)
+            {
+            lo = 0;
+            hi = static_cast<int>(n) - 1;
+            }
+        }
+
+    //! Spread the lowest 21 bits of a coordinate so there are two zeros between each bit
+    HOSTDEVICE static uint64_t spreadBits(uint64_t x)
+        {
+        x &= 0x1fffffULL;
+        x = (x | (x << 32)) & 0x1f00000000ffffULL;
+        x = (x | (x << 16)) & 0x1f0000ff0000ffULL;
+        x = (x | (x << 8)) & 0x100f00f00f00f00fULL;
+        x = (x | (x << 4)) & 0x10c30c30c30c30c3ULL;
+        x = (x | (x << 2)) & 0x1249249249249249ULL;
+        return x;
+        }
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#undef HOSTDEVICE
+
+#endif // __HASHED_CELL_INDEXER_H__
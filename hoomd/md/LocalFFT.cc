@@ -0,0 +1,121 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "LocalFFT.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+/*! \file LocalFFT.cc
+    \brief Defines the backends for the 3D FFTs of the PPPM meshes on a single rank
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace detail
+    {
+LocalFFTKiss::LocalFFTKiss(uint3 dim)
+    {
+    // kiss FFT expects the slowest varying dimension first
+    int dims[3];
+    dims[0] = dim.z;
+    dims[1] = dim.y;
+    dims[2] = dim.x;
+
+    m_fft = kiss_fftnd_alloc(dims, 3, 0, NULL, NULL);
+    m_ifft = kiss_fftnd_alloc(dims, 3, 1, NULL, NULL);
+    }
+
+LocalFFTKiss::~LocalFFTKiss()
+    {
+    kiss_fft_free(m_fft);
+    kiss_fft_free(m_ifft);
+    kiss_fft_cleanup();
+    }
+
+void LocalFFTKiss::forward(const kiss_fft_cpx* in, kiss_fft_cpx* out)
+    {
+    kiss_fftnd(m_fft, in, out);
+    }
+
+void LocalFFTKiss::inverse(const kiss_fft_cpx* in, kiss_fft_cpx* out)
+    {
+    kiss_fftnd(m_ifft, in, out);
+    }
+
+#ifdef ENABLE_FFTW
+LocalFFTW::LocalFFTW(uint3 dim) : m_n(size_t(dim.x) * dim.y * dim.z)
+    {
+    m_in = fftwf_alloc_complex(m_n);
+    m_out = fftwf_alloc_complex(m_n);
+
+    // FFTW_MEASURE overwrites the buffers, which hold no data yet
+    m_plan_fwd = fftwf_plan_dft_3d(dim.z, dim.y, dim.x, m_in, m_out, FFTW_FORWARD, FFTW_MEASURE);
+    m_plan_inv = fftwf_plan_dft_3d(dim.z, dim.y, dim.x, m_in, m_out, FFTW_BACKWARD, FFTW_MEASURE);
+
+    if (!m_plan_fwd || !m_plan_inv)
+        {
+        throw std::runtime_error("Error planning FFTW transforms.");
+        }
+    }
+
+LocalFFTW::~LocalFFTW()
+    {
+    fftwf_destroy_plan(m_plan_fwd);
+    fftwf_destroy_plan(m_plan_inv);
+    fftwf_free(m_in);
+    fftwf_free(m_out);
+    }
+
+void LocalFFTW::forward(const kiss_fft_cpx* in, kiss_fft_cpx* out)
+    {
+    execute(m_plan_fwd, in, out);
+    }
+
+void LocalFFTW::inverse(const kiss_fft_cpx* in, kiss_fft_cpx* out)
+    {
+    execute(m_plan_inv, in, out);
+    }
+
+void LocalFFTW::execute(fftwf_plan plan, const kiss_fft_cpx* in, kiss_fft_cpx* out)
+    {
+    // kiss_fft_cpx and fftwf_complex have the same layout
+    static_assert(sizeof(kiss_fft_cpx) == sizeof(fftwf_complex));
+    std::copy(in, in + m_n, reinterpret_cast<kiss_fft_cpx*>(m_in));
+    fftwf_execute(plan);
+    const kiss_fft_cpx* buf_out = reinterpret_cast<const kiss_fft_cpx*>(m_out);
+    std::copy(buf_out, buf_out + m_n, out);
+    }
+#endif
+
+std::vector<std::string> getLocalFFTBackends()
+    {
+    std::vector<std::string> backends;
+#ifdef ENABLE_FFTW
+    backends.push_back("fftw");
+#endif
+    backends.push_back("kiss");
+    return backends;
+    }
+
+std::unique_ptr<LocalFFT> makeLocalFFT(const std::string& backend, uint3 dim)
+    {
+#ifdef ENABLE_FFTW
+    if (backend == "auto" || backend == "fftw")
+        {
+        return std::unique_ptr<LocalFFT>(new LocalFFTW(dim));
+        }
+#endif
+    if (backend == "auto" || backend == "kiss")
+        {
+        return std::unique_ptr<LocalFFT>(new LocalFFTKiss(dim));
+        }
+
+    throw std::runtime_error("FFT backend " + backend + " is not available in this build.");
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
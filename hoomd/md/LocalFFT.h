@@ -0,0 +1,111 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __LOCAL_FFT_H__
+#define __LOCAL_FFT_H__
+
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/extern/kiss_fftnd.h"
+
+#ifdef ENABLE_FFTW
+#include <fftw3.h>
+#endif
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/*! \file LocalFFT.h
+    \brief Declares the backends for the 3D FFTs of the PPPM meshes on a single rank
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace detail
+    {
+//! Unnormalized 3D complex to complex FFT of a mesh stored on a single rank
+/*! The mesh is stored in row major order, with x the fastest varying index. The forward transform
+    uses the exponent -i k.r and the inverse transform +i k.r. Neither transform is normalized.
+*/
+class LocalFFT
+    {
+    public:
+    virtual ~LocalFFT() { }
+
+    //! Forward transform \a in into \a out
+    virtual void forward(const kiss_fft_cpx* in, kiss_fft_cpx* out) = 0;
+
+    //! Inverse transform \a in into \a out
+    virtual void inverse(const kiss_fft_cpx* in, kiss_fft_cpx* out) = 0;
+    };
+
+//! FFT using the bundled KISS FFT library
+class LocalFFTKiss : public LocalFFT
+    {
+    public:
+    //! Plan the transforms of a mesh with \a dim points
+    LocalFFTKiss(uint3 dim);
+
+    virtual ~LocalFFTKiss();
+
+    virtual void forward(const kiss_fft_cpx* in, kiss_fft_cpx* out);
+
+    virtual void inverse(const kiss_fft_cpx* in, kiss_fft_cpx* out);
+
+    private:
+    kiss_fftnd_cfg m_fft;  //!< Forward FFT configuration
+    kiss_fftnd_cfg m_ifft; //!< Inverse FFT configuration
+    };
+
+#ifdef ENABLE_FFTW
+//! FFT using the single precision FFTW3 library (or the FFTW3 interface of MKL)
+/*! The transforms are planned once on aligned buffers owned by this class. The meshes are copied
+    to and from these buffers so that FFTW can use the best plan regardless of the alignment of
+    the meshes. The copies are cheap compared to the transform.
+*/
+class LocalFFTW : public LocalFFT
+    {
+    public:
+    //! Plan the transforms of a mesh with \a dim points
+    LocalFFTW(uint3 dim);
+
+    virtual ~LocalFFTW();
+
+    virtual void forward(const kiss_fft_cpx* in, kiss_fft_cpx* out);
+
+    virtual void inverse(const kiss_fft_cpx* in, kiss_fft_cpx* out);
+
+    private:
+    size_t m_n;            //!< Number of points in the mesh
+    fftwf_complex* m_in;   //!< Input buffer
+    fftwf_complex* m_out;  //!< Output buffer
+    fftwf_plan m_plan_fwd; //!< Forward plan
+    fftwf_plan m_plan_inv; //!< Inverse plan
+
+    //! Execute a plan
+    void execute(fftwf_plan plan, const kiss_fft_cpx* in, kiss_fft_cpx* out);
+    };
+#endif
+
+//! Get the names of the FFT backends available in this build
+std::vector<std::string> getLocalFFTBackends();
+
+//! Create an FFT of a mesh with \a dim points
+/*! \param backend Name of the backend. "auto" selects the fastest available backend.
+    \param dim Number of mesh points along each direction
+
+    \throws std::runtime_error if the backend is not available in this build
+*/
+std::unique_ptr<LocalFFT> makeLocalFFT(const std::string& backend, uint3 dim);
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __LOCAL_FFT_H__
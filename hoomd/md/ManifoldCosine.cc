@@ -0,0 +1,25 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "ManifoldCosine.h"
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace detail
+    {
+//! Exports the Cosine manifold class to python
+void export_ManifoldCosine(pybind11::module& m)
+    {
+    pybind11::class_<ManifoldCosine, std::shared_ptr<ManifoldCosine>>(m, "ManifoldCosine")
+        .def(pybind11::init<Scalar, unsigned int, Scalar>())
+        .def_property_readonly("A", &ManifoldCosine::getA)
+        .def_property_readonly("p", &ManifoldCosine::getP)
+        .def_property_readonly("shift", &ManifoldCosine::getShift);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
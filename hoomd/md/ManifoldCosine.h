@@ -0,0 +1,143 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __MANIFOLD_CLASS_COSINE_H__
+#define __MANIFOLD_CLASS_COSINE_H__
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+
+/*! \file ManifoldCosine.h
+    \brief Defines the manifold class for the Cosine surface
+*/
+
+// need to declare these class methods with __device__ qualifiers when building in nvcc
+// DEVICE is __host__ __device__ when included in nvcc and blank when included into the host
+// compiler
+#ifdef __HIPCC__
+#define DEVICE __device__
+#else
+#define DEVICE
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Class for constructing the Cosine surface
+/*! <b>General Overview</b>
+
+    ManifoldCosine is a low level computation class that computes the distance and normal vector to
+   the cosine surface.
+
+    <b>Cosine specifics</b>
+
+    ManifoldCosine constructs the surface:
+    z = A cos(2 pi p x / L_x) + shift
+
+    These are the parameters:
+    - \a A = amplitude of the cosine;
+    - \a p = number of repetitions of the cosine in the box along x;
+    - \a shift = shift of the cosine in z-direction;
+
+    The wavenumber is set from the box length L_x, so the surface is periodic in x. With \a shift
+   set to +h or -h, the surface coincides with a wall of the MPCD cosine channel with the same \a A
+   and \a p.
+*/
+
+class ManifoldCosine
+    {
+    public:
+    //! Constructs the manifold class
+    /*! \param _A amplitude of the cosine
+        \param _p number of repetitions of the cosine in the box along x
+        \param _shift in z direction
+     */
+    DEVICE ManifoldCosine(const Scalar _A, const unsigned int _p, const Scalar _shift)
+        : A(_A), p(_p), shift(_shift), k(0)
+        {
+        }
+
+    //! Evaluate implicit function
+    /*! \param point Point at which surface is calculated
+
+        \return result of the nodal function at input point
+    */
+
+    DEVICE Scalar implicitFunction(const Scalar3& point)
+        {
+        return point.z - A * fast::cos(k * point.x) - shift;
+        }
+
+    //! Evaluate derivative of implicit function
+    /*! \param point Point at surface is calculated
+
+        \return normal of the Cosine surface at input point
+    */
+
+    DEVICE Scalar3 derivative(const Scalar3& point)
+        {
+        return make_scalar3(A * k * fast::sin(k * point.x), 0, 1);
+        }
+
+    //! Project a point onto the surface along a fixed direction
+    /*! \param point Point to project
+        \param direction Direction along which the point is displaced
+        \param s Set to the root of F(point - s * direction) = 0 closest to zero
+
+        \return false, the surface has no closed-form projection
+    */
+    DEVICE bool projectAlong(const Scalar3& point, const Scalar3& direction, Scalar& s)
+        {
+        return false;
+        }
+
+    DEVICE bool fitsInsideBox(const BoxDim& box)
+        {
+        Scalar3 lo = box.getLo();
+        Scalar3 hi = box.getHi();
+
+        k = 2 * M_PI * p / (hi.x - lo.x);
+
+        Scalar abs_A = (A >= 0) ? A : -A;
+        if (shift + abs_A > hi.z || shift - abs_A < lo.z)
+            {
+            return false; // Cosine does not fit inside box
+            }
+        else
+            {
+            return true;
+            }
+        }
+
+    Scalar getA()
+        {
+        return A;
+        };
+
+    unsigned int getP()
+        {
+        return p;
+        };
+
+    Scalar getShift()
+        {
+        return shift;
+        };
+
+    static unsigned int dimension()
+        {
+        return 2;
+        }
+
+    protected:
+    Scalar A;
+    unsigned int p;
+    Scalar shift;
+    Scalar k;
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __MANIFOLD_CLASS_COSINE_H__
@@ -93,6 +93,18 @@ class ManifoldDiamond
                             -Lz * (cx * cy * sz + sx * sy * cz));
         }
 
+    //! Project a point onto the surface along a fixed direction
+    /*! \param point Point to project
+        \param direction Direction along which the point is displaced
+        \param s Set to the root of F(point - s * direction) = 0 closest to zero
+
+        \return false, the surface has no closed-form projection
+    */
+    DEVICE bool projectAlong(const Scalar3& point, const Scalar3& direction, Scalar& s)
+        {
+        return false;
+        }
+
     DEVICE bool fitsInsideBox(const BoxDim& box)
         {
         Scalar3 box_length = box.getHi() - box.getLo();
@@ -91,6 +91,31 @@ class ManifoldEllipsoid
                             2 * inv_c2 * (point.z - Pz));
         }
 
+    //! Project a point onto the surface along a fixed direction
+    /*! \param point Point to project
+        \param direction Direction along which the point is displaced
+        \param s Set to the root of F(point - s * direction) = 0 closest to zero
+
+        \return true when the projection was computed in closed form
+    */
+    DEVICE bool projectAlong(const Scalar3& point, const Scalar3& direction, Scalar& s)
+        {
+        Scalar3 w = make_scalar3(point.x - Px, point.y - Py, point.z - Pz);
+        Scalar qa = inv_a2 * direction.x * direction.x + inv_b2 * direction.y * direction.y
+                    + inv_c2 * direction.z * direction.z;
+        Scalar qb = inv_a2 * w.x * direction.x + inv_b2 * w.y * direction.y
+                    + inv_c2 * w.z * direction.z;
+        Scalar qc = inv_a2 * w.x * w.x + inv_b2 * w.y * w.y + inv_c2 * w.z * w.z - 1;
+        Scalar disc = qb * qb - qa * qc;
+        if (disc < 0)
+            return false;
+        Scalar q = (qb < 0) ? qb - slow::sqrt(disc) : qb + slow::sqrt(disc);
+        if (q == 0)
+            return false;
+        s = qc / q;
+        return true;
+        }
+
     DEVICE bool fitsInsideBox(const BoxDim& box)
         {
         Scalar3 lo = box.getLo();
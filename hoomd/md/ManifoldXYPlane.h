@@ -70,6 +70,21 @@ class ManifoldXYPlane
         return make_scalar3(0, 0, 1);
         }
 
+    //! Project a point onto the surface along a fixed direction
+    /*! \param point Point to project
+        \param direction Direction along which the point is displaced
+        \param s Set to the root of F(point - s * direction) = 0 closest to zero
+
+        \return true when the projection was computed in closed form
+    */
+    DEVICE bool projectAlong(const Scalar3& point, const Scalar3& direction, Scalar& s)
+        {
+        if (direction.z == 0)
+            return false;
+        s = (point.z - shift) / direction.z;
+        return true;
+        }
+
     DEVICE bool fitsInsideBox(const BoxDim& box)
         {
         Scalar3 lo = box.getLo();
@@ -81,6 +81,30 @@ class ManifoldZCylinder
         return make_scalar3(2 * (point.x - Px), 2 * (point.y - Py), 0);
         }
 
+    //! Project a point onto the surface along a fixed direction
+    /*! \param point Point to project
+        \param direction Direction along which the point is displaced
+        \param s Set to the root of F(point - s * direction) = 0 closest to zero
+
+        \return true when the projection was computed in closed form
+    */
+    DEVICE bool projectAlong(const Scalar3& point, const Scalar3& direction, Scalar& s)
+        {
+        Scalar wx = point.x - Px;
+        Scalar wy = point.y - Py;
+        Scalar qa = direction.x * direction.x + direction.y * direction.y;
+        Scalar qb = wx * direction.x + wy * direction.y;
+        Scalar qc = wx * wx + wy * wy - R_sq;
+        Scalar disc = qb * qb - qa * qc;
+        if (disc < 0)
+            return false;
+        Scalar q = (qb < 0) ? qb - slow::sqrt(disc) : qb + slow::sqrt(disc);
+        if (q == 0)
+            return false;
+        s = qc / q;
+        return true;
+        }
+
     DEVICE bool fitsInsideBox(const BoxDim& box)
         {
         Scalar3 lo = box.getLo();
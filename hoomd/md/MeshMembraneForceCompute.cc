@@ -0,0 +1,353 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "MeshMembraneForceCompute.h"
+#include "MeshMembraneGeometry.h"
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+using namespace std;
+
+/*! \file MeshMembraneForceCompute.cc
+    \brief Contains code for the MeshMembraneForceCompute class
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System to compute forces on
+    \param meshdef Mesh the membrane is made of
+    \post Memory is allocated, and forces are zeroed.
+*/
+MeshMembraneForceCompute::MeshMembraneForceCompute(std::shared_ptr<SystemDefinition> sysdef,
+                                                   std::shared_ptr<MeshDefinition> meshdef)
+    : ForceCompute(sysdef), m_area_k(0), m_area0(0), m_volume_k(0), m_volume0(0), m_area(0),
+      m_volume(0), m_mesh_data(meshdef)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing MeshMembraneForceCompute" << endl;
+
+    // access the mesh data for later use
+    m_mesh_bond_data = meshdef->getMeshBondData();
+    m_mesh_triangle_data = meshdef->getMeshTriangleData();
+
+    // allocate the parameters
+    GPUArray<Scalar> kappa(m_mesh_bond_data->getNTypes(), m_exec_conf);
+    m_kappa.swap(kappa);
+    }
+
+MeshMembraneForceCompute::~MeshMembraneForceCompute()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying MeshMembraneForceCompute" << endl;
+    }
+
+/*! \param type Type of the mesh bonds to set parameters for
+    \param kappa Bending rigidity
+
+    Sets the bending rigidity of a particular mesh type
+*/
+void MeshMembraneForceCompute::setParams(unsigned int type, Scalar kappa)
+    {
+    // make sure the type is valid
+    if (type >= m_mesh_bond_data->getNTypes())
+        {
+        throw runtime_error("Invalid mesh type.");
+        }
+
+    ArrayHandle<Scalar> h_kappa(m_kappa, access_location::host, access_mode::readwrite);
+    h_kappa.data[type] = kappa;
+    }
+
+void MeshMembraneForceCompute::setParamsPython(std::string type, pybind11::dict params)
+    {
+    auto typ = m_mesh_bond_data->getTypeByName(type);
+    setParams(typ, params["kappa"].cast<Scalar>());
+    }
+
+pybind11::dict MeshMembraneForceCompute::getParams(std::string type)
+    {
+    auto typ = m_mesh_bond_data->getTypeByName(type);
+    ArrayHandle<Scalar> h_kappa(m_kappa, access_location::host, access_mode::read);
+    pybind11::dict params;
+    params["kappa"] = h_kappa.data[typ];
+    return params;
+    }
+
+/*! \param area Area of the triangles owned by this rank
+    \param volume Volume of the triangles owned by this rank
+
+    Each rank owns one third of a triangle per local vertex, so the sum over all ranks counts every
+    triangle exactly once.
+*/
+void MeshMembraneForceCompute::reduceAreaVolume(Scalar area, Scalar volume)
+    {
+    Scalar sums[2] = {area, volume};
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      sums,
+                      2,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+    m_area = sums[0];
+    m_volume = sums[1];
+    }
+
+/*! \param area_derivative Derivative of the area constraint energy with respect to the area
+    \param area_energy Area constraint energy divided by the total area
+    \param volume_derivative Derivative of the volume constraint energy with respect to the volume
+    \param volume_energy Volume constraint energy divided by the total volume
+
+    The force on a vertex is -(area_derivative * dA/dr + volume_derivative * dV/dr), and its share
+    of the constraint energies is area_energy * a + volume_energy * v with its area share a and
+    volume share v.
+*/
+void MeshMembraneForceCompute::getConstraintFactors(Scalar& area_derivative,
+                                                    Scalar& area_energy,
+                                                    Scalar& volume_derivative,
+                                                    Scalar& volume_energy) const
+    {
+    area_derivative = area_energy = Scalar(0.0);
+    volume_derivative = volume_energy = Scalar(0.0);
+
+    if (hasAreaConstraint())
+        {
+        Scalar delta = m_area - m_area0;
+        area_derivative = m_area_k * delta / m_area0;
+        if (m_area != Scalar(0.0))
+            area_energy = Scalar(0.5) * area_derivative * delta / m_area;
+        }
+
+    if (hasVolumeConstraint())
+        {
+        Scalar delta = m_volume - m_volume0;
+        volume_derivative = m_volume_k * delta / m_volume0;
+        if (m_volume != Scalar(0.0))
+            volume_energy = Scalar(0.5) * volume_derivative * delta / m_volume;
+        }
+    }
+
+/*! Actually perform the force computation
+    \param timestep Current time step
+ */
+void MeshMembraneForceCompute::computeForces(uint64_t timestep)
+    {
+    assert(m_pdata);
+    // access the particle data arrays
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar> h_kappa(m_kappa, access_location::host, access_mode::read);
+
+    // Zero data for force calculation.
+    memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+    memset((void*)h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+
+    size_t virial_pitch = m_virial.getPitch();
+
+    // we are using the minimum image of the global box here
+    // to ensure that ghosts are always correctly wrapped (even if a bond exceeds half the domain
+    // length)
+    const BoxDim box = m_pdata->getGlobalBox();
+
+    const unsigned int N = m_pdata->getN();
+    const unsigned int max_local = N + m_pdata->getNGhosts();
+
+    ArrayHandle<MeshBondData::members_t> h_bonds(m_mesh_bond_data->getMembersArray(),
+                                                 access_location::host,
+                                                 access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(m_mesh_bond_data->getTypeValArray(),
+                                     access_location::host,
+                                     access_mode::read);
+
+    // bending across every mesh bond (a, b) with the opposite vertices c and d
+    for (unsigned int i = 0; i < m_mesh_bond_data->getN(); i++)
+        {
+        const MeshBondData::members_t& bond = h_bonds.data[i];
+
+        unsigned int idx[4];
+        for (unsigned int j = 0; j < 4; ++j)
+            {
+            idx[j] = h_rtag.data[bond.tag[j]];
+            if (idx[j] >= max_local)
+                {
+                std::ostringstream stream;
+                stream << "Error: mesh bond " << bond.tag[0] << " " << bond.tag[1]
+                       << " is incomplete.";
+                throw std::runtime_error(stream.str());
+                }
+            }
+
+        // a bond on the mesh boundary belongs to a single triangle and does not bend
+        if (bond.tag[2] == bond.tag[3])
+            continue;
+
+        vec3<Scalar> pos_a(h_pos.data[idx[0]]);
+        vec3<Scalar> dab = box.minImage(vec3<Scalar>(h_pos.data[idx[1]]) - pos_a);
+        vec3<Scalar> dac = box.minImage(vec3<Scalar>(h_pos.data[idx[2]]) - pos_a);
+        vec3<Scalar> dad = box.minImage(vec3<Scalar>(h_pos.data[idx[3]]) - pos_a);
+
+        vec3<Scalar> f[4];
+        Scalar bending_eng
+            = computeMeshBendingForces(dab, dac, dad, h_kappa.data[h_typeval.data[i].type], f);
+
+        // compute 1/4 of the energy and virial, 1/4 for each vertex in the bond
+        Scalar bending_virial[6] = {};
+        addMeshVirial(bending_virial, dab, f[1], Scalar(0.25));
+        addMeshVirial(bending_virial, dac, f[2], Scalar(0.25));
+        addMeshVirial(bending_virial, dad, f[3], Scalar(0.25));
+
+        for (unsigned int j = 0; j < 4; ++j)
+            {
+            h_force.data[idx[j]].x += f[j].x;
+            h_force.data[idx[j]].y += f[j].y;
+            h_force.data[idx[j]].z += f[j].z;
+            h_force.data[idx[j]].w += Scalar(0.25) * bending_eng;
+            for (unsigned int k = 0; k < 6; k++)
+                h_virial.data[virial_pitch * k + idx[j]] += bending_virial[k];
+            }
+        }
+
+    ArrayHandle<TriangleData::members_t> h_triangles(m_mesh_triangle_data->getMembersArray(),
+                                                     access_location::host,
+                                                     access_mode::read);
+    const unsigned int n_triangles = m_mesh_triangle_data->getN();
+
+    // unwrap the vertices of a triangle around its first local vertex, returns the number of
+    // local vertices
+    auto unwrap_triangle = [&](unsigned int i, unsigned int* idx, vec3<Scalar>* r)
+    {
+        const TriangleData::members_t& triangle = h_triangles.data[i];
+
+        unsigned int ref = 3;
+        unsigned int n_local = 0;
+        for (unsigned int j = 0; j < 3; ++j)
+            {
+            idx[j] = h_rtag.data[triangle.tag[j]];
+            if (idx[j] >= max_local)
+                {
+                std::ostringstream stream;
+                stream << "Error: mesh triangle " << triangle.tag[0] << " " << triangle.tag[1]
+                       << " " << triangle.tag[2] << " is incomplete.";
+                throw std::runtime_error(stream.str());
+                }
+            if (idx[j] < N)
+                {
+                if (ref == 3)
+                    ref = j;
+                n_local++;
+                }
+            }
+
+        if (n_local == 0)
+            return n_local;
+
+        Scalar3 pos_ref = make_scalar3(h_pos.data[idx[ref]].x,
+                                       h_pos.data[idx[ref]].y,
+                                       h_pos.data[idx[ref]].z);
+        vec3<Scalar> r_ref(box.shift(pos_ref, h_image.data[idx[ref]]));
+        for (unsigned int j = 0; j < 3; ++j)
+            {
+            r[j] = r_ref
+                   + box.minImage(vec3<Scalar>(h_pos.data[idx[j]]) - vec3<Scalar>(pos_ref));
+            }
+        return n_local;
+    };
+
+    // sum the area and volume shares of the local vertices
+    Scalar area = Scalar(0.0);
+    Scalar volume = Scalar(0.0);
+    for (unsigned int i = 0; i < n_triangles; i++)
+        {
+        unsigned int idx[3];
+        vec3<Scalar> r[3];
+        unsigned int n_local = unwrap_triangle(i, idx, r);
+        if (n_local == 0)
+            continue;
+
+        Scalar area_t, volume_t;
+        vec3<Scalar> grad_area[3], grad_volume[3];
+        computeMeshTriangleGradients(r, area_t, volume_t, grad_area, grad_volume);
+        area += Scalar(n_local) / Scalar(3.0) * area_t;
+        volume += Scalar(n_local) / Scalar(3.0) * volume_t;
+        }
+    reduceAreaVolume(area, volume);
+
+    if (!hasAreaConstraint() && !hasVolumeConstraint())
+        return;
+
+    Scalar area_derivative, area_energy, volume_derivative, volume_energy;
+    getConstraintFactors(area_derivative, area_energy, volume_derivative, volume_energy);
+
+    // apply the area and volume constraint forces
+    for (unsigned int i = 0; i < n_triangles; i++)
+        {
+        unsigned int idx[3];
+        vec3<Scalar> r[3];
+        if (unwrap_triangle(i, idx, r) == 0)
+            continue;
+
+        Scalar area_t, volume_t;
+        vec3<Scalar> grad_area[3], grad_volume[3];
+        computeMeshTriangleGradients(r, area_t, volume_t, grad_area, grad_volume);
+
+        // compute 1/3 of the energy and virial, 1/3 for each vertex in the triangle
+        Scalar triangle_eng = (area_energy * area_t + volume_energy * volume_t) / Scalar(3.0);
+        vec3<Scalar> f[3];
+        Scalar triangle_virial[6] = {};
+        for (unsigned int j = 0; j < 3; ++j)
+            {
+            f[j] = -(area_derivative * grad_area[j] + volume_derivative * grad_volume[j]);
+            addMeshVirial(triangle_virial, r[j], f[j], Scalar(1.0) / Scalar(3.0));
+            }
+
+        for (unsigned int j = 0; j < 3; ++j)
+            {
+            h_force.data[idx[j]].x += f[j].x;
+            h_force.data[idx[j]].y += f[j].y;
+            h_force.data[idx[j]].z += f[j].z;
+            h_force.data[idx[j]].w += triangle_eng;
+            for (unsigned int k = 0; k < 6; k++)
+                h_virial.data[virial_pitch * k + idx[j]] += triangle_virial[k];
+            }
+        }
+    }
+
+namespace detail
+    {
+void export_MeshMembraneForceCompute(pybind11::module& m)
+    {
+    pybind11::class_<MeshMembraneForceCompute,
+                     ForceCompute,
+                     std::shared_ptr<MeshMembraneForceCompute>>(m, "MeshMembraneForceCompute")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<MeshDefinition>>())
+        .def("setParams", &MeshMembraneForceCompute::setParamsPython)
+        .def("getParams", &MeshMembraneForceCompute::getParams)
+        .def_property("k_area",
+                      &MeshMembraneForceCompute::getAreaK,
+                      &MeshMembraneForceCompute::setAreaK)
+        .def_property("area0",
+                      &MeshMembraneForceCompute::getArea0,
+                      &MeshMembraneForceCompute::setArea0)
+        .def_property("k_volume",
+                      &MeshMembraneForceCompute::getVolumeK,
+                      &MeshMembraneForceCompute::setVolumeK)
+        .def_property("volume0",
+                      &MeshMembraneForceCompute::getVolume0,
+                      &MeshMembraneForceCompute::setVolume0)
+        .def_property_readonly("area", &MeshMembraneForceCompute::getArea)
+        .def_property_readonly("volume", &MeshMembraneForceCompute::getVolume);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,162 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/ForceCompute.h"
+#include "hoomd/MeshDefinition.h"
+
+#include <memory>
+
+/*! \file MeshMembraneForceCompute.h
+    \brief Declares a class for computing mesh membrane bending, area, and volume forces
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __MESHMEMBRANEFORCECOMPUTE_H__
+#define __MESHMEMBRANEFORCECOMPUTE_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Computes the bending, area, and volume forces of a membrane mesh
+/*! The membrane energy is the sum of three terms:
+
+    - A bending energy kappa / 2 (1 - n1 . n2) for every mesh bond, where n1 and n2 are the unit
+      normals of the two triangles sharing the bond. kappa is set per mesh type.
+    - A global area constraint k_A (A - A0)^2 / (2 A0) on the total area A of the mesh triangles.
+    - A global volume constraint k_V (V - V0)^2 / (2 V0) on the total volume V enclosed by the mesh.
+
+    A constraint is disabled when its spring constant is zero or its target is not positive. The
+    area and volume sum over the triangles of all mesh types. The volume uses unwrapped vertex
+    positions, so the image flags of the mesh vertices must be consistent with each other.
+
+    Each vertex takes one quarter of the bending energy of its mesh bonds and the fraction of the
+    constraint energies given by its share (one third per triangle) of the area and volume.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT MeshMembraneForceCompute : public ForceCompute
+    {
+    public:
+    //! Constructs the compute
+    MeshMembraneForceCompute(std::shared_ptr<SystemDefinition> sysdef,
+                             std::shared_ptr<MeshDefinition> meshdef);
+
+    //! Destructor
+    virtual ~MeshMembraneForceCompute();
+
+    //! Set the bending rigidity of a mesh type
+    virtual void setParams(unsigned int type, Scalar kappa);
+
+    virtual void setParamsPython(std::string type, pybind11::dict params);
+
+    /// Get the parameters for a particular type
+    pybind11::dict getParams(std::string type);
+
+    //! Get the area constraint spring constant
+    Scalar getAreaK()
+        {
+        return m_area_k;
+        }
+
+    //! Set the area constraint spring constant
+    void setAreaK(Scalar area_k)
+        {
+        m_area_k = area_k;
+        }
+
+    //! Get the target area
+    Scalar getArea0()
+        {
+        return m_area0;
+        }
+
+    //! Set the target area
+    void setArea0(Scalar area0)
+        {
+        m_area0 = area0;
+        }
+
+    //! Get the volume constraint spring constant
+    Scalar getVolumeK()
+        {
+        return m_volume_k;
+        }
+
+    //! Set the volume constraint spring constant
+    void setVolumeK(Scalar volume_k)
+        {
+        m_volume_k = volume_k;
+        }
+
+    //! Get the target volume
+    Scalar getVolume0()
+        {
+        return m_volume0;
+        }
+
+    //! Set the target volume
+    void setVolume0(Scalar volume0)
+        {
+        m_volume0 = volume0;
+        }
+
+    //! Get the total mesh area at the last force evaluation
+    Scalar getArea()
+        {
+        return m_area;
+        }
+
+    //! Get the total mesh volume at the last force evaluation
+    Scalar getVolume()
+        {
+        return m_volume;
+        }
+
+    protected:
+    GPUArray<Scalar> m_kappa; //!< Bending rigidity per mesh type
+    Scalar m_area_k;          //!< Area constraint spring constant
+    Scalar m_area0;           //!< Target area
+    Scalar m_volume_k;        //!< Volume constraint spring constant
+    Scalar m_volume0;         //!< Target volume
+    Scalar m_area;            //!< Total mesh area at the last force evaluation
+    Scalar m_volume;          //!< Total mesh volume at the last force evaluation
+
+    std::shared_ptr<MeshDefinition> m_mesh_data;        //!< Mesh the membrane is made of
+    std::shared_ptr<MeshBondData> m_mesh_bond_data;     //!< Mesh bonds to compute bending on
+    std::shared_ptr<TriangleData> m_mesh_triangle_data; //!< Mesh triangles to constrain
+
+    //! Check whether the area constraint is active
+    bool hasAreaConstraint() const
+        {
+        return m_area_k != Scalar(0.0) && m_area0 > Scalar(0.0);
+        }
+
+    //! Check whether the volume constraint is active
+    bool hasVolumeConstraint() const
+        {
+        return m_volume_k != Scalar(0.0) && m_volume0 > Scalar(0.0);
+        }
+
+    //! Reduce the local shares of the area and volume to the totals over all ranks
+    void reduceAreaVolume(Scalar area, Scalar volume);
+
+    //! Get the constraint energy derivatives and the constraint energies per unit area and volume
+    void getConstraintFactors(Scalar& area_derivative,
+                              Scalar& area_energy,
+                              Scalar& volume_derivative,
+                              Scalar& volume_energy) const;
+
+    //! Actually compute the forces
+    virtual void computeForces(uint64_t timestep);
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -0,0 +1,211 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MeshMembraneForceComputeGPU.cc
+    \brief Defines MeshMembraneForceComputeGPU
+*/
+
+#include "MeshMembraneForceComputeGPU.h"
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System to compute forces on
+    \param meshdef Mesh the membrane is made of
+ */
+MeshMembraneForceComputeGPU::MeshMembraneForceComputeGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                                         std::shared_ptr<MeshDefinition> meshdef)
+    : MeshMembraneForceCompute(sysdef, meshdef)
+    {
+    // can't run on the GPU if there aren't any GPUs in the execution configuration
+    if (!m_exec_conf->isCUDAEnabled())
+        {
+        m_exec_conf->msg->error()
+            << "Creating a MeshMembraneForceComputeGPU with no GPU in the execution configuration"
+            << endl;
+        throw std::runtime_error("Error initializing MeshMembraneForceComputeGPU");
+        }
+
+    m_area_grad = GPUVector<Scalar4>(m_exec_conf);
+    m_volume_grad = GPUVector<Scalar4>(m_exec_conf);
+    m_constraint_virial = GPUVector<Scalar>(m_exec_conf);
+    m_partial_sum = GPUVector<Scalar>(m_exec_conf);
+
+    GPUArray<Scalar> sum(2, m_exec_conf);
+    m_sum.swap(sum);
+
+    // the block reduction needs a power of two block size
+    std::vector<unsigned int> valid_params;
+    for (unsigned int block_size = m_exec_conf->dev_prop.warpSize;
+         block_size <= (unsigned int)m_exec_conf->dev_prop.maxThreadsPerBlock;
+         block_size *= 2)
+        {
+        valid_params.push_back(block_size);
+        }
+
+    m_tuner.reset(new Autotuner<1>({valid_params}, m_exec_conf, "mesh_membrane"));
+    m_tuner_apply.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                         m_exec_conf,
+                                         "mesh_membrane_constraint",
+                                         5,
+                                         true));
+    m_autotuners.insert(m_autotuners.end(), {m_tuner, m_tuner_apply});
+    }
+
+MeshMembraneForceComputeGPU::~MeshMembraneForceComputeGPU() { }
+
+/*! Internal method for computing the forces on the GPU.
+    \post The force data on the GPU is written with the calculated forces
+
+    \param timestep Current time step of the simulation
+
+    Calls gpu_compute_mesh_membrane_forces and gpu_apply_mesh_membrane_constraints to do the dirty
+    work.
+*/
+void MeshMembraneForceComputeGPU::computeForces(uint64_t timestep)
+    {
+    const unsigned int N = m_pdata->getN();
+
+    // resize the per vertex scratch space
+    if (m_area_grad.size() != N)
+        {
+        m_area_grad.resize(N);
+        m_volume_grad.resize(N);
+        m_constraint_virial.resize(12 * N);
+        }
+
+    unsigned int block_size = m_tuner->getParam()[0];
+    unsigned int num_blocks = N / block_size + 1;
+    if (2 * num_blocks != m_partial_sum.size())
+        {
+        m_partial_sum.resize(2 * num_blocks);
+        }
+
+        {
+        ArrayHandle<MeshBondData::members_t> d_bond_table(m_mesh_bond_data->getGPUTable(),
+                                                          access_location::device,
+                                                          access_mode::read);
+        ArrayHandle<unsigned int> d_bond_pos(m_mesh_bond_data->getGPUPosTable(),
+                                             access_location::device,
+                                             access_mode::read);
+        ArrayHandle<unsigned int> d_n_bonds(m_mesh_bond_data->getNGroupsArray(),
+                                            access_location::device,
+                                            access_mode::read);
+        ArrayHandle<TriangleData::members_t> d_triangle_table(
+            m_mesh_triangle_data->getGPUTable(),
+            access_location::device,
+            access_mode::read);
+        ArrayHandle<unsigned int> d_triangle_pos(m_mesh_triangle_data->getGPUPosTable(),
+                                                 access_location::device,
+                                                 access_mode::read);
+        ArrayHandle<unsigned int> d_n_triangles(m_mesh_triangle_data->getNGroupsArray(),
+                                                access_location::device,
+                                                access_mode::read);
+
+        ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+        ArrayHandle<int3> d_image(m_pdata->getImages(), access_location::device, access_mode::read);
+        BoxDim box = m_pdata->getGlobalBox();
+
+        ArrayHandle<Scalar4> d_force(m_force, access_location::device, access_mode::overwrite);
+        ArrayHandle<Scalar> d_virial(m_virial, access_location::device, access_mode::overwrite);
+        ArrayHandle<Scalar> d_kappa(m_kappa, access_location::device, access_mode::read);
+
+        ArrayHandle<Scalar4> d_area_grad(m_area_grad,
+                                         access_location::device,
+                                         access_mode::overwrite);
+        ArrayHandle<Scalar4> d_volume_grad(m_volume_grad,
+                                           access_location::device,
+                                           access_mode::overwrite);
+        ArrayHandle<Scalar> d_constraint_virial(m_constraint_virial,
+                                                access_location::device,
+                                                access_mode::overwrite);
+        ArrayHandle<Scalar> d_partial_sum(m_partial_sum,
+                                          access_location::device,
+                                          access_mode::overwrite);
+        ArrayHandle<Scalar> d_sum(m_sum, access_location::device, access_mode::overwrite);
+
+        m_tuner->begin();
+        kernel::gpu_compute_mesh_membrane_forces(d_force.data,
+                                                 d_virial.data,
+                                                 m_virial.getPitch(),
+                                                 N,
+                                                 d_pos.data,
+                                                 d_image.data,
+                                                 box,
+                                                 d_bond_table.data,
+                                                 d_bond_pos.data,
+                                                 m_mesh_bond_data->getGPUTableIndexer().getW(),
+                                                 d_n_bonds.data,
+                                                 d_kappa.data,
+                                                 d_triangle_table.data,
+                                                 d_triangle_pos.data,
+                                                 m_mesh_triangle_data->getGPUTableIndexer().getW(),
+                                                 d_n_triangles.data,
+                                                 d_area_grad.data,
+                                                 d_volume_grad.data,
+                                                 d_constraint_virial.data,
+                                                 d_sum.data,
+                                                 d_partial_sum.data,
+                                                 block_size,
+                                                 num_blocks);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner->end();
+        }
+
+        {
+        ArrayHandle<Scalar> h_sum(m_sum, access_location::host, access_mode::read);
+        reduceAreaVolume(h_sum.data[0], h_sum.data[1]);
+        }
+
+    if (!hasAreaConstraint() && !hasVolumeConstraint())
+        return;
+
+    Scalar area_derivative, area_energy, volume_derivative, volume_energy;
+    getConstraintFactors(area_derivative, area_energy, volume_derivative, volume_energy);
+
+    ArrayHandle<Scalar4> d_force(m_force, access_location::device, access_mode::readwrite);
+    ArrayHandle<Scalar> d_virial(m_virial, access_location::device, access_mode::readwrite);
+    ArrayHandle<Scalar4> d_area_grad(m_area_grad, access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_volume_grad(m_volume_grad, access_location::device, access_mode::read);
+    ArrayHandle<Scalar> d_constraint_virial(m_constraint_virial,
+                                            access_location::device,
+                                            access_mode::read);
+
+    m_tuner_apply->begin();
+    kernel::gpu_apply_mesh_membrane_constraints(d_force.data,
+                                                d_virial.data,
+                                                m_virial.getPitch(),
+                                                N,
+                                                d_area_grad.data,
+                                                d_volume_grad.data,
+                                                d_constraint_virial.data,
+                                                area_derivative,
+                                                area_energy,
+                                                volume_derivative,
+                                                volume_energy,
+                                                m_tuner_apply->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_apply->end();
+    }
+
+namespace detail
+    {
+void export_MeshMembraneForceComputeGPU(pybind11::module& m)
+    {
+    pybind11::class_<MeshMembraneForceComputeGPU,
+                     MeshMembraneForceCompute,
+                     std::shared_ptr<MeshMembraneForceComputeGPU>>(m,
+                                                                   "MeshMembraneForceComputeGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<MeshDefinition>>());
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
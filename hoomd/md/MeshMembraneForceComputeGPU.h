@@ -0,0 +1,59 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "MeshMembraneForceCompute.h"
+#include "MeshMembraneForceGPU.cuh"
+#include "hoomd/Autotuner.h"
+#include "hoomd/GPUVector.h"
+
+#include <memory>
+
+/*! \file MeshMembraneForceComputeGPU.h
+    \brief Declares the MeshMembraneForceComputeGPU class
+*/
+
+#ifndef __MESHMEMBRANEFORCECOMPUTEGPU_H__
+#define __MESHMEMBRANEFORCECOMPUTEGPU_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Implements the mesh membrane force calculation on the GPU
+/*! MeshMembraneForceComputeGPU implements the same calculations as MeshMembraneForceCompute, but
+    executing on the GPU.
+
+    One kernel visits the mesh bonds and triangles of every vertex once. It completes the bending
+    forces, stores the area and volume gradients of each vertex, and reduces the area and volume
+    shares over the thread block. The block sums are reduced on the GPU and across ranks on the
+    host, after which a second, elementwise kernel adds the constraint forces.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT MeshMembraneForceComputeGPU : public MeshMembraneForceCompute
+    {
+    public:
+    //! Constructs the compute
+    MeshMembraneForceComputeGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                std::shared_ptr<MeshDefinition> meshdef);
+    //! Destructor
+    ~MeshMembraneForceComputeGPU();
+
+    protected:
+    std::shared_ptr<Autotuner<1>> m_tuner;       //!< Autotuner for the force block size
+    std::shared_ptr<Autotuner<1>> m_tuner_apply; //!< Autotuner for the constraint block size
+
+    GPUVector<Scalar4> m_area_grad;        //!< Area gradient and area share of each vertex
+    GPUVector<Scalar4> m_volume_grad;      //!< Volume gradient and volume share of each vertex
+    GPUVector<Scalar> m_constraint_virial; //!< Virials of the area and volume gradients
+    GPUVector<Scalar> m_partial_sum;       //!< Area and volume summed over each block
+    GPUArray<Scalar> m_sum;                //!< Area and volume of the local vertices
+
+    //! Actually compute the forces
+    virtual void computeForces(uint64_t timestep);
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -0,0 +1,449 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "MeshMembraneForceGPU.cuh"
+#include "MeshMembraneGeometry.h"
+#include "hoomd/VectorMath.h"
+
+#include <assert.h>
+
+/*! \file MeshMembraneForceGPU.cu
+    \brief Defines GPU kernel code for calculating the mesh membrane forces. Used by
+   MeshMembraneForceComputeGPU.
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Kernel for calculating the bending forces and the area and volume terms on the GPU
+/*! \param d_force Device memory to write computed forces
+    \param d_virial Device memory to write computed virials
+    \param virial_pitch pitch of 2D virial array
+    \param N number of particles
+    \param d_pos particle positions on the device
+    \param d_image particle images on the device
+    \param box Box dimensions for periodic boundary condition handling
+    \param d_bond_table Mesh bonds of each vertex
+    \param d_bond_pos Position of each vertex in its mesh bonds
+    \param bond_pitch Pitch of 2D mesh bond table
+    \param d_n_bonds Number of mesh bonds of each vertex
+    \param d_kappa Bending rigidity of each mesh type
+    \param d_triangle_table Mesh triangles of each vertex
+    \param d_triangle_pos Position of each vertex in its mesh triangles
+    \param triangle_pitch Pitch of 2D mesh triangle table
+    \param d_n_triangles Number of mesh triangles of each vertex
+    \param d_area_grad Area gradient (xyz) and area share (w) of each vertex (output)
+    \param d_volume_grad Volume gradient (xyz) and volume share (w) of each vertex (output)
+    \param d_constraint_virial Virials of the area (rows 0-5) and volume (rows 6-11) gradients
+    \param d_partial_sum Area (first row) and volume (second row) summed over each block
+
+    One thread per vertex visits its mesh bonds and triangles once. The bending force is complete
+    after this kernel. The constraint forces scale with the total area and volume, which are not
+    known until all blocks have finished, so the gradients are kept for
+    gpu_apply_mesh_membrane_constraints_kernel.
+*/
+__global__ void gpu_compute_mesh_membrane_partial_kernel(Scalar4* d_force,
+                                                         Scalar* d_virial,
+                                                         const size_t virial_pitch,
+                                                         const unsigned int N,
+                                                         const Scalar4* d_pos,
+                                                         const int3* d_image,
+                                                         BoxDim box,
+                                                         const group_storage<4>* d_bond_table,
+                                                         const unsigned int* d_bond_pos,
+                                                         const unsigned int bond_pitch,
+                                                         const unsigned int* d_n_bonds,
+                                                         const Scalar* d_kappa,
+                                                         const group_storage<3>* d_triangle_table,
+                                                         const unsigned int* d_triangle_pos,
+                                                         const unsigned int triangle_pitch,
+                                                         const unsigned int* d_n_triangles,
+                                                         Scalar4* d_area_grad,
+                                                         Scalar4* d_volume_grad,
+                                                         Scalar* d_constraint_virial,
+                                                         Scalar* d_partial_sum)
+    {
+    extern __shared__ Scalar membrane_sdata[];
+
+    // start by identifying which particle we are to handle
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    Scalar area = Scalar(0.0);
+    Scalar volume = Scalar(0.0);
+
+    if (idx < N)
+        {
+        Scalar4 idx_postype = d_pos[idx];
+        vec3<Scalar> idx_pos(idx_postype);
+
+        vec3<Scalar> force(0, 0, 0);
+        Scalar energy = Scalar(0.0);
+        Scalar virial[6] = {};
+
+        // loop over all mesh bonds (a, b) with the opposite vertices c and d
+        unsigned int n_bonds = d_n_bonds[idx];
+        for (unsigned int bond_idx = 0; bond_idx < n_bonds; bond_idx++)
+            {
+            group_storage<4> cur_bond = d_bond_table[bond_pitch * bond_idx + idx];
+            unsigned int cur_bond_pos = d_bond_pos[bond_pitch * bond_idx + idx];
+
+            // restore the order of the members with this vertex in its place
+            unsigned int members[4];
+            unsigned int n = 0;
+            for (unsigned int j = 0; j < 4; ++j)
+                members[j] = (j == cur_bond_pos) ? idx : cur_bond.idx[n++];
+
+            // a bond on the mesh boundary belongs to a single triangle and does not bend
+            if (members[2] == members[3])
+                continue;
+
+            vec3<Scalar> pos_a(d_pos[members[0]]);
+            vec3<Scalar> dab = box.minImage(vec3<Scalar>(d_pos[members[1]]) - pos_a);
+            vec3<Scalar> dac = box.minImage(vec3<Scalar>(d_pos[members[2]]) - pos_a);
+            vec3<Scalar> dad = box.minImage(vec3<Scalar>(d_pos[members[3]]) - pos_a);
+
+            vec3<Scalar> f[4];
+            Scalar bending_eng
+                = computeMeshBendingForces(dab, dac, dad, d_kappa[cur_bond.idx[3]], f);
+
+            // compute 1/4 of the energy and virial, 1/4 for each vertex in the bond
+            force += f[cur_bond_pos];
+            energy += Scalar(0.25) * bending_eng;
+            addMeshVirial(virial, dab, f[1], Scalar(0.25));
+            addMeshVirial(virial, dac, f[2], Scalar(0.25));
+            addMeshVirial(virial, dad, f[3], Scalar(0.25));
+            }
+
+        d_force[idx] = make_scalar4(force.x, force.y, force.z, energy);
+        for (unsigned int k = 0; k < 6; k++)
+            d_virial[k * virial_pitch + idx] = virial[k];
+
+        // unwrap the vertex so that the triangles enclose the volume of the mesh
+        vec3<Scalar> idx_r(
+            box.shift(make_scalar3(idx_postype.x, idx_postype.y, idx_postype.z), d_image[idx]));
+
+        vec3<Scalar> grad_area(0, 0, 0);
+        vec3<Scalar> grad_volume(0, 0, 0);
+        Scalar area_virial[6] = {};
+        Scalar volume_virial[6] = {};
+
+        // loop over all mesh triangles
+        unsigned int n_triangles = d_n_triangles[idx];
+        for (unsigned int triangle_idx = 0; triangle_idx < n_triangles; triangle_idx++)
+            {
+            group_storage<3> cur_triangle = d_triangle_table[triangle_pitch * triangle_idx + idx];
+            unsigned int cur_triangle_pos = d_triangle_pos[triangle_pitch * triangle_idx + idx];
+
+            vec3<Scalar> r[3];
+            unsigned int n = 0;
+            for (unsigned int j = 0; j < 3; ++j)
+                {
+                if (j == cur_triangle_pos)
+                    r[j] = idx_r;
+                else
+                    r[j] = idx_r
+                           + box.minImage(vec3<Scalar>(d_pos[cur_triangle.idx[n++]]) - idx_pos);
+                }
+
+            Scalar area_t, volume_t;
+            vec3<Scalar> grad_area_t[3], grad_volume_t[3];
+            computeMeshTriangleGradients(r, area_t, volume_t, grad_area_t, grad_volume_t);
+
+            // this vertex owns 1/3 of the triangle
+            area += area_t / Scalar(3.0);
+            volume += volume_t / Scalar(3.0);
+            grad_area += grad_area_t[cur_triangle_pos];
+            grad_volume += grad_volume_t[cur_triangle_pos];
+            for (unsigned int j = 0; j < 3; ++j)
+                {
+                addMeshVirial(area_virial, r[j], grad_area_t[j], Scalar(1.0) / Scalar(3.0));
+                addMeshVirial(volume_virial, r[j], grad_volume_t[j], Scalar(1.0) / Scalar(3.0));
+                }
+            }
+
+        d_area_grad[idx] = make_scalar4(grad_area.x, grad_area.y, grad_area.z, area);
+        d_volume_grad[idx] = make_scalar4(grad_volume.x, grad_volume.y, grad_volume.z, volume);
+        for (unsigned int k = 0; k < 6; k++)
+            {
+            d_constraint_virial[k * N + idx] = area_virial[k];
+            d_constraint_virial[(k + 6) * N + idx] = volume_virial[k];
+            }
+        }
+
+    membrane_sdata[threadIdx.x] = area;
+    membrane_sdata[blockDim.x + threadIdx.x] = volume;
+    __syncthreads();
+
+    // reduce the sums in parallel
+    int offs = blockDim.x >> 1;
+    while (offs > 0)
+        {
+        if (threadIdx.x < offs)
+            {
+            membrane_sdata[threadIdx.x] += membrane_sdata[threadIdx.x + offs];
+            membrane_sdata[blockDim.x + threadIdx.x]
+                += membrane_sdata[blockDim.x + threadIdx.x + offs];
+            }
+        offs >>= 1;
+        __syncthreads();
+        }
+
+    // write out our partial sums
+    if (threadIdx.x == 0)
+        {
+        d_partial_sum[blockIdx.x] = membrane_sdata[0];
+        d_partial_sum[gridDim.x + blockIdx.x] = membrane_sdata[blockDim.x];
+        }
+    }
+
+//! Kernel function for reducing the partial sums to the total area and volume
+/*! \param d_sum Total area and volume
+    \param d_partial_sum Partial sums, two rows of num_blocks elements
+    \param num_blocks Number of partial sums per row
+
+    Block k reduces row k of the partial sums.
+*/
+__global__ void gpu_compute_mesh_membrane_sum_kernel(Scalar* d_sum,
+                                                     const Scalar* d_partial_sum,
+                                                     unsigned int num_blocks)
+    {
+    extern __shared__ Scalar membrane_sdata[];
+
+    const Scalar* d_row = d_partial_sum + blockIdx.x * num_blocks;
+    Scalar sum = Scalar(0.0);
+
+    // sum up the values in the partial sum via a sliding window
+    for (int start = 0; start < num_blocks; start += blockDim.x)
+        {
+        __syncthreads();
+        if (start + threadIdx.x < num_blocks)
+            membrane_sdata[threadIdx.x] = d_row[start + threadIdx.x];
+        else
+            membrane_sdata[threadIdx.x] = Scalar(0.0);
+        __syncthreads();
+
+        // reduce the sum in parallel
+        int offs = blockDim.x >> 1;
+        while (offs > 0)
+            {
+            if (threadIdx.x < offs)
+                membrane_sdata[threadIdx.x] += membrane_sdata[threadIdx.x + offs];
+            offs >>= 1;
+            __syncthreads();
+            }
+
+        sum += membrane_sdata[0];
+        }
+
+    if (threadIdx.x == 0)
+        d_sum[blockIdx.x] = sum;
+    }
+
+/*! \param d_force Device memory to write computed forces
+    \param d_virial Device memory to write computed virials
+    \param virial_pitch pitch of 2D virial array
+    \param N number of particles
+    \param d_pos particle positions on the GPU
+    \param d_image particle images on the GPU
+    \param box Box dimensions (in GPU format) to use for periodic boundary conditions
+    \param d_bond_table Mesh bonds of each vertex
+    \param d_bond_pos Position of each vertex in its mesh bonds
+    \param bond_pitch Pitch of 2D mesh bond table
+    \param d_n_bonds Number of mesh bonds of each vertex
+    \param d_kappa Bending rigidity of each mesh type
+    \param d_triangle_table Mesh triangles of each vertex
+    \param d_triangle_pos Position of each vertex in its mesh triangles
+    \param triangle_pitch Pitch of 2D mesh triangle table
+    \param d_n_triangles Number of mesh triangles of each vertex
+    \param d_area_grad Area gradient and area share of each vertex (output)
+    \param d_volume_grad Volume gradient and volume share of each vertex (output)
+    \param d_constraint_virial Virials of the area and volume gradients (output, pitch N)
+    \param d_sum Area and volume of the local vertices (output)
+    \param d_partial_sum Partial sums, 2 * num_blocks elements
+    \param block_size Block size to use when performing calculations (a power of two)
+    \param num_blocks Number of blocks
+
+    \returns Any error code resulting from the kernel launch
+    \note Always returns hipSuccess in release builds to avoid the hipDeviceSynchronize()
+
+    This is a driver for gpu_compute_mesh_membrane_partial_kernel() and
+    gpu_compute_mesh_membrane_sum_kernel(), see them for details
+*/
+hipError_t gpu_compute_mesh_membrane_forces(Scalar4* d_force,
+                                            Scalar* d_virial,
+                                            const size_t virial_pitch,
+                                            const unsigned int N,
+                                            const Scalar4* d_pos,
+                                            const int3* d_image,
+                                            const BoxDim& box,
+                                            const group_storage<4>* d_bond_table,
+                                            const unsigned int* d_bond_pos,
+                                            const unsigned int bond_pitch,
+                                            const unsigned int* d_n_bonds,
+                                            const Scalar* d_kappa,
+                                            const group_storage<3>* d_triangle_table,
+                                            const unsigned int* d_triangle_pos,
+                                            const unsigned int triangle_pitch,
+                                            const unsigned int* d_n_triangles,
+                                            Scalar4* d_area_grad,
+                                            Scalar4* d_volume_grad,
+                                            Scalar* d_constraint_virial,
+                                            Scalar* d_sum,
+                                            Scalar* d_partial_sum,
+                                            unsigned int block_size,
+                                            unsigned int num_blocks)
+    {
+    assert(d_kappa);
+
+    // setup the grid to run the kernel
+    dim3 grid(num_blocks, 1, 1);
+    dim3 threads(block_size, 1, 1);
+
+    // run the kernels
+    hipLaunchKernelGGL((gpu_compute_mesh_membrane_partial_kernel),
+                       grid,
+                       threads,
+                       2 * block_size * sizeof(Scalar),
+                       0,
+                       d_force,
+                       d_virial,
+                       virial_pitch,
+                       N,
+                       d_pos,
+                       d_image,
+                       box,
+                       d_bond_table,
+                       d_bond_pos,
+                       bond_pitch,
+                       d_n_bonds,
+                       d_kappa,
+                       d_triangle_table,
+                       d_triangle_pos,
+                       triangle_pitch,
+                       d_n_triangles,
+                       d_area_grad,
+                       d_volume_grad,
+                       d_constraint_virial,
+                       d_partial_sum);
+
+    hipLaunchKernelGGL((gpu_compute_mesh_membrane_sum_kernel),
+                       dim3(2, 1, 1),
+                       threads,
+                       block_size * sizeof(Scalar),
+                       0,
+                       d_sum,
+                       d_partial_sum,
+                       num_blocks);
+
+    return hipSuccess;
+    }
+
+//! Kernel for adding the area and volume constraint forces on the GPU
+/*! \param d_force Device memory to add the constraint forces to
+    \param d_virial Device memory to add the constraint virials to
+    \param virial_pitch pitch of 2D virial array
+    \param N number of particles
+    \param d_area_grad Area gradient and area share of each vertex
+    \param d_volume_grad Volume gradient and volume share of each vertex
+    \param d_constraint_virial Virials of the area and volume gradients
+    \param area_derivative Derivative of the area constraint energy with respect to the area
+    \param area_energy Area constraint energy divided by the total area
+    \param volume_derivative Derivative of the volume constraint energy with respect to the volume
+    \param volume_energy Volume constraint energy divided by the total volume
+*/
+__global__ void gpu_apply_mesh_membrane_constraints_kernel(Scalar4* d_force,
+                                                           Scalar* d_virial,
+                                                           const size_t virial_pitch,
+                                                           const unsigned int N,
+                                                           const Scalar4* d_area_grad,
+                                                           const Scalar4* d_volume_grad,
+                                                           const Scalar* d_constraint_virial,
+                                                           Scalar area_derivative,
+                                                           Scalar area_energy,
+                                                           Scalar volume_derivative,
+                                                           Scalar volume_energy)
+    {
+    // start by identifying which particle we are to handle
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (idx >= N)
+        return;
+
+    Scalar4 grad_area = d_area_grad[idx];
+    Scalar4 grad_volume = d_volume_grad[idx];
+
+    Scalar4 force = d_force[idx];
+    force.x -= area_derivative * grad_area.x + volume_derivative * grad_volume.x;
+    force.y -= area_derivative * grad_area.y + volume_derivative * grad_volume.y;
+    force.z -= area_derivative * grad_area.z + volume_derivative * grad_volume.z;
+    force.w += area_energy * grad_area.w + volume_energy * grad_volume.w;
+    d_force[idx] = force;
+
+    for (unsigned int k = 0; k < 6; k++)
+        {
+        d_virial[k * virial_pitch + idx]
+            -= area_derivative * d_constraint_virial[k * N + idx]
+               + volume_derivative * d_constraint_virial[(k + 6) * N + idx];
+        }
+    }
+
+/*! \param d_force Device memory to add the constraint forces to
+    \param d_virial Device memory to add the constraint virials to
+    \param virial_pitch pitch of 2D virial array
+    \param N number of particles
+    \param d_area_grad Area gradient and area share of each vertex
+    \param d_volume_grad Volume gradient and volume share of each vertex
+    \param d_constraint_virial Virials of the area and volume gradients
+    \param area_derivative Derivative of the area constraint energy with respect to the area
+    \param area_energy Area constraint energy divided by the total area
+    \param volume_derivative Derivative of the volume constraint energy with respect to the volume
+    \param volume_energy Volume constraint energy divided by the total volume
+    \param block_size Block size to use when performing calculations
+
+    \returns Any error code resulting from the kernel launch
+    \note Always returns hipSuccess in release builds to avoid the hipDeviceSynchronize()
+*/
+hipError_t gpu_apply_mesh_membrane_constraints(Scalar4* d_force,
+                                               Scalar* d_virial,
+                                               const size_t virial_pitch,
+                                               const unsigned int N,
+                                               const Scalar4* d_area_grad,
+                                               const Scalar4* d_volume_grad,
+                                               const Scalar* d_constraint_virial,
+                                               Scalar area_derivative,
+                                               Scalar area_energy,
+                                               Scalar volume_derivative,
+                                               Scalar volume_energy,
+                                               unsigned int block_size)
+    {
+    // setup the grid to run the kernel
+    dim3 grid(N / block_size + 1, 1, 1);
+    dim3 threads(block_size, 1, 1);
+
+    // run the kernel
+    hipLaunchKernelGGL((gpu_apply_mesh_membrane_constraints_kernel),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       d_force,
+                       d_virial,
+                       virial_pitch,
+                       N,
+                       d_area_grad,
+                       d_volume_grad,
+                       d_constraint_virial,
+                       area_derivative,
+                       area_energy,
+                       volume_derivative,
+                       volume_energy);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
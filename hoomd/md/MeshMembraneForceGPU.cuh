@@ -0,0 +1,66 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hip/hip_runtime.h"
+#include "hoomd/BondedGroupData.cuh"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/ParticleData.cuh"
+
+/*! \file MeshMembraneForceGPU.cuh
+    \brief Declares GPU kernel code for calculating the mesh membrane forces. Used by
+   MeshMembraneForceComputeGPU.
+*/
+
+#ifndef __MESHMEMBRANEFORCEGPU_CUH__
+#define __MESHMEMBRANEFORCEGPU_CUH__
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Kernel driver that computes the bending forces and the area and volume shares and gradients
+hipError_t gpu_compute_mesh_membrane_forces(Scalar4* d_force,
+                                            Scalar* d_virial,
+                                            const size_t virial_pitch,
+                                            const unsigned int N,
+                                            const Scalar4* d_pos,
+                                            const int3* d_image,
+                                            const BoxDim& box,
+                                            const group_storage<4>* d_bond_table,
+                                            const unsigned int* d_bond_pos,
+                                            const unsigned int bond_pitch,
+                                            const unsigned int* d_n_bonds,
+                                            const Scalar* d_kappa,
+                                            const group_storage<3>* d_triangle_table,
+                                            const unsigned int* d_triangle_pos,
+                                            const unsigned int triangle_pitch,
+                                            const unsigned int* d_n_triangles,
+                                            Scalar4* d_area_grad,
+                                            Scalar4* d_volume_grad,
+                                            Scalar* d_constraint_virial,
+                                            Scalar* d_sum,
+                                            Scalar* d_partial_sum,
+                                            unsigned int block_size,
+                                            unsigned int num_blocks);
+
+//! Kernel driver that adds the area and volume constraint forces
+hipError_t gpu_apply_mesh_membrane_constraints(Scalar4* d_force,
+                                               Scalar* d_virial,
+                                               const size_t virial_pitch,
+                                               const unsigned int N,
+                                               const Scalar4* d_area_grad,
+                                               const Scalar4* d_volume_grad,
+                                               const Scalar* d_constraint_virial,
+                                               Scalar area_derivative,
+                                               Scalar area_energy,
+                                               Scalar volume_derivative,
+                                               Scalar volume_energy,
+                                               unsigned int block_size);
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
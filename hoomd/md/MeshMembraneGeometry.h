@@ -0,0 +1,128 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __MESH_MEMBRANE_GEOMETRY_H__
+#define __MESH_MEMBRANE_GEOMETRY_H__
+
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/VectorMath.h"
+
+/*! \file MeshMembraneGeometry.h
+    \brief Geometric terms shared by the CPU and GPU mesh membrane force computes
+*/
+
+// need to declare these functions with __device__ qualifiers when building in nvcc
+// DEVICE is __host__ __device__ when included in nvcc and blank when included into the host
+// compiler
+#ifdef __HIPCC__
+#define DEVICE __device__
+#else
+#define DEVICE
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Area and enclosed volume of a mesh triangle and their gradients
+/*! \param r Unwrapped positions of the triangle vertices in mesh order
+    \param area Area of the triangle (output)
+    \param volume Signed volume of the tetrahedron spanned by the origin and the triangle (output)
+    \param grad_area Gradient of \a area with respect to each vertex (output)
+    \param grad_volume Gradient of \a volume with respect to each vertex (output)
+
+    The volume is positive when the vertices run counterclockwise seen from outside the mesh, so
+    the sum over a closed, consistently oriented mesh is its enclosed volume.
+*/
+DEVICE inline void computeMeshTriangleGradients(const vec3<Scalar> r[3],
+                                                Scalar& area,
+                                                Scalar& volume,
+                                                vec3<Scalar> grad_area[3],
+                                                vec3<Scalar> grad_volume[3])
+    {
+    vec3<Scalar> z = cross(r[1] - r[0], r[2] - r[0]);
+    Scalar zabs = fast::sqrt(dot(z, z));
+
+    area = Scalar(0.5) * zabs;
+    volume = dot(r[0], cross(r[1], r[2])) / Scalar(6.0);
+
+    vec3<Scalar> n = zabs > Scalar(0.0) ? z / zabs : vec3<Scalar>(0, 0, 0);
+    for (unsigned int i = 0; i < 3; ++i)
+        {
+        const vec3<Scalar>& r_j = r[(i + 1) % 3];
+        const vec3<Scalar>& r_l = r[(i + 2) % 3];
+        grad_area[i] = Scalar(0.5) * cross(n, r_l - r_j);
+        grad_volume[i] = cross(r_j, r_l) / Scalar(6.0);
+        }
+    }
+
+//! Bending energy and forces across one mesh edge
+/*! \param dab Vector from vertex a to vertex b (the shared edge)
+    \param dac Vector from vertex a to vertex c (opposite vertex of the first triangle)
+    \param dad Vector from vertex a to vertex d (opposite vertex of the second triangle)
+    \param kappa Bending rigidity
+    \param force Force on a, b, c and d (output)
+
+    The energy is kappa / 2 (1 - n1 . n2) with the unit normals n1 ~ dab x dac and n2 ~ dad x dab,
+    which point to the same side of the edge independent of the orientation of the triangles.
+
+    \returns The bending energy of the edge
+*/
+DEVICE inline Scalar computeMeshBendingForces(const vec3<Scalar>& dab,
+                                              const vec3<Scalar>& dac,
+                                              const vec3<Scalar>& dad,
+                                              Scalar kappa,
+                                              vec3<Scalar> force[4])
+    {
+    vec3<Scalar> z1 = cross(dab, dac);
+    vec3<Scalar> z2 = cross(dad, dab);
+    Scalar z1sq = dot(z1, z1);
+    Scalar z2sq = dot(z2, z2);
+
+    for (unsigned int i = 0; i < 4; ++i)
+        force[i] = vec3<Scalar>(0, 0, 0);
+
+    // a degenerate triangle has no normal
+    if (z1sq == Scalar(0.0) || z2sq == Scalar(0.0))
+        return Scalar(0.0);
+
+    Scalar z1inv = fast::rsqrt(z1sq);
+    Scalar z2inv = fast::rsqrt(z2sq);
+    vec3<Scalar> n1 = z1 * z1inv;
+    vec3<Scalar> n2 = z2 * z2inv;
+    Scalar c = dot(n1, n2);
+
+    // derivatives of c with respect to z1 and z2
+    vec3<Scalar> w1 = (n2 - c * n1) * z1inv;
+    vec3<Scalar> w2 = (n1 - c * n2) * z2inv;
+
+    Scalar prefactor = Scalar(0.5) * kappa;
+    force[1] = prefactor * (cross(dac, w1) + cross(w2, dad));
+    force[2] = prefactor * cross(w1, dab);
+    force[3] = prefactor * cross(dab, w2);
+    force[0] = -(force[1] + force[2] + force[3]);
+
+    return prefactor * (Scalar(1.0) - c);
+    }
+
+//! Add the virial r (x) f to the upper triangular virial tensor
+/*! \param virial Virial tensor to update (xx, xy, xz, yy, yz, zz)
+    \param r Position
+    \param f Force acting at \a r
+    \param scale Factor to apply to the virial
+*/
+DEVICE inline void
+addMeshVirial(Scalar virial[6], const vec3<Scalar>& r, const vec3<Scalar>& f, Scalar scale)
+    {
+    virial[0] += scale * r.x * f.x;
+    virial[1] += scale * r.x * f.y;
+    virial[2] += scale * r.x * f.z;
+    virial[3] += scale * r.y * f.y;
+    virial[4] += scale * r.y * f.z;
+    virial[5] += scale * r.z * f.z;
+    }
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __MESH_MEMBRANE_GEOMETRY_H__
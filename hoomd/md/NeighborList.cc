@@ -8,6 +8,7 @@
 #include "NeighborList.h"
 #include "hoomd/BondedGroupData.h"
 
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
 
@@ -405,18 +406,21 @@ void NeighborList::compute(uint64_t timestep)
     // check if the list needs to be updated and update it
     if (needsUpdating(timestep))
         {
+        ScopedTrace trace(m_exec_conf->getTracer(), typeid(*this), "compute");
+        ScopedTimer timer(m_timer);
+
         // check simulation box size is OK
         checkBoxSize();
 
         // rebuild the list until there is no overflow
-        bool overflowed = false;
+        bool rebuild = false;
         do
             {
             buildNlist(timestep);
 
-            overflowed = checkConditions();
+            rebuild = checkConditions();
             // if we overflowed, need to reallocate memory and reset the conditions
-            if (overflowed)
+            if (rebuild)
                 {
                 // always rebuild the head list after an overflow
                 buildHeadList();
@@ -424,16 +428,79 @@ void NeighborList::compute(uint64_t timestep)
                 // zero out the conditions for the next build
                 resetConditions();
                 }
-            } while (overflowed);
+            else if (shrinkNmax())
+                {
+                // the capacity per particle shrank, build again in the compact layout
+                buildHeadList();
+                rebuild = true;
+                }
+            } while (rebuild);
 
-        if (m_exclusions_set)
+        if (m_exclusions_set && !m_filter_exclusions_in_build)
             filterNlist();
 
         setLastUpdatedPos();
         m_has_been_updated_once = true;
+        m_interior_partition_valid = false;
         }
     }
 
+/*! \param n_interior Set to the number of interior particles
+    \returns Indices of the local particles with the \a n_interior interior particles first,
+             followed by the boundary particles
+
+    Interior particles have no ghost particles in their neighbor list, so their forces can be
+    computed before the ghost positions are updated. The partition is rebuilt on the first call
+    after each build of the neighbor list.
+*/
+const GlobalArray<unsigned int>& NeighborList::getInteriorPartition(unsigned int& n_interior)
+    {
+    if (!m_interior_partition_valid)
+        {
+        if (m_interior_partition.getNumElements() < m_pdata->getMaxN())
+            {
+            GlobalArray<unsigned int> interior_partition(m_pdata->getMaxN(), m_exec_conf);
+            m_interior_partition.swap(interior_partition);
+            TAG_ALLOCATION(m_interior_partition);
+            }
+
+        buildInteriorPartition();
+        m_interior_partition_valid = true;
+        }
+
+    n_interior = m_n_interior;
+    return m_interior_partition;
+    }
+
+void NeighborList::buildInteriorPartition()
+    {
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_interior_partition(m_interior_partition,
+                                                   access_location::host,
+                                                   access_mode::overwrite);
+
+    const unsigned int N = m_pdata->getN();
+    unsigned int n_interior = 0;
+    unsigned int n_boundary = 0;
+    for (unsigned int i = 0; i < N; ++i)
+        {
+        const size_t head = h_head_list.data[i];
+        bool interior = true;
+        for (unsigned int k = 0; k < h_n_neigh.data[i] && interior; ++k)
+            interior = h_nlist.data[head + k] < N;
+
+        // boundary particles fill the array from the end
+        if (interior)
+            h_interior_partition.data[n_interior++] = i;
+        else
+            h_interior_partition.data[N - 1 - n_boundary++] = i;
+        }
+
+    m_n_interior = n_interior;
+    }
+
 /*! \param r_buff New buffer radius to set
     \note Changing the buffer radius does NOT immediately update the neighborlist.
             The new buffer will take effect when compute is called for the next timestep.
@@ -1568,7 +1635,8 @@ void NeighborList::buildHeadList()
  * \param size the requested number of elements in the neighbor list
  *
  * Increases the size of the neighbor list memory using amortized resizing (growth factor: 9/8)
- * only when needed.
+ * only when needed. Releases memory when the request falls below half of the allocation, keeping
+ * the same 1/8 headroom.
  */
 void NeighborList::resizeNlist(size_t size)
     {
@@ -1589,6 +1657,20 @@ void NeighborList::resizeNlist(size_t size)
 
         m_nlist.resize(alloc_size);
         }
+    else if (size < m_nlist.getNumElements() / 2)
+        {
+        size_t alloc_size = size + size / 8;
+
+        // round up to nearest multiple of 4
+        alloc_size = (alloc_size > 4) ? (alloc_size + 3) & ~3 : 4;
+
+        if (alloc_size < m_nlist.getNumElements())
+            {
+            m_exec_conf->msg->notice(6)
+                << "nlist: Shrinking neighbor list, new size " << alloc_size << " uints " << endl;
+            m_nlist.resize(alloc_size);
+            }
+        }
     }
 
 /*!
@@ -1616,6 +1698,52 @@ bool NeighborList::checkConditions()
     return result;
     }
 
+/*!
+ * \returns true if the maximum number of neighbors decreased for any particle type
+ *
+ * checkConditions() only ever grows m_Nmax. Every s_shrink_check_period builds, find the largest
+ * number of neighbors of each type in the list just built. When a type holds more than twice
+ * the capacity it needs (for example, after the density drops), lower its capacity to the need
+ * plus 1/8 headroom, rounded up to a multiple of 4. The caller must rebuild the head list and the
+ * neighbor list after a shrink.
+ */
+bool NeighborList::shrinkNmax()
+    {
+    if (++m_builds_since_shrink_check < s_shrink_check_period)
+        return false;
+    m_builds_since_shrink_check = 0;
+
+    std::vector<unsigned int> max_n_neigh(m_pdata->getNTypes(), 0);
+        {
+        ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        for (unsigned int i = 0; i < m_pdata->getN(); ++i)
+            {
+            unsigned int type = __scalar_as_int(h_pos.data[i].w);
+            max_n_neigh[type] = std::max(max_n_neigh[type], h_n_neigh.data[i]);
+            }
+        }
+
+    bool result = false;
+    ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::readwrite);
+    for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+        {
+        unsigned int n = max_n_neigh[i] + max_n_neigh[i] / 8;
+        n = (n > 4) ? (n + 3) & ~3 : 4;
+        if (n <= h_Nmax.data[i] / 2)
+            {
+            m_exec_conf->msg->notice(6) << "nlist: Shrinking Nmax[" << i << "] from "
+                                        << h_Nmax.data[i] << " to " << n << endl;
+            h_Nmax.data[i] = n;
+            result = true;
+            }
+        }
+
+    return result;
+    }
+
 void NeighborList::resetConditions()
     {
     ArrayHandle<unsigned int> h_conditions(m_conditions,
@@ -103,7 +103,9 @@ namespace md
    indices whenever a particle sort occurs (updateExListIdx()). If any exclusions are set,
    filterNlist() is called after buildNlist(). filterNlist() loops through the neighbor list and
    removes any particles that are excluded. This allows an arbitrary number of exclusions to be
-   processed without slowing the performance of the buildNlist() step itself.
+   processed without slowing the performance of the buildNlist() step itself. Subclasses that
+   skip the excluded pairs while building set \a m_filter_exclusions_in_build, and then the
+   filter pass is not needed.
 
     <b>Overflow handling:</b>
     For easy support of derived GPU classes to implement overflow detection the overflow condition
@@ -420,6 +422,23 @@ class PYBIND11_EXPORT NeighborList : public Compute
     bool peekUpdate(uint64_t timestep);
 #endif
 
+    //! Test if compute() will use the current list without rebuilding it
+    /*! \param timestep Current time step
+     *
+     *  Unlike peekUpdate(), this does not check particle displacements. It returns true only when
+     *  the rebuild check at \a timestep has already been performed (for example, by the
+     *  communicator's migration check) and found that no rebuild is needed.
+     */
+    bool isCurrent(uint64_t timestep) const
+        {
+        return m_has_been_updated_once && m_last_checked_tstep == timestep && !m_last_check_result
+               && !m_force_update && !m_rcut_changed && !m_n_particles_changed
+               && !m_topology_changed;
+        }
+
+    //! Get the local particle indices with the interior particles first
+    const GlobalArray<unsigned int>& getInteriorPartition(unsigned int& n_interior);
+
     //! Return true if the neighbor list has been updated this time step
     /*! \param timestep Current time step
      *
@@ -505,6 +524,9 @@ class PYBIND11_EXPORT NeighborList : public Compute
     Index2D m_ex_list_indexer_tag;           //!< Indexer for accessing the by-tag exclusion list
     bool m_exclusions_set;                   //!< True if any exclusions have been set
 
+    /// True if buildNlist() skips the excluded pairs, so filterNlist() is not called.
+    bool m_filter_exclusions_in_build = false;
+
     std::shared_ptr<MeshBondData> m_meshbond_data;
 
     /// True if the number of particles has changed.
@@ -513,6 +535,15 @@ class PYBIND11_EXPORT NeighborList : public Compute
     /// True if the number of bonds/angles/dihedrals/impropers/pairs has changed.
     bool m_topology_changed = false;
 
+    /// Local particle indices, interior particles first (see getInteriorPartition())
+    GlobalArray<unsigned int> m_interior_partition;
+
+    /// Number of interior particles in m_interior_partition
+    unsigned int m_n_interior = 0;
+
+    /// True when m_interior_partition matches the current list
+    bool m_interior_partition_valid = false;
+
 #ifdef ENABLE_MPI
     /// The system's communicator.
     std::shared_ptr<Communicator> m_comm;
@@ -548,6 +579,9 @@ class PYBIND11_EXPORT NeighborList : public Compute
     //! Amortized resizing of the neighborlist
     void resizeNlist(size_t size);
 
+    //! Partition the local particles into interior and boundary particles
+    virtual void buildInteriorPartition();
+
 #ifdef ENABLE_MPI
     CommFlags getRequestedCommFlags(uint64_t timestep)
         {
@@ -605,6 +639,15 @@ class PYBIND11_EXPORT NeighborList : public Compute
     //! Check the status of the conditions
     bool checkConditions();
 
+    //! Lower the maximum number of neighbors of types that use much less than their capacity
+    bool shrinkNmax();
+
+    /// Number of builds between checks for unused neighbor list capacity
+    static const unsigned int s_shrink_check_period = 100;
+
+    /// Number of builds since the last check for unused capacity
+    unsigned int m_builds_since_shrink_check = 0;
+
     //! Resets the condition status to all zeroes
     virtual void resetConditions();
 
@@ -34,6 +34,12 @@ NeighborListBinned::~NeighborListBinned()
     }
 
 void NeighborListBinned::buildNlist(uint64_t timestep)
+    {
+    computeCellList(timestep);
+    buildRows(nullptr);
+    }
+
+void NeighborListBinned::computeCellList(uint64_t timestep)
     {
     // update the cell list size if needed
     if (m_update_cell_size)
@@ -45,7 +51,14 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
         }
 
     m_cl->compute(timestep);
+    }
 
+/*! \param rows Local particles whose neighbors are found, or nullptr for all local particles
+
+    The rows of the other particles are not modified.
+*/
+void NeighborListBinned::buildRows(const std::vector<unsigned int>* rows)
+    {
     uint3 dim = m_cl->getDim();
     Scalar3 ghost_width = m_cl->getGhostWidth();
 
@@ -78,8 +91,9 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
     ArrayHandle<unsigned int> h_conditions(m_conditions,
                                            access_location::host,
                                            access_mode::readwrite);
-    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::overwrite);
-    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::overwrite);
+    const access_mode::Enum mode = (rows) ? access_mode::readwrite : access_mode::overwrite;
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, mode);
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, mode);
 
     // access indexers
     Index3D ci = m_cl->getCellIndexer();
@@ -89,11 +103,12 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
     // get periodic flags
     uchar3 periodic = box.getPeriodic();
 
-    // for each local particle
-    unsigned int nparticles = m_pdata->getN();
+    // for each local particle (or requested row)
+    unsigned int nrows = (rows) ? (unsigned int)rows->size() : m_pdata->getN();
 
-    for (int i = 0; i < (int)nparticles; i++)
+    for (unsigned int row = 0; row < nrows; row++)
         {
+        const int i = (rows) ? (int)(*rows)[row] : (int)row;
         unsigned int cur_n_neigh = 0;
 
         const Scalar3 my_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
@@ -178,6 +193,162 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
         }
     }
 
+/*! \returns true if the full neighbor list needs to be rebuilt
+
+    In partial rebuild mode, each local particle is tracked from the position where it was last
+    displaced (m_last_pos). A particle is displaced once it moves r_buff/4 from that position,
+    which is half the threshold of the full distance check. The rows of the displaced particles are
+    rebuilt, along with the rows of every local particle in the cells adjacent to them, and only
+    the reference positions of the displaced particles are reset. All other rows are kept.
+
+    The smaller threshold makes the kept rows valid even though the particles have different
+    reference positions: a particle moves less than r_buff/2 between two of its own rebuilds,
+    and any pair moves less than 3/4 r_buff relative to each other after either row was built. A
+    particle that is displaced away from a kept row was more than a cell width (at least the list
+    cutoff) from it, so the pair cannot come inside the cutoff before one of the rows is rebuilt.
+
+    The full list is rebuilt instead when the box has changed, when many particles are displaced,
+    or when a rebuilt row overflows its allocation.
+*/
+bool NeighborListBinned::distanceCheck(uint64_t timestep)
+    {
+    bool partial = m_partial_rebuild;
+#ifdef ENABLE_MPI
+    // ghost particles are only migrated and reordered by a full rebuild
+    partial = partial && !m_sysdef->isDomainDecomposed();
+#endif
+    if (!partial)
+        return NeighborList::distanceCheck(timestep);
+
+    // box changes are only handled by the full rebuild
+    const Scalar3 L_g = m_pdata->getGlobalBox().getNearestPlaneDistance();
+    if (L_g.x != m_last_L.x || L_g.y != m_last_L.y || L_g.z != m_last_L.z)
+        return true;
+
+    const BoxDim& box = m_pdata->getBox();
+    const unsigned int N = m_pdata->getN();
+    const Scalar delta_max = m_r_buff / Scalar(4.0);
+    const Scalar maxsq = delta_max * delta_max;
+
+    // find the displaced particles
+    m_displaced.clear();
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<Scalar4> h_last_pos(m_last_pos, access_location::host, access_mode::read);
+        for (unsigned int i = 0; i < N; i++)
+            {
+            Scalar3 dx = make_scalar3(h_pos.data[i].x - h_last_pos.data[i].x,
+                                      h_pos.data[i].y - h_last_pos.data[i].y,
+                                      h_pos.data[i].z - h_last_pos.data[i].z);
+            dx = box.minImage(dx);
+            if (dot(dx, dx) >= maxsq)
+                m_displaced.push_back(i);
+            }
+        }
+    if (m_displaced.empty())
+        return false;
+
+    // a full rebuild is cheaper when the rows of most particles would be rebuilt anyway
+    if (m_displaced.size() * m_partial_rebuild_max > N)
+        return true;
+
+    computeCellList(timestep);
+    const uint3 dim = m_cl->getDim();
+    const Scalar3 ghost_width = m_cl->getGhostWidth();
+    const uchar3 periodic = box.getPeriodic();
+    const Index3D ci = m_cl->getCellIndexer();
+    const Index2D cli = m_cl->getCellListIndexer();
+    const Index2D cadji = m_cl->getCellAdjIndexer();
+
+    // collect the local particles in the cells adjacent to the displaced particles
+    m_rows.clear();
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<unsigned int> h_cell_size(m_cl->getCellSizeArray(),
+                                              access_location::host,
+                                              access_mode::read);
+        ArrayHandle<Scalar4> h_cell_xyzf(m_cl->getXYZFArray(),
+                                         access_location::host,
+                                         access_mode::read);
+        ArrayHandle<unsigned int> h_cell_adj(m_cl->getCellAdjArray(),
+                                             access_location::host,
+                                             access_mode::read);
+
+        m_cell_marked.assign(ci.getNumElements(), 0);
+        for (const unsigned int i : m_displaced)
+            {
+            const Scalar3 pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            Scalar3 f = box.makeFraction(pos, ghost_width);
+            unsigned int ib = (unsigned int)(f.x * dim.x);
+            unsigned int jb = (unsigned int)(f.y * dim.y);
+            unsigned int kb = (unsigned int)(f.z * dim.z);
+            if (ib == dim.x && periodic.x)
+                ib = 0;
+            if (jb == dim.y && periodic.y)
+                jb = 0;
+            if (kb == dim.z && periodic.z)
+                kb = 0;
+
+            const unsigned int my_cell = ci(ib, jb, kb);
+            for (unsigned int cur_adj = 0; cur_adj < cadji.getW(); cur_adj++)
+                {
+                const unsigned int neigh_cell = h_cell_adj.data[cadji(cur_adj, my_cell)];
+                if (m_cell_marked[neigh_cell])
+                    continue;
+                m_cell_marked[neigh_cell] = 1;
+
+                const unsigned int size = h_cell_size.data[neigh_cell];
+                for (unsigned int cur_offset = 0; cur_offset < size; cur_offset++)
+                    {
+                    const unsigned int j
+                        = __scalar_as_int(h_cell_xyzf.data[cli(cur_offset, neigh_cell)].w);
+                    if (j < N)
+                        m_rows.push_back(j);
+                    }
+                }
+            }
+        }
+
+    buildRows(&m_rows);
+
+    // a row that overflowed needs the storage to be reallocated
+        {
+        ArrayHandle<unsigned int> h_conditions(m_conditions,
+                                               access_location::host,
+                                               access_mode::read);
+        ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::read);
+        for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+            {
+            if (h_conditions.data[i] > h_Nmax.data[i])
+                return true;
+            }
+        }
+
+    if (m_exclusions_set)
+        filterNlist();
+
+    // only the displaced particles start over
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<Scalar4> h_last_pos(m_last_pos,
+                                        access_location::host,
+                                        access_mode::readwrite);
+        for (const unsigned int i : m_displaced)
+            {
+            h_last_pos.data[i] = h_pos.data[i];
+            }
+        }
+
+    m_partial_builds++;
+    return false;
+    }
+
 namespace detail
     {
 void export_NeighborListBinned(pybind11::module& m)
@@ -192,7 +363,11 @@ void export_NeighborListBinned(pybind11::module& m)
         .def("getDim",
              &NeighborListBinned::getDim,
              pybind11::return_value_policy::reference_internal)
-        .def("getNmax", &NeighborListBinned::getNmax);
+        .def("getNmax", &NeighborListBinned::getNmax)
+        .def_property("partial_rebuild",
+                      &NeighborListBinned::getPartialRebuild,
+                      &NeighborListBinned::setPartialRebuild)
+        .def_property_readonly("num_partial_builds", &NeighborListBinned::getNumPartialBuilds);
     }
 
     } // end namespace detail
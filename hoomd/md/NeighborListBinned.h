@@ -4,6 +4,8 @@
 #include "NeighborList.h"
 #include "hoomd/CellList.h"
 
+#include <vector>
+
 /*! \file NeighborListBinned.h
     \brief Declares the NeighborListBinned class
 */
@@ -66,14 +68,52 @@ class PYBIND11_EXPORT NeighborListBinned : public NeighborList
         return m_cl->getNmax();
         }
 
+    /// Set whether only the rows around displaced particles are rebuilt
+    void setPartialRebuild(bool partial_rebuild)
+        {
+        m_partial_rebuild = partial_rebuild;
+        }
+
+    /// Get the partial rebuild flag
+    bool getPartialRebuild() const
+        {
+        return m_partial_rebuild;
+        }
+
+    /// Get the number of partial rebuilds
+    uint64_t getNumPartialBuilds() const
+        {
+        return m_partial_builds;
+        }
+
     protected:
     std::shared_ptr<CellList> m_cl; //!< The cell list
 
     /// Track when the cell size needs to be updated
     bool m_update_cell_size = true;
 
+    /// Rebuild only the rows around displaced particles
+    bool m_partial_rebuild = false;
+
+    /// Fall back to a full rebuild when more than 1 in this many particles are displaced
+    unsigned int m_partial_rebuild_max = 8;
+
+    uint64_t m_partial_builds = 0;            //!< Number of partial rebuilds
+    std::vector<unsigned int> m_displaced;    //!< Particles displaced in the last check
+    std::vector<unsigned int> m_rows;         //!< Rows rebuilt in the last partial rebuild
+    std::vector<unsigned char> m_cell_marked; //!< Flags for cells next to a displaced particle
+
     //! Builds the neighbor list
     virtual void buildNlist(uint64_t timestep);
+
+    //! Check if the list needs to be rebuilt, and rebuild rows in partial rebuild mode
+    virtual bool distanceCheck(uint64_t timestep);
+
+    //! Compute the cell list at the current list cutoff
+    void computeCellList(uint64_t timestep);
+
+    //! Find the neighbors of some local particles
+    void buildRows(const std::vector<unsigned int>* rows);
     };
 
     } // end namespace md
@@ -0,0 +1,257 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file NeighborListBufferTuner.cc
+    \brief Defines the NeighborListBufferTuner class
+*/
+
+#include "NeighborListBufferTuner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <pybind11/stl.h>
+#include <stdexcept>
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System definition
+    \param trigger Steps on which to adjust the buffer
+    \param nlist Neighbor list to tune
+    \param forces Forces that use \a nlist
+    \param minimum_buffer Smallest buffer to set
+    \param maximum_buffer Largest buffer to set
+*/
+NeighborListBufferTuner::NeighborListBufferTuner(std::shared_ptr<SystemDefinition> sysdef,
+                                                 std::shared_ptr<Trigger> trigger,
+                                                 std::shared_ptr<NeighborList> nlist,
+                                                 std::vector<std::shared_ptr<ForceCompute>> forces,
+                                                 Scalar minimum_buffer,
+                                                 Scalar maximum_buffer)
+    : Tuner(sysdef, trigger), m_nlist(nlist), m_forces(forces), m_minimum_buffer(0),
+      m_maximum_buffer(0), m_has_state(false), m_last_timestep(0), m_build_time(0),
+      m_pair_time(0), m_build_rate(0)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing NeighborListBufferTuner" << std::endl;
+    setMaximumBuffer(maximum_buffer);
+    setMinimumBuffer(minimum_buffer);
+    }
+
+NeighborListBufferTuner::~NeighborListBufferTuner()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying NeighborListBufferTuner" << std::endl;
+    }
+
+void NeighborListBufferTuner::setMinimumBuffer(Scalar minimum_buffer)
+    {
+    if (minimum_buffer < Scalar(0) || minimum_buffer > m_maximum_buffer)
+        {
+        throw std::invalid_argument("The minimum buffer must be in the range [0, maximum_buffer].");
+        }
+    m_minimum_buffer = minimum_buffer;
+    }
+
+void NeighborListBufferTuner::setMaximumBuffer(Scalar maximum_buffer)
+    {
+    if (maximum_buffer <= Scalar(0) || maximum_buffer < m_minimum_buffer)
+        {
+        throw std::invalid_argument("The maximum buffer must be positive and at least "
+                                    "minimum_buffer.");
+        }
+    m_maximum_buffer = maximum_buffer;
+    }
+
+/*! \param timestep Current time step
+
+    The costs are measured over the steps since the last update and are skipped when any timer was
+    reset in between.
+*/
+void NeighborListBufferTuner::update(uint64_t timestep)
+    {
+    Tuner::update(timestep);
+    const bool use_gpu = m_exec_conf->isCUDAEnabled() && m_exec_conf->operationGPUTimingEnabled();
+    if (!m_has_state || timestep <= m_last_timestep || m_force_states.size() != m_forces.size())
+        {
+        storeTimers(use_gpu, timestep);
+        return;
+        }
+
+    // time per build
+    const TimerState nlist_state = readTimer(m_nlist->getTimer(), use_gpu);
+    if (nlist_state.num_calls < m_nlist_state.num_calls)
+        {
+        storeTimers(use_gpu, timestep);
+        return;
+        }
+    const double n_steps = double(timestep - m_last_timestep);
+    const uint64_t n_builds = nlist_state.num_calls - m_nlist_state.num_calls;
+    const uint64_t n_build_samples = nlist_state.num_samples - m_nlist_state.num_samples;
+    if (n_build_samples > 0)
+        {
+        m_build_time = (nlist_state.total - m_nlist_state.total) / double(n_build_samples);
+        }
+    m_build_rate = double(n_builds) / n_steps;
+
+    // time per step of the forces, which build the neighbor list when they are computed
+    double force_time = 0;
+    for (unsigned int i = 0; i < m_forces.size(); ++i)
+        {
+        const TimerState force_state = readTimer(m_forces[i]->getTimer(), use_gpu);
+        const TimerState& last = m_force_states[i];
+        if (force_state.num_calls < last.num_calls)
+            {
+            storeTimers(use_gpu, timestep);
+            return;
+            }
+        const uint64_t n_samples = force_state.num_samples - last.num_samples;
+        if (n_samples > 0)
+            {
+            force_time += (force_state.total - last.total) / double(n_samples)
+                          * double(force_state.num_calls - last.num_calls);
+            }
+        }
+    m_pair_time = std::max(force_time / n_steps - m_build_time * m_build_rate, 0.0);
+    storeTimers(use_gpu, timestep);
+
+#ifdef ENABLE_MPI
+    // the slowest rank sets the cost so that all ranks choose the same buffer
+    if (m_sysdef->isDomainDecomposed())
+        {
+        double times[2] = {m_build_time, m_pair_time};
+        MPI_Allreduce(MPI_IN_PLACE,
+                      times,
+                      2,
+                      MPI_DOUBLE,
+                      MPI_MAX,
+                      m_exec_conf->getMPICommunicator());
+        m_build_time = times[0];
+        m_pair_time = times[1];
+        }
+#endif
+
+    if (!(m_build_time > 0) || !(m_pair_time > 0))
+        return;
+
+    // assume one build when there were none, which bounds the buffer from above
+    const double build_rate = std::max(m_build_rate, 1.0 / n_steps);
+    const Scalar r_buff = m_nlist->getRBuff();
+    const Scalar r_opt = findOptimalBuffer(r_buff, build_rate);
+    const Scalar r_new = std::clamp(r_buff + Scalar(0.5) * (r_opt - r_buff),
+                                    m_minimum_buffer,
+                                    m_maximum_buffer);
+    if (std::abs(r_new - r_buff) > Scalar(0.01) * r_buff)
+        {
+        m_exec_conf->msg->notice(6) << "NeighborListBufferTuner: buffer " << r_buff << " -> "
+                                    << r_new << std::endl;
+        m_nlist->setRBuff(r_new);
+        }
+    }
+
+/*! \param timer Timer to read
+    \param use_gpu If true, read the GPU times
+    \returns The state of the timer
+*/
+NeighborListBufferTuner::TimerState NeighborListBufferTuner::readTimer(OperationTimer& timer,
+                                                                       bool use_gpu) const
+    {
+    TimerState state;
+    state.num_calls = timer.getNumCalls();
+    if (use_gpu)
+        {
+        state.num_samples = timer.getNumGPUSamples();
+        state.total = timer.getGPUTotal();
+        }
+    else
+        {
+        state.num_samples = state.num_calls;
+        state.total = timer.getTotal();
+        }
+    return state;
+    }
+
+/*! \param use_gpu If true, read the GPU times
+    \param timestep Current time step
+*/
+void NeighborListBufferTuner::storeTimers(bool use_gpu, uint64_t timestep)
+    {
+    m_nlist_state = readTimer(m_nlist->getTimer(), use_gpu);
+    m_force_states.resize(m_forces.size());
+    for (unsigned int i = 0; i < m_forces.size(); ++i)
+        {
+        m_force_states[i] = readTimer(m_forces[i]->getTimer(), use_gpu);
+        }
+    m_last_timestep = timestep;
+    m_has_state = true;
+    }
+
+/*! \param r_buff Current buffer
+    \param build_rate Number of builds per step at \a r_buff
+    \returns The buffer in [minimum_buffer, maximum_buffer] that minimizes the modeled cost
+
+    The modeled cost per step is \f$ a (r_c + x)^d + b / x \f$, where \a a is fit to the force time
+    and \a b is fit to the build time times the build rate at \a r_buff. The cost is convex, so its
+    derivative is bisected.
+*/
+Scalar NeighborListBufferTuner::findOptimalBuffer(Scalar r_buff, double build_rate) const
+    {
+    const double dim = m_sysdef->getNDimensions();
+    const double r_cut = m_nlist->getMaxRCut();
+
+    // a buffer of zero rebuilds every step, so fit as if it were small instead
+    const double r = std::max(double(r_buff), 1e-3 * std::max(r_cut, 1.0));
+    const double a = m_pair_time / std::pow(r_cut + r, dim);
+    const double b = m_build_time * build_rate * r;
+
+    auto derivative = [&](double x)
+    {
+        if (x <= 0)
+            return -std::numeric_limits<double>::infinity();
+        return dim * a * std::pow(r_cut + x, dim - 1) - b / (x * x);
+    };
+
+    double lo = m_minimum_buffer;
+    double hi = m_maximum_buffer;
+    if (derivative(lo) >= 0)
+        return Scalar(lo);
+    if (derivative(hi) <= 0)
+        return Scalar(hi);
+    for (unsigned int i = 0; i < 64; ++i)
+        {
+        const double mid = 0.5 * (lo + hi);
+        if (derivative(mid) < 0)
+            lo = mid;
+        else
+            hi = mid;
+        }
+    return Scalar(0.5 * (lo + hi));
+    }
+
+namespace detail
+    {
+void export_NeighborListBufferTuner(pybind11::module& m)
+    {
+    pybind11::class_<NeighborListBufferTuner, Tuner, std::shared_ptr<NeighborListBufferTuner>>(
+        m,
+        "NeighborListBufferTuner")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<NeighborList>,
+                            std::vector<std::shared_ptr<ForceCompute>>,
+                            Scalar,
+                            Scalar>())
+        .def_property("minimum_buffer",
+                      &NeighborListBufferTuner::getMinimumBuffer,
+                      &NeighborListBufferTuner::setMinimumBuffer)
+        .def_property("maximum_buffer",
+                      &NeighborListBufferTuner::getMaximumBuffer,
+                      &NeighborListBufferTuner::setMaximumBuffer)
+        .def_property_readonly("build_time", &NeighborListBufferTuner::getBuildTime)
+        .def_property_readonly("pair_time", &NeighborListBufferTuner::getPairTime)
+        .def_property_readonly("build_rate", &NeighborListBufferTuner::getBuildRate);
+    }
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
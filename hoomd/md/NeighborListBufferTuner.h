@@ -0,0 +1,142 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file NeighborListBufferTuner.h
+    \brief Declares the NeighborListBufferTuner class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#ifndef __NEIGHBOR_LIST_BUFFER_TUNER_H__
+#define __NEIGHBOR_LIST_BUFFER_TUNER_H__
+
+#include "NeighborList.h"
+#include "hoomd/ForceCompute.h"
+#include "hoomd/Tuner.h"
+
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <vector>
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Adjusts the neighbor list buffer to minimize the cost of the forces that use it
+/*! The timers of the neighbor list and of the forces that use it are read every time the tuner
+    runs. Over that interval, they give the time per neighbor list build, the number of builds per
+    step, and the time per step that the forces spend outside of the builds. The GPU times are used
+    when GPU operation timing is enabled, otherwise the wall clock times are used.
+
+    The force time is modeled as proportional to the volume of the search sphere, (r_cut + r_buff)^d
+    in d dimensions, and the number of builds per step is modeled as inversely proportional to
+    r_buff, which holds while the particles move ballistically between builds. Both constants are
+    refit from every interval, and r_buff is moved halfway toward the minimum of the modeled cost
+    per step. It is only changed when it moves by more than 1%, because every change forces a
+    build.
+
+    If there are no builds in an interval, one build is assumed, which overestimates their cost and
+    lowers r_buff until builds are observed again.
+
+    In MPI simulations, the slowest rank sets the cost so that all ranks choose the same r_buff.
+
+    \ingroup tuners
+*/
+class PYBIND11_EXPORT NeighborListBufferTuner : public Tuner
+    {
+    public:
+    //! Constructor
+    NeighborListBufferTuner(std::shared_ptr<SystemDefinition> sysdef,
+                            std::shared_ptr<Trigger> trigger,
+                            std::shared_ptr<NeighborList> nlist,
+                            std::vector<std::shared_ptr<ForceCompute>> forces,
+                            Scalar minimum_buffer,
+                            Scalar maximum_buffer);
+
+    //! Destructor
+    virtual ~NeighborListBufferTuner();
+
+    //! Adjust the buffer
+    virtual void update(uint64_t timestep);
+
+    //! Get the smallest buffer to set
+    Scalar getMinimumBuffer() const
+        {
+        return m_minimum_buffer;
+        }
+
+    //! Set the smallest buffer to set
+    void setMinimumBuffer(Scalar minimum_buffer);
+
+    //! Get the largest buffer to set
+    Scalar getMaximumBuffer() const
+        {
+        return m_maximum_buffer;
+        }
+
+    //! Set the largest buffer to set
+    void setMaximumBuffer(Scalar maximum_buffer);
+
+    //! Get the time per neighbor list build in the last interval (in seconds)
+    double getBuildTime() const
+        {
+        return m_build_time;
+        }
+
+    //! Get the time per step of the forces outside of the builds in the last interval (in seconds)
+    double getPairTime() const
+        {
+        return m_pair_time;
+        }
+
+    //! Get the number of neighbor list builds per step in the last interval
+    double getBuildRate() const
+        {
+        return m_build_rate;
+        }
+
+    private:
+    //! State of an OperationTimer at the last update
+    struct TimerState
+        {
+        uint64_t num_calls = 0;   //!< Number of calls
+        uint64_t num_samples = 0; //!< Number of timed calls
+        double total = 0;         //!< Total time of the timed calls
+        };
+
+    std::shared_ptr<NeighborList> m_nlist;               //!< Neighbor list to tune
+    std::vector<std::shared_ptr<ForceCompute>> m_forces; //!< Forces that use the neighbor list
+    Scalar m_minimum_buffer;                             //!< Smallest buffer to set
+    Scalar m_maximum_buffer;                             //!< Largest buffer to set
+
+    bool m_has_state;                       //!< True once the timers have been read
+    uint64_t m_last_timestep;               //!< Timestep of the last update
+    TimerState m_nlist_state;               //!< State of the neighbor list timer
+    std::vector<TimerState> m_force_states; //!< State of the force timers
+
+    double m_build_time; //!< Time per build in the last interval
+    double m_pair_time;  //!< Time per step of the forces outside of the builds
+    double m_build_rate; //!< Number of builds per step in the last interval
+
+    //! Read the state of a timer
+    TimerState readTimer(OperationTimer& timer, bool use_gpu) const;
+
+    //! Store the state of all timers
+    void storeTimers(bool use_gpu, uint64_t timestep);
+
+    //! Find the buffer that minimizes the modeled cost per step
+    Scalar findOptimalBuffer(Scalar r_buff, double build_rate) const;
+    };
+
+namespace detail
+    {
+//! Export the NeighborListBufferTuner class to python
+void export_NeighborListBufferTuner(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __NEIGHBOR_LIST_BUFFER_TUNER_H__
@@ -0,0 +1,150 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file NeighborListCluster.cc
+    \brief Defines NeighborListCluster
+*/
+
+#include "NeighborListCluster.h"
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+NeighborListCluster::NeighborListCluster(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff)
+    : NeighborListBinned(sysdef, r_buff)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing NeighborListCluster" << endl;
+    }
+
+NeighborListCluster::~NeighborListCluster()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying NeighborListCluster" << endl;
+    }
+
+void NeighborListCluster::setLastUpdatedPos()
+    {
+    NeighborListBinned::setLastUpdatedPos();
+    buildClusters();
+    }
+
+/*! A partial rebuild changes some rows of the list without going through setLastUpdatedPos, so
+    the cluster pairs are rebuilt after it too.
+*/
+bool NeighborListCluster::distanceCheck(uint64_t timestep)
+    {
+    const uint64_t partial_builds = m_partial_builds;
+    const bool result = NeighborListBinned::distanceCheck(timestep);
+    if (!result && m_partial_builds != partial_builds)
+        buildClusters();
+    return result;
+    }
+
+/*! The particles in each cell of the last cell list build are split into consecutive clusters,
+    which keeps the members of a cluster close together. (After a partial rebuild, the cell list is
+    slightly out of date, but the cluster pairs are still exact because they come from the list.)
+    The mask of each cluster pair is then set from the neighbors of the particles in the i-cluster.
+*/
+void NeighborListCluster::buildClusters()
+    {
+    const unsigned int N = m_pdata->getN();
+    const unsigned int N_total = N + m_pdata->getNGhosts();
+
+    // group the particles in each cell into clusters
+        {
+        ArrayHandle<unsigned int> h_cell_size(m_cl->getCellSizeArray(),
+                                              access_location::host,
+                                              access_mode::read);
+        ArrayHandle<Scalar4> h_cell_xyzf(m_cl->getXYZFArray(),
+                                         access_location::host,
+                                         access_mode::read);
+        const Index3D ci = m_cl->getCellIndexer();
+        const Index2D cli = m_cl->getCellListIndexer();
+
+        m_cluster_members.clear();
+        m_cluster_slot.assign(N_total, NO_PARTICLE);
+        for (unsigned int cell = 0; cell < ci.getNumElements(); ++cell)
+            {
+            const unsigned int size = h_cell_size.data[cell];
+            for (unsigned int offset = 0; offset < size; ++offset)
+                {
+                if (offset % cluster_size == 0)
+                    m_cluster_members.resize(m_cluster_members.size() + cluster_size, NO_PARTICLE);
+
+                const unsigned int idx = __scalar_as_int(h_cell_xyzf.data[cli(offset, cell)].w);
+                const unsigned int slot
+                    = static_cast<unsigned int>(m_cluster_members.size()) - cluster_size
+                      + offset % cluster_size;
+                m_cluster_members[slot] = idx;
+                m_cluster_slot[idx] = slot;
+                }
+            }
+        }
+
+    // convert the neighbors of the particles in each cluster into cluster pairs
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
+
+    const unsigned int n_clusters = getNumClusters();
+    m_i_clusters.clear();
+    m_cluster_head.clear();
+    m_cluster_pairs.clear();
+    m_pair_idx.assign(n_clusters, NO_PARTICLE);
+    for (unsigned int cluster_i = 0; cluster_i < n_clusters; ++cluster_i)
+        {
+        const size_t first_pair = m_cluster_pairs.size();
+        bool has_local = false;
+        for (unsigned int a = 0; a < cluster_size; ++a)
+            {
+            const unsigned int i = m_cluster_members[cluster_i * cluster_size + a];
+            if (i == NO_PARTICLE || i >= N)
+                continue;
+            has_local = true;
+
+            const size_t head_i = h_head_list.data[i];
+            for (unsigned int k = 0; k < h_n_neigh.data[i]; ++k)
+                {
+                const unsigned int slot = m_cluster_slot[h_nlist.data[head_i + k]];
+                assert(slot != NO_PARTICLE);
+                const unsigned int cluster_j = slot / cluster_size;
+                if (m_pair_idx[cluster_j] == NO_PARTICLE)
+                    {
+                    m_pair_idx[cluster_j] = static_cast<unsigned int>(m_cluster_pairs.size());
+                    m_cluster_pairs.push_back(ClusterPair {cluster_j, 0});
+                    }
+                m_cluster_pairs[m_pair_idx[cluster_j]].mask
+                    |= 1u << (a * cluster_size + slot % cluster_size);
+                }
+            }
+
+        // reset the scratch indexes of the j-clusters of this i-cluster
+        for (size_t p = first_pair; p < m_cluster_pairs.size(); ++p)
+            m_pair_idx[m_cluster_pairs[p].cluster] = NO_PARTICLE;
+
+        if (has_local)
+            {
+            m_i_clusters.push_back(cluster_i);
+            m_cluster_head.push_back(first_pair);
+            }
+        }
+    m_cluster_head.push_back(m_cluster_pairs.size());
+    }
+
+namespace detail
+    {
+void export_NeighborListCluster(pybind11::module& m)
+    {
+    pybind11::class_<NeighborListCluster,
+                     NeighborListBinned,
+                     std::shared_ptr<NeighborListCluster>>(m, "NeighborListCluster")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
+        .def("getNumClusters", &NeighborListCluster::getNumClusters)
+        .def("getNumClusterPairs", &NeighborListCluster::getNumClusterPairs);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,123 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "NeighborListBinned.h"
+
+#include <vector>
+
+/*! \file NeighborListCluster.h
+    \brief Declares the NeighborListCluster class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __NEIGHBORLISTCLUSTER_H__
+#define __NEIGHBORLISTCLUSTER_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Neighbor list on the CPU that also groups the neighbors into cluster pairs
+/*! The per-particle neighbor list is built in the same way as NeighborListBinned, so that any
+    compute can use it. After each build, the particles (including ghosts) in each cell of the
+    cell list are additionally grouped into clusters of cluster_size particles, and the neighbor
+    list is converted into a list of cluster pairs. Each pair of an i-cluster and a j-cluster has a
+    mask with bit (a * cluster_size + b) set if particle b of the j-cluster is in the neighbor list
+    of particle a of the i-cluster. Self pairs, exclusions, and skipped type pairs are therefore
+    already masked out.
+
+    PotentialPair uses the cluster pairs when the list is in full storage mode. The positions of
+    the particles in each cluster are gathered into contiguous arrays once per force evaluation,
+    and each cluster pair is then evaluated as a cluster_size x cluster_size block with fixed
+    trip counts (see PotentialPair::computeForcesClusters). The cluster size matches the number of
+    double precision lanes in a 256-bit SIMD register.
+
+    Only i-clusters that contain at least one local particle are stored.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT NeighborListCluster : public NeighborListBinned
+    {
+    public:
+    //! Number of particles in a cluster
+    static constexpr unsigned int cluster_size = 4;
+
+    //! Marks an empty slot in a cluster
+    static constexpr unsigned int NO_PARTICLE = 0xffffffff;
+
+    //! A j-cluster and the mask of the pairs it forms with an i-cluster
+    struct ClusterPair
+        {
+        unsigned int cluster; //!< Index of the j-cluster
+        unsigned int mask;    //!< Bit (a * cluster_size + b) is set if (a, b) are neighbors
+        };
+
+    //! Constructs the compute
+    NeighborListCluster(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff);
+
+    //! Destructor
+    virtual ~NeighborListCluster();
+
+    /// Get the number of clusters
+    unsigned int getNumClusters() const
+        {
+        return static_cast<unsigned int>(m_cluster_members.size() / cluster_size);
+        }
+
+    /// Get the particles in each cluster (cluster_size per cluster, padded with NO_PARTICLE)
+    const std::vector<unsigned int>& getClusterMembers() const
+        {
+        return m_cluster_members;
+        }
+
+    /// Get the clusters that contain local particles
+    const std::vector<unsigned int>& getIClusters() const
+        {
+        return m_i_clusters;
+        }
+
+    /// Get the first cluster pair of each i-cluster (one extra element marks the end)
+    const std::vector<size_t>& getClusterHead() const
+        {
+        return m_cluster_head;
+        }
+
+    /// Get the cluster pairs
+    const std::vector<ClusterPair>& getClusterPairs() const
+        {
+        return m_cluster_pairs;
+        }
+
+    /// Get the number of cluster pairs
+    unsigned int getNumClusterPairs() const
+        {
+        return static_cast<unsigned int>(m_cluster_pairs.size());
+        }
+
+    protected:
+    std::vector<unsigned int> m_cluster_members; //!< Particles in each cluster
+    std::vector<unsigned int> m_cluster_slot;    //!< Cluster and lane of each particle
+    std::vector<unsigned int> m_i_clusters;      //!< Clusters that contain local particles
+    std::vector<size_t> m_cluster_head;          //!< First cluster pair of each i-cluster
+    std::vector<ClusterPair> m_cluster_pairs;    //!< Cluster pairs
+    std::vector<unsigned int> m_pair_idx;        //!< Scratch index of a j-cluster in the pairs
+
+    //! Store the positions at the last build and convert the list into cluster pairs
+    virtual void setLastUpdatedPos();
+
+    //! Check if the list needs to be rebuilt, and convert partial rebuilds into cluster pairs
+    virtual bool distanceCheck(uint64_t timestep);
+
+    //! Group the particles into clusters and build the cluster pairs from the neighbor list
+    void buildClusters();
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -149,12 +149,23 @@ void NeighborListGPU::updateExListIdx()
                                             access_location::device,
                                             access_mode::overwrite);
 
+    if (m_ex_mask_idx.getNumElements() < m_n_ex_idx.getNumElements())
+        {
+        GlobalArray<unsigned int> ex_mask_idx(m_n_ex_idx.getNumElements(), m_exec_conf);
+        m_ex_mask_idx.swap(ex_mask_idx);
+        TAG_ALLOCATION(m_ex_mask_idx);
+        }
+    ArrayHandle<unsigned int> d_ex_mask_idx(m_ex_mask_idx,
+                                            access_location::device,
+                                            access_mode::overwrite);
+
     kernel::gpu_update_exclusion_list(d_tag.data,
                                       d_rtag.data,
                                       d_n_ex_tag.data,
                                       d_ex_list_tag.data,
                                       m_ex_list_indexer_tag,
                                       d_n_ex_idx.data,
+                                      d_ex_mask_idx.data,
                                       d_ex_list_idx.data,
                                       m_ex_list_indexer,
                                       m_pdata->getN());
@@ -220,6 +231,59 @@ void NeighborListGPU::buildHeadList()
     updateMemoryMapping();
     }
 
+void NeighborListGPU::buildInteriorPartition()
+    {
+    const unsigned int N = m_pdata->getN();
+    if (!N)
+        {
+        m_n_interior = 0;
+        return;
+        }
+
+    ArrayHandle<unsigned int> d_n_neigh(m_n_neigh, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_nlist(m_nlist, access_location::device, access_mode::read);
+    ArrayHandle<size_t> d_head_list(m_head_list, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_interior_partition(m_interior_partition,
+                                                   access_location::device,
+                                                   access_mode::overwrite);
+
+    ScopedAllocation<unsigned char> d_interior(m_exec_conf->getCachedAllocator(), N);
+    ScopedAllocation<unsigned int> d_n_interior(m_exec_conf->getCachedAllocator(), 1);
+
+    // Hard code block size of 128. This kernel is called once per build.
+    kernel::gpu_nlist_flag_interior(d_interior(),
+                                    d_n_neigh.data,
+                                    d_nlist.data,
+                                    d_head_list.data,
+                                    N,
+                                    128);
+
+    // size temporary storage
+    void* d_tmp = NULL;
+    size_t tmp_bytes = 0;
+    kernel::gpu_nlist_partition_interior(d_tmp,
+                                         tmp_bytes,
+                                         d_interior(),
+                                         d_interior_partition.data,
+                                         d_n_interior(),
+                                         N);
+
+    // partition the particles
+    ScopedAllocation<unsigned char> d_tmp_alloc(m_exec_conf->getCachedAllocator(),
+                                                (tmp_bytes > 0) ? tmp_bytes : 1);
+    d_tmp = (void*)d_tmp_alloc();
+    kernel::gpu_nlist_partition_interior(d_tmp,
+                                         tmp_bytes,
+                                         d_interior(),
+                                         d_interior_partition.data,
+                                         d_n_interior(),
+                                         N);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+
+    hipMemcpy(&m_n_interior, d_n_interior(), sizeof(unsigned int), hipMemcpyDeviceToHost);
+    }
+
 namespace detail
     {
 void export_NeighborListGPU(pybind11::module& m)
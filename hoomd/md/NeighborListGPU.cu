@@ -13,6 +13,7 @@
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
+#include <hipcub/hipcub.hpp>
 #include <thrust/device_ptr.h>
 #include <thrust/scan.h>
 #pragma GCC diagnostic pop
@@ -273,6 +274,7 @@ __global__ void gpu_update_exclusion_list_kernel(const unsigned int* tags,
                                                  const unsigned int* ex_list_tag,
                                                  const Index2D ex_list_tag_indexer,
                                                  unsigned int* n_ex_idx,
+                                                 unsigned int* ex_mask_idx,
                                                  unsigned int* ex_list_idx,
                                                  const Index2D ex_list_indexer,
                                                  const unsigned int N)
@@ -289,13 +291,16 @@ __global__ void gpu_update_exclusion_list_kernel(const unsigned int* tags,
     // copy over number of exclusions
     n_ex_idx[idx] = n;
 
+    unsigned int mask = 0;
     for (unsigned int offset = 0; offset < n; offset++)
         {
         unsigned int ex_tag = ex_list_tag[ex_list_tag_indexer(tag, offset)];
         unsigned int ex_idx = rtags[ex_tag];
 
         ex_list_idx[ex_list_indexer(idx, offset)] = ex_idx;
+        mask |= nlist_exclusions_t::bit(ex_idx);
         }
+    ex_mask_idx[idx] = mask;
     }
 
 //! GPU function to update the exclusion list on the device
@@ -305,6 +310,7 @@ __global__ void gpu_update_exclusion_list_kernel(const unsigned int* tags,
     \param d_ex_list_tag 2D Exclusion list per tag
     \param ex_list_tag_indexer Indexer for per-tag exclusion list
     \param d_n_ex_idx List of number of exclusions per idx
+    \param d_ex_mask_idx Hashed bits of the excluded indices per idx (see nlist_exclusions_t)
     \param d_ex_list_idx Exclusion list per idx
     \param ex_list_indexer Indexer for per-idx exclusion list
     \param N number of particles
@@ -315,6 +321,7 @@ hipError_t gpu_update_exclusion_list(const unsigned int* d_tag,
                                      const unsigned int* d_ex_list_tag,
                                      const Index2D& ex_list_tag_indexer,
                                      unsigned int* d_n_ex_idx,
+                                     unsigned int* d_ex_mask_idx,
                                      unsigned int* d_ex_list_idx,
                                      const Index2D& ex_list_indexer,
                                      const unsigned int N)
@@ -332,6 +339,7 @@ hipError_t gpu_update_exclusion_list(const unsigned int* d_tag,
                        d_ex_list_tag,
                        ex_list_tag_indexer,
                        d_n_ex_idx,
+                       d_ex_mask_idx,
                        d_ex_list_idx,
                        ex_list_indexer,
                        N);
@@ -455,6 +463,112 @@ hipError_t gpu_nlist_build_head_list(size_t* d_head_list,
     return hipSuccess;
     }
 
+/*!
+ * \param d_interior Flag set to 1 for interior particles and 0 for boundary particles
+ * \param d_n_neigh Number of neighbors of each particle
+ * \param d_nlist Neighbor list
+ * \param d_head_list Indexes for reading \a d_nlist
+ * \param N Number of particles on this rank
+ *
+ * A particle is in the interior when none of its neighbors is a ghost particle (index >= N).
+ */
+__global__ void gpu_nlist_flag_interior_kernel(unsigned char* d_interior,
+                                               const unsigned int* d_n_neigh,
+                                               const unsigned int* d_nlist,
+                                               const size_t* d_head_list,
+                                               const unsigned int N)
+    {
+    // particle index
+    const unsigned int idx = blockDim.x * blockIdx.x + threadIdx.x;
+
+    // one thread per particle
+    if (idx >= N)
+        return;
+
+    const unsigned int n_neigh = d_n_neigh[idx];
+    const size_t head = d_head_list[idx];
+    unsigned char interior = 1;
+    for (unsigned int k = 0; k < n_neigh && interior; ++k)
+        {
+        if (__ldg(d_nlist + head + k) >= N)
+            interior = 0;
+        }
+
+    d_interior[idx] = interior;
+    }
+
+/*!
+ * \param d_interior Flag set to 1 for interior particles and 0 for boundary particles
+ * \param d_n_neigh Number of neighbors of each particle
+ * \param d_nlist Neighbor list
+ * \param d_head_list Indexes for reading \a d_nlist
+ * \param N Number of particles on this rank
+ * \param block_size Number of threads per block
+ *
+ * \return hipSuccess on completion
+ */
+hipError_t gpu_nlist_flag_interior(unsigned char* d_interior,
+                                   const unsigned int* d_n_neigh,
+                                   const unsigned int* d_nlist,
+                                   const size_t* d_head_list,
+                                   const unsigned int N,
+                                   const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_nlist_flag_interior_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+
+    hipLaunchKernelGGL((gpu_nlist_flag_interior_kernel),
+                       dim3(N / run_block_size + 1),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_interior,
+                       d_n_neigh,
+                       d_nlist,
+                       d_head_list,
+                       N);
+
+    return hipSuccess;
+    }
+
+/*!
+ * \param d_tmp Temporary storage
+ * \param tmp_bytes Number of bytes in temporary storage
+ * \param d_interior Flags set to 1 for interior particles and 0 for boundary particles
+ * \param d_interior_partition Partitioned indexes of interior (first) and boundary (last) particles
+ * \param d_n_interior Number of interior particles
+ * \param N Number of particles on this rank
+ *
+ * \return hipSuccess on completion
+ *
+ * \b Implementation
+ * This is a wrapper to hipcub::DevicePartition::Flagged, and as such requires two calls. The first
+ * call sizes the temporary storage in \a tmp_bytes. The second call partitions the particle
+ * indexes, with the interior particles first (in their original order) and the boundary particles
+ * in reverse order at the end of the array.
+ */
+hipError_t gpu_nlist_partition_interior(void* d_tmp,
+                                        size_t& tmp_bytes,
+                                        const unsigned char* d_interior,
+                                        unsigned int* d_interior_partition,
+                                        unsigned int* d_n_interior,
+                                        const unsigned int N)
+    {
+    hipcub::CountingInputIterator<unsigned int> ids(0);
+    hipcub::DevicePartition::Flagged(d_tmp,
+                                     tmp_bytes,
+                                     ids,
+                                     d_interior,
+                                     d_interior_partition,
+                                     d_n_interior,
+                                     N);
+    return hipSuccess;
+    }
+
     } // end namespace kernel
     } // end namespace md
     } // end namespace hoomd
@@ -21,6 +21,42 @@ namespace md
     {
 namespace kernel
     {
+//! Exclusions that the neighbor list build kernels skip
+/*! Each particle index has a 32-bit mask with one hashed bit set for every index that it excludes.
+    A pair is only looked up in the exclusion list when the bit of the neighbor is set in the mask,
+    so most pairs are accepted after a single load.
+*/
+struct nlist_exclusions_t
+    {
+    const unsigned int* d_n_ex;    //!< Number of exclusions per index (nullptr when there are none)
+    const unsigned int* d_ex_mask; //!< Hashed bits of the excluded indices per index
+    const unsigned int* d_ex_list; //!< Excluded indices per index
+    Index2D exli;                  //!< Indexer into d_ex_list
+
+#ifdef __HIPCC__
+    //! Get the bit of a particle index in the masks
+    __device__ static unsigned int bit(unsigned int idx)
+        {
+        return 1u << ((idx * 2654435761u) >> 27);
+        }
+
+    //! Test if particle \a i excludes particle \a j
+    __device__ bool isExcluded(unsigned int i, unsigned int j) const
+        {
+        if (!d_n_ex || !(__ldg(d_ex_mask + i) & bit(j)))
+            return false;
+
+        const unsigned int n_ex = __ldg(d_n_ex + i);
+        for (unsigned int k = 0; k < n_ex; ++k)
+            {
+            if (__ldg(d_ex_list + exli(i, k)) == j)
+                return true;
+            }
+        return false;
+        }
+#endif
+    };
+
 //! Kernel driver for gpu_nlist_needs_update_check_new_kernel()
 hipError_t gpu_nlist_needs_update_check_new(unsigned int* d_result,
                                             const Scalar4* d_last_pos,
@@ -61,10 +97,27 @@ hipError_t gpu_update_exclusion_list(const unsigned int* d_tag,
                                      const unsigned int* d_ex_list_tag,
                                      const Index2D& ex_list_tag_indexer,
                                      unsigned int* d_n_ex_idx,
+                                     unsigned int* d_ex_mask_idx,
                                      unsigned int* d_ex_list_idx,
                                      const Index2D& ex_list_indexer,
                                      const unsigned int N);
 
+//! Kernel driver for gpu_nlist_flag_interior_kernel()
+hipError_t gpu_nlist_flag_interior(unsigned char* d_interior,
+                                   const unsigned int* d_n_neigh,
+                                   const unsigned int* d_nlist,
+                                   const size_t* d_head_list,
+                                   const unsigned int N,
+                                   const unsigned int block_size);
+
+//! Partition the particle indexes into interior and boundary particles
+hipError_t gpu_nlist_partition_interior(void* d_tmp,
+                                        size_t& tmp_bytes,
+                                        const unsigned char* d_interior,
+                                        unsigned int* d_interior_partition,
+                                        unsigned int* d_n_interior,
+                                        const unsigned int N);
+
     } // end namespace kernel
     } // end namespace md
     } // end namespace hoomd
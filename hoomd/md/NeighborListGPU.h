@@ -102,6 +102,8 @@ class PYBIND11_EXPORT NeighborListGPU : public NeighborList
 
     GlobalArray<size_t> m_req_size_nlist; //!< Flag to hold the required size of the neighborlist
 
+    GlobalArray<unsigned int> m_ex_mask_idx; //!< Hashed bits of the exclusions for each index
+
     //! Builds the neighbor list
     virtual void buildNlist(uint64_t timestep);
 
@@ -119,9 +121,32 @@ class PYBIND11_EXPORT NeighborListGPU : public NeighborList
     //! Filter the neighbor list of excluded particles
     virtual void filterNlist();
 
+    //! Get the exclusions for the build kernels
+    /*! \param d_n_ex_idx Number of exclusions per index on the device
+        \param d_ex_mask_idx Hashed bits of the exclusions per index on the device
+        \param d_ex_list_idx Exclusion list per index on the device
+        \returns Exclusions that are empty when none are set
+    */
+    kernel::nlist_exclusions_t getBuildExclusions(const ArrayHandle<unsigned int>& d_n_ex_idx,
+                                                  const ArrayHandle<unsigned int>& d_ex_mask_idx,
+                                                  const ArrayHandle<unsigned int>& d_ex_list_idx)
+        {
+        kernel::nlist_exclusions_t ex;
+        const bool use_ex
+            = m_exclusions_set && m_ex_mask_idx.getNumElements() >= m_pdata->getN();
+        ex.d_n_ex = use_ex ? d_n_ex_idx.data : nullptr;
+        ex.d_ex_mask = d_ex_mask_idx.data;
+        ex.d_ex_list = d_ex_list_idx.data;
+        ex.exli = m_ex_list_indexer;
+        return ex;
+        }
+
     //! Build the head list for neighbor list indexing on the GPU
     virtual void buildHeadList();
 
+    //! Partition the local particles into interior and boundary particles on the GPU
+    virtual void buildInteriorPartition();
+
     //! Schedule the distance check kernel
     /*! \param timestep Current time step
      */
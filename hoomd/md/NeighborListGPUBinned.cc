@@ -33,6 +33,9 @@ NeighborListGPUBinned::NeighborListGPUBinned(std::shared_ptr<SystemDefinition> s
     m_cl->setComputeTypeBody(!m_use_index);
     m_cl->setFlagIndex();
 
+    // excluded pairs are skipped in the build kernel
+    m_filter_exclusions_in_build = true;
+
     CHECK_CUDA_ERROR();
 
     // Initialize autotuner.
@@ -116,6 +119,14 @@ void NeighborListGPUBinned::buildNlist(uint64_t timestep)
     ArrayHandle<Scalar> d_r_cut(m_r_cut, access_location::device, access_mode::read);
     ArrayHandle<Scalar> d_r_listsq(m_r_listsq, access_location::device, access_mode::read);
 
+    ArrayHandle<unsigned int> d_n_ex_idx(m_n_ex_idx, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_ex_mask_idx(m_ex_mask_idx,
+                                            access_location::device,
+                                            access_mode::read);
+    ArrayHandle<unsigned int> d_ex_list_idx(m_ex_list_idx,
+                                            access_location::device,
+                                            access_mode::read);
+
 #ifdef __HIP_PLATFORM_NVCC__
     auto& gpu_map = m_exec_conf->getGPUIds();
 
@@ -170,6 +181,7 @@ void NeighborListGPUBinned::buildNlist(uint64_t timestep)
         m_cl->getGhostWidth(),
         m_pdata->getGPUPartition(),
         m_use_index,
+        getBuildExclusions(d_n_ex_idx, d_ex_mask_idx, d_ex_list_idx),
         m_exec_conf->dev_prop);
 
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -193,7 +205,15 @@ void export_NeighborListGPUBinned(pybind11::module& m)
         .def("getDim",
              &NeighborListGPUBinned::getDim,
              pybind11::return_value_policy::reference_internal)
-        .def("getNmax", &NeighborListGPUBinned::getNmax);
+        .def("getNmax", &NeighborListGPUBinned::getNmax)
+        .def_property(
+            "partial_rebuild",
+            [](const NeighborListGPUBinned& self) { return false; },
+            [](NeighborListGPUBinned& self, bool partial_rebuild)
+            {
+                if (partial_rebuild)
+                    throw std::runtime_error("Partial neighbor list rebuilds require a CPU device.");
+            });
     }
 
     } // end namespace detail
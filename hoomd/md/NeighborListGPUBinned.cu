@@ -46,6 +46,8 @@ namespace kernel
     \param ghost_width Width of ghost cell layer
     \param offset Starting particle index
     \param nwork Number of particles to process
+    \param ngpu Number of active GPUs
+    \param ex Exclusions to skip
 
     \note optimized for Kepler
 */
@@ -77,7 +79,8 @@ __global__ void gpu_compute_nlist_binned_kernel(unsigned int* d_nlist,
                                                 const Scalar3 ghost_width,
                                                 const unsigned int offset,
                                                 const unsigned int nwork,
-                                                const unsigned int ngpu)
+                                                const unsigned int ngpu,
+                                                const nlist_exclusions_t ex)
     {
     // cache the r_listsq parameters into shared memory
     Index2D typpair_idx(ntypes);
@@ -257,7 +260,8 @@ __global__ void gpu_compute_nlist_binned_kernel(unsigned int* d_nlist,
                     excluded = excluded | (my_body == neigh_body);
 
                 // store result in shared memory
-                if (drsq <= r_list * r_list && !excluded)
+                if (drsq <= r_list * r_list && !excluded
+                    && !ex.isExcluded((unsigned int)my_pidx, (unsigned int)cur_neigh))
                     {
                     neighbor = cur_neigh;
                     has_neighbor = 1;
@@ -339,6 +343,7 @@ inline void launcher(unsigned int* d_nlist,
                      std::pair<unsigned int, unsigned int> range,
                      bool use_index,
                      const unsigned int ngpu,
+                     const nlist_exclusions_t ex,
                      const hipDeviceProp_t& devprop)
     {
     // shared memory = r_listsq + Nmax + stuff needed for neighborlist (computed below)
@@ -398,7 +403,8 @@ inline void launcher(unsigned int* d_nlist,
                                    ghost_width,
                                    offset,
                                    nwork,
-                                   ngpu);
+                                   ngpu,
+                                   ex);
                 }
             else if (filter_body && !enable_shared)
                 {
@@ -438,7 +444,8 @@ inline void launcher(unsigned int* d_nlist,
                                    ghost_width,
                                    offset,
                                    nwork,
-                                   ngpu);
+                                   ngpu,
+                                   ex);
                 }
             else if (!filter_body && enable_shared)
                 {
@@ -478,7 +485,8 @@ inline void launcher(unsigned int* d_nlist,
                                    ghost_width,
                                    offset,
                                    nwork,
-                                   ngpu);
+                                   ngpu,
+                                   ex);
                 }
             else if (filter_body && enable_shared)
                 {
@@ -518,7 +526,8 @@ inline void launcher(unsigned int* d_nlist,
                                    ghost_width,
                                    offset,
                                    nwork,
-                                   ngpu);
+                                   ngpu,
+                                   ex);
                 }
             }
         else // use_index
@@ -561,7 +570,8 @@ inline void launcher(unsigned int* d_nlist,
                                    ghost_width,
                                    offset,
                                    nwork,
-                                   ngpu);
+                                   ngpu,
+                                   ex);
                 }
             else if (filter_body && !enable_shared)
                 {
@@ -601,7 +611,8 @@ inline void launcher(unsigned int* d_nlist,
                                    ghost_width,
                                    offset,
                                    nwork,
-                                   ngpu);
+                                   ngpu,
+                                   ex);
                 }
             else if (!filter_body && enable_shared)
                 {
@@ -641,7 +652,8 @@ inline void launcher(unsigned int* d_nlist,
                                    ghost_width,
                                    offset,
                                    nwork,
-                                   ngpu);
+                                   ngpu,
+                                   ex);
                 }
             else if (filter_body && enable_shared)
                 {
@@ -681,7 +693,8 @@ inline void launcher(unsigned int* d_nlist,
                                    ghost_width,
                                    offset,
                                    nwork,
-                                   ngpu);
+                                   ngpu,
+                                   ex);
                 }
             }
         }
@@ -715,6 +728,7 @@ inline void launcher(unsigned int* d_nlist,
                               range,
                               use_index,
                               ngpu,
+                              ex,
                               devprop);
         }
     }
@@ -749,6 +763,7 @@ inline void launcher<min_threads_per_particle / 2>(unsigned int* d_nlist,
                                                    std::pair<unsigned int, unsigned int> range,
                                                    bool use_index,
                                                    const unsigned int ngpu,
+                                                   const nlist_exclusions_t ex,
                                                    const hipDeviceProp_t& devprop)
     {
     }
@@ -780,6 +795,7 @@ hipError_t gpu_compute_nlist_binned(unsigned int* d_nlist,
                                     const Scalar3& ghost_width,
                                     const GPUPartition& gpu_partition,
                                     bool use_index,
+                                    const nlist_exclusions_t& ex,
                                     const hipDeviceProp_t& devprop)
     {
     unsigned int ngpu = gpu_partition.getNumActiveGPUs();
@@ -817,6 +833,7 @@ hipError_t gpu_compute_nlist_binned(unsigned int* d_nlist,
                                            range,
                                            use_index,
                                            ngpu,
+                                           ex,
                                            devprop);
         }
     return hipSuccess;
@@ -11,6 +11,8 @@
 #include "hoomd/Index1D.h"
 #include "hoomd/ParticleData.cuh"
 
+#include "NeighborListGPU.cuh"
+
 /*! \file NeighborListGPUBinned.cuh
     \brief Declares GPU kernel code for neighbor list generation on the GPU
 */
@@ -59,6 +61,7 @@ hipError_t gpu_compute_nlist_binned(unsigned int* d_nlist,
                                     const Scalar3& ghost_width,
                                     const GPUPartition& gpu_partition,
                                     bool use_index,
+                                    const nlist_exclusions_t& ex,
                                     const hipDeviceProp_t& devprop);
 
     } // end namespace kernel
@@ -0,0 +1,398 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file NeighborListGPUHashed.cc
+    \brief Defines NeighborListGPUHashed
+*/
+
+#include "NeighborListGPUHashed.h"
+#include "NeighborListGPUHashed.cuh"
+
+#include <limits>
+
+namespace hoomd
+    {
+namespace md
+    {
+NeighborListGPUHashed::NeighborListGPUHashed(std::shared_ptr<SystemDefinition> sysdef,
+                                             Scalar r_buff)
+    : NeighborListGPU(sysdef, r_buff), m_table_size(0), m_quantization(0),
+      m_max_num_changed(true)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing NeighborListGPUHashed" << std::endl;
+    m_pdata->getMaxParticleNumberChangeSignal()
+        .connect<NeighborListGPUHashed, &NeighborListGPUHashed::slotMaxNumChanged>(this);
+
+    m_key_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                       m_exec_conf,
+                                       "nlist_hashed_key"));
+    m_table_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                         m_exec_conf,
+                                         "nlist_hashed_table"));
+    m_quantize_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                            m_exec_conf,
+                                            "nlist_hashed_quantize"));
+    m_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                   m_exec_conf,
+                                   "nlist_hashed"));
+    m_autotuners.insert(m_autotuners.end(),
+                        {m_key_tuner, m_table_tuner, m_quantize_tuner, m_tuner});
+    }
+
+NeighborListGPUHashed::~NeighborListGPUHashed()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying NeighborListGPUHashed" << std::endl;
+    m_pdata->getMaxParticleNumberChangeSignal()
+        .disconnect<NeighborListGPUHashed, &NeighborListGPUHashed::slotMaxNumChanged>(this);
+    }
+
+/*!
+ * \param bits Number of bits per quantized coordinate. 0 disables quantization.
+ */
+void NeighborListGPUHashed::setQuantization(unsigned int bits)
+    {
+    if (bits != 0 && bits != 16 && bits != 32)
+        {
+        m_exec_conf->msg->error() << "nlist.Hashed: quantization must be 0, 16, or 32 bits"
+                                  << std::endl;
+        throw std::runtime_error("Error setting neighbor list quantization");
+        }
+    if (bits != m_quantization)
+        {
+        m_quantization = bits;
+        forceUpdate();
+        }
+    }
+
+/*!
+ * The quantized coordinates are rounded down, so each coordinate is at most one quantum smaller
+ * in cell units. The largest error in a distance is the sum of those quanta along each lattice
+ * vector, plus a few units of rounding in the arithmetic, and the list radius is enlarged by it.
+ */
+void NeighborListGPUHashed::updateQuantizedListRadius()
+    {
+    const unsigned int ntypes = m_pdata->getNTypes();
+    if (m_r_listsq_quantized.getNumElements() != ntypes * ntypes)
+        {
+        GPUArray<Scalar> r_listsq_quantized(ntypes * ntypes, m_exec_conf);
+        m_r_listsq_quantized.swap(r_listsq_quantized);
+        }
+
+    const BoxDim& box = m_pdata->getBox();
+    const Scalar quantum = (m_quantization == 16) ? Scalar(1.0 / 65536.0)
+                                                  : Scalar(1.0 / 4294967296.0);
+    const Scalar tol = quantum + Scalar(8) * std::numeric_limits<Scalar>::epsilon();
+    const unsigned int dim[3] = {m_indexer.dim.x, m_indexer.dim.y, m_indexer.dim.z};
+    Scalar eps(0);
+    for (unsigned int k = 0; k < ((m_indexer.two_d) ? 2u : 3u); ++k)
+        {
+        const Scalar3 a = box.getLatticeVector(k);
+        eps += tol * slow::sqrt(dot(a, a)) / Scalar(dim[k]);
+        }
+
+    ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_listsq_quantized(m_r_listsq_quantized,
+                                             access_location::host,
+                                             access_mode::overwrite);
+    for (unsigned int i = 0; i < ntypes * ntypes; ++i)
+        {
+        const Scalar r_listsq = h_r_listsq.data[i];
+        if (r_listsq > Scalar(0))
+            {
+            const Scalar r_list = slow::sqrt(r_listsq) + eps;
+            h_r_listsq_quantized.data[i] = r_list * r_list;
+            }
+        else
+            {
+            h_r_listsq_quantized.data[i] = r_listsq;
+            }
+        }
+    }
+
+/*!
+ * The cell keys of the local and ghost particles are computed and radix sorted, the occupied
+ * cells are inserted into the hash table, and then the neighbor list is built. The cells are
+ * sized from the current cutoffs and box on every build since, unlike the full cell list, no
+ * storage depends on the number of cells.
+ */
+void NeighborListGPUHashed::buildNlist(uint64_t timestep)
+    {
+    if (m_storage_mode != full)
+        {
+        throw std::runtime_error("GPU neighbor lists require a full storage mode.");
+        }
+
+    // allocate memory that depends on the local number of particles
+    if (m_max_num_changed)
+        {
+        const unsigned int max_n = m_pdata->getMaxN();
+
+        GPUArray<uint64_t> keys(max_n, m_exec_conf);
+        m_keys.swap(keys);
+
+        GPUArray<uint64_t> sorted_keys(max_n, m_exec_conf);
+        m_sorted_keys.swap(sorted_keys);
+
+        GPUArray<unsigned int> indexes(max_n, m_exec_conf);
+        m_indexes.swap(indexes);
+
+        GPUArray<unsigned int> sorted_indexes(max_n, m_exec_conf);
+        m_sorted_indexes.swap(sorted_indexes);
+
+        m_table_size = HashedCellIndexer::getTableSize(max_n);
+        GPUArray<uint64_t> table_keys(m_table_size, m_exec_conf);
+        m_table_keys.swap(table_keys);
+
+        GPUArray<uint2> table_cells(m_table_size, m_exec_conf);
+        m_table_cells.swap(table_cells);
+
+        GPUArray<uint4> quantized(max_n, m_exec_conf);
+        m_quantized.swap(quantized);
+
+        m_max_num_changed = false;
+        }
+
+    const BoxDim& box = m_pdata->getBox();
+    m_indexer = HashedCellIndexer(box, getMaxRCut() + m_r_buff, m_sysdef->getNDimensions() == 2);
+    const unsigned int N = m_pdata->getN();
+    const unsigned int N_total = N + m_pdata->getNGhosts();
+
+    // distances can only be computed from the cell offsets if every neighboring cell is distinct
+    const bool quantize = (m_quantization > 0) && m_indexer.hasDistinctNeighbors();
+    if (quantize && m_quantization == 16 && m_pdata->getNTypes() > 0xffff)
+        {
+        m_exec_conf->msg->error() << "nlist.Hashed: 16 bit quantization supports at most 65535 "
+                                  << "particle types" << std::endl;
+        throw std::runtime_error("Error building neighbor list");
+        }
+
+    // compute the cell keys
+        {
+        ArrayHandle<uint64_t> d_keys(m_keys, access_location::device, access_mode::overwrite);
+        ArrayHandle<unsigned int> d_indexes(m_indexes,
+                                            access_location::device,
+                                            access_mode::overwrite);
+        ArrayHandle<Scalar4> d_last_pos(m_last_pos,
+                                        access_location::device,
+                                        access_mode::overwrite);
+        ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+
+        m_key_tuner->begin();
+        kernel::gpu_nlist_hashed_keys(d_keys.data,
+                                      d_indexes.data,
+                                      d_last_pos.data,
+                                      d_pos.data,
+                                      N,
+                                      m_pdata->getNGhosts(),
+                                      box,
+                                      m_indexer,
+                                      m_key_tuner->getParam()[0]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_key_tuner->end();
+        }
+
+    // sort the particles by key
+        {
+        uchar2 swap;
+            {
+            ArrayHandle<uint64_t> d_keys(m_keys, access_location::device, access_mode::readwrite);
+            ArrayHandle<uint64_t> d_sorted_keys(m_sorted_keys,
+                                                access_location::device,
+                                                access_mode::overwrite);
+            ArrayHandle<unsigned int> d_indexes(m_indexes,
+                                                access_location::device,
+                                                access_mode::readwrite);
+            ArrayHandle<unsigned int> d_sorted_indexes(m_sorted_indexes,
+                                                       access_location::device,
+                                                       access_mode::overwrite);
+
+            void* d_tmp = NULL;
+            size_t tmp_bytes = 0;
+            kernel::gpu_nlist_hashed_sort(d_tmp,
+                                          tmp_bytes,
+                                          d_keys.data,
+                                          d_sorted_keys.data,
+                                          d_indexes.data,
+                                          d_sorted_indexes.data,
+                                          N_total);
+
+            // make requested temporary allocation (1 char = 1B)
+            size_t alloc_size = (tmp_bytes > 0) ? tmp_bytes : 4;
+            ScopedAllocation<unsigned char> d_alloc(m_exec_conf->getCachedAllocator(), alloc_size);
+            d_tmp = (void*)d_alloc();
+
+            // perform the sort
+            swap = kernel::gpu_nlist_hashed_sort(d_tmp,
+                                                 tmp_bytes,
+                                                 d_keys.data,
+                                                 d_sorted_keys.data,
+                                                 d_indexes.data,
+                                                 d_sorted_indexes.data,
+                                                 N_total);
+            if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            }
+        if (swap.x)
+            m_sorted_keys.swap(m_keys);
+        if (swap.y)
+            m_sorted_indexes.swap(m_indexes);
+        }
+
+    // insert the occupied cells into the hash table
+        {
+        ArrayHandle<uint64_t> d_table_keys(m_table_keys,
+                                           access_location::device,
+                                           access_mode::overwrite);
+        ArrayHandle<uint2> d_table_cells(m_table_cells,
+                                         access_location::device,
+                                         access_mode::overwrite);
+        ArrayHandle<uint64_t> d_sorted_keys(m_sorted_keys,
+                                            access_location::device,
+                                            access_mode::read);
+
+        m_table_tuner->begin();
+        kernel::gpu_nlist_hashed_fill_table(d_table_keys.data,
+                                            d_table_cells.data,
+                                            d_sorted_keys.data,
+                                            N_total,
+                                            m_table_size,
+                                            m_table_tuner->getParam()[0]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_table_tuner->end();
+        }
+
+    // store the quantized coordinates in the sorted order
+    if (quantize)
+        {
+        ArrayHandle<uint4> d_quantized(m_quantized,
+                                       access_location::device,
+                                       access_mode::overwrite);
+        ArrayHandle<unsigned int> d_sorted_indexes(m_sorted_indexes,
+                                                   access_location::device,
+                                                   access_mode::read);
+        ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+
+        m_quantize_tuner->begin();
+        kernel::gpu_nlist_hashed_quantize(d_quantized.data,
+                                          d_sorted_indexes.data,
+                                          d_pos.data,
+                                          N_total,
+                                          box,
+                                          m_indexer,
+                                          m_quantization,
+                                          m_quantize_tuner->getParam()[0]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_quantize_tuner->end();
+
+        updateQuantizedListRadius();
+        }
+
+    // build the neighbor list
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_body(m_pdata->getBodies(),
+                                     access_location::device,
+                                     access_mode::read);
+    ArrayHandle<unsigned int> d_sorted_indexes(m_sorted_indexes,
+                                               access_location::device,
+                                               access_mode::read);
+    ArrayHandle<uint64_t> d_table_keys(m_table_keys, access_location::device, access_mode::read);
+    ArrayHandle<uint2> d_table_cells(m_table_cells, access_location::device, access_mode::read);
+
+    ArrayHandle<size_t> d_head_list(m_head_list, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_Nmax(m_Nmax, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_conditions(m_conditions,
+                                           access_location::device,
+                                           access_mode::readwrite);
+    ArrayHandle<unsigned int> d_nlist(m_nlist, access_location::device, access_mode::overwrite);
+    ArrayHandle<unsigned int> d_n_neigh(m_n_neigh, access_location::device, access_mode::overwrite);
+
+    ArrayHandle<Scalar> d_r_cut(m_r_cut, access_location::device, access_mode::read);
+    ArrayHandle<Scalar> d_r_listsq(m_r_listsq, access_location::device, access_mode::read);
+
+    if (quantize)
+        {
+        ArrayHandle<uint4> d_quantized(m_quantized, access_location::device, access_mode::read);
+        ArrayHandle<Scalar> d_r_listsq_quantized(m_r_listsq_quantized,
+                                                 access_location::device,
+                                                 access_mode::read);
+
+        m_tuner->begin();
+        kernel::gpu_compute_nlist_hashed_quantized(d_nlist.data,
+                                                   d_n_neigh.data,
+                                                   d_conditions.data,
+                                                   d_Nmax.data,
+                                                   d_head_list.data,
+                                                   d_pos.data,
+                                                   d_body.data,
+                                                   d_sorted_indexes.data,
+                                                   d_quantized.data,
+                                                   d_table_keys.data,
+                                                   d_table_cells.data,
+                                                   N,
+                                                   m_table_size,
+                                                   box,
+                                                   m_indexer,
+                                                   d_r_cut.data,
+                                                   d_r_listsq_quantized.data,
+                                                   m_pdata->getNTypes(),
+                                                   m_filter_body,
+                                                   m_quantization,
+                                                   m_tuner->getParam()[0]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner->end();
+        return;
+        }
+
+    m_tuner->begin();
+    kernel::gpu_compute_nlist_hashed(d_nlist.data,
+                                     d_n_neigh.data,
+                                     d_conditions.data,
+                                     d_Nmax.data,
+                                     d_head_list.data,
+                                     d_pos.data,
+                                     d_body.data,
+                                     d_sorted_indexes.data,
+                                     d_table_keys.data,
+                                     d_table_cells.data,
+                                     N,
+                                     m_table_size,
+                                     box,
+                                     m_indexer,
+                                     d_r_cut.data,
+                                     d_r_listsq.data,
+                                     m_pdata->getNTypes(),
+                                     m_filter_body,
+                                     m_tuner->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner->end();
+    }
+
+namespace detail
+    {
+void export_NeighborListGPUHashed(pybind11::module& m)
+    {
+    pybind11::class_<NeighborListGPUHashed,
+                     NeighborListGPU,
+                     std::shared_ptr<NeighborListGPUHashed>>(m, "NeighborListGPUHashed")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
+        .def("getDim",
+             &NeighborListGPUHashed::getDim,
+             pybind11::return_value_policy::reference_internal)
+        .def("getTableSize", &NeighborListGPUHashed::getTableSize)
+        .def_property("quantization",
+                      &NeighborListGPUHashed::getQuantization,
+                      &NeighborListGPUHashed::setQuantization);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,852 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "NeighborListGPUHashed.cuh"
+#include "hip/hip_runtime.h"
+#include "hoomd/Index1D.h"
+
+#include <hipcub/hipcub.hpp>
+
+/*! \file NeighborListGPUHashed.cu
+    \brief Defines GPU kernel code for the hashed cell neighbor list build on the GPU
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Kernel to compute the cell keys of the particles
+/*!
+ * \param d_keys Cell key of each particle
+ * \param d_indexes Index of each particle (for sorting)
+ * \param d_last_pos Positions of the local particles at this build
+ * \param d_pos Particle positions
+ * \param N Number of local particles
+ * \param nghosts Number of ghost particles
+ * \param box Local simulation box
+ * \param indexer Indexer of the cells
+ *
+ * One thread is used per particle (local and ghost).
+ */
+__global__ void gpu_nlist_hashed_keys_kernel(uint64_t* d_keys,
+                                             unsigned int* d_indexes,
+                                             Scalar4* d_last_pos,
+                                             const Scalar4* d_pos,
+                                             const unsigned int N,
+                                             const unsigned int nghosts,
+                                             const BoxDim box,
+                                             const HashedCellIndexer indexer)
+    {
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N + nghosts)
+        return;
+
+    const Scalar4 postype = d_pos[idx];
+    const Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+    d_keys[idx] = indexer.getKey(indexer.getCell(box.makeFraction(pos)));
+    d_indexes[idx] = idx;
+
+    if (idx < N)
+        d_last_pos[idx] = postype;
+    }
+
+/*!
+ * \param d_keys Cell key of each particle
+ * \param d_indexes Index of each particle (for sorting)
+ * \param d_last_pos Positions of the local particles at this build
+ * \param d_pos Particle positions
+ * \param N Number of local particles
+ * \param nghosts Number of ghost particles
+ * \param box Local simulation box
+ * \param indexer Indexer of the cells
+ * \param block_size Number of CUDA threads per block
+ *
+ * \returns cudaSuccess on completion
+ */
+hipError_t gpu_nlist_hashed_keys(uint64_t* d_keys,
+                                 unsigned int* d_indexes,
+                                 Scalar4* d_last_pos,
+                                 const Scalar4* d_pos,
+                                 const unsigned int N,
+                                 const unsigned int nghosts,
+                                 const BoxDim& box,
+                                 const HashedCellIndexer& indexer,
+                                 const unsigned int block_size)
+    {
+    if (N + nghosts == 0)
+        return hipSuccess;
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(gpu_nlist_hashed_keys_kernel));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    const unsigned int run_block_size = min(block_size, max_block_size);
+    const unsigned int num_blocks = (N + nghosts) / run_block_size + 1;
+    hipLaunchKernelGGL((gpu_nlist_hashed_keys_kernel),
+                       dim3(num_blocks),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_keys,
+                       d_indexes,
+                       d_last_pos,
+                       d_pos,
+                       N,
+                       nghosts,
+                       box,
+                       indexer);
+    return hipSuccess;
+    }
+
+/*!
+ * \param d_tmp Temporary memory for sorting.
+ * \param tmp_bytes Number of temporary bytes for sorting.
+ * \param d_keys The cell keys to sort.
+ * \param d_sorted_keys The sorted cell keys.
+ * \param d_indexes The particle indexes to sort.
+ * \param d_sorted_indexes The sorted particle indexes.
+ * \param N Number of particles to sort.
+ *
+ * \returns Flags for whether the (keys, indexes) need to be swapped.
+ *
+ * The sorting is done using CUB with the DoubleBuffer, the same as gpu_nlist_sort_types. On the
+ * first call, the temporary memory is sized. On the second call, the sorting is performed. The
+ * Morton keys use the lowest 63 bits.
+ */
+uchar2 gpu_nlist_hashed_sort(void* d_tmp,
+                             size_t& tmp_bytes,
+                             uint64_t* d_keys,
+                             uint64_t* d_sorted_keys,
+                             unsigned int* d_indexes,
+                             unsigned int* d_sorted_indexes,
+                             const unsigned int N)
+    {
+    hipcub::DoubleBuffer<uint64_t> keys(d_keys, d_sorted_keys);
+    hipcub::DoubleBuffer<unsigned int> vals(d_indexes, d_sorted_indexes);
+    hipcub::DeviceRadixSort::SortPairs(d_tmp, tmp_bytes, keys, vals, N, 0, 63);
+
+    uchar2 swap = make_uchar2(0, 0);
+    if (d_tmp != NULL)
+        {
+        // mark that the gpu arrays should be flipped if the final result is not in the sorted array
+        swap.x = (keys.selector == 0);
+        swap.y = (vals.selector == 0);
+        }
+    return swap;
+    }
+
+//! Kernel to insert the occupied cells into the hash table
+/*!
+ * \param d_table_keys Key stored in each slot of the table
+ * \param d_table_cells First and last+1 sorted particle of the cell in each slot
+ * \param d_sorted_keys Sorted cell keys of the particles
+ * \param N Number of sorted particles
+ * \param mask Size of the table minus 1
+ *
+ * One thread is used per sorted particle, and the thread for the first particle in each cell
+ * inserts the cell using open addressing with linear probing. The cells are short, so the end of
+ * the cell is found by scanning forward from its start.
+ */
+__global__ void gpu_nlist_hashed_fill_table_kernel(uint64_t* d_table_keys,
+                                                   uint2* d_table_cells,
+                                                   const uint64_t* d_sorted_keys,
+                                                   const unsigned int N,
+                                                   const unsigned int mask)
+    {
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    const uint64_t key = d_sorted_keys[idx];
+    if (idx > 0 && d_sorted_keys[idx - 1] == key)
+        return;
+
+    unsigned int last = idx + 1;
+    while (last < N && d_sorted_keys[last] == key)
+        ++last;
+
+    // each key is only inserted once, so there is no need to check for a match
+    unsigned int slot = HashedCellIndexer::hash(key, mask);
+    while (atomicCAS(reinterpret_cast<unsigned long long int*>(d_table_keys + slot),
+                     static_cast<unsigned long long int>(HashedCellEmptyKey),
+                     static_cast<unsigned long long int>(key))
+           != static_cast<unsigned long long int>(HashedCellEmptyKey))
+        {
+        slot = (slot + 1) & mask;
+        }
+    d_table_cells[slot] = make_uint2(idx, last);
+    }
+
+/*!
+ * \param d_table_keys Key stored in each slot of the table
+ * \param d_table_cells First and last+1 sorted particle of the cell in each slot
+ * \param d_sorted_keys Sorted cell keys of the particles
+ * \param N Number of sorted particles
+ * \param table_size Size of the table (a power of 2)
+ * \param block_size Number of CUDA threads per block
+ *
+ * \returns cudaSuccess on completion
+ */
+hipError_t gpu_nlist_hashed_fill_table(uint64_t* d_table_keys,
+                                       uint2* d_table_cells,
+                                       const uint64_t* d_sorted_keys,
+                                       const unsigned int N,
+                                       const unsigned int table_size,
+                                       const unsigned int block_size)
+    {
+    // all bits set is the empty key
+    hipMemset(d_table_keys, 0xff, sizeof(uint64_t) * table_size);
+    if (N == 0)
+        return hipSuccess;
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(gpu_nlist_hashed_fill_table_kernel));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    const unsigned int run_block_size = min(block_size, max_block_size);
+    const unsigned int num_blocks = N / run_block_size + 1;
+    hipLaunchKernelGGL((gpu_nlist_hashed_fill_table_kernel),
+                       dim3(num_blocks),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_table_keys,
+                       d_table_cells,
+                       d_sorted_keys,
+                       N,
+                       table_size - 1);
+    return hipSuccess;
+    }
+
+//! Kernel to build the neighbor list from the hash table
+/*!
+ * \param d_nlist Neighbor list data structure to write
+ * \param d_n_neigh Number of neighbors to write
+ * \param d_conditions Conditions array for writing overflow condition
+ * \param d_Nmax Maximum number of neighbors per type
+ * \param d_head_list List of indexes to access \a d_nlist
+ * \param d_pos Particle positions
+ * \param d_body Particle body indices
+ * \param d_sorted_indexes Particle indexes sorted by cell key
+ * \param d_table_keys Key stored in each slot of the table
+ * \param d_table_cells First and last+1 sorted particle of the cell in each slot
+ * \param N Number of local particles
+ * \param mask Size of the table minus 1
+ * \param box Local simulation box
+ * \param indexer Indexer of the cells
+ * \param d_r_cut Cutoff radius stored by pair type r_cut(i,j)
+ * \param d_r_listsq Squared list radius stored by pair type
+ * \param ntypes Number of particle types
+ * \param filter_body If true, particles in the same body are excluded
+ *
+ * One thread is used per local particle. The neighboring cells are looked up in the hash table,
+ * and empty cells are skipped after (usually) one probe.
+ */
+__global__ void gpu_compute_nlist_hashed_kernel(unsigned int* d_nlist,
+                                                unsigned int* d_n_neigh,
+                                                unsigned int* d_conditions,
+                                                const unsigned int* d_Nmax,
+                                                const size_t* d_head_list,
+                                                const Scalar4* d_pos,
+                                                const unsigned int* d_body,
+                                                const unsigned int* d_sorted_indexes,
+                                                const uint64_t* d_table_keys,
+                                                const uint2* d_table_cells,
+                                                const unsigned int N,
+                                                const unsigned int mask,
+                                                const BoxDim box,
+                                                const HashedCellIndexer indexer,
+                                                const Scalar* d_r_cut,
+                                                const Scalar* d_r_listsq,
+                                                const unsigned int ntypes,
+                                                const bool filter_body)
+    {
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    const Scalar4 my_postype = d_pos[idx];
+    const Scalar3 my_pos = make_scalar3(my_postype.x, my_postype.y, my_postype.z);
+    const unsigned int my_type = __scalar_as_int(my_postype.w);
+    const unsigned int my_body = d_body[idx];
+    const unsigned int Nmax_i = d_Nmax[my_type];
+    const size_t head_idx = d_head_list[idx];
+    const Index2D typpair_idx(ntypes);
+
+    int3 lo, hi;
+    indexer.getStencil(lo, hi);
+    const int3 my_cell = indexer.getCell(box.makeFraction(my_pos));
+
+    unsigned int n_neigh = 0;
+    for (int k = lo.z; k <= hi.z; ++k)
+        {
+        for (int j = lo.y; j <= hi.y; ++j)
+            {
+            for (int i = lo.x; i <= hi.x; ++i)
+                {
+                const int3 neigh_cell
+                    = indexer.wrap(make_int3(my_cell.x + i, my_cell.y + j, my_cell.z + k));
+                const uint64_t key = indexer.getKey(neigh_cell);
+
+                // probe the table until the cell or an empty slot is found
+                unsigned int slot = HashedCellIndexer::hash(key, mask);
+                uint64_t slot_key = d_table_keys[slot];
+                while (slot_key != key && slot_key != HashedCellEmptyKey)
+                    {
+                    slot = (slot + 1) & mask;
+                    slot_key = d_table_keys[slot];
+                    }
+                if (slot_key != key)
+                    continue;
+
+                const uint2 cell = d_table_cells[slot];
+                for (unsigned int cur = cell.x; cur < cell.y; ++cur)
+                    {
+                    const unsigned int neigh = d_sorted_indexes[cur];
+                    const Scalar4 neigh_postype = d_pos[neigh];
+                    const unsigned int neigh_type = __scalar_as_int(neigh_postype.w);
+                    const unsigned int typpair = typpair_idx(my_type, neigh_type);
+
+                    // exclude self, skippable cutoffs, and particles in the same body
+                    bool excluded = (neigh == idx) || (d_r_cut[typpair] <= Scalar(0.0));
+                    if (filter_body && my_body != 0xffffffff)
+                        excluded = excluded || (my_body == d_body[neigh]);
+                    if (excluded)
+                        continue;
+
+                    const Scalar3 dx = box.minImage(
+                        my_pos - make_scalar3(neigh_postype.x, neigh_postype.y, neigh_postype.z));
+                    if (dot(dx, dx) <= d_r_listsq[typpair])
+                        {
+                        if (n_neigh < Nmax_i)
+                            d_nlist[head_idx + n_neigh] = neigh;
+                        ++n_neigh;
+                        }
+                    }
+                }
+            }
+        }
+
+    d_n_neigh[idx] = n_neigh;
+    if (n_neigh > Nmax_i)
+        atomicMax(&d_conditions[my_type], n_neigh);
+    }
+
+/*!
+ * \param d_nlist Neighbor list data structure to write
+ * \param d_n_neigh Number of neighbors to write
+ * \param d_conditions Conditions array for writing overflow condition
+ * \param d_Nmax Maximum number of neighbors per type
+ * \param d_head_list List of indexes to access \a d_nlist
+ * \param d_pos Particle positions
+ * \param d_body Particle body indices
+ * \param d_sorted_indexes Particle indexes sorted by cell key
+ * \param d_table_keys Key stored in each slot of the table
+ * \param d_table_cells First and last+1 sorted particle of the cell in each slot
+ * \param N Number of local particles
+ * \param table_size Size of the table (a power of 2)
+ * \param box Local simulation box
+ * \param indexer Indexer of the cells
+ * \param d_r_cut Cutoff radius stored by pair type r_cut(i,j)
+ * \param d_r_listsq Squared list radius stored by pair type
+ * \param ntypes Number of particle types
+ * \param filter_body If true, particles in the same body are excluded
+ * \param block_size Number of CUDA threads per block
+ *
+ * \returns cudaSuccess on completion
+ */
+hipError_t gpu_compute_nlist_hashed(unsigned int* d_nlist,
+                                    unsigned int* d_n_neigh,
+                                    unsigned int* d_conditions,
+                                    const unsigned int* d_Nmax,
+                                    const size_t* d_head_list,
+                                    const Scalar4* d_pos,
+                                    const unsigned int* d_body,
+                                    const unsigned int* d_sorted_indexes,
+                                    const uint64_t* d_table_keys,
+                                    const uint2* d_table_cells,
+                                    const unsigned int N,
+                                    const unsigned int table_size,
+                                    const BoxDim& box,
+                                    const HashedCellIndexer& indexer,
+                                    const Scalar* d_r_cut,
+                                    const Scalar* d_r_listsq,
+                                    const unsigned int ntypes,
+                                    const bool filter_body,
+                                    const unsigned int block_size)
+    {
+    if (N == 0)
+        return hipSuccess;
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(gpu_compute_nlist_hashed_kernel));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    const unsigned int run_block_size = min(block_size, max_block_size);
+    const unsigned int num_blocks = N / run_block_size + 1;
+    hipLaunchKernelGGL((gpu_compute_nlist_hashed_kernel),
+                       dim3(num_blocks),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_nlist,
+                       d_n_neigh,
+                       d_conditions,
+                       d_Nmax,
+                       d_head_list,
+                       d_pos,
+                       d_body,
+                       d_sorted_indexes,
+                       d_table_keys,
+                       d_table_cells,
+                       N,
+                       table_size - 1,
+                       box,
+                       indexer,
+                       d_r_cut,
+                       d_r_listsq,
+                       ntypes,
+                       filter_body);
+    return hipSuccess;
+    }
+
+//! Get the position of a particle relative to the lower corner of its cell
+/*!
+ * \param f Fractional coordinate of the particle in the local box
+ * \param indexer Indexer of the cells
+ *
+ * \returns Position in cell units, in [0, 1) along each direction (0 along z in 2D)
+ *
+ * The floor is taken the same way as in HashedCellIndexer::getCell, so the position is relative
+ * to the cell that the particle is sorted into.
+ */
+__device__ inline Scalar3 gpu_nlist_hashed_cell_position(const Scalar3& f,
+                                                         const HashedCellIndexer& indexer)
+    {
+    const Scalar3 s = make_scalar3(f.x * Scalar(indexer.dim.x),
+                                   f.y * Scalar(indexer.dim.y),
+                                   f.z * Scalar(indexer.dim.z));
+    Scalar3 r = make_scalar3(s.x - slow::floor(s.x),
+                             s.y - slow::floor(s.y),
+                             s.z - slow::floor(s.z));
+    if (indexer.two_d)
+        r.z = Scalar(0);
+    return r;
+    }
+
+//! Kernel to quantize the cell-relative coordinates of the sorted particles
+/*!
+ * \param d_quantized Quantized coordinates and type of each sorted particle
+ * \param d_sorted_indexes Particle indexes sorted by cell key
+ * \param d_pos Particle positions
+ * \param N Number of sorted particles
+ * \param box Local simulation box
+ * \param indexer Indexer of the cells
+ * \param scale Number of quanta per cell width
+ * \param max_q Largest quantized value
+ *
+ * One thread is used per sorted particle. The coordinates are rounded down, and the arithmetic is
+ * in double precision so that 32 bit values are not rounded past \a max_q.
+ */
+template<class T>
+__global__ void gpu_nlist_hashed_quantize_kernel(T* d_quantized,
+                                                 const unsigned int* d_sorted_indexes,
+                                                 const Scalar4* d_pos,
+                                                 const unsigned int N,
+                                                 const BoxDim box,
+                                                 const HashedCellIndexer indexer,
+                                                 const double scale,
+                                                 const double max_q)
+    {
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    const Scalar4 postype = d_pos[d_sorted_indexes[idx]];
+    const Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+    const Scalar3 r = gpu_nlist_hashed_cell_position(box.makeFraction(pos), indexer);
+
+    T q;
+    q.x = static_cast<unsigned int>(fmin(floor(double(r.x) * scale), max_q));
+    q.y = static_cast<unsigned int>(fmin(floor(double(r.y) * scale), max_q));
+    q.z = static_cast<unsigned int>(fmin(floor(double(r.z) * scale), max_q));
+    q.w = __scalar_as_int(postype.w);
+    d_quantized[idx] = q;
+    }
+
+/*!
+ * \param d_quantized Quantized coordinates and type of each sorted particle
+ * \param d_sorted_indexes Particle indexes sorted by cell key
+ * \param d_pos Particle positions
+ * \param N Number of sorted particles
+ * \param box Local simulation box
+ * \param indexer Indexer of the cells
+ * \param bits Number of bits per coordinate (16 or 32)
+ * \param block_size Number of CUDA threads per block
+ *
+ * \returns cudaSuccess on completion
+ *
+ * The 16 bit coordinates are stored as ushort4 and the 32 bit coordinates as uint4.
+ */
+hipError_t gpu_nlist_hashed_quantize(void* d_quantized,
+                                     const unsigned int* d_sorted_indexes,
+                                     const Scalar4* d_pos,
+                                     const unsigned int N,
+                                     const BoxDim& box,
+                                     const HashedCellIndexer& indexer,
+                                     const unsigned int bits,
+                                     const unsigned int block_size)
+    {
+    if (N == 0)
+        return hipSuccess;
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    if (bits == 16)
+        {
+        hipFuncGetAttributes(&attr, (const void*)gpu_nlist_hashed_quantize_kernel<ushort4>);
+        }
+    else
+        {
+        hipFuncGetAttributes(&attr, (const void*)gpu_nlist_hashed_quantize_kernel<uint4>);
+        }
+    max_block_size = attr.maxThreadsPerBlock;
+
+    const unsigned int run_block_size = min(block_size, max_block_size);
+    const unsigned int num_blocks = N / run_block_size + 1;
+    if (bits == 16)
+        {
+        hipLaunchKernelGGL((gpu_nlist_hashed_quantize_kernel<ushort4>),
+                           dim3(num_blocks),
+                           dim3(run_block_size),
+                           0,
+                           0,
+                           static_cast<ushort4*>(d_quantized),
+                           d_sorted_indexes,
+                           d_pos,
+                           N,
+                           box,
+                           indexer,
+                           65536.0,
+                           65535.0);
+        }
+    else
+        {
+        hipLaunchKernelGGL((gpu_nlist_hashed_quantize_kernel<uint4>),
+                           dim3(num_blocks),
+                           dim3(run_block_size),
+                           0,
+                           0,
+                           static_cast<uint4*>(d_quantized),
+                           d_sorted_indexes,
+                           d_pos,
+                           N,
+                           box,
+                           indexer,
+                           4294967296.0,
+                           4294967295.0);
+        }
+    return hipSuccess;
+    }
+
+//! Kernel to build the neighbor list from the hash table and the quantized coordinates
+/*!
+ * \param d_nlist Neighbor list data structure to write
+ * \param d_n_neigh Number of neighbors to write
+ * \param d_conditions Conditions array for writing overflow condition
+ * \param d_Nmax Maximum number of neighbors per type
+ * \param d_head_list List of indexes to access \a d_nlist
+ * \param d_pos Particle positions
+ * \param d_body Particle body indices
+ * \param d_sorted_indexes Particle indexes sorted by cell key
+ * \param d_quantized Quantized coordinates and type of each sorted particle
+ * \param d_table_keys Key stored in each slot of the table
+ * \param d_table_cells First and last+1 sorted particle of the cell in each slot
+ * \param N Number of local particles
+ * \param mask Size of the table minus 1
+ * \param box Local simulation box
+ * \param indexer Indexer of the cells
+ * \param d_r_cut Cutoff radius stored by pair type r_cut(i,j)
+ * \param d_r_listsq Squared list radius (enlarged by the rounding error) stored by pair type
+ * \param ntypes Number of particle types
+ * \param filter_body If true, particles in the same body are excluded
+ * \param inv_scale Cell width per quantum
+ *
+ * This is the same as gpu_compute_nlist_hashed_kernel, but the candidates are read from the
+ * quantized coordinates in the sorted order instead of gathered from \a d_pos. The separation is
+ * computed in cell units from the offset to the neighboring cell and then transformed by the cell
+ * lattice vectors. The neighboring cells must all be distinct (see
+ * HashedCellIndexer::hasDistinctNeighbors) so that this is the minimum image.
+ */
+template<class T>
+__global__ void gpu_compute_nlist_hashed_quantized_kernel(unsigned int* d_nlist,
+                                                          unsigned int* d_n_neigh,
+                                                          unsigned int* d_conditions,
+                                                          const unsigned int* d_Nmax,
+                                                          const size_t* d_head_list,
+                                                          const Scalar4* d_pos,
+                                                          const unsigned int* d_body,
+                                                          const unsigned int* d_sorted_indexes,
+                                                          const T* d_quantized,
+                                                          const uint64_t* d_table_keys,
+                                                          const uint2* d_table_cells,
+                                                          const unsigned int N,
+                                                          const unsigned int mask,
+                                                          const BoxDim box,
+                                                          const HashedCellIndexer indexer,
+                                                          const Scalar* d_r_cut,
+                                                          const Scalar* d_r_listsq,
+                                                          const unsigned int ntypes,
+                                                          const bool filter_body,
+                                                          const Scalar inv_scale)
+    {
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    const Scalar4 my_postype = d_pos[idx];
+    const Scalar3 my_pos = make_scalar3(my_postype.x, my_postype.y, my_postype.z);
+    const unsigned int my_type = __scalar_as_int(my_postype.w);
+    const unsigned int my_body = d_body[idx];
+    const unsigned int Nmax_i = d_Nmax[my_type];
+    const size_t head_idx = d_head_list[idx];
+    const Index2D typpair_idx(ntypes);
+
+    int3 lo, hi;
+    indexer.getStencil(lo, hi);
+    const Scalar3 my_f = box.makeFraction(my_pos);
+    const int3 my_cell = indexer.getCell(my_f);
+    const Scalar3 my_r = gpu_nlist_hashed_cell_position(my_f, indexer);
+
+    // lattice vectors of a cell
+    const Scalar3 a0 = box.getLatticeVector(0) / Scalar(indexer.dim.x);
+    const Scalar3 a1 = box.getLatticeVector(1) / Scalar(indexer.dim.y);
+    const Scalar3 a2 = box.getLatticeVector(2) / Scalar(indexer.dim.z);
+
+    unsigned int n_neigh = 0;
+    for (int k = lo.z; k <= hi.z; ++k)
+        {
+        for (int j = lo.y; j <= hi.y; ++j)
+            {
+            for (int i = lo.x; i <= hi.x; ++i)
+                {
+                const int3 neigh_cell
+                    = indexer.wrap(make_int3(my_cell.x + i, my_cell.y + j, my_cell.z + k));
+                const uint64_t key = indexer.getKey(neigh_cell);
+
+                // probe the table until the cell or an empty slot is found
+                unsigned int slot = HashedCellIndexer::hash(key, mask);
+                uint64_t slot_key = d_table_keys[slot];
+                while (slot_key != key && slot_key != HashedCellEmptyKey)
+                    {
+                    slot = (slot + 1) & mask;
+                    slot_key = d_table_keys[slot];
+                    }
+                if (slot_key != key)
+                    continue;
+
+                // separation in cell units from the corner of this particle's cell
+                const Scalar3 offset
+                    = make_scalar3(Scalar(i) - my_r.x, Scalar(j) - my_r.y, Scalar(k) - my_r.z);
+
+                const uint2 cell = d_table_cells[slot];
+                for (unsigned int cur = cell.x; cur < cell.y; ++cur)
+                    {
+                    const unsigned int neigh = d_sorted_indexes[cur];
+                    const T q = d_quantized[cur];
+                    const unsigned int neigh_type = q.w;
+                    const unsigned int typpair = typpair_idx(my_type, neigh_type);
+
+                    // exclude self, skippable cutoffs, and particles in the same body
+                    bool excluded = (neigh == idx) || (d_r_cut[typpair] <= Scalar(0.0));
+                    if (filter_body && my_body != 0xffffffff)
+                        excluded = excluded || (my_body == d_body[neigh]);
+                    if (excluded)
+                        continue;
+
+                    const Scalar3 dx = (offset.x + Scalar(q.x) * inv_scale) * a0
+                                       + (offset.y + Scalar(q.y) * inv_scale) * a1
+                                       + (offset.z + Scalar(q.z) * inv_scale) * a2;
+                    if (dot(dx, dx) <= d_r_listsq[typpair])
+                        {
+                        if (n_neigh < Nmax_i)
+                            d_nlist[head_idx + n_neigh] = neigh;
+                        ++n_neigh;
+                        }
+                    }
+                }
+            }
+        }
+
+    d_n_neigh[idx] = n_neigh;
+    if (n_neigh > Nmax_i)
+        atomicMax(&d_conditions[my_type], n_neigh);
+    }
+
+//! Launch the quantized neighbor list kernel for one storage type
+template<class T>
+static void gpu_launch_nlist_hashed_quantized(unsigned int* d_nlist,
+                                              unsigned int* d_n_neigh,
+                                              unsigned int* d_conditions,
+                                              const unsigned int* d_Nmax,
+                                              const size_t* d_head_list,
+                                              const Scalar4* d_pos,
+                                              const unsigned int* d_body,
+                                              const unsigned int* d_sorted_indexes,
+                                              const T* d_quantized,
+                                              const uint64_t* d_table_keys,
+                                              const uint2* d_table_cells,
+                                              const unsigned int N,
+                                              const unsigned int table_size,
+                                              const BoxDim& box,
+                                              const HashedCellIndexer& indexer,
+                                              const Scalar* d_r_cut,
+                                              const Scalar* d_r_listsq,
+                                              const unsigned int ntypes,
+                                              const bool filter_body,
+                                              const Scalar inv_scale,
+                                              const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_compute_nlist_hashed_quantized_kernel<T>);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    const unsigned int run_block_size = min(block_size, max_block_size);
+    const unsigned int num_blocks = N / run_block_size + 1;
+    hipLaunchKernelGGL((gpu_compute_nlist_hashed_quantized_kernel<T>),
+                       dim3(num_blocks),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_nlist,
+                       d_n_neigh,
+                       d_conditions,
+                       d_Nmax,
+                       d_head_list,
+                       d_pos,
+                       d_body,
+                       d_sorted_indexes,
+                       d_quantized,
+                       d_table_keys,
+                       d_table_cells,
+                       N,
+                       table_size - 1,
+                       box,
+                       indexer,
+                       d_r_cut,
+                       d_r_listsq,
+                       ntypes,
+                       filter_body,
+                       inv_scale);
+    }
+
+/*!
+ * \param d_nlist Neighbor list data structure to write
+ * \param d_n_neigh Number of neighbors to write
+ * \param d_conditions Conditions array for writing overflow condition
+ * \param d_Nmax Maximum number of neighbors per type
+ * \param d_head_list List of indexes to access \a d_nlist
+ * \param d_pos Particle positions
+ * \param d_body Particle body indices
+ * \param d_sorted_indexes Particle indexes sorted by cell key
+ * \param d_quantized Quantized coordinates and type of each sorted particle
+ * \param d_table_keys Key stored in each slot of the table
+ * \param d_table_cells First and last+1 sorted particle of the cell in each slot
+ * \param N Number of local particles
+ * \param table_size Size of the table (a power of 2)
+ * \param box Local simulation box
+ * \param indexer Indexer of the cells
+ * \param d_r_cut Cutoff radius stored by pair type r_cut(i,j)
+ * \param d_r_listsq Squared list radius (enlarged by the rounding error) stored by pair type
+ * \param ntypes Number of particle types
+ * \param filter_body If true, particles in the same body are excluded
+ * \param bits Number of bits per coordinate (16 or 32)
+ * \param block_size Number of CUDA threads per block
+ *
+ * \returns cudaSuccess on completion
+ */
+hipError_t gpu_compute_nlist_hashed_quantized(unsigned int* d_nlist,
+                                              unsigned int* d_n_neigh,
+                                              unsigned int* d_conditions,
+                                              const unsigned int* d_Nmax,
+                                              const size_t* d_head_list,
+                                              const Scalar4* d_pos,
+                                              const unsigned int* d_body,
+                                              const unsigned int* d_sorted_indexes,
+                                              const void* d_quantized,
+                                              const uint64_t* d_table_keys,
+                                              const uint2* d_table_cells,
+                                              const unsigned int N,
+                                              const unsigned int table_size,
+                                              const BoxDim& box,
+                                              const HashedCellIndexer& indexer,
+                                              const Scalar* d_r_cut,
+                                              const Scalar* d_r_listsq,
+                                              const unsigned int ntypes,
+                                              const bool filter_body,
+                                              const unsigned int bits,
+                                              const unsigned int block_size)
+    {
+    if (N == 0)
+        return hipSuccess;
+
+    if (bits == 16)
+        {
+        gpu_launch_nlist_hashed_quantized(d_nlist,
+                                          d_n_neigh,
+                                          d_conditions,
+                                          d_Nmax,
+                                          d_head_list,
+                                          d_pos,
+                                          d_body,
+                                          d_sorted_indexes,
+                                          static_cast<const ushort4*>(d_quantized),
+                                          d_table_keys,
+                                          d_table_cells,
+                                          N,
+                                          table_size,
+                                          box,
+                                          indexer,
+                                          d_r_cut,
+                                          d_r_listsq,
+                                          ntypes,
+                                          filter_body,
+                                          Scalar(1.0 / 65536.0),
+                                          block_size);
+        }
+    else
+        {
+        gpu_launch_nlist_hashed_quantized(d_nlist,
+                                          d_n_neigh,
+                                          d_conditions,
+                                          d_Nmax,
+                                          d_head_list,
+                                          d_pos,
+                                          d_body,
+                                          d_sorted_indexes,
+                                          static_cast<const uint4*>(d_quantized),
+                                          d_table_keys,
+                                          d_table_cells,
+                                          N,
+                                          table_size,
+                                          box,
+                                          indexer,
+                                          d_r_cut,
+                                          d_r_listsq,
+                                          ntypes,
+                                          filter_body,
+                                          Scalar(1.0 / 4294967296.0),
+                                          block_size);
+        }
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,109 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __NEIGHBORLISTGPUHASHED_CUH__
+#define __NEIGHBORLISTGPUHASHED_CUH__
+
+/*! \file NeighborListGPUHashed.cuh
+    \brief Declares GPU kernel code for the hashed cell neighbor list build on the GPU
+*/
+
+#include <hip/hip_runtime.h>
+
+#include "HashedCellIndexer.h"
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Kernel driver to compute the cell keys of the particles
+hipError_t gpu_nlist_hashed_keys(uint64_t* d_keys,
+                                 unsigned int* d_indexes,
+                                 Scalar4* d_last_pos,
+                                 const Scalar4* d_pos,
+                                 const unsigned int N,
+                                 const unsigned int nghosts,
+                                 const BoxDim& box,
+                                 const HashedCellIndexer& indexer,
+                                 const unsigned int block_size);
+
+//! Kernel driver to sort the particles by cell key
+uchar2 gpu_nlist_hashed_sort(void* d_tmp,
+                             size_t& tmp_bytes,
+                             uint64_t* d_keys,
+                             uint64_t* d_sorted_keys,
+                             unsigned int* d_indexes,
+                             unsigned int* d_sorted_indexes,
+                             const unsigned int N);
+
+//! Kernel driver to insert the occupied cells into the hash table
+hipError_t gpu_nlist_hashed_fill_table(uint64_t* d_table_keys,
+                                       uint2* d_table_cells,
+                                       const uint64_t* d_sorted_keys,
+                                       const unsigned int N,
+                                       const unsigned int table_size,
+                                       const unsigned int block_size);
+
+//! Kernel driver to build the neighbor list from the hash table
+hipError_t gpu_compute_nlist_hashed(unsigned int* d_nlist,
+                                    unsigned int* d_n_neigh,
+                                    unsigned int* d_conditions,
+                                    const unsigned int* d_Nmax,
+                                    const size_t* d_head_list,
+                                    const Scalar4* d_pos,
+                                    const unsigned int* d_body,
+                                    const unsigned int* d_sorted_indexes,
+                                    const uint64_t* d_table_keys,
+                                    const uint2* d_table_cells,
+                                    const unsigned int N,
+                                    const unsigned int table_size,
+                                    const BoxDim& box,
+                                    const HashedCellIndexer& indexer,
+                                    const Scalar* d_r_cut,
+                                    const Scalar* d_r_listsq,
+                                    const unsigned int ntypes,
+                                    const bool filter_body,
+                                    const unsigned int block_size);
+
+//! Kernel driver to store the quantized cell-relative coordinates of the sorted particles
+hipError_t gpu_nlist_hashed_quantize(void* d_quantized,
+                                     const unsigned int* d_sorted_indexes,
+                                     const Scalar4* d_pos,
+                                     const unsigned int N,
+                                     const BoxDim& box,
+                                     const HashedCellIndexer& indexer,
+                                     const unsigned int bits,
+                                     const unsigned int block_size);
+
+//! Kernel driver to build the neighbor list from the hash table and quantized coordinates
+hipError_t gpu_compute_nlist_hashed_quantized(unsigned int* d_nlist,
+                                              unsigned int* d_n_neigh,
+                                              unsigned int* d_conditions,
+                                              const unsigned int* d_Nmax,
+                                              const size_t* d_head_list,
+                                              const Scalar4* d_pos,
+                                              const unsigned int* d_body,
+                                              const unsigned int* d_sorted_indexes,
+                                              const void* d_quantized,
+                                              const uint64_t* d_table_keys,
+                                              const uint2* d_table_cells,
+                                              const unsigned int N,
+                                              const unsigned int table_size,
+                                              const BoxDim& box,
+                                              const HashedCellIndexer& indexer,
+                                              const Scalar* d_r_cut,
+                                              const Scalar* d_r_listsq,
+                                              const unsigned int ntypes,
+                                              const bool filter_body,
+                                              const unsigned int bits,
+                                              const unsigned int block_size);
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __NEIGHBORLISTGPUHASHED_CUH__
@@ -0,0 +1,116 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "HashedCellIndexer.h"
+#include "NeighborListGPU.h"
+#include "hoomd/Autotuner.h"
+
+/*! \file NeighborListGPUHashed.h
+    \brief Declares the NeighborListGPUHashed class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __NEIGHBORLISTGPUHASHED_H__
+#define __NEIGHBORLISTGPUHASHED_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Neighbor list build on the GPU using a hashed cell list
+/*! This is the GPU implementation of NeighborListHashed. The particles are given the Morton key of
+    their cell and radix sorted by key, and the thread for the first particle of each cell inserts
+    the cell into an open-addressed hash table with at least twice as many slots as particles. Each
+    particle then looks up its neighboring cells in the table. All of the memory scales with the
+    number of particles rather than the volume of the box.
+
+    Optionally, the build can use quantized coordinates. After the sort, the position of each
+    particle relative to the corner of its cell is stored in 16 or 32 bits per coordinate (in cell
+    units), together with its type, in the sorted order. The neighbor loop then reads one small
+    contiguous record per candidate instead of gathering the full position, and computes the
+    distance from the cell offset without a minimum image. The rounding error is bounded, so
+    the list radius is enlarged by the largest possible error and no neighbors are missed; the
+    few extra candidates are rejected by the pair potentials. The exact build is used when a
+    periodic direction has fewer than 3 cells.
+
+    GPU kernel methods are defined in NeighborListGPUHashed.cuh and defined in
+    NeighborListGPUHashed.cu.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT NeighborListGPUHashed : public NeighborListGPU
+    {
+    public:
+    //! Constructs the compute
+    NeighborListGPUHashed(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff);
+
+    //! Destructor
+    virtual ~NeighborListGPUHashed();
+
+    /// Get the dimensions of the (virtual) cell grid
+    const uint3& getDim() const
+        {
+        return m_indexer.dim;
+        }
+
+    /// Get the number of slots in the hash table
+    unsigned int getTableSize() const
+        {
+        return m_table_size;
+        }
+
+    /// Get the number of bits used to quantize the coordinates (0 if not quantized)
+    unsigned int getQuantization() const
+        {
+        return m_quantization;
+        }
+
+    /// Set the number of bits used to quantize the coordinates (0, 16, or 32)
+    void setQuantization(unsigned int bits);
+
+    protected:
+    std::shared_ptr<Autotuner<1>> m_key_tuner;      //!< Tuner for the cell key kernel
+    std::shared_ptr<Autotuner<1>> m_table_tuner;    //!< Tuner for the hash table kernel
+    std::shared_ptr<Autotuner<1>> m_quantize_tuner; //!< Tuner for the quantization kernel
+    std::shared_ptr<Autotuner<1>> m_tuner;          //!< Tuner for the neighbor list kernel
+
+    HashedCellIndexer m_indexer; //!< Indexer of the cells in the last build
+
+    GPUArray<uint64_t> m_keys;               //!< Cell keys of the particles (for sorting)
+    GPUArray<uint64_t> m_sorted_keys;        //!< Sorted cell keys
+    GPUArray<unsigned int> m_indexes;        //!< Particle indexes (for sorting)
+    GPUArray<unsigned int> m_sorted_indexes; //!< Sorted particle indexes
+
+    unsigned int m_table_size;       //!< Number of slots in the hash table
+    GPUArray<uint64_t> m_table_keys; //!< Key of the cell in each slot
+    GPUArray<uint2> m_table_cells;   //!< Range of sorted particles of the cell in each slot
+
+    unsigned int m_quantization;           //!< Bits per quantized coordinate (0 for none)
+    GPUArray<uint4> m_quantized;           //!< Quantized coordinates and types (sorted order)
+    GPUArray<Scalar> m_r_listsq_quantized; //!< Squared list radius enlarged by rounding error
+
+    //! Compute the list radius enlarged by the quantization error
+    void updateQuantizedListRadius();
+
+    //! Builds the neighbor list
+    virtual void buildNlist(uint64_t timestep);
+
+    private:
+    //! Notify the list that the maximum number of particles has changed
+    void slotMaxNumChanged()
+        {
+        m_max_num_changed = true;
+        }
+
+    bool m_max_num_changed; //!< Flag if max number of particles changed
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -38,6 +38,9 @@ NeighborListGPUStencil::NeighborListGPUStencil(std::shared_ptr<SystemDefinition>
     m_cl->setFlagIndex();
     m_cl->setComputeAdjList(false);
 
+    // excluded pairs are skipped in the build kernel
+    m_filter_exclusions_in_build = true;
+
     CHECK_CUDA_ERROR();
 
     // Initialize autotuner.
@@ -227,6 +230,14 @@ void NeighborListGPUStencil::buildNlist(uint64_t timestep)
     ArrayHandle<Scalar> d_r_cut(m_r_cut, access_location::device, access_mode::read);
     ArrayHandle<Scalar> d_r_listsq(m_r_listsq, access_location::device, access_mode::read);
 
+    ArrayHandle<unsigned int> d_n_ex_idx(m_n_ex_idx, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_ex_mask_idx(m_ex_mask_idx,
+                                            access_location::device,
+                                            access_mode::read);
+    ArrayHandle<unsigned int> d_ex_list_idx(m_ex_list_idx,
+                                            access_location::device,
+                                            access_mode::read);
+
     if ((box.getPeriodic().x && nearest_plane_distance.x <= rmax * 2.0)
         || (box.getPeriodic().y && nearest_plane_distance.y <= rmax * 2.0)
         || (this->m_sysdef->getNDimensions() == 3 && box.getPeriodic().z
@@ -283,6 +294,7 @@ void NeighborListGPUStencil::buildNlist(uint64_t timestep)
                                       m_filter_body,
                                       threads_per_particle,
                                       block_size,
+                                      getBuildExclusions(d_n_ex_idx, d_ex_mask_idx, d_ex_list_idx),
                                       m_exec_conf->dev_prop);
 
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -301,7 +313,10 @@ void export_NeighborListGPUStencil(pybind11::module& m)
                      NeighborListGPU,
                      std::shared_ptr<NeighborListGPUStencil>>(m, "NeighborListGPUStencil")
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
-        .def("setCellWidth", &NeighborListGPUStencil::setCellWidth);
+        .def("setCellWidth", &NeighborListGPUStencil::setCellWidth)
+        .def_property("cell_width",
+                      &NeighborListGPUStencil::getCellWidth,
+                      &NeighborListGPUStencil::setCellWidth);
     }
 
     } // end namespace detail
@@ -47,6 +47,7 @@ namespace kernel
     \param r_buff The maximum radius for which to include particles as neighbors
     \param ntypes Number of particle types
     \param ghost_width Width of ghost cell layer
+    \param ex Exclusions to skip
 
     \note optimized for Kepler
 */
@@ -73,7 +74,8 @@ __global__ void gpu_compute_nlist_stencil_kernel(unsigned int* d_nlist,
                                                  const Scalar* d_r_cut,
                                                  const Scalar r_buff,
                                                  const unsigned int ntypes,
-                                                 const Scalar3 ghost_width)
+                                                 const Scalar3 ghost_width,
+                                                 const nlist_exclusions_t ex)
     {
     // cache the r_listsq parameters into shared memory
     Index2D typpair_idx(ntypes);
@@ -240,8 +242,8 @@ __global__ void gpu_compute_nlist_stencil_kernel(unsigned int* d_nlist,
                 const Scalar3 neigh_pos = make_scalar3(neigh_xyzf.x, neigh_xyzf.y, neigh_xyzf.z);
                 unsigned int cur_neigh = __scalar_as_int(neigh_xyzf.w);
 
-                // a particle cannot neighbor itself
-                if (my_pidx == (int)cur_neigh)
+                // a particle cannot neighbor itself or an excluded particle
+                if (my_pidx == (int)cur_neigh || ex.isExcluded((unsigned int)my_pidx, cur_neigh))
                     break;
 
                 Scalar3 dx = my_pos - neigh_pos;
@@ -332,6 +334,7 @@ inline void stencil_launcher(unsigned int* d_nlist,
                              bool filter_body,
                              const unsigned int threads_per_particle,
                              const unsigned int block_size,
+                             const nlist_exclusions_t& ex,
                              const hipDeviceProp_t& devprop)
     {
     // shared memory = r_listsq + Nmax + stuff needed for neighborlist (computed below)
@@ -383,7 +386,8 @@ inline void stencil_launcher(unsigned int* d_nlist,
                                d_r_cut,
                                r_buff,
                                ntypes,
-                               ghost_width);
+                               ghost_width,
+                               ex);
             }
         else if (filter_body)
             {
@@ -421,7 +425,8 @@ inline void stencil_launcher(unsigned int* d_nlist,
                                d_r_cut,
                                r_buff,
                                ntypes,
-                               ghost_width);
+                               ghost_width,
+                               ex);
             }
         }
     else
@@ -452,6 +457,7 @@ inline void stencil_launcher(unsigned int* d_nlist,
                                       filter_body,
                                       threads_per_particle,
                                       block_size,
+                                      ex,
                                       devprop);
         }
     }
@@ -484,6 +490,7 @@ inline void stencil_launcher<min_threads_per_particle / 2>(unsigned int* d_nlist
                                                            bool filter_body,
                                                            const unsigned int threads_per_particle,
                                                            const unsigned int block_size,
+                                                           const nlist_exclusions_t& ex,
                                                            const hipDeviceProp_t& devprop)
     {
     }
@@ -514,6 +521,7 @@ hipError_t gpu_compute_nlist_stencil(unsigned int* d_nlist,
                                      bool filter_body,
                                      const unsigned int threads_per_particle,
                                      const unsigned int block_size,
+                                     const nlist_exclusions_t& ex,
                                      const hipDeviceProp_t& devprop)
     {
     stencil_launcher<max_threads_per_particle>(d_nlist,
@@ -542,6 +550,7 @@ hipError_t gpu_compute_nlist_stencil(unsigned int* d_nlist,
                                                filter_body,
                                                threads_per_particle,
                                                block_size,
+                                               ex,
                                                devprop);
     return hipSuccess;
     }
@@ -10,6 +10,8 @@
 #include "hoomd/Index1D.h"
 #include "hoomd/ParticleData.cuh"
 
+#include "NeighborListGPU.cuh"
+
 /*! \file NeighborListGPUStencil.cuh
     \brief Declares GPU kernel code for neighbor list generation on the GPU
 */
@@ -56,6 +58,7 @@ hipError_t gpu_compute_nlist_stencil(unsigned int* d_nlist,
                                      bool filter_body,
                                      const unsigned int threads_per_particle,
                                      const unsigned int block_size,
+                                     const nlist_exclusions_t& ex,
                                      const hipDeviceProp_t& devprop);
 
 //! Kernel driver for filling the particle types for sorting
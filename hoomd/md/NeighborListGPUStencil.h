@@ -49,11 +49,26 @@ class PYBIND11_EXPORT NeighborListGPUStencil : public NeighborListGPU
         }
 
     //! Change the underlying cell width
+    /*! \param cell_width Width of the cells, or 0 to use the shortest list radius
+
+        Unlike NeighborListStencil, all types share one cell list.
+    */
     void setCellWidth(Scalar cell_width)
         {
-        m_override_cell_width = true;
+        if (cell_width < Scalar(0))
+            {
+            throw std::invalid_argument("The cell width must not be negative.");
+            }
+        m_override_cell_width = cell_width > Scalar(0);
+        m_update_cell_size = true;
         m_needs_restencil = true;
-        m_cl->setNominalWidth(cell_width);
+        if (m_override_cell_width)
+            m_cl->setNominalWidth(cell_width);
+        }
+
+    Scalar getCellWidth()
+        {
+        return m_override_cell_width ? m_cl->getNominalWidth() : Scalar(0);
         }
 
     protected:
@@ -22,8 +22,9 @@ namespace md
  * \param r_buff The buffer radius.
  */
 NeighborListGPUTree::NeighborListGPUTree(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff)
-    : NeighborListGPU(sysdef, r_buff), m_type_bits(1), m_lbvh_errors(m_exec_conf), m_n_images(0),
-      m_types_allocated(false), m_box_changed(true), m_max_num_changed(true), m_max_types(0)
+    : NeighborListGPU(sysdef, r_buff), m_type_bits(1), m_single_tree(false),
+      m_lbvh_errors(m_exec_conf), m_n_images(0), m_types_allocated(false), m_box_changed(true),
+      m_max_num_changed(true), m_max_types(0)
     {
     m_exec_conf->msg->notice(5) << "Constructing NeighborListGPUTree" << std::endl;
     m_pdata->getBoxChangeSignal()
@@ -31,6 +32,9 @@ NeighborListGPUTree::NeighborListGPUTree(std::shared_ptr<SystemDefinition> sysde
     m_pdata->getMaxParticleNumberChangeSignal()
         .connect<NeighborListGPUTree, &NeighborListGPUTree::slotMaxNumChanged>(this);
 
+    // excluded pairs are skipped in the traversal
+    m_filter_exclusions_in_build = true;
+
     m_mark_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
                                         m_exec_conf,
                                         "nlist_tree_mark"));
@@ -66,8 +70,8 @@ NeighborListGPUTree::~NeighborListGPUTree()
  *
  * First, memory is reallocated based on the number of particles and types.
  * The traversal images are also updated if the box has changed. One LBVH is then
- * built for each particle type using buildTree(), and these LBVHs are traversed in
- * traverseTree().
+ * built for each particle type (or one for all types) using buildTree(), and these LBVHs are
+ * traversed in traverseTree().
  */
 void NeighborListGPUTree::buildNlist(uint64_t timestep)
     {
@@ -107,6 +111,9 @@ void NeighborListGPUTree::buildNlist(uint64_t timestep)
             GPUArray<unsigned int> type_last(m_pdata->getNTypes(), m_exec_conf);
             m_type_last.swap(type_last);
 
+            GPUArray<Scalar> type_rlist(m_pdata->getNTypes(), m_exec_conf);
+            m_type_rlist.swap(type_rlist);
+
             m_lbvhs.resize(m_pdata->getNTypes());
             m_traversers.resize(m_pdata->getNTypes());
             m_streams.resize(m_pdata->getNTypes());
@@ -338,15 +345,11 @@ void NeighborListGPUTree::buildTree()
         m_count_tuner->end();
         }
 
-        // build a lbvh for each type
-        {
-        ArrayHandle<unsigned int> h_type_first(m_type_first,
-                                               access_location::host,
-                                               access_mode::read);
-        ArrayHandle<unsigned int> h_type_last(m_type_last,
-                                              access_location::host,
-                                              access_mode::read);
+    // group the particles into the LBVHs
+    chooseTrees();
 
+        // build the lbvhs
+        {
         ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
                                    access_location::device,
                                    access_mode::read);
@@ -357,22 +360,14 @@ void NeighborListGPUTree::buildTree()
         const BoxDim lbvh_box = getLBVHBox();
 
         // first, setup memory (these do not actually execute in a stream)
-        for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+        for (unsigned int i = 0; i < m_tree_N.size(); ++i)
             {
-            const unsigned int first = h_type_first.data[i];
-            const unsigned int last = h_type_last.data[i];
-            if (first != kernel::NeighborListTypeSentinel)
-                {
-                m_lbvhs[i]->setup(d_pos.data,
-                                  d_sorted_indexes.data + first,
-                                  last - first,
-                                  m_streams[i]);
-                }
-            else
-                {
-                // effectively destroy the lbvh
-                m_lbvhs[i]->setup(d_pos.data, NULL, 0, m_streams[i]);
-                }
+            const unsigned int N = m_tree_N[i];
+            // an empty map effectively destroys the lbvh
+            m_lbvhs[i]->setup(d_pos.data,
+                              (N > 0) ? d_sorted_indexes.data + m_tree_first[i] : NULL,
+                              N,
+                              m_streams[i]);
             }
 
         // then, launch all of the builds in their own streams
@@ -380,32 +375,16 @@ void NeighborListGPUTree::buildTree()
         m_build_tuner->begin();
         const unsigned int block_size = m_build_tuner->getParam()[0];
 
-        for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+        for (unsigned int i = 0; i < m_tree_N.size(); ++i)
             {
-            const unsigned int first = h_type_first.data[i];
-            const unsigned int last = h_type_last.data[i];
-
-            if (first != kernel::NeighborListTypeSentinel)
-                {
-                m_lbvhs[i]->build(d_pos.data,
-                                  d_sorted_indexes.data + first,
-                                  last - first,
-                                  lbvh_box.getLo(),
-                                  lbvh_box.getHi(),
-                                  m_streams[i],
-                                  block_size);
-                }
-            else
-                {
-                // effectively destroy the lbvh
-                m_lbvhs[i]->build(d_pos.data,
-                                  NULL,
-                                  0,
-                                  lbvh_box.getLo(),
-                                  lbvh_box.getHi(),
-                                  m_streams[i],
-                                  block_size);
-                }
+            const unsigned int N = m_tree_N[i];
+            m_lbvhs[i]->build(d_pos.data,
+                              (N > 0) ? d_sorted_indexes.data + m_tree_first[i] : NULL,
+                              N,
+                              lbvh_box.getLo(),
+                              lbvh_box.getHi(),
+                              m_streams[i],
+                              block_size);
             }
         m_build_tuner->end();
         // wait for all builds to finish
@@ -415,9 +394,6 @@ void NeighborListGPUTree::buildTree()
         // put particles in primitive order for traversal and compress the lbvhs so that the data is
         // ready for traversal
         {
-        ArrayHandle<unsigned int> h_type_first(m_type_first,
-                                               access_location::host,
-                                               access_mode::read);
         ArrayHandle<unsigned int> d_traverse_order(m_traverse_order,
                                                    access_location::device,
                                                    access_mode::overwrite);
@@ -425,12 +401,12 @@ void NeighborListGPUTree::buildTree()
                                                    access_location::device,
                                                    access_mode::read);
 
-        for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+        for (unsigned int i = 0; i < m_tree_N.size(); ++i)
             {
             const unsigned int Ni = m_lbvhs[i]->getN();
             if (Ni > 0)
                 {
-                const unsigned int first = h_type_first.data[i];
+                const unsigned int first = m_tree_first[i];
                 auto d_primitives = m_lbvhs[i]->getPrimitives();
                 m_copy_tuner->begin();
                 kernel::gpu_nlist_copy_primitives(d_traverse_order.data + first,
@@ -447,11 +423,11 @@ void NeighborListGPUTree::buildTree()
         // loops are not fused to avoid streams or syncing in kernel loop above, but could be done
         // if necessary
         hipDeviceSynchronize();
-        for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+        for (unsigned int i = 0; i < m_tree_N.size(); ++i)
             {
             if (m_lbvhs[i]->getN() == 0)
                 continue;
-            m_traversers[i]->setup(d_sorted_indexes.data + h_type_first.data[i],
+            m_traversers[i]->setup(d_sorted_indexes.data + m_tree_first[i],
                                    *(m_lbvhs[i]->get()),
                                    m_streams[i]);
             }
@@ -459,6 +435,83 @@ void NeighborListGPUTree::buildTree()
         }
     }
 
+/*!
+ * A single LBVH of all particles is used when every type searches all types with one radius, so
+ * nothing would be gained by splitting the particles by type. It is also used when there are few
+ * particles of each type on average, where launching the per-type builds and traversals costs more
+ * than searching the larger volume. Otherwise, one LBVH is built per type.
+ *
+ * The largest search radius of each type is also computed for the single LBVH.
+ */
+void NeighborListGPUTree::chooseTrees()
+    {
+    const unsigned int ntypes = m_pdata->getNTypes();
+    ArrayHandle<unsigned int> h_type_first(m_type_first, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_type_last(m_type_last, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_type_rlist(m_type_rlist, access_location::host, access_mode::overwrite);
+
+    // particles that are not sentinels are sorted first
+    unsigned int N_tree = 0;
+    unsigned int n_populated_types = 0;
+    bool uniform = true;
+    for (unsigned int i = 0; i < ntypes; ++i)
+        {
+        if (h_type_first.data[i] == kernel::NeighborListTypeSentinel)
+            {
+            h_type_rlist.data[i] = Scalar(0);
+            continue;
+            }
+        N_tree = std::max(N_tree, h_type_last.data[i]);
+        ++n_populated_types;
+
+        // only types that have particles are in the lbvh
+        Scalar r_listsq_max(0);
+        for (unsigned int j = 0; j < ntypes; ++j)
+            {
+            if (h_type_first.data[j] != kernel::NeighborListTypeSentinel)
+                r_listsq_max = std::max(r_listsq_max, h_r_listsq.data[m_typpair_idx(i, j)]);
+            }
+        h_type_rlist.data[i] = slow::sqrt(r_listsq_max);
+
+        for (unsigned int j = 0; j < ntypes; ++j)
+            {
+            const Scalar r_listsq = h_r_listsq.data[m_typpair_idx(i, j)];
+            if (h_type_first.data[j] != kernel::NeighborListTypeSentinel && r_listsq > Scalar(0)
+                && r_listsq != r_listsq_max)
+                uniform = false;
+            }
+        }
+
+    m_single_tree = n_populated_types > 1
+                    && (uniform || N_tree < single_tree_max_per_type * n_populated_types);
+
+    if (m_single_tree)
+        {
+        m_tree_first.assign(1, 0);
+        m_tree_N.assign(1, N_tree);
+        }
+    else
+        {
+        m_tree_first.resize(ntypes);
+        m_tree_N.resize(ntypes);
+        for (unsigned int i = 0; i < ntypes; ++i)
+            {
+            const unsigned int first = h_type_first.data[i];
+            if (first != kernel::NeighborListTypeSentinel)
+                {
+                m_tree_first[i] = first;
+                m_tree_N[i] = h_type_last.data[i] - first;
+                }
+            else
+                {
+                m_tree_first[i] = 0;
+                m_tree_N[i] = 0;
+                }
+            }
+        }
+    }
+
 /*!
  * Traversal is performed for each particle type against all LBVHs. This is done using one CUDA
  * stream for each particle type, and traversal of each LBVH is loaded into the stream so that there
@@ -466,6 +519,8 @@ void NeighborListGPUTree::buildTree()
  * calls on the host. For efficiency, body filtering is templated out, and the correct template is
  * selected at dispatch.
  *
+ * A single LBVH of all types is traversed once by all particles, using the search radii by type.
+ *
  * As for the build, I note that the use of autotuners in neighbor should break concurrency, since
  * these CUDA timing events are placed in the default stream. This might be reconsidered in future
  * if HOOMD makes more use of CUDA streams anywhere.
@@ -497,7 +552,16 @@ void NeighborListGPUTree::traverseTree()
     ArrayHandle<Scalar3> d_image_list(m_image_list, access_location::device, access_mode::read);
 
     ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::read);
+
+    ArrayHandle<unsigned int> d_n_ex_idx(m_n_ex_idx, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_ex_mask_idx(m_ex_mask_idx,
+                                            access_location::device,
+                                            access_mode::read);
+    ArrayHandle<unsigned int> d_ex_list_idx(m_ex_list_idx,
+                                            access_location::device,
+                                            access_mode::read);
+    const kernel::nlist_exclusions_t ex
+        = getBuildExclusions(d_n_ex_idx, d_ex_mask_idx, d_ex_list_idx);
 
     // clear the neighbor counts
     hipMemset(d_n_neigh.data, 0, sizeof(unsigned int) * m_pdata->getN());
@@ -508,13 +572,52 @@ void NeighborListGPUTree::traverseTree()
     hipDeviceSynchronize();
     m_traverse_tuner->begin();
     const unsigned int block_size = m_traverse_tuner->getParam()[0];
-    for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+    if (m_single_tree && m_lbvhs[0]->getN() > 0)
+        {
+        ArrayHandle<Scalar> d_type_rlist(m_type_rlist, access_location::device, access_mode::read);
+        ArrayHandle<Scalar> d_r_listsq(m_r_listsq, access_location::device, access_mode::read);
+        ArrayHandle<unsigned int> d_Nmax(m_Nmax, access_location::device, access_mode::read);
+
+        kernel::LBVHTraverserWrapper::TraverserArgs args;
+        args.map = d_sorted_indexes.data;
+
+        args.positions = d_pos.data;
+        args.bodies = (m_filter_body) ? d_body.data : NULL;
+        args.order = d_traverse_order.data;
+        args.N = m_lbvhs[0]->getN();
+        args.Nown = m_pdata->getN();
+        args.rcut = m_rcut_max_max + m_r_buff;
+        args.rlist = args.rcut;
+        args.box = box;
+        args.ex = ex;
+
+        // the overflow flags and the maximum number of neighbors are read by type
+        args.neigh_list = d_nlist.data;
+        args.nneigh = d_n_neigh.data;
+        args.new_max_neigh = d_conditions.data;
+        args.first_neigh = d_head_list.data;
+        args.max_neigh = 0;
+
+        args.type_rlist = d_type_rlist.data;
+        args.r_listsq = d_r_listsq.data;
+        args.typpair_idx = m_typpair_idx;
+        args.type_max_neigh = d_Nmax.data;
+
+        m_traversers[0]->traverse(args,
+                                  *(m_lbvhs[0]->get()),
+                                  d_image_list.data,
+                                  (unsigned int)m_image_list.getNumElements(),
+                                  m_streams[0],
+                                  block_size);
+        }
+    for (unsigned int i = 0; i < m_pdata->getNTypes() && !m_single_tree; ++i)
         {
         // skip this type if there are no particles
         const unsigned int first = h_type_first.data[i];
         if (first == kernel::NeighborListTypeSentinel)
             continue;
         const unsigned int Ni = h_type_last.data[i] - first;
+        ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::read);
 
         // traverse it against all trees, using the same stream for type i to avoid race conditions
         // on writing
@@ -553,6 +656,7 @@ void NeighborListGPUTree::traverseTree()
             args.rcut = rcut;
             args.rlist = rlist;
             args.box = box;
+            args.ex = ex;
 
             // neighbor list write op for this type
             args.neigh_list = d_nlist.data;
@@ -560,6 +664,9 @@ void NeighborListGPUTree::traverseTree()
             args.new_max_neigh = d_conditions.data + i;
             args.first_neigh = d_head_list.data;
             args.max_neigh = h_Nmax.data[i];
+            args.type_rlist = NULL;
+            args.r_listsq = NULL;
+            args.type_max_neigh = NULL;
 
             m_traversers[j]->traverse(args,
                                       *(m_lbvhs[j]->get()),
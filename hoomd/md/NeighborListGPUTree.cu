@@ -462,6 +462,8 @@ template<bool use_body> struct ParticleQueryOp
      * \param Nown_ Number of locally owned particles.
      * \param rcut_ Cutoff radius for the spheres.
      * \param rlist_ Total search radius for the spheres (differs under shifting).
+     * \param box_ Local simulation box.
+     * \param ex_ Exclusions to skip.
      */
     ParticleQueryOp(const Scalar4* positions_,
                     const unsigned int* bodies_,
@@ -470,9 +472,10 @@ template<bool use_body> struct ParticleQueryOp
                     unsigned int Nown_,
                     const Scalar rcut_,
                     const Scalar rlist_,
-                    const BoxDim& box_)
+                    const BoxDim& box_,
+                    const nlist_exclusions_t& ex_)
         : positions(positions_), bodies(bodies_), map(map_), N(N_), Nown(Nown_), rcut(rcut_),
-          rlist(rlist_), box(box_)
+          rlist(rlist_), box(box_), ex(ex_)
         {
         }
 
@@ -557,7 +560,7 @@ template<bool use_body> struct ParticleQueryOp
      *
      * HOOMD's neighbor lists require additional filtering. This first ensures
      * that the overlap is not with itself. If body filtering is enabled,
-     * particles in the same body do not overlap.
+     * particles in the same body do not overlap. Excluded particles never overlap.
      */
     DEVICE bool refine(const ThreadData& q, const int primitive) const
         {
@@ -570,6 +573,9 @@ template<bool use_body> struct ParticleQueryOp
             exclude |= (q.body == body);
             }
 
+        if (!exclude)
+            exclude = ex.isExcluded((unsigned int)q.idx, (unsigned int)primitive);
+
         return !exclude;
         }
 
@@ -579,14 +585,109 @@ template<bool use_body> struct ParticleQueryOp
         return N;
         }
 
-    const Scalar4* positions;   //!< Particle positions
-    const unsigned int* bodies; //!< Particle bodies
-    const unsigned int* map;    //!< Mapping of particles to read
-    unsigned int N;             //!< Total number of particles in map
-    unsigned int Nown;          //!< Number of particles owned by the local rank
-    Scalar rcut;                //!< True cutoff radius + buffer
-    Scalar rlist;               //!< Maximum cutoff (may include shifting)
-    const BoxDim box;           //!< Box dimensions
+    const Scalar4* positions;    //!< Particle positions
+    const unsigned int* bodies;  //!< Particle bodies
+    const unsigned int* map;     //!< Mapping of particles to read
+    unsigned int N;              //!< Total number of particles in map
+    unsigned int Nown;           //!< Number of particles owned by the local rank
+    Scalar rcut;                 //!< True cutoff radius + buffer
+    Scalar rlist;                //!< Maximum cutoff (may include shifting)
+    const BoxDim box;            //!< Box dimensions
+    const nlist_exclusions_t ex; //!< Exclusions to skip
+    };
+
+//! Neighbor list particle query operation for one LBVH of all types.
+/*!
+ * \tparam use_body If true, use the body fields during query.
+ *
+ * Each sphere is given the largest search radius of its type, and the intersected primitives are
+ * refined with the search radius of the type pair. The distance is taken with the minimum image
+ * convention because the image that the primitive was found through is not known in the
+ * refinement.
+ */
+template<bool use_body> struct TypedParticleQueryOp : public ParticleQueryOp<use_body>
+    {
+    //! Constructor
+    /*!
+     * \param positions_ Particle positions.
+     * \param bodies_ Particle body tags.
+     * \param map_ Map of the particle indexes to traverse.
+     * \param N_ Number of particles (total).
+     * \param Nown_ Number of locally owned particles.
+     * \param type_rlist_ Largest search radius of each type.
+     * \param r_listsq_ Search radius squared of each type pair (0 if turned off).
+     * \param typpair_idx_ Indexer for the type pairs.
+     * \param box_ Local simulation box.
+     * \param ex_ Exclusions to skip.
+     */
+    TypedParticleQueryOp(const Scalar4* positions_,
+                         const unsigned int* bodies_,
+                         const unsigned int* map_,
+                         unsigned int N_,
+                         unsigned int Nown_,
+                         const Scalar* type_rlist_,
+                         const Scalar* r_listsq_,
+                         const Index2D& typpair_idx_,
+                         const BoxDim& box_,
+                         const nlist_exclusions_t& ex_)
+        : ParticleQueryOp<use_body>(positions_, bodies_, map_, N_, Nown_, 0, 0, box_, ex_),
+          type_rlist(type_rlist_), pair_r_listsq(r_listsq_), typpair_idx(typpair_idx_)
+        {
+        }
+
+    //! Data stored per thread for traversal, including the particle type
+    struct ThreadData : public ParticleQueryOp<use_body>::ThreadData
+        {
+        DEVICE ThreadData(Scalar3 position_, int idx_, unsigned int body_, unsigned int type_)
+            : ParticleQueryOp<use_body>::ThreadData(position_, idx_, body_), type(type_)
+            {
+            }
+
+        unsigned int type; //!< Particle type
+        };
+
+    typedef typename ParticleQueryOp<use_body>::Volume Volume;
+
+    //! Loads the per-thread data
+    DEVICE ThreadData setup(const unsigned int idx) const
+        {
+        const unsigned int pidx = this->map[idx];
+
+        const Scalar4 position = this->positions[pidx];
+        const Scalar3 r = make_scalar3(position.x, position.y, position.z);
+
+        unsigned int body(0xffffffff);
+        if (use_body)
+            {
+            body = __ldg(this->bodies + pidx);
+            }
+
+        return ThreadData(r, pidx, body, __scalar_as_int(position.w));
+        }
+
+    //! Return the traversal volume subject to a translation
+    DEVICE Volume get(const ThreadData& q, const Scalar3& image) const
+        {
+        return Volume(q.position + image, (q.idx < this->Nown) ? __ldg(type_rlist + q.type) : -1.0);
+        }
+
+    //! Refine the rough overlap test with the search radius of the type pair
+    DEVICE bool refine(const ThreadData& q, const int primitive) const
+        {
+        if (!ParticleQueryOp<use_body>::refine(q, primitive))
+            return false;
+
+        const Scalar4 postype = this->positions[primitive];
+        const Scalar r_listsq
+            = __ldg(pair_r_listsq + typpair_idx(q.type, __scalar_as_int(postype.w)));
+        const Scalar3 dr
+            = this->box.minImage(q.position - make_scalar3(postype.x, postype.y, postype.z));
+        return r_listsq > Scalar(0) && dot(dr, dr) <= r_listsq;
+        }
+
+    const Scalar* type_rlist;    //!< Largest search radius of each type
+    const Scalar* pair_r_listsq; //!< Search radius squared of each type pair
+    const Index2D typpair_idx;   //!< Indexer for the type pairs
     };
 
 //! Operation to write the neighbor list
@@ -702,7 +803,27 @@ struct NeighborListOp
      */
     DEVICE void process(ThreadData& t, const int primitive) const
         {
-        if (t.num_neigh < max_neigh)
+        push(t, primitive, max_neigh);
+        }
+
+    //! Finish the output job once the thread is ready to terminate.
+    /*!
+     * \param t My output thread data
+     *
+     * The number of neighbors found for this thread is written. If this value
+     * exceeds the current allocation, this value is atomically maximized for
+     * reallocation. Any values remaining on the stack are written to ensure the
+     * list is complete.
+     */
+    DEVICE void finalize(const ThreadData& t) const
+        {
+        finish(t, max_neigh, new_max_neigh);
+        }
+
+    //! Push a neighbor onto the stack, writing the stack if it is full
+    DEVICE void push(ThreadData& t, const int primitive, const unsigned int max) const
+        {
+        if (t.num_neigh < max)
             {
             // push primitive into the stack of 4, pre-increment
             const unsigned int offset = t.num_neigh % 4;
@@ -717,21 +838,14 @@ struct NeighborListOp
         ++t.num_neigh;
         }
 
-    //! Finish the output job once the thread is ready to terminate.
-    /*!
-     * \param t My output thread data
-     *
-     * The number of neighbors found for this thread is written. If this value
-     * exceeds the current allocation, this value is atomically maximized for
-     * reallocation. Any values remaining on the stack are written to ensure the
-     * list is complete.
-     */
-    DEVICE void finalize(const ThreadData& t) const
+    //! Write the number of neighbors and the rest of the stack
+    DEVICE void
+    finish(const ThreadData& t, const unsigned int max, unsigned int* new_max) const
         {
         nneigh[t.idx] = t.num_neigh;
-        if (t.num_neigh > max_neigh)
+        if (t.num_neigh > max)
             {
-            atomicMax(new_max_neigh, t.num_neigh);
+            atomicMax(new_max, t.num_neigh);
             }
         else if (t.num_neigh % 4 != 0)
             {
@@ -750,6 +864,67 @@ struct NeighborListOp
     unsigned int max_neigh;      //!< Maximum number of neighbors allocated
     };
 
+//! Operation to write the neighbor list for particles of all types
+/*!
+ * The neighbor list is written like in NeighborListOp, but the maximum number of neighbors and the
+ * overflow flag are taken from the type of each particle. The query data must have the type.
+ */
+struct TypedNeighborListOp : public NeighborListOp
+    {
+    //! Constructor
+    /*!
+     * \param neigh_list_ Neighbor list (aligned to multiple of 4)
+     * \param nneigh_ Neighbor of neighbors per particle
+     * \param new_max_neigh_ Maximum number of neighbors to allocate per type if overflow occurs.
+     * \param first_neigh_ First index for the current particle index in the neighbor list.
+     * \param type_max_neigh_ Maximum number of neighbors to allow per particle of each type.
+     */
+    TypedNeighborListOp(unsigned int* neigh_list_,
+                        unsigned int* nneigh_,
+                        unsigned int* new_max_neigh_,
+                        const size_t* first_neigh_,
+                        const unsigned int* type_max_neigh_)
+        : NeighborListOp(neigh_list_, nneigh_, new_max_neigh_, first_neigh_, 0),
+          type_max_neigh(type_max_neigh_)
+        {
+        }
+
+    //! Thread-local data, including the type and its maximum number of neighbors
+    struct ThreadData : public NeighborListOp::ThreadData
+        {
+        DEVICE ThreadData(const NeighborListOp::ThreadData& t,
+                          const unsigned int type_,
+                          const unsigned int max_neigh_)
+            : NeighborListOp::ThreadData(t), type(type_), max_neigh(max_neigh_)
+            {
+            }
+
+        unsigned int type;      //!< Type of the particle
+        unsigned int max_neigh; //!< Maximum number of neighbors of the type
+        };
+
+    //! Setup the thread data
+    template<class QueryDataT>
+    DEVICE ThreadData setup(const unsigned int idx, const QueryDataT& q) const
+        {
+        return ThreadData(NeighborListOp::setup(idx, q), q.type, __ldg(type_max_neigh + q.type));
+        }
+
+    //! Processes a newly intersected primitive.
+    DEVICE void process(ThreadData& t, const int primitive) const
+        {
+        push(t, primitive, t.max_neigh);
+        }
+
+    //! Finish the output job once the thread is ready to terminate.
+    DEVICE void finalize(const ThreadData& t) const
+        {
+        finish(t, t.max_neigh, new_max_neigh + t.type);
+        }
+
+    const unsigned int* type_max_neigh; //!< Maximum number of neighbors per type
+    };
+
 //! Host function to convert a double to a float in round-down mode
 float double2float_rd(double x)
     {
@@ -894,6 +1069,9 @@ void LBVHTraverserWrapper::setup(const unsigned int* map, neighbor::LBVH& lbvh,
  * are determined by checking if the body data pointers
  * are NULL. It is the callers job to set rcut and rlist in the TraverserArgs
  * to compatible with those modes.
+ *
+ * If the per-type search radii are set, the LBVH holds particles of all types and it is
+ * traversed by particles of all types at once with TypedParticleQueryOp and TypedNeighborListOp.
  */
 void LBVHTraverserWrapper::traverse(TraverserArgs& args,
                                     neighbor::LBVH& lbvh,
@@ -912,7 +1090,54 @@ void LBVHTraverserWrapper::traverse(TraverserArgs& args,
 
     neighbor::ImageListOp<Scalar3> translate(images, Nimages);
 
-    if (args.bodies == NULL)
+    // one traversal of all types
+    if (args.type_rlist != NULL)
+        {
+        TypedNeighborListOp typed_nlist_op(args.neigh_list,
+                                           args.nneigh,
+                                           args.new_max_neigh,
+                                           args.first_neigh,
+                                           args.type_max_neigh);
+        if (args.bodies == NULL)
+            {
+            TypedParticleQueryOp<false> query(args.positions,
+                                              NULL,
+                                              args.order,
+                                              args.N,
+                                              args.Nown,
+                                              args.type_rlist,
+                                              args.r_listsq,
+                                              args.typpair_idx,
+                                              args.box,
+                                              args.ex);
+            trav_->traverse(neighbor::LBVHTraverser::LaunchParameters(block_size, stream),
+                            lbvh,
+                            query,
+                            typed_nlist_op,
+                            translate,
+                            map);
+            }
+        else
+            {
+            TypedParticleQueryOp<true> query(args.positions,
+                                             args.bodies,
+                                             args.order,
+                                             args.N,
+                                             args.Nown,
+                                             args.type_rlist,
+                                             args.r_listsq,
+                                             args.typpair_idx,
+                                             args.box,
+                                             args.ex);
+            trav_->traverse(neighbor::LBVHTraverser::LaunchParameters(block_size, stream),
+                            lbvh,
+                            query,
+                            typed_nlist_op,
+                            translate,
+                            map);
+            }
+        }
+    else if (args.bodies == NULL)
         {
         ParticleQueryOp<false> query(args.positions,
                                      NULL,
@@ -921,7 +1146,8 @@ void LBVHTraverserWrapper::traverse(TraverserArgs& args,
                                      args.Nown,
                                      args.rcut,
                                      args.rlist,
-                                     args.box);
+                                     args.box,
+                                     args.ex);
         trav_->traverse(neighbor::LBVHTraverser::LaunchParameters(block_size, stream),
                         lbvh,
                         query,
@@ -938,7 +1164,8 @@ void LBVHTraverserWrapper::traverse(TraverserArgs& args,
                                     args.Nown,
                                     args.rcut,
                                     args.rlist,
-                                    args.box);
+                                    args.box,
+                                    args.ex);
         trav_->traverse(neighbor::LBVHTraverser::LaunchParameters(block_size, stream),
                         lbvh,
                         query,
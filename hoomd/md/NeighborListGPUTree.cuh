@@ -14,6 +14,8 @@
 #include "hoomd/Index1D.h"
 #include "hoomd/ParticleData.cuh"
 
+#include "NeighborListGPU.cuh"
+
 // forward declaration
 namespace neighbor
     {
@@ -148,6 +150,15 @@ class LBVHTraverserWrapper
         unsigned int* new_max_neigh;
         size_t* first_neigh;
         unsigned int max_neigh;
+
+        // per-type search radii, only set to traverse all types at once
+        Scalar* type_rlist;
+        Scalar* r_listsq;
+        Index2D typpair_idx;
+        unsigned int* type_max_neigh;
+
+        // exclusions to skip
+        nlist_exclusions_t ex;
         };
 
     //! Constructor
@@ -31,6 +31,12 @@ namespace md
  * to construct the neighbor lists. To support large numbers of types, this traversal is
  * done using one CUDA stream per type to try to improve concurrency.
  *
+ * When the type pairs have the same search radius, or there are only a few particles of each
+ * type, a single LBVH of all particles is built instead and traversed once by all particles. Each
+ * particle then searches with the largest radius of its type, and the neighbors are filtered by
+ * the search radius of the type pair. This replaces the per-type builds and the N^2 traversals
+ * with one of each.
+ *
  * The other jobs of this class are then to preprocess the particle data into a format suitable
  * for building one LBVH per-type. This mainly means sorting the particles by type. In MPI
  * simulations, this sorting can also be used to efficiently filter out ghosts that lie outside the
@@ -67,6 +73,14 @@ class PYBIND11_EXPORT NeighborListGPUTree : public NeighborListGPU
     GPUArray<unsigned int> m_type_first; //!< First index of each particle type in sorted list
     GPUArray<unsigned int> m_type_last;  //!< Last index of each particle type in sorted list
 
+    bool m_single_tree;                    //!< If true, build one LBVH of all types
+    std::vector<unsigned int> m_tree_first; //!< First index of each LBVH in sorted list
+    std::vector<unsigned int> m_tree_N;     //!< Number of particles in each LBVH
+    GPUArray<Scalar> m_type_rlist;         //!< Largest search radius of each type
+
+    //! Largest mean number of particles per type to build one LBVH of all types
+    static const unsigned int single_tree_max_per_type = 1024;
+
     GPUFlags<unsigned int> m_lbvh_errors; //!< Error flags during particle marking (e.g., off rank)
     std::vector<std::unique_ptr<kernel::LBVHWrapper>> m_lbvhs; //!< Array of LBVHs per-type
     std::vector<std::unique_ptr<kernel::LBVHTraverserWrapper>>
@@ -77,6 +91,9 @@ class PYBIND11_EXPORT NeighborListGPUTree : public NeighborListGPU
     unsigned int m_n_images;                 //!< Number of translation vectors for traversal
     GPUArray<unsigned int> m_traverse_order; //!< Order to traverse primitives
 
+    //! Choose whether to build one LBVH per type or one of all types
+    void chooseTrees();
+
     //! Build the LBVHs using the neighbor library
     void buildTree();
 
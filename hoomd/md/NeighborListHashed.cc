@@ -0,0 +1,197 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file NeighborListHashed.cc
+    \brief Defines NeighborListHashed
+*/
+
+#include "NeighborListHashed.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+NeighborListHashed::NeighborListHashed(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff)
+    : NeighborList(sysdef, r_buff)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing NeighborListHashed" << endl;
+    }
+
+NeighborListHashed::~NeighborListHashed()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying NeighborListHashed" << endl;
+    }
+
+/*! The cells are sized from the current cutoffs and box on every build since, unlike the full
+    cell list, there is no storage tied to the number of cells.
+*/
+void NeighborListHashed::binParticles()
+    {
+    const BoxDim& box = m_pdata->getBox();
+    m_indexer
+        = HashedCellIndexer(box, getMaxRCut() + m_r_buff, m_sysdef->getNDimensions() == 2);
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    const unsigned int N = m_pdata->getN() + m_pdata->getNGhosts();
+    m_particle_keys.resize(N);
+    for (unsigned int i = 0; i < N; ++i)
+        {
+        const Scalar4 postype = h_pos.data[i];
+        const Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+        m_particle_keys[i] = make_pair(m_indexer.getKey(m_indexer.getCell(box.makeFraction(pos))),
+                                       i);
+        }
+    // sorting by the pair also orders the particles in each cell, so the list is deterministic
+    std::sort(m_particle_keys.begin(), m_particle_keys.end());
+
+    m_cells.clear();
+    m_cells.reserve(N);
+    for (unsigned int i = 0; i < N;)
+        {
+        const uint64_t key = m_particle_keys[i].first;
+        unsigned int last = i + 1;
+        while (last < N && m_particle_keys[last].first == key)
+            ++last;
+        m_cells[key] = make_uint2(i, last);
+        i = last;
+        }
+    }
+
+void NeighborListHashed::buildNlist(uint64_t timestep)
+    {
+    binParticles();
+
+    // acquire the particle data and box dimension
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                     access_location::host,
+                                     access_mode::read);
+
+    const BoxDim& box = m_pdata->getBox();
+
+    // access the rlist data
+    ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
+
+    // access the neighbor list data
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_conditions(m_conditions,
+                                           access_location::host,
+                                           access_mode::readwrite);
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::overwrite);
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::overwrite);
+
+    // offsets to the neighboring cells
+    int3 lo, hi;
+    m_indexer.getStencil(lo, hi);
+    std::vector<int3> stencil;
+    for (int k = lo.z; k <= hi.z; ++k)
+        for (int j = lo.y; j <= hi.y; ++j)
+            for (int l = lo.x; l <= hi.x; ++l)
+                stencil.push_back(make_int3(l, j, k));
+
+    // for each local particle
+    unsigned int nparticles = m_pdata->getN();
+
+    for (int i = 0; i < (int)nparticles; i++)
+        {
+        unsigned int cur_n_neigh = 0;
+
+        const Scalar3 my_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+        const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+        const unsigned int body_i = h_body.data[i];
+
+        const unsigned int Nmax_i = h_Nmax.data[type_i];
+        const size_t head_idx_i = h_head_list.data[i];
+
+        // loop through all neighboring bins that have particles
+        const int3 my_cell = m_indexer.getCell(box.makeFraction(my_pos));
+        for (const int3& offset : stencil)
+            {
+            const int3 neigh_cell = m_indexer.wrap(
+                make_int3(my_cell.x + offset.x, my_cell.y + offset.y, my_cell.z + offset.z));
+            auto cell = m_cells.find(m_indexer.getKey(neigh_cell));
+            if (cell == m_cells.end())
+                continue;
+
+            // check against all the particles in that neighboring bin to see if it is a neighbor
+            for (unsigned int cur_offset = cell->second.x; cur_offset < cell->second.y;
+                 cur_offset++)
+                {
+                unsigned int cur_neigh = m_particle_keys[cur_offset].second;
+                const Scalar4 neigh_postype = h_pos.data[cur_neigh];
+                unsigned int cur_neigh_type = __scalar_as_int(neigh_postype.w);
+                Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, cur_neigh_type)];
+
+                // automatically exclude particles without a distance check when:
+                // (1) they are the same particle, or
+                // (2) the r_cut(i,j) indicates to skip, or
+                // (3) they are in the same body
+                bool excluded = ((i == (int)cur_neigh) || (r_cut <= Scalar(0.0)));
+                if (m_filter_body && body_i != NO_BODY)
+                    excluded = excluded | (body_i == h_body.data[cur_neigh]);
+                if (excluded)
+                    continue;
+
+                Scalar3 neigh_pos = make_scalar3(neigh_postype.x, neigh_postype.y, neigh_postype.z);
+                Scalar3 dx = my_pos - neigh_pos;
+                dx = box.minImage(dx);
+
+                Scalar dr_sq = dot(dx, dx);
+
+                Scalar r_listsq = h_r_listsq.data[m_typpair_idx(type_i, cur_neigh_type)];
+                if (dr_sq <= r_listsq)
+                    {
+                    // Add the neighbor index to the list.
+                    if (m_storage_mode == full || i < (int)cur_neigh)
+                        {
+                        if (cur_n_neigh < Nmax_i)
+                            {
+                            h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
+                            }
+                        else
+                            h_conditions.data[type_i]
+                                = max(h_conditions.data[type_i], cur_n_neigh + 1);
+
+                        cur_n_neigh++;
+                        }
+                    }
+                }
+            }
+
+        h_n_neigh.data[i] = cur_n_neigh;
+        }
+    }
+
+namespace detail
+    {
+void export_NeighborListHashed(pybind11::module& m)
+    {
+    pybind11::class_<NeighborListHashed, NeighborList, std::shared_ptr<NeighborListHashed>>(
+        m,
+        "NeighborListHashed")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
+        .def("getDim",
+             &NeighborListHashed::getDim,
+             pybind11::return_value_policy::reference_internal)
+        .def("getNumOccupiedCells", &NeighborListHashed::getNumOccupiedCells)
+        .def_property(
+            "quantization",
+            [](const NeighborListHashed& self) { return 0u; },
+            [](NeighborListHashed& self, unsigned int bits)
+            {
+                if (bits != 0)
+                    throw std::runtime_error(
+                        "Quantized neighbor list coordinates require a GPU device.");
+            });
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,81 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "HashedCellIndexer.h"
+#include "NeighborList.h"
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*! \file NeighborListHashed.h
+    \brief Declares the NeighborListHashed class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __NEIGHBORLISTHASHED_H__
+#define __NEIGHBORLISTHASHED_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Neighbor list build on the CPU using a hashed cell list
+/*! The particles (including ghosts) are binned into cells that are at least as wide as the
+    largest list cutoff, like NeighborListBinned. Instead of allocating every cell of the box, the
+    particles are sorted by the Morton key of their cell (see HashedCellIndexer), and only the
+    occupied cells are stored in a hash table that maps the key to the range of particles in that
+    cell. The memory scales with the number of particles rather than with the volume of the box,
+    which is much smaller for dilute systems (e.g., solute particles embedded in a large MPCD
+    solvent).
+
+    Neighbors are found by looking up the 27 (9 in 2D) cells around each particle's cell.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT NeighborListHashed : public NeighborList
+    {
+    public:
+    //! Constructs the compute
+    NeighborListHashed(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff);
+
+    //! Destructor
+    virtual ~NeighborListHashed();
+
+    /// Get the dimensions of the (virtual) cell grid
+    const uint3& getDim() const
+        {
+        return m_indexer.dim;
+        }
+
+    /// Get the number of occupied cells in the last build
+    unsigned int getNumOccupiedCells() const
+        {
+        return static_cast<unsigned int>(m_cells.size());
+        }
+
+    protected:
+    //! Builds the neighbor list
+    virtual void buildNlist(uint64_t timestep);
+
+    //! Bin the particles into the occupied cells
+    void binParticles();
+
+    HashedCellIndexer m_indexer; //!< Indexer of the cells in the last build
+
+    /// Key of the cell and index of each particle, sorted by key
+    std::vector<std::pair<uint64_t, unsigned int>> m_particle_keys;
+
+    /// First and last+1 entry in m_particle_keys of each occupied cell
+    std::unordered_map<uint64_t, uint2> m_cells;
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __NEIGHBORLISTHASHED_H__
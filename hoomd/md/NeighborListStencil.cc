@@ -11,6 +11,9 @@
 #include "hoomd/Communicator.h"
 #endif
 
+#include <algorithm>
+#include <limits>
+
 using namespace std;
 
 namespace hoomd
@@ -19,23 +22,14 @@ namespace md
     {
 /*!
  * \param sysdef System definition
- * \param r_cut Default cutoff radius
  * \param r_buff Neighbor list buffer width
- * \param cl Cell list
- * \param cls Cell list stencil
  *
- * A default cell list and stencil will be constructed if \a cl or \a cls are not instantiated.
+ * The cell lists are set up on the first build, when the cutoffs are known.
  */
 NeighborListStencil::NeighborListStencil(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff)
-    : NeighborList(sysdef, r_buff), m_cl(std::make_shared<CellList>(sysdef)),
-      m_cls(std::make_shared<CellListStencil>(sysdef, m_cl))
+    : NeighborList(sysdef, r_buff)
     {
     m_exec_conf->msg->notice(5) << "Constructing NeighborListStencil" << endl;
-
-    m_cl->setRadius(1);
-    m_cl->setComputeTypeBody(true);
-    m_cl->setFlagIndex();
-    m_cl->setComputeAdjList(false);
     }
 
 NeighborListStencil::~NeighborListStencil()
@@ -43,38 +37,139 @@ NeighborListStencil::~NeighborListStencil()
     m_exec_conf->msg->notice(5) << "Destroying NeighborListStencil" << endl;
     }
 
-void NeighborListStencil::updateRStencil()
+/*!
+ * The types are sorted by the shortest cutoff that they have with any type, and a new class is
+ * started whenever that cutoff exceeds size_class_ratio times the shortest cutoff of the current
+ * class. All types share one cell list, as before, when the user sets the cell width or when there
+ * is only one class.
+ */
+void NeighborListStencil::updateCellLists()
     {
-    ArrayHandle<Scalar> h_rcut_max(m_rcut_max, access_location::host, access_mode::read);
-    std::vector<Scalar> rstencil(m_pdata->getNTypes(), -1.0);
-    for (unsigned int cur_type = 0; cur_type < m_pdata->getNTypes(); ++cur_type)
+    const unsigned int ntypes = m_pdata->getNTypes();
+    std::vector<std::vector<unsigned int>> class_types;
+    std::vector<Scalar> class_width;
+    if (m_cell_width > Scalar(0))
+        {
+        class_types.resize(1);
+        class_width.push_back(m_cell_width);
+        }
+    else
+        {
+        // shortest cutoff of each type that interacts
+        ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+        std::vector<std::pair<Scalar, unsigned int>> rmin;
+        for (unsigned int type = 0; type < ntypes; ++type)
+            {
+            Scalar r = std::numeric_limits<Scalar>::max();
+            for (unsigned int other = 0; other < ntypes; ++other)
+                {
+                const Scalar r_cut = h_r_cut.data[m_typpair_idx(type, other)];
+                if (r_cut > Scalar(0.0))
+                    r = std::min(r, r_cut);
+                }
+            if (r < std::numeric_limits<Scalar>::max())
+                rmin.push_back(std::make_pair(r, type));
+            }
+        std::sort(rmin.begin(), rmin.end());
+
+        for (const auto& r_type : rmin)
+            {
+            if (class_width.empty()
+                || r_type.first + m_r_buff > size_class_ratio * class_width.back())
+                {
+                class_types.push_back(std::vector<unsigned int>());
+                class_width.push_back(r_type.first + m_r_buff);
+                }
+            class_types.back().push_back(r_type.second);
+            }
+
+        // one class of all types bins them without a type mask
+        if (class_types.size() <= 1)
+            {
+            class_types.assign(1, std::vector<unsigned int>());
+            class_width.assign(1, getMinRCut() + m_r_buff);
+            }
+        }
+
+    // reuse the existing cell lists, which keeps their memory
+    if (m_cl.size() != class_types.size())
+        {
+        m_exec_conf->msg->notice(6) << "nlist: binning the types into " << class_types.size()
+                                    << " cell lists" << endl;
+        }
+    while (m_cl.size() < class_types.size())
+        {
+        auto cl = std::make_shared<CellList>(m_sysdef);
+        cl->setRadius(1);
+        cl->setComputeTypeBody(true);
+        cl->setFlagIndex();
+        cl->setComputeAdjList(false);
+        cl->setSortCellList(m_deterministic);
+        m_cl.push_back(cl);
+        m_cls.push_back(std::make_shared<CellListStencil>(m_sysdef, cl));
+        }
+    m_cl.resize(class_types.size());
+    m_cls.resize(class_types.size());
+
+    for (unsigned int c = 0; c < class_types.size(); ++c)
         {
-        Scalar rcut = h_rcut_max.data[cur_type];
-        if (rcut > Scalar(0.0))
+        std::vector<bool> type_mask;
+        if (!class_types[c].empty())
             {
-            Scalar rlist = rcut + m_r_buff;
-            rstencil[cur_type] = rlist;
+            type_mask.assign(ntypes, false);
+            for (unsigned int type : class_types[c])
+                type_mask[type] = true;
             }
+        m_cl[c]->setTypeMask(type_mask);
+        m_cl[c]->setNominalWidth(class_width[c]);
         }
-    m_cls->setRStencil(rstencil);
+    m_class_types = class_types;
     }
 
-void NeighborListStencil::buildNlist(uint64_t timestep)
+/*!
+ * The stencil radius of a type in a class is its longest list radius with the types in that class.
+ */
+void NeighborListStencil::updateRStencil()
     {
-    if (m_update_cell_size)
+    ArrayHandle<Scalar> h_rcut_max(m_rcut_max, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+    const unsigned int ntypes = m_pdata->getNTypes();
+    for (unsigned int c = 0; c < m_cls.size(); ++c)
         {
-        // update the cell size if the user has not forced a specific size
-        if (!m_override_cell_width)
+        std::vector<Scalar> rstencil(ntypes, -1.0);
+        for (unsigned int cur_type = 0; cur_type < ntypes; ++cur_type)
             {
-            Scalar rmin = getMinRCut() + m_r_buff;
+            Scalar rcut = -1.0;
+            if (m_class_types[c].empty())
+                {
+                rcut = h_rcut_max.data[cur_type];
+                }
+            else
+                {
+                for (unsigned int other : m_class_types[c])
+                    rcut = std::max(rcut, h_r_cut.data[m_typpair_idx(cur_type, other)]);
+                }
 
-            m_cl->setNominalWidth(rmin);
+            if (rcut > Scalar(0.0))
+                {
+                Scalar rlist = rcut + m_r_buff;
+                rstencil[cur_type] = rlist;
+                }
             }
+        m_cls[c]->setRStencil(rstencil);
+        }
+    }
 
+void NeighborListStencil::buildNlist(uint64_t timestep)
+    {
+    if (m_update_cell_size)
+        {
+        updateCellLists();
         m_update_cell_size = false;
         }
 
-    m_cl->compute(timestep);
+    for (auto& cl : m_cl)
+        cl->compute(timestep);
 
     // update the stencil radii if there was a change
     if (m_needs_restencil)
@@ -82,10 +177,8 @@ void NeighborListStencil::buildNlist(uint64_t timestep)
         updateRStencil();
         m_needs_restencil = false;
         }
-    m_cls->compute(timestep);
-
-    uint3 dim = m_cl->getDim();
-    Scalar3 ghost_width = m_cl->getGhostWidth();
+    for (auto& cls : m_cls)
+        cls->compute(timestep);
 
     // acquire the particle data and box dimension
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
@@ -123,22 +216,6 @@ void NeighborListStencil::buildNlist(uint64_t timestep)
     // access the rlist data
     ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
 
-    // access the cell list data arrays
-    ArrayHandle<unsigned int> h_cell_size(m_cl->getCellSizeArray(),
-                                          access_location::host,
-                                          access_mode::read);
-    ArrayHandle<Scalar4> h_cell_xyzf(m_cl->getXYZFArray(),
-                                     access_location::host,
-                                     access_mode::read);
-    ArrayHandle<uint2> h_cell_type_body(m_cl->getTypeBodyArray(),
-                                        access_location::host,
-                                        access_mode::read);
-    ArrayHandle<Scalar4> h_stencil(m_cls->getStencils(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_n_stencil(m_cls->getStencilSizes(),
-                                          access_location::host,
-                                          access_mode::read);
-    const Index2D& stencil_idx = m_cls->getStencilIndexer();
-
     // access the neighbor list data
     ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
     ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::read);
@@ -148,157 +225,185 @@ void NeighborListStencil::buildNlist(uint64_t timestep)
     ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::overwrite);
     ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::overwrite);
 
-    // access indexers
-    Index3D ci = m_cl->getCellIndexer();
-    Index2D cli = m_cl->getCellListIndexer();
-
     // for each local particle
     unsigned int nparticles = m_pdata->getN();
+    memset(h_n_neigh.data, 0, sizeof(unsigned int) * nparticles);
 
-    for (int i = 0; i < (int)nparticles; i++)
+    // search the cell list of each size class in turn
+    for (unsigned int c = 0; c < m_cl.size(); ++c)
         {
-        unsigned int cur_n_neigh = 0;
-
-        const Scalar3 my_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
-        const unsigned int body_i = h_body.data[i];
-
-        const unsigned int Nmax_i = h_Nmax.data[type_i];
-        const size_t head_idx_i = h_head_list.data[i];
-
-        // find the bin each particle belongs in
-        Scalar3 f = box.makeFraction(my_pos, ghost_width);
-        int ib = (unsigned int)(f.x * dim.x);
-        int jb = (unsigned int)(f.y * dim.y);
-        int kb = (unsigned int)(f.z * dim.z);
-
-        // need to handle the case where the particle is exactly at the box hi
-        if (ib == (int)dim.x && periodic.x)
-            ib = 0;
-        if (jb == (int)dim.y && periodic.y)
-            jb = 0;
-        if (kb == (int)dim.z && periodic.z)
-            kb = 0;
-
-        // loop through all neighboring bins
-        unsigned int n_stencil = h_n_stencil.data[type_i];
-        for (unsigned int cur_stencil = 0; cur_stencil < n_stencil; ++cur_stencil)
+        uint3 dim = m_cl[c]->getDim();
+        Scalar3 ghost_width = m_cl[c]->getGhostWidth();
+
+        // access the cell list data arrays
+        ArrayHandle<unsigned int> h_cell_size(m_cl[c]->getCellSizeArray(),
+                                              access_location::host,
+                                              access_mode::read);
+        ArrayHandle<Scalar4> h_cell_xyzf(m_cl[c]->getXYZFArray(),
+                                         access_location::host,
+                                         access_mode::read);
+        ArrayHandle<uint2> h_cell_type_body(m_cl[c]->getTypeBodyArray(),
+                                            access_location::host,
+                                            access_mode::read);
+        ArrayHandle<Scalar4> h_stencil(m_cls[c]->getStencils(),
+                                       access_location::host,
+                                       access_mode::read);
+        ArrayHandle<unsigned int> h_n_stencil(m_cls[c]->getStencilSizes(),
+                                              access_location::host,
+                                              access_mode::read);
+        const Index2D& stencil_idx = m_cls[c]->getStencilIndexer();
+
+        // access indexers
+        Index3D ci = m_cl[c]->getCellIndexer();
+        Index2D cli = m_cl[c]->getCellListIndexer();
+
+        for (int i = 0; i < (int)nparticles; i++)
             {
-            // compute the stenciled cell cartesian coordinates
-            Scalar4 stencil = h_stencil.data[stencil_idx(cur_stencil, type_i)];
-            int sib = ib + __scalar_as_int(stencil.x);
-            int sjb = jb + __scalar_as_int(stencil.y);
-            int skb = kb + __scalar_as_int(stencil.z);
-            Scalar cell_dist2 = stencil.w;
-            // wrap through the boundary
-            if (periodic.x)
-                {
-                if (sib >= (int)dim.x)
-                    sib -= dim.x;
-                else if (sib < 0)
-                    sib += dim.x;
-
-                // wrapping and the stencil construction should ensure this is in bounds
-                assert(sib >= 0 && sib < (int)dim.x);
-                }
-            else if (sib < 0 || sib >= (int)dim.x)
-                {
-                // in aperiodic systems the stencil could maybe extend out of the grid
-                continue;
-                }
-
-            if (periodic.y)
-                {
-                if (sjb >= (int)dim.y)
-                    sjb -= dim.y;
-                else if (sjb < 0)
-                    sjb += dim.y;
-
-                assert(sjb >= 0 && sjb < (int)dim.y);
-                }
-            else if (sjb < 0 || sjb >= (int)dim.y)
-                {
-                continue;
-                }
-
-            if (periodic.z)
-                {
-                if (skb >= (int)dim.z)
-                    skb -= dim.z;
-                else if (skb < 0)
-                    skb += dim.z;
-
-                assert(skb >= 0 && skb < (int)dim.z);
-                }
-            else if (skb < 0 || skb >= (int)dim.z)
-                {
-                continue;
-                }
-
-            unsigned int neigh_cell = ci(sib, sjb, skb);
-
-            // check against all the particles in that neighboring bin to see if it is a neighbor
-            unsigned int size = h_cell_size.data[neigh_cell];
-            for (unsigned int cur_offset = 0; cur_offset < size; cur_offset++)
+            unsigned int cur_n_neigh = h_n_neigh.data[i];
+
+            const Scalar3 my_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+            const unsigned int body_i = h_body.data[i];
+
+            const unsigned int Nmax_i = h_Nmax.data[type_i];
+            const size_t head_idx_i = h_head_list.data[i];
+
+            // find the bin each particle belongs in
+            Scalar3 f = box.makeFraction(my_pos, ghost_width);
+            int ib = (unsigned int)(f.x * dim.x);
+            int jb = (unsigned int)(f.y * dim.y);
+            int kb = (unsigned int)(f.z * dim.z);
+
+            // need to handle the case where the particle is exactly at the box hi
+            if (ib == (int)dim.x && periodic.x)
+                ib = 0;
+            if (jb == (int)dim.y && periodic.y)
+                jb = 0;
+            if (kb == (int)dim.z && periodic.z)
+                kb = 0;
+
+            // loop through all neighboring bins
+            unsigned int n_stencil = h_n_stencil.data[type_i];
+            for (unsigned int cur_stencil = 0; cur_stencil < n_stencil; ++cur_stencil)
                 {
-                // read in the particle type (diameter and body as well while we've got the Scalar4
-                // in)
-                const uint2& neigh_type_body = h_cell_type_body.data[cli(cur_offset, neigh_cell)];
-                const unsigned int type_j = neigh_type_body.x;
-                const unsigned int body_j = neigh_type_body.y;
-
-                // skip any particles belonging to the same body if requested
-                if (m_filter_body && body_i != NO_BODY && body_i == body_j)
-                    continue;
+                // compute the stenciled cell cartesian coordinates
+                Scalar4 stencil = h_stencil.data[stencil_idx(cur_stencil, type_i)];
+                int sib = ib + __scalar_as_int(stencil.x);
+                int sjb = jb + __scalar_as_int(stencil.y);
+                int skb = kb + __scalar_as_int(stencil.z);
+                Scalar cell_dist2 = stencil.w;
+                // wrap through the boundary
+                if (periodic.x)
+                    {
+                    if (sib >= (int)dim.x)
+                        sib -= dim.x;
+                    else if (sib < 0)
+                        sib += dim.x;
 
-                // read cutoff and skip if pair is inactive
-                Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, type_j)];
-                if (r_cut <= Scalar(0.0))
+                    // wrapping and the stencil construction should ensure this is in bounds
+                    assert(sib >= 0 && sib < (int)dim.x);
+                    }
+                else if (sib < 0 || sib >= (int)dim.x)
+                    {
+                    // in aperiodic systems the stencil could maybe extend out of the grid
                     continue;
+                    }
 
-                // compute the rlist based on the particle type we're interacting with
-                Scalar r_list = r_cut + m_r_buff;
-                Scalar r_listsq = r_list * r_list;
+                if (periodic.y)
+                    {
+                    if (sjb >= (int)dim.y)
+                        sjb -= dim.y;
+                    else if (sjb < 0)
+                        sjb += dim.y;
 
-                // compare the check distance to the minimum cell distance, and pass without
-                // distance check if unnecessary
-                if (cell_dist2 > r_listsq)
+                    assert(sjb >= 0 && sjb < (int)dim.y);
+                    }
+                else if (sjb < 0 || sjb >= (int)dim.y)
+                    {
                     continue;
+                    }
 
-                // only load in the particle position and id if distance check is satisfied
-                const Scalar4& neigh_xyzf = h_cell_xyzf.data[cli(cur_offset, neigh_cell)];
-                unsigned int cur_neigh = __scalar_as_int(neigh_xyzf.w);
+                if (periodic.z)
+                    {
+                    if (skb >= (int)dim.z)
+                        skb -= dim.z;
+                    else if (skb < 0)
+                        skb += dim.z;
 
-                // a particle cannot neighbor itself
-                if (i == (int)cur_neigh)
+                    assert(skb >= 0 && skb < (int)dim.z);
+                    }
+                else if (skb < 0 || skb >= (int)dim.z)
+                    {
                     continue;
+                    }
 
-                Scalar3 neigh_pos = make_scalar3(neigh_xyzf.x, neigh_xyzf.y, neigh_xyzf.z);
-                Scalar3 dx = my_pos - neigh_pos;
-                dx = box.minImage(dx);
-
-                Scalar dr_sq = dot(dx, dx);
+                unsigned int neigh_cell = ci(sib, sjb, skb);
 
-                if (dr_sq <= r_listsq)
+                // check against all the particles in that neighboring bin to see if it is a
+                // neighbor
+                unsigned int size = h_cell_size.data[neigh_cell];
+                for (unsigned int cur_offset = 0; cur_offset < size; cur_offset++)
                     {
-                    if (m_storage_mode == full || i < (int)cur_neigh)
+                    // read in the particle type (diameter and body as well while we've got the
+                    // Scalar4 in)
+                    const uint2& neigh_type_body
+                        = h_cell_type_body.data[cli(cur_offset, neigh_cell)];
+                    const unsigned int type_j = neigh_type_body.x;
+                    const unsigned int body_j = neigh_type_body.y;
+
+                    // skip any particles belonging to the same body if requested
+                    if (m_filter_body && body_i != NO_BODY && body_i == body_j)
+                        continue;
+
+                    // read cutoff and skip if pair is inactive
+                    Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, type_j)];
+                    if (r_cut <= Scalar(0.0))
+                        continue;
+
+                    // compute the rlist based on the particle type we're interacting with
+                    Scalar r_list = r_cut + m_r_buff;
+                    Scalar r_listsq = r_list * r_list;
+
+                    // compare the check distance to the minimum cell distance, and pass without
+                    // distance check if unnecessary
+                    if (cell_dist2 > r_listsq)
+                        continue;
+
+                    // only load in the particle position and id if distance check is satisfied
+                    const Scalar4& neigh_xyzf = h_cell_xyzf.data[cli(cur_offset, neigh_cell)];
+                    unsigned int cur_neigh = __scalar_as_int(neigh_xyzf.w);
+
+                    // a particle cannot neighbor itself
+                    if (i == (int)cur_neigh)
+                        continue;
+
+                    Scalar3 neigh_pos = make_scalar3(neigh_xyzf.x, neigh_xyzf.y, neigh_xyzf.z);
+                    Scalar3 dx = my_pos - neigh_pos;
+                    dx = box.minImage(dx);
+
+                    Scalar dr_sq = dot(dx, dx);
+
+                    if (dr_sq <= r_listsq)
                         {
-                        // local neighbor
-                        if (cur_n_neigh < Nmax_i)
+                        if (m_storage_mode == full || i < (int)cur_neigh)
                             {
-                            h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
+                            // local neighbor
+                            if (cur_n_neigh < Nmax_i)
+                                {
+                                h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
+                                }
+                            else
+                                h_conditions.data[type_i]
+                                    = max(h_conditions.data[type_i], cur_n_neigh + 1);
+
+                            ++cur_n_neigh;
                             }
-                        else
-                            h_conditions.data[type_i]
-                                = max(h_conditions.data[type_i], cur_n_neigh + 1);
-
-                        ++cur_n_neigh;
                         }
                     }
                 }
-            }
 
-        h_n_neigh.data[i] = cur_n_neigh;
+            h_n_neigh.data[i] = cur_n_neigh;
+            }
         }
     }
 
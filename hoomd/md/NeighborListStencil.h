@@ -14,6 +14,7 @@
 #endif
 
 #include <pybind11/pybind11.h>
+#include <vector>
 
 #ifndef __NEIGHBORLISTSTENCIL_H__
 #define __NEIGHBORLISTSTENCIL_H__
@@ -25,6 +26,15 @@ namespace md
 //! Efficient neighbor list build on the CPU with multiple bin stencils
 /*! Implements the O(N) neighbor list build on the CPU using a cell list with multiple bin stencils.
 
+    Unless the cell width is set, the types are split into size classes, and each class is binned
+    into its own cell list. Each type is searched with the shortest cutoff that it has with any
+    type, and a class begins with the type that has the shortest such cutoff and contains every
+    type whose cutoff is at most size_class_ratio times longer. The cell width of a class is its
+    shortest cutoff plus the buffer, so the pairs of small particles search small cells even when
+    there are large particles in the system. Every particle searches the cell list of each class
+    with a stencil whose radius is its longest list radius with a type in that class. Types that
+    do not interact with any type are not binned at all.
+
     \sa CellListStencil
     \ingroup computes
 */
@@ -46,26 +56,40 @@ class PYBIND11_EXPORT NeighborListStencil : public NeighborList
         }
 
     //! Change the underlying cell width
+    /*! \param cell_width Width of the cells, or 0 to choose the widths of the size classes
+     */
     void setCellWidth(Scalar cell_width)
         {
-        m_override_cell_width = true;
+        if (cell_width < Scalar(0))
+            {
+            throw std::invalid_argument("The cell width must not be negative.");
+            }
+        m_cell_width = cell_width;
+        m_update_cell_size = true;
         m_needs_restencil = true;
-        m_cl->setNominalWidth(cell_width);
         }
 
     void setDeterministic(bool deterministic)
         {
-        m_cl->setSortCellList(deterministic);
+        m_deterministic = deterministic;
+        for (auto& cl : m_cl)
+            cl->setSortCellList(deterministic);
         }
 
     bool getDeterministic()
         {
-        return m_cl->getSortCellList();
+        return m_deterministic;
         }
 
     Scalar getCellWidth()
         {
-        return m_cl->getNominalWidth();
+        return m_cell_width;
+        }
+
+    //! Get the number of cell lists of size classes
+    unsigned int getNumCellLists()
+        {
+        return (unsigned int)m_cl.size();
         }
 
     protected:
@@ -73,15 +97,22 @@ class PYBIND11_EXPORT NeighborListStencil : public NeighborList
     virtual void buildNlist(uint64_t timestep);
 
     private:
-    std::shared_ptr<CellList> m_cl;         //!< The cell list
-    std::shared_ptr<CellListStencil> m_cls; //!< The cell list stencil
-    bool m_override_cell_width = false;     //!< Flag to override the cell width
+    static constexpr Scalar size_class_ratio = 2.0; //!< Largest ratio of cutoffs in a class
+
+    std::vector<std::shared_ptr<CellList>> m_cl;          //!< The cell list of each size class
+    std::vector<std::shared_ptr<CellListStencil>> m_cls;  //!< The stencil of each size class
+    std::vector<std::vector<unsigned int>> m_class_types; //!< Types in each size class
+    Scalar m_cell_width = 0;                              //!< Cell width set by the user (or 0)
+    bool m_deterministic = false;                         //!< Flag to sort the cell lists
 
     bool m_needs_restencil = true; //!< Flag for updating the stencil
 
     /// Track when the cell size needs to be updated
     bool m_update_cell_size = true;
 
+    //! Split the types into size classes and set up their cell lists
+    void updateCellLists();
+
     //! Update the stencil radius
     void updateRStencil();
     };
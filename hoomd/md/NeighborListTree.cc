@@ -261,7 +261,13 @@ void NeighborListTree::buildTree()
         {
         if (m_num_per_type[i] > 0)
             {
+#ifdef ENABLE_TBB
+            m_aabb_trees[i].buildTree(&(h_aabbs.data[0]) + m_type_head[i],
+                                      m_num_per_type[i],
+                                      *m_exec_conf->getTaskArena());
+#else
             m_aabb_trees[i].buildTree(&(h_aabbs.data[0]) + m_type_head[i], m_num_per_type[i]);
+#endif
             }
         }
     }
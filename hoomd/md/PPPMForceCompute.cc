@@ -2,7 +2,10 @@
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 #include "PPPMForceCompute.h"
+#include <algorithm>
+#include <cfloat>
 #include <map>
+#include <sstream>
 
 namespace hoomd
     {
@@ -38,14 +41,16 @@ PPPMForceCompute::PPPMForceCompute(std::shared_ptr<SystemDefinition> sysdef,
     : ForceCompute(sysdef), m_nlist(nlist), m_group(group), m_n_ghost_cells(make_uint3(0, 0, 0)),
       m_grid_dim(make_uint3(0, 0, 0)), m_ghost_width(make_scalar3(0, 0, 0)), m_ghost_offset(0),
       m_n_cells(0), m_radius(1), m_n_inner_cells(0), m_need_initialize(true), m_params_set(false),
-      m_box_changed(false), m_q(0.0), m_q2(0.0), m_body_energy(0.0), m_ptls_added_removed(false),
-      m_kiss_fft_initialized(false), m_dfft_initialized(false)
+      m_box_changed(false), m_q(0.0), m_q2(0.0), m_single_precision_mesh(false),
+      m_slab_correction(false), m_slab_volume_factor(1.0), m_body_energy(0.0),
+      m_ptls_added_removed(false), m_fft_backend("auto"), m_dfft_initialized(false)
     {
     m_pdata->getBoxChangeSignal().connect<PPPMForceCompute, &PPPMForceCompute::setBoxChange>(this);
     // reset virial
     ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
     memset(h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
 
+    m_resolution = make_uint3(0, 0, 0);
     m_mesh_points = make_uint3(0, 0, 0);
     m_global_dim = make_uint3(0, 0, 0);
     m_kappa = Scalar(0.0);
@@ -69,7 +74,24 @@ void PPPMForceCompute::setParams(unsigned int nx,
     m_rcut = rcut;
     m_alpha = alpha;
 
-    m_mesh_points = make_uint3(nx, ny, nz);
+    // pad the mesh along z with vacuum for slab systems
+    m_resolution = make_uint3(nx, ny, nz);
+    unsigned int nz_mesh = nz;
+    if (m_slab_volume_factor != Scalar(1.0))
+        {
+        nz_mesh = (unsigned int)ceil(Scalar(nz) * m_slab_volume_factor);
+#ifdef ENABLE_MPI
+        if (m_pdata->getDomainDecomposition())
+            {
+            m_exec_conf->msg->error()
+                << "charge.pppm: slab_volume_factor > 1 is not supported with domain decomposition"
+                << std::endl;
+            throw std::runtime_error("Error setting PPPM parameters");
+            }
+#endif
+        }
+
+    m_mesh_points = make_uint3(nx, ny, nz_mesh);
     m_global_dim = m_mesh_points;
 
     if (order < 1 || order > PPPM_MAX_ORDER)
@@ -133,17 +155,96 @@ void PPPMForceCompute::setParams(unsigned int nx,
     m_params_set = true;
     }
 
+/*! \param backend Name of the backend of the FFT on a single rank, or "auto" to select the fastest
+                    backend in this build
+
+    The backend is used when the mesh is not distributed over several ranks. The FFTs on the GPU
+    always use cuFFT or hipFFT.
+*/
+void PPPMForceCompute::setFFTBackend(const std::string& backend)
+    {
+    std::vector<std::string> backends = detail::getLocalFFTBackends();
+    if (backend != "auto" && std::find(backends.begin(), backends.end(), backend) == backends.end())
+        {
+        std::ostringstream s;
+        s << "FFT backend " << backend << " is not available. Choose from: auto";
+        for (const auto& b : backends)
+            s << ", " << b;
+        s << ".";
+        m_exec_conf->msg->error() << s.str() << std::endl;
+        throw std::runtime_error("Error setting FFT backend");
+        }
+
+    m_fft_backend = backend;
+
+    // plan the new FFT for the current mesh
+    if (m_fft)
+        {
+        m_fft = detail::makeLocalFFT(m_fft_backend, m_mesh_points);
+        }
+    }
+
+/*! \param slab_volume_factor Ratio of the height of the mesh to the height of the box
+
+    The mesh extends above the box by (slab_volume_factor - 1) times the height of the box. The
+    empty space separates the periodic images of a slab along z. Use it together with the slab
+    correction.
+*/
+void PPPMForceCompute::setSlabVolumeFactor(Scalar slab_volume_factor)
+    {
+    if (!(slab_volume_factor >= Scalar(1.0)))
+        {
+        m_exec_conf->msg->error() << "charge.pppm: slab_volume_factor must be >= 1" << std::endl;
+        throw std::runtime_error("Error setting PPPM parameters");
+        }
+
+    if (slab_volume_factor == m_slab_volume_factor)
+        return;
+
+    m_slab_volume_factor = slab_volume_factor;
+
+    // reallocate the mesh
+    if (m_params_set)
+        {
+        setParams(m_resolution.x,
+                  m_resolution.y,
+                  m_resolution.z,
+                  m_order,
+                  m_kappa,
+                  m_rcut,
+                  m_alpha);
+        }
+    }
+
+/*! \param box Local or global simulation box
+    \returns The box extended along z by the slab volume factor
+*/
+BoxDim PPPMForceCompute::getMeshBox(const BoxDim& box)
+    {
+    if (m_slab_volume_factor == Scalar(1.0))
+        return box;
+
+    if (box.getTiltFactorXZ() != Scalar(0.0) || box.getTiltFactorYZ() != Scalar(0.0))
+        {
+        m_exec_conf->msg->error()
+            << "charge.pppm: slab_volume_factor > 1 requires a box with xz = yz = 0" << std::endl;
+        throw std::runtime_error("Error computing PPPM forces");
+        }
+
+    Scalar3 lo = box.getLo();
+    Scalar3 hi = box.getHi();
+    hi.z = lo.z + (hi.z - lo.z) * m_slab_volume_factor;
+
+    BoxDim mesh_box = box;
+    mesh_box.setLoHi(lo, hi);
+    return mesh_box;
+    }
+
 PPPMForceCompute::~PPPMForceCompute()
     {
     m_pdata->getGlobalParticleNumberChangeSignal()
         .disconnect<PPPMForceCompute, &PPPMForceCompute::slotGlobalParticleNumberChange>(this);
 
-    if (m_kiss_fft_initialized)
-        {
-        kiss_fft_free(m_kiss_fft);
-        kiss_fft_free(m_kiss_ifft);
-        kiss_fft_cleanup();
-        }
 #ifdef ENABLE_MPI
     if (m_dfft_initialized)
         {
@@ -346,7 +447,7 @@ void PPPMForceCompute::setupCoeffs()
     // compute RMS force error
     // NOTE: this is for an orthorhombic box, need to generalize to triclinic
     // but I don't know where this formula comes from
-    const BoxDim& global_box = m_pdata->getGlobalBox();
+    const BoxDim global_box = getMeshBox(m_pdata->getGlobalBox());
     Scalar3 L = global_box.getL();
     Scalar hx = L.x / (Scalar)m_global_dim.x;
     Scalar hy = L.y / (Scalar)m_global_dim.y;
@@ -369,6 +470,19 @@ void PPPMForceCompute::setupCoeffs()
         m_exec_conf->msg->notice(2) << "charge.pppm: RMS error: " << RMS_error << std::endl;
         }
 
+    if (m_single_precision_mesh && m_exec_conf->isCUDAEnabled())
+        {
+        Scalar precision_error = estimateSinglePrecisionError();
+        m_exec_conf->msg->notice(2)
+            << "charge.pppm: single precision mesh RMS error: " << precision_error << std::endl;
+        if (precision_error > Scalar(0.1) * RMS_error)
+            {
+            m_exec_conf->msg->warning()
+                << "charge.pppm: the single precision error of " << precision_error
+                << " is comparable to the RMS error" << std::endl;
+            }
+        }
+
     // initialize coefficients for charge assignment
     compute_rho_coeff();
 
@@ -376,13 +490,28 @@ void PPPMForceCompute::setupCoeffs()
     compute_gf_denom();
     }
 
+/*! Single precision arithmetic rounds every assignment weight, every mesh value, and every
+    contribution of a mesh point to the force with a relative error of order FLT_EPSILON. The
+    rounding errors of the order^3 stencil points and of the log2(n) stages of the FFT are
+    uncorrelated and add in quadrature. The typical reciprocal space force is that between two
+    RMS charges q2/N at the distance 1/kappa. This is an order of magnitude estimate.
+*/
+Scalar PPPMForceCompute::estimateSinglePrecisionError()
+    {
+    Scalar n_global_cells = Scalar(m_global_dim.x) * m_global_dim.y * m_global_dim.z;
+    Scalar n_stencil = Scalar(m_order) * m_order * m_order;
+    Scalar n_rounding = Scalar(2.0) * n_stencil + log2(n_global_cells);
+    Scalar f_typical = m_q2 / Scalar(m_pdata->getNGlobal()) * m_kappa * m_kappa;
+    return Scalar(FLT_EPSILON) * sqrt(n_rounding) * f_typical;
+    }
+
 void PPPMForceCompute::setupMesh()
     {
     // update number of ghost cells
     m_n_ghost_cells = computeGhostCellNum();
 
     // extra ghost cells are as wide as the inner cells
-    const BoxDim& box = m_pdata->getBox();
+    const BoxDim box = getMeshBox(m_pdata->getBox());
     Scalar3 cell_width = box.getNearestPlaneDistance()
                          / make_scalar3(m_mesh_points.x, m_mesh_points.y, m_mesh_points.z);
     m_ghost_width
@@ -432,7 +561,7 @@ uint3 PPPMForceCompute::computeGhostCellNum()
         {
         Scalar r_buff = m_nlist->getRBuff() / 2.0;
 
-        const BoxDim& box = m_pdata->getBox();
+        const BoxDim box = getMeshBox(m_pdata->getBox());
         Scalar3 cell_width = box.getNearestPlaneDistance()
                              / make_scalar3(m_mesh_points.x, m_mesh_points.y, m_mesh_points.z);
 
@@ -464,14 +593,15 @@ void PPPMForceCompute::initializeFFT()
                 make_uint3(m_grid_dim.x, m_grid_dim.y, m_grid_dim.z),
                 m_n_ghost_cells,
                 true));
-        // ghost cell communicator for force mesh
-        m_grid_comm_reverse
-            = std::unique_ptr<CommunicatorGrid<kiss_fft_cpx>>(new CommunicatorGrid<kiss_fft_cpx>(
-                m_sysdef,
-                make_uint3(m_mesh_points.x, m_mesh_points.y, m_mesh_points.z),
-                make_uint3(m_grid_dim.x, m_grid_dim.y, m_grid_dim.z),
-                m_n_ghost_cells,
-                false));
+        // ghost cell communicators for force mesh
+        for (unsigned int i = 0; i < 3; ++i)
+            m_grid_comm_reverse[i] = std::unique_ptr<CommunicatorGrid<kiss_fft_cpx>>(
+                new CommunicatorGrid<kiss_fft_cpx>(
+                    m_sysdef,
+                    make_uint3(m_mesh_points.x, m_mesh_points.y, m_mesh_points.z),
+                    make_uint3(m_grid_dim.x, m_grid_dim.y, m_grid_dim.z),
+                    m_n_ghost_cells,
+                    false));
         // set up distributed FFTs
         int gdim[3];
         int pdim[3];
@@ -527,24 +657,7 @@ void PPPMForceCompute::initializeFFT()
 
     if (local_fft)
         {
-        int dims[3];
-        dims[0] = m_mesh_points.z;
-        dims[1] = m_mesh_points.y;
-        dims[2] = m_mesh_points.x;
-
-        if (m_kiss_fft)
-            {
-            kiss_fft_free(m_kiss_fft);
-            }
-        if (m_kiss_ifft)
-            {
-            kiss_fft_free(m_kiss_ifft);
-            }
-
-        m_kiss_fft = kiss_fftnd_alloc(dims, 3, 0, NULL, NULL);
-        m_kiss_ifft = kiss_fftnd_alloc(dims, 3, 1, NULL, NULL);
-
-        m_kiss_fft_initialized = true;
+        m_fft = detail::makeLocalFFT(m_fft_backend, m_mesh_points);
         }
 
     // allocate mesh and transformed mesh
@@ -608,7 +721,7 @@ void PPPMForceCompute::computeInfluenceFunction()
     memset(h_inf_f.data, 0, sizeof(Scalar) * m_inf_f.getNumElements());
     memset(h_k.data, 0, sizeof(Scalar3) * m_k.getNumElements());
 
-    const BoxDim& global_box = m_pdata->getGlobalBox();
+    const BoxDim global_box = getMeshBox(m_pdata->getGlobalBox());
 
     // compute reciprocal lattice vectors
     Scalar3 a1 = global_box.getLatticeVector(0);
@@ -633,7 +746,7 @@ void PPPMForceCompute::computeInfluenceFunction()
                  / V_box;
 
 #ifdef ENABLE_MPI
-    bool local_fft = m_kiss_fft_initialized;
+    bool local_fft = bool(m_fft);
 
     uint3 pdim = make_uint3(0, 0, 0);
     uint3 pidx = make_uint3(0, 0, 0);
@@ -783,7 +896,7 @@ void PPPMForceCompute::assignParticles()
 
     ArrayHandle<Scalar> h_rho_coeff(m_rho_coeff, access_location::host, access_mode::read);
 
-    const BoxDim& box = m_pdata->getBox();
+    const BoxDim box = getMeshBox(m_pdata->getBox());
 
     // set mesh to zero
     memset(h_mesh.data, 0, sizeof(kiss_fft_cpx) * m_mesh.getNumElements());
@@ -928,7 +1041,7 @@ void PPPMForceCompute::assignParticles()
 
 void PPPMForceCompute::updateMeshes()
     {
-    if (m_kiss_fft_initialized)
+    if (m_fft)
         {
         // transform the particle mesh locally (forward transform)
         ArrayHandle<kiss_fft_cpx> h_mesh(m_mesh, access_location::host, access_mode::read);
@@ -936,7 +1049,7 @@ void PPPMForceCompute::updateMeshes()
                                                  access_location::host,
                                                  access_mode::overwrite);
 
-        kiss_fftnd(m_kiss_fft, h_mesh.data, h_fourier_mesh.data);
+        m_fft->forward(h_mesh.data, h_fourier_mesh.data);
         }
 
 #ifdef ENABLE_MPI
@@ -999,7 +1112,7 @@ void PPPMForceCompute::updateMeshes()
             }
         }
 
-    if (m_kiss_fft_initialized)
+    if (m_fft)
         {
         // do a local inverse transform of the force mesh
         ArrayHandle<kiss_fft_cpx> h_fourier_mesh_G_x(m_fourier_mesh_G_x,
@@ -1020,9 +1133,9 @@ void PPPMForceCompute::updateMeshes()
         ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_z(m_inv_fourier_mesh_z,
                                                        access_location::host,
                                                        access_mode::overwrite);
-        kiss_fftnd(m_kiss_ifft, h_fourier_mesh_G_x.data, h_inv_fourier_mesh_x.data);
-        kiss_fftnd(m_kiss_ifft, h_fourier_mesh_G_y.data, h_inv_fourier_mesh_y.data);
-        kiss_fftnd(m_kiss_ifft, h_fourier_mesh_G_z.data, h_inv_fourier_mesh_z.data);
+        m_fft->inverse(h_fourier_mesh_G_x.data, h_inv_fourier_mesh_x.data);
+        m_fft->inverse(h_fourier_mesh_G_y.data, h_inv_fourier_mesh_y.data);
+        m_fft->inverse(h_fourier_mesh_G_z.data, h_inv_fourier_mesh_z.data);
         }
 
 #ifdef ENABLE_MPI
@@ -1070,17 +1183,28 @@ void PPPMForceCompute::updateMeshes()
 #ifdef ENABLE_MPI
     if (m_pdata->getDomainDecomposition())
         {
-        // update outer cells of force mesh using ghost cells from neighboring processors
+        // start updating the outer cells of force mesh using ghost cells from neighboring
+        // processors, interpolateForces() completes the update
         m_exec_conf->msg->notice(8) << "charge.pppm: Ghost cell update" << std::endl;
-        m_grid_comm_reverse->communicate(m_inv_fourier_mesh_x);
-        m_grid_comm_reverse->communicate(m_inv_fourier_mesh_y);
-        m_grid_comm_reverse->communicate(m_inv_fourier_mesh_z);
+        m_grid_comm_reverse[0]->beginCommunicate(m_inv_fourier_mesh_x);
+        m_grid_comm_reverse[1]->beginCommunicate(m_inv_fourier_mesh_y);
+        m_grid_comm_reverse[2]->beginCommunicate(m_inv_fourier_mesh_z);
         }
 #endif
     }
 
 void PPPMForceCompute::interpolateForces()
     {
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        // complete the ghost cell update started in updateMeshes()
+        m_grid_comm_reverse[0]->finishCommunicate(m_inv_fourier_mesh_x);
+        m_grid_comm_reverse[1]->finishCommunicate(m_inv_fourier_mesh_y);
+        m_grid_comm_reverse[2]->finishCommunicate(m_inv_fourier_mesh_z);
+        }
+#endif
+
     // access particle data
     ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
                                    access_location::host,
@@ -1106,7 +1230,7 @@ void PPPMForceCompute::interpolateForces()
 
     ArrayHandle<Scalar> h_rho_coeff(m_rho_coeff, access_location::host, access_mode::read);
 
-    const BoxDim& box = m_pdata->getBox();
+    const BoxDim box = getMeshBox(m_pdata->getBox());
 
     // loop over group
     unsigned int group_size = m_group->getNumMembers();
@@ -1284,7 +1408,7 @@ Scalar PPPMForceCompute::computePE()
             }
         }
 
-    Scalar V = m_pdata->getGlobalBox().getVolume();
+    Scalar V = getMeshBox(m_pdata->getGlobalBox()).getVolume();
     Scalar scale = Scalar(1.0) / ((Scalar)(m_global_dim.x * m_global_dim.y * m_global_dim.z));
     sum *= Scalar(0.5) * V * scale * scale;
 
@@ -1373,11 +1497,11 @@ void PPPMForceCompute::computeForces(uint64_t timestep)
 
     updateMeshes();
 
+    // the energy and virial only need the Fourier mesh, compute them while the ghost cells of the
+    // force mesh are communicated
     PDataFlags flags = this->m_pdata->getFlags();
     computePE();
 
-    interpolateForces();
-
     if (flags[pdata_flag::pressure_tensor])
         {
         computeVirial();
@@ -1388,6 +1512,13 @@ void PPPMForceCompute::computeForces(uint64_t timestep)
             m_external_virial[i] = Scalar(0.0);
         }
 
+    interpolateForces();
+
+    if (m_slab_correction)
+        {
+        computeSlabCorrection();
+        }
+
     // If there are exclusions, correct for the long-range part of the potential
     if (m_nlist->getExclusionsSet())
         {
@@ -1396,6 +1527,78 @@ void PPPMForceCompute::computeForces(uint64_t timestep)
         }
     }
 
+/*! The Yeh-Berkowitz correction with the terms for non-neutral systems by Ballenegger et al.
+    (J. Chem. Phys. 131, 094107, 2009) removes the interaction between the periodic images of a
+    slab along z:
+
+    \f[ U = \frac{2\pi}{V} \left(M_z^2 - Q \sum_i q_i z_i^2 - Q^2 \frac{L_z^2}{12}\right) \f]
+
+    where \f$ M_z = \sum_i q_i z_i \f$ and V is the volume of the mesh box.
+*/
+Scalar PPPMForceCompute::getSlabCorrectionFactors(Scalar dipole,
+                                                  Scalar moment2,
+                                                  Scalar& dipole_force,
+                                                  Scalar& charge_force)
+    {
+    const BoxDim global_box = m_pdata->getGlobalBox();
+    Scalar V = getMeshBox(global_box).getVolume();
+    Scalar L_z = global_box.getL().z;
+    Scalar prefactor = Scalar(2.0 * M_PI) / V;
+
+    dipole_force = -Scalar(2.0) * prefactor * dipole;
+    charge_force = Scalar(2.0) * prefactor * m_q;
+
+    return prefactor * (dipole * dipole - m_q * moment2 - m_q * m_q * L_z * L_z / Scalar(12.0));
+    }
+
+void PPPMForceCompute::computeSlabCorrection()
+    {
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::readwrite);
+
+    // sum the moments of the charge distribution along z
+    Scalar moments[2] = {Scalar(0.0), Scalar(0.0)};
+    unsigned int group_size = m_group->getNumMembers();
+    for (unsigned int group_idx = 0; group_idx < group_size; ++group_idx)
+        {
+        unsigned int j = m_group->getMemberIndex(group_idx);
+        Scalar qz = h_charge.data[j] * h_postype.data[j].z;
+        moments[0] += qz;
+        moments[1] += qz * h_postype.data[j].z;
+        }
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      moments,
+                      2,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    Scalar dipole_force, charge_force;
+    Scalar energy = getSlabCorrectionFactors(moments[0], moments[1], dipole_force, charge_force);
+
+    for (unsigned int group_idx = 0; group_idx < group_size; ++group_idx)
+        {
+        unsigned int j = m_group->getMemberIndex(group_idx);
+        h_force.data[j].z
+            += h_charge.data[j] * (dipole_force + charge_force * h_postype.data[j].z);
+        }
+
+    // the correction is a global quantity, add it on rank 0 only
+    if (m_exec_conf->getRank() == 0)
+        {
+        m_external_energy += energy;
+        }
+    }
+
 void PPPMForceCompute::computeVirial()
     {
     ArrayHandle<kiss_fft_cpx> h_fourier_mesh(m_fourier_mesh,
@@ -1445,7 +1648,7 @@ void PPPMForceCompute::computeVirial()
             }
         }
 
-    Scalar V = m_pdata->getGlobalBox().getVolume();
+    Scalar V = getMeshBox(m_pdata->getGlobalBox()).getVolume();
     Scalar scale = Scalar(1.0) / ((Scalar)(m_global_dim.x * m_global_dim.y * m_global_dim.z));
 
     for (unsigned int k = 0; k < 6; ++k)
@@ -1755,7 +1958,19 @@ void export_PPPMForceCompute(pybind11::module& m)
         .def_property_readonly("order", &PPPMForceCompute::getOrder)
         .def_property_readonly("kappa", &PPPMForceCompute::getKappa)
         .def_property_readonly("r_cut", &PPPMForceCompute::getRCut)
-        .def_property_readonly("alpha", &PPPMForceCompute::getAlpha);
+        .def_property_readonly("alpha", &PPPMForceCompute::getAlpha)
+        .def_property("fft_backend",
+                      &PPPMForceCompute::getFFTBackend,
+                      &PPPMForceCompute::setFFTBackend)
+        .def_property("single_precision_mesh",
+                      &PPPMForceCompute::getSinglePrecisionMesh,
+                      &PPPMForceCompute::setSinglePrecisionMesh)
+        .def_property("slab_correction",
+                      &PPPMForceCompute::getSlabCorrection,
+                      &PPPMForceCompute::setSlabCorrection)
+        .def_property("slab_volume_factor",
+                      &PPPMForceCompute::getSlabVolumeFactor,
+                      &PPPMForceCompute::setSlabVolumeFactor);
     }
 
     } // end namespace detail
@@ -4,6 +4,7 @@
 #ifndef __PPPM_FORCE_COMPUTE_H__
 #define __PPPM_FORCE_COMPUTE_H__
 
+#include "LocalFFT.h"
 #include "NeighborList.h"
 #include "hoomd/ForceCompute.h"
 #include "hoomd/ParticleGroup.h"
@@ -13,8 +14,6 @@
 #include "hoomd/extern/dfftlib/src/dfft_host.h"
 #endif
 
-#include "hoomd/extern/kiss_fftnd.h"
-
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 #include <memory>
 
@@ -57,9 +56,9 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
     pybind11::tuple getResolution()
         {
         pybind11::list val;
-        val.append(m_global_dim.x);
-        val.append(m_global_dim.y);
-        val.append(m_global_dim.z);
+        val.append(m_resolution.x);
+        val.append(m_resolution.y);
+        val.append(m_resolution.z);
 
         return pybind11::tuple(val);
         }
@@ -84,6 +83,48 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
         return m_alpha;
         }
 
+    /// Set the backend of the FFT on a single rank
+    void setFFTBackend(const std::string& backend);
+
+    /// Get the backend of the FFT on a single rank
+    std::string getFFTBackend()
+        {
+        return m_fft_backend;
+        }
+
+    /// Set whether to assign charges and interpolate forces at single precision on the GPU
+    void setSinglePrecisionMesh(bool single_precision_mesh)
+        {
+        m_single_precision_mesh = single_precision_mesh;
+        }
+
+    /// Get whether to assign charges and interpolate forces at single precision on the GPU
+    bool getSinglePrecisionMesh()
+        {
+        return m_single_precision_mesh;
+        }
+
+    /// Set whether to apply the slab correction for systems that are not periodic in z
+    void setSlabCorrection(bool slab_correction)
+        {
+        m_slab_correction = slab_correction;
+        }
+
+    /// Get whether to apply the slab correction
+    bool getSlabCorrection()
+        {
+        return m_slab_correction;
+        }
+
+    /// Set the ratio of the height of the mesh to the height of the box
+    void setSlabVolumeFactor(Scalar slab_volume_factor);
+
+    /// Get the ratio of the height of the mesh to the height of the box
+    Scalar getSlabVolumeFactor()
+        {
+        return m_slab_volume_factor;
+        }
+
 #ifdef ENABLE_MPI
     //! Get ghost particle fields requested by this pair potential
     /*! \param timestep Current time step
@@ -120,6 +161,7 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
     std::shared_ptr<NeighborList> m_nlist;  //!< The neighborlist to use for the computation
     std::shared_ptr<ParticleGroup> m_group; //!< Group to compute properties for
 
+    uint3 m_resolution;           //!< Number of mesh points along each box vector (user input)
     uint3 m_mesh_points;          //!< Number of sub-divisions along one coordinate
     uint3 m_global_dim;           //!< Global grid dimensions
     uint3 m_n_ghost_cells;        //!< Number of ghost cells along every axis
@@ -149,6 +191,11 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
     GlobalArray<Scalar> m_rho_coeff; //!< Coefficients for computing the grid based charge density
     GlobalArray<Scalar> m_gf_b;      //!< Green function coefficients
 
+    bool m_single_precision_mesh; //!< True to assign and interpolate at single precision on the GPU
+
+    bool m_slab_correction;      //!< True to apply the Yeh-Berkowitz slab correction
+    Scalar m_slab_volume_factor; //!< Ratio of the height of the mesh to the height of the box
+
     Scalar m_body_energy;      //!< Energy correction due to rigid body exclusions
     bool m_ptls_added_removed; //!< True if global particle number changed
 
@@ -194,24 +241,48 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
     //! Setup coefficients
     virtual void setupCoeffs();
 
+    //! Estimate the RMS force error due to single precision arithmetic on the mesh
+    Scalar estimateSinglePrecisionError();
+
+    //! Get the box covered by the mesh
+    BoxDim getMeshBox(const BoxDim& box);
+
+    //! Apply the slab correction to the forces and the energy
+    virtual void computeSlabCorrection();
+
+    //! Compute the slab correction from the moments of the charge distribution along z
+    /*! \param dipole Sum of q_i z_i over all particles
+        \param moment2 Sum of q_i z_i^2 over all particles
+        \param dipole_force Set so that F_z,i = q_i (dipole_force + charge_force z_i)
+        \param charge_force Set so that F_z,i = q_i (dipole_force + charge_force z_i)
+
+        \returns The correction to the energy
+    */
+    Scalar getSlabCorrectionFactors(Scalar dipole,
+                                    Scalar moment2,
+                                    Scalar& dipole_force,
+                                    Scalar& charge_force);
+
     //! Compute rigid body correction
     virtual void computeBodyCorrection();
 
     private:
-    kiss_fftnd_cfg m_kiss_fft = NULL;  //!< The FFT configuration
-    kiss_fftnd_cfg m_kiss_ifft = NULL; //!< Inverse FFT configuration
+    std::string m_fft_backend;               //!< Name of the local FFT backend
+    std::unique_ptr<detail::LocalFFT> m_fft; //!< FFT when the mesh is on a single rank
 
 #ifdef ENABLE_MPI
     dfft_plan m_dfft_plan_forward; //!< Distributed FFT for forward transform
     dfft_plan m_dfft_plan_inverse; //!< Distributed FFT for inverse transform
     std::unique_ptr<CommunicatorGrid<kiss_fft_cpx>>
         m_grid_comm_forward; //!< Communicator for charge mesh
-    std::unique_ptr<CommunicatorGrid<kiss_fft_cpx>>
-        m_grid_comm_reverse; //!< Communicator for inv fourier mesh
+    //! Communicators for the x, y, and z inv fourier meshes
+    /*! Each mesh has its own communicator so that the three exchanges are in flight at once. They
+        are started in updateMeshes() and finished in interpolateForces(), which overlaps them with
+        the energy and virial computation.
+    */
+    std::unique_ptr<CommunicatorGrid<kiss_fft_cpx>> m_grid_comm_reverse[3];
 #endif
 
-    bool m_kiss_fft_initialized; //!< True if a local KISS FFT has been set up
-
     GlobalArray<kiss_fft_cpx> m_mesh;         //!< The particle density mesh
     GlobalArray<kiss_fft_cpx> m_fourier_mesh; //!< The fourier transformed mesh
     GlobalArray<kiss_fft_cpx>
@@ -20,7 +20,8 @@ PPPMForceComputeGPU::PPPMForceComputeGPU(std::shared_ptr<SystemDefinition> sysde
     : PPPMForceCompute(sysdef, nlist, group), m_local_fft(true), m_sum(m_exec_conf),
       m_block_size(256)
     {
-    m_tuner_assign.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+    // the second parameter selects the shared memory tiled (1) or global atomic (0) assignment
+    m_tuner_assign.reset(new Autotuner<2>({AutotunerBase::makeBlockSizeRange(m_exec_conf), {0, 1}},
                                           m_exec_conf,
                                           "pppm_assign"));
     m_tuner_reduce_mesh.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
@@ -42,6 +43,9 @@ PPPMForceComputeGPU::PPPMForceComputeGPU(std::shared_ptr<SystemDefinition> sysde
 
     m_cufft_initialized = false;
     m_cuda_dfft_initialized = false;
+
+    GlobalArray<Scalar2> slab_sum(1, m_exec_conf);
+    m_slab_sum.swap(slab_sum);
     }
 
 PPPMForceComputeGPU::~PPPMForceComputeGPU()
@@ -95,14 +99,15 @@ void PPPMForceComputeGPU::initializeFFT()
                 make_uint3(m_grid_dim.x, m_grid_dim.y, m_grid_dim.z),
                 m_n_ghost_cells,
                 true));
-        // ghost cell communicator for force mesh
-        m_gpu_grid_comm_reverse
-            = std::shared_ptr<CommunicatorGridGPUComplex>(new CommunicatorGridGPUComplex(
-                m_sysdef,
-                make_uint3(m_mesh_points.x, m_mesh_points.y, m_mesh_points.z),
-                make_uint3(m_grid_dim.x, m_grid_dim.y, m_grid_dim.z),
-                m_n_ghost_cells,
-                false));
+        // ghost cell communicators for force mesh
+        for (unsigned int i = 0; i < 3; ++i)
+            m_gpu_grid_comm_reverse[i]
+                = std::shared_ptr<CommunicatorGridGPUComplex>(new CommunicatorGridGPUComplex(
+                    m_sysdef,
+                    make_uint3(m_mesh_points.x, m_mesh_points.y, m_mesh_points.z),
+                    make_uint3(m_grid_dim.x, m_grid_dim.y, m_grid_dim.z),
+                    m_n_ghost_cells,
+                    false));
 
         // set up distributed FFT
         int gdim[3];
@@ -313,7 +318,9 @@ void PPPMForceComputeGPU::assignParticles()
     this->m_exec_conf->beginMultiGPU();
 
     m_tuner_assign->begin();
-    unsigned int block_size = m_tuner_assign->getParam()[0];
+    auto param = m_tuner_assign->getParam();
+    unsigned int block_size = param[0];
+    bool tiled = param[1];
 
     kernel::gpu_assign_particles(m_mesh_points,
                                  m_n_ghost_cells,
@@ -326,11 +333,13 @@ void PPPMForceComputeGPU::assignParticles()
                                  d_mesh_scratch.data,
                                  (unsigned int)m_mesh.getNumElements(),
                                  m_order,
-                                 m_pdata->getBox(),
+                                 getMeshBox(m_pdata->getBox()),
                                  block_size,
                                  d_rho_coeff.data,
                                  m_exec_conf->dev_prop,
-                                 m_group->getGPUPartition());
+                                 m_group->getGPUPartition(),
+                                 m_single_precision_mesh,
+                                 tiled);
 
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
@@ -538,18 +547,28 @@ void PPPMForceComputeGPU::updateMeshes()
 #ifdef ENABLE_MPI
     if (!m_local_fft)
         {
-        // update outer cells of inverse Fourier meshes using ghost cells from neighboring
-        // processors
+        // start updating the outer cells of inverse Fourier meshes using ghost cells from
+        // neighboring processors, interpolateForces() completes the update
         m_exec_conf->msg->notice(8) << "charge.pppm: Ghost cell update" << std::endl;
-        m_gpu_grid_comm_reverse->communicate(m_inv_fourier_mesh_x);
-        m_gpu_grid_comm_reverse->communicate(m_inv_fourier_mesh_y);
-        m_gpu_grid_comm_reverse->communicate(m_inv_fourier_mesh_z);
+        m_gpu_grid_comm_reverse[0]->beginCommunicate(m_inv_fourier_mesh_x);
+        m_gpu_grid_comm_reverse[1]->beginCommunicate(m_inv_fourier_mesh_y);
+        m_gpu_grid_comm_reverse[2]->beginCommunicate(m_inv_fourier_mesh_z);
         }
 #endif
     }
 
 void PPPMForceComputeGPU::interpolateForces()
     {
+#ifdef ENABLE_MPI
+    if (!m_local_fft)
+        {
+        // complete the ghost cell update started in updateMeshes()
+        m_gpu_grid_comm_reverse[0]->finishCommunicate(m_inv_fourier_mesh_x);
+        m_gpu_grid_comm_reverse[1]->finishCommunicate(m_inv_fourier_mesh_y);
+        m_gpu_grid_comm_reverse[2]->finishCommunicate(m_inv_fourier_mesh_z);
+        }
+#endif
+
     ArrayHandle<Scalar4> d_postype(m_pdata->getPositions(),
                                    access_location::device,
                                    access_mode::read);
@@ -587,7 +606,7 @@ void PPPMForceComputeGPU::interpolateForces()
                                m_grid_dim,
                                m_n_ghost_cells,
                                d_charge.data,
-                               m_pdata->getBox(),
+                               getMeshBox(m_pdata->getBox()),
                                m_order,
                                d_index_array.data,
                                m_group->getGPUPartition(),
@@ -595,7 +614,8 @@ void PPPMForceComputeGPU::interpolateForces()
                                d_rho_coeff.data,
                                block_size,
                                m_local_fft,
-                               m_n_cells + m_ghost_offset);
+                               m_n_cells + m_ghost_offset,
+                               m_single_precision_mesh);
 
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
@@ -653,7 +673,7 @@ void PPPMForceComputeGPU::computeVirial()
 
     ArrayHandle<Scalar> h_sum_virial(m_sum_virial, access_location::host, access_mode::read);
 
-    Scalar V = m_pdata->getGlobalBox().getVolume();
+    Scalar V = getMeshBox(m_pdata->getGlobalBox()).getVolume();
     Scalar scale = Scalar(1.0) / ((Scalar)(m_global_dim.x * m_global_dim.y * m_global_dim.z));
 
     for (unsigned int i = 0; i < 6; ++i)
@@ -692,7 +712,7 @@ Scalar PPPMForceComputeGPU::computePE()
 
     Scalar sum = m_sum.readFlags();
 
-    Scalar V = m_pdata->getGlobalBox().getVolume();
+    Scalar V = getMeshBox(m_pdata->getGlobalBox()).getVolume();
     Scalar scale = Scalar(1.0) / ((Scalar)(m_global_dim.x * m_global_dim.y * m_global_dim.z));
     sum *= Scalar(0.5) * V * scale * scale;
 
@@ -759,7 +779,7 @@ void PPPMForceComputeGPU::computeInfluenceFunction()
                                            global_dim,
                                            d_inf_f.data,
                                            d_k.data,
-                                           m_pdata->getGlobalBox(),
+                                           getMeshBox(m_pdata->getGlobalBox()),
                                            m_local_fft,
                                            pidx,
                                            pdim,
@@ -821,6 +841,82 @@ void PPPMForceComputeGPU::fixExclusions()
         CHECK_CUDA_ERROR();
     }
 
+void PPPMForceComputeGPU::computeSlabCorrection()
+    {
+    unsigned int group_size = m_group->getNumMembers();
+    unsigned int n_blocks = group_size / m_block_size + 1;
+    if (m_slab_sum_partial.getNumElements() < n_blocks)
+        {
+        GlobalArray<Scalar2> slab_sum_partial(n_blocks, m_exec_conf);
+        m_slab_sum_partial.swap(slab_sum_partial);
+        }
+
+    ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
+                                            access_location::device,
+                                            access_mode::read);
+    ArrayHandle<Scalar4> d_postype(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+    ArrayHandle<Scalar> d_charge(m_pdata->getCharges(), access_location::device, access_mode::read);
+
+        {
+        ArrayHandle<Scalar2> d_slab_sum_partial(m_slab_sum_partial,
+                                                access_location::device,
+                                                access_mode::overwrite);
+        ArrayHandle<Scalar2> d_slab_sum(m_slab_sum,
+                                        access_location::device,
+                                        access_mode::overwrite);
+
+        kernel::gpu_compute_slab_moments(group_size,
+                                         d_slab_sum_partial.data,
+                                         d_slab_sum.data,
+                                         d_index_array.data,
+                                         d_postype.data,
+                                         d_charge.data,
+                                         m_block_size);
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+    ArrayHandle<Scalar2> h_slab_sum(m_slab_sum, access_location::host, access_mode::read);
+    Scalar moments[2] = {h_slab_sum.data[0].x, h_slab_sum.data[0].y};
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      moments,
+                      2,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    Scalar dipole_force, charge_force;
+    Scalar energy = getSlabCorrectionFactors(moments[0], moments[1], dipole_force, charge_force);
+
+    ArrayHandle<Scalar4> d_force(m_force, access_location::device, access_mode::readwrite);
+    kernel::gpu_apply_slab_correction(group_size,
+                                      d_index_array.data,
+                                      d_postype.data,
+                                      d_charge.data,
+                                      d_force.data,
+                                      dipole_force,
+                                      charge_force,
+                                      m_block_size);
+
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+
+    // the correction is a global quantity, add it on rank 0 only
+    if (m_exec_conf->getRank() == 0)
+        {
+        m_external_energy += energy;
+        }
+    }
+
 namespace detail
     {
 void export_PPPMForceComputeGPU(pybind11::module& m)
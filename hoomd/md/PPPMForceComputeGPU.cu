@@ -3,6 +3,9 @@
 
 #include "PPPMForceComputeGPU.cuh"
 #include "hoomd/TextureTools.h"
+#include "hoomd/VectorMath.h"
+
+#include <climits>
 
 // __scalar2int_rd is __float2int_rd in single, __double2int_rd in double
 #if HOOMD_LONGREAL_SIZE == 32
@@ -121,6 +124,11 @@ __device__ int3 find_cell(const Scalar3& pos,
     return make_int3(ix, iy, iz);
     }
 
+//! Assign the particle charges to the mesh
+/*! \tparam Real Precision of the assignment weights. The charge density is accumulated at
+    single precision regardless, so float weights are accurate to the precision of the mesh.
+*/
+template<class Real>
 __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
                                             const uint3 n_ghost_bins,
                                             unsigned int work_size,
@@ -134,7 +142,8 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
                                             BoxDim box,
                                             const Scalar* d_rho_coeff)
     {
-    extern __shared__ Scalar s_coeff[];
+    extern __shared__ char s_data[];
+    Real* s_coeff = (Real*)s_data;
 
     // load in interpolation coefficients
     unsigned int ncoeffs = order * (2 * order + 1);
@@ -142,7 +151,7 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
         {
         if (cur_offset + threadIdx.x < ncoeffs)
             {
-            s_coeff[cur_offset + threadIdx.x] = d_rho_coeff[cur_offset + threadIdx.x];
+            s_coeff[cur_offset + threadIdx.x] = Real(d_rho_coeff[cur_offset + threadIdx.x]);
             }
         }
     __syncthreads();
@@ -167,9 +176,10 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
     Scalar qi = d_charge[idx];
 
     // compute coordinates in units of the cell size
-    Scalar3 dr = make_scalar3(0, 0, 0);
+    Scalar3 dr_scalar = make_scalar3(0, 0, 0);
     int3 bin_coord
-        = find_cell(pos, mesh_dim.x, mesh_dim.y, mesh_dim.z, n_ghost_bins, box, order, dr);
+        = find_cell(pos, mesh_dim.x, mesh_dim.y, mesh_dim.z, n_ghost_bins, box, order, dr_scalar);
+    vec3<Real> dr(Real(dr_scalar.x), Real(dr_scalar.y), Real(dr_scalar.z));
 
     // ignore particles that are not within our domain (the error should be caught by HOOMD's cell
     // list)
@@ -186,11 +196,11 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
     int nlower = -(order - 1) / 2;
     int nupper = order / 2;
 
-    Scalar result;
+    Real result;
 
     int mult_fact = 2 * order + 1;
 
-    Scalar x0 = qi;
+    Real x0 = Real(qi / V_cell);
 
     bool ignore_x = false;
     bool ignore_y = false;
@@ -200,12 +210,12 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
     for (int l = nlower; l <= nupper; ++l)
         {
         // precalculate assignment factor
-        result = Scalar(0.0);
+        result = Real(0.0);
         for (int iorder = order - 1; iorder >= 0; iorder--)
             {
             result = s_coeff[l - nlower + iorder * mult_fact] + result * dr.x;
             }
-        Scalar y0 = x0 * result;
+        Real y0 = x0 * result;
 
         int neighi = i + l;
         if (neighi >= (int)bin_dim.x)
@@ -225,12 +235,12 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
 
         for (int m = nlower; m <= nupper; ++m)
             {
-            result = Scalar(0.0);
+            result = Real(0.0);
             for (int iorder = order - 1; iorder >= 0; iorder--)
                 {
                 result = s_coeff[m - nlower + iorder * mult_fact] + result * dr.y;
                 }
-            Scalar z0 = y0 * result;
+            Real z0 = y0 * result;
 
             int neighj = j + m;
             if (neighj >= (int)bin_dim.y)
@@ -250,7 +260,7 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
 
             for (int n = nlower; n <= nupper; ++n)
                 {
-                result = Scalar(0.0);
+                result = Real(0.0);
                 for (int iorder = order - 1; iorder >= 0; iorder--)
                     {
                     result = s_coeff[n - nlower + iorder * mult_fact] + result * dr.z;
@@ -280,7 +290,7 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
 
                     // compute fraction of particle density assigned to cell
                     // from particles in this bin
-                    myAtomicAdd(&d_mesh[cell_idx].x, z0 * result / V_cell);
+                    myAtomicAdd(&d_mesh[cell_idx].x, float(z0 * result));
                     }
 
                 ignore_z = false;
@@ -291,6 +301,230 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
         } // end of loop over neighboring bins
     }
 
+//! Wrap a mesh index into the mesh, or flag it when it falls outside the mesh and ghost layer
+/*! \param n Mesh index along one direction, within one mesh length of the mesh
+    \param dim Number of mesh points along this direction, including ghost points
+    \param n_ghost Number of ghost points on either side along this direction
+
+    \returns false if the point belongs to another domain
+*/
+__device__ inline bool wrap_bin(int& n, int dim, unsigned int n_ghost)
+    {
+    if (n >= dim)
+        {
+        if (n_ghost)
+            return false;
+        n -= dim;
+        }
+    else if (n < 0)
+        {
+        if (n_ghost)
+            return false;
+        n += dim;
+        }
+    return true;
+    }
+
+//! Assign the particle charges to the mesh through a tile of the mesh in shared memory
+/*! \tparam Real Precision of the assignment weights
+
+    Each block accumulates the charges of its particles in the smallest box of mesh points that
+    covers their stencils and then adds the box to the mesh in global memory, one atomic operation
+    per mesh point. The particles are sorted along a space filling curve, so the particles of a
+    block are close together and the box is small. Blocks whose box does not fit in
+    \a max_tile_elements mesh points fall back to atomic operations on the mesh in global memory.
+*/
+template<class Real>
+__global__ void gpu_assign_particles_tiled_kernel(const uint3 mesh_dim,
+                                                  const uint3 n_ghost_bins,
+                                                  unsigned int work_size,
+                                                  const unsigned int* d_index_array,
+                                                  const Scalar4* d_postype,
+                                                  const Scalar* d_charge,
+                                                  hipfftComplex* d_mesh,
+                                                  Scalar V_cell,
+                                                  int order,
+                                                  unsigned int offset,
+                                                  BoxDim box,
+                                                  const Scalar* d_rho_coeff,
+                                                  unsigned int max_tile_elements)
+    {
+    extern __shared__ char s_data[];
+    Real* s_coeff = (Real*)s_data;
+    unsigned int ncoeffs = order * (2 * order + 1);
+    float* s_tile = (float*)(s_data + ncoeffs * sizeof(Real));
+
+    __shared__ int s_lo[3];
+    __shared__ int s_hi[3];
+
+    // load in interpolation coefficients
+    for (unsigned int cur_offset = 0; cur_offset < ncoeffs; cur_offset += blockDim.x)
+        {
+        if (cur_offset + threadIdx.x < ncoeffs)
+            {
+            s_coeff[cur_offset + threadIdx.x] = Real(d_rho_coeff[cur_offset + threadIdx.x]);
+            }
+        }
+
+    if (threadIdx.x < 3)
+        {
+        s_lo[threadIdx.x] = INT_MAX;
+        s_hi[threadIdx.x] = INT_MIN;
+        }
+    __syncthreads();
+
+    int3 bin_dim = make_int3(mesh_dim.x + 2 * n_ghost_bins.x,
+                             mesh_dim.y + 2 * n_ghost_bins.y,
+                             mesh_dim.z + 2 * n_ghost_bins.z);
+
+    // all threads stay alive until the end of the kernel to participate in the tile operations
+    unsigned int work_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    bool active = work_idx < work_size;
+
+    int3 bin_coord = make_int3(0, 0, 0);
+    vec3<Real> dr;
+    Real x0 = Real(0.0);
+
+    if (active)
+        {
+        unsigned int idx = d_index_array[work_idx + offset];
+        Scalar4 postype = d_postype[idx];
+        Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+
+        Scalar3 dr_scalar = make_scalar3(0, 0, 0);
+        bin_coord = find_cell(pos,
+                              mesh_dim.x,
+                              mesh_dim.y,
+                              mesh_dim.z,
+                              n_ghost_bins,
+                              box,
+                              order,
+                              dr_scalar);
+        dr = vec3<Real>(Real(dr_scalar.x), Real(dr_scalar.y), Real(dr_scalar.z));
+        x0 = Real(d_charge[idx] / V_cell);
+
+        // ignore particles that are not within our domain (the error should be caught by
+        // HOOMD's cell list)
+        active = bin_coord.x >= 0 && bin_coord.x < bin_dim.x && bin_coord.y >= 0
+                 && bin_coord.y < bin_dim.y && bin_coord.z >= 0 && bin_coord.z < bin_dim.z;
+        }
+
+    if (active)
+        {
+        atomicMin(&s_lo[0], bin_coord.x);
+        atomicMin(&s_lo[1], bin_coord.y);
+        atomicMin(&s_lo[2], bin_coord.z);
+        atomicMax(&s_hi[0], bin_coord.x);
+        atomicMax(&s_hi[1], bin_coord.y);
+        atomicMax(&s_hi[2], bin_coord.z);
+        }
+    __syncthreads();
+
+    // the block has no particles in the domain
+    if (s_lo[0] > s_hi[0])
+        return;
+
+    int nlower = -(order - 1) / 2;
+    int nupper = order / 2;
+    int mult_fact = 2 * order + 1;
+
+    // box of mesh points covered by the stencils, in unwrapped mesh coordinates
+    int3 tile_lo = make_int3(s_lo[0] + nlower, s_lo[1] + nlower, s_lo[2] + nlower);
+    int3 tile_dim = make_int3(s_hi[0] - s_lo[0] + order,
+                              s_hi[1] - s_lo[1] + order,
+                              s_hi[2] - s_lo[2] + order);
+    unsigned long long tile_elements
+        = (unsigned long long)tile_dim.x * tile_dim.y * (unsigned long long)tile_dim.z;
+    bool use_tile = tile_elements <= max_tile_elements;
+
+    if (use_tile)
+        {
+        for (unsigned int t = threadIdx.x; t < tile_elements; t += blockDim.x)
+            {
+            s_tile[t] = 0.0f;
+            }
+        __syncthreads();
+        }
+
+    if (active)
+        {
+        for (int l = nlower; l <= nupper; ++l)
+            {
+            Real result = Real(0.0);
+            for (int iorder = order - 1; iorder >= 0; iorder--)
+                {
+                result = s_coeff[l - nlower + iorder * mult_fact] + result * dr.x;
+                }
+            Real y0 = x0 * result;
+
+            for (int m = nlower; m <= nupper; ++m)
+                {
+                result = Real(0.0);
+                for (int iorder = order - 1; iorder >= 0; iorder--)
+                    {
+                    result = s_coeff[m - nlower + iorder * mult_fact] + result * dr.y;
+                    }
+                Real z0 = y0 * result;
+
+                for (int n = nlower; n <= nupper; ++n)
+                    {
+                    result = Real(0.0);
+                    for (int iorder = order - 1; iorder >= 0; iorder--)
+                        {
+                        result = s_coeff[n - nlower + iorder * mult_fact] + result * dr.z;
+                        }
+                    float value = float(z0 * result);
+
+                    int neighi = bin_coord.x + l;
+                    int neighj = bin_coord.y + m;
+                    int neighk = bin_coord.z + n;
+
+                    if (use_tile)
+                        {
+                        unsigned int tile_idx
+                            = (neighi - tile_lo.x)
+                              + tile_dim.x
+                                    * ((neighj - tile_lo.y) + tile_dim.y * (neighk - tile_lo.z));
+                        myAtomicAdd(&s_tile[tile_idx], value);
+                        }
+                    else if (wrap_bin(neighi, bin_dim.x, n_ghost_bins.x)
+                             && wrap_bin(neighj, bin_dim.y, n_ghost_bins.y)
+                             && wrap_bin(neighk, bin_dim.z, n_ghost_bins.z))
+                        {
+                        unsigned int cell_idx = neighi + bin_dim.x * (neighj + bin_dim.y * neighk);
+                        myAtomicAdd(&d_mesh[cell_idx].x, value);
+                        }
+                    }
+                }
+            }
+        }
+
+    if (!use_tile)
+        return;
+
+    __syncthreads();
+
+    // add the tile to the mesh
+    for (unsigned int t = threadIdx.x; t < tile_elements; t += blockDim.x)
+        {
+        float value = s_tile[t];
+        if (value == 0.0f)
+            continue;
+
+        int neighi = tile_lo.x + t % tile_dim.x;
+        int neighj = tile_lo.y + (t / tile_dim.x) % tile_dim.y;
+        int neighk = tile_lo.z + t / (tile_dim.x * tile_dim.y);
+
+        if (wrap_bin(neighi, bin_dim.x, n_ghost_bins.x)
+            && wrap_bin(neighj, bin_dim.y, n_ghost_bins.y)
+            && wrap_bin(neighk, bin_dim.z, n_ghost_bins.z))
+            {
+            unsigned int cell_idx = neighi + bin_dim.x * (neighj + bin_dim.y * neighk);
+            myAtomicAdd(&d_mesh[cell_idx].x, value);
+            }
+        }
+    }
+
 __global__ void gpu_reduce_meshes(const unsigned int mesh_elements,
                                   const hipfftComplex* d_mesh_scratch,
                                   hipfftComplex* d_mesh,
@@ -315,29 +549,32 @@ __global__ void gpu_reduce_meshes(const unsigned int mesh_elements,
     d_mesh[idx] = res;
     }
 
-void gpu_assign_particles(const uint3 mesh_dim,
-                          const uint3 n_ghost_bins,
-                          const uint3 grid_dim,
-                          unsigned int group_size,
-                          const unsigned int* d_index_array,
-                          const Scalar4* d_postype,
-                          const Scalar* d_charge,
-                          hipfftComplex* d_mesh,
-                          hipfftComplex* d_mesh_scratch,
-                          const unsigned int mesh_elements,
-                          int order,
-                          const BoxDim& box,
-                          unsigned int block_size,
-                          const Scalar* d_rho_coeff,
-                          const hipDeviceProp_t& dev_prop,
-                          const GPUPartition& gpu_partition)
+//! Launch the charge assignment on all GPUs with weights of precision Real
+template<class Real>
+void assign_particles(const uint3 mesh_dim,
+                      const uint3 n_ghost_bins,
+                      unsigned int group_size,
+                      const unsigned int* d_index_array,
+                      const Scalar4* d_postype,
+                      const Scalar* d_charge,
+                      hipfftComplex* d_mesh,
+                      hipfftComplex* d_mesh_scratch,
+                      const unsigned int mesh_elements,
+                      int order,
+                      const BoxDim& box,
+                      Scalar V_cell,
+                      unsigned int block_size,
+                      const Scalar* d_rho_coeff,
+                      const hipDeviceProp_t& dev_prop,
+                      const GPUPartition& gpu_partition,
+                      bool tiled)
     {
-    hipMemsetAsync(d_mesh, 0, sizeof(hipfftComplex) * grid_dim.x * grid_dim.y * grid_dim.z);
-    Scalar V_cell = box.getVolume() / (Scalar)(mesh_dim.x * mesh_dim.y * mesh_dim.z);
-
     unsigned int max_block_size;
     hipFuncAttributes attr;
-    hipFuncGetAttributes(&attr, (const void*)gpu_assign_particles_kernel);
+    if (tiled)
+        hipFuncGetAttributes(&attr, (const void*)gpu_assign_particles_tiled_kernel<Real>);
+    else
+        hipFuncGetAttributes(&attr, (const void*)gpu_assign_particles_kernel<Real>);
     max_block_size = attr.maxThreadsPerBlock;
 
     unsigned int run_block_size = min(max_block_size, block_size);
@@ -347,6 +584,14 @@ void gpu_assign_particles(const uint3 mesh_dim,
         run_block_size -= dev_prop.warpSize;
         }
 
+    const size_t coeff_bytes = order * (2 * order + 1) * sizeof(Real);
+
+    // use at most a quarter of the shared memory for the tile to keep several blocks on each SM
+    size_t tile_bytes = dev_prop.sharedMemPerBlock / 4;
+    if (tile_bytes + coeff_bytes + attr.sharedSizeBytes > dev_prop.sharedMemPerBlock)
+        tile_bytes = dev_prop.sharedMemPerBlock - coeff_bytes - attr.sharedSizeBytes;
+    unsigned int max_tile_elements = (unsigned int)(tile_bytes / sizeof(float));
+
     // iterate over active GPUs in reverse, to end up on first GPU when returning from this function
     unsigned int ngpu = gpu_partition.getNumActiveGPUs();
     for (int idev = ngpu - 1; idev >= 0; --idev)
@@ -363,25 +608,113 @@ void gpu_assign_particles(const uint3 mesh_dim,
 
         unsigned int nwork = range.second - range.first;
         unsigned int n_blocks = nwork / run_block_size + 1;
-        const size_t shared_bytes = order * (2 * order + 1) * sizeof(Scalar);
+        hipfftComplex* d_mesh_dev = ngpu > 1 ? d_mesh_scratch + idev * mesh_elements : d_mesh;
 
-        hipLaunchKernelGGL((gpu_assign_particles_kernel),
-                           dim3(n_blocks),
-                           dim3(run_block_size),
-                           shared_bytes,
-                           0,
-                           mesh_dim,
-                           n_ghost_bins,
-                           nwork,
-                           d_index_array,
-                           d_postype,
-                           d_charge,
-                           ngpu > 1 ? d_mesh_scratch + idev * mesh_elements : d_mesh,
-                           V_cell,
-                           order,
-                           range.first,
-                           box,
-                           d_rho_coeff);
+        if (tiled)
+            {
+            hipLaunchKernelGGL((gpu_assign_particles_tiled_kernel<Real>),
+                               dim3(n_blocks),
+                               dim3(run_block_size),
+                               coeff_bytes + max_tile_elements * sizeof(float),
+                               0,
+                               mesh_dim,
+                               n_ghost_bins,
+                               nwork,
+                               d_index_array,
+                               d_postype,
+                               d_charge,
+                               d_mesh_dev,
+                               V_cell,
+                               order,
+                               range.first,
+                               box,
+                               d_rho_coeff,
+                               max_tile_elements);
+            }
+        else
+            {
+            hipLaunchKernelGGL((gpu_assign_particles_kernel<Real>),
+                               dim3(n_blocks),
+                               dim3(run_block_size),
+                               coeff_bytes,
+                               0,
+                               mesh_dim,
+                               n_ghost_bins,
+                               nwork,
+                               d_index_array,
+                               d_postype,
+                               d_charge,
+                               d_mesh_dev,
+                               V_cell,
+                               order,
+                               range.first,
+                               box,
+                               d_rho_coeff);
+            }
+        }
+    }
+
+void gpu_assign_particles(const uint3 mesh_dim,
+                          const uint3 n_ghost_bins,
+                          const uint3 grid_dim,
+                          unsigned int group_size,
+                          const unsigned int* d_index_array,
+                          const Scalar4* d_postype,
+                          const Scalar* d_charge,
+                          hipfftComplex* d_mesh,
+                          hipfftComplex* d_mesh_scratch,
+                          const unsigned int mesh_elements,
+                          int order,
+                          const BoxDim& box,
+                          unsigned int block_size,
+                          const Scalar* d_rho_coeff,
+                          const hipDeviceProp_t& dev_prop,
+                          const GPUPartition& gpu_partition,
+                          bool single_precision,
+                          bool tiled)
+    {
+    hipMemsetAsync(d_mesh, 0, sizeof(hipfftComplex) * grid_dim.x * grid_dim.y * grid_dim.z);
+    Scalar V_cell = box.getVolume() / (Scalar)(mesh_dim.x * mesh_dim.y * mesh_dim.z);
+
+    if (single_precision)
+        {
+        assign_particles<float>(mesh_dim,
+                                n_ghost_bins,
+                                group_size,
+                                d_index_array,
+                                d_postype,
+                                d_charge,
+                                d_mesh,
+                                d_mesh_scratch,
+                                mesh_elements,
+                                order,
+                                box,
+                                V_cell,
+                                block_size,
+                                d_rho_coeff,
+                                dev_prop,
+                                gpu_partition,
+                                tiled);
+        }
+    else
+        {
+        assign_particles<Scalar>(mesh_dim,
+                                 n_ghost_bins,
+                                 group_size,
+                                 d_index_array,
+                                 d_postype,
+                                 d_charge,
+                                 d_mesh,
+                                 d_mesh_scratch,
+                                 mesh_elements,
+                                 order,
+                                 box,
+                                 V_cell,
+                                 block_size,
+                                 d_rho_coeff,
+                                 dev_prop,
+                                 gpu_partition,
+                                 tiled);
         }
     }
 
@@ -549,6 +882,11 @@ void gpu_update_meshes(const unsigned int n_wave_vectors,
                        NNN);
     }
 
+//! Interpolate the forces from the mesh
+/*! \tparam Real Precision of the interpolation weights. The contributions of the mesh points are
+    accumulated into the force at Scalar precision.
+*/
+template<class Real>
 __global__ void gpu_compute_forces_kernel(const unsigned int work_size,
                                           const Scalar4* d_postype,
                                           Scalar4* d_force,
@@ -564,7 +902,8 @@ __global__ void gpu_compute_forces_kernel(const unsigned int work_size,
                                           const Scalar* d_rho_coeff,
                                           const unsigned int offset)
     {
-    extern __shared__ Scalar s_coeff[];
+    extern __shared__ char s_data[];
+    Real* s_coeff = (Real*)s_data;
 
     // load in interpolation coefficients
     unsigned int ncoeffs = order * (2 * order + 1);
@@ -572,7 +911,7 @@ __global__ void gpu_compute_forces_kernel(const unsigned int work_size,
         {
         if (cur_offset + threadIdx.x < ncoeffs)
             {
-            s_coeff[cur_offset + threadIdx.x] = d_rho_coeff[cur_offset + threadIdx.x];
+            s_coeff[cur_offset + threadIdx.x] = Real(d_rho_coeff[cur_offset + threadIdx.x]);
             }
         }
     __syncthreads();
@@ -594,13 +933,20 @@ __global__ void gpu_compute_forces_kernel(const unsigned int work_size,
 
     Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
     unsigned int type = __scalar_as_int(postype.w);
-    Scalar qi = d_charge[idx];
+    Real qi = Real(d_charge[idx]);
 
-    Scalar3 dr = make_scalar3(0, 0, 0);
+    Scalar3 dr_scalar = make_scalar3(0, 0, 0);
 
     // find cell the particle is in
-    int3 cell_coord
-        = find_cell(pos, inner_dim.x, inner_dim.y, inner_dim.z, n_ghost_cells, box, order, dr);
+    int3 cell_coord = find_cell(pos,
+                                inner_dim.x,
+                                inner_dim.y,
+                                inner_dim.z,
+                                n_ghost_cells,
+                                box,
+                                order,
+                                dr_scalar);
+    vec3<Real> dr(Real(dr_scalar.x), Real(dr_scalar.y), Real(dr_scalar.z));
 
     // ignore particles that are not within our domain (the error should be caught by HOOMD's cell
     // list)
@@ -615,36 +961,36 @@ __global__ void gpu_compute_forces_kernel(const unsigned int work_size,
     int nlower = -(order - 1) / 2;
     int nupper = order / 2;
 
-    Scalar result;
+    Real result;
     int mult_fact = 2 * order + 1;
 
     // back-interpolate forces from neighboring mesh points
     for (int l = nlower; l <= nupper; ++l)
         {
-        result = Scalar(0.0);
+        result = Real(0.0);
         for (int k = order - 1; k >= 0; k--)
             {
             result = s_coeff[l - nlower + k * mult_fact] + result * dr.x;
             }
-        Scalar x0 = result;
+        Real x0 = result;
 
         for (int m = nlower; m <= nupper; ++m)
             {
-            result = Scalar(0.0);
+            result = Real(0.0);
             for (int k = order - 1; k >= 0; k--)
                 {
                 result = s_coeff[m - nlower + k * mult_fact] + result * dr.y;
                 }
-            Scalar y0 = x0 * result;
+            Real y0 = x0 * result;
 
             for (int n = nlower; n <= nupper; ++n)
                 {
-                result = Scalar(0.0);
+                result = Real(0.0);
                 for (int k = order - 1; k >= 0; k--)
                     {
                     result = s_coeff[n - nlower + k * mult_fact] + result * dr.z;
                     }
-                Scalar z0 = y0 * result;
+                Real z0 = qi * y0 * result;
 
                 int neighl = (int)cell_coord.x + l;
                 int neighm = (int)cell_coord.y + m;
@@ -681,9 +1027,9 @@ __global__ void gpu_compute_forces_kernel(const unsigned int work_size,
                 hipfftComplex inv_mesh_y = inv_fourier_mesh_y[cell_idx];
                 hipfftComplex inv_mesh_z = inv_fourier_mesh_z[cell_idx];
 
-                force.x += qi * z0 * inv_mesh_x.x;
-                force.y += qi * z0 * inv_mesh_y.x;
-                force.z += qi * z0 * inv_mesh_z.x;
+                force.x += Scalar(z0 * Real(inv_mesh_x.x));
+                force.y += Scalar(z0 * Real(inv_mesh_y.x));
+                force.z += Scalar(z0 * Real(inv_mesh_z.x));
                 }
             }
         } // end neighbor cells loop
@@ -708,11 +1054,15 @@ void gpu_compute_forces(const unsigned int N,
                         const Scalar* d_rho_coeff,
                         unsigned int block_size,
                         bool local_fft,
-                        unsigned int inv_mesh_elements)
+                        unsigned int inv_mesh_elements,
+                        bool single_precision)
     {
     unsigned int max_block_size;
     hipFuncAttributes attr;
-    hipFuncGetAttributes(&attr, (const void*)gpu_compute_forces_kernel);
+    if (single_precision)
+        hipFuncGetAttributes(&attr, (const void*)gpu_compute_forces_kernel<float>);
+    else
+        hipFuncGetAttributes(&attr, (const void*)gpu_compute_forces_kernel<Scalar>);
     max_block_size = attr.maxThreadsPerBlock;
 
     unsigned int run_block_size = min(max_block_size, block_size);
@@ -733,28 +1083,59 @@ void gpu_compute_forces(const unsigned int N,
 
         unsigned int nwork = range.second - range.first;
         unsigned int n_blocks = nwork / run_block_size + 1;
-        const size_t shared_bytes = order * (2 * order + 1) * sizeof(Scalar);
-
-        hipLaunchKernelGGL(
-            (gpu_compute_forces_kernel),
-            dim3(n_blocks),
-            dim3(run_block_size),
-            shared_bytes,
-            0,
-            nwork,
-            d_postype,
-            d_force,
-            grid_dim,
-            n_ghost_cells,
-            d_charge,
-            box,
-            order,
-            d_index_array,
-            local_fft ? d_inv_fourier_mesh_x + idev * inv_mesh_elements : d_inv_fourier_mesh_x,
-            local_fft ? d_inv_fourier_mesh_y + idev * inv_mesh_elements : d_inv_fourier_mesh_y,
-            local_fft ? d_inv_fourier_mesh_z + idev * inv_mesh_elements : d_inv_fourier_mesh_z,
-            d_rho_coeff,
-            range.first);
+        const hipfftComplex* d_inv_x
+            = local_fft ? d_inv_fourier_mesh_x + idev * inv_mesh_elements : d_inv_fourier_mesh_x;
+        const hipfftComplex* d_inv_y
+            = local_fft ? d_inv_fourier_mesh_y + idev * inv_mesh_elements : d_inv_fourier_mesh_y;
+        const hipfftComplex* d_inv_z
+            = local_fft ? d_inv_fourier_mesh_z + idev * inv_mesh_elements : d_inv_fourier_mesh_z;
+
+        if (single_precision)
+            {
+            const size_t shared_bytes = order * (2 * order + 1) * sizeof(float);
+            hipLaunchKernelGGL((gpu_compute_forces_kernel<float>),
+                               dim3(n_blocks),
+                               dim3(run_block_size),
+                               shared_bytes,
+                               0,
+                               nwork,
+                               d_postype,
+                               d_force,
+                               grid_dim,
+                               n_ghost_cells,
+                               d_charge,
+                               box,
+                               order,
+                               d_index_array,
+                               d_inv_x,
+                               d_inv_y,
+                               d_inv_z,
+                               d_rho_coeff,
+                               range.first);
+            }
+        else
+            {
+            const size_t shared_bytes = order * (2 * order + 1) * sizeof(Scalar);
+            hipLaunchKernelGGL((gpu_compute_forces_kernel<Scalar>),
+                               dim3(n_blocks),
+                               dim3(run_block_size),
+                               shared_bytes,
+                               0,
+                               nwork,
+                               d_postype,
+                               d_force,
+                               grid_dim,
+                               n_ghost_cells,
+                               d_charge,
+                               box,
+                               order,
+                               d_index_array,
+                               d_inv_x,
+                               d_inv_y,
+                               d_inv_z,
+                               d_rho_coeff,
+                               range.first);
+            }
         }
     }
 
@@ -1478,6 +1859,165 @@ hipError_t gpu_fix_exclusions(Scalar4* d_force,
     return hipSuccess;
     }
 
+//! Partial sums of the moments q_i z_i and q_i z_i^2 of the charge distribution
+__global__ void kernel_calculate_slab_moments_partial(unsigned int group_size,
+                                                      Scalar2* sum_partial,
+                                                      const unsigned int* d_index_array,
+                                                      const Scalar4* d_postype,
+                                                      const Scalar* d_charge)
+    {
+    HIP_DYNAMIC_SHARED(Scalar2, sdata)
+
+    unsigned int tidx = threadIdx.x;
+    unsigned int group_idx = blockDim.x * blockIdx.x + threadIdx.x;
+
+    Scalar2 mySum = make_scalar2(0.0, 0.0);
+
+    if (group_idx < group_size)
+        {
+        unsigned int idx = d_index_array[group_idx];
+        Scalar z = d_postype[idx].z;
+        Scalar qz = d_charge[idx] * z;
+        mySum = make_scalar2(qz, qz * z);
+        }
+
+    sdata[tidx] = mySum;
+
+    __syncthreads();
+
+    // reduce the sum
+    int offs = blockDim.x >> 1;
+    while (offs > 0)
+        {
+        if (tidx < offs)
+            {
+            sdata[tidx].x += sdata[tidx + offs].x;
+            sdata[tidx].y += sdata[tidx + offs].y;
+            }
+        offs >>= 1;
+        __syncthreads();
+        }
+
+    // write result to global memory
+    if (tidx == 0)
+        sum_partial[blockIdx.x] = sdata[0];
+    }
+
+__global__ void
+kernel_final_reduce_slab_moments(Scalar2* sum_partial, unsigned int nblocks, Scalar2* sum)
+    {
+    HIP_DYNAMIC_SHARED(Scalar2, smem)
+
+    if (threadIdx.x == 0)
+        *sum = make_scalar2(0.0, 0.0);
+
+    for (int start = 0; start < nblocks; start += blockDim.x)
+        {
+        __syncthreads();
+        if (start + threadIdx.x < nblocks)
+            smem[threadIdx.x] = sum_partial[start + threadIdx.x];
+        else
+            smem[threadIdx.x] = make_scalar2(0.0, 0.0);
+
+        __syncthreads();
+
+        // reduce the sum
+        int offs = blockDim.x >> 1;
+        while (offs > 0)
+            {
+            if (threadIdx.x < offs)
+                {
+                smem[threadIdx.x].x += smem[threadIdx.x + offs].x;
+                smem[threadIdx.x].y += smem[threadIdx.x + offs].y;
+                }
+            offs >>= 1;
+            __syncthreads();
+            }
+
+        if (threadIdx.x == 0)
+            {
+            sum->x += smem[0].x;
+            sum->y += smem[0].y;
+            }
+        }
+    }
+
+void gpu_compute_slab_moments(unsigned int group_size,
+                              Scalar2* d_sum_partial,
+                              Scalar2* d_sum,
+                              const unsigned int* d_index_array,
+                              const Scalar4* d_postype,
+                              const Scalar* d_charge,
+                              const unsigned int block_size)
+    {
+    unsigned int n_blocks = group_size / block_size + 1;
+
+    unsigned int shared_size = (unsigned int)(block_size * sizeof(Scalar2));
+
+    hipLaunchKernelGGL((kernel_calculate_slab_moments_partial),
+                       dim3(n_blocks),
+                       dim3(block_size),
+                       shared_size,
+                       0,
+                       group_size,
+                       d_sum_partial,
+                       d_index_array,
+                       d_postype,
+                       d_charge);
+
+    // calculate final sum
+    const unsigned int final_block_size = 256;
+    shared_size = final_block_size * sizeof(Scalar2);
+    hipLaunchKernelGGL((kernel_final_reduce_slab_moments),
+                       dim3(1),
+                       dim3(final_block_size),
+                       shared_size,
+                       0,
+                       d_sum_partial,
+                       n_blocks,
+                       d_sum);
+    }
+
+__global__ void gpu_apply_slab_correction_kernel(unsigned int group_size,
+                                                 const unsigned int* d_index_array,
+                                                 const Scalar4* d_postype,
+                                                 const Scalar* d_charge,
+                                                 Scalar4* d_force,
+                                                 Scalar dipole_force,
+                                                 Scalar charge_force)
+    {
+    unsigned int group_idx = blockDim.x * blockIdx.x + threadIdx.x;
+
+    if (group_idx >= group_size)
+        return;
+
+    unsigned int idx = d_index_array[group_idx];
+    d_force[idx].z += d_charge[idx] * (dipole_force + charge_force * d_postype[idx].z);
+    }
+
+void gpu_apply_slab_correction(unsigned int group_size,
+                               const unsigned int* d_index_array,
+                               const Scalar4* d_postype,
+                               const Scalar* d_charge,
+                               Scalar4* d_force,
+                               Scalar dipole_force,
+                               Scalar charge_force,
+                               const unsigned int block_size)
+    {
+    hipLaunchKernelGGL((gpu_apply_slab_correction_kernel),
+                       dim3(group_size / block_size + 1),
+                       dim3(block_size),
+                       0,
+                       0,
+                       group_size,
+                       d_index_array,
+                       d_postype,
+                       d_charge,
+                       d_force,
+                       dipole_force,
+                       charge_force);
+    }
+
     } // namespace kernel
     } // end namespace md
     } // end namespace hoomd
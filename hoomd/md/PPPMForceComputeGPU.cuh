@@ -39,7 +39,9 @@ void gpu_assign_particles(const uint3 mesh_dim,
                           unsigned int block_size,
                           const Scalar* d_rho_coeff,
                           const hipDeviceProp_t& dev_prop,
-                          const GPUPartition& gpu_partition);
+                          const GPUPartition& gpu_partition,
+                          bool single_precision,
+                          bool tiled);
 
 void gpu_reduce_meshes(const unsigned int mesh_elements,
                        const hipfftComplex* d_mesh_scratch,
@@ -82,7 +84,8 @@ void gpu_compute_forces(const unsigned int N,
                         const Scalar* d_rho_coeff,
                         unsigned int block_size,
                         bool local_fft,
-                        unsigned int inv_mesh_elements);
+                        unsigned int inv_mesh_elements,
+                        bool single_precision);
 
 void gpu_compute_pe(unsigned int n_wave_vectors,
                     Scalar* d_sum_partial,
@@ -130,6 +133,23 @@ hipError_t gpu_fix_exclusions(Scalar4* d_force,
                               unsigned int group_size,
                               int block_size);
 
+void gpu_compute_slab_moments(unsigned int group_size,
+                              Scalar2* d_sum_partial,
+                              Scalar2* d_sum,
+                              const unsigned int* d_index_array,
+                              const Scalar4* d_postype,
+                              const Scalar* d_charge,
+                              const unsigned int block_size);
+
+void gpu_apply_slab_correction(unsigned int group_size,
+                               const unsigned int* d_index_array,
+                               const Scalar4* d_postype,
+                               const Scalar* d_charge,
+                               Scalar4* d_force,
+                               Scalar dipole_force,
+                               Scalar charge_force,
+                               const unsigned int block_size);
+
 void gpu_initialize_coeff(Scalar* CPU_rho_coeff, int order, const GPUPartition& gpu_partition);
 
     } // end namespace kernel
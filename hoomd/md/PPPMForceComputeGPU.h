@@ -77,6 +77,9 @@ class PYBIND11_EXPORT PPPMForceComputeGPU : public PPPMForceCompute
     //! Helper function to correct forces on excluded particles
     virtual void fixExclusions();
 
+    //! Apply the slab correction to the forces and the energy
+    virtual void computeSlabCorrection();
+
 //! Check for HIPFFT errors
 #ifdef __HIP_PLATFORM_HCC__
     inline void handleHIPFFTResult(hipfftResult result, const char* file, unsigned int line) const
@@ -98,8 +101,8 @@ class PYBIND11_EXPORT PPPMForceComputeGPU : public PPPMForceCompute
         }
 
     private:
-    std::shared_ptr<Autotuner<1>>
-        m_tuner_assign; //!< Autotuner for assigning binned charges to mesh
+    /// Autotuner for assigning charges to the mesh (block size, tiled or global atomics)
+    std::shared_ptr<Autotuner<2>> m_tuner_assign;
     std::shared_ptr<Autotuner<1>> m_tuner_reduce_mesh; //!< Autotuner to reduce meshes for multi GPU
     std::shared_ptr<Autotuner<1>> m_tuner_update;      //!< Autotuner for updating mesh values
     std::shared_ptr<Autotuner<1>> m_tuner_force;       //!< Autotuner for populating the force array
@@ -115,8 +118,8 @@ class PYBIND11_EXPORT PPPMForceComputeGPU : public PPPMForceCompute
 #ifdef ENABLE_MPI
     typedef CommunicatorGridGPU<hipfftComplex> CommunicatorGridGPUComplex;
     std::shared_ptr<CommunicatorGridGPUComplex> m_gpu_grid_comm_forward; //!< Communicate mesh
-    std::shared_ptr<CommunicatorGridGPUComplex>
-        m_gpu_grid_comm_reverse; //!< Communicate fourier mesh
+    //! Communicate the x, y, and z inv fourier meshes, each in flight at once
+    std::shared_ptr<CommunicatorGridGPUComplex> m_gpu_grid_comm_reverse[3];
 
     dfft_plan m_dfft_plan_forward; //!< Forward distributed FFT
     dfft_plan m_dfft_plan_inverse; //!< Forward distributed FFT
@@ -133,6 +136,9 @@ class PYBIND11_EXPORT PPPMForceComputeGPU : public PPPMForceCompute
     GlobalArray<Scalar> m_sum_virial_partial; //!< Partial sums over virial mesh values
     GlobalArray<Scalar> m_sum_virial;         //!< Final sum over virial mesh values
     unsigned int m_block_size;                //!< Block size for fourier mesh reduction
+
+    GlobalArray<Scalar2> m_slab_sum_partial; //!< Partial sums of the slab correction moments
+    GlobalArray<Scalar2> m_slab_sum;         //!< Moments of the charge distribution along z
     };
 
     } // end namespace md
@@ -1,6 +1,7 @@
 // Copyright (c) 2009-2024 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "ForceThreadBuffers.h"
 #include "hoomd/ForceCompute.h"
 #include "hoomd/GPUArray.h"
 #include "hoomd/MeshDefinition.h"
@@ -61,8 +62,9 @@ template<class evaluator, class Bonds> class PotentialBond : public ForceCompute
 #endif
 
     protected:
-    GPUArray<param_type> m_params;      //!< Bond parameters per type
-    std::shared_ptr<Bonds> m_bond_data; //!< Bond data to use in computing bonds
+    GPUArray<param_type> m_params;               //!< Bond parameters per type
+    std::shared_ptr<Bonds> m_bond_data;          //!< Bond data to use in computing bonds
+    detail::ForceThreadBuffers m_thread_buffers; //!< Per-thread force buffers
 
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
@@ -197,10 +199,6 @@ void PotentialBond<evaluator, Bonds>::computeForces(uint64_t timestep)
     PDataFlags flags = this->m_pdata->getFlags();
     bool compute_virial = flags[pdata_flag::pressure_tensor];
 
-    Scalar bond_virial[6];
-    for (unsigned int i = 0; i < 6; i++)
-        bond_virial[i] = Scalar(0.0);
-
     ArrayHandle<typename Bonds::members_t> h_bonds(m_bond_data->getMembersArray(),
                                                    access_location::host,
                                                    access_mode::read);
@@ -213,105 +211,117 @@ void PotentialBond<evaluator, Bonds>::computeForces(uint64_t timestep)
     // for each of the bonds
     const unsigned int size = (unsigned int)m_bond_data->getN();
 
-    for (unsigned int i = 0; i < size; i++)
-        {
-        // lookup the tag of each of the particles participating in the bond
-        const typename Bonds::members_t& bond = h_bonds.data[i];
-        assert(bond.tag[0] < m_pdata->getMaximumTag() + 1);
-        assert(bond.tag[1] < m_pdata->getMaximumTag() + 1);
-
-        // transform a and b into indices into the particle data arrays
-        // (MEM TRANSFER: 4 integers)
-        unsigned int idx_a = h_rtag.data[bond.tag[0]];
-        unsigned int idx_b = h_rtag.data[bond.tag[1]];
-
-        // throw an error if this bond is incomplete
-        if (idx_a >= max_local || idx_b >= max_local)
+    // loop over the bonds in [begin, end) and add their forces to the given arrays
+    auto compute_range = [&](unsigned int begin, unsigned int end, const detail::ForceOutput& out)
+    {
+        for (unsigned int i = begin; i < end; i++)
             {
-            std::ostringstream stream;
-            stream << "Error: bond " << bond.tag[0] << " " << bond.tag[1] << " is incomplete.";
-            throw std::runtime_error(stream.str());
-            }
+            // lookup the tag of each of the particles participating in the bond
+            const typename Bonds::members_t& bond = h_bonds.data[i];
+            assert(bond.tag[0] < m_pdata->getMaximumTag() + 1);
+            assert(bond.tag[1] < m_pdata->getMaximumTag() + 1);
+
+            // transform a and b into indices into the particle data arrays
+            // (MEM TRANSFER: 4 integers)
+            unsigned int idx_a = h_rtag.data[bond.tag[0]];
+            unsigned int idx_b = h_rtag.data[bond.tag[1]];
+
+            // throw an error if this bond is incomplete
+            if (idx_a >= max_local || idx_b >= max_local)
+                {
+                std::ostringstream stream;
+                stream << "Error: bond " << bond.tag[0] << " " << bond.tag[1] << " is incomplete.";
+                throw std::runtime_error(stream.str());
+                }
 
-        // calculate d\vec{r}
-        // (MEM TRANSFER: 6 Scalars / FLOPS: 3)
-        Scalar3 posa = make_scalar3(h_pos.data[idx_a].x, h_pos.data[idx_a].y, h_pos.data[idx_a].z);
-        Scalar3 posb = make_scalar3(h_pos.data[idx_b].x, h_pos.data[idx_b].y, h_pos.data[idx_b].z);
+            // calculate d\vec{r}
+            // (MEM TRANSFER: 6 Scalars / FLOPS: 3)
+            Scalar3 posa
+                = make_scalar3(h_pos.data[idx_a].x, h_pos.data[idx_a].y, h_pos.data[idx_a].z);
+            Scalar3 posb
+                = make_scalar3(h_pos.data[idx_b].x, h_pos.data[idx_b].y, h_pos.data[idx_b].z);
 
-        Scalar3 dx = posb - posa;
+            Scalar3 dx = posb - posa;
 
-        // access charge (if needed)
-        Scalar charge_a = Scalar(0.0);
-        Scalar charge_b = Scalar(0.0);
-        if (evaluator::needsCharge())
-            {
-            charge_a = h_charge.data[idx_a];
-            charge_b = h_charge.data[idx_b];
-            }
+            // access charge (if needed)
+            Scalar charge_a = Scalar(0.0);
+            Scalar charge_b = Scalar(0.0);
+            if (evaluator::needsCharge())
+                {
+                charge_a = h_charge.data[idx_a];
+                charge_b = h_charge.data[idx_b];
+                }
 
-        // if the vector crosses the box, pull it back
-        dx = box.minImage(dx);
+            // if the vector crosses the box, pull it back
+            dx = box.minImage(dx);
 
-        // calculate r_ab squared
-        Scalar rsq = dot(dx, dx);
+            // calculate r_ab squared
+            Scalar rsq = dot(dx, dx);
 
-        // compute the force and potential energy
-        Scalar force_divr = Scalar(0.0);
-        Scalar bond_eng = Scalar(0.0);
-        evaluator eval(rsq, h_params.data[h_typeval.data[i].type]);
-        if (evaluator::needsCharge())
-            eval.setCharge(charge_a, charge_b);
+            // compute the force and potential energy
+            Scalar force_divr = Scalar(0.0);
+            Scalar bond_eng = Scalar(0.0);
+            evaluator eval(rsq, h_params.data[h_typeval.data[i].type]);
+            if (evaluator::needsCharge())
+                eval.setCharge(charge_a, charge_b);
 
-        bool evaluated = eval.evalForceAndEnergy(force_divr, bond_eng);
+            bool evaluated = eval.evalForceAndEnergy(force_divr, bond_eng);
 
-        // Bond energy must be halved
-        bond_eng *= Scalar(0.5);
+            // Bond energy must be halved
+            bond_eng *= Scalar(0.5);
 
-        if (evaluated)
-            {
-            // calculate virial
-            if (compute_virial)
+            if (evaluated)
                 {
-                Scalar force_div2r = Scalar(1.0 / 2.0) * force_divr;
-                bond_virial[0] = dx.x * dx.x * force_div2r; // xx
-                bond_virial[1] = dx.x * dx.y * force_div2r; // xy
-                bond_virial[2] = dx.x * dx.z * force_div2r; // xz
-                bond_virial[3] = dx.y * dx.y * force_div2r; // yy
-                bond_virial[4] = dx.y * dx.z * force_div2r; // yz
-                bond_virial[5] = dx.z * dx.z * force_div2r; // zz
-                }
-
-            // add the force to the particles (only for non-ghost particles)
-            if (idx_b < m_pdata->getN())
-                {
-                h_force.data[idx_b].x += force_divr * dx.x;
-                h_force.data[idx_b].y += force_divr * dx.y;
-                h_force.data[idx_b].z += force_divr * dx.z;
-                h_force.data[idx_b].w += bond_eng;
+                // calculate virial
+                Scalar bond_virial[6] = {0, 0, 0, 0, 0, 0};
                 if (compute_virial)
-                    for (unsigned int i = 0; i < 6; i++)
-                        h_virial.data[i * m_virial_pitch + idx_b] += bond_virial[i];
+                    {
+                    Scalar force_div2r = Scalar(1.0 / 2.0) * force_divr;
+                    bond_virial[0] = dx.x * dx.x * force_div2r; // xx
+                    bond_virial[1] = dx.x * dx.y * force_div2r; // xy
+                    bond_virial[2] = dx.x * dx.z * force_div2r; // xz
+                    bond_virial[3] = dx.y * dx.y * force_div2r; // yy
+                    bond_virial[4] = dx.y * dx.z * force_div2r; // yz
+                    bond_virial[5] = dx.z * dx.z * force_div2r; // zz
+                    }
+
+                // add the force to the particles (only for non-ghost particles)
+                if (idx_b < m_pdata->getN())
+                    {
+                    out.force[idx_b].x += force_divr * dx.x;
+                    out.force[idx_b].y += force_divr * dx.y;
+                    out.force[idx_b].z += force_divr * dx.z;
+                    out.force[idx_b].w += bond_eng;
+                    if (compute_virial)
+                        for (unsigned int l = 0; l < 6; l++)
+                            out.virial[l * out.virial_pitch + idx_b] += bond_virial[l];
+                    }
+
+                if (idx_a < m_pdata->getN())
+                    {
+                    out.force[idx_a].x -= force_divr * dx.x;
+                    out.force[idx_a].y -= force_divr * dx.y;
+                    out.force[idx_a].z -= force_divr * dx.z;
+                    out.force[idx_a].w += bond_eng;
+                    if (compute_virial)
+                        for (unsigned int l = 0; l < 6; l++)
+                            out.virial[l * out.virial_pitch + idx_a] += bond_virial[l];
+                    }
                 }
-
-            if (idx_a < m_pdata->getN())
+            else
                 {
-                h_force.data[idx_a].x -= force_divr * dx.x;
-                h_force.data[idx_a].y -= force_divr * dx.y;
-                h_force.data[idx_a].z -= force_divr * dx.z;
-                h_force.data[idx_a].w += bond_eng;
-                if (compute_virial)
-                    for (unsigned int i = 0; i < 6; i++)
-                        h_virial.data[i * m_virial_pitch + idx_a] += bond_virial[i];
+                this->m_exec_conf->msg->error()
+                    << "bond." << evaluator::getName() << ": bond out of bounds" << std::endl
+                    << std::endl;
+                throw std::runtime_error("Error in bond calculation");
                 }
             }
-        else
-            {
-            this->m_exec_conf->msg->error()
-                << "bond." << evaluator::getName() << ": bond out of bounds" << std::endl
-                << std::endl;
-            throw std::runtime_error("Error in bond calculation");
-            }
-        }
+    };
+
+    // each bond adds forces to two particles, so each thread accumulates into its own buffer
+    const detail::ForceOutput out
+        = {h_force.data, nullptr, compute_virial ? h_virial.data : nullptr, m_virial_pitch};
+    m_thread_buffers.run(*m_exec_conf, size, m_pdata->getN(), out, compute_range);
     }
 
 #ifdef ENABLE_MPI
@@ -6,6 +6,7 @@
 #include "hoomd/Index1D.h"
 #include "hoomd/ParticleData.cuh"
 #include "hoomd/TextureTools.h"
+#include "hoomd/WarpTools.cuh"
 
 #include "hoomd/BondedGroupData.cuh"
 
@@ -24,6 +25,14 @@ namespace md
     {
 namespace kernel
     {
+//! Subsets of the particles that the bond force kernel computes
+enum bond_subset
+    {
+    bond_subset_all = 0,  //!< All local particles
+    bond_subset_interior, //!< Particles with no ghost bond partners
+    bond_subset_boundary  //!< Particles with at least one ghost bond partner
+    };
+
 //! Wraps arguments to kernel driver
 template<int group_size> struct bond_args_t
     {
@@ -37,17 +46,21 @@ template<int group_size> struct bond_args_t
                 const Scalar* _d_charge,
                 const BoxDim& _box,
                 const group_storage<group_size>* _d_gpu_bondlist,
-                const Index2D& _gpu_table_indexer,
                 const unsigned int* _d_gpu_bond_pos,
-                const unsigned int* _d_gpu_n_bonds,
+                const unsigned int* _d_gpu_bond_offsets,
+                const unsigned int* _d_gpu_high_degree,
+                const unsigned int _n_high_degree,
+                const unsigned int _high_degree,
                 const unsigned int _n_bond_types,
                 const unsigned int _block_size,
-                const hipDeviceProp_t& _devprop)
+                const hipDeviceProp_t& _devprop,
+                const unsigned int _subset = bond_subset_all)
         : d_force(_d_force), d_virial(_d_virial), virial_pitch(_virial_pitch), N(_N), n_max(_n_max),
           d_pos(_d_pos), d_charge(_d_charge), box(_box), d_gpu_bondlist(_d_gpu_bondlist),
-          gpu_table_indexer(_gpu_table_indexer), d_gpu_bond_pos(_d_gpu_bond_pos),
-          d_gpu_n_bonds(_d_gpu_n_bonds), n_bond_types(_n_bond_types), block_size(_block_size),
-          devprop(_devprop) {};
+          d_gpu_bond_pos(_d_gpu_bond_pos), d_gpu_bond_offsets(_d_gpu_bond_offsets),
+          d_gpu_high_degree(_d_gpu_high_degree), n_high_degree(_n_high_degree),
+          high_degree(_high_degree), n_bond_types(_n_bond_types), block_size(_block_size),
+          devprop(_devprop), subset(_subset) {};
 
     Scalar4* d_force;          //!< Force to write out
     Scalar* d_virial;          //!< Virial to write out
@@ -57,18 +70,98 @@ template<int group_size> struct bond_args_t
     const Scalar4* d_pos;      //!< particle positions
     const Scalar* d_charge;    //!< particle charges
     const BoxDim box;          //!< Simulation box in GPU format
-    const group_storage<group_size>* d_gpu_bondlist; //!< List of bonds stored on the GPU
-    const Index2D& gpu_table_indexer;                //!< Indexer of 2D bond list
+    const group_storage<group_size>* d_gpu_bondlist; //!< Bonds by particle index, in CSR format
     const unsigned int*
         d_gpu_bond_pos; //!< List of pos id of bonds stored on the GPU (needed for mesh bond)
-    const unsigned int* d_gpu_n_bonds; //!< List of number of bonds stored on the GPU
-    const unsigned int n_bond_types;   //!< Number of bond types in the simulation
+    const unsigned int* d_gpu_bond_offsets; //!< Offset of the bonds of each particle
+    const unsigned int* d_gpu_high_degree;  //!< Particles with more than high_degree bonds
+    const unsigned int n_high_degree;       //!< Number of particles in d_gpu_high_degree
+    const unsigned int high_degree;         //!< Largest number of bonds computed by one thread
+    const unsigned int n_bond_types;        //!< Number of bond types in the simulation
     const unsigned int block_size;     //!< Block size to execute
     const hipDeviceProp_t& devprop;    //!< CUDA device properties
+    const unsigned int subset;         //!< Subset of the particles to compute (a bond_subset)
     };
 
 #ifdef __HIPCC__
 
+//! Number of threads that compute the forces on a particle with many bonds
+const unsigned int bond_high_degree_tpp = 32;
+
+//! Add the force and virial of one bond to a particle
+/*! \param cur_bond Other particle and type of the bond
+    \param pos Position of the particle
+    \param q Charge of the particle
+    \param d_pos particle positions on the GPU
+    \param d_charge particle charges
+    \param box Box dimensions used to implement periodic boundary conditions
+    \param params Parameters for the potential, stored per bond type
+    \param force Force on the particle (updated)
+    \param virial Virial of the particle (updated)
+
+    \returns false if the bond could not be evaluated
+*/
+template<class evaluator, int group_size>
+__device__ inline bool gpu_add_bond_force(const group_storage<group_size>& cur_bond,
+                                          const Scalar3& pos,
+                                          const Scalar q,
+                                          const Scalar4* d_pos,
+                                          const Scalar* d_charge,
+                                          const BoxDim& box,
+                                          const typename evaluator::param_type* params,
+                                          Scalar4& force,
+                                          Scalar* virial)
+    {
+    int cur_bond_idx = cur_bond.idx[0];
+    int cur_bond_type = cur_bond.idx[group_size - 1];
+
+    // get the bonded particle's position (MEM_TRANSFER: 16 bytes)
+    Scalar4 neigh_postypej = __ldg(d_pos + cur_bond_idx);
+    Scalar3 neigh_pos = make_scalar3(neigh_postypej.x, neigh_postypej.y, neigh_postypej.z);
+
+    // calculate dr (FLOPS: 3)
+    Scalar3 dx = pos - neigh_pos;
+
+    // apply periodic boundary conditions (FLOPS: 12)
+    dx = box.minImage(dx);
+
+    Scalar rsq = dot(dx, dx);
+
+    // evaluate the potential
+    Scalar force_divr = Scalar(0.0);
+    Scalar bond_eng = Scalar(0.0);
+
+    // get the bond parameters (MEM TRANSFER: 8 bytes)
+    evaluator eval(rsq, params[cur_bond_type]);
+
+    if (evaluator::needsCharge())
+        {
+        Scalar neigh_q = __ldg(d_charge + cur_bond_idx);
+        eval.setCharge(q, neigh_q);
+        }
+
+    if (!eval.evalForceAndEnergy(force_divr, bond_eng))
+        return false;
+
+    // add up the virial (double counting, multiply by 0.5)
+    Scalar force_div2r = force_divr / Scalar(2.0);
+    virial[0] += dx.x * dx.x * force_div2r; // xx
+    virial[1] += dx.x * dx.y * force_div2r; // xy
+    virial[2] += dx.x * dx.z * force_div2r; // xz
+    virial[3] += dx.y * dx.y * force_div2r; // yy
+    virial[4] += dx.y * dx.z * force_div2r; // yz
+    virial[5] += dx.z * dx.z * force_div2r; // zz
+
+    // add up the forces
+    force.x += dx.x * force_divr;
+    force.y += dx.y * force_divr;
+    force.z += dx.z * force_divr;
+    // energy is double counted: multiply by 0.5
+    force.w += bond_eng * Scalar(0.5);
+
+    return true;
+    }
+
 //! Kernel for calculating bond forces
 /*! This kernel is called to calculate the bond forces on all N particles. Actual evaluation of the
    potentials and forces for each bond is handled via the template class \a evaluator.
@@ -80,15 +173,19 @@ template<int group_size> struct bond_args_t
     \param d_pos particle positions on the GPU
     \param d_charge particle charges
     \param box Box dimensions used to implement periodic boundary conditions
-    \param blist List of bonds stored on the GPU
-    \param pitch Pitch of 2D bond list
+    \param blist List of bonds stored on the GPU, in CSR format
     \param bpos_list List of positions in bonds stored on the GPU
-    \param n_bonds_list List of numbers of bonds stored on the GPU
+    \param bond_offsets Offset of the bonds of each particle in \a blist
+    \param high_degree Largest number of bonds of a particle that this kernel computes
     \param n_bond_type number of bond types
     \param d_params Parameters for the potential, stored per bond type
     \param d_flags Flag allocated on the device for use in checking for bonds that cannot be
    evaluated
+    \param subset Subset of the particles to compute (a bond_subset)
 
+    The forces on particles with more than \a high_degree bonds are left to
+    gpu_compute_bond_forces_high_degree_kernel, so that a few highly connected particles do not
+    hold up the other threads of their warp.
 
     Certain options are controlled via template parameters to avoid the performance hit when they
    are not enabled. \tparam evaluator EvaluatorBond class to evaluate V(r) and -delta V(r)/r
@@ -103,12 +200,13 @@ __global__ void gpu_compute_bond_forces_kernel(Scalar4* d_force,
                                                const Scalar* d_charge,
                                                const BoxDim box,
                                                const group_storage<group_size>* blist,
-                                               const Index2D blist_idx,
                                                const unsigned int* bpos_list,
-                                               const unsigned int* n_bonds_list,
+                                               const unsigned int* bond_offsets,
+                                               const unsigned int high_degree,
                                                const unsigned int n_bond_type,
                                                const typename evaluator::param_type* d_params,
-                                               unsigned int* d_flags)
+                                               unsigned int* d_flags,
+                                               const unsigned int subset)
     {
     // start by identifying which particle we are to handle
     int idx = blockIdx.x * blockDim.x + threadIdx.x;
@@ -134,8 +232,27 @@ __global__ void gpu_compute_bond_forces_kernel(Scalar4* d_force,
     if (idx >= N)
         return;
 
-    // load in the length of the list for this thread (MEM TRANSFER: 4 bytes)
-    int n_bonds = n_bonds_list[idx];
+    // load in the range of the list for this thread (MEM TRANSFER: 8 bytes)
+    const unsigned int first_bond = bond_offsets[idx];
+    const unsigned int last_bond = bond_offsets[idx + 1];
+    if (last_bond - first_bond > high_degree)
+        return;
+
+    if (subset != bond_subset_all)
+        {
+        // a particle is on the boundary when any of its bonded partners is a ghost
+        bool boundary = false;
+        for (unsigned int bond_idx = first_bond; bond_idx < last_bond && !boundary; bond_idx++)
+            {
+            if (bpos_list[bond_idx] > 1)
+                continue;
+
+            boundary = blist[bond_idx].idx[0] >= N;
+            }
+
+        if (boundary != (subset == bond_subset_boundary))
+            return;
+        }
 
     // read in the position of our particle. (MEM TRANSFER: 16 bytes)
     Scalar4 postype = __ldg(d_pos + idx);
@@ -149,6 +266,8 @@ __global__ void gpu_compute_bond_forces_kernel(Scalar4* d_force,
     else
         q += 0; // Silence compiler warning.
 
+    const typename evaluator::param_type* params = enable_shared_cache ? s_params : d_params;
+
     // initialize the force to 0
     Scalar4 force = make_scalar4(0, 0, 0, 0);
     // initialize the virial tensor to 0
@@ -157,85 +276,164 @@ __global__ void gpu_compute_bond_forces_kernel(Scalar4* d_force,
         virial[i] = 0;
 
     // loop over neighbors
-    for (int bond_idx = 0; bond_idx < n_bonds; bond_idx++)
+    for (unsigned int bond_idx = first_bond; bond_idx < last_bond; bond_idx++)
         {
-        int cur_bond_pos = bpos_list[blist_idx(idx, bond_idx)];
-
-        if (cur_bond_pos > 1)
+        if (bpos_list[bond_idx] > 1)
             continue;
 
-        group_storage<group_size> cur_bond = blist[blist_idx(idx, bond_idx)];
+        if (!gpu_add_bond_force<evaluator, group_size>(blist[bond_idx],
+                                                       pos,
+                                                       q,
+                                                       d_pos,
+                                                       d_charge,
+                                                       box,
+                                                       params,
+                                                       force,
+                                                       virial))
+            {
+            *d_flags = 1;
+            return;
+            }
+        }
 
-        int cur_bond_idx = cur_bond.idx[0];
-        int cur_bond_type = cur_bond.idx[group_size - 1];
+    // now that the force calculation is complete, write out the result (MEM TRANSFER: 20 bytes);
+    d_force[idx] = force;
 
-        // get the bonded particle's position (MEM_TRANSFER: 16 bytes)
-        Scalar4 neigh_postypej = __ldg(d_pos + cur_bond_idx);
-        Scalar3 neigh_pos = make_scalar3(neigh_postypej.x, neigh_postypej.y, neigh_postypej.z);
+    for (unsigned int i = 0; i < 6; i++)
+        d_virial[i * virial_pitch + idx] = virial[i];
+    }
 
-        // calculate dr (FLOPS: 3)
-        Scalar3 dx = pos - neigh_pos;
+//! Kernel for calculating bond forces on particles with many bonds
+/*! The bonds of each particle in \a d_high_degree are split over bond_high_degree_tpp threads,
+    and their forces and virials are summed with a warp reduction. The other parameters are the
+    same as for gpu_compute_bond_forces_kernel.
 
-        // apply periodic boundary conditions (FLOPS: 12)
-        dx = box.minImage(dx);
+    \param d_high_degree Particles with more bonds than gpu_compute_bond_forces_kernel computes
+    \param n_high_degree Number of particles in \a d_high_degree
+*/
+template<class evaluator, int group_size, bool enable_shared_cache>
+__global__ void
+gpu_compute_bond_forces_high_degree_kernel(Scalar4* d_force,
+                                           Scalar* d_virial,
+                                           const size_t virial_pitch,
+                                           const unsigned int N,
+                                           const Scalar4* d_pos,
+                                           const Scalar* d_charge,
+                                           const BoxDim box,
+                                           const group_storage<group_size>* blist,
+                                           const unsigned int* bpos_list,
+                                           const unsigned int* bond_offsets,
+                                           const unsigned int* d_high_degree,
+                                           const unsigned int n_high_degree,
+                                           const unsigned int n_bond_type,
+                                           const typename evaluator::param_type* d_params,
+                                           unsigned int* d_flags,
+                                           const unsigned int subset)
+    {
+    // shared array for per bond type parameters
+    extern __shared__ char s_data[];
+    typename evaluator::param_type* s_params = (typename evaluator::param_type*)(&s_data[0]);
 
-        // get the bond parameters (MEM TRANSFER: 8 bytes)
-        const typename evaluator::param_type* param;
-        if (enable_shared_cache)
-            {
-            param = s_params + cur_bond_type;
-            }
-        else
+    if (enable_shared_cache)
+        {
+        // load in per bond type parameters
+        for (unsigned int cur_offset = 0; cur_offset < n_bond_type; cur_offset += blockDim.x)
             {
-            param = d_params + cur_bond_type;
+            if (cur_offset + threadIdx.x < n_bond_type)
+                {
+                s_params[cur_offset + threadIdx.x] = d_params[cur_offset + threadIdx.x];
+                }
             }
 
-        Scalar rsq = dot(dx, dx);
+        __syncthreads();
+        }
 
-        // evaluate the potential
-        Scalar force_divr = Scalar(0.0);
-        Scalar bond_eng = Scalar(0.0);
+    // one group of bond_high_degree_tpp threads per particle
+    const unsigned int i = (blockIdx.x * blockDim.x + threadIdx.x) / bond_high_degree_tpp;
+    const unsigned int lane = threadIdx.x % bond_high_degree_tpp;
+    if (i >= n_high_degree)
+        return;
 
-        evaluator eval(rsq, *param);
+    const unsigned int idx = d_high_degree[i];
+    const unsigned int first_bond = bond_offsets[idx];
+    const unsigned int last_bond = bond_offsets[idx + 1];
 
-        if (evaluator::needsCharge())
+    if (subset != bond_subset_all)
+        {
+        // a particle is on the boundary when any of its bonded partners is a ghost
+        unsigned int n_ghost = 0;
+        for (unsigned int bond_idx = first_bond + lane; bond_idx < last_bond;
+             bond_idx += bond_high_degree_tpp)
             {
-            Scalar neigh_q = __ldg(d_charge + cur_bond_idx);
-            eval.setCharge(q, neigh_q);
+            if (bpos_list[bond_idx] <= 1 && blist[bond_idx].idx[0] >= N)
+                ++n_ghost;
             }
+        n_ghost = hoomd::detail::WarpReduce<unsigned int, bond_high_degree_tpp>().Sum(n_ghost);
+        n_ghost = hoomd::detail::WarpScan<unsigned int, bond_high_degree_tpp>().Broadcast(n_ghost,
+                                                                                           0);
 
-        bool evaluated = eval.evalForceAndEnergy(force_divr, bond_eng);
+        if ((n_ghost > 0) != (subset == bond_subset_boundary))
+            return;
+        }
 
-        if (evaluated)
-            {
-            // add up the virial (double counting, multiply by 0.5)
-            Scalar force_div2r = force_divr / Scalar(2.0);
-            virial[0] += dx.x * dx.x * force_div2r; // xx
-            virial[1] += dx.x * dx.y * force_div2r; // xy
-            virial[2] += dx.x * dx.z * force_div2r; // xz
-            virial[3] += dx.y * dx.y * force_div2r; // yy
-            virial[4] += dx.y * dx.z * force_div2r; // yz
-            virial[5] += dx.z * dx.z * force_div2r; // zz
-
-            // add up the forces
-            force.x += dx.x * force_divr;
-            force.y += dx.y * force_divr;
-            force.z += dx.z * force_divr;
-            // energy is double counted: multiply by 0.5
-            force.w += bond_eng * Scalar(0.5);
-            }
-        else
+    // read in the position of our particle. (MEM TRANSFER: 16 bytes)
+    Scalar4 postype = __ldg(d_pos + idx);
+    Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+
+    Scalar q(0);
+    if (evaluator::needsCharge())
+        {
+        q = __ldg(d_charge + idx);
+        }
+    else
+        q += 0; // Silence compiler warning.
+
+    const typename evaluator::param_type* params = enable_shared_cache ? s_params : d_params;
+
+    // initialize the force to 0
+    Scalar4 force = make_scalar4(0, 0, 0, 0);
+    // initialize the virial tensor to 0
+    Scalar virial[6];
+    for (unsigned int j = 0; j < 6; j++)
+        virial[j] = 0;
+
+    // loop over neighbors, all threads must take part in the reduction below
+    for (unsigned int bond_idx = first_bond + lane; bond_idx < last_bond;
+         bond_idx += bond_high_degree_tpp)
+        {
+        if (bpos_list[bond_idx] > 1)
+            continue;
+
+        if (!gpu_add_bond_force<evaluator, group_size>(blist[bond_idx],
+                                                       pos,
+                                                       q,
+                                                       d_pos,
+                                                       d_charge,
+                                                       box,
+                                                       params,
+                                                       force,
+                                                       virial))
             {
             *d_flags = 1;
-            return;
+            break;
             }
         }
 
-    // now that the force calculation is complete, write out the result (MEM TRANSFER: 20 bytes);
-    d_force[idx] = force;
+    // reduce the force and virial over the threads of the particle
+    hoomd::detail::WarpReduce<Scalar, bond_high_degree_tpp> reducer;
+    force.x = reducer.Sum(force.x);
+    force.y = reducer.Sum(force.y);
+    force.z = reducer.Sum(force.z);
+    force.w = reducer.Sum(force.w);
+    for (unsigned int j = 0; j < 6; j++)
+        virial[j] = reducer.Sum(virial[j]);
 
-    for (unsigned int i = 0; i < 6; i++)
-        d_virial[i * virial_pitch + idx] = virial[i];
+    if (lane == 0)
+        {
+        d_force[idx] = force;
+        for (unsigned int j = 0; j < 6; j++)
+            d_virial[j * virial_pitch + idx] = virial[j];
+        }
     }
 
 //! Kernel driver that computes lj forces on the GPU for LJForceComputeGPU
@@ -271,6 +469,22 @@ gpu_compute_bond_forces(const kernel::bond_args_t<group_size>& bond_args,
     dim3 grid(bond_args.N / run_block_size + 1, 1, 1);
     dim3 threads(run_block_size, 1, 1);
 
+    // the particles with many bonds are split over whole groups of threads
+    hipFuncGetAttributes(
+        &attr,
+        reinterpret_cast<const void*>(
+            &gpu_compute_bond_forces_high_degree_kernel<evaluator, group_size, true>));
+    unsigned int high_degree_block_size
+        = min(run_block_size, (unsigned int)attr.maxThreadsPerBlock);
+    high_degree_block_size -= high_degree_block_size % bond_high_degree_tpp;
+    if (high_degree_block_size == 0)
+        high_degree_block_size = bond_high_degree_tpp;
+    dim3 high_degree_grid(bond_args.n_high_degree * bond_high_degree_tpp / high_degree_block_size
+                              + 1,
+                          1,
+                          1);
+    dim3 high_degree_threads(high_degree_block_size, 1, 1);
+
     size_t shared_bytes = sizeof(typename evaluator::param_type) * bond_args.n_bond_types;
 
     bool enable_shared_cache = true;
@@ -281,7 +495,7 @@ gpu_compute_bond_forces(const kernel::bond_args_t<group_size>& bond_args,
         shared_bytes = 0;
         }
 
-    // run the kernel
+    // run the kernels
     if (enable_shared_cache)
         {
         hipLaunchKernelGGL((gpu_compute_bond_forces_kernel<evaluator, group_size, true>),
@@ -297,12 +511,39 @@ gpu_compute_bond_forces(const kernel::bond_args_t<group_size>& bond_args,
                            bond_args.d_charge,
                            bond_args.box,
                            bond_args.d_gpu_bondlist,
-                           bond_args.gpu_table_indexer,
                            bond_args.d_gpu_bond_pos,
-                           bond_args.d_gpu_n_bonds,
+                           bond_args.d_gpu_bond_offsets,
+                           bond_args.high_degree,
                            bond_args.n_bond_types,
                            d_params,
-                           d_flags);
+                           d_flags,
+                           bond_args.subset);
+
+        if (bond_args.n_high_degree > 0)
+            {
+            hipLaunchKernelGGL(
+                (gpu_compute_bond_forces_high_degree_kernel<evaluator, group_size, true>),
+                high_degree_grid,
+                high_degree_threads,
+                shared_bytes,
+                0,
+                bond_args.d_force,
+                bond_args.d_virial,
+                bond_args.virial_pitch,
+                bond_args.N,
+                bond_args.d_pos,
+                bond_args.d_charge,
+                bond_args.box,
+                bond_args.d_gpu_bondlist,
+                bond_args.d_gpu_bond_pos,
+                bond_args.d_gpu_bond_offsets,
+                bond_args.d_gpu_high_degree,
+                bond_args.n_high_degree,
+                bond_args.n_bond_types,
+                d_params,
+                d_flags,
+                bond_args.subset);
+            }
         }
     else
         {
@@ -319,12 +560,39 @@ gpu_compute_bond_forces(const kernel::bond_args_t<group_size>& bond_args,
                            bond_args.d_charge,
                            bond_args.box,
                            bond_args.d_gpu_bondlist,
-                           bond_args.gpu_table_indexer,
                            bond_args.d_gpu_bond_pos,
-                           bond_args.d_gpu_n_bonds,
+                           bond_args.d_gpu_bond_offsets,
+                           bond_args.high_degree,
                            bond_args.n_bond_types,
                            d_params,
-                           d_flags);
+                           d_flags,
+                           bond_args.subset);
+
+        if (bond_args.n_high_degree > 0)
+            {
+            hipLaunchKernelGGL(
+                (gpu_compute_bond_forces_high_degree_kernel<evaluator, group_size, false>),
+                high_degree_grid,
+                high_degree_threads,
+                shared_bytes,
+                0,
+                bond_args.d_force,
+                bond_args.d_virial,
+                bond_args.virial_pitch,
+                bond_args.N,
+                bond_args.d_pos,
+                bond_args.d_charge,
+                bond_args.box,
+                bond_args.d_gpu_bondlist,
+                bond_args.d_gpu_bond_pos,
+                bond_args.d_gpu_bond_offsets,
+                bond_args.d_gpu_high_degree,
+                bond_args.n_high_degree,
+                bond_args.n_bond_types,
+                d_params,
+                d_flags,
+                bond_args.subset);
+            }
         }
 
     return hipSuccess;
@@ -47,6 +47,12 @@ class PotentialBondGPU : public PotentialBond<evaluator, Bonds>
 
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
+
+    //! Compute the forces on particles that have no ghost bond partners
+    virtual bool computeInteriorForces(uint64_t timestep);
+
+    //! Launch the force kernel
+    void launchForces(unsigned int subset);
     };
 
 template<class evaluator, class Bonds>
@@ -116,6 +122,32 @@ PotentialBondGPU<evaluator, Bonds>::PotentialBondGPU(std::shared_ptr<SystemDefin
 
 template<class evaluator, class Bonds>
 void PotentialBondGPU<evaluator, Bonds>::computeForces(uint64_t timestep)
+    {
+    // the interior particles were computed while the ghost positions were in flight
+    launchForces(this->m_interior_computed ? kernel::bond_subset_boundary
+                                           : kernel::bond_subset_all);
+    }
+
+/*! \param timestep Current time step
+    \returns true when the forces on the interior particles have been computed
+
+    Interior particles have no ghost bond partners. Their forces are computed once the autotuner
+    has completed its scan (so that it times full launches only).
+*/
+template<class evaluator, class Bonds>
+bool PotentialBondGPU<evaluator, Bonds>::computeInteriorForces(uint64_t timestep)
+    {
+    if (!m_tuner->isComplete())
+        return false;
+
+    launchForces(kernel::bond_subset_interior);
+    return true;
+    }
+
+/*! \param subset Subset of the particles to compute (a kernel::bond_subset)
+ */
+template<class evaluator, class Bonds>
+void PotentialBondGPU<evaluator, Bonds>::launchForces(unsigned int subset)
     {
     // access the particle data
     ArrayHandle<Scalar4> d_pos(this->m_pdata->getPositions(),
@@ -140,19 +172,18 @@ void PotentialBondGPU<evaluator, Bonds>::computeForces(uint64_t timestep)
     ArrayHandle<Scalar> d_virial(this->m_virial, access_location::device, access_mode::readwrite);
 
         {
-        const GPUArray<typename Bonds::members_t>& gpu_bond_list = this->m_bond_data->getGPUTable();
-        const Index2D& gpu_table_indexer = this->m_bond_data->getGPUTableIndexer();
-
-        ArrayHandle<typename Bonds::members_t> d_gpu_bondlist(gpu_bond_list,
+        ArrayHandle<typename Bonds::members_t> d_gpu_bondlist(this->m_bond_data->getGPUCSRTable(),
                                                               access_location::device,
                                                               access_mode::read);
-
-        ArrayHandle<unsigned int> d_gpu_bond_pos_list(this->m_bond_data->getGPUPosTable(),
+        ArrayHandle<unsigned int> d_gpu_bond_pos_list(this->m_bond_data->getGPUCSRPosTable(),
                                                       access_location::device,
                                                       access_mode::read);
-        ArrayHandle<unsigned int> d_gpu_n_bonds(this->m_bond_data->getNGroupsArray(),
-                                                access_location::device,
-                                                access_mode::read);
+        ArrayHandle<unsigned int> d_gpu_bond_offsets(this->m_bond_data->getGPUCSROffsets(),
+                                                     access_location::device,
+                                                     access_mode::read);
+        ArrayHandle<unsigned int> d_gpu_high_degree(this->m_bond_data->getGPUCSRHighDegree(),
+                                                    access_location::device,
+                                                    access_mode::read);
 
         // access the flags array for overwriting
         ArrayHandle<unsigned int> d_flags(m_flags, access_location::device, access_mode::readwrite);
@@ -168,12 +199,15 @@ void PotentialBondGPU<evaluator, Bonds>::computeForces(uint64_t timestep)
                                              d_charge.data,
                                              box,
                                              d_gpu_bondlist.data,
-                                             gpu_table_indexer,
                                              d_gpu_bond_pos_list.data,
-                                             d_gpu_n_bonds.data,
+                                             d_gpu_bond_offsets.data,
+                                             d_gpu_high_degree.data,
+                                             this->m_bond_data->getNGPUCSRHighDegree(),
+                                             Bonds::csr_high_degree,
                                              this->m_bond_data->getNTypes(),
                                              this->m_tuner->getParam()[0],
-                                             this->m_exec_conf->dev_prop),
+                                             this->m_exec_conf->dev_prop,
+                                             subset),
             d_params.data,
             d_flags.data);
         }
@@ -7,6 +7,7 @@
 #include "hoomd/VectorMath.h"
 #include "hoomd/managed_allocator.h"
 #include "hoomd/md/EvaluatorExternalPeriodic.h"
+#include "hoomd/md/WallCellList.h"
 #include <memory>
 #include <stdexcept>
 
@@ -68,6 +69,12 @@ template<class evaluator> class PotentialExternal : public ForceCompute
     GPUArray<param_type> m_params;       //!< Array of per-type parameters
     std::shared_ptr<field_type> m_field; /// evaluator dependent field parameters
 
+    /// Walls near each cell of the local box, used only by the wall potentials
+    std::shared_ptr<WallCellList> m_wall_cell_list;
+
+    //! Rebuild the wall cell lists of the wall potentials when needed
+    void updateWallCellList();
+
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
     };
@@ -83,12 +90,33 @@ PotentialExternal<evaluator>::PotentialExternal(std::shared_ptr<SystemDefinition
     {
     GPUArray<param_type> params(m_pdata->getNTypes(), m_exec_conf);
     m_params.swap(params);
+
+    m_wall_cell_list = std::make_shared<WallCellList>(m_exec_conf);
     }
 
 /*! Destructor
  */
 template<class evaluator> PotentialExternal<evaluator>::~PotentialExternal() { }
 
+/*! The wall potentials vanish farther than r_cut from a wall surface, or farther than r_extrap in
+    the extrapolated mode, so the cell lists use the largest of these over all types.
+*/
+template<class evaluator> void PotentialExternal<evaluator>::updateWallCellList()
+    {
+    if constexpr (std::is_same<field_type, wall_type>::value)
+        {
+        Scalar r_cut = Scalar(0.0);
+        ArrayHandle<param_type> h_params(m_params, access_location::host, access_mode::read);
+        for (unsigned int type = 0; type < m_pdata->getNTypes(); type++)
+            {
+            r_cut = std::max(r_cut, sqrt(h_params.data[type].rcutsq));
+            r_cut = std::max(r_cut, h_params.data[type].rextrap);
+            }
+
+        m_wall_cell_list->update(*m_field, m_pdata->getBox(), r_cut, m_sysdef->getNDimensions());
+        }
+    }
+
 /*! Computes the specified constraint forces
     \param timestep Current timestep
 */
@@ -116,6 +144,17 @@ template<class evaluator> void PotentialExternal<evaluator>::computeForces(uint6
 
     const BoxDim box = m_pdata->getGlobalBox();
 
+    // wall potentials evaluate only the walls near each particle
+    updateWallCellList();
+    ArrayHandle<unsigned int> h_wall_cell_size(m_wall_cell_list->getCellSizeArray(),
+                                               access_location::host,
+                                               access_mode::read);
+    ArrayHandle<unsigned int> h_wall_cell_walls(m_wall_cell_list->getCellWallsArray(),
+                                                access_location::host,
+                                                access_mode::read);
+    const wall_cell_list_t wall_cells
+        = m_wall_cell_list->getCellList(h_wall_cell_size.data, h_wall_cell_walls.data);
+
     unsigned int nparticles = m_pdata->getN();
 
     // Zero data for force calculation.
@@ -140,6 +179,7 @@ template<class evaluator> void PotentialExternal<evaluator>::computeForces(uint6
         Scalar virial[6];
 
         evaluator eval(X, q, box, h_params.data[type], *m_field);
+        selectNearbyWalls(eval, wall_cells);
 
         if (evaluator::needsCharge())
             {
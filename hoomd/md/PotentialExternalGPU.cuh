@@ -7,6 +7,7 @@
 
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/ParticleData.cuh"
+#include "hoomd/md/EvaluatorWalls.h"
 
 #include <assert.h>
 
@@ -36,23 +37,25 @@ struct external_potential_args_t
                               const Scalar4* _d_orientation,
                               const Scalar* _d_charge,
                               const BoxDim& _box,
+                              const wall_cell_list_t& _wall_cells,
                               const unsigned int _block_size,
                               const hipDeviceProp_t& _devprop)
         : d_force(_d_force), d_torque(_d_torque), d_virial(_d_virial), virial_pitch(_virial_pitch),
           box(_box), N(_N), d_pos(_d_pos), d_orientation(_d_orientation), d_charge(_d_charge),
-          block_size(_block_size), devprop(_devprop) {};
-
-    Scalar4* d_force;               //!< Force to write out
-    Scalar4* d_torque;              //!< Torque to write out
-    Scalar* d_virial;               //!< Virial to write out
-    const size_t virial_pitch;      //!< The pitch of the 2D array of virial matrix elements
-    const BoxDim box;               //!< Simulation box in GPU format
-    const unsigned int N;           //!< Number of particles
-    const Scalar4* d_pos;           //!< Device array of particle positions
-    const Scalar4* d_orientation;   //!< Device array of particle orientations
-    const Scalar* d_charge;         //!< particle charges
-    const unsigned int block_size;  //!< Block size to execute
-    const hipDeviceProp_t& devprop; //!< Device properties
+          wall_cells(_wall_cells), block_size(_block_size), devprop(_devprop) {};
+
+    Scalar4* d_force;                  //!< Force to write out
+    Scalar4* d_torque;                 //!< Torque to write out
+    Scalar* d_virial;                  //!< Virial to write out
+    const size_t virial_pitch;         //!< The pitch of the 2D array of virial matrix elements
+    const BoxDim box;                  //!< Simulation box in GPU format
+    const unsigned int N;              //!< Number of particles
+    const Scalar4* d_pos;              //!< Device array of particle positions
+    const Scalar4* d_orientation;      //!< Device array of particle orientations
+    const Scalar* d_charge;            //!< particle charges
+    const wall_cell_list_t wall_cells; //!< Walls near each cell, used by the wall potentials
+    const unsigned int block_size;     //!< Block size to execute
+    const hipDeviceProp_t& devprop;    //!< Device properties
     };
 
 //! Driver function for compute external field kernel
@@ -81,6 +84,7 @@ hipError_t __attribute__((visibility("default"))) gpu_compute_potential_external
     \param d_pos device array of particle positions
     \param d_orientation device array of particle orientations
     \param box Box dimensions used to implement periodic boundary conditions
+    \param wall_cells Walls near each cell of the local box, used by the wall potentials
     \param params per-type array of parameters for the potential
 
 */
@@ -94,6 +98,7 @@ __global__ void gpu_compute_external_forces_kernel(Scalar4* d_force,
                                                    const Scalar4* d_orientation,
                                                    const Scalar* d_charge,
                                                    const BoxDim box,
+                                                   const wall_cell_list_t wall_cells,
                                                    const typename evaluator::param_type* params,
                                                    const typename evaluator::field_type* d_field)
     {
@@ -145,6 +150,7 @@ __global__ void gpu_compute_external_forces_kernel(Scalar4* d_force,
     Scalar3 Xi = make_scalar3(posi.x, posi.y, posi.z);
     quat<Scalar> q(d_orientation[idx]);
     evaluator eval(Xi, q, box, params[typei], field);
+    selectNearbyWalls(eval, wall_cells);
 
     if (evaluator::needsCharge())
         eval.setCharge(qi);
@@ -210,6 +216,7 @@ hipError_t gpu_compute_potential_external_forces(
                        external_potential_args.d_orientation,
                        external_potential_args.d_charge,
                        external_potential_args.box,
+                       external_potential_args.wall_cells,
                        d_params,
                        d_field);
 
@@ -77,6 +77,15 @@ template<class evaluator> void PotentialExternalGPU<evaluator>::computeForces(ui
                                                          access_location::device,
                                                          access_mode::read);
 
+    // wall potentials evaluate only the walls near each particle
+    this->updateWallCellList();
+    ArrayHandle<unsigned int> d_wall_cell_size(this->m_wall_cell_list->getCellSizeArray(),
+                                               access_location::device,
+                                               access_mode::read);
+    ArrayHandle<unsigned int> d_wall_cell_walls(this->m_wall_cell_list->getCellWallsArray(),
+                                                access_location::device,
+                                                access_mode::read);
+
     m_tuner->begin();
     kernel::gpu_compute_potential_external_forces<evaluator>(
         kernel::external_potential_args_t(d_force.data,
@@ -88,6 +97,9 @@ template<class evaluator> void PotentialExternalGPU<evaluator>::computeForces(ui
                                           d_orientation.data,
                                           d_charge.data,
                                           box,
+                                          this->m_wall_cell_list->getCellList(
+                                              d_wall_cell_size.data,
+                                              d_wall_cell_walls.data),
                                           m_tuner->getParam()[0],
                                           this->m_exec_conf->dev_prop),
         d_params.data,
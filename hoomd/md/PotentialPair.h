@@ -9,8 +9,11 @@
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <stdexcept>
+#include <type_traits>
 
+#include "ForceThreadBuffers.h"
 #include "NeighborList.h"
+#include "NeighborListCluster.h"
 #include "hoomd/ForceCompute.h"
 #include "hoomd/GlobalArray.h"
 #include "hoomd/HOOMDMath.h"
@@ -199,6 +202,12 @@ template<class evaluator> class PotentialPair : public ForceCompute
     computeEnergyBetweenSetsPythonList(pybind11::array_t<int, pybind11::array::c_style> tags1,
                                        pybind11::array_t<int, pybind11::array::c_style> tags2);
 
+    //! Calculates the energy between two arrays of particle tags
+    virtual Scalar computeEnergyBetweenTags(const unsigned int* tags1,
+                                            size_t n_tags1,
+                                            const unsigned int* tags2,
+                                            size_t n_tags2);
+
     std::vector<std::string> getTypeShapeMapping() const
         {
         std::vector<std::string> type_shape_mapping(m_pdata->getNTypes());
@@ -247,9 +256,38 @@ template<class evaluator> class PotentialPair : public ForceCompute
     std::shared_ptr<Communicator> m_comm;
 #endif
 
+    /// Per-thread force buffers for the CPU force loop with a half neighbor list
+    detail::ForceThreadBuffers m_thread_buffers;
+
+    /// Positions and types of the particles in each cluster (scratch for computeForcesClusters)
+    std::vector<Scalar4> m_cluster_postype;
+
+    /// Charges of the particles in each cluster (scratch for computeForcesClusters)
+    std::vector<Scalar> m_cluster_charge;
+
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
 
+    //! Migrate the particles and exchange the ghosts with their tags
+    void exchangeGhostTags();
+
+    //! Compute the forces from the cluster pairs of a NeighborListCluster
+    void computeForcesClusters(const NeighborListCluster& nlist);
+
+    //! Evaluate the force and energy of one pair, including the energy shift and XPLOR smoothing
+    template<energyShiftMode shift_mode>
+    bool evalPair(Scalar rsq,
+                  const param_type& param,
+                  Scalar rcut_sq,
+                  Scalar ron_sq,
+                  Scalar qi,
+                  Scalar qj,
+                  Scalar& force_divr,
+                  Scalar& pair_eng) const;
+
+    //! Call a function with the energy shift mode and whether there is only one type pair
+    template<class Func> void dispatchVariant(Func&& f) const;
+
     //! Compute the long-range corrections to energy and pressure to account for truncating the pair
     //! potentials
     virtual void computeTailCorrection()
@@ -579,6 +617,112 @@ void PotentialPair<evaluator>::setROnPython(pybind11::tuple types, Scalar r_on)
     setRon(typ1, typ2, r_on);
     }
 
+/*! \param rsq Squared distance between the particles
+    \param param Parameters of the type pair
+    \param rcut_sq Squared cutoff radius of the type pair
+    \param ron_sq Squared XPLOR switching radius of the type pair (only used with xplor)
+    \param qi Charge of particle i
+    \param qj Charge of particle j
+    \param force_divr Force divided by r (output)
+    \param pair_eng Pair energy (output)
+
+    \tparam shift_mode Energy shift mode, so that the branches on it are resolved at compile time
+
+    \returns True if the pair was evaluated
+*/
+template<class evaluator>
+template<typename PotentialPair<evaluator>::energyShiftMode shift_mode>
+inline bool PotentialPair<evaluator>::evalPair(Scalar rsq,
+                                               const param_type& param,
+                                               Scalar rcut_sq,
+                                               Scalar ron_sq,
+                                               Scalar qi,
+                                               Scalar qj,
+                                               Scalar& force_divr,
+                                               Scalar& pair_eng) const
+    {
+    // design specifies that energies are shifted if
+    // 1) shift mode is set to shift
+    // or 2) shift mode is explor and ron > rcut
+    bool energy_shift = false;
+    if (shift_mode == shift)
+        energy_shift = true;
+    else if (shift_mode == xplor)
+        {
+        if (ron_sq > rcut_sq)
+            energy_shift = true;
+        }
+
+    // compute the force and potential energy
+    evaluator eval(rsq, rcut_sq, param);
+    if (evaluator::needsCharge())
+        eval.setCharge(qi, qj);
+
+    bool evaluated = eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+
+    // modify the potential for xplor shifting
+    if (evaluated && shift_mode == xplor)
+        {
+        if (rsq >= ron_sq && rsq < rcut_sq)
+            {
+            // Implement XPLOR smoothing (FLOPS: 16)
+            Scalar old_pair_eng = pair_eng;
+            Scalar old_force_divr = force_divr;
+
+            // calculate 1.0 / (xplor denominator)
+            Scalar xplor_denom_inv
+                = Scalar(1.0) / ((rcut_sq - ron_sq) * (rcut_sq - ron_sq) * (rcut_sq - ron_sq));
+
+            Scalar rsq_minus_r_cut_sq = rsq - rcut_sq;
+            Scalar s = rsq_minus_r_cut_sq * rsq_minus_r_cut_sq
+                       * (rcut_sq + Scalar(2.0) * rsq - Scalar(3.0) * ron_sq) * xplor_denom_inv;
+            Scalar ds_dr_divr
+                = Scalar(12.0) * (rsq - ron_sq) * rsq_minus_r_cut_sq * xplor_denom_inv;
+
+            // make modifications to the old pair energy and force
+            pair_eng = old_pair_eng * s;
+            // note: I'm not sure why the minus sign needs to be there: my notes have a
+            // + But this is verified correct via plotting
+            force_divr = s * old_force_divr - ds_dr_divr * old_pair_eng;
+            }
+        }
+    return evaluated;
+    }
+
+/*! \param f Function to call with a std::integral_constant holding the energy shift mode and a
+        std::bool_constant that is true when the system has only one particle type
+
+    The force loops are compiled once for each combination, so the energy shift is not tested on
+    every pair, and with a single type pair the parameters are loaded once outside of the loop.
+*/
+template<class evaluator>
+template<class Func>
+void PotentialPair<evaluator>::dispatchVariant(Func&& f) const
+    {
+    const bool single_type = m_pdata->getNTypes() == 1;
+    switch (m_shift_mode)
+        {
+    case no_shift:
+        if (single_type)
+            f(std::integral_constant<energyShiftMode, no_shift>(), std::true_type());
+        else
+            f(std::integral_constant<energyShiftMode, no_shift>(), std::false_type());
+        break;
+    case shift:
+        if (single_type)
+            f(std::integral_constant<energyShiftMode, shift>(), std::true_type());
+        else
+            f(std::integral_constant<energyShiftMode, shift>(), std::false_type());
+        break;
+    case xplor:
+        if (single_type)
+            f(std::integral_constant<energyShiftMode, xplor>(), std::true_type());
+        else
+            f(std::integral_constant<energyShiftMode, xplor>(), std::false_type());
+        break;
+        }
+    }
+
 /*! \post The pair forces are computed for the given timestep. The neighborlist's compute method is
    called to ensure that it is up to date before proceeding.
 
@@ -593,6 +737,15 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
     // to reduce computations at the cost of memory access complexity: set that flag now
     bool third_law = m_nlist->getStorageMode() == NeighborList::half;
 
+    // evaluate blocks of neighbors when the list is grouped into cluster pairs
+    auto cluster_nlist = std::dynamic_pointer_cast<NeighborListCluster>(m_nlist);
+    if (cluster_nlist && !third_law)
+        {
+        computeForcesClusters(*cluster_nlist);
+        computeTailCorrection();
+        return;
+        }
+
     // access the neighbor list, particle data, and system box
     ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
                                         access_location::host,
@@ -623,174 +776,411 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
     memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
     memset((void*)h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
 
-    // for each particle
-    for (int i = 0; i < (int)m_pdata->getN(); i++)
+    // loop over the particles in [begin, end) and add their forces to the given arrays
+    auto compute_range = [&](auto shift_tag,
+                             auto single_type_tag,
+                             unsigned int begin,
+                             unsigned int end,
+                             const detail::ForceOutput& out)
+    {
+        constexpr energyShiftMode shift_mode = decltype(shift_tag)::value;
+        constexpr bool single_type = decltype(single_type_tag)::value;
+
+        // with a single type pair, the parameters are loaded once for all pairs
+        [[maybe_unused]] const param_type param_0 = m_params[0];
+        [[maybe_unused]] const Scalar rcut_sq_0 = h_rcutsq.data[0];
+        [[maybe_unused]] const Scalar ron_sq_0 = h_ronsq.data[0];
+        auto eval_pair = [&](Scalar rsq,
+                             unsigned int typei,
+                             unsigned int typej,
+                             Scalar qi,
+                             Scalar qj,
+                             Scalar& force_divr,
+                             Scalar& pair_eng)
         {
-        // access the particle's position and type (MEM TRANSFER: 4 scalars)
-        Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-
-        // sanity check
-        assert(typei < m_pdata->getNTypes());
-
-        // access charge (if needed)
-        Scalar qi = Scalar(0.0);
-        if (evaluator::needsCharge())
-            qi = h_charge.data[i];
+            if constexpr (single_type)
+                {
+                return this->template evalPair<shift_mode>(rsq,
+                                                           param_0,
+                                                           rcut_sq_0,
+                                                           ron_sq_0,
+                                                           qi,
+                                                           qj,
+                                                           force_divr,
+                                                           pair_eng);
+                }
+            else
+                {
+                const unsigned int typpair = m_typpair_idx(typei, typej);
+                return this->template evalPair<shift_mode>(rsq,
+                                                           m_params[typpair],
+                                                           h_rcutsq.data[typpair],
+                                                           h_ronsq.data[typpair],
+                                                           qi,
+                                                           qj,
+                                                           force_divr,
+                                                           pair_eng);
+                }
+        };
 
-        // initialize current particle force, potential energy, and virial to 0
-        Scalar3 fi = make_scalar3(0, 0, 0);
-        Scalar pei = 0.0;
-        Scalar virialxxi = 0.0;
-        Scalar virialxyi = 0.0;
-        Scalar virialxzi = 0.0;
-        Scalar virialyyi = 0.0;
-        Scalar virialyzi = 0.0;
-        Scalar virialzzi = 0.0;
-
-        // loop over all of the neighbors of this particle
-        const size_t myHead = h_head_list.data[i];
-        const unsigned int size = (unsigned int)h_n_neigh.data[i];
-        for (unsigned int k = 0; k < size; k++)
+        for (unsigned int i = begin; i < end; i++)
             {
-            // access the index of this neighbor (MEM TRANSFER: 1 scalar)
-            unsigned int j = h_nlist.data[myHead + k];
-            assert(j < m_pdata->getN() + m_pdata->getNGhosts());
+            // access the particle's position and type (MEM TRANSFER: 4 scalars)
+            Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
 
-            // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
-            Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
-            Scalar3 dx = pi - pj;
-
-            // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
-            unsigned int typej = __scalar_as_int(h_pos.data[j].w);
-            assert(typej < m_pdata->getNTypes());
+            // sanity check
+            assert(typei < m_pdata->getNTypes());
 
             // access charge (if needed)
-            Scalar qj = Scalar(0.0);
+            Scalar qi = Scalar(0.0);
             if (evaluator::needsCharge())
-                qj = h_charge.data[j];
+                qi = h_charge.data[i];
+
+            // initialize current particle force, potential energy, and virial to 0
+            Scalar3 fi = make_scalar3(0, 0, 0);
+            Scalar pei = 0.0;
+            Scalar virialxxi = 0.0;
+            Scalar virialxyi = 0.0;
+            Scalar virialxzi = 0.0;
+            Scalar virialyyi = 0.0;
+            Scalar virialyzi = 0.0;
+            Scalar virialzzi = 0.0;
+
+            // loop over all of the neighbors of this particle
+            const size_t myHead = h_head_list.data[i];
+            const unsigned int size = (unsigned int)h_n_neigh.data[i];
+            for (unsigned int k = 0; k < size; k++)
+                {
+                // access the index of this neighbor (MEM TRANSFER: 1 scalar)
+                unsigned int j = h_nlist.data[myHead + k];
+                assert(j < m_pdata->getN() + m_pdata->getNGhosts());
 
-            // apply periodic boundary conditions
-            dx = box.minImage(dx);
+                // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
+                Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+                Scalar3 dx = pi - pj;
 
-            // calculate r_ij squared (FLOPS: 5)
-            Scalar rsq = dot(dx, dx);
+                // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
+                unsigned int typej = __scalar_as_int(h_pos.data[j].w);
+                assert(typej < m_pdata->getNTypes());
 
-            // get parameters for this type pair
-            unsigned int typpair_idx = m_typpair_idx(typei, typej);
-            const param_type& param = m_params[typpair_idx];
-            Scalar rcutsq = h_rcutsq.data[typpair_idx];
-            Scalar ronsq = Scalar(0.0);
-            if (m_shift_mode == xplor)
-                ronsq = h_ronsq.data[typpair_idx];
+                // access charge (if needed)
+                Scalar qj = Scalar(0.0);
+                if (evaluator::needsCharge())
+                    qj = h_charge.data[j];
 
-            // design specifies that energies are shifted if
-            // 1) shift mode is set to shift
-            // or 2) shift mode is explor and ron > rcut
-            bool energy_shift = false;
-            if (m_shift_mode == shift)
-                energy_shift = true;
-            else if (m_shift_mode == xplor)
+                // apply periodic boundary conditions
+                dx = box.minImage(dx);
+
+                // calculate r_ij squared (FLOPS: 5)
+                Scalar rsq = dot(dx, dx);
+
+                // compute the force and potential energy
+                Scalar force_divr = Scalar(0.0);
+                Scalar pair_eng = Scalar(0.0);
+                bool evaluated = eval_pair(rsq, typei, typej, qi, qj, force_divr, pair_eng);
+
+                if (evaluated)
+                    {
+                    Scalar force_div2r = force_divr * Scalar(0.5);
+                    // add the force, potential energy and virial to the particle i
+                    // (FLOPS: 8)
+                    fi += dx * force_divr;
+                    pei += pair_eng * Scalar(0.5);
+                    if (compute_virial)
+                        {
+                        virialxxi += force_div2r * dx.x * dx.x;
+                        virialxyi += force_div2r * dx.x * dx.y;
+                        virialxzi += force_div2r * dx.x * dx.z;
+                        virialyyi += force_div2r * dx.y * dx.y;
+                        virialyzi += force_div2r * dx.y * dx.z;
+                        virialzzi += force_div2r * dx.z * dx.z;
+                        }
+
+                    // add the force to particle j if we are using the third law (MEM TRANSFER: 10
+                    // scalars / FLOPS: 8) only add force to local particles
+                    if (third_law && j < m_pdata->getN())
+                        {
+                        unsigned int mem_idx = j;
+                        out.force[mem_idx].x -= dx.x * force_divr;
+                        out.force[mem_idx].y -= dx.y * force_divr;
+                        out.force[mem_idx].z -= dx.z * force_divr;
+                        out.force[mem_idx].w += pair_eng * Scalar(0.5);
+                        if (compute_virial)
+                            {
+                            out.virial[0 * out.virial_pitch + mem_idx] += force_div2r * dx.x * dx.x;
+                            out.virial[1 * out.virial_pitch + mem_idx] += force_div2r * dx.x * dx.y;
+                            out.virial[2 * out.virial_pitch + mem_idx] += force_div2r * dx.x * dx.z;
+                            out.virial[3 * out.virial_pitch + mem_idx] += force_div2r * dx.y * dx.y;
+                            out.virial[4 * out.virial_pitch + mem_idx] += force_div2r * dx.y * dx.z;
+                            out.virial[5 * out.virial_pitch + mem_idx] += force_div2r * dx.z * dx.z;
+                            }
+                        }
+                    }
+                }
+
+            // finally, increment the force, potential energy and virial for particle i
+            unsigned int mem_idx = i;
+            out.force[mem_idx].x += fi.x;
+            out.force[mem_idx].y += fi.y;
+            out.force[mem_idx].z += fi.z;
+            out.force[mem_idx].w += pei;
+            if (compute_virial)
                 {
-                if (ronsq > rcutsq)
-                    energy_shift = true;
+                out.virial[0 * out.virial_pitch + mem_idx] += virialxxi;
+                out.virial[1 * out.virial_pitch + mem_idx] += virialxyi;
+                out.virial[2 * out.virial_pitch + mem_idx] += virialxzi;
+                out.virial[3 * out.virial_pitch + mem_idx] += virialyyi;
+                out.virial[4 * out.virial_pitch + mem_idx] += virialyzi;
+                out.virial[5 * out.virial_pitch + mem_idx] += virialzzi;
                 }
+            }
+    };
+
+    // with a full list, each particle only adds to its own force, so the particles are split
+    // over the threads directly. with a half list, each thread accumulates into its own buffer.
+    const detail::ForceOutput out
+        = {h_force.data, nullptr, compute_virial ? h_virial.data : nullptr, m_virial_pitch};
+    dispatchVariant(
+        [&](auto shift_tag, auto single_type_tag)
+        {
+            auto compute_variant
+                = [&](unsigned int begin, unsigned int end, const detail::ForceOutput& out_range)
+            { compute_range(shift_tag, single_type_tag, begin, end, out_range); };
 
-            // compute the force and potential energy
-            Scalar force_divr = Scalar(0.0);
-            Scalar pair_eng = Scalar(0.0);
-            evaluator eval(rsq, rcutsq, param);
-            if (evaluator::needsCharge())
-                eval.setCharge(qi, qj);
+            if (third_law)
+                {
+                m_thread_buffers
+                    .run(*m_exec_conf, m_pdata->getN(), m_pdata->getN(), out, compute_variant);
+                }
+            else
+                {
+                hoomd::detail::parallelForEach(*m_exec_conf,
+                                        m_pdata->getN(),
+                                        [&](unsigned int begin, unsigned int end)
+                                        { compute_variant(begin, end, out); });
+                }
+        });
 
-            bool evaluated = eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+    computeTailCorrection();
+    }
 
-            if (evaluated)
+/*! \param nlist Neighbor list with the cluster pairs (in full storage mode)
+
+    The positions, types, and charges of the particles are first gathered into contiguous arrays
+    in cluster order. Each cluster pair is then evaluated as a block: the separations from one
+    particle of the i-cluster to all of the particles of the j-cluster are computed in fixed length
+    loops over the lanes of the cluster, and the pairs in the mask are evaluated. The forces on the
+    i-cluster are accumulated per lane and written once at the end. Each pair is evaluated from both
+    sides, the same as with a full neighbor list in computeForces.
+*/
+template<class evaluator>
+void PotentialPair<evaluator>::computeForcesClusters(const NeighborListCluster& nlist)
+    {
+    constexpr unsigned int W = NeighborListCluster::cluster_size;
+    const std::vector<unsigned int>& members = nlist.getClusterMembers();
+    const std::vector<unsigned int>& i_clusters = nlist.getIClusters();
+    const std::vector<size_t>& cluster_head = nlist.getClusterHead();
+    const std::vector<NeighborListCluster::ClusterPair>& cluster_pairs = nlist.getClusterPairs();
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+
+    // force arrays
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
+
+    const BoxDim box = m_pdata->getGlobalBox();
+    const bool orthorhombic = box.isOrthorhombic();
+    ArrayHandle<Scalar> h_ronsq(m_ronsq, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_rcutsq(m_rcutsq, access_location::host, access_mode::read);
+
+    PDataFlags flags = this->m_pdata->getFlags();
+    bool compute_virial = flags[pdata_flag::pressure_tensor];
+
+    // need to start from a zero force, energy and virial
+    memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+    memset((void*)h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+
+    // gather the particles into cluster order, empty slots are masked out of every pair
+    m_cluster_postype.resize(members.size());
+    m_cluster_charge.resize(members.size());
+    for (size_t slot = 0; slot < members.size(); ++slot)
+        {
+        const unsigned int idx = members[slot];
+        if (idx != NeighborListCluster::NO_PARTICLE)
+            {
+            m_cluster_postype[slot] = h_pos.data[idx];
+            m_cluster_charge[slot] = (evaluator::needsCharge()) ? h_charge.data[idx] : Scalar(0.0);
+            }
+        else
+            {
+            m_cluster_postype[slot] = make_scalar4(0, 0, 0, __int_as_scalar(0));
+            m_cluster_charge[slot] = Scalar(0.0);
+            }
+        }
+
+    const unsigned int N = m_pdata->getN();
+
+    // each i-cluster only adds to the forces of its own particles, so they are split over the
+    // threads directly
+    auto compute_range
+        = [&](auto shift_tag, auto single_type_tag, unsigned int begin, unsigned int end)
+    {
+        constexpr energyShiftMode shift_mode = decltype(shift_tag)::value;
+        constexpr bool single_type = decltype(single_type_tag)::value;
+
+        // with a single type pair, the parameters are loaded once for all pairs
+        [[maybe_unused]] const param_type param_0 = m_params[0];
+        [[maybe_unused]] const Scalar rcut_sq_0 = h_rcutsq.data[0];
+        [[maybe_unused]] const Scalar ron_sq_0 = h_ronsq.data[0];
+        auto eval_pair = [&](Scalar rsq,
+                             unsigned int typei,
+                             unsigned int typej,
+                             Scalar qi,
+                             Scalar qj,
+                             Scalar& force_divr,
+                             Scalar& pair_eng)
+        {
+            if constexpr (single_type)
                 {
-                // modify the potential for xplor shifting
-                if (m_shift_mode == xplor)
+                return this->template evalPair<shift_mode>(rsq,
+                                                           param_0,
+                                                           rcut_sq_0,
+                                                           ron_sq_0,
+                                                           qi,
+                                                           qj,
+                                                           force_divr,
+                                                           pair_eng);
+                }
+            else
+                {
+                const unsigned int typpair = m_typpair_idx(typei, typej);
+                return this->template evalPair<shift_mode>(rsq,
+                                                           m_params[typpair],
+                                                           h_rcutsq.data[typpair],
+                                                           h_ronsq.data[typpair],
+                                                           qi,
+                                                           qj,
+                                                           force_divr,
+                                                           pair_eng);
+                }
+        };
+
+        for (unsigned int ci = begin; ci < end; ++ci)
+            {
+            const unsigned int cluster_i = i_clusters[ci];
+            const Scalar4* postype_i = &m_cluster_postype[cluster_i * W];
+            const Scalar* charge_i = &m_cluster_charge[cluster_i * W];
+
+            // force, potential energy and virial of each lane of the i-cluster
+            Scalar3 fi[W];
+            Scalar pei[W];
+            Scalar viriali[6][W];
+            for (unsigned int a = 0; a < W; ++a)
+                {
+                fi[a] = make_scalar3(0, 0, 0);
+                pei[a] = Scalar(0.0);
+                for (unsigned int k = 0; k < 6; ++k)
+                    viriali[k][a] = Scalar(0.0);
+                }
+
+            for (size_t p = cluster_head[ci]; p < cluster_head[ci + 1]; ++p)
+                {
+                const NeighborListCluster::ClusterPair& pair = cluster_pairs[p];
+                const Scalar4* postype_j = &m_cluster_postype[pair.cluster * W];
+                const Scalar* charge_j = &m_cluster_charge[pair.cluster * W];
+
+                for (unsigned int a = 0; a < W; ++a)
                     {
-                    if (rsq >= ronsq && rsq < rcutsq)
-                        {
-                        // Implement XPLOR smoothing (FLOPS: 16)
-                        Scalar old_pair_eng = pair_eng;
-                        Scalar old_force_divr = force_divr;
+                    const unsigned int lane_mask = (pair.mask >> (a * W)) & ((1u << W) - 1);
+                    if (lane_mask == 0)
+                        continue;
 
-                        // calculate 1.0 / (xplor denominator)
-                        Scalar xplor_denom_inv
-                            = Scalar(1.0)
-                              / ((rcutsq - ronsq) * (rcutsq - ronsq) * (rcutsq - ronsq));
+                    const unsigned int typei = __scalar_as_int(postype_i[a].w);
 
-                        Scalar rsq_minus_r_cut_sq = rsq - rcutsq;
-                        Scalar s = rsq_minus_r_cut_sq * rsq_minus_r_cut_sq
-                                   * (rcutsq + Scalar(2.0) * rsq - Scalar(3.0) * ronsq)
-                                   * xplor_denom_inv;
-                        Scalar ds_dr_divr
-                            = Scalar(12.0) * (rsq - ronsq) * rsq_minus_r_cut_sq * xplor_denom_inv;
+                    // separations to every lane of the j-cluster, wrapped as a batch
+                    Scalar dx_x[W], dx_y[W], dx_z[W];
+                    for (unsigned int b = 0; b < W; ++b)
+                        {
+                        dx_x[b] = postype_i[a].x - postype_j[b].x;
+                        dx_y[b] = postype_i[a].y - postype_j[b].y;
+                        dx_z[b] = postype_i[a].z - postype_j[b].z;
+                        }
+                    if (orthorhombic)
+                        box.minImageBatch<false>(dx_x, dx_y, dx_z, W);
+                    else
+                        box.minImageBatch<true>(dx_x, dx_y, dx_z, W);
+
+                    Scalar3 dx[W];
+                    Scalar rsq[W];
+                    for (unsigned int b = 0; b < W; ++b)
+                        {
+                        dx[b] = make_scalar3(dx_x[b], dx_y[b], dx_z[b]);
+                        rsq[b] = dot(dx[b], dx[b]);
+                        }
 
-                        // make modifications to the old pair energy and force
-                        pair_eng = old_pair_eng * s;
-                        // note: I'm not sure why the minus sign needs to be there: my notes have a
-                        // + But this is verified correct via plotting
-                        force_divr = s * old_force_divr - ds_dr_divr * old_pair_eng;
+                    for (unsigned int b = 0; b < W; ++b)
+                        {
+                        if (!(lane_mask & (1u << b)))
+                            continue;
+
+                        const unsigned int typej = __scalar_as_int(postype_j[b].w);
+                        Scalar force_divr = Scalar(0.0);
+                        Scalar pair_eng = Scalar(0.0);
+                        bool evaluated = eval_pair(rsq[b],
+                                                   typei,
+                                                   typej,
+                                                   charge_i[a],
+                                                   charge_j[b],
+                                                   force_divr,
+                                                   pair_eng);
+                        if (evaluated)
+                            {
+                            Scalar force_div2r = force_divr * Scalar(0.5);
+                            fi[a] += dx[b] * force_divr;
+                            pei[a] += pair_eng * Scalar(0.5);
+                            if (compute_virial)
+                                {
+                                viriali[0][a] += force_div2r * dx[b].x * dx[b].x;
+                                viriali[1][a] += force_div2r * dx[b].x * dx[b].y;
+                                viriali[2][a] += force_div2r * dx[b].x * dx[b].z;
+                                viriali[3][a] += force_div2r * dx[b].y * dx[b].y;
+                                viriali[4][a] += force_div2r * dx[b].y * dx[b].z;
+                                viriali[5][a] += force_div2r * dx[b].z * dx[b].z;
+                                }
+                            }
                         }
                     }
+                }
 
-                Scalar force_div2r = force_divr * Scalar(0.5);
-                // add the force, potential energy and virial to the particle i
-                // (FLOPS: 8)
-                fi += dx * force_divr;
-                pei += pair_eng * Scalar(0.5);
+            // finally, increment the force, potential energy and virial for the local particles
+            for (unsigned int a = 0; a < W; ++a)
+                {
+                const unsigned int mem_idx = members[cluster_i * W + a];
+                if (mem_idx == NeighborListCluster::NO_PARTICLE || mem_idx >= N)
+                    continue;
+
+                h_force.data[mem_idx].x += fi[a].x;
+                h_force.data[mem_idx].y += fi[a].y;
+                h_force.data[mem_idx].z += fi[a].z;
+                h_force.data[mem_idx].w += pei[a];
                 if (compute_virial)
                     {
-                    virialxxi += force_div2r * dx.x * dx.x;
-                    virialxyi += force_div2r * dx.x * dx.y;
-                    virialxzi += force_div2r * dx.x * dx.z;
-                    virialyyi += force_div2r * dx.y * dx.y;
-                    virialyzi += force_div2r * dx.y * dx.z;
-                    virialzzi += force_div2r * dx.z * dx.z;
-                    }
-
-                // add the force to particle j if we are using the third law (MEM TRANSFER: 10
-                // scalars / FLOPS: 8) only add force to local particles
-                if (third_law && j < m_pdata->getN())
-                    {
-                    unsigned int mem_idx = j;
-                    h_force.data[mem_idx].x -= dx.x * force_divr;
-                    h_force.data[mem_idx].y -= dx.y * force_divr;
-                    h_force.data[mem_idx].z -= dx.z * force_divr;
-                    h_force.data[mem_idx].w += pair_eng * Scalar(0.5);
-                    if (compute_virial)
-                        {
-                        h_virial.data[0 * m_virial_pitch + mem_idx] += force_div2r * dx.x * dx.x;
-                        h_virial.data[1 * m_virial_pitch + mem_idx] += force_div2r * dx.x * dx.y;
-                        h_virial.data[2 * m_virial_pitch + mem_idx] += force_div2r * dx.x * dx.z;
-                        h_virial.data[3 * m_virial_pitch + mem_idx] += force_div2r * dx.y * dx.y;
-                        h_virial.data[4 * m_virial_pitch + mem_idx] += force_div2r * dx.y * dx.z;
-                        h_virial.data[5 * m_virial_pitch + mem_idx] += force_div2r * dx.z * dx.z;
-                        }
+                    for (unsigned int k = 0; k < 6; ++k)
+                        h_virial.data[k * m_virial_pitch + mem_idx] += viriali[k][a];
                     }
                 }
             }
-
-        // finally, increment the force, potential energy and virial for particle i
-        unsigned int mem_idx = i;
-        h_force.data[mem_idx].x += fi.x;
-        h_force.data[mem_idx].y += fi.y;
-        h_force.data[mem_idx].z += fi.z;
-        h_force.data[mem_idx].w += pei;
-        if (compute_virial)
-            {
-            h_virial.data[0 * m_virial_pitch + mem_idx] += virialxxi;
-            h_virial.data[1 * m_virial_pitch + mem_idx] += virialxyi;
-            h_virial.data[2 * m_virial_pitch + mem_idx] += virialxzi;
-            h_virial.data[3 * m_virial_pitch + mem_idx] += virialyyi;
-            h_virial.data[4 * m_virial_pitch + mem_idx] += virialyzi;
-            h_virial.data[5 * m_virial_pitch + mem_idx] += virialzzi;
-            }
-        }
-
-    computeTailCorrection();
+    };
+    dispatchVariant(
+        [&](auto shift_tag, auto single_type_tag)
+        {
+            hoomd::detail::parallelForEach(*m_exec_conf,
+                                    static_cast<unsigned int>(i_clusters.size()),
+                                    [&](unsigned int begin, unsigned int end)
+                                    { compute_range(shift_tag, single_type_tag, begin, end); });
+        });
     }
 
 #ifdef ENABLE_MPI
@@ -839,23 +1229,7 @@ inline void PotentialPair<evaluator>::computeEnergyBetweenSets(InputIterator fir
     if (first1 == last1 || first2 == last2)
         return;
 
-#ifdef ENABLE_MPI
-    if (m_sysdef->isDomainDecomposed())
-        {
-        // temporarily add tag comm flag
-        CommFlags old_flags = m_comm->getFlags();
-        CommFlags new_flags = old_flags;
-        new_flags[comm_flag::tag] = 1;
-        m_comm->setFlags(new_flags);
-
-        // force communication
-        m_comm->migrateParticles();
-        m_comm->exchangeGhosts();
-
-        // reset the old flags
-        m_comm->setFlags(old_flags);
-        }
-#endif
+    exchangeGhostTags();
 
     energy = Scalar(0.0);
 
@@ -990,13 +1364,53 @@ inline void PotentialPair<evaluator>::computeEnergyBetweenSets(InputIterator fir
 #endif
     }
 
+/*! The tags are needed to find the particles in both sets among the ghosts, which are normally
+    exchanged without them.
+*/
+template<class evaluator> void PotentialPair<evaluator>::exchangeGhostTags()
+    {
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        // temporarily add tag comm flag
+        CommFlags old_flags = m_comm->getFlags();
+        CommFlags new_flags = old_flags;
+        new_flags[comm_flag::tag] = 1;
+        m_comm->setFlags(new_flags);
+
+        // force communication
+        m_comm->migrateParticles();
+        m_comm->exchangeGhosts();
+
+        // reset the old flags
+        m_comm->setFlags(old_flags);
+        }
+#endif
+    }
+
+/*! \param tags1 Tags of the particles in the first set
+    \param n_tags1 Number of tags in \a tags1
+    \param tags2 Tags of the particles in the second set
+    \param n_tags2 Number of tags in \a tags2
+    \returns The sum of the energies between all particles in \a tags1 and \a tags2
+*/
+template<class evaluator>
+Scalar PotentialPair<evaluator>::computeEnergyBetweenTags(const unsigned int* tags1,
+                                                          size_t n_tags1,
+                                                          const unsigned int* tags2,
+                                                          size_t n_tags2)
+    {
+    Scalar eng = 0.0;
+    computeEnergyBetweenSets(tags1, tags1 + n_tags1, tags2, tags2 + n_tags2, eng);
+    return eng;
+    }
+
 //! Calculates the energy between two lists of particles.
 template<class evaluator>
 Scalar PotentialPair<evaluator>::computeEnergyBetweenSetsPythonList(
     pybind11::array_t<int, pybind11::array::c_style> tags1,
     pybind11::array_t<int, pybind11::array::c_style> tags2)
     {
-    Scalar eng = 0.0;
     if (tags1.ndim() != 1)
         throw std::domain_error("error: ndim != 2");
     unsigned int* itags1 = (unsigned int*)tags1.mutable_data();
@@ -1004,8 +1418,7 @@ Scalar PotentialPair<evaluator>::computeEnergyBetweenSetsPythonList(
     if (tags2.ndim() != 1)
         throw std::domain_error("error: ndim != 2");
     unsigned int* itags2 = (unsigned int*)tags2.mutable_data();
-    computeEnergyBetweenSets(itags1, itags1 + tags1.size(), itags2, itags2 + tags2.size(), eng);
-    return eng;
+    return computeEnergyBetweenTags(itags1, tags1.size(), itags2, tags2.size());
     }
 
 namespace detail
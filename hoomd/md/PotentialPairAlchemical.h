@@ -31,6 +31,10 @@ template<class evaluator> struct AlchemyPackage
     std::vector<std::array<Scalar, evaluator::num_alchemical_parameters>> alphas = {};
     std::vector<ArrayHandle<Scalar>> force_handles = {};
     std::vector<std::bitset<evaluator::num_alchemical_parameters>> compute_mask = {};
+    //! Alphas of each sampled alchemical state, indexed by [sample][type pair]
+    std::vector<std::vector<std::array<Scalar, evaluator::num_alchemical_parameters>>>
+        sample_alphas = {};
+    std::vector<Scalar> sample_energies = {}; //!< Pair energy at each sampled state
 
     AlchemyPackage(std::nullptr_t) {};
     AlchemyPackage() {};
@@ -41,6 +45,11 @@ template<class evaluator> struct AlchemyPackage
 
     <b>Implementation details</b>
 
+    Free energy estimators need the energy of the current configuration at many alchemical
+    states. When the enabled alchemical particles of this potential set alpha_samples, each
+    neighbor pair found in the force loop is also evaluated at every sampled state, so the
+    energies at all states come from the same sweep over the neighbor list. The sampled energies
+    are available from getSampleEnergies() after the forces are computed.
 
 
     \sa export_PotentialPair()
@@ -90,6 +99,12 @@ class PotentialPairAlchemical : public PotentialPair<evaluator>
             = false;
         }
 
+    //! Get the total pair energy at each of the sampled alchemical states
+    pybind11::array_t<Scalar> getSampleEnergies()
+        {
+        return pybind11::array(m_sample_energies.size(), m_sample_energies.data());
+        }
+
     protected:
     typedef std::bitset<evaluator::num_alchemical_parameters> mask_type;
     typedef std::array<Scalar, evaluator::num_alchemical_parameters> alpha_array_t;
@@ -117,7 +132,8 @@ class PotentialPairAlchemical : public PotentialPair<evaluator>
     Index2DUpperTriangular m_alchemy_index; //!< upper triangular typepair index
     std::vector<mask_type> m_alchemy_mask;  //!< Type pair mask for if alchemical forces are used
     std::vector<std::shared_ptr<alpha_particle_type>>
-        m_alchemical_particles; //!< 2D array (alchemy_index,alchemical param)
+        m_alchemical_particles;           //!< 2D array (alchemy_index,alchemical param)
+    std::vector<Scalar> m_sample_energies; //!< Pair energy at each sampled alchemical state
 
     //! Method to be called when number of particles changes
     void slotNumParticlesChange()
@@ -139,6 +155,17 @@ class PotentialPairAlchemical : public PotentialPair<evaluator>
                                        extra_pkg&);
     virtual inline void pkgFinalize(extra_pkg&);
 
+    //! Add the energy of a pair at each sampled alchemical state
+    inline void evalSampleEnergies(Scalar rsq,
+                                   Scalar rcutsq,
+                                   const typename evaluator::param_type& param,
+                                   Scalar qi,
+                                   Scalar qj,
+                                   unsigned int alchemy_index,
+                                   bool energy_shift,
+                                   Scalar weight,
+                                   extra_pkg& pkg);
+
     virtual void computeForces(uint64_t timestep);
     };
 
@@ -208,6 +235,41 @@ inline extra_pkg PotentialPairAlchemical<evaluator, extra_pkg, alpha_particle_ty
             }
     pkg.compute_mask.swap(compute_mask);
 
+    // collect the alchemical states to sample, all enabled particles must list the same number
+    size_t n_samples = 0;
+    for (auto& particle : m_alchemical_particles)
+        {
+        if (!particle || particle->alpha_samples.empty()
+            || !m_alchemy_mask[m_alchemy_index(particle->m_type_pair_param.x,
+                                               particle->m_type_pair_param.y)]
+                              [particle->m_type_pair_param.z])
+            continue;
+        if (n_samples != 0 && particle->alpha_samples.size() != n_samples)
+            {
+            throw std::runtime_error(
+                "All alchemical degrees of freedom must have the same number of alpha samples.");
+            }
+        n_samples = particle->alpha_samples.size();
+        }
+
+    if (n_samples > 0)
+        {
+        pkg.sample_alphas.assign(n_samples, pkg.alphas);
+        pkg.sample_energies.assign(n_samples, Scalar(0.0));
+        for (auto& particle : m_alchemical_particles)
+            {
+            if (!particle || particle->alpha_samples.empty())
+                continue;
+            unsigned int pair_idx = m_alchemy_index(particle->m_type_pair_param.x,
+                                                    particle->m_type_pair_param.y);
+            if (!m_alchemy_mask[pair_idx][particle->m_type_pair_param.z])
+                continue;
+            for (size_t k = 0; k < n_samples; k++)
+                pkg.sample_alphas[k][pair_idx][particle->m_type_pair_param.z]
+                    = particle->alpha_samples[k];
+            }
+        }
+
     if (pkg.calculate_derivatives)
         {
         m_exec_conf->msg->notice(10)
@@ -283,6 +345,43 @@ PotentialPairAlchemical<evaluator, extra_pkg, alpha_particle_type>::pkgFinalize(
                 }
     }
 
+/*! \param rsq Squared distance between the particles
+    \param rcutsq Squared cutoff distance of the type pair
+    \param param Parameters of the type pair before the alchemical update
+    \param qi Charge of particle i
+    \param qj Charge of particle j
+    \param alchemy_index Index of the type pair in m_alchemy_index
+    \param energy_shift Whether to shift the energy to zero at the cutoff
+    \param weight Fraction of the pair energy counted by this evaluation
+    \param pkg Package holding the sampled states and accumulated energies
+*/
+template<class evaluator, typename extra_pkg, typename alpha_particle_type>
+inline void PotentialPairAlchemical<evaluator, extra_pkg, alpha_particle_type>::evalSampleEnergies(
+    Scalar rsq,
+    Scalar rcutsq,
+    const typename evaluator::param_type& param,
+    Scalar qi,
+    Scalar qj,
+    unsigned int alchemy_index,
+    bool energy_shift,
+    Scalar weight,
+    extra_pkg& pkg)
+    {
+    for (size_t k = 0; k < pkg.sample_energies.size(); k++)
+        {
+        evaluator eval(rsq,
+                       rcutsq,
+                       evaluator::updateAlchemyParams(param, pkg.sample_alphas[k][alchemy_index]));
+        if (evaluator::needsCharge())
+            eval.setCharge(qi, qj);
+
+        Scalar force_divr = Scalar(0.0);
+        Scalar pair_eng = Scalar(0.0);
+        if (eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift))
+            pkg.sample_energies[k] += pair_eng * weight;
+        }
+    }
+
 /*! Compute pair forces with extra alchemical derivatives.
  */
 template<class evaluator, typename extra_pkg, typename alpha_particle_type>
@@ -408,6 +507,22 @@ void PotentialPairAlchemical<evaluator, extra_pkg, alpha_particle_type>::compute
             if (evaluator::needsCharge())
                 eval.setCharge(qi, qj);
 
+            // each pair is visited once per local particle unless the third law applies
+            if (!pkg.sample_energies.empty() && rsq < rcutsq)
+                {
+                Scalar weight
+                    = (third_law && j < m_pdata->getN()) ? Scalar(1.0) : Scalar(0.5);
+                evalSampleEnergies(rsq,
+                                   rcutsq,
+                                   param,
+                                   qi,
+                                   qj,
+                                   m_alchemy_index(typei, typej),
+                                   energy_shift,
+                                   weight,
+                                   pkg);
+                }
+
             pkgPerNeighbor(i, j, typei, typej, (rsq < rcutsq), eval, pkg);
 
             bool evaluated = eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
@@ -498,6 +613,19 @@ void PotentialPairAlchemical<evaluator, extra_pkg, alpha_particle_type>::compute
         }
     pkgFinalize(pkg);
 
+    m_sample_energies.swap(pkg.sample_energies);
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed() && !m_sample_energies.empty())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      m_sample_energies.data(),
+                      static_cast<int>(m_sample_energies.size()),
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
     computeTailCorrection();
     }
 
@@ -520,7 +648,8 @@ void export_PotentialPairAlchemical(pybind11::module& m, const std::string& name
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<NeighborList>>())
         .def("getAlchemicalPairParticle", &T::getAlchemicalPairParticle)
         .def("enableAlchemicalPairParticle", &T::enableAlchemicalPairParticle)
-        .def("disableAlchemicalPairParticle", &T::disableAlchemicalPairParticle);
+        .def("disableAlchemicalPairParticle", &T::disableAlchemicalPairParticle)
+        .def("getSampleEnergies", &T::getSampleEnergies);
     }
 
     } // end namespace detail
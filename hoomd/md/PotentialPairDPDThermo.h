@@ -67,8 +67,17 @@ template<class evaluator> class PotentialPairDPDThermo : public PotentialPair<ev
     protected:
     std::shared_ptr<Variant> m_T; //!< Temperature for the DPD thermostat
 
+    /// Velocities of the particles in each cluster (scratch for computeThermoForcesClusters)
+    std::vector<Scalar3> m_cluster_vel;
+
+    /// Tags of the particles in each cluster (scratch for computeThermoForcesClusters)
+    std::vector<unsigned int> m_cluster_tag;
+
     //! Actually compute the forces (overwrites PotentialPair::computeForces())
     virtual void computeForces(uint64_t timestep);
+
+    //! Compute the forces from the cluster pairs of a NeighborListCluster
+    void computeThermoForcesClusters(const NeighborListCluster& nlist, uint64_t timestep);
     };
 
 /*! \param sysdef System to compute forces on
@@ -108,6 +117,14 @@ template<class evaluator> void PotentialPairDPDThermo<evaluator>::computeForces(
     // to reduce computations at the cost of memory access complexity: set that flag now
     bool third_law = this->m_nlist->getStorageMode() == NeighborList::half;
 
+    // evaluate blocks of neighbors when the list is grouped into cluster pairs
+    auto cluster_nlist = std::dynamic_pointer_cast<NeighborListCluster>(this->m_nlist);
+    if (cluster_nlist && !third_law)
+        {
+        computeThermoForcesClusters(*cluster_nlist, timestep);
+        return;
+        }
+
     // access the neighbor list, particle data, and system box
     ArrayHandle<unsigned int> h_n_neigh(this->m_nlist->getNNeighArray(),
                                         access_location::host,
@@ -143,128 +160,335 @@ template<class evaluator> void PotentialPairDPDThermo<evaluator>::computeForces(
 
     uint16_t seed = this->m_sysdef->getSeed();
 
-    // for each particle
-    for (int i = 0; i < (int)this->m_pdata->getN(); i++)
-        {
-        // access the particle's position, velocity, and type (MEM TRANSFER: 7 scalars)
-        Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        Scalar3 vi = make_scalar3(h_vel.data[i].x, h_vel.data[i].y, h_vel.data[i].z);
-
-        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-        const size_t head_i = h_head_list.data[i];
-
-        // sanity check
-        assert(typei < this->m_pdata->getNTypes());
-
-        // initialize current particle force, potential energy, and virial to 0
-        Scalar3 fi = make_scalar3(0, 0, 0);
-        Scalar pei = 0.0;
-        Scalar viriali[6];
-        for (unsigned int l = 0; l < 6; l++)
-            viriali[l] = 0.0;
-
-        // loop over all of the neighbors of this particle
-        const unsigned int size = (unsigned int)h_n_neigh.data[i];
-        for (unsigned int k = 0; k < size; k++)
+    // Special Potential Pair DPD Requirements
+    const Scalar currentTemp = m_T->operator()(timestep);
+
+    // loop over the particles in [begin, end) and add their forces to the given arrays
+    auto compute_range = [&](unsigned int begin, unsigned int end, const detail::ForceOutput& out)
+    {
+        for (unsigned int i = begin; i < end; i++)
             {
-            // access the index of this neighbor (MEM TRANSFER: 1 scalar)
-            unsigned int j = h_nlist.data[head_i + k];
-            assert(j < this->m_pdata->getN() + this->m_pdata->getNGhosts());
-
-            // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
-            Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
-            Scalar3 dx = pi - pj;
-
-            // calculate dv_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
-            Scalar3 vj = make_scalar3(h_vel.data[j].x, h_vel.data[j].y, h_vel.data[j].z);
-            Scalar3 dv = vi - vj;
-
-            // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
-            unsigned int typej = __scalar_as_int(h_pos.data[j].w);
-            assert(typej < this->m_pdata->getNTypes());
-
-            // apply periodic boundary conditions
-            dx = box.minImage(dx);
-
-            // calculate r_ij squared (FLOPS: 5)
-            Scalar rsq = dot(dx, dx);
-
-            // calculate the drag term r \dot v
-            Scalar rdotv = dot(dx, dv);
-
-            // get parameters for this type pair
-            unsigned int typpair_idx = this->m_typpair_idx(typei, typej);
-            const param_type& param = this->m_params[typpair_idx];
-            Scalar rcutsq = h_rcutsq.data[typpair_idx];
-
-            // design specifies that energies are shifted if
-            // 1) shift mode is set to shift
-            bool energy_shift = false;
-            if (this->m_shift_mode == this->shift)
-                energy_shift = true;
-
-            // compute the force and potential energy
-            Scalar force_divr = Scalar(0.0);
-            Scalar force_divr_cons = Scalar(0.0);
-            Scalar pair_eng = Scalar(0.0);
-            evaluator eval(rsq, rcutsq, param);
-
-            // Special Potential Pair DPD Requirements
-            const Scalar currentTemp = m_T->operator()(timestep);
-
-            // set seed using global tags
-            unsigned int tagi = h_tag.data[i];
-            unsigned int tagj = h_tag.data[j];
-            eval.set_seed_ij_timestep(seed, tagi, tagj, timestep);
-            eval.setDeltaT(this->m_deltaT);
-            eval.setRDotV(rdotv);
-            eval.setT(currentTemp);
-
-            bool evaluated
-                = eval.evalForceEnergyThermo(force_divr, force_divr_cons, pair_eng, energy_shift);
-
-            if (evaluated)
+            // access the particle's position, velocity, and type (MEM TRANSFER: 7 scalars)
+            Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            Scalar3 vi = make_scalar3(h_vel.data[i].x, h_vel.data[i].y, h_vel.data[i].z);
+
+            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+            const size_t head_i = h_head_list.data[i];
+
+            // sanity check
+            assert(typei < this->m_pdata->getNTypes());
+
+            // initialize current particle force, potential energy, and virial to 0
+            Scalar3 fi = make_scalar3(0, 0, 0);
+            Scalar pei = 0.0;
+            Scalar viriali[6];
+            for (unsigned int l = 0; l < 6; l++)
+                viriali[l] = 0.0;
+
+            // loop over all of the neighbors of this particle
+            const unsigned int size = (unsigned int)h_n_neigh.data[i];
+            for (unsigned int k = 0; k < size; k++)
                 {
-                // compute the virial (FLOPS: 2)
-                Scalar pair_virial[6];
-                pair_virial[0] = Scalar(0.5) * dx.x * dx.x * force_divr_cons;
-                pair_virial[1] = Scalar(0.5) * dx.x * dx.y * force_divr_cons;
-                pair_virial[2] = Scalar(0.5) * dx.x * dx.z * force_divr_cons;
-                pair_virial[3] = Scalar(0.5) * dx.y * dx.y * force_divr_cons;
-                pair_virial[4] = Scalar(0.5) * dx.y * dx.z * force_divr_cons;
-                pair_virial[5] = Scalar(0.5) * dx.z * dx.z * force_divr_cons;
-
-                // add the force, potential energy and virial to the particle i
-                // (FLOPS: 8)
-                fi += dx * force_divr;
-                pei += pair_eng * Scalar(0.5);
-                for (unsigned int l = 0; l < 6; l++)
-                    viriali[l] += pair_virial[l];
-
-                // add the force to particle j if we are using the third law (MEM TRANSFER: 10
-                // scalars / FLOPS: 8)
-                if (third_law)
+                // access the index of this neighbor (MEM TRANSFER: 1 scalar)
+                unsigned int j = h_nlist.data[head_i + k];
+                assert(j < this->m_pdata->getN() + this->m_pdata->getNGhosts());
+
+                // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
+                Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+                Scalar3 dx = pi - pj;
+
+                // calculate dv_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
+                Scalar3 vj = make_scalar3(h_vel.data[j].x, h_vel.data[j].y, h_vel.data[j].z);
+                Scalar3 dv = vi - vj;
+
+                // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
+                unsigned int typej = __scalar_as_int(h_pos.data[j].w);
+                assert(typej < this->m_pdata->getNTypes());
+
+                // apply periodic boundary conditions
+                dx = box.minImage(dx);
+
+                // calculate r_ij squared (FLOPS: 5)
+                Scalar rsq = dot(dx, dx);
+
+                // calculate the drag term r \dot v
+                Scalar rdotv = dot(dx, dv);
+
+                // get parameters for this type pair
+                unsigned int typpair_idx = this->m_typpair_idx(typei, typej);
+                const param_type& param = this->m_params[typpair_idx];
+                Scalar rcutsq = h_rcutsq.data[typpair_idx];
+
+                // design specifies that energies are shifted if
+                // 1) shift mode is set to shift
+                bool energy_shift = false;
+                if (this->m_shift_mode == this->shift)
+                    energy_shift = true;
+
+                // compute the force and potential energy
+                Scalar force_divr = Scalar(0.0);
+                Scalar force_divr_cons = Scalar(0.0);
+                Scalar pair_eng = Scalar(0.0);
+                evaluator eval(rsq, rcutsq, param);
+
+                // set seed using global tags
+                unsigned int tagi = h_tag.data[i];
+                unsigned int tagj = h_tag.data[j];
+                eval.set_seed_ij_timestep(seed, tagi, tagj, timestep);
+                eval.setDeltaT(this->m_deltaT);
+                eval.setRDotV(rdotv);
+                eval.setT(currentTemp);
+
+                bool evaluated = eval.evalForceEnergyThermo(force_divr,
+                                                            force_divr_cons,
+                                                            pair_eng,
+                                                            energy_shift);
+
+                if (evaluated)
                     {
-                    unsigned int mem_idx = j;
-                    h_force.data[mem_idx].x -= dx.x * force_divr;
-                    h_force.data[mem_idx].y -= dx.y * force_divr;
-                    h_force.data[mem_idx].z -= dx.z * force_divr;
-                    h_force.data[mem_idx].w += pair_eng * Scalar(0.5);
+                    // compute the virial (FLOPS: 2)
+                    Scalar pair_virial[6];
+                    pair_virial[0] = Scalar(0.5) * dx.x * dx.x * force_divr_cons;
+                    pair_virial[1] = Scalar(0.5) * dx.x * dx.y * force_divr_cons;
+                    pair_virial[2] = Scalar(0.5) * dx.x * dx.z * force_divr_cons;
+                    pair_virial[3] = Scalar(0.5) * dx.y * dx.y * force_divr_cons;
+                    pair_virial[4] = Scalar(0.5) * dx.y * dx.z * force_divr_cons;
+                    pair_virial[5] = Scalar(0.5) * dx.z * dx.z * force_divr_cons;
+
+                    // add the force, potential energy and virial to the particle i
+                    // (FLOPS: 8)
+                    fi += dx * force_divr;
+                    pei += pair_eng * Scalar(0.5);
                     for (unsigned int l = 0; l < 6; l++)
-                        h_virial.data[l * this->m_virial_pitch + mem_idx] += pair_virial[l];
+                        viriali[l] += pair_virial[l];
+
+                    // add the force to particle j if we are using the third law (MEM TRANSFER: 10
+                    // scalars / FLOPS: 8)
+                    if (third_law)
+                        {
+                        unsigned int mem_idx = j;
+                        out.force[mem_idx].x -= dx.x * force_divr;
+                        out.force[mem_idx].y -= dx.y * force_divr;
+                        out.force[mem_idx].z -= dx.z * force_divr;
+                        out.force[mem_idx].w += pair_eng * Scalar(0.5);
+                        for (unsigned int l = 0; l < 6; l++)
+                            out.virial[l * out.virial_pitch + mem_idx] += pair_virial[l];
+                        }
                     }
                 }
+
+            // finally, increment the force, potential energy and virial for particle i
+            unsigned int mem_idx = i;
+            out.force[mem_idx].x += fi.x;
+            out.force[mem_idx].y += fi.y;
+            out.force[mem_idx].z += fi.z;
+            out.force[mem_idx].w += pei;
+            for (unsigned int l = 0; l < 6; l++)
+                out.virial[l * out.virial_pitch + mem_idx] += viriali[l];
             }
+    };
+
+    // with a full list, each particle only adds to its own force, so the particles are split
+    // over the threads directly. with a half list, each thread accumulates into its own buffer.
+    const detail::ForceOutput out = {h_force.data, nullptr, h_virial.data, this->m_virial_pitch};
+    if (third_law)
+        {
+        this->m_thread_buffers.run(*this->m_exec_conf,
+                                   this->m_pdata->getN(),
+                                   this->m_pdata->getN() + this->m_pdata->getNGhosts(),
+                                   out,
+                                   compute_range);
+        }
+    else
+        {
+        hoomd::detail::parallelForEach(*this->m_exec_conf,
+                                this->m_pdata->getN(),
+                                [&](unsigned int begin, unsigned int end)
+                                { compute_range(begin, end, out); });
+        }
+    }
+
+/*! \param nlist Neighbor list with the cluster pairs (in full storage mode)
+    \param timestep Current time step
+
+    This follows PotentialPair::computeForcesClusters, with the velocities and tags that the
+    thermostat needs gathered into cluster order along with the positions. The random force of each
+    pair is seeded by the tags, so the forces are the same as with the per-particle list.
+*/
+template<class evaluator>
+void PotentialPairDPDThermo<evaluator>::computeThermoForcesClusters(
+    const NeighborListCluster& nlist,
+    uint64_t timestep)
+    {
+    constexpr unsigned int W = NeighborListCluster::cluster_size;
+    const std::vector<unsigned int>& members = nlist.getClusterMembers();
+    const std::vector<unsigned int>& i_clusters = nlist.getIClusters();
+    const std::vector<size_t>& cluster_head = nlist.getClusterHead();
+    const std::vector<NeighborListCluster::ClusterPair>& cluster_pairs = nlist.getClusterPairs();
+
+    ArrayHandle<Scalar4> h_pos(this->m_pdata->getPositions(),
+                               access_location::host,
+                               access_mode::read);
+    ArrayHandle<Scalar4> h_vel(this->m_pdata->getVelocities(),
+                               access_location::host,
+                               access_mode::read);
+    ArrayHandle<unsigned int> h_tag(this->m_pdata->getTags(),
+                                    access_location::host,
+                                    access_mode::read);
+
+    // force arrays
+    ArrayHandle<Scalar4> h_force(this->m_force, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar> h_virial(this->m_virial, access_location::host, access_mode::overwrite);
 
-        // finally, increment the force, potential energy and virial for particle i
-        unsigned int mem_idx = i;
-        h_force.data[mem_idx].x += fi.x;
-        h_force.data[mem_idx].y += fi.y;
-        h_force.data[mem_idx].z += fi.z;
-        h_force.data[mem_idx].w += pei;
-        for (unsigned int l = 0; l < 6; l++)
-            h_virial.data[l * this->m_virial_pitch + mem_idx] += viriali[l];
+    const BoxDim box = this->m_pdata->getBox();
+    ArrayHandle<Scalar> h_rcutsq(this->m_rcutsq, access_location::host, access_mode::read);
+
+    // need to start from a zero force, energy and virial
+    memset((void*)h_force.data, 0, sizeof(Scalar4) * this->m_force.getNumElements());
+    memset((void*)h_virial.data, 0, sizeof(Scalar) * this->m_virial.getNumElements());
+
+    uint16_t seed = this->m_sysdef->getSeed();
+    const Scalar currentTemp = m_T->operator()(timestep);
+
+    // design specifies that energies are shifted if
+    // 1) shift mode is set to shift
+    const bool energy_shift = (this->m_shift_mode == this->shift);
+
+    // gather the particles into cluster order, empty slots are masked out of every pair
+    std::vector<Scalar4>& cluster_postype = this->m_cluster_postype;
+    cluster_postype.resize(members.size());
+    m_cluster_vel.resize(members.size());
+    m_cluster_tag.resize(members.size());
+    for (size_t slot = 0; slot < members.size(); ++slot)
+        {
+        const unsigned int idx = members[slot];
+        if (idx != NeighborListCluster::NO_PARTICLE)
+            {
+            cluster_postype[slot] = h_pos.data[idx];
+            m_cluster_vel[slot]
+                = make_scalar3(h_vel.data[idx].x, h_vel.data[idx].y, h_vel.data[idx].z);
+            m_cluster_tag[slot] = h_tag.data[idx];
+            }
+        else
+            {
+            cluster_postype[slot] = make_scalar4(0, 0, 0, __int_as_scalar(0));
+            m_cluster_vel[slot] = make_scalar3(0, 0, 0);
+            m_cluster_tag[slot] = 0;
+            }
         }
+
+    const unsigned int N = this->m_pdata->getN();
+
+    // each i-cluster only adds to the forces of its own particles, so they are split over the
+    // threads directly
+    auto compute_range = [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int ci = begin; ci < end; ++ci)
+            {
+            const unsigned int cluster_i = i_clusters[ci];
+            const Scalar4* postype_i = &cluster_postype[cluster_i * W];
+            const Scalar3* vel_i = &m_cluster_vel[cluster_i * W];
+            const unsigned int* tag_i = &m_cluster_tag[cluster_i * W];
+
+            // force, potential energy and virial of each lane of the i-cluster
+            Scalar3 fi[W];
+            Scalar pei[W];
+            Scalar viriali[6][W];
+            for (unsigned int a = 0; a < W; ++a)
+                {
+                fi[a] = make_scalar3(0, 0, 0);
+                pei[a] = Scalar(0.0);
+                for (unsigned int l = 0; l < 6; ++l)
+                    viriali[l][a] = Scalar(0.0);
+                }
+
+            for (size_t p = cluster_head[ci]; p < cluster_head[ci + 1]; ++p)
+                {
+                const NeighborListCluster::ClusterPair& pair = cluster_pairs[p];
+                const Scalar4* postype_j = &cluster_postype[pair.cluster * W];
+                const Scalar3* vel_j = &m_cluster_vel[pair.cluster * W];
+                const unsigned int* tag_j = &m_cluster_tag[pair.cluster * W];
+
+                for (unsigned int a = 0; a < W; ++a)
+                    {
+                    const unsigned int lane_mask = (pair.mask >> (a * W)) & ((1u << W) - 1);
+                    if (lane_mask == 0)
+                        continue;
+
+                    const unsigned int typei = __scalar_as_int(postype_i[a].w);
+
+                    // separations and drag terms to every lane of the j-cluster
+                    Scalar3 dx[W];
+                    Scalar rsq[W];
+                    Scalar rdotv[W];
+                    for (unsigned int b = 0; b < W; ++b)
+                        {
+                        dx[b] = box.minImage(make_scalar3(postype_i[a].x - postype_j[b].x,
+                                                          postype_i[a].y - postype_j[b].y,
+                                                          postype_i[a].z - postype_j[b].z));
+                        rsq[b] = dot(dx[b], dx[b]);
+                        rdotv[b] = dot(dx[b], vel_i[a] - vel_j[b]);
+                        }
+
+                    for (unsigned int b = 0; b < W; ++b)
+                        {
+                        if (!(lane_mask & (1u << b)))
+                            continue;
+
+                        const unsigned int typej = __scalar_as_int(postype_j[b].w);
+                        const unsigned int typpair_idx = this->m_typpair_idx(typei, typej);
+
+                        // compute the force and potential energy
+                        Scalar force_divr = Scalar(0.0);
+                        Scalar force_divr_cons = Scalar(0.0);
+                        Scalar pair_eng = Scalar(0.0);
+                        evaluator eval(rsq[b],
+                                       h_rcutsq.data[typpair_idx],
+                                       this->m_params[typpair_idx]);
+                        eval.set_seed_ij_timestep(seed, tag_i[a], tag_j[b], timestep);
+                        eval.setDeltaT(this->m_deltaT);
+                        eval.setRDotV(rdotv[b]);
+                        eval.setT(currentTemp);
+
+                        bool evaluated = eval.evalForceEnergyThermo(force_divr,
+                                                                    force_divr_cons,
+                                                                    pair_eng,
+                                                                    energy_shift);
+                        if (evaluated)
+                            {
+                            const Scalar half_cons = Scalar(0.5) * force_divr_cons;
+                            fi[a] += dx[b] * force_divr;
+                            pei[a] += pair_eng * Scalar(0.5);
+                            viriali[0][a] += half_cons * dx[b].x * dx[b].x;
+                            viriali[1][a] += half_cons * dx[b].x * dx[b].y;
+                            viriali[2][a] += half_cons * dx[b].x * dx[b].z;
+                            viriali[3][a] += half_cons * dx[b].y * dx[b].y;
+                            viriali[4][a] += half_cons * dx[b].y * dx[b].z;
+                            viriali[5][a] += half_cons * dx[b].z * dx[b].z;
+                            }
+                        }
+                    }
+                }
+
+            // finally, increment the force, potential energy and virial for the local particles
+            for (unsigned int a = 0; a < W; ++a)
+                {
+                const unsigned int mem_idx = members[cluster_i * W + a];
+                if (mem_idx == NeighborListCluster::NO_PARTICLE || mem_idx >= N)
+                    continue;
+
+                h_force.data[mem_idx].x += fi[a].x;
+                h_force.data[mem_idx].y += fi[a].y;
+                h_force.data[mem_idx].z += fi[a].z;
+                h_force.data[mem_idx].w += pei[a];
+                for (unsigned int l = 0; l < 6; ++l)
+                    h_virial.data[l * this->m_virial_pitch + mem_idx] += viriali[l][a];
+                }
+            }
+    };
+    hoomd::detail::parallelForEach(*this->m_exec_conf,
+                            static_cast<unsigned int>(i_clusters.size()),
+                            compute_range);
     }
 
 #ifdef ENABLE_MPI
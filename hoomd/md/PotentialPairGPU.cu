@@ -0,0 +1,117 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "PotentialPairGPU.cuh"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#include <hipcub/hipcub.hpp>
+#pragma GCC diagnostic pop
+
+/*! \file PotentialPairGPU.cu
+    \brief Defines the GPU kernels shared by all pair potentials
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Kernel to flag the particle indices of a set of tags
+/*! \param d_flags Flag per particle index, set to 1 for the particles in the set (output)
+    \param d_tags Tags of the particles in the set
+    \param n_tags Number of tags in \a d_tags
+    \param d_rtag Index of each particle by tag
+    \param n_rtag Number of elements in \a d_rtag
+    \param n_flags Number of elements in \a d_flags
+
+    Tags of particles that are not on this rank are skipped.
+*/
+__global__ void gpu_flag_pair_set_kernel(unsigned char* d_flags,
+                                         const unsigned int* d_tags,
+                                         const unsigned int n_tags,
+                                         const unsigned int* d_rtag,
+                                         const unsigned int n_rtag,
+                                         const unsigned int n_flags)
+    {
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= n_tags)
+        return;
+
+    const unsigned int tag = d_tags[idx];
+    if (tag >= n_rtag)
+        return;
+
+    const unsigned int i = d_rtag[tag];
+    if (i < n_flags)
+        d_flags[i] = 1;
+    }
+
+/*! \param d_flags Flag per particle index, set to 1 for the particles in the set (output)
+    \param d_tags Tags of the particles in the set
+    \param n_tags Number of tags in \a d_tags
+    \param d_rtag Index of each particle by tag
+    \param n_rtag Number of elements in \a d_rtag
+    \param n_flags Number of elements in \a d_flags
+    \param block_size Number of threads per block
+
+    \a d_flags must be zeroed before the call.
+*/
+hipError_t gpu_flag_pair_set(unsigned char* d_flags,
+                             const unsigned int* d_tags,
+                             const unsigned int n_tags,
+                             const unsigned int* d_rtag,
+                             const unsigned int n_rtag,
+                             const unsigned int n_flags,
+                             const unsigned int block_size)
+    {
+    if (n_tags == 0)
+        return hipSuccess;
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_flag_pair_set_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid((n_tags / run_block_size) + 1, 1, 1);
+    dim3 threads(run_block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_flag_pair_set_kernel),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       d_flags,
+                       d_tags,
+                       n_tags,
+                       d_rtag,
+                       n_rtag,
+                       n_flags);
+    return hipSuccess;
+    }
+
+/*! \param d_sum Sum of the energies (output)
+    \param d_tmp Temporary storage for the reduction (output on first call)
+    \param tmp_bytes Number of bytes of temporary storage (output on first call)
+    \param d_energy Energy of each particle in the set
+    \param n Number of particles in the set
+
+    This is a wrapper to hipcub::DeviceReduce::Sum, and as such requires two calls. The first call
+    sizes the temporary storage, which the caller must then allocate into \a d_tmp before calling a
+    second time.
+*/
+hipError_t gpu_sum_pair_energies(Scalar* d_sum,
+                                 void* d_tmp,
+                                 size_t& tmp_bytes,
+                                 const Scalar* d_energy,
+                                 const unsigned int n)
+    {
+    hipcub::DeviceReduce::Sum(d_tmp, tmp_bytes, d_energy, d_sum, n);
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
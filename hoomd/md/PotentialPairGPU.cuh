@@ -62,16 +62,19 @@ struct pair_args_t
                 const unsigned int _block_size,
                 const unsigned int _shift_mode,
                 const unsigned int _compute_virial,
+                const unsigned int _compute_energy,
                 const unsigned int _threads_per_particle,
                 const GPUPartition& _gpu_partition,
-                const hipDeviceProp_t& _devprop)
+                const hipDeviceProp_t& _devprop,
+                const unsigned int* _d_index = nullptr,
+                const unsigned int _n_index = 0)
         : d_force(_d_force), d_virial(_d_virial), virial_pitch(_virial_pitch), N(_N), n_max(_n_max),
           d_pos(_d_pos), d_charge(_d_charge), box(_box), d_n_neigh(_d_n_neigh), d_nlist(_d_nlist),
           d_head_list(_d_head_list), d_rcutsq(_d_rcutsq), d_ronsq(_d_ronsq),
           size_neigh_list(_size_neigh_list), ntypes(_ntypes), block_size(_block_size),
-          shift_mode(_shift_mode), compute_virial(_compute_virial),
+          shift_mode(_shift_mode), compute_virial(_compute_virial), compute_energy(_compute_energy),
           threads_per_particle(_threads_per_particle), gpu_partition(_gpu_partition),
-          devprop(_devprop) {};
+          devprop(_devprop), d_index(_d_index), n_index(_n_index) {};
 
     Scalar4* d_force;          //!< Force to write out
     Scalar* d_virial;          //!< Virial to write out
@@ -92,11 +95,63 @@ struct pair_args_t
     const unsigned int block_size;           //!< Block size to execute
     const unsigned int shift_mode;           //!< The potential energy shift mode
     const unsigned int compute_virial;       //!< Flag to indicate if virials should be computed
+    const unsigned int compute_energy;       //!< Flag to indicate if energies should be computed
     const unsigned int threads_per_particle; //!< Number of threads per particle (maximum: 1 warp)
     const GPUPartition& gpu_partition; //!< The load balancing partition of particles between GPUs
     const hipDeviceProp_t& devprop;    //!< CUDA device properties
+    const unsigned int* d_index;       //!< Indices of the particles to compute (nullptr for all)
+    const unsigned int n_index;        //!< Number of particles in d_index
     };
 
+//! Wraps arguments to gpu_compute_pair_energy_between_sets
+/*! The neighbors of each particle in the first set are read from the neighbor list when
+    \a d_n_neigh is set, otherwise they are found in the cell list.
+*/
+struct pair_sets_args_t
+    {
+    Scalar* d_energy;                //!< Energy of each particle in the first set (output)
+    const unsigned int* d_tags1;     //!< Tags of the particles in the first set
+    unsigned int n_tags1;            //!< Number of tags in the first set
+    const unsigned int* d_rtag;      //!< Index of each particle by tag
+    unsigned int n_rtag;             //!< Number of elements in d_rtag
+    const unsigned char* d_in_set2;  //!< Nonzero for the particle indices in the second set
+    unsigned int N;                  //!< Number of local particles
+    const Scalar4* d_pos;            //!< Particle positions
+    const Scalar* d_charge;          //!< Particle charges
+    BoxDim box;                      //!< Local box
+    const unsigned int* d_n_neigh;   //!< Number of neighbors of each particle (nullptr for cells)
+    const unsigned int* d_nlist;     //!< Neighbor list
+    const size_t* d_head_list;       //!< Head list indexes for accessing d_nlist
+    const unsigned int* d_cell_size; //!< Number of particles in each cell
+    const Scalar4* d_cell_xyzf;      //!< Cell list with the particle index in w
+    const unsigned int* d_cell_adj;  //!< Cell adjacency list
+    Index3D ci;                      //!< Cell indexer
+    Index2D cli;                     //!< Cell list indexer
+    Index2D cadji;                   //!< Cell adjacency indexer
+    Scalar3 ghost_width;             //!< Width of the ghost layer in the cell list
+    const Scalar* d_rcutsq;          //!< r_cut squared per type pair
+    const Scalar* d_ronsq;           //!< r_on squared per type pair
+    unsigned int ntypes;             //!< Number of particle types
+    unsigned int shift_mode;         //!< The potential energy shift mode
+    unsigned int block_size;         //!< Block size to execute
+    };
+
+//! Flag the particle indices of a set of tags
+hipError_t gpu_flag_pair_set(unsigned char* d_flags,
+                             const unsigned int* d_tags,
+                             const unsigned int n_tags,
+                             const unsigned int* d_rtag,
+                             const unsigned int n_rtag,
+                             const unsigned int n_flags,
+                             const unsigned int block_size);
+
+//! Sum the energies of the particles in a set
+hipError_t gpu_sum_pair_energies(Scalar* d_sum,
+                                 void* d_tmp,
+                                 size_t& tmp_bytes,
+                                 const Scalar* d_energy,
+                                 const unsigned int n);
+
 #ifdef __HIPCC__
 
 //! Kernel for calculating pair forces
@@ -118,6 +173,8 @@ struct pair_args_t
     \param d_ronsq ron squared, stored per type pair
     \param ntypes Number of types in the simulation
     \param offset Offset of first particle
+    \param d_index Indices of the particles to compute, or nullptr to compute particles offset to
+           offset + N - 1
 
     \a d_params, \a d_rcutsq, and \a d_ronsq must be indexed with an Index2DUpperTriangular(typei,
    typej) to access the unique value for that type pair. These values are all cached into shared
@@ -130,7 +187,10 @@ struct pair_args_t
    shift_mode 0: No energy shifting is done. 1: V(r) is shifted to be 0 at rcut. 2: XPLOR switching
    is enabled (See PotentialPair for a discussion on what that entails) \tparam compute_virial When
    non-zero, the virial tensor is computed. When zero, the virial tensor is not computed. \tparam
-   tpp Number of threads to use per particle, must be power of 2 and smaller than warp size
+   compute_energy When non-zero, the potential energy is computed. When zero, the energy is not
+   accumulated and is written as 0, so the compiler can drop the energy terms of the evaluator
+   (except with XPLOR smoothing, which needs the energy for the force). \tparam tpp Number of
+   threads to use per particle, must be power of 2 and smaller than warp size
 
     <b>Implementation details</b>
     Each block will calculate the forces on a block of particles.
@@ -140,6 +200,7 @@ struct pair_args_t
 template<class evaluator,
          unsigned int shift_mode,
          unsigned int compute_virial,
+         unsigned int compute_energy,
          int tpp,
          bool enable_shared_cache>
 __global__ void
@@ -158,6 +219,7 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
                                       const Scalar* d_ronsq,
                                       const unsigned int ntypes,
                                       const unsigned int offset,
+                                      const unsigned int* d_index,
                                       unsigned int max_extra_bytes)
     {
     Index2D typpair_idx(ntypes);
@@ -219,6 +281,10 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
     // add offset to get actual particle index
     idx += offset;
 
+    // look up the particle index when computing a subset of the particles
+    if (active && d_index)
+        idx = d_index[idx];
+
     // initialize the force to 0
     Scalar4 force = make_scalar4(Scalar(0.0), Scalar(0.0), Scalar(0.0), Scalar(0.0));
     Scalar virialxx = Scalar(0.0);
@@ -362,7 +428,8 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
                 force.y += dx.y * force_divr;
                 force.z += dx.z * force_divr;
 
-                force.w += pair_eng;
+                if (compute_energy)
+                    force.w += pair_eng;
                 }
             }
 
@@ -375,7 +442,8 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
     force.x = reducer.Sum(force.x);
     force.y = reducer.Sum(force.y);
     force.z = reducer.Sum(force.z);
-    force.w = reducer.Sum(force.w);
+    if (compute_energy)
+        force.w = reducer.Sum(force.w);
 
     // now that the force calculation is complete, write out the result
     if (active && threadIdx.x % tpp == 0)
@@ -419,13 +487,17 @@ template<typename T> int get_max_block_size(T func)
  * \tparam shift_mode 0: No energy shifting is done. 1: V(r) is shifted to be 0 at rcut. 2: XPLOR
  * switching is enabled (See PotentialPair for a discussion on what that entails) \tparam
  * compute_virial When non-zero, the virial tensor is computed. When zero, the virial tensor is not
- * computed. \tparam tpp Number of threads to use per particle, must be power of 2 and smaller than
- * warp size
+ * computed. \tparam compute_energy When non-zero, the potential energy is computed. \tparam tpp
+ * Number of threads to use per particle, must be power of 2 and smaller than warp size
  *
  * Partial function template specialization is not allowed in C++, so instead we have to wrap this
  * with a struct that we are allowed to partially specialize.
  */
-template<class evaluator, unsigned int shift_mode, unsigned int compute_virial, int tpp>
+template<class evaluator,
+         unsigned int shift_mode,
+         unsigned int compute_virial,
+         unsigned int compute_energy,
+         int tpp>
 struct PairForceComputeKernel
     {
     //! Launcher for the pair force kernel
@@ -457,6 +529,7 @@ struct PairForceComputeKernel
                 = get_max_block_size(gpu_compute_pair_forces_shared_kernel<evaluator,
                                                                            shift_mode,
                                                                            compute_virial,
+                                                                           compute_energy,
                                                                            tpp,
                                                                            true>);
 
@@ -466,6 +539,7 @@ struct PairForceComputeKernel
                 reinterpret_cast<const void*>(&gpu_compute_pair_forces_shared_kernel<evaluator,
                                                                                      shift_mode,
                                                                                      compute_virial,
+                                                                                     compute_energy,
                                                                                      tpp,
                                                                                      true>));
 
@@ -496,6 +570,7 @@ struct PairForceComputeKernel
                 hipLaunchKernelGGL((gpu_compute_pair_forces_shared_kernel<evaluator,
                                                                           shift_mode,
                                                                           compute_virial,
+                                                                          compute_energy,
                                                                           tpp,
                                                                           true>),
                                    dim3(grid),
@@ -517,6 +592,7 @@ struct PairForceComputeKernel
                                    pair_args.d_ronsq,
                                    pair_args.ntypes,
                                    offset,
+                                   pair_args.d_index,
                                    max_extra_bytes);
                 }
             else
@@ -524,6 +600,7 @@ struct PairForceComputeKernel
                 hipLaunchKernelGGL((gpu_compute_pair_forces_shared_kernel<evaluator,
                                                                           shift_mode,
                                                                           compute_virial,
+                                                                          compute_energy,
                                                                           tpp,
                                                                           false>),
                                    dim3(grid),
@@ -545,22 +622,24 @@ struct PairForceComputeKernel
                                    pair_args.d_ronsq,
                                    pair_args.ntypes,
                                    offset,
+                                   pair_args.d_index,
                                    max_extra_bytes);
                 }
             }
         else
             {
-            PairForceComputeKernel<evaluator, shift_mode, compute_virial, tpp / 2>::launch(
-                pair_args,
-                range,
-                d_params);
+            PairForceComputeKernel<evaluator, shift_mode, compute_virial, compute_energy, tpp / 2>::
+                launch(pair_args, range, d_params);
             }
         }
     };
 
 //! Template specialization to do nothing for the tpp = 0 case
-template<class evaluator, unsigned int shift_mode, unsigned int compute_virial>
-struct PairForceComputeKernel<evaluator, shift_mode, compute_virial, 0>
+template<class evaluator,
+         unsigned int shift_mode,
+         unsigned int compute_virial,
+         unsigned int compute_energy>
+struct PairForceComputeKernel<evaluator, shift_mode, compute_virial, compute_energy, 0>
     {
     static void launch(const pair_args_t& pair_args,
                        std::pair<unsigned int, unsigned int> range,
@@ -570,11 +649,63 @@ struct PairForceComputeKernel<evaluator, shift_mode, compute_virial, 0>
         }
     };
 
+//! Launch the pair force kernel for the shift mode in the arguments
+/*! \tparam evaluator EvaluatorPair class to evaluate V(r) and -delta V(r)/r
+    \tparam compute_virial When non-zero, the virial tensor is computed
+    \tparam compute_energy When non-zero, the potential energy is computed
+    \param pair_args Other arguments to pass onto the kernel
+    \param range Range of particle indices this GPU operates on
+    \param d_params Parameters for the potential, stored per type pair
+*/
+template<class evaluator, unsigned int compute_virial, unsigned int compute_energy>
+void launch_compute_pair_forces(const pair_args_t& pair_args,
+                                std::pair<unsigned int, unsigned int> range,
+                                const typename evaluator::param_type* d_params)
+    {
+    switch (pair_args.shift_mode)
+        {
+    case 0:
+        {
+        PairForceComputeKernel<evaluator,
+                               0,
+                               compute_virial,
+                               compute_energy,
+                               gpu_pair_force_max_tpp>::launch(pair_args, range, d_params);
+        break;
+        }
+    case 1:
+        {
+        PairForceComputeKernel<evaluator,
+                               1,
+                               compute_virial,
+                               compute_energy,
+                               gpu_pair_force_max_tpp>::launch(pair_args, range, d_params);
+        break;
+        }
+    case 2:
+        {
+        PairForceComputeKernel<evaluator,
+                               2,
+                               compute_virial,
+                               compute_energy,
+                               gpu_pair_force_max_tpp>::launch(pair_args, range, d_params);
+        break;
+        }
+    default:
+        break;
+        }
+    }
+
 //! Kernel driver that computes lj forces on the GPU for LJForceComputeGPU
 /*! \param pair_args Other arguments to pass onto the kernel
     \param d_params Parameters for the potential, stored per type pair
 
     This is just a driver function for gpu_compute_pair_forces_shared_kernel(), see it for details.
+    When \a pair_args.d_index is set, only the listed particles are computed, on the current GPU.
+
+    Three variants of the kernel are compiled: force only, force and energy, and force, energy, and
+    virial. The virial is only needed on steps with pressure computations, so the energy is always
+    computed along with it.
 */
 template<class evaluator>
 __attribute__((visibility("default"))) hipError_t
@@ -587,71 +718,224 @@ gpu_compute_pair_forces(const pair_args_t& pair_args,
     assert(pair_args.ntypes > 0);
 
     // iterate over active GPUs in reverse, to end up on first GPU when returning from this function
-    for (int idev = pair_args.gpu_partition.getNumActiveGPUs() - 1; idev >= 0; --idev)
+    int n_devices = pair_args.d_index ? 1 : pair_args.gpu_partition.getNumActiveGPUs();
+    for (int idev = n_devices - 1; idev >= 0; --idev)
         {
-        auto range = pair_args.gpu_partition.getRangeAndSetGPU(idev);
+        auto range = pair_args.d_index ? std::make_pair(0u, pair_args.n_index)
+                                       : pair_args.gpu_partition.getRangeAndSetGPU(idev);
 
         // Launch kernel
         if (pair_args.compute_virial)
             {
-            switch (pair_args.shift_mode)
-                {
-            case 0:
-                {
-                PairForceComputeKernel<evaluator, 0, 1, gpu_pair_force_max_tpp>::launch(pair_args,
-                                                                                        range,
-                                                                                        d_params);
-                break;
-                }
-            case 1:
-                {
-                PairForceComputeKernel<evaluator, 1, 1, gpu_pair_force_max_tpp>::launch(pair_args,
-                                                                                        range,
-                                                                                        d_params);
-                break;
-                }
-            case 2:
-                {
-                PairForceComputeKernel<evaluator, 2, 1, gpu_pair_force_max_tpp>::launch(pair_args,
-                                                                                        range,
-                                                                                        d_params);
-                break;
-                }
-            default:
-                break;
-                }
+            launch_compute_pair_forces<evaluator, 1, 1>(pair_args, range, d_params);
+            }
+        else if (pair_args.compute_energy)
+            {
+            launch_compute_pair_forces<evaluator, 0, 1>(pair_args, range, d_params);
             }
         else
             {
-            switch (pair_args.shift_mode)
-                {
-            case 0:
-                {
-                PairForceComputeKernel<evaluator, 0, 0, gpu_pair_force_max_tpp>::launch(pair_args,
-                                                                                        range,
-                                                                                        d_params);
-                break;
-                }
-            case 1:
+            launch_compute_pair_forces<evaluator, 0, 0>(pair_args, range, d_params);
+            }
+        }
+
+    return hipSuccess;
+    }
+
+//! Evaluate the energy of one pair for gpu_compute_pair_energy_between_sets_kernel
+/*! \tparam evaluator EvaluatorPair class to evaluate V(r)
+    \tparam shift_mode The potential energy shift mode, see gpu_compute_pair_forces_shared_kernel
+    \param args Arguments of the kernel
+    \param d_params Parameters for the potential, stored per type pair
+    \param posi Position of particle i
+    \param typei Type of particle i
+    \param qi Charge of particle i
+    \param j Index of particle j
+    \returns The energy of the pair
+*/
+template<class evaluator, unsigned int shift_mode>
+__device__ inline Scalar eval_pair_set_energy(const pair_sets_args_t& args,
+                                              const typename evaluator::param_type* d_params,
+                                              const Scalar3& posi,
+                                              unsigned int typei,
+                                              Scalar qi,
+                                              unsigned int j)
+    {
+    const Scalar4 postypej = __ldg(args.d_pos + j);
+    Scalar3 dx = posi - make_scalar3(postypej.x, postypej.y, postypej.z);
+    dx = args.box.minImage(dx);
+    const Scalar rsq = dot(dx, dx);
+
+    Index2D typpair_idx(args.ntypes);
+    const unsigned int typpair = typpair_idx(typei, __scalar_as_int(postypej.w));
+    const Scalar rcutsq = args.d_rcutsq[typpair];
+    const Scalar ronsq = (shift_mode == 2) ? args.d_ronsq[typpair] : Scalar(0.0);
+
+    // energies are shifted in the shift mode, and in the xplor mode when ron > rcut
+    const bool energy_shift = shift_mode == 1 || (shift_mode == 2 && ronsq > rcutsq);
+
+    Scalar force_divr = Scalar(0.0);
+    Scalar pair_eng = Scalar(0.0);
+    evaluator eval(rsq, rcutsq, d_params[typpair]);
+    if (evaluator::needsCharge())
+        eval.setCharge(qi, __ldg(args.d_charge + j));
+    if (!eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift))
+        return Scalar(0.0);
+
+    if (shift_mode == 2 && rsq >= ronsq && rsq < rcutsq)
+        {
+        // XPLOR smoothing
+        Scalar xplor_denom_inv
+            = Scalar(1.0) / ((rcutsq - ronsq) * (rcutsq - ronsq) * (rcutsq - ronsq));
+        Scalar rsq_minus_r_cut_sq = rsq - rcutsq;
+        Scalar s = rsq_minus_r_cut_sq * rsq_minus_r_cut_sq
+                   * (rcutsq + Scalar(2.0) * rsq - Scalar(3.0) * ronsq) * xplor_denom_inv;
+        pair_eng *= s;
+        }
+    return pair_eng;
+    }
+
+//! Kernel for calculating the energy between two sets of particles
+/*! \tparam evaluator EvaluatorPair class to evaluate V(r)
+    \tparam shift_mode The potential energy shift mode, see gpu_compute_pair_forces_shared_kernel
+    \param args Arguments of the kernel
+    \param d_params Parameters for the potential, stored per type pair
+
+    Each thread sums the energy of one particle in the first set with its neighbors in the second
+    set. Particles that are not local to this rank contribute zero.
+*/
+template<class evaluator, unsigned int shift_mode>
+__global__ void
+gpu_compute_pair_energy_between_sets_kernel(const pair_sets_args_t args,
+                                            const typename evaluator::param_type* d_params)
+    {
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= args.n_tags1)
+        return;
+
+    const unsigned int tag = args.d_tags1[idx];
+    const unsigned int i = (tag < args.n_rtag) ? args.d_rtag[tag] : NOT_LOCAL;
+
+    Scalar energy = Scalar(0.0);
+    if (i < args.N)
+        {
+        const Scalar4 postypei = __ldg(args.d_pos + i);
+        const Scalar3 posi = make_scalar3(postypei.x, postypei.y, postypei.z);
+        const unsigned int typei = __scalar_as_int(postypei.w);
+        Scalar qi = Scalar(0.0);
+        if (evaluator::needsCharge())
+            qi = __ldg(args.d_charge + i);
+
+        if (args.d_n_neigh)
+            {
+            const size_t head = args.d_head_list[i];
+            const unsigned int n_neigh = args.d_n_neigh[i];
+            for (unsigned int k = 0; k < n_neigh; ++k)
                 {
-                PairForceComputeKernel<evaluator, 1, 0, gpu_pair_force_max_tpp>::launch(pair_args,
-                                                                                        range,
-                                                                                        d_params);
-                break;
+                const unsigned int j = __ldg(args.d_nlist + head + k);
+                if (!args.d_in_set2[j])
+                    continue;
+                energy += eval_pair_set_energy<evaluator, shift_mode>(args,
+                                                                      d_params,
+                                                                      posi,
+                                                                      typei,
+                                                                      qi,
+                                                                      j);
                 }
-            case 2:
+            }
+        else
+            {
+            // find the cell of the particle
+            const Scalar3 f = args.box.makeFraction(posi, args.ghost_width);
+            int ib = (int)(f.x * args.ci.getW());
+            int jb = (int)(f.y * args.ci.getH());
+            int kb = (int)(f.z * args.ci.getD());
+
+            // handle the case where the particle is exactly at the box hi
+            const uchar3 periodic = args.box.getPeriodic();
+            if (ib == (int)args.ci.getW() && periodic.x)
+                ib = 0;
+            if (jb == (int)args.ci.getH() && periodic.y)
+                jb = 0;
+            if (kb == (int)args.ci.getD() && periodic.z)
+                kb = 0;
+            const unsigned int my_cell = args.ci(ib, jb, kb);
+
+            for (unsigned int cur_adj = 0; cur_adj < args.cadji.getW(); ++cur_adj)
                 {
-                PairForceComputeKernel<evaluator, 2, 0, gpu_pair_force_max_tpp>::launch(pair_args,
-                                                                                        range,
-                                                                                        d_params);
-                break;
-                }
-            default:
-                break;
+                const unsigned int neigh_cell
+                    = __ldg(args.d_cell_adj + args.cadji(cur_adj, my_cell));
+                const unsigned int size = __ldg(args.d_cell_size + neigh_cell);
+                for (unsigned int k = 0; k < size; ++k)
+                    {
+                    const Scalar4 xyzf = __ldg(args.d_cell_xyzf + args.cli(k, neigh_cell));
+                    const unsigned int j = __scalar_as_int(xyzf.w);
+                    if (j == i || !args.d_in_set2[j])
+                        continue;
+                    energy += eval_pair_set_energy<evaluator, shift_mode>(args,
+                                                                          d_params,
+                                                                          posi,
+                                                                          typei,
+                                                                          qi,
+                                                                          j);
+                    }
                 }
             }
         }
 
+    args.d_energy[idx] = energy;
+    }
+
+//! Launch gpu_compute_pair_energy_between_sets_kernel with a shift mode
+template<class evaluator, unsigned int shift_mode>
+void launch_compute_pair_energy_between_sets(const pair_sets_args_t& args,
+                                             const typename evaluator::param_type* d_params)
+    {
+    unsigned int max_block_size
+        = get_max_block_size(gpu_compute_pair_energy_between_sets_kernel<evaluator, shift_mode>);
+    unsigned int run_block_size = min(args.block_size, max_block_size);
+    dim3 grid(args.n_tags1 / run_block_size + 1, 1, 1);
+
+    hipLaunchKernelGGL((gpu_compute_pair_energy_between_sets_kernel<evaluator, shift_mode>),
+                       grid,
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       args,
+                       d_params);
+    }
+
+//! Kernel driver that computes the energy of each particle in a set with another set
+/*! \param args Arguments of the kernel
+    \param d_params Parameters for the potential, stored per type pair
+
+    This is just a driver function for gpu_compute_pair_energy_between_sets_kernel(), see it for
+    details. It runs on the current GPU.
+*/
+template<class evaluator>
+__attribute__((visibility("default"))) hipError_t
+gpu_compute_pair_energy_between_sets(const pair_sets_args_t& args,
+                                     const typename evaluator::param_type* d_params)
+    {
+    assert(d_params);
+    if (args.n_tags1 == 0)
+        return hipSuccess;
+
+    switch (args.shift_mode)
+        {
+    case 0:
+        launch_compute_pair_energy_between_sets<evaluator, 0>(args, d_params);
+        break;
+    case 1:
+        launch_compute_pair_energy_between_sets<evaluator, 1>(args, d_params);
+        break;
+    case 2:
+        launch_compute_pair_energy_between_sets<evaluator, 2>(args, d_params);
+        break;
+    default:
+        break;
+        }
+
     return hipSuccess;
     }
 #else
@@ -659,6 +943,11 @@ template<class evaluator>
 __attribute__((visibility("default"))) hipError_t
 gpu_compute_pair_forces(const pair_args_t& pair_args,
                         const typename evaluator::param_type* d_params);
+
+template<class evaluator>
+__attribute__((visibility("default"))) hipError_t
+gpu_compute_pair_energy_between_sets(const pair_sets_args_t& args,
+                                     const typename evaluator::param_type* d_params);
 #endif
 
     } // end namespace kernel
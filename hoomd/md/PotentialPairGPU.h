@@ -6,12 +6,16 @@
 
 #ifdef ENABLE_HIP
 
+#include <algorithm>
 #include <memory>
 
 #include "PotentialPair.h"
 #include "PotentialPairGPU.cuh"
 
 #include "hoomd/Autotuner.h"
+#include "hoomd/CachedAllocator.h"
+#include "hoomd/CellListGPU.h"
+#include "hoomd/GPUFlags.h"
 
 /*! \file PotentialPairGPU.h
     \brief Defines the template class for standard pair potentials on the GPU
@@ -46,22 +50,45 @@ namespace md
 template<class evaluator> class PotentialPairGPU : public PotentialPair<evaluator>
     {
     public:
+    //! Param type from evaluator
+    typedef typename evaluator::param_type param_type;
+
     //! Construct the pair potential
     PotentialPairGPU(std::shared_ptr<SystemDefinition> sysdef, std::shared_ptr<NeighborList> nlist);
     //! Destructor
     virtual ~PotentialPairGPU() { }
 
+    //! Set and prefetch the parameters for a single type pair
+    virtual void setParams(unsigned int typ1, unsigned int typ2, const param_type& param);
+
+    //! Calculates the energy between two arrays of particle tags on the GPU
+    virtual Scalar computeEnergyBetweenTags(const unsigned int* tags1,
+                                            size_t n_tags1,
+                                            const unsigned int* tags2,
+                                            size_t n_tags2);
+
     protected:
     std::shared_ptr<Autotuner<2>> m_tuner; //!< Autotuner for block size and threads per particle
+    std::shared_ptr<CellList> m_sets_cl;   //!< Cell list to find the pairs between sets
+    GPUFlags<Scalar> m_sets_energy;        //!< Energy between the sets on this rank
 
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
+
+    //! Compute the forces on particles that have no ghost neighbors
+    virtual bool computeInteriorForces(uint64_t timestep);
+
+    //! Launch the force kernel
+    void launchForces(const unsigned int* d_index, unsigned int n_index);
+
+    //! Launch the kernel for the energy between sets and sum its result
+    Scalar launchEnergyBetweenSets(kernel::pair_sets_args_t& args);
     };
 
 template<class evaluator>
 PotentialPairGPU<evaluator>::PotentialPairGPU(std::shared_ptr<SystemDefinition> sysdef,
                                               std::shared_ptr<NeighborList> nlist)
-    : PotentialPair<evaluator>(sysdef, nlist)
+    : PotentialPair<evaluator>(sysdef, nlist), m_sets_energy(this->m_exec_conf)
     {
     // can't run on the GPU if there aren't any GPUs in the execution configuration
     if (!this->m_exec_conf->isCUDAEnabled())
@@ -86,6 +113,29 @@ PotentialPairGPU<evaluator>::PotentialPairGPU(std::shared_ptr<SystemDefinition>
 #endif
     }
 
+/*! \param typ1 First type index in the pair
+    \param typ2 Second type index in the pair
+    \param param Parameter to set
+
+    The parameters are in managed memory and are written on the host. With a single GPU, they are
+    prefetched to it so that the next force kernel does not fault on them. With several GPUs, all
+    of them read the parameters and the pages are left where they are.
+*/
+template<class evaluator>
+void PotentialPairGPU<evaluator>::setParams(unsigned int typ1,
+                                            unsigned int typ2,
+                                            const param_type& param)
+    {
+    PotentialPair<evaluator>::setParams(typ1, typ2, param);
+
+    if (this->m_exec_conf->getNumActiveGPUs() == 1)
+        {
+        this->m_params.get_allocator().prefetch(this->m_params.data(),
+                                                this->m_params.size(),
+                                                this->m_exec_conf->getGPUIds()[0]);
+        }
+    }
+
 template<class evaluator> void PotentialPairGPU<evaluator>::computeForces(uint64_t timestep)
     {
     this->m_nlist->compute(timestep);
@@ -99,6 +149,56 @@ template<class evaluator> void PotentialPairGPU<evaluator>::computeForces(uint64
         throw std::runtime_error("Error computing forces in PotentialPairGPU");
         }
 
+    if (this->m_interior_computed)
+        {
+        // the interior particles were computed while the ghost positions were in flight
+        unsigned int n_interior = 0;
+        ArrayHandle<unsigned int> d_interior_partition(
+            this->m_nlist->getInteriorPartition(n_interior),
+            access_location::device,
+            access_mode::read);
+        launchForces(d_interior_partition.data + n_interior, this->m_pdata->getN() - n_interior);
+        }
+    else
+        {
+        launchForces(nullptr, 0);
+        }
+
+    // energy and pressure corrections
+    this->computeTailCorrection();
+    }
+
+/*! \param timestep Current time step
+    \returns true when the forces on the interior particles have been computed
+
+    Interior particles have no ghost particles in their neighbor list. Their forces are computed
+    only when the neighbor list is current, a single GPU is active, and the autotuner has completed
+    its scan (so that it times full launches only).
+*/
+template<class evaluator>
+bool PotentialPairGPU<evaluator>::computeInteriorForces(uint64_t timestep)
+    {
+    if (!this->m_nlist->isCurrent(timestep)
+        || this->m_nlist->getStorageMode() == NeighborList::half
+        || this->m_exec_conf->getNumActiveGPUs() > 1 || !m_tuner->isComplete())
+        {
+        return false;
+        }
+
+    unsigned int n_interior = 0;
+    ArrayHandle<unsigned int> d_interior_partition(this->m_nlist->getInteriorPartition(n_interior),
+                                                   access_location::device,
+                                                   access_mode::read);
+    launchForces(d_interior_partition.data, n_interior);
+    return true;
+    }
+
+/*! \param d_index Indices of the particles to compute (nullptr computes all local particles)
+    \param n_index Number of particles in \a d_index
+*/
+template<class evaluator>
+void PotentialPairGPU<evaluator>::launchForces(const unsigned int* d_index, unsigned int n_index)
+    {
     // access the neighbor list
     ArrayHandle<unsigned int> d_n_neigh(this->m_nlist->getNNeighArray(),
                                         access_location::device,
@@ -155,9 +255,12 @@ template<class evaluator> void PotentialPairGPU<evaluator>::computeForces(uint64
                             block_size,
                             this->m_shift_mode,
                             flags[pdata_flag::pressure_tensor],
+                            flags[pdata_flag::potential_energy],
                             threads_per_particle,
                             this->m_pdata->getGPUPartition(),
-                            this->m_exec_conf->dev_prop),
+                            this->m_exec_conf->dev_prop,
+                            d_index,
+                            n_index),
         this->m_params.data());
 
     if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -166,9 +269,198 @@ template<class evaluator> void PotentialPairGPU<evaluator>::computeForces(uint64
     m_tuner->end();
 
     this->m_exec_conf->endMultiGPU();
+    }
 
-    // energy and pressure corrections
-    this->computeTailCorrection();
+/*! \param tags1 Tags of the particles in the first set
+    \param n_tags1 Number of tags in \a tags1
+    \param tags2 Tags of the particles in the second set
+    \param n_tags2 Number of tags in \a tags2
+    \returns The sum of the energies between all particles in \a tags1 and \a tags2
+
+    The particles in the second set are flagged by index, and one thread per particle in the first
+    set sums its energy with the flagged particles near it. The neighbor list holds every pair
+    within r_cut unless it excludes some, so its neighbors are searched when there are no
+    exclusions. Otherwise, the local and ghost particles are binned into a cell list as wide as the
+    largest r_cut. Only the tags are copied to the device and only the total is copied back.
+*/
+template<class evaluator>
+Scalar PotentialPairGPU<evaluator>::computeEnergyBetweenTags(const unsigned int* tags1,
+                                                             size_t n_tags1,
+                                                             const unsigned int* tags2,
+                                                             size_t n_tags2)
+    {
+    if (n_tags1 == 0 || n_tags2 == 0)
+        return Scalar(0.0);
+
+    this->exchangeGhostTags();
+
+    const unsigned int N = this->m_pdata->getN();
+    const unsigned int n_flags = N + this->m_pdata->getNGhosts();
+    CachedAllocator& alloc = this->m_exec_conf->getCachedAllocator();
+
+    // copy the tags to the device and flag the particles in the second set
+    ScopedAllocation<unsigned int> d_tags1(alloc, n_tags1);
+    ScopedAllocation<unsigned int> d_tags2(alloc, n_tags2);
+    ScopedAllocation<unsigned char> d_in_set2(alloc, (n_flags > 0) ? n_flags : 1);
+    ScopedAllocation<Scalar> d_energy(alloc, n_tags1);
+    hipMemcpy(d_tags1(), tags1, sizeof(unsigned int) * n_tags1, hipMemcpyHostToDevice);
+    hipMemcpy(d_tags2(), tags2, sizeof(unsigned int) * n_tags2, hipMemcpyHostToDevice);
+    hipMemset(d_in_set2(), 0, (n_flags > 0) ? n_flags : 1);
+
+    const unsigned int block_size = 256;
+    ArrayHandle<unsigned int> d_rtag(this->m_pdata->getRTags(),
+                                     access_location::device,
+                                     access_mode::read);
+    const unsigned int n_rtag = (unsigned int)this->m_pdata->getRTags().size();
+    kernel::gpu_flag_pair_set(d_in_set2(),
+                              d_tags2(),
+                              (unsigned int)n_tags2,
+                              d_rtag.data,
+                              n_rtag,
+                              n_flags,
+                              block_size);
+    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+
+    kernel::pair_sets_args_t args;
+    args.d_energy = d_energy();
+    args.d_tags1 = d_tags1();
+    args.n_tags1 = (unsigned int)n_tags1;
+    args.d_rtag = d_rtag.data;
+    args.n_rtag = n_rtag;
+    args.d_in_set2 = d_in_set2();
+    args.N = N;
+    args.block_size = block_size;
+
+    Scalar energy = Scalar(0.0);
+    if (!this->m_nlist->getExclusionsSet()
+        && this->m_nlist->getStorageMode() == NeighborList::full)
+        {
+#ifdef ENABLE_MPI
+        // the particles were reordered by the migration
+        if (this->m_sysdef->isDomainDecomposed())
+            this->m_nlist->forceUpdate();
+#endif
+        this->m_nlist->compute(this->m_last_computed);
+
+        ArrayHandle<unsigned int> d_n_neigh(this->m_nlist->getNNeighArray(),
+                                            access_location::device,
+                                            access_mode::read);
+        ArrayHandle<unsigned int> d_nlist(this->m_nlist->getNListArray(),
+                                          access_location::device,
+                                          access_mode::read);
+        ArrayHandle<size_t> d_head_list(this->m_nlist->getHeadList(),
+                                        access_location::device,
+                                        access_mode::read);
+        args.d_n_neigh = d_n_neigh.data;
+        args.d_nlist = d_nlist.data;
+        args.d_head_list = d_head_list.data;
+        energy = launchEnergyBetweenSets(args);
+        }
+    else
+        {
+        Scalar r_cut_max = Scalar(0.0);
+            {
+            ArrayHandle<Scalar> h_rcutsq(this->m_rcutsq, access_location::host, access_mode::read);
+            for (unsigned int i = 0; i < this->m_typpair_idx.getNumElements(); ++i)
+                r_cut_max = std::max(r_cut_max, fast::sqrt(h_rcutsq.data[i]));
+            }
+
+        if (r_cut_max > Scalar(0.0))
+            {
+            if (!m_sets_cl)
+                {
+                m_sets_cl = std::make_shared<CellListGPU>(this->m_sysdef);
+                m_sets_cl->setRadius(1);
+                m_sets_cl->setComputeXYZF(true);
+                m_sets_cl->setComputeTypeBody(false);
+                m_sets_cl->setFlagIndex();
+                }
+            if (m_sets_cl->getNominalWidth() != r_cut_max)
+                m_sets_cl->setNominalWidth(r_cut_max);
+            m_sets_cl->forceCompute(this->m_last_computed);
+
+            ArrayHandle<unsigned int> d_cell_size(m_sets_cl->getCellSizeArray(),
+                                                  access_location::device,
+                                                  access_mode::read);
+            ArrayHandle<Scalar4> d_cell_xyzf(m_sets_cl->getXYZFArray(),
+                                             access_location::device,
+                                             access_mode::read);
+            ArrayHandle<unsigned int> d_cell_adj(m_sets_cl->getCellAdjArray(),
+                                                 access_location::device,
+                                                 access_mode::read);
+            args.d_n_neigh = nullptr;
+            args.d_cell_size = d_cell_size.data;
+            args.d_cell_xyzf = d_cell_xyzf.data;
+            args.d_cell_adj = d_cell_adj.data;
+            args.ci = m_sets_cl->getCellIndexer();
+            args.cli = m_sets_cl->getCellListIndexer();
+            args.cadji = m_sets_cl->getCellAdjIndexer();
+            args.ghost_width = m_sets_cl->getGhostWidth();
+            energy = launchEnergyBetweenSets(args);
+            }
+        }
+
+#ifdef ENABLE_MPI
+    if (this->m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &energy,
+                      1,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      this->m_exec_conf->getMPICommunicator());
+        }
+#endif
+    return energy;
+    }
+
+/*! \param args Arguments of the kernel, with the sets and neighbors filled in
+    \returns The energy between the sets on this rank
+*/
+template<class evaluator>
+Scalar PotentialPairGPU<evaluator>::launchEnergyBetweenSets(kernel::pair_sets_args_t& args)
+    {
+    ArrayHandle<Scalar4> d_pos(this->m_pdata->getPositions(),
+                               access_location::device,
+                               access_mode::read);
+    ArrayHandle<Scalar> d_charge(this->m_pdata->getCharges(),
+                                 access_location::device,
+                                 access_mode::read);
+    ArrayHandle<Scalar> d_ronsq(this->m_ronsq, access_location::device, access_mode::read);
+    ArrayHandle<Scalar> d_rcutsq(this->m_rcutsq, access_location::device, access_mode::read);
+
+    args.d_pos = d_pos.data;
+    args.d_charge = d_charge.data;
+    args.box = this->m_pdata->getBox();
+    args.d_rcutsq = d_rcutsq.data;
+    args.d_ronsq = d_ronsq.data;
+    args.ntypes = this->m_pdata->getNTypes();
+    args.shift_mode = this->m_shift_mode;
+
+    kernel::gpu_compute_pair_energy_between_sets<evaluator>(args, this->m_params.data());
+    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+
+    void* d_tmp = NULL;
+    size_t tmp_bytes = 0;
+    kernel::gpu_sum_pair_energies(m_sets_energy.getDeviceFlags(),
+                                  d_tmp,
+                                  tmp_bytes,
+                                  args.d_energy,
+                                  args.n_tags1);
+    ScopedAllocation<unsigned char> d_tmp_alloc(this->m_exec_conf->getCachedAllocator(),
+                                                (tmp_bytes > 0) ? tmp_bytes : 1);
+    d_tmp = (void*)d_tmp_alloc();
+    kernel::gpu_sum_pair_energies(m_sets_energy.getDeviceFlags(),
+                                  d_tmp,
+                                  tmp_bytes,
+                                  args.d_energy,
+                                  args.n_tags1);
+    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+
+    return m_sets_energy.readFlags();
     }
 
 namespace detail
@@ -104,19 +104,19 @@ template<class evaluator> void PotentialSpecialPairGPU<evaluator>::computeForces
     ArrayHandle<Scalar> d_virial(this->m_virial, access_location::device, access_mode::readwrite);
 
         {
-        const GPUArray<typename PairData::members_t>& gpu_bond_list
-            = this->m_pair_data->getGPUTable();
-        const Index2D& gpu_table_indexer = this->m_pair_data->getGPUTableIndexer();
-
-        ArrayHandle<typename PairData::members_t> d_gpu_bondlist(gpu_bond_list,
-                                                                 access_location::device,
-                                                                 access_mode::read);
-        ArrayHandle<unsigned int> d_gpu_bond_pos_list(this->m_pair_data->getGPUPosTable(),
+        ArrayHandle<typename PairData::members_t> d_gpu_bondlist(
+            this->m_pair_data->getGPUCSRTable(),
+            access_location::device,
+            access_mode::read);
+        ArrayHandle<unsigned int> d_gpu_bond_pos_list(this->m_pair_data->getGPUCSRPosTable(),
                                                       access_location::device,
                                                       access_mode::read);
-        ArrayHandle<unsigned int> d_gpu_n_bonds(this->m_pair_data->getNGroupsArray(),
-                                                access_location::device,
-                                                access_mode::read);
+        ArrayHandle<unsigned int> d_gpu_bond_offsets(this->m_pair_data->getGPUCSROffsets(),
+                                                     access_location::device,
+                                                     access_mode::read);
+        ArrayHandle<unsigned int> d_gpu_high_degree(this->m_pair_data->getGPUCSRHighDegree(),
+                                                    access_location::device,
+                                                    access_mode::read);
 
         // access the flags array for overwriting
         ArrayHandle<unsigned int> d_flags(m_flags, access_location::device, access_mode::readwrite);
@@ -132,9 +132,11 @@ template<class evaluator> void PotentialSpecialPairGPU<evaluator>::computeForces
                                    d_charge.data,
                                    box,
                                    d_gpu_bondlist.data,
-                                   gpu_table_indexer,
                                    d_gpu_bond_pos_list.data,
-                                   d_gpu_n_bonds.data,
+                                   d_gpu_bond_offsets.data,
+                                   d_gpu_high_degree.data,
+                                   this->m_pair_data->getNGPUCSRHighDegree(),
+                                   PairData::csr_high_degree,
                                    this->m_pair_data->getNTypes(),
                                    m_tuner->getParam()[0],
                                    this->m_exec_conf->dev_prop),
@@ -8,10 +8,13 @@
 #include <iostream>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
+#include "ForceThreadBuffers.h"
 #include "NeighborList.h"
 #include "hoomd/ForceCompute.h"
 #include "hoomd/GPUArray.h"
+#include "hoomd/GPUVector.h"
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/Index1D.h"
 
@@ -65,6 +68,15 @@ namespace md
    parameters is defined by \a param_type in the potential evaluator class passed in. See the
    appropriate documentation for the evaluator for the definition of each element of the parameters.
 
+    <b>Triplet list</b>
+
+    When the triplet list is enabled, the Tersoff and SquareDensity branch on the CPU caches, for
+   every pair ij in the neighbor list, the sorted positions in the neighbor list of i of all
+   neighbors k != j whose type pair with i is interactive. The triplet list is rebuilt only when the
+   neighbor list is rebuilt or the parameters change, and each step evaluates the chi and ik terms
+   directly over the cached triplets. The separations of i to its neighbors are computed once per
+   particle and shared by the ij, chi, and ik loops in both modes.
+
     \sa export_PotentialTersoff()
 */
 template<class evaluator> class PotentialTersoff : public ForceCompute
@@ -93,6 +105,19 @@ template<class evaluator> class PotentialTersoff : public ForceCompute
     /// Validate that types are within Ntypes
     virtual void validateTypes(unsigned int typ1, unsigned int typ2, std::string action);
 
+    /// Get whether the triplet list is used
+    bool getTripletList()
+        {
+        return m_use_triplet_list;
+        }
+
+    /// Set whether the triplet list is used
+    void setTripletList(bool use_triplet_list)
+        {
+        m_use_triplet_list = use_triplet_list;
+        m_triplet_list_valid = false;
+        }
+
     virtual void notifyDetach()
         {
         if (m_attached)
@@ -135,6 +160,19 @@ template<class evaluator> class PotentialTersoff : public ForceCompute
     // r_cut (not squared) given to the neighborlist
     std::shared_ptr<GlobalArray<Scalar>> m_r_cut_nlist;
 
+    // per-thread force buffers for the CPU force loop
+    detail::ForceThreadBuffers m_thread_buffers;
+
+    bool m_use_triplet_list = false;           //!< True when the triplet list is used
+    bool m_triplet_list_valid = false;         //!< True when the triplet list matches the nlist
+    uint64_t m_triplet_list_nlist_updates = 0; //!< Neighbor list updates at the last build
+    GPUVector<size_t> m_triplet_head;          //!< First triplet of each neighbor list pair
+    GPUVector<unsigned int> m_n_triplet;       //!< Number of triplets of each neighbor list pair
+    GPUVector<unsigned int> m_triplet_k;       //!< Neighbor list position of k in each triplet
+
+    //! Rebuild the triplet list when the neighbor list or the parameters changed
+    void updateTripletList();
+
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
     };
@@ -145,7 +183,8 @@ template<class evaluator> class PotentialTersoff : public ForceCompute
 template<class evaluator>
 PotentialTersoff<evaluator>::PotentialTersoff(std::shared_ptr<SystemDefinition> sysdef,
                                               std::shared_ptr<NeighborList> nlist)
-    : ForceCompute(sysdef), m_nlist(nlist), m_typpair_idx(m_pdata->getNTypes())
+    : ForceCompute(sysdef), m_nlist(nlist), m_typpair_idx(m_pdata->getNTypes()),
+      m_triplet_head(m_exec_conf), m_n_triplet(m_exec_conf), m_triplet_k(m_exec_conf)
     {
     this->m_exec_conf->msg->notice(5) << "Constructing PotentialTersoff" << std::endl;
 
@@ -186,6 +225,7 @@ void PotentialTersoff<evaluator>::setParams(unsigned int typ1,
     ArrayHandle<param_type> h_params(m_params, access_location::host, access_mode::readwrite);
     h_params.data[m_typpair_idx(typ1, typ2)] = param;
     h_params.data[m_typpair_idx(typ2, typ1)] = param;
+    m_triplet_list_valid = false;
     }
 
 template<class evaluator>
@@ -197,6 +237,7 @@ void PotentialTersoff<evaluator>::setParamsPython(pybind11::tuple typ, pybind11:
     ArrayHandle<param_type> h_params(m_params, access_location::host, access_mode::readwrite);
     h_params.data[m_typpair_idx(typ1, typ2)] = param_type(params);
     h_params.data[m_typpair_idx(typ2, typ1)] = param_type(params);
+    m_triplet_list_valid = false;
     }
 
 template<class evaluator> pybind11::dict PotentialTersoff<evaluator>::getParams(pybind11::tuple typ)
@@ -265,6 +306,108 @@ template<class evaluator> Scalar PotentialTersoff<evaluator>::getRCut(pybind11::
     return sqrt(h_rcutsq.data[m_typpair_idx(typ1, typ2)]);
     }
 
+/*! The triplet list stores, for every pair ij in the neighbor list, the positions k in the neighbor
+    list of i of the neighbors that take part in the chi and ik terms of the pair. The positions are
+    ascending, so the evaluation walks the neighbor list of i in order. Whether a triplet takes part
+    depends only on the types of i and k, because areInteractive() of the evaluators used by this
+    branch depends only on the parameters. The list is therefore valid until the neighbor list is
+    rebuilt or the parameters change. Particle types that change without a neighbor list rebuild
+    are not detected.
+
+    \pre The neighbor list is up to date.
+*/
+template<class evaluator> void PotentialTersoff<evaluator>::updateTripletList()
+    {
+    const uint64_t nlist_updates = m_nlist->getNumUpdates();
+    if (m_triplet_list_valid && nlist_updates == m_triplet_list_nlist_updates)
+        return;
+
+    ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
+                                        access_location::host,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
+                                    access_location::host,
+                                    access_mode::read);
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_rcutsq(m_rcutsq, access_location::host, access_mode::read);
+    ArrayHandle<param_type> h_params(m_params, access_location::host, access_mode::read);
+
+    const unsigned int N = m_pdata->getN();
+    const size_t n_pairs = m_nlist->getNListArray().getNumElements();
+    m_triplet_head.resize(n_pairs);
+    m_n_triplet.resize(n_pairs);
+
+    // the triplets of a pair are the interactive neighbors other than j itself
+    auto is_interactive = [&](unsigned int typei, unsigned int kk)
+    {
+        unsigned int typek = __scalar_as_int(h_pos.data[kk].w);
+        unsigned int typpair_idx = m_typpair_idx(typei, typek);
+        evaluator eval(Scalar(0.0), h_rcutsq.data[typpair_idx], h_params.data[typpair_idx]);
+        return eval.areInteractive();
+    };
+
+    // count the triplets of every pair
+    size_t n_triplets = 0;
+    {
+    ArrayHandle<size_t> h_triplet_head(m_triplet_head,
+                                       access_location::host,
+                                       access_mode::overwrite);
+    ArrayHandle<unsigned int> h_n_triplet(m_n_triplet,
+                                          access_location::host,
+                                          access_mode::overwrite);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        const size_t head_i = h_head_list.data[i];
+        const unsigned int size = h_n_neigh.data[i];
+        const unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+        for (unsigned int j = 0; j < size; j++)
+            {
+            const unsigned int jj = h_nlist.data[head_i + j];
+            unsigned int n_k = 0;
+            for (unsigned int k = 0; k < size; k++)
+                {
+                const unsigned int kk = h_nlist.data[head_i + k];
+                if (kk != jj && is_interactive(typei, kk))
+                    n_k++;
+                }
+            h_triplet_head.data[head_i + j] = n_triplets;
+            h_n_triplet.data[head_i + j] = n_k;
+            n_triplets += n_k;
+            }
+        }
+    }
+
+    // fill in the neighbor list positions of k in ascending order
+    m_triplet_k.resize(n_triplets);
+    ArrayHandle<size_t> h_triplet_head(m_triplet_head, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_triplet_k(m_triplet_k,
+                                          access_location::host,
+                                          access_mode::overwrite);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        const size_t head_i = h_head_list.data[i];
+        const unsigned int size = h_n_neigh.data[i];
+        const unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+        for (unsigned int j = 0; j < size; j++)
+            {
+            const unsigned int jj = h_nlist.data[head_i + j];
+            size_t cur = h_triplet_head.data[head_i + j];
+            for (unsigned int k = 0; k < size; k++)
+                {
+                const unsigned int kk = h_nlist.data[head_i + k];
+                if (kk != jj && is_interactive(typei, kk))
+                    h_triplet_k.data[cur++] = k;
+                }
+            }
+        }
+
+    m_triplet_list_nlist_updates = nlist_updates;
+    m_triplet_list_valid = true;
+    }
+
 /*! \post The forces are computed for the given timestep. The neighborlist's compute method is
    called to ensure that it is up to date before proceeding.
 
@@ -319,222 +462,239 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
         memset(h_force.data, 0, sizeof(Scalar4) * (m_pdata->getN() + m_pdata->getNGhosts()));
         memset(h_virial.data, 0, sizeof(Scalar) * 6 * m_virial_pitch);
 
-        // for each particle
-        for (int i = 0; i < (int)m_pdata->getN(); i++)
-            {
-            // access the particle's position and type (MEM TRANSFER: 4 scalars)
-            Scalar3 posi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-            const size_t head_i = h_head_list.data[i];
-            // sanity check
-            assert(typei < m_pdata->getNTypes());
-
-            // initialize current force and potential energy of particle i to 0
-            Scalar3 fi = make_scalar3(0.0, 0.0, 0.0);
-            Scalar pei = 0.0;
-
-            Scalar virialixx(0.0);
-            Scalar virialixy(0.0);
-            Scalar virialixz(0.0);
-            Scalar virialiyy(0.0);
-            Scalar virialiyz(0.0);
-            Scalar virializz(0.0);
-
-            // loop over all of the neighbors of this particle
-            const unsigned int size = (unsigned int)h_n_neigh.data[i];
-            for (unsigned int j = 0; j < size; j++)
+        // loop over the particles in [begin, end) and add their forces to the given arrays
+        auto compute_range
+            = [&](unsigned int begin, unsigned int end, const detail::ForceOutput& out)
+        {
+            for (unsigned int i = begin; i < end; i++)
                 {
-                // access the index of neighbor j (MEM TRANSFER: 1 scalar)
-                unsigned int jj = h_nlist.data[head_i + j];
-                assert(jj < m_pdata->getN() + m_pdata->getNGhosts());
-
-                // access the position and type of particle j
-                Scalar3 posj = make_scalar3(h_pos.data[jj].x, h_pos.data[jj].y, h_pos.data[jj].z);
-                unsigned int typej = __scalar_as_int(h_pos.data[jj].w);
-                assert(typej < m_pdata->getNTypes());
-
-                // initialize the current force and potential energy of particle j to 0
-                Scalar3 fj = make_scalar3(0.0, 0.0, 0.0);
-                Scalar pej = 0.0;
-
-                // calculate dr_ij (MEM TRANSFER: 3 scalars / FLOPS: 3)
-                Scalar3 dxij = posi - posj;
-
-                // apply periodic boundary conditions
-                dxij = box.minImage(dxij);
-
-                // compute rij_sq (FLOPS: 5)
-                Scalar rij_sq = dot(dxij, dxij);
-
-                // get parameters for this type pair
-                unsigned int typpair_idx = m_typpair_idx(typei, typej);
-                const param_type& param = h_params.data[typpair_idx];
-                Scalar rcutsq = h_rcutsq.data[typpair_idx];
-
-                // evaluate the base repulsive and attractive terms
-                Scalar invratio = 0.0;
-                Scalar invratio2 = 0.0;
-                evaluator eval(rij_sq, rcutsq, param);
-                bool evaluated = eval.evalRepulsiveAndAttractive(invratio, invratio2);
-
-                // Even though the i-j interaction is symmetric so in principle I could consider i>j
-                // only, I have to loop over both i-j-k and j-i-k because I search only in neighbors
-                // of of the first element (since nl are type-wise I can not even merge them because
-                // i, j and k could be different types)
-                if (evaluated)
+                // access the particle's position and type (MEM TRANSFER: 4 scalars)
+                Scalar3 posi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+                unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+                const size_t head_i = h_head_list.data[i];
+                // sanity check
+                assert(typei < m_pdata->getNTypes());
+
+                // initialize current force and potential energy of particle i to 0
+                Scalar3 fi = make_scalar3(0.0, 0.0, 0.0);
+                Scalar pei = 0.0;
+
+                Scalar virialixx(0.0);
+                Scalar virialixy(0.0);
+                Scalar virialixz(0.0);
+                Scalar virialiyy(0.0);
+                Scalar virialiyz(0.0);
+                Scalar virializz(0.0);
+
+                // loop over all of the neighbors of this particle
+                const unsigned int size = (unsigned int)h_n_neigh.data[i];
+                for (unsigned int j = 0; j < size; j++)
                     {
-                    // printf("\nEvaluating the pair (i,j)=(%d, %d)  from inside HOOMD CPU",i,jj);
-                    // evaluate the force and energy from the ij interaction
-                    Scalar force_divr = Scalar(0.0);
-                    Scalar potential_eng = Scalar(0.0);
-                    Scalar bij = Scalar(0.0); // not used
-                    eval.evalForceij(invratio,
-                                     invratio2,
-                                     Scalar(0.0),
-                                     Scalar(0.0),
-                                     bij,
-                                     force_divr,
-                                     potential_eng);
-
-                    // add this force to particle i
-                    fi += force_divr * dxij;
-                    pei += potential_eng;
-
-                    // add this force to particle j
-                    fj += Scalar(-1.0) * force_divr * dxij;
-                    pej += potential_eng;
-
-                    // vir contribute for i j direct interaction on particle i and j
-                    if (compute_virial)
-                        {
-                        virialixx += force_divr * dxij.x * dxij.x;
-                        virialixy += force_divr * dxij.x * dxij.y;
-                        virialixz += force_divr * dxij.x * dxij.z;
-                        virialiyy += force_divr * dxij.y * dxij.y;
-                        virialiyz += force_divr * dxij.y * dxij.z;
-                        virializz += force_divr * dxij.z * dxij.z;
-                        }
+                    // access the index of neighbor j (MEM TRANSFER: 1 scalar)
+                    unsigned int jj = h_nlist.data[head_i + j];
+                    assert(jj < m_pdata->getN() + m_pdata->getNGhosts());
 
-                    // evaluate the force from the ik interactions
-                    for (unsigned int k = j + 1; k < size;
-                         k++) // I want to account only a single time for each triplets
+                    // access the position and type of particle j
+                    Scalar3 posj
+                        = make_scalar3(h_pos.data[jj].x, h_pos.data[jj].y, h_pos.data[jj].z);
+                    unsigned int typej = __scalar_as_int(h_pos.data[jj].w);
+                    assert(typej < m_pdata->getNTypes());
+
+                    // initialize the current force and potential energy of particle j to 0
+                    Scalar3 fj = make_scalar3(0.0, 0.0, 0.0);
+                    Scalar pej = 0.0;
+
+                    // calculate dr_ij (MEM TRANSFER: 3 scalars / FLOPS: 3)
+                    Scalar3 dxij = posi - posj;
+
+                    // apply periodic boundary conditions
+                    dxij = box.minImage(dxij);
+
+                    // compute rij_sq (FLOPS: 5)
+                    Scalar rij_sq = dot(dxij, dxij);
+
+                    // get parameters for this type pair
+                    unsigned int typpair_idx = m_typpair_idx(typei, typej);
+                    const param_type& param = h_params.data[typpair_idx];
+                    Scalar rcutsq = h_rcutsq.data[typpair_idx];
+
+                    // evaluate the base repulsive and attractive terms
+                    Scalar invratio = 0.0;
+                    Scalar invratio2 = 0.0;
+                    evaluator eval(rij_sq, rcutsq, param);
+                    bool evaluated = eval.evalRepulsiveAndAttractive(invratio, invratio2);
+
+                    // Even though the i-j interaction is symmetric so in principle I could consider
+                    // i>j only, I have to loop over both i-j-k and j-i-k because I search only in
+                    // neighbors of of the first element (since nl are type-wise I can not even
+                    // merge them because i, j and k could be different types)
+                    if (evaluated)
                         {
-                        // access the index of neighbor k
-                        unsigned int kk = h_nlist.data[head_i + k];
-                        assert(kk < m_pdata->getN() + m_pdata->getNGhosts());
-
-                        // access the position and type of neighbor k
-                        Scalar3 posk
-                            = make_scalar3(h_pos.data[kk].x, h_pos.data[kk].y, h_pos.data[kk].z);
-                        unsigned int typek = __scalar_as_int(h_pos.data[kk].w);
-                        assert(typek < m_pdata->getNTypes());
-
-                        // access the type pair parameters for i and k
-                        typpair_idx = m_typpair_idx(typei, typek);
-                        param_type temp_param
-                            = h_params.data[typpair_idx]; // use this to control the species wich
-                                                          // have to interact
-
-                        // compute dr_ik
-                        Scalar3 dxik = posi - posk;
-                        // apply periodic boundary conditions
-                        dxik = box.minImage(dxik);
-                        // compute rik_sq
-                        Scalar rik_sq = dot(dxik, dxik);
-
-                        // check if k interacts using a temporary evaluator to analyze i-k
-                        // parameters
-                        evaluator temp_eval(rij_sq, rcutsq, temp_param);
-                        temp_eval.setRik(rik_sq);
-                        bool temp_evaluated = temp_eval.areInteractive();
-
-                        // 3 Body interaction ******
-                        if (temp_evaluated)
+                        // printf("\nEvaluating the pair (i,j)=(%d, %d)  from inside HOOMD
+                        // CPU",i,jj);
+                        // evaluate the force and energy from the ij interaction
+                        Scalar force_divr = Scalar(0.0);
+                        Scalar potential_eng = Scalar(0.0);
+                        Scalar bij = Scalar(0.0); // not used
+                        eval.evalForceij(invratio,
+                                         invratio2,
+                                         Scalar(0.0),
+                                         Scalar(0.0),
+                                         bij,
+                                         force_divr,
+                                         potential_eng);
+
+                        // add this force to particle i
+                        fi += force_divr * dxij;
+                        pei += potential_eng;
+
+                        // add this force to particle j
+                        fj += Scalar(-1.0) * force_divr * dxij;
+                        pej += potential_eng;
+
+                        // vir contribute for i j direct interaction on particle i and j
+                        if (compute_virial)
                             {
-                            eval.setRik(rik_sq);
-                            // compute the total force and energy
-                            Scalar3 fk = make_scalar3(0.0, 0.0, 0.0);
-                            Scalar3 force_divr_ij_vec = make_scalar3(0.0, 0.0, 0.0);
-                            Scalar3 force_divr_ik_vec = make_scalar3(0.0, 0.0, 0.0);
-                            bool evaluatedk = eval.evalForceik(invratio,
-                                                               invratio2,
-                                                               Scalar(0.0),
-                                                               Scalar(0.0),
-                                                               force_divr_ij_vec,
-                                                               force_divr_ik_vec);
-                            // k interacts with the i-j as an additional third body
-                            if (evaluatedk)
-                                {
-                                // I stored the modulus of the force in the first component
-                                Scalar force_divr_ij = force_divr_ij_vec.x;
-                                Scalar force_divr_ik = force_divr_ik_vec.x;
+                            virialixx += force_divr * dxij.x * dxij.x;
+                            virialixy += force_divr * dxij.x * dxij.y;
+                            virialixz += force_divr * dxij.x * dxij.z;
+                            virialiyy += force_divr * dxij.y * dxij.y;
+                            virialiyz += force_divr * dxij.y * dxij.z;
+                            virializz += force_divr * dxij.z * dxij.z;
+                            }
 
-                                // add the force to particle i
-                                fi += force_divr_ij * dxij + force_divr_ik * dxik;
+                        // evaluate the force from the ik interactions
+                        for (unsigned int k = j + 1; k < size;
+                             k++) // I want to account only a single time for each triplets
+                            {
+                            // access the index of neighbor k
+                            unsigned int kk = h_nlist.data[head_i + k];
+                            assert(kk < m_pdata->getN() + m_pdata->getNGhosts());
 
-                                // add the force to particle j (FLOPS: 17)
-                                fj += force_divr_ij * dxij * Scalar(-1.0);
+                            // access the position and type of neighbor k
+                            Scalar3 posk = make_scalar3(h_pos.data[kk].x,
+                                                        h_pos.data[kk].y,
+                                                        h_pos.data[kk].z);
+                            unsigned int typek = __scalar_as_int(h_pos.data[kk].w);
+                            assert(typek < m_pdata->getNTypes());
 
-                                // add the force to particle k
-                                fk += force_divr_ik * dxik * Scalar(-1.0);
+                            // access the type pair parameters for i and k
+                            typpair_idx = m_typpair_idx(typei, typek);
+                            // use this to control the species wich have to interact
+                            param_type temp_param = h_params.data[typpair_idx];
+
+                            // compute dr_ik
+                            Scalar3 dxik = posi - posk;
+                            // apply periodic boundary conditions
+                            dxik = box.minImage(dxik);
+                            // compute rik_sq
+                            Scalar rik_sq = dot(dxik, dxik);
+
+                            // check if k interacts using a temporary evaluator to analyze i-k
+                            // parameters
+                            evaluator temp_eval(rij_sq, rcutsq, temp_param);
+                            temp_eval.setRik(rik_sq);
+                            bool temp_evaluated = temp_eval.areInteractive();
 
-                                if (compute_virial)
+                            // 3 Body interaction ******
+                            if (temp_evaluated)
+                                {
+                                eval.setRik(rik_sq);
+                                // compute the total force and energy
+                                Scalar3 fk = make_scalar3(0.0, 0.0, 0.0);
+                                Scalar3 force_divr_ij_vec = make_scalar3(0.0, 0.0, 0.0);
+                                Scalar3 force_divr_ik_vec = make_scalar3(0.0, 0.0, 0.0);
+                                bool evaluatedk = eval.evalForceik(invratio,
+                                                                   invratio2,
+                                                                   Scalar(0.0),
+                                                                   Scalar(0.0),
+                                                                   force_divr_ij_vec,
+                                                                   force_divr_ik_vec);
+                                // k interacts with the i-j as an additional third body
+                                if (evaluatedk)
                                     {
-                                    //***look at 3 body pressure notes
-                                    // i just need a single term to account for all of the 3 body
-                                    // virial that i decide to store in the i particle's data and i
-                                    // just defined the diagonal component of pressure tensor, I
-                                    // don't know how the off diagonal terms can be included
-                                    virialixx += (force_divr_ij * dxij.x * dxij.x
-                                                  + force_divr_ik * dxik.x * dxik.x);
-                                    virialiyy += (force_divr_ij * dxij.y * dxij.y
-                                                  + force_divr_ik * dxik.y * dxik.y);
-                                    virializz += (force_divr_ij * dxij.z * dxij.z
-                                                  + force_divr_ik * dxik.z * dxik.z);
-                                    virialixy += (force_divr_ij * dxij.x * dxij.y
-                                                  + force_divr_ik * dxik.x * dxik.y);
-                                    virialixz += (force_divr_ij * dxij.x * dxij.z
-                                                  + force_divr_ik * dxik.x * dxik.z);
-                                    virialiyz += (force_divr_ij * dxij.y * dxij.z
-                                                  + force_divr_ik * dxik.y * dxik.z);
+                                    // I stored the modulus of the force in the first component
+                                    Scalar force_divr_ij = force_divr_ij_vec.x;
+                                    Scalar force_divr_ik = force_divr_ik_vec.x;
+
+                                    // add the force to particle i
+                                    fi += force_divr_ij * dxij + force_divr_ik * dxik;
+
+                                    // add the force to particle j (FLOPS: 17)
+                                    fj += force_divr_ij * dxij * Scalar(-1.0);
+
+                                    // add the force to particle k
+                                    fk += force_divr_ik * dxik * Scalar(-1.0);
+
+                                    if (compute_virial)
+                                        {
+                                        //***look at 3 body pressure notes
+                                        // i just need a single term to account for all of the 3
+                                        // body virial that i decide to store in the i particle's
+                                        // data and i just defined the diagonal component of
+                                        // pressure tensor, I don't know how the off diagonal terms
+                                        // can be included
+                                        virialixx += (force_divr_ij * dxij.x * dxij.x
+                                                      + force_divr_ik * dxik.x * dxik.x);
+                                        virialiyy += (force_divr_ij * dxij.y * dxij.y
+                                                      + force_divr_ik * dxik.y * dxik.y);
+                                        virializz += (force_divr_ij * dxij.z * dxij.z
+                                                      + force_divr_ik * dxik.z * dxik.z);
+                                        virialixy += (force_divr_ij * dxij.x * dxij.y
+                                                      + force_divr_ik * dxik.x * dxik.y);
+                                        virialixz += (force_divr_ij * dxij.x * dxij.z
+                                                      + force_divr_ik * dxik.x * dxik.z);
+                                        virialiyz += (force_divr_ij * dxij.y * dxij.z
+                                                      + force_divr_ik * dxik.y * dxik.z);
+                                        }
+
+                                    // increment the force for particle k
+                                    unsigned int mem_idx = kk;
+                                    out.force[mem_idx].x += fk.x;
+                                    out.force[mem_idx].y += fk.y;
+                                    out.force[mem_idx].z += fk.z;
                                     }
-
-                                // increment the force for particle k
-                                unsigned int mem_idx = kk;
-                                h_force.data[mem_idx].x += fk.x;
-                                h_force.data[mem_idx].y += fk.y;
-                                h_force.data[mem_idx].z += fk.z;
                                 }
                             }
                         }
-                    }
 
-                // increment the force and potential energy for particle j
-                unsigned int mem_idx = jj;
-                h_force.data[mem_idx].x += fj.x;
-                h_force.data[mem_idx].y += fj.y;
-                h_force.data[mem_idx].z += fj.z;
-                h_force.data[mem_idx].w += pej;
-                }
+                    // increment the force and potential energy for particle j
+                    unsigned int mem_idx = jj;
+                    out.force[mem_idx].x += fj.x;
+                    out.force[mem_idx].y += fj.y;
+                    out.force[mem_idx].z += fj.z;
+                    out.force[mem_idx].w += pej;
+                    }
 
-            // finally, increment the force and potential energy for particle i
-            unsigned int mem_idx = i;
-            h_force.data[mem_idx].x += fi.x;
-            h_force.data[mem_idx].y += fi.y;
-            h_force.data[mem_idx].z += fi.z;
-            h_force.data[mem_idx].w += pei;
+                // finally, increment the force and potential energy for particle i
+                unsigned int mem_idx = i;
+                out.force[mem_idx].x += fi.x;
+                out.force[mem_idx].y += fi.y;
+                out.force[mem_idx].z += fi.z;
+                out.force[mem_idx].w += pei;
 
-            // imcrement vir for i
-            if (compute_virial)
-                {
-                h_virial.data[0 * m_virial_pitch + mem_idx] += virialixx;
-                h_virial.data[1 * m_virial_pitch + mem_idx] += virialixy;
-                h_virial.data[2 * m_virial_pitch + mem_idx] += virialixz;
-                h_virial.data[3 * m_virial_pitch + mem_idx] += virialiyy;
-                h_virial.data[4 * m_virial_pitch + mem_idx] += virialiyz;
-                h_virial.data[5 * m_virial_pitch + mem_idx] += virializz;
+                // imcrement vir for i
+                if (compute_virial)
+                    {
+                    out.virial[0 * out.virial_pitch + mem_idx] += virialixx;
+                    out.virial[1 * out.virial_pitch + mem_idx] += virialixy;
+                    out.virial[2 * out.virial_pitch + mem_idx] += virialixz;
+                    out.virial[3 * out.virial_pitch + mem_idx] += virialiyy;
+                    out.virial[4 * out.virial_pitch + mem_idx] += virialiyz;
+                    out.virial[5 * out.virial_pitch + mem_idx] += virializz;
+                    }
                 }
-            }
+        };
+
+        // each particle adds forces to its neighbors, so each thread accumulates into its own
+        // buffer
+        const detail::ForceOutput out
+            = {h_force.data, nullptr, compute_virial ? h_virial.data : nullptr, m_virial_pitch};
+        m_thread_buffers.run(*m_exec_conf,
+                             m_pdata->getN(),
+                             m_pdata->getN() + m_pdata->getNGhosts(),
+                             out,
+                             compute_range);
         }
     else
         {
@@ -552,6 +712,9 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
             throw std::runtime_error("Error computing forces in PotentialTersoff");
             }
 
+        if (m_use_triplet_list)
+            updateTripletList();
+
         // access the neighbor list, particle data, and system box
         ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
                                             access_location::host,
@@ -578,395 +741,444 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
         ArrayHandle<Scalar> h_rcutsq(m_rcutsq, access_location::host, access_mode::read);
         ArrayHandle<param_type> h_params(m_params, access_location::host, access_mode::read);
 
+        // access the triplet list
+        ArrayHandle<size_t> h_triplet_head(m_triplet_head,
+                                           access_location::host,
+                                           access_mode::read);
+        ArrayHandle<unsigned int> h_n_triplet(m_n_triplet,
+                                              access_location::host,
+                                              access_mode::read);
+        ArrayHandle<unsigned int> h_triplet_k(m_triplet_k,
+                                              access_location::host,
+                                              access_mode::read);
+        const bool use_triplet_list = m_use_triplet_list;
+
         // need to start from a zero force, energy
         memset(h_force.data, 0, sizeof(Scalar4) * (m_pdata->getN() + m_pdata->getNGhosts()));
         memset(h_virial.data, 0, sizeof(Scalar) * 6 * m_virial_pitch);
 
         unsigned int ntypes = m_pdata->getNTypes();
 
-        // for each particle
-        for (int i = 0; i < (int)m_pdata->getN(); i++)
-            {
-            // access the particle's position and type (MEM TRANSFER: 4 scalars)
-            Scalar3 posi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-            const size_t head_i = h_head_list.data[i];
-            // sanity check
-            assert(typei < m_pdata->getNTypes());
-
-            // initialize current force and potential energy of particle i to 0
-            Scalar3 fi = make_scalar3(0.0, 0.0, 0.0);
-            Scalar pei = 0.0;
-
-            Scalar viriali_xx(0.0);
-            Scalar viriali_xy(0.0);
-            Scalar viriali_xz(0.0);
-            Scalar viriali_yy(0.0);
-            Scalar viriali_yz(0.0);
-            Scalar viriali_zz(0.0);
-
-            Scalar phi_ab[ntypes];
-
-            // reset phi
-            for (unsigned int typ_b = 0; typ_b < ntypes; ++typ_b)
-                {
-                phi_ab[typ_b] = Scalar(0.0);
-                }
+        // loop over the particles in [begin, end) and add their forces to the given arrays
+        auto compute_range
+            = [&](unsigned int begin, unsigned int end, const detail::ForceOutput& out)
+        {
+            // separations of the current particle to its neighbors
+            std::vector<Scalar3> dx_neigh;
+            std::vector<Scalar> rsq_neigh;
 
-            // all neighbors of this particle
-            const unsigned int size = (unsigned int)h_n_neigh.data[i];
-            if (evaluator::hasPerParticleEnergy())
+            for (unsigned int i = begin; i < end; i++)
                 {
+                // access the particle's position and type (MEM TRANSFER: 4 scalars)
+                Scalar3 posi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+                unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+                const size_t head_i = h_head_list.data[i];
+                // sanity check
+                assert(typei < m_pdata->getNTypes());
+
+                // initialize current force and potential energy of particle i to 0
+                Scalar3 fi = make_scalar3(0.0, 0.0, 0.0);
+                Scalar pei = 0.0;
+
+                Scalar viriali_xx(0.0);
+                Scalar viriali_xy(0.0);
+                Scalar viriali_xz(0.0);
+                Scalar viriali_yy(0.0);
+                Scalar viriali_yz(0.0);
+                Scalar viriali_zz(0.0);
+
+                Scalar phi_ab[ntypes];
+
+                // reset phi
+                for (unsigned int typ_b = 0; typ_b < ntypes; ++typ_b)
+                    {
+                    phi_ab[typ_b] = Scalar(0.0);
+                    }
+
+                // all neighbors of this particle
+                const unsigned int size = (unsigned int)h_n_neigh.data[i];
+
+                // compute the separations once, they are shared by the ij, chi, and ik loops
+                dx_neigh.resize(size);
+                rsq_neigh.resize(size);
                 for (unsigned int j = 0; j < size; j++)
                     {
                     // access the index of neighbor j (MEM TRANSFER: 1 scalar)
                     unsigned int jj = h_nlist.data[head_i + j];
                     assert(jj < m_pdata->getN() + m_pdata->getNGhosts());
 
-                    // access the position and type of particle j
+                    // calculate dr_ij (MEM TRANSFER: 3 scalars / FLOPS: 3)
                     Scalar3 posj
                         = make_scalar3(h_pos.data[jj].x, h_pos.data[jj].y, h_pos.data[jj].z);
-                    unsigned int typej = __scalar_as_int(h_pos.data[jj].w);
-                    assert(typej < m_pdata->getNTypes());
-
-                    // calculate dr_ij (MEM TRANSFER: 3 scalars / FLOPS: 3)
                     Scalar3 dxij = posi - posj;
 
                     // apply periodic boundary conditions
-                    dxij = box.minImage(dxij);
+                    dx_neigh[j] = box.minImage(dxij);
 
                     // compute rij_sq (FLOPS: 5)
-                    Scalar rij_sq = dot(dxij, dxij);
-
-                    // get parameters for this type pair
-                    unsigned int typpair_idx = m_typpair_idx(typei, typej);
-                    const param_type& param = h_params.data[typpair_idx];
-                    Scalar rcutsq = h_rcutsq.data[typpair_idx];
-
-                    // evaluate the scalar per-neighbor contribution
-                    evaluator eval(rij_sq, rcutsq, param);
-                    eval.evalPhi(phi_ab[typej]);
-                    }
-
-                // self-energy
-                for (unsigned int typ_b = 0; typ_b < ntypes; ++typ_b)
-                    {
-                    unsigned int typpair_idx = m_typpair_idx(typei, typ_b);
-                    const param_type& param = h_params.data[typpair_idx];
-                    Scalar rcutsq = h_rcutsq.data[typpair_idx];
-                    evaluator eval(Scalar(0.0), rcutsq, param);
-                    Scalar energy(0.0);
-                    eval.evalSelfEnergy(energy, phi_ab[typ_b]);
-                    pei += energy;
+                    rsq_neigh[j] = dot(dx_neigh[j], dx_neigh[j]);
                     }
-                }
 
-            // loop over all of the neighbors of this particle
-            for (unsigned int j = 0; j < size; j++)
-                {
-                // access the index of neighbor j (MEM TRANSFER: 1 scalar)
-                unsigned int jj = h_nlist.data[head_i + j];
-                assert(jj < m_pdata->getN() + m_pdata->getNGhosts());
-
-                // access the position and type of particle j
-                Scalar3 posj = make_scalar3(h_pos.data[jj].x, h_pos.data[jj].y, h_pos.data[jj].z);
-                unsigned int typej = __scalar_as_int(h_pos.data[jj].w);
-                assert(typej < m_pdata->getNTypes());
-
-                // initialize the current force and potential energy of particle j to 0
-                Scalar3 fj = make_scalar3(0.0, 0.0, 0.0);
-                Scalar pej = 0.0;
-
-                // calculate dr_ij (MEM TRANSFER: 3 scalars / FLOPS: 3)
-                Scalar3 dxij = posi - posj;
-
-                // apply periodic boundary conditions
-                dxij = box.minImage(dxij);
-
-                // compute rij_sq (FLOPS: 5)
-                Scalar rij_sq = dot(dxij, dxij);
-
-                // get parameters for this type pair
-                unsigned int typpair_idx = m_typpair_idx(typei, typej);
-                const param_type& param = h_params.data[typpair_idx];
-                Scalar rcutsq = h_rcutsq.data[typpair_idx];
-
-                // evaluate the base repulsive and attractive terms
-                Scalar fR = 0.0;
-                Scalar fA = 0.0;
-                evaluator eval(rij_sq, rcutsq, param);
-                bool evaluated = eval.evalRepulsiveAndAttractive(fR, fA);
-
-                Scalar virialj_xx(0.0);
-                Scalar virialj_xy(0.0);
-                Scalar virialj_xz(0.0);
-                Scalar virialj_yy(0.0);
-                Scalar virialj_yz(0.0);
-                Scalar virialj_zz(0.0);
-
-                if (evaluated)
+                if (evaluator::hasPerParticleEnergy())
                     {
-                    // evaluate chi
-                    Scalar chi = 0.0;
-                    if (evaluator::needsChi())
+                    for (unsigned int j = 0; j < size; j++)
                         {
-                        for (unsigned int k = 0; k < size; k++)
-                            {
-                            // access the index of neighbor k
-                            unsigned int kk = h_nlist.data[head_i + k];
-                            assert(kk < m_pdata->getN() + m_pdata->getNGhosts());
-
-                            // access the position and type of neighbor k
-                            Scalar3 posk = make_scalar3(h_pos.data[kk].x,
-                                                        h_pos.data[kk].y,
-                                                        h_pos.data[kk].z);
-                            unsigned int typek = __scalar_as_int(h_pos.data[kk].w);
-                            assert(typek < m_pdata->getNTypes());
-
-                            // access the type pair parameters for i and k
-                            typpair_idx = m_typpair_idx(typei, typek);
-                            const param_type& temp_param = h_params.data[typpair_idx];
-
-                            evaluator temp_eval(rij_sq, rcutsq, temp_param);
-                            bool temp_evaluated = temp_eval.areInteractive();
-
-                            if (kk != jj && temp_evaluated)
-                                {
-                                // compute drik
-                                Scalar3 dxik = posi - posk;
-
-                                // apply periodic boundary conditions
-                                dxik = box.minImage(dxik);
-
-                                // compute rik_sq
-                                Scalar rik_sq = dot(dxik, dxik);
+                        // access the type of neighbor j
+                        unsigned int jj = h_nlist.data[head_i + j];
+                        unsigned int typej = __scalar_as_int(h_pos.data[jj].w);
+                        assert(typej < m_pdata->getNTypes());
+                        Scalar rij_sq = rsq_neigh[j];
+
+                        // get parameters for this type pair
+                        unsigned int typpair_idx = m_typpair_idx(typei, typej);
+                        const param_type& param = h_params.data[typpair_idx];
+                        Scalar rcutsq = h_rcutsq.data[typpair_idx];
+
+                        // evaluate the scalar per-neighbor contribution
+                        evaluator eval(rij_sq, rcutsq, param);
+                        eval.evalPhi(phi_ab[typej]);
+                        }
 
-                                // compute the bond angle (if needed)
-                                Scalar cos_th = Scalar(0.0);
-                                if (evaluator::needsAngle())
-                                    cos_th = dot(dxij, dxik) / fast::sqrt(rij_sq * rik_sq);
+                    // self-energy
+                    for (unsigned int typ_b = 0; typ_b < ntypes; ++typ_b)
+                        {
+                        unsigned int typpair_idx = m_typpair_idx(typei, typ_b);
+                        const param_type& param = h_params.data[typpair_idx];
+                        Scalar rcutsq = h_rcutsq.data[typpair_idx];
+                        evaluator eval(Scalar(0.0), rcutsq, param);
+                        Scalar energy(0.0);
+                        eval.evalSelfEnergy(energy, phi_ab[typ_b]);
+                        pei += energy;
+                        }
+                    }
 
-                                // evaluate the partial chi term
-                                eval.setRik(rik_sq);
-                                if (evaluator::needsAngle())
-                                    eval.setAngle(cos_th);
+                // loop over all of the neighbors of this particle
+                for (unsigned int j = 0; j < size; j++)
+                    {
+                    // access the index of neighbor j (MEM TRANSFER: 1 scalar)
+                    unsigned int jj = h_nlist.data[head_i + j];
+                    assert(jj < m_pdata->getN() + m_pdata->getNGhosts());
 
-                                eval.evalChi(chi);
-                                }
-                            }
-                        }
+                    // access the type of particle j
+                    unsigned int typej = __scalar_as_int(h_pos.data[jj].w);
+                    assert(typej < m_pdata->getNTypes());
 
-                    // evaluate the force and energy from the ij interaction
-                    Scalar force_divr = Scalar(0.0);
-                    Scalar potential_eng = Scalar(0.0);
-                    Scalar bij = Scalar(0.0);
-                    eval.evalForceij(fR, fA, chi, phi_ab[typej], bij, force_divr, potential_eng);
+                    // initialize the current force and potential energy of particle j to 0
+                    Scalar3 fj = make_scalar3(0.0, 0.0, 0.0);
+                    Scalar pej = 0.0;
 
-                    // add this force to particle i
-                    fi += force_divr * dxij;
-                    pei += potential_eng * Scalar(0.5);
+                    // access the cached dr_ij and rij_sq
+                    Scalar3 dxij = dx_neigh[j];
+                    Scalar rij_sq = rsq_neigh[j];
 
-                    if (compute_virial)
+                    // the neighbors k of this pair, either cached or all neighbors of i
+                    const unsigned int* triplet_k = nullptr;
+                    unsigned int n_k = size;
+                    if (use_triplet_list)
                         {
-                        Scalar force_div2r = Scalar(0.5) * force_divr;
-
-                        viriali_xx += force_div2r * dxij.x * dxij.x;
-                        viriali_xy += force_div2r * dxij.x * dxij.y;
-                        viriali_xz += force_div2r * dxij.x * dxij.z;
-                        viriali_yy += force_div2r * dxij.y * dxij.y;
-                        viriali_yz += force_div2r * dxij.y * dxij.z;
-                        viriali_zz += force_div2r * dxij.z * dxij.z;
+                        triplet_k = h_triplet_k.data + h_triplet_head.data[head_i + j];
+                        n_k = h_n_triplet.data[head_i + j];
                         }
 
-                    // add this force to particle j
-                    fj += Scalar(-1.0) * force_divr * dxij;
-                    pej += potential_eng * Scalar(0.5);
+                    // get parameters for this type pair
+                    unsigned int typpair_idx = m_typpair_idx(typei, typej);
+                    const param_type& param = h_params.data[typpair_idx];
+                    Scalar rcutsq = h_rcutsq.data[typpair_idx];
 
-                    if (compute_virial)
-                        {
-                        Scalar force_div2r = Scalar(0.5) * force_divr;
-
-                        virialj_xx += force_div2r * dxij.x * dxij.x;
-                        virialj_xy += force_div2r * dxij.x * dxij.y;
-                        virialj_xz += force_div2r * dxij.x * dxij.z;
-                        virialj_yy += force_div2r * dxij.y * dxij.y;
-                        virialj_yz += force_div2r * dxij.y * dxij.z;
-                        virialj_zz += force_div2r * dxij.z * dxij.z;
-                        }
+                    // evaluate the base repulsive and attractive terms
+                    Scalar fR = 0.0;
+                    Scalar fA = 0.0;
+                    evaluator eval(rij_sq, rcutsq, param);
+                    bool evaluated = eval.evalRepulsiveAndAttractive(fR, fA);
+
+                    Scalar virialj_xx(0.0);
+                    Scalar virialj_xy(0.0);
+                    Scalar virialj_xz(0.0);
+                    Scalar virialj_yy(0.0);
+                    Scalar virialj_yz(0.0);
+                    Scalar virialj_zz(0.0);
 
-                    if (evaluator::hasIkForce())
+                    if (evaluated)
                         {
-                        // evaluate the force from the ik interactions
-                        for (unsigned int k = 0; k < size; k++)
+                        // evaluate chi
+                        Scalar chi = 0.0;
+                        if (evaluator::needsChi())
                             {
-                            // access the index of neighbor k
-                            unsigned int kk = h_nlist.data[head_i + k];
-                            assert(kk < m_pdata->getN() + m_pdata->getNGhosts());
+                            for (unsigned int t = 0; t < n_k; t++)
+                                {
+                                // access the index of neighbor k
+                                unsigned int k = use_triplet_list ? triplet_k[t] : t;
+                                unsigned int kk = h_nlist.data[head_i + k];
+                                assert(kk < m_pdata->getN() + m_pdata->getNGhosts());
+
+                                // the triplet list holds only the interactive k != j
+                                bool temp_evaluated = true;
+                                if (!use_triplet_list)
+                                    {
+                                    // access the type of neighbor k
+                                    unsigned int typek = __scalar_as_int(h_pos.data[kk].w);
+                                    assert(typek < m_pdata->getNTypes());
 
-                            // access the position and type of neighbor k
-                            Scalar3 posk = make_scalar3(h_pos.data[kk].x,
-                                                        h_pos.data[kk].y,
-                                                        h_pos.data[kk].z);
-                            unsigned int typek = __scalar_as_int(h_pos.data[kk].w);
-                            assert(typek < m_pdata->getNTypes());
+                                    // access the type pair parameters for i and k
+                                    typpair_idx = m_typpair_idx(typei, typek);
+                                    const param_type& temp_param = h_params.data[typpair_idx];
 
-                            // access the type pair parameters for i and k
-                            typpair_idx = m_typpair_idx(typei, typek);
-                            const param_type& temp_param = h_params.data[typpair_idx];
+                                    evaluator temp_eval(rij_sq, rcutsq, temp_param);
+                                    temp_evaluated = kk != jj && temp_eval.areInteractive();
+                                    }
 
-                            evaluator temp_eval(rij_sq, rcutsq, temp_param);
-                            bool temp_evaluated = temp_eval.areInteractive();
+                                if (temp_evaluated)
+                                    {
+                                    // access the cached dr_ik and rik_sq
+                                    Scalar3 dxik = dx_neigh[k];
+                                    Scalar rik_sq = rsq_neigh[k];
 
-                            if (kk != jj && temp_evaluated)
-                                {
-                                // create variable for the force on k
-                                Scalar3 fk = make_scalar3(0.0, 0.0, 0.0);
+                                    // compute the bond angle (if needed)
+                                    Scalar cos_th = Scalar(0.0);
+                                    if (evaluator::needsAngle())
+                                        cos_th = dot(dxij, dxik) / fast::sqrt(rij_sq * rik_sq);
 
-                                // compute dr_ik
-                                Scalar3 dxik = posi - posk;
+                                    // evaluate the partial chi term
+                                    eval.setRik(rik_sq);
+                                    if (evaluator::needsAngle())
+                                        eval.setAngle(cos_th);
 
-                                // apply periodic boundary conditions
-                                dxik = box.minImage(dxik);
+                                    eval.evalChi(chi);
+                                    }
+                                }
+                            }
 
-                                // compute rik_sq
-                                Scalar rik_sq = dot(dxik, dxik);
+                        // evaluate the force and energy from the ij interaction
+                        Scalar force_divr = Scalar(0.0);
+                        Scalar potential_eng = Scalar(0.0);
+                        Scalar bij = Scalar(0.0);
+                        eval.evalForceij(fR,
+                                         fA,
+                                         chi,
+                                         phi_ab[typej],
+                                         bij,
+                                         force_divr,
+                                         potential_eng);
+
+                        // add this force to particle i
+                        fi += force_divr * dxij;
+                        pei += potential_eng * Scalar(0.5);
+
+                        if (compute_virial)
+                            {
+                            Scalar force_div2r = Scalar(0.5) * force_divr;
+
+                            viriali_xx += force_div2r * dxij.x * dxij.x;
+                            viriali_xy += force_div2r * dxij.x * dxij.y;
+                            viriali_xz += force_div2r * dxij.x * dxij.z;
+                            viriali_yy += force_div2r * dxij.y * dxij.y;
+                            viriali_yz += force_div2r * dxij.y * dxij.z;
+                            viriali_zz += force_div2r * dxij.z * dxij.z;
+                            }
 
-                                // compute the bond angle (if needed)
-                                Scalar cos_th = Scalar(0.0);
-                                if (evaluator::needsAngle())
-                                    cos_th = dot(dxij, dxik) / sqrt(rij_sq * rik_sq);
+                        // add this force to particle j
+                        fj += Scalar(-1.0) * force_divr * dxij;
+                        pej += potential_eng * Scalar(0.5);
 
-                                // set up the evaluator
-                                eval.setRik(rik_sq);
-                                if (evaluator::needsAngle())
-                                    eval.setAngle(cos_th);
+                        if (compute_virial)
+                            {
+                            Scalar force_div2r = Scalar(0.5) * force_divr;
+
+                            virialj_xx += force_div2r * dxij.x * dxij.x;
+                            virialj_xy += force_div2r * dxij.x * dxij.y;
+                            virialj_xz += force_div2r * dxij.x * dxij.z;
+                            virialj_yy += force_div2r * dxij.y * dxij.y;
+                            virialj_yz += force_div2r * dxij.y * dxij.z;
+                            virialj_zz += force_div2r * dxij.z * dxij.z;
+                            }
 
-                                // compute the total force and energy
-                                Scalar3 force_divr_ij = make_scalar3(0.0, 0.0, 0.0);
-                                Scalar3 force_divr_ik = make_scalar3(0.0, 0.0, 0.0);
-                                eval.evalForceik(fR, fA, chi, bij, force_divr_ij, force_divr_ik);
-
-                                // add the force to particle i
-                                // (FLOPS: 17)
-                                fi.x += force_divr_ij.x * dxij.x + force_divr_ik.x * dxik.x;
-                                fi.y += force_divr_ij.x * dxij.y + force_divr_ik.x * dxik.y;
-                                fi.z += force_divr_ij.x * dxij.z + force_divr_ik.x * dxik.z;
-
-                                // NOTE: virial for ik forces not tested
-                                if (compute_virial)
+                        if (evaluator::hasIkForce())
+                            {
+                            // evaluate the force from the ik interactions
+                            for (unsigned int t = 0; t < n_k; t++)
+                                {
+                                // access the index of neighbor k
+                                unsigned int k = use_triplet_list ? triplet_k[t] : t;
+                                unsigned int kk = h_nlist.data[head_i + k];
+                                assert(kk < m_pdata->getN() + m_pdata->getNGhosts());
+
+                                // the triplet list holds only the interactive k != j
+                                bool temp_evaluated = true;
+                                if (!use_triplet_list)
                                     {
-                                    Scalar force_div2r_ij = Scalar(0.5) * force_divr_ij.x;
-                                    Scalar force_div2r_ik = Scalar(0.5) * force_divr_ik.x;
-                                    viriali_xx += force_div2r_ij * dxij.x * dxij.x
-                                                  + force_div2r_ik * dxik.x * dxik.x;
-                                    viriali_xy += force_div2r_ij * dxij.x * dxij.y
-                                                  + force_div2r_ik * dxik.x * dxik.y;
-                                    viriali_xz += force_div2r_ij * dxij.x * dxij.z
-                                                  + force_div2r_ik * dxik.x * dxik.z;
-                                    viriali_yy += force_div2r_ij * dxij.y * dxij.y
-                                                  + force_div2r_ik * dxik.y * dxik.y;
-                                    viriali_yz += force_div2r_ij * dxij.y * dxij.z
-                                                  + force_div2r_ik * dxik.y * dxik.z;
-                                    viriali_zz += force_div2r_ij * dxij.z * dxij.z
-                                                  + force_div2r_ik * dxik.z * dxik.z;
-                                    }
+                                    // access the type of neighbor k
+                                    unsigned int typek = __scalar_as_int(h_pos.data[kk].w);
+                                    assert(typek < m_pdata->getNTypes());
 
-                                // add the force to particle j (FLOPS: 17)
-                                fj.x += force_divr_ij.y * dxij.x + force_divr_ik.y * dxik.x;
-                                fj.y += force_divr_ij.y * dxij.y + force_divr_ik.y * dxik.y;
-                                fj.z += force_divr_ij.y * dxij.z + force_divr_ik.y * dxik.z;
+                                    // access the type pair parameters for i and k
+                                    typpair_idx = m_typpair_idx(typei, typek);
+                                    const param_type& temp_param = h_params.data[typpair_idx];
 
-                                // NOTE: virial for ik forces not tested
-                                if (compute_virial)
-                                    {
-                                    Scalar force_div2r_ij = Scalar(0.5) * force_divr_ij.y;
-                                    Scalar force_div2r_ik = Scalar(0.5) * force_divr_ik.y;
-                                    virialj_xx += force_div2r_ij * dxij.x * dxij.x
-                                                  + force_div2r_ik * dxik.x * dxik.x;
-                                    virialj_xy += force_div2r_ij * dxij.x * dxij.y
-                                                  + force_div2r_ik * dxik.x * dxik.y;
-                                    virialj_xz += force_div2r_ij * dxij.x * dxij.z
-                                                  + force_div2r_ik * dxik.x * dxik.z;
-                                    virialj_yy += force_div2r_ij * dxij.y * dxij.y
-                                                  + force_div2r_ik * dxik.y * dxik.y;
-                                    virialj_yz += force_div2r_ij * dxij.y * dxij.z
-                                                  + force_div2r_ik * dxik.y * dxik.z;
-                                    virialj_zz += force_div2r_ij * dxij.z * dxij.z
-                                                  + force_div2r_ik * dxik.z * dxik.z;
+                                    evaluator temp_eval(rij_sq, rcutsq, temp_param);
+                                    temp_evaluated = kk != jj && temp_eval.areInteractive();
                                     }
 
-                                // add the force to particle k
-                                fk.x += force_divr_ij.z * dxij.x + force_divr_ik.z * dxik.x;
-                                fk.y += force_divr_ij.z * dxij.y + force_divr_ik.z * dxik.y;
-                                fk.z += force_divr_ij.z * dxij.z + force_divr_ik.z * dxik.z;
-
-                                // increment the force for particle k
-                                unsigned int mem_idx = kk;
-                                h_force.data[mem_idx].x += fk.x;
-                                h_force.data[mem_idx].y += fk.y;
-                                h_force.data[mem_idx].z += fk.z;
-
-                                if (compute_virial)
+                                if (temp_evaluated)
                                     {
-                                    Scalar force_div2r_ij = Scalar(0.5) * force_divr_ij.z;
-                                    Scalar force_div2r_ik = Scalar(0.5) * force_divr_ik.z;
-                                    h_virial.data[0 * m_virial_pitch + mem_idx]
-                                        += force_div2r_ij * dxij.x * dxij.x
-                                           + force_div2r_ik * dxik.x * dxik.x;
-                                    h_virial.data[1 * m_virial_pitch + mem_idx]
-                                        += force_div2r_ij * dxij.x * dxij.y
-                                           + force_div2r_ik * dxik.x * dxik.y;
-                                    h_virial.data[2 * m_virial_pitch + mem_idx]
-                                        += force_div2r_ij * dxij.x * dxij.z
-                                           + force_div2r_ik * dxik.x * dxik.z;
-                                    h_virial.data[3 * m_virial_pitch + mem_idx]
-                                        += force_div2r_ij * dxij.y * dxij.y
-                                           + force_div2r_ik * dxik.y * dxik.y;
-                                    h_virial.data[4 * m_virial_pitch + mem_idx]
-                                        += force_div2r_ij * dxij.y * dxij.z
-                                           + force_div2r_ik * dxik.y * dxik.z;
-                                    h_virial.data[5 * m_virial_pitch + mem_idx]
-                                        += force_div2r_ij * dxij.z * dxij.z
-                                           + force_div2r_ik * dxik.z * dxik.z;
+                                    // create variable for the force on k
+                                    Scalar3 fk = make_scalar3(0.0, 0.0, 0.0);
+
+                                    // access the cached dr_ik and rik_sq
+                                    Scalar3 dxik = dx_neigh[k];
+                                    Scalar rik_sq = rsq_neigh[k];
+
+                                    // compute the bond angle (if needed)
+                                    Scalar cos_th = Scalar(0.0);
+                                    if (evaluator::needsAngle())
+                                        cos_th = dot(dxij, dxik) / sqrt(rij_sq * rik_sq);
+
+                                    // set up the evaluator
+                                    eval.setRik(rik_sq);
+                                    if (evaluator::needsAngle())
+                                        eval.setAngle(cos_th);
+
+                                    // compute the total force and energy
+                                    Scalar3 force_divr_ij = make_scalar3(0.0, 0.0, 0.0);
+                                    Scalar3 force_divr_ik = make_scalar3(0.0, 0.0, 0.0);
+                                    eval.evalForceik(fR,
+                                                     fA,
+                                                     chi,
+                                                     bij,
+                                                     force_divr_ij,
+                                                     force_divr_ik);
+
+                                    // add the force to particle i
+                                    // (FLOPS: 17)
+                                    fi.x += force_divr_ij.x * dxij.x + force_divr_ik.x * dxik.x;
+                                    fi.y += force_divr_ij.x * dxij.y + force_divr_ik.x * dxik.y;
+                                    fi.z += force_divr_ij.x * dxij.z + force_divr_ik.x * dxik.z;
+
+                                    // NOTE: virial for ik forces not tested
+                                    if (compute_virial)
+                                        {
+                                        Scalar force_div2r_ij = Scalar(0.5) * force_divr_ij.x;
+                                        Scalar force_div2r_ik = Scalar(0.5) * force_divr_ik.x;
+                                        viriali_xx += force_div2r_ij * dxij.x * dxij.x
+                                                      + force_div2r_ik * dxik.x * dxik.x;
+                                        viriali_xy += force_div2r_ij * dxij.x * dxij.y
+                                                      + force_div2r_ik * dxik.x * dxik.y;
+                                        viriali_xz += force_div2r_ij * dxij.x * dxij.z
+                                                      + force_div2r_ik * dxik.x * dxik.z;
+                                        viriali_yy += force_div2r_ij * dxij.y * dxij.y
+                                                      + force_div2r_ik * dxik.y * dxik.y;
+                                        viriali_yz += force_div2r_ij * dxij.y * dxij.z
+                                                      + force_div2r_ik * dxik.y * dxik.z;
+                                        viriali_zz += force_div2r_ij * dxij.z * dxij.z
+                                                      + force_div2r_ik * dxik.z * dxik.z;
+                                        }
+
+                                    // add the force to particle j (FLOPS: 17)
+                                    fj.x += force_divr_ij.y * dxij.x + force_divr_ik.y * dxik.x;
+                                    fj.y += force_divr_ij.y * dxij.y + force_divr_ik.y * dxik.y;
+                                    fj.z += force_divr_ij.y * dxij.z + force_divr_ik.y * dxik.z;
+
+                                    // NOTE: virial for ik forces not tested
+                                    if (compute_virial)
+                                        {
+                                        Scalar force_div2r_ij = Scalar(0.5) * force_divr_ij.y;
+                                        Scalar force_div2r_ik = Scalar(0.5) * force_divr_ik.y;
+                                        virialj_xx += force_div2r_ij * dxij.x * dxij.x
+                                                      + force_div2r_ik * dxik.x * dxik.x;
+                                        virialj_xy += force_div2r_ij * dxij.x * dxij.y
+                                                      + force_div2r_ik * dxik.x * dxik.y;
+                                        virialj_xz += force_div2r_ij * dxij.x * dxij.z
+                                                      + force_div2r_ik * dxik.x * dxik.z;
+                                        virialj_yy += force_div2r_ij * dxij.y * dxij.y
+                                                      + force_div2r_ik * dxik.y * dxik.y;
+                                        virialj_yz += force_div2r_ij * dxij.y * dxij.z
+                                                      + force_div2r_ik * dxik.y * dxik.z;
+                                        virialj_zz += force_div2r_ij * dxij.z * dxij.z
+                                                      + force_div2r_ik * dxik.z * dxik.z;
+                                        }
+
+                                    // add the force to particle k
+                                    fk.x += force_divr_ij.z * dxij.x + force_divr_ik.z * dxik.x;
+                                    fk.y += force_divr_ij.z * dxij.y + force_divr_ik.z * dxik.y;
+                                    fk.z += force_divr_ij.z * dxij.z + force_divr_ik.z * dxik.z;
+
+                                    // increment the force for particle k
+                                    unsigned int mem_idx = kk;
+                                    out.force[mem_idx].x += fk.x;
+                                    out.force[mem_idx].y += fk.y;
+                                    out.force[mem_idx].z += fk.z;
+
+                                    if (compute_virial)
+                                        {
+                                        Scalar force_div2r_ij = Scalar(0.5) * force_divr_ij.z;
+                                        Scalar force_div2r_ik = Scalar(0.5) * force_divr_ik.z;
+                                        out.virial[0 * out.virial_pitch + mem_idx]
+                                            += force_div2r_ij * dxij.x * dxij.x
+                                               + force_div2r_ik * dxik.x * dxik.x;
+                                        out.virial[1 * out.virial_pitch + mem_idx]
+                                            += force_div2r_ij * dxij.x * dxij.y
+                                               + force_div2r_ik * dxik.x * dxik.y;
+                                        out.virial[2 * out.virial_pitch + mem_idx]
+                                            += force_div2r_ij * dxij.x * dxij.z
+                                               + force_div2r_ik * dxik.x * dxik.z;
+                                        out.virial[3 * out.virial_pitch + mem_idx]
+                                            += force_div2r_ij * dxij.y * dxij.y
+                                               + force_div2r_ik * dxik.y * dxik.y;
+                                        out.virial[4 * out.virial_pitch + mem_idx]
+                                            += force_div2r_ij * dxij.y * dxij.z
+                                               + force_div2r_ik * dxik.y * dxik.z;
+                                        out.virial[5 * out.virial_pitch + mem_idx]
+                                            += force_div2r_ij * dxij.z * dxij.z
+                                               + force_div2r_ik * dxik.z * dxik.z;
+                                        }
                                     }
                                 }
                             }
                         }
+                    // increment the force and potential energy for particle j
+                    unsigned int mem_idx = jj;
+                    out.force[mem_idx].x += fj.x;
+                    out.force[mem_idx].y += fj.y;
+                    out.force[mem_idx].z += fj.z;
+                    out.force[mem_idx].w += pej;
+
+                    if (compute_virial)
+                        {
+                        out.virial[0 * out.virial_pitch + mem_idx] += virialj_xx;
+                        out.virial[1 * out.virial_pitch + mem_idx] += virialj_xy;
+                        out.virial[2 * out.virial_pitch + mem_idx] += virialj_xz;
+                        out.virial[3 * out.virial_pitch + mem_idx] += virialj_yy;
+                        out.virial[4 * out.virial_pitch + mem_idx] += virialj_yz;
+                        out.virial[5 * out.virial_pitch + mem_idx] += virialj_zz;
+                        }
                     }
-                // increment the force and potential energy for particle j
-                unsigned int mem_idx = jj;
-                h_force.data[mem_idx].x += fj.x;
-                h_force.data[mem_idx].y += fj.y;
-                h_force.data[mem_idx].z += fj.z;
-                h_force.data[mem_idx].w += pej;
+                // finally, increment the force and potential energy for particle i
+                unsigned int mem_idx = i;
+                out.force[mem_idx].x += fi.x;
+                out.force[mem_idx].y += fi.y;
+                out.force[mem_idx].z += fi.z;
+                out.force[mem_idx].w += pei;
 
                 if (compute_virial)
                     {
-                    h_virial.data[0 * m_virial_pitch + mem_idx] += virialj_xx;
-                    h_virial.data[1 * m_virial_pitch + mem_idx] += virialj_xy;
-                    h_virial.data[2 * m_virial_pitch + mem_idx] += virialj_xz;
-                    h_virial.data[3 * m_virial_pitch + mem_idx] += virialj_yy;
-                    h_virial.data[4 * m_virial_pitch + mem_idx] += virialj_yz;
-                    h_virial.data[5 * m_virial_pitch + mem_idx] += virialj_zz;
+                    out.virial[0 * out.virial_pitch + mem_idx] += viriali_xx;
+                    out.virial[1 * out.virial_pitch + mem_idx] += viriali_xy;
+                    out.virial[2 * out.virial_pitch + mem_idx] += viriali_xz;
+                    out.virial[3 * out.virial_pitch + mem_idx] += viriali_yy;
+                    out.virial[4 * out.virial_pitch + mem_idx] += viriali_yz;
+                    out.virial[5 * out.virial_pitch + mem_idx] += viriali_zz;
                     }
                 }
-            // finally, increment the force and potential energy for particle i
-            unsigned int mem_idx = i;
-            h_force.data[mem_idx].x += fi.x;
-            h_force.data[mem_idx].y += fi.y;
-            h_force.data[mem_idx].z += fi.z;
-            h_force.data[mem_idx].w += pei;
-
-            if (compute_virial)
-                {
-                h_virial.data[0 * m_virial_pitch + mem_idx] += viriali_xx;
-                h_virial.data[1 * m_virial_pitch + mem_idx] += viriali_xy;
-                h_virial.data[2 * m_virial_pitch + mem_idx] += viriali_xz;
-                h_virial.data[3 * m_virial_pitch + mem_idx] += viriali_yy;
-                h_virial.data[4 * m_virial_pitch + mem_idx] += viriali_yz;
-                h_virial.data[5 * m_virial_pitch + mem_idx] += viriali_zz;
-                }
-            }
+        };
+
+        // each particle adds forces to its neighbors, so each thread accumulates into its own
+        // buffer
+        const detail::ForceOutput out
+            = {h_force.data, nullptr, compute_virial ? h_virial.data : nullptr, m_virial_pitch};
+        m_thread_buffers.run(*m_exec_conf,
+                             m_pdata->getN(),
+                             m_pdata->getN() + m_pdata->getNGhosts(),
+                             out,
+                             compute_range);
         }
     }
 
@@ -1005,7 +1217,10 @@ template<class T> void export_PotentialTersoff(pybind11::module& m, const std::s
         .def("setParams", &PotentialTersoff<T>::setParamsPython)
         .def("getParams", &PotentialTersoff<T>::getParams)
         .def("setRCut", &PotentialTersoff<T>::setRCutPython)
-        .def("getRCut", &PotentialTersoff<T>::getRCut);
+        .def("getRCut", &PotentialTersoff<T>::getRCut)
+        .def_property("triplet_list",
+                      &PotentialTersoff<T>::getTripletList,
+                      &PotentialTersoff<T>::setTripletList);
     }
 
     } // end namespace detail
@@ -0,0 +1,79 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __RATTLE_MULTIPLIER_H__
+#define __RATTLE_MULTIPLIER_H__
+
+#include "hoomd/HOOMDMath.h"
+
+/*! \file RATTLEMultiplier.h
+    \brief Solves for the Lagrange multiplier of the RATTLE position constraint
+*/
+
+// need to declare these functions with __device__ qualifiers when building in nvcc
+// DEVICE is __host__ __device__ when included in nvcc and blank when included into the host
+// compiler
+#ifdef __HIPCC__
+#define DEVICE __device__
+#else
+#define DEVICE
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Solve for the multiplier that places the constrained position on the manifold
+/*! \param manifold Manifold the particle is constrained to
+    \param unconstrained_pos Position the particle reaches without the constraint force
+    \param normal Manifold normal at the start of the step
+    \param scale Displacement per unit multiplier along -normal
+    \param tolerance Convergence tolerance on the implicit function
+    \param max_iteration Maximum number of Newton iterations
+    \param lambda Initial guess on input, multiplier on output
+
+    The constrained position is unconstrained_pos - scale * lambda * normal, so the position
+    constraint reduces to a single equation in lambda. Manifolds with a closed-form projection solve
+    it directly. Otherwise, Newton iterations start from the given lambda, which callers take from
+    the previous step of the same particle.
+
+    \returns The number of Newton iterations taken (0 for a closed-form projection)
+*/
+template<class Manifold>
+DEVICE inline unsigned int computeRATTLEMultiplier(Manifold& manifold,
+                                                   const Scalar3& unconstrained_pos,
+                                                   const Scalar3& normal,
+                                                   Scalar scale,
+                                                   Scalar tolerance,
+                                                   unsigned int max_iteration,
+                                                   Scalar& lambda)
+    {
+    Scalar s;
+    if (manifold.projectAlong(unconstrained_pos, normal, s))
+        {
+        lambda = s / scale;
+        return 0;
+        }
+
+    unsigned int iteration = 0;
+    while (iteration < max_iteration)
+        {
+        Scalar3 next_pos = unconstrained_pos - scale * lambda * normal;
+        Scalar resid = manifold.implicitFunction(next_pos);
+        if (fabs(resid) <= tolerance)
+            break;
+
+        Scalar slope = scale * dot(manifold.derivative(next_pos), normal);
+        if (slope == Scalar(0.0))
+            break;
+
+        lambda += resid / slope;
+        iteration++;
+        }
+    return iteration;
+    }
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __RATTLE_MULTIPLIER_H__
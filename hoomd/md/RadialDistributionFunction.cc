@@ -0,0 +1,233 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file RadialDistributionFunction.cc
+    \brief Defines the RadialDistributionFunction class
+*/
+
+#include "RadialDistributionFunction.h"
+
+#include <algorithm>
+#include <cstring>
+#include <pybind11/stl.h>
+#include <stdexcept>
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System definition
+    \param trigger Steps on which to sample the pair distances
+    \param nlist Neighbor list to count pairs in
+    \param num_bins Number of bins
+    \param r_max Largest distance to bin
+*/
+RadialDistributionFunction::RadialDistributionFunction(std::shared_ptr<SystemDefinition> sysdef,
+                                                       std::shared_ptr<Trigger> trigger,
+                                                       std::shared_ptr<NeighborList> nlist,
+                                                       unsigned int num_bins,
+                                                       Scalar r_max)
+    : Analyzer(sysdef, trigger), m_nlist(nlist), m_attached(true), m_num_bins(num_bins),
+      m_r_max(r_max), m_num_samples(0), m_norm(0)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing RadialDistributionFunction" << std::endl;
+
+    if (num_bins == 0)
+        {
+        throw std::invalid_argument("The radial distribution function must have at least 1 bin.");
+        }
+    if (!(r_max > Scalar(0)))
+        {
+        throw std::invalid_argument("r_max must be positive.");
+        }
+
+    GPUArray<unsigned long long> histogram(num_bins, m_exec_conf);
+    m_histogram.swap(histogram);
+    resetHistogram();
+
+    // the neighbor list must find every pair within r_max
+    const unsigned int num_pairs = Index2D(m_pdata->getNTypes()).getNumElements();
+    m_r_cut_nlist = std::make_shared<GlobalArray<Scalar>>(num_pairs, m_exec_conf);
+        {
+        ArrayHandle<Scalar> h_r_cut_nlist(*m_r_cut_nlist,
+                                          access_location::host,
+                                          access_mode::overwrite);
+        std::fill(h_r_cut_nlist.data, h_r_cut_nlist.data + num_pairs, r_max);
+        }
+    m_nlist->addRCutMatrix(m_r_cut_nlist);
+    }
+
+RadialDistributionFunction::~RadialDistributionFunction()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying RadialDistributionFunction" << std::endl;
+    if (m_attached)
+        {
+        m_nlist->removeRCutMatrix(m_r_cut_nlist);
+        }
+    }
+
+/*! \param timestep Current time step
+ */
+void RadialDistributionFunction::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+
+    m_nlist->compute(timestep);
+    accumulate();
+
+    const unsigned int ndim = m_sysdef->getNDimensions();
+    const double N = double(m_pdata->getNGlobal());
+    m_norm += N * (N - 1.0) / double(m_pdata->getGlobalBox().getVolume(ndim == 2));
+    ++m_num_samples;
+    }
+
+void RadialDistributionFunction::notifyDetach()
+    {
+    if (m_attached)
+        {
+        m_nlist->removeRCutMatrix(m_r_cut_nlist);
+        }
+    m_attached = false;
+    }
+
+/*! The distances are computed from the current positions, so the pairs that the neighbor list
+    keeps in its buffer are skipped. A half neighbor list stores each pair of local particles once,
+    so it is counted twice. A pair with a ghost particle is counted once on each rank.
+*/
+void RadialDistributionFunction::accumulate()
+    {
+    const BoxDim box = m_pdata->getBox();
+    const Scalar r_max_sq = m_r_max * m_r_max;
+    const Scalar bin_scale = Scalar(m_num_bins) / m_r_max;
+    const unsigned int N = m_pdata->getN();
+    const bool half = m_nlist->getStorageMode() == NeighborList::half;
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
+                                        access_location::host,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
+                                    access_location::host,
+                                    access_mode::read);
+    ArrayHandle<unsigned long long> h_histogram(m_histogram,
+                                                access_location::host,
+                                                access_mode::readwrite);
+
+    for (unsigned int i = 0; i < N; ++i)
+        {
+        const Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+        const size_t head = h_head_list.data[i];
+        const unsigned int n_neigh = h_n_neigh.data[i];
+        for (unsigned int k = 0; k < n_neigh; ++k)
+            {
+            const unsigned int j = h_nlist.data[head + k];
+            Scalar3 dx = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z) - pi;
+            dx = box.minImage(dx);
+            const Scalar rsq = dot(dx, dx);
+            if (rsq < r_max_sq)
+                {
+                const unsigned int bin
+                    = std::min((unsigned int)(fast::sqrt(rsq) * bin_scale), m_num_bins - 1);
+                h_histogram.data[bin] += (half && j < N) ? 2 : 1;
+                }
+            }
+        }
+    }
+
+void RadialDistributionFunction::resetHistogram()
+    {
+    ArrayHandle<unsigned long long> h_histogram(m_histogram,
+                                                access_location::host,
+                                                access_mode::overwrite);
+    memset(h_histogram.data, 0, sizeof(unsigned long long) * m_histogram.getNumElements());
+    }
+
+void RadialDistributionFunction::reset()
+    {
+    resetHistogram();
+    m_num_samples = 0;
+    m_norm = 0;
+    }
+
+/*! \returns The distance at the center of each bin
+ */
+std::vector<Scalar> RadialDistributionFunction::getBinCenters() const
+    {
+    std::vector<Scalar> r(m_num_bins);
+    const Scalar dr = m_r_max / Scalar(m_num_bins);
+    for (unsigned int bin = 0; bin < m_num_bins; ++bin)
+        {
+        r[bin] = (Scalar(bin) + Scalar(0.5)) * dr;
+        }
+    return r;
+    }
+
+/*! \returns The radial distribution function in each bin, which is zero before any samples
+
+    The histogram is reduced over all ranks, so this must be called on all ranks.
+*/
+std::vector<Scalar> RadialDistributionFunction::getRDF()
+    {
+    std::vector<unsigned long long> counts(m_num_bins);
+        {
+        ArrayHandle<unsigned long long> h_histogram(m_histogram,
+                                                    access_location::host,
+                                                    access_mode::read);
+        std::copy(h_histogram.data, h_histogram.data + m_num_bins, counts.begin());
+        }
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      counts.data(),
+                      m_num_bins,
+                      MPI_UNSIGNED_LONG_LONG,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    std::vector<Scalar> rdf(m_num_bins, Scalar(0));
+    if (!(m_norm > 0))
+        return rdf;
+
+    const bool two_d = m_sysdef->getNDimensions() == 2;
+    const double dr = double(m_r_max) / m_num_bins;
+    for (unsigned int bin = 0; bin < m_num_bins; ++bin)
+        {
+        const double r_lo = bin * dr;
+        const double r_hi = r_lo + dr;
+        const double shell = two_d ? M_PI * (r_hi * r_hi - r_lo * r_lo)
+                                   : 4.0 / 3.0 * M_PI * (r_hi * r_hi * r_hi - r_lo * r_lo * r_lo);
+        rdf[bin] = Scalar(double(counts[bin]) / (m_norm * shell));
+        }
+    return rdf;
+    }
+
+namespace detail
+    {
+void export_RadialDistributionFunction(pybind11::module& m)
+    {
+    pybind11::class_<RadialDistributionFunction,
+                     Analyzer,
+                     std::shared_ptr<RadialDistributionFunction>>(m, "RadialDistributionFunction")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<NeighborList>,
+                            unsigned int,
+                            Scalar>())
+        .def_property_readonly("num_bins", &RadialDistributionFunction::getNumBins)
+        .def_property_readonly("r_max", &RadialDistributionFunction::getRMax)
+        .def_property_readonly("num_samples", &RadialDistributionFunction::getNumSamples)
+        .def_property_readonly("bin_centers", &RadialDistributionFunction::getBinCenters)
+        .def_property_readonly("rdf", &RadialDistributionFunction::getRDF)
+        .def("reset", &RadialDistributionFunction::reset);
+    }
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
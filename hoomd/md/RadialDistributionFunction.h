@@ -0,0 +1,114 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file RadialDistributionFunction.h
+    \brief Declares the RadialDistributionFunction class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#ifndef __RADIAL_DISTRIBUTION_FUNCTION_H__
+#define __RADIAL_DISTRIBUTION_FUNCTION_H__
+
+#include "NeighborList.h"
+#include "hoomd/Analyzer.h"
+#include "hoomd/GPUArray.h"
+
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <vector>
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Accumulates the radial distribution function from a neighbor list
+/*! Every time the analyzer is triggered, the neighbor list is brought up to date and the distances
+    of all pairs in it that are closer than \a r_max are counted in \a num_bins bins of equal width.
+    A r_cut matrix of \a r_max is added to the neighbor list, so it finds all of these pairs. The
+    counts stay in device memory (on the GPU) and accumulate over all samples. They are only
+    reduced over the ranks and normalized when the radial distribution function is read.
+
+    Each sample is normalized by the number of ordered pairs in an ideal gas at the same density,
+    \f$ N (N - 1) / V \f$ times the volume of the shell (the area of the ring in 2D). The pairs that
+    the neighbor list excludes (e.g. bonded particles) are not counted.
+
+    \ingroup analyzers
+*/
+class PYBIND11_EXPORT RadialDistributionFunction : public Analyzer
+    {
+    public:
+    //! Constructor
+    RadialDistributionFunction(std::shared_ptr<SystemDefinition> sysdef,
+                               std::shared_ptr<Trigger> trigger,
+                               std::shared_ptr<NeighborList> nlist,
+                               unsigned int num_bins,
+                               Scalar r_max);
+
+    //! Destructor
+    virtual ~RadialDistributionFunction();
+
+    //! Accumulate the pair distances
+    virtual void analyze(uint64_t timestep);
+
+    //! Remove the r_cut matrix from the neighbor list
+    virtual void notifyDetach();
+
+    //! Get the number of bins
+    unsigned int getNumBins() const
+        {
+        return m_num_bins;
+        }
+
+    //! Get the largest distance to bin
+    Scalar getRMax() const
+        {
+        return m_r_max;
+        }
+
+    //! Get the number of samples that have been accumulated
+    uint64_t getNumSamples() const
+        {
+        return m_num_samples;
+        }
+
+    //! Get the distance at the center of each bin
+    std::vector<Scalar> getBinCenters() const;
+
+    //! Get the radial distribution function averaged over all samples
+    std::vector<Scalar> getRDF();
+
+    //! Discard all samples
+    void reset();
+
+    protected:
+    std::shared_ptr<NeighborList> m_nlist;              //!< Neighbor list to count pairs in
+    std::shared_ptr<GlobalArray<Scalar>> m_r_cut_nlist; //!< r_cut matrix added to the neighbor list
+    bool m_attached;                                    //!< True while the r_cut matrix is added
+
+    const unsigned int m_num_bins; //!< Number of bins
+    const Scalar m_r_max;          //!< Largest distance to bin
+
+    GPUArray<unsigned long long> m_histogram; //!< Number of ordered pairs in each bin
+    uint64_t m_num_samples;                   //!< Number of samples that have been accumulated
+    double m_norm; //!< Sum of the ideal gas pair densities of all samples
+
+    //! Add the pairs in the neighbor list to the histogram
+    virtual void accumulate();
+
+    //! Zero the histogram
+    virtual void resetHistogram();
+    };
+
+namespace detail
+    {
+//! Export the RadialDistributionFunction class to python
+void export_RadialDistributionFunction(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __RADIAL_DISTRIBUTION_FUNCTION_H__
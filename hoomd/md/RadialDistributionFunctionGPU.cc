@@ -0,0 +1,106 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file RadialDistributionFunctionGPU.cc
+    \brief Defines the RadialDistributionFunctionGPU class
+*/
+
+#include "RadialDistributionFunctionGPU.h"
+#include "RadialDistributionFunctionGPU.cuh"
+
+#include <stdexcept>
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System definition
+    \param trigger Steps on which to sample the pair distances
+    \param nlist Neighbor list to count pairs in
+    \param num_bins Number of bins
+    \param r_max Largest distance to bin
+*/
+RadialDistributionFunctionGPU::RadialDistributionFunctionGPU(
+    std::shared_ptr<SystemDefinition> sysdef,
+    std::shared_ptr<Trigger> trigger,
+    std::shared_ptr<NeighborList> nlist,
+    unsigned int num_bins,
+    Scalar r_max)
+    : RadialDistributionFunction(sysdef, trigger, nlist, num_bins, r_max)
+    {
+    if (!m_exec_conf->isCUDAEnabled())
+        {
+        throw std::runtime_error(
+            "Cannot initialize RadialDistributionFunctionGPU on a CPU device.");
+        }
+
+    m_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                   m_exec_conf,
+                                   "rdf_accumulate"));
+    m_autotuners.push_back(m_tuner);
+    }
+
+void RadialDistributionFunctionGPU::accumulate()
+    {
+    const bool use_shared
+        = sizeof(unsigned long long) * m_num_bins <= m_exec_conf->dev_prop.sharedMemPerBlock;
+
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_n_neigh(m_nlist->getNNeighArray(),
+                                        access_location::device,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> d_nlist(m_nlist->getNListArray(),
+                                      access_location::device,
+                                      access_mode::read);
+    ArrayHandle<size_t> d_head_list(m_nlist->getHeadList(),
+                                    access_location::device,
+                                    access_mode::read);
+    ArrayHandle<unsigned long long> d_histogram(m_histogram,
+                                                access_location::device,
+                                                access_mode::readwrite);
+
+    m_tuner->begin();
+    kernel::gpu_rdf_accumulate(d_histogram.data,
+                               d_pos.data,
+                               d_n_neigh.data,
+                               d_nlist.data,
+                               d_head_list.data,
+                               m_pdata->getBox(),
+                               m_pdata->getN(),
+                               m_nlist->getStorageMode() == NeighborList::half,
+                               m_num_bins,
+                               m_r_max,
+                               use_shared,
+                               m_tuner->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner->end();
+    }
+
+void RadialDistributionFunctionGPU::resetHistogram()
+    {
+    ArrayHandle<unsigned long long> d_histogram(m_histogram,
+                                                access_location::device,
+                                                access_mode::overwrite);
+    hipMemset(d_histogram.data, 0, sizeof(unsigned long long) * m_histogram.getNumElements());
+    }
+
+namespace detail
+    {
+void export_RadialDistributionFunctionGPU(pybind11::module& m)
+    {
+    pybind11::class_<RadialDistributionFunctionGPU,
+                     RadialDistributionFunction,
+                     std::shared_ptr<RadialDistributionFunctionGPU>>(
+        m,
+        "RadialDistributionFunctionGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<NeighborList>,
+                            unsigned int,
+                            Scalar>());
+    }
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
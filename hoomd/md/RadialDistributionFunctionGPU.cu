@@ -0,0 +1,153 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "RadialDistributionFunctionGPU.cuh"
+
+/*! \file RadialDistributionFunctionGPU.cu
+    \brief Defines GPU kernel code for RadialDistributionFunctionGPU
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Kernel to add the pairs in a neighbor list to a histogram of their distances
+/*! \param d_histogram Number of ordered pairs in each bin
+    \param d_pos Particle positions
+    \param d_n_neigh Number of neighbors of each particle
+    \param d_nlist Neighbor list
+    \param d_head_list Index of the first neighbor of each particle in \a d_nlist
+    \param box Local simulation box
+    \param N Number of local particles
+    \param half True if the neighbor list stores each pair once
+    \param num_bins Number of bins
+    \param r_max Largest distance to bin
+    \param use_shared True if the block accumulates its counts in shared memory
+
+    Using one thread per particle, the distances to all of its neighbors are binned. When
+    \a use_shared is set, the histogram of the block is held in shared memory, so the atomic
+    operations on global memory are reduced to one per nonzero bin per block.
+*/
+__global__ void gpu_rdf_accumulate_kernel(unsigned long long* d_histogram,
+                                          const Scalar4* d_pos,
+                                          const unsigned int* d_n_neigh,
+                                          const unsigned int* d_nlist,
+                                          const size_t* d_head_list,
+                                          const BoxDim box,
+                                          const unsigned int N,
+                                          const bool half,
+                                          const unsigned int num_bins,
+                                          const Scalar r_max,
+                                          const bool use_shared)
+    {
+    HIP_DYNAMIC_SHARED(unsigned long long, s_histogram)
+    unsigned long long* histogram = use_shared ? s_histogram : d_histogram;
+    if (use_shared)
+        {
+        for (unsigned int bin = threadIdx.x; bin < num_bins; bin += blockDim.x)
+            s_histogram[bin] = 0;
+        __syncthreads();
+        }
+
+    // one thread per particle, but all threads must reach the barrier below
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx < N)
+        {
+        const Scalar4 postype = d_pos[idx];
+        const Scalar3 pi = make_scalar3(postype.x, postype.y, postype.z);
+        const Scalar r_max_sq = r_max * r_max;
+        const Scalar bin_scale = Scalar(num_bins) / r_max;
+        const size_t head = d_head_list[idx];
+        const unsigned int n_neigh = d_n_neigh[idx];
+        for (unsigned int k = 0; k < n_neigh; ++k)
+            {
+            const unsigned int j = __ldg(d_nlist + head + k);
+            const Scalar4 postype_j = d_pos[j];
+            Scalar3 dx = make_scalar3(postype_j.x, postype_j.y, postype_j.z) - pi;
+            dx = box.minImage(dx);
+            const Scalar rsq = dot(dx, dx);
+            if (rsq < r_max_sq)
+                {
+                const unsigned int bin
+                    = min((unsigned int)(fast::sqrt(rsq) * bin_scale), num_bins - 1);
+                atomicAdd(histogram + bin, (half && j < N) ? 2ull : 1ull);
+                }
+            }
+        }
+
+    if (use_shared)
+        {
+        __syncthreads();
+        for (unsigned int bin = threadIdx.x; bin < num_bins; bin += blockDim.x)
+            {
+            const unsigned long long count = s_histogram[bin];
+            if (count > 0)
+                atomicAdd(d_histogram + bin, count);
+            }
+        }
+    }
+
+/*! \param d_histogram Number of ordered pairs in each bin
+    \param d_pos Particle positions
+    \param d_n_neigh Number of neighbors of each particle
+    \param d_nlist Neighbor list
+    \param d_head_list Index of the first neighbor of each particle in \a d_nlist
+    \param box Local simulation box
+    \param N Number of local particles
+    \param half True if the neighbor list stores each pair once
+    \param num_bins Number of bins
+    \param r_max Largest distance to bin
+    \param use_shared True if the histogram fits in shared memory
+    \param block_size Number of threads per block
+*/
+hipError_t gpu_rdf_accumulate(unsigned long long* d_histogram,
+                              const Scalar4* d_pos,
+                              const unsigned int* d_n_neigh,
+                              const unsigned int* d_nlist,
+                              const size_t* d_head_list,
+                              const BoxDim& box,
+                              const unsigned int N,
+                              const bool half,
+                              const unsigned int num_bins,
+                              const Scalar r_max,
+                              const bool use_shared,
+                              const unsigned int block_size)
+    {
+    if (N == 0)
+        return hipSuccess;
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_rdf_accumulate_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid((N / run_block_size) + 1, 1, 1);
+    dim3 threads(run_block_size, 1, 1);
+    const size_t shared_bytes = use_shared ? sizeof(unsigned long long) * num_bins : 0;
+
+    hipLaunchKernelGGL((gpu_rdf_accumulate_kernel),
+                       grid,
+                       threads,
+                       shared_bytes,
+                       0,
+                       d_histogram,
+                       d_pos,
+                       d_n_neigh,
+                       d_nlist,
+                       d_head_list,
+                       box,
+                       N,
+                       half,
+                       num_bins,
+                       r_max,
+                       use_shared);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
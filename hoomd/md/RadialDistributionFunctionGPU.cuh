@@ -0,0 +1,39 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file RadialDistributionFunctionGPU.cuh
+    \brief Declares GPU kernel code for RadialDistributionFunctionGPU
+*/
+
+#include "hip/hip_runtime.h"
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+
+#ifndef __RADIAL_DISTRIBUTION_FUNCTION_GPU_CUH__
+#define __RADIAL_DISTRIBUTION_FUNCTION_GPU_CUH__
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Kernel driver to add the pairs in a neighbor list to a histogram of their distances
+hipError_t gpu_rdf_accumulate(unsigned long long* d_histogram,
+                              const Scalar4* d_pos,
+                              const unsigned int* d_n_neigh,
+                              const unsigned int* d_nlist,
+                              const size_t* d_head_list,
+                              const BoxDim& box,
+                              const unsigned int N,
+                              const bool half,
+                              const unsigned int num_bins,
+                              const Scalar r_max,
+                              const bool use_shared,
+                              const unsigned int block_size);
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __RADIAL_DISTRIBUTION_FUNCTION_GPU_CUH__
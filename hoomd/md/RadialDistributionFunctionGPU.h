@@ -0,0 +1,59 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file RadialDistributionFunctionGPU.h
+    \brief Declares the RadialDistributionFunctionGPU class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#ifndef __RADIAL_DISTRIBUTION_FUNCTION_GPU_H__
+#define __RADIAL_DISTRIBUTION_FUNCTION_GPU_H__
+
+#include "RadialDistributionFunction.h"
+#include "hoomd/Autotuner.h"
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Accumulates the radial distribution function from a neighbor list on the GPU
+/*! The histogram is accumulated in shared memory by each block when it fits, and the blocks then
+    add their counts to the histogram in global memory. See RadialDistributionFunction for design
+    details.
+
+    \ingroup analyzers
+*/
+class PYBIND11_EXPORT RadialDistributionFunctionGPU : public RadialDistributionFunction
+    {
+    public:
+    //! Constructor
+    RadialDistributionFunctionGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                  std::shared_ptr<Trigger> trigger,
+                                  std::shared_ptr<NeighborList> nlist,
+                                  unsigned int num_bins,
+                                  Scalar r_max);
+
+    protected:
+    //! Add the pairs in the neighbor list to the histogram on the GPU
+    virtual void accumulate();
+
+    //! Zero the histogram on the GPU
+    virtual void resetHistogram();
+
+    private:
+    std::shared_ptr<Autotuner<1>> m_tuner; //!< Kernel tuner
+    };
+
+namespace detail
+    {
+//! Export the RadialDistributionFunctionGPU class to python
+void export_RadialDistributionFunctionGPU(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __RADIAL_DISTRIBUTION_FUNCTION_GPU_H__
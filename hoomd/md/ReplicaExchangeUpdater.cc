@@ -0,0 +1,237 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ReplicaExchangeUpdater.cc
+    \brief Defines the ReplicaExchangeUpdater class
+*/
+
+#include "ReplicaExchangeUpdater.h"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+
+#include <pybind11/stl.h>
+
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System definition
+    \param trigger Steps on which to attempt exchanges
+    \param thermo Computes the potential energy of the replica
+    \param kT_variant Variant that the updater sets to the kT of the current slot
+    \param P_variant Variant that the updater sets to the P of the current slot (may be null)
+    \param kT kT of each slot, one per partition
+    \param P P of each slot, one per partition (empty for constant volume replicas)
+*/
+ReplicaExchangeUpdater::ReplicaExchangeUpdater(std::shared_ptr<SystemDefinition> sysdef,
+                                               std::shared_ptr<Trigger> trigger,
+                                               std::shared_ptr<ComputeThermo> thermo,
+                                               std::shared_ptr<VariantConstant> kT_variant,
+                                               std::shared_ptr<VariantConstant> P_variant,
+                                               const std::vector<Scalar>& kT,
+                                               const std::vector<Scalar>& P)
+    : Updater(sysdef, trigger), m_thermo(thermo), m_kT_variant(kT_variant),
+      m_P_variant(P_variant), m_kT(kT), m_P(P), m_n_exchanges(0)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing ReplicaExchangeUpdater" << endl;
+    assert(m_thermo);
+    assert(m_kT_variant);
+
+    const unsigned int n_partitions = m_exec_conf->getNPartitions();
+    if (m_kT.size() != n_partitions)
+        {
+        throw std::invalid_argument("ReplicaExchange needs one kT for each of the "
+                                    + std::to_string(n_partitions) + " partitions.");
+        }
+    if (!m_P.empty() && m_P.size() != n_partitions)
+        {
+        throw std::invalid_argument("ReplicaExchange needs one P for each of the "
+                                    + std::to_string(n_partitions) + " partitions.");
+        }
+    if (!m_P.empty() && !m_P_variant)
+        {
+        throw std::invalid_argument("ReplicaExchange needs a P variant to exchange pressures.");
+        }
+    for (auto value : m_kT)
+        {
+        if (!(value > Scalar(0.0)))
+            {
+            throw std::invalid_argument("ReplicaExchange kT values must be positive.");
+            }
+        }
+
+    // replicas start in the slot that matches their partition
+    m_slots.resize(n_partitions);
+    for (unsigned int i = 0; i < n_partitions; i++)
+        {
+        m_slots[i] = i;
+        }
+    m_slot = m_exec_conf->getPartition();
+
+    unsigned int n_pairs = n_partitions > 0 ? n_partitions - 1 : 0;
+    m_n_attempted.resize(n_pairs, 0);
+    m_n_accepted.resize(n_pairs, 0);
+
+    applySlot();
+    }
+
+ReplicaExchangeUpdater::~ReplicaExchangeUpdater()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying ReplicaExchangeUpdater" << endl;
+    }
+
+void ReplicaExchangeUpdater::applySlot()
+    {
+    m_kT_variant->setValue(m_kT[m_slot]);
+    if (m_P_variant && !m_P.empty())
+        {
+        m_P_variant->setValue(m_P[m_slot]);
+        }
+    }
+
+/*! \param factor Factor to multiply the momenta by
+ */
+void ReplicaExchangeUpdater::scaleMomenta(Scalar factor)
+    {
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                               access_location::host,
+                               access_mode::readwrite);
+    ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(),
+                                  access_location::host,
+                                  access_mode::readwrite);
+
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        h_vel.data[i].x *= factor;
+        h_vel.data[i].y *= factor;
+        h_vel.data[i].z *= factor;
+
+        h_angmom.data[i].x *= factor;
+        h_angmom.data[i].y *= factor;
+        h_angmom.data[i].z *= factor;
+        h_angmom.data[i].w *= factor;
+        }
+    }
+
+/*! \param timestep Current time step of the simulation
+ */
+void ReplicaExchangeUpdater::update(uint64_t timestep)
+    {
+    Updater::update(timestep);
+
+    const unsigned int n_partitions = m_exec_conf->getNPartitions();
+    if (n_partitions < 2)
+        {
+        return;
+        }
+
+#ifdef ENABLE_MPI
+    // Every rank contributes the same row as the other ranks in its partition. Gathering on the
+    // world communicator is a single small collective and avoids a separate broadcast within
+    // each partition.
+    const unsigned int n_fields = 5;
+    m_thermo->compute(timestep);
+    double row[n_fields] = {double(m_slot),
+                            double(m_thermo->getPotentialEnergy()),
+                            double(m_thermo->getVolume()),
+                            double(timestep),
+                            double(m_sysdef->getSeed())};
+
+    const unsigned int n_ranks_global = m_exec_conf->getMPIConfig()->getNRanksGlobal();
+    std::vector<double> rows(n_ranks_global * n_fields);
+    MPI_Allgather(row,
+                  n_fields,
+                  MPI_DOUBLE,
+                  rows.data(),
+                  n_fields,
+                  MPI_DOUBLE,
+                  m_exec_conf->getHOOMDWorldMPICommunicator());
+
+    // read the row of the root rank in each partition
+    const unsigned int n_ranks = m_exec_conf->getNRanks();
+    std::vector<unsigned int> partition_in_slot(n_partitions);
+    std::vector<double> energy(n_partitions);
+    std::vector<double> volume(n_partitions);
+    for (unsigned int p = 0; p < n_partitions; p++)
+        {
+        const double* partition_row = &rows[p * n_ranks * n_fields];
+        if (uint64_t(partition_row[3]) != timestep)
+            {
+            throw std::runtime_error("ReplicaExchange must execute on the same time step in all "
+                                     "partitions.");
+            }
+
+        m_slots[p] = (unsigned int)partition_row[0];
+        partition_in_slot[m_slots[p]] = p;
+        energy[p] = partition_row[1];
+        volume[p] = partition_row[2];
+        }
+
+    // all ranks draw the same random numbers
+    const uint16_t seed = uint16_t(rows[4]);
+    RandomGenerator rng(hoomd::Seed(RNGIdentifier::ReplicaExchangeUpdater, timestep, seed),
+                        hoomd::Counter());
+    hoomd::UniformDistribution<double> uniform(0.0, 1.0);
+
+    for (unsigned int i = m_n_exchanges % 2; i + 1 < n_partitions; i += 2)
+        {
+        const unsigned int a = partition_in_slot[i];
+        const unsigned int b = partition_in_slot[i + 1];
+        const double beta_i = 1.0 / m_kT[i];
+        const double beta_j = 1.0 / m_kT[i + 1];
+
+        double delta = (beta_i - beta_j) * (energy[a] - energy[b]);
+        if (!m_P.empty())
+            {
+            delta += (beta_i * m_P[i] - beta_j * m_P[i + 1]) * (volume[a] - volume[b]);
+            }
+
+        m_n_attempted[i]++;
+        if (delta >= 0 || uniform(rng) < exp(delta))
+            {
+            m_n_accepted[i]++;
+            std::swap(partition_in_slot[i], partition_in_slot[i + 1]);
+            m_slots[a] = i + 1;
+            m_slots[b] = i;
+            }
+        }
+    m_n_exchanges++;
+
+    const unsigned int new_slot = m_slots[m_exec_conf->getPartition()];
+    if (new_slot != m_slot)
+        {
+        scaleMomenta(Scalar(sqrt(m_kT[new_slot] / m_kT[m_slot])));
+        m_slot = new_slot;
+        applySlot();
+        }
+#endif
+    }
+
+namespace detail
+    {
+void export_ReplicaExchangeUpdater(pybind11::module& m)
+    {
+    pybind11::class_<ReplicaExchangeUpdater, Updater, std::shared_ptr<ReplicaExchangeUpdater>>(
+        m,
+        "ReplicaExchangeUpdater")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<ComputeThermo>,
+                            std::shared_ptr<VariantConstant>,
+                            std::shared_ptr<VariantConstant>,
+                            const std::vector<Scalar>&,
+                            const std::vector<Scalar>&>())
+        .def_property_readonly("slot", &ReplicaExchangeUpdater::getSlot)
+        .def_property_readonly("slots", &ReplicaExchangeUpdater::getSlots)
+        .def_property_readonly("n_attempted", &ReplicaExchangeUpdater::getNAttempted)
+        .def_property_readonly("n_accepted", &ReplicaExchangeUpdater::getNAccepted);
+    }
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
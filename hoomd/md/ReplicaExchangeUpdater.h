@@ -0,0 +1,120 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ReplicaExchangeUpdater.h
+    \brief Declares an updater that exchanges thermodynamic parameters between partitions
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "ComputeThermo.h"
+#include "hoomd/Updater.h"
+#include "hoomd/Variant.h"
+
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <vector>
+
+#ifndef __REPLICAEXCHANGEUPDATER_H__
+#define __REPLICAEXCHANGEUPDATER_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Exchanges temperatures (and pressures) between replicas in MPI partitions
+/*! Each MPI partition holds one replica of the system. The updater assigns each replica a slot in
+    a ladder of temperatures kT (and optionally pressures P). On each triggered step, the partitions
+    attempt to swap the slots of neighboring replicas in the ladder with the Metropolis criterion:
+
+    \f[ p = \min\left(1, e^{(\beta_i - \beta_j)(U_a - U_b)
+                           + (\beta_i P_i - \beta_j P_j)(V_a - V_b)}\right) \f]
+
+    where replica a is in slot i and replica b is in slot j = i + 1. Attempts alternate between the
+    pairs that start on even and odd slots.
+
+    The configurations never move between partitions. Instead, each partition sets the values of
+    the kT and P variants it owns to the values in its new slot and rescales the particle momenta
+    by \f$ \sqrt{kT_\mathrm{new} / kT_\mathrm{old}} \f$. The integration methods read the
+    variants, so they thermostat (and barostat) at the new values from the next step on.
+
+    The only communication is one all-gather of a few scalars per rank on the HOOMD world
+    communicator. Every rank then evaluates the same swap decisions with a random number stream
+    seeded from partition 0, so the decisions need no further communication.
+
+    The partitions must execute the updater on the same time steps.
+
+    \ingroup updaters
+*/
+class PYBIND11_EXPORT ReplicaExchangeUpdater : public Updater
+    {
+    public:
+    //! Constructor
+    ReplicaExchangeUpdater(std::shared_ptr<SystemDefinition> sysdef,
+                           std::shared_ptr<Trigger> trigger,
+                           std::shared_ptr<ComputeThermo> thermo,
+                           std::shared_ptr<VariantConstant> kT_variant,
+                           std::shared_ptr<VariantConstant> P_variant,
+                           const std::vector<Scalar>& kT,
+                           const std::vector<Scalar>& P);
+
+    virtual ~ReplicaExchangeUpdater();
+
+    //! Attempt to exchange slots
+    virtual void update(uint64_t timestep);
+
+    //! Get the ladder slot of this partition's replica
+    unsigned int getSlot() const
+        {
+        return m_slot;
+        }
+
+    //! Get the ladder slot of each partition's replica
+    const std::vector<unsigned int>& getSlots() const
+        {
+        return m_slots;
+        }
+
+    //! Get the number of attempted swaps between slots i and i + 1
+    const std::vector<uint64_t>& getNAttempted() const
+        {
+        return m_n_attempted;
+        }
+
+    //! Get the number of accepted swaps between slots i and i + 1
+    const std::vector<uint64_t>& getNAccepted() const
+        {
+        return m_n_accepted;
+        }
+
+    protected:
+    std::shared_ptr<ComputeThermo> m_thermo;        //!< Computes the potential energy
+    std::shared_ptr<VariantConstant> m_kT_variant;  //!< kT of this partition's slot
+    std::shared_ptr<VariantConstant> m_P_variant;   //!< P of this partition's slot (may be null)
+    std::vector<Scalar> m_kT;                       //!< kT in each slot
+    std::vector<Scalar> m_P;                        //!< P in each slot (empty when constant volume)
+    unsigned int m_slot;                            //!< Slot of this partition's replica
+    std::vector<unsigned int> m_slots;              //!< Slot of each partition's replica
+    std::vector<uint64_t> m_n_attempted;            //!< Attempted swaps per pair of slots
+    std::vector<uint64_t> m_n_accepted;             //!< Accepted swaps per pair of slots
+    uint64_t m_n_exchanges;                         //!< Number of exchange steps performed
+
+    //! Set the variants to the values of this partition's slot
+    void applySlot();
+
+    //! Scale the particle momenta
+    void scaleMomenta(Scalar factor);
+    };
+
+namespace detail
+    {
+//! Export ReplicaExchangeUpdater to python
+void export_ReplicaExchangeUpdater(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -23,7 +23,8 @@ namespace md
 */
 TableAngleForceCompute::TableAngleForceCompute(std::shared_ptr<SystemDefinition> sysdef,
                                                unsigned int table_width)
-    : ForceCompute(sysdef), m_table_width(table_width)
+    : ForceCompute(sysdef), m_table_width(table_width),
+      m_interpolation(detail::table_interpolation::linear)
     {
     m_exec_conf->msg->notice(5) << "Constructing TableAngleForceCompute" << endl;
 
@@ -160,6 +161,10 @@ void TableAngleForceCompute::computeForces(uint64_t timestep)
 
     // access the table data
     ArrayHandle<Scalar2> h_tables(m_tables, access_location::host, access_mode::read);
+    const detail::TableInterpolator interpolator(h_tables.data,
+                                                 m_table_value,
+                                                 m_table_width,
+                                                 m_interpolation);
 
     // for each of the angles
     const unsigned int size = (unsigned int)m_angle_data->getN();
@@ -241,25 +246,10 @@ void TableAngleForceCompute::computeForces(uint64_t timestep)
         // precomputed term
         Scalar value_f = theta / delta_th;
 
-        // compute index into the table and read in values
-
-        /// Here we use the table!!
+        // interpolate to get V and T
         unsigned int angle_type = m_angle_data->getTypeByIndex(i);
-        unsigned int value_i = (unsigned int)(slow::floor(value_f));
-        Scalar2 VT0 = h_tables.data[m_table_value(value_i, angle_type)];
-        Scalar2 VT1 = h_tables.data[m_table_value(value_i + 1, angle_type)];
-        // unpack the data
-        Scalar V0 = VT0.x;
-        Scalar V1 = VT1.x;
-        Scalar T0 = VT0.y;
-        Scalar T1 = VT1.y;
-
-        // compute the linear interpolation coefficient
-        Scalar f = value_f - Scalar(value_i);
-
-        // interpolate to get V and T;
-        Scalar V = V0 + f * (V1 - V0);
-        Scalar T = T0 + f * (T1 - T0);
+        Scalar V, T;
+        interpolator.evaluate(V, T, value_f, angle_type, delta_th);
 
         Scalar a = T * s_abbc;
         Scalar a11 = a * c_abbc / rsqab;
@@ -332,6 +322,9 @@ void export_TableAngleForceCompute(pybind11::module& m)
         "TableAngleForceCompute")
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, unsigned int>())
         .def_property_readonly("width", &TableAngleForceCompute::getWidth)
+        .def_property("interpolation",
+                      &TableAngleForceCompute::getInterpolation,
+                      &TableAngleForceCompute::setInterpolation)
         .def("setParams", &TableAngleForceCompute::setParamsPython)
         .def("getParams", &TableAngleForceCompute::getParams);
     }
@@ -86,6 +86,7 @@ void TableAngleForceComputeGPU::computeForces(uint64_t timestep)
                                                d_tables.data,
                                                m_table_width,
                                                m_table_value,
+                                               m_interpolation,
                                                m_tuner->getParam()[0]);
         }
 
@@ -37,8 +37,7 @@ namespace kernel
     \param pitch Pitch of 2D angle list
     \param n_angles_list List of numbers of angles stored on the GPU
     \param n_angle_type number of angle types
-    \param d_tables Tables of the potential and force
-    \param table_value index helper function
+    \param interpolator Interpolator of the tables
     \param delta_th angle delta of the table
 
     See TableAngleForceCompute for information on the memory layout.
@@ -53,8 +52,7 @@ __global__ void gpu_compute_table_angle_forces_kernel(Scalar4* d_force,
                                                       const unsigned int* apos_list,
                                                       const unsigned int pitch,
                                                       const unsigned int* n_angles_list,
-                                                      const Scalar2* d_tables,
-                                                      const Index2D table_value,
+                                                      const detail::TableInterpolator interpolator,
                                                       const Scalar delta_th)
     {
     // start by identifying which particle we are to handle
@@ -150,22 +148,9 @@ __global__ void gpu_compute_table_angle_forces_kernel(Scalar4* d_force,
         // precomputed term
         Scalar value_f = theta / delta_th;
 
-        // compute index into the table and read in values
-        unsigned int value_i = value_f;
-        Scalar2 VT0 = __ldg(d_tables + table_value(value_i, cur_angle_type));
-        Scalar2 VT1 = __ldg(d_tables + table_value(value_i + 1, cur_angle_type));
-        // unpack the data
-        Scalar V0 = VT0.x;
-        Scalar V1 = VT1.x;
-        Scalar T0 = VT0.y;
-        Scalar T1 = VT1.y;
-
-        // compute the linear interpolation coefficient
-        Scalar f = value_f - Scalar(value_i);
-
-        // interpolate to get V and T;
-        Scalar V = V0 + f * (V1 - V0);
-        Scalar T = T0 + f * (T1 - T0);
+        // interpolate to get V and T
+        Scalar V, T;
+        interpolator.evaluate(V, T, value_f, cur_angle_type, delta_th);
 
         Scalar a = T * s_abbc;
         Scalar a11 = a * c_abbc / rsqab;
@@ -236,6 +221,7 @@ __global__ void gpu_compute_table_angle_forces_kernel(Scalar4* d_force,
     \param d_tables Tables of the potential and force
     \param table_width Number of points in each table
     \param table_value indexer helper
+    \param interpolation Interpolation between table points
     \param block_size Block size at which to run the kernel
     \param compute_capability Compute capability of the device (200, 300, 350, ...)
 
@@ -255,6 +241,7 @@ hipError_t gpu_compute_table_angle_forces(Scalar4* d_force,
                                           const Scalar2* d_tables,
                                           const unsigned int table_width,
                                           const Index2D& table_value,
+                                          const detail::table_interpolation interpolation,
                                           const unsigned int block_size)
     {
     assert(d_tables);
@@ -291,8 +278,7 @@ hipError_t gpu_compute_table_angle_forces(Scalar4* d_force,
                        apos_list,
                        pitch,
                        n_angles_list,
-                       d_tables,
-                       table_value,
+                       detail::TableInterpolator(d_tables, table_value, table_width, interpolation),
                        delta_th);
 
     return hipSuccess;
@@ -11,6 +11,8 @@
 #include "hoomd/Index1D.h"
 #include "hoomd/ParticleData.cuh"
 
+#include "TableInterpolator.h"
+
 #ifndef __TABLEANGLEFORCECOMPUTEGPU_CUH__
 #define __TABLEANGLEFORCECOMPUTEGPU_CUH__
 
@@ -34,6 +36,7 @@ hipError_t gpu_compute_table_angle_forces(Scalar4* d_force,
                                           const Scalar2* d_tables,
                                           const unsigned int table_width,
                                           const Index2D& table_value,
+                                          const detail::table_interpolation interpolation,
                                           const unsigned int block_size);
 
     } // end namespace kernel
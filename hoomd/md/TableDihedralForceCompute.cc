@@ -24,7 +24,8 @@ namespace md
 */
 TableDihedralForceCompute::TableDihedralForceCompute(std::shared_ptr<SystemDefinition> sysdef,
                                                      unsigned int table_width)
-    : ForceCompute(sysdef), m_table_width(table_width)
+    : ForceCompute(sysdef), m_table_width(table_width),
+      m_interpolation(detail::table_interpolation::linear)
     {
     m_exec_conf->msg->notice(5) << "Constructing TableDihedralForceCompute" << endl;
 
@@ -155,6 +156,10 @@ void TableDihedralForceCompute::computeForces(uint64_t timestep)
 
     // access the table data
     ArrayHandle<Scalar2> h_tables(m_tables, access_location::host, access_mode::read);
+    const detail::TableInterpolator interpolator(h_tables.data,
+                                                 m_table_value,
+                                                 m_table_width,
+                                                 m_interpolation);
 
     // for each of the dihedrals
     const unsigned int size = (unsigned int)m_dihedral_data->getN();
@@ -282,25 +287,10 @@ void TableDihedralForceCompute::computeForces(uint64_t timestep)
         Scalar delta_phi = Scalar(2.0 * M_PI) / Scalar(m_table_width - 1);
         Scalar value_f = (Scalar(M_PI) + phi) / delta_phi;
 
-        // compute index into the table and read in values
-
-        /// Here we use the table!!
+        // interpolate to get V and T
         unsigned int dihedral_type = m_dihedral_data->getTypeByIndex(i);
-        unsigned int value_i = (unsigned int)value_f;
-        Scalar2 VT0 = h_tables.data[m_table_value(value_i, dihedral_type)];
-        Scalar2 VT1 = h_tables.data[m_table_value(value_i + 1, dihedral_type)];
-        // unpack the data
-        Scalar V0 = VT0.x;
-        Scalar V1 = VT1.x;
-        Scalar T0 = VT0.y;
-        Scalar T1 = VT1.y;
-
-        // compute the linear interpolation coefficient
-        Scalar f = value_f - Scalar(value_i);
-
-        // interpolate to get V and T;
-        Scalar V = V0 + f * (V1 - V0);
-        Scalar T = T0 + f * (T1 - T0);
+        Scalar V, T;
+        interpolator.evaluate(V, T, value_f, dihedral_type, delta_phi);
 
         // from Blondel and Karplus 1995
         vec3<Scalar> A = cross(vec3<Scalar>(dab), vec3<Scalar>(dcbm));
@@ -375,6 +365,9 @@ void export_TableDihedralForceCompute(pybind11::module& m)
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, unsigned int>())
         .def("setTable", &TableDihedralForceCompute::setTable)
         .def_property_readonly("width", &TableDihedralForceCompute::getWidth)
+        .def_property("interpolation",
+                      &TableDihedralForceCompute::getInterpolation,
+                      &TableDihedralForceCompute::setInterpolation)
         .def("setParams", &TableDihedralForceCompute::setParamsPython)
         .def("getParams", &TableDihedralForceCompute::getParams);
     }
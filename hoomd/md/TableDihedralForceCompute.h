@@ -6,6 +6,8 @@
 #include "hoomd/GPUArray.h"
 #include "hoomd/Index1D.h"
 
+#include "TableInterpolator.h"
+
 #include <memory>
 
 /*! \file TableDihedralForceCompute.h
@@ -78,6 +80,18 @@ class PYBIND11_EXPORT TableDihedralForceCompute : public ForceCompute
         return m_table_width;
         }
 
+    /// Get the name of the interpolation method
+    std::string getInterpolation()
+        {
+        return detail::getTableInterpolationName(m_interpolation);
+        }
+
+    /// Set the interpolation method by name
+    void setInterpolation(const std::string& interpolation)
+        {
+        m_interpolation = detail::getTableInterpolation(interpolation);
+        }
+
 #ifdef ENABLE_MPI
     //! Get ghost particle fields requested by this pair potential
     /*! \param timestep Current time step
@@ -96,6 +110,7 @@ class PYBIND11_EXPORT TableDihedralForceCompute : public ForceCompute
     unsigned int m_table_width;                    //!< Width of the tables in memory
     GPUArray<Scalar2> m_tables;                    //!< Stored V and F tables
     Index2D m_table_value;                         //!< Index table helper
+    detail::table_interpolation m_interpolation;   //!< Interpolation between table points
 
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
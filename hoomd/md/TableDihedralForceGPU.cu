@@ -38,25 +38,24 @@ namespace kernel
     \param pitch Pitch of 2D dihedral list
     \param n_dihedrals_list List of numbers of dihedrals stored on the GPU
     \param n_dihedral_type number of dihedral types
-    \param d_tables Tables of the potential and force
-    \param table_value index helper function
+    \param interpolator Interpolator of the tables
     \param delta_phi dihedral delta of the table
 
     See TableDihedralForceCompute for information on the memory layout.
 */
-__global__ void gpu_compute_table_dihedral_forces_kernel(Scalar4* d_force,
-                                                         Scalar* d_virial,
-                                                         const size_t virial_pitch,
-                                                         const unsigned int N,
-                                                         const Scalar4* device_pos,
-                                                         const BoxDim box,
-                                                         const group_storage<4>* dlist,
-                                                         const unsigned int* dihedral_ABCD,
-                                                         const unsigned int pitch,
-                                                         const unsigned int* n_dihedrals_list,
-                                                         const Scalar2* d_tables,
-                                                         const Index2D table_value,
-                                                         const Scalar delta_phi)
+__global__ void
+gpu_compute_table_dihedral_forces_kernel(Scalar4* d_force,
+                                         Scalar* d_virial,
+                                         const size_t virial_pitch,
+                                         const unsigned int N,
+                                         const Scalar4* device_pos,
+                                         const BoxDim box,
+                                         const group_storage<4>* dlist,
+                                         const unsigned int* dihedral_ABCD,
+                                         const unsigned int pitch,
+                                         const unsigned int* n_dihedrals_list,
+                                         const detail::TableInterpolator interpolator,
+                                         const Scalar delta_phi)
     {
     // start by identifying which particle we are to handle
     unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
@@ -210,22 +209,9 @@ __global__ void gpu_compute_table_dihedral_forces_kernel(Scalar4* d_force,
         // precomputed term
         Scalar value_f = (Scalar(M_PI) + phi) / delta_phi;
 
-        // compute index into the table and read in values
-        unsigned int value_i = value_f;
-        Scalar2 VT0 = __ldg(d_tables + table_value(value_i, cur_dihedral_type));
-        Scalar2 VT1 = __ldg(d_tables + table_value(value_i + 1, cur_dihedral_type));
-        // unpack the data
-        Scalar V0 = VT0.x;
-        Scalar V1 = VT1.x;
-        Scalar T0 = VT0.y;
-        Scalar T1 = VT1.y;
-
-        // compute the linear interpolation coefficient
-        Scalar f = value_f - Scalar(value_i);
-
-        // interpolate to get V and T;
-        Scalar V = V0 + f * (V1 - V0);
-        Scalar T = T0 + f * (T1 - T0);
+        // interpolate to get V and T
+        Scalar V, T;
+        interpolator.evaluate(V, T, value_f, cur_dihedral_type, delta_phi);
 
         // from Blondel and Karplus 1995
         vec3<Scalar> A = cross(vec3<Scalar>(dab), vec3<Scalar>(dcbm));
@@ -309,6 +295,7 @@ __global__ void gpu_compute_table_dihedral_forces_kernel(Scalar4* d_force,
     \param d_tables Tables of the potential and force
     \param table_width Number of points in each table
     \param table_value indexer helper
+    \param interpolation Interpolation between table points
     \param block_size Block size at which to run the kernel
     \param compute_capability Compute capability of the device (200, 300, 350, ...)
 
@@ -328,6 +315,7 @@ hipError_t gpu_compute_table_dihedral_forces(Scalar4* d_force,
                                              const Scalar2* d_tables,
                                              const unsigned int table_width,
                                              const Index2D& table_value,
+                                             const detail::table_interpolation interpolation,
                                              const unsigned int block_size)
     {
     assert(d_tables);
@@ -364,8 +352,7 @@ hipError_t gpu_compute_table_dihedral_forces(Scalar4* d_force,
                        dihedral_ABCD,
                        pitch,
                        n_dihedrals_list,
-                       d_tables,
-                       table_value,
+                       detail::TableInterpolator(d_tables, table_value, table_width, interpolation),
                        delta_phi);
 
     return hipSuccess;
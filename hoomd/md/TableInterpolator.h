@@ -0,0 +1,146 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file TableInterpolator.h
+    \brief Defines the TableInterpolator class shared by the tabulated bonded forces
+*/
+
+#ifndef __TABLE_INTERPOLATOR_H__
+#define __TABLE_INTERPOLATOR_H__
+
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/Index1D.h"
+
+#ifndef __HIPCC__
+#include <stdexcept>
+#include <string>
+#endif
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__ inline
+#else
+#define HOSTDEVICE inline __attribute__((always_inline))
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace detail
+    {
+//! Methods to interpolate between table points
+enum class table_interpolation
+    {
+    linear, //!< Interpolate V and F linearly
+    cubic   //!< Interpolate V with a cubic Hermite spline and take F from its derivative
+    };
+
+#ifndef __HIPCC__
+//! Get the name of an interpolation method
+inline std::string getTableInterpolationName(table_interpolation interpolation)
+    {
+    return (interpolation == table_interpolation::cubic) ? "cubic" : "linear";
+    }
+
+//! Get the interpolation method with a name
+inline table_interpolation getTableInterpolation(const std::string& name)
+    {
+    if (name == "linear")
+        return table_interpolation::linear;
+    else if (name == "cubic")
+        return table_interpolation::cubic;
+    else
+        throw std::invalid_argument("Invalid table interpolation: " + name);
+    }
+#endif // __HIPCC__
+
+//! Interpolates the potential and force from tables of V and F = -dV/dx
+/*! Each type has its own row of \a width points, spaced by \a delta in x, with the pair (V, F) at
+    every point. Coordinates are given as the fractional position \a u = (x - x_0) / delta in the
+    table, and points past the last interval are evaluated in the last interval.
+
+    Linear interpolation interpolates V and F independently. Cubic interpolation interpolates V
+    with the cubic Hermite spline that matches V and dV/dx = -F at both ends of the interval, and
+    F is the negative derivative of that spline. It is exact for a cubic V, and the force is the
+    gradient of the energy within every interval, so energy is conserved more closely at the same
+    table width. Both methods read the same two table points.
+*/
+class TableInterpolator
+    {
+    public:
+    //! Constructor
+    /*! \param tables Table values
+        \param table_value Indexer into \a tables by point and type
+        \param width Number of points in a table (at least 2)
+        \param interpolation Interpolation method
+    */
+    HOSTDEVICE TableInterpolator(const Scalar2* tables,
+                                 const Index2D& table_value,
+                                 unsigned int width,
+                                 table_interpolation interpolation)
+        : m_tables(tables), m_table_value(table_value), m_width(width),
+          m_interpolation(interpolation)
+        {
+        }
+
+    //! Evaluate the potential and force
+    /*! \param V Interpolated potential (output)
+        \param F Interpolated force (output)
+        \param u Fractional position in the table
+        \param type Type of the table
+        \param delta Spacing of the table points
+    */
+    HOSTDEVICE void
+    evaluate(Scalar& V, Scalar& F, Scalar u, unsigned int type, Scalar delta) const
+        {
+        unsigned int i = (unsigned int)u;
+        if (i > m_width - 2)
+            i = m_width - 2;
+        const Scalar2 VF0 = fetch(m_table_value(i, type));
+        const Scalar2 VF1 = fetch(m_table_value(i + 1, type));
+        const Scalar t = u - Scalar(i);
+
+        if (m_interpolation == table_interpolation::cubic)
+            {
+            // slopes of V with respect to t
+            const Scalar m0 = -VF0.y * delta;
+            const Scalar m1 = -VF1.y * delta;
+            const Scalar dV = VF1.x - VF0.x;
+
+            // V(t) = V0 + m0 t + (3 dV - 2 m0 - m1) t^2 + (m0 + m1 - 2 dV) t^3
+            const Scalar c2 = Scalar(3) * dV - Scalar(2) * m0 - m1;
+            const Scalar c3 = m0 + m1 - Scalar(2) * dV;
+            V = VF0.x + t * (m0 + t * (c2 + t * c3));
+            F = -(m0 + t * (Scalar(2) * c2 + Scalar(3) * t * c3)) / delta;
+            }
+        else
+            {
+            V = VF0.x + t * (VF1.x - VF0.x);
+            F = VF0.y + t * (VF1.y - VF0.y);
+            }
+        }
+
+    private:
+    const Scalar2* m_tables;                   //!< Table values
+    const Index2D m_table_value;               //!< Indexer into the tables
+    const unsigned int m_width;                //!< Number of points in a table
+    const table_interpolation m_interpolation; //!< Interpolation method
+
+    //! Load a table point through the read-only cache
+    HOSTDEVICE Scalar2 fetch(unsigned int idx) const
+        {
+#ifdef __HIP_DEVICE_COMPILE__
+        return __ldg(m_tables + idx);
+#else
+        return m_tables[idx];
+#endif
+        }
+    };
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#undef HOSTDEVICE
+
+#endif // __TABLE_INTERPOLATOR_H__
@@ -35,12 +35,17 @@ TwoStepConstantPressureGPU::TwoStepConstantPressureGPU(
     m_tuner_two.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                        m_exec_conf,
                                        "npt_mtk_step_two"));
+    // the wrap and rescale kernels do not run when step one can fuse them
     m_tuner_wrap.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                         m_exec_conf,
-                                        "npt_mtk_wrap"));
+                                        "npt_mtk_wrap",
+                                        5,
+                                        true));
     m_tuner_rescale.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                            m_exec_conf,
-                                           "npt_mtk_rescale"));
+                                           "npt_mtk_rescale",
+                                           5,
+                                           true));
     m_tuner_angular_one.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                                m_exec_conf,
                                                "npt_mtk_angular_one",
@@ -128,7 +133,14 @@ void TwoStepConstantPressureGPU::integrateStepOne(uint64_t timestep)
     // update the propagator matrix
     updatePropagator();
 
-    if (m_rescale_all)
+    // When the group holds every local particle, the step one kernel rescales and wraps all
+    // positions itself and the separate passes over all particles are skipped.
+    const bool fuse_passes = m_group->getNumMembers() == m_pdata->getN();
+
+    // Get new (local) box lengths
+    BoxDim box = m_pdata->getBox();
+
+    if (m_rescale_all && !fuse_passes)
         {
         ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
                                    access_location::device,
@@ -166,6 +178,9 @@ void TwoStepConstantPressureGPU::integrateStepOne(uint64_t timestep)
         ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
                                    access_location::device,
                                    access_mode::readwrite);
+        ArrayHandle<int3> d_image(m_pdata->getImages(),
+                                  access_location::device,
+                                  access_mode::readwrite);
 
         ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
                                                 access_location::device,
@@ -185,7 +200,10 @@ void TwoStepConstantPressureGPU::integrateStepOne(uint64_t timestep)
                                          m_mat_exp_r,
                                          m_mat_exp_r_int,
                                          m_deltaT,
-                                         m_rescale_all,
+                                         m_rescale_all && !fuse_passes,
+                                         d_image.data,
+                                         box,
+                                         fuse_passes,
                                          m_tuner_one->getParam()[0]);
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -195,9 +213,7 @@ void TwoStepConstantPressureGPU::integrateStepOne(uint64_t timestep)
         m_exec_conf->endMultiGPU();
         } // end of GPUArray scope
 
-    // Get new (local) box lengths
-    BoxDim box = m_pdata->getBox();
-
+    if (!fuse_passes)
         {
         ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
                                    access_location::device,
@@ -48,7 +48,10 @@ __global__ void gpu_npt_mtk_step_one_kernel(Scalar4* d_pos,
                                             Scalar mat_exp_r_int_yz,
                                             Scalar mat_exp_r_int_zz,
                                             Scalar deltaT,
-                                            bool rescale_all)
+                                            bool rescale_all,
+                                            int3* d_image,
+                                            BoxDim box,
+                                            bool wrap)
     {
     // determine which particle this thread works on
     int work_idx = blockIdx.x * blockDim.x + threadIdx.x;
@@ -93,6 +96,14 @@ __global__ void gpu_npt_mtk_step_one_kernel(Scalar4* d_pos,
         r.y += mat_exp_r_int_yy * v.y + mat_exp_r_int_yz * v.z;
         r.z += mat_exp_r_int_zz * v.z;
 
+        // wrap the particle back into the new box when no separate wrap kernel follows
+        if (wrap)
+            {
+            int3 image = d_image[idx];
+            box.wrap(r, image);
+            d_image[idx] = image;
+            }
+
         // write out the results
         d_pos[idx] = make_scalar4(r.x, r.y, r.z, pos.w);
         d_vel[idx] = make_scalar4(v.x, v.y, v.z, vel.w);
@@ -111,6 +122,9 @@ __global__ void gpu_npt_mtk_step_one_kernel(Scalar4* d_pos,
     \param deltaT Time to advance (for one full step)
     \param deltaT Time to move forward in one whole step
     \param rescale_all True if all particles in the system should be rescaled at once
+    \param d_image array of particle images
+    \param box The new box the particles reside in
+    \param wrap True if the kernel should also wrap the particles into \a box
 
     This is just a kernel driver for gpu_npt_mtk_step_one_kernel(). See it for more details.
 */
@@ -125,6 +139,9 @@ hipError_t gpu_npt_rescale_step_one(Scalar4* d_pos,
                                     Scalar* mat_exp_r_int,
                                     Scalar deltaT,
                                     bool rescale_all,
+                                    int3* d_image,
+                                    const BoxDim& box,
+                                    bool wrap,
                                     const unsigned int block_size)
     {
     unsigned int max_block_size;
@@ -177,7 +194,10 @@ hipError_t gpu_npt_rescale_step_one(Scalar4* d_pos,
                            mat_exp_r_int[4],
                            mat_exp_r_int[5],
                            deltaT,
-                           rescale_all);
+                           rescale_all,
+                           d_image,
+                           box,
+                           wrap);
         }
 
     return hipSuccess;
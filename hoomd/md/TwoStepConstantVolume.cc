@@ -16,6 +16,10 @@ void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
 
     unsigned int group_size = m_group->getNumMembers();
 
+#ifdef HOOMD_COMPENSATED_INTEGRATION
+    validateCompensation();
+#endif
+
         // scope array handles for proper releasing before calling the thermo compute
         {
         ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
@@ -27,6 +31,11 @@ void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
         ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
                                    access_location::host,
                                    access_mode::readwrite);
+#ifdef HOOMD_COMPENSATED_INTEGRATION
+        ArrayHandle<Scalar3> h_pos_compensation(m_pos_compensation,
+                                                access_location::host,
+                                                access_mode::readwrite);
+#endif
 
         for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
             {
@@ -51,7 +60,15 @@ void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
                     v = v / len * maximum_displacement / m_deltaT;
                     }
                 }
+#ifdef HOOMD_COMPENSATED_INTEGRATION
+            // Kahan summation carries the rounding error of the update to the next step
+            Scalar3 dx = m_deltaT * v - h_pos_compensation.data[j];
+            Scalar3 new_pos = pos + dx;
+            h_pos_compensation.data[j] = (new_pos - pos) - dx;
+            pos = new_pos;
+#else
             pos += m_deltaT * v;
+#endif
 
             // store updated variables
             h_vel.data[j].x = v.x;
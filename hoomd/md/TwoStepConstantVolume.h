@@ -16,6 +16,12 @@ namespace hoomd::md
 
     Implement the the Velocity-Verlet integration scheme with an optional velocity rescaling
     Thermostat.
+
+    When built with HOOMD_COMPENSATED_INTEGRATION, the position update is Kahan-compensated: the
+    rounding error of each update is kept per particle and added back on the next step. This
+    reduces the energy drift of long constant energy simulations, most noticeably in single
+    precision builds. The compensation is indexed like the particle data, so it is reset whenever
+    the particles are reordered.
 */
 class PYBIND11_EXPORT TwoStepConstantVolume : public IntegrationMethodTwoStep
     {
@@ -31,9 +37,19 @@ class PYBIND11_EXPORT TwoStepConstantVolume : public IntegrationMethodTwoStep
                           std::shared_ptr<Thermostat> thermostat)
         : IntegrationMethodTwoStep(sysdef, group), m_thermostat(thermostat)
         {
+#ifdef HOOMD_COMPENSATED_INTEGRATION
+        m_pdata->getParticleSortSignal()
+            .connect<TwoStepConstantVolume, &TwoStepConstantVolume::slotParticleSort>(this);
+#endif
         }
 
-    virtual ~TwoStepConstantVolume() { }
+    virtual ~TwoStepConstantVolume()
+        {
+#ifdef HOOMD_COMPENSATED_INTEGRATION
+        m_pdata->getParticleSortSignal()
+            .disconnect<TwoStepConstantVolume, &TwoStepConstantVolume::slotParticleSort>(this);
+#endif
+        }
 
     /** Performs the first half-step of the integration.
 
@@ -106,6 +122,42 @@ class PYBIND11_EXPORT TwoStepConstantVolume : public IntegrationMethodTwoStep
 
     /// The distance limit to apply (may be null).
     std::shared_ptr<Variant> m_limit;
+
+#ifdef HOOMD_COMPENSATED_INTEGRATION
+    /// Rounding error of the last position update of each particle.
+    GPUArray<Scalar3> m_pos_compensation;
+
+    /// True when m_pos_compensation matches the current particle order.
+    bool m_compensation_valid = false;
+
+    /// Zero the compensation when the particles have been reordered or the arrays resized.
+    void validateCompensation()
+        {
+        if (m_compensation_valid && m_pos_compensation.getNumElements() >= m_pdata->getN())
+            {
+            return;
+            }
+
+        if (m_pos_compensation.getNumElements() < m_pdata->getN())
+            {
+            GPUArray<Scalar3> pos_compensation(m_pdata->getMaxN(), m_exec_conf);
+            m_pos_compensation.swap(pos_compensation);
+            }
+
+        ArrayHandle<Scalar3> h_pos_compensation(m_pos_compensation,
+                                                access_location::host,
+                                                access_mode::overwrite);
+        memset(h_pos_compensation.data, 0, sizeof(Scalar3) * m_pos_compensation.getNumElements());
+        m_compensation_valid = true;
+        }
+
+    private:
+    /// Invalidate the compensation when the particles are sorted, migrated, added, or removed.
+    void slotParticleSort()
+        {
+        m_compensation_valid = false;
+        }
+#endif
     };
 
     } // namespace hoomd::md
@@ -51,6 +51,9 @@ void TwoStepConstantVolumeGPU::integrateStepOne(uint64_t timestep)
         }
 
     unsigned int group_size = m_group->getNumMembers();
+#ifdef HOOMD_COMPENSATED_INTEGRATION
+    validateCompensation();
+#endif
     const auto&& rescalingFactors = m_thermostat
                                         ? m_thermostat->getRescalingFactorsOne(timestep, m_deltaT)
                                         : std::array<Scalar, 2> {1., 1.};
@@ -69,6 +72,15 @@ void TwoStepConstantVolumeGPU::integrateStepOne(uint64_t timestep)
                                   access_location::device,
                                   access_mode::readwrite);
 
+#ifdef HOOMD_COMPENSATED_INTEGRATION
+        ArrayHandle<Scalar3> d_pos_compensation(m_pos_compensation,
+                                                access_location::device,
+                                                access_mode::readwrite);
+        Scalar3* d_pos_compensation_data = d_pos_compensation.data;
+#else
+        Scalar3* d_pos_compensation_data = nullptr;
+#endif
+
         BoxDim box = m_pdata->getBox();
         ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
                                                 access_location::device,
@@ -84,6 +96,7 @@ void TwoStepConstantVolumeGPU::integrateStepOne(uint64_t timestep)
                                          d_vel.data,
                                          d_accel.data,
                                          d_image.data,
+                                         d_pos_compensation_data,
                                          d_index_array.data,
                                          group_size,
                                          box,
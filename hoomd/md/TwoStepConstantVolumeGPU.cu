@@ -20,6 +20,7 @@ namespace kernel
     \param d_vel array of particle velocities
     \param d_accel array of particle accelerations
     \param d_image array of particle images
+    \param d_pos_compensation Kahan compensation of the position update (may be NULL)
     \param d_group_members Device array listing the indices of the members of the group to integrate
     \param work_size Number of members in the group for this GPU
     \param box Box dimensions for periodic boundary condition handling
@@ -36,6 +37,7 @@ __global__ void gpu_nvt_rescale_step_one_kernel(Scalar4* d_pos,
                                                 Scalar4* d_vel,
                                                 const Scalar3* d_accel,
                                                 int3* d_image,
+                                                Scalar3* d_pos_compensation,
                                                 unsigned int* d_group_members,
                                                 unsigned int work_size,
                                                 BoxDim box,
@@ -73,7 +75,18 @@ __global__ void gpu_nvt_rescale_step_one_kernel(Scalar4* d_pos,
                 vel = vel * maximum_displacement / displacement * deltaT;
             }
 
-        pos += vel * deltaT;
+        if (d_pos_compensation)
+            {
+            // Kahan summation carries the rounding error of the update to the next step
+            Scalar3 dx = vel * deltaT - d_pos_compensation[idx];
+            Scalar3 new_pos = pos + dx;
+            d_pos_compensation[idx] = (new_pos - pos) - dx;
+            pos = new_pos;
+            }
+        else
+            {
+            pos += vel * deltaT;
+            }
 
         // read in the image flags
         int3 image = d_image[idx];
@@ -92,6 +105,7 @@ __global__ void gpu_nvt_rescale_step_one_kernel(Scalar4* d_pos,
     \param d_vel array of particle velocities
     \param d_accel array of particle accelerations
     \param d_image array of particle images
+    \param d_pos_compensation Kahan compensation of the position update (may be NULL)
     \param d_group_members Device array listing the indices of the members of the group to integrate
     \param group_size Number of members in the group
     \param box Box dimensions for periodic boundary condition handling
@@ -103,6 +117,7 @@ hipError_t gpu_nvt_rescale_step_one(Scalar4* d_pos,
                                     Scalar4* d_vel,
                                     const Scalar3* d_accel,
                                     int3* d_image,
+                                    Scalar3* d_pos_compensation,
                                     unsigned int* d_group_members,
                                     unsigned int group_size,
                                     const BoxDim& box,
@@ -141,6 +156,7 @@ hipError_t gpu_nvt_rescale_step_one(Scalar4* d_pos,
                            d_vel,
                            d_accel,
                            d_image,
+                           d_pos_compensation,
                            d_group_members,
                            nwork,
                            box,
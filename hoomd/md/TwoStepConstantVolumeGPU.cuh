@@ -19,6 +19,7 @@ hipError_t gpu_nvt_rescale_step_one(Scalar4* d_pos,
                                     Scalar4* d_vel,
                                     const Scalar3* d_accel,
                                     int3* d_image,
+                                    Scalar3* d_pos_compensation,
                                     unsigned int* d_group_members,
                                     unsigned int group_size,
                                     const BoxDim& box,
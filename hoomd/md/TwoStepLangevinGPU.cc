@@ -40,15 +40,18 @@ TwoStepLangevinGPU::TwoStepLangevinGPU(std::shared_ptr<SystemDefinition> sysdef,
     GPUArray<Scalar> partial_sum1(m_num_blocks, m_exec_conf);
     m_partial_sum1.swap(partial_sum1);
 
+    // only one of the step one kernels runs, so both tuners are optional
     m_tuner_one.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                        m_exec_conf,
-                                       "langevin_nve"));
-    m_tuner_angular_one.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
-                                               m_exec_conf,
-                                               "langevin_angular",
-                                               5,
-                                               true));
-    m_autotuners.insert(m_autotuners.end(), {m_tuner_one, m_tuner_angular_one});
+                                       "langevin_nve",
+                                       5,
+                                       true));
+    m_tuner_fused_one.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                             m_exec_conf,
+                                             "langevin_nve_angular",
+                                             5,
+                                             true));
+    m_autotuners.insert(m_autotuners.end(), {m_tuner_one, m_tuner_fused_one});
     }
 
 /*! \param timestep Current time step
@@ -56,10 +59,17 @@ TwoStepLangevinGPU::TwoStepLangevinGPU(std::shared_ptr<SystemDefinition> sysdef,
    velocity verlet method.
 
     This method is copied directly from TwoStepNVEGPU::integrateStepOne() and reimplemented here to
-   avoid multiple.
+   avoid multiple. Anisotropic integration updates the translational and angular degrees of freedom
+   in one kernel.
 */
 void TwoStepLangevinGPU::integrateStepOne(uint64_t timestep)
     {
+    if (m_aniso)
+        {
+        integrateStepOneFused();
+        return;
+        }
+
     // access all the needed data
     BoxDim box = m_pdata->getBox();
     ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
@@ -99,46 +109,69 @@ void TwoStepLangevinGPU::integrateStepOne(uint64_t timestep)
         CHECK_CUDA_ERROR();
     m_tuner_one->end();
     m_exec_conf->endMultiGPU();
+    }
 
-    if (m_aniso)
-        {
-        // first part of angular update
-        ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
-                                           access_location::device,
-                                           access_mode::readwrite);
-        ArrayHandle<Scalar4> d_angmom(m_pdata->getAngularMomentumArray(),
-                                      access_location::device,
-                                      access_mode::readwrite);
-        ArrayHandle<Scalar4> d_net_torque(m_pdata->getNetTorqueArray(),
-                                          access_location::device,
-                                          access_mode::read);
-        ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(),
-                                       access_location::device,
-                                       access_mode::read);
-
-        m_exec_conf->beginMultiGPU();
-        m_tuner_angular_one->begin();
+/*! Performs the translational and angular parts of integrateStepOne() in one kernel.
+ */
+void TwoStepLangevinGPU::integrateStepOneFused()
+    {
+    BoxDim box = m_pdata->getBox();
+    ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
+                                            access_location::device,
+                                            access_mode::read);
 
-        kernel::gpu_nve_angular_step_one(d_orientation.data,
-                                         d_angmom.data,
-                                         d_inertia.data,
-                                         d_net_torque.data,
-                                         d_index_array.data,
-                                         m_group->getGPUPartition(),
-                                         m_deltaT,
-                                         1.0,
-                                         m_tuner_angular_one->getParam()[0]);
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                               access_location::device,
+                               access_mode::readwrite);
+    ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                               access_location::device,
+                               access_mode::readwrite);
+    ArrayHandle<Scalar3> d_accel(m_pdata->getAccelerations(),
+                                 access_location::device,
+                                 access_mode::read);
+    ArrayHandle<int3> d_image(m_pdata->getImages(),
+                              access_location::device,
+                              access_mode::readwrite);
+    ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
+                                       access_location::device,
+                                       access_mode::readwrite);
+    ArrayHandle<Scalar4> d_angmom(m_pdata->getAngularMomentumArray(),
+                                  access_location::device,
+                                  access_mode::readwrite);
+    ArrayHandle<Scalar4> d_net_torque(m_pdata->getNetTorqueArray(),
+                                      access_location::device,
+                                      access_mode::read);
+    ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(),
+                                   access_location::device,
+                                   access_mode::read);
 
-        m_tuner_angular_one->end();
-        m_exec_conf->endMultiGPU();
+    m_exec_conf->beginMultiGPU();
+    m_tuner_fused_one->begin();
+    kernel::gpu_nve_translational_angular_step_one(d_pos.data,
+                                                   d_vel.data,
+                                                   d_accel.data,
+                                                   d_image.data,
+                                                   d_orientation.data,
+                                                   d_angmom.data,
+                                                   d_inertia.data,
+                                                   d_net_torque.data,
+                                                   d_index_array.data,
+                                                   m_group->getGPUPartition(),
+                                                   box,
+                                                   m_deltaT,
+                                                   1.0,
+                                                   m_tuner_fused_one->getParam()[0]);
 
-        if (m_exec_conf->isCUDAErrorCheckingEnabled())
-            CHECK_CUDA_ERROR();
-        }
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_fused_one->end();
+    m_exec_conf->endMultiGPU();
     }
 
 /*! \param timestep Current time step
     \post particle velocities are moved forward to timestep+1 on the GPU
+
+    Anisotropic integration updates the translational and angular degrees of freedom in one kernel.
 */
 void TwoStepLangevinGPU::integrateStepTwo(uint64_t timestep)
     {
@@ -190,23 +223,8 @@ void TwoStepLangevinGPU::integrateStepTwo(uint64_t timestep)
                                             m_tally,
                                             m_exec_conf->dev_prop);
 
-        kernel::gpu_langevin_step_two(d_pos.data,
-                                      d_vel.data,
-                                      d_accel.data,
-                                      d_tag.data,
-                                      d_index_array.data,
-                                      group_size,
-                                      d_net_force.data,
-                                      args,
-                                      m_deltaT,
-                                      D);
-
-        if (m_exec_conf->isCUDAErrorCheckingEnabled())
-            CHECK_CUDA_ERROR();
-
         if (m_aniso)
             {
-            // second part of angular update
             ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
                                                access_location::device,
                                                access_mode::read);
@@ -215,29 +233,44 @@ void TwoStepLangevinGPU::integrateStepTwo(uint64_t timestep)
                                           access_mode::readwrite);
             ArrayHandle<Scalar4> d_net_torque(m_pdata->getNetTorqueArray(),
                                               access_location::device,
-                                              access_mode::read);
+                                              access_mode::readwrite);
             ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(),
                                            access_location::device,
                                            access_mode::read);
 
-            unsigned int group_size = m_group->getNumMembers();
-            gpu_langevin_angular_step_two(d_pos.data,
-                                          d_orientation.data,
-                                          d_angmom.data,
-                                          d_inertia.data,
-                                          d_net_torque.data,
-                                          d_index_array.data,
-                                          d_gamma_r.data,
+            kernel::gpu_langevin_translational_angular_step_two(d_pos.data,
+                                                                d_vel.data,
+                                                                d_accel.data,
+                                                                d_tag.data,
+                                                                d_index_array.data,
+                                                                group_size,
+                                                                d_net_force.data,
+                                                                d_orientation.data,
+                                                                d_angmom.data,
+                                                                d_inertia.data,
+                                                                d_net_torque.data,
+                                                                d_gamma_r.data,
+                                                                args,
+                                                                m_deltaT,
+                                                                D,
+                                                                1.0);
+            }
+        else
+            {
+            kernel::gpu_langevin_step_two(d_pos.data,
+                                          d_vel.data,
+                                          d_accel.data,
                                           d_tag.data,
+                                          d_index_array.data,
                                           group_size,
+                                          d_net_force.data,
                                           args,
                                           m_deltaT,
-                                          D,
-                                          1.0);
-
-            if (m_exec_conf->isCUDAErrorCheckingEnabled())
-                CHECK_CUDA_ERROR();
+                                          D);
             }
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
         }
 
     if (m_tally)
@@ -23,6 +23,116 @@ namespace md
     {
 namespace kernel
     {
+//! NO_SQUISH angular part of the second half step of one particle
+/*! See gpu_langevin_angular_step_two_kernel() for the parameters.
+ */
+__device__ inline void langevin_angular_step_two_particle(unsigned int idx,
+                                                          unsigned int ptag,
+                                                          Scalar3 gamma_r,
+                                                          Scalar4* d_orientation,
+                                                          Scalar4* d_angmom,
+                                                          const Scalar3* d_inertia,
+                                                          Scalar4* d_net_torque,
+                                                          uint64_t timestep,
+                                                          uint16_t seed,
+                                                          Scalar T,
+                                                          bool noiseless_r,
+                                                          Scalar deltaT,
+                                                          unsigned int D,
+                                                          Scalar scale)
+    {
+    if (gamma_r.x > 0 || gamma_r.y > 0 || gamma_r.z > 0)
+        {
+        quat<Scalar> q(d_orientation[idx]);
+        quat<Scalar> p(d_angmom[idx]);
+        vec3<Scalar> t(d_net_torque[idx]);
+        vec3<Scalar> I(d_inertia[idx]);
+
+        vec3<Scalar> s;
+        s = (Scalar(1. / 2.) * conj(q) * p).v;
+
+        // first calculate in the body frame random and damping torque imposed by the dynamics
+        vec3<Scalar> bf_torque;
+
+        // original Gaussian random torque
+        // for future reference: if gamma_r is different for xyz, then we need to generate 3
+        // sigma_r
+        Scalar3 sigma_r = make_scalar3(fast::sqrt(Scalar(2.0) * gamma_r.x * T / deltaT),
+                                       fast::sqrt(Scalar(2.0) * gamma_r.y * T / deltaT),
+                                       fast::sqrt(Scalar(2.0) * gamma_r.z * T / deltaT));
+        if (noiseless_r)
+            sigma_r = make_scalar3(0, 0, 0);
+
+        RandomGenerator rng(hoomd::Seed(RNGIdentifier::TwoStepLangevinAngular, timestep, seed),
+                            hoomd::Counter(ptag));
+        Scalar rand_x = NormalDistribution<Scalar>(sigma_r.x)(rng);
+        Scalar rand_y = NormalDistribution<Scalar>(sigma_r.y)(rng);
+        Scalar rand_z = NormalDistribution<Scalar>(sigma_r.z)(rng);
+
+        // check for zero moment of inertia
+        bool x_zero, y_zero, z_zero;
+        x_zero = (I.x == 0);
+        y_zero = (I.y == 0);
+        z_zero = (I.z == 0);
+
+        bf_torque.x = rand_x - gamma_r.x * (s.x / I.x);
+        bf_torque.y = rand_y - gamma_r.y * (s.y / I.y);
+        bf_torque.z = rand_z - gamma_r.z * (s.z / I.z);
+
+        // ignore torque component along an axis for which the moment of inertia zero
+        if (x_zero)
+            bf_torque.x = 0;
+        if (y_zero)
+            bf_torque.y = 0;
+        if (z_zero)
+            bf_torque.z = 0;
+
+        // change to lab frame and update the net torque
+        bf_torque = rotate(q, bf_torque);
+        d_net_torque[idx].x += bf_torque.x;
+        d_net_torque[idx].y += bf_torque.y;
+        d_net_torque[idx].z += bf_torque.z;
+
+        // with the wishful mind that compiler may use conditional move to avoid branching
+        if (D < 3)
+            d_net_torque[idx].x = 0;
+        if (D < 3)
+            d_net_torque[idx].y = 0;
+        }
+
+    //////////////////////////////
+    // read the particle's orientation, conjugate quaternion, moment of inertia and net torque
+    quat<Scalar> q(d_orientation[idx]);
+    quat<Scalar> p(d_angmom[idx]);
+    vec3<Scalar> t(d_net_torque[idx]);
+    vec3<Scalar> I(d_inertia[idx]);
+
+    // rotate torque into principal frame
+    t = rotate(conj(q), t);
+
+    // check for zero moment of inertia
+    bool x_zero, y_zero, z_zero;
+    x_zero = (I.x == 0);
+    y_zero = (I.y == 0);
+    z_zero = (I.z == 0);
+
+    // ignore torque component along an axis for which the moment of inertia zero
+    if (x_zero)
+        t.x = Scalar(0.0);
+    if (y_zero)
+        t.y = Scalar(0.0);
+    if (z_zero)
+        t.z = Scalar(0.0);
+
+    // rescale
+    p = p * scale;
+
+    // advance p(t)->p(t+deltaT/2), q(t)->q(t+deltaT)
+    p += deltaT * q * t;
+
+    d_angmom[idx] = quat_to_scalar4(p);
+    }
+
 //! Takes the second half-step forward in the Langevin integration on a group of particles with
 /*! \param d_pos array of particle positions and types
     \param d_vel array of particle positions and masses
@@ -47,7 +157,12 @@ namespace kernel
     This kernel will tally the energy transfer from the bd thermal reservoir and the particle system
 
     This kernel must be launched with enough dynamic shared memory per block to read in d_gamma
+
+    When \a aniso is true, the kernel also performs the angular part of the second half step
+    (see gpu_langevin_angular_step_two_kernel()) and must be launched with enough dynamic shared
+    memory to read in d_gamma_r after d_gamma.
 */
+template<bool aniso>
 __global__ void gpu_langevin_step_two_kernel(const Scalar4* d_pos,
                                              Scalar4* d_vel,
                                              Scalar3* d_accel,
@@ -65,10 +180,18 @@ __global__ void gpu_langevin_step_two_kernel(const Scalar4* d_pos,
                                              unsigned int D,
                                              bool tally,
                                              Scalar* d_partial_sum_bdenergy,
-                                             bool enable_shared_cache)
+                                             bool enable_shared_cache,
+                                             Scalar4* d_orientation,
+                                             Scalar4* d_angmom,
+                                             const Scalar3* d_inertia,
+                                             Scalar4* d_net_torque,
+                                             const Scalar3* d_gamma_r,
+                                             bool noiseless_r,
+                                             Scalar scale)
     {
     HIP_DYNAMIC_SHARED(char, s_data)
     Scalar* s_gammas = (Scalar*)s_data;
+    Scalar3* s_gammas_r = (Scalar3*)(s_gammas + n_types);
 
     if (enable_shared_cache)
         {
@@ -76,7 +199,11 @@ __global__ void gpu_langevin_step_two_kernel(const Scalar4* d_pos,
         for (int cur_offset = 0; cur_offset < n_types; cur_offset += blockDim.x)
             {
             if (cur_offset + threadIdx.x < n_types)
+                {
                 s_gammas[cur_offset + threadIdx.x] = d_gamma[cur_offset + threadIdx.x];
+                if (aniso)
+                    s_gammas_r[cur_offset + threadIdx.x] = d_gamma_r[cur_offset + threadIdx.x];
+                }
             }
         __syncthreads();
         }
@@ -153,6 +280,25 @@ __global__ void gpu_langevin_step_two_kernel(const Scalar4* d_pos,
         d_vel[idx] = vel;
         // since we calculate the acceleration, we need to write it for the next step
         d_accel[idx] = accel;
+
+        if (aniso)
+            {
+            Scalar3 gamma_r = enable_shared_cache ? s_gammas_r[typ] : d_gamma_r[typ];
+            langevin_angular_step_two_particle(idx,
+                                               ptag,
+                                               gamma_r,
+                                               d_orientation,
+                                               d_angmom,
+                                               d_inertia,
+                                               d_net_torque,
+                                               timestep,
+                                               seed,
+                                               T,
+                                               noiseless_r,
+                                               deltaT,
+                                               D,
+                                               scale);
+            }
         }
 
     Scalar* bdtally_sdata = (Scalar*)&s_data[0];
@@ -294,96 +440,20 @@ __global__ void gpu_langevin_angular_step_two_kernel(const Scalar4* d_pos,
             gamma_r = d_gamma_r[type_r];
             }
 
-        if (gamma_r.x > 0 || gamma_r.y > 0 || gamma_r.z > 0)
-            {
-            quat<Scalar> q(d_orientation[idx]);
-            quat<Scalar> p(d_angmom[idx]);
-            vec3<Scalar> t(d_net_torque[idx]);
-            vec3<Scalar> I(d_inertia[idx]);
-
-            vec3<Scalar> s;
-            s = (Scalar(1. / 2.) * conj(q) * p).v;
-
-            // first calculate in the body frame random and damping torque imposed by the dynamics
-            vec3<Scalar> bf_torque;
-
-            // original Gaussian random torque
-            // for future reference: if gamma_r is different for xyz, then we need to generate 3
-            // sigma_r
-            Scalar3 sigma_r = make_scalar3(fast::sqrt(Scalar(2.0) * gamma_r.x * T / deltaT),
-                                           fast::sqrt(Scalar(2.0) * gamma_r.y * T / deltaT),
-                                           fast::sqrt(Scalar(2.0) * gamma_r.z * T / deltaT));
-            if (noiseless_r)
-                sigma_r = make_scalar3(0, 0, 0);
-
-            RandomGenerator rng(hoomd::Seed(RNGIdentifier::TwoStepLangevinAngular, timestep, seed),
-                                hoomd::Counter(ptag));
-            Scalar rand_x = NormalDistribution<Scalar>(sigma_r.x)(rng);
-            Scalar rand_y = NormalDistribution<Scalar>(sigma_r.y)(rng);
-            Scalar rand_z = NormalDistribution<Scalar>(sigma_r.z)(rng);
-
-            // check for zero moment of inertia
-            bool x_zero, y_zero, z_zero;
-            x_zero = (I.x == 0);
-            y_zero = (I.y == 0);
-            z_zero = (I.z == 0);
-
-            bf_torque.x = rand_x - gamma_r.x * (s.x / I.x);
-            bf_torque.y = rand_y - gamma_r.y * (s.y / I.y);
-            bf_torque.z = rand_z - gamma_r.z * (s.z / I.z);
-
-            // ignore torque component along an axis for which the moment of inertia zero
-            if (x_zero)
-                bf_torque.x = 0;
-            if (y_zero)
-                bf_torque.y = 0;
-            if (z_zero)
-                bf_torque.z = 0;
-
-            // change to lab frame and update the net torque
-            bf_torque = rotate(q, bf_torque);
-            d_net_torque[idx].x += bf_torque.x;
-            d_net_torque[idx].y += bf_torque.y;
-            d_net_torque[idx].z += bf_torque.z;
-
-            // with the wishful mind that compiler may use conditional move to avoid branching
-            if (D < 3)
-                d_net_torque[idx].x = 0;
-            if (D < 3)
-                d_net_torque[idx].y = 0;
-            }
-
-        //////////////////////////////
-        // read the particle's orientation, conjugate quaternion, moment of inertia and net torque
-        quat<Scalar> q(d_orientation[idx]);
-        quat<Scalar> p(d_angmom[idx]);
-        vec3<Scalar> t(d_net_torque[idx]);
-        vec3<Scalar> I(d_inertia[idx]);
-
-        // rotate torque into principal frame
-        t = rotate(conj(q), t);
-
-        // check for zero moment of inertia
-        bool x_zero, y_zero, z_zero;
-        x_zero = (I.x == 0);
-        y_zero = (I.y == 0);
-        z_zero = (I.z == 0);
-
-        // ignore torque component along an axis for which the moment of inertia zero
-        if (x_zero)
-            t.x = Scalar(0.0);
-        if (y_zero)
-            t.y = Scalar(0.0);
-        if (z_zero)
-            t.z = Scalar(0.0);
-
-        // rescale
-        p = p * scale;
-
-        // advance p(t)->p(t+deltaT/2), q(t)->q(t+deltaT)
-        p += deltaT * q * t;
-
-        d_angmom[idx] = quat_to_scalar4(p);
+        langevin_angular_step_two_particle(idx,
+                                           ptag,
+                                           gamma_r,
+                                           d_orientation,
+                                           d_angmom,
+                                           d_inertia,
+                                           d_net_torque,
+                                           timestep,
+                                           seed,
+                                           T,
+                                           noiseless_r,
+                                           deltaT,
+                                           D,
+                                           scale);
         }
     }
 
@@ -460,29 +530,27 @@ hipError_t gpu_langevin_angular_step_two(const Scalar4* d_pos,
     return hipSuccess;
     }
 
-/*! \param d_pos array of particle positions and types
-    \param d_vel array of particle positions and masses
-    \param d_accel array of particle accelerations
-    \param d_tag array of particle tags
-    \param d_group_members Device array listing the indices of the members of the group to integrate
-    \param group_size Number of members in the group
-    \param d_net_force Net force on each particle
-    \param langevin_args Collected arguments for gpu_langevin_step_two_kernel() and
-   gpu_langevin_angular_step_two() \param deltaT Amount of real time to step forward in one time
-   step \param D Dimensionality of the system
-
-    This is just a driver for gpu_langevin_step_two_kernel(), see it for details.
+//! Launch gpu_langevin_step_two_kernel() and reduce the energy tally
+/*! See gpu_langevin_step_two() and gpu_langevin_translational_angular_step_two() for the
+    parameters.
 */
-hipError_t gpu_langevin_step_two(const Scalar4* d_pos,
-                                 Scalar4* d_vel,
-                                 Scalar3* d_accel,
-                                 const unsigned int* d_tag,
-                                 unsigned int* d_group_members,
-                                 unsigned int group_size,
-                                 Scalar4* d_net_force,
-                                 const langevin_step_two_args& langevin_args,
-                                 Scalar deltaT,
-                                 unsigned int D)
+template<bool aniso>
+static void launch_langevin_step_two(const Scalar4* d_pos,
+                                     Scalar4* d_vel,
+                                     Scalar3* d_accel,
+                                     const unsigned int* d_tag,
+                                     unsigned int* d_group_members,
+                                     unsigned int group_size,
+                                     Scalar4* d_net_force,
+                                     const langevin_step_two_args& langevin_args,
+                                     Scalar deltaT,
+                                     unsigned int D,
+                                     Scalar4* d_orientation,
+                                     Scalar4* d_angmom,
+                                     const Scalar3* d_inertia,
+                                     Scalar4* d_net_torque,
+                                     const Scalar3* d_gamma_r,
+                                     Scalar scale)
     {
     // setup the grid to run the kernel
     dim3 grid(langevin_args.num_blocks, 1, 1);
@@ -490,19 +558,21 @@ hipError_t gpu_langevin_step_two(const Scalar4* d_pos,
     dim3 threads(langevin_args.block_size, 1, 1);
     dim3 threads1(256, 1, 1);
 
-    auto shared_bytes = max((sizeof(Scalar) * langevin_args.n_types),
-                            (langevin_args.block_size * sizeof(Scalar)));
+    size_t gamma_bytes = sizeof(Scalar) * langevin_args.n_types;
+    if (aniso)
+        gamma_bytes += sizeof(Scalar3) * langevin_args.n_types;
+    auto shared_bytes = max(gamma_bytes, (langevin_args.block_size * sizeof(Scalar)));
 
     bool enable_shared_cache = true;
 
     if (shared_bytes > langevin_args.devprop.sharedMemPerBlock)
         {
         enable_shared_cache = false;
-        shared_bytes = 0;
+        shared_bytes = langevin_args.tally ? langevin_args.block_size * sizeof(Scalar) : 0;
         }
 
     // run the kernel
-    hipLaunchKernelGGL((gpu_langevin_step_two_kernel),
+    hipLaunchKernelGGL((gpu_langevin_step_two_kernel<aniso>),
                        grid,
                        threads,
                        shared_bytes,
@@ -524,7 +594,14 @@ hipError_t gpu_langevin_step_two(const Scalar4* d_pos,
                        D,
                        langevin_args.tally,
                        langevin_args.d_partial_sum_bdenergy,
-                       enable_shared_cache);
+                       enable_shared_cache,
+                       d_orientation,
+                       d_angmom,
+                       d_inertia,
+                       d_net_torque,
+                       d_gamma_r,
+                       langevin_args.noiseless_r,
+                       scale);
 
     // run the summation kernel
     if (langevin_args.tally)
@@ -536,7 +613,89 @@ hipError_t gpu_langevin_step_two(const Scalar4* d_pos,
                            &langevin_args.d_sum_bdenergy[0],
                            langevin_args.d_partial_sum_bdenergy,
                            langevin_args.num_blocks);
+    }
 
+/*! \param d_pos array of particle positions and types
+    \param d_vel array of particle positions and masses
+    \param d_accel array of particle accelerations
+    \param d_tag array of particle tags
+    \param d_group_members Device array listing the indices of the members of the group to integrate
+    \param group_size Number of members in the group
+    \param d_net_force Net force on each particle
+    \param langevin_args Collected arguments for gpu_langevin_step_two_kernel() and
+   gpu_langevin_angular_step_two() \param deltaT Amount of real time to step forward in one time
+   step \param D Dimensionality of the system
+
+    This is just a driver for gpu_langevin_step_two_kernel(), see it for details.
+*/
+hipError_t gpu_langevin_step_two(const Scalar4* d_pos,
+                                 Scalar4* d_vel,
+                                 Scalar3* d_accel,
+                                 const unsigned int* d_tag,
+                                 unsigned int* d_group_members,
+                                 unsigned int group_size,
+                                 Scalar4* d_net_force,
+                                 const langevin_step_two_args& langevin_args,
+                                 Scalar deltaT,
+                                 unsigned int D)
+    {
+    launch_langevin_step_two<false>(d_pos,
+                                    d_vel,
+                                    d_accel,
+                                    d_tag,
+                                    d_group_members,
+                                    group_size,
+                                    d_net_force,
+                                    langevin_args,
+                                    deltaT,
+                                    D,
+                                    nullptr,
+                                    nullptr,
+                                    nullptr,
+                                    nullptr,
+                                    nullptr,
+                                    Scalar(1.0));
+    return hipSuccess;
+    }
+
+/*! See gpu_langevin_step_two() and gpu_langevin_angular_step_two() for the parameters.
+
+    This driver performs the translational and angular parts of the second half step in one
+    kernel.
+*/
+hipError_t gpu_langevin_translational_angular_step_two(const Scalar4* d_pos,
+                                                       Scalar4* d_vel,
+                                                       Scalar3* d_accel,
+                                                       const unsigned int* d_tag,
+                                                       unsigned int* d_group_members,
+                                                       unsigned int group_size,
+                                                       Scalar4* d_net_force,
+                                                       Scalar4* d_orientation,
+                                                       Scalar4* d_angmom,
+                                                       const Scalar3* d_inertia,
+                                                       Scalar4* d_net_torque,
+                                                       const Scalar3* d_gamma_r,
+                                                       const langevin_step_two_args& langevin_args,
+                                                       Scalar deltaT,
+                                                       unsigned int D,
+                                                       Scalar scale)
+    {
+    launch_langevin_step_two<true>(d_pos,
+                                   d_vel,
+                                   d_accel,
+                                   d_tag,
+                                   d_group_members,
+                                   group_size,
+                                   d_net_force,
+                                   langevin_args,
+                                   deltaT,
+                                   D,
+                                   d_orientation,
+                                   d_angmom,
+                                   d_inertia,
+                                   d_net_torque,
+                                   d_gamma_r,
+                                   scale);
     return hipSuccess;
     }
 
@@ -84,6 +84,25 @@ hipError_t gpu_langevin_angular_step_two(const Scalar4* d_pos,
                                          unsigned int D,
                                          Scalar scale);
 
+//! Kernel driver for the second part of the translational and angular Langevin update in one
+//! kernel
+hipError_t gpu_langevin_translational_angular_step_two(const Scalar4* d_pos,
+                                                       Scalar4* d_vel,
+                                                       Scalar3* d_accel,
+                                                       const unsigned int* d_tag,
+                                                       unsigned int* d_group_members,
+                                                       unsigned int group_size,
+                                                       Scalar4* d_net_force,
+                                                       Scalar4* d_orientation,
+                                                       Scalar4* d_angmom,
+                                                       const Scalar3* d_inertia,
+                                                       Scalar4* d_net_torque,
+                                                       const Scalar3* d_gamma_r,
+                                                       const langevin_step_two_args& langevin_args,
+                                                       Scalar deltaT,
+                                                       unsigned int D,
+                                                       Scalar scale);
+
     } // end namespace kernel
     } // end namespace md
     } // end namespace hoomd
@@ -37,6 +37,9 @@ class PYBIND11_EXPORT TwoStepLangevinGPU : public TwoStepLangevin
     virtual void integrateStepTwo(uint64_t timestep);
 
     protected:
+    //! Performs the first step of anisotropic integration in a single kernel
+    void integrateStepOneFused();
+
     unsigned int m_block_size;       //!< block size for partial sum memory
     unsigned int m_num_blocks;       //!< number of memory blocks reserved for partial sum memory
     GPUArray<Scalar> m_partial_sum1; //!< memory space for partial sum over bd energy transfers
@@ -45,8 +48,8 @@ class PYBIND11_EXPORT TwoStepLangevinGPU : public TwoStepLangevin
     /// Autotuner for block size (step one kernel)
     std::shared_ptr<Autotuner<1>> m_tuner_one;
 
-    /// Autotuner for block size (angular step one kernel).
-    std::shared_ptr<Autotuner<1>> m_tuner_angular_one;
+    /// Autotuner for block size (translational and angular step one kernel).
+    std::shared_ptr<Autotuner<1>> m_tuner_fused_one;
     };
 
     } // end namespace md
@@ -55,6 +55,22 @@ hipError_t gpu_nve_angular_step_one(Scalar4* d_orientation,
                                     Scalar scale,
                                     const unsigned int block_size);
 
+//! Kernel driver for the first part of the translational and angular NVE update in one kernel
+hipError_t gpu_nve_translational_angular_step_one(Scalar4* d_pos,
+                                                  Scalar4* d_vel,
+                                                  const Scalar3* d_accel,
+                                                  int3* d_image,
+                                                  Scalar4* d_orientation,
+                                                  Scalar4* d_angmom,
+                                                  const Scalar3* d_inertia,
+                                                  const Scalar4* d_net_torque,
+                                                  unsigned int* d_group_members,
+                                                  const GPUPartition& gpu_partition,
+                                                  const BoxDim& box,
+                                                  Scalar deltaT,
+                                                  Scalar scale,
+                                                  unsigned int block_size);
+
 //! Kernel driver for the second part of the angular NVE update (NO_SQUISH) by TwoStepNVEPU
 hipError_t gpu_nve_angular_step_two(const Scalar4* d_orientation,
                                     Scalar4* d_angmom,
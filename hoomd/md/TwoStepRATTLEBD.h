@@ -92,6 +92,14 @@ template<class Manifold> class PYBIND11_EXPORT TwoStepRATTLEBD : public TwoStepL
     Scalar m_tolerance; //!< The tolerance value of the RATTLE algorithm, setting the tolerance to
                         //!< the manifold
     bool m_box_changed;
+    GlobalArray<Scalar2> m_multipliers; //!< Last RATTLE multiplier (x) and tag (y) per index
+
+    //! Grow the multiplier storage with the particle data arrays
+    void checkMultiplierSize()
+        {
+        if (m_multipliers.getNumElements() < m_pdata->getMaxN())
+            m_multipliers.resize(m_pdata->getMaxN());
+        }
     };
 
 /*! \file TwoStepRATTLEBD.h
@@ -127,6 +135,9 @@ TwoStepRATTLEBD<Manifold>::TwoStepRATTLEBD(std::shared_ptr<SystemDefinition> sys
         {
         throw std::runtime_error("Parts of the manifold are outside the box");
         }
+
+    GlobalArray<Scalar2> multipliers(m_pdata->getMaxN(), m_exec_conf);
+    m_multipliers.swap(multipliers);
     }
 
 template<class Manifold> TwoStepRATTLEBD<Manifold>::~TwoStepRATTLEBD()
@@ -390,6 +401,8 @@ template<class Manifold> void TwoStepRATTLEBD<Manifold>::integrateStepTwo(uint64
 
 template<class Manifold> void TwoStepRATTLEBD<Manifold>::includeRATTLEForce(uint64_t timestep)
     {
+    checkMultiplierSize();
+
     unsigned int group_size = m_group->getNumMembers();
 
     const Scalar currentTemp = m_T->operator()(timestep);
@@ -403,6 +416,10 @@ template<class Manifold> void TwoStepRATTLEBD<Manifold>::includeRATTLEForce(uint
     ArrayHandle<Scalar> h_net_virial(net_virial, access_location::host, access_mode::readwrite);
     ArrayHandle<Scalar> h_gamma(m_gamma, access_location::host, access_mode::read);
 
+    ArrayHandle<Scalar2> h_multipliers(m_multipliers,
+                                       access_location::host,
+                                       access_mode::readwrite);
+
     size_t net_virial_pitch = net_virial.getPitch();
 
     uint16_t seed = m_sysdef->getSeed();
@@ -425,12 +442,8 @@ template<class Manifold> void TwoStepRATTLEBD<Manifold>::includeRATTLEForce(uint
         gamma = h_gamma.data[type];
         Scalar deltaT_gamma = m_deltaT / gamma;
 
-        Scalar3 next_pos;
-        next_pos.x = h_pos.data[j].x;
-        next_pos.y = h_pos.data[j].y;
-        next_pos.z = h_pos.data[j].z;
-
-        Scalar3 normal = m_manifold.derivative(next_pos);
+        Scalar3 pos = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+        Scalar3 normal = m_manifold.derivative(pos);
         Scalar norm_normal = fast::rsqrt(dot(normal, normal));
 
         normal.x *= norm_normal;
@@ -471,38 +484,24 @@ template<class Manifold> void TwoStepRATTLEBD<Manifold>::includeRATTLEForce(uint
         Scalar Fr_y = ry * coeff;
         Scalar Fr_z = rz * coeff;
 
-        // update position
-        Scalar mu = 0.0;
-
-        Scalar inv_alpha = -Scalar(1.0) / deltaT_gamma;
-
-        Scalar3 residual;
-        Scalar resid;
-
-        unsigned int iteration = 0;
-        do
-            {
-            iteration++;
-            residual.x = h_pos.data[j].x - next_pos.x
-                         + (h_net_force.data[j].x + Fr_x - mu * normal.x) * deltaT_gamma;
-            residual.y = h_pos.data[j].y - next_pos.y
-                         + (h_net_force.data[j].y + Fr_y - mu * normal.y) * deltaT_gamma;
-            residual.z = h_pos.data[j].z - next_pos.z
-                         + (h_net_force.data[j].z + Fr_z - mu * normal.z) * deltaT_gamma;
-            resid = m_manifold.implicitFunction(next_pos);
-
-            Scalar3 next_normal = m_manifold.derivative(next_pos);
-
-            Scalar nndotr = dot(next_normal, residual);
-            Scalar nndotn = dot(next_normal, normal);
-            Scalar beta = (resid + nndotr) / nndotn;
-
-            next_pos.x = next_pos.x - beta * normal.x + residual.x;
-            next_pos.y = next_pos.y - beta * normal.y + residual.y;
-            next_pos.z = next_pos.z - beta * normal.z + residual.z;
-            mu = mu - beta * inv_alpha;
-
-            } while (maxNorm(residual, resid) > m_tolerance && iteration < maxiteration);
+        // r(t+deltaT) = r(t) + (Fc(t) + Fr - mu*n_manifold(r(t)))*deltaT/gamma lies on the manifold
+        Scalar3 unconstrained_pos;
+        unconstrained_pos.x = h_pos.data[j].x + (h_net_force.data[j].x + Fr_x) * deltaT_gamma;
+        unconstrained_pos.y = h_pos.data[j].y + (h_net_force.data[j].y + Fr_y) * deltaT_gamma;
+        unconstrained_pos.z = h_pos.data[j].z + (h_net_force.data[j].z + Fr_z) * deltaT_gamma;
+
+        // warm start from the multiplier this particle needed on the previous step
+        Scalar2 last_multiplier = h_multipliers.data[j];
+        Scalar mu = ((unsigned int)__scalar_as_int(last_multiplier.y) == ptag) ? last_multiplier.x
+                                                                              : Scalar(0.0);
+        unsigned int iteration = computeRATTLEMultiplier(m_manifold,
+                                                         unconstrained_pos,
+                                                         normal,
+                                                         deltaT_gamma,
+                                                         m_tolerance,
+                                                         maxiteration,
+                                                         mu);
+        h_multipliers.data[j] = make_scalar2(mu, __int_as_scalar(ptag));
 
         if (iteration == maxiteration)
             {
@@ -22,6 +22,8 @@
 #include "hoomd/RNGIdentifiers.h"
 #include "hoomd/RandomNumbers.h"
 
+#include "RATTLEMultiplier.h"
+
 #include <assert.h>
 #include <type_traits>
 
@@ -86,6 +88,7 @@ hipError_t gpu_include_rattle_force_bd(const Scalar4* d_pos,
                                        Scalar4* d_net_force,
                                        Scalar* d_net_virial,
                                        const unsigned int* d_tag,
+                                       Scalar2* d_multipliers,
                                        const unsigned int* d_group_members,
                                        const unsigned int group_size,
                                        const rattle_bd_step_one_args& rattle_bd_args,
@@ -431,6 +434,7 @@ __global__ void gpu_include_rattle_force_bd_kernel(const Scalar4* d_pos,
                                                    Scalar4* d_net_force,
                                                    Scalar* d_net_virial,
                                                    const unsigned int* d_tag,
+                                                   Scalar2* d_multipliers,
                                                    const unsigned int* d_group_members,
                                                    const unsigned int nwork,
                                                    const Scalar* d_gamma,
@@ -537,46 +541,26 @@ __global__ void gpu_include_rattle_force_bd_kernel(const Scalar4* d_pos,
         brownian_force.y = ry * coeff;
         brownian_force.z = rz * coeff;
 
-        // update position
-
-        Scalar mu = 0;
+        // r(t+deltaT) = r(t) + (Fc(t) + Fr - mu*n_manifold(r(t)))*deltaT/gamma lies on the
+        // manifold, warm started from the multiplier of the previous step
+        Scalar3 unconstrained_pos;
+        unconstrained_pos.x = postype.x + (net_force.x + brownian_force.x) * deltaT_gamma;
+        unconstrained_pos.y = postype.y + (net_force.y + brownian_force.y) * deltaT_gamma;
+        unconstrained_pos.z = postype.z + (net_force.z + brownian_force.z) * deltaT_gamma;
 
-        Scalar inv_alpha = -deltaT_gamma;
-        inv_alpha = Scalar(1.0) / inv_alpha;
+        Scalar2 last_multiplier = d_multipliers[idx];
+        Scalar mu = ((unsigned int)__scalar_as_int(last_multiplier.y) == tag) ? last_multiplier.x
+                                                                             : Scalar(0.0);
 
-        Scalar3 residual;
-        Scalar resid;
-        unsigned int iteration = 0;
         const unsigned int maxiteration = 10;
-
-        do
-            {
-            iteration++;
-            residual.x = postype.x - next_pos.x
-                         + (net_force.x + brownian_force.x - mu * normal.x) * deltaT_gamma;
-            residual.y = postype.y - next_pos.y
-                         + (net_force.y + brownian_force.y - mu * normal.y) * deltaT_gamma;
-            residual.z = postype.z - next_pos.z
-                         + (net_force.z + brownian_force.z - mu * normal.z) * deltaT_gamma;
-            resid = manifold.implicitFunction(next_pos);
-
-            Scalar3 next_normal = manifold.derivative(next_pos);
-
-            Scalar nndotr = dot(next_normal, residual);
-            Scalar nndotn = dot(next_normal, normal);
-            Scalar beta = (resid + nndotr) / nndotn;
-
-            next_pos.x = next_pos.x - beta * normal.x + residual.x;
-            next_pos.y = next_pos.y - beta * normal.y + residual.y;
-            next_pos.z = next_pos.z - beta * normal.z + residual.z;
-            mu = mu - beta * inv_alpha;
-
-            resid = fabs(resid);
-            Scalar vec_norm = sqrt(dot(residual, residual));
-            if (vec_norm > resid)
-                resid = vec_norm;
-
-            } while (resid > tolerance && iteration < maxiteration);
+        computeRATTLEMultiplier(manifold,
+                                unconstrained_pos,
+                                normal,
+                                deltaT_gamma,
+                                tolerance,
+                                maxiteration,
+                                mu);
+        d_multipliers[idx] = make_scalar2(mu, __int_as_scalar(tag));
 
         net_force.x -= mu * normal.x;
         net_force.y -= mu * normal.y;
@@ -604,6 +588,7 @@ hipError_t gpu_include_rattle_force_bd(const Scalar4* d_pos,
                                        Scalar4* d_net_force,
                                        Scalar* d_net_virial,
                                        const unsigned int* d_tag,
+                                       Scalar2* d_multipliers,
                                        const unsigned int* d_group_members,
                                        const unsigned int group_size,
                                        const rattle_bd_step_one_args& rattle_bd_args,
@@ -645,6 +630,7 @@ hipError_t gpu_include_rattle_force_bd(const Scalar4* d_pos,
                            d_net_force,
                            d_net_virial,
                            d_tag,
+                           d_multipliers,
                            d_group_members,
                            nwork,
                            rattle_bd_args.d_gamma,
@@ -193,6 +193,8 @@ template<class Manifold> void TwoStepRATTLEBDGPU<Manifold>::integrateStepOne(uin
 */
 template<class Manifold> void TwoStepRATTLEBDGPU<Manifold>::includeRATTLEForce(uint64_t timestep)
     {
+    this->checkMultiplierSize();
+
     // access all the needed data
     ArrayHandle<unsigned int> d_index_array(this->m_group->getIndexArray(),
                                             access_location::device,
@@ -210,6 +212,9 @@ template<class Manifold> void TwoStepRATTLEBDGPU<Manifold>::includeRATTLEForce(u
     ArrayHandle<unsigned int> d_tag(this->m_pdata->getTags(),
                                     access_location::device,
                                     access_mode::read);
+    ArrayHandle<Scalar2> d_multipliers(this->m_multipliers,
+                                       access_location::device,
+                                       access_mode::readwrite);
 
     size_t net_virial_pitch = net_virial.getPitch();
 
@@ -244,6 +249,7 @@ template<class Manifold> void TwoStepRATTLEBDGPU<Manifold>::includeRATTLEForce(u
                                                   d_net_force.data,
                                                   d_net_virial.data,
                                                   d_tag.data,
+                                                  d_multipliers.data,
                                                   d_index_array.data,
                                                   group_size,
                                                   args,
@@ -332,6 +332,8 @@ void TwoStepRATTLELangevinGPU<Manifold>::integrateStepTwo(uint64_t timestep)
 template<class Manifold>
 void TwoStepRATTLELangevinGPU<Manifold>::includeRATTLEForce(uint64_t timestep)
     {
+    this->checkMultiplierSize();
+
     // access all the needed data
     const GlobalArray<Scalar4>& net_force = this->m_pdata->getNetForce();
     const GlobalArray<Scalar>& net_virial = this->m_pdata->getNetVirial();
@@ -351,6 +353,12 @@ void TwoStepRATTLELangevinGPU<Manifold>::includeRATTLEForce(uint64_t timestep)
     ArrayHandle<unsigned int> d_index_array(this->m_group->getIndexArray(),
                                             access_location::device,
                                             access_mode::read);
+    ArrayHandle<unsigned int> d_tag(this->m_pdata->getTags(),
+                                    access_location::device,
+                                    access_mode::read);
+    ArrayHandle<Scalar2> d_multipliers(this->m_multipliers,
+                                       access_location::device,
+                                       access_mode::readwrite);
 
     size_t net_virial_pitch = net_virial.getPitch();
 
@@ -362,6 +370,8 @@ void TwoStepRATTLELangevinGPU<Manifold>::includeRATTLEForce(uint64_t timestep)
                                                    d_accel.data,
                                                    d_net_force.data,
                                                    d_net_virial.data,
+                                                   d_tag.data,
+                                                   d_multipliers.data,
                                                    d_index_array.data,
                                                    this->m_group->getGPUPartition(),
                                                    net_virial_pitch,
@@ -2,6 +2,7 @@
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 #include "IntegrationMethodTwoStep.h"
+#include "RATTLEMultiplier.h"
 
 #ifndef __TWO_STEP_RATTLE_NVE_H__
 #define __TWO_STEP_RATTLE_NVE_H__
@@ -115,6 +116,14 @@ template<class Manifold> class PYBIND11_EXPORT TwoStepRATTLENVE : public Integra
                         //!< the manifold
     bool m_zero_force;  //!< True if the integration step should ignore computed forces
     bool m_box_changed;
+    GlobalArray<Scalar2> m_multipliers; //!< Last RATTLE multiplier (x) and tag (y) per index
+
+    //! Grow the multiplier storage with the particle data arrays
+    void checkMultiplierSize()
+        {
+        if (m_multipliers.getNumElements() < m_pdata->getMaxN())
+            m_multipliers.resize(m_pdata->getMaxN());
+        }
     };
 
 /*! \file TwoStepRATTLENVE.h
@@ -144,6 +153,9 @@ TwoStepRATTLENVE<Manifold>::TwoStepRATTLENVE(std::shared_ptr<SystemDefinition> s
         {
         throw std::runtime_error("Parts of the manifold are outside the box");
         }
+
+    GlobalArray<Scalar2> multipliers(m_pdata->getMaxN(), m_exec_conf);
+    m_multipliers.swap(multipliers);
     }
 
 template<class Manifold> TwoStepRATTLENVE<Manifold>::~TwoStepRATTLENVE()
@@ -521,6 +533,8 @@ template<class Manifold> void TwoStepRATTLENVE<Manifold>::integrateStepTwo(uint6
 
 template<class Manifold> void TwoStepRATTLENVE<Manifold>::includeRATTLEForce(uint64_t timestep)
     {
+    checkMultiplierSize();
+
     unsigned int group_size = m_group->getNumMembers();
 
     const GlobalArray<Scalar4>& net_force = m_pdata->getNetForce();
@@ -534,6 +548,11 @@ template<class Manifold> void TwoStepRATTLENVE<Manifold>::includeRATTLEForce(uin
     ArrayHandle<Scalar4> h_net_force(net_force, access_location::host, access_mode::readwrite);
     ArrayHandle<Scalar> h_net_virial(net_virial, access_location::host, access_mode::readwrite);
 
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar2> h_multipliers(m_multipliers,
+                                       access_location::host,
+                                       access_mode::readwrite);
+
     size_t net_virial_pitch = net_virial.getPitch();
 
     // perform the first half step of the RATTLE algorithm applied on velocity verlet
@@ -547,51 +566,35 @@ template<class Manifold> void TwoStepRATTLENVE<Manifold>::includeRATTLEForce(uin
             h_accel.data[j].x = h_accel.data[j].y = h_accel.data[j].z = 0.0;
             }
 
-        Scalar lambda = 0.0;
-
-        Scalar3 next_pos;
-        next_pos.x = h_pos.data[j].x;
-        next_pos.y = h_pos.data[j].y;
-        next_pos.z = h_pos.data[j].z;
-
-        Scalar3 normal = m_manifold.derivative(next_pos);
+        Scalar3 pos = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+        Scalar3 normal = m_manifold.derivative(pos);
 
         Scalar inv_mass = Scalar(1.0) / h_vel.data[j].w;
         Scalar deltaT_half = Scalar(1.0 / 2.0) * m_deltaT;
-        Scalar inv_alpha = -deltaT_half * m_deltaT * inv_mass;
-        inv_alpha = Scalar(1.0) / inv_alpha;
-
-        Scalar3 residual;
-        Scalar resid;
-        Scalar3 half_vel;
 
-        unsigned int iteration = 0;
-        do
-            {
-            iteration++;
-            half_vel.x = h_vel.data[j].x
-                         + deltaT_half * (h_accel.data[j].x - inv_mass * lambda * normal.x);
-            half_vel.y = h_vel.data[j].y
-                         + deltaT_half * (h_accel.data[j].y - inv_mass * lambda * normal.y);
-            half_vel.z = h_vel.data[j].z
-                         + deltaT_half * (h_accel.data[j].z - inv_mass * lambda * normal.z);
-
-            residual.x = h_pos.data[j].x - next_pos.x + m_deltaT * half_vel.x;
-            residual.y = h_pos.data[j].y - next_pos.y + m_deltaT * half_vel.y;
-            residual.z = h_pos.data[j].z - next_pos.z + m_deltaT * half_vel.z;
-            resid = m_manifold.implicitFunction(next_pos);
-
-            Scalar3 next_normal = m_manifold.derivative(next_pos);
-            Scalar nndotr = dot(next_normal, residual);
-            Scalar nndotn = dot(next_normal, normal);
-            Scalar beta = (resid + nndotr) / nndotn;
-
-            next_pos.x = next_pos.x - beta * normal.x + residual.x;
-            next_pos.y = next_pos.y - beta * normal.y + residual.y;
-            next_pos.z = next_pos.z - beta * normal.z + residual.z;
-            lambda = lambda - beta * inv_alpha;
-
-            } while (maxNorm(residual, resid) > m_tolerance && iteration < maxiteration);
+        // x(t+deltaT) = x(t) + deltaT*v(t) + (1/2)*deltaT^2*(a-lambda*n_manifold(x(t))/m) lies on
+        // the manifold
+        Scalar3 unconstrained_pos;
+        unconstrained_pos.x
+            = pos.x + m_deltaT * (h_vel.data[j].x + deltaT_half * h_accel.data[j].x);
+        unconstrained_pos.y
+            = pos.y + m_deltaT * (h_vel.data[j].y + deltaT_half * h_accel.data[j].y);
+        unconstrained_pos.z
+            = pos.z + m_deltaT * (h_vel.data[j].z + deltaT_half * h_accel.data[j].z);
+
+        // warm start from the multiplier this particle needed on the previous step
+        Scalar2 last_multiplier = h_multipliers.data[j];
+        Scalar lambda = ((unsigned int)__scalar_as_int(last_multiplier.y) == h_tag.data[j])
+                          ? last_multiplier.x
+                          : Scalar(0.0);
+        unsigned int iteration = computeRATTLEMultiplier(m_manifold,
+                                                         unconstrained_pos,
+                                                         normal,
+                                                         deltaT_half * m_deltaT * inv_mass,
+                                                         m_tolerance,
+                                                         maxiteration,
+                                                         lambda);
+        h_multipliers.data[j] = make_scalar2(lambda, __int_as_scalar(h_tag.data[j]));
 
         if (iteration == maxiteration)
             {
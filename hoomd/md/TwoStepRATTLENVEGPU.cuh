@@ -18,6 +18,8 @@
 #include "hoomd/ParticleData.cuh"
 #include "hoomd/VectorMath.h"
 
+#include "RATTLEMultiplier.h"
+
 #include "TwoStepRATTLENVEGPU.cuh"
 #include "hoomd/GPUPartition.cuh"
 
@@ -86,6 +88,8 @@ hipError_t gpu_include_rattle_force_nve(const Scalar4* d_pos,
                                         Scalar3* d_accel,
                                         Scalar4* d_net_force,
                                         Scalar* d_net_virial,
+                                        const unsigned int* d_tag,
+                                        Scalar2* d_multipliers,
                                         unsigned int* d_group_members,
                                         const GPUPartition& gpu_partition,
                                         size_t net_virial_pitch,
@@ -303,6 +307,8 @@ __global__ void gpu_include_rattle_force_nve_kernel(const Scalar4* d_pos,
                                                     Scalar3* d_accel,
                                                     Scalar4* d_net_force,
                                                     Scalar* d_net_virial,
+                                                    const unsigned int* d_tag,
+                                                    Scalar2* d_multipliers,
                                                     unsigned int* d_group_members,
                                                     const unsigned int nwork,
                                                     const unsigned int offset,
@@ -350,45 +356,32 @@ __global__ void gpu_include_rattle_force_nve_kernel(const Scalar4* d_pos,
         Scalar virial4 = d_net_virial[4 * net_virial_pitch + idx];
         Scalar virial5 = d_net_virial[5 * net_virial_pitch + idx];
 
-        Scalar lambda = 0.0;
         Scalar inv_mass = Scalar(1.0) / velmass.w;
         Scalar deltaT_half = Scalar(1.0 / 2.0) * deltaT;
-        Scalar inv_alpha = -deltaT_half * deltaT * inv_mass;
-        inv_alpha = Scalar(1.0) / inv_alpha;
-
-        Scalar3 next_pos = pos;
-        Scalar3 residual;
-        Scalar resid;
-        Scalar3 half_vel;
-
-        const unsigned int maxiteration = 10;
-        unsigned int iteration = 0;
-        do
-            {
-            iteration++;
-            half_vel = vel + deltaT_half * accel - deltaT_half * inv_mass * lambda * normal;
-
-            residual = pos - next_pos + deltaT * half_vel;
-            resid = manifold.implicitFunction(next_pos);
 
-            Scalar3 next_normal = manifold.derivative(next_pos);
-            Scalar nndotr = dot(next_normal, residual);
-            Scalar nndotn = dot(next_normal, normal);
-            Scalar beta = (resid + nndotr) / nndotn;
+        // x(t+deltaT) = x(t) + deltaT*v(t) + (1/2)*deltaT^2*(a-lambda*n_manifold(x(t))/m) lies on
+        // the manifold, warm started from the multiplier of the previous step
+        Scalar3 unconstrained_pos = pos + deltaT * (vel + deltaT_half * accel);
 
-            next_pos = next_pos - beta * normal + residual;
-            lambda = lambda - beta * inv_alpha;
+        unsigned int tag = d_tag[idx];
+        Scalar2 last_multiplier = d_multipliers[idx];
+        Scalar lambda = ((unsigned int)__scalar_as_int(last_multiplier.y) == tag)
+                            ? last_multiplier.x
+                            : Scalar(0.0);
 
-            resid = fabs(resid);
-            Scalar vec_norm = sqrt(dot(residual, residual));
-            if (vec_norm > resid)
-                resid = vec_norm;
-
-            } while (resid > tolerance && iteration < maxiteration);
+        const unsigned int maxiteration = 10;
+        computeRATTLEMultiplier(manifold,
+                                unconstrained_pos,
+                                normal,
+                                deltaT_half * deltaT * inv_mass,
+                                tolerance,
+                                maxiteration,
+                                lambda);
+        d_multipliers[idx] = make_scalar2(lambda, __int_as_scalar(tag));
 
-        accel = accel - lambda * normal;
+        accel = accel - inv_mass * lambda * normal;
 
-        force = force - inv_mass * lambda * normal;
+        force = force - lambda * normal;
 
         virial0 -= lambda * normal.x * pos.x;
         virial1 -= 0.5 * lambda * (normal.x * pos.y + normal.y * pos.x);
@@ -414,6 +407,8 @@ hipError_t gpu_include_rattle_force_nve(const Scalar4* d_pos,
                                         Scalar3* d_accel,
                                         Scalar4* d_net_force,
                                         Scalar* d_net_virial,
+                                        const unsigned int* d_tag,
+                                        Scalar2* d_multipliers,
                                         unsigned int* d_group_members,
                                         const GPUPartition& gpu_partition,
                                         size_t net_virial_pitch,
@@ -452,6 +447,8 @@ hipError_t gpu_include_rattle_force_nve(const Scalar4* d_pos,
                            d_accel,
                            d_net_force,
                            d_net_virial,
+                           d_tag,
+                           d_multipliers,
                            d_group_members,
                            nwork,
                            range.first,
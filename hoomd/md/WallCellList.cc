@@ -0,0 +1,129 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "WallCellList.h"
+
+#include <cstring>
+
+/*! \file WallCellList.cc
+    \brief Defines the WallCellList class
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param exec_conf Execution configuration
+ */
+WallCellList::WallCellList(std::shared_ptr<const ExecutionConfiguration> exec_conf)
+    : m_exec_conf(exec_conf), m_cell_size(1, exec_conf), m_cell_walls(1, exec_conf),
+      m_cell_indexer(1, 1, 1), m_cell_list_indexer(1, 1), m_valid(false), m_r_cut(0.0), m_ndim(3)
+    {
+    }
+
+/*! \param walls Walls of the wall potential
+    \param box Local simulation box
+    \param r_cut Largest distance from a wall surface at which the wall potential is nonzero
+    \param ndim Number of dimensions of the system
+*/
+void WallCellList::update(const wall_type& walls, const BoxDim& box, Scalar r_cut, unsigned int ndim)
+    {
+    if (m_valid && box == m_box && r_cut == m_r_cut && ndim == m_ndim
+        && std::memcmp(&walls, &m_walls, sizeof(wall_type)) == 0)
+        {
+        return;
+        }
+
+    std::memcpy((void*)&m_walls, &walls, sizeof(wall_type));
+    m_box = box;
+    m_r_cut = r_cut;
+    m_ndim = ndim;
+    build();
+    m_valid = true;
+    }
+
+/*! A wall is listed in a cell when the distance of the cell center to the wall surface is at most
+    the interaction range plus the distance of the cell center to the farthest cell corner. The
+    distance to the wall surface changes no faster than the position, so no wall that interacts
+    with a particle in the cell is missed.
+*/
+void WallCellList::build()
+    {
+    // cells are at least as wide as the interaction range
+    const Scalar3 L = m_box.getNearestPlaneDistance();
+    auto num_cells = [this](Scalar length)
+    {
+        if (m_r_cut <= Scalar(0.0))
+            return 1u;
+        Scalar n = floor(length / m_r_cut);
+        return (unsigned int)std::max(Scalar(1.0), std::min(n, Scalar(max_cells_per_dim)));
+    };
+    const unsigned int nx = num_cells(L.x);
+    const unsigned int ny = num_cells(L.y);
+    const unsigned int nz = m_ndim == 2 ? 1 : num_cells(L.z);
+    m_cell_indexer = Index3D(nx, ny, nz);
+
+    // the circumradius of a cell is half of its longest body diagonal
+    const vec3<Scalar> a = vec3<Scalar>(m_box.getLatticeVector(0)) / Scalar(nx);
+    const vec3<Scalar> b = vec3<Scalar>(m_box.getLatticeVector(1)) / Scalar(ny);
+    const vec3<Scalar> c = vec3<Scalar>(m_box.getLatticeVector(2)) / Scalar(nz);
+    Scalar diagonal_sq = std::max(std::max(dot(a + b + c, a + b + c), dot(a + b - c, a + b - c)),
+                                  std::max(dot(a - b + c, a - b + c), dot(a - b - c, a - b - c)));
+    const Scalar range = m_r_cut + Scalar(0.5) * sqrt(diagonal_sq);
+
+    const unsigned int n_walls = m_walls.numSpheres + m_walls.numCylinders + m_walls.numPlanes;
+    const unsigned int n_cells = m_cell_indexer.getNumElements();
+    m_cell_list_indexer = Index2D(std::max(n_walls, 1u), n_cells);
+
+    GPUArray<unsigned int> cell_size(n_cells, m_exec_conf);
+    m_cell_size.swap(cell_size);
+    GPUArray<unsigned int> cell_walls(m_cell_list_indexer.getNumElements(), m_exec_conf);
+    m_cell_walls.swap(cell_walls);
+
+    ArrayHandle<unsigned int> h_cell_size(m_cell_size,
+                                          access_location::host,
+                                          access_mode::overwrite);
+    ArrayHandle<unsigned int> h_cell_walls(m_cell_walls,
+                                           access_location::host,
+                                           access_mode::overwrite);
+
+    unsigned int max_size = 0;
+    for (unsigned int k = 0; k < nz; k++)
+        for (unsigned int j = 0; j < ny; j++)
+            for (unsigned int i = 0; i < nx; i++)
+                {
+                const unsigned int cell = m_cell_indexer(i, j, k);
+                const Scalar3 f = make_scalar3((Scalar(i) + Scalar(0.5)) / Scalar(nx),
+                                               (Scalar(j) + Scalar(0.5)) / Scalar(ny),
+                                               (Scalar(k) + Scalar(0.5)) / Scalar(nz));
+                const vec3<Scalar> center(m_box.makeCoordinates(f));
+
+                unsigned int size = 0;
+                auto add_if_near = [&](const auto& wall, unsigned int w)
+                {
+                    bool in_active_space = false;
+                    Scalar3 dr = distVectorWallToPoint(wall, center, in_active_space);
+                    if (dot(dr, dr) <= range * range)
+                        h_cell_walls.data[m_cell_list_indexer(size++, cell)] = w;
+                };
+
+                // keep the order of the full wall loop
+                unsigned int w = 0;
+                for (unsigned int s = 0; s < m_walls.numSpheres; s++)
+                    add_if_near(m_walls.Spheres[s], w++);
+                for (unsigned int s = 0; s < m_walls.numCylinders; s++)
+                    add_if_near(m_walls.Cylinders[s], w++);
+                for (unsigned int s = 0; s < m_walls.numPlanes; s++)
+                    add_if_near(m_walls.Planes[s], w++);
+
+                h_cell_size.data[cell] = size;
+                max_size = std::max(max_size, size);
+                }
+
+    m_exec_conf->msg->notice(7) << "WallCellList: " << nx << " x " << ny << " x " << nz
+                                << " cells, at most " << max_size << " of " << n_walls
+                                << " walls per cell" << std::endl;
+    }
+
+    } // end namespace md
+    } // end namespace hoomd
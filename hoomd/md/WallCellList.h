@@ -0,0 +1,95 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "EvaluatorWalls.h"
+#include "hoomd/ExecutionConfiguration.h"
+#include "hoomd/GPUArray.h"
+
+#include <memory>
+
+/*! \file WallCellList.h
+    \brief Declares a class that lists the walls near each cell of a grid
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#ifndef __WALL_CELL_LIST_H__
+#define __WALL_CELL_LIST_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Lists the walls near each cell of a grid over the local box
+/*! The wall potentials evaluate every wall for every particle. WallCellList divides the local box
+    into a grid of cells at least as wide as the interaction range and lists the walls whose surface
+    comes within the interaction range of each cell, so that a particle evaluates only the walls
+    listed for its cell.
+
+    The cell lists are rebuilt only when the walls, the box, or the interaction range change. The
+    walls are compared to a copy of the walls at the last build, because the wall collection is
+    modified in place from Python.
+*/
+class PYBIND11_EXPORT WallCellList
+    {
+    public:
+    //! Constructor
+    WallCellList(std::shared_ptr<const ExecutionConfiguration> exec_conf);
+
+    //! Rebuild the cell lists when the walls, the box, or the interaction range changed
+    void update(const wall_type& walls, const BoxDim& box, Scalar r_cut, unsigned int ndim);
+
+    //! Get the number of walls in each cell
+    const GPUArray<unsigned int>& getCellSizeArray() const
+        {
+        return m_cell_size;
+        }
+
+    //! Get the walls in each cell
+    const GPUArray<unsigned int>& getCellWallsArray() const
+        {
+        return m_cell_walls;
+        }
+
+    //! Get the cell lists to pass to the evaluator
+    /*! \param d_cell_size Number of walls in each cell
+        \param d_cell_walls Walls in each cell
+     */
+    wall_cell_list_t getCellList(const unsigned int* d_cell_size,
+                                 const unsigned int* d_cell_walls) const
+        {
+        wall_cell_list_t cells;
+        cells.cell_size = d_cell_size;
+        cells.cell_walls = d_cell_walls;
+        cells.ci = m_cell_indexer;
+        cells.cli = m_cell_list_indexer;
+        cells.box = m_box;
+        return cells;
+        }
+
+    //! Largest number of cells along each direction
+    static const unsigned int max_cells_per_dim = 16;
+
+    private:
+    std::shared_ptr<const ExecutionConfiguration> m_exec_conf; //!< Execution configuration
+    GPUArray<unsigned int> m_cell_size;                        //!< Number of walls in each cell
+    GPUArray<unsigned int> m_cell_walls;                       //!< Walls in each cell
+    Index3D m_cell_indexer;                                    //!< Indexer of the cells
+    Index2D m_cell_list_indexer; //!< Indexer of the walls in the cells
+
+    bool m_valid;        //!< True after the first build
+    wall_type m_walls;   //!< Walls at the last build
+    BoxDim m_box;        //!< Box at the last build
+    Scalar m_r_cut;      //!< Interaction range at the last build
+    unsigned int m_ndim; //!< Dimensionality at the last build
+
+    //! Build the cell lists
+    void build();
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __WALL_CELL_LIST_H__
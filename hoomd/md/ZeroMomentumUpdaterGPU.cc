@@ -0,0 +1,157 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ZeroMomentumUpdaterGPU.cc
+    \brief Defines the ZeroMomentumUpdaterGPU class
+*/
+
+#include "ZeroMomentumUpdaterGPU.h"
+#include "ZeroMomentumUpdaterGPU.cuh"
+
+#include "hoomd/CachedAllocator.h"
+
+#ifdef ENABLE_MPI
+#include "hoomd/HOOMDMPI.h"
+#endif
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System to zero the momentum of
+ */
+ZeroMomentumUpdaterGPU::ZeroMomentumUpdaterGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                               std::shared_ptr<Trigger> trigger)
+    : ZeroMomentumUpdater(sysdef, trigger), m_sum(m_exec_conf)
+    {
+    if (!m_exec_conf->isCUDAEnabled())
+        {
+        throw std::runtime_error("Cannot initialize ZeroMomentumUpdaterGPU on a CPU device.");
+        }
+
+    m_tuner_momentum.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                            m_exec_conf,
+                                            "zero_momentum_compute"));
+    m_tuner_remove.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                          m_exec_conf,
+                                          "zero_momentum_remove"));
+    m_autotuners.insert(m_autotuners.end(), {m_tuner_momentum, m_tuner_remove});
+    }
+
+ZeroMomentumUpdaterGPU::~ZeroMomentumUpdaterGPU()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying ZeroMomentumUpdaterGPU" << endl;
+    }
+
+/*! Perform the needed calculations to zero the system's momentum
+    \param timestep Current time step of the simulation
+*/
+void ZeroMomentumUpdaterGPU::update(uint64_t timestep)
+    {
+    Updater::update(timestep);
+
+    const unsigned int N = m_pdata->getN();
+
+    // sum of the momentum in xyz and the number of counted particles in w
+    Scalar4 sum = make_scalar4(0, 0, 0, 0);
+    if (N > 0)
+        {
+        if (m_momentum.getNumElements() < N)
+            {
+            GPUArray<Scalar4> momentum(N, m_exec_conf);
+            m_momentum.swap(momentum);
+            }
+
+        ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                                   access_location::device,
+                                   access_mode::read);
+        ArrayHandle<unsigned int> d_body(m_pdata->getBodies(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<unsigned int> d_tag(m_pdata->getTags(),
+                                        access_location::device,
+                                        access_mode::read);
+        ArrayHandle<Scalar4> d_momentum(m_momentum,
+                                        access_location::device,
+                                        access_mode::overwrite);
+
+        m_tuner_momentum->begin();
+        kernel::gpu_zero_momentum_compute(d_momentum.data,
+                                          d_vel.data,
+                                          d_body.data,
+                                          d_tag.data,
+                                          N,
+                                          m_tuner_momentum->getParam()[0]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_momentum->end();
+
+        void* d_tmp = NULL;
+        size_t tmp_bytes = 0;
+        kernel::gpu_zero_momentum_sum(m_sum.getDeviceFlags(), d_tmp, tmp_bytes, d_momentum.data, N);
+        ScopedAllocation<unsigned char> d_tmp_alloc(m_exec_conf->getCachedAllocator(),
+                                                    (tmp_bytes > 0) ? tmp_bytes : 1);
+        d_tmp = (void*)d_tmp_alloc();
+        kernel::gpu_zero_momentum_sum(m_sum.getDeviceFlags(), d_tmp, tmp_bytes, d_momentum.data, N);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+
+        sum = m_sum.readFlags();
+        }
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        Scalar s[4] = {sum.x, sum.y, sum.z, sum.w};
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &s[0],
+                      4,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        sum = make_scalar4(s[0], s[1], s[2], s[3]);
+        }
+#endif
+
+    // calculate the average
+    const Scalar3 avg_p = make_scalar3(sum.x / sum.w, sum.y / sum.w, sum.z / sum.w);
+
+    if (N > 0)
+        {
+        ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                                   access_location::device,
+                                   access_mode::readwrite);
+        ArrayHandle<unsigned int> d_body(m_pdata->getBodies(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<unsigned int> d_tag(m_pdata->getTags(),
+                                        access_location::device,
+                                        access_mode::read);
+
+        m_tuner_remove->begin();
+        kernel::gpu_zero_momentum_remove(d_vel.data,
+                                         d_body.data,
+                                         d_tag.data,
+                                         avg_p,
+                                         N,
+                                         m_tuner_remove->getParam()[0]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_remove->end();
+        }
+    }
+
+namespace detail
+    {
+void export_ZeroMomentumUpdaterGPU(pybind11::module& m)
+    {
+    pybind11::class_<ZeroMomentumUpdaterGPU,
+                     ZeroMomentumUpdater,
+                     std::shared_ptr<ZeroMomentumUpdaterGPU>>(m, "ZeroMomentumUpdaterGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<Trigger>>());
+    }
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
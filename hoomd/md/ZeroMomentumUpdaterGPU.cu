@@ -0,0 +1,177 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "ZeroMomentumUpdaterGPU.cuh"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#include <hipcub/hipcub.hpp>
+#pragma GCC diagnostic pop
+
+/*! \file ZeroMomentumUpdaterGPU.cu
+    \brief Defines GPU kernel code for ZeroMomentumUpdaterGPU
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Sum of two Scalar4s for the device reduction
+struct SumScalar4
+    {
+    __host__ __device__ Scalar4 operator()(const Scalar4& a, const Scalar4& b) const
+        {
+        return make_scalar4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+        }
+    };
+
+//! Kernel to compute the momentum of the free and central particles
+/*! \param d_momentum Momentum of the particles, with 1 in w if the particle is counted (output)
+    \param d_vel Particle velocities and masses
+    \param d_body Particle body ids
+    \param d_tag Particle tags
+    \param N Number of local particles
+
+    Constituent particles of rigid bodies have zero momentum and are not counted.
+*/
+__global__ void gpu_zero_momentum_compute_kernel(Scalar4* d_momentum,
+                                                 const Scalar4* d_vel,
+                                                 const unsigned int* d_body,
+                                                 const unsigned int* d_tag,
+                                                 const unsigned int N)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    const unsigned int body = d_body[idx];
+    if (body >= MIN_FLOPPY || body == d_tag[idx])
+        {
+        const Scalar4 vel = d_vel[idx];
+        d_momentum[idx] = make_scalar4(vel.w * vel.x, vel.w * vel.y, vel.w * vel.z, Scalar(1.0));
+        }
+    else
+        {
+        d_momentum[idx] = make_scalar4(0, 0, 0, 0);
+        }
+    }
+
+//! Kernel to subtract the average momentum from the free and central particles
+/*! \param d_vel Particle velocities and masses
+    \param d_body Particle body ids
+    \param d_tag Particle tags
+    \param avg_p Average momentum to subtract
+    \param N Number of local particles
+*/
+__global__ void gpu_zero_momentum_remove_kernel(Scalar4* d_vel,
+                                                const unsigned int* d_body,
+                                                const unsigned int* d_tag,
+                                                const Scalar3 avg_p,
+                                                const unsigned int N)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    const unsigned int body = d_body[idx];
+    if (body >= MIN_FLOPPY || body == d_tag[idx])
+        {
+        Scalar4 vel = d_vel[idx];
+        vel.x -= avg_p.x / vel.w;
+        vel.y -= avg_p.y / vel.w;
+        vel.z -= avg_p.z / vel.w;
+        d_vel[idx] = vel;
+        }
+    }
+
+hipError_t gpu_zero_momentum_compute(Scalar4* d_momentum,
+                                     const Scalar4* d_vel,
+                                     const unsigned int* d_body,
+                                     const unsigned int* d_tag,
+                                     const unsigned int N,
+                                     const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_zero_momentum_compute_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid((N / run_block_size) + 1, 1, 1);
+    dim3 threads(run_block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_zero_momentum_compute_kernel),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       d_momentum,
+                       d_vel,
+                       d_body,
+                       d_tag,
+                       N);
+
+    return hipSuccess;
+    }
+
+/*! \param d_sum Sum of the momentum (output on second call)
+    \param d_tmp Temporary storage for the reduction (output on first call)
+    \param tmp_bytes Number of bytes of temporary storage (output on first call)
+    \param d_momentum Momentum of the particles
+    \param N Number of local particles
+
+    This is a wrapper to hipcub::DeviceReduce::Reduce, and as such requires two calls. The first
+    call sizes the temporary storage, which the caller must then allocate into \a d_tmp before
+    calling a second time.
+*/
+hipError_t gpu_zero_momentum_sum(Scalar4* d_sum,
+                                 void* d_tmp,
+                                 size_t& tmp_bytes,
+                                 const Scalar4* d_momentum,
+                                 const unsigned int N)
+    {
+    hipcub::DeviceReduce::Reduce(d_tmp,
+                                 tmp_bytes,
+                                 d_momentum,
+                                 d_sum,
+                                 N,
+                                 SumScalar4(),
+                                 make_scalar4(0, 0, 0, 0));
+    return hipSuccess;
+    }
+
+hipError_t gpu_zero_momentum_remove(Scalar4* d_vel,
+                                    const unsigned int* d_body,
+                                    const unsigned int* d_tag,
+                                    const Scalar3 avg_p,
+                                    const unsigned int N,
+                                    const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_zero_momentum_remove_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid((N / run_block_size) + 1, 1, 1);
+    dim3 threads(run_block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_zero_momentum_remove_kernel),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       d_vel,
+                       d_body,
+                       d_tag,
+                       avg_p,
+                       N);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,47 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ZeroMomentumUpdaterGPU.cuh
+    \brief Declares GPU kernel code for ZeroMomentumUpdaterGPU
+*/
+
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/ParticleData.cuh"
+
+#ifndef __ZEROMOMENTUMUPDATERGPU_CUH__
+#define __ZEROMOMENTUMUPDATERGPU_CUH__
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Kernel driver to compute the momentum of the free and central particles
+hipError_t gpu_zero_momentum_compute(Scalar4* d_momentum,
+                                     const Scalar4* d_vel,
+                                     const unsigned int* d_body,
+                                     const unsigned int* d_tag,
+                                     const unsigned int N,
+                                     const unsigned int block_size);
+
+//! Sum the momentum of the particles
+hipError_t gpu_zero_momentum_sum(Scalar4* d_sum,
+                                 void* d_tmp,
+                                 size_t& tmp_bytes,
+                                 const Scalar4* d_momentum,
+                                 const unsigned int N);
+
+//! Kernel driver to subtract the average momentum from the free and central particles
+hipError_t gpu_zero_momentum_remove(Scalar4* d_vel,
+                                    const unsigned int* d_body,
+                                    const unsigned int* d_tag,
+                                    const Scalar3 avg_p,
+                                    const unsigned int N,
+                                    const unsigned int block_size);
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __ZEROMOMENTUMUPDATERGPU_CUH__
@@ -0,0 +1,62 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ZeroMomentumUpdaterGPU.h
+    \brief Declares an updater that zeros the momentum of the system on the GPU
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "ZeroMomentumUpdater.h"
+
+#include "hoomd/Autotuner.h"
+#include "hoomd/GPUArray.h"
+#include "hoomd/GPUFlags.h"
+
+#ifndef __ZEROMOMENTUMUPDATERGPU_H__
+#define __ZEROMOMENTUMUPDATERGPU_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Updates particle velocities to zero the momentum on the GPU
+/*! The momentum of the free and central particles is summed with a device reduction, so only the
+    summed momentum and the number of particles are copied to the host (and reduced across ranks)
+    before the velocities are corrected in place.
+
+    \ingroup updaters
+*/
+class PYBIND11_EXPORT ZeroMomentumUpdaterGPU : public ZeroMomentumUpdater
+    {
+    public:
+    //! Constructor
+    ZeroMomentumUpdaterGPU(std::shared_ptr<SystemDefinition> sysdef,
+                           std::shared_ptr<Trigger> trigger);
+    virtual ~ZeroMomentumUpdaterGPU();
+
+    //! Take one timestep forward
+    virtual void update(uint64_t timestep);
+
+    private:
+    GPUArray<Scalar4> m_momentum; //!< Momentum of the local particles, with 1 in w if counted
+    GPUFlags<Scalar4> m_sum;      //!< Sum of the momentum and the number of counted particles
+
+    /// Autotuner for block size (momentum kernel).
+    std::shared_ptr<Autotuner<1>> m_tuner_momentum;
+    /// Autotuner for block size (remove kernel).
+    std::shared_ptr<Autotuner<1>> m_tuner_remove;
+    };
+
+namespace detail
+    {
+//! Export the ZeroMomentumUpdaterGPU to python
+void export_ZeroMomentumUpdaterGPU(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -127,6 +127,18 @@ class _AlchemicalPairForce(_HOOMDBaseObject):
             return self._alchemical_params[attr]
         return super()._getattr_hook(attr)
 
+    @log(category='sequence', requires_run=True)
+    def alchemical_energies(self):
+        """(*N_samples*, ) `numpy.ndarray` of ``float``: Energy of the force \
+        at each sampled alchemical state :math:`[\\mathrm{energy}]`.
+
+        The states are given by the `AlchemicalDOF.alpha_samples` of the
+        attached alchemical degrees of freedom. All the energies are computed in
+        the same pass over the neighbor list that computes the forces.
+        """
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.getSampleEnergies()
+
 
 class AlchemicalDOF(_HOOMDBaseObject):
     """Alchemical degree of freedom :math:`\\alpha_i` associated with a\
@@ -149,6 +161,12 @@ class AlchemicalDOF(_HOOMDBaseObject):
             freedom :math:`\\alpha_i`.
 
         alchemical_momentum (float): The momentum of the alchemical parameter.
+
+        alpha_samples (list[float]): Values of :math:`\\alpha_i` at which to
+            evaluate the energy of the pair force, see
+            `LJGauss.alchemical_energies`. All degrees of freedom of a force
+            that set samples must set the same number of them. The other
+            degrees of freedom keep their current value in every sample.
     """
 
     def __init__(self,
@@ -157,7 +175,8 @@ class AlchemicalDOF(_HOOMDBaseObject):
                  typepair: tuple = None,
                  alpha: float = 1.0,
                  mass: float = 1.0,
-                 mu: float = 0.0):
+                 mu: float = 0.0,
+                 alpha_samples: list = ()):
         """Cache existing instances of AlchemicalDOF.
 
         Args:
@@ -169,6 +188,8 @@ class AlchemicalDOF(_HOOMDBaseObject):
             alpha (float): The value of the alchemical parameter.
             mass (float): The mass of the alchemical degree of freedom.
             mu (float): The alchemical potential.
+            alpha_samples (list[float]): Values of alpha to evaluate the energy
+                at.
 
         """
         self._force = force
@@ -180,11 +201,13 @@ class AlchemicalDOF(_HOOMDBaseObject):
         param_dict = ParameterDict(mass=float,
                                    mu=float,
                                    alpha=float,
-                                   alchemical_momentum=float)
+                                   alchemical_momentum=float,
+                                   alpha_samples=[float])
         param_dict['mass'] = mass
         param_dict['mu'] = mu
         param_dict['alpha'] = alpha
         param_dict['alchemical_momentum'] = 0.0
+        param_dict['alpha_samples'] = list(alpha_samples)
 
         # set defaults
         self._param_dict.update(param_dict)
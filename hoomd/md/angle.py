@@ -154,6 +154,8 @@ class Table(Angle):
 
     Args:
         width (int): Number of points in the table.
+        interpolation (str): Interpolation between grid points,
+            ``'linear'`` or ``'cubic'``. Defaults to ``'linear'``.
 
     `Table` computes computes forces, virials, and energies on all angles
     in the simulation given the user defined tables :math:`U` and :math:`\\tau`.
@@ -173,7 +175,11 @@ class Table(Angle):
     in the range :math:`\\theta \\in [0,\\pi]`. `Table` linearly
     interpolates values when :math:`\\theta` lies between grid points. The
     torque must be specificed commensurate with the potential: :math:`\\tau =
-    -\\frac{\\partial U}{\\partial \\theta}`.
+    -\\frac{\\partial U}{\\partial \\theta}`. With
+    ``interpolation='cubic'``, `Table` instead interpolates the energy
+    values with a cubic Hermite spline that matches the tabulated values and
+    derivatives at the grid points, and takes the torque from the derivative
+    of the spline, which conserves energy more closely at the same *width*.
 
     Attributes:
         params (`TypeParameter` [``angle type``, `dict`]):
@@ -188,13 +194,20 @@ class Table(Angle):
             \\mathrm{length}]`. Must have a size equal to `width`.
 
         width (int): Number of points in the table.
+
+        interpolation (str): Interpolation between grid points, ``'linear'``
+            or ``'cubic'``.
     """
 
-    def __init__(self, width):
+    def __init__(self, width, interpolation='linear'):
         super().__init__()
-        param_dict = hoomd.data.parameterdicts.ParameterDict(width=int)
+        param_dict = hoomd.data.parameterdicts.ParameterDict(
+            width=int,
+            interpolation=hoomd.data.typeconverter.OnlyFrom(
+                ['linear', 'cubic']))
         param_dict['width'] = width
-        self._param_dict = param_dict
+        param_dict['interpolation'] = interpolation
+        self._param_dict.update(param_dict)
 
         params = TypeParameter(
             "params", "angle_types",
@@ -180,6 +180,8 @@ class Table(Bond):
 
     Args:
         width (int): Number of points in the table.
+        interpolation (str): Interpolation between grid points,
+            ``'linear'`` or ``'cubic'``. Defaults to ``'linear'``.
 
     `Table` computes computes forces, virials, and energies on all bonds
     in the simulation given the user defined tables :math:`U` and :math:`F`.
@@ -222,7 +224,11 @@ class Table(Bond):
     :math:`r_{\\mathrm{max}}`. `Table` linearly interpolates values when
     :math:`r` lies between grid points and between the last grid point and
     :math:`r=r_{\\mathrm{max}}`.  The force must be specificed commensurate with
-    the potential: :math:`F = -\\frac{\\partial U}{\\partial r}`.
+    the potential: :math:`F = -\\frac{\\partial U}{\\partial r}`. With
+    ``interpolation='cubic'``, `Table` instead interpolates the energy
+    values with a cubic Hermite spline that matches the tabulated values and
+    derivatives at the grid points, and takes the force from the derivative
+    of the spline, which conserves energy more closely at the same *width*.
 
     Attributes:
         params (`TypeParameter` [``bond type``, `dict`]):
@@ -245,13 +251,20 @@ class Table(Bond):
             size equal to `width`.
 
         width (int): Number of points in the table.
+
+        interpolation (str): Interpolation between grid points, ``'linear'``
+            or ``'cubic'``.
     """
 
-    def __init__(self, width):
+    def __init__(self, width, interpolation='linear'):
         super().__init__()
-        param_dict = hoomd.data.parameterdicts.ParameterDict(width=int)
+        param_dict = hoomd.data.parameterdicts.ParameterDict(
+            width=int,
+            interpolation=hoomd.data.typeconverter.OnlyFrom(
+                ['linear', 'cubic']))
         param_dict['width'] = width
-        self._param_dict = param_dict
+        param_dict['interpolation'] = interpolation
+        self._param_dict.update(param_dict)
 
         params = TypeParameter(
             "params", "bond_types",
@@ -9,10 +9,12 @@ or by direct access via the Python API.
 """
 
 from hoomd.md import _md
-from hoomd.operation import Compute
+from hoomd.operation import Compute, Writer
 from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import SetOnce
 from hoomd.logging import log
 import hoomd
+import numpy
 
 
 class ThermodynamicQuantities(Compute):
@@ -315,6 +317,10 @@ class HarmonicAveragedThermodynamicQuantities(Compute):
             :math:`[\\mathrm{pressure}]`. If omitted, the HMA pressure can
             still be computed, but will be similar in precision to
             the conventional pressure.
+        thermodynamic_quantities (ThermodynamicQuantities): Compute that
+            accumulates the HMA sums in its own pass over the particles. It must
+            use the same filter. Defaults to `None`, which computes the HMA sums
+            separately.
 
     `HarmonicAveragedThermodynamicQuantities` acts on a given subset of
     particles and calculates harmonically mapped average (HMA) properties of
@@ -325,6 +331,12 @@ class HarmonicAveragedThermodynamicQuantities(Compute):
     saved either during first call to `Simulation.run` or when the compute is
     first added to the simulation, whichever occurs last.
 
+    When ``thermodynamic_quantities`` is set, the HMA sums are computed in the
+    same kernel as the sums of ``thermodynamic_quantities`` and reduced over MPI
+    ranks with them, so logging both costs one pass over the particles and one
+    reduction. ``thermodynamic_quantities`` then always computes the potential
+    energy.
+
     Note:
         `HarmonicAveragedThermodynamicQuantities` is an implementation of the
         methods section of Sabry G. Moustafa, Andrew J. Schultz, and David A.
@@ -349,7 +361,11 @@ class HarmonicAveragedThermodynamicQuantities(Compute):
             :math:`[\\mathrm{pressure}]`.
     """
 
-    def __init__(self, filter, kT, harmonic_pressure=0):
+    def __init__(self,
+                 filter,
+                 kT,
+                 harmonic_pressure=0,
+                 thermodynamic_quantities=None):
 
         # store metadata
         param_dict = ParameterDict(kT=float(kT),
@@ -358,6 +374,7 @@ class HarmonicAveragedThermodynamicQuantities(Compute):
         self._param_dict.update(param_dict)
 
         self._filter = filter
+        self._thermodynamic_quantities = thermodynamic_quantities
         # initialize base class
         super().__init__()
 
@@ -369,6 +386,22 @@ class HarmonicAveragedThermodynamicQuantities(Compute):
         group = self._simulation.state._get_group(self._filter)
         self._cpp_obj = thermoHMA_cls(self._simulation.state._cpp_sys_def,
                                       group, self.kT, self.harmonic_pressure)
+        thermo = self._thermodynamic_quantities
+        if thermo is not None:
+            if thermo._attached and self._simulation != thermo._simulation:
+                raise hoomd.error.SimulationDefinitionError(
+                    f"{thermo} is attached to another simulation.")
+            thermo._attach(self._simulation)
+            try:
+                self._cpp_obj.setThermo(thermo._cpp_obj)
+            except ValueError:
+                thermo._detach()
+                raise
+
+    def _detach_hook(self):
+        if self._thermodynamic_quantities is not None:
+            self._cpp_obj.setThermo(None)
+            self._thermodynamic_quantities._detach()
 
     @log(requires_run=True)
     def potential_energy(self):
@@ -381,3 +414,102 @@ class HarmonicAveragedThermodynamicQuantities(Compute):
         """Average pressure :math:`[\\mathrm{pressure}]`."""
         self._cpp_obj.compute(self._simulation.timestep)
         return self._cpp_obj.pressure
+
+
+class RadialDistributionFunction(Writer):
+    """Accumulate the radial distribution function from a neighbor list.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps on which to
+            sample the pair distances.
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list to count pairs in.
+        bins (int): Number of bins.
+        r_max (float): Largest distance to bin :math:`[\\mathrm{length}]`.
+
+    `RadialDistributionFunction` counts the distances of all pairs of particles
+    closer than ``r_max`` in ``bins`` bins of equal width every time it is
+    triggered, and averages the radial distribution function :math:`g(r)` over
+    all samples:
+
+    .. math::
+
+        g(r) = \\frac{1}{N_\\mathrm{samples}} \\sum_\\mathrm{samples}
+        \\frac{V}{N (N - 1)} \\frac{n(r)}{V_\\mathrm{shell}(r)},
+
+    where :math:`n(r)` is the number of ordered pairs in the bin and
+    :math:`V_\\mathrm{shell}(r)` is the volume of its spherical shell (the area
+    of its ring in 2D). The pairs are found with ``nlist``, which includes
+    ``r_max`` in its cutoff. Share the neighbor list of a pair force with a
+    cutoff of at least ``r_max`` so that sampling only costs one pass over the
+    neighbors. Pairs excluded from ``nlist`` (e.g. bonded particles) are not
+    counted. On the GPU, the counts stay in device memory until `rdf` is read.
+
+    Add `RadialDistributionFunction` to `hoomd.Operations.writers`.
+
+    Example::
+
+        rdf = hoomd.md.compute.RadialDistributionFunction(
+            trigger=hoomd.trigger.Periodic(100),
+            nlist=nlist,
+            bins=100,
+            r_max=3.0)
+        simulation.operations.writers.append(rdf)
+
+    Attributes:
+        trigger (hoomd.trigger.Trigger): Select the timesteps on which to
+            sample the pair distances.
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list to count pairs in.
+        bins (int): Number of bins.
+        r_max (float): Largest distance to bin :math:`[\\mathrm{length}]`.
+    """
+
+    def __init__(self, trigger, nlist, bins, r_max):
+        super().__init__(trigger)
+        param_dict = ParameterDict(nlist=SetOnce(hoomd.md.nlist.NeighborList),
+                                   bins=SetOnce(int),
+                                   r_max=SetOnce(float))
+        param_dict.update({"nlist": nlist, "bins": bins, "r_max": r_max})
+        self._param_dict.update(param_dict)
+
+    def _attach_hook(self):
+        if self.nlist._attached and self._simulation != self.nlist._simulation:
+            raise hoomd.error.SimulationDefinitionError(
+                f"{self.nlist} is attached to another simulation.")
+        self.nlist._attach(self._simulation)
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            rdf_cls = _md.RadialDistributionFunction
+        else:
+            rdf_cls = _md.RadialDistributionFunctionGPU
+        self._cpp_obj = rdf_cls(self._simulation.state._cpp_sys_def,
+                                self.trigger, self.nlist._cpp_obj, self.bins,
+                                self.r_max)
+
+    def _detach_hook(self):
+        self.nlist._detach()
+
+    def reset(self):
+        """Discard all samples."""
+        if self._attached:
+            self._cpp_obj.reset()
+
+    @log(category='sequence', requires_run=True)
+    def rdf(self):
+        """(*bins*, ) `numpy.ndarray` of ``float``: Radial distribution \
+        function averaged over all samples.
+
+        Note:
+            The counts are summed over all MPI ranks, so all ranks must access
+            `rdf`.
+        """
+        return numpy.array(self._cpp_obj.rdf)
+
+    @log(category='sequence', requires_run=True)
+    def bin_centers(self):
+        """(*bins*, ) `numpy.ndarray` of ``float``: Distance at the center of \
+        each bin :math:`[\\mathrm{length}]`."""
+        return numpy.array(self._cpp_obj.bin_centers)
+
+    @log(requires_run=True)
+    def num_samples(self):
+        """int: Number of samples in the average."""
+        return self._cpp_obj.num_samples
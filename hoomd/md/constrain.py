@@ -22,7 +22,7 @@ Warning:
 from hoomd.md import _md
 from hoomd.data.parameterdicts import ParameterDict, TypeParameterDict
 from hoomd.data.typeparam import TypeParameter
-from hoomd.data.typeconverter import OnlyIf, to_type_converter
+from hoomd.data.typeconverter import OnlyIf, OnlyFrom, to_type_converter
 from hoomd.md.force import Force
 import hoomd
 
@@ -52,6 +52,12 @@ class Distance(Constraint):
 
     Args:
         tolerance (float): Relative tolerance for constraint violation warnings.
+        solver (str): Method that solves the linear system of equations for
+          the constraint forces, ``'direct'`` or ``'iterative'``.
+        solver_tolerance (float): Norm of the residual relative to the norm of
+          the right hand side at which the iterative solver stops.
+        solver_max_iterations (int): Maximum number of iterations of the
+          iterative solver.
 
     `Distance` applies forces between particles that constrain the distances
     between particles to specific values. The algorithm implemented is described
@@ -82,6 +88,16 @@ class Distance(Constraint):
     equations to determine the force. The constraints are satisfied at :math:`t
     + 2 \\delta t`, so the scheme is self-correcting and avoids drifts.
 
+    With ``solver='direct'``, `Distance` solves the system of equations with a
+    sparse LU decomposition of the full constraint matrix. With
+    ``solver='iterative'``, it uses the Jacobi preconditioned BiCGSTAB method
+    instead, which applies the matrix directly from the list of constraints
+    and starts from the solution of the previous step. The iterative solver
+    needs memory proportional to the number of constraints, making it the
+    better choice for systems with many constraints per molecule, such as long
+    constrained polymers. The iterative solver runs on the CPU, also in GPU
+    simulations.
+
     Add an instance of `Distance` to the integrator constraints list
     `hoomd.md.Integrator.constraints` to apply the force during the simulation.
 
@@ -98,12 +114,30 @@ class Distance(Constraint):
 
     Attributes:
         tolerance (float): Relative tolerance for constraint violation warnings.
+
+        solver (str): Method that solves the linear system of equations for
+          the constraint forces, ``'direct'`` or ``'iterative'``.
+
+        solver_tolerance (float): Norm of the residual relative to the norm of
+          the right hand side at which the iterative solver stops.
+
+        solver_max_iterations (int): Maximum number of iterations of the
+          iterative solver.
     """
 
     _cpp_class_name = "ForceDistanceConstraint"
 
-    def __init__(self, tolerance=1e-3):
-        self._param_dict.update(ParameterDict(tolerance=float(tolerance)))
+    def __init__(self,
+                 tolerance=1e-3,
+                 solver='direct',
+                 solver_tolerance=1e-8,
+                 solver_max_iterations=1000):
+        self._param_dict.update(
+            ParameterDict(tolerance=float(tolerance),
+                          solver=OnlyFrom(['direct', 'iterative']),
+                          solver_tolerance=float(solver_tolerance),
+                          solver_max_iterations=int(solver_max_iterations)))
+        self.solver = solver
 
 
 class Rigid(Constraint):
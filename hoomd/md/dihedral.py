@@ -127,6 +127,8 @@ class Table(Dihedral):
 
     Args:
         width (int): Number of points in the table.
+        interpolation (str): Interpolation between grid points,
+            ``'linear'`` or ``'cubic'``. Defaults to ``'linear'``.
 
     `Table` computes computes forces, virials, and energies on all dihedrals
     in the simulation given the user defined tables :math:`U` and :math:`\\tau`.
@@ -146,7 +148,11 @@ class Table(Dihedral):
     in the range :math:`\\phi \\in [-\\pi,\\pi]`. `Table` linearly
     interpolates values when :math:`\\phi` lies between grid points. The
     torque must be specificed commensurate with the potential: :math:`\\tau =
-    -\\frac{\\partial U}{\\partial \\phi}`.
+    -\\frac{\\partial U}{\\partial \\phi}`. With ``interpolation='cubic'``,
+    `Table` instead interpolates the energy values with a cubic Hermite
+    spline that matches the tabulated values and derivatives at the grid
+    points, and takes the torque from the derivative of the spline, which
+    conserves energy more closely at the same *width*.
 
     Attributes:
         params (`TypeParameter` [``dihedral type``, `dict`]):
@@ -161,13 +167,20 @@ class Table(Dihedral):
             \\mathrm{length}]`. Must have a size equal to `width`.
 
         width (int): Number of points in the table.
+
+        interpolation (str): Interpolation between grid points, ``'linear'``
+            or ``'cubic'``.
     """
 
-    def __init__(self, width):
+    def __init__(self, width, interpolation='linear'):
         super().__init__()
-        param_dict = hoomd.data.parameterdicts.ParameterDict(width=int)
+        param_dict = hoomd.data.parameterdicts.ParameterDict(
+            width=int,
+            interpolation=hoomd.data.typeconverter.OnlyFrom(
+                ['linear', 'cubic']))
         param_dict['width'] = width
-        self._param_dict = param_dict
+        param_dict['interpolation'] = interpolation
+        self._param_dict.update(param_dict)
 
         params = TypeParameter(
             "params", "dihedral_types",
@@ -4,6 +4,7 @@
 """Apply forces to particles."""
 
 from abc import abstractmethod
+import ctypes
 
 import hoomd
 from hoomd.md import _md
@@ -66,13 +67,37 @@ class Force(Compute):
         <hoomd.Operations.computes>` list to compute the forces and energy
         without influencing the system dynamics.
 
+    .. rubric:: Multiple timestep integration
+
+    Set `timestep_multiple` to :math:`n > 1` to apply a slowly varying force
+    (such as `md.long_range.pppm.Coulomb`) as the impulse :math:`n \vec{F}_i`
+    on every :math:`n`-th timestep and not at all in between, while the other
+    forces apply on every timestep. With a velocity Verlet integration method
+    such as `md.methods.ConstantVolume`, this is the reversible RESPA multiple
+    timestep integrator with the outer timestep :math:`n \Delta t`.
+
+    The energy and virial of the force are included in the logged quantities
+    on every timestep. To do so, the force is also evaluated between the
+    impulses on timesteps that need the energy or virial. Set
+    `Simulation.always_compute_energy <hoomd.Simulation.always_compute_energy>`
+    to `False` so that this is only the case on timesteps where a writer logs
+    data. `md.methods.ConstantPressure` needs the virial on every timestep, so
+    it evaluates the force on every timestep.
+
+    `md.minimize.FIRE` and constraints do not support `timestep_multiple`.
+
     Warning:
         This class should not be instantiated by users. The class can be used
         for `isinstance` or `issubclass` checks.
+
+    Attributes:
+        timestep_multiple (int): Number of timesteps between applications of
+            this force by the integrator (defaults to 1).
     """
 
     def __init__(self):
         self._in_context_manager = False
+        self._param_dict.update(ParameterDict(timestep_multiple=int(1)))
 
     @log(requires_run=True)
     def energy(self):
@@ -319,6 +344,108 @@ class Custom(Force):
         pass
 
 
+class CustomFunction(Force):
+    r"""Custom forces implemented in a compiled function.
+
+    Args:
+        function: Compiled function that computes the forces.
+        device (str): ``"cpu"`` when *function* takes host arrays and ``"gpu"``
+            when it takes device arrays.
+        aniso (bool): Set to `True` when *function* computes torques.
+
+    `CustomFunction` calls *function* directly from C++ on every step with
+    pointers to the rank local particle and force arrays. Unlike `Custom`, it
+    does not call into Python, acquire the global interpreter lock, or copy
+    data between the host and the device, so the cost per step is that of the
+    function alone.
+
+    *function* is either the address of the function as an `int` or an object
+    that provides it: a Numba ``cfunc`` (through its ``address`` attribute) or a
+    `ctypes` function pointer. It must have the C signature:
+
+    .. code-block:: c
+
+        void function(uint64_t timestep,
+                      unsigned int N,
+                      const Scalar* box,
+                      const Scalar4* position,
+                      const Scalar4* velocity,
+                      const Scalar4* orientation,
+                      const unsigned int* tag,
+                      Scalar4* force,
+                      Scalar4* torque,
+                      Scalar* virial,
+                      size_t virial_pitch,
+                      void* stream);
+
+    where ``Scalar`` is ``double`` or ``float`` depending on the
+    `hoomd.version.floating_point_precision` and ``Scalar4`` is 4 consecutive
+    ``Scalar`` values. ``box`` holds :math:`L_x`, :math:`L_y`, :math:`L_z`,
+    :math:`xy`, :math:`xz`, and :math:`yz` of the global box and is always a
+    host array. The 4th element of ``position`` is the type id, and that of
+    ``force`` is the potential energy. ``torque`` is ``NULL`` when *aniso* is
+    `False`, and ``virial`` is ``NULL`` on steps where the virial is not needed.
+    Virial component ``k`` of particle ``i`` is ``virial[k * virial_pitch +
+    i]``. ``stream`` is the stream that *function* should launch its kernels on
+    when *device* is ``"gpu"``. `CustomFunction` zeros the outputs before each
+    call.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        # signature is the Numba signature of the C function above
+        @numba.cfunc(signature)
+        def harmonic_trap(timestep, N, box, position, velocity, orientation,
+                          tag, force, torque, virial, virial_pitch, stream):
+            for i in range(N):
+                for j in range(3):
+                    force[4 * i + j] = -position[4 * i + j]
+                    force[4 * i + 3] += 0.5 * position[4 * i + j]**2
+
+        trap = hoomd.md.force.CustomFunction(harmonic_trap)
+
+    Warning:
+        *function* is called without holding the global interpreter lock. A
+        function implemented in Python must acquire it, as `ctypes` callbacks
+        do.
+
+    Note:
+        The arrays are MPI rank local and do not include ghost particles.
+    """
+
+    def __init__(self, function, device='cpu', aniso=False):
+        super().__init__()
+        if device not in ('cpu', 'gpu'):
+            raise ValueError(f"device must be 'cpu' or 'gpu', got {device}.")
+        self._function = function
+        self._device = device
+        self._aniso = aniso
+
+    @staticmethod
+    def _function_address(function):
+        """Get the address of a compiled function."""
+        if isinstance(function, int):
+            return function
+        if hasattr(function, 'address'):
+            return function.address
+        if isinstance(function, ctypes._CFuncPtr):
+            return ctypes.cast(function, ctypes.c_void_p).value
+        raise TypeError("function must be an address, an object with an "
+                        "address attribute, or a ctypes function pointer.")
+
+    def _attach_hook(self):
+        if (self._device == 'gpu'
+                and not isinstance(self._simulation.device, hoomd.device.GPU)):
+            raise RuntimeError(
+                "Cannot use a GPU custom force function in a CPU simulation.")
+
+        self._cpp_obj = _md.CustomForceCompute(
+            self._simulation.state._cpp_sys_def, None, self._aniso)
+        self._cpp_obj.setFunction(self._function_address(self._function),
+                                  self._device == 'gpu')
+
+
 class Active(Force):
     r"""Active force.
 
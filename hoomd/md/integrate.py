@@ -153,6 +153,10 @@ class Integrator(_DynamicIntegrator):
         half_step_hook (hoomd.md.HalfStepHook): Enables the user to perform
             arbitrary computations during the half-step of the integration.
 
+        overlap_ghost_updates (bool): When True, compute forces on particles
+            that do not interact with ghost particles while the ghost positions
+            are communicated.
+
     `Integrator` is the top level class that orchestrates the time integration
     step in molecular dynamics simulations. The integration `methods` define
     the equations of motion to integrate under the influence of the given
@@ -232,6 +236,22 @@ class Integrator(_DynamicIntegrator):
 
     - `hoomd.md.constrain`
 
+    .. rubric:: Overlapping communication
+
+    In MPI simulations, `Integrator` updates the positions of ghost particles
+    on every step and migrates particles between ranks when the neighbor list
+    needs an update. When `overlap_ghost_updates` is ``True``, `Integrator`
+    computes the forces on *interior* particles (those that do not interact
+    with any ghost particle) while the ghost positions are in flight. It then
+    computes the forces on the remaining *boundary* particles after the update
+    completes. This hides communication latency in strong scaling runs with few
+    particles per rank.
+
+    Pair forces on the GPU find the interior particles from the neighbor list
+    and bond forces on the GPU find them from the bond partners. Other forces,
+    and all forces on the CPU, are computed after the ghost update completes.
+    `overlap_ghost_updates` has no effect in serial simulations.
+
     Examples::
 
         nlist = hoomd.md.nlist.Cell()
@@ -262,6 +282,10 @@ class Integrator(_DynamicIntegrator):
 
         half_step_hook (hoomd.md.HalfStepHook): User defined implementation to
             perform computations during the half-step of the integration.
+
+        overlap_ghost_updates (bool): When True, compute forces on particles
+            that do not interact with ghost particles while the ghost positions
+            are communicated.
     """
 
     def __init__(self,
@@ -271,7 +295,8 @@ class Integrator(_DynamicIntegrator):
                  constraints=None,
                  methods=None,
                  rigid=None,
-                 half_step_hook=None):
+                 half_step_hook=None,
+                 overlap_ghost_updates=False):
 
         super().__init__(forces, constraints, methods, rigid)
 
@@ -280,7 +305,8 @@ class Integrator(_DynamicIntegrator):
                 dt=float(dt),
                 integrate_rotational_dof=bool(integrate_rotational_dof),
                 half_step_hook=OnlyTypes(hoomd.md.HalfStepHook,
-                                         allow_none=True)))
+                                         allow_none=True),
+                overlap_ghost_updates=bool(overlap_ghost_updates)))
 
         self.half_step_hook = half_step_hook
 
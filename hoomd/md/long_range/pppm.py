@@ -155,22 +155,96 @@ class Coulomb(Force):
           space terms :math:`\\mathrm{[length]}`.
         alpha (float): Debye screening parameter
           :math:`\\mathrm{[length^{-1}]}`.
+        fft_backend (str): Library that performs the FFTs on the CPU when the
+          simulation runs on a single rank. ``'auto'`` selects the fastest
+          available library. ``'fftw'`` uses FFTW (or the FFTW3 interface of
+          MKL), which requires a build with ``ENABLE_FFTW=on``. ``'kiss'`` uses
+          the bundled KISS FFT library. Simulations on the GPU or with domain
+          decomposition ignore `fft_backend`.
+        single_precision_mesh (bool): When `True`, assign the charges to the
+          mesh and interpolate the forces from the mesh with single precision
+          arithmetic on the GPU. The forces are still accumulated at the
+          precision of the build. Simulations on the CPU ignore
+          `single_precision_mesh`.
+        slab_correction (bool): When `True`, apply the slab correction for
+          systems that are periodic in x and y but not in z (see below).
+        slab_volume_factor (float): Ratio of the height of the mesh to the
+          height of the box :math:`\mathrm{[dimensionless]}`. When greater
+          than 1, the mesh extends above the box with empty space and
+          ``resolution[2]`` sets the number of mesh points in the box.
+          Requires a box with :math:`xz = yz = 0` and a simulation without
+          domain decomposition.
+
+    Tip:
+        The charge density mesh and the FFTs are always single precision, so
+        the accuracy of the mesh is limited by the assignment order and grid
+        resolution. Set ``single_precision_mesh=True`` to speed up the
+        assignment and interpolation on GPUs with low double precision
+        throughput. HOOMD-blue reports an estimate of the resulting error next
+        to the RMS force error at notice level 2.
+
+    .. rubric:: Slab geometry
+
+    For a system confined between walls normal to z, such as a channel, set
+    ``slab_correction=True`` to apply the correction of `Yeh and Berkowitz
+    1999`_ with the terms for non-neutral systems of `Ballenegger et. al.
+    2009`_. The correction removes the interactions between the periodic
+    images of the slab along z:
+
+    .. math::
+
+        U_\mathrm{slab} = \frac{2\pi}{V} \left( M_z^2
+          - Q \sum_{i=0}^{N-1} q_i z_i^2 - Q^2 \frac{L_z^2}{12} \right)
+
+    where :math:`M_z = \sum_i q_i z_i`, :math:`Q = \sum_i q_i`, and
+    :math:`V` is the volume of the mesh. The periodic images must be
+    separated by empty space. Set ``slab_volume_factor`` to add this space to
+    the mesh instead of to the simulation box, so that the short range
+    computations do not process it. A value of 3 is typical; smaller values
+    need fewer mesh points at the cost of accuracy.
+
+    Note:
+        The slab correction does not contribute to the pressure tensor.
+
+    .. _Yeh and Berkowitz 1999: https://doi.org/10.1063/1.479595
+
+    .. _Ballenegger et. al. 2009: https://doi.org/10.1063/1.3216473
     """
 
-    def __init__(self, nlist, resolution, order, r_cut, alpha, pair_force):
+    def __init__(self,
+                 nlist,
+                 resolution,
+                 order,
+                 r_cut,
+                 alpha,
+                 pair_force,
+                 fft_backend='auto',
+                 single_precision_mesh=False,
+                 slab_correction=False,
+                 slab_volume_factor=1.0):
         super().__init__()
         self._nlist = hoomd.data.typeconverter.OnlyTypes(
             hoomd.md.nlist.NeighborList)(nlist)
         self._param_dict.update(
-            hoomd.data.parameterdicts.ParameterDict(resolution=(int, int, int),
-                                                    order=int,
-                                                    r_cut=float,
-                                                    alpha=float))
+            hoomd.data.parameterdicts.ParameterDict(
+                resolution=(int, int, int),
+                order=int,
+                r_cut=float,
+                alpha=float,
+                fft_backend=hoomd.data.typeconverter.OnlyFrom(
+                    ['auto', 'fftw', 'kiss']),
+                single_precision_mesh=bool,
+                slab_correction=bool,
+                slab_volume_factor=float))
 
         self.resolution = resolution
         self.order = order
         self.r_cut = r_cut
         self.alpha = alpha
+        self.fft_backend = fft_backend
+        self.single_precision_mesh = single_precision_mesh
+        self.slab_correction = slab_correction
+        self.slab_volume_factor = slab_volume_factor
         self._pair_force = pair_force
 
     def _attach_hook(self):
@@ -199,11 +273,13 @@ class Coulomb(Force):
         box = self._simulation.state.box
         Lx = box.Lx
         Ly = box.Ly
-        Lz = box.Lz
+        # the error estimate is for the mesh, which may extend above the box
+        Lz = box.Lz * self.slab_volume_factor
+        Nz_mesh = int(math.ceil(Nz * self.slab_volume_factor))
 
         hx = Lx / Nx
         hy = Ly / Ny
-        hz = Lz / Nz
+        hz = Lz / Nz_mesh
 
         gew1 = 0.0
         kappa = gew1
@@ -56,6 +56,48 @@ class Manifold(_HOOMDBaseObject):
         raise MutabilityError(attr)
 
 
+class Cosine(Manifold):
+    r"""Cosine manifold.
+
+    Args:
+        A (float): amplitude of the cosine :math:`[\mathrm{length}]`.
+        p (int): number of repetitions of the cosine in the box along x
+            (default 1).
+        shift (float): z-shift of the cosine (default 0)
+            :math:`[\mathrm{length}]`.
+
+    `Cosine` defines a sinusoidal surface that is periodic in x and extends
+    infinitely in y:
+
+    .. math::
+        F(x,y,z) = z - A \cos{\frac{2 \pi p x}{L_x}} - \textrm{shift}
+
+    where :math:`L_x` is the current box length in x. The parameters match
+    the walls of the ``hoomd.mpcd.stream.cosine_channel`` geometry: set
+    ``shift`` to :math:`+h` or :math:`-h` to constrain particles to the upper
+    or lower wall of a channel with the same ``A`` and ``p``.
+
+    Example::
+
+        cosine1 = manifold.Cosine(A=5)
+        cosine2 = manifold.Cosine(A=5, p=2, shift=-2)
+    """
+
+    def __init__(self, A, p=1, shift=0):
+        param_dict = ParameterDict(
+            A=float(A),
+            p=int(p),
+            shift=float(shift),
+        )
+
+        self._param_dict.update(param_dict)
+
+    def _attach_hook(self):
+        self._cpp_obj = _md.ManifoldCosine(self.A, self.p, self.shift)
+
+        super()._attach(self._simulation)
+
+
 class Cylinder(Manifold):
     r"""Cylinder manifold.
 
@@ -126,6 +126,7 @@ class Tersoff(Triplet):
     Args:
         nlist (hoomd.md.nlist.NeighborList): Neighbor list
         default_r_cut (float): Default cutoff radius :math:`[\mathrm{length}]`.
+        triplet_list (bool): Cache the triplets between neighbor list builds.
 
     The Tersoff potential is a bond-order potential based on the Morse potential
     that accounts for the weakening of individual bonds with increasing
@@ -225,6 +226,12 @@ class Tersoff(Triplet):
         Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
         `dict`]
 
+    Attributes:
+        triplet_list (bool): When `True`, cache the triplets :math:`(i,j,k)`
+            of interacting types when the neighbor list is built and evaluate
+            :math:`\chi_{ij}` and the three-body forces over the cached
+            triplets in the following steps. Only used on the CPU.
+
     Example::
 
         nl = md.nlist.Cell()
@@ -233,8 +240,9 @@ class Tersoff(Triplet):
     """
     _cpp_class_name = "PotentialTersoff"
 
-    def __init__(self, nlist, default_r_cut=None):
+    def __init__(self, nlist, default_r_cut=None, triplet_list=False):
         super().__init__(nlist, default_r_cut)
+        self._param_dict.update(ParameterDict(triplet_list=bool(triplet_list)))
         params = TypeParameter(
             'params', 'particle_types',
             TypeParameterDict(cutoff_thickness=0.2,
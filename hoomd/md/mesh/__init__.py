@@ -5,3 +5,4 @@
 
 from .potential import MeshPotential
 from . import bond
+from . import membrane
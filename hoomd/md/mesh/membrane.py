@@ -0,0 +1,122 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+r"""Mesh membrane forces.
+
+Mesh membrane force classes apply bending rigidity to the edges of a mesh and
+constrain the total area of its triangles and the volume it encloses.
+
+See Also:
+   See the documentation in `hoomd.mesh.Mesh` for more information on the
+   initialization of the mesh object.
+"""
+
+from hoomd.md.mesh.potential import MeshPotential
+from hoomd.data.typeparam import TypeParameter
+from hoomd.data.parameterdicts import ParameterDict, TypeParameterDict
+from hoomd.logging import log
+
+
+class Membrane(MeshPotential):
+    r"""Bending, area, and volume forces on a membrane mesh.
+
+    Args:
+        mesh (hoomd.mesh.Mesh): Mesh data structure constraint.
+        k_area (float): Area constraint spring constant
+            :math:`[\mathrm{energy} \cdot \mathrm{length}^{-2}]`.
+        area0 (float): Target area :math:`[\mathrm{length}^{2}]`.
+        k_volume (float): Volume constraint spring constant
+            :math:`[\mathrm{energy} \cdot \mathrm{length}^{-3}]`.
+        volume0 (float): Target volume :math:`[\mathrm{length}^{3}]`.
+
+    `Membrane` computes forces, virials, and energies on all vertices of
+    ``mesh`` with the potential:
+
+    .. math::
+
+        U = \sum_{(j,k)} \frac{\kappa}{2} \left( 1 - \hat{n}_1 \cdot
+        \hat{n}_2 \right)
+        + \frac{k_A}{2 A_0} \left( A - A_0 \right)^2
+        + \frac{k_V}{2 V_0} \left( V - V_0 \right)^2
+
+    where the sum runs over the mesh bonds :math:`(j,k)`, :math:`\hat{n}_1`
+    and :math:`\hat{n}_2` are the unit normals of the two triangles that share
+    the bond, :math:`A` is the total area of the mesh triangles, and :math:`V`
+    is the volume enclosed by the mesh. Bonds on the boundary of an open mesh
+    do not bend.
+
+    The area and volume constraints are disabled when their spring constant
+    is zero or their target is not positive.
+
+    Note:
+        The enclosed volume is computed from the unwrapped vertex positions
+        and is positive when the triangles run counterclockwise seen from
+        outside the mesh. Orient all triangles consistently and set the image
+        flags so that the unwrapped mesh is connected.
+
+    .. rubric:: Per-particle energies and virials
+
+    Each vertex takes 1/4 of the bending energy of every mesh bond it belongs
+    to. The constraint energies are distributed in proportion to the share of
+    the area and volume of each vertex, which is 1/3 of each of its triangles.
+
+    Attributes:
+        params (TypeParameter[``mesh name``,dict]):
+            The bending parameter of the defined mesh. The mesh type name
+            defaults to "mesh". The dictionary has the following keys:
+
+            * ``kappa`` (`float`, **required**) - bending rigidity
+              :math:`[\mathrm{energy}]`
+
+        k_area (float): Area constraint spring constant
+            :math:`[\mathrm{energy} \cdot \mathrm{length}^{-2}]`.
+
+        area0 (float): Target area :math:`[\mathrm{length}^{2}]`.
+
+        k_volume (float): Volume constraint spring constant
+            :math:`[\mathrm{energy} \cdot \mathrm{length}^{-3}]`.
+
+        volume0 (float): Target volume :math:`[\mathrm{length}^{3}]`.
+
+    Examples::
+
+        membrane = hoomd.md.mesh.membrane.Membrane(mesh,
+                                                   k_area=1000.0,
+                                                   area0=12.0,
+                                                   k_volume=1000.0,
+                                                   volume0=4.0)
+        membrane.params["mesh"] = dict(kappa=20.0)
+    """
+    _cpp_class_name = "MeshMembraneForceCompute"
+
+    def __init__(self,
+                 mesh,
+                 k_area=0.0,
+                 area0=0.0,
+                 k_volume=0.0,
+                 volume0=0.0):
+        params = TypeParameter("params", "types",
+                               TypeParameterDict(kappa=float, len_keys=1))
+        self._add_typeparam(params)
+
+        self._param_dict.update(
+            ParameterDict(k_area=float(k_area),
+                          area0=float(area0),
+                          k_volume=float(k_volume),
+                          volume0=float(volume0)))
+
+        super().__init__(mesh)
+
+    @log(requires_run=True)
+    def area(self):
+        """float: Total area of the mesh triangles \
+        :math:`[\\mathrm{length}^{2}]`."""
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.area
+
+    @log(requires_run=True)
+    def volume(self):
+        """float: Volume enclosed by the mesh \
+        :math:`[\\mathrm{length}^{3}]`."""
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.volume
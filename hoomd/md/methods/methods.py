@@ -164,6 +164,8 @@ class ConstantVolume(Thermostatted):
         group = self._simulation.state._get_group(self.filter)
         cpp_sys_def = self._simulation.state._cpp_sys_def
         self._thermo = thermo_cls(cpp_sys_def, group)
+        # thermostats only need the kinetic energy
+        self._thermo.kinetic_energy_only = True
 
         if self.thermostat is None:
             self._cpp_obj = cls(cpp_sys_def, group, None)
@@ -461,6 +463,7 @@ class ConstantPressure(Thermostatted):
 
                 npt.barostat_dof = numpy.load(file=path / 'barostat_dof.npy')
     """
+    _checkpoint_parameters = ('barostat_dof',)
 
     def __init__(self,
                  filter,
@@ -510,8 +513,10 @@ class ConstantPressure(Thermostatted):
         cpp_sys_def = self._simulation.state._cpp_sys_def
         thermo_group = self._simulation.state._get_group(self.filter)
 
-        # Only save the half step thermo
+        # Only save the half step thermo, thermostats only need its kinetic
+        # energy
         self._thermo = thermo_cls(cpp_sys_def, thermo_group)
+        self._thermo.kinetic_energy_only = True
         thermo_full_step = thermo_cls(cpp_sys_def, thermo_group)
 
         if self.thermostat is None:
@@ -185,6 +185,7 @@ class MTTK(Thermostat):
                 mttk.rotational_dof = numpy.load(
                     file=path / 'rotational_dof.npy')
     """
+    _checkpoint_parameters = ('translational_dof', 'rotational_dof')
 
     def __init__(self, kT, tau):
         super().__init__(kT)
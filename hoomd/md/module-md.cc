@@ -11,6 +11,7 @@ namespace detail
     {
 
 void export_ActiveForceCompute(pybind11::module& m);
+void export_ActiveForceConstraintComputeCosine(pybind11::module& m);
 void export_ActiveForceConstraintComputeCylinder(pybind11::module& m);
 void export_ActiveForceConstraintComputeDiamond(pybind11::module& m);
 void export_ActiveForceConstraintComputeEllipsoid(pybind11::module& m);
@@ -26,6 +27,7 @@ void export_HarmonicAngleForceCompute(pybind11::module& m);
 void export_CosineSqAngleForceCompute(pybind11::module& m);
 void export_TableAngleForceCompute(pybind11::module& m);
 void export_HarmonicDihedralForceCompute(pybind11::module& m);
+void export_MeshMembraneForceCompute(pybind11::module& m);
 void export_PeriodicImproperForceCompute(pybind11::module& m);
 void export_OPLSDihedralForceCompute(pybind11::module& m);
 void export_TableDihedralForceCompute(pybind11::module& m);
@@ -33,13 +35,17 @@ void export_HarmonicImproperForceCompute(pybind11::module& m);
 void export_BondTablePotential(pybind11::module& m);
 void export_CustomForceCompute(pybind11::module& m);
 void export_NeighborList(pybind11::module& m);
+void export_NeighborListBufferTuner(pybind11::module& m);
 void export_NeighborListBinned(pybind11::module& m);
 void export_NeighborListStencil(pybind11::module& m);
 void export_NeighborListTree(pybind11::module& m);
+void export_NeighborListHashed(pybind11::module& m);
+void export_NeighborListCluster(pybind11::module& m);
 void export_MolecularForceCompute(pybind11::module& m);
 void export_ForceDistanceConstraint(pybind11::module& m);
 void export_ForceComposite(pybind11::module& m);
 void export_PPPMForceCompute(pybind11::module& m);
+void export_RadialDistributionFunction(pybind11::module& m);
 void export_wall_data(pybind11::module& m);
 void export_wall_field(pybind11::module& m);
 void export_LocalNeighborListDataHost(pybind11::module& m);
@@ -53,6 +59,10 @@ void export_PotentialPairExpandedLJ(pybind11::module& m);
 void export_PotentialPairExpandedGaussian(pybind11::module& m);
 void export_PotentialPairExpandedMie(pybind11::module& m);
 void export_PotentialPairYukawa(pybind11::module& m);
+void export_PotentialPairLJYukawa(pybind11::module& m);
+void export_PotentialPairTabulatedExpandedMie(pybind11::module& m);
+void export_PotentialPairTabulatedDLVO(pybind11::module& m);
+void export_PotentialPairTabulatedTWF(pybind11::module& m);
 void export_PotentialPairEwald(pybind11::module& m);
 void export_PotentialPairMorse(pybind11::module& m);
 void export_PotentialPairMoliere(pybind11::module& m);
@@ -100,10 +110,12 @@ void export_PotentialExternalWallMorse(pybind11::module& m);
 
 void export_PotentialPairDPDThermoDPD(pybind11::module& m);
 void export_PotentialPairDPDThermoLJ(pybind11::module& m);
+void export_PotentialPairDPDThermoDPDYukawa(pybind11::module& m);
 
 void export_IntegratorTwoStep(pybind11::module& m);
 void export_IntegrationMethodTwoStep(pybind11::module& m);
 void export_ZeroMomentumUpdater(pybind11::module& m);
+void export_ReplicaExchangeUpdater(pybind11::module& m);
 
 void export_Thermostat(pybind11::module& m);
 void export_MTTKThermostat(pybind11::module& m);
@@ -121,6 +133,7 @@ void export_MuellerPlatheFlow(pybind11::module& m);
 void export_AlchemostatTwoStep(pybind11::module& m);
 void export_HalfStepHook(pybind11::module& m);
 
+void export_TwoStepRATTLEBDCosine(pybind11::module& m);
 void export_TwoStepRATTLEBDCylinder(pybind11::module& m);
 void export_TwoStepRATTLEBDDiamond(pybind11::module& m);
 void export_TwoStepRATTLEBDEllipsoid(pybind11::module& m);
@@ -129,6 +142,7 @@ void export_TwoStepRATTLEBDPlane(pybind11::module& m);
 void export_TwoStepRATTLEBDPrimitive(pybind11::module& m);
 void export_TwoStepRATTLEBDSphere(pybind11::module& m);
 
+void export_TwoStepRATTLELangevinCosine(pybind11::module& m);
 void export_TwoStepRATTLELangevinCylinder(pybind11::module& m);
 void export_TwoStepRATTLELangevinDiamond(pybind11::module& m);
 void export_TwoStepRATTLELangevinEllipsoid(pybind11::module& m);
@@ -137,6 +151,7 @@ void export_TwoStepRATTLELangevinPlane(pybind11::module& m);
 void export_TwoStepRATTLELangevinPrimitive(pybind11::module& m);
 void export_TwoStepRATTLELangevinSphere(pybind11::module& m);
 
+void export_TwoStepRATTLENVECosine(pybind11::module& m);
 void export_TwoStepRATTLENVECylinder(pybind11::module& m);
 void export_TwoStepRATTLENVEDiamond(pybind11::module& m);
 void export_TwoStepRATTLENVEEllipsoid(pybind11::module& m);
@@ -145,6 +160,7 @@ void export_TwoStepRATTLENVEPlane(pybind11::module& m);
 void export_TwoStepRATTLENVEPrimitive(pybind11::module& m);
 void export_TwoStepRATTLENVESphere(pybind11::module& m);
 
+void export_ManifoldCosine(pybind11::module& m);
 void export_ManifoldDiamond(pybind11::module& m);
 void export_ManifoldEllipsoid(pybind11::module& m);
 void export_ManifoldGyroid(pybind11::module& m);
@@ -158,6 +174,7 @@ void export_PotentialPairAlchemicalLJGauss(pybind11::module& m);
 
 #ifdef ENABLE_HIP
 
+void export_ActiveForceConstraintComputeCosineGPU(pybind11::module& m);
 void export_ActiveForceConstraintComputeCylinderGPU(pybind11::module& m);
 void export_ActiveForceConstraintComputeDiamondGPU(pybind11::module& m);
 void export_ActiveForceConstraintComputeEllipsoidGPU(pybind11::module& m);
@@ -173,6 +190,7 @@ void export_HarmonicAngleForceComputeGPU(pybind11::module& m);
 void export_CosineSqAngleForceComputeGPU(pybind11::module& m);
 void export_TableAngleForceComputeGPU(pybind11::module& m);
 void export_HarmonicDihedralForceComputeGPU(pybind11::module& m);
+void export_MeshMembraneForceComputeGPU(pybind11::module& m);
 void export_OPLSDihedralForceComputeGPU(pybind11::module& m);
 void export_TableDihedralForceComputeGPU(pybind11::module& m);
 void export_HarmonicImproperForceComputeGPU(pybind11::module& m);
@@ -181,10 +199,13 @@ void export_NeighborListGPU(pybind11::module& m);
 void export_NeighborListGPUBinned(pybind11::module& m);
 void export_NeighborListGPUStencil(pybind11::module& m);
 void export_NeighborListGPUTree(pybind11::module& m);
+void export_NeighborListGPUHashed(pybind11::module& m);
+void export_ZeroMomentumUpdaterGPU(pybind11::module& m);
 void export_ForceDistanceConstraintGPU(pybind11::module& m);
 void export_ForceCompositeGPU(pybind11::module& m);
 void export_PeriodicImproperForceComputeGPU(pybind11::module& m);
 void export_PPPMForceComputeGPU(pybind11::module& m);
+void export_RadialDistributionFunctionGPU(pybind11::module& m);
 void export_LocalNeighborListDataGPU(pybind11::module& m);
 
 void export_PotentialPairBuckinghamGPU(pybind11::module& m);
@@ -196,6 +217,10 @@ void export_PotentialPairExpandedLJGPU(pybind11::module& m);
 void export_PotentialPairExpandedGaussianGPU(pybind11::module& m);
 void export_PotentialPairExpandedMieGPU(pybind11::module& m);
 void export_PotentialPairYukawaGPU(pybind11::module& m);
+void export_PotentialPairLJYukawaGPU(pybind11::module& m);
+void export_PotentialPairTabulatedExpandedMieGPU(pybind11::module& m);
+void export_PotentialPairTabulatedDLVOGPU(pybind11::module& m);
+void export_PotentialPairTabulatedTWFGPU(pybind11::module& m);
 void export_PotentialPairEwaldGPU(pybind11::module& m);
 void export_PotentialPairMorseGPU(pybind11::module& m);
 void export_PotentialPairMoliereGPU(pybind11::module& m);
@@ -244,6 +269,7 @@ void export_PotentialExternalWallMorseGPU(pybind11::module& m);
 
 void export_PotentialPairDPDThermoDPDGPU(pybind11::module& m);
 void export_PotentialPairDPDThermoLJGPU(pybind11::module& m);
+void export_PotentialPairDPDThermoDPDYukawaGPU(pybind11::module& m);
 
 void export_TwoStepConstantVolumeGPU(pybind11::module& m);
 void export_TwoStepLangevinGPU(pybind11::module& m);
@@ -252,6 +278,7 @@ void export_TwoStepConstantPressureGPU(pybind11::module& m);
 void export_FIREEnergyMinimizerGPU(pybind11::module& m);
 void export_MuellerPlatheFlowGPU(pybind11::module& m);
 
+void export_TwoStepRATTLEBDGPUCosine(pybind11::module& m);
 void export_TwoStepRATTLEBDGPUCylinder(pybind11::module& m);
 void export_TwoStepRATTLEBDGPUDiamond(pybind11::module& m);
 void export_TwoStepRATTLEBDGPUEllipsoid(pybind11::module& m);
@@ -260,6 +287,7 @@ void export_TwoStepRATTLEBDGPUPlane(pybind11::module& m);
 void export_TwoStepRATTLEBDGPUPrimitive(pybind11::module& m);
 void export_TwoStepRATTLEBDGPUSphere(pybind11::module& m);
 
+void export_TwoStepRATTLELangevinGPUCosine(pybind11::module& m);
 void export_TwoStepRATTLELangevinGPUCylinder(pybind11::module& m);
 void export_TwoStepRATTLELangevinGPUDiamond(pybind11::module& m);
 void export_TwoStepRATTLELangevinGPUEllipsoid(pybind11::module& m);
@@ -268,6 +296,7 @@ void export_TwoStepRATTLELangevinGPUPlane(pybind11::module& m);
 void export_TwoStepRATTLELangevinGPUPrimitive(pybind11::module& m);
 void export_TwoStepRATTLELangevinGPUSphere(pybind11::module& m);
 
+void export_TwoStepRATTLENVEGPUCosine(pybind11::module& m);
 void export_TwoStepRATTLENVEGPUCylinder(pybind11::module& m);
 void export_TwoStepRATTLENVEGPUDiamond(pybind11::module& m);
 void export_TwoStepRATTLENVEGPUEllipsoid(pybind11::module& m);
@@ -291,6 +320,7 @@ using namespace hoomd::md::detail;
 PYBIND11_MODULE(_md, m)
     {
     export_ActiveForceCompute(m);
+    export_ActiveForceConstraintComputeCosine(m);
     export_ActiveForceConstraintComputeCylinder(m);
     export_ActiveForceConstraintComputeDiamond(m);
     export_ActiveForceConstraintComputeEllipsoid(m);
@@ -321,6 +351,10 @@ PYBIND11_MODULE(_md, m)
     export_PotentialPairExpandedGaussian(m);
     export_PotentialPairExpandedMie(m);
     export_PotentialPairYukawa(m);
+    export_PotentialPairLJYukawa(m);
+    export_PotentialPairTabulatedExpandedMie(m);
+    export_PotentialPairTabulatedDLVO(m);
+    export_PotentialPairTabulatedTWF(m);
     export_PotentialPairEwald(m);
     export_PotentialPairMorse(m);
     export_PotentialPairMoliere(m);
@@ -349,6 +383,7 @@ PYBIND11_MODULE(_md, m)
 
     export_PotentialPairDPDThermoDPD(m);
     export_PotentialPairDPDThermoLJ(m);
+    export_PotentialPairDPDThermoDPDYukawa(m);
 
     export_PotentialBondHarmonic(m);
     export_PotentialBondFENE(m);
@@ -357,19 +392,24 @@ PYBIND11_MODULE(_md, m)
     export_PotentialMeshBondHarmonic(m);
     export_PotentialMeshBondFENE(m);
     export_PotentialMeshBondTether(m);
+    export_MeshMembraneForceCompute(m);
 
     export_PotentialSpecialPairLJ(m);
     export_PotentialSpecialPairCoulomb(m);
 
     export_CustomForceCompute(m);
     export_NeighborList(m);
+    export_NeighborListBufferTuner(m);
     export_NeighborListBinned(m);
     export_NeighborListStencil(m);
     export_NeighborListTree(m);
+    export_NeighborListHashed(m);
+    export_NeighborListCluster(m);
     export_MolecularForceCompute(m);
     export_ForceDistanceConstraint(m);
     export_ForceComposite(m);
     export_PPPMForceCompute(m);
+    export_RadialDistributionFunction(m);
     export_LocalNeighborListDataHost(m);
 
     export_PotentialExternalPeriodic(m);
@@ -391,6 +431,7 @@ PYBIND11_MODULE(_md, m)
     export_NeighborListGPUBinned(m);
     export_NeighborListGPUStencil(m);
     export_NeighborListGPUTree(m);
+    export_NeighborListGPUHashed(m);
     export_ForceCompositeGPU(m);
     export_LocalNeighborListDataGPU(m);
 
@@ -403,6 +444,10 @@ PYBIND11_MODULE(_md, m)
     export_PotentialPairExpandedGaussianGPU(m);
     export_PotentialPairExpandedMieGPU(m);
     export_PotentialPairYukawaGPU(m);
+    export_PotentialPairLJYukawaGPU(m);
+    export_PotentialPairTabulatedExpandedMieGPU(m);
+    export_PotentialPairTabulatedDLVOGPU(m);
+    export_PotentialPairTabulatedTWFGPU(m);
     export_PotentialPairEwaldGPU(m);
     export_PotentialPairMorseGPU(m);
     export_PotentialPairMoliereGPU(m);
@@ -424,6 +469,7 @@ PYBIND11_MODULE(_md, m)
 
     export_PotentialPairDPDThermoDPDGPU(m);
     export_PotentialPairDPDThermoLJGPU(m);
+    export_PotentialPairDPDThermoDPDYukawaGPU(m);
 
     export_AnisoPotentialPairALJ2DGPU(m);
     export_AnisoPotentialPairALJ3DGPU(m);
@@ -437,6 +483,7 @@ PYBIND11_MODULE(_md, m)
     export_PotentialMeshBondHarmonicGPU(m);
     export_PotentialMeshBondFENEGPU(m);
     export_PotentialMeshBondTetherGPU(m);
+    export_MeshMembraneForceComputeGPU(m);
 
     export_PotentialSpecialPairLJGPU(m);
     export_PotentialSpecialPairCoulombGPU(m);
@@ -453,7 +500,9 @@ PYBIND11_MODULE(_md, m)
     export_ComputeThermoHMAGPU(m);
     export_PeriodicImproperForceComputeGPU(m);
     export_PPPMForceComputeGPU(m);
+    export_RadialDistributionFunctionGPU(m);
     export_ActiveForceComputeGPU(m);
+    export_ActiveForceConstraintComputeCosineGPU(m);
     export_ActiveForceConstraintComputeCylinderGPU(m);
     export_ActiveForceConstraintComputeDiamondGPU(m);
     export_ActiveForceConstraintComputeEllipsoidGPU(m);
@@ -483,6 +532,7 @@ PYBIND11_MODULE(_md, m)
     export_IntegratorTwoStep(m);
     export_IntegrationMethodTwoStep(m);
     export_ZeroMomentumUpdater(m);
+    export_ReplicaExchangeUpdater(m);
     export_TwoStepConstantVolume(m);
     export_TwoStepLangevinBase(m);
     export_TwoStepLangevin(m);
@@ -495,6 +545,7 @@ PYBIND11_MODULE(_md, m)
     export_HalfStepHook(m);
 
     // RATTLE
+    export_TwoStepRATTLEBDCosine(m);
     export_TwoStepRATTLEBDCylinder(m);
     export_TwoStepRATTLEBDDiamond(m);
     export_TwoStepRATTLEBDEllipsoid(m);
@@ -503,6 +554,7 @@ PYBIND11_MODULE(_md, m)
     export_TwoStepRATTLEBDPrimitive(m);
     export_TwoStepRATTLEBDSphere(m);
 
+    export_TwoStepRATTLELangevinCosine(m);
     export_TwoStepRATTLELangevinCylinder(m);
     export_TwoStepRATTLELangevinDiamond(m);
     export_TwoStepRATTLELangevinEllipsoid(m);
@@ -511,6 +563,7 @@ PYBIND11_MODULE(_md, m)
     export_TwoStepRATTLELangevinPrimitive(m);
     export_TwoStepRATTLELangevinSphere(m);
 
+    export_TwoStepRATTLENVECosine(m);
     export_TwoStepRATTLENVECylinder(m);
     export_TwoStepRATTLENVEDiamond(m);
     export_TwoStepRATTLENVEEllipsoid(m);
@@ -526,7 +579,9 @@ PYBIND11_MODULE(_md, m)
     export_TwoStepConstantPressureGPU(m);
     export_FIREEnergyMinimizerGPU(m);
     export_MuellerPlatheFlowGPU(m);
+    export_ZeroMomentumUpdaterGPU(m);
 
+    export_TwoStepRATTLEBDGPUCosine(m);
     export_TwoStepRATTLEBDGPUCylinder(m);
     export_TwoStepRATTLEBDGPUDiamond(m);
     export_TwoStepRATTLEBDGPUEllipsoid(m);
@@ -535,6 +590,7 @@ PYBIND11_MODULE(_md, m)
     export_TwoStepRATTLEBDGPUPrimitive(m);
     export_TwoStepRATTLEBDGPUSphere(m);
 
+    export_TwoStepRATTLELangevinGPUCosine(m);
     export_TwoStepRATTLELangevinGPUCylinder(m);
     export_TwoStepRATTLELangevinGPUDiamond(m);
     export_TwoStepRATTLELangevinGPUEllipsoid(m);
@@ -543,6 +599,7 @@ PYBIND11_MODULE(_md, m)
     export_TwoStepRATTLELangevinGPUPrimitive(m);
     export_TwoStepRATTLELangevinGPUSphere(m);
 
+    export_TwoStepRATTLENVEGPUCosine(m);
     export_TwoStepRATTLENVEGPUCylinder(m);
     export_TwoStepRATTLENVEGPUDiamond(m);
     export_TwoStepRATTLENVEGPUEllipsoid(m);
@@ -554,6 +611,7 @@ PYBIND11_MODULE(_md, m)
 
     // manifolds
     export_ManifoldZCylinder(m);
+    export_ManifoldCosine(m);
     export_ManifoldDiamond(m);
     export_ManifoldEllipsoid(m);
     export_ManifoldGyroid(m);
@@ -6,7 +6,8 @@ r"""Neighbor list acceleration structures.
 Pair forces (`hoomd.md.pair`) use neighbor list data structures to find
 neighboring particle pairs (those within a distance of :math:`r_\mathrm{cut}`)
 efficiently. HOOMD-blue provides a several types of neighbor list construction
-algorithms that you can select from: `Cell`, `Tree`, and `Stencil`.
+algorithms that you can select from: `Cell`, `Tree`, `Stencil`, `Hashed`, and
+`Cluster`.
 
 Multiple pair force objects can share a single neighbor list, or use independent
 neighbor list objects. When neighbor lists are shared, they find neighbors
@@ -339,6 +340,8 @@ class Cell(NeighborList):
             mesh to determine the bond exclusions in addition to all other
             set exclusions.
         default_r_cut
+        partial_rebuild (bool): When `True`, only rebuild the neighbors of
+            particles near those that have moved (CPU only).
 
     `Cell` finds neighboring particles using a fixed width cell list, allowing
     for *O(kN)* construction of the neighbor list where *k* is the number of
@@ -363,6 +366,18 @@ class Cell(NeighborList):
         number of cells in the system. In these cases, consider using `Stencil`
         or `Tree`, which can use less memory.
 
+    .. rubric:: Partial rebuilds
+
+    When `partial_rebuild` is `True`, `Cell` tracks how far each particle has
+    moved since its neighbors were last found. Instead of rebuilding the whole
+    list when any particle moves ``buffer/2``, it rebuilds only the neighbors of
+    particles that moved ``buffer/4``, and of the particles in cells next to
+    them. This is much faster in heterogeneous systems where a few fast (e.g.,
+    active or driven) particles move through a nearly static bulk. The whole
+    list is still rebuilt when the box changes, when more than 1/8 of the
+    particles have moved, or when the particles are domain decomposed. Partial
+    rebuilds require `check_dist` and are only implemented on the CPU.
+
     Examples::
 
         cell = nlist.Cell()
@@ -370,6 +385,9 @@ class Cell(NeighborList):
     Attributes:
         deterministic (bool): When `True`, sort neighbors to help provide
             deterministic simulation runs.
+
+        partial_rebuild (bool): When `True`, only rebuild the neighbors of
+            particles near those that have moved (CPU only).
     """
 
     def __init__(self,
@@ -379,13 +397,15 @@ class Cell(NeighborList):
                  check_dist=True,
                  deterministic=False,
                  mesh=None,
-                 default_r_cut=0.0):
+                 default_r_cut=0.0,
+                 partial_rebuild=False):
 
         super().__init__(buffer, exclusions, rebuild_check_delay, check_dist,
                          mesh, default_r_cut)
 
         self._param_dict.update(
-            ParameterDict(deterministic=bool(deterministic)))
+            ParameterDict(deterministic=bool(deterministic),
+                          partial_rebuild=bool(partial_rebuild)))
 
     def _attach_hook(self):
         if isinstance(self._simulation.device, hoomd.device.CPU):
@@ -417,13 +437,21 @@ class Cell(NeighborList):
         """
         return self._cpp_obj.getNmax()
 
+    @log(requires_run=True, default=False)
+    def num_partial_builds(self):
+        """int: The number of times the neighbor list was partially rebuilt.
+
+        Partial rebuilds are not counted in `num_builds`.
+        """
+        return self._cpp_obj.num_partial_builds
+
 
 class Stencil(NeighborList):
     """Cell list based neighbor list using stencils.
 
     Args:
-        cell_width (float): The underlying stencil bin width for the cell list
-            :math:`[\\mathrm{length}]`.
+        cell_width (float): The underlying stencil bin width for the cell list,
+            or 0 to choose it from the cutoffs :math:`[\\mathrm{length}]`.
         buffer (float): Buffer width :math:`[\\mathrm{length}]`.
         exclusions (tuple[str]): Defines which particles to exclude from the
             neighbor list, see more details in `NeighborList`.
@@ -463,6 +491,14 @@ class Stencil(NeighborList):
     *cell_width*, and when the *cell_width* covers the simulation box with a
     roughly integer number of cells.
 
+    When *cell_width* is 0 on the CPU, `Stencil` groups the particle types into
+    size classes by the shortest cutoff of each type, where the cutoffs in a
+    class differ by at most a factor of 2. Each class is binned into its own
+    cell list with a width of its shortest cutoff plus the buffer, so that the
+    small particles in a mixture with large ones are searched with small cells.
+    On the GPU, a cell width of 0 uses one cell list with a width of the
+    shortest cutoff plus the buffer.
+
     Examples::
 
         nl_s = nlist.Stencil(cell_width=1.5)
@@ -473,8 +509,8 @@ class Stencil(NeighborList):
         `Stencil` in your research.
 
     Attributes:
-        cell_width (float): The underlying stencil bin width for the cell list
-            :math:`[\\mathrm{length}]`.
+        cell_width (float): The underlying stencil bin width for the cell list,
+            or 0 to choose it from the cutoffs :math:`[\\mathrm{length}]`.
         deterministic (bool): When `True`, sort neighbors to help provide
             deterministic simulation runs.
     """
@@ -529,7 +565,9 @@ class Tree(NeighborList):
     asymmetry, but has slower performance for monodisperse systems. `Tree` can
     also be slower than `Cell` if there are multiple types in the system, but
     the cutoffs between types are identical. (This is because one BVH is created
-    per type.) The user should carefully benchmark neighbor list build times to
+    per type.) On the GPU, a single BVH of all types is created instead when the
+    cutoffs between types are identical or when there are few particles of each
+    type. The user should carefully benchmark neighbor list build times to
     select the appropriate neighbor list construction type.
 
     .. image:: tree_schematic.png
@@ -573,3 +611,136 @@ class Tree(NeighborList):
         self._cpp_obj = nlist_cls(self._simulation.state._cpp_sys_def,
                                   self.buffer)
         super()._attach_hook()
+
+
+class Hashed(NeighborList):
+    """Hashed cell list based neighbor list.
+
+    Args:
+        buffer (float): Buffer width :math:`[\\mathrm{length}]`.
+        exclusions (tuple[str]): Defines which particles to exclude from the
+            neighbor list, see more details in `NeighborList`.
+        rebuild_check_delay (int): How often to attempt to rebuild the neighbor
+            list.
+        check_dist (bool): Flag to enable / disable distance checking.
+        mesh (Mesh): When a mesh object is passed, the neighbor list uses the
+            mesh to determine the bond exclusions in addition to all other
+            set exclusions.
+        quantization (int): Number of bits used to store each coordinate of
+            the particles during the build, 0 (exact), 16, or 32 (GPU only).
+
+    `Hashed` finds neighbors in :math:`O(N)` time using cells of the same size
+    as `Cell`, but it only stores the cells that contain particles. The
+    particles are sorted by the Morton key of their cell, and the occupied
+    cells are looked up in a hash table. `Hashed`'s memory requirements scale
+    with the number of particles in the system rather than the box volume, which
+    makes it a good choice for dilute systems in large boxes (for example, a few
+    solute particles in a large `hoomd.mpcd` solvent) where most of the cells
+    of `Cell` would be empty. For dense systems, `Cell` is usually faster.
+
+    .. rubric:: Quantized coordinates
+
+    On the GPU, `Hashed` can build the list from the position of each particle
+    relative to its cell stored with `quantization` bits per coordinate instead
+    of the full positions. The smaller, contiguous records reduce the memory
+    traffic of the build. The list radius is enlarged by the largest possible
+    rounding error, so no neighbors are missed, and the pair forces are still
+    computed from the full positions. The exact build is used when the box is
+    less than 3 cells wide along a periodic direction.
+
+    Examples::
+
+        nl_h = nlist.Hashed(buffer=0.4)
+
+    Attributes:
+        quantization (int): Number of bits used to store each coordinate of
+            the particles during the build, 0 (exact), 16, or 32 (GPU only).
+    """
+
+    def __init__(self,
+                 buffer,
+                 exclusions=('bond',),
+                 rebuild_check_delay=1,
+                 check_dist=True,
+                 mesh=None,
+                 default_r_cut=0.0,
+                 quantization=0):
+
+        super().__init__(buffer, exclusions, rebuild_check_delay, check_dist,
+                         mesh, default_r_cut)
+
+        self._param_dict.update(ParameterDict(quantization=int(quantization)))
+
+    def _attach_hook(self):
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            nlist_cls = _md.NeighborListHashed
+        else:
+            nlist_cls = _md.NeighborListGPUHashed
+        self._cpp_obj = nlist_cls(self._simulation.state._cpp_sys_def,
+                                  self.buffer)
+        super()._attach_hook()
+
+
+class Cluster(NeighborList):
+    """Cell list based neighbor list grouped into cluster pairs.
+
+    Args:
+        buffer (float): Buffer width :math:`[\\mathrm{length}]`.
+        exclusions (tuple[str]): Defines which particles to exclude from the
+            neighbor list, see more details in `NeighborList`.
+        rebuild_check_delay (int): How often to attempt to rebuild the neighbor
+            list.
+        check_dist (bool): Flag to enable / disable distance checking.
+        deterministic (bool): When `True`, sort neighbors to help provide
+            deterministic simulation runs.
+        mesh (Mesh): When a mesh object is passed, the neighbor list uses the
+            mesh to determine the bond exclusions in addition to all other
+            set exclusions.
+
+    `Cluster` finds neighbors in the same way as `Cell`, and then groups the
+    particles in each cell into clusters of 4. The neighbors are stored as
+    pairs of clusters, and the pair forces in `hoomd.md.pair` evaluate each
+    cluster pair as a 4 x 4 block from positions gathered into contiguous
+    memory. This gives the compiler loops with fixed trip counts over
+    contiguous data and is faster than a per-particle list on CPUs with wide
+    vector units. Other forces that use the neighbor list see the same
+    per-particle list as with `Cell`.
+
+    On the GPU, `Cluster` builds the same list as `Cell`.
+
+    Note:
+        The anisotropic pair potentials in `hoomd.md.pair.aniso` compute
+        their forces from the per-particle list.
+
+    Examples::
+
+        cluster = nlist.Cluster(buffer=0.4)
+
+    Attributes:
+        deterministic (bool): When `True`, sort neighbors to help provide
+            deterministic simulation runs.
+    """
+
+    def __init__(self,
+                 buffer,
+                 exclusions=('bond',),
+                 rebuild_check_delay=1,
+                 check_dist=True,
+                 deterministic=False,
+                 mesh=None,
+                 default_r_cut=0.0):
+
+        super().__init__(buffer, exclusions, rebuild_check_delay, check_dist,
+                         mesh, default_r_cut)
+
+        self._param_dict.update(
+            ParameterDict(deterministic=bool(deterministic)))
+
+    def _attach_hook(self):
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            nlist_cls = _md.NeighborListCluster
+        else:
+            nlist_cls = _md.NeighborListGPUBinned
+        self._cpp_obj = nlist_cls(self._simulation.state._cpp_sys_def,
+                                  self.buffer)
+        super()._attach_hook()
@@ -140,11 +140,13 @@ from .pair import (
     ExpandedLJ,
     ExpandedGaussian,
     Yukawa,
+    LJYukawa,
     Ewald,
     Morse,
     DPD,
     DPDConservative,
     DPDLJ,
+    DPDYukawa,
     ForceShiftedLJ,
     Moliere,
     ZBL,
@@ -306,6 +306,13 @@ class ALJ(AnisotropicPair):
          - alpha = 2
          - alpha = 3
 
+    With alpha = 0, both interactions are zero beyond their WCA cutoffs, so the
+    pairs whose centers are farther apart than :math:`\lambda_{min} \sigma` and
+    whose oriented bounding boxes are farther apart than :math:`\lambda_{min}
+    \sigma_c` skip the contact point calculation. `culled_pair_fraction`
+    reports how many of the pairs within `r_cut <hoomd.md.pair.Pair.r_cut>` are
+    culled in this way.
+
     For polytopes, computing interactions using a single contact point leads to
     significant instabilities in the torques because the contact point can jump
     from one end of a face to another in an arbitrarily small time interval. To
@@ -563,3 +570,13 @@ class ALJ(AnisotropicPair):
         log shape for visualization and storage through the GSD file type.
         """
         return self._return_type_shapes()
+
+    @log(requires_run=True)
+    def culled_pair_fraction(self):
+        """float: Fraction of the neighbor pairs within ``r_cut`` that are \
+                culled by their bounding boxes.
+
+        The pairs in the current neighbor list are evaluated again on the host
+        to compute `culled_pair_fraction`, so log it infrequently.
+        """
+        return self._cpp_obj.getCulledPairFraction()
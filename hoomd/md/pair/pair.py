@@ -87,6 +87,14 @@ class Pair(force.Force):
         self.mode = mode
         self.nlist = nlist
 
+    def _tabulated_params(self, tabulate, **params):
+        """Add the table parameters and select the tabulated C++ class."""
+        if tabulate:
+            self._cpp_class_name = self._cpp_class_name.replace(
+                "PotentialPair", "PotentialPairTabulated")
+            params.update(r_min=float, r_max=float, tolerance=1e-6)
+        return params
+
     def compute_energy(self, tags1, tags2):
         r"""Compute the energy between two sets of particles.
 
@@ -454,6 +462,78 @@ class Yukawa(Pair):
         self._add_typeparam(params)
 
 
+class LJYukawa(Pair):
+    r"""Sum of the Lennard-Jones and Yukawa pair forces.
+
+    Args:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list.
+        default_r_cut (float): Default cutoff radius :math:`[\mathrm{length}]`.
+        default_r_on (float): Default turn-on radius :math:`[\mathrm{length}]`.
+        mode (str): Energy shifting/smoothing mode.
+
+    `LJYukawa` computes the sum of the `LJ` and `Yukawa` pair forces on every
+    particle in the simulation state:
+
+    .. math::
+
+        U(r) = 4 \varepsilon_\mathrm{LJ} \left[ \left(
+               \frac{\sigma}{r} \right)^{12} - \left( \frac{\sigma}{r}
+               \right)^{6} \right] + \varepsilon_\mathrm{Y} \frac{ \exp \left(
+               -\kappa r \right) }{r}
+
+    Both terms are evaluated in one pass over the neighbor list, which is
+    faster than adding separate `LJ` and `Yukawa` forces to the integrator.
+    The two terms share the cutoff radius. In the ``"shift"`` mode, each term
+    is shifted so that it is zero at the cutoff.
+
+    Example::
+
+        nl = nlist.Cell()
+        lj_yukawa = pair.LJYukawa(default_r_cut=3.0, nlist=nl)
+        lj_yukawa.params[('A', 'A')] = dict(
+            lj=dict(epsilon=1.0, sigma=1.0),
+            yukawa=dict(epsilon=2.0, kappa=0.5))
+        lj_yukawa.r_cut[('A', 'B')] = 3.0
+
+    .. py:attribute:: params
+
+        The potential parameters. The dictionary has the following keys:
+
+        * ``lj`` (`dict`, **required**) - parameters of the LJ term:
+
+          * ``epsilon`` (`float`, **required**) - energy parameter
+            :math:`\varepsilon_\mathrm{LJ}` :math:`[\mathrm{energy}]`
+          * ``sigma`` (`float`, **required**) - particle size
+            :math:`\sigma` :math:`[\mathrm{length}]`
+
+        * ``yukawa`` (`dict`, **required**) - parameters of the Yukawa term:
+
+          * ``epsilon`` (`float`, **required**) - energy parameter
+            :math:`\varepsilon_\mathrm{Y}` :math:`[\mathrm{energy}]`
+          * ``kappa`` (`float`, **required**) - scaling parameter
+            :math:`\kappa` :math:`[\mathrm{length}^{-1}]`
+
+        Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
+        `dict`]
+
+    .. py:attribute:: mode
+
+        Energy shifting/smoothing mode: ``"none"``, ``"shift"``, or ``"xplor"``.
+
+        Type: `str`
+    """
+    _cpp_class_name = "PotentialPairLJYukawa"
+
+    def __init__(self, nlist, default_r_cut=None, default_r_on=0., mode='none'):
+        super().__init__(nlist, default_r_cut, default_r_on, mode)
+        params = TypeParameter(
+            'params', 'particle_types',
+            TypeParameterDict(lj=dict(epsilon=float, sigma=float),
+                              yukawa=dict(epsilon=float, kappa=float),
+                              len_keys=2))
+        self._add_typeparam(params)
+
+
 class Ewald(Pair):
     r"""Ewald pair force.
 
@@ -935,6 +1015,102 @@ class DPDLJ(Pair):
         super()._attach_hook()
 
 
+class DPDYukawa(Pair):
+    r"""Dissipative Particle Dynamics with an added Yukawa pair force.
+
+    Args:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list.
+        kT (`hoomd.variant` or `float`): Temperature of
+            thermostat :math:`[\mathrm{energy}]`.
+        default_r_cut (float): Default cutoff radius :math:`[\mathrm{length}]`.
+        mode (str): Energy shifting mode.
+
+    `DPDYukawa` computes the `DPD` pair force and thermostat combined with the
+    `Yukawa` pair force on every particle in the simulation state:
+
+    .. math::
+        F &= F_{\mathrm{C}}(r) + F_{\mathrm{R,ij}}(r_{ij}) +
+            F_{\mathrm{D,ij}}(v_{ij}), \\
+        F_{\mathrm{C}}(r) &= \partial U / \partial r, \\
+        U(r) &= A \cdot \left( r_{\mathrm{cut}} - r \right)
+            - \frac{1}{2} \cdot \frac{A}{r_{\mathrm{cut}}} \cdot
+            \left(r_{\mathrm{cut}}^2 - r^2 \right)
+            + \varepsilon \frac{ \exp \left( -\kappa r \right) }{r},
+
+    where the random force :math:`F_{\mathrm{R,ij}}` and the dissipative force
+    :math:`F_{\mathrm{D,ij}}` are those of `DPD`.
+
+    The thermostat and both conservative terms are evaluated in one pass over
+    the neighbor list, which is faster than adding separate `DPD` and `Yukawa`
+    forces to the integrator. The random numbers are drawn for each pair
+    inside that pass, so `DPDYukawa` gives the same forces as the two separate
+    pair forces. The terms share the cutoff radius.
+
+    To use the DPD thermostat, apply the `hoomd.md.methods.ConstantVolume` or
+    `hoomd.md.methods.ConstantPressure` integration method without thermostat
+    along with `DPDYukawa` forces. Use of the DPD thermostat pair force with
+    other integrators will result in nonphysical behavior.
+
+    Example::
+
+        nl = nlist.Cell()
+        dpd_yukawa = pair.DPDYukawa(nlist=nl, kT=1.0, default_r_cut=1.0)
+        dpd_yukawa.params[('A', 'A')] = dict(
+            dpd=dict(A=25.0, gamma=4.5),
+            yukawa=dict(epsilon=2.0, kappa=0.5))
+
+    .. py:attribute:: params
+
+        The potential parameters. The dictionary has the following keys:
+
+        * ``dpd`` (`dict`, **required**) - parameters of the DPD term:
+
+          * ``A`` (`float`, **required**) - :math:`A` :math:`[\mathrm{force}]`
+          * ``gamma`` (`float`, **required**) - :math:`\gamma`
+            :math:`[\mathrm{mass} \cdot \mathrm{time}^{-1}]`
+
+        * ``yukawa`` (`dict`, **required**) - parameters of the Yukawa term:
+
+          * ``epsilon`` (`float`, **required**) - energy parameter
+            :math:`\varepsilon` :math:`[\mathrm{energy}]`
+          * ``kappa`` (`float`, **required**) - scaling parameter
+            :math:`\kappa` :math:`[\mathrm{length}^{-1}]`
+
+        Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
+        `dict`]
+
+    .. py:attribute:: mode
+
+        Energy shifting/smoothing mode: ``"none"`` or ``"shift"``.
+
+        Type: `str`
+    """
+    _cpp_class_name = "PotentialPairDPDThermoDPDYukawa"
+    _accepted_modes = ("none", "shift")
+
+    def __init__(self, nlist, kT, default_r_cut=None, mode='none'):
+        super().__init__(nlist=nlist,
+                         default_r_cut=default_r_cut,
+                         default_r_on=0,
+                         mode=mode)
+        params = TypeParameter(
+            'params', 'particle_types',
+            TypeParameterDict(dpd=dict(A=float, gamma=float),
+                              yukawa=dict(epsilon=float, kappa=float),
+                              len_keys=2))
+        self._add_typeparam(params)
+
+        d = ParameterDict(kT=hoomd.variant.Variant)
+        self._param_dict.update(d)
+
+        self.kT = kT
+
+    def _attach_hook(self):
+        """DPDYukawa uses RNGs. Warn the user if they did not set the seed."""
+        self._simulation._warn_if_seed_unset()
+        super()._attach_hook()
+
+
 class ForceShiftedLJ(Pair):
     r"""Force-shifted Lennard-Jones pair force.
 
@@ -1227,6 +1403,8 @@ class ExpandedMie(Pair):
         default_r_cut (float): Default cutoff radius :math:`[\mathrm{length}]`.
         default_r_on (float): Default turn-on radius :math:`[\mathrm{length}]`.
         mode (str): Energy shifting/smoothing mode.
+        tabulate (bool): When `True`, evaluate the force from a cubic spline
+            table of the potential.
 
     `ExpandedMie` computes the radially shifted Mie pair force on every particle
     in the simulation state:
@@ -1238,6 +1416,17 @@ class ExpandedMie(Pair):
           {\sigma}{r-\Delta}
           \right)^{m} \right]
 
+    When ``tabulate`` is `True`, the potential is sampled into a cubic spline
+    table for each pair of particle types when its parameters are set, and
+    pairs between ``r_min`` and ``r_max`` are interpolated from the table.
+    The number of points in the table is increased until the interpolated
+    energy and force match the potential to within ``tolerance`` (relative to
+    the magnitude of the value, or absolute for values smaller than 1). This
+    avoids the per-pair ``pow``/``exp`` evaluations. Pairs outside the table,
+    and all pairs when the energy is shifted and ``r_cut`` is beyond ``r_max``,
+    are evaluated analytically. Set ``r_max`` to ``r_cut`` for the best
+    performance.
+
     Example::
 
         nl = nlist.Cell()
@@ -1266,6 +1455,16 @@ class ExpandedMie(Pair):
         * ``delta`` (`float`, **required**) -
           :math:`\Delta` :math:`[\mathrm{length}]`.
 
+        When ``tabulate`` is `True`, the dictionary also has the following
+        keys:
+
+        * ``r_min`` (`float`, **required**) - first distance in the table
+          :math:`[\mathrm{length}]`
+        * ``r_max`` (`float`, **required**) - last distance in the table
+          :math:`[\mathrm{length}]`
+        * ``tolerance`` (`float`, **optional**, defaults to ``1e-6``) -
+          tolerance of the table :math:`[\mathrm{dimensionless}]`
+
         Type: `TypeParameter` [ `tuple` [``particle_type``, ``particle_type``],
         `dict`]
 
@@ -1277,16 +1476,22 @@ class ExpandedMie(Pair):
     """
     _cpp_class_name = "PotentialPairExpandedMie"
 
-    def __init__(self, nlist, default_r_cut=None, default_r_on=0., mode='none'):
+    def __init__(self,
+                 nlist,
+                 default_r_cut=None,
+                 default_r_on=0.,
+                 mode='none',
+                 tabulate=False):
 
         super().__init__(nlist, default_r_cut, default_r_on, mode)
         params = TypeParameter(
             'params', 'particle_types',
-            TypeParameterDict(epsilon=float,
-                              sigma=float,
-                              n=float,
-                              m=float,
-                              delta=float,
+            TypeParameterDict(**self._tabulated_params(tabulate,
+                                                       epsilon=float,
+                                                       sigma=float,
+                                                       n=float,
+                                                       m=float,
+                                                       delta=float),
                               len_keys=2))
 
         self._add_typeparam(params)
@@ -1381,6 +1586,8 @@ class DLVO(Pair):
         default_r_on (float): Default turn-on radius :math:`[\mathrm{length}]`.
         name (str): Name of the force instance.
         mode (str): Energy shifting mode.
+        tabulate (bool): When `True`, evaluate the force from a cubic spline
+            table of the potential.
 
     `DLVO` computes the DLVO dispersion and electrostatic interaction pair force
     on every particle in the simulation state with:
@@ -1403,6 +1610,17 @@ class DLVO(Pair):
     spherical surfaces. See "Intermolecular and Surface Forces" Israelachvili
     2011, pp. 317.
 
+    When ``tabulate`` is `True`, the potential is sampled into a cubic spline
+    table for each pair of particle types when its parameters are set, and
+    pairs between ``r_min`` and ``r_max`` are interpolated from the table.
+    The number of points in the table is increased until the interpolated
+    energy and force match the potential to within ``tolerance`` (relative to
+    the magnitude of the value, or absolute for values smaller than 1). This
+    avoids the per-pair ``pow``/``exp`` evaluations. Pairs outside the table,
+    and all pairs when the energy is shifted and ``r_cut`` is beyond ``r_max``,
+    are evaluated analytically. Set ``r_max`` to ``r_cut`` for the best
+    performance.
+
     Example::
 
         nl = hoomd.md.nlist.Cell()
@@ -1426,6 +1644,16 @@ class DLVO(Pair):
         * ``Z`` surface electric potential (`float`, **required**) - :math:`Z`
           :math:`[\mathrm{energy} \cdot \mathrm{length}^{-1}]`
 
+        When ``tabulate`` is `True`, the dictionary also has the following
+        keys:
+
+        * ``r_min`` (`float`, **required**) - first distance in the table
+          :math:`[\mathrm{length}]`
+        * ``r_max`` (`float`, **required**) - last distance in the table
+          :math:`[\mathrm{length}]`
+        * ``tolerance`` (`float`, **optional**, defaults to ``1e-6``) -
+          tolerance of the table :math:`[\mathrm{dimensionless}]`
+
         Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
         `dict`]
 
@@ -1438,7 +1666,12 @@ class DLVO(Pair):
     _cpp_class_name = "PotentialPairDLVO"
     _accepted_modes = ("none", "shift")
 
-    def __init__(self, nlist, default_r_cut=None, default_r_on=0., mode='none'):
+    def __init__(self,
+                 nlist,
+                 default_r_cut=None,
+                 default_r_on=0.,
+                 mode='none',
+                 tabulate=False):
         if mode == 'xplor':
             raise ValueError("xplor is not a valid mode for the DLVO potential")
 
@@ -1446,11 +1679,12 @@ class DLVO(Pair):
         params = TypeParameter(
             'params', 'particle_types',
             TypeParameterDict(
-                kappa=float,
-                Z=float,
-                A=float,
-                a1=float,
-                a2=float,
+                **self._tabulated_params(tabulate,
+                                         kappa=float,
+                                         Z=float,
+                                         A=float,
+                                         a1=float,
+                                         a2=float),
                 len_keys=2,
             ))
         self._add_typeparam(params)
@@ -1759,6 +1993,8 @@ class TWF(Pair):
         default_r_cut (float): Default cutoff radius :math:`[\mathrm{length}]`.
         default_r_on (float): Default turn-on radius :math:`[\mathrm{length}]`.
         mode (str): Energy shifting/smoothing mode.
+        tabulate (bool): When `True`, evaluate the force from a cubic spline
+            table of the potential.
 
     `TWF` computes the Ten-wolde Frenkel potential on all particles in the
     simulation state:
@@ -1774,6 +2010,17 @@ class TWF(Pair):
     .. _Pieter Rein ten Wolde and Daan Frenkel 1997:
        https://dx.doi.org/10.1126/science.277.5334.1975
 
+    When ``tabulate`` is `True`, the potential is sampled into a cubic spline
+    table for each pair of particle types when its parameters are set, and
+    pairs between ``r_min`` and ``r_max`` are interpolated from the table.
+    The number of points in the table is increased until the interpolated
+    energy and force match the potential to within ``tolerance`` (relative to
+    the magnitude of the value, or absolute for values smaller than 1). This
+    avoids the per-pair ``pow``/``exp`` evaluations. Pairs outside the table,
+    and all pairs when the energy is shifted and ``r_cut`` is beyond ``r_max``,
+    are evaluated analytically. Set ``r_max`` to ``r_cut`` for the best
+    performance.
+
     Example::
 
         nl = nlist.Cell()
@@ -1792,6 +2039,16 @@ class TWF(Pair):
         * ``alpha`` (`float`, **required**) -
           controls well-width :math:`\alpha` :math:`[\mathrm{dimensionless}]`
 
+        When ``tabulate`` is `True`, the dictionary also has the following
+        keys:
+
+        * ``r_min`` (`float`, **required**) - first distance in the table
+          :math:`[\mathrm{length}]`
+        * ``r_max`` (`float`, **required**) - last distance in the table
+          :math:`[\mathrm{length}]`
+        * ``tolerance`` (`float`, **optional**, defaults to ``1e-6``) -
+          tolerance of the table :math:`[\mathrm{dimensionless}]`
+
         Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
         `dict`]
 
@@ -1807,13 +2064,15 @@ class TWF(Pair):
                  nlist,
                  default_r_cut=None,
                  default_r_on=0.0,
-                 mode='none'):
+                 mode='none',
+                 tabulate=False):
         super().__init__(nlist, default_r_cut, default_r_on, mode)
         params = TypeParameter(
             'params', 'particle_types',
-            TypeParameterDict(epsilon=float,
-                              sigma=float,
-                              alpha=float,
+            TypeParameterDict(**self._tabulated_params(tabulate,
+                                                       epsilon=float,
+                                                       sigma=float,
+                                                       alpha=float),
                               len_keys=2))
         self._add_typeparam(params)
 
@@ -4,6 +4,8 @@
 import hoomd
 from hoomd.conftest import pickling_check
 import hoomd.md.alchemy
+import math
+import numpy
 import pytest
 
 _NVT_args = (hoomd.md.alchemy.methods.NVT, {
@@ -117,3 +119,45 @@ def test_pickling_potential(simulation_factory, two_particle_snapshot_factory,
     sim.operations.integrator = integrator
     sim.run(0)
     pickling_check(ljg)
+
+
+@pytest.mark.cpu
+@pytest.mark.serial
+def test_alchemical_energies(simulation_factory, two_particle_snapshot_factory):
+    d = 1.5
+    sim = simulation_factory(two_particle_snapshot_factory(dimensions=3, d=d))
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    ljg = hoomd.md.alchemy.pair.LJGauss(nlist, default_r_cut=3.0)
+    ljg.params[('A', 'A')] = dict(epsilon=1., sigma=0.5, r0=1.8)
+    integrator = hoomd.md.Integrator(dt=0.005)
+    integrator.forces.append(ljg)
+    sim.operations.integrator = integrator
+    sim.run(0)
+
+    epsilon_dof = ljg.epsilon[('A', 'A')]
+    r0_dof = ljg.r0[('A', 'A')]
+    epsilon_samples = [0.0, 0.5, 1.0, 2.0]
+    r0_samples = [1.0, 0.9, 1.0, 1.1]
+    epsilon_dof.alpha_samples = epsilon_samples
+    r0_dof.alpha_samples = r0_samples
+    alchemostat = hoomd.md.alchemy.methods.NVT(
+        period=10,
+        alchemical_dof=[epsilon_dof, r0_dof],
+        alchemical_kT=hoomd.variant.Constant(1))
+    integrator.methods.insert(0, alchemostat)
+    sim.run(0)
+
+    def energy(alpha_epsilon, alpha_r0):
+        return (1 / d**12 - (2 / d)**6 - alpha_epsilon
+                * math.exp(-(d - alpha_r0 * 1.8)**2 / (2 * 0.5**2)))
+
+    energies = ljg.alchemical_energies
+    assert len(energies) == len(epsilon_samples)
+    for energy_k, a_eps, a_r0 in zip(energies, epsilon_samples, r0_samples):
+        numpy.testing.assert_allclose(energy_k, energy(a_eps, a_r0), rtol=1e-5)
+    numpy.testing.assert_allclose(energies[2], ljg.energy, rtol=1e-5)
+
+    # the samples must have the same length
+    r0_dof.alpha_samples = [1.0]
+    with pytest.raises(RuntimeError):
+        sim.run(1)
@@ -62,6 +62,14 @@ angle_test_parameters = [
         -1 / 3,
         10 / 3,
     ),
+    (
+        hoomd.md.angle.Table,
+        dict(width=5, interpolation='cubic'),
+        dict(U=1.5 * (numpy.linspace(0, numpy.pi, 5) - numpy.pi / 2)**2,
+             tau=-3.0 * (numpy.linspace(0, numpy.pi, 5) - numpy.pi / 2)),
+        -1.5708,
+        0.4112,
+    ),
 ]
 
 
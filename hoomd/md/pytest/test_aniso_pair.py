@@ -469,6 +469,48 @@ def test_aniso_force_computes(make_two_particle_simulation,
             assert isclose(sim_torques, aniso_forces_and_energies.torques[i])
 
 
+def test_alj_culling(make_two_particle_simulation):
+    """Test that purely repulsive ALJ cubes beyond contact range are culled."""
+    alj = md.pair.aniso.ALJ(nlist=md.nlist.Cell(buffer=0.4), default_r_cut=2.5)
+    alj.params[('A', 'A')] = dict(epsilon=1.0,
+                                  sigma_i=1.0,
+                                  sigma_j=1.0,
+                                  alpha=0)
+    alj.shape['A'] = dict(vertices=[(x, y, z)
+                                    for x in (-0.5, 0.5)
+                                    for y in (-0.5, 0.5)
+                                    for z in (-0.5, 0.5)],
+                          faces=[[0, 2, 6, 4], [1, 5, 7, 3], [0, 4, 5, 1],
+                                 [2, 3, 7, 6], [0, 1, 3, 2], [4, 6, 7, 5]])
+    sim = make_two_particle_simulation(types=['A'], d=1.5, force=alj)
+    sim.run(0)
+
+    # the faces are 0.5 apart, beyond the contact cutoff 2^(1/6) * 0.15
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        snap.particles.position[0] = [0, 0, 0.1]
+        snap.particles.position[1] = [0, 0, 1.6]
+    sim.state.set_snapshot(snap)
+    sim.run(0)
+    assert alj.culled_pair_fraction == 1.0
+    energies = alj.energies
+    forces = alj.forces
+    if energies is not None:
+        np.testing.assert_array_equal(energies, 0)
+        np.testing.assert_array_equal(forces, 0)
+
+    # the faces are 0.1 apart, within the contact cutoff
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        snap.particles.position[1] = [0, 0, 1.2]
+    sim.state.set_snapshot(snap)
+    sim.run(0)
+    assert alj.culled_pair_fraction == 0.0
+    forces = alj.forces
+    if forces is not None:
+        assert forces[0][2] < 0
+
+
 @pytest.mark.parametrize('pair_potential_spec',
                          _valid_params(),
                          ids=PotentialId())
@@ -487,7 +529,8 @@ def test_pickling(make_two_particle_simulation, pair_potential_spec):
     pickling_check(pair_potential)
 
 
-def _base_expected_loggable(include_type_shapes=False):
+def _base_expected_loggable(include_type_shapes=False,
+                            include_culled_pair_fraction=False):
     base = {
         "forces": {
             "category": hoomd.logging.LoggerCategories["particle"],
@@ -515,6 +558,11 @@ def _base_expected_loggable(include_type_shapes=False):
             'category': LoggerCategories.object,
             'default': True
         }
+    if include_culled_pair_fraction:
+        base["culled_pair_fraction"] = {
+            'category': LoggerCategories.scalar,
+            'default': True
+        }
     return base
 
 
@@ -524,6 +572,6 @@ def _base_expected_loggable(include_type_shapes=False):
         md.pair.aniso.GayBerne, md.pair.aniso.Dipole,
         md.pair.aniso.ALJ), (_base_expected_loggable(True),
                              _base_expected_loggable(),
-                             _base_expected_loggable(True)))))
+                             _base_expected_loggable(True, True)))))
 def test_logging(cls, log_check_params):
     logging_check(cls, ('md', 'pair', 'aniso'), log_check_params)
@@ -171,14 +171,16 @@ def test_burst_dump(sim, tmp_path):
             assert [frame.configuration.step for frame in traj] == [0, 3, 5, 7]
 
 
-def test_burst_max_size(sim, tmp_path):
+@pytest.mark.parametrize("device_buffer", [False, True])
+def test_burst_max_size(sim, tmp_path, device_buffer):
     filename = Path(tmp_path / "temporary_test_file.gsd")
     burst_writer = hoomd.write.Burst(filename=str(filename),
                                      trigger=hoomd.trigger.Periodic(1),
                                      mode='wb',
                                      dynamic=['property', 'momentum'],
                                      max_burst_size=N_RUN_STEPS,
-                                     write_at_start=True)
+                                     write_at_start=True,
+                                     device_buffer=device_buffer)
     sim.operations.writers.append(burst_writer)
     # Run 1 extra step to fill the burst which does not include the first frame
     sim.run(N_RUN_STEPS + 1)
@@ -186,6 +188,42 @@ def test_burst_max_size(sim, tmp_path):
     check_write(sim, filename, 1)
 
 
+def test_device_buffer(sim, tmp_path):
+    filename = tmp_path / "temporary_test_file.gsd"
+    burst_writer = hoomd.write.Burst(filename=filename,
+                                     trigger=hoomd.trigger.Periodic(1),
+                                     mode='wb',
+                                     write_at_start=True,
+                                     device_buffer=True)
+    sim.operations.writers.append(burst_writer)
+    # Errors without a fixed number of frames
+    with pytest.raises(RuntimeError):
+        sim.run(0)
+
+    sim.operations.writers.clear()
+    burst_writer = hoomd.write.Burst(filename=filename,
+                                     trigger=hoomd.trigger.Periodic(1),
+                                     mode='wb',
+                                     dynamic=['property', 'momentum'],
+                                     max_burst_size=4,
+                                     write_at_start=True,
+                                     device_buffer=True)
+    sim.operations.writers.append(burst_writer)
+    sim.run(6)
+    assert len(burst_writer) == 4
+    burst_writer.max_burst_size = 2
+    assert len(burst_writer) == 2
+    burst_writer.max_burst_size = 3
+    sim.run(1)
+    assert len(burst_writer) == 3
+    burst_writer.dump()
+    assert len(burst_writer) == 0
+    burst_writer.flush()
+    if sim.device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='r') as traj:
+            assert [frame.configuration.step for frame in traj] == [0, 5, 6, 7]
+
+
 def test_burst_mode_xb(sim, tmp_path):
     filename = tmp_path / "temporary_test_file.gsd"
     if sim.device.communicator.rank == 0:
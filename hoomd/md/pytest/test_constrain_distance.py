@@ -146,3 +146,38 @@ def test_basic_simulation(simulation_factory, polymer_snapshot_factory):
                                       rtol=1e-5)
 
     autotuned_kernel_parameter_check(instance=d, activate=lambda: sim.run(1))
+
+
+def test_iterative_solver(simulation_factory, polymer_snapshot_factory):
+    """Ensure that the iterative solver matches the direct solver."""
+    positions = {}
+    for solver in ('direct', 'iterative'):
+        d = hoomd.md.constrain.Distance(solver=solver, solver_tolerance=1e-12)
+        assert d.solver == solver
+
+        sim = simulation_factory(polymer_snapshot_factory())
+        integrator = hoomd.md.Integrator(dt=0.005)
+        nve = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())
+        integrator.methods.append(nve)
+        integrator.constraints.append(d)
+        sim.operations.integrator = integrator
+
+        sim.state.thermalize_particle_momenta(filter=hoomd.filter.All(),
+                                              kT=1.0)
+        sim.run(10)
+
+        assert d.solver == solver
+        assert d.solver_tolerance == 1e-12
+
+        snap = sim.state.get_snapshot()
+        if snap.communicator.rank == 0:
+            positions[solver] = snap.particles.position.copy()
+
+    if len(positions) > 0:
+        numpy.testing.assert_allclose(positions['iterative'],
+                                      positions['direct'],
+                                      rtol=1e-6,
+                                      atol=1e-6)
+
+    with pytest.raises(ValueError):
+        d.solver = 'cg'
@@ -1,6 +1,8 @@
 # Copyright (c) 2009-2024 The Regents of the University of Michigan.
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+import ctypes
+
 import pytest
 import numpy as np
 import numpy.testing as npt
@@ -477,3 +479,49 @@ def test_force_zeroing(force_simulation_factory, two_particle_snapshot_factory):
             assert np.allclose(forces, timestep)
             assert np.allclose(torques, timestep)
             assert np.allclose(virials, timestep)
+
+
+_double_p = ctypes.POINTER(ctypes.c_double)
+_custom_function_type = ctypes.CFUNCTYPE(None, ctypes.c_uint64, ctypes.c_uint,
+                                         _double_p, _double_p, _double_p,
+                                         _double_p,
+                                         ctypes.POINTER(ctypes.c_uint),
+                                         _double_p, _double_p, _double_p,
+                                         ctypes.c_size_t, ctypes.c_void_p)
+
+
+@_custom_function_type
+def _harmonic_trap(timestep, N, box, position, velocity, orientation, tag,
+                   force, torque, virial, virial_pitch, stream):
+    for i in range(N):
+        for j in range(3):
+            force[4 * i + j] = -position[4 * i + j]
+            force[4 * i + 3] += 0.5 * position[4 * i + j]**2
+        torque[4 * i + 2] = tag[i]
+
+
+@pytest.mark.skipif(hoomd.version.floating_point_precision[0] != 64,
+                    reason="The test function takes double precision arrays")
+def test_custom_function(force_simulation_factory, lattice_snapshot_factory):
+    snap = lattice_snapshot_factory(n=4, a=2.0)
+    custom = md.force.CustomFunction(_harmonic_trap, aniso=True)
+    sim = force_simulation_factory(custom, snap)
+    sim.run(0)
+
+    forces = custom.forces
+    energies = custom.energies
+    torques = custom.torques
+    snap = sim.state.get_snapshot()
+    if sim.device.communicator.rank == 0:
+        position = snap.particles.position
+        npt.assert_allclose(forces, -position)
+        npt.assert_allclose(energies, 0.5 * np.sum(position**2, axis=1))
+        npt.assert_allclose(torques[:, 2], np.arange(snap.particles.N))
+
+
+def test_custom_function_invalid():
+    with pytest.raises(ValueError):
+        md.force.CustomFunction(_harmonic_trap, device='tpu')
+
+    with pytest.raises(TypeError):
+        md.force.CustomFunction._function_address("not a function")
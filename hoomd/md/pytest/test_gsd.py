@@ -118,6 +118,116 @@ def test_write_gsd_trigger(create_md_sim, tmp_path):
             assert [frame.configuration.step for frame in traj] == [5, 15, 25]
 
 
+def test_write_gsd_async(create_md_sim, tmp_path):
+
+    filename = tmp_path / "temporary_test_file.gsd"
+
+    sim = create_md_sim
+    gsd_writer = hoomd.write.GSD(filename=filename,
+                                 trigger=hoomd.trigger.Periodic(1),
+                                 mode='wb',
+                                 dynamic=['property', 'momentum'])
+    gsd_writer.async_queue_size = 2
+    assert gsd_writer.async_queue_size == 2
+    sim.operations.writers.append(gsd_writer)
+
+    positions = []
+    for _ in range(5):
+        sim.run(1)
+        snapshot = sim.state.get_snapshot()
+        if snapshot.communicator.rank == 0:
+            positions.append(np.array(snapshot.particles.position))
+
+    gsd_writer.flush()
+
+    if sim.device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='r') as traj:
+            assert len(traj) == 5
+            assert [frame.configuration.step for frame in traj] == [
+                1, 2, 3, 4, 5
+            ]
+            for frame, position in zip(traj, positions):
+                np.testing.assert_allclose(frame.particles.position,
+                                           position)
+
+
+def test_write_gsd_parallel_io(create_md_sim, tmp_path):
+
+    filename = tmp_path / "temporary_test_file.gsd"
+    filename_parallel = tmp_path / "temporary_test_file_parallel.gsd"
+
+    sim = create_md_sim
+    gsd_writer = hoomd.write.GSD(filename=filename,
+                                 trigger=hoomd.trigger.Periodic(1),
+                                 mode='wb',
+                                 dynamic=['property', 'momentum'])
+    gsd_writer_parallel = hoomd.write.GSD(filename=filename_parallel,
+                                          trigger=hoomd.trigger.Periodic(1),
+                                          mode='wb',
+                                          dynamic=['property', 'momentum'])
+    gsd_writer_parallel.parallel_io = True
+    assert gsd_writer_parallel.parallel_io
+    sim.operations.writers.append(gsd_writer)
+    sim.operations.writers.append(gsd_writer_parallel)
+
+    sim.run(3)
+    gsd_writer.flush()
+    gsd_writer_parallel.flush()
+
+    if sim.device.communicator.rank == 0:
+        traj = gsd.hoomd.open(name=filename, mode='r')
+        traj_parallel = gsd.hoomd.open(name=filename_parallel, mode='r')
+        assert len(traj_parallel) == len(traj)
+        for frame, frame_parallel in zip(traj, traj_parallel):
+            assert frame.particles.N == frame_parallel.particles.N
+            np.testing.assert_array_equal(frame.particles.position,
+                                          frame_parallel.particles.position)
+            np.testing.assert_array_equal(frame.particles.velocity,
+                                          frame_parallel.particles.velocity)
+            np.testing.assert_array_equal(frame.particles.typeid,
+                                          frame_parallel.particles.typeid)
+        traj.close()
+        traj_parallel.close()
+
+
+def test_write_gsd_precision(create_md_sim, tmp_path):
+
+    filename = tmp_path / "temporary_test_file.gsd"
+
+    sim = create_md_sim
+    gsd_writer = hoomd.write.GSD(filename=filename,
+                                 trigger=hoomd.trigger.Periodic(1),
+                                 mode='wb',
+                                 dynamic=['property', 'momentum'])
+    gsd_writer.position_precision = 0.01
+    gsd_writer.velocity_precision = 0.1
+    sim.operations.writers.append(gsd_writer)
+
+    sim.run(1)
+    gsd_writer.flush()
+    snapshot = sim.state.get_snapshot()
+
+    if sim.device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='r') as traj:
+            position = traj[0].particles.position
+            velocity = traj[0].particles.velocity
+
+        # the values are multiples of 2**-7 and 2**-4
+        np.testing.assert_array_equal(position * 2**7,
+                                      np.round(position * 2**7))
+        np.testing.assert_array_equal(velocity * 2**4,
+                                      np.round(velocity * 2**4))
+        np.testing.assert_allclose(position,
+                                   snapshot.particles.position,
+                                   atol=2**-8 + 1e-6)
+        np.testing.assert_allclose(velocity,
+                                   snapshot.particles.velocity,
+                                   atol=2**-5 + 1e-6)
+
+    with pytest.raises(ValueError):
+        gsd_writer.position_precision = -1
+
+
 def test_write_gsd_mode(create_md_sim, hoomd_snapshot, tmp_path,
                         simulation_factory):
 
@@ -541,3 +651,46 @@ def test_write_gsd_no_dynamic(simulation_factory, hoomd_snapshot, tmp_path):
             assert not f.chunk_exists(frame=1, name='configuration/box')
             assert not f.chunk_exists(frame=1, name='particles/N')
             assert not f.chunk_exists(frame=1, name='particles/position')
+
+
+def test_checkpoint_restart(simulation_factory, device, hoomd_snapshot,
+                            tmp_path):
+    filename = tmp_path / "checkpoint.gsd"
+
+    def npt_integrator():
+        integrator = lj_integrator()
+        mttk = hoomd.md.methods.thermostats.MTTK(kT=1.0, tau=0.5)
+        integrator.methods = [
+            hoomd.md.methods.ConstantPressure(filter=hoomd.filter.All(),
+                                              S=1.0,
+                                              tauS=1.0,
+                                              couple='xyz',
+                                              thermostat=mttk)
+        ]
+        return integrator
+
+    sim = simulation_factory(hoomd_snapshot)
+    sim.operations.integrator = npt_integrator()
+    sim.operations.writers.append(
+        hoomd.write.Checkpoint(trigger=hoomd.trigger.Periodic(10),
+                               filename=filename))
+    sim.run(10)
+
+    method = sim.operations.integrator.methods[0]
+    barostat_dof = method.barostat_dof
+    translational_dof = method.thermostat.translational_dof
+    assert barostat_dof != (0, 0, 0, 0, 0, 0)
+
+    restart = hoomd.Simulation(device=device)
+    restart.create_state_from_checkpoint(filename)
+    assert restart.timestep == 10
+    assert restart.seed == sim.seed
+    assert_equivalent_snapshots(restart.state.get_snapshot(),
+                                sim.state.get_snapshot())
+
+    restart.operations.integrator = npt_integrator()
+    restart.run(0)
+    method = restart.operations.integrator.methods[0]
+    np.testing.assert_array_equal(method.barostat_dof, barostat_dof)
+    np.testing.assert_array_equal(method.thermostat.translational_dof,
+                                  translational_dof)
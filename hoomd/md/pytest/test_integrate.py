@@ -164,3 +164,178 @@ def test_logging():
             "category": hoomd.logging.LoggerCategories.sequence
         }
     })
+
+
+def test_timestep_multiple(simulation_factory, two_particle_snapshot_factory):
+    nlist = md.nlist.Cell(buffer=0.4)
+    lj = md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+    lj.params[("A", "A")] = {"epsilon": 1.0, "sigma": 1.0}
+    assert lj.timestep_multiple == 1
+    lj.timestep_multiple = 2
+    assert lj.timestep_multiple == 2
+
+    def run_impulse(timestep_multiple):
+        sim = simulation_factory(two_particle_snapshot_factory(d=1.2))
+        lj.timestep_multiple = timestep_multiple
+        nve = md.methods.ConstantVolume(hoomd.filter.All())
+        sim.operations.integrator = md.Integrator(dt=0.001,
+                                                  methods=[nve],
+                                                  forces=[lj])
+        sim.run(2)
+        snap = sim.state.get_snapshot()
+        with pytest.raises(ValueError):
+            lj.timestep_multiple = 0
+        sim.operations.integrator = None
+        return snap
+
+    # for a slowly varying force, the impulses applied every other step
+    # approximate those applied every step
+    snap_1 = run_impulse(1)
+    snap_2 = run_impulse(2)
+    if snap_1.communicator.rank == 0:
+        numpy.testing.assert_allclose(snap_2.particles.velocity,
+                                      snap_1.particles.velocity,
+                                      rtol=1e-2)
+        assert numpy.any(snap_2.particles.velocity != 0)
+
+
+def test_overlap_ghost_updates(simulation_factory, lattice_snapshot_factory):
+    integrator = md.Integrator(dt=0.005)
+    assert not integrator.overlap_ghost_updates
+    integrator.overlap_ghost_updates = True
+    assert integrator.overlap_ghost_updates
+
+    def run(overlap_ghost_updates):
+        snap = lattice_snapshot_factory(n=8, a=1.5, r=0.1)
+        if snap.communicator.rank == 0:
+            # bond neighboring particles along x, including across domains
+            snap.bonds.types = ['A-A']
+            snap.bonds.N = snap.particles.N // 2
+            snap.bonds.group[:] = numpy.arange(snap.particles.N).reshape(
+                (-1, 2))
+        sim = simulation_factory(snap)
+        sim.seed = 2
+
+        nlist = md.nlist.Cell(buffer=0.4)
+        lj = md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+        lj.params[("A", "A")] = {"epsilon": 1.0, "sigma": 1.0}
+        harmonic = md.bond.Harmonic()
+        harmonic.params['A-A'] = dict(k=10.0, r0=1.5)
+        nve = md.methods.ConstantVolume(hoomd.filter.All())
+        sim.operations.integrator = md.Integrator(
+            dt=0.001,
+            methods=[nve],
+            forces=[lj, harmonic],
+            overlap_ghost_updates=overlap_ghost_updates)
+        sim.run(20)
+        return sim.state.get_snapshot()
+
+    # computing the interior and boundary particles separately gives the same
+    # trajectory
+    snap_1 = run(False)
+    snap_2 = run(True)
+    if snap_1.communicator.rank == 0:
+        numpy.testing.assert_allclose(snap_2.particles.position,
+                                      snap_1.particles.position,
+                                      rtol=1e-6,
+                                      atol=1e-6)
+
+
+@pytest.mark.parametrize("persistent, compress", [(True, False), (False, True),
+                                                  (True, True)])
+def test_ghost_update_modes(simulation_factory, lattice_snapshot_factory,
+                            persistent, compress):
+
+    def run(persistent, compress):
+        sim = simulation_factory(lattice_snapshot_factory(n=8, a=1.5, r=0.1))
+        sim.persistent_ghost_updates = persistent
+        sim.compress_ghost_updates = compress
+
+        nlist = md.nlist.Cell(buffer=0.4)
+        lj = md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+        lj.params[("A", "A")] = {"epsilon": 1.0, "sigma": 1.0}
+        nve = md.methods.ConstantVolume(hoomd.filter.All())
+        sim.operations.integrator = md.Integrator(dt=0.001,
+                                                  methods=[nve],
+                                                  forces=[lj])
+        sim.run(20)
+        return sim.state.get_snapshot()
+
+    # ghost positions sent as single precision offsets are accurate to well
+    # below the tolerance
+    snap_1 = run(False, False)
+    snap_2 = run(persistent, compress)
+    if snap_1.communicator.rank == 0:
+        numpy.testing.assert_allclose(snap_2.particles.position,
+                                      snap_1.particles.position,
+                                      rtol=1e-5,
+                                      atol=1e-5)
+
+
+def test_delta_ghost_updates(simulation_factory, lattice_snapshot_factory):
+
+    def run(delta):
+        snap = lattice_snapshot_factory(n=8, a=1.5, r=0.1)
+        if snap.communicator.rank == 0:
+            snap.particles.moment_inertia[:] = [1, 1, 1]
+        sim = simulation_factory(snap)
+        sim.delta_ghost_updates = delta
+
+        # DPD communicates ghost velocities and Gay-Berne ghost orientations
+        nlist = md.nlist.Cell(buffer=0.4)
+        dpd = md.pair.DPD(nlist=nlist, kT=1.0, default_r_cut=1.0)
+        dpd.params[("A", "A")] = dict(A=25.0, gamma=4.5)
+        gay_berne = md.pair.aniso.GayBerne(nlist=nlist, default_r_cut=2.5)
+        gay_berne.params[("A", "A")] = dict(epsilon=1.0, lperp=0.45, lpar=0.5)
+        nve = md.methods.ConstantVolume(hoomd.filter.All())
+        sim.operations.integrator = md.Integrator(dt=0.001,
+                                                  methods=[nve],
+                                                  forces=[dpd, gay_berne],
+                                                  integrate_rotational_dof=True)
+        sim.run(20)
+        return sim.state.get_snapshot()
+
+    # the ghosts receive the same values as with full updates
+    snap_1 = run(False)
+    snap_2 = run(True)
+    if snap_1.communicator.rank == 0:
+        numpy.testing.assert_allclose(snap_2.particles.position,
+                                      snap_1.particles.position,
+                                      rtol=1e-6,
+                                      atol=1e-6)
+        numpy.testing.assert_allclose(snap_2.particles.orientation,
+                                      snap_1.particles.orientation,
+                                      rtol=1e-6,
+                                      atol=1e-6)
+
+
+def test_ghost_shell(simulation_factory, lattice_snapshot_factory):
+
+    def run(ghost_shell):
+        sim = simulation_factory(lattice_snapshot_factory(n=10, a=1.5, r=0.1))
+        sim.ghost_shell = ghost_shell
+
+        nlist = md.nlist.Cell(buffer=0.2)
+        lj = md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+        lj.params[("A", "A")] = {"epsilon": 1.0, "sigma": 1.0}
+        nve = md.methods.ConstantVolume(hoomd.filter.All())
+        sim.operations.integrator = md.Integrator(dt=0.005,
+                                                  methods=[nve],
+                                                  forces=[lj])
+        sim.run(100)
+
+        exchanges = None
+        if sim._system_communicator is not None:
+            exchanges = sim._system_communicator.getNumGhostExchanges()
+        return sim.state.get_snapshot(), exchanges
+
+    # neighbor lists rebuilt between ghost exchanges find the same neighbors
+    snap_1, exchanges_1 = run(0.0)
+    snap_2, exchanges_2 = run(0.4)
+    if exchanges_1 is not None:
+        assert exchanges_2 <= exchanges_1
+    if snap_1.communicator.rank == 0:
+        numpy.testing.assert_allclose(snap_2.particles.position,
+                                      snap_1.particles.position,
+                                      rtol=1e-6,
+                                      atol=1e-6)
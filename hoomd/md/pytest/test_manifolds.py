@@ -3,6 +3,7 @@
 
 import hoomd
 from hoomd.conftest import pickling_check
+import numpy
 import pytest
 from copy import deepcopy
 from collections import namedtuple
@@ -15,6 +16,15 @@ def _manifold_base_params():
     manifold_base_params_list = []
     # Start with valid parameters to get the keys and placeholder values
 
+    cosine_setup_params = {'A': 1}
+    cosine_extra_params = {'p': 1, 'shift': 0}
+    cosine_changed_params = {'A': 2, 'p': 2, 'shift': 0.5}
+
+    manifold_base_params_list.extend([
+        paramtuple(cosine_setup_params, cosine_extra_params,
+                   cosine_changed_params, hoomd.md.manifold.Cosine)
+    ])
+
     cylinder_setup_params = {'r': 5}
     cylinder_extra_params = {'P': (0, 0, 0)}
     cylinder_changed_params = {'r': 4, 'P': (1.0, 0, 0)}
@@ -141,3 +151,31 @@ def test_pickling(manifold_base_params, simulation_factory,
     pickling_check(manifold)
     sim.run(0)
     pickling_check(manifold)
+
+
+def test_cosine_constraint(simulation_factory, lattice_snapshot_factory):
+    """Particles integrated with RATTLE stay on the cosine surface."""
+    A = 1.5
+    shift = -0.5
+    snap = lattice_snapshot_factory(n=4, a=2.5)
+    if snap.communicator.rank == 0:
+        L = snap.configuration.box[0]
+        x = snap.particles.position[:, 0]
+        z = A * numpy.cos(2 * numpy.pi * x / L) + shift
+        snap.particles.position[:, 2] = z
+        snap.particles.velocity[:] = [0.5, 0.2, 0]
+    sim = simulation_factory(snap)
+
+    surface = hoomd.md.manifold.Cosine(A=A, shift=shift)
+    method = hoomd.md.methods.rattle.NVE(filter=hoomd.filter.All(),
+                                         manifold_constraint=surface,
+                                         tolerance=1e-7)
+    sim.operations.integrator = hoomd.md.Integrator(0.005, methods=[method])
+    sim.run(200)
+
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        L = snap.configuration.box[0]
+        pos = snap.particles.position
+        z = A * numpy.cos(2 * numpy.pi * pos[:, 0] / L) + shift
+        numpy.testing.assert_allclose(pos[:, 2], z, atol=1e-4)
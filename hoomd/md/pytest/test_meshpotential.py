@@ -280,3 +280,112 @@ def test_auto_detach_simulation(simulation_factory, mesh_snapshot_factory):
     del integrator.forces[0]
     assert not mesh._attached
     assert mesh._cpp_obj is None
+
+
+@pytest.fixture(scope='session')
+def tetrahedron_snapshot_factory(device):
+
+    def make_snapshot(L=5):
+        s = hoomd.Snapshot(device.communicator)
+        if s.communicator.rank == 0:
+            s.configuration.box = [L, L, L, 0, 0, 0]
+            s.particles.N = 4
+            s.particles.types = ['A']
+            # shift particle positions slightly so MPI tests pass
+            s.particles.position[:] = np.array([[0.0, 0.0, 0.0],
+                                                [1.0, 0.0, 0.0],
+                                                [0.0, 1.0, 0.0],
+                                                [0.0, 0.0, 1.0]]) + 0.1
+        return s
+
+    return make_snapshot
+
+
+_tetrahedron_triangles = [[0, 2, 1], [0, 1, 3], [0, 3, 2], [1, 2, 3]]
+
+
+def _tetrahedron_bending_energy(kappa):
+    r = np.array([[0.0, 0.0, 0.0], [1.0, 0.0, 0.0], [0.0, 1.0, 0.0],
+                  [0.0, 0.0, 1.0]])
+    energy = 0
+    for a in range(4):
+        for b in range(a + 1, 4):
+            c, d = [v for v in range(4) if v not in (a, b)]
+            n1 = np.cross(r[b] - r[a], r[c] - r[a])
+            n2 = np.cross(r[d] - r[a], r[b] - r[a])
+            cos = np.dot(n1, n2) / np.linalg.norm(n1) / np.linalg.norm(n2)
+            energy += kappa / 2 * (1 - cos)
+    return energy
+
+
+def test_membrane_attributes(tetrahedron_snapshot_factory, simulation_factory):
+    mesh = hoomd.mesh.Mesh()
+    membrane = hoomd.md.mesh.membrane.Membrane(mesh,
+                                               k_area=10.0,
+                                               area0=2.0,
+                                               k_volume=20.0,
+                                               volume0=0.2)
+    membrane.params["mesh"] = dict(kappa=5.0)
+    assert membrane.params["mesh"]["kappa"] == 5.0
+    assert membrane.k_area == 10.0
+    assert membrane.volume0 == 0.2
+
+    sim = simulation_factory(tetrahedron_snapshot_factory())
+    mesh.triangulation = dict(type_ids=[0] * 4,
+                              triangles=_tetrahedron_triangles)
+    integrator = hoomd.md.Integrator(dt=0.005, forces=[membrane])
+    sim.operations.integrator = integrator
+    sim.run(0)
+
+    np.testing.assert_allclose(membrane.params["mesh"]["kappa"], 5.0)
+    np.testing.assert_allclose(membrane.k_area, 10.0)
+    np.testing.assert_allclose(membrane.area0, 2.0)
+    np.testing.assert_allclose(membrane.k_volume, 20.0)
+    np.testing.assert_allclose(membrane.volume0, 0.2)
+
+    membrane.k_area = 15.0
+    np.testing.assert_allclose(membrane.k_area, 15.0)
+
+
+@pytest.mark.parametrize("kappa, k_area, k_volume", [(5.0, 0.0, 0.0),
+                                                     (0.0, 10.0, 0.0),
+                                                     (0.0, 0.0, 20.0),
+                                                     (5.0, 10.0, 20.0)])
+def test_membrane_forces_and_energies(tetrahedron_snapshot_factory,
+                                      simulation_factory, kappa, k_area,
+                                      k_volume):
+    sim = simulation_factory(tetrahedron_snapshot_factory())
+
+    mesh = hoomd.mesh.Mesh()
+    mesh.triangulation = dict(type_ids=[0] * 4,
+                              triangles=_tetrahedron_triangles)
+
+    area0 = 2.0
+    volume0 = 0.2
+    membrane = hoomd.md.mesh.membrane.Membrane(mesh,
+                                               k_area=k_area,
+                                               area0=area0,
+                                               k_volume=k_volume,
+                                               volume0=volume0)
+    membrane.params["mesh"] = dict(kappa=kappa)
+
+    integrator = hoomd.md.Integrator(dt=0.005, forces=[membrane])
+    sim.operations.integrator = integrator
+    sim.run(0)
+
+    area = 1.5 + np.sqrt(3) / 2
+    volume = 1 / 6
+    energy = (_tetrahedron_bending_energy(kappa)
+              + k_area * (area - area0)**2 / (2 * area0)
+              + k_volume * (volume - volume0)**2 / (2 * volume0))
+
+    np.testing.assert_allclose(membrane.area, area, rtol=1e-5)
+    np.testing.assert_allclose(membrane.volume, volume, rtol=1e-5)
+
+    sim_energy = membrane.energy
+    sim_forces = membrane.forces
+    if sim.device.communicator.rank == 0:
+        np.testing.assert_allclose(sim_energy, energy, rtol=1e-5, atol=1e-6)
+        # the forces on a closed mesh do not move its center
+        np.testing.assert_allclose(np.sum(sim_forces, axis=0), [0, 0, 0],
+                                   atol=1e-5)
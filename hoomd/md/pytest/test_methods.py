@@ -1,6 +1,8 @@
 # Copyright (c) 2009-2024 The Regents of the University of Michigan.
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+import fractions
+
 import numpy as np
 import pytest
 
@@ -414,9 +416,10 @@ class TestMethods:
                       })
 
 
-@pytest.fixture(scope="function", params=range(7))
+@pytest.fixture(scope="function", params=range(8))
 def manifold(request):
     return (
+        hoomd.md.manifold.Cosine(A=1),
         hoomd.md.manifold.Cylinder(r=5),
         hoomd.md.manifold.Diamond(N=(1, 1, 1)),
         hoomd.md.manifold.Ellipsoid(a=3.3, b=5, c=4.1),
@@ -546,3 +549,51 @@ class TestRattle:
             hoomd.md.methods.rattle.NVE(filter=all_,
                                         manifold_constraint=manifold))
         assert len(sim.operations.integrator.methods) == 1
+
+
+@pytest.mark.validate
+@pytest.mark.skipif('COMPENSATED' not in hoomd.version.compile_flags,
+                    reason='Compensated integration not enabled')
+def test_compensated_position_update(simulation_factory,
+                                     two_particle_snapshot_factory):
+    """Test that Kahan summation reduces the error of the position updates.
+
+    Free particles move by the same rounded displacement on every step, so the
+    exact positions are known. Plain summation rounds every update, which
+    builds up an error of hundreds of ulps over the run.
+    """
+    snap = two_particle_snapshot_factory(d=2.2, L=20)
+    if snap.communicator.rank == 0:
+        snap.particles.velocity[:] = [[-0.1, 0, 0], [0.1, 0, 0]]
+    sim = simulation_factory(snap)
+
+    # sorting the particles resets the compensation
+    sim.operations.tuners.clear()
+
+    dt = 0.005
+    nve = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())
+    sim.operations.integrator = hoomd.md.Integrator(dt=dt, methods=[nve])
+    n_steps = 10000
+    sim.run(n_steps)
+
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        scalar = (np.float64
+                  if hoomd.version.floating_point_precision[0] == 64 else
+                  np.float32)
+        for x0, v, x in zip([-1.1, 1.1], [-0.1, 0.1],
+                            snap.particles.position[:, 0]):
+            dx = scalar(dt) * scalar(v)
+            exact = (fractions.Fraction(float(scalar(x0)))
+                     + n_steps * fractions.Fraction(float(dx)))
+
+            # the same updates with plain summation
+            x_plain = scalar(x0)
+            for i in range(n_steps):
+                x_plain = scalar(x_plain + dx)
+
+            ulp = fractions.Fraction(float(np.spacing(scalar(float(exact)))))
+            plain_error = abs(fractions.Fraction(float(x_plain)) - exact) / ulp
+            error = abs(fractions.Fraction(float(x)) - exact) / ulp
+            assert plain_error > 100
+            assert error < 10
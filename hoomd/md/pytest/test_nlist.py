@@ -10,7 +10,7 @@ import json
 import random
 import collections
 from pathlib import Path
-from hoomd.md.nlist import Cell, Stencil, Tree
+from hoomd.md.nlist import Cell, Cluster, Hashed, Stencil, Tree
 from hoomd.conftest import (logging_check, pickling_check,
                             autotuned_kernel_parameter_check)
 
@@ -32,6 +32,8 @@ def _nlist_params():
     nlists = []
     nlists.append((Cell, {}))
     nlists.append((Tree, {}))
+    nlists.append((Hashed, {}))
+    nlists.append((Cluster, {}))
     nlists.append((Stencil, dict(cell_width=0.5)))
     return nlists
 
@@ -84,9 +86,11 @@ def test_common_params(nlist_params):
 
 def test_cell_specific_params():
     nlist = Cell(buffer=0.4)
-    _assert_nlist_params(nlist, dict(deterministic=False))
+    _assert_nlist_params(nlist, dict(deterministic=False,
+                                     partial_rebuild=False))
     nlist.deterministic = True
-    _assert_nlist_params(nlist, dict(deterministic=True))
+    nlist.partial_rebuild = True
+    _assert_nlist_params(nlist, dict(deterministic=True, partial_rebuild=True))
 
 
 def test_stencil_specific_params():
@@ -100,6 +104,13 @@ def test_stencil_specific_params():
     _assert_nlist_params(nlist, dict(deterministic=True, cell_width=x))
 
 
+def test_hashed_specific_params():
+    nlist = Hashed(buffer=0.4)
+    _assert_nlist_params(nlist, dict(quantization=0))
+    nlist.quantization = 16
+    _assert_nlist_params(nlist, dict(quantization=16))
+
+
 def test_simple_simulation(nlist_params, simulation_factory,
                            lattice_snapshot_factory):
     nlist_cls, required_args = nlist_params
@@ -167,6 +178,37 @@ def test_pickling(simulation_factory, two_particle_snapshot_factory):
     pickling_check(nlist)
 
 
+@pytest.mark.serial
+def test_shrink(simulation_factory, lattice_snapshot_factory):
+    """The neighbor list releases memory when the density drops."""
+    nlist = Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=3.0)
+    lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+
+    sim = simulation_factory(lattice_snapshot_factory(n=8, a=1.0))
+    sim.operations.integrator = hoomd.md.Integrator(0.001, forces=[lj])
+    nlist.check_dist = False
+    nlist.rebuild_check_delay = 1
+    sim.run(0)
+
+    with nlist.cpu_local_nlist_arrays as data:
+        dense_size = len(data.nlist)
+
+    # expand the lattice to lower the density
+    snapshot = sim.state.get_snapshot()
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.position[:] *= 2
+        snapshot.configuration.box = [16, 16, 16, 0, 0, 0]
+    sim.state.set_snapshot(snapshot)
+
+    # the neighbor list checks for unused capacity every 100 builds
+    sim.run(101)
+
+    with nlist.cpu_local_nlist_arrays as data:
+        assert len(data.nlist) < dense_size / 2
+        assert all(data.n_neigh > 0)
+
+
 def test_cell_properties(simulation_factory, lattice_snapshot_factory):
     nlist = hoomd.md.nlist.Cell(buffer=0)
     lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.1)
@@ -191,6 +233,48 @@ def test_cell_properties(simulation_factory, lattice_snapshot_factory):
     assert nlist.allocated_particles_per_cell >= 1
 
 
+@pytest.mark.parametrize("pair_cls", [hoomd.md.pair.LJ, hoomd.md.pair.DPD])
+def test_cluster_forces(simulation_factory, lattice_snapshot_factory,
+                        pair_cls):
+    """Check that the cluster pair forces match the per-particle list."""
+    snap = lattice_snapshot_factory(n=8, a=1.05, r=0.1)
+    if snap.communicator.rank == 0:
+        snap.particles.velocity[:] = np.random.default_rng(1).normal(
+            size=(snap.particles.N, 3))
+
+    forces = []
+    energies = []
+    virials = []
+    for nlist_cls in (Cell, Cluster):
+        nlist = nlist_cls(buffer=0.4)
+        if pair_cls is hoomd.md.pair.DPD:
+            pair = pair_cls(nlist, kT=1.0, default_r_cut=1.1)
+            pair.params[('A', 'A')] = dict(A=25.0, gamma=4.5)
+        else:
+            pair = pair_cls(nlist, default_r_cut=1.1, mode='shift')
+            pair.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+        integrator = hoomd.md.Integrator(0.005)
+        integrator.forces.append(pair)
+
+        sim = simulation_factory(snap)
+        sim.operations.integrator = integrator
+        sim.operations.computes.append(
+            hoomd.md.compute.ThermodynamicQuantities(hoomd.filter.All()))
+        sim.run(0)
+
+        forces.append(pair.forces)
+        energies.append(pair.energies)
+        virials.append(pair.virials)
+
+    if forces[0] is not None:
+        np.testing.assert_allclose(forces[1], forces[0], rtol=1e-5, atol=1e-5)
+        np.testing.assert_allclose(energies[1],
+                                   energies[0],
+                                   rtol=1e-5,
+                                   atol=1e-5)
+        np.testing.assert_allclose(virials[1], virials[0], rtol=1e-5, atol=1e-5)
+
+
 def test_logging():
     base_loggables = {
         'shortest_rebuild': {
@@ -215,6 +299,10 @@ def test_logging():
                 'category': LoggerCategories.scalar,
                 'default': False
             },
+            'num_partial_builds': {
+                'category': LoggerCategories.scalar,
+                'default': False
+            },
         })
 
 
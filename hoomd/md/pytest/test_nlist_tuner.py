@@ -124,3 +124,25 @@ class TestMoveSize:
 
     def test_pickling(self, nlist_tuner, simulation):
         operation_pickling_check(nlist_tuner, simulation)
+
+
+class TestAdaptiveNeighborListBuffer:
+
+    def test_invalid_attach(self, simulation, nlist):
+        tuner = md.tune.AdaptiveNeighborListBuffer(trigger=5,
+                                                   nlist=nlist,
+                                                   maximum_buffer=0.5,
+                                                   minimum_buffer=1.0)
+        simulation.operations.tuners.append(tuner)
+        with pytest.raises(ValueError):
+            simulation.run(0)
+
+    def test_run(self, simulation, nlist):
+        tuner = md.tune.AdaptiveNeighborListBuffer(trigger=5,
+                                                   nlist=nlist,
+                                                   maximum_buffer=1.0)
+        simulation.operations.tuners.append(tuner)
+        simulation.run(50)
+        assert tuner.build_rate >= 0
+        assert tuner.pair_time >= 0
+        assert 0 <= nlist.buffer <= 1.0
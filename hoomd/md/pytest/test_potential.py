@@ -430,6 +430,14 @@ def _valid_params(particle_types=['A', 'B']):
         paramtuple(md.pair.Yukawa, dict(zip(combos, yukawa_valid_param_dicts)),
                    {}))
 
+    lj_yukawa_valid_param_dicts = [
+        dict(lj=lj, yukawa=yukawa)
+        for lj, yukawa in zip(lj_valid_param_dicts, yukawa_valid_param_dicts)
+    ]
+    valid_params_list.append(
+        paramtuple(md.pair.LJYukawa,
+                   dict(zip(combos, lj_yukawa_valid_param_dicts)), {}))
+
     ewald_arg_dict = {"alpha": [0.025, 0.05, 0.075], "kappa": [0.5, 1.0, 1.5]}
     ewald_valid_param_dicts = _make_valid_param_dicts(ewald_arg_dict)
     valid_params_list.append(
@@ -547,6 +555,14 @@ def _valid_params(particle_types=['A', 'B']):
         paramtuple(md.pair.DPD, dict(zip(combos, dpd_valid_param_dicts)),
                    {"kT": 2}))
 
+    dpd_yukawa_valid_param_dicts = [
+        dict(dpd=dpd, yukawa=yukawa)
+        for dpd, yukawa in zip(dpd_valid_param_dicts, yukawa_valid_param_dicts)
+    ]
+    valid_params_list.append(
+        paramtuple(md.pair.DPDYukawa,
+                   dict(zip(combos, dpd_yukawa_valid_param_dicts)), {"kT": 2}))
+
     dpdlj_arg_dict = {
         'sigma': [0.5, 1.0, 1.5],
         'epsilon': [0.0005, 0.001, 0.0015],
@@ -893,9 +909,9 @@ def _calculate_force(sim):
 
 def test_force_energy_relationship(device, simulation_factory,
                                    two_particle_snapshot_factory, valid_params):
-    # don't really test DPD and DPDLJ for this test
+    # don't really test DPD, DPDLJ, and DPDYukawa for this test
     pot_name = valid_params.pair_potential.__name__
-    if any(pot_name == name for name in ["DPD", "DPDLJ"]):
+    if any(pot_name == name for name in ["DPD", "DPDLJ", "DPDYukawa"]):
         pytest.skip("Cannot test force energy relationship for " + pot_name
                     + " pair force")
 
@@ -1298,6 +1314,274 @@ def test_adding_to_operations(simulation_factory,
     assert lj.energy != 0
 
 
+@pytest.mark.cpu
+@pytest.mark.skipif(not hoomd.version.tbb_enabled, reason="TBB not enabled")
+def test_threaded_forces(device, simulation_factory, lattice_snapshot_factory):
+    """Check that the threaded CPU force loop matches the serial one."""
+    snap = lattice_snapshot_factory(n=10, a=1.1, r=0.1)
+    num_cpu_threads = device.num_cpu_threads
+
+    forces = []
+    energies = []
+    try:
+        for threads in (1, 4, 4):
+            device.num_cpu_threads = threads
+            sim = simulation_factory(snap)
+            lj = md.pair.LJ(nlist=md.nlist.Cell(0.4), default_r_cut=2.5)
+            lj.params[("A", "A")] = {"sigma": 1.0, "epsilon": 1.0}
+            sim.operations.computes.append(lj)
+            sim.run(0)
+            forces.append(lj.forces)
+            energies.append(lj.energies)
+    finally:
+        device.num_cpu_threads = num_cpu_threads
+
+    if forces[0] is not None:
+        np.testing.assert_allclose(forces[1], forces[0], rtol=1e-6, atol=1e-8)
+        np.testing.assert_allclose(energies[1],
+                                   energies[0],
+                                   rtol=1e-6,
+                                   atol=1e-8)
+
+        # the result with a fixed number of threads is deterministic
+        np.testing.assert_array_equal(forces[2], forces[1])
+        np.testing.assert_array_equal(energies[2], energies[1])
+
+
+@pytest.mark.parametrize("mode", ['none', 'shift', 'xplor'])
+def test_compute_energy(simulation_factory, lattice_snapshot_factory, mode):
+    """Check the energy between two sets against a direct sum."""
+    snap = lattice_snapshot_factory(n=6, a=1.1, r=0.1)
+    sim = simulation_factory(snap)
+    lj = md.pair.LJ(nlist=md.nlist.Cell(0.4), default_r_cut=2.5, mode=mode)
+    lj.params[("A", "A")] = {"sigma": 1.0, "epsilon": 1.0}
+    lj.r_on[("A", "A")] = 2.0
+    sim.operations.computes.append(lj)
+    sim.run(0)
+
+    N = sim.state.N_particles
+    tags = np.arange(N, dtype=np.int32)
+    U = lj.compute_energy(tags1=tags[0:N:2], tags2=tags[1:N:2])
+
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        pos = snap.particles.position
+        L = snap.configuration.box[0]
+        dx = pos[0:N:2, np.newaxis, :] - pos[np.newaxis, 1:N:2, :]
+        dx -= L * np.round(dx / L)
+        rsq = np.sum(dx * dx, axis=2)
+        rsq = rsq[rsq < 2.5**2]
+
+        def V(rsq):
+            return 4 * (rsq**-6 - rsq**-3)
+
+        energy = V(rsq)
+        if mode == 'shift':
+            energy -= V(2.5**2)
+        elif mode == 'xplor':
+            r_cut_sq = 2.5**2
+            r_on_sq = 2.0**2
+            s = ((r_cut_sq - rsq)**2 * (r_cut_sq + 2 * rsq - 3 * r_on_sq)
+                 / (r_cut_sq - r_on_sq)**3)
+            energy = np.where(rsq >= r_on_sq, energy * s, energy)
+
+        assert U == pytest.approx(np.sum(energy), rel=1e-4)
+
+
+def test_tersoff_triplet_list(simulation_factory, lattice_snapshot_factory):
+    """Check that the Tersoff triplet list matches the full triplet loop."""
+    snap = lattice_snapshot_factory(particle_types=['A', 'B'],
+                                    n=5,
+                                    a=1.1,
+                                    r=0.1)
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[::2] = 1
+
+    forces = []
+    energies = []
+    virials = []
+    for triplet_list in (False, True):
+        sim = simulation_factory(snap)
+        _skip_if_triplet_gpu_mpi(sim, md.many_body.Tersoff)
+        tersoff = md.many_body.Tersoff(nlist=md.nlist.Cell(buffer=0.4),
+                                       default_r_cut=1.5,
+                                       triplet_list=triplet_list)
+        tersoff.params[('A', 'A')] = dict(magnitudes=(2.0, 1.0),
+                                          lambda3=1.0,
+                                          n=1.0,
+                                          gamma=0.5,
+                                          c=1.0,
+                                          m=0.5)
+        tersoff.params[('A', 'B')] = dict(magnitudes=(1.0, 0.5), lambda3=2.0)
+        # B-B pairs do not interact and do not enter the triplet list
+        tersoff.params[('B', 'B')] = dict(magnitudes=(0.0, 0.0))
+        assert tersoff.triplet_list == triplet_list
+
+        integrator = md.Integrator(dt=0.001)
+        integrator.forces.append(tersoff)
+        integrator.methods.append(
+            md.methods.ConstantVolume(hoomd.filter.All()))
+        sim.operations.integrator = integrator
+        sim.state.thermalize_particle_momenta(hoomd.filter.All(), kT=1.0)
+        sim.always_compute_pressure = True
+
+        # run long enough for the neighbor list to be rebuilt
+        sim.run(100)
+        forces.append(tersoff.forces)
+        energies.append(tersoff.energies)
+        virials.append(tersoff.virials)
+
+    if forces[0] is not None:
+        np.testing.assert_allclose(forces[1], forces[0], rtol=1e-5, atol=1e-8)
+        np.testing.assert_allclose(energies[1],
+                                   energies[0],
+                                   rtol=1e-5,
+                                   atol=1e-8)
+        np.testing.assert_allclose(virials[1],
+                                   virials[0],
+                                   rtol=1e-5,
+                                   atol=1e-8)
+
+
+@pytest.mark.parametrize("mode", ['none', 'shift', 'xplor'])
+def test_lj_yukawa(simulation_factory, lattice_snapshot_factory, mode):
+    """Check that LJYukawa matches separate LJ and Yukawa forces."""
+    snap = lattice_snapshot_factory(n=6, a=1.1, r=0.1)
+    sim = simulation_factory(snap)
+    nlist = md.nlist.Cell(buffer=0.4)
+
+    lj = md.pair.LJ(nlist=nlist, default_r_cut=2.5, default_r_on=2.0, mode=mode)
+    lj.params[("A", "A")] = {"sigma": 1.0, "epsilon": 1.0}
+    yukawa = md.pair.Yukawa(nlist=nlist,
+                            default_r_cut=2.5,
+                            default_r_on=2.0,
+                            mode=mode)
+    yukawa.params[("A", "A")] = {"epsilon": 2.0, "kappa": 0.5}
+    lj_yukawa = md.pair.LJYukawa(nlist=nlist,
+                                 default_r_cut=2.5,
+                                 default_r_on=2.0,
+                                 mode=mode)
+    lj_yukawa.params[("A", "A")] = {
+        "lj": {
+            "sigma": 1.0,
+            "epsilon": 1.0
+        },
+        "yukawa": {
+            "epsilon": 2.0,
+            "kappa": 0.5
+        }
+    }
+    sim.operations.computes.extend([lj, yukawa, lj_yukawa])
+    sim.run(0)
+
+    forces = lj_yukawa.forces
+    if forces is not None:
+        np.testing.assert_allclose(forces,
+                                   lj.forces + yukawa.forces,
+                                   rtol=1e-5,
+                                   atol=1e-6)
+        np.testing.assert_allclose(lj_yukawa.energies,
+                                   lj.energies + yukawa.energies,
+                                   rtol=1e-5,
+                                   atol=1e-6)
+        np.testing.assert_allclose(lj_yukawa.virials,
+                                   lj.virials + yukawa.virials,
+                                   rtol=1e-5,
+                                   atol=1e-6)
+
+
+@pytest.mark.parametrize("mode", ['none', 'shift'])
+def test_dpd_yukawa(simulation_factory, lattice_snapshot_factory, mode):
+    """Check that DPDYukawa matches separate DPD and Yukawa forces."""
+    snap = lattice_snapshot_factory(n=6, a=1.1, r=0.1)
+    if snap.communicator.rank == 0:
+        snap.particles.velocity[:] = np.random.uniform(-1, 1,
+                                                       (snap.particles.N, 3))
+    sim = simulation_factory(snap)
+    sim.seed = 7
+    nlist = md.nlist.Cell(buffer=0.4)
+
+    dpd = md.pair.DPD(nlist=nlist, kT=1.0, default_r_cut=1.5)
+    dpd.params[("A", "A")] = {"A": 25.0, "gamma": 4.5}
+    yukawa = md.pair.Yukawa(nlist=nlist, default_r_cut=1.5, mode=mode)
+    yukawa.params[("A", "A")] = {"epsilon": 2.0, "kappa": 0.5}
+    dpd_yukawa = md.pair.DPDYukawa(nlist=nlist,
+                                   kT=1.0,
+                                   default_r_cut=1.5,
+                                   mode=mode)
+    dpd_yukawa.params[("A", "A")] = {
+        "dpd": {
+            "A": 25.0,
+            "gamma": 4.5
+        },
+        "yukawa": {
+            "epsilon": 2.0,
+            "kappa": 0.5
+        }
+    }
+
+    # the thermostat needs the time step of an integrator
+    integrator = md.Integrator(dt=0.005)
+    integrator.forces.extend([dpd, yukawa, dpd_yukawa])
+    integrator.methods.append(md.methods.ConstantVolume(hoomd.filter.All()))
+    sim.operations.integrator = integrator
+    sim.run(0)
+
+    forces = dpd_yukawa.forces
+    if forces is not None:
+        np.testing.assert_allclose(forces,
+                                   dpd.forces + yukawa.forces,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+        np.testing.assert_allclose(dpd_yukawa.energies,
+                                   dpd.energies + yukawa.energies,
+                                   rtol=1e-5,
+                                   atol=1e-6)
+        np.testing.assert_allclose(dpd_yukawa.virials,
+                                   dpd.virials + yukawa.virials,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+
+
+@pytest.mark.parametrize("mode", ['none', 'shift'])
+@pytest.mark.parametrize(
+    "cls, params, a, r_min",
+    [(md.pair.ExpandedMie,
+      dict(epsilon=1.0, sigma=1.0, n=12.0, m=6.0, delta=0.5), 2.0, 1.55),
+     (md.pair.DLVO, dict(A=1.0, kappa=1.0, Z=2.0, a1=1.0, a2=1.0), 2.5, 2.05),
+     (md.pair.TWF, dict(epsilon=1.0, sigma=1.0, alpha=50.0), 1.4, 1.05)],
+    ids=lambda x: x.__name__ if isinstance(x, type) else None)
+def test_tabulated(simulation_factory, lattice_snapshot_factory, mode, cls,
+                   params, a, r_min):
+    """Check that the tabulated forces match the analytic ones."""
+    snap = lattice_snapshot_factory(n=4, a=a, r=0.1)
+    sim = simulation_factory(snap)
+    nlist = md.nlist.Cell(buffer=0.4)
+    r_cut = a + 1.0
+
+    analytic = cls(nlist=nlist, default_r_cut=r_cut, mode=mode)
+    analytic.params[("A", "A")] = params
+    tabulated = cls(nlist=nlist,
+                    default_r_cut=r_cut,
+                    mode=mode,
+                    tabulate=True)
+    tabulated.params[("A", "A")] = dict(r_min=r_min, r_max=r_cut, **params)
+    sim.operations.computes.extend([analytic, tabulated])
+    sim.run(0)
+
+    assert tabulated.params[("A", "A")]["tolerance"] == 1e-6
+    forces = tabulated.forces
+    if forces is not None:
+        np.testing.assert_allclose(forces,
+                                   analytic.forces,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+        np.testing.assert_allclose(tabulated.energies,
+                                   analytic.energies,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+
+
 def test_forces_multiple_lists(simulation_factory,
                                two_particle_snapshot_factory):
     """Test that forces added to an integrator and compute work correctly.
@@ -163,3 +163,112 @@ def test_pppm_energy(simulation_factory, two_charged_particle_snapshot_factory):
     # The reference energy is from a LAMMPS simulation. The tolerance is large
     # as the PPPM parameters do not directly map between the two codes
     numpy.testing.assert_allclose(energy, -1.0021254, rtol=1e-2)
+
+
+@pytest.mark.cpu
+def test_fft_backend(simulation_factory, two_charged_particle_snapshot_factory):
+    """Test that the FFT backends compute the same energy."""
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    ewald, coulomb = hoomd.md.long_range.pppm.make_pppm_coulomb_forces(
+        nlist=nlist, resolution=(64, 64, 64), order=6, r_cut=3.0, alpha=0)
+    assert coulomb.fft_backend == 'auto'
+
+    with pytest.raises(ValueError):
+        coulomb.fft_backend = 'not_a_backend'
+
+    sim = simulation_factory(two_charged_particle_snapshot_factory())
+    integrator = hoomd.md.Integrator(dt=0.005)
+    integrator.forces.extend([ewald, coulomb])
+    sim.operations.integrator = integrator
+
+    sim.run(0)
+    energy = coulomb.energy
+
+    coulomb.fft_backend = 'kiss'
+    assert coulomb.fft_backend == 'kiss'
+    sim.run(1)
+    numpy.testing.assert_allclose(coulomb.energy, energy, rtol=1e-5)
+
+
+def test_single_precision_mesh(simulation_factory,
+                               two_charged_particle_snapshot_factory):
+    """Test that single precision mesh arithmetic computes the same forces."""
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    ewald, coulomb = hoomd.md.long_range.pppm.make_pppm_coulomb_forces(
+        nlist=nlist, resolution=(64, 64, 64), order=6, r_cut=3.0, alpha=0)
+    assert not coulomb.single_precision_mesh
+
+    sim = simulation_factory(two_charged_particle_snapshot_factory())
+    integrator = hoomd.md.Integrator(dt=0.005)
+    integrator.forces.extend([ewald, coulomb])
+    sim.operations.integrator = integrator
+
+    sim.run(0)
+    energy = coulomb.energy
+    forces = coulomb.forces
+
+    coulomb.single_precision_mesh = True
+    assert coulomb.single_precision_mesh
+    sim.run(1)
+    numpy.testing.assert_allclose(coulomb.energy, energy, rtol=1e-4)
+    if sim.device.communicator.rank == 0:
+        numpy.testing.assert_allclose(coulomb.forces,
+                                      forces,
+                                      rtol=1e-3,
+                                      atol=1e-6)
+
+
+def test_slab_correction(simulation_factory,
+                         two_charged_particle_snapshot_factory):
+    """Test that the slab correction adds the dipole energy and forces."""
+    L = 20
+
+    def compute(Lz=L, resolution=(32, 32, 32), **kwargs):
+        snapshot = two_charged_particle_snapshot_factory(L=L)
+        if snapshot.communicator.rank == 0:
+            snapshot.configuration.box = [L, L, Lz, 0, 0, 0]
+            snapshot.particles.position[:] = [[0, 0, -1], [0, 0, 2]]
+
+        nlist = hoomd.md.nlist.Cell(buffer=0.4)
+        ewald, coulomb = hoomd.md.long_range.pppm.make_pppm_coulomb_forces(
+            nlist=nlist, resolution=resolution, order=6, r_cut=3.0, alpha=0)
+        for key, value in kwargs.items():
+            setattr(coulomb, key, value)
+
+        sim = simulation_factory(snapshot)
+        integrator = hoomd.md.Integrator(dt=0.005)
+        integrator.forces.extend([ewald, coulomb])
+        sim.operations.integrator = integrator
+        sim.run(0)
+        assert coulomb.resolution == resolution
+        return coulomb.energy, coulomb.forces
+
+    energy, forces = compute()
+    energy_slab, forces_slab = compute(slab_correction=True)
+
+    # neutral system: U = 2 pi M_z^2 / V and F_z,i = -4 pi q_i M_z / V
+    M_z = -1 * -1 + 1 * 2
+    V = L**3
+    numpy.testing.assert_allclose(energy_slab - energy,
+                                  2 * numpy.pi * M_z**2 / V,
+                                  rtol=1e-5)
+    if forces is not None:
+        dforce_z = forces_slab[:, 2] - forces[:, 2]
+        numpy.testing.assert_allclose(dforce_z,
+                                      -4 * numpy.pi * numpy.array([-1, 1])
+                                      * M_z / V,
+                                      rtol=1e-5)
+        numpy.testing.assert_allclose(forces_slab[:, 0:2], forces[:, 0:2])
+
+    # padding the mesh is equivalent to padding the box
+    energy_mesh, forces_mesh = compute(slab_correction=True,
+                                       slab_volume_factor=2.0)
+    energy_box, forces_box = compute(Lz=2 * L,
+                                     resolution=(32, 32, 64),
+                                     slab_correction=True)
+    numpy.testing.assert_allclose(energy_mesh, energy_box, rtol=1e-4)
+    if forces_mesh is not None:
+        numpy.testing.assert_allclose(forces_mesh,
+                                      forces_box,
+                                      rtol=1e-3,
+                                      atol=1e-6)
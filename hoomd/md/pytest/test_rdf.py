@@ -0,0 +1,111 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import numpy as np
+import pytest
+
+import hoomd
+from hoomd import md
+from hoomd.conftest import operation_pickling_check, logging_check
+from hoomd.error import DataAccessError
+from hoomd.logging import LoggerCategories
+
+
+def _make_simulation(simulation_factory, snapshot, nlist, pair):
+    sim = simulation_factory(snapshot)
+    forces = []
+    if pair:
+        lj = md.pair.LJ(nlist, default_r_cut=2.5)
+        lj.params[("A", "A")] = {"sigma": 1.0, "epsilon": 0.0}
+        forces.append(lj)
+    sim.operations.integrator = md.Integrator(dt=0.005, forces=forces)
+    return sim
+
+
+@pytest.mark.parametrize("dimensions", [2, 3])
+@pytest.mark.parametrize("pair", [False, True])
+def test_two_particles(simulation_factory, two_particle_snapshot_factory,
+                       dimensions, pair):
+    nlist = md.nlist.Cell(buffer=0.4)
+    # place the pair away from the bin edges
+    snap = two_particle_snapshot_factory(dimensions=dimensions, d=1.05, L=10)
+    sim = _make_simulation(simulation_factory, snap, nlist, pair)
+
+    rdf = md.compute.RadialDistributionFunction(trigger=1,
+                                                nlist=nlist,
+                                                bins=10,
+                                                r_max=2.0)
+    with pytest.raises(DataAccessError):
+        rdf.rdf
+    sim.operations.writers.append(rdf)
+    sim.run(3)
+
+    assert rdf.num_samples == 3
+    np.testing.assert_allclose(rdf.bin_centers, np.arange(10) * 0.2 + 0.1)
+
+    # both ordered pairs are in the bin [1.0, 1.2)
+    if dimensions == 2:
+        volume = 10.0**2
+        shell = np.pi * (1.2**2 - 1.0**2)
+    else:
+        volume = 10.0**3
+        shell = 4.0 / 3.0 * np.pi * (1.2**3 - 1.0**3)
+    expected = np.zeros(10)
+    expected[5] = volume / shell
+    np.testing.assert_allclose(rdf.rdf, expected, rtol=1e-5)
+
+    rdf.reset()
+    np.testing.assert_allclose(rdf.rdf, np.zeros(10))
+    sim.run(1)
+    assert rdf.num_samples == 1
+    np.testing.assert_allclose(rdf.rdf, expected, rtol=1e-5)
+
+
+def test_ideal_gas(simulation_factory, lattice_snapshot_factory):
+    """Random particles have g(r) = 1 within the statistical error."""
+    snap = lattice_snapshot_factory(n=10, a=2.0)
+    if snap.communicator.rank == 0:
+        rng = np.random.default_rng(4)
+        L = snap.configuration.box[0]
+        snap.particles.position[:] = rng.uniform(-L / 2, L / 2,
+                                                 (snap.particles.N, 3))
+    nlist = md.nlist.Cell(buffer=0.4)
+    sim = _make_simulation(simulation_factory, snap, nlist, False)
+    rdf = md.compute.RadialDistributionFunction(trigger=1,
+                                                nlist=nlist,
+                                                bins=5,
+                                                r_max=4.0)
+    sim.operations.writers.append(rdf)
+    sim.run(1)
+
+    # the outer bins hold thousands of pairs
+    np.testing.assert_allclose(rdf.rdf[2:], 1.0, atol=0.1)
+
+
+def test_pickling(simulation_factory, two_particle_snapshot_factory):
+    nlist = md.nlist.Cell(buffer=0.4)
+    sim = _make_simulation(simulation_factory,
+                           two_particle_snapshot_factory(), nlist, False)
+    rdf = md.compute.RadialDistributionFunction(trigger=1,
+                                                nlist=nlist,
+                                                bins=10,
+                                                r_max=2.0)
+    operation_pickling_check(rdf, sim)
+
+
+def test_logging():
+    logging_check(
+        hoomd.md.compute.RadialDistributionFunction, ('md', 'compute'), {
+            'rdf': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'bin_centers': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'num_samples': {
+                'category': LoggerCategories.scalar,
+                'default': True
+            },
+        })
@@ -0,0 +1,87 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+import pytest
+
+
+def test_before_attaching():
+    replica_exchange = hoomd.md.update.ReplicaExchange(
+        trigger=hoomd.trigger.Periodic(10), kT=[1.0, 1.5], P=[2.0, 3.0])
+    assert replica_exchange.kT == (1.0, 1.5)
+    assert replica_exchange.P == (2.0, 3.0)
+    assert isinstance(replica_exchange.kT_variant, hoomd.variant.Constant)
+    assert isinstance(replica_exchange.P_variant, hoomd.variant.Constant)
+
+    replica_exchange = hoomd.md.update.ReplicaExchange(
+        trigger=hoomd.trigger.Periodic(10), kT=[1.0])
+    assert replica_exchange.P is None
+    assert replica_exchange.P_variant is None
+
+    with pytest.raises(ValueError):
+        hoomd.md.update.ReplicaExchange(trigger=10, kT=[])
+
+    with pytest.raises(ValueError):
+        hoomd.md.update.ReplicaExchange(trigger=10, kT=[1.0], P=[1.0, 2.0])
+
+
+def make_replica(simulation, replica_exchange):
+    thermostat = hoomd.md.methods.thermostats.Bussi(
+        kT=replica_exchange.kT_variant)
+    nvt = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All(),
+                                          thermostat=thermostat)
+    lj = hoomd.md.pair.LJ(nlist=hoomd.md.nlist.Cell(buffer=0.4))
+    lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+    lj.r_cut[('A', 'A')] = 2.5
+    simulation.operations.integrator = hoomd.md.Integrator(dt=0.005,
+                                                           methods=[nvt],
+                                                           forces=[lj])
+    simulation.operations.updaters.append(replica_exchange)
+
+
+@pytest.mark.serial
+def test_single_partition(simulation_factory, lattice_snapshot_factory):
+    simulation = simulation_factory(lattice_snapshot_factory(n=4))
+    replica_exchange = hoomd.md.update.ReplicaExchange(
+        trigger=hoomd.trigger.Periodic(5), kT=[1.5])
+    make_replica(simulation, replica_exchange)
+
+    simulation.run(20)
+    assert replica_exchange.slot == 0
+    assert list(replica_exchange.slots) == [0]
+    assert list(replica_exchange.acceptance_ratio) == []
+    assert replica_exchange.kT_variant.value == 1.5
+
+
+@pytest.mark.serial
+def test_wrong_length(simulation_factory, lattice_snapshot_factory):
+    simulation = simulation_factory(lattice_snapshot_factory(n=4))
+    replica_exchange = hoomd.md.update.ReplicaExchange(
+        trigger=hoomd.trigger.Periodic(5), kT=[1.0, 2.0])
+    make_replica(simulation, replica_exchange)
+
+    with pytest.raises(ValueError):
+        simulation.run(0)
+
+
+def test_partitions():
+    world_communicator = hoomd.communicator.Communicator()
+    if world_communicator.num_ranks != 2:
+        pytest.skip("Requires 2 MPI ranks.")
+
+    communicator = hoomd.communicator.Communicator(ranks_per_partition=1)
+    simulation = hoomd.util.make_example_simulation(
+        device=hoomd.device.CPU(communicator=communicator))
+    replica_exchange = hoomd.md.update.ReplicaExchange(
+        trigger=hoomd.trigger.Periodic(5), kT=[1.0, 1.1])
+    make_replica(simulation, replica_exchange)
+
+    simulation.run(100)
+
+    slots = list(replica_exchange.slots)
+    assert sorted(slots) == [0, 1]
+    assert replica_exchange.slot == slots[communicator.partition]
+    assert (replica_exchange.kT_variant.value == replica_exchange.kT[
+        replica_exchange.slot])
+    assert len(replica_exchange.acceptance_ratio) == 1
+    assert 0 <= replica_exchange.acceptance_ratio[0] <= 1
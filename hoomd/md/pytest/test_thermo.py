@@ -99,6 +99,37 @@ def test_basic_system_3d(simulation_factory, two_particle_snapshot_factory):
                               [8.0 / 20.0**3, 0., 0., 0., 0., 0.], volume)
 
 
+def test_kinetic_energy_only(simulation_factory,
+                             two_particle_snapshot_factory):
+    filt = hoomd.filter.All()
+    thermo = hoomd.md.compute.ThermodynamicQuantities(filt)
+    snap = two_particle_snapshot_factory()
+    if snap.communicator.rank == 0:
+        snap.particles.velocity[:] = [[-2, 0, 0], [2, 0, 0]]
+    sim = simulation_factory(snap)
+    sim.always_compute_pressure = True
+    sim.operations.add(thermo)
+
+    integrator = hoomd.md.Integrator(dt=0.0001)
+    thermostat = hoomd.md.methods.thermostats.MTTK(kT=1.0, tau=1.0)
+    method = hoomd.md.methods.ConstantVolume(filt, thermostat)
+    integrator.methods.append(method)
+    sim.operations.integrator = integrator
+
+    sim.run(1)
+
+    # the thermostat's compute skips the quantities it does not need
+    assert method._thermo.kinetic_energy_only
+    assert method._thermo.kinetic_energy == pytest.approx(4.0)
+    assert np.isnan(method._thermo.potential_energy)
+    assert np.isnan(method._thermo.pressure)
+
+    # other computes are unaffected
+    thermo._cpp_obj.kinetic_energy_only = False
+    assert thermo.potential_energy == 0.0
+    assert thermo.pressure_tensor[0] == pytest.approx(8.0 / 20.0**3)
+
+
 def test_basic_system_2d(simulation_factory, lattice_snapshot_factory):
     filterA = hoomd.filter.Type(['A'])
     filterB = hoomd.filter.Type(['B'])
@@ -63,3 +63,48 @@ def test_logging():
                 'default': True
             }
         })
+
+
+@pytest.mark.serial
+def test_fused_thermo(simulation_factory, lattice_snapshot_factory):
+    snap = lattice_snapshot_factory(n=4, a=1.2)
+    if snap.communicator.rank == 0:
+        snap.particles.position[:] += [0.05, -0.02, 0.03]
+    sim = simulation_factory(snap)
+
+    integrator = hoomd.md.Integrator(dt=0.005)
+    lj = hoomd.md.pair.LJ(nlist=hoomd.md.nlist.Cell(buffer=0.4),
+                          default_r_cut=2.5)
+    lj.params[('A', 'A')] = dict(sigma=1, epsilon=1)
+    integrator.forces.append(lj)
+    sim.operations.integrator = integrator
+
+    filt = hoomd.filter.All()
+    thermo = hoomd.md.compute.ThermodynamicQuantities(filt)
+    separate = hoomd.md.compute.HarmonicAveragedThermodynamicQuantities(
+        filt, 1.0, 0.5)
+    fused = hoomd.md.compute.HarmonicAveragedThermodynamicQuantities(
+        filt, 1.0, 0.5, thermodynamic_quantities=thermo)
+    sim.operations.computes.extend([separate, fused])
+    sim.always_compute_pressure = True
+    sim.run(0)
+
+    # the lattice sites are the initial positions, so shift the particles
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        snap.particles.position[:] += [0.01, 0.02, -0.01]
+    sim.state.set_snapshot(snap)
+    sim.run(1)
+
+    assert fused.potential_energy == pytest.approx(separate.potential_energy,
+                                                   rel=1e-5)
+    assert fused.pressure == pytest.approx(separate.pressure, rel=1e-5)
+
+    # the fused compute requires the same group
+    other = hoomd.md.compute.HarmonicAveragedThermodynamicQuantities(
+        hoomd.filter.Type(['A']),
+        1.0,
+        thermodynamic_quantities=hoomd.md.compute.ThermodynamicQuantities(
+            filt))
+    with pytest.raises(ValueError):
+        sim.operations.computes.append(other)
@@ -262,6 +262,92 @@ def test_r_extrap(simulation, cls, params):
         assert np.all(np.any(forces != 0, axis=1))
 
 
+def _reference_lj_wall_forces(positions, walls, sigma, epsilon, r_cut):
+    """Compute the LJ wall forces by evaluating every wall for every particle.
+    """
+    forces = np.zeros_like(positions)
+    for wall in walls:
+        origin = np.array(wall.origin)
+        if isinstance(wall, hoomd.wall.Plane):
+            normal = np.array(wall.normal) / np.linalg.norm(wall.normal)
+            distance = np.dot(positions - origin, normal)
+            drv = distance[:, np.newaxis] * normal
+            active = distance > 0
+        else:
+            v = positions - origin
+            if isinstance(wall, hoomd.wall.Cylinder):
+                axis = np.array(wall.axis) / np.linalg.norm(wall.axis)
+                v = v - np.outer(np.dot(v, axis), axis)
+            distance = np.linalg.norm(v, axis=1)
+            drv = (1 - wall.radius / distance)[:, np.newaxis] * v
+            inside = distance < wall.radius
+            active = inside if wall.inside else ~inside
+        rsq = np.sum(drv * drv, axis=1)
+        active &= rsq < r_cut * r_cut
+        sr6 = (sigma * sigma / rsq[active])**3
+        force_divr = 24 * epsilon / rsq[active] * (2 * sr6 * sr6 - sr6)
+        forces[active] += force_divr[:, np.newaxis] * drv[active]
+    return forces
+
+
+def test_many_walls(simulation_factory, lattice_snapshot_factory):
+    """Test that only evaluating the walls near each particle is exact."""
+    snap = lattice_snapshot_factory(n=6, a=2.0, r=0.2)
+    sim = simulation_factory(snap)
+
+    rng = np.random.default_rng(98431)
+    walls = [
+        hoomd.wall.Plane(origin=(0, 0, -5.5), normal=(0, 0, 1)),
+        hoomd.wall.Plane(origin=(0, 0, 5.5), normal=(0, 0, -1)),
+        hoomd.wall.Cylinder(radius=5.0, origin=(0, 0, 0), axis=(0, 0, 1)),
+    ]
+    for _ in range(12):
+        walls.append(
+            hoomd.wall.Sphere(radius=0.3,
+                              origin=rng.uniform(-5, 5, size=3),
+                              inside=False))
+    for _ in range(4):
+        walls.append(
+            hoomd.wall.Cylinder(radius=0.2,
+                                origin=rng.uniform(-5, 5, size=3),
+                                axis=(1, 0, 0),
+                                inside=False))
+
+    sigma, epsilon, r_cut = 0.3, 1.0, 1.5
+    wall_pot = md.external.wall.LJ(walls)
+    wall_pot.params["A"] = dict(sigma=sigma,
+                                epsilon=epsilon,
+                                r_cut=r_cut,
+                                r_extrap=0.0)
+    sim.operations.computes.append(wall_pot)
+
+    # Also check that changes to the walls, the box, and r_cut are picked up.
+    for step in range(4):
+        if step == 1:
+            wall_pot.walls.append(
+                hoomd.wall.Sphere(radius=0.3, origin=(1, 1, 1), inside=False))
+        elif step == 2:
+            hoomd.update.BoxResize.update(sim.state, sim.state.box.scale(1.1))
+        elif step == 3:
+            r_cut = 2.5
+            wall_pot.params["A"] = dict(sigma=sigma,
+                                        epsilon=epsilon,
+                                        r_cut=r_cut,
+                                        r_extrap=0.0)
+
+        sim.run(0)
+        snapshot = sim.state.get_snapshot()
+        forces = wall_pot.forces
+        if snapshot.communicator.rank == 0:
+            reference = _reference_lj_wall_forces(snapshot.particles.position,
+                                                  wall_pot.walls, sigma,
+                                                  epsilon, r_cut)
+            np.testing.assert_allclose(forces,
+                                       reference,
+                                       rtol=1e-6,
+                                       atol=1e-6)
+
+
 # Test Logging
 @pytest.mark.parametrize(
     'cls, expected_namespace, expected_loggables',
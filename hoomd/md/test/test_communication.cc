@@ -24,6 +24,8 @@ HOOMD_UP_MAIN()
 #endif
 
 #include <algorithm>
+#include <array>
+#include <set>
 
 #define TO_TRICLINIC(v) dest_box.makeCoordinates(ref_box.makeFraction(make_scalar3(v.x, v.y, v.z)))
 #define TO_POS4(v) make_scalar4(v.x, v.y, v.z, h_pos.data[rtag].w)
@@ -3630,6 +3632,184 @@ void test_communicator_ghosts_per_type(communicator_creator comm_creator,
     }
 
 //! Communicator creator for unit tests
+#ifdef ENABLE_HIP
+//! Check the GPU bond table against a table built from scratch on the host
+/*!
+ * The order of the bonds in a row of the GPU table depends on how it was built, so the rows are
+ * compared as sets.
+ */
+void check_bond_gpu_table(std::shared_ptr<BondData> bdata, std::shared_ptr<ParticleData> pdata)
+    {
+    const unsigned int n_ptl = pdata->getN() + pdata->getNGhosts();
+    const unsigned int n_bonds = bdata->getN() + bdata->getNGhosts();
+
+    // build the reference rows of pairs of (position in bond, other member) and the bond type
+    std::vector<std::multiset<std::array<unsigned int, 3>>> ref(n_ptl);
+        {
+        ArrayHandle<unsigned int> h_rtag(pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::read);
+        for (unsigned int group_idx = 0; group_idx < n_bonds; ++group_idx)
+            {
+            const BondData::members_t g = bdata->getMembersByIndex(group_idx);
+            const unsigned int type = bdata->getTypeByIndex(group_idx);
+            const unsigned int idx_a = h_rtag.data[g.tag[0]];
+            const unsigned int idx_b = h_rtag.data[g.tag[1]];
+            UP_ASSERT(idx_a < n_ptl);
+            UP_ASSERT(idx_b < n_ptl);
+            ref[idx_a].insert(std::array<unsigned int, 3> {0, idx_b, type});
+            ref[idx_b].insert(std::array<unsigned int, 3> {1, idx_a, type});
+            }
+        }
+
+    const Index2D& gpu_table_indexer = bdata->getGPUTableIndexer();
+    ArrayHandle<BondData::members_t> h_gpu_table(bdata->getGPUTable(),
+                                                 access_location::host,
+                                                 access_mode::read);
+    ArrayHandle<unsigned int> h_gpu_pos_table(bdata->getGPUPosTable(),
+                                              access_location::host,
+                                              access_mode::read);
+    ArrayHandle<unsigned int> h_n_groups(bdata->getNGroupsArray(),
+                                         access_location::host,
+                                         access_mode::read);
+    UP_ASSERT(gpu_table_indexer.getW() >= n_ptl);
+    for (unsigned int idx = 0; idx < n_ptl; ++idx)
+        {
+        UP_ASSERT_EQUAL(h_n_groups.data[idx], ref[idx].size());
+        UP_ASSERT(h_n_groups.data[idx] <= gpu_table_indexer.getH());
+
+        std::multiset<std::array<unsigned int, 3>> row;
+        for (unsigned int j = 0; j < h_n_groups.data[idx]; ++j)
+            {
+            const BondData::members_t h = h_gpu_table.data[gpu_table_indexer(idx, j)];
+            row.insert(std::array<unsigned int, 3> {h_gpu_pos_table.data[gpu_table_indexer(idx, j)],
+                                                    h.idx[0],
+                                                    h.idx[1]});
+            }
+        UP_ASSERT(row == ref[idx]);
+        }
+    }
+
+//! Test that the GPU bond table is patched correctly after particles migrate
+/*!
+ * The bonds join particles of a simple cubic lattice into short chains along x. After the first
+ * full build, moving a single particle to another domain changes only a few groups, so the table
+ * is patched. Shifting the whole lattice by one site moves most of the groups, so the table is
+ * rebuilt. In both cases, the table should match one built from scratch.
+ */
+void test_communicator_bond_table_patch(communicator_creator comm_creator,
+                                        std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    // this test needs to be run on eight processors
+    int size;
+    MPI_Comm_size(exec_conf->getHOOMDWorldMPICommunicator(), &size);
+    UP_ASSERT_EQUAL(size, 8);
+
+    // 8 x 8 x 8 lattice with a lattice spacing of one
+    const unsigned int n = 8;
+    const BoxDim box = BoxDim(Scalar(n));
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(n * n * n, // number of particles
+                                                                  box, // box dimensions
+                                                                  1,   // number of particle types
+                                                                  2,   // number of bond types
+                                                                  0,   // number of angle types
+                                                                  0,   // number of dihedral types
+                                                                  0,   // number of dihedral types
+                                                                  exec_conf));
+
+    std::shared_ptr<ParticleData> pdata(sysdef->getParticleData());
+    std::shared_ptr<BondData> bdata(sysdef->getBondData());
+    auto tag = [n](unsigned int i, unsigned int j, unsigned int k) { return i + n * (j + n * k); };
+    for (unsigned int k = 0; k < n; ++k)
+        for (unsigned int j = 0; j < n; ++j)
+            for (unsigned int i = 0; i < n; ++i)
+                {
+                pdata->setPosition(tag(i, j, k),
+                                   make_scalar3(Scalar(i) - Scalar(n / 2) + Scalar(0.5),
+                                                Scalar(j) - Scalar(n / 2) + Scalar(0.5),
+                                                Scalar(k) - Scalar(n / 2) + Scalar(0.5)),
+                                   false);
+
+                // chains of four particles that fit inside one domain, with two bond types
+                if (i % 4 != 3)
+                    bdata->addBondedGroup(Bond((i + j) % 2, tag(i, j, k), tag(i + 1, j, k)));
+                }
+
+    SnapshotParticleData<Scalar> snap(n * n * n);
+    pdata->takeSnapshot(snap);
+
+    BondData::Snapshot bdata_snap(bdata->getNGlobal());
+    bdata->takeSnapshot(bdata_snap);
+
+    std::shared_ptr<DomainDecomposition> decomposition(
+        new DomainDecomposition(exec_conf, box.getL()));
+    std::shared_ptr<hoomd::Communicator> comm = comm_creator(sysdef, decomposition);
+
+    // communicate tags, necessary for gpu bond table
+    CommFlags flags(0);
+    flags[comm_flag::tag] = 1;
+    comm->setFlags(flags);
+
+    // width of ghost layer
+    ghost_layer_width g(0.1);
+    comm->getGhostLayerWidthRequestSignal().connect<ghost_layer_width, &ghost_layer_width::get>(g);
+
+    pdata->setDomainDecomposition(decomposition);
+    pdata->initializeFromSnapshot(snap);
+    bdata->initializeFromSnapshot(bdata_snap);
+
+    comm->migrateParticles();
+    comm->exchangeGhosts();
+
+    // every domain holds 16 whole chains, and the first build is a full one
+    UP_ASSERT_EQUAL(pdata->getN(), 64);
+    UP_ASSERT_EQUAL(bdata->getN(), 48);
+    UP_ASSERT_EQUAL(pdata->getNGhosts(), 0);
+    check_bond_gpu_table(bdata, pdata);
+
+    // move the particle with the last index on rank 0 to the neighboring domain in x, so that no
+    // other particles are reordered
+    unsigned int moved_tag = 0;
+    if (exec_conf->getRank() == 0)
+        {
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+        moved_tag = h_tag.data[pdata->getN() - 1];
+        }
+    MPI_Bcast(&moved_tag, 1, MPI_UNSIGNED, 0, exec_conf->getMPICommunicator());
+
+    Scalar3 pos = pdata->getPosition(moved_tag);
+    int3 img = make_int3(0, 0, 0);
+    pos.x += Scalar(n / 2) + Scalar(0.25);
+    box.wrap(pos, img);
+    pdata->setPosition(moved_tag, pos, false);
+
+    comm->migrateParticles();
+    comm->exchangeGhosts();
+
+    // the bonds of the moved particle now cross the domain boundary
+    check_bond_gpu_table(bdata, pdata);
+
+    // shift the lattice by one site, which moves the particles of a whole layer to another domain
+    for (unsigned int t = 0; t < n * n * n; ++t)
+        {
+        Scalar3 pos = pdata->getPosition(t);
+        int3 img = make_int3(0, 0, 0);
+        pos.x += Scalar(1.0);
+        box.wrap(pos, img);
+        pdata->setPosition(t, pos, false);
+        }
+
+    comm->migrateParticles();
+    comm->exchangeGhosts();
+    check_bond_gpu_table(bdata, pdata);
+
+    // exchanging the ghosts again after the rebuild leaves the groups in place, so it is patched
+    comm->migrateParticles();
+    comm->exchangeGhosts();
+    check_bond_gpu_table(bdata, pdata);
+    }
+#endif
+
 std::shared_ptr<hoomd::Communicator>
 base_class_communicator_creator(std::shared_ptr<SystemDefinition> sysdef,
                                 std::shared_ptr<DomainDecomposition> decomposition)
@@ -4120,6 +4300,16 @@ UP_TEST(communicator_bond_exchange_test_GPU)
         }
     }
 
+UP_TEST(communicator_bond_table_patch_test_GPU)
+    {
+    if (!exec_conf_gpu)
+        exec_conf_gpu = std::shared_ptr<ExecutionConfiguration>(
+            new ExecutionConfiguration(ExecutionConfiguration::GPU));
+
+    communicator_creator communicator_creator_gpu = bind(gpu_communicator_creator, _1, _2);
+    test_communicator_bond_table_patch(communicator_creator_gpu, exec_conf_gpu);
+    }
+
 UP_TEST(communicator_ghost_fields_test_GPU)
     {
     if (!exec_conf_gpu)
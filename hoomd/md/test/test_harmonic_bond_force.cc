@@ -396,6 +396,13 @@ void bond_force_comparison_tests(bondforce_creator bf_creator1,
         sysdef->getBondData()->addBondedGroup(Bond(0, i, i + 1));
         }
 
+    // crosslink the first particle to every tenth particle, so that it has more bonds than a
+    // particle with one bond per thread on the GPU
+    for (unsigned int i = 10; i < N; i += 10)
+        {
+        sysdef->getBondData()->addBondedGroup(Bond(0, 0, i));
+        }
+
     // compute the forces
     fc1->compute(0);
     fc2->compute(0);
@@ -10,14 +10,18 @@
 #include <memory>
 
 #include "hoomd/Initializers.h"
+#include "hoomd/SnapshotSystemData.h"
 #include "hoomd/md/NeighborList.h"
 #include "hoomd/md/NeighborListBinned.h"
+#include "hoomd/md/NeighborListCluster.h"
+#include "hoomd/md/NeighborListHashed.h"
 #include "hoomd/md/NeighborListStencil.h"
 #include "hoomd/md/NeighborListTree.h"
 
 #ifdef ENABLE_HIP
 #include "hoomd/md/NeighborListGPU.h"
 #include "hoomd/md/NeighborListGPUBinned.h"
+#include "hoomd/md/NeighborListGPUHashed.h"
 #include "hoomd/md/NeighborListGPUStencil.h"
 #include "hoomd/md/NeighborListGPUTree.h"
 #endif
@@ -1146,6 +1150,160 @@ void neighborlist_comparison_test(std::shared_ptr<ExecutionConfiguration> exec_c
         }
     }
 
+//! Test that the stencil neighbor list finds the same neighbors with one cell list per size class
+void neighborlist_stencil_size_class_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    // a mixture of small particles and a few large ones
+    RandomInitializer init(1000, Scalar(0.016778), Scalar(0.9), "A");
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap = init.getSnapshot();
+    snap->particle_data.type_mapping.push_back("B");
+    for (unsigned int i = 0; i < snap->particle_data.size; i += 10)
+        snap->particle_data.type[i] = 1;
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+
+    std::shared_ptr<NeighborList> nlist1(new NeighborListBinned(sysdef, Scalar(0.4)));
+    auto r_cut
+        = std::make_shared<GlobalArray<Scalar>>(nlist1->getTypePairIndexer().getNumElements(),
+                                                exec_conf);
+        {
+        ArrayHandle<Scalar> h_r_cut(*r_cut, access_location::host, access_mode::overwrite);
+        const Index2D& typpair_idx = nlist1->getTypePairIndexer();
+        h_r_cut.data[typpair_idx(0, 0)] = 1.0;
+        h_r_cut.data[typpair_idx(0, 1)] = 3.0;
+        h_r_cut.data[typpair_idx(1, 0)] = 3.0;
+        h_r_cut.data[typpair_idx(1, 1)] = 5.0;
+        }
+    nlist1->addRCutMatrix(r_cut);
+    nlist1->setStorageMode(NeighborList::full);
+
+    std::shared_ptr<NeighborListStencil> nlist2(new NeighborListStencil(sysdef, Scalar(0.4)));
+    nlist2->addRCutMatrix(r_cut);
+    nlist2->setStorageMode(NeighborList::full);
+
+    nlist1->compute(0);
+    nlist2->compute(0);
+
+    // the small and large particles are binned separately
+    UP_ASSERT_EQUAL(nlist2->getNumCellLists(), 2);
+
+    ArrayHandle<unsigned int> h_n_neigh1(nlist1->getNNeighArray(),
+                                         access_location::host,
+                                         access_mode::read);
+    ArrayHandle<unsigned int> h_nlist1(nlist1->getNListArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<size_t> h_head_list1(nlist1->getHeadList(),
+                                     access_location::host,
+                                     access_mode::read);
+    ArrayHandle<unsigned int> h_n_neigh2(nlist2->getNNeighArray(),
+                                         access_location::host,
+                                         access_mode::read);
+    ArrayHandle<unsigned int> h_nlist2(nlist2->getNListArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<size_t> h_head_list2(nlist2->getHeadList(),
+                                     access_location::host,
+                                     access_mode::read);
+
+    for (unsigned int i = 0; i < pdata->getN(); i++)
+        {
+        UP_ASSERT_EQUAL(h_n_neigh2.data[i], h_n_neigh1.data[i]);
+
+        std::vector<unsigned int> ref_list(h_nlist1.data + h_head_list1.data[i],
+                                           h_nlist1.data + h_head_list1.data[i]
+                                               + h_n_neigh1.data[i]);
+        std::vector<unsigned int> test_list(h_nlist2.data + h_head_list2.data[i],
+                                            h_nlist2.data + h_head_list2.data[i]
+                                                + h_n_neigh2.data[i]);
+        std::sort(ref_list.begin(), ref_list.end());
+        std::sort(test_list.begin(), test_list.end());
+        UP_ASSERT(ref_list == test_list);
+        }
+    }
+
+//! Test that the cluster pairs of NeighborListCluster hold exactly the neighbors in the list
+void neighborlist_cluster_pairs_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    // construct the particle system
+    RandomInitializer init(1000, Scalar(0.016778), Scalar(0.9), "A");
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap = init.getSnapshot();
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+
+    std::shared_ptr<NeighborListCluster> nlist(new NeighborListCluster(sysdef, Scalar(0.4)));
+    auto r_cut
+        = std::make_shared<GlobalArray<Scalar>>(nlist->getTypePairIndexer().getNumElements(),
+                                                exec_conf);
+        {
+        ArrayHandle<Scalar> h_r_cut(*r_cut, access_location::host, access_mode::overwrite);
+        h_r_cut.data[0] = 3.0;
+        }
+    nlist->addRCutMatrix(r_cut);
+    nlist->setStorageMode(NeighborList::full);
+    for (unsigned int i = 0; i < pdata->getN() - 1; i++)
+        nlist->addExclusion(i, i + 1);
+    nlist->compute(0);
+
+    const unsigned int W = NeighborListCluster::cluster_size;
+    const std::vector<unsigned int>& members = nlist->getClusterMembers();
+    const std::vector<unsigned int>& i_clusters = nlist->getIClusters();
+    const std::vector<size_t>& cluster_head = nlist->getClusterHead();
+    const std::vector<NeighborListCluster::ClusterPair>& pairs = nlist->getClusterPairs();
+    UP_ASSERT_EQUAL(cluster_head.size(), i_clusters.size() + 1);
+    UP_ASSERT_EQUAL(cluster_head.back(), pairs.size());
+
+    // every particle is in exactly one cluster
+    std::vector<unsigned int> n_found(pdata->getN(), 0);
+    for (unsigned int idx : members)
+        {
+        if (idx != NeighborListCluster::NO_PARTICLE)
+            n_found[idx]++;
+        }
+    for (unsigned int i = 0; i < pdata->getN(); ++i)
+        UP_ASSERT_EQUAL(n_found[i], 1);
+
+    // expand the cluster pairs back into neighbors of each particle
+    std::vector<std::vector<unsigned int>> expanded(pdata->getN());
+    for (size_t ci = 0; ci < i_clusters.size(); ++ci)
+        {
+        for (size_t p = cluster_head[ci]; p < cluster_head[ci + 1]; ++p)
+            {
+            UP_ASSERT(pairs[p].mask != 0);
+            for (unsigned int a = 0; a < W; ++a)
+                {
+                for (unsigned int b = 0; b < W; ++b)
+                    {
+                    if (pairs[p].mask & (1u << (a * W + b)))
+                        {
+                        const unsigned int i = members[i_clusters[ci] * W + a];
+                        const unsigned int j = members[pairs[p].cluster * W + b];
+                        UP_ASSERT(i != NeighborListCluster::NO_PARTICLE);
+                        UP_ASSERT(j != NeighborListCluster::NO_PARTICLE);
+                        expanded[i].push_back(j);
+                        }
+                    }
+                }
+            }
+        }
+
+    ArrayHandle<unsigned int> h_n_neigh(nlist->getNNeighArray(),
+                                        access_location::host,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(nlist->getNListArray(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<size_t> h_head_list(nlist->getHeadList(), access_location::host, access_mode::read);
+    for (unsigned int i = 0; i < pdata->getN(); ++i)
+        {
+        std::vector<unsigned int> ref_list(h_nlist.data + h_head_list.data[i],
+                                           h_nlist.data + h_head_list.data[i] + h_n_neigh.data[i]);
+        std::sort(ref_list.begin(), ref_list.end());
+        std::sort(expanded[i].begin(), expanded[i].end());
+        UP_ASSERT(ref_list == expanded[i]);
+        }
+    }
+
 //! Test that a NeighborList can successfully exclude a ridiculously large number of particles
 template<class NL>
 void neighborlist_large_ex_tests(std::shared_ptr<ExecutionConfiguration> exec_conf)
@@ -1513,6 +1671,100 @@ template<class NL> void neighborlist_2d_tests(std::shared_ptr<ExecutionConfigura
         }
     }
 
+//! Test that a partial rebuild of NeighborListBinned finds every pair within the cutoff
+void neighborlist_partial_rebuild_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    // construct the particle system
+    RandomInitializer init(1000, Scalar(0.016778), Scalar(0.9), "A");
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap = init.getSnapshot();
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+    const Scalar r_cut = 3.0;
+
+    std::shared_ptr<NeighborListBinned> nlist(new NeighborListBinned(sysdef, Scalar(0.4)));
+    auto r_cut_matrix
+        = std::make_shared<GlobalArray<Scalar>>(nlist->getTypePairIndexer().getNumElements(),
+                                                exec_conf);
+        {
+        ArrayHandle<Scalar> h_r_cut(*r_cut_matrix, access_location::host, access_mode::overwrite);
+        h_r_cut.data[0] = r_cut;
+        }
+    nlist->addRCutMatrix(r_cut_matrix);
+    nlist->setStorageMode(NeighborList::full);
+    nlist->setPartialRebuild(true);
+    nlist->compute(0);
+    UP_ASSERT_EQUAL(nlist->getNumUpdates(), 1);
+
+    // displace a few particles by more than r_buff/4 but less than r_buff/2
+    auto displace = [&](unsigned int N)
+    {
+        ArrayHandle<Scalar4> h_pos(pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        ArrayHandle<int3> h_image(pdata->getImages(),
+                                  access_location::host,
+                                  access_mode::readwrite);
+        const BoxDim box = pdata->getBox();
+        for (unsigned int i = 0; i < N; ++i)
+            {
+            Scalar3 pos = make_scalar3(h_pos.data[i].x + Scalar(0.15),
+                                       h_pos.data[i].y - Scalar(0.05),
+                                       h_pos.data[i].z);
+            box.wrap(pos, h_image.data[i]);
+            h_pos.data[i].x = pos.x;
+            h_pos.data[i].y = pos.y;
+            }
+    };
+
+    // repeat so that the displaced particles keep moving away from the kept rows
+    for (unsigned int step = 1; step <= 5; ++step)
+        {
+        displace(10);
+        nlist->compute(step);
+        }
+    UP_ASSERT_EQUAL(nlist->getNumUpdates(), 1);
+    UP_ASSERT_EQUAL(nlist->getNumPartialBuilds(), 5);
+
+    // every pair within the cutoff must be in the list
+        {
+        ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_n_neigh(nlist->getNNeighArray(),
+                                            access_location::host,
+                                            access_mode::read);
+        ArrayHandle<unsigned int> h_nlist(nlist->getNListArray(),
+                                          access_location::host,
+                                          access_mode::read);
+        ArrayHandle<size_t> h_head_list(nlist->getHeadList(),
+                                        access_location::host,
+                                        access_mode::read);
+        const BoxDim box = pdata->getBox();
+        for (unsigned int i = 0; i < pdata->getN(); ++i)
+            {
+            const unsigned int* begin = h_nlist.data + h_head_list.data[i];
+            const unsigned int* end = begin + h_n_neigh.data[i];
+            for (unsigned int j = 0; j < pdata->getN(); ++j)
+                {
+                if (i == j)
+                    continue;
+                const Scalar3 dr = box.minImage(
+                    make_scalar3(h_pos.data[i].x - h_pos.data[j].x,
+                                 h_pos.data[i].y - h_pos.data[j].y,
+                                 h_pos.data[i].z - h_pos.data[j].z));
+                if (dot(dr, dr) <= r_cut * r_cut)
+                    {
+                    UP_ASSERT(std::find(begin, end, j) != end);
+                    }
+                }
+            }
+        }
+
+    // displacing many particles falls back to a full rebuild
+    displace(500);
+    nlist->compute(6);
+    UP_ASSERT_EQUAL(nlist->getNumUpdates(), 2);
+    UP_ASSERT_EQUAL(nlist->getNumPartialBuilds(), 5);
+    }
+
 ///////////////
 // BINNED CPU
 ///////////////
@@ -1564,6 +1816,12 @@ UP_TEST(NeighborListBinned_2d)
     neighborlist_2d_tests<NeighborListBinned>(std::shared_ptr<ExecutionConfiguration>(
         new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
+//! partial rebuild test case for binned class
+UP_TEST(NeighborListBinned_partial_rebuild)
+    {
+    neighborlist_partial_rebuild_test(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
 
 ////////////////////
 // STENCIL CPU
@@ -1625,6 +1883,13 @@ UP_TEST(NeighborListStencil_comparison)
             new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
 
+//! size class test case for stencil class
+UP_TEST(NeighborListStencil_size_class)
+    {
+    neighborlist_stencil_size_class_test(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
 ///////////////
 // TREE CPU
 ///////////////
@@ -1684,6 +1949,106 @@ UP_TEST(NeighborListTree_comparison)
             new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
 
+///////////////
+// HASHED CPU
+///////////////
+//! basic test case for hashed class
+UP_TEST(NeighborListHashed_basic)
+    {
+    neighborlist_basic_tests<NeighborListHashed>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! exclusion test case for hashed class
+UP_TEST(NeighborListHashed_exclusion)
+    {
+    neighborlist_exclusion_tests<NeighborListHashed>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! large exclusion test case for hashed class
+UP_TEST(NeighborListHashed_large_ex)
+    {
+    neighborlist_large_ex_tests<NeighborListHashed>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! body filter test case for hashed class
+UP_TEST(NeighborListHashed_body_filter)
+    {
+    neighborlist_body_filter_tests<NeighborListHashed>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! particle asymmetry test case for hashed class
+UP_TEST(NeighborListHashed_particle_asymm)
+    {
+    neighborlist_particle_asymm_tests<NeighborListHashed>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! cutoff exclusion test case for hashed class
+UP_TEST(NeighborListHashed_cutoff_exclude)
+    {
+    neighborlist_cutoff_exclude_tests<NeighborListHashed>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! type test case for hashed class
+UP_TEST(NeighborListHashed_type)
+    {
+    neighborlist_type_tests<NeighborListHashed>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! 2d tests for hashed class
+UP_TEST(NeighborListHashed_2d)
+    {
+    neighborlist_2d_tests<NeighborListHashed>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! comparison test case for hashed class
+UP_TEST(NeighborListHashed_comparison)
+    {
+    neighborlist_comparison_test<NeighborListBinned, NeighborListHashed>(
+        std::shared_ptr<ExecutionConfiguration>(
+            new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
+///////////////
+// CLUSTER CPU
+///////////////
+//! basic test case for cluster class
+UP_TEST(NeighborListCluster_basic)
+    {
+    neighborlist_basic_tests<NeighborListCluster>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! exclusion test case for cluster class
+UP_TEST(NeighborListCluster_exclusion)
+    {
+    neighborlist_exclusion_tests<NeighborListCluster>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! body filter test case for cluster class
+UP_TEST(NeighborListCluster_body_filter)
+    {
+    neighborlist_body_filter_tests<NeighborListCluster>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! 2D test case for cluster class
+UP_TEST(NeighborListCluster_2d)
+    {
+    neighborlist_2d_tests<NeighborListCluster>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! comparison test case for cluster class
+UP_TEST(NeighborListCluster_comparison)
+    {
+    neighborlist_comparison_test<NeighborListBinned, NeighborListCluster>(
+        std::shared_ptr<ExecutionConfiguration>(
+            new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! cluster pair test case for cluster class
+UP_TEST(NeighborListCluster_cluster_pairs)
+    {
+    neighborlist_cluster_pairs_test(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
 #ifdef ENABLE_HIP
 ///////////////
 // BINNED GPU
@@ -1887,4 +2252,119 @@ UP_TEST(NeighborListGPUTree_binned_comparison)
         new ExecutionConfiguration(ExecutionConfiguration::GPU));
     neighborlist_comparison_test<NeighborListGPUBinned, NeighborListGPUTree>(exec_conf);
     }
+
+///////////////
+// HASHED GPU
+///////////////
+//! GPUHashed class that builds the list with quantized coordinates
+template<unsigned int bits> class NeighborListGPUHashedQuantized : public NeighborListGPUHashed
+    {
+    public:
+    NeighborListGPUHashedQuantized(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff)
+        : NeighborListGPUHashed(sysdef, r_buff)
+        {
+        setQuantization(bits);
+        }
+    };
+
+//! basic test case for GPUHashed class
+UP_TEST(NeighborListGPUHashed_basic)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    neighborlist_basic_tests<NeighborListGPUHashed>(exec_conf);
+    }
+//! exclusion test case for GPUHashed class
+UP_TEST(NeighborListGPUHashed_exclusion)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    neighborlist_exclusion_tests<NeighborListGPUHashed>(exec_conf);
+    }
+//! large exclusion test case for GPUHashed class
+UP_TEST(NeighborListGPUHashed_large_ex)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    neighborlist_large_ex_tests<NeighborListGPUHashed>(exec_conf);
+    }
+//! body filter test case for GPUHashed class
+UP_TEST(NeighborListGPUHashed_body_filter)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    neighborlist_body_filter_tests<NeighborListGPUHashed>(exec_conf);
+    }
+//! particle asymmetry test case for GPUHashed class
+UP_TEST(NeighborListGPUHashed_particle_asymm)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    neighborlist_particle_asymm_tests<NeighborListGPUHashed>(exec_conf);
+    }
+//! cutoff exclusion test case for GPUHashed class
+UP_TEST(NeighborListGPUHashed_cutoff_exclude)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    neighborlist_cutoff_exclude_tests<NeighborListGPUHashed>(exec_conf);
+    }
+//! type test case for hashed class
+UP_TEST(NeighborListGPUHashed_type)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    neighborlist_type_tests<NeighborListGPUHashed>(exec_conf);
+    }
+//! 2d tests for hashed class
+UP_TEST(NeighborListGPUHashed_2d)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    neighborlist_2d_tests<NeighborListGPUHashed>(exec_conf);
+    }
+//! comparison test case for GPUHashed class with itself
+UP_TEST(NeighborListGPUHashed_cpu_comparison)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    neighborlist_comparison_test<NeighborListHashed, NeighborListGPUHashed>(exec_conf);
+    }
+//! comparison test case for GPUHashed class with GPUBinned
+UP_TEST(NeighborListGPUHashed_binned_comparison)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    neighborlist_comparison_test<NeighborListGPUBinned, NeighborListGPUHashed>(exec_conf);
+    }
+//! basic test case for GPUHashed class with 16 bit quantized coordinates
+UP_TEST(NeighborListGPUHashed_quantized_basic)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    neighborlist_basic_tests<NeighborListGPUHashedQuantized<16>>(exec_conf);
+    }
+//! 2d test case for GPUHashed class with 16 bit quantized coordinates
+UP_TEST(NeighborListGPUHashed_quantized_2d)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    neighborlist_2d_tests<NeighborListGPUHashedQuantized<16>>(exec_conf);
+    }
+//! comparison test case for GPUHashed class with 16 bit quantized coordinates
+UP_TEST(NeighborListGPUHashed_quantized16_comparison)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    neighborlist_comparison_test<NeighborListGPUHashed, NeighborListGPUHashedQuantized<16>>(
+        exec_conf);
+    }
+//! comparison test case for GPUHashed class with 32 bit quantized coordinates
+UP_TEST(NeighborListGPUHashed_quantized32_comparison)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    neighborlist_comparison_test<NeighborListGPUHashed, NeighborListGPUHashedQuantized<32>>(
+        exec_conf);
+    }
 #endif
@@ -14,6 +14,7 @@ from hoomd.data.typeconverter import OnlyTypes, SetOnce
 import hoomd.logging
 import hoomd.tune
 import hoomd.trigger
+from hoomd.md import _md
 from hoomd.md.nlist import NeighborList
 
 
@@ -338,3 +339,100 @@ class NeighborListBuffer(hoomd.tune.custom_tuner._InternalCustomTuner):
             hoomd.tune.GridOptimizer(n_bins, n_rounds, True),
             maximum_buffer=maximum_buffer,
         )
+
+
+class AdaptiveNeighborListBuffer(hoomd.operation.Tuner):
+    """Continuously adjust the neighbor list buffer from measured costs.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps on which to
+            adjust the buffer.
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list instance to tune.
+        maximum_buffer (float): The largest buffer value to allow
+            :math:`[\\mathrm{length}]`.
+        minimum_buffer (`float`, optional): The smallest buffer value to allow
+            (defaults to 0) :math:`[\\mathrm{length}]`.
+
+    `AdaptiveNeighborListBuffer` reads the timers of the neighbor list and of
+    the forces in the integrator that use it. Between two adjustments, it
+    measures the time per neighbor list build, the number of builds per step,
+    and the time per step that the forces take outside of the builds. The force
+    time is modeled as proportional to the volume of the search sphere and the
+    number of builds as inversely proportional to the buffer, and the buffer is
+    moved halfway toward the minimum of their sum. The buffer follows changes in
+    density (e.g. during compression) within a few adjustments, unlike
+    `NeighborListBuffer`, which compares the TPS of whole tuning intervals.
+
+    On the GPU, the times of the GPU work are used when
+    `hoomd.device.GPU.operation_gpu_timing` is set. Otherwise, the wall
+    clock times are used, which only include the GPU work that the host waits
+    for.
+
+    The forces that use `nlist` are found when the tuner is attached. Add the
+    tuner after the forces are added to the integrator.
+
+    Attributes:
+        trigger (hoomd.trigger.Trigger): Select the timesteps on which to
+            adjust the buffer.
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list instance to tune.
+        maximum_buffer (float): The largest buffer value to allow
+            :math:`[\\mathrm{length}]`.
+        minimum_buffer (float): The smallest buffer value to allow
+            :math:`[\\mathrm{length}]`.
+
+    Example::
+
+        tuner = hoomd.md.tune.AdaptiveNeighborListBuffer(
+            trigger=hoomd.trigger.Periodic(100),
+            nlist=nlist,
+            maximum_buffer=1.0)
+        simulation.operations.tuners.append(tuner)
+    """
+
+    def __init__(self, trigger, nlist, maximum_buffer, minimum_buffer=0.0):
+        super().__init__(trigger)
+        param_dict = hoomd.data.parameterdicts.ParameterDict(
+            nlist=SetOnce(NeighborList),
+            maximum_buffer=float,
+            minimum_buffer=float)
+        param_dict.update({
+            "nlist": nlist,
+            "maximum_buffer": maximum_buffer,
+            "minimum_buffer": minimum_buffer
+        })
+        self._param_dict.update(param_dict)
+
+    def _attach_hook(self):
+        if not self.nlist._attached:
+            raise RuntimeError("The neighbor list must be attached first.")
+
+        integrator = self._simulation.operations.integrator
+        forces = []
+        if integrator is not None:
+            forces = [
+                force._cpp_obj
+                for force in integrator.forces
+                if getattr(force, "nlist", None) is self.nlist
+            ]
+        self._cpp_obj = _md.NeighborListBufferTuner(
+            self._simulation.state._cpp_sys_def, self.trigger,
+            self.nlist._cpp_obj, forces, self.minimum_buffer,
+            self.maximum_buffer)
+
+    @hoomd.logging.log(requires_run=True)
+    def build_time(self):
+        """float: Time per neighbor list build in the last interval \
+        :math:`[\\mathrm{s}]`."""
+        return self._cpp_obj.build_time
+
+    @hoomd.logging.log(requires_run=True)
+    def pair_time(self):
+        """float: Time per step of the forces outside of the neighbor list \
+        builds in the last interval :math:`[\\mathrm{s}]`."""
+        return self._cpp_obj.pair_time
+
+    @hoomd.logging.log(requires_run=True)
+    def build_rate(self):
+        """float: Number of neighbor list builds per step in the last \
+        interval."""
+        return self._cpp_obj.build_rate
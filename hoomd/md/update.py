@@ -1,7 +1,12 @@
 # Copyright (c) 2009-2024 The Regents of the University of Michigan.
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
-"""MD updaters."""
+"""MD updaters.
+
+.. invisible-code-block: python
+
+    simulation = hoomd.util.make_example_simulation()
+"""
 
 from hoomd.md import _md
 import hoomd
@@ -36,9 +41,6 @@ class ZeroMomentum(Updater):
     where the index :math:`i` includes only free and central particles (and
     excludes consitutent particles of rigid bodies).
 
-    Note:
-        `ZeroMomentum` executes on the CPU even when using a GPU device.
-
     Examples::
 
         zero_momentum = hoomd.md.update.ZeroMomentum(
@@ -51,8 +53,13 @@ class ZeroMomentum(Updater):
 
     def _attach_hook(self):
         # create the c++ mirror class
-        self._cpp_obj = _md.ZeroMomentumUpdater(
-            self._simulation.state._cpp_sys_def, self.trigger)
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            cpp_class = _md.ZeroMomentumUpdater
+        else:
+            cpp_class = _md.ZeroMomentumUpdaterGPU
+
+        self._cpp_obj = cpp_class(self._simulation.state._cpp_sys_def,
+                                  self.trigger)
 
 
 class ReversePerturbationFlow(Updater):
@@ -301,3 +308,153 @@ class ActiveRotationalDiffusion(Updater):
         if attr == "active_force":
             raise ValueError("active_force is not settable after construction.")
         super()._setattr_param(attr, value)
+
+
+class ReplicaExchange(Updater):
+    r"""Exchange temperatures and pressures between replicas in partitions.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to attempt
+            exchanges.
+        kT (`list` [`float`]): Temperature of each slot in the ladder, one per
+            partition :math:`[\mathrm{energy}]`.
+        P (`list` [`float`]): Pressure of each slot in the ladder, one per
+            partition. Set to `None` for constant volume replicas
+            :math:`[\mathrm{pressure}]`.
+
+    `ReplicaExchange` implements parallel tempering over the partitions of a
+    `hoomd.communicator.Communicator`. Each partition simulates one replica that
+    occupies a slot :math:`i` of the ladder. On each triggered time step, the
+    updater attempts to swap the slots of the replicas :math:`a` and :math:`b`
+    that occupy neighboring slots :math:`i` and :math:`j = i + 1` with the
+    probability:
+
+    .. math::
+
+        p = \min \left(1, e^{(\beta_i - \beta_j)(U_a - U_b)
+                        + (\beta_i P_i - \beta_j P_j)(V_a - V_b)} \right)
+
+    where :math:`\beta = 1 / kT`, :math:`U` is the potential energy, and
+    :math:`V` is the volume. The attempts alternate between pairs that start on
+    even and odd slots.
+
+    The configurations stay in their partitions. Instead, the updater sets
+    `kT_variant` (and `P_variant`) to the values of the new slot and rescales
+    the particle momenta by :math:`\sqrt{kT_\mathrm{new} / kT_\mathrm{old}}`.
+    Pass `kT_variant` to the thermostat (and `P_variant` to the barostat) of
+    the integration method in every partition. The only communication is one
+    collective of a few scalars per rank.
+
+    Important:
+        Add `ReplicaExchange` with the same parameters and trigger to the
+        simulation in every partition and run the same number of steps in each
+        partition.
+
+    Note:
+        `ReplicaExchange` does not reset the thermostat and barostat degrees of
+        freedom when a slot changes.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        replica_exchange = hoomd.md.update.ReplicaExchange(
+            trigger=hoomd.trigger.Periodic(1000),
+            kT=[1.0, 1.2, 1.44, 1.73])
+        nvt = hoomd.md.methods.ConstantVolume(
+            filter=hoomd.filter.All(),
+            thermostat=hoomd.md.methods.thermostats.Bussi(
+                kT=replica_exchange.kT_variant))
+        simulation.operations.updaters.append(replica_exchange)
+
+    Attributes:
+        trigger (hoomd.trigger.Trigger): Select the timesteps to attempt
+            exchanges.
+    """
+
+    def __init__(self, trigger, kT, P=None):
+        super().__init__(trigger)
+        self._kT = tuple(float(value) for value in kT)
+        if len(self._kT) == 0:
+            raise ValueError("kT must have at least one value.")
+        self._kT_variant = hoomd.variant.Constant(self._kT[0])
+
+        if P is None:
+            self._P = None
+            self._P_variant = None
+        else:
+            self._P = tuple(float(value) for value in P)
+            if len(self._P) != len(self._kT):
+                raise ValueError("kT and P must have the same length.")
+            self._P_variant = hoomd.variant.Constant(self._P[0])
+
+    def _attach_hook(self):
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            thermo_cls = _md.ComputeThermo
+        else:
+            thermo_cls = _md.ComputeThermoGPU
+
+        sys_def = self._simulation.state._cpp_sys_def
+        group = self._simulation.state._get_group(hoomd.filter.All())
+        self._thermo = thermo_cls(sys_def, group)
+
+        P = [] if self._P is None else list(self._P)
+        self._cpp_obj = _md.ReplicaExchangeUpdater(sys_def, self.trigger,
+                                                   self._thermo,
+                                                   self._kT_variant,
+                                                   self._P_variant,
+                                                   list(self._kT), P)
+
+    @property
+    def kT(self):
+        """tuple[float]: Temperature of each slot :math:`[\\mathrm{energy}]`.
+
+        Not settable after construction.
+        """
+        return self._kT
+
+    @property
+    def P(self):
+        """tuple[float]: Pressure of each slot :math:`[\\mathrm{pressure}]`.
+
+        `None` for constant volume replicas. Not settable after construction.
+        """
+        return self._P
+
+    @property
+    def kT_variant(self):
+        """hoomd.variant.Constant: Temperature of this partition's slot.
+
+        Holds the value of the current slot after the simulation attaches the
+        updater.
+        """
+        return self._kT_variant
+
+    @property
+    def P_variant(self):
+        """hoomd.variant.Constant: Pressure of this partition's slot.
+
+        `None` for constant volume replicas.
+        """
+        return self._P_variant
+
+    @log(requires_run=True)
+    def slot(self):
+        """int: Slot of this partition's replica in the ladder."""
+        return self._cpp_obj.slot
+
+    @log(category="sequence", requires_run=True)
+    def slots(self):
+        """list[int]: Slot of each partition's replica."""
+        return self._cpp_obj.slots
+
+    @log(category="sequence", requires_run=True)
+    def acceptance_ratio(self):
+        """list[float]: Fraction of accepted swaps between slots :math:`i` \
+        and :math:`i + 1`."""
+        n_accepted = self._cpp_obj.n_accepted
+        n_attempted = self._cpp_obj.n_attempted
+        return [
+            accepted / attempted if attempted > 0 else 0.0
+            for accepted, attempted in zip(n_accepted, n_attempted)
+        ]
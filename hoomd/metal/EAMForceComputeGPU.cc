@@ -40,23 +40,18 @@ EAMForceComputeGPU::EAMForceComputeGPU(std::shared_ptr<SystemDefinition> sysdef,
                                    "pair_eam"));
     m_autotuners.push_back(m_tuner);
 
-    // allocate the coefficients data on the GPU
+    // load the coefficients and collect the table parameters for the kernels
     loadFile(filename, type_of_file);
-    GlobalArray<kernel::EAMTexInterData> eam_data(1, m_exec_conf);
-    std::swap(eam_data, m_eam_data);
-
-    ArrayHandle<kernel::EAMTexInterData> h_eam_data(m_eam_data,
-                                                    access_location::host,
-                                                    access_mode::overwrite);
-    h_eam_data.data->nr = nr;     //!< number of tabulated values of interpolated rho(r), r*phi(r)
-    h_eam_data.data->nrho = nrho; //!< number of tabulated values of interpolated F(rho)
-    h_eam_data.data->dr = dr;     //!< interval of r in interpolated table
-    h_eam_data.data->rdr = 1.0 / dr;              //!< 1.0 / dr
-    h_eam_data.data->drho = drho;                 //!< interval of rho in interpolated table
-    h_eam_data.data->rdrho = 1.0 / drho;          //!< 1.0 / drho
-    h_eam_data.data->r_cut = m_r_cut;             //!< cut-off radius
-    h_eam_data.data->r_cutsq = m_r_cut * m_r_cut; //!< r_cut^2
-    h_eam_data.data->ntypes = m_ntypes;           //!< number of potential element types
+
+    m_eam_data.nr = nr;                     //!< number of tabulated values of rho(r), r*phi(r)
+    m_eam_data.nrho = nrho;                 //!< number of tabulated values of F(rho)
+    m_eam_data.dr = dr;                     //!< interval of r in interpolated table
+    m_eam_data.rdr = 1.0 / dr;              //!< 1.0 / dr
+    m_eam_data.drho = drho;                 //!< interval of rho in interpolated table
+    m_eam_data.rdrho = 1.0 / drho;          //!< 1.0 / drho
+    m_eam_data.r_cut = m_r_cut;             //!< cut-off radius
+    m_eam_data.r_cutsq = m_r_cut * m_r_cut; //!< r_cut^2
+    m_eam_data.ntypes = m_ntypes;           //!< number of potential element types
     }
 
 EAMForceComputeGPU::~EAMForceComputeGPU() { }
@@ -100,15 +95,35 @@ void EAMForceComputeGPU::computeForces(uint64_t timestep)
     ArrayHandle<Scalar4> d_drho(m_drho, access_location::device, access_mode::read);
     ArrayHandle<Scalar4> d_rphi(m_rphi, access_location::device, access_mode::read);
     ArrayHandle<Scalar4> d_drphi(m_drphi, access_location::device, access_mode::read);
-    ArrayHandle<kernel::EAMTexInterData> d_eam_data(m_eam_data,
-                                                    access_location::device,
-                                                    access_mode::read);
 
     // Derivative Embedding Function for each atom
-    GPUArray<Scalar> t_dFdP(m_pdata->getN(), m_exec_conf);
-    m_dFdP.swap(t_dFdP);
+    if (m_dFdP.getNumElements() != m_pdata->getN())
+        {
+        GPUArray<Scalar> dFdP(m_pdata->getN(), m_exec_conf);
+        m_dFdP.swap(dFdP);
+        GPUArray<unsigned int> n_pairs(m_pdata->getN(), m_exec_conf);
+        m_n_pairs.swap(n_pairs);
+        }
     ArrayHandle<Scalar> d_dFdP(m_dFdP, access_location::device, access_mode::overwrite);
 
+    // pairs in range found by the density pass and reused by the force pass, stored in the
+    // layout of the neighbor list
+    size_t nlist_size = this->m_nlist->getNListArray().getNumElements();
+    if (m_pair_dr.getNumElements() != nlist_size)
+        {
+        GPUArray<Scalar4> pair_dr(nlist_size, m_exec_conf);
+        m_pair_dr.swap(pair_dr);
+        GPUArray<uint2> pair_neigh(nlist_size, m_exec_conf);
+        m_pair_neigh.swap(pair_neigh);
+        }
+    ArrayHandle<Scalar4> d_pair_dr(m_pair_dr, access_location::device, access_mode::overwrite);
+    ArrayHandle<uint2> d_pair_neigh(m_pair_neigh,
+                                    access_location::device,
+                                    access_mode::overwrite);
+    ArrayHandle<unsigned int> d_n_pairs(m_n_pairs,
+                                        access_location::device,
+                                        access_mode::overwrite);
+
     // Compute energy and forces in GPU
     m_tuner->begin();
     kernel::gpu_compute_eam_tex_inter_forces(d_force.data,
@@ -120,9 +135,11 @@ void EAMForceComputeGPU::computeForces(uint64_t timestep)
                                              d_n_neigh.data,
                                              d_nlist.data,
                                              d_head_list.data,
-                                             this->m_nlist->getNListArray().getPitch(),
-                                             d_eam_data.data,
+                                             m_eam_data,
                                              d_dFdP.data,
+                                             d_pair_dr.data,
+                                             d_pair_neigh.data,
+                                             d_n_pairs.data,
                                              d_F.data,
                                              d_rho.data,
                                              d_rphi.data,
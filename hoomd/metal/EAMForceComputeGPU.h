@@ -24,8 +24,9 @@ namespace hoomd
 namespace metal
     {
 //! Computes EAM forces on each particle using the GPU
-/*! Calculates the same forces as EAMForceCompute, but on the GPU by using texture
- * memory(CUDAArray).
+/*! Calculates the same forces as EAMForceCompute, but on the GPU. The density pass stores the
+ * separation, neighbor, and type of every pair within the cutoff, and the force pass walks only
+ * these pairs. The tables are read through the read-only data cache.
  */
 class EAMForceComputeGPU : public EAMForceCompute
     {
@@ -37,8 +38,13 @@ class EAMForceComputeGPU : public EAMForceCompute
     virtual ~EAMForceComputeGPU();
 
     protected:
-    GlobalArray<kernel::EAMTexInterData> m_eam_data; //!< EAM parameters to be communicated
-    std::shared_ptr<Autotuner<1>> m_tuner;           //!< autotuner for block size
+    kernel::EAMTexInterData m_eam_data;    //!< EAM parameters passed by value to the kernels
+    std::shared_ptr<Autotuner<1>> m_tuner; //!< autotuner for block size
+
+    GPUArray<Scalar4> m_pair_dr;      //!< Separation (xyz) and distance (w) of pairs in range
+    GPUArray<uint2> m_pair_neigh;     //!< Neighbor index (x) and type (y) of pairs in range
+    GPUArray<unsigned int> m_n_pairs; //!< Number of pairs in range of each particle
+
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
     };
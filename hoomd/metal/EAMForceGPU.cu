@@ -16,40 +16,27 @@ namespace metal
     {
 namespace kernel
     {
-//! Kernel for computing EAM forces on the GPU
-__global__ void gpu_kernel_1(Scalar4* d_force,
-                             Scalar* d_virial,
-                             const size_t virial_pitch,
-                             const unsigned int N,
-                             const Scalar4* d_pos,
-                             BoxDim box,
-                             const unsigned int* d_n_neigh,
-                             const unsigned int* d_nlist,
-                             const size_t* d_head_list,
-                             const Scalar4* d_F,
-                             const Scalar4* d_rho,
-                             const Scalar4* d_rphi,
-                             const Scalar4* d_dF,
-                             const Scalar4* d_drho,
-                             const Scalar4* d_drphi,
-                             Scalar* d_dFdP,
-                             const EAMTexInterData* d_eam_data)
+//! Kernel for computing the electron density and embedding energy on the GPU
+/*! The pairs within the cutoff are written to \a d_pair_dr and \a d_pair_neigh in the layout of
+    the neighbor list, compacted to the first \a d_n_pairs entries of each particle, for use by
+    gpu_compute_eam_force_kernel().
+*/
+__global__ void gpu_compute_eam_density_kernel(Scalar4* d_force,
+                                               const unsigned int N,
+                                               const Scalar4* d_pos,
+                                               BoxDim box,
+                                               const unsigned int* d_n_neigh,
+                                               const unsigned int* d_nlist,
+                                               const size_t* d_head_list,
+                                               const Scalar4* d_F,
+                                               const Scalar4* d_rho,
+                                               const Scalar4* d_dF,
+                                               Scalar* d_dFdP,
+                                               Scalar4* d_pair_dr,
+                                               uint2* d_pair_neigh,
+                                               unsigned int* d_n_pairs,
+                                               const EAMTexInterData eam_data)
     {
-    __shared__ EAMTexInterData eam_data_ti;
-
-    // copy over parameters one int per thread
-    unsigned int tidx = threadIdx.x;
-    unsigned int block_size = blockDim.x;
-    unsigned int param_size = sizeof(EAMTexInterData) / sizeof(int);
-
-    for (unsigned int cur_offset = 0; cur_offset < param_size; cur_offset += block_size)
-        {
-        if (cur_offset + tidx < param_size)
-            {
-            ((int*)&eam_data_ti)[cur_offset + tidx] = ((int*)d_eam_data)[cur_offset + tidx];
-            }
-        }
-
     // start by identifying which particle we are to handle
     int idx = blockIdx.x * blockDim.x + threadIdx.x;
 
@@ -83,12 +70,13 @@ __global__ void gpu_kernel_1(Scalar4* d_force,
 
     // loop over neighbors
     Scalar atomElectronDensity = Scalar(0.0);
-    int ntypes = eam_data_ti.ntypes;
-    int nrho = eam_data_ti.nrho;
-    int nr = eam_data_ti.nr;
-    Scalar rdrho = eam_data_ti.rdrho;
-    Scalar rdr = eam_data_ti.rdr;
-    Scalar r_cutsq = eam_data_ti.r_cutsq;
+    unsigned int n_pairs = 0;
+    int ntypes = eam_data.ntypes;
+    int nrho = eam_data.nrho;
+    int nr = eam_data.nr;
+    Scalar rdrho = eam_data.rdrho;
+    Scalar rdr = eam_data.rdr;
+    Scalar r_cutsq = eam_data.r_cutsq;
 
     for (int neigh_idx = 0; neigh_idx < n_neigh; neigh_idx++)
         {
@@ -109,11 +97,17 @@ __global__ void gpu_kernel_1(Scalar4* d_force,
 
         // calculate r squared
         Scalar rsq = dot(dx, dx);
-        ;
         if (rsq < r_cutsq)
             {
+            Scalar r = fast::sqrt(rsq);
+
+            // keep the pair for the force pass
+            d_pair_dr[head_idx + n_pairs] = make_scalar4(dx.x, dx.y, dx.z, r);
+            d_pair_neigh[head_idx + n_pairs] = make_uint2(cur_neigh, typej);
+            n_pairs++;
+
             // calculate position r for rho(r)
-            position = sqrtf(rsq) * rdr;
+            position = r * rdr;
             int_position = (unsigned int)position;
             int_position = min(int_position, nr - 1);
             remainder = position - int_position;
@@ -124,6 +118,7 @@ __global__ void gpu_kernel_1(Scalar4* d_force,
                                    + v.x * remainder * remainder * remainder;
             }
         }
+    d_n_pairs[idx] = n_pairs;
 
     // calculate position rho for F(rho)
     position = atomElectronDensity * rdrho;
@@ -143,54 +138,37 @@ __global__ void gpu_kernel_1(Scalar4* d_force,
     d_force[idx] = force;
     }
 
-//! Second stage kernel for computing EAM forces on the GPU
-__global__ void gpu_kernel_2(Scalar4* d_force,
-                             Scalar* d_virial,
-                             const size_t virial_pitch,
-                             const unsigned int N,
-                             const Scalar4* d_pos,
-                             BoxDim box,
-                             const unsigned int* d_n_neigh,
-                             const unsigned int* d_nlist,
-                             const size_t* d_head_list,
-                             const Scalar4* d_F,
-                             const Scalar4* d_rho,
-                             const Scalar4* d_rphi,
-                             const Scalar4* d_dF,
-                             const Scalar4* d_drho,
-                             const Scalar4* d_drphi,
-                             Scalar* d_dFdP,
-                             const EAMTexInterData* d_eam_data)
+//! Kernel for computing EAM forces on the GPU from the pairs found by the density pass
+/*! Each thread sums over the full neighbor list of its particle and writes only its own force, so
+    no atomic operations are needed.
+*/
+__global__ void gpu_compute_eam_force_kernel(Scalar4* d_force,
+                                             Scalar* d_virial,
+                                             const size_t virial_pitch,
+                                             const unsigned int N,
+                                             const Scalar4* d_pos,
+                                             const size_t* d_head_list,
+                                             const Scalar4* d_rphi,
+                                             const Scalar4* d_drho,
+                                             const Scalar4* d_drphi,
+                                             const Scalar* d_dFdP,
+                                             const Scalar4* d_pair_dr,
+                                             const uint2* d_pair_neigh,
+                                             const unsigned int* d_n_pairs,
+                                             const EAMTexInterData eam_data)
     {
-    __shared__ EAMTexInterData eam_data_ti;
-
-    // copy over parameters one int per thread
-    unsigned int tidx = threadIdx.x;
-    unsigned int block_size = blockDim.x;
-    unsigned int param_size = sizeof(EAMTexInterData) / sizeof(int);
-
-    for (unsigned int cur_offset = 0; cur_offset < param_size; cur_offset += block_size)
-        {
-        if (cur_offset + tidx < param_size)
-            {
-            ((int*)&eam_data_ti)[cur_offset + tidx] = ((int*)d_eam_data)[cur_offset + tidx];
-            }
-        }
-
     // start by identifying which particle we are to handle
     int idx = blockIdx.x * blockDim.x + threadIdx.x;
 
     if (idx >= N)
         return;
 
-    // load in the length of the list
-    int n_neigh = d_n_neigh[idx];
+    // load in the number of pairs in range
+    unsigned int n_pairs = d_n_pairs[idx];
     const size_t head_idx = d_head_list[idx];
 
-    // read in the position of our particle. Texture reads of Scalar4's are faster than global reads
-    Scalar4 postype = __ldg(d_pos + idx);
-    Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
-    int typei = __scalar_as_int(postype.w);
+    // read in the type of our particle, the positions of the pairs are cached
+    int typei = __scalar_as_int(__ldg(d_pos + idx).w);
 
     // index and remainder
     Scalar position;           // look up position, scalar
@@ -199,14 +177,7 @@ __global__ void gpu_kernel_2(Scalar4* d_force,
     Scalar remainder;          // look up remainder in array, integer
     Scalar4 v, dv;             // value, d(value)
 
-    // prefetch neighbor index
-    int cur_neigh = 0;
-    int next_neigh(0);
-    next_neigh = __ldg(d_nlist + head_idx);
-
-    // Scalar4 force = force_data.force[idx];
     Scalar4 force = make_scalar4(Scalar(0.0), Scalar(0.0), Scalar(0.0), Scalar(0.0));
-    // force.w = force_data.force[idx].w;
     Scalar fxi = Scalar(0.0);
     Scalar fyi = Scalar(0.0);
     Scalar fzi = Scalar(0.0);
@@ -217,35 +188,22 @@ __global__ void gpu_kernel_2(Scalar4* d_force,
         virial[i] = Scalar(0.0);
 
     force.w = d_force[idx].w;
-    int ntypes = eam_data_ti.ntypes;
-    int nr = eam_data_ti.nr;
-    Scalar rdr = eam_data_ti.rdr;
-    Scalar r_cutsq = eam_data_ti.r_cutsq;
+    int ntypes = eam_data.ntypes;
+    int nr = eam_data.nr;
+    Scalar rdr = eam_data.rdr;
     Scalar d_dFdPidx = __ldg(d_dFdP + idx);
-    for (int neigh_idx = 0; neigh_idx < n_neigh; neigh_idx++)
+    for (unsigned int pair_idx = 0; pair_idx < n_pairs; pair_idx++)
         {
-        cur_neigh = next_neigh;
-        next_neigh = __ldg(d_nlist + head_idx + neigh_idx + 1);
-
-        // get the neighbor's position
-        Scalar4 neigh_postype = __ldg(d_pos + cur_neigh);
-        Scalar3 neigh_pos = make_scalar3(neigh_postype.x, neigh_postype.y, neigh_postype.z);
-
-        // calculate dr (with periodic boundary conditions)
-        Scalar3 dx = pos - neigh_pos;
-        int typej = __scalar_as_int(neigh_postype.w);
-        // apply periodic boundary conditions
-        dx = box.minImage(dx);
-
-        // calculate r squared
-        Scalar rsq = dot(dx, dx);
-
-        if (rsq > r_cutsq)
-            continue;
+        // read the cached separation and neighbor
+        Scalar4 dr = __ldg(d_pair_dr + head_idx + pair_idx);
+        uint2 neigh = __ldg(d_pair_neigh + head_idx + pair_idx);
+        Scalar3 dx = make_scalar3(dr.x, dr.y, dr.z);
+        unsigned int cur_neigh = neigh.x;
+        int typej = neigh.y;
 
         // calculate position r for phi(r)
-        Scalar inverseR = rsqrtf(rsq);
-        Scalar r = Scalar(1.0) / inverseR;
+        Scalar r = dr.w;
+        Scalar inverseR = Scalar(1.0) / r;
         position = r * rdr;
         int_position = (unsigned int)position;
         int_position = min(int_position, nr - 1);
@@ -316,9 +274,11 @@ hipError_t gpu_compute_eam_tex_inter_forces(Scalar4* d_force,
                                             const unsigned int* d_n_neigh,
                                             const unsigned int* d_nlist,
                                             const size_t* d_head_list,
-                                            const size_t size_nlist,
-                                            const EAMTexInterData* d_eam_data,
+                                            const EAMTexInterData& eam_data,
                                             Scalar* d_dFdP,
+                                            Scalar4* d_pair_dr,
+                                            uint2* d_pair_neigh,
+                                            unsigned int* d_n_pairs,
                                             const Scalar4* d_F,
                                             const Scalar4* d_rho,
                                             const Scalar4* d_rphi,
@@ -331,10 +291,10 @@ hipError_t gpu_compute_eam_tex_inter_forces(Scalar4* d_force,
     unsigned int max_block_size_2;
 
     hipFuncAttributes attr1;
-    hipFuncGetAttributes(&attr1, reinterpret_cast<const void*>(gpu_kernel_1));
+    hipFuncGetAttributes(&attr1, reinterpret_cast<const void*>(gpu_compute_eam_density_kernel));
 
     hipFuncAttributes attr2;
-    hipFuncGetAttributes(&attr2, reinterpret_cast<const void*>(gpu_kernel_2));
+    hipFuncGetAttributes(&attr2, reinterpret_cast<const void*>(gpu_compute_eam_force_kernel));
 
     max_block_size_1 = attr1.maxThreadsPerBlock;
     max_block_size_2 = attr2.maxThreadsPerBlock;
@@ -350,14 +310,12 @@ hipError_t gpu_compute_eam_tex_inter_forces(Scalar4* d_force,
     dim3 grid_2((int)ceil((double)N / (double)run_block_size_2), 1, 1);
     dim3 threads_2(run_block_size_2, 1, 1);
 
-    hipLaunchKernelGGL(gpu_kernel_1,
+    hipLaunchKernelGGL(gpu_compute_eam_density_kernel,
                        dim3(grid_1),
                        dim3(threads_1),
                        0,
                        0,
                        d_force,
-                       d_virial,
-                       virial_pitch,
                        N,
                        d_pos,
                        box,
@@ -366,13 +324,13 @@ hipError_t gpu_compute_eam_tex_inter_forces(Scalar4* d_force,
                        d_head_list,
                        d_F,
                        d_rho,
-                       d_rphi,
                        d_dF,
-                       d_drho,
-                       d_drphi,
                        d_dFdP,
-                       d_eam_data);
-    hipLaunchKernelGGL(gpu_kernel_2,
+                       d_pair_dr,
+                       d_pair_neigh,
+                       d_n_pairs,
+                       eam_data);
+    hipLaunchKernelGGL(gpu_compute_eam_force_kernel,
                        dim3(grid_2),
                        dim3(threads_2),
                        0,
@@ -382,18 +340,15 @@ hipError_t gpu_compute_eam_tex_inter_forces(Scalar4* d_force,
                        virial_pitch,
                        N,
                        d_pos,
-                       box,
-                       d_n_neigh,
-                       d_nlist,
                        d_head_list,
-                       d_F,
-                       d_rho,
                        d_rphi,
-                       d_dF,
                        d_drho,
                        d_drphi,
                        d_dFdP,
-                       d_eam_data);
+                       d_pair_dr,
+                       d_pair_neigh,
+                       d_n_pairs,
+                       eam_data);
 
     return hipSuccess;
     }
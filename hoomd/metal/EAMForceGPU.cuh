@@ -42,9 +42,11 @@ hipError_t gpu_compute_eam_tex_inter_forces(Scalar4* d_force,
                                             const unsigned int* d_n_neigh,
                                             const unsigned int* d_nlist,
                                             const size_t* d_head_list,
-                                            const size_t size_nlist,
-                                            const EAMTexInterData* d_eam_data,
+                                            const EAMTexInterData& eam_data,
                                             Scalar* d_dFdP,
+                                            Scalar4* d_pair_dr,
+                                            uint2* d_pair_neigh,
+                                            unsigned int* d_n_pairs,
                                             const Scalar4* d_F,
                                             const Scalar4* d_rho,
                                             const Scalar4* d_rphi,
@@ -3,10 +3,13 @@
 
 #include "Action.h"
 #include "Analyzer.h"
+#include "BinaryLogWriter.h"
 #include "BondedGroupData.h"
 #include "BoxResizeUpdater.h"
 #include "CellList.h"
 #include "CellListStencil.h"
+#include "CheckpointReader.h"
+#include "CheckpointWriter.h"
 #include "ClockSource.h"
 #include "Compute.h"
 #include "DCDDumpWriter.h"
@@ -23,6 +26,7 @@
 #include "MeshDefinition.h"
 #include "MeshGroupData.h"
 #include "Messenger.h"
+#include "OperationTimer.h"
 #include "ParticleData.h"
 #include "ParticleFilterUpdater.h"
 #include "PythonAnalyzer.h"
@@ -33,6 +37,7 @@
 #include "SnapshotSystemData.h"
 #include "System.h"
 #include "SystemDefinition.h"
+#include "Tracer.h"
 #include "Trigger.h"
 #include "Tuner.h"
 #include "Updater.h"
@@ -55,6 +60,7 @@
 #include "CellListGPU.h"
 #include "LoadBalancerGPU.h"
 #include "SFCPackTunerGPU.h"
+#include "UpdaterRemoveDriftGPU.h"
 #include <hip/hip_runtime.h>
 #endif
 
@@ -229,6 +235,8 @@ PYBIND11_MODULE(_hoomd, m)
     // utils
     export_hoomd_math_functions(m);
     export_ClockSource(m);
+    export_Tracer(m);
+    export_OperationTimer(m);
 
     // data structures
     export_HOOMDHostBuffer(m);
@@ -282,11 +290,16 @@ PYBIND11_MODULE(_hoomd, m)
 #endif
 #ifdef BUILD_MPCD
     mpcd::detail::export_ParticleData(m);
+    mpcd::detail::export_LocalParticleData<HOOMDHostBuffer>(m, "LocalMPCDParticleDataHost");
+#ifdef ENABLE_HIP
+    mpcd::detail::export_LocalParticleData<HOOMDDeviceBuffer>(m, "LocalMPCDParticleDataDevice");
+#endif
     mpcd::detail::export_ParticleDataSnapshot(m);
 #endif
 
     // initializers
     export_GSDReader(m);
+    export_CheckpointReader(m);
 
     // computes
     export_Autotuned(m);
@@ -308,9 +321,11 @@ PYBIND11_MODULE(_hoomd, m)
     // analyzers
     export_Analyzer(m);
     export_PythonAnalyzer(m);
+    export_BinaryLogWriter(m);
     export_DCDDumpWriter(m);
     export_GSDDumpWriter(m);
     export_GSDDequeWriter(m);
+    export_CheckpointWriter(m);
 
     // updaters
     export_Updater(m);
@@ -320,11 +335,13 @@ PYBIND11_MODULE(_hoomd, m)
     export_UpdaterRemoveDrift(m);
 #ifdef ENABLE_HIP
     export_BoxResizeUpdaterGPU(m);
+    export_UpdaterRemoveDriftGPU(m);
 #endif
 
     // tuners
     export_Tuner(m);
     export_PythonTuner(m);
+    export_SortKeyProvider(m);
     export_SFCPackTuner(m);
     export_LoadBalancer(m);
 #ifdef ENABLE_HIP
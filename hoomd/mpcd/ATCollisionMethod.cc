@@ -9,6 +9,7 @@
 #include "ATCollisionMethod.h"
 #include "hoomd/RNGIdentifiers.h"
 #include "hoomd/RandomNumbers.h"
+#include "hoomd/ThreadLoops.h"
 
 namespace hoomd
     {
@@ -17,7 +18,8 @@ mpcd::ATCollisionMethod::ATCollisionMethod(std::shared_ptr<SystemDefinition> sys
                                            uint64_t period,
                                            int phase,
                                            std::shared_ptr<Variant> T)
-    : mpcd::CollisionMethod(sysdef, cur_timestep, period, phase), m_T(T)
+    : mpcd::CollisionMethod(sysdef, cur_timestep, period, phase), m_T(T), m_friction(2.0),
+      m_rand_vel(m_exec_conf)
     {
     m_exec_conf->msg->notice(5) << "Constructing MPCD AT collision method" << std::endl;
     }
@@ -30,17 +32,17 @@ mpcd::ATCollisionMethod::~ATCollisionMethod()
 
 /*!
  * \param timestep Current timestep.
+ *
+ * The random velocities are drawn and summed in a callback of the cell thermo compute.
  */
 void mpcd::ATCollisionMethod::rule(uint64_t timestep)
     {
     m_thermo->compute(timestep);
 
-    // compute the cell average of the random velocities
-    m_pdata->swapVelocities();
-    m_mpcd_pdata->swapVelocities();
-    m_rand_thermo->compute(timestep);
-    m_pdata->swapVelocities();
-    m_mpcd_pdata->swapVelocities();
+#ifdef ENABLE_MPI
+    if (m_rand_comm)
+        m_rand_comm->finalize(m_rand_vel, mpcd::detail::CellVelocityPackOp());
+#endif // ENABLE_MPI
 
     // apply random velocities
     applyVelocities();
@@ -48,18 +50,48 @@ void mpcd::ATCollisionMethod::rule(uint64_t timestep)
 
 /*!
  * \param timestep Current timestep.
+ *
+ * The sums of the outer cells begin communicating now, and the communication finishes in rule().
+ */
+void mpcd::ATCollisionMethod::slotDrawVelocities(uint64_t timestep)
+    {
+    m_rand_vel.resize(m_cl->getNCells());
+    drawVelocities(timestep);
+
+#ifdef ENABLE_MPI
+    if (m_rand_comm)
+        m_rand_comm->begin(m_rand_vel, mpcd::detail::CellVelocityPackOp());
+#endif // ENABLE_MPI
+    }
+
+/*!
+ * \param timestep Current timestep.
+ *
+ * The particles are drawn from the cell list, so every cell sums the random momentum and mass of
+ * its own particles without a second pass. The random stream of each particle is set by its tag,
+ * so the velocities do not depend on the order of the particles in the cells.
  */
 void mpcd::ATCollisionMethod::drawVelocities(uint64_t timestep)
     {
+    // cell list
+    ArrayHandle<unsigned int> h_cell_list(m_cl->getCellList(),
+                                          access_location::host,
+                                          access_mode::read);
+    ArrayHandle<unsigned int> h_cell_np(m_cl->getCellSizeArray(),
+                                        access_location::host,
+                                        access_mode::read);
+    const Index2D& cli = m_cl->getCellListIndexer();
+    const unsigned int ncells = m_cl->getNCells();
+
     // mpcd particle data
     ArrayHandle<unsigned int> h_tag(m_mpcd_pdata->getTags(),
                                     access_location::host,
                                     access_mode::read);
-    ArrayHandle<Scalar4> h_alt_vel(m_mpcd_pdata->getAltVelocities(),
-                                   access_location::host,
-                                   access_mode::overwrite);
+    ArrayHandle<SolventScalar4> h_alt_vel(m_mpcd_pdata->getAltVelocities(),
+                                          access_location::host,
+                                          access_mode::overwrite);
     const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
-    unsigned int N_tot = N_mpcd;
+    const Scalar mpcd_mass = m_mpcd_pdata->getMass();
 
     // embedded particle data
     std::unique_ptr<ArrayHandle<unsigned int>> h_embed_idx;
@@ -80,62 +112,94 @@ void mpcd::ATCollisionMethod::drawVelocities(uint64_t timestep)
         h_tag_embed.reset(new ArrayHandle<unsigned int>(m_pdata->getTags(),
                                                         access_location::host,
                                                         access_mode::read));
-        N_tot += m_embed_group->getNumMembers();
         }
 
-    uint16_t seed = m_sysdef->getSeed();
+    ArrayHandle<double4> h_rand_vel(m_rand_vel, access_location::host, access_mode::overwrite);
 
     // random velocities are drawn for each particle and stored into the "alternate" arrays
     const Scalar T = (*m_T)(timestep);
-    for (unsigned int idx = 0; idx < N_tot; ++idx)
-        {
-        unsigned int pidx;
-        unsigned int tag;
-        Scalar mass;
-        if (idx < N_mpcd)
-            {
-            pidx = idx;
-            mass = m_mpcd_pdata->getMass();
-            tag = h_tag.data[idx];
-            }
-        else
-            {
-            pidx = h_embed_idx->data[idx - N_mpcd];
-            mass = h_vel_embed->data[pidx].w;
-            tag = h_tag_embed->data[pidx];
-            }
+    const hoomd::Seed rng_seed(hoomd::RNGIdentifier::ATCollisionMethod,
+                               timestep,
+                               m_sysdef->getSeed());
 
-        // draw random velocities from normal distribution
-        hoomd::RandomGenerator rng(
-            hoomd::Seed(hoomd::RNGIdentifier::ATCollisionMethod, timestep, seed),
-            hoomd::Counter(tag));
-        hoomd::NormalDistribution<Scalar> gen(fast::sqrt(T / mass), 0.0);
-        Scalar3 vel;
-        gen(vel.x, vel.y, rng);
-        vel.z = gen(rng);
-
-        // save out velocities
-        if (idx < N_mpcd)
-            {
-            h_alt_vel.data[pidx]
-                = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
-            }
-        else
+    // every cell is summed from its own particles, so ranges of cells can be done on the threads.
+    // the random numbers of the particles in a cell are drawn in batches.
+    auto draw_range = [&](unsigned int begin, unsigned int end)
+    {
+        hoomd::RandomGeneratorBatch<2> rng_batch;
+        for (unsigned int cell = begin; cell < end; ++cell)
             {
-            h_alt_vel_embed->data[pidx] = make_scalar4(vel.x, vel.y, vel.z, mass);
+            const unsigned int np = h_cell_np.data[cell];
+            double4 momentum = make_double4(0.0, 0.0, 0.0, 0.0);
+            for (unsigned int offset = 0; offset < np; offset += rng_batch.width)
+                {
+                const unsigned int n_batch = std::min(np - offset, rng_batch.width);
+                unsigned int pidx[rng_batch.width];
+                for (unsigned int i = 0; i < n_batch; ++i)
+                    {
+                    const unsigned int cur_p = h_cell_list.data[cli(offset + i, cell)];
+                    unsigned int tag;
+                    if (cur_p < N_mpcd)
+                        {
+                        pidx[i] = cur_p;
+                        tag = h_tag.data[cur_p];
+                        }
+                    else
+                        {
+                        pidx[i] = h_embed_idx->data[cur_p - N_mpcd];
+                        tag = h_tag_embed->data[pidx[i]];
+                        }
+                    rng_batch.setStream(i, rng_seed, hoomd::Counter(tag));
+                    }
+                rng_batch.generate();
+
+                for (unsigned int i = 0; i < n_batch; ++i)
+                    {
+                    const bool is_mpcd = h_cell_list.data[cli(offset + i, cell)] < N_mpcd;
+                    const Scalar mass = is_mpcd ? mpcd_mass : h_vel_embed->data[pidx[i]].w;
+
+                    // draw random velocities from normal distribution
+                    auto rng = rng_batch.getGenerator(i);
+                    hoomd::NormalDistribution<Scalar> gen(fast::sqrt(T / mass), 0.0);
+                    Scalar3 vel;
+                    gen(vel.x, vel.y, rng);
+                    vel.z = gen(rng);
+
+                    // save out velocities
+                    if (is_mpcd)
+                        {
+                        h_alt_vel.data[pidx[i]]
+                            = make_solvent_scalar4(vel.x,
+                                                   vel.y,
+                                                   vel.z,
+                                                   __int_as_solvent_scalar(mpcd::detail::NO_CELL));
+                        }
+                    else
+                        {
+                        h_alt_vel_embed->data[pidx[i]] = make_scalar4(vel.x, vel.y, vel.z, mass);
+                        }
+
+                    momentum.x += double(mass) * vel.x;
+                    momentum.y += double(mass) * vel.y;
+                    momentum.z += double(mass) * vel.z;
+                    momentum.w += mass;
+                    }
+                }
+            h_rand_vel.data[cell] = momentum;
             }
-        }
+    };
+    hoomd::detail::parallelForEach(*m_exec_conf, ncells, draw_range);
     }
 
 void mpcd::ATCollisionMethod::applyVelocities()
     {
     // mpcd particle data
-    ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(),
-                               access_location::host,
-                               access_mode::readwrite);
-    ArrayHandle<Scalar4> h_vel_alt(m_mpcd_pdata->getAltVelocities(),
-                                   access_location::host,
-                                   access_mode::read);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::readwrite);
+    ArrayHandle<SolventScalar4> h_vel_alt(m_mpcd_pdata->getAltVelocities(),
+                                          access_location::host,
+                                          access_mode::read);
     const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
     unsigned int N_tot = N_mpcd;
 
@@ -164,46 +228,64 @@ void mpcd::ATCollisionMethod::applyVelocities()
     ArrayHandle<double4> h_cell_vel(m_thermo->getCellVelocities(),
                                     access_location::host,
                                     access_mode::read);
-    ArrayHandle<double4> h_rand_vel(m_rand_thermo->getCellVelocities(),
-                                    access_location::host,
-                                    access_mode::read);
+    ArrayHandle<double4> h_rand_vel(m_rand_vel, access_location::host, access_mode::read);
+    const Scalar2 factors = getVelocityFactors();
 
-    for (unsigned int idx = 0; idx < N_tot; ++idx)
-        {
-        unsigned int cell, pidx;
-        Scalar4 vel_rand;
-        if (idx < N_mpcd)
-            {
-            pidx = idx;
-            const Scalar4 vel_cell = h_vel.data[idx];
-            cell = __scalar_as_int(vel_cell.w);
-            vel_rand = h_vel_alt.data[idx];
-            }
-        else
+    // every particle is updated independently, so ranges of particles can be done on the threads
+    auto apply_range = [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int idx = begin; idx < end; ++idx)
             {
-            pidx = h_embed_idx->data[idx - N_mpcd];
-            cell = h_embed_cell_ids->data[idx - N_mpcd];
-            vel_rand = h_vel_alt_embed->data[pidx];
-            }
+            unsigned int cell, pidx;
+            Scalar3 vel, vel_rand;
+            if (idx < N_mpcd)
+                {
+                pidx = idx;
+                const SolventScalar4 vel_cell = h_vel.data[idx];
+                vel = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
+                cell = __solvent_scalar_as_int(vel_cell.w);
+                const SolventScalar4 vel_alt = h_vel_alt.data[idx];
+                vel_rand = make_scalar3(vel_alt.x, vel_alt.y, vel_alt.z);
+                }
+            else
+                {
+                pidx = h_embed_idx->data[idx - N_mpcd];
+                const Scalar4 vel_mass = h_vel_embed->data[pidx];
+                vel = make_scalar3(vel_mass.x, vel_mass.y, vel_mass.z);
+                cell = h_embed_cell_ids->data[idx - N_mpcd];
+                const Scalar4 vel_alt = h_vel_alt_embed->data[pidx];
+                vel_rand = make_scalar3(vel_alt.x, vel_alt.y, vel_alt.z);
+                }
 
-        // load cell data
-        const double4 v_c = h_cell_vel.data[cell];
-        const double4 vrand_c = h_rand_vel.data[cell];
+            // load cell data, averaging the random momentum over the mass of the cell, which
+            // includes this particle
+            const double4 v_c = h_cell_vel.data[cell];
+            const double4 rand_sum = h_rand_vel.data[cell];
+            const double inv_mass = 1.0 / rand_sum.w;
+            const double3 vrand_c
+                = make_double3(rand_sum.x * inv_mass, rand_sum.y * inv_mass, rand_sum.z * inv_mass);
 
-        // compute new velocity using the cell + the random draw
-        const Scalar3 vnew = make_scalar3(v_c.x - vrand_c.x + vel_rand.x,
-                                          v_c.y - vrand_c.y + vel_rand.y,
-                                          v_c.z - vrand_c.z + vel_rand.z);
+            // compute new velocity using the cell + the relative and random velocities
+            const Scalar a = factors.x;
+            const Scalar b = factors.y;
+            const Scalar3 vnew
+                = make_scalar3(v_c.x + a * (vel.x - v_c.x) + b * (vel_rand.x - vrand_c.x),
+                               v_c.y + a * (vel.y - v_c.y) + b * (vel_rand.y - vrand_c.y),
+                               v_c.z + a * (vel.z - v_c.z) + b * (vel_rand.z - vrand_c.z));
 
-        if (idx < N_mpcd)
-            {
-            h_vel.data[pidx] = make_scalar4(vnew.x, vnew.y, vnew.z, __int_as_scalar(cell));
-            }
-        else
-            {
-            h_vel_embed->data[pidx] = make_scalar4(vnew.x, vnew.y, vnew.z, vel_rand.w);
+            if (idx < N_mpcd)
+                {
+                h_vel.data[pidx]
+                    = make_solvent_scalar4(vnew.x, vnew.y, vnew.z, __int_as_solvent_scalar(cell));
+                }
+            else
+                {
+                h_vel_embed->data[pidx]
+                    = make_scalar4(vnew.x, vnew.y, vnew.z, h_vel_alt_embed->data[pidx].w);
+                }
             }
-        }
+    };
+    hoomd::detail::parallelForEach(*m_exec_conf, N_tot, apply_range);
     }
 
 void mpcd::ATCollisionMethod::setCellList(std::shared_ptr<mpcd::CellList> cl)
@@ -216,14 +298,19 @@ void mpcd::ATCollisionMethod::setCellList(std::shared_ptr<mpcd::CellList> cl)
         if (m_cl)
             {
             m_thermo = std::make_shared<mpcd::CellThermoCompute>(m_sysdef, m_cl);
-            m_rand_thermo = std::make_shared<mpcd::CellThermoCompute>(m_sysdef, m_cl);
             attachCallbacks();
             }
         else
             {
             m_thermo = std::shared_ptr<mpcd::CellThermoCompute>();
-            m_rand_thermo = std::shared_ptr<mpcd::CellThermoCompute>();
             }
+
+#ifdef ENABLE_MPI
+        if (m_cl && m_exec_conf->getNRanks() > 1)
+            m_rand_comm = std::make_shared<mpcd::CellCommunicator>(m_sysdef, m_cl);
+        else
+            m_rand_comm = std::shared_ptr<mpcd::CellCommunicator>();
+#endif // ENABLE_MPI
         }
     }
 
@@ -231,7 +318,7 @@ void mpcd::ATCollisionMethod::attachCallbacks()
     {
     assert(m_thermo);
     m_thermo->getCallbackSignal()
-        .connect<mpcd::ATCollisionMethod, &mpcd::ATCollisionMethod::drawVelocities>(this);
+        .connect<mpcd::ATCollisionMethod, &mpcd::ATCollisionMethod::slotDrawVelocities>(this);
     }
 
 void mpcd::ATCollisionMethod::detachCallbacks()
@@ -239,7 +326,8 @@ void mpcd::ATCollisionMethod::detachCallbacks()
     if (m_thermo)
         {
         m_thermo->getCallbackSignal()
-            .disconnect<mpcd::ATCollisionMethod, &mpcd::ATCollisionMethod::drawVelocities>(this);
+            .disconnect<mpcd::ATCollisionMethod, &mpcd::ATCollisionMethod::slotDrawVelocities>(
+                this);
         }
     }
 
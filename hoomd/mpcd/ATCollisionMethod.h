@@ -15,13 +15,34 @@
 
 #include "CellThermoCompute.h"
 #include "CollisionMethod.h"
+#ifdef ENABLE_MPI
+#include "CellCommunicator.h"
+#endif // ENABLE_MPI
 
+#include "hoomd/GPUVector.h"
 #include "hoomd/Variant.h"
 namespace hoomd
     {
 namespace mpcd
     {
 //! Implements the Anderson thermostat collision rule for MPCD.
+/*!
+ * Each particle is assigned the cell velocity \f$ \mathbf{u} \f$ plus a randomly drawn velocity
+ * \f$ \boldsymbol{\xi}_i \f$ relative to the cell average of the random velocities. More generally,
+ * the rule
+ * \f[ \mathbf{v}_i' = \mathbf{u} + a (\mathbf{v}_i - \mathbf{u})
+ *      + b (\boldsymbol{\xi}_i - \langle \boldsymbol{\xi} \rangle) \f]
+ * with \f$ a = (1-\tilde\gamma/2)/(1+\tilde\gamma/2) \f$ and \f$ b = \sqrt{1-a^2} \f$ is
+ * implemented, which is the MPC-Langevin rule with dimensionless friction \f$ \tilde\gamma \f$.
+ * The Andersen thermostat is the case \f$ \tilde\gamma = 2 \f$, and the friction can only be
+ * changed by mpcd::LangevinCollisionMethod.
+ *
+ * The random velocities are drawn cell by cell from the cell list while the cell thermo is
+ * computed, and their momentum and mass are summed in the same pass, so the cell averages
+ * \f$ \langle \boldsymbol{\xi} \rangle \f$ need no separate pass over the particles. The sums
+ * of the cells that overlap neighboring ranks are reduced while the cell thermo finishes
+ * communicating, and the averages are taken when the velocities are applied.
+ */
 class PYBIND11_EXPORT ATCollisionMethod : public mpcd::CollisionMethod
     {
     public:
@@ -44,14 +65,29 @@ class PYBIND11_EXPORT ATCollisionMethod : public mpcd::CollisionMethod
         }
 
     protected:
-    std::shared_ptr<mpcd::CellThermoCompute> m_thermo;      //!< Cell thermo
-    std::shared_ptr<mpcd::CellThermoCompute> m_rand_thermo; //!< Cell thermo for random velocities
-    std::shared_ptr<Variant> m_T;                           //!< Temperature for thermostat
+    std::shared_ptr<mpcd::CellThermoCompute> m_thermo; //!< Cell thermo
+    std::shared_ptr<Variant> m_T;                      //!< Temperature for thermostat
+    Scalar m_friction;                                 //!< Dimensionless friction
+    GPUVector<double4> m_rand_vel;                     //!< Sums of the random momentum and mass
+#ifdef ENABLE_MPI
+    std::shared_ptr<mpcd::CellCommunicator> m_rand_comm; //!< Communicator for the random sums
+#endif // ENABLE_MPI
+
+    //! Get the factors multiplying the relative and random velocities
+    /*!
+     * \returns The factors \a a (x) and \a b (y) of the collision rule
+     */
+    Scalar2 getVelocityFactors() const
+        {
+        const Scalar a = (Scalar(1.0) - Scalar(0.5) * m_friction)
+                         / (Scalar(1.0) + Scalar(0.5) * m_friction);
+        return make_scalar2(a, slow::sqrt(Scalar(1.0) - a * a));
+        }
 
     //! Implementation of the collision rule
     virtual void rule(uint64_t timestep);
 
-    //! Draw velocities for particles in each cell
+    //! Draw velocities for particles in each cell and sum them
     virtual void drawVelocities(uint64_t timestep);
 
     //! Apply the random velocities to particles in each cell
@@ -62,6 +98,10 @@ class PYBIND11_EXPORT ATCollisionMethod : public mpcd::CollisionMethod
 
     //! Detach callback signals
     void detachCallbacks();
+
+    private:
+    //! Draw the random velocities and begin reducing their sums
+    void slotDrawVelocities(uint64_t timestep);
     };
 
 namespace detail
@@ -19,7 +19,8 @@ mpcd::ATCollisionMethodGPU::ATCollisionMethodGPU(std::shared_ptr<SystemDefinitio
                                                  std::shared_ptr<Variant> T)
     : mpcd::ATCollisionMethod(sysdef, cur_timestep, period, phase, T)
     {
-    m_tuner_draw.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+    m_tuner_draw.reset(new Autotuner<2>({AutotunerBase::makeBlockSizeRange(m_exec_conf),
+                                         AutotunerBase::getTppListPow2(m_exec_conf)},
                                         m_exec_conf,
                                         "mpcd_at_draw"));
     m_tuner_apply.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
@@ -30,86 +31,88 @@ mpcd::ATCollisionMethodGPU::ATCollisionMethodGPU(std::shared_ptr<SystemDefinitio
 
 void mpcd::ATCollisionMethodGPU::drawVelocities(uint64_t timestep)
     {
+    mpcd::gpu::at_draw_args_t args;
+
+    // cell list
+    ArrayHandle<unsigned int> d_cell_list(m_cl->getCellList(),
+                                          access_location::device,
+                                          access_mode::read);
+    ArrayHandle<unsigned int> d_cell_np(m_cl->getCellSizeArray(),
+                                        access_location::device,
+                                        access_mode::read);
+    args.cell_list = d_cell_list.data;
+    args.cell_np = d_cell_np.data;
+    args.cli = m_cl->getCellListIndexer();
+    args.num_cells = m_cl->getNCells();
+
     // mpcd particle data
     ArrayHandle<unsigned int> d_tag(m_mpcd_pdata->getTags(),
                                     access_location::device,
                                     access_mode::read);
-    ArrayHandle<Scalar4> d_alt_vel(m_mpcd_pdata->getAltVelocities(),
-                                   access_location::device,
-                                   access_mode::overwrite);
-    const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
-    unsigned int N_tot = N_mpcd;
-
-    // random velocities are drawn for each particle and stored into the "alternate" arrays
-    const Scalar T = (*m_T)(timestep);
-
-    uint16_t seed = m_sysdef->getSeed();
-
+    ArrayHandle<SolventScalar4> d_alt_vel(m_mpcd_pdata->getAltVelocities(),
+                                          access_location::device,
+                                          access_mode::overwrite);
+    args.alt_vel = d_alt_vel.data;
+    args.tag = d_tag.data;
+    args.mpcd_mass = m_mpcd_pdata->getMass();
+    args.N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
+
+    // embedded particle data
+    std::unique_ptr<ArrayHandle<unsigned int>> d_embed_idx;
+    std::unique_ptr<ArrayHandle<Scalar4>> d_vel_embed;
+    std::unique_ptr<ArrayHandle<Scalar4>> d_alt_vel_embed;
+    std::unique_ptr<ArrayHandle<unsigned int>> d_tag_embed;
     if (m_embed_group)
         {
-        ArrayHandle<unsigned int> d_embed_idx(m_embed_group->getIndexArray(),
-                                              access_location::device,
-                                              access_mode::read);
-        ArrayHandle<Scalar4> d_vel_embed(m_pdata->getVelocities(),
-                                         access_location::device,
-                                         access_mode::read);
-        ArrayHandle<Scalar4> d_alt_vel_embed(m_pdata->getAltVelocities(),
-                                             access_location::device,
-                                             access_mode::overwrite);
-        ArrayHandle<unsigned int> d_tag_embed(m_pdata->getTags(),
-                                              access_location::device,
-                                              access_mode::read);
-        N_tot += m_embed_group->getNumMembers();
-
-        m_tuner_draw->begin();
-        mpcd::gpu::at_draw_velocity(d_alt_vel.data,
-                                    d_alt_vel_embed.data,
-                                    d_tag.data,
-                                    m_mpcd_pdata->getMass(),
-                                    d_embed_idx.data,
-                                    d_vel_embed.data,
-                                    d_tag_embed.data,
-                                    timestep,
-                                    seed,
-                                    T,
-                                    N_mpcd,
-                                    N_tot,
-                                    m_tuner_draw->getParam()[0]);
-        if (m_exec_conf->isCUDAErrorCheckingEnabled())
-            CHECK_CUDA_ERROR();
-        m_tuner_draw->end();
+        d_embed_idx.reset(new ArrayHandle<unsigned int>(m_embed_group->getIndexArray(),
+                                                        access_location::device,
+                                                        access_mode::read));
+        d_vel_embed.reset(new ArrayHandle<Scalar4>(m_pdata->getVelocities(),
+                                                   access_location::device,
+                                                   access_mode::read));
+        d_alt_vel_embed.reset(new ArrayHandle<Scalar4>(m_pdata->getAltVelocities(),
+                                                       access_location::device,
+                                                       access_mode::overwrite));
+        d_tag_embed.reset(new ArrayHandle<unsigned int>(m_pdata->getTags(),
+                                                        access_location::device,
+                                                        access_mode::read));
+        args.embed_idx = d_embed_idx->data;
+        args.vel_embed = d_vel_embed->data;
+        args.alt_vel_embed = d_alt_vel_embed->data;
+        args.tag_embed = d_tag_embed->data;
         }
     else
         {
-        m_tuner_draw->begin();
-        mpcd::gpu::at_draw_velocity(d_alt_vel.data,
-                                    NULL,
-                                    d_tag.data,
-                                    m_mpcd_pdata->getMass(),
-                                    NULL,
-                                    NULL,
-                                    NULL,
-                                    timestep,
-                                    seed,
-                                    T,
-                                    N_mpcd,
-                                    N_tot,
-                                    m_tuner_draw->getParam()[0]);
-        if (m_exec_conf->isCUDAErrorCheckingEnabled())
-            CHECK_CUDA_ERROR();
-        m_tuner_draw->end();
+        args.embed_idx = NULL;
+        args.vel_embed = NULL;
+        args.alt_vel_embed = NULL;
+        args.tag_embed = NULL;
         }
+
+    // random velocities are drawn for each particle and stored into the "alternate" arrays
+    ArrayHandle<double4> d_rand_vel(m_rand_vel, access_location::device, access_mode::overwrite);
+    args.rand_vel = d_rand_vel.data;
+    args.timestep = timestep;
+    args.seed = m_sysdef->getSeed();
+    args.T = (*m_T)(timestep);
+
+    m_tuner_draw->begin();
+    const auto param = m_tuner_draw->getParam();
+    mpcd::gpu::at_draw_cell_velocity(args, param[0], param[1]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_draw->end();
     }
 
 void mpcd::ATCollisionMethodGPU::applyVelocities()
     {
     // mpcd particle data
-    ArrayHandle<Scalar4> d_vel(m_mpcd_pdata->getVelocities(),
-                               access_location::device,
-                               access_mode::readwrite);
-    ArrayHandle<Scalar4> d_vel_alt(m_mpcd_pdata->getAltVelocities(),
-                                   access_location::device,
-                                   access_mode::read);
+    ArrayHandle<SolventScalar4> d_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::device,
+                                      access_mode::readwrite);
+    ArrayHandle<SolventScalar4> d_vel_alt(m_mpcd_pdata->getAltVelocities(),
+                                          access_location::device,
+                                          access_mode::read);
     const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
     unsigned int N_tot = N_mpcd;
 
@@ -117,9 +120,8 @@ void mpcd::ATCollisionMethodGPU::applyVelocities()
     ArrayHandle<double4> d_cell_vel(m_thermo->getCellVelocities(),
                                     access_location::device,
                                     access_mode::read);
-    ArrayHandle<double4> d_rand_vel(m_rand_thermo->getCellVelocities(),
-                                    access_location::device,
-                                    access_mode::read);
+    ArrayHandle<double4> d_rand_vel(m_rand_vel, access_location::device, access_mode::read);
+    const Scalar2 factors = getVelocityFactors();
 
     if (m_embed_group)
         {
@@ -146,6 +148,7 @@ void mpcd::ATCollisionMethodGPU::applyVelocities()
                                      d_embed_cell_ids.data,
                                      d_cell_vel.data,
                                      d_rand_vel.data,
+                                     factors,
                                      N_mpcd,
                                      N_tot,
                                      m_tuner_apply->getParam()[0]);
@@ -164,6 +167,7 @@ void mpcd::ATCollisionMethodGPU::applyVelocities()
                                      NULL,
                                      d_cell_vel.data,
                                      d_rand_vel.data,
+                                     factors,
                                      N_mpcd,
                                      N_tot,
                                      m_tuner_apply->getParam()[0]);
@@ -183,14 +187,19 @@ void mpcd::ATCollisionMethodGPU::setCellList(std::shared_ptr<mpcd::CellList> cl)
         if (m_cl)
             {
             m_thermo = std::make_shared<mpcd::CellThermoComputeGPU>(m_sysdef, m_cl);
-            m_rand_thermo = std::make_shared<mpcd::CellThermoComputeGPU>(m_sysdef, m_cl);
             attachCallbacks();
             }
         else
             {
             m_thermo = std::shared_ptr<mpcd::CellThermoComputeGPU>();
-            m_rand_thermo = std::shared_ptr<mpcd::CellThermoComputeGPU>();
             }
+
+#ifdef ENABLE_MPI
+        if (m_cl && m_exec_conf->getNRanks() > 1)
+            m_rand_comm = std::make_shared<mpcd::CellCommunicator>(m_sysdef, m_cl);
+        else
+            m_rand_comm = std::shared_ptr<mpcd::CellCommunicator>();
+#endif // ENABLE_MPI
         }
     }
 
@@ -7,9 +7,11 @@
  */
 
 #include "ATCollisionMethodGPU.cuh"
+#include "CellThermoComputeGPU.cuh"
 #include "ParticleDataUtilities.h"
 #include "hoomd/RNGIdentifiers.h"
 #include "hoomd/RandomNumbers.h"
+#include "hoomd/WarpTools.cuh"
 
 namespace hoomd
     {
@@ -19,67 +21,134 @@ namespace gpu
     {
 namespace kernel
     {
-__global__ void at_draw_velocity(Scalar4* d_alt_vel,
-                                 Scalar4* d_alt_vel_embed,
-                                 const unsigned int* d_tag,
-                                 const Scalar mpcd_mass,
-                                 const unsigned int* d_embed_idx,
-                                 const Scalar4* d_vel_embed,
-                                 const unsigned int* d_tag_embed,
-                                 const uint64_t timestep,
-                                 const uint16_t seed,
-                                 const Scalar T,
-                                 const unsigned int N_mpcd,
-                                 const unsigned int N_tot)
+//! Draw particle velocities for the Andersen thermostat and sum them per cell
+/*!
+ * \param d_rand_vel Summed random momentum and mass of each cell (output)
+ * \param d_alt_vel Random velocities of the MPCD particles (output)
+ * \param d_alt_vel_embed Random velocities of the embedded particles (output)
+ * \param d_cell_list MPCD cell list
+ * \param d_cell_np Number of particles in each cell
+ * \param cli Cell list indexer
+ * \param d_tag MPCD particle tags
+ * \param mpcd_mass MPCD particle mass
+ * \param d_embed_idx Indexes of the embedded particles
+ * \param d_vel_embed Velocities and masses of the embedded particles
+ * \param d_tag_embed Tags of the embedded particles
+ * \param timestep Current timestep
+ * \param seed User seed for RNG
+ * \param T Temperature
+ * \param N_mpcd Number of MPCD particles
+ * \param num_cells Number of cells
+ *
+ * \tparam tpp Number of threads per cell
+ *
+ * Each particle draws from the stream of its tag, so the velocities do not depend on \a tpp. The
+ * sums are independent of \a tpp with HOOMD_FIXED_POINT_ACCUMULATION.
+ */
+template<unsigned int tpp>
+__global__ void at_draw_cell_velocity(double4* d_rand_vel,
+                                      SolventScalar4* d_alt_vel,
+                                      Scalar4* d_alt_vel_embed,
+                                      const unsigned int* d_cell_list,
+                                      const unsigned int* d_cell_np,
+                                      const Index2D cli,
+                                      const unsigned int* d_tag,
+                                      const Scalar mpcd_mass,
+                                      const unsigned int* d_embed_idx,
+                                      const Scalar4* d_vel_embed,
+                                      const unsigned int* d_tag_embed,
+                                      const uint64_t timestep,
+                                      const uint16_t seed,
+                                      const Scalar T,
+                                      const unsigned int N_mpcd,
+                                      const unsigned int num_cells)
     {
-    // one thread per particle
+    // tpp threads per cell
     unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
-    if (idx >= N_tot)
+    if (idx >= tpp * num_cells)
         return;
 
-    unsigned int pidx;
-    unsigned int tag;
-    Scalar mass;
-    if (idx < N_mpcd)
-        {
-        pidx = idx;
-        mass = mpcd_mass;
-        tag = d_tag[idx];
-        }
-    else
+    const unsigned int cell = idx / tpp;
+    const unsigned int np = d_cell_np[cell];
+    cell_sum_t momentum_x(0), momentum_y(0), momentum_z(0), mass_sum(0);
+
+    for (unsigned int offset = (idx % tpp); offset < np; offset += tpp)
         {
-        pidx = d_embed_idx[idx - N_mpcd];
-        mass = d_vel_embed[pidx].w;
-        tag = d_tag_embed[pidx];
-        }
+        const unsigned int cur_p = d_cell_list[cli(offset, cell)];
+        unsigned int pidx;
+        unsigned int tag;
+        Scalar mass;
+        if (cur_p < N_mpcd)
+            {
+            pidx = cur_p;
+            mass = mpcd_mass;
+            tag = d_tag[cur_p];
+            }
+        else
+            {
+            pidx = d_embed_idx[cur_p - N_mpcd];
+            mass = d_vel_embed[pidx].w;
+            tag = d_tag_embed[pidx];
+            }
 
-    // draw random velocities from normal distribution
-    hoomd::RandomGenerator rng(hoomd::Seed(hoomd::RNGIdentifier::ATCollisionMethod, timestep, seed),
-                               hoomd::Counter(tag));
-    hoomd::NormalDistribution<Scalar> gen(fast::sqrt(T / mass), 0.0);
-    Scalar3 vel;
-    gen(vel.x, vel.y, rng);
-    vel.z = gen(rng);
+        // draw random velocities from normal distribution
+        hoomd::RandomGenerator rng(
+            hoomd::Seed(hoomd::RNGIdentifier::ATCollisionMethod, timestep, seed),
+            hoomd::Counter(tag));
+        hoomd::NormalDistribution<Scalar> gen(fast::sqrt(T / mass), 0.0);
+        Scalar3 vel;
+        gen(vel.x, vel.y, rng);
+        vel.z = gen(rng);
 
-    // save out velocities
-    if (idx < N_mpcd)
+        // save out velocities
+        if (cur_p < N_mpcd)
+            {
+            d_alt_vel[pidx] = make_solvent_scalar4(vel.x,
+                                                   vel.y,
+                                                   vel.z,
+                                                   __int_as_solvent_scalar(mpcd::detail::NO_CELL));
+            }
+        else
+            {
+            d_alt_vel_embed[pidx] = make_scalar4(vel.x, vel.y, vel.z, mass);
+            }
+
+        // add momentum
+        momentum_x += toCellSum((double)mass * vel.x);
+        momentum_y += toCellSum((double)mass * vel.y);
+        momentum_z += toCellSum((double)mass * vel.z);
+        mass_sum += toCellSum(mass);
+        }
+
+    // reduce quantities down into the 0-th lane per logical warp
+    if (tpp > 1)
         {
-        d_alt_vel[pidx] = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
+        hoomd::detail::WarpReduce<cell_sum_t, tpp> reducer;
+        momentum_x = reducer.Sum(momentum_x);
+        momentum_y = reducer.Sum(momentum_y);
+        momentum_z = reducer.Sum(momentum_z);
+        mass_sum = reducer.Sum(mass_sum);
         }
-    else
+
+    // 0-th lane in each warp writes the result
+    if (idx % tpp == 0)
         {
-        d_alt_vel_embed[pidx] = make_scalar4(vel.x, vel.y, vel.z, mass);
+        d_rand_vel[cell] = make_double4(fromCellSum(momentum_x),
+                                        fromCellSum(momentum_y),
+                                        fromCellSum(momentum_z),
+                                        fromCellSum(mass_sum));
         }
     }
 
-__global__ void at_apply_velocity(Scalar4* d_vel,
+__global__ void at_apply_velocity(SolventScalar4* d_vel,
                                   Scalar4* d_vel_embed,
-                                  const Scalar4* d_vel_alt,
+                                  const SolventScalar4* d_vel_alt,
                                   const unsigned int* d_embed_idx,
                                   const Scalar4* d_vel_alt_embed,
                                   const unsigned int* d_embed_cell_ids,
                                   const double4* d_cell_vel,
                                   const double4* d_rand_vel,
+                                  const Scalar2 factors,
                                   const unsigned int N_mpcd,
                                   const unsigned int N_tot)
     {
@@ -89,88 +158,132 @@ __global__ void at_apply_velocity(Scalar4* d_vel,
         return;
 
     unsigned int cell, pidx;
-    Scalar4 vel_rand;
+    Scalar3 vel, vel_rand;
     if (idx < N_mpcd)
         {
         pidx = idx;
-        const Scalar4 vel_cell = d_vel[idx];
-        cell = __scalar_as_int(vel_cell.w);
-        vel_rand = d_vel_alt[idx];
+        const SolventScalar4 vel_cell = d_vel[idx];
+        vel = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
+        cell = __solvent_scalar_as_int(vel_cell.w);
+        const SolventScalar4 vel_alt = d_vel_alt[idx];
+        vel_rand = make_scalar3(vel_alt.x, vel_alt.y, vel_alt.z);
         }
     else
         {
         pidx = d_embed_idx[idx - N_mpcd];
+        const Scalar4 vel_mass = d_vel_embed[pidx];
+        vel = make_scalar3(vel_mass.x, vel_mass.y, vel_mass.z);
         cell = d_embed_cell_ids[idx - N_mpcd];
-        vel_rand = d_vel_alt_embed[pidx];
+        const Scalar4 vel_alt = d_vel_alt_embed[pidx];
+        vel_rand = make_scalar3(vel_alt.x, vel_alt.y, vel_alt.z);
         }
 
-    // load cell data
+    // load cell data, averaging the random momentum over the mass of the cell, which includes this
+    // particle
     const double4 v_c = d_cell_vel[cell];
-    const double4 vrand_c = d_rand_vel[cell];
+    const double4 rand_sum = d_rand_vel[cell];
+    const double inv_mass = 1.0 / rand_sum.w;
+    const double3 vrand_c
+        = make_double3(rand_sum.x * inv_mass, rand_sum.y * inv_mass, rand_sum.z * inv_mass);
 
-    // compute new velocity using the cell + the random draw
-    const Scalar3 vnew = make_scalar3(v_c.x - vrand_c.x + vel_rand.x,
-                                      v_c.y - vrand_c.y + vel_rand.y,
-                                      v_c.z - vrand_c.z + vel_rand.z);
+    // compute new velocity using the cell + the relative and random velocities
+    const Scalar a = factors.x;
+    const Scalar b = factors.y;
+    const Scalar3 vnew = make_scalar3(v_c.x + a * (vel.x - v_c.x) + b * (vel_rand.x - vrand_c.x),
+                                      v_c.y + a * (vel.y - v_c.y) + b * (vel_rand.y - vrand_c.y),
+                                      v_c.z + a * (vel.z - v_c.z) + b * (vel_rand.z - vrand_c.z));
 
     if (idx < N_mpcd)
         {
-        d_vel[pidx] = make_scalar4(vnew.x, vnew.y, vnew.z, __int_as_scalar(cell));
+        d_vel[pidx] = make_solvent_scalar4(vnew.x, vnew.y, vnew.z, __int_as_solvent_scalar(cell));
         }
     else
         {
-        d_vel_embed[pidx] = make_scalar4(vnew.x, vnew.y, vnew.z, vel_rand.w);
+        d_vel_embed[pidx] = make_scalar4(vnew.x, vnew.y, vnew.z, d_vel_alt_embed[pidx].w);
         }
     }
 
     } // end namespace kernel
 
-cudaError_t at_draw_velocity(Scalar4* d_alt_vel,
-                             Scalar4* d_alt_vel_embed,
-                             const unsigned int* d_tag,
-                             const Scalar mpcd_mass,
-                             const unsigned int* d_embed_idx,
-                             const Scalar4* d_vel_embed,
-                             const unsigned int* d_tag_embed,
-                             const uint64_t timestep,
-                             const uint16_t seed,
-                             const Scalar T,
-                             const unsigned int N_mpcd,
-                             const unsigned int N_tot,
-                             const unsigned int block_size)
+//! Launch the per-cell draw kernel with the runtime number of threads per cell
+/*!
+ * \tparam cur_tpp Number of threads-per-cell for this template instantiation
+ *
+ * The launchers are recursively instantiated like mpcd::gpu::launch_begin_cell_thermo.
+ */
+template<unsigned int cur_tpp>
+inline void launch_at_draw_cell_velocity(const at_draw_args_t& args,
+                                         const unsigned int block_size,
+                                         const unsigned int tpp)
     {
-    unsigned int max_block_size;
-    cudaFuncAttributes attr;
-    cudaFuncGetAttributes(&attr, (const void*)mpcd::gpu::kernel::at_draw_velocity);
-    max_block_size = attr.maxThreadsPerBlock;
+    if (cur_tpp == tpp)
+        {
+        unsigned int max_block_size;
+        cudaFuncAttributes attr;
+        cudaFuncGetAttributes(&attr,
+                              (const void*)mpcd::gpu::kernel::at_draw_cell_velocity<cur_tpp>);
+        max_block_size = attr.maxThreadsPerBlock;
 
-    unsigned int run_block_size = min(block_size, max_block_size);
+        unsigned int run_block_size = min(block_size, max_block_size);
+        dim3 grid(cur_tpp * args.num_cells / run_block_size + 1);
+        mpcd::gpu::kernel::at_draw_cell_velocity<cur_tpp>
+            <<<grid, run_block_size>>>(args.rand_vel,
+                                       args.alt_vel,
+                                       args.alt_vel_embed,
+                                       args.cell_list,
+                                       args.cell_np,
+                                       args.cli,
+                                       args.tag,
+                                       args.mpcd_mass,
+                                       args.embed_idx,
+                                       args.vel_embed,
+                                       args.tag_embed,
+                                       args.timestep,
+                                       args.seed,
+                                       args.T,
+                                       args.N_mpcd,
+                                       args.num_cells);
+        }
+    else
+        {
+        launch_at_draw_cell_velocity<cur_tpp / 2>(args, block_size, tpp);
+        }
+    }
+//! Template specialization to break recursion
+template<>
+inline void launch_at_draw_cell_velocity<0>(const at_draw_args_t& args,
+                                            const unsigned int block_size,
+                                            const unsigned int tpp)
+    {
+    }
 
-    dim3 grid(N_tot / run_block_size + 1);
-    mpcd::gpu::kernel::at_draw_velocity<<<grid, run_block_size>>>(d_alt_vel,
-                                                                  d_alt_vel_embed,
-                                                                  d_tag,
-                                                                  mpcd_mass,
-                                                                  d_embed_idx,
-                                                                  d_vel_embed,
-                                                                  d_tag_embed,
-                                                                  timestep,
-                                                                  seed,
-                                                                  T,
-                                                                  N_mpcd,
-                                                                  N_tot);
+/*!
+ * \param args Arguments to the draw kernel
+ * \param block_size Number of threads per block
+ * \param tpp Number of threads per cell
+ *
+ * \returns cudaSuccess on completion
+ */
+cudaError_t at_draw_cell_velocity(const at_draw_args_t& args,
+                                  const unsigned int block_size,
+                                  const unsigned int tpp)
+    {
+    if (args.num_cells == 0)
+        return cudaSuccess;
 
+    launch_at_draw_cell_velocity<32>(args, block_size, tpp);
     return cudaSuccess;
     }
 
-cudaError_t at_apply_velocity(Scalar4* d_vel,
+cudaError_t at_apply_velocity(SolventScalar4* d_vel,
                               Scalar4* d_vel_embed,
-                              const Scalar4* d_vel_alt,
+                              const SolventScalar4* d_vel_alt,
                               const unsigned int* d_embed_idx,
                               const Scalar4* d_vel_alt_embed,
                               const unsigned int* d_embed_cell_ids,
                               const double4* d_cell_vel,
                               const double4* d_rand_vel,
+                              const Scalar2 factors,
                               const unsigned int N_mpcd,
                               const unsigned int N_tot,
                               const unsigned int block_size)
@@ -191,6 +304,7 @@ cudaError_t at_apply_velocity(Scalar4* d_vel,
                                                                    d_embed_cell_ids,
                                                                    d_cell_vel,
                                                                    d_rand_vel,
+                                                                   factors,
                                                                    N_mpcd,
                                                                    N_tot);
 
@@ -11,6 +11,7 @@
 
 #include <cuda_runtime.h>
 
+#include "ParticleDataUtilities.h"
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/Index1D.h"
 
@@ -20,30 +21,42 @@ namespace mpcd
     {
 namespace gpu
     {
-//! Draw particle velocities for the Andersen thermostat from Gaussian distribution
-cudaError_t at_draw_velocity(Scalar4* d_alt_vel,
-                             Scalar4* d_alt_vel_embed,
-                             const unsigned int* d_tag,
-                             const Scalar mpcd_mass,
-                             const unsigned int* d_embed_idx,
-                             const Scalar4* d_vel_embed,
-                             const unsigned int* d_tag_embed,
-                             const uint64_t timestep,
-                             const uint16_t seed,
-                             const Scalar T,
-                             const unsigned int N_mpcd,
-                             const unsigned int N_tot,
-                             const unsigned int block_size);
-
-//! Apply velocities for the Andersen thermostat
-cudaError_t at_apply_velocity(Scalar4* d_vel,
+//! Arguments to the kernel drawing the Andersen thermostat velocities
+struct at_draw_args_t
+    {
+    double4* rand_vel;             //!< Summed random momentum and mass of each cell (output)
+    SolventScalar4* alt_vel;       //!< Random velocities of the MPCD particles (output)
+    Scalar4* alt_vel_embed;        //!< Random velocities of the embedded particles (output)
+    const unsigned int* cell_list; //!< MPCD cell list
+    const unsigned int* cell_np;   //!< Number of particles in each cell
+    Index2D cli;                   //!< Cell list indexer
+    const unsigned int* tag;       //!< MPCD particle tags
+    Scalar mpcd_mass;              //!< MPCD particle mass
+    const unsigned int* embed_idx; //!< Indexes of the embedded particles
+    const Scalar4* vel_embed;      //!< Velocities and masses of the embedded particles
+    const unsigned int* tag_embed; //!< Tags of the embedded particles
+    uint64_t timestep;             //!< Current timestep
+    uint16_t seed;                 //!< User seed for RNG
+    Scalar T;                      //!< Temperature
+    unsigned int N_mpcd;           //!< Number of MPCD particles
+    unsigned int num_cells;        //!< Number of cells
+    };
+
+//! Draw particle velocities for the Andersen thermostat cell by cell and sum them
+cudaError_t at_draw_cell_velocity(const at_draw_args_t& args,
+                                  const unsigned int block_size,
+                                  const unsigned int tpp);
+
+//! Apply velocities for the Andersen thermostat or MPC-Langevin rule
+cudaError_t at_apply_velocity(SolventScalar4* d_vel,
                               Scalar4* d_vel_embed,
-                              const Scalar4* d_vel_alt,
+                              const SolventScalar4* d_vel_alt,
                               const unsigned int* d_embed_idx,
                               const Scalar4* d_vel_alt_embed,
                               const unsigned int* d_embed_cell_ids,
                               const double4* d_cell_vel,
                               const double4* d_rand_vel,
+                              const Scalar2 factors,
                               const unsigned int N_mpcd,
                               const unsigned int N_tot,
                               const unsigned int block_size);
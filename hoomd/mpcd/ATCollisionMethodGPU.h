@@ -33,14 +33,14 @@ class PYBIND11_EXPORT ATCollisionMethodGPU : public mpcd::ATCollisionMethod
     void setCellList(std::shared_ptr<mpcd::CellList> cl);
 
     protected:
-    //! Draw velocities for particles in each cell on the GPU
+    //! Draw velocities for particles in each cell and sum them on the GPU
     virtual void drawVelocities(uint64_t timestep);
 
     //! Apply the random velocities to particles in each cell on the GPU
     virtual void applyVelocities();
 
     private:
-    std::shared_ptr<Autotuner<1>> m_tuner_draw;  //!< Tuner for drawing random velocities
+    std::shared_ptr<Autotuner<2>> m_tuner_draw;  //!< Tuner for drawing random velocities
     std::shared_ptr<Autotuner<1>> m_tuner_apply; //!< Tuner for applying random velocities
     };
 
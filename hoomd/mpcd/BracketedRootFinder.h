@@ -0,0 +1,118 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/BracketedRootFinder.h
+ * \brief Definition of a safeguarded root finder for bounce-back geometries
+ */
+
+#ifndef MPCD_BRACKETED_ROOT_FINDER_H_
+#define MPCD_BRACKETED_ROOT_FINDER_H_
+
+#include "CollisionStatistics.h"
+
+#include "hoomd/HOOMDMath.h"
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__ inline
+#else
+#define HOSTDEVICE inline __attribute__((always_inline))
+#endif // __HIPCC__
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace detail
+    {
+//! Find a root of a function that is bracketed by an interval
+/*!
+ * \param f Function to find the root of
+ * \param lo Lower end of the bracketing interval
+ * \param f_lo Value of \a f at \a lo
+ * \param hi Upper end of the bracketing interval
+ * \param f_hi Value of \a f at \a hi
+ * \param target_precision Convergence tolerance on the magnitude of \a f
+ * \param max_iteration Maximum number of iterations
+ * \param stats Optional statistics to record the iterations into
+ *
+ * \returns Estimate of the root of \a f in [\a lo, \a hi]
+ *
+ * The function \a f must have a sign change on the interval, and it must provide
+ * `void operator()(Scalar x, Scalar& f, Scalar& df) const` that evaluates the function and its
+ * first derivative at \a x. The root is found using Newton's method starting from the linear
+ * interpolation between the ends of the interval. The interval is shrunk after every iteration so
+ * that it always brackets the root, and a bisection step is taken instead whenever the Newton step
+ * would leave the interval. This keeps the quadratic convergence of Newton's method in the common
+ * case while guaranteeing that the estimate never leaves the interval.
+ *
+ * Every iteration does exactly one evaluation of \a f, and the choice between the Newton and
+ * bisection step is made without branching, which keeps threads in a warp converged.
+ *
+ * If \a stats is not null, the number of evaluations of \a f is added to its iterations, and
+ * the fallback and unconverged counters are incremented if any bisection steps were taken or
+ * \a max_iteration was reached, respectively.
+ */
+template<class Function>
+HOSTDEVICE Scalar findBracketedRoot(const Function& f,
+                                    Scalar lo,
+                                    Scalar f_lo,
+                                    Scalar hi,
+                                    Scalar f_hi,
+                                    Scalar target_precision,
+                                    unsigned int max_iteration,
+                                    CollisionStatistics* stats = nullptr)
+    {
+    // an end of the interval may already be the root
+    Scalar x = lo;
+    unsigned int iteration = 0;
+    bool bisected = false;
+    bool converged = true;
+    if (fabs(f_hi) <= target_precision)
+        {
+        x = hi;
+        }
+    else if (fabs(f_lo) > target_precision)
+        {
+        // initial guess from linear interpolation is exact if f is linear
+        x = lo + (hi - lo) * f_lo / (f_lo - f_hi);
+        converged = false;
+        while (iteration < max_iteration)
+            {
+            Scalar fx, dfx;
+            f(x, fx, dfx);
+            ++iteration;
+            converged = (fabs(fx) <= target_precision);
+            if (converged)
+                break;
+
+            // shrink the interval so that it keeps bracketing the root
+            const bool same_sign_as_lo = ((fx > Scalar(0)) == (f_lo > Scalar(0)));
+            lo = (same_sign_as_lo) ? x : lo;
+            f_lo = (same_sign_as_lo) ? fx : f_lo;
+            hi = (same_sign_as_lo) ? hi : x;
+
+            // take the Newton step if it stays inside the interval, otherwise bisect
+            const Scalar x_newton = x - fx / dfx;
+            const bool inside = ((x_newton - lo) * (x_newton - hi) < Scalar(0));
+            x = (inside) ? x_newton : Scalar(0.5) * (lo + hi);
+            bisected |= !inside;
+            }
+        }
+
+    if (stats)
+        {
+        stats->iterations += iteration;
+        stats->fallbacks += bisected;
+        stats->unconverged += !converged;
+        }
+
+    return x;
+    }
+
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+#undef HOSTDEVICE
+
+#endif // MPCD_BRACKETED_ROOT_FINDER_H_
@@ -9,6 +9,8 @@
 #ifndef MPCD_BULK_GEOMETRY_H_
 #define MPCD_BULK_GEOMETRY_H_
 
+#include "CollisionStatistics.h"
+
 #include "hoomd/BoxDim.h"
 #include "hoomd/HOOMDMath.h"
 
@@ -39,6 +41,7 @@ class __attribute__((visibility("default"))) BulkGeometry
      * \param pos Proposed particle position
      * \param vel Proposed particle velocity
      * \param dt Integration time remaining
+     * \param stats Optional collision statistics (unused because there is no root finding)
      *
      * \returns True if a collision occurred, and false otherwise
      *
@@ -46,7 +49,10 @@ class __attribute__((visibility("default"))) BulkGeometry
      * is updated according to the appropriate bounce back rule, and the integration time \a dt is
      * decreased to the amount of time remaining.
      */
-    HOSTDEVICE bool detectCollision(Scalar3& pos, Scalar3& vel, Scalar& dt) const
+    HOSTDEVICE bool detectCollision(Scalar3& pos,
+                                    Scalar3& vel,
+                                    Scalar& dt,
+                                    CollisionStatistics* stats = nullptr) const
         {
         dt = Scalar(0);
         return false;
@@ -28,6 +28,11 @@ mpcd::CellCommunicator::CellCommunicator(std::shared_ptr<SystemDefinition> sysde
     {
     m_exec_conf->msg->notice(5) << "Constructing MPCD CellCommunicator" << std::endl;
 #ifdef ENABLE_HIP
+    m_stream = 0;
+    GPUVector<unsigned char> send_stage(m_exec_conf);
+    m_send_stage.swap(send_stage);
+    m_gpu_aware_mpi = m_exec_conf->getMPIConfig()->isGPUAwareMPI();
+
     if (m_exec_conf->isCUDAEnabled())
         {
         m_tuner_pack.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
@@ -88,6 +88,39 @@ class PYBIND11_EXPORT CellCommunicator : public Autotuned
         return m_cells;
         }
 
+#ifdef ENABLE_HIP
+    //! Set the stream that the send buffer is packed on
+    /*!
+     * \param stream Stream for packing the send buffer and copying it to the host
+     *
+     * Only \a stream is synchronized before the MPI calls are made, so other work can continue on
+     * the GPU while the buffers are communicated. The caller is responsible for ordering \a stream
+     * after the work that produces the properties to communicate.
+     */
+    void setStream(cudaStream_t stream)
+        {
+        m_stream = stream;
+        }
+
+    //! Get whether MPI is passed GPU device buffers
+    bool getGPUAwareMPI() const
+        {
+        return m_gpu_aware_mpi;
+        }
+
+    //! Set whether MPI is passed GPU device buffers
+    /*!
+     * \param gpu_aware_mpi If true, MPI communicates the device buffers without host staging
+     *
+     * The default is detected by MPIConfiguration::isGPUAwareMPI(). This option has no effect
+     * if the GPU is not used.
+     */
+    void setGPUAwareMPI(bool gpu_aware_mpi)
+        {
+        m_gpu_aware_mpi = gpu_aware_mpi;
+        }
+#endif // ENABLE_HIP
+
     private:
     static unsigned int num_instances; //!< Number of communicator instances
     const unsigned int m_id;           //!< Id for this communicator to use in tags
@@ -137,6 +170,9 @@ class PYBIND11_EXPORT CellCommunicator : public Autotuned
 #ifdef ENABLE_HIP
     std::shared_ptr<Autotuner<1>> m_tuner_pack;   //!< Tuner for pack kernel
     std::shared_ptr<Autotuner<1>> m_tuner_unpack; //!< Tuner for unpack kernel
+    cudaStream_t m_stream;                        //!< Stream for packing the send buffer
+    GPUVector<unsigned char> m_send_stage;        //!< Host staging buffer for GPU sends
+    bool m_gpu_aware_mpi;                         //!< True if MPI is passed device buffers
 
     //! Packs the property buffer on the GPU
     template<typename T, class PackOpT>
@@ -186,13 +222,41 @@ void mpcd::CellCommunicator::begin(const GPUArray<T>& props, const PackOpT op)
         }
 
     // resize send / receive buffers for this comm element
-    m_send_buf.resize(m_send_idx.getNumElements() * sizeof(typename PackOpT::element));
-    m_recv_buf.resize(m_send_idx.getNumElements() * sizeof(typename PackOpT::element));
+    const size_t num_bytes = m_send_idx.getNumElements() * sizeof(typename PackOpT::element);
+    m_send_buf.resize(num_bytes);
+    m_recv_buf.resize(num_bytes);
 
+    // on the GPU, the send buffer is either passed to MPI directly or staged to the host
+    GPUVector<unsigned char>* send_buf_mpi = &m_send_buf;
+    access_location::Enum mpi_loc = access_location::host;
 #ifdef ENABLE_HIP
     if (m_exec_conf->isCUDAEnabled())
         {
         packBufferGPU(props, op);
+
+        if (m_gpu_aware_mpi)
+            {
+            mpi_loc = access_location::device;
+            }
+        else
+            {
+            m_send_stage.resize(num_bytes);
+            ArrayHandle<unsigned char> d_send_buf(m_send_buf,
+                                                  access_location::device,
+                                                  access_mode::read);
+            ArrayHandle<unsigned char> h_send_stage(m_send_stage,
+                                                    access_location::host,
+                                                    access_mode::overwrite);
+            cudaMemcpyAsync(h_send_stage.data,
+                            d_send_buf.data,
+                            num_bytes,
+                            cudaMemcpyDeviceToHost,
+                            m_stream);
+            send_buf_mpi = &m_send_stage;
+            }
+        cudaStreamSynchronize(m_stream);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
         }
     else
 #endif // ENABLE_HIP
@@ -202,13 +266,7 @@ void mpcd::CellCommunicator::begin(const GPUArray<T>& props, const PackOpT op)
 
         // make the MPI calls
         {
-        // determine whether to use CPU or GPU CUDA buffers
-        access_location::Enum mpi_loc;
-            {
-            mpi_loc = access_location::host;
-            }
-
-        ArrayHandle<unsigned char> h_send_buf(m_send_buf, mpi_loc, access_mode::read);
+        ArrayHandle<unsigned char> h_send_buf(*send_buf_mpi, mpi_loc, access_mode::read);
         ArrayHandle<unsigned char> h_recv_buf(m_recv_buf, mpi_loc, access_mode::overwrite);
         typename PackOpT::element* send_buf
             = reinterpret_cast<typename PackOpT::element*>(h_send_buf.data);
@@ -380,7 +438,8 @@ void mpcd::CellCommunicator::packBufferGPU(const GPUArray<T>& props, const PackO
                                 d_send_idx.data,
                                 op,
                                 (unsigned int)m_send_idx.getNumElements(),
-                                m_tuner_pack->getParam()[0]);
+                                m_tuner_pack->getParam()[0],
+                                m_stream);
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
     m_tuner_pack->end();
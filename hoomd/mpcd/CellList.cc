@@ -2,6 +2,7 @@
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 #include "CellList.h"
+#include "hoomd/ThreadLoops.h"
 
 #ifdef ENABLE_MPI
 #include "Communicator.h"
@@ -19,7 +20,9 @@ mpcd::CellList::CellList(std::shared_ptr<SystemDefinition> sysdef)
     : Compute(sysdef), m_mpcd_pdata(m_sysdef->getMPCDParticleData()), m_cell_size(1.0),
       m_cell_np_max(4), m_cell_np(m_exec_conf), m_cell_list(m_exec_conf),
       m_embed_cell_ids(m_exec_conf), m_conditions(m_exec_conf), m_needs_compute_dim(true),
-      m_particles_sorted(false), m_virtual_change(false)
+      m_particles_sorted(false), m_virtual_change(false), m_incremental(false),
+      m_incremental_valid(false), m_incremental_N(0), m_incremental_N_tot(0),
+      m_particle_cells(m_exec_conf), m_particle_offsets(m_exec_conf), m_virtual_cells_valid(false)
     {
     assert(m_mpcd_pdata);
     m_exec_conf->msg->notice(5) << "Constructing MPCD CellList" << std::endl;
@@ -132,6 +135,9 @@ void mpcd::CellList::reallocate()
                                 << std::endl;
     m_cell_list_indexer = Index2D(m_cell_np_max, m_cell_indexer.getNumElements());
     m_cell_list.resize(m_cell_list_indexer.getNumElements());
+
+    // tracked offsets are no longer valid for the new layout
+    m_incremental_valid = false;
     }
 
 void mpcd::CellList::updateGlobalBox()
@@ -179,6 +185,7 @@ void mpcd::CellList::computeDimensions()
     {
     if (!m_needs_compute_dim)
         return;
+    m_virtual_cells_valid = false;
 
     // first update / validate the global box
     updateGlobalBox();
@@ -517,11 +524,139 @@ bool mpcd::CellList::isCommunicating(mpcd::detail::face dir)
     }
 #endif // ENABLE_MPI
 
+/*!
+ * \returns Number of cells in the global box, padded by the extra communication cells
+ */
+uint3 mpcd::CellList::getNumGlobalCells()
+    {
+    uint3 n_global_cells = m_global_cell_dim;
+#ifdef ENABLE_MPI
+    if (isCommunicating(mpcd::detail::face::east))
+        n_global_cells.x += 2 * m_num_extra;
+    if (isCommunicating(mpcd::detail::face::north))
+        n_global_cells.y += 2 * m_num_extra;
+    if (isCommunicating(mpcd::detail::face::up))
+        n_global_cells.z += 2 * m_num_extra;
+#endif // ENABLE_MPI
+    return n_global_cells;
+    }
+
+/*!
+ * \param bin_idx Local cell index of the particle
+ * \param pos Particle position
+ * \param n_global_cells Number of global cells, including extra communication cells
+ * \param global_lo Lower bound of the global box
+ * \param periodic Periodicity of the local box
+ *
+ * \returns True if the particle lies in the local cell list, false otherwise
+ */
+bool mpcd::CellList::binParticle(unsigned int& bin_idx,
+                                 const Scalar3& pos,
+                                 const uint3& n_global_cells,
+                                 const Scalar3& global_lo,
+                                 const uchar3& periodic) const
+    {
+    // bin particle assuming orthorhombic box (already validated)
+    const Scalar3 delta = (pos - m_grid_shift) - global_lo;
+    int3 global_bin = make_int3((int)std::floor(delta.x / m_cell_size),
+                                (int)std::floor(delta.y / m_cell_size),
+                                (int)std::floor(delta.z / m_cell_size));
+
+    // wrap cell back through the boundaries (grid shifting may send +/- 1 outside of range)
+    // this is done using periodic from the "local" box, since this will be periodic
+    // only when there is one rank along the dimension
+    if (periodic.x)
+        {
+        if (global_bin.x == (int)n_global_cells.x)
+            global_bin.x = 0;
+        else if (global_bin.x == -1)
+            global_bin.x = n_global_cells.x - 1;
+        }
+    if (periodic.y)
+        {
+        if (global_bin.y == (int)n_global_cells.y)
+            global_bin.y = 0;
+        else if (global_bin.y == -1)
+            global_bin.y = n_global_cells.y - 1;
+        }
+    if (periodic.z)
+        {
+        if (global_bin.z == (int)n_global_cells.z)
+            global_bin.z = 0;
+        else if (global_bin.z == -1)
+            global_bin.z = n_global_cells.z - 1;
+        }
+
+    // compute the local cell
+    int3 bin = make_int3(global_bin.x - m_origin_idx.x,
+                         global_bin.y - m_origin_idx.y,
+                         global_bin.z - m_origin_idx.z);
+
+    // validate and make sure no particles blew out of the box
+    if ((bin.x < 0 || bin.x >= (int)m_cell_dim.x) || (bin.y < 0 || bin.y >= (int)m_cell_dim.y)
+        || (bin.z < 0 || bin.z >= (int)m_cell_dim.z))
+        {
+        return false;
+        }
+
+    bin_idx = m_cell_indexer(bin.x, bin.y, bin.z);
+    return true;
+    }
+
+/*!
+ * \param keys Key of each local MD particle (output)
+ * \returns Number of local cells, or 0 if there are no embedded particles
+ *
+ * The key of an embedded particle is the local cell that it is binned into, so SFCPackTuner places
+ * the embedded particles in the same cell next to each other when it sorts the MD particles. The
+ * other particles, and embedded particles that are not in a local cell, do not get a key.
+ */
+unsigned int mpcd::CellList::computeSortKeys(std::vector<unsigned int>& keys)
+    {
+    if (!m_embed_group || m_embed_group->getNumMembers() == 0)
+        return 0;
+
+    computeDimensions();
+    const unsigned int n_cells = m_cell_indexer.getNumElements();
+    keys.assign(m_pdata->getN(), n_cells);
+
+    const uint3 n_global_cells = getNumGlobalCells();
+    const Scalar3 global_lo = m_pdata->getGlobalBox().getLo();
+    const uchar3 periodic = m_pdata->getBox().getPeriodic();
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_embed_member_idx(m_embed_group->getIndexArray(),
+                                                 access_location::host,
+                                                 access_mode::read);
+    const unsigned int N_embed = m_embed_group->getNumMembers();
+    for (unsigned int i = 0; i < N_embed; ++i)
+        {
+        const unsigned int idx = h_embed_member_idx.data[i];
+        const Scalar4 postype = h_pos.data[idx];
+        const Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+        if (std::isnan(pos.x) || std::isnan(pos.y) || std::isnan(pos.z))
+            continue;
+
+        unsigned int bin_idx;
+        if (binParticle(bin_idx, pos, n_global_cells, global_lo, periodic))
+            keys[idx] = bin_idx;
+        }
+
+    return n_cells;
+    }
+
 /*!
  * \param timestep Current simulation timestep
  */
 void mpcd::CellList::buildCellList()
     {
+    // only move particles that changed cells if the last build can be reused
+    if (m_incremental && m_incremental_valid && m_incremental_N == m_mpcd_pdata->getN())
+        {
+        buildCellListIncremental();
+        return;
+        }
+
     const BoxDim& box = m_pdata->getBox();
     const uchar3 periodic = box.getPeriodic();
 
@@ -534,15 +669,19 @@ void mpcd::CellList::buildCellList()
 
     uint3 conditions = make_uint3(0, 0, 0);
 
-    ArrayHandle<Scalar4> h_pos(m_mpcd_pdata->getPositions(),
-                               access_location::host,
-                               access_mode::read);
-    ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(),
-                               access_location::host,
-                               access_mode::readwrite);
-    unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
+    ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::readwrite);
+    const unsigned int N = m_mpcd_pdata->getN();
+    unsigned int N_mpcd = N + m_mpcd_pdata->getNVirtual();
     unsigned int N_tot = N_mpcd;
 
+    // virtual particles binned by the fillers already have their cell in the velocity
+    const unsigned int N_binned = m_virtual_cells_valid ? N_mpcd : N;
+
     // we can't modify the velocity of embedded particles, so we only read their position
     std::unique_ptr<ArrayHandle<unsigned int>> h_embed_cell_ids;
     std::unique_ptr<ArrayHandle<Scalar4>> h_pos_embed;
@@ -561,109 +700,293 @@ void mpcd::CellList::buildCellList()
         N_tot += m_embed_group->getNumMembers();
         }
 
+    // track the cell and offset of every particle for the next incremental build
+    std::unique_ptr<ArrayHandle<unsigned int>> h_particle_cells;
+    std::unique_ptr<ArrayHandle<unsigned int>> h_particle_offsets;
+    if (m_incremental)
+        {
+        m_particle_cells.resize(N_tot);
+        m_particle_offsets.resize(N_tot);
+        h_particle_cells.reset(new ArrayHandle<unsigned int>(m_particle_cells,
+                                                             access_location::host,
+                                                             access_mode::overwrite));
+        h_particle_offsets.reset(new ArrayHandle<unsigned int>(m_particle_offsets,
+                                                               access_location::host,
+                                                               access_mode::overwrite));
+        }
+
     // total effective number of cells in the global box, optionally padded by
     // extra cells in MPI simulations
-    uint3 n_global_cells = m_global_cell_dim;
-#ifdef ENABLE_MPI
-    if (isCommunicating(mpcd::detail::face::east))
-        n_global_cells.x += 2 * m_num_extra;
-    if (isCommunicating(mpcd::detail::face::north))
-        n_global_cells.y += 2 * m_num_extra;
-    if (isCommunicating(mpcd::detail::face::up))
-        n_global_cells.z += 2 * m_num_extra;
-#endif // ENABLE_MPI
-
+    const uint3 n_global_cells = getNumGlobalCells();
     const Scalar3 global_lo = m_pdata->getGlobalBox().getLo();
 
+    // bin the particles on the threads, marking any that could not be binned
+    const unsigned int nan_bin = 0xffffffff;
+    const unsigned int out_bin = 0xfffffffe;
+    m_bins.resize(N_tot);
+    auto bin_range = [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int cur_p = begin; cur_p < end; ++cur_p)
+            {
+            if (cur_p >= N && cur_p < N_binned)
+                {
+                const unsigned int cell = __solvent_scalar_as_int(h_vel.data[cur_p].w);
+                if (cell != mpcd::detail::NO_CELL)
+                    {
+                    m_bins[cur_p] = cell;
+                    continue;
+                    }
+                }
+
+            Scalar3 pos_i;
+            if (cur_p < N_mpcd)
+                {
+                const SolventScalar4 postype_i = h_pos.data[cur_p];
+                pos_i = make_scalar3(postype_i.x, postype_i.y, postype_i.z);
+                }
+            else
+                {
+                const Scalar4 postype_i
+                    = h_pos_embed->data[h_embed_member_idx->data[cur_p - N_mpcd]];
+                pos_i = make_scalar3(postype_i.x, postype_i.y, postype_i.z);
+                }
+
+            unsigned int bin_idx;
+            if (std::isnan(pos_i.x) || std::isnan(pos_i.y) || std::isnan(pos_i.z))
+                {
+                bin_idx = nan_bin;
+                }
+            else if (!binParticle(bin_idx, pos_i, n_global_cells, global_lo, periodic))
+                {
+                bin_idx = out_bin;
+                }
+            m_bins[cur_p] = bin_idx;
+            }
+    };
+    hoomd::detail::parallelForEach(*m_exec_conf, N_tot, bin_range);
+
+    // then fill the cells in order of the particles so that the cell list does not depend on
+    // the number of threads
     for (unsigned int cur_p = 0; cur_p < N_tot; ++cur_p)
         {
-        Scalar4 postype_i;
+        const unsigned int bin_idx = m_bins[cur_p];
+        if (bin_idx == nan_bin)
+            {
+            conditions.y = cur_p + 1;
+            continue;
+            }
+        else if (bin_idx == out_bin)
+            {
+            conditions.z = cur_p + 1;
+            continue;
+            }
+
+        unsigned int offset = h_cell_np.data[bin_idx];
+        if (offset < m_cell_np_max)
+            {
+            h_cell_list.data[m_cell_list_indexer(offset, bin_idx)] = cur_p;
+            }
+        else
+            {
+            // overflow
+            conditions.x = std::max(conditions.x, offset + 1);
+            }
+
+        // stash the current particle bin into the velocity array
         if (cur_p < N_mpcd)
             {
-            postype_i = h_pos.data[cur_p];
+            h_vel.data[cur_p].w = __int_as_solvent_scalar(bin_idx);
             }
         else
             {
-            postype_i = h_pos_embed->data[h_embed_member_idx->data[cur_p - N_mpcd]];
+            h_embed_cell_ids->data[cur_p - N_mpcd] = bin_idx;
             }
-        Scalar3 pos_i = make_scalar3(postype_i.x, postype_i.y, postype_i.z);
 
-        if (std::isnan(pos_i.x) || std::isnan(pos_i.y) || std::isnan(pos_i.z))
+        if (m_incremental)
             {
-            conditions.y = cur_p + 1;
-            continue;
+            h_particle_cells->data[cur_p] = bin_idx;
+            h_particle_offsets->data[cur_p] = offset;
             }
 
-        // bin particle assuming orthorhombic box (already validated)
-        const Scalar3 delta = (pos_i - m_grid_shift) - global_lo;
-        int3 global_bin = make_int3((int)std::floor(delta.x / m_cell_size),
-                                    (int)std::floor(delta.y / m_cell_size),
-                                    (int)std::floor(delta.z / m_cell_size));
+        // increment the counter always
+        ++h_cell_np.data[bin_idx];
+        }
+
+    // the tracked cells can only be reused if every particle was placed
+    m_incremental_valid
+        = (m_incremental && conditions.x == 0 && conditions.y == 0 && conditions.z == 0);
+    m_incremental_N = m_mpcd_pdata->getN();
+    m_incremental_N_tot = N_tot;
+
+    // write out the conditions
+    m_conditions.resetFlags(conditions);
+    }
+
+/*!
+ * The MPCD particles from the last build are kept in their cells unless their cell changed, in
+ * which case they are removed from the old cell and appended to the new one. A particle is removed
+ * by moving the last particle of its cell into its slot, so the cell stays contiguous. The virtual
+ * and embedded particles are always removed and reinserted because their number and indexes may
+ * change between builds. Virtual particles that the fillers binned are inserted into the cells
+ * they were given without being binned again.
+ *
+ * If a cell overflows, building stops and the overflow is signaled through the conditions so that
+ * a full build is done after the cell list is reallocated.
+ */
+void mpcd::CellList::buildCellListIncremental()
+    {
+    const BoxDim& box = m_pdata->getBox();
+    const uchar3 periodic = box.getPeriodic();
+
+    const unsigned int N = m_mpcd_pdata->getN();
+    const unsigned int N_mpcd = N + m_mpcd_pdata->getNVirtual();
+    unsigned int N_tot = N_mpcd;
+    if (m_embed_group)
+        {
+        N_tot += m_embed_group->getNumMembers();
+        }
+
+    // keep the tracked particles of the last build in range while removing them
+    m_particle_cells.resize(std::max(N_tot, m_incremental_N_tot));
+    m_particle_offsets.resize(std::max(N_tot, m_incremental_N_tot));
+
+    ArrayHandle<unsigned int> h_cell_list(m_cell_list,
+                                          access_location::host,
+                                          access_mode::readwrite);
+    ArrayHandle<unsigned int> h_cell_np(m_cell_np, access_location::host, access_mode::readwrite);
+    ArrayHandle<unsigned int> h_particle_cells(m_particle_cells,
+                                               access_location::host,
+                                               access_mode::readwrite);
+    ArrayHandle<unsigned int> h_particle_offsets(m_particle_offsets,
+                                                 access_location::host,
+                                                 access_mode::readwrite);
+
+    uint3 conditions = make_uint3(0, 0, 0);
 
-        // wrap cell back through the boundaries (grid shifting may send +/- 1 outside of range)
-        // this is done using periodic from the "local" box, since this will be periodic
-        // only when there is one rank along the dimension
-        if (periodic.x)
+    // remove a particle by moving the last particle in its cell into its slot
+    auto remove_particle = [&](unsigned int pid)
+    {
+        const unsigned int cell = h_particle_cells.data[pid];
+        const unsigned int offset = h_particle_offsets.data[pid];
+        const unsigned int last = --h_cell_np.data[cell];
+        if (offset != last)
             {
-            if (global_bin.x == (int)n_global_cells.x)
-                global_bin.x = 0;
-            else if (global_bin.x == -1)
-                global_bin.x = n_global_cells.x - 1;
+            const unsigned int moved = h_cell_list.data[m_cell_list_indexer(last, cell)];
+            h_cell_list.data[m_cell_list_indexer(offset, cell)] = moved;
+            h_particle_offsets.data[moved] = offset;
             }
-        if (periodic.y)
+    };
+
+    // append a particle to a cell, returning false on overflow
+    auto insert_particle = [&](unsigned int pid, unsigned int cell)
+    {
+        const unsigned int offset = h_cell_np.data[cell];
+        if (offset >= m_cell_np_max)
             {
-            if (global_bin.y == (int)n_global_cells.y)
-                global_bin.y = 0;
-            else if (global_bin.y == -1)
-                global_bin.y = n_global_cells.y - 1;
+            conditions.x = offset + 1;
+            return false;
             }
-        if (periodic.z)
+        h_cell_list.data[m_cell_list_indexer(offset, cell)] = pid;
+        h_particle_cells.data[pid] = cell;
+        h_particle_offsets.data[pid] = offset;
+        ++h_cell_np.data[cell];
+        return true;
+    };
+
+    for (unsigned int cur_p = m_incremental_N; cur_p < m_incremental_N_tot; ++cur_p)
+        {
+        remove_particle(cur_p);
+        }
+
+    ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::readwrite);
+
+    std::unique_ptr<ArrayHandle<unsigned int>> h_embed_cell_ids;
+    std::unique_ptr<ArrayHandle<Scalar4>> h_pos_embed;
+    std::unique_ptr<ArrayHandle<unsigned int>> h_embed_member_idx;
+    if (m_embed_group)
+        {
+        h_embed_cell_ids.reset(new ArrayHandle<unsigned int>(m_embed_cell_ids,
+                                                             access_location::host,
+                                                             access_mode::overwrite));
+        h_pos_embed.reset(new ArrayHandle<Scalar4>(m_pdata->getPositions(),
+                                                   access_location::host,
+                                                   access_mode::read));
+        h_embed_member_idx.reset(new ArrayHandle<unsigned int>(m_embed_group->getIndexArray(),
+                                                               access_location::host,
+                                                               access_mode::read));
+        }
+
+    const uint3 n_global_cells = getNumGlobalCells();
+    const Scalar3 global_lo = m_pdata->getGlobalBox().getLo();
+    const unsigned int N_binned = m_virtual_cells_valid ? N_mpcd : N;
+
+    bool overflowed = false;
+    for (unsigned int cur_p = 0; cur_p < N_tot && !overflowed; ++cur_p)
+        {
+        // virtual particles binned by the fillers are appended to their cell directly
+        if (cur_p >= N && cur_p < N_binned)
             {
-            if (global_bin.z == (int)n_global_cells.z)
-                global_bin.z = 0;
-            else if (global_bin.z == -1)
-                global_bin.z = n_global_cells.z - 1;
+            const unsigned int cell = __solvent_scalar_as_int(h_vel.data[cur_p].w);
+            if (cell != mpcd::detail::NO_CELL)
+                {
+                overflowed = !insert_particle(cur_p, cell);
+                continue;
+                }
             }
 
-        // compute the local cell
-        int3 bin = make_int3(global_bin.x - m_origin_idx.x,
-                             global_bin.y - m_origin_idx.y,
-                             global_bin.z - m_origin_idx.z);
+        Scalar3 pos_i;
+        if (cur_p < N_mpcd)
+            {
+            const SolventScalar4 postype_i = h_pos.data[cur_p];
+            pos_i = make_scalar3(postype_i.x, postype_i.y, postype_i.z);
+            }
+        else
+            {
+            const Scalar4 postype_i = h_pos_embed->data[h_embed_member_idx->data[cur_p - N_mpcd]];
+            pos_i = make_scalar3(postype_i.x, postype_i.y, postype_i.z);
+            }
 
-        // validate and make sure no particles blew out of the box
-        if ((bin.x < 0 || bin.x >= (int)m_cell_dim.x) || (bin.y < 0 || bin.y >= (int)m_cell_dim.y)
-            || (bin.z < 0 || bin.z >= (int)m_cell_dim.z))
+        if (std::isnan(pos_i.x) || std::isnan(pos_i.y) || std::isnan(pos_i.z))
             {
-            conditions.z = cur_p + 1;
+            conditions.y = cur_p + 1;
             continue;
             }
 
-        unsigned int bin_idx = m_cell_indexer(bin.x, bin.y, bin.z);
-        unsigned int offset = h_cell_np.data[bin_idx];
-        if (offset < m_cell_np_max)
+        unsigned int bin_idx;
+        if (!binParticle(bin_idx, pos_i, n_global_cells, global_lo, periodic))
             {
-            h_cell_list.data[m_cell_list_indexer(offset, bin_idx)] = cur_p;
+            conditions.z = cur_p + 1;
+            continue;
             }
-        else
+
+        // MPCD particles only need to move if they changed cells
+        if (cur_p >= N || bin_idx != h_particle_cells.data[cur_p])
             {
-            // overflow
-            conditions.x = std::max(conditions.x, offset + 1);
+            if (cur_p < N)
+                {
+                remove_particle(cur_p);
+                }
+            overflowed = !insert_particle(cur_p, bin_idx);
             }
 
-        // stash the current particle bin into the velocity array
         if (cur_p < N_mpcd)
             {
-            h_vel.data[cur_p].w = __int_as_scalar(bin_idx);
+            h_vel.data[cur_p].w = __int_as_solvent_scalar(bin_idx);
             }
         else
             {
             h_embed_cell_ids->data[cur_p - N_mpcd] = bin_idx;
             }
-
-        // increment the counter always
-        ++h_cell_np.data[bin_idx];
         }
 
+    m_incremental_valid = (conditions.x == 0 && conditions.y == 0 && conditions.z == 0);
+    m_incremental_N_tot = N_tot;
+
     // write out the conditions
     m_conditions.resetFlags(conditions);
     }
@@ -677,6 +1000,10 @@ void mpcd::CellList::sort(uint64_t timestep,
                           const GPUArray<unsigned int>& order,
                           const GPUArray<unsigned int>& rorder)
     {
+    // tracked cells are only kept if they can be remapped along with the cell list
+    const bool remap_tracked = m_incremental_valid;
+    m_incremental_valid = false;
+
     // no need to do any sorting if we can still be called at the current timestep
     if (peekCompute(timestep))
         return;
@@ -698,6 +1025,18 @@ void mpcd::CellList::sort(uint64_t timestep,
                                           access_mode::readwrite);
     const unsigned int N_mpcd = m_mpcd_pdata->getN();
 
+    std::unique_ptr<ArrayHandle<unsigned int>> h_particle_cells;
+    std::unique_ptr<ArrayHandle<unsigned int>> h_particle_offsets;
+    if (remap_tracked)
+        {
+        h_particle_cells.reset(new ArrayHandle<unsigned int>(m_particle_cells,
+                                                             access_location::host,
+                                                             access_mode::readwrite));
+        h_particle_offsets.reset(new ArrayHandle<unsigned int>(m_particle_offsets,
+                                                               access_location::host,
+                                                               access_mode::readwrite));
+        }
+
     for (unsigned int idx = 0; idx < getNCells(); ++idx)
         {
         const unsigned int np = h_cell_np.data[idx];
@@ -708,10 +1047,17 @@ void mpcd::CellList::sort(uint64_t timestep,
             // only update indexes of MPCD particles, not virtual or embedded particles
             if (pid < N_mpcd)
                 {
-                h_cell_list.data[cl_idx] = h_rorder.data[pid];
+                const unsigned int new_pid = h_rorder.data[pid];
+                h_cell_list.data[cl_idx] = new_pid;
+                if (remap_tracked)
+                    {
+                    h_particle_cells->data[new_pid] = idx;
+                    h_particle_offsets->data[new_pid] = offset;
+                    }
                 }
             }
         }
+    m_incremental_valid = remap_tracked;
     }
 
 #ifdef ENABLE_MPI
@@ -798,10 +1144,11 @@ bool mpcd::CellList::checkConditions()
         Scalar4 pos_empty_i;
         if (n < m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual())
             {
-            ArrayHandle<Scalar4> h_pos(m_mpcd_pdata->getPositions(),
-                                       access_location::host,
-                                       access_mode::read);
-            pos_empty_i = h_pos.data[n];
+            ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                              access_location::host,
+                                              access_mode::read);
+            const SolventScalar4 postype = h_pos.data[n];
+            pos_empty_i = make_scalar4(postype.x, postype.y, postype.z, postype.w);
             if (n < m_mpcd_pdata->getN())
                 m_exec_conf->msg->errorAllRanks()
                     << "MPCD particle is no longer in the simulation box" << std::endl;
@@ -929,11 +1276,21 @@ const int3 mpcd::CellList::wrapGlobalCell(const int3& cell) const
 
 void mpcd::detail::export_CellList(pybind11::module& m)
     {
-    pybind11::class_<mpcd::CellList, Compute, std::shared_ptr<mpcd::CellList>>(m, "CellList")
-        .def(pybind11::init<std::shared_ptr<SystemDefinition>>())
+    pybind11::class_<mpcd::CellList, Compute, SortKeyProvider, std::shared_ptr<mpcd::CellList>> cl(
+        m,
+        "CellList");
+    cl.def(pybind11::init<std::shared_ptr<SystemDefinition>>())
         .def_property("cell_size", &mpcd::CellList::getCellSize, &mpcd::CellList::setCellSize)
+        .def_property("incremental",
+                      &mpcd::CellList::getIncremental,
+                      &mpcd::CellList::setIncremental)
         .def("setEmbeddedGroup", &mpcd::CellList::setEmbeddedGroup)
         .def("removeEmbeddedGroup", &mpcd::CellList::removeEmbeddedGroup);
+#ifdef ENABLE_MPI
+    cl.def_property("extra_cells",
+                    &mpcd::CellList::getNExtraCells,
+                    &mpcd::CellList::setNExtraCells);
+#endif // ENABLE_MPI
     }
 
     } // end namespace hoomd
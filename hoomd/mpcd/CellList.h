@@ -19,18 +19,24 @@
 #include "hoomd/Compute.h"
 #include "hoomd/GPUFlags.h"
 #include "hoomd/ParticleGroup.h"
+#include "hoomd/SortKeyProvider.h"
 
 #include "hoomd/extern/nano-signal-slot/nano_signal_slot.hpp"
 #include <pybind11/pybind11.h>
 
 #include <array>
+#include <vector>
 
 namespace hoomd
     {
 namespace mpcd
     {
 //! Computes the MPCD cell list on the CPU
-class PYBIND11_EXPORT CellList : public Compute
+/*!
+ * The cell list is also a SortKeyProvider, so that SFCPackTuner can order the embedded particles
+ * by their cells, like mpcd::Sorter orders the MPCD particles.
+ */
+class PYBIND11_EXPORT CellList : public Compute, public SortKeyProvider
     {
     public:
     //! Constructor
@@ -45,6 +51,12 @@ class PYBIND11_EXPORT CellList : public Compute
     //! Sizes the cell list based on the box
     void computeDimensions();
 
+    //! Check if the cell list needs to be resized before it is used
+    bool needsComputeDimensions() const
+        {
+        return m_needs_compute_dim;
+        }
+
     //! Get the cell list data
     const GPUArray<unsigned int>& getCellList() const
         {
@@ -148,6 +160,18 @@ class PYBIND11_EXPORT CellList : public Compute
 
 #ifdef ENABLE_MPI
     //! Set the number of extra communication cells
+    /*!
+     * \param num_extra Number of extra cells to pad each decomposed face of the domain with
+     *
+     * The extra cells act as a guard layer. MPCD particles are only migrated on collision steps,
+     * and only if they have left the coverage box, so particles that stream into the guard layer
+     * and back between collisions are never sent. To avoid migration entirely for a given
+     * particle, the guard layer should be at least as thick as the distance it can stream between
+     * collisions, i.e., the collision period times the time step times its speed. Every extra
+     * cell is also communicated when the cell properties are reduced, so thick guard layers trade
+     * migration traffic for cell traffic. The guard layer cannot extend past the neighboring
+     * domains, which is checked by mpcd::Communicator.
+     */
     void setNExtraCells(unsigned int num_extra)
         {
         m_num_extra = num_extra;
@@ -177,6 +201,10 @@ class PYBIND11_EXPORT CellList : public Compute
         }
 
     //! Set the grid shift vector
+    /*!
+     * \param shift Grid shift vector
+     * \note Changing the shift invalidates the cells written for the virtual particles
+     */
     void setGridShift(const Scalar3& shift)
         {
         if (std::fabs(shift.x) > m_max_grid_shift || std::fabs(shift.y) > m_max_grid_shift
@@ -189,6 +217,10 @@ class PYBIND11_EXPORT CellList : public Compute
             throw std::runtime_error("Error setting MPCD grid shift");
             }
 
+        if (shift.x != m_grid_shift.x || shift.y != m_grid_shift.y || shift.z != m_grid_shift.z)
+            {
+            m_virtual_cells_valid = false;
+            }
         m_grid_shift = shift;
         }
 
@@ -201,6 +233,58 @@ class PYBIND11_EXPORT CellList : public Compute
     //! Calculate current cell occupancy statistics
     virtual void getCellStatistics() const;
 
+    //! Get the number of global cells, including any extra communication cells
+    uint3 getNumGlobalCells();
+
+    //! Bin a particle into a local cell
+    bool binParticle(unsigned int& bin_idx,
+                     const Scalar3& pos,
+                     const uint3& n_global_cells,
+                     const Scalar3& global_lo,
+                     const uchar3& periodic) const;
+
+    //! Check if the cells written for the virtual particles are used by the next build
+    bool getVirtualCellsValid() const
+        {
+        return m_virtual_cells_valid;
+        }
+
+    //! Mark the cells written for the virtual particles as valid
+    /*!
+     * A filler that bins the virtual particles while drawing them writes the local cell of each
+     * particle into its velocity, as the cell list does, and mpcd::detail::NO_CELL otherwise. The
+     * builds then take the written cells instead of binning these particles again, and place them
+     * after the MPCD particles in each cell. The cells must be found with binParticle() after the
+     * grid shift is set and the dimensions are computed. They stay valid until either changes.
+     */
+    void validateVirtualCells()
+        {
+        m_virtual_cells_valid = true;
+        }
+
+    //! Get whether the cell list is updated incrementally
+    bool getIncremental() const
+        {
+        return m_incremental;
+        }
+
+    //! Set whether the cell list is updated incrementally
+    /*!
+     * \param incremental If true, only particles whose cell changed are moved between cells
+     *
+     * The cell and offset of each particle in the cell list are tracked between builds, and only
+     * particles that changed cells are removed and reinserted. The virtual and embedded particles
+     * are always reinserted. A full build is done whenever the tracked state is not valid, e.g.,
+     * after a change in the number of particles or the cell list dimensions, or after overflow.
+     *
+     * \note Incremental builds are currently only implemented on the CPU.
+     */
+    void setIncremental(bool incremental)
+        {
+        m_incremental = incremental;
+        m_incremental_valid = false;
+        }
+
     //! Gets the group of particles that is coupled to the MPCD solvent through the collision step
     std::shared_ptr<ParticleGroup> getEmbeddedGroup() const
         {
@@ -229,6 +313,9 @@ class PYBIND11_EXPORT CellList : public Compute
         return m_embed_cell_ids;
         }
 
+    //! Compute the cells of the embedded particles as their sort keys
+    virtual unsigned int computeSortKeys(std::vector<unsigned int>& keys);
+
     //! Get the signal for dimensions changing
     /*!
      * \returns A signal that subscribers can attach to be notified that the
@@ -281,6 +368,9 @@ class PYBIND11_EXPORT CellList : public Compute
     //! Builds the cell list and handles cell list memory
     virtual void buildCellList();
 
+    //! Updates the cell list by moving only the particles that changed cells
+    void buildCellListIncremental();
+
     //! Callback to sort cell list when particle data is sorted
     virtual void sort(uint64_t timestep,
                       const GPUArray<unsigned int>& order,
@@ -315,6 +405,16 @@ class PYBIND11_EXPORT CellList : public Compute
         m_virtual_change = true;
         }
 
+    bool m_incremental;                         //!< True if builds are incremental
+    bool m_incremental_valid;                   //!< True if the tracked cells are valid
+    unsigned int m_incremental_N;               //!< Number of MPCD particles in the last build
+    unsigned int m_incremental_N_tot;           //!< Number of all particles in the last build
+    GPUVector<unsigned int> m_particle_cells;   //!< Cell of each particle in the last build
+    GPUVector<unsigned int> m_particle_offsets; //!< Offset of each particle in its cell
+    std::vector<unsigned int> m_bins;           //!< Bin of each particle during a full CPU build
+
+    bool m_virtual_cells_valid; //!< True if the cells written for the virtual particles are valid
+
     //! Update global simulation box and check that cell list is compatible with it
     void updateGlobalBox();
 
@@ -48,9 +48,9 @@ namespace kernel
 __global__ void compute_cell_list(unsigned int* d_cell_np,
                                   unsigned int* d_cell_list,
                                   uint3* d_conditions,
-                                  Scalar4* d_vel,
+                                  SolventScalar4* d_vel,
                                   unsigned int* d_embed_cell_ids,
-                                  const Scalar4* d_pos,
+                                  const SolventScalar4* d_pos,
                                   const Scalar4* d_pos_embed,
                                   const unsigned int* d_embed_member_idx,
                                   const uchar3 periodic,
@@ -70,16 +70,17 @@ __global__ void compute_cell_list(unsigned int* d_cell_np,
     if (idx >= N_tot)
         return;
 
-    Scalar4 postype_i;
+    Scalar3 pos_i;
     if (idx < N_mpcd)
         {
-        postype_i = d_pos[idx];
+        const SolventScalar4 postype_i = d_pos[idx];
+        pos_i = make_scalar3(postype_i.x, postype_i.y, postype_i.z);
         }
     else
         {
-        postype_i = d_pos_embed[d_embed_member_idx[idx - N_mpcd]];
+        const Scalar4 postype_i = d_pos_embed[d_embed_member_idx[idx - N_mpcd]];
+        pos_i = make_scalar3(postype_i.x, postype_i.y, postype_i.z);
         }
-    const Scalar3 pos_i = make_scalar3(postype_i.x, postype_i.y, postype_i.z);
 
     if (isnan(pos_i.x) || isnan(pos_i.y) || isnan(pos_i.z))
         {
@@ -147,7 +148,7 @@ __global__ void compute_cell_list(unsigned int* d_cell_np,
     // stash the current particle bin into the velocity array
     if (idx < N_mpcd)
         {
-        d_vel[idx].w = __int_as_scalar(bin_idx);
+        d_vel[idx].w = __int_as_solvent_scalar(bin_idx);
         }
     else
         {
@@ -257,9 +258,9 @@ __global__ void cell_apply_sort(unsigned int* d_cell_list,
 cudaError_t mpcd::gpu::compute_cell_list(unsigned int* d_cell_np,
                                          unsigned int* d_cell_list,
                                          uint3* d_conditions,
-                                         Scalar4* d_vel,
+                                         SolventScalar4* d_vel,
                                          unsigned int* d_embed_cell_ids,
-                                         const Scalar4* d_pos,
+                                         const SolventScalar4* d_pos,
                                          const Scalar4* d_pos_embed,
                                          const unsigned int* d_embed_member_idx,
                                          const uchar3& periodic,
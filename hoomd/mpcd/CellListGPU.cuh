@@ -11,6 +11,7 @@
 
 #include <cuda_runtime.h>
 
+#include "ParticleDataUtilities.h"
 #include "hoomd/BoxDim.h"
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/Index1D.h"
@@ -25,9 +26,9 @@ namespace gpu
 cudaError_t compute_cell_list(unsigned int* d_cell_np,
                               unsigned int* d_cell_list,
                               uint3* d_conditions,
-                              Scalar4* d_vel,
+                              SolventScalar4* d_vel,
                               unsigned int* d_embed_cell_ids,
-                              const Scalar4* d_pos,
+                              const SolventScalar4* d_pos,
                               const Scalar4* d_pos_embed,
                               const unsigned int* d_embed_member_idx,
                               const uchar3& periodic,
@@ -8,6 +8,7 @@
 
 #include "CellThermoCompute.h"
 #include "ReductionOperators.h"
+#include "hoomd/ThreadLoops.h"
 
 namespace hoomd
     {
@@ -59,6 +60,13 @@ void mpcd::CellThermoCompute::compute(uint64_t timestep)
         return;
     m_last_computed = timestep;
 
+    // the cell properties may have already been accumulated while streaming
+    if (finishFusedCompute(timestep))
+        {
+        m_needs_net_reduce = true;
+        return;
+        }
+
     // cell list needs to be up to date first
     m_cl->compute(timestep);
 
@@ -147,7 +155,7 @@ struct CellPropertySum
     CellPropertySum(const unsigned int* cell_list_,
                     const unsigned int* cell_np_,
                     const Index2D& cli_,
-                    const Scalar4* vel_,
+                    const SolventScalar4* vel_,
                     const Scalar mass_,
                     const Scalar4* embed_vel_,
                     const unsigned int* embed_idx_,
@@ -183,7 +191,7 @@ struct CellPropertySum
             double mass_i;
             if (cur_p < N_mpcd)
                 {
-                Scalar4 vel_cell = vel[cur_p];
+                SolventScalar4 vel_cell = vel[cur_p];
                 vel_i = make_double3(vel_cell.x, vel_cell.y, vel_cell.z);
                 mass_i = mass;
                 }
@@ -210,7 +218,7 @@ struct CellPropertySum
     const unsigned int* cell_np;   //!< Number of particles per cell
     const Index2D cli;             //!< Cell list indexer
 
-    const Scalar4* vel;            //!< MPCD particle velocities
+    const SolventScalar4* vel;     //!< MPCD particle velocities
     const Scalar mass;             //!< MPCD particle mass
     const Scalar4* embed_vel;      //!< Embedded particle velocities
     const unsigned int* embed_idx; //!< Embedded particle indexes
@@ -232,9 +240,9 @@ void mpcd::CellThermoCompute::beginOuterCellProperties()
     const Index2D& cli = m_cl->getCellListIndexer();
 
     // MPCD particle data
-    ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(),
-                               access_location::host,
-                               access_mode::read);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::read);
     const Scalar mpcd_mass = m_mpcd_pdata->getMass();
     const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
 
@@ -352,9 +360,9 @@ void mpcd::CellThermoCompute::calcInnerCellProperties()
     // MPCD particle data
     const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
     const Scalar mpcd_mass = m_mpcd_pdata->getMass();
-    ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(),
-                               access_location::host,
-                               access_mode::read);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::read);
 
     // Embedded particle data
     std::unique_ptr<ArrayHandle<Scalar4>> h_embed_vel;
@@ -407,12 +415,16 @@ void mpcd::CellThermoCompute::calcInnerCellProperties()
         hi = m_cl->getDim();
         }
 
-    // iterate over all of the inner cells and compute average velocity, energy, temperature
+    // iterate over all of the inner cells and compute average velocity, energy, temperature.
+    // every cell is summed from its own particles, so rows of cells can be done on the threads.
     const bool need_energy = m_flags[mpcd::detail::thermo_options::energy];
-    for (unsigned int k = lo.z; k < hi.z; ++k)
-        {
-        for (unsigned int j = lo.y; j < hi.y; ++j)
+    const unsigned int n_y = hi.y - lo.y;
+    auto compute_rows = [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int row = begin; row < end; ++row)
             {
+            const unsigned int j = lo.y + row % n_y;
+            const unsigned int k = lo.z + row / n_y;
             for (unsigned int i = lo.x; i < hi.x; ++i)
                 {
                 const unsigned int cur_cell = ci(i, j, k);
@@ -446,8 +458,9 @@ void mpcd::CellThermoCompute::calcInnerCellProperties()
                     h_cell_energy.data[cur_cell] = make_double3(ke, temp, __int_as_double(np));
                     }
                 } // i
-            } // j
-        } // k
+            } // row
+    };
+    hoomd::detail::parallelForEach(*m_exec_conf, n_y * (hi.z - lo.z), compute_rows);
     }
 
 void mpcd::CellThermoCompute::computeNetProperties()
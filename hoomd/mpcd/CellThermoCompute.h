@@ -20,6 +20,7 @@
 #endif // ENABLE_MPI
 
 #include "hoomd/Compute.h"
+#include "hoomd/PythonLocalDataAccess.h"
 #include "hoomd/SystemDefinition.h"
 #include "hoomd/extern/nano-signal-slot/nano_signal_slot.hpp"
 #include <pybind11/pybind11.h>
@@ -138,7 +139,7 @@ class PYBIND11_EXPORT CellThermoCompute : public Compute
 
     protected:
     //! Compute the cell properties
-    void computeCellProperties(uint64_t timestep);
+    virtual void computeCellProperties(uint64_t timestep);
 
 #ifdef ENABLE_MPI
     //! Begin the calculation of outer cell properties
@@ -154,6 +155,18 @@ class PYBIND11_EXPORT CellThermoCompute : public Compute
     //! Compute the net properties from the cell properties
     virtual void computeNetProperties();
 
+    //! Finish computing cell properties that were accumulated while streaming
+    /*!
+     * \param timestep Current timestep
+     * \returns True if the cell properties were finished, false if they need to be computed
+     *
+     * The base class does not support accumulating properties while streaming.
+     */
+    virtual bool finishFusedCompute(uint64_t timestep)
+        {
+        return false;
+        }
+
     std::shared_ptr<mpcd::ParticleData> m_mpcd_pdata; //!< MPCD particle data
     std::shared_ptr<mpcd::CellList> m_cl;             //!< MPCD cell list
 #ifdef ENABLE_MPI
@@ -176,10 +189,10 @@ class PYBIND11_EXPORT CellThermoCompute : public Compute
 
     Nano::Signal<void(uint64_t timestep)> m_callbacks; //!< Signal for callback functions
 
-    private:
     //! Allocate memory per cell
     void reallocate(unsigned int ncells);
 
+    private:
     //! Slot for the number of virtual particles changing
     /*!
      * All thermo properties should be recomputed if the number of virtual particles changes.
@@ -192,10 +205,121 @@ class PYBIND11_EXPORT CellThermoCompute : public Compute
         }
     };
 
+//! Zero-copy access to the cell properties from Python
+/*!
+ * The buffers hold the properties from the last call to compute() for every cell on this rank,
+ * including the cells that overlap neighboring ranks. Cells are ordered by the cell indexer, so
+ * the arrays can be reshaped to the cell dimensions with the x index varying fastest. All buffers
+ * are read only.
+ *
+ * \tparam Output The buffer output type (either HOOMDHostBuffer or HOOMDDeviceBuffer)
+ */
+template<class Output>
+class PYBIND11_EXPORT LocalCellThermoData
+    : public LocalDataAccess<Output, mpcd::CellThermoCompute>
+    {
+    public:
+    LocalCellThermoData(mpcd::CellThermoCompute& data)
+        : LocalDataAccess<Output, mpcd::CellThermoCompute>(data), m_velocity_handle(),
+          m_energy_handle()
+        {
+        }
+
+    virtual ~LocalCellThermoData() = default;
+
+    Output getVelocities()
+        {
+        return this->template getBuffer<double4, double, GPUArray>(
+            m_velocity_handle,
+            &CellThermoCompute::getCellVelocities,
+            {getNCells(), 3},
+            false);
+        }
+
+    Output getMasses()
+        {
+        return this->template getBuffer<double4, double, GPUArray>(
+            m_velocity_handle,
+            &CellThermoCompute::getCellVelocities,
+            {getNCells()},
+            false,
+            3 * sizeof(double));
+        }
+
+    Output getKineticEnergies()
+        {
+        return this->template getBuffer<double3, double, GPUArray>(
+            m_energy_handle,
+            &CellThermoCompute::getCellEnergies,
+            {getNCells()},
+            false);
+        }
+
+    Output getTemperatures()
+        {
+        return this->template getBuffer<double3, double, GPUArray>(
+            m_energy_handle,
+            &CellThermoCompute::getCellEnergies,
+            {getNCells()},
+            false,
+            sizeof(double));
+        }
+
+    Output getNumParticles()
+        {
+        return this->template getBuffer<double3, unsigned int, GPUArray>(
+            m_energy_handle,
+            &CellThermoCompute::getCellEnergies,
+            {getNCells()},
+            false,
+            2 * sizeof(double));
+        }
+
+    //! Get the number of cells along each dimension
+    pybind11::tuple getCellDims()
+        {
+        const Index3D& ci = this->m_data.getCellIndexer();
+        return pybind11::make_tuple(ci.getW(), ci.getH(), ci.getD());
+        }
+
+    protected:
+    void clear()
+        {
+        m_velocity_handle.reset(nullptr);
+        m_energy_handle.reset(nullptr);
+        }
+
+    private:
+    std::unique_ptr<ArrayHandle<double4>> m_velocity_handle;
+    std::unique_ptr<ArrayHandle<double3>> m_energy_handle;
+
+    size_t getNCells()
+        {
+        return this->m_data.getCellIndexer().getNumElements();
+        }
+    };
+
 namespace detail
     {
 //! Export the CellThermoCompute class to python
 void export_CellThermoCompute(pybind11::module& m);
+
+//! Export the zero-copy access to the cell properties to python
+template<class Output> void export_LocalCellThermoData(pybind11::module& m, std::string name)
+    {
+    pybind11::class_<LocalCellThermoData<Output>, std::shared_ptr<LocalCellThermoData<Output>>>(
+        m,
+        name.c_str())
+        .def(pybind11::init<mpcd::CellThermoCompute&>())
+        .def("getVelocities", &LocalCellThermoData<Output>::getVelocities)
+        .def("getMasses", &LocalCellThermoData<Output>::getMasses)
+        .def("getKineticEnergies", &LocalCellThermoData<Output>::getKineticEnergies)
+        .def("getTemperatures", &LocalCellThermoData<Output>::getTemperatures)
+        .def("getNumParticles", &LocalCellThermoData<Output>::getNumParticles)
+        .def("getCellDims", &LocalCellThermoData<Output>::getCellDims)
+        .def("enter", &LocalCellThermoData<Output>::enter)
+        .def("exit", &LocalCellThermoData<Output>::exit);
+    }
     } // end namespace detail
 
     } // end namespace mpcd
@@ -17,7 +17,9 @@ namespace hoomd
  */
 mpcd::CellThermoComputeGPU::CellThermoComputeGPU(std::shared_ptr<SystemDefinition> sysdef,
                                                  std::shared_ptr<mpcd::CellList> cl)
-    : mpcd::CellThermoCompute(sysdef, cl), m_tmp_thermo(m_exec_conf), m_reduced(m_exec_conf)
+    : mpcd::CellThermoCompute(sysdef, cl), m_tmp_thermo(m_exec_conf), m_reduced(m_exec_conf),
+      m_fused_conditions(m_exec_conf), m_fused(false), m_fused_timestep(0), m_fused_energy(false),
+      m_fused_grid_shift(make_scalar3(0, 0, 0))
     {
     m_begin_tuner.reset(new Autotuner<2>({AutotunerBase::makeBlockSizeRange(m_exec_conf),
                                           AutotunerBase::getTppListPow2(this->m_exec_conf)},
@@ -34,13 +36,246 @@ mpcd::CellThermoComputeGPU::CellThermoComputeGPU(std::shared_ptr<SystemDefinitio
                                          m_exec_conf,
                                          "mpcd_cell_thermo_stage"));
 
+    m_accumulate_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                              m_exec_conf,
+                                              "mpcd_cell_thermo_accumulate"));
+    m_finish_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                          m_exec_conf,
+                                          "mpcd_cell_thermo_finish"));
+
     m_autotuners.insert(m_autotuners.end(),
-                        {m_begin_tuner, m_end_tuner, m_inner_tuner, m_stage_tuner});
+                        {m_begin_tuner,
+                         m_end_tuner,
+                         m_inner_tuner,
+                         m_stage_tuner,
+                         m_accumulate_tuner,
+                         m_finish_tuner});
+
+#ifdef ENABLE_MPI
+    m_use_outer_stream = false;
+    if (m_use_mpi)
+        {
+        int least_priority, greatest_priority;
+        cudaDeviceGetStreamPriorityRange(&least_priority, &greatest_priority);
+        cudaStreamCreateWithPriority(&m_outer_stream, cudaStreamNonBlocking, greatest_priority);
+        cudaEventCreateWithFlags(&m_outer_ready, cudaEventDisableTiming);
+        cudaEventCreateWithFlags(&m_outer_done, cudaEventDisableTiming);
+        }
+#endif // ENABLE_MPI
+    }
+
+mpcd::CellThermoComputeGPU::~CellThermoComputeGPU()
+    {
+#ifdef ENABLE_MPI
+    if (m_use_mpi)
+        {
+        cudaEventDestroy(m_outer_done);
+        cudaEventDestroy(m_outer_ready);
+        cudaStreamDestroy(m_outer_stream);
+        }
+#endif // ENABLE_MPI
+    }
+
+/*!
+ * The cell properties are zeroed so that the streaming method can accumulate the particles into
+ * them using getAccumulateArgs(). The cell list must already have the grid shift of the collision
+ * that the properties are for. The accumulated properties are only used if endFusedCompute() is
+ * called after the particles are streamed.
+ */
+void mpcd::CellThermoComputeGPU::beginFusedCompute()
+    {
+    m_fused = false;
+
+    // ensure optional flags and cell dimensions are up to date
+    updateFlags();
+    m_cl->computeDimensions();
+    const unsigned int ncells = m_cl->getNCells();
+    if (ncells != m_ncells_alloc)
+        {
+        reallocate(ncells);
+        }
+
+    ArrayHandle<double4> d_cell_vel(m_cell_vel, access_location::device, access_mode::overwrite);
+    ArrayHandle<double3> d_cell_energy(m_cell_energy,
+                                       access_location::device,
+                                       access_mode::overwrite);
+    hipMemset(d_cell_vel.data, 0, sizeof(double4) * ncells);
+    hipMemset(d_cell_energy.data, 0, sizeof(double3) * ncells);
+
+    m_fused_conditions.resetFlags(0);
+    m_fused_energy = m_flags[mpcd::detail::thermo_options::energy];
+    m_fused_grid_shift = m_cl->getGridShift();
     }
 
-mpcd::CellThermoComputeGPU::~CellThermoComputeGPU() { }
+/*!
+ * \param d_cell_vel Cell velocities acquired on the device with read-write access
+ * \param d_cell_energy Cell energies acquired on the device with read-write access
+ * \returns Parameters to bin and accumulate particles with the current cell list
+ */
+mpcd::detail::cell_accumulate_args_t
+mpcd::CellThermoComputeGPU::getAccumulateArgs(double4* d_cell_vel, double3* d_cell_energy)
+    {
+    return mpcd::detail::cell_accumulate_args_t(d_cell_vel,
+                                                d_cell_energy,
+                                                m_fused_conditions.getDeviceFlags(),
+                                                m_cl->getCellIndexer(),
+                                                m_cl->getOriginIndex(),
+                                                m_cl->getGlobalDim(),
+                                                m_pdata->getBox().getPeriodic(),
+                                                m_fused_grid_shift,
+                                                m_pdata->getGlobalBox().getLo(),
+                                                m_cl->getCellSize(),
+                                                m_mpcd_pdata->getMass(),
+                                                m_fused_energy);
+    }
+
+/*!
+ * \param timestep Timestep the accumulated cell properties are for
+ */
+void mpcd::CellThermoComputeGPU::endFusedCompute(uint64_t timestep)
+    {
+    m_fused = true;
+    m_fused_timestep = timestep;
+    }
+
+/*!
+ * \param timestep Current timestep
+ * \returns True if the accumulated cell properties could be used
+ *
+ * The accumulated cell properties are used only if they were accumulated for \a timestep with the
+ * current cell dimensions, grid shift, and requested flags, and only if all particles could be
+ * binned. Otherwise, the caller falls back to building the cell list and computing the cell
+ * properties from it, which also reports any errors binning the particles. Virtual particles are
+ * added after streaming, so they are binned and accumulated here before the cell properties are
+ * finished.
+ */
+bool mpcd::CellThermoComputeGPU::finishFusedCompute(uint64_t timestep)
+    {
+    if (!m_fused || m_fused_timestep != timestep)
+        {
+        m_fused = false;
+        return false;
+        }
+    m_fused = false;
+
+    updateFlags();
+    const Scalar3 grid_shift = m_cl->getGridShift();
+    if (m_cl->needsComputeDimensions() || m_cl->getNCells() != m_ncells_alloc
+        || m_cl->getEmbeddedGroup() || grid_shift.x != m_fused_grid_shift.x
+        || grid_shift.y != m_fused_grid_shift.y || grid_shift.z != m_fused_grid_shift.z
+        || (m_flags[mpcd::detail::thermo_options::energy] && !m_fused_energy))
+        {
+        return false;
+        }
+
+        {
+        ArrayHandle<double4> d_cell_vel(m_cell_vel,
+                                        access_location::device,
+                                        access_mode::readwrite);
+        ArrayHandle<double3> d_cell_energy(m_cell_energy,
+                                           access_location::device,
+                                           access_mode::readwrite);
+
+        // add the virtual particles
+        const unsigned int N_virtual = m_mpcd_pdata->getNVirtual();
+        if (N_virtual > 0)
+            {
+            ArrayHandle<SolventScalar4> d_pos(m_mpcd_pdata->getPositions(),
+                                              access_location::device,
+                                              access_mode::read);
+            ArrayHandle<SolventScalar4> d_vel(m_mpcd_pdata->getVelocities(),
+                                              access_location::device,
+                                              access_mode::readwrite);
+
+            m_accumulate_tuner->begin();
+            mpcd::gpu::accumulate_cell_thermo(d_vel.data,
+                                              d_pos.data,
+                                              m_mpcd_pdata->getN(),
+                                              N_virtual,
+                                              getAccumulateArgs(d_cell_vel.data,
+                                                                d_cell_energy.data),
+                                              m_accumulate_tuner->getParam()[0]);
+            if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            m_accumulate_tuner->end();
+            }
+
+        if (m_fused_conditions.readFlags())
+            {
+            return false;
+            }
+
+        m_finish_tuner->begin();
+        mpcd::gpu::finish_cell_thermo(d_cell_vel.data,
+                                      d_cell_energy.data,
+                                      m_ncells_alloc,
+                                      m_mpcd_pdata->getMass(),
+                                      m_sysdef->getNDimensions(),
+                                      m_fused_energy,
+                                      m_finish_tuner->getParam()[0]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_finish_tuner->end();
+        }
+
+    if (!m_callbacks.empty())
+        m_callbacks.emit(timestep);
+
+    // all particles now have their cell stashed in their velocity
+    m_mpcd_pdata->validateCellCache();
+    return true;
+    }
 
 #ifdef ENABLE_MPI
+/*!
+ * \param timestep Current timestep
+ *
+ * The outer cells are computed, packed, and copied to the host on a separate high-priority stream,
+ * and the inner cells are launched on the default stream before the outer cells are packed. Only
+ * the high-priority stream is synchronized before the MPI calls are made, so the inner cells are
+ * computed on the GPU while the outer cells are communicated. The default stream waits for the
+ * outer cells before any of the remaining work is done.
+ *
+ * The outer cells are computed on the default stream while their kernel is being tuned because
+ * the autotuner measures the time on the default stream.
+ */
+void mpcd::CellThermoComputeGPU::computeCellProperties(uint64_t timestep)
+    {
+    if (!m_use_mpi)
+        {
+        mpcd::CellThermoCompute::computeCellProperties(timestep);
+        return;
+        }
+
+    m_use_outer_stream = m_begin_tuner->isComplete();
+    const cudaStream_t outer_stream = (m_use_outer_stream) ? m_outer_stream : 0;
+
+    beginOuterCellProperties();
+    calcInnerCellProperties();
+
+    m_vel_comm->setStream(outer_stream);
+    m_vel_comm->begin(m_cell_vel, mpcd::detail::CellVelocityPackOp());
+    if (m_flags[mpcd::detail::thermo_options::energy])
+        {
+        m_energy_comm->setStream(outer_stream);
+        m_energy_comm->begin(m_cell_energy, mpcd::detail::CellEnergyPackOp());
+        }
+    if (m_use_outer_stream)
+        {
+        cudaEventRecord(m_outer_done, m_outer_stream);
+        cudaStreamWaitEvent(0, m_outer_done, 0);
+        }
+
+    if (!m_callbacks.empty())
+        m_callbacks.emit(timestep);
+
+    if (m_flags[mpcd::detail::thermo_options::energy])
+        m_energy_comm->finalize(m_cell_energy, mpcd::detail::CellEnergyPackOp());
+    m_vel_comm->finalize(m_cell_vel, mpcd::detail::CellVelocityPackOp());
+
+    finishOuterCellProperties();
+    }
+
 void mpcd::CellThermoComputeGPU::beginOuterCellProperties()
     {
     ArrayHandle<double4> d_cell_vel(m_cell_vel, access_location::device, access_mode::overwrite);
@@ -58,9 +293,11 @@ void mpcd::CellThermoComputeGPU::beginOuterCellProperties()
                                           access_location::device,
                                           access_mode::read);
 
-    ArrayHandle<Scalar4> d_vel(m_mpcd_pdata->getVelocities(),
-                               access_location::device,
-                               access_mode::read);
+    ArrayHandle<SolventScalar4> d_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::device,
+                                      access_mode::read);
+
+    const cudaStream_t outer_stream = (m_use_outer_stream) ? m_outer_stream : 0;
 
     if (m_cl->getEmbeddedGroup())
         {
@@ -84,11 +321,23 @@ void mpcd::CellThermoComputeGPU::beginOuterCellProperties()
                                          d_embed_cell.data,
                                          m_flags[mpcd::detail::thermo_options::energy]);
 
+        // the outer stream waits for the inputs from the default stream, including any copies
+        if (m_use_outer_stream)
+            {
+            cudaEventRecord(m_outer_ready, 0);
+            cudaStreamWaitEvent(m_outer_stream, m_outer_ready, 0);
+            }
+
         m_begin_tuner->begin();
         auto param = m_begin_tuner->getParam();
         const unsigned int block_size = param[0];
         const unsigned int tpp = param[1];
-        gpu::begin_cell_thermo(args, d_cells.data, m_vel_comm->getNCells(), block_size, tpp);
+        gpu::begin_cell_thermo(args,
+                               d_cells.data,
+                               m_vel_comm->getNCells(),
+                               block_size,
+                               tpp,
+                               outer_stream);
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
         m_begin_tuner->end();
@@ -107,11 +356,23 @@ void mpcd::CellThermoComputeGPU::beginOuterCellProperties()
                                          NULL,
                                          m_flags[mpcd::detail::thermo_options::energy]);
 
+        // the outer stream waits for the inputs from the default stream, including any copies
+        if (m_use_outer_stream)
+            {
+            cudaEventRecord(m_outer_ready, 0);
+            cudaStreamWaitEvent(m_outer_stream, m_outer_ready, 0);
+            }
+
         m_begin_tuner->begin();
         auto param = m_begin_tuner->getParam();
         const unsigned int block_size = param[0];
         const unsigned int tpp = param[1];
-        gpu::begin_cell_thermo(args, d_cells.data, m_vel_comm->getNCells(), block_size, tpp);
+        gpu::begin_cell_thermo(args,
+                               d_cells.data,
+                               m_vel_comm->getNCells(),
+                               block_size,
+                               tpp,
+                               outer_stream);
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
         m_begin_tuner->end();
@@ -155,9 +416,9 @@ void mpcd::CellThermoComputeGPU::calcInnerCellProperties()
                                           access_location::device,
                                           access_mode::read);
 
-    ArrayHandle<Scalar4> d_vel(m_mpcd_pdata->getVelocities(),
-                               access_location::device,
-                               access_mode::read);
+    ArrayHandle<SolventScalar4> d_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::device,
+                                      access_mode::read);
 
     /*
      * Determine the inner cell indexer and offset. The inner indexer is the cube containing
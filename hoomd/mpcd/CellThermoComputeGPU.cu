@@ -47,7 +47,8 @@ namespace kernel
  * Using \a tpp threads per cell, the cell properties are accumulated into \a d_cell_vel
  * and \a d_cell_energy. Shuffle-based intrinsics are used to reduce the accumulated
  * properties per-cell, and the first thread for each cell writes the result into
- * global memory.
+ * global memory. With HOOMD_FIXED_POINT_ACCUMULATION, the sums are in fixed point, so they do
+ * not depend on \a tpp or on the order of the particles in the cell list.
  */
 template<bool need_energy, unsigned int tpp>
 __global__ void begin_cell_thermo(double4* d_cell_vel,
@@ -56,7 +57,7 @@ __global__ void begin_cell_thermo(double4* d_cell_vel,
                                   const unsigned int* d_cell_np,
                                   const unsigned int* d_cell_list,
                                   const Index2D cli,
-                                  const Scalar4* d_vel,
+                                  const SolventScalar4* d_vel,
                                   const unsigned int N_mpcd,
                                   const Scalar mpcd_mass,
                                   const Scalar4* d_embed_vel,
@@ -70,8 +71,7 @@ __global__ void begin_cell_thermo(double4* d_cell_vel,
 
     const unsigned int cell_id = d_cells[idx / tpp];
     const unsigned int np = d_cell_np[cell_id];
-    double4 momentum = make_double4(0.0, 0.0, 0.0, 0.0);
-    double ke(0.0);
+    cell_sum_t momentum_x(0), momentum_y(0), momentum_z(0), mass_sum(0), ke_sum(0);
 
     for (unsigned int offset = (idx % tpp); offset < np; offset += tpp)
         {
@@ -81,7 +81,7 @@ __global__ void begin_cell_thermo(double4* d_cell_vel,
         double mass_i;
         if (cur_p < N_mpcd)
             {
-            Scalar4 vel_cell = d_vel[cur_p];
+            SolventScalar4 vel_cell = d_vel[cur_p];
             vel_i = make_double3(vel_cell.x, vel_cell.y, vel_cell.z);
             mass_i = mpcd_mass;
             }
@@ -93,28 +93,33 @@ __global__ void begin_cell_thermo(double4* d_cell_vel,
             }
 
         // add momentum
-        momentum.x += mass_i * vel_i.x;
-        momentum.y += mass_i * vel_i.y;
-        momentum.z += mass_i * vel_i.z;
-        momentum.w += mass_i;
+        momentum_x += toCellSum(mass_i * vel_i.x);
+        momentum_y += toCellSum(mass_i * vel_i.y);
+        momentum_z += toCellSum(mass_i * vel_i.z);
+        mass_sum += toCellSum(mass_i);
 
         // also compute ke of the particle
         if (need_energy)
-            ke += (double)(0.5) * mass_i
-                  * (vel_i.x * vel_i.x + vel_i.y * vel_i.y + vel_i.z * vel_i.z);
+            ke_sum += toCellSum((double)(0.5) * mass_i
+                                * (vel_i.x * vel_i.x + vel_i.y * vel_i.y + vel_i.z * vel_i.z));
         }
 
     // reduce quantities down into the 0-th lane per logical warp
     if (tpp > 1)
         {
-        hoomd::detail::WarpReduce<Scalar, tpp> reducer;
-        momentum.x = reducer.Sum(momentum.x);
-        momentum.y = reducer.Sum(momentum.y);
-        momentum.z = reducer.Sum(momentum.z);
-        momentum.w = reducer.Sum(momentum.w);
+        hoomd::detail::WarpReduce<cell_sum_t, tpp> reducer;
+        momentum_x = reducer.Sum(momentum_x);
+        momentum_y = reducer.Sum(momentum_y);
+        momentum_z = reducer.Sum(momentum_z);
+        mass_sum = reducer.Sum(mass_sum);
         if (need_energy)
-            ke = reducer.Sum(ke);
+            ke_sum = reducer.Sum(ke_sum);
         }
+    const double4 momentum = make_double4(fromCellSum(momentum_x),
+                                          fromCellSum(momentum_y),
+                                          fromCellSum(momentum_z),
+                                          fromCellSum(mass_sum));
+    const double ke = fromCellSum(ke_sum);
 
     // 0-th lane in each warp writes the result
     if (idx % tpp == 0)
@@ -208,7 +213,8 @@ __global__ void end_cell_thermo(double4* d_cell_vel,
  * Using \a tpp threads per cell, the cell properties are accumulated into \a d_cell_vel
  * and \a d_cell_energy. Shuffle-based intrinsics are used to reduce the accumulated
  * properties per-cell, and the first thread for each cell writes the result into
- * global memory. The properties are properly normalized
+ * global memory. With HOOMD_FIXED_POINT_ACCUMULATION, the sums are in fixed point, so they do
+ * not depend on \a tpp or on the order of the particles in the cell list. The properties are properly normalized
  *
  * See mpcd::gpu::kernel::begin_cell_thermo for an almost identical implementation
  * without the normalization at the end, which is used for the outer cells.
@@ -222,7 +228,7 @@ __global__ void inner_cell_thermo(double4* d_cell_vel,
                                   const unsigned int* d_cell_np,
                                   const unsigned int* d_cell_list,
                                   const Index2D cli,
-                                  const Scalar4* d_vel,
+                                  const SolventScalar4* d_vel,
                                   const unsigned int N_mpcd,
                                   const Scalar mpcd_mass,
                                   const Scalar4* d_embed_vel,
@@ -243,8 +249,7 @@ __global__ void inner_cell_thermo(double4* d_cell_vel,
     const unsigned int cell_id = ci(cell.x, cell.y, cell.z);
 
     const unsigned int np = d_cell_np[cell_id];
-    double4 momentum = make_double4(0.0, 0.0, 0.0, 0.0);
-    double ke(0.0);
+    cell_sum_t momentum_x(0), momentum_y(0), momentum_z(0), mass_sum(0), ke_sum(0);
 
     for (unsigned int offset = (idx % tpp); offset < np; offset += tpp)
         {
@@ -254,7 +259,7 @@ __global__ void inner_cell_thermo(double4* d_cell_vel,
         double mass_i;
         if (cur_p < N_mpcd)
             {
-            Scalar4 vel_cell = d_vel[cur_p];
+            SolventScalar4 vel_cell = d_vel[cur_p];
             vel_i = make_double3(vel_cell.x, vel_cell.y, vel_cell.z);
             mass_i = mpcd_mass;
             }
@@ -266,27 +271,33 @@ __global__ void inner_cell_thermo(double4* d_cell_vel,
             }
 
         // add momentum
-        momentum.x += mass_i * vel_i.x;
-        momentum.y += mass_i * vel_i.y;
-        momentum.z += mass_i * vel_i.z;
-        momentum.w += mass_i;
+        momentum_x += toCellSum(mass_i * vel_i.x);
+        momentum_y += toCellSum(mass_i * vel_i.y);
+        momentum_z += toCellSum(mass_i * vel_i.z);
+        mass_sum += toCellSum(mass_i);
 
         // also compute ke of the particle
         if (need_energy)
-            ke += 0.5 * mass_i * (vel_i.x * vel_i.x + vel_i.y * vel_i.y + vel_i.z * vel_i.z);
+            ke_sum += toCellSum(0.5 * mass_i
+                                * (vel_i.x * vel_i.x + vel_i.y * vel_i.y + vel_i.z * vel_i.z));
         }
 
     // reduce quantities down into the 0-th lane per logical warp
     if (tpp > 1)
         {
-        hoomd::detail::WarpReduce<Scalar, tpp> reducer;
-        momentum.x = reducer.Sum(momentum.x);
-        momentum.y = reducer.Sum(momentum.y);
-        momentum.z = reducer.Sum(momentum.z);
-        momentum.w = reducer.Sum(momentum.w);
+        hoomd::detail::WarpReduce<cell_sum_t, tpp> reducer;
+        momentum_x = reducer.Sum(momentum_x);
+        momentum_y = reducer.Sum(momentum_y);
+        momentum_z = reducer.Sum(momentum_z);
+        mass_sum = reducer.Sum(mass_sum);
         if (need_energy)
-            ke = reducer.Sum(ke);
+            ke_sum = reducer.Sum(ke_sum);
         }
+    const double4 momentum = make_double4(fromCellSum(momentum_x),
+                                          fromCellSum(momentum_y),
+                                          fromCellSum(momentum_z),
+                                          fromCellSum(mass_sum));
+    const double ke = fromCellSum(ke_sum);
 
     // 0-th lane in each warp writes the result
     if (idx % tpp == 0)
@@ -381,6 +392,100 @@ __global__ void stage_net_cell_thermo(mpcd::detail::cell_thermo_element* d_tmp_t
     d_tmp_thermo[tmp_idx] = thermo;
     }
 
+//! Bins particles and accumulates their cell properties
+/*!
+ * \param d_vel MPCD particle velocities
+ * \param d_pos MPCD particle positions
+ * \param first Index of the first particle to accumulate
+ * \param N Number of particles to accumulate
+ * \param args Binning and accumulation parameters
+ *
+ * \tparam need_energy If true, accumulate the kinetic energy of the particles
+ *
+ * \b Implementation details:
+ * Using one thread per particle, the particle is binned and its properties are added to its cell
+ * by mpcd::gpu::kernel::accumulate_cell_particle. The cell of the particle is stashed into the
+ * velocity array, as it is when the cell list is built.
+ */
+template<bool need_energy>
+__global__ void accumulate_cell_thermo(SolventScalar4* d_vel,
+                                       const SolventScalar4* d_pos,
+                                       const unsigned int first,
+                                       const unsigned int N,
+                                       const mpcd::detail::cell_accumulate_args_t args)
+    {
+    // one thread per particle
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+    idx += first;
+
+    const SolventScalar4 postype = d_pos[idx];
+    const Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+    const SolventScalar4 vel_cell = d_vel[idx];
+    const Scalar3 vel = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
+
+    const unsigned int cell = accumulate_cell_particle<need_energy>(pos, vel, args);
+    d_vel[idx] = make_solvent_scalar4(vel.x, vel.y, vel.z, __int_as_solvent_scalar(cell));
+    }
+
+//! Finishes cell properties that were accumulated per particle
+/*!
+ * \param d_cell_vel Cell momentum and mass, which is converted to velocity and mass
+ * \param d_cell_energy Cell energy, which gets the temperature and number of particles
+ * \param Ncell Number of cells
+ * \param mass MPCD particle mass
+ * \param n_dimensions Number of dimensions in system
+ *
+ * \tparam need_energy If true, compute the cell-level energy properties.
+ *
+ * \b Implementation details:
+ * Using one thread per cell, the properties are averaged as in
+ * mpcd::gpu::kernel::end_cell_thermo. All particles have mass \a mass, so the number of
+ * particles in the cell is recovered from the cell mass rather than being accumulated.
+ */
+template<bool need_energy>
+__global__ void finish_cell_thermo(double4* d_cell_vel,
+                                   double3* d_cell_energy,
+                                   const unsigned int Ncell,
+                                   const double mass,
+                                   const unsigned int n_dimensions)
+    {
+    // one thread per cell
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= Ncell)
+        return;
+
+    const double4 cell_vel = d_cell_vel[idx];
+    double3 vel_cm = make_double3(readAtomicCellSum(cell_vel.x),
+                                  readAtomicCellSum(cell_vel.y),
+                                  readAtomicCellSum(cell_vel.z));
+    const double cell_mass = readAtomicCellSum(cell_vel.w);
+    if (cell_mass > 0.)
+        {
+        vel_cm.x /= cell_mass;
+        vel_cm.y /= cell_mass;
+        vel_cm.z /= cell_mass;
+        }
+    d_cell_vel[idx] = make_double4(vel_cm.x, vel_cm.y, vel_cm.z, cell_mass);
+
+    if (need_energy)
+        {
+        const double ke = readAtomicCellSum(d_cell_energy[idx].x);
+        const unsigned int np = __double2uint_rn(cell_mass / mass);
+        double temp(0.0);
+        // temperature is only defined for 2 or more particles
+        if (np > 1)
+            {
+            const double ke_cm
+                = 0.5 * cell_mass
+                  * (vel_cm.x * vel_cm.x + vel_cm.y * vel_cm.y + vel_cm.z * vel_cm.z);
+            temp = 2. * (ke - ke_cm) / (n_dimensions * (np - 1));
+            }
+        d_cell_energy[idx] = make_double3(ke, temp, __int_as_double(np));
+        }
+    }
+
     } // end namespace kernel
 
 //! Templated launcher for multiple threads-per-cell kernel for outer cells
@@ -390,6 +495,7 @@ __global__ void stage_net_cell_thermo(mpcd::detail::cell_thermo_element* d_tmp_t
  * \param num_cells Number of cells to compute for
  * \param block_size Number of threads per block
  * \param tpp Number of threads to use per-cell
+ * \param stream Stream to launch the kernel on
  *
  * \tparam cur_tpp Number of threads-per-cell for this template instantiation
  *
@@ -405,7 +511,8 @@ inline void launch_begin_cell_thermo(const mpcd::detail::thermo_args_t& args,
                                      const unsigned int* d_cells,
                                      const unsigned int num_cells,
                                      const unsigned int block_size,
-                                     const unsigned int tpp)
+                                     const unsigned int tpp,
+                                     cudaStream_t stream)
     {
     if (cur_tpp == tpp)
         {
@@ -420,18 +527,18 @@ inline void launch_begin_cell_thermo(const mpcd::detail::thermo_args_t& args,
             unsigned int run_block_size = min(block_size, max_block_size_energy);
             dim3 grid(cur_tpp * num_cells / run_block_size + 1);
             mpcd::gpu::kernel::begin_cell_thermo<true, cur_tpp>
-                <<<grid, run_block_size>>>(args.cell_vel,
-                                           args.cell_energy,
-                                           d_cells,
-                                           args.cell_np,
-                                           args.cell_list,
-                                           args.cli,
-                                           args.vel,
-                                           args.N_mpcd,
-                                           args.mass,
-                                           args.embed_vel,
-                                           args.embed_idx,
-                                           num_cells);
+                <<<grid, run_block_size, 0, stream>>>(args.cell_vel,
+                                                      args.cell_energy,
+                                                      d_cells,
+                                                      args.cell_np,
+                                                      args.cell_list,
+                                                      args.cli,
+                                                      args.vel,
+                                                      args.N_mpcd,
+                                                      args.mass,
+                                                      args.embed_vel,
+                                                      args.embed_idx,
+                                                      num_cells);
             }
         else
             {
@@ -445,23 +552,23 @@ inline void launch_begin_cell_thermo(const mpcd::detail::thermo_args_t& args,
             unsigned int run_block_size = min(block_size, max_block_size_noenergy);
             dim3 grid(cur_tpp * num_cells / run_block_size + 1);
             mpcd::gpu::kernel::begin_cell_thermo<false, cur_tpp>
-                <<<grid, run_block_size>>>(args.cell_vel,
-                                           args.cell_energy,
-                                           d_cells,
-                                           args.cell_np,
-                                           args.cell_list,
-                                           args.cli,
-                                           args.vel,
-                                           args.N_mpcd,
-                                           args.mass,
-                                           args.embed_vel,
-                                           args.embed_idx,
-                                           num_cells);
+                <<<grid, run_block_size, 0, stream>>>(args.cell_vel,
+                                                      args.cell_energy,
+                                                      d_cells,
+                                                      args.cell_np,
+                                                      args.cell_list,
+                                                      args.cli,
+                                                      args.vel,
+                                                      args.N_mpcd,
+                                                      args.mass,
+                                                      args.embed_vel,
+                                                      args.embed_idx,
+                                                      num_cells);
             }
         }
     else
         {
-        launch_begin_cell_thermo<cur_tpp / 2>(args, d_cells, num_cells, block_size, tpp);
+        launch_begin_cell_thermo<cur_tpp / 2>(args, d_cells, num_cells, block_size, tpp, stream);
         }
     }
 //! Template specialization to break recursion
@@ -470,7 +577,8 @@ inline void launch_begin_cell_thermo<0>(const mpcd::detail::thermo_args_t& args,
                                         const unsigned int* d_cells,
                                         const unsigned int num_cells,
                                         const unsigned int block_size,
-                                        const unsigned int tpp)
+                                        const unsigned int tpp,
+                                        cudaStream_t stream)
     {
     }
 
@@ -480,6 +588,7 @@ inline void launch_begin_cell_thermo<0>(const mpcd::detail::thermo_args_t& args,
  * \param num_cells Number of cells to compute for
  * \param block_size Number of threads per block
  * \param tpp Number of threads per cell
+ * \param stream Stream to launch the kernel on
  *
  * \returns cudaSuccess on completion
  *
@@ -490,12 +599,13 @@ cudaError_t begin_cell_thermo(const mpcd::detail::thermo_args_t& args,
                               const unsigned int* d_cells,
                               const unsigned int num_cells,
                               const unsigned int block_size,
-                              const unsigned int tpp)
+                              const unsigned int tpp,
+                              cudaStream_t stream)
     {
     if (num_cells == 0)
         return cudaSuccess;
 
-    launch_begin_cell_thermo<32>(args, d_cells, num_cells, block_size, tpp);
+    launch_begin_cell_thermo<32>(args, d_cells, num_cells, block_size, tpp, stream);
     return cudaSuccess;
     }
 
@@ -550,6 +660,109 @@ cudaError_t end_cell_thermo(double4* d_cell_vel,
     return cudaSuccess;
     }
 
+/*!
+ * \param d_vel MPCD particle velocities
+ * \param d_pos MPCD particle positions
+ * \param first Index of the first particle to accumulate
+ * \param N Number of particles to accumulate
+ * \param args Binning and accumulation parameters
+ * \param block_size Number of threads per block
+ *
+ * \returns cudaSuccess on completion
+ *
+ * \sa mpcd::gpu::kernel::accumulate_cell_thermo
+ */
+cudaError_t accumulate_cell_thermo(SolventScalar4* d_vel,
+                                   const SolventScalar4* d_pos,
+                                   const unsigned int first,
+                                   const unsigned int N,
+                                   const mpcd::detail::cell_accumulate_args_t& args,
+                                   const unsigned int block_size)
+    {
+    if (N == 0)
+        return cudaSuccess;
+
+    if (args.need_energy)
+        {
+        unsigned int max_block_size;
+        cudaFuncAttributes attr;
+        cudaFuncGetAttributes(&attr, (const void*)mpcd::gpu::kernel::accumulate_cell_thermo<true>);
+        max_block_size = attr.maxThreadsPerBlock;
+
+        unsigned int run_block_size = min(block_size, max_block_size);
+        dim3 grid(N / run_block_size + 1);
+        mpcd::gpu::kernel::accumulate_cell_thermo<true>
+            <<<grid, run_block_size>>>(d_vel, d_pos, first, N, args);
+        }
+    else
+        {
+        unsigned int max_block_size;
+        cudaFuncAttributes attr;
+        cudaFuncGetAttributes(&attr,
+                              (const void*)mpcd::gpu::kernel::accumulate_cell_thermo<false>);
+        max_block_size = attr.maxThreadsPerBlock;
+
+        unsigned int run_block_size = min(block_size, max_block_size);
+        dim3 grid(N / run_block_size + 1);
+        mpcd::gpu::kernel::accumulate_cell_thermo<false>
+            <<<grid, run_block_size>>>(d_vel, d_pos, first, N, args);
+        }
+
+    return cudaSuccess;
+    }
+
+/*!
+ * \param d_cell_vel Cell momentum and mass, which is converted to velocity and mass
+ * \param d_cell_energy Cell energy, which gets the temperature and number of particles
+ * \param Ncell Number of cells
+ * \param mass MPCD particle mass
+ * \param n_dimensions Number of dimensions in system
+ * \param need_energy If true, compute the cell-level energy properties
+ * \param block_size Number of threads per block
+ *
+ * \returns cudaSuccess on completion
+ *
+ * \sa mpcd::gpu::kernel::finish_cell_thermo
+ */
+cudaError_t finish_cell_thermo(double4* d_cell_vel,
+                               double3* d_cell_energy,
+                               const unsigned int Ncell,
+                               const Scalar mass,
+                               const unsigned int n_dimensions,
+                               const bool need_energy,
+                               const unsigned int block_size)
+    {
+    if (Ncell == 0)
+        return cudaSuccess;
+
+    if (need_energy)
+        {
+        unsigned int max_block_size;
+        cudaFuncAttributes attr;
+        cudaFuncGetAttributes(&attr, (const void*)mpcd::gpu::kernel::finish_cell_thermo<true>);
+        max_block_size = attr.maxThreadsPerBlock;
+
+        unsigned int run_block_size = min(block_size, max_block_size);
+        dim3 grid(Ncell / run_block_size + 1);
+        mpcd::gpu::kernel::finish_cell_thermo<true>
+            <<<grid, run_block_size>>>(d_cell_vel, d_cell_energy, Ncell, mass, n_dimensions);
+        }
+    else
+        {
+        unsigned int max_block_size;
+        cudaFuncAttributes attr;
+        cudaFuncGetAttributes(&attr, (const void*)mpcd::gpu::kernel::finish_cell_thermo<false>);
+        max_block_size = attr.maxThreadsPerBlock;
+
+        unsigned int run_block_size = min(block_size, max_block_size);
+        dim3 grid(Ncell / run_block_size + 1);
+        mpcd::gpu::kernel::finish_cell_thermo<false>
+            <<<grid, run_block_size>>>(d_cell_vel, d_cell_energy, Ncell, mass, n_dimensions);
+        }
+
+    return cudaSuccess;
+    }
+
 //! Templated launcher for multiple threads-per-cell kernel for inner cells
 /*
  * \param args Common arguments to thermo kernels
@@ -768,7 +981,8 @@ pack_cell_buffer(typename mpcd::detail::CellVelocityPackOp::element* d_send_buf,
                  const unsigned int* d_send_idx,
                  const mpcd::detail::CellVelocityPackOp op,
                  const unsigned int num_send,
-                 unsigned int block_size);
+                 unsigned int block_size,
+                 cudaStream_t stream);
 
 //! Explicit template instantiation of pack for cell energy
 template cudaError_t __attribute__((visibility("default")))
@@ -777,7 +991,8 @@ pack_cell_buffer(typename mpcd::detail::CellEnergyPackOp::element* d_send_buf,
                  const unsigned int* d_send_idx,
                  const mpcd::detail::CellEnergyPackOp op,
                  const unsigned int num_send,
-                 unsigned int block_size);
+                 unsigned int block_size,
+                 cudaStream_t stream);
 
 //! Explicit template instantiation of unpack for cell velocity
 template cudaError_t __attribute__((visibility("default")))
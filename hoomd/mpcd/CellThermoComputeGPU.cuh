@@ -9,7 +9,9 @@
 #ifndef MPCD_CELL_THERMO_COMPUTE_GPU_CUH_
 #define MPCD_CELL_THERMO_COMPUTE_GPU_CUH_
 
+#include "ParticleDataUtilities.h"
 #include "hoomd/BoxDim.h"
+#include "hoomd/FixedPoint.h"
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/Index1D.h"
 
@@ -58,7 +60,7 @@ struct thermo_args_t
                   const unsigned int* cell_np_,
                   const unsigned int* cell_list_,
                   const Index2D& cli_,
-                  const Scalar4* vel_,
+                  const SolventScalar4* vel_,
                   const unsigned int N_mpcd_,
                   const Scalar mass_,
                   const Scalar4* embed_vel_,
@@ -76,13 +78,58 @@ struct thermo_args_t
     const unsigned int* cell_np;   //!< Number of particles per cell
     const unsigned int* cell_list; //!< MPCD cell list
     const Index2D cli;             //!< MPCD cell list indexer
-    const Scalar4* vel;            //!< MPCD particle velocities
+    const SolventScalar4* vel;     //!< MPCD particle velocities
     const unsigned int N_mpcd;     //!< Number of MPCD particles
     const Scalar mass;             //!< MPCD particle mass
     const Scalar4* embed_vel;      //!< Embedded particle velocities
     const unsigned int* embed_idx; //!< Embedded particle indexes
     const bool need_energy;        //!< Flag if energy calculations are required
     };
+
+//! Convenience struct for parameters to bin particles and accumulate their cell properties
+struct cell_accumulate_args_t
+    {
+    //! Default constructor, which does not point to any cells
+    cell_accumulate_args_t()
+        : cell_vel(nullptr), cell_energy(nullptr), conditions(nullptr), ci(),
+          origin_idx(make_int3(0, 0, 0)), n_global_cell(make_uint3(0, 0, 0)),
+          periodic(make_uchar3(0, 0, 0)), grid_shift(make_scalar3(0, 0, 0)),
+          global_lo(make_scalar3(0, 0, 0)), cell_size(0), mass(0), need_energy(false)
+        {
+        }
+
+    cell_accumulate_args_t(double4* cell_vel_,
+                           double3* cell_energy_,
+                           unsigned int* conditions_,
+                           const Index3D& ci_,
+                           const int3& origin_idx_,
+                           const uint3& n_global_cell_,
+                           const uchar3& periodic_,
+                           const Scalar3& grid_shift_,
+                           const Scalar3& global_lo_,
+                           const Scalar cell_size_,
+                           const Scalar mass_,
+                           bool need_energy_)
+        : cell_vel(cell_vel_), cell_energy(cell_energy_), conditions(conditions_), ci(ci_),
+          origin_idx(origin_idx_), n_global_cell(n_global_cell_), periodic(periodic_),
+          grid_shift(grid_shift_), global_lo(global_lo_), cell_size(cell_size_), mass(mass_),
+          need_energy(need_energy_)
+        {
+        }
+
+    double4* cell_vel;         //!< Cell momentum and mass (accumulated)
+    double3* cell_energy;      //!< Cell kinetic energy (accumulated)
+    unsigned int* conditions;  //!< Flag set if a particle could not be binned
+    const Index3D ci;          //!< Cell indexer
+    const int3 origin_idx;     //!< Global origin index for the local cells
+    const uint3 n_global_cell; //!< Global dimensions of the cells
+    const uchar3 periodic;     //!< Flags if the local box is periodic
+    const Scalar3 grid_shift;  //!< Grid shift of the cells
+    const Scalar3 global_lo;   //!< Lower bound of the global box
+    const Scalar cell_size;    //!< Cell width
+    const Scalar mass;         //!< MPCD particle mass
+    const bool need_energy;    //!< Flag if energy calculations are required
+    };
 #undef HOSTDEVICE
     } // namespace detail
 
@@ -93,7 +140,8 @@ cudaError_t begin_cell_thermo(const mpcd::detail::thermo_args_t& args,
                               const unsigned int* d_cells,
                               const unsigned int num_cells,
                               const unsigned int block_size,
-                              const unsigned int tpp);
+                              const unsigned int tpp,
+                              cudaStream_t stream = 0);
 
 //! Kernel driver to finalize cell thermo compute of outer cells
 cudaError_t end_cell_thermo(double4* d_cell_vel,
@@ -122,6 +170,23 @@ cudaError_t stage_net_cell_thermo(mpcd::detail::cell_thermo_element* d_tmp_therm
                                   const bool need_energy,
                                   const unsigned int block_size);
 
+//! Kernel driver to bin particles and accumulate their cell properties
+cudaError_t accumulate_cell_thermo(SolventScalar4* d_vel,
+                                   const SolventScalar4* d_pos,
+                                   const unsigned int first,
+                                   const unsigned int N,
+                                   const mpcd::detail::cell_accumulate_args_t& args,
+                                   const unsigned int block_size);
+
+//! Kernel driver to finish cell properties that were accumulated per particle
+cudaError_t finish_cell_thermo(double4* d_cell_vel,
+                               double3* d_cell_energy,
+                               const unsigned int Ncell,
+                               const Scalar mass,
+                               const unsigned int n_dimensions,
+                               const bool need_energy,
+                               const unsigned int block_size);
+
 //! Wrapper to cub device reduce for cell thermo properties
 cudaError_t reduce_net_cell_thermo(mpcd::detail::cell_thermo_element* d_reduced,
                                    void* d_tmp,
@@ -129,6 +194,155 @@ cudaError_t reduce_net_cell_thermo(mpcd::detail::cell_thermo_element* d_reduced,
                                    const mpcd::detail::cell_thermo_element* d_tmp_thermo,
                                    const size_t Ncell);
 
+#ifdef __HIPCC__
+namespace kernel
+    {
+#ifdef HOOMD_FIXED_POINT_ACCUMULATION
+//! Type of the per-cell sums, which are independent of the summation order in fixed point
+typedef long long cell_sum_t;
+#else
+//! Type of the per-cell sums
+typedef double cell_sum_t;
+#endif
+
+//! Convert a particle contribution to a per-cell sum
+__device__ inline cell_sum_t toCellSum(double x)
+    {
+#ifdef HOOMD_FIXED_POINT_ACCUMULATION
+    return hoomd::detail::toFixedPoint(x);
+#else
+    return x;
+#endif
+    }
+
+//! Convert a per-cell sum back to a double
+__device__ inline double fromCellSum(cell_sum_t x)
+    {
+#ifdef HOOMD_FIXED_POINT_ACCUMULATION
+    return hoomd::detail::fromFixedPoint(x);
+#else
+    return x;
+#endif
+    }
+
+//! Atomically add a particle contribution to a per-cell sum stored as a double
+/*!
+ * \param address Sum in the cell properties
+ * \param x Value to add
+ *
+ * In fixed point, the sum is stored in the bits of the double until it is read with
+ * mpcd::gpu::kernel::readAtomicCellSum. A zeroed double is also a zero fixed-point sum.
+ */
+__device__ inline void atomicAddCellSum(double* address, double x)
+    {
+#ifdef HOOMD_FIXED_POINT_ACCUMULATION
+    hoomd::detail::atomicAddFixedPoint(reinterpret_cast<long long*>(address), x);
+#else
+    atomicAdd(address, x);
+#endif
+    }
+
+//! Read a per-cell sum that was accumulated with mpcd::gpu::kernel::atomicAddCellSum
+__device__ inline double readAtomicCellSum(double x)
+    {
+#ifdef HOOMD_FIXED_POINT_ACCUMULATION
+    return fromCellSum(__double_as_longlong(x));
+#else
+    return x;
+#endif
+    }
+
+//! Bin an MPCD particle and accumulate its properties into its cell
+/*!
+ * \param pos Particle position
+ * \param vel Particle velocity
+ * \param args Binning and accumulation parameters
+ *
+ * \returns The cell of the particle, or mpcd::detail::NO_CELL if it could not be binned
+ *
+ * \tparam need_energy If true, accumulate the kinetic energy of the particle
+ *
+ * The particle is binned in the same way as mpcd::gpu::kernel::compute_cell_list, but it is not
+ * written into a cell list. Instead, its momentum, mass, and (optionally) kinetic energy are
+ * added to its cell using atomic operations, in fixed point when the build uses
+ * HOOMD_FIXED_POINT_ACCUMULATION. If the particle cannot be binned, a flag is set in the
+ * conditions so that the caller can fall back to building the cell list, which reports the error.
+ */
+template<bool need_energy>
+__device__ inline unsigned int
+accumulate_cell_particle(const Scalar3& pos,
+                         const Scalar3& vel,
+                         const mpcd::detail::cell_accumulate_args_t& args)
+    {
+    if (isnan(pos.x) || isnan(pos.y) || isnan(pos.z))
+        {
+        atomicMax(args.conditions, 1);
+        return mpcd::detail::NO_CELL;
+        }
+
+    // bin particle with grid shift assuming orthorhombic box (already validated)
+    const Scalar3 delta = (pos - args.grid_shift) - args.global_lo;
+    int3 global_bin = make_int3(std::floor(delta.x / args.cell_size),
+                                std::floor(delta.y / args.cell_size),
+                                std::floor(delta.z / args.cell_size));
+
+    // wrap cell back through the boundaries (grid shifting may send +/- 1 outside of range)
+    if (args.periodic.x)
+        {
+        if (global_bin.x == (int)args.n_global_cell.x)
+            global_bin.x = 0;
+        else if (global_bin.x == -1)
+            global_bin.x = args.n_global_cell.x - 1;
+        }
+    if (args.periodic.y)
+        {
+        if (global_bin.y == (int)args.n_global_cell.y)
+            global_bin.y = 0;
+        else if (global_bin.y == -1)
+            global_bin.y = args.n_global_cell.y - 1;
+        }
+    if (args.periodic.z)
+        {
+        if (global_bin.z == (int)args.n_global_cell.z)
+            global_bin.z = 0;
+        else if (global_bin.z == -1)
+            global_bin.z = args.n_global_cell.z - 1;
+        }
+
+    // compute the local cell, and make sure no particles blew out of the box
+    const int3 bin = make_int3(global_bin.x - args.origin_idx.x,
+                               global_bin.y - args.origin_idx.y,
+                               global_bin.z - args.origin_idx.z);
+    if ((bin.x < 0 || bin.x >= (int)args.ci.getW()) || (bin.y < 0 || bin.y >= (int)args.ci.getH())
+        || (bin.z < 0 || bin.z >= (int)args.ci.getD()))
+        {
+        atomicMax(args.conditions, 1);
+        return mpcd::detail::NO_CELL;
+        }
+    const unsigned int cell = args.ci(bin.x, bin.y, bin.z);
+
+    // add momentum and mass
+    const double mass = args.mass;
+    double* cell_vel = reinterpret_cast<double*>(args.cell_vel + cell);
+    atomicAddCellSum(cell_vel, mass * vel.x);
+    atomicAddCellSum(cell_vel + 1, mass * vel.y);
+    atomicAddCellSum(cell_vel + 2, mass * vel.z);
+    atomicAddCellSum(cell_vel + 3, mass);
+
+    // also add ke of the particle
+    if (need_energy)
+        {
+        atomicAddCellSum(&args.cell_energy[cell].x,
+                         0.5 * mass
+                             * ((double)vel.x * vel.x + (double)vel.y * vel.y
+                                + (double)vel.z * vel.z));
+        }
+
+    return cell;
+    }
+    } // end namespace kernel
+#endif // __HIPCC__
+
     } // end namespace gpu
     } // end namespace mpcd
     } // end namespace hoomd
@@ -36,8 +36,21 @@ class PYBIND11_EXPORT CellThermoComputeGPU : public mpcd::CellThermoCompute
     //! Destructor
     virtual ~CellThermoComputeGPU();
 
+    //! Begin accumulating the cell properties while the particles are streamed
+    void beginFusedCompute();
+
+    //! Get the parameters to accumulate particles into the cells
+    mpcd::detail::cell_accumulate_args_t getAccumulateArgs(double4* d_cell_vel,
+                                                           double3* d_cell_energy);
+
+    //! Finish accumulating the cell properties while the particles are streamed
+    void endFusedCompute(uint64_t timestep);
+
     protected:
 #ifdef ENABLE_MPI
+    //! Compute the cell properties, overlapping the outer cell communication on the GPU
+    virtual void computeCellProperties(uint64_t timestep);
+
     //! Begin the calculation of outer cell properties on the GPU
     virtual void beginOuterCellProperties();
 
@@ -51,15 +64,33 @@ class PYBIND11_EXPORT CellThermoComputeGPU : public mpcd::CellThermoCompute
     //! Compute the net properties from the cell properties
     virtual void computeNetProperties();
 
+    //! Finish computing cell properties that were accumulated while streaming
+    virtual bool finishFusedCompute(uint64_t timestep);
+
     private:
-    std::shared_ptr<Autotuner<2>> m_begin_tuner; //!< Tuner for cell begin kernel
-    std::shared_ptr<Autotuner<1>> m_end_tuner;   //!< Tuner for cell end kernel
-    std::shared_ptr<Autotuner<2>> m_inner_tuner; //!< Tuner for inner cell compute kernel
-    std::shared_ptr<Autotuner<1>> m_stage_tuner; //!< Tuner for staging net property compute
+    std::shared_ptr<Autotuner<2>> m_begin_tuner;      //!< Tuner for cell begin kernel
+    std::shared_ptr<Autotuner<1>> m_end_tuner;        //!< Tuner for cell end kernel
+    std::shared_ptr<Autotuner<2>> m_inner_tuner;      //!< Tuner for inner cell compute kernel
+    std::shared_ptr<Autotuner<1>> m_stage_tuner;      //!< Tuner for staging net property compute
+    std::shared_ptr<Autotuner<1>> m_accumulate_tuner; //!< Tuner for accumulating particles
+    std::shared_ptr<Autotuner<1>> m_finish_tuner;     //!< Tuner for finishing accumulated cells
 
     GPUVector<mpcd::detail::cell_thermo_element>
         m_tmp_thermo; //!< Temporary array for holding cell data
     GPUFlags<mpcd::detail::cell_thermo_element> m_reduced; //!< Flags to hold reduced sum
+
+    GPUFlags<unsigned int> m_fused_conditions; //!< Flag if particles could not be accumulated
+    bool m_fused;                              //!< True if the cell properties were accumulated
+    uint64_t m_fused_timestep;                 //!< Timestep the cell properties are for
+    bool m_fused_energy;                       //!< True if the energy was accumulated
+    Scalar3 m_fused_grid_shift;                //!< Grid shift the particles were binned with
+
+#ifdef ENABLE_MPI
+    cudaStream_t m_outer_stream; //!< High-priority stream for the outer cells
+    cudaEvent_t m_outer_ready;   //!< Event for the outer cell inputs being ready
+    cudaEvent_t m_outer_done;    //!< Event for the outer cells being packed
+    bool m_use_outer_stream;     //!< True if the outer cells are on the outer stream this step
+#endif // ENABLE_MPI
     };
 
 namespace detail
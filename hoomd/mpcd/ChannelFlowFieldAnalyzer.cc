@@ -0,0 +1,119 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/ChannelFlowFieldAnalyzer.cc
+ * \brief Definition of mpcd::ChannelFlowFieldAnalyzer
+ */
+
+#include "ChannelFlowFieldAnalyzer.h"
+
+namespace hoomd
+    {
+/*!
+ * \param sysdef System definition
+ * \param trigger Trigger for sampling the flow field
+ * \param geom Channel geometry
+ * \param ns Number of bins along the arc length of the centerline
+ * \param ny Number of bins along y
+ * \param nn Number of bins along the normal distance to the centerline
+ * \param n_max Largest normal distance to bin
+ * \param num_samples Number of samples in each averaging window
+ */
+mpcd::ChannelFlowFieldAnalyzer::ChannelFlowFieldAnalyzer(
+    std::shared_ptr<SystemDefinition> sysdef,
+    std::shared_ptr<Trigger> trigger,
+    std::shared_ptr<const mpcd::detail::CosineChannel> geom,
+    unsigned int ns,
+    unsigned int ny,
+    unsigned int nn,
+    Scalar n_max,
+    unsigned int num_samples)
+    : mpcd::FlowFieldAnalyzer(sysdef, trigger, ns, ny, nn, num_samples), m_geom(geom),
+      m_n_max(n_max)
+    {
+    if (!(n_max > Scalar(0)))
+        {
+        m_exec_conf->msg->error() << "mpcd: channel flow field must bin a positive normal distance"
+                                  << std::endl;
+        throw std::runtime_error("Invalid channel flow field normal distance");
+        }
+    }
+
+mpcd::detail::ChannelFlowFieldBins mpcd::ChannelFlowFieldAnalyzer::makeBins() const
+    {
+    return mpcd::detail::ChannelFlowFieldBins(m_pdata->getGlobalBox(),
+                                              m_num_bins,
+                                              m_geom->getAmplitude(),
+                                              m_geom->getWavenumber(),
+                                              m_geom->getPhase(),
+                                              m_n_max);
+    }
+
+void mpcd::ChannelFlowFieldAnalyzer::accumulate()
+    {
+    const mpcd::detail::ChannelFlowFieldBins bins = makeBins();
+
+    ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<double4> h_bin_vel(m_bin_vel, access_location::host, access_mode::readwrite);
+    ArrayHandle<double> h_bin_vsq(m_bin_vsq, access_location::host, access_mode::readwrite);
+
+    for (unsigned int idx = 0; idx < m_mpcd_pdata->getN(); ++idx)
+        {
+        const SolventScalar4 postype = h_pos.data[idx];
+        const SolventScalar4 vel_cell = h_vel.data[idx];
+        Scalar3 v = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
+        const unsigned int bin = bins.getBin(make_scalar3(postype.x, postype.y, postype.z), v);
+
+        const double3 vel = make_double3(v.x, v.y, v.z);
+        double4& bin_vel = h_bin_vel.data[bin];
+        bin_vel.x += vel.x;
+        bin_vel.y += vel.y;
+        bin_vel.z += vel.z;
+        bin_vel.w += 1.0;
+        h_bin_vsq.data[bin] += vel.x * vel.x + vel.y * vel.y + vel.z * vel.z;
+        }
+    }
+
+/*!
+ * \returns Volume of each bin
+ */
+std::vector<Scalar> mpcd::ChannelFlowFieldAnalyzer::getBinVolumes() const
+    {
+    const mpcd::detail::ChannelFlowFieldBins bins = makeBins();
+    std::vector<Scalar> bin_volume(bins.getBinIndexer().getNumElements());
+    for (unsigned int bin = 0; bin < bin_volume.size(); ++bin)
+        {
+        bin_volume[bin] = bins.getBinVolume(bin);
+        }
+    return bin_volume;
+    }
+
+/*!
+ * \param m Python module to export to
+ */
+void mpcd::detail::export_ChannelFlowFieldAnalyzer(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::ChannelFlowFieldAnalyzer,
+                     mpcd::FlowFieldAnalyzer,
+                     std::shared_ptr<mpcd::ChannelFlowFieldAnalyzer>>(m, "ChannelFlowFieldAnalyzer")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<const mpcd::detail::CosineChannel>,
+                            unsigned int,
+                            unsigned int,
+                            unsigned int,
+                            Scalar,
+                            unsigned int>())
+        .def_property("geometry",
+                      &mpcd::ChannelFlowFieldAnalyzer::getGeometry,
+                      &mpcd::ChannelFlowFieldAnalyzer::setGeometry)
+        .def_property_readonly("n_max", &mpcd::ChannelFlowFieldAnalyzer::getNormalDistance);
+    }
+
+    } // end namespace hoomd
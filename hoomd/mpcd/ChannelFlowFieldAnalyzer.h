@@ -0,0 +1,90 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/ChannelFlowFieldAnalyzer.h
+ * \brief Declaration of mpcd::ChannelFlowFieldAnalyzer
+ */
+
+#ifndef MPCD_CHANNEL_FLOW_FIELD_ANALYZER_H_
+#define MPCD_CHANNEL_FLOW_FIELD_ANALYZER_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "ChannelFlowFieldBins.h"
+#include "CosineChannelGeometry.h"
+#include "FlowFieldAnalyzer.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Accumulates time-averaged flow fields of the MPCD particles along a cosine channel
+/*!
+ * The MPCD particles are binned in the coordinates that follow the centerline of a
+ * mpcd::detail::CosineChannel (see mpcd::detail::ChannelFlowFieldBins): the arc length \a s, \a y,
+ * and the normal distance \a n to the centerline. The flow field is otherwise accumulated and
+ * averaged like in mpcd::FlowFieldAnalyzer, so the histograms are only reduced across the ranks at
+ * the end of each averaging window. The mean velocity has components along the tangent of the
+ * centerline, along \a y, and along its normal. The density is computed from the exact volume of
+ * each bin.
+ *
+ * The centerline is taken from the geometry each time the analyzer is triggered, so it follows
+ * walls that move.
+ */
+class PYBIND11_EXPORT ChannelFlowFieldAnalyzer : public mpcd::FlowFieldAnalyzer
+    {
+    public:
+    //! Constructor
+    ChannelFlowFieldAnalyzer(std::shared_ptr<SystemDefinition> sysdef,
+                             std::shared_ptr<Trigger> trigger,
+                             std::shared_ptr<const mpcd::detail::CosineChannel> geom,
+                             unsigned int ns,
+                             unsigned int ny,
+                             unsigned int nn,
+                             Scalar n_max,
+                             unsigned int num_samples);
+
+    //! Get the channel geometry
+    std::shared_ptr<const mpcd::detail::CosineChannel> getGeometry() const
+        {
+        return m_geom;
+        }
+
+    //! Set the channel geometry
+    void setGeometry(std::shared_ptr<const mpcd::detail::CosineChannel> geom)
+        {
+        m_geom = geom;
+        }
+
+    //! Get the largest normal distance to bin
+    Scalar getNormalDistance() const
+        {
+        return m_n_max;
+        }
+
+    protected:
+    std::shared_ptr<const mpcd::detail::CosineChannel> m_geom; //!< Channel geometry
+    const Scalar m_n_max; //!< Largest normal distance to bin
+
+    //! Make the bins for the current channel
+    mpcd::detail::ChannelFlowFieldBins makeBins() const;
+
+    //! Add the current particles to the sums in each bin
+    virtual void accumulate();
+
+    //! Get the volume of each bin
+    virtual std::vector<Scalar> getBinVolumes() const;
+    };
+
+namespace detail
+    {
+//! Export the mpcd::ChannelFlowFieldAnalyzer to python
+void export_ChannelFlowFieldAnalyzer(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+
+#endif // MPCD_CHANNEL_FLOW_FIELD_ANALYZER_H_
@@ -0,0 +1,96 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/ChannelFlowFieldAnalyzerGPU.cc
+ * \brief Definition of mpcd::ChannelFlowFieldAnalyzerGPU
+ */
+
+#include "ChannelFlowFieldAnalyzerGPU.h"
+#include "ChannelFlowFieldAnalyzerGPU.cuh"
+
+namespace hoomd
+    {
+/*!
+ * \param sysdef System definition
+ * \param trigger Trigger for sampling the flow field
+ * \param geom Channel geometry
+ * \param ns Number of bins along the arc length of the centerline
+ * \param ny Number of bins along y
+ * \param nn Number of bins along the normal distance to the centerline
+ * \param n_max Largest normal distance to bin
+ * \param num_samples Number of samples in each averaging window
+ */
+mpcd::ChannelFlowFieldAnalyzerGPU::ChannelFlowFieldAnalyzerGPU(
+    std::shared_ptr<SystemDefinition> sysdef,
+    std::shared_ptr<Trigger> trigger,
+    std::shared_ptr<const mpcd::detail::CosineChannel> geom,
+    unsigned int ns,
+    unsigned int ny,
+    unsigned int nn,
+    Scalar n_max,
+    unsigned int num_samples)
+    : mpcd::ChannelFlowFieldAnalyzer(sysdef, trigger, geom, ns, ny, nn, n_max, num_samples)
+    {
+    m_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                   m_exec_conf,
+                                   "mpcd_channel_flow_field"));
+    m_autotuners.push_back(m_tuner);
+    }
+
+void mpcd::ChannelFlowFieldAnalyzerGPU::accumulate()
+    {
+    const mpcd::detail::ChannelFlowFieldBins bins = makeBins();
+
+    ArrayHandle<SolventScalar4> d_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::device,
+                                      access_mode::read);
+    ArrayHandle<SolventScalar4> d_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::device,
+                                      access_mode::read);
+    ArrayHandle<double4> d_bin_vel(m_bin_vel, access_location::device, access_mode::readwrite);
+    ArrayHandle<double> d_bin_vsq(m_bin_vsq, access_location::device, access_mode::readwrite);
+
+    m_tuner->begin();
+    mpcd::gpu::channel_flow_field_accumulate(d_bin_vel.data,
+                                             d_bin_vsq.data,
+                                             d_pos.data,
+                                             d_vel.data,
+                                             bins,
+                                             m_mpcd_pdata->getN(),
+                                             m_exec_conf->dev_prop.sharedMemPerBlock,
+                                             m_tuner->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner->end();
+    }
+
+void mpcd::ChannelFlowFieldAnalyzerGPU::resetAccumulators()
+    {
+    ArrayHandle<double4> d_bin_vel(m_bin_vel, access_location::device, access_mode::overwrite);
+    ArrayHandle<double> d_bin_vsq(m_bin_vsq, access_location::device, access_mode::overwrite);
+    hipMemset(d_bin_vel.data, 0, sizeof(double4) * m_bin_vel.getNumElements());
+    hipMemset(d_bin_vsq.data, 0, sizeof(double) * m_bin_vsq.getNumElements());
+    }
+
+/*!
+ * \param m Python module to export to
+ */
+void mpcd::detail::export_ChannelFlowFieldAnalyzerGPU(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::ChannelFlowFieldAnalyzerGPU,
+                     mpcd::ChannelFlowFieldAnalyzer,
+                     std::shared_ptr<mpcd::ChannelFlowFieldAnalyzerGPU>>(
+        m,
+        "ChannelFlowFieldAnalyzerGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<const mpcd::detail::CosineChannel>,
+                            unsigned int,
+                            unsigned int,
+                            unsigned int,
+                            Scalar,
+                            unsigned int>());
+    }
+
+    } // end namespace hoomd
@@ -0,0 +1,160 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/ChannelFlowFieldAnalyzerGPU.cu
+ * \brief Defines GPU functions and kernels used by mpcd::ChannelFlowFieldAnalyzerGPU
+ */
+
+#include "ChannelFlowFieldAnalyzerGPU.cuh"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace gpu
+    {
+namespace kernel
+    {
+/*!
+ * \param d_bin_vel Summed velocity and number of particles in each bin
+ * \param d_bin_vsq Summed squared velocity in each bin
+ * \param d_pos Particle positions
+ * \param d_vel Particle velocities
+ * \param bins Channel flow field bins
+ * \param N Number of particles
+ * \param num_bins Number of bins
+ *
+ * \tparam use_shared If true, accumulate the sums of the block in shared memory
+ *
+ * \b Implementation:
+ *
+ * Using one thread per particle, the particle is binned in the channel coordinates and its
+ * rotated velocity is added to the sums of its bin with atomic operations. When \a use_shared is
+ * true, the block first accumulates into its own sums in shared memory, and the bins that
+ * received particles are then added to the global sums.
+ */
+template<bool use_shared>
+__global__ void channel_flow_field_accumulate(double4* d_bin_vel,
+                                              double* d_bin_vsq,
+                                              const SolventScalar4* d_pos,
+                                              const SolventScalar4* d_vel,
+                                              const mpcd::detail::ChannelFlowFieldBins bins,
+                                              const unsigned int N,
+                                              const unsigned int num_bins)
+    {
+    extern __shared__ char s_data[];
+    double* s_bin_vel = reinterpret_cast<double*>(s_data);
+    double* s_bin_vsq = s_bin_vel + 4 * num_bins;
+    if (use_shared)
+        {
+        for (unsigned int i = threadIdx.x; i < 5 * num_bins; i += blockDim.x)
+            {
+            s_bin_vel[i] = 0.0;
+            }
+        __syncthreads();
+        }
+
+    // one thread per particle, but all threads in the block must reach the flush
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx < N)
+        {
+        const SolventScalar4 postype = d_pos[idx];
+        const SolventScalar4 vel_cell = d_vel[idx];
+        Scalar3 v = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
+        const unsigned int bin = bins.getBin(make_scalar3(postype.x, postype.y, postype.z), v);
+
+        const double3 vel = make_double3(v.x, v.y, v.z);
+        double* bin_vel
+            = (use_shared) ? s_bin_vel + 4 * bin : reinterpret_cast<double*>(d_bin_vel + bin);
+        double* bin_vsq = (use_shared) ? s_bin_vsq + bin : d_bin_vsq + bin;
+        atomicAdd(bin_vel, vel.x);
+        atomicAdd(bin_vel + 1, vel.y);
+        atomicAdd(bin_vel + 2, vel.z);
+        atomicAdd(bin_vel + 3, 1.0);
+        atomicAdd(bin_vsq, vel.x * vel.x + vel.y * vel.y + vel.z * vel.z);
+        }
+
+    if (use_shared)
+        {
+        __syncthreads();
+        for (unsigned int bin = threadIdx.x; bin < num_bins; bin += blockDim.x)
+            {
+            if (s_bin_vel[4 * bin + 3] > 0.0)
+                {
+                double* bin_vel = reinterpret_cast<double*>(d_bin_vel + bin);
+                atomicAdd(bin_vel, s_bin_vel[4 * bin]);
+                atomicAdd(bin_vel + 1, s_bin_vel[4 * bin + 1]);
+                atomicAdd(bin_vel + 2, s_bin_vel[4 * bin + 2]);
+                atomicAdd(bin_vel + 3, s_bin_vel[4 * bin + 3]);
+                atomicAdd(d_bin_vsq + bin, s_bin_vsq[bin]);
+                }
+            }
+        }
+    }
+    } // end namespace kernel
+
+/*!
+ * \param d_bin_vel Summed velocity and number of particles in each bin
+ * \param d_bin_vsq Summed squared velocity in each bin
+ * \param d_pos Particle positions
+ * \param d_vel Particle velocities
+ * \param bins Channel flow field bins
+ * \param N Number of particles
+ * \param max_shared_bytes Shared memory available per block
+ * \param block_size Number of threads per block
+ *
+ * The sums are accumulated in shared memory if they fit.
+ *
+ * \sa kernel::channel_flow_field_accumulate
+ */
+cudaError_t channel_flow_field_accumulate(double4* d_bin_vel,
+                                          double* d_bin_vsq,
+                                          const SolventScalar4* d_pos,
+                                          const SolventScalar4* d_vel,
+                                          const mpcd::detail::ChannelFlowFieldBins& bins,
+                                          const unsigned int N,
+                                          const size_t max_shared_bytes,
+                                          const unsigned int block_size)
+    {
+    if (N == 0)
+        return cudaSuccess;
+
+    const unsigned int num_bins = bins.getBinIndexer().getNumElements();
+    const size_t shared_bytes = 5 * sizeof(double) * num_bins;
+
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)kernel::channel_flow_field_accumulate<true>);
+    if (shared_bytes + attr.sharedSizeBytes <= max_shared_bytes)
+        {
+        unsigned int run_block_size = min(block_size, (unsigned int)attr.maxThreadsPerBlock);
+        dim3 grid(N / run_block_size + 1);
+        kernel::channel_flow_field_accumulate<true>
+            <<<grid, run_block_size, shared_bytes>>>(d_bin_vel,
+                                                     d_bin_vsq,
+                                                     d_pos,
+                                                     d_vel,
+                                                     bins,
+                                                     N,
+                                                     num_bins);
+        }
+    else
+        {
+        cudaFuncGetAttributes(&attr, (const void*)kernel::channel_flow_field_accumulate<false>);
+        unsigned int run_block_size = min(block_size, (unsigned int)attr.maxThreadsPerBlock);
+        dim3 grid(N / run_block_size + 1);
+        kernel::channel_flow_field_accumulate<false><<<grid, run_block_size>>>(d_bin_vel,
+                                                                                d_bin_vsq,
+                                                                                d_pos,
+                                                                                d_vel,
+                                                                                bins,
+                                                                                N,
+                                                                                num_bins);
+        }
+
+    return cudaSuccess;
+    }
+
+    } // end namespace gpu
+    } // end namespace mpcd
+    } // end namespace hoomd
@@ -0,0 +1,37 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef MPCD_CHANNEL_FLOW_FIELD_ANALYZER_GPU_CUH_
+#define MPCD_CHANNEL_FLOW_FIELD_ANALYZER_GPU_CUH_
+
+/*!
+ * \file mpcd/ChannelFlowFieldAnalyzerGPU.cuh
+ * \brief Declaration of CUDA kernels for mpcd::ChannelFlowFieldAnalyzerGPU
+ */
+
+#include <cuda_runtime.h>
+
+#include "ChannelFlowFieldBins.h"
+#include "ParticleDataUtilities.h"
+#include "hoomd/HOOMDMath.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace gpu
+    {
+//! Kernel driver to add the particles to the sums in each channel flow field bin
+cudaError_t channel_flow_field_accumulate(double4* d_bin_vel,
+                                          double* d_bin_vsq,
+                                          const SolventScalar4* d_pos,
+                                          const SolventScalar4* d_vel,
+                                          const mpcd::detail::ChannelFlowFieldBins& bins,
+                                          const unsigned int N,
+                                          const size_t max_shared_bytes,
+                                          const unsigned int block_size);
+
+    } // end namespace gpu
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_CHANNEL_FLOW_FIELD_ANALYZER_GPU_CUH_
@@ -0,0 +1,62 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/ChannelFlowFieldAnalyzerGPU.h
+ * \brief Declaration of mpcd::ChannelFlowFieldAnalyzerGPU
+ */
+
+#ifndef MPCD_CHANNEL_FLOW_FIELD_ANALYZER_GPU_H_
+#define MPCD_CHANNEL_FLOW_FIELD_ANALYZER_GPU_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "ChannelFlowFieldAnalyzer.h"
+#include "hoomd/Autotuner.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Accumulates time-averaged flow fields of the MPCD particles along a cosine channel on the GPU
+/*!
+ * See mpcd::ChannelFlowFieldAnalyzer for design details. Each block accumulates its particles
+ * into a copy of the sums in shared memory, which is then added to the sums in global memory, so
+ * fewer atomic operations contend on the global sums. If the sums do not fit in shared memory,
+ * the particles are added directly to the global sums.
+ */
+class PYBIND11_EXPORT ChannelFlowFieldAnalyzerGPU : public mpcd::ChannelFlowFieldAnalyzer
+    {
+    public:
+    //! Constructor
+    ChannelFlowFieldAnalyzerGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                std::shared_ptr<Trigger> trigger,
+                                std::shared_ptr<const mpcd::detail::CosineChannel> geom,
+                                unsigned int ns,
+                                unsigned int ny,
+                                unsigned int nn,
+                                Scalar n_max,
+                                unsigned int num_samples);
+
+    protected:
+    //! Add the current particles to the sums in each bin on the GPU
+    virtual void accumulate();
+
+    //! Zero the sums in each bin on the GPU
+    virtual void resetAccumulators();
+
+    private:
+    std::shared_ptr<Autotuner<1>> m_tuner; //!< Kernel tuner
+    };
+
+namespace detail
+    {
+//! Export the mpcd::ChannelFlowFieldAnalyzerGPU to python
+void export_ChannelFlowFieldAnalyzerGPU(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+
+#endif // MPCD_CHANNEL_FLOW_FIELD_ANALYZER_GPU_H_
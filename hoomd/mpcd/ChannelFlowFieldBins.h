@@ -0,0 +1,281 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/ChannelFlowFieldBins.h
+ * \brief Defines mpcd::detail::ChannelFlowFieldBins
+ */
+
+#ifndef MPCD_CHANNEL_FLOW_FIELD_BINS_H_
+#define MPCD_CHANNEL_FLOW_FIELD_BINS_H_
+
+#include "EvaluatorExternalCosineWall.h"
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/Index1D.h"
+
+#ifndef __HIPCC__
+#include <cmath>
+#endif // __HIPCC__
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__ inline
+#else
+#define HOSTDEVICE inline __attribute__((always_inline))
+#endif
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace detail
+    {
+//! Bins for accumulating a flow field in the coordinates that follow a cosine channel
+/*!
+ * The centerline of the mpcd::detail::CosineChannel is \f$ z_c(x) = A \cos(k x - \phi) \f$. A
+ * particle is mapped to the closest point on the centerline, which is found in the same way as
+ * the closest point on a cosine wall (see mpcd::detail::findCosineWallClosestPoint). Its
+ * coordinates are then the arc length \a s of the centerline from the lower edge of the box to
+ * that point, \a y, and the signed normal distance \a n to the centerline, which is positive above
+ * it. The arc length is divided into bins of equal length along the whole (periodic) centerline,
+ * and the normal distance is divided into bins of equal width in [-\a n_max, \a n_max). Particles
+ * outside this range are put into the nearest bin. The bins are indexed by Index3D in the order
+ * (s, y, n).
+ *
+ * The velocity of a particle is also rotated into its components along the tangent of the
+ * centerline, along \a y, and along the normal of the centerline.
+ *
+ * The arc length is evaluated from the Fourier series of the arc length element
+ * \f$ \sqrt{1 + (A k)^2 \sin^2\theta} \f$, which converges geometrically, so it costs a fixed
+ * number of multiply-adds instead of a quadrature. The coefficients are computed on the host
+ * when the bins are constructed.
+ *
+ * The normal coordinates are only unique within the radius of curvature \f$ 1/(A k^2) \f$ of the
+ * centerline, so \a n_max should not exceed it.
+ */
+class ChannelFlowFieldBins
+    {
+    public:
+    static const unsigned int num_terms = 16; //!< Number of terms in the arc length series
+
+#ifndef __HIPCC__
+    //! Constructor
+    /*!
+     * \param global_box Global simulation box
+     * \param num_bins Number of bins along s, y, and n
+     * \param amplitude Amplitude \a A of the centerline
+     * \param wavenumber Wavenumber \a k of the centerline
+     * \param phase Phase \f$ \phi \f$ of the centerline
+     * \param n_max Largest normal distance to bin
+     */
+    ChannelFlowFieldBins(const BoxDim& global_box,
+                         const uint3& num_bins,
+                         Scalar amplitude,
+                         Scalar wavenumber,
+                         Scalar phase,
+                         Scalar n_max)
+        : m_global_box(global_box), m_num_bins(num_bins),
+          m_bin_indexer(num_bins.x, num_bins.y, num_bins.z), m_amplitude(amplitude),
+          m_k(wavenumber), m_phase(phase), m_n_max(n_max), m_c0(0), m_s_origin(0)
+        {
+        // the arc length element has period pi and is even, so it is a cosine series in 2 theta.
+        // the trapezoidal rule converges exponentially for periodic functions.
+        const double a = static_cast<double>(amplitude) * static_cast<double>(wavenumber);
+        const unsigned int num_samples = 4 * num_terms;
+        double c0 = 0;
+        double coeff[num_terms] = {};
+        for (unsigned int i = 0; i < num_samples; ++i)
+            {
+            const double theta = M_PI * i / num_samples;
+            const double sin_theta = std::sin(theta);
+            const double g = std::sqrt(1.0 + a * a * sin_theta * sin_theta);
+            c0 += g;
+            for (unsigned int m = 1; m <= num_terms; ++m)
+                {
+                coeff[m - 1] += g * std::cos(2.0 * m * theta);
+                }
+            }
+
+        // integrate the series term by term
+        m_c0 = Scalar(c0 / num_samples);
+        for (unsigned int m = 1; m <= num_terms; ++m)
+            {
+            m_coeff[m - 1] = Scalar(2.0 * coeff[m - 1] / num_samples / (2.0 * m));
+            }
+        m_s_origin = getArcLength(global_box.getLo().x);
+        }
+
+    //! Get the volume of a bin
+    /*!
+     * \param bin Index of the bin
+     * \returns Volume of the bin
+     *
+     * The area element in the (s, n) coordinates is \f$ (1 - \kappa n) ds dn \f$, where
+     * \f$ \kappa \f$ is the curvature of the centerline. Its integral over \a s is the change in
+     * the angle of the tangent, so the volume of a bin is exact.
+     */
+    Scalar getBinVolume(unsigned int bin) const
+        {
+        const uint3 b = m_bin_indexer.getTriple(bin);
+        const Scalar ds = getLength() / m_num_bins.x;
+        const Scalar dn = Scalar(2) * m_n_max / m_num_bins.z;
+        const Scalar n_lo = -m_n_max + b.z * dn;
+        const Scalar n_hi = n_lo + dn;
+        const Scalar turn = getTangentAngle(getCenterlineX((b.x + 1) * ds))
+                            - getTangentAngle(getCenterlineX(b.x * ds));
+        const Scalar area = ds * dn - Scalar(0.5) * (n_hi * n_hi - n_lo * n_lo) * turn;
+        return area * m_global_box.getL().y / m_num_bins.y;
+        }
+#endif // __HIPCC__
+
+    //! Get the bin of a particle, and rotate its velocity into the channel coordinates
+    /*!
+     * \param pos Particle position
+     * \param vel Particle velocity, which is rotated into its (s, y, n) components
+     * \returns Index of the bin that contains \a pos
+     */
+    HOSTDEVICE unsigned int getBin(const Scalar3& pos, Scalar3& vel) const
+        {
+        // closest point on the centerline, shifted so that the cosine has no phase
+        const Scalar shift = m_phase / m_k;
+        const Scalar3 r = make_scalar3(pos.x - shift, pos.y, pos.z);
+        const Scalar dz = r.z - m_amplitude * fast::cos(m_k * r.x);
+        Scalar x = pos.x;
+        Scalar n = dz;
+        if (dz != Scalar(0) && m_amplitude != Scalar(0))
+            {
+            // the vertical distance bounds the distance to the centerline
+            const Scalar side = (dz > Scalar(0)) ? Scalar(1) : Scalar(-1);
+            const cosine_wall_t centerline = {m_amplitude, Scalar(0), side};
+            Scalar3 dr;
+            findCosineWallClosestPoint(dr, r, centerline, m_k, Scalar(2) * fabs(dz));
+            x = pos.x - dr.x;
+            n = side * fast::sqrt(dr.x * dr.x + dr.z * dr.z);
+            }
+
+        // rotate the velocity into the tangent and normal of the centerline at x
+        const Scalar slope = getSlope(x);
+        const Scalar inv_norm = fast::rsqrt(Scalar(1) + slope * slope);
+        vel = make_scalar3((vel.x + slope * vel.z) * inv_norm,
+                           vel.y,
+                           (vel.z - slope * vel.x) * inv_norm);
+
+        // the arc length is periodic, so wrap its bin
+        const Scalar s = getArcLength(x) / getLength();
+        int bin_s = static_cast<int>(slow::floor(s * m_num_bins.x)) % int(m_num_bins.x);
+        if (bin_s < 0)
+            bin_s += m_num_bins.x;
+
+        const Scalar f_y = m_global_box.makeFraction(pos).y;
+        const Scalar f_n = (n + m_n_max) / (Scalar(2) * m_n_max);
+        return m_bin_indexer(bin_s,
+                             clampBin(static_cast<int>(slow::floor(f_y * m_num_bins.y)),
+                                      m_num_bins.y),
+                             clampBin(static_cast<int>(slow::floor(f_n * m_num_bins.z)),
+                                      m_num_bins.z));
+        }
+
+    //! Get the arc length of the centerline
+    /*!
+     * \param x Position along the centerline
+     * \returns Arc length of the centerline from the lower edge of the box to \a x
+     *
+     * The series of \f$ \sin(2 m \theta) \f$ is evaluated with the Chebyshev recurrence, so only
+     * one sine and cosine are computed.
+     */
+    HOSTDEVICE Scalar getArcLength(Scalar x) const
+        {
+        const Scalar theta = m_k * x - m_phase;
+        Scalar sin_2theta, cos_2theta;
+        fast::sincos(Scalar(2) * theta, sin_2theta, cos_2theta);
+
+        Scalar s = m_c0 * theta;
+        Scalar sin_prev(0);
+        Scalar sin_cur = sin_2theta;
+        for (unsigned int m = 0; m < num_terms; ++m)
+            {
+            s += m_coeff[m] * sin_cur;
+            const Scalar sin_next = Scalar(2) * cos_2theta * sin_cur - sin_prev;
+            sin_prev = sin_cur;
+            sin_cur = sin_next;
+            }
+        return s / m_k - m_s_origin;
+        }
+
+    //! Get the arc length of the centerline across the box
+    HOSTDEVICE Scalar getLength() const
+        {
+        return m_c0 * m_global_box.getL().x;
+        }
+
+    //! Get the bin indexer
+    HOSTDEVICE const Index3D& getBinIndexer() const
+        {
+        return m_bin_indexer;
+        }
+
+    private:
+    BoxDim m_global_box;      //!< Global simulation box
+    uint3 m_num_bins;         //!< Number of bins along s, y, and n
+    Index3D m_bin_indexer;    //!< Indexer for the bins
+    Scalar m_amplitude;       //!< Amplitude of the centerline
+    Scalar m_k;               //!< Wavenumber of the centerline
+    Scalar m_phase;           //!< Phase of the centerline
+    Scalar m_n_max;           //!< Largest normal distance to bin
+    Scalar m_c0;              //!< Mean of the arc length element
+    Scalar m_coeff[num_terms]; //!< Coefficients of the integrated arc length series
+    Scalar m_s_origin;        //!< Arc length series at the lower edge of the box
+
+    //! Get the slope of the centerline at \a x
+    HOSTDEVICE Scalar getSlope(Scalar x) const
+        {
+        return -m_amplitude * m_k * fast::sin(m_k * x - m_phase);
+        }
+
+#ifndef __HIPCC__
+    //! Get the angle of the tangent of the centerline at \a x
+    Scalar getTangentAngle(Scalar x) const
+        {
+        return std::atan(getSlope(x));
+        }
+
+    //! Get the position along x of the point on the centerline with arc length \a s
+    /*!
+     * The arc length increases monotonically with a derivative of at least 1, so Newton's method
+     * converges from the position that the mean arc length element gives.
+     */
+    Scalar getCenterlineX(Scalar s) const
+        {
+        Scalar x = m_global_box.getLo().x + s / m_c0;
+        for (unsigned int i = 0; i < 32; ++i)
+            {
+            const Scalar slope = getSlope(x);
+            const Scalar dx = (getArcLength(x) - s) / std::sqrt(Scalar(1) + slope * slope);
+            x -= dx;
+            if (std::abs(dx) < Scalar(1e-10) * m_global_box.getL().x)
+                break;
+            }
+        return x;
+        }
+#endif // __HIPCC__
+
+    //! Clamp a bin index into the range [0, \a num_bins)
+    HOSTDEVICE static unsigned int clampBin(int bin, unsigned int num_bins)
+        {
+        if (bin < 0)
+            return 0;
+        else if (bin >= static_cast<int>(num_bins))
+            return num_bins - 1;
+        else
+            return bin;
+        }
+    };
+
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+
+#undef HOSTDEVICE
+
+#endif // MPCD_CHANNEL_FLOW_FIELD_BINS_H_
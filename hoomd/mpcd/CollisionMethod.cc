@@ -7,6 +7,7 @@
  */
 
 #include "CollisionMethod.h"
+#include "CellThermoCompute.h"
 #include "hoomd/RNGIdentifiers.h"
 #include "hoomd/RandomNumbers.h"
 
@@ -25,7 +26,7 @@ mpcd::CollisionMethod::CollisionMethod(std::shared_ptr<SystemDefinition> sysdef,
                                        int phase)
     : m_sysdef(sysdef), m_pdata(m_sysdef->getParticleData()),
       m_mpcd_pdata(sysdef->getMPCDParticleData()), m_exec_conf(m_pdata->getExecConf()),
-      m_period(period), m_enable_grid_shift(true)
+      m_period(period), m_fused(false), m_fused_timestep(0), m_enable_grid_shift(true)
     {
     // setup next timestep for collision
     m_next_timestep = cur_timestep;
@@ -53,12 +54,46 @@ void mpcd::CollisionMethod::collide(uint64_t timestep)
     // set random grid shift
     drawGridShift(timestep);
 
-    // update cell list
-    m_cl->compute(timestep);
+    // update cell list, unless the cell properties were accumulated while streaming. in that
+    // case, the cell thermo compute decides if the cell list is still needed.
+    const bool fused = (m_fused && m_fused_timestep == timestep);
+    m_fused = false;
+    if (!fused)
+        m_cl->compute(timestep);
 
+    setAutotunerProblemSize(m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual());
     rule(timestep);
     }
 
+/*!
+ * \param timestep Timestep of the collision to prepare
+ * \returns The cell thermo compute to accumulate into, or a null pointer if the collision cannot
+ *          be prepared
+ *
+ * The cell list has its grid shift set for \a timestep and its dimensions computed, so that the
+ * streaming method can bin the particles into the cells they will have when the collision occurs.
+ * The streaming method is then responsible for accumulating the cell properties into the
+ * returned compute. The collision is not prepared if there is an embedded group, since the
+ * embedded particles are not streamed by the MPCD streaming method.
+ */
+std::shared_ptr<mpcd::CellThermoCompute>
+mpcd::CollisionMethod::beginFusedCollision(uint64_t timestep)
+    {
+    auto thermo = getFusedThermo();
+    if (!thermo || !m_cl || m_embed_group)
+        {
+        return std::shared_ptr<mpcd::CellThermoCompute>();
+        }
+
+    m_cl->setEmbeddedGroup(m_embed_group);
+    m_cl->setGridShift(computeGridShift(timestep));
+    m_cl->computeDimensions();
+
+    m_fused = true;
+    m_fused_timestep = timestep;
+    return thermo;
+    }
+
 /*!
  * \param timestep Current timestep
  * \returns True when \a timestep is a \a m_period multiple of the the next timestep the collision
@@ -141,30 +176,39 @@ bool mpcd::CollisionMethod::shouldCollide(uint64_t timestep)
  */
 void mpcd::CollisionMethod::drawGridShift(uint64_t timestep)
     {
-    uint16_t seed = m_sysdef->getSeed();
+    m_cl->setGridShift(computeGridShift(timestep));
+    }
 
+/*!
+ * \param timestep Timestep to compute shifting for
+ * \returns The grid shift vector for \a timestep
+ *
+ * The shift is drawn from a PRNG seeded by \a timestep, so the same vector is returned for a
+ * timestep no matter when it is computed. This allows the shift for a future collision to be
+ * known in advance.
+ */
+Scalar3 mpcd::CollisionMethod::computeGridShift(uint64_t timestep) const
+    {
     // return zeros if shifting is off
     if (!m_enable_grid_shift)
         {
-        m_cl->setGridShift(make_scalar3(0.0, 0.0, 0.0));
-        }
-    else
-        {
-        // PRNG using seed and timestep as seeds
-        hoomd::RandomGenerator rng(
-            hoomd::Seed(hoomd::RNGIdentifier::CollisionMethod, timestep, seed),
-            hoomd::Counter(m_instance));
-        const Scalar max_shift = m_cl->getMaxGridShift();
-
-        // draw shift variables from uniform distribution
-        Scalar3 shift;
-        hoomd::UniformDistribution<Scalar> uniform(-max_shift, max_shift);
-        shift.x = uniform(rng);
-        shift.y = uniform(rng);
-        shift.z = (m_sysdef->getNDimensions() == 3) ? uniform(rng) : Scalar(0.0);
-
-        m_cl->setGridShift(shift);
+        return make_scalar3(0.0, 0.0, 0.0);
         }
+
+    // PRNG using seed and timestep as seeds
+    uint16_t seed = m_sysdef->getSeed();
+    hoomd::RandomGenerator rng(hoomd::Seed(hoomd::RNGIdentifier::CollisionMethod, timestep, seed),
+                               hoomd::Counter(m_instance));
+    const Scalar max_shift = m_cl->getMaxGridShift();
+
+    // draw shift variables from uniform distribution
+    Scalar3 shift;
+    hoomd::UniformDistribution<Scalar> uniform(-max_shift, max_shift);
+    shift.x = uniform(rng);
+    shift.y = uniform(rng);
+    shift.z = (m_sysdef->getNDimensions() == 3) ? uniform(rng) : Scalar(0.0);
+
+    return shift;
     }
 
 /*!
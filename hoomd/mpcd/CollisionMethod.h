@@ -24,6 +24,8 @@ namespace hoomd
     {
 namespace mpcd
     {
+class CellThermoCompute;
+
 //! MPCD collision method
 /*!
  * This class forms the generic base for an MPCD collision method. It handles the boiler plate of
@@ -59,6 +61,9 @@ class PYBIND11_EXPORT CollisionMethod : public Autotuned
     //! Generates the random grid shift vector
     void drawGridShift(uint64_t timestep);
 
+    //! Prepare a collision whose cell properties are accumulated while the particles stream
+    std::shared_ptr<mpcd::CellThermoCompute> beginFusedCollision(uint64_t timestep);
+
     //! Sets a group of particles that is coupled to the MPCD solvent through the collision step
     /*!
      * \param embed_group Group to embed
@@ -75,6 +80,12 @@ class PYBIND11_EXPORT CollisionMethod : public Autotuned
     //! Set the period of the collision method
     void setPeriod(unsigned int cur_timestep, unsigned int period);
 
+    //! Get the period of the collision method
+    uint64_t getPeriod() const
+        {
+        return m_period;
+        }
+
     /// Set the RNG instance
     void setInstance(unsigned int instance)
         {
@@ -117,12 +128,31 @@ class PYBIND11_EXPORT CollisionMethod : public Autotuned
 
     unsigned int m_instance = 0; //!< Unique ID for RNG seeding
 
+    bool m_fused;              //!< True if a collision was prepared by beginFusedCollision()
+    uint64_t m_fused_timestep; //!< Timestep of the collision prepared by beginFusedCollision()
+
     //! Check if a collision should occur and advance the timestep counter
     virtual bool shouldCollide(uint64_t timestep);
 
     //! Call the collision rule
     virtual void rule(uint64_t timestep) { }
 
+    //! Compute the random grid shift vector
+    Scalar3 computeGridShift(uint64_t timestep) const;
+
+    //! Get the cell thermo compute whose properties can be accumulated while streaming
+    /*!
+     * \returns A null pointer if the collision rule does not support this
+     *
+     * Collision methods that only need the cell velocities and energies of the MPCD particles
+     * can override this method so that the cell properties are accumulated by the streaming
+     * method, rather than by building the cell list after streaming.
+     */
+    virtual std::shared_ptr<mpcd::CellThermoCompute> getFusedThermo()
+        {
+        return std::shared_ptr<mpcd::CellThermoCompute>();
+        }
+
     bool m_enable_grid_shift; //!< Flag to enable grid shifting
     };
 
@@ -0,0 +1,63 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/CollisionStatistics.h
+ * \brief Definition of mpcd::detail::CollisionStatistics
+ */
+
+#ifndef MPCD_COLLISION_STATISTICS_H_
+#define MPCD_COLLISION_STATISTICS_H_
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__ inline
+#else
+#define HOSTDEVICE inline __attribute__((always_inline))
+#endif // __HIPCC__
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace detail
+    {
+//! Counters for collisions of MPCD particles with a confining geometry
+/*!
+ * The streaming method counts the collisions and particles that collide more than once during a
+ * step. Geometries that need to solve for the collision point numerically additionally count the
+ * number of root-finding iterations, the number of collisions that needed bisection steps, and
+ * the number of collisions that reached the maximum number of iterations.
+ */
+struct CollisionStatistics
+    {
+    unsigned int collisions;  //!< Number of collisions with the geometry
+    unsigned int multiple;    //!< Number of particles that collided more than once
+    unsigned int iterations;  //!< Number of root-finding iterations
+    unsigned int fallbacks;   //!< Number of collisions that fell back to bisection
+    unsigned int unconverged; //!< Number of collisions that reached the maximum iteration
+
+    //! Constructor
+    HOSTDEVICE CollisionStatistics()
+        : collisions(0), multiple(0), iterations(0), fallbacks(0), unconverged(0)
+        {
+        }
+
+    //! Addition operator for summed reduction
+    HOSTDEVICE CollisionStatistics operator+(const CollisionStatistics& other) const
+        {
+        CollisionStatistics sum;
+        sum.collisions = collisions + other.collisions;
+        sum.multiple = multiple + other.multiple;
+        sum.iterations = iterations + other.iterations;
+        sum.fallbacks = fallbacks + other.fallbacks;
+        sum.unconverged = unconverged + other.unconverged;
+        return sum;
+        }
+    };
+
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+#undef HOSTDEVICE
+
+#endif // MPCD_COLLISION_STATISTICS_H_
@@ -66,6 +66,21 @@ mpcd::Communicator::Communicator(std::shared_ptr<SystemDefinition> sysdef)
     MPI_Type_commit(&m_pdata_element);
     MPI_Type_free(&tmp);
 
+    // create a smaller data type with only the fields that are needed after migration
+    const int nitems_migrate = 3;
+    int blocklengths_migrate[nitems_migrate] = {4, 3, 1};
+    MPI_Datatype types_migrate[nitems_migrate] = {MPI_HOOMD_SCALAR, MPI_HOOMD_SCALAR, MPI_UNSIGNED};
+    MPI_Aint offsets_migrate[nitems_migrate] = {offsets[0], offsets[1], offsets[2]};
+    MPI_Type_create_struct(nitems_migrate,
+                           blocklengths_migrate,
+                           offsets_migrate,
+                           types_migrate,
+                           &tmp);
+    MPI_Type_commit(&tmp);
+    MPI_Type_create_resized(tmp, 0, sizeof(mpcd::detail::pdata_element), &m_migrate_element);
+    MPI_Type_commit(&m_migrate_element);
+    MPI_Type_free(&tmp);
+
     initializeNeighborArrays();
     }
 
@@ -74,6 +89,7 @@ mpcd::Communicator::~Communicator()
     m_exec_conf->msg->notice(5) << "Destroying MPCD Communicator" << std::endl;
     detachCallbacks();
     MPI_Type_free(&m_pdata_element);
+    MPI_Type_free(&m_migrate_element);
     }
 
 void mpcd::Communicator::initializeNeighborArrays()
@@ -224,36 +240,15 @@ void mpcd::Communicator::communicate(uint64_t timestep)
     m_is_communicating = false;
     }
 
-namespace mpcd
-    {
-namespace detail
-    {
-//! Partition operation for migrating particles
 /*!
- * This functor is used in combination with std::partition to sort migrated
- * particles in the send / receive buffers. The communication flags in an
- * mpcd::detail::pdata_element are checked with bitwise AND against a mask.
- * The result is cast to bool and negated. This behavior results in std::partition
- * moving all particles for which the flags are bitwise AND true with the mask
- * to the end of the buffer. This effectively compacts the buffers in place for
- * sending.
+ * \param timestep Current timestep
+ *
+ * All particles that have left the local domain are sent directly to their destination rank in
+ * a single exchange with the unique neighbors, including those that have crossed an edge or a
+ * corner of the domain. Each particle can move by at most one domain in each direction, which is
+ * guaranteed by checkDecomposition(). Only the fields that are meaningful after migration are
+ * sent, so the cell index and communication flags are reset on receipt.
  */
-class MigratePartitionOp
-    {
-    public:
-    MigratePartitionOp(const unsigned int mask_) : mask(mask_) { }
-
-    inline bool operator()(const mpcd::detail::pdata_element& e) const
-        {
-        return !static_cast<bool>(e.comm_flag & mask);
-        }
-
-    private:
-    const unsigned int mask; //!< Mask for the current communication stage
-    };
-    } // namespace detail
-    } // namespace mpcd
-
 void mpcd::Communicator::migrateParticles(uint64_t timestep)
     {
     if (m_mpcd_pdata->getNVirtual() > 0)
@@ -270,157 +265,173 @@ void mpcd::Communicator::migrateParticles(uint64_t timestep)
 
     // fill send buffer once
     m_mpcd_pdata->removeParticles(m_sendbuf, 0xffffffff, timestep);
-
-    // fill the buffers and send in each direction
-    unsigned int n_recv = 0;
-    for (unsigned int dim = 0; dim < m_sysdef->getNDimensions(); ++dim)
+    const unsigned int n_send = (unsigned int)m_sendbuf.size();
+
+    // find the unique neighbor that each particle is sent to, with the last slot being this rank
+    // for any particles that only crossed a boundary in a direction that is not decomposed
+    const unsigned int self = m_n_unique_neigh;
+    m_send_neigh.resize(n_send);
+    m_n_send.assign(m_n_unique_neigh + 1, 0);
+    m_n_recv.assign(m_n_unique_neigh + 1, 0);
         {
-        if (!isCommunicating(static_cast<mpcd::detail::face>(2 * dim)))
-            continue;
-
-        const unsigned int right_mask = 1 << (2 * dim);
-        const unsigned int left_mask = 1 << (2 * dim + 1);
-        const unsigned int stage_mask = right_mask | left_mask;
-
-        // neighbor ranks
-        const unsigned int right_neigh = m_decomposition->getNeighborRank(2 * dim);
-        const unsigned int left_neigh = m_decomposition->getNeighborRank(2 * dim + 1);
-
-        // partition the send buffer by destination, leaving unsent particles at the front
-        unsigned int n_keep, n_send_left, n_send_right;
+        ArrayHandle<mpcd::detail::pdata_element> h_sendbuf(m_sendbuf,
+                                                           access_location::host,
+                                                           access_mode::read);
+        ArrayHandle<unsigned int> h_cart_ranks(m_decomposition->getCartRanks(),
+                                               access_location::host,
+                                               access_mode::read);
+        const Index3D& di = m_decomposition->getDomainIndexer();
+        const uint3 my_pos = m_decomposition->getGridPos();
+        const int3 grid = make_int3(di.getW(), di.getH(), di.getD());
+        const unsigned int my_rank = m_exec_conf->getRank();
+
+        for (unsigned int idx = 0; idx < n_send; ++idx)
             {
-            ArrayHandle<mpcd::detail::pdata_element> h_sendbuf(m_sendbuf,
-                                                               access_location::host,
-                                                               access_mode::readwrite);
-
-            // first, partition off particles that may be sent in either direction
-            mpcd::detail::MigratePartitionOp part_op(stage_mask);
-            auto bound = std::partition(h_sendbuf.data, h_sendbuf.data + m_sendbuf.size(), part_op);
-            n_keep = (unsigned int)(&(*bound) - h_sendbuf.data);
-
-            // then, partition the sent particles into the left and right ranks so that particles
-            // getting sent right come first
-            if (left_neigh != right_neigh)
+            const unsigned int flags = h_sendbuf.data[idx].comm_flag;
+            int3 pos = make_int3(my_pos.x, my_pos.y, my_pos.z);
+            if (flags & static_cast<unsigned int>(mpcd::detail::send_mask::east))
+                ++pos.x;
+            else if (flags & static_cast<unsigned int>(mpcd::detail::send_mask::west))
+                --pos.x;
+            if (flags & static_cast<unsigned int>(mpcd::detail::send_mask::north))
+                ++pos.y;
+            else if (flags & static_cast<unsigned int>(mpcd::detail::send_mask::south))
+                --pos.y;
+            if (flags & static_cast<unsigned int>(mpcd::detail::send_mask::up))
+                ++pos.z;
+            else if (flags & static_cast<unsigned int>(mpcd::detail::send_mask::down))
+                --pos.z;
+
+            // wrap through the periodic boundaries of the processor grid
+            if (pos.x == grid.x)
+                pos.x = 0;
+            else if (pos.x < 0)
+                pos.x += grid.x;
+            if (pos.y == grid.y)
+                pos.y = 0;
+            else if (pos.y < 0)
+                pos.y += grid.y;
+            if (pos.z == grid.z)
+                pos.z = 0;
+            else if (pos.z < 0)
+                pos.z += grid.z;
+
+            const unsigned int dest = h_cart_ranks.data[di(pos.x, pos.y, pos.z)];
+            unsigned int neigh = self;
+            if (dest != my_rank)
                 {
-                // partition the remaining particles left and right
-                mpcd::detail::MigratePartitionOp sort_op(left_mask);
-                bound = std::partition(h_sendbuf.data + n_keep,
-                                       h_sendbuf.data + m_sendbuf.size(),
-                                       sort_op);
-                n_send_right = (unsigned int)(&(*bound) - (h_sendbuf.data + n_keep));
-                n_send_left = (unsigned int)(m_sendbuf.size() - n_keep - n_send_right);
-                }
-            else
-                {
-                n_send_right = (unsigned int)(m_sendbuf.size() - n_keep);
-                n_send_left = 0;
+                auto it = m_unique_neigh_map.find(dest);
+                assert(it != m_unique_neigh_map.end());
+                neigh = it->second;
                 }
+            m_send_neigh[idx] = neigh;
+            ++m_n_send[neigh];
             }
+        }
+    m_n_recv[self] = m_n_send[self];
 
-        // communicate size of the message that will contain the particle data
-        unsigned int n_recv_left, n_recv_right;
-        if (left_neigh != right_neigh)
+    // communicate the number of particles exchanged with every neighbor
+        {
+        ArrayHandle<unsigned int> h_unique_neighbors(m_unique_neighbors,
+                                                     access_location::host,
+                                                     access_mode::read);
+        m_reqs.resize(2 * m_n_unique_neigh);
+        for (unsigned int i = 0; i < m_n_unique_neigh; ++i)
             {
-            m_reqs.resize(4);
-            MPI_Isend(&n_send_right, 1, MPI_UNSIGNED, right_neigh, 0, m_mpi_comm, &m_reqs[0]);
-            MPI_Irecv(&n_recv_right, 1, MPI_UNSIGNED, right_neigh, 0, m_mpi_comm, &m_reqs[1]);
-            MPI_Isend(&n_send_left, 1, MPI_UNSIGNED, left_neigh, 0, m_mpi_comm, &m_reqs[2]);
-            MPI_Irecv(&n_recv_left, 1, MPI_UNSIGNED, left_neigh, 0, m_mpi_comm, &m_reqs[3]);
-            MPI_Waitall(4, m_reqs.data(), MPI_STATUSES_IGNORE);
+            MPI_Isend(&m_n_send[i],
+                      1,
+                      MPI_UNSIGNED,
+                      h_unique_neighbors.data[i],
+                      0,
+                      m_mpi_comm,
+                      &m_reqs[2 * i]);
+            MPI_Irecv(&m_n_recv[i],
+                      1,
+                      MPI_UNSIGNED,
+                      h_unique_neighbors.data[i],
+                      0,
+                      m_mpi_comm,
+                      &m_reqs[2 * i + 1]);
             }
-        else
+        MPI_Waitall((int)m_reqs.size(), m_reqs.data(), MPI_STATUSES_IGNORE);
+        }
+
+    // offsets for every neighbor into the send and receive buffers
+    m_send_offsets.resize(m_n_unique_neigh + 1);
+    m_recv_offsets.resize(m_n_unique_neigh + 1);
+    unsigned int n_recv = 0;
+        {
+        unsigned int offset = 0;
+        for (unsigned int i = 0; i <= m_n_unique_neigh; ++i)
             {
-            // send right, receive left (same thing, really) only if neighbors match
-            n_recv_right = 0;
-            m_reqs.resize(2);
-            MPI_Isend(&n_send_right, 1, MPI_UNSIGNED, right_neigh, 0, m_mpi_comm, &m_reqs[0]);
-            MPI_Irecv(&n_recv_left, 1, MPI_UNSIGNED, left_neigh, 0, m_mpi_comm, &m_reqs[1]);
-            MPI_Waitall(2, m_reqs.data(), MPI_STATUSES_IGNORE);
+            m_send_offsets[i] = offset;
+            offset += m_n_send[i];
+            m_recv_offsets[i] = n_recv;
+            n_recv += m_n_recv[i];
             }
+        }
 
-        // exchange particle data
-        m_recvbuf.resize(n_recv + n_recv_left + n_recv_right);
+    // sort the send buffer by neighbor, using the receive buffer as scratch space
+    m_recvbuf.resize(n_send);
+        {
+        ArrayHandle<mpcd::detail::pdata_element> h_sendbuf(m_sendbuf,
+                                                           access_location::host,
+                                                           access_mode::read);
+        ArrayHandle<mpcd::detail::pdata_element> h_sorted(m_recvbuf,
+                                                          access_location::host,
+                                                          access_mode::overwrite);
+        std::vector<unsigned int> cursor(m_send_offsets);
+        for (unsigned int idx = 0; idx < n_send; ++idx)
             {
-            ArrayHandle<mpcd::detail::pdata_element> h_sendbuf(m_sendbuf,
-                                                               access_location::host,
-                                                               access_mode::read);
-            ArrayHandle<mpcd::detail::pdata_element> h_recvbuf(m_recvbuf,
-                                                               access_location::host,
-                                                               access_mode::overwrite);
-            m_reqs.resize(4);
-            int nreq = 0;
-            if (n_send_right != 0)
-                {
-                MPI_Isend(h_sendbuf.data + n_keep,
-                          n_send_right,
-                          m_pdata_element,
-                          right_neigh,
-                          1,
-                          m_mpi_comm,
-                          &m_reqs[nreq++]);
-                }
-            if (n_send_left != 0)
-                {
-                MPI_Isend(h_sendbuf.data + n_keep + n_send_right,
-                          n_send_left,
-                          m_pdata_element,
-                          left_neigh,
-                          1,
-                          m_mpi_comm,
-                          &m_reqs[nreq++]);
-                }
-            if (n_recv_right != 0)
+            h_sorted.data[cursor[m_send_neigh[idx]]++] = h_sendbuf.data[idx];
+            }
+        }
+    m_sendbuf.swap(m_recvbuf);
+
+    // exchange particle data, keeping any particles that stay on this rank
+    m_recvbuf.resize(n_recv);
+        {
+        ArrayHandle<mpcd::detail::pdata_element> h_sendbuf(m_sendbuf,
+                                                           access_location::host,
+                                                           access_mode::read);
+        ArrayHandle<mpcd::detail::pdata_element> h_recvbuf(m_recvbuf,
+                                                           access_location::host,
+                                                           access_mode::overwrite);
+        ArrayHandle<unsigned int> h_unique_neighbors(m_unique_neighbors,
+                                                     access_location::host,
+                                                     access_mode::read);
+
+        std::copy(h_sendbuf.data + m_send_offsets[self],
+                  h_sendbuf.data + m_send_offsets[self] + m_n_send[self],
+                  h_recvbuf.data + m_recv_offsets[self]);
+
+        m_reqs.resize(2 * m_n_unique_neigh);
+        int nreq = 0;
+        for (unsigned int i = 0; i < m_n_unique_neigh; ++i)
+            {
+            if (m_n_send[i] != 0)
                 {
-                MPI_Irecv(h_recvbuf.data + n_recv,
-                          n_recv_right,
-                          m_pdata_element,
-                          right_neigh,
+                MPI_Isend(h_sendbuf.data + m_send_offsets[i],
+                          m_n_send[i],
+                          m_migrate_element,
+                          h_unique_neighbors.data[i],
                           1,
                           m_mpi_comm,
                           &m_reqs[nreq++]);
                 }
-            if (n_recv_left != 0)
+            if (m_n_recv[i] != 0)
                 {
-                MPI_Irecv(h_recvbuf.data + n_recv + n_recv_right,
-                          n_recv_left,
-                          m_pdata_element,
-                          left_neigh,
+                MPI_Irecv(h_recvbuf.data + m_recv_offsets[i],
+                          m_n_recv[i],
+                          m_migrate_element,
+                          h_unique_neighbors.data[i],
                           1,
                           m_mpi_comm,
                           &m_reqs[nreq++]);
                 }
-            MPI_Waitall(nreq, m_reqs.data(), MPI_STATUSES_IGNORE);
             }
-
-            // now we pass through and unpack the particles, either by holding onto them in the
-            // receive buffer or by passing them back into the send buffer for the next stage
-            {
-            // partition the receive buffer so that particles that need to be sent are at the end
-            ArrayHandle<mpcd::detail::pdata_element> h_recvbuf(m_recvbuf,
-                                                               access_location::host,
-                                                               access_mode::readwrite);
-            mpcd::detail::MigratePartitionOp part_op(~stage_mask);
-            auto bound = std::partition(h_recvbuf.data + n_recv,
-                                        h_recvbuf.data + m_recvbuf.size(),
-                                        part_op);
-            n_recv = (unsigned int)(&(*bound) - h_recvbuf.data);
-
-            // move particles to resend over to the send buffer and unset the bits from this stage
-            const unsigned int n_resend = (unsigned int)(m_recvbuf.size() - n_recv);
-            m_sendbuf.resize(n_keep + n_resend);
-            ArrayHandle<mpcd::detail::pdata_element> h_sendbuf(m_sendbuf,
-                                                               access_location::host,
-                                                               access_mode::readwrite);
-            std::copy(h_recvbuf.data + n_recv,
-                      h_recvbuf.data + m_recvbuf.size(),
-                      h_sendbuf.data + n_keep);
-            for (unsigned int idx = n_keep; idx < m_sendbuf.size(); ++idx)
-                {
-                h_sendbuf.data[idx].comm_flag &= ~stage_mask;
-                }
-            }
-        m_recvbuf.resize(n_recv); // free up memory from the end of the receive buffer
-        } // end dir loop
+        MPI_Waitall(nreq, m_reqs.data(), MPI_STATUSES_IGNORE);
+        }
 
         // fill particle data with wrapped, received particles
         {
@@ -431,10 +442,15 @@ void mpcd::Communicator::migrateParticles(uint64_t timestep)
         for (unsigned int idx = 0; idx < n_recv; ++idx)
             {
             mpcd::detail::pdata_element& p = h_recvbuf.data[idx];
-            Scalar4& postype = p.pos;
+            Scalar3 pos = make_scalar3(p.pos.x, p.pos.y, p.pos.z);
             int3 image = make_int3(0, 0, 0);
 
-            wrap_box.wrap(postype, image);
+            wrap_box.wrap(pos, image);
+            p.pos = make_solvent_scalar4(pos.x, pos.y, pos.z, p.pos.w);
+
+            // these fields are not communicated
+            p.vel.w = __int_as_solvent_scalar(mpcd::detail::NO_CELL);
+            p.comm_flag = 0;
             }
         }
 
@@ -452,9 +468,9 @@ void mpcd::Communicator::setCommFlags(const BoxDim& box)
     {
     // mark all particles which have left the box for sending
     unsigned int N = m_mpcd_pdata->getN();
-    ArrayHandle<Scalar4> h_pos(m_mpcd_pdata->getPositions(),
-                               access_location::host,
-                               access_mode::read);
+    ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::host,
+                                      access_mode::read);
     ArrayHandle<unsigned int> h_comm_flag(m_mpcd_pdata->getCommFlags(),
                                           access_location::host,
                                           access_mode::overwrite);
@@ -464,7 +480,7 @@ void mpcd::Communicator::setCommFlags(const BoxDim& box)
     const Scalar3 hi = box.getHi();
     for (unsigned int idx = 0; idx < N; ++idx)
         {
-        const Scalar4& postype = h_pos.data[idx];
+        const SolventScalar4& postype = h_pos.data[idx];
         const Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
 
         unsigned int flags = 0;
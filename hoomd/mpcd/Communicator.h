@@ -47,8 +47,7 @@ namespace mpcd
  * are used in parallel simulations on the CPU. A domain decomposition communication pattern
  * is used so that every processor owns particles that are spatially local (\cite Plimpton 1995). So
  * far, the only communication needed for MPCD particles is migration, which is handled
- * using the same algorithms as for the standard hoomd::ParticleData
- * (::Communicator::migrateParticles).
+ * by a single exchange of particles with all unique neighbors, like mpcd::CommunicatorGPU.
  *
  * There is unfortunately significant code duplication with ::Communicator, but
  * there is little that can be done about this without creating an abstracted
@@ -98,9 +97,8 @@ class PYBIND11_EXPORT Communicator : public Autotuned
      * boundaries and transfers them to neighboring processors.
      *
      * Particles sent to a neighbor are deleted from the local particle data.
-     * Particles received from a neighbor in one of the six communication steps
-     * are added to the local particle data, and are also considered for forwarding to a neighbor
-     * in the subsequent communication steps.
+     * Every particle is sent directly to its destination rank in one exchange with
+     * the unique neighbors, and particles received are added to the local particle data.
      *
      * \post Every particle on every processor can be found inside the local domain boundaries.
      */
@@ -199,6 +197,7 @@ class PYBIND11_EXPORT Communicator : public Autotuned
     void initializeNeighborArrays();
 
     MPI_Datatype m_pdata_element;                     //!< MPI struct for pdata_element
+    MPI_Datatype m_migrate_element; //!< MPI struct for the migrated fields of pdata_element
     GPUVector<mpcd::detail::pdata_element> m_sendbuf; //!< Buffer for particles that are sent
     GPUVector<mpcd::detail::pdata_element> m_recvbuf; //!< Buffer for particles that are received
     std::vector<MPI_Request> m_reqs;                  //!< MPI requests
@@ -218,6 +217,12 @@ class PYBIND11_EXPORT Communicator : public Autotuned
 
     MigrateSignal m_migrate_requests; //!< Signal to request migration
     bool m_force_migrate;             //!< If true, force particle migration
+
+    std::vector<unsigned int> m_send_neigh;   //!< Unique neighbor each particle is sent to
+    std::vector<unsigned int> m_n_send;       //!< Number of particles sent per neighbor
+    std::vector<unsigned int> m_n_recv;       //!< Number of particles received per neighbor
+    std::vector<unsigned int> m_send_offsets; //!< Offsets into the send buffer per neighbor
+    std::vector<unsigned int> m_recv_offsets; //!< Offsets into the receive buffer per neighbor
     };
 
 namespace detail
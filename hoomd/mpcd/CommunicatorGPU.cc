@@ -22,7 +22,7 @@ namespace hoomd
  */
 mpcd::CommunicatorGPU::CommunicatorGPU(std::shared_ptr<SystemDefinition> sysdef)
     : Communicator(sysdef), m_max_stages(1), m_num_stages(0), m_comm_mask(0),
-      m_tmp_keys(m_exec_conf)
+      m_tmp_keys(m_exec_conf), m_gpu_aware_mpi(m_exec_conf->getMPIConfig()->isGPUAwareMPI())
     {
     // initialize communication stages
     initializeCommunicationStages();
@@ -289,15 +289,24 @@ void mpcd::CommunicatorGPU::migrateParticles(uint64_t timestep)
         // Resize particles from neighbor ranks
         m_recvbuf.resize(n_recv_tot);
             {
+            // GPU-aware MPI is passed the device buffers, otherwise they are staged on the host
+            const access_location::Enum mpi_loc
+                = (m_gpu_aware_mpi) ? access_location::device : access_location::host;
+            if (m_gpu_aware_mpi)
+                {
+                // the send buffer must be packed before MPI reads it
+                cudaDeviceSynchronize();
+                }
+
             ArrayHandle<unsigned int> h_unique_neighbors(m_unique_neighbors,
                                                          access_location::host,
                                                          access_mode::read);
-            ArrayHandle<mpcd::detail::pdata_element> h_sendbuf(m_sendbuf,
-                                                               access_location::host,
-                                                               access_mode::read);
-            ArrayHandle<mpcd::detail::pdata_element> h_recvbuf(m_recvbuf,
-                                                               access_location::host,
-                                                               access_mode::overwrite);
+            ArrayHandle<mpcd::detail::pdata_element> mpi_sendbuf(m_sendbuf,
+                                                                 mpi_loc,
+                                                                 access_mode::read);
+            ArrayHandle<mpcd::detail::pdata_element> mpi_recvbuf(m_recvbuf,
+                                                                 mpi_loc,
+                                                                 access_mode::overwrite);
 
             // loop over neighbors
             unsigned int nreq = 0;
@@ -311,7 +320,7 @@ void mpcd::CommunicatorGPU::migrateParticles(uint64_t timestep)
                 // exchange particle data
                 if (m_n_send_ptls[ineigh])
                     {
-                    MPI_Isend(h_sendbuf.data + sendidx,
+                    MPI_Isend(mpi_sendbuf.data + sendidx,
                               m_n_send_ptls[ineigh],
                               m_pdata_element,
                               neighbor,
@@ -325,7 +334,7 @@ void mpcd::CommunicatorGPU::migrateParticles(uint64_t timestep)
 
                 if (m_n_recv_ptls[ineigh])
                     {
-                    MPI_Irecv(h_recvbuf.data + m_offsets[ineigh],
+                    MPI_Irecv(mpi_recvbuf.data + m_offsets[ineigh],
                               m_n_recv_ptls[ineigh],
                               m_pdata_element,
                               neighbor,
@@ -366,9 +375,9 @@ void mpcd::CommunicatorGPU::setCommFlags(const BoxDim& box)
     ArrayHandle<unsigned int> d_comm_flag(m_mpcd_pdata->getCommFlags(),
                                           access_location::device,
                                           access_mode::overwrite);
-    ArrayHandle<Scalar4> d_pos(m_mpcd_pdata->getPositions(),
-                               access_location::device,
-                               access_mode::read);
+    ArrayHandle<SolventScalar4> d_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::device,
+                                      access_mode::read);
 
     m_flags_tuner->begin();
     mpcd::gpu::stage_particles(d_comm_flag.data,
@@ -390,7 +399,10 @@ void mpcd::detail::export_CommunicatorGPU(pybind11::module& m)
                      mpcd::Communicator,
                      std::shared_ptr<mpcd::CommunicatorGPU>>(m, "CommunicatorGPU")
         .def(pybind11::init<std::shared_ptr<SystemDefinition>>())
-        .def("setMaxStages", &mpcd::CommunicatorGPU::setMaxStages);
+        .def("setMaxStages", &mpcd::CommunicatorGPU::setMaxStages)
+        .def_property("gpu_aware_mpi",
+                      &mpcd::CommunicatorGPU::getGPUAwareMPI,
+                      &mpcd::CommunicatorGPU::setGPUAwareMPI);
     }
 
     } // end namespace hoomd
@@ -41,14 +41,16 @@ namespace kernel
  *
  * Checks for particles being out of bounds, and aggregates send flags.
  */
-__global__ void
-stage_particles(unsigned int* d_comm_flag, const Scalar4* d_pos, unsigned int N, const BoxDim box)
+__global__ void stage_particles(unsigned int* d_comm_flag,
+                                const SolventScalar4* d_pos,
+                                unsigned int N,
+                                const BoxDim box)
     {
     const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
     if (idx >= N)
         return;
 
-    const Scalar4 postype = d_pos[idx];
+    const SolventScalar4 postype = d_pos[idx];
     const Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
     const Scalar3 lo = box.getLo();
     const Scalar3 hi = box.getHi();
@@ -163,7 +165,7 @@ struct get_migrate_key : public thrust::unary_function<const unsigned int, unsig
  * \returns Accumulated communication flags of all particles
  */
 cudaError_t mpcd::gpu::stage_particles(unsigned int* d_comm_flag,
-                                       const Scalar4* d_pos,
+                                       const SolventScalar4* d_pos,
                                        const unsigned int N,
                                        const BoxDim& box,
                                        const unsigned int block_size)
@@ -288,8 +290,10 @@ struct wrap_particle_op
     __device__ mpcd::detail::pdata_element operator()(const mpcd::detail::pdata_element p)
         {
         mpcd::detail::pdata_element ret = p;
+        Scalar3 pos = make_scalar3(p.pos.x, p.pos.y, p.pos.z);
         int3 image = make_int3(0, 0, 0);
-        box.wrap(ret.pos, image);
+        box.wrap(pos, image);
+        ret.pos = make_solvent_scalar4(pos.x, pos.y, pos.z, p.pos.w);
         return ret;
         }
     };
@@ -19,7 +19,7 @@ namespace gpu
     {
 //! Mark particles that have left the local box for sending
 cudaError_t stage_particles(unsigned int* d_comm_flag,
-                            const Scalar4* d_pos,
+                            const SolventScalar4* d_pos,
                             const unsigned int n,
                             const BoxDim& box,
                             const unsigned int block_size);
@@ -69,6 +69,23 @@ class PYBIND11_EXPORT CommunicatorGPU : public mpcd::Communicator
         initializeCommunicationStages();
         }
 
+    //! Get whether MPI is passed GPU device buffers
+    bool getGPUAwareMPI() const
+        {
+        return m_gpu_aware_mpi;
+        }
+
+    //! Set whether MPI is passed GPU device buffers
+    /*!
+     * \param gpu_aware_mpi If true, MPI communicates the particle buffers without host staging
+     *
+     * The default is detected by MPIConfiguration::isGPUAwareMPI().
+     */
+    void setGPUAwareMPI(bool gpu_aware_mpi)
+        {
+        m_gpu_aware_mpi = gpu_aware_mpi;
+        }
+
     protected:
     //! Set the communication flags for the particle data on the GPU
     virtual void setCommFlags(const BoxDim& box);
@@ -87,6 +104,7 @@ class PYBIND11_EXPORT CommunicatorGPU : public mpcd::Communicator
     std::vector<unsigned int> m_n_send_ptls; //!< Number of particles sent per neighbor
     std::vector<unsigned int> m_n_recv_ptls; //!< Number of particles received per neighbor
     std::vector<unsigned int> m_offsets;     //!< Offsets for particle send buffers
+    bool m_gpu_aware_mpi;                    //!< True if MPI is passed device buffers
 
     //! Helper function to set up communication stages
     void initializeCommunicationStages();
@@ -0,0 +1,163 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/CompositeGeometry.h
+ * \brief Definition of the MPCD composite geometry
+ */
+
+#ifndef MPCD_COMPOSITE_GEOMETRY_H_
+#define MPCD_COMPOSITE_GEOMETRY_H_
+
+#include "CollisionStatistics.h"
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__ inline
+#else
+#define HOSTDEVICE inline __attribute__((always_inline))
+#include <string>
+#endif // __HIPCC__
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace detail
+    {
+//! Composition of two streaming geometries
+/*!
+ * The solid of the composite geometry is the union of the solids of the \a First and \a Second
+ * geometries, so a particle is inside the composite only if it is inside both. For example, a
+ * CosineChannel composed with a SlitPoreGeometry is a cosine channel with a constriction.
+ *
+ * Both geometries are stored by value and called directly, so the composite can be used anywhere
+ * a single geometry can (including in the GPU streaming kernel) without any virtual calls. More
+ * than two geometries can be combined by nesting composites.
+ *
+ * When a particle ends a step outside both geometries, it is reflected from the wall that it
+ * crossed first. The streaming methods keep detecting collisions for the remaining time, so any
+ * later crossing of the other wall is handled on the next iteration.
+ */
+template<class First, class Second> class __attribute__((visibility("default"))) CompositeGeometry
+    {
+    public:
+    //! Constructor
+    /*!
+     * \param first First geometry
+     * \param second Second geometry
+     */
+    HOSTDEVICE CompositeGeometry(const First& first, const Second& second)
+        : m_first(first), m_second(second)
+        {
+        }
+
+    //! Detect collision between the particle and the boundary
+    /*!
+     * \param pos Proposed particle position
+     * \param vel Proposed particle velocity
+     * \param dt Integration time remaining
+     * \param stats Optional statistics to record the root finding into
+     *
+     * \returns True if a collision occurred, and false otherwise
+     *
+     * \post The particle position \a pos is moved to the point of reflection, the velocity \a vel
+     * is updated according to the appropriate bounce back rule, and the integration time \a dt is
+     * decreased to the amount of time remaining.
+     *
+     * The remaining time returned by each geometry is the time the particle spent past its wall,
+     * so the wall crossed first is the one with the larger remaining time.
+     */
+    HOSTDEVICE bool detectCollision(Scalar3& pos,
+                                    Scalar3& vel,
+                                    Scalar& dt,
+                                    CollisionStatistics* stats = nullptr) const
+        {
+        Scalar3 pos_first = pos;
+        Scalar3 vel_first = vel;
+        Scalar dt_first = dt;
+        const bool collide_first = m_first.detectCollision(pos_first, vel_first, dt_first, stats);
+
+        Scalar3 pos_second = pos;
+        Scalar3 vel_second = vel;
+        Scalar dt_second = dt;
+        const bool collide_second
+            = m_second.detectCollision(pos_second, vel_second, dt_second, stats);
+
+        if (collide_first && (!collide_second || dt_first >= dt_second))
+            {
+            pos = pos_first;
+            vel = vel_first;
+            dt = dt_first;
+            return true;
+            }
+        else if (collide_second)
+            {
+            pos = pos_second;
+            vel = vel_second;
+            dt = dt_second;
+            return true;
+            }
+        else
+            {
+            dt = Scalar(0);
+            return false;
+            }
+        }
+
+    //! Check if a particle is out of bounds
+    /*!
+     * \param pos Current particle position
+     * \returns True if particle is out of bounds of either geometry, and false otherwise
+     */
+    HOSTDEVICE bool isOutside(const Scalar3& pos) const
+        {
+        return (m_first.isOutside(pos) || m_second.isOutside(pos));
+        }
+
+    //! Validate that the simulation box is large enough for the geometry
+    /*!
+     * \param box Global simulation box
+     * \param cell_size Size of MPCD cell
+     *
+     * \returns True if the box is large enough for both geometries
+     */
+    HOSTDEVICE bool validateBox(const BoxDim& box, Scalar cell_size) const
+        {
+        return (m_first.validateBox(box, cell_size) && m_second.validateBox(box, cell_size));
+        }
+
+    //! Get the first geometry
+    HOSTDEVICE const First& getFirst() const
+        {
+        return m_first;
+        }
+
+    //! Get the second geometry
+    HOSTDEVICE const Second& getSecond() const
+        {
+        return m_second;
+        }
+
+#ifndef __HIPCC__
+    //! Get the unique name of this geometry
+    static std::string getName()
+        {
+        return std::string("Composite") + First::getName() + Second::getName();
+        }
+#endif // __HIPCC__
+
+    private:
+    const First m_first;   //!< First geometry
+    const Second m_second; //!< Second geometry
+    };
+
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+
+#undef HOSTDEVICE
+
+#endif // MPCD_COMPOSITE_GEOMETRY_H_
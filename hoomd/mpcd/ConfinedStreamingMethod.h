@@ -13,7 +13,12 @@
 #error This header cannot be compiled by nvcc
 #endif
 
+#include "CollisionStatistics.h"
+#include "RigidBodyCoupling.h"
 #include "StreamingMethod.h"
+#include "WallMotion.h"
+
+#include "hoomd/ThreadLoops.h"
 #include <pybind11/pybind11.h>
 
 namespace hoomd
@@ -39,6 +44,22 @@ namespace mpcd
  *  3. validateBox(): Checks whether the global simulation box is consistent with the streaming
  * geometry.
  *
+ * Statistics about the collisions with the Geometry can optionally be collected on each streaming
+ * step. These are not tracked by default because they require an additional reduction.
+ *
+ * MD rigid bodies can optionally act as moving obstacles through an mpcd::RigidBodyCoupling. The
+ * particles are reflected from the bodies after checking for a collision with the Geometry, and the
+ * momentum they exchange is summed for each body. Collisions with the bodies are not counted in the
+ * statistics.
+ *
+ * The walls of the Geometry can optionally be moved by an mpcd::WallMotion, which owns the
+ * geometry that is streamed in. The walls are moved at the end of each streaming step to the time
+ * of the next streaming step, so the virtual particle fillers that share the geometry also follow
+ * the walls. Only the box is validated after the walls move. The particles are not validated
+ * again because particles that the walls sweep over are pushed back inside when they collide.
+ *
+ * The box and particles are validated again on the next streaming step after the box changes, for
+ * example when it is resized by a BoxResizeUpdater.
  */
 template<class Geometry>
 class PYBIND11_EXPORT ConfinedStreamingMethod : public mpcd::StreamingMethod
@@ -58,8 +79,19 @@ class PYBIND11_EXPORT ConfinedStreamingMethod : public mpcd::StreamingMethod
                             int phase,
                             std::shared_ptr<const Geometry> geom)
         : mpcd::StreamingMethod(sysdef, cur_timestep, period, phase), m_geom(geom),
-          m_validate_geom(true)
+          m_validate_geom(true), m_track_collisions(false)
         {
+        m_pdata->getBoxChangeSignal()
+            .template connect<ConfinedStreamingMethod<Geometry>,
+                              &ConfinedStreamingMethod<Geometry>::requestValidate>(this);
+        }
+
+    //! Destructor
+    virtual ~ConfinedStreamingMethod()
+        {
+        m_pdata->getBoxChangeSignal()
+            .template disconnect<ConfinedStreamingMethod<Geometry>,
+                                 &ConfinedStreamingMethod<Geometry>::requestValidate>(this);
         }
 
     //! Implementation of the streaming rule
@@ -78,15 +110,93 @@ class PYBIND11_EXPORT ConfinedStreamingMethod : public mpcd::StreamingMethod
         m_geom = geom;
         }
 
+    //! Get whether collision statistics are tracked
+    bool getTrackCollisions() const
+        {
+        return m_track_collisions;
+        }
+
+    //! Set whether collision statistics are tracked
+    void setTrackCollisions(bool track_collisions)
+        {
+        m_track_collisions = track_collisions;
+        m_collision_stats = mpcd::detail::CollisionStatistics();
+        }
+
+    //! Get the collision statistics from the last streaming step
+    /*!
+     * \returns Collision statistics summed over all ranks
+     *
+     * All counters are zero if collision statistics are not tracked.
+     */
+    const mpcd::detail::CollisionStatistics& getCollisionStatistics() const
+        {
+        return m_collision_stats;
+        }
+
+    //! Get the coupled rigid bodies
+    std::shared_ptr<mpcd::RigidBodyCoupling> getRigidBodyCoupling() const
+        {
+        return m_bodies;
+        }
+
+    //! Set the coupled rigid bodies
+    /*!
+     * \param bodies Rigid bodies to reflect particles from, or null to remove them
+     */
+    void setRigidBodyCoupling(std::shared_ptr<mpcd::RigidBodyCoupling> bodies)
+        {
+        m_bodies = bodies;
+        }
+
+    //! Get the motion of the walls
+    std::shared_ptr<mpcd::WallMotion<Geometry>> getWallMotion() const
+        {
+        return m_motion;
+        }
+
+    //! Set the motion of the walls
+    /*!
+     * \param motion Motion of the walls, or null to stop moving them
+     *
+     * The geometry is replaced by the moving geometry of \a motion. The walls stay where they are
+     * if the motion is removed.
+     */
+    void setWallMotion(std::shared_ptr<mpcd::WallMotion<Geometry>> motion)
+        {
+        m_motion = motion;
+        if (m_motion)
+            {
+            m_geom = m_motion->getGeometry();
+            }
+        }
+
     protected:
     std::shared_ptr<const Geometry> m_geom; //!< Streaming geometry
     bool m_validate_geom;                   //!< If true, run a validation check on the geometry
+    bool m_track_collisions;                //!< If true, collect collision statistics
+    mpcd::detail::CollisionStatistics m_collision_stats; //!< Statistics from last streaming step
+    std::shared_ptr<mpcd::RigidBodyCoupling> m_bodies;   //!< Coupled rigid bodies (optional)
+    std::shared_ptr<mpcd::WallMotion<Geometry>> m_motion; //!< Motion of the walls (optional)
 
     //! Validate the system with the streaming geometry
     void validate();
 
+    //! Sum the collision statistics across all ranks
+    void reduceCollisionStatistics();
+
+    //! Move the walls to the next streaming step
+    void moveWalls(uint64_t timestep);
+
     //! Check that particles lie inside the geometry
     virtual bool validateParticles();
+
+    private:
+    //! Validate the geometry again on the next streaming step
+    void requestValidate()
+        {
+        m_validate_geom = true;
+        }
     };
 
 /*!
@@ -110,56 +220,139 @@ template<class Geometry> void ConfinedStreamingMethod<Geometry>::stream(uint64_t
 
     const BoxDim box = m_cl->getCoverageBox();
 
-    ArrayHandle<Scalar4> h_pos(m_mpcd_pdata->getPositions(),
-                               access_location::host,
-                               access_mode::readwrite);
-    ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(),
-                               access_location::host,
-                               access_mode::readwrite);
+    ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::host,
+                                      access_mode::readwrite);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::readwrite);
     const Scalar mass = m_mpcd_pdata->getMass();
 
     // acquire polymorphic pointer to the external field
     const mpcd::ExternalField* field = (m_field) ? m_field->get(access_location::host) : nullptr;
 
-    for (unsigned int cur_p = 0; cur_p < m_mpcd_pdata->getN(); ++cur_p)
+    // statistics are only passed to the geometry if requested
+    m_collision_stats = mpcd::detail::CollisionStatistics();
+    mpcd::detail::CollisionStatistics* stats = (m_track_collisions) ? &m_collision_stats : nullptr;
+
+    // rigid bodies that the particles are reflected from
+    std::unique_ptr<ArrayHandle<mpcd::detail::RigidBodyState>> h_bodies;
+    std::unique_ptr<ArrayHandle<Scalar3>> h_impulse;
+    std::unique_ptr<ArrayHandle<Scalar3>> h_angular_impulse;
+    mpcd::detail::RigidBodyObstacles bodies;
+    if (m_bodies)
         {
-        const Scalar4 postype = h_pos.data[cur_p];
-        Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
-        const unsigned int type = __scalar_as_int(postype.w);
+        m_bodies->beginStreaming();
+        h_bodies.reset(new ArrayHandle<mpcd::detail::RigidBodyState>(m_bodies->getBodies(),
+                                                                     access_location::host,
+                                                                     access_mode::read));
+        h_impulse.reset(new ArrayHandle<Scalar3>(m_bodies->getImpulses(),
+                                                 access_location::host,
+                                                 access_mode::readwrite));
+        h_angular_impulse.reset(new ArrayHandle<Scalar3>(m_bodies->getAngularImpulses(),
+                                                         access_location::host,
+                                                         access_mode::readwrite));
+        bodies = m_bodies->getObstacles(h_bodies->data);
+        }
 
-        const Scalar4 vel_cell = h_vel.data[cur_p];
-        Scalar3 vel = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
-        // estimate next velocity based on current acceleration
-        if (field)
+    // each particle streams independently, so ranges of particles can be streamed on separate
+    // threads with the same result as the serial loop. the counters are integers, so they can be
+    // summed from the ranges in any order.
+    auto stream_range
+        = [&](unsigned int begin, unsigned int end, mpcd::detail::CollisionStatistics& local_stats)
+    {
+        mpcd::detail::CollisionStatistics* range_stats = (stats) ? &local_stats : nullptr;
+        for (unsigned int cur_p = begin; cur_p < end; ++cur_p)
             {
-            vel += Scalar(0.5) * m_mpcd_dt * field->evaluate(pos) / mass;
-            }
+            const SolventScalar4 postype = h_pos.data[cur_p];
+            Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+            const unsigned int type = __solvent_scalar_as_int(postype.w);
 
-        // propagate the particle to its new position ballistically
-        Scalar dt_remain = m_mpcd_dt;
-        bool collide = true;
-        do
-            {
-            pos += dt_remain * vel;
-            collide = m_geom->detectCollision(pos, vel, dt_remain);
-            } while (dt_remain > 0 && collide);
-        // finalize velocity update
-        if (field)
-            {
-            vel += Scalar(0.5) * m_mpcd_dt * field->evaluate(pos) / mass;
-            }
+            const SolventScalar4 vel_cell = h_vel.data[cur_p];
+            Scalar3 vel = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
+            // estimate next velocity based on current acceleration
+            if (field)
+                {
+                vel += Scalar(0.5) * m_mpcd_dt * field->evaluate(pos) / mass;
+                }
+
+            // propagate the particle to its new position ballistically
+            Scalar dt_remain = m_mpcd_dt;
+            bool collide = true;
+            unsigned int num_collisions = 0;
+            do
+                {
+                pos += dt_remain * vel;
+                collide = m_geom->detectCollision(pos, vel, dt_remain, range_stats);
+                num_collisions += collide;
+                if (!collide && bodies.N > 0)
+                    {
+                    unsigned int body;
+                    Scalar3 r, dv;
+                    collide = bodies.detectCollision(pos, vel, dt_remain, body, r, dv);
+                    if (collide)
+                        {
+                        // the body gains the momentum that the particle loses
+                        const vec3<Scalar> dp = -mass * vec3<Scalar>(dv);
+                        h_impulse->data[body] += vec_to_scalar3(dp);
+                        h_angular_impulse->data[body]
+                            += vec_to_scalar3(cross(vec3<Scalar>(r), dp));
+                        }
+                    }
+                } while (dt_remain > 0 && collide);
+            if (range_stats)
+                {
+                range_stats->collisions += num_collisions;
+                range_stats->multiple += (num_collisions > 1);
+                }
+            // finalize velocity update
+            if (field)
+                {
+                vel += Scalar(0.5) * m_mpcd_dt * field->evaluate(pos) / mass;
+                }
 
-        // wrap and update the position
-        int3 image = make_int3(0, 0, 0);
-        box.wrap(pos, image);
+            // wrap and update the position
+            int3 image = make_int3(0, 0, 0);
+            box.wrap(pos, image);
 
-        h_pos.data[cur_p] = make_scalar4(pos.x, pos.y, pos.z, __int_as_scalar(type));
-        h_vel.data[cur_p]
-            = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
+            h_pos.data[cur_p]
+                = make_solvent_scalar4(pos.x, pos.y, pos.z, __int_as_solvent_scalar(type));
+            h_vel.data[cur_p]
+                = make_solvent_scalar4(vel.x,
+                                       vel.y,
+                                       vel.z,
+                                       __int_as_solvent_scalar(mpcd::detail::NO_CELL));
+            }
+    };
+
+    // collisions with rigid bodies add to the impulses of the bodies in the order of the particles
+    mpcd::detail::CollisionStatistics stream_stats;
+    if (bodies.N > 0)
+        {
+        stream_range(0, m_mpcd_pdata->getN(), stream_stats);
+        }
+    else
+        {
+        // each thread counts collisions into its own statistics, which are summed once at the end
+        stream_stats = hoomd::detail::parallelAccumulate(*m_exec_conf,
+                                                         m_mpcd_pdata->getN(),
+                                                         mpcd::detail::CollisionStatistics(),
+                                                         stream_range);
+        }
+    if (stats)
+        {
+        *stats = *stats + stream_stats;
         }
 
     // particles have moved, so the cell cache is no longer valid
     m_mpcd_pdata->invalidateCellCache();
+
+    if (m_track_collisions)
+        {
+        reduceCollisionStatistics();
+        }
+
+    moveWalls(timestep);
     }
 
 template<class Geometry> void ConfinedStreamingMethod<Geometry>::validate()
@@ -190,22 +383,43 @@ template<class Geometry> void ConfinedStreamingMethod<Geometry>::validate()
         throw std::runtime_error("Invalid MPCD particle configuration for confined geometry");
     }
 
+/*!
+ * \param timestep Current time that was streamed
+ *
+ * The walls are moved to the timestep when this streaming step ends, and the box is checked
+ * against the geometry because the walls may have grown.
+ */
+template<class Geometry> void ConfinedStreamingMethod<Geometry>::moveWalls(uint64_t timestep)
+    {
+    if (!m_motion)
+        return;
+
+    m_motion->update(timestep + m_period, m_mpcd_dt);
+    if (!m_geom->validateBox(m_pdata->getGlobalBox(), m_cl->getCellSize()))
+        {
+        m_exec_conf->msg->error() << "ConfinedStreamingMethod: box too small for moving "
+                                  << Geometry::getName() << " geometry. Increase box size."
+                                  << std::endl;
+        throw std::runtime_error("Simulation box too small for confined streaming method");
+        }
+    }
+
 /*!
  * Checks each MPCD particle position to determine if it lies within the geometry. If any particle
  * is out of bounds, an error is raised.
  */
 template<class Geometry> bool ConfinedStreamingMethod<Geometry>::validateParticles()
     {
-    ArrayHandle<Scalar4> h_pos(m_mpcd_pdata->getPositions(),
-                               access_location::host,
-                               access_mode::read);
+    ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::host,
+                                      access_mode::read);
     ArrayHandle<unsigned int> h_tag(m_mpcd_pdata->getTags(),
                                     access_location::host,
                                     access_mode::read);
 
     for (unsigned int idx = 0; idx < m_mpcd_pdata->getN(); ++idx)
         {
-        const Scalar4 postype = h_pos.data[idx];
+        const SolventScalar4 postype = h_pos.data[idx];
         const Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
         if (m_geom->isOutside(pos))
             {
@@ -220,6 +434,34 @@ template<class Geometry> bool ConfinedStreamingMethod<Geometry>::validateParticl
     return true;
     }
 
+/*!
+ * The statistics in \a m_collision_stats are summed in place across all ranks.
+ */
+template<class Geometry> void ConfinedStreamingMethod<Geometry>::reduceCollisionStatistics()
+    {
+#ifdef ENABLE_MPI
+    if (m_exec_conf->getNRanks() > 1)
+        {
+        unsigned int counts[5] = {m_collision_stats.collisions,
+                                  m_collision_stats.multiple,
+                                  m_collision_stats.iterations,
+                                  m_collision_stats.fallbacks,
+                                  m_collision_stats.unconverged};
+        MPI_Allreduce(MPI_IN_PLACE,
+                      counts,
+                      5,
+                      MPI_UNSIGNED,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        m_collision_stats.collisions = counts[0];
+        m_collision_stats.multiple = counts[1];
+        m_collision_stats.iterations = counts[2];
+        m_collision_stats.fallbacks = counts[3];
+        m_collision_stats.unconverged = counts[4];
+        }
+#endif // ENABLE_MPI
+    }
+
 namespace detail
     {
 //! Export mpcd::StreamingMethod to python
@@ -239,7 +481,18 @@ template<class Geometry> void export_ConfinedStreamingMethod(pybind11::module& m
                             std::shared_ptr<const Geometry>>())
         .def_property("geometry",
                       &mpcd::ConfinedStreamingMethod<Geometry>::getGeometry,
-                      &mpcd::ConfinedStreamingMethod<Geometry>::setGeometry);
+                      &mpcd::ConfinedStreamingMethod<Geometry>::setGeometry)
+        .def_property("track_collisions",
+                      &mpcd::ConfinedStreamingMethod<Geometry>::getTrackCollisions,
+                      &mpcd::ConfinedStreamingMethod<Geometry>::setTrackCollisions)
+        .def_property("rigid_bodies",
+                      &mpcd::ConfinedStreamingMethod<Geometry>::getRigidBodyCoupling,
+                      &mpcd::ConfinedStreamingMethod<Geometry>::setRigidBodyCoupling)
+        .def_property("wall_motion",
+                      &mpcd::ConfinedStreamingMethod<Geometry>::getWallMotion,
+                      &mpcd::ConfinedStreamingMethod<Geometry>::setWallMotion)
+        .def_property_readonly("collision_statistics",
+                               &mpcd::ConfinedStreamingMethod<Geometry>::getCollisionStatistics);
     }
     } // end namespace detail
     } // end namespace mpcd
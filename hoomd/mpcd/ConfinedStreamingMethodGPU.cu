@@ -11,6 +11,8 @@
  * ExternalFields.cu.
  */
 
+#include <hipcub/hipcub.hpp>
+
 #include "ConfinedStreamingMethodGPU.cuh"
 #include "StreamingGeometry.h"
 
@@ -23,6 +25,32 @@ namespace mpcd
     {
 namespace gpu
     {
+/*!
+ * \param d_reduced Collision statistics summed over all particles (output on second call)
+ * \param d_tmp Temporary storage for reduction (output on first call)
+ * \param tmp_bytes Number of bytes allocated for temporary storage (output on first call)
+ * \param d_stats Collision statistics per particle
+ * \param N Number of particles
+ *
+ * \returns cudaSuccess on completion
+ *
+ * \b Implementation details:
+ * CUB DeviceReduce is used to perform the reduction. Hence, this function requires
+ * two calls to perform the reduction. The first call sizes the temporary storage,
+ * which is returned in \a d_tmp and \a tmp_bytes. The caller must then allocate
+ * the required bytes, and call the function a second time. This performs the
+ * reduction and returns the result in \a d_reduced.
+ */
+cudaError_t reduce_collision_statistics(mpcd::detail::CollisionStatistics* d_reduced,
+                                        void* d_tmp,
+                                        size_t& tmp_bytes,
+                                        const mpcd::detail::CollisionStatistics* d_stats,
+                                        const unsigned int N)
+    {
+    cub::DeviceReduce::Sum(d_tmp, tmp_bytes, d_stats, d_reduced, N);
+    return cudaSuccess;
+    }
+
 //! Template instantiation of bulk geometry streaming
 template cudaError_t __attribute__((visibility("default")))
 confined_stream<mpcd::detail::BulkGeometry>(const stream_args_t& args,
@@ -33,11 +61,31 @@ template cudaError_t __attribute__((visibility("default")))
 confined_stream<mpcd::detail::SlitGeometry>(const stream_args_t& args,
                                             const mpcd::detail::SlitGeometry& geom);
 
-//! Template instantiation of slit geometry streaming
+//! Template instantiation of slit pore geometry streaming
 template cudaError_t
 confined_stream<mpcd::detail::SlitPoreGeometry>(const stream_args_t& args,
                                                 const mpcd::detail::SlitPoreGeometry& geom);
 
+//! Template instantiation of cosine channel geometry streaming
+template cudaError_t
+confined_stream<mpcd::detail::CosineChannel>(const stream_args_t& args,
+                                             const mpcd::detail::CosineChannel& geom);
+
+//! Template instantiation of cosine expansion-contraction geometry streaming
+template cudaError_t confined_stream<mpcd::detail::CosineExpansionContraction>(
+    const stream_args_t& args,
+    const mpcd::detail::CosineExpansionContraction& geom);
+
+//! Template instantiation of signed distance field geometry streaming
+template cudaError_t
+confined_stream<mpcd::detail::SDFGeometry>(const stream_args_t& args,
+                                           const mpcd::detail::SDFGeometry& geom);
+
+//! Template instantiation of cosine channel with a pore geometry streaming
+template cudaError_t
+confined_stream<mpcd::detail::CosineChannelPore>(const stream_args_t& args,
+                                                 const mpcd::detail::CosineChannelPore& geom);
+
     } // end namespace gpu
     } // end namespace mpcd
     } // end namespace hoomd
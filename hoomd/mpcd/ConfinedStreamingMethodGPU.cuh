@@ -9,8 +9,12 @@
  * \brief Declaration of CUDA kernels for mpcd::ConfinedStreamingMethodGPU
  */
 
+#include "BulkGeometry.h"
+#include "CellThermoComputeGPU.cuh"
+#include "CollisionStatistics.h"
 #include "ExternalField.h"
 #include "ParticleDataUtilities.h"
+#include "RigidBodyObstacles.h"
 #include "hoomd/BoxDim.h"
 #include "hoomd/HOOMDMath.h"
 
@@ -24,33 +28,58 @@ namespace gpu
 struct stream_args_t
     {
     //! Constructor
-    stream_args_t(Scalar4* _d_pos,
-                  Scalar4* _d_vel,
+    stream_args_t(SolventScalar4* _d_pos,
+                  SolventScalar4* _d_vel,
                   const Scalar _mass,
                   const mpcd::ExternalField* _field,
+                  const mpcd::ExternalField* _host_field,
                   const BoxDim& _box,
                   const Scalar _dt,
                   const unsigned int _N,
-                  const unsigned int _block_size)
-        : d_pos(_d_pos), d_vel(_d_vel), mass(_mass), field(_field), box(_box), dt(_dt), N(_N),
-          block_size(_block_size)
+                  const unsigned int _block_size,
+                  mpcd::detail::CollisionStatistics* _d_stats = nullptr,
+                  const mpcd::detail::cell_accumulate_args_t* _accumulate = nullptr,
+                  const mpcd::detail::RigidBodyObstacles& _bodies
+                  = mpcd::detail::RigidBodyObstacles(),
+                  Scalar3* _d_impulse = nullptr,
+                  Scalar3* _d_angular_impulse = nullptr)
+        : d_pos(_d_pos), d_vel(_d_vel), mass(_mass), field(_field), host_field(_host_field),
+          box(_box), dt(_dt), N(_N),
+          block_size(_block_size), d_stats(_d_stats), accumulate(_accumulate), bodies(_bodies),
+          d_impulse(_d_impulse), d_angular_impulse(_d_angular_impulse)
         {
         }
 
-    Scalar4* d_pos;                   //!< Particle positions
-    Scalar4* d_vel;                   //!< Particle velocities
-    const Scalar mass;                //!< Particle mass
-    const mpcd::ExternalField* field; //!< Applied external field on particles
-    const BoxDim box;                 //!< Simulation box
-    const Scalar dt;                  //!< Timestep
-    const unsigned int N;             //!< Number of particles
-    const unsigned int block_size;    //!< Number of threads per block
+    SolventScalar4* d_pos;                      //!< Particle positions
+    SolventScalar4* d_vel;                      //!< Particle velocities
+    const Scalar mass;                          //!< Particle mass
+    const mpcd::ExternalField* field;           //!< Applied external field on particles
+    const mpcd::ExternalField* host_field;      //!< Host copy of the field, to select its type
+    const BoxDim box;                           //!< Simulation box
+    const Scalar dt;                            //!< Timestep
+    const unsigned int N;                       //!< Number of particles
+    const unsigned int block_size;              //!< Number of threads per block
+    mpcd::detail::CollisionStatistics* d_stats; //!< Collision statistics per particle (optional)
+
+    //! Parameters to accumulate the particles into cells (optional)
+    const mpcd::detail::cell_accumulate_args_t* accumulate;
+
+    const mpcd::detail::RigidBodyObstacles bodies; //!< Rigid bodies to reflect from (optional)
+    Scalar3* d_impulse;                            //!< Momentum transferred to the bodies
+    Scalar3* d_angular_impulse;                    //!< Angular momentum transferred to the bodies
     };
 
 //! Kernel driver to stream particles ballistically
 template<class Geometry>
 cudaError_t confined_stream(const stream_args_t& args, const Geometry& geom);
 
+//! Kernel driver to sum the collision statistics of all particles
+cudaError_t reduce_collision_statistics(mpcd::detail::CollisionStatistics* d_reduced,
+                                        void* d_tmp,
+                                        size_t& tmp_bytes,
+                                        const mpcd::detail::CollisionStatistics* d_stats,
+                                        const unsigned int N);
+
 #ifdef __HIPCC__
 namespace kernel
     {
@@ -61,11 +90,20 @@ namespace kernel
  * \param mass Particle mass
  * \param box Simulation box
  * \param dt Timestep to stream
- * \param field Applied external field
+ * \param field Evaluator for the applied external field
  * \param N Number of particles
  * \param geom Confined geometry
+ * \param d_stats Collision statistics per particle (output)
+ * \param accumulate_args Parameters to accumulate the particles into cells
+ * \param bodies Rigid bodies to reflect the particles from
+ * \param d_impulse Momentum transferred to the bodies
+ * \param d_angular_impulse Angular momentum transferred to the bodies
  *
  * \tparam Geometry type of the confined geometry \a geom
+ * \tparam Field type of the evaluator for the external field
+ * \tparam track_collisions If true, record the collision statistics of each particle
+ * \tparam accumulate If true, bin the particles and accumulate their cell properties
+ * \tparam need_energy If true, also accumulate the kinetic energy of the cells
  *
  * \b Implementation
  * Using one thread per particle, the particle position and velocity is loaded.
@@ -77,85 +115,382 @@ namespace kernel
  * \f]
  * Particles crossing a periodic global boundary are wrapped back into the simulation box.
  * Particles are appropriately reflected from the boundaries defined by \a geom during the
- * position update step. The particle positions and velocities are updated accordingly.
+ * position update step. The particle positions and velocities are updated accordingly. The
+ * statistics are written per particle (rather than accumulated with atomics) when \a
+ * track_collisions is true, and are otherwise compiled out. The external field is evaluated by
+ * value through \a Field so that built-in forces are inlined rather than called virtually.
+ *
+ * When \a accumulate is true, the streamed particle is also binned into the cells of the next
+ * collision, and its properties are added to its cell by
+ * mpcd::gpu::kernel::accumulate_cell_particle. This saves reading the particles again to build
+ * the cell list and compute the cell properties. The cell of the particle is stashed into its
+ * velocity. Otherwise, the particle is marked as not being in a cell.
+ *
+ * Particles that are not reflected by \a geom are checked against the rigid \a bodies, and the
+ * momentum exchanged with a body is added to it with atomics. The loop over the bodies is empty if
+ * no rigid bodies are coupled.
  */
-template<class Geometry>
-__global__ void confined_stream(Scalar4* d_pos,
-                                Scalar4* d_vel,
+template<class Geometry, class Field, bool track_collisions, bool accumulate, bool need_energy>
+__global__ void confined_stream(SolventScalar4* d_pos,
+                                SolventScalar4* d_vel,
                                 const Scalar mass,
-                                const mpcd::ExternalField* field,
+                                const Field field,
                                 const BoxDim box,
                                 const Scalar dt,
                                 const unsigned int N,
-                                const Geometry geom)
+                                const Geometry geom,
+                                mpcd::detail::CollisionStatistics* d_stats,
+                                const mpcd::detail::cell_accumulate_args_t accumulate_args,
+                                const mpcd::detail::RigidBodyObstacles bodies,
+                                Scalar3* d_impulse,
+                                Scalar3* d_angular_impulse)
     {
     // one thread per particle
     unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
     if (idx >= N)
         return;
 
-    const Scalar4 postype = d_pos[idx];
+    const SolventScalar4 postype = d_pos[idx];
     Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
-    const unsigned int type = __scalar_as_int(postype.w);
+    const unsigned int type = __solvent_scalar_as_int(postype.w);
 
-    const Scalar4 vel_cell = d_vel[idx];
+    const SolventScalar4 vel_cell = d_vel[idx];
     Scalar3 vel = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
     // estimate next velocity based on current acceleration
-    if (field)
+    if (field.hasField())
         {
-        vel += Scalar(0.5) * dt * field->evaluate(pos) / mass;
+        vel += Scalar(0.5) * dt * field.evaluate(pos) / mass;
         }
 
     // propagate the particle to its new position ballistically
     Scalar dt_remain = dt;
     bool collide = true;
+    mpcd::detail::CollisionStatistics stats;
+    unsigned int num_collisions = 0;
     do
         {
         pos += dt_remain * vel;
-        collide = geom.detectCollision(pos, vel, dt_remain);
+        collide = geom.detectCollision(pos, vel, dt_remain, (track_collisions) ? &stats : nullptr);
+        num_collisions += collide;
+        if (!collide && bodies.N > 0)
+            {
+            unsigned int body;
+            Scalar3 r, dv;
+            collide = bodies.detectCollision(pos, vel, dt_remain, body, r, dv);
+            if (collide)
+                {
+                // the body gains the momentum that the particle loses
+                const vec3<Scalar> dp = -mass * vec3<Scalar>(dv);
+                const vec3<Scalar> dL = cross(vec3<Scalar>(r), dp);
+                atomicAdd(&d_impulse[body].x, dp.x);
+                atomicAdd(&d_impulse[body].y, dp.y);
+                atomicAdd(&d_impulse[body].z, dp.z);
+                atomicAdd(&d_angular_impulse[body].x, dL.x);
+                atomicAdd(&d_angular_impulse[body].y, dL.y);
+                atomicAdd(&d_angular_impulse[body].z, dL.z);
+                }
+            }
         } while (dt_remain > 0 && collide);
+    if (track_collisions)
+        {
+        stats.collisions = num_collisions;
+        stats.multiple = (num_collisions > 1);
+        d_stats[idx] = stats;
+        }
     // finalize velocity update
-    if (field)
+    if (field.hasField())
         {
-        vel += Scalar(0.5) * dt * field->evaluate(pos) / mass;
+        vel += Scalar(0.5) * dt * field.evaluate(pos) / mass;
         }
 
     // wrap and update the position
     int3 image = make_int3(0, 0, 0);
     box.wrap(pos, image);
 
-    d_pos[idx] = make_scalar4(pos.x, pos.y, pos.z, __int_as_scalar(type));
-    d_vel[idx] = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
+    // optionally accumulate the particle into its cell for the next collision
+    unsigned int cell = mpcd::detail::NO_CELL;
+    if (accumulate)
+        {
+        cell = accumulate_cell_particle<need_energy>(pos, vel, accumulate_args);
+        }
+
+    d_pos[idx] = make_solvent_scalar4(pos.x, pos.y, pos.z, __int_as_solvent_scalar(type));
+    d_vel[idx] = make_solvent_scalar4(vel.x, vel.y, vel.z, __int_as_solvent_scalar(cell));
+    }
+
+//! Kernel to stream particles ballistically in bulk without a field
+/*!
+ * \param d_pos Particle positions
+ * \param d_vel Particle velocities
+ * \param box Simulation box
+ * \param dt Timestep to stream
+ * \param N Number of particles
+ * \param accumulate_args Parameters to accumulate the particles into cells
+ *
+ * \param accumulate If true, bin the particles and accumulate their cell properties
+ * \param need_energy If true, also accumulate the kinetic energy of the cells
+ *
+ * \b Implementation
+ * This is mpcd::gpu::kernel::confined_stream with no walls, field, or rigid bodies, so there is
+ * no collision loop. Using one thread per particle, the position is advanced by \f$v \Delta t\f$
+ * and wrapped back into the simulation box once. The velocity only changes by the cell that is
+ * stashed into it.
+ */
+template<bool accumulate, bool need_energy>
+__global__ void bulk_stream(SolventScalar4* d_pos,
+                            SolventScalar4* d_vel,
+                            const BoxDim box,
+                            const Scalar dt,
+                            const unsigned int N,
+                            const mpcd::detail::cell_accumulate_args_t accumulate_args)
+    {
+    // one thread per particle
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    const SolventScalar4 postype = d_pos[idx];
+    SolventScalar4 vel_cell = d_vel[idx];
+    const Scalar3 vel = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
+    Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z) + dt * vel;
+
+    int3 image = make_int3(0, 0, 0);
+    box.wrap(pos, image);
+
+    unsigned int cell = mpcd::detail::NO_CELL;
+    if (accumulate)
+        {
+        cell = accumulate_cell_particle<need_energy>(pos, vel, accumulate_args);
+        }
+    vel_cell.w = __int_as_solvent_scalar(cell);
+
+    d_pos[idx] = make_solvent_scalar4(pos.x, pos.y, pos.z, postype.w);
+    d_vel[idx] = vel_cell;
     }
 
     } // end namespace kernel
 
+//! Launch the kernel to stream particles ballistically
 /*!
  * \param args Common arguments for a streaming kernel
  * \param geom Confined geometry
+ * \param field Evaluator for the external field
  *
  * \tparam Geometry type of the confined geometry \a geom
+ * \tparam Field type of the evaluator for the external field
+ * \tparam track_collisions If true, record the collision statistics of each particle
+ * \tparam accumulate If true, bin the particles and accumulate their cell properties
+ * \tparam need_energy If true, also accumulate the kinetic energy of the cells
+ */
+template<class Geometry, class Field, bool track_collisions, bool accumulate, bool need_energy>
+inline void
+launch_confined_stream(const stream_args_t& args, const Geometry& geom, const Field& field)
+    {
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(
+        &attr,
+        (const void*)
+            kernel::confined_stream<Geometry, Field, track_collisions, accumulate, need_energy>);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(args.block_size, max_block_size);
+    dim3 grid(args.N / run_block_size + 1);
+    mpcd::gpu::kernel::confined_stream<Geometry, Field, track_collisions, accumulate, need_energy>
+        <<<grid, run_block_size>>>(args.d_pos,
+                                   args.d_vel,
+                                   args.mass,
+                                   field,
+                                   args.box,
+                                   args.dt,
+                                   args.N,
+                                   geom,
+                                   args.d_stats,
+                                   (accumulate) ? *args.accumulate
+                                                : mpcd::detail::cell_accumulate_args_t(),
+                                   args.bodies,
+                                   args.d_impulse,
+                                   args.d_angular_impulse);
+    }
+
+//! Launch the kernel to stream particles ballistically in bulk without a field
+/*!
+ * \param args Common arguments for a streaming kernel
  *
- * \sa mpcd::gpu::kernel::confined_stream
+ * \tparam accumulate If true, bin the particles and accumulate their cell properties
+ * \tparam need_energy If true, also accumulate the kinetic energy of the cells
  */
-template<class Geometry>
-cudaError_t confined_stream(const stream_args_t& args, const Geometry& geom)
+template<bool accumulate, bool need_energy>
+inline void launch_bulk_stream(const stream_args_t& args)
     {
     unsigned int max_block_size;
     cudaFuncAttributes attr;
-    cudaFuncGetAttributes(&attr, (const void*)mpcd::gpu::kernel::confined_stream<Geometry>);
+    cudaFuncGetAttributes(&attr, (const void*)kernel::bulk_stream<accumulate, need_energy>);
     max_block_size = attr.maxThreadsPerBlock;
 
     unsigned int run_block_size = min(args.block_size, max_block_size);
     dim3 grid(args.N / run_block_size + 1);
-    mpcd::gpu::kernel::confined_stream<Geometry><<<grid, run_block_size>>>(args.d_pos,
-                                                                           args.d_vel,
-                                                                           args.mass,
-                                                                           args.field,
-                                                                           args.box,
-                                                                           args.dt,
-                                                                           args.N,
-                                                                           geom);
+    mpcd::gpu::kernel::bulk_stream<accumulate, need_energy><<<grid, run_block_size>>>(
+        args.d_pos,
+        args.d_vel,
+        args.box,
+        args.dt,
+        args.N,
+        (accumulate) ? *args.accumulate : mpcd::detail::cell_accumulate_args_t());
+    }
+
+//! Stream particles with a kernel specialized to the geometry, if there is one
+/*!
+ * \param args Common arguments for a streaming kernel
+ * \param geom Confined geometry
+ *
+ * \returns True if the particles were streamed
+ *
+ * \tparam Geometry type of the confined geometry \a geom
+ *
+ * Most geometries do not have a specialized kernel, so nothing is done.
+ */
+template<class Geometry>
+inline bool dispatch_specialized_stream(const stream_args_t& args, const Geometry& geom)
+    {
+    return false;
+    }
+
+//! Stream particles in bulk with the specialized kernel, if possible
+/*!
+ * \param args Common arguments for a streaming kernel
+ * \param geom Bulk geometry
+ *
+ * \returns True if the particles were streamed
+ *
+ * The particles are streamed by mpcd::gpu::kernel::bulk_stream when there is no field, no rigid
+ * bodies, and no collision statistics to track.
+ */
+inline bool dispatch_specialized_stream(const stream_args_t& args,
+                                        const mpcd::detail::BulkGeometry& geom)
+    {
+    if (args.host_field || args.d_stats || args.bodies.N > 0)
+        return false;
+
+    if (!args.accumulate)
+        {
+        launch_bulk_stream<false, false>(args);
+        }
+    else if (args.accumulate->need_energy)
+        {
+        launch_bulk_stream<true, true>(args);
+        }
+    else
+        {
+        launch_bulk_stream<true, false>(args);
+        }
+    return true;
+    }
+
+//! Launch the kernel to stream particles ballistically with the requested cell accumulation
+/*!
+ * \param args Common arguments for a streaming kernel
+ * \param geom Confined geometry
+ * \param field Evaluator for the external field
+ *
+ * \tparam Geometry type of the confined geometry \a geom
+ * \tparam Field type of the evaluator for the external field
+ * \tparam track_collisions If true, record the collision statistics of each particle
+ */
+template<class Geometry, class Field, bool track_collisions>
+inline void
+dispatch_confined_stream(const stream_args_t& args, const Geometry& geom, const Field& field)
+    {
+    if (!args.accumulate)
+        {
+        launch_confined_stream<Geometry, Field, track_collisions, false, false>(args, geom, field);
+        }
+    else if (args.accumulate->need_energy)
+        {
+        launch_confined_stream<Geometry, Field, track_collisions, true, true>(args, geom, field);
+        }
+    else
+        {
+        launch_confined_stream<Geometry, Field, track_collisions, true, false>(args, geom, field);
+        }
+    }
+
+//! Launch the kernel to stream particles ballistically with the evaluator for the field
+/*!
+ * \param args Common arguments for a streaming kernel
+ * \param geom Confined geometry
+ *
+ * \tparam Geometry type of the confined geometry \a geom
+ * \tparam track_collisions If true, record the collision statistics of each particle
+ *
+ * The fields implemented in HOOMD are passed to the kernel by value as their evaluator, which is
+ * found from the type of \a args.host_field, so that the force can be inlined. Any other field
+ * (or no field) is called through the polymorphic device pointer \a args.field.
+ */
+template<class Geometry, bool track_collisions>
+inline void dispatch_confined_stream_field(const stream_args_t& args, const Geometry& geom)
+    {
+    if (auto constant = dynamic_cast<const mpcd::ConstantForce*>(args.host_field))
+        {
+        dispatch_confined_stream<Geometry, mpcd::detail::ConstantForceEvaluator, track_collisions>(
+            args,
+            geom,
+            constant->getEvaluator());
+        }
+    else if (auto block = dynamic_cast<const mpcd::BlockForce*>(args.host_field))
+        {
+        dispatch_confined_stream<Geometry, mpcd::detail::BlockForceEvaluator, track_collisions>(
+            args,
+            geom,
+            block->getEvaluator());
+        }
+    else if (auto sine = dynamic_cast<const mpcd::SineForce*>(args.host_field))
+        {
+        dispatch_confined_stream<Geometry, mpcd::detail::SineForceEvaluator, track_collisions>(
+            args,
+            geom,
+            sine->getEvaluator());
+        }
+    else
+        {
+        dispatch_confined_stream<Geometry,
+                                 mpcd::detail::PolymorphicFieldEvaluator,
+                                 track_collisions>(
+            args,
+            geom,
+            mpcd::detail::PolymorphicFieldEvaluator(args.field));
+        }
+    }
+
+/*!
+ * \param args Common arguments for a streaming kernel
+ * \param geom Confined geometry
+ *
+ * \tparam Geometry type of the confined geometry \a geom
+ *
+ * The kernel specialized to the geometry is used if possible, and otherwise the general kernel is
+ * used.
+ *
+ * \sa mpcd::gpu::dispatch_specialized_stream
+ * \sa mpcd::gpu::dispatch_confined_stream_field
+ * \sa mpcd::gpu::kernel::confined_stream
+ */
+template<class Geometry>
+cudaError_t confined_stream(const stream_args_t& args, const Geometry& geom)
+    {
+    if (dispatch_specialized_stream(args, geom))
+        {
+        return cudaSuccess;
+        }
+
+    if (args.d_stats)
+        {
+        dispatch_confined_stream_field<Geometry, true>(args, geom);
+        }
+    else
+        {
+        dispatch_confined_stream_field<Geometry, false>(args, geom);
+        }
 
     return cudaSuccess;
     }
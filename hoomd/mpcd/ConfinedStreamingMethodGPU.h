@@ -13,9 +13,13 @@
 #error This header cannot be compiled by nvcc
 #endif
 
+#include "CellThermoComputeGPU.h"
 #include "ConfinedStreamingMethod.h"
 #include "ConfinedStreamingMethodGPU.cuh"
 #include "hoomd/Autotuner.h"
+#include "hoomd/CachedAllocator.h"
+#include "hoomd/GPUFlags.h"
+#include "hoomd/GPUVector.h"
 
 namespace hoomd
     {
@@ -43,7 +47,8 @@ class PYBIND11_EXPORT ConfinedStreamingMethodGPU : public mpcd::ConfinedStreamin
                                unsigned int period,
                                int phase,
                                std::shared_ptr<const Geometry> geom)
-        : mpcd::ConfinedStreamingMethod<Geometry>(sysdef, cur_timestep, period, phase, geom)
+        : mpcd::ConfinedStreamingMethod<Geometry>(sysdef, cur_timestep, period, phase, geom),
+          m_tmp_stats(this->m_exec_conf), m_reduced_stats(this->m_exec_conf)
         {
         m_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
                                        this->m_exec_conf,
@@ -54,8 +59,21 @@ class PYBIND11_EXPORT ConfinedStreamingMethodGPU : public mpcd::ConfinedStreamin
     //! Implementation of the streaming rule
     virtual void stream(uint64_t timestep);
 
+    //! Stream the particles and accumulate their cell properties for the next collision
+    virtual bool streamFused(uint64_t timestep, std::shared_ptr<mpcd::CellThermoCompute> thermo);
+
     protected:
     std::shared_ptr<Autotuner<1>> m_tuner;
+
+    GPUVector<mpcd::detail::CollisionStatistics>
+        m_tmp_stats; //!< Temporary array for holding per-particle statistics
+    GPUFlags<mpcd::detail::CollisionStatistics> m_reduced_stats; //!< Flags to hold reduced sum
+
+    //! Sum the collision statistics of all particles
+    void sumCollisionStatistics();
+
+    //! Stream the particles, optionally accumulating their cell properties
+    void streamParticles(mpcd::CellThermoComputeGPU* thermo);
     };
 
 /*!
@@ -66,6 +84,41 @@ template<class Geometry> void ConfinedStreamingMethodGPU<Geometry>::stream(uint6
     if (!this->shouldStream(timestep))
         return;
 
+    streamParticles(nullptr);
+    this->moveWalls(timestep);
+    }
+
+/*!
+ * \param timestep Current time to stream
+ * \param thermo Cell thermo compute to accumulate into
+ * \returns True if the particles were streamed
+ *
+ * The particles are binned into the cells of the collision that occurs when this streaming step
+ * ends, so the cell list of \a thermo must already have the grid shift of that collision. The
+ * particles are only streamed if \a thermo supports accumulating on the GPU.
+ */
+template<class Geometry>
+bool ConfinedStreamingMethodGPU<Geometry>::streamFused(
+    uint64_t timestep,
+    std::shared_ptr<mpcd::CellThermoCompute> thermo)
+    {
+    auto thermo_gpu = std::dynamic_pointer_cast<mpcd::CellThermoComputeGPU>(thermo);
+    if (!thermo_gpu || !this->shouldStream(timestep))
+        return false;
+
+    thermo_gpu->beginFusedCompute();
+    streamParticles(thermo_gpu.get());
+    thermo_gpu->endFusedCompute(timestep + this->m_period);
+    this->moveWalls(timestep);
+    return true;
+    }
+
+/*!
+ * \param thermo Cell thermo compute to accumulate into, or null to only stream the particles
+ */
+template<class Geometry>
+void ConfinedStreamingMethodGPU<Geometry>::streamParticles(mpcd::CellThermoComputeGPU* thermo)
+    {
     // the validation step currently proceeds on the cpu because it is done infrequently.
     // if it becomes a performance concern, it can be ported to the gpu
     if (this->m_validate_geom)
@@ -74,30 +127,137 @@ template<class Geometry> void ConfinedStreamingMethodGPU<Geometry>::stream(uint6
         this->m_validate_geom = false;
         }
 
-    ArrayHandle<Scalar4> d_pos(this->m_mpcd_pdata->getPositions(),
-                               access_location::device,
-                               access_mode::readwrite);
-    ArrayHandle<Scalar4> d_vel(this->m_mpcd_pdata->getVelocities(),
-                               access_location::device,
-                               access_mode::readwrite);
-    mpcd::gpu::stream_args_t args(d_pos.data,
-                                  d_vel.data,
-                                  this->m_mpcd_pdata->getMass(),
-                                  (this->m_field) ? this->m_field->get(access_location::device)
-                                                  : nullptr,
-                                  this->m_cl->getCoverageBox(),
-                                  this->m_mpcd_dt,
-                                  this->m_mpcd_pdata->getN(),
-                                  m_tuner->getParam()[0]);
-
-    m_tuner->begin();
-    mpcd::gpu::confined_stream<Geometry>(args, *(this->m_geom));
-    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
-        CHECK_CUDA_ERROR();
-    m_tuner->end();
+    const unsigned int N = this->m_mpcd_pdata->getN();
+    if (this->m_track_collisions)
+        {
+        m_tmp_stats.resize(N);
+        }
+
+        {
+        ArrayHandle<SolventScalar4> d_pos(this->m_mpcd_pdata->getPositions(),
+                                          access_location::device,
+                                          access_mode::readwrite);
+        ArrayHandle<SolventScalar4> d_vel(this->m_mpcd_pdata->getVelocities(),
+                                          access_location::device,
+                                          access_mode::readwrite);
+        ArrayHandle<mpcd::detail::CollisionStatistics> d_stats(m_tmp_stats,
+                                                              access_location::device,
+                                                              access_mode::overwrite);
+
+        // cell properties to accumulate into
+        std::unique_ptr<ArrayHandle<double4>> d_cell_vel;
+        std::unique_ptr<ArrayHandle<double3>> d_cell_energy;
+        std::unique_ptr<mpcd::detail::cell_accumulate_args_t> accumulate;
+        if (thermo)
+            {
+            d_cell_vel.reset(new ArrayHandle<double4>(thermo->getCellVelocities(),
+                                                      access_location::device,
+                                                      access_mode::readwrite));
+            d_cell_energy.reset(new ArrayHandle<double3>(thermo->getCellEnergies(),
+                                                         access_location::device,
+                                                         access_mode::readwrite));
+            accumulate.reset(new mpcd::detail::cell_accumulate_args_t(
+                thermo->getAccumulateArgs(d_cell_vel->data, d_cell_energy->data)));
+            }
+
+        // rigid bodies to reflect from
+        std::unique_ptr<ArrayHandle<mpcd::detail::RigidBodyState>> d_bodies;
+        std::unique_ptr<ArrayHandle<Scalar3>> d_impulse;
+        std::unique_ptr<ArrayHandle<Scalar3>> d_angular_impulse;
+        mpcd::detail::RigidBodyObstacles bodies;
+        if (this->m_bodies)
+            {
+            this->m_bodies->beginStreaming();
+            d_bodies.reset(
+                new ArrayHandle<mpcd::detail::RigidBodyState>(this->m_bodies->getBodies(),
+                                                              access_location::device,
+                                                              access_mode::read));
+            d_impulse.reset(new ArrayHandle<Scalar3>(this->m_bodies->getImpulses(),
+                                                     access_location::device,
+                                                     access_mode::readwrite));
+            d_angular_impulse.reset(new ArrayHandle<Scalar3>(this->m_bodies->getAngularImpulses(),
+                                                             access_location::device,
+                                                             access_mode::readwrite));
+            bodies = this->m_bodies->getObstacles(d_bodies->data);
+            }
+
+        mpcd::gpu::stream_args_t args(d_pos.data,
+                                      d_vel.data,
+                                      this->m_mpcd_pdata->getMass(),
+                                      (this->m_field) ? this->m_field->get(access_location::device)
+                                                      : nullptr,
+                                      (this->m_field) ? this->m_field->get(access_location::host)
+                                                      : nullptr,
+                                      this->m_cl->getCoverageBox(),
+                                      this->m_mpcd_dt,
+                                      N,
+                                      m_tuner->getParam()[0],
+                                      (this->m_track_collisions) ? d_stats.data : nullptr,
+                                      accumulate.get(),
+                                      bodies,
+                                      (d_impulse) ? d_impulse->data : nullptr,
+                                      (d_angular_impulse) ? d_angular_impulse->data : nullptr);
+
+        m_tuner->begin();
+        mpcd::gpu::confined_stream<Geometry>(args, *(this->m_geom));
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner->end();
+        }
 
     // particles have moved, so the cell cache is no longer valid
     this->m_mpcd_pdata->invalidateCellCache();
+
+    if (this->m_track_collisions)
+        {
+        sumCollisionStatistics();
+        this->reduceCollisionStatistics();
+        }
+    }
+
+/*!
+ * The per-particle statistics are summed on the GPU by hipcub, and the result is copied into
+ * \a m_collision_stats.
+ */
+template<class Geometry> void ConfinedStreamingMethodGPU<Geometry>::sumCollisionStatistics()
+    {
+    const unsigned int N = this->m_mpcd_pdata->getN();
+    if (N == 0)
+        {
+        this->m_collision_stats = mpcd::detail::CollisionStatistics();
+        return;
+        }
+
+        {
+        ArrayHandle<mpcd::detail::CollisionStatistics> d_stats(m_tmp_stats,
+                                                              access_location::device,
+                                                              access_mode::read);
+
+        // use cub to reduce the statistics on the gpu
+        void* d_tmp = NULL;
+        size_t tmp_bytes = 0;
+        mpcd::gpu::reduce_collision_statistics(m_reduced_stats.getDeviceFlags(),
+                                               d_tmp,
+                                               tmp_bytes,
+                                               d_stats.data,
+                                               N);
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+
+        ScopedAllocation<unsigned char> d_tmp_alloc(this->m_exec_conf->getCachedAllocator(),
+                                                    (tmp_bytes > 0) ? tmp_bytes : 1);
+        d_tmp = (void*)d_tmp_alloc();
+
+        mpcd::gpu::reduce_collision_statistics(m_reduced_stats.getDeviceFlags(),
+                                               d_tmp,
+                                               tmp_bytes,
+                                               d_stats.data,
+                                               N);
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+    this->m_collision_stats = m_reduced_stats.readFlags();
     }
 
 namespace detail
@@ -1,7 +1,6 @@
 // Copyright (c) 2018-2020, Michael P. Howard
 // Copyright (c) 2021-2022, Auburn University
-
-// Maintainer: astatt
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 /*!
  * \file mpcd/CosineChannelFiller.cc
@@ -9,112 +8,251 @@
  */
 
 #include "CosineChannelFiller.h"
+#include "hoomd/RNGIdentifiers.h"
 #include "hoomd/RandomNumbers.h"
-#include "RNGIdentifiers.h"
+
+#include <algorithm>
+#include <cmath>
 
 namespace hoomd
-{
-CosineChannelFiller::CosineChannelFiller(std::shared_ptr<mpcd::SystemDefinition> sysdef,
-                                                 Scalar density,
-                                                 unsigned int type,
-                                                 std::shared_ptr<::Variant> T,
-                                                 unsigned int seed,
-                                                 std::shared_ptr<const detail::CosineChannel> geom)
-    : mpcd::ManualVirtualParticleFiller(sysdata, density, type, T, seed), m_geom(geom)
+    {
+mpcd::CosineChannelFiller::CosineChannelFiller(
+    std::shared_ptr<SystemDefinition> sysdef,
+    Scalar density,
+    unsigned int type,
+    std::shared_ptr<Variant> T,
+    std::shared_ptr<const mpcd::detail::CosineChannel> geom)
+    : mpcd::VirtualParticleFiller(sysdef, density, type, T), m_geom(geom), m_motion_version(0),
+      m_thickness_lo(0), m_thickness_hi(0), m_N_lo(0), m_N_hi(0)
     {
     m_exec_conf->msg->notice(5) << "Constructing MPCD CosineChannelFiller" << std::endl;
+
+    // unphysical values in cache to always force recompute
+    m_needs_recompute = true;
+    m_recompute_cache = make_scalar2(-1, -1);
+    m_pdata->getBoxChangeSignal()
+        .connect<mpcd::CosineChannelFiller, &mpcd::CosineChannelFiller::notifyRecompute>(this);
     }
 
-CosineChannelFiller::~CosineChannelFiller()
+mpcd::CosineChannelFiller::~CosineChannelFiller()
     {
     m_exec_conf->msg->notice(5) << "Destroying MPCD CosineChannelFiller" << std::endl;
+    m_pdata->getBoxChangeSignal()
+        .disconnect<mpcd::CosineChannelFiller, &mpcd::CosineChannelFiller::notifyRecompute>(this);
     }
 
-void CosineChannelFiller::computeNumFill()
+void mpcd::CosineChannelFiller::computeNumFill()
     {
+    const Scalar cell_size = m_cl->getCellSize();
+
+    // check if fill-relevant variables have changed (can't use signal because cell list build may
+    // not have triggered yet)
+    m_needs_recompute |= (m_recompute_cache.x != cell_size || m_recompute_cache.y != m_density);
+
+    // the fill volume follows the walls when they move
+    if (m_motion && m_motion->getVersion() != m_motion_version)
+        {
+        m_motion_version = m_motion->getVersion();
+        invalidateReservoir();
+        m_needs_recompute = true;
+        }
+
+    // only recompute if needed
+    if (!m_needs_recompute)
+        return;
+
     // as a precaution, validate the global box with the current cell list
     const BoxDim& global_box = m_pdata->getGlobalBox();
-    const Scalar cell_size = m_cl->getCellSize();
-    const Scalar max_shift = m_cl->getMaxGridShift();
     if (!m_geom->validateBox(global_box, cell_size))
         {
-        m_exec_conf->msg->error() << "Invalid cosine geometry for global box, cannot fill virtual particles." << std::endl;
-        m_exec_conf->msg->error() << "Filler thickness is given by cell_size +  0.5*A*sin((cell_size+max_shift)*2*pi*p/L); " << std::endl;
-        throw std::runtime_error("Invalid AntiSymCos geometry for global box");
+        m_exec_conf->msg->error()
+            << "Invalid cosine channel geometry for global box, cannot fill virtual particles."
+            << std::endl;
+        throw std::runtime_error("Invalid cosine channel geometry for global box");
         }
 
-    // default is not to fill anything
-    m_thickness = 0;
-    m_N_fill = 0;
-    m_pi_period_div_L = 0;
-    m_Amplitude = 0;
-    m_H_narrow = 0;
-
-    // box and sine geometry
+    // box and cosine geometry
     const BoxDim& box = m_pdata->getBox();
     const Scalar3 L = box.getL();
-    const Scalar Area = L.x * L.y;
+    const Scalar3 lo = box.getLo();
+    const Scalar3 hi = box.getHi();
     const Scalar A = m_geom->getAmplitude();
-    const Scalar h = m_geom->getHnarrow();
-    const Scalar r = m_geom->getRepetitions();
-    m_Amplitude=A;
-    m_pi_period_div_L = 2*M_PI*r/L.x;
-    m_H_narrow = h;
-
-    /* This geometry needs a larger filler thickness than just a single cell_size because of its curved bounds.
-     * Each cell along the wall boundary must be filled such that a cell shifted with max_shift is still entirely covered.
-     * At the top/bottom this is straightforward, so cell_size+max_shift should be enough (max_shift = 0.5*cell_size).
-     * At the steepest point of the sine (i.e., around the zero crossing), we actually need more thickness, such that the
-     * diagonal of cell_size+max_shift fits into the filler area. The equation below comes from calculating the minimum
-     * shift necessary to fit the diagonal of a by max_shift shifted cell at the narrowest point.
-     * It will fail when A=0 (but then the slit geometry should be used anyway). This creates a filler that is at least
-     * cell_size+max_shift wide everywhere.
+    const Scalar h = m_geom->getH();
+    const Scalar k = m_geom->getWavenumber();
+
+    /*
+     * The volume of each layer is integrated along x with the midpoint rule, using enough points
+     * to resolve the kinks in the local thickness where a crest or trough enters the search
+     * interval. The local thickness changes by at most 2*|A|*k per unit length, so padding the
+     * largest sampled thickness by this over half a sample spacing bounds the true largest
+     * thickness for rejection sampling.
      */
-    m_thickness = cell_size +  m_Amplitude*fast::sin((cell_size+max_shift)*m_pi_period_div_L);
-    m_N_fill = 2*m_density*Area*m_thickness;
+    const unsigned int num_samples = 128 * std::max(1u, (unsigned int)std::ceil(L.x / cell_size));
+    const Scalar dx = L.x / num_samples;
+    Scalar sum_lo(0), sum_hi(0), max_lo(0), max_hi(0);
+    for (unsigned int i = 0; i < num_samples; ++i)
+        {
+        const Scalar x = lo.x + (i + Scalar(0.5)) * dx;
+        const Scalar wall = m_geom->getCosine(x);
+        Scalar wall_min, wall_max;
+        m_geom->getCosineRange(x, cell_size, wall_min, wall_max);
+
+        const Scalar t_lo = cell_size + wall - wall_min;
+        const Scalar t_hi = cell_size + wall_max - wall;
+        sum_lo += t_lo;
+        sum_hi += t_hi;
+        max_lo = std::max(max_lo, t_lo);
+        max_hi = std::max(max_hi, t_hi);
+        }
+    const Scalar pad = std::abs(A) * k * dx;
+    m_thickness_lo = max_lo + pad;
+    m_thickness_hi = max_hi + pad;
+
+    // default is not to fill anything
+    m_N_hi = m_N_lo = 0;
+
+    /*
+     * The layer above the channel spans z from -A+h to A+h+cell_size, and the layer below is its
+     * mirror image. Each layer is filled if it is fully contained in the local domain along z. It
+     * is an error for the layers to extend outside the global box, or for the domain boundaries to
+     * cut through a layer.
+     */
+    const Scalar layer_lo = -A + h;
+    const Scalar layer_hi = A + h + cell_size;
+    if (layer_hi > global_box.getHi().z || -layer_hi < global_box.getLo().z)
+        {
+        m_exec_conf->msg->error() << "Virtual particle layer of thickness " << cell_size
+                                  << " does not fit in the global box. Increase box size in z."
+                                  << std::endl;
+        throw std::runtime_error("Simulation box too small for cosine channel filler");
+        }
+    if (lo.z <= layer_lo && hi.z >= layer_hi)
+        {
+        m_N_hi = (unsigned int)std::round(L.y * sum_hi * dx * m_density);
+        }
+    else if (hi.z > layer_lo && lo.z < layer_hi)
+        {
+        m_exec_conf->msg->error() << "Domain decomposition cannot cut through cosine channel "
+                                     "virtual particle layer."
+                                  << std::endl;
+        throw std::runtime_error("Invalid domain decomposition for cosine channel filler");
+        }
+
+    if (lo.z <= -layer_hi && hi.z >= -layer_lo)
+        {
+        m_N_lo = (unsigned int)std::round(L.y * sum_lo * dx * m_density);
+        }
+    else if (hi.z > -layer_hi && lo.z < -layer_lo)
+        {
+        m_exec_conf->msg->error() << "Domain decomposition cannot cut through cosine channel "
+                                     "virtual particle layer."
+                                  << std::endl;
+        throw std::runtime_error("Invalid domain decomposition for cosine channel filler");
+        }
+
+    // total number of fill particles
+    m_N_fill = m_N_hi + m_N_lo;
+
+    // size is now updated, cache the parameters used
+    m_needs_recompute = false;
+    m_recompute_cache = make_scalar2(cell_size, m_density);
     }
 
 /*!
  * \param timestep Current timestep to draw particles
  */
-void CosineChannelFiller::drawParticles(unsigned int timestep)
+void mpcd::CosineChannelFiller::drawParticles(uint64_t timestep)
     {
-    ArrayHandle<Scalar4> h_pos(m_mpcd_pdata->getPositions(), access_location::host, access_mode::readwrite);
-    ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(), access_location::host, access_mode::readwrite);
-    ArrayHandle<unsigned int> h_tag(m_mpcd_pdata->getTags(), access_location::host, access_mode::readwrite);
+    ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::host,
+                                      access_mode::readwrite);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::readwrite);
+    ArrayHandle<unsigned int> h_tag(m_mpcd_pdata->getTags(),
+                                    access_location::host,
+                                    access_mode::readwrite);
 
     const BoxDim& box = m_pdata->getBox();
-    Scalar3 lo = box.getLo();
-    Scalar3 hi = box.getHi();
-    const unsigned int N_half = m_N_fill/2;
-    const Scalar vel_factor = fast::sqrt(m_T->getValue(timestep) / m_mpcd_pdata->getMass());
+    const Scalar3 lo = box.getLo();
+    const Scalar3 hi = box.getHi();
+    const Scalar h = m_geom->getH();
+    const Scalar cell_size = m_cl->getCellSize();
+
+    const Scalar vel_factor = fast::sqrt((*m_T)(timestep) / m_mpcd_pdata->getMass());
+
+    // the particles are binned into the cell list while they are drawn if it is ready
+    const bool bin = canBinParticles();
+    const uint3 n_global_cells = bin ? m_cl->getNumGlobalCells() : make_uint3(0, 0, 0);
+    const Scalar3 global_lo = m_pdata->getGlobalBox().getLo();
+    const uchar3 periodic = box.getPeriodic();
+
+    uint16_t seed = m_sysdef->getSeed();
+
+    // most particles draw 3 positions and 2 pairs of velocities
+    const hoomd::Seed rng_seed(hoomd::RNGIdentifier::CosineChannelFiller, timestep, seed);
+    hoomd::RandomGeneratorBatch<5> rng_batch;
 
     // index to start filling from
     const unsigned int first_idx = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual() - m_N_fill;
-    for (unsigned int i=0; i < m_N_fill; ++i)
+    for (unsigned int i = 0; i < m_N_fill; ++i)
         {
         const unsigned int tag = m_first_tag + i;
-        hoomd::RandomGenerator rng(RNGIdentifier::CosineChannelFiller, m_seed, tag, timestep);
-        signed char sign = (i >= N_half) - (i < N_half); // bottom -1 or top +1
 
-        Scalar x = hoomd::UniformDistribution<Scalar>(lo.x, hi.x)(rng);
-        Scalar y = hoomd::UniformDistribution<Scalar>(lo.y, hi.y)(rng);
-        Scalar z = hoomd::UniformDistribution<Scalar>(0, sign*m_thickness)(rng);
-        z += m_Amplitude*fast::cos(x*m_pi_period_div_L)+sign*m_H_narrow;
+        // the streams of the next particles are drawn together
+        const unsigned int lane = i % rng_batch.width;
+        if (lane == 0)
+            {
+            for (unsigned int j = 0; j < rng_batch.width; ++j)
+                {
+                rng_batch.setStream(j, rng_seed, hoomd::Counter(tag + j));
+                }
+            rng_batch.generate();
+            }
+        auto rng = rng_batch.getGenerator(lane);
+        const signed char sign = (char)((i >= m_N_lo) - (i < m_N_lo));
+        const Scalar max_thickness = (sign < 0) ? m_thickness_lo : m_thickness_hi;
+
+        // draw uniformly in x and the largest layer, then reject points outside the local layer
+        Scalar x, dz, thickness;
+        unsigned int attempt = 0;
+        do
+            {
+            x = hoomd::UniformDistribution<Scalar>(lo.x, hi.x)(rng);
+            dz = hoomd::UniformDistribution<Scalar>(0, max_thickness)(rng);
+
+            const Scalar wall = m_geom->getCosine(x);
+            Scalar wall_min, wall_max;
+            m_geom->getCosineRange(x, cell_size, wall_min, wall_max);
+            thickness = cell_size + ((sign < 0) ? wall - wall_min : wall_max - wall);
+            } while (dz > thickness && ++attempt < MAX_ATTEMPTS);
+        if (dz > thickness)
+            dz *= thickness / max_thickness;
+
+        const Scalar y = hoomd::UniformDistribution<Scalar>(lo.y, hi.y)(rng);
+        const Scalar z = m_geom->getCosine(x) + sign * (h + dz);
 
         const unsigned int pidx = first_idx + i;
-        h_pos.data[pidx] = make_scalar4(x, y, z, __int_as_scalar(m_type));
+        h_pos.data[pidx] = make_solvent_scalar4(x, y, z, __int_as_solvent_scalar(m_type));
 
         hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
         Scalar3 vel;
         gen(vel.x, vel.y, rng);
         vel.z = gen(rng);
-        h_vel.data[pidx] = make_scalar4(vel.x,
-                                        vel.y,
-                                        vel.z,
-                                        __int_as_scalar(mpcd::detail::NO_CELL));
+        vel += m_geom->getWallVelocity(x);
+
+        unsigned int cell = mpcd::detail::NO_CELL;
+        if (bin
+            && !m_cl->binParticle(cell, make_scalar3(x, y, z), n_global_cells, global_lo, periodic))
+            {
+            cell = mpcd::detail::NO_CELL;
+            }
+        h_vel.data[pidx] = make_solvent_scalar4(vel.x, vel.y, vel.z, __int_as_solvent_scalar(cell));
         h_tag.data[pidx] = tag;
         }
+
+    if (bin)
+        m_cl->validateVirtualCells();
     }
 
 /*!
@@ -122,20 +260,16 @@ void CosineChannelFiller::drawParticles(unsigned int timestep)
  */
 void mpcd::detail::export_CosineChannelFiller(pybind11::module& m)
     {
-    pybind11::class_<mpcd::CosineChannelFiller, 
+    pybind11::class_<mpcd::CosineChannelFiller,
                      mpcd::VirtualParticleFiller,
-                     std::shared_ptr<mpcd::CosineChannelGeometryFiller>>(
-        m,
-        "CosineChannelGeometryFiller")
-        .def(pybind11::init<std::shared_ptr<mpcd::SystemDefinition>,
-             Scalar,
-             unsigned int,
-             std::shared_ptr<::Variant>,
-             unsigned int,
-             std::shared_ptr<const mpcd::SinusoidalChannel>>())
-        .def_property_readonly("geometry", &mpcd::CosineChannelFiller::getGeometry);
+                     std::shared_ptr<mpcd::CosineChannelFiller>>(m, "CosineChannelFiller")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            Scalar,
+                            unsigned int,
+                            std::shared_ptr<Variant>,
+                            std::shared_ptr<const mpcd::detail::CosineChannel>>())
+        .def("setGeometry", &mpcd::CosineChannelFiller::setGeometry)
+        .def("setWallMotion", &mpcd::CosineChannelFiller::setWallMotion);
     }
 
-}
-
-} // end namespace hoomd
+    } // end namespace hoomd
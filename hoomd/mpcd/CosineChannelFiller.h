@@ -1,10 +1,9 @@
 // Copyright (c) 2018-2020, Michael P. Howard
 // Copyright (c) 2021-2022, Auburn University
-
-// Maintainer: astatt
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 /*!
- * \file CosineChannelFiller.h
+ * \file mpcd/CosineChannelFiller.h
  * \brief Definition of virtual particle filler for mpcd::detail::CosineChannel.
  */
 
@@ -17,56 +16,108 @@
 
 #include "CosineChannelGeometry.h"
 #include "VirtualParticleFiller.h"
-#include "SystemDefinition.h"
-#include "/pybind11/pybind11.h"
+#include "WallMotion.h"
+
+#include <pybind11/pybind11.h>
 
 namespace hoomd
-{
+    {
 namespace mpcd
-{
-
-//! Adds virtual particles to the MPCD particle data for SinusoidalChannel
+    {
+//! Adds virtual particles to the MPCD particle data for CosineChannel
 /*!
- * Particles are added to the volume that is overlapped by any of the cells that are also "inside" the channel,
- * subject to the grid shift.
+ * Particles are added to a layer outside each cosine wall. Any point in a cell is within one cell
+ * size of every other point in the same cell along each direction, regardless of the grid shift.
+ * A point outside the upper wall therefore needs to be filled only if it is less than one cell
+ * size above the highest point of the wall within one cell size along x. The local thickness of
+ * the layer is the distance from the wall to this height, and it is thicker where the wall is
+ * steep than at its crests and troughs. The lower layer is defined in the same way.
+ *
+ * The volume of each layer in the local domain is integrated numerically unless the box, cell
+ * size, geometry, or density change. Particles are drawn uniformly in the layer by rejection
+ * sampling against the largest local thickness. If no point is accepted after MAX_ATTEMPTS, the
+ * last point is scaled into the layer instead.
+ *
+ * The walls can be moved by an mpcd::WallMotion shared with the streaming method. The fill volume
+ * is then recomputed each time the walls move, and the virtual particles are drawn with the local
+ * velocity of the wall as their mean velocity.
  */
-class PYBIND11_EXPORT CosineChannelFiller : public mpcd::ManualVirtualParticleFiller
+class PYBIND11_EXPORT CosineChannelFiller : public mpcd::VirtualParticleFiller
     {
     public:
-        CosineChannelFiller(std::shared_ptr<mpcd::SystemDefinition> sysdef,
-                                Scalar density,
-                                unsigned int type,
-                                std::shared_ptr<::Variant> T,
-                                unsigned int seed,
-                                std::shared_ptr<const mpcd::CosineChannel> geom);
+    CosineChannelFiller(std::shared_ptr<SystemDefinition> sysdef,
+                        Scalar density,
+                        unsigned int type,
+                        std::shared_ptr<Variant> T,
+                        std::shared_ptr<const mpcd::detail::CosineChannel> geom);
+
+    virtual ~CosineChannelFiller();
 
-        virtual ~CosineChannelFiller();
+    void setGeometry(std::shared_ptr<const mpcd::detail::CosineChannel> geom)
+        {
+        m_geom = geom;
+        invalidateReservoir();
+        notifyRecompute();
+        }
 
-        void setGeometry(std::shared_ptr<const mpcd::CosineChannelGeometry> geom)
+    //! Set the motion of the walls
+    /*!
+     * \param motion Motion of the walls, or null to stop following them
+     */
+    void setWallMotion(std::shared_ptr<mpcd::WallMotion<mpcd::detail::CosineChannel>> motion)
+        {
+        m_motion = motion;
+        if (m_motion)
             {
-            m_geom = geom;
+            m_geom = m_motion->getGeometry();
+            m_motion_version = m_motion->getVersion();
             }
+        invalidateReservoir();
+        notifyRecompute();
+        }
+
+    //! Maximum number of rejection sampling attempts per particle
+    const static unsigned int MAX_ATTEMPTS = 256;
 
     protected:
-        std::shared_ptr<const detail::CosineChannel> m_geom;
-        Scalar m_thickness;       //!< thickness of virtual particle buffer zone
-        Scalar m_Amplitude;       //!< amplitude of  channel wall cosine: 0.5(H_wide - H_narrow)
-        Scalar m_pi_period_div_L; //!< period of channel wall cosine: 2*pi*period/Lx
-        Scalar m_H_narrow;        //!< half width of the narrowest height of the channel
+    std::shared_ptr<const mpcd::detail::CosineChannel> m_geom;
+    std::shared_ptr<mpcd::WallMotion<mpcd::detail::CosineChannel>> m_motion; //!< Wall motion
+    unsigned int m_motion_version; //!< Version of the walls the fill volume was computed for
+    Scalar m_thickness_lo; //!< Largest thickness of virtual particle layer below channel
+    Scalar m_thickness_hi; //!< Largest thickness of virtual particle layer above channel
+    unsigned int m_N_lo;   //!< Number of particles to fill below channel
+    unsigned int m_N_hi;   //!< Number of particles to fill above channel
+
+    //! Compute the total number of particles to fill
+    virtual void computeNumFill();
+
+    //! Draw particles within the fill volume
+    virtual void drawParticles(uint64_t timestep);
 
-        //! Compute the total number of particles to fill
-        virtual void computeNumFill();
+    //! Get the mean velocity of a virtual particle at a position
+    /*!
+     * \param pos Position of the virtual particle
+     * \returns Velocity of the wall surface at the same x as \a pos
+     */
+    virtual Scalar3 getMeanVelocity(const SolventScalar4& pos) const
+        {
+        return m_geom->getWallVelocity(pos.x);
+        }
 
-        //! Draw particles within the fill volume
-        virtual void drawParticles(unsigned int timestep);
+    private:
+    bool m_needs_recompute;
+    Scalar2 m_recompute_cache;
+    void notifyRecompute()
+        {
+        m_needs_recompute = true;
+        }
     };
 
 namespace detail
-{
+    {
 //! Export CosineChannelFiller to python
 void export_CosineChannelFiller(pybind11::module& m);
-} // end namespace detail
-} // end namespace mpcd
-} // end namespace hoomd
-
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
 #endif // MPCD_COSINE_CHANNEL_FILLER_H_
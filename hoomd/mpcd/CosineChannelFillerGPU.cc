@@ -1,9 +1,9 @@
 // Copyright (c) 2018-2020, Michael P. Howard
 // Copyright (c) 2021-2022, Auburn University
-
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 /*!
- * \file CosineChannelFillerGPU.cc
+ * \file mpcd/CosineChannelFillerGPU.cc
  * \brief Definition of mpcd::CosineChannelFillerGPU
  */
 
@@ -11,54 +11,61 @@
 #include "CosineChannelFillerGPU.cuh"
 
 namespace hoomd
-{
-
+    {
 mpcd::CosineChannelFillerGPU::CosineChannelFillerGPU(
-    std::shared_ptr<mpcd::SystemDefinition> sysdef,
-    conds std::string& type,
+    std::shared_ptr<SystemDefinition> sysdef,
     Scalar density,
+    unsigned int type,
     std::shared_ptr<Variant> T,
-    std::shared_ptr<consd mpcd::CosineChannelGeometry> geom)
-    : mpcd::CosineChannelFiller(sysdef,density,type,T,seed,geom)
+    std::shared_ptr<const mpcd::detail::CosineChannel> geom)
+    : mpcd::CosineChannelFiller(sysdef, density, type, T, geom)
     {
     m_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
-                                    m_exec_conf,
-                                    "mpcd_cosine_channel_filler"));
+                                   m_exec_conf,
+                                   "mpcd_cosine_channel_filler"));
     m_autotuners.push_back(m_tuner);
     }
 
 /*!
  * \param timestep Current timestep
  */
-void CosineChannelFillerGPU::drawParticles(uint64_t timestep)
+void mpcd::CosineChannelFillerGPU::drawParticles(uint64_t timestep)
     {
-    ArrayHandle<Scalar4> d_pos(m_mpcd_pdata->getPositions(), access_location::device, access_mode::readwrite);
-    ArrayHandle<Scalar4> d_vel(m_mpcd_pdata->getVelocities(), access_location::device, access_mode::readwrite);
-    ArrayHandle<unsigned int> d_tag(m_mpcd_pdata->getTags(), access_location::device, access_mode::readwrite);
+    ArrayHandle<SolventScalar4> d_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::device,
+                                      access_mode::readwrite);
+    ArrayHandle<SolventScalar4> d_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::device,
+                                      access_mode::readwrite);
+    ArrayHandle<unsigned int> d_tag(m_mpcd_pdata->getTags(),
+                                    access_location::device,
+                                    access_mode::readwrite);
+
+    const unsigned int first_idx = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual() - m_N_fill;
 
     uint16_t seed = m_sysdef->getSeed();
 
     m_tuner->begin();
-
     mpcd::gpu::cosine_channel_draw_particles(d_pos.data,
-                                     d_vel.data,
-                                     d_tag.data,
-                                     *m_geom,
-                                     m_pi_period_div_L,
-                                     m_Amplitude,
-                                     m_H_narrow,
-                                     m_thickness,
-                                     m_pdata->getBox(),
-                                     m_mpcd_pdata->getMass(),
-                                     m_type,
-                                     m_N_fill,
-                                     m_first_tag,
-                                     first_idx,
-                                     (*m_T)(timestep),
-                                     timestep,
-                                     m_seed,
-                                     m_tuner->getParam()[0]);
-    if (m_exec_conf->isCUDAErrorCheckingEnabled()) 
+                                             d_vel.data,
+                                             d_tag.data,
+                                             *m_geom,
+                                             m_cl->getCellSize(),
+                                             m_thickness_lo,
+                                             m_thickness_hi,
+                                             MAX_ATTEMPTS,
+                                             m_pdata->getBox(),
+                                             m_mpcd_pdata->getMass(),
+                                             m_type,
+                                             m_N_lo,
+                                             m_N_hi,
+                                             m_first_tag,
+                                             first_idx,
+                                             (*m_T)(timestep),
+                                             timestep,
+                                             seed,
+                                             m_tuner->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
     m_tuner->end();
     }
@@ -66,19 +73,16 @@ void CosineChannelFillerGPU::drawParticles(uint64_t timestep)
 /*!
  * \param m Python module to export to
  */
-void export_CosineChannelFillerGPU(pybind11::module& m)
+void mpcd::detail::export_CosineChannelFillerGPU(pybind11::module& m)
     {
-    pybind11::class_<mpcd::CosineChannelGeometryFillerGPU,
-                     mpcd::CosineChannelGeometryFiller
-                     std::shared_ptr<mpcd::CosineChannelGeometryFillerGPU>>(
-        m,
-        "CosineChannelGeometryFillerGPU"
-        .def(pybind11::init<std::shared_ptr<mpcd::SystemDefinition>,
-                            const std::string&,
+    pybind11::class_<mpcd::CosineChannelFillerGPU,
+                     mpcd::CosineChannelFiller,
+                     std::shared_ptr<mpcd::CosineChannelFillerGPU>>(m, "CosineChannelFillerGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
                             Scalar,
-                            std::shared_ptr<Variant>
-             std::shared_ptr<const mpcd::CosineChannel>>());
+                            unsigned int,
+                            std::shared_ptr<Variant>,
+                            std::shared_ptr<const mpcd::detail::CosineChannel>>());
     }
-}
 
-} // end namespace hoomd
+    } // end namespace hoomd
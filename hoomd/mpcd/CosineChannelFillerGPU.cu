@@ -1,74 +1,81 @@
 // Copyright (c) 2018-2020, Michael P. Howard
 // Copyright (c) 2021-2022, Auburn University
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 /*!
- * \file CosineChannelFillerGPU.cu
- * \brief Defines GPU functions and kernels used by mpcd::gpu::SinusoidalChannelFillerGPU
+ * \file mpcd/CosineChannelFillerGPU.cu
+ * \brief Defines GPU functions and kernels used by mpcd::CosineChannelFillerGPU
  */
 
 #include "CosineChannelFillerGPU.cuh"
+#include "ParticleDataUtilities.h"
+#include "hoomd/RNGIdentifiers.h"
 #include "hoomd/RandomNumbers.h"
-#include "RNGIdentifiers.h"
-#include "hoomd/mpcd/ParticleDataUtilities.h"
-
 
 namespace hoomd
-{
-
-namespace mpcd 
-{
-
+    {
+namespace mpcd
+    {
 namespace gpu
-{
-
+    {
 namespace kernel
-{
+    {
 /*!
  * \param d_pos Particle positions
  * \param d_vel Particle velocities
  * \param d_tag Particle tags
- * \param geom geometry to fill
- * \param m_pi_period_div_L
- * \param m_amplitude
+ * \param geom Cosine channel geometry to fill
+ * \param cell_size Size of MPCD cell
+ * \param thickness_lo Largest thickness of the fill layer below the channel
+ * \param thickness_hi Largest thickness of the fill layer above the channel
+ * \param max_attempts Maximum number of rejection sampling attempts per particle
  * \param box Local simulation box
  * \param type Type of fill particles
  * \param N_lo Number of particles to fill in lower region
- * \param N_hi Number of particles to fill in upper region
+ * \param N_tot Total number of particles to fill
  * \param first_tag First tag of filled particles
  * \param first_idx First (local) particle index of filled particles
- * \param vel_factor Scale factor for uniform normal velocities consistent with particle mass / temperature
+ * \param vel_factor Scale factor for uniform normal velocities consistent with particle mass /
+ * temperature
  * \param timestep Current timestep
  * \param seed User seed to PRNG for drawing velocities
  *
- * Using one thread per particle (in both slabs), the thread is assigned to fill either the lower
- * or upper region.  A random position is drawn within a cuboid, which is then shifted in z using the wall equation.
- * The thread index is translated into a particle tag and local particle index.
+ * \b Implementation:
  *
+ * Using one thread per particle (in both layers), the thread is assigned to fill either the lower
+ * or upper layer. The thread index is translated into a particle tag and local particle index. A
+ * random position is drawn in x and y within the local box, and the z position is drawn within the
+ * layer following the cosine wall at that x. Points outside the local thickness of the layer are
+ * rejected so that the particles are uniformly distributed in the layer. The thermal velocity is
+ * drawn around the velocity of the wall at that x.
  */
-__global__ void cosine_channel_draw_particles(Scalar4 *d_pos,
-                                            Scalar4 *d_vel,
-                                            unsigned int *d_tag,
-                                            const mpcd::detail::SinusoidalChannel geom,
-                                            const Scalar m_pi_period_div_L,
-                                            const Scalar m_amplitude,
-                                            const Scalar m_h,
-                                            const Scalar m_thickness,
-                                            const BoxDim box,
-                                            const unsigned int type,
-                                            const unsigned int N_fill,
-                                            const unsigned int first_tag,
-                                            const unsigned int first_idx,
-                                            const Scalar vel_factor,
-                                            const uint64_t timestep,
-                                            const uint16_t seed)
+__global__ void cosine_channel_draw_particles(SolventScalar4* d_pos,
+                                              SolventScalar4* d_vel,
+                                              unsigned int* d_tag,
+                                              const mpcd::detail::CosineChannel geom,
+                                              const Scalar cell_size,
+                                              const Scalar thickness_lo,
+                                              const Scalar thickness_hi,
+                                              const unsigned int max_attempts,
+                                              const BoxDim box,
+                                              const unsigned int type,
+                                              const unsigned int N_lo,
+                                              const unsigned int N_tot,
+                                              const unsigned int first_tag,
+                                              const unsigned int first_idx,
+                                              const Scalar vel_factor,
+                                              const uint64_t timestep,
+                                              const uint16_t seed)
     {
     // one thread per particle
     const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
-    if (idx >= N_fill)
+    if (idx >= N_tot)
         return;
-    Scalar3 lo = box.getLo();
-    Scalar3 hi = box.getHi();
-    const unsigned int N_half = N_fill/2;
+
+    // determine the fill region based on current index
+    const signed char sign = (idx >= N_lo) - (idx < N_lo);
+    const Scalar3 lo = box.getLo();
+    const Scalar3 hi = box.getHi();
 
     // particle tag and index
     const unsigned int tag = first_tag + idx;
@@ -76,35 +83,50 @@ __global__ void cosine_channel_draw_particles(Scalar4 *d_pos,
     d_tag[pidx] = tag;
 
     // initialize random number generator for positions and velocity
-    hoomd::RandomGenerator rng(RNGIdentifier::CosineChannelFiller, seed, tag, timestep);
-    signed char sign = (idx >= N_half) - (idx < N_half); // bottom -1 or top +1
+    hoomd::RandomGenerator rng(
+        hoomd::Seed(hoomd::RNGIdentifier::CosineChannelFiller, timestep, seed),
+        hoomd::Counter(tag));
+
+    // draw uniformly in x and the largest layer, then reject points outside the local layer
+    const Scalar max_thickness = (sign < 0) ? thickness_lo : thickness_hi;
+    Scalar x, dz, thickness;
+    unsigned int attempt = 0;
+    do
+        {
+        x = hoomd::UniformDistribution<Scalar>(lo.x, hi.x)(rng);
+        dz = hoomd::UniformDistribution<Scalar>(0, max_thickness)(rng);
 
-    Scalar x = hoomd::UniformDistribution<Scalar>(lo.x, hi.x)(rng);
-    Scalar y = hoomd::UniformDistribution<Scalar>(lo.y, hi.y)(rng);
-    Scalar z = hoomd::UniformDistribution<Scalar>(0, sign*m_thickness)(rng);
-    z += m_amplitude*fast::cos(x*m_pi_period_div_L)+ sign*m_h;
+        const Scalar wall = geom.getCosine(x);
+        Scalar wall_min, wall_max;
+        geom.getCosineRange(x, cell_size, wall_min, wall_max);
+        thickness = cell_size + ((sign < 0) ? wall - wall_min : wall_max - wall);
+        } while (dz > thickness && ++attempt < max_attempts);
+    if (dz > thickness)
+        dz *= thickness / max_thickness;
 
-    d_pos[pidx] = make_scalar4(x, y, z, __int_as_scalar(type));
+    const Scalar y = hoomd::UniformDistribution<Scalar>(lo.y, hi.y)(rng);
+    const Scalar z = geom.getCosine(x) + sign * (geom.getH() + dz);
+    d_pos[pidx] = make_solvent_scalar4(x, y, z, __int_as_solvent_scalar(type));
 
     hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
     Scalar3 vel;
     gen(vel.x, vel.y, rng);
     vel.z = gen(rng);
-
-    d_vel[pidx] = make_scalar4(vel.x,
-                               vel.y,
-                               vel.z,
-                               __int_as_scalar(mpcd::detail::NO_CELL));
+    vel += geom.getWallVelocity(x);
+    d_vel[pidx]
+        = make_solvent_scalar4(vel.x, vel.y, vel.z, __int_as_solvent_scalar(mpcd::detail::NO_CELL));
     }
-} // end namespace kernel
+    } // end namespace kernel
 
 /*!
  * \param d_pos Particle positions
  * \param d_vel Particle velocities
  * \param d_tag Particle tags
- * \param geom Slit geometry to fill
- * \param z_min Lower bound to lower fill region
- * \param z_max Upper bound to upper fill region
+ * \param geom Cosine channel geometry to fill
+ * \param cell_size Size of MPCD cell
+ * \param thickness_lo Largest thickness of the fill layer below the channel
+ * \param thickness_hi Largest thickness of the fill layer above the channel
+ * \param max_attempts Maximum number of rejection sampling attempts per particle
  * \param box Local simulation box
  * \param mass Mass of fill particles
  * \param type Type of fill particles
@@ -117,62 +139,63 @@ __global__ void cosine_channel_draw_particles(Scalar4 *d_pos,
  * \param seed User seed to PRNG for drawing velocities
  * \param block_size Number of threads per block
  *
- * \sa kernel::anti_sim_cos_draw_particles
+ * \sa kernel::cosine_channel_draw_particles
  */
-cudaError_t cosine_channel_draw_particles(Scalar4 *d_pos,
-                                        Scalar4 *d_vel,
-                                        unsigned int *d_tag,
-                                        const azplugins::detail::SinusoidalChannel& geom,
-                                        const Scalar m_pi_period_div_L,
-                                        const Scalar m_amplitude,
-                                        const Scalar m_h,
-                                        const Scalar m_thickness,
-                                        const BoxDim& box,
-                                        const Scalar mass,
-                                        const unsigned int type,
-                                        const unsigned int N_fill,
-                                        const unsigned int first_tag,
-                                        const unsigned int first_idx,
-                                        const Scalar kT,
-                                        const uint64_t timestep,
-                                        const uint16_t seed,
-                                        const unsigned int block_size)
+cudaError_t cosine_channel_draw_particles(SolventScalar4* d_pos,
+                                          SolventScalar4* d_vel,
+                                          unsigned int* d_tag,
+                                          const mpcd::detail::CosineChannel& geom,
+                                          const Scalar cell_size,
+                                          const Scalar thickness_lo,
+                                          const Scalar thickness_hi,
+                                          const unsigned int max_attempts,
+                                          const BoxDim& box,
+                                          const Scalar mass,
+                                          const unsigned int type,
+                                          const unsigned int N_lo,
+                                          const unsigned int N_hi,
+                                          const unsigned int first_tag,
+                                          const unsigned int first_idx,
+                                          const Scalar kT,
+                                          const uint64_t timestep,
+                                          const uint16_t seed,
+                                          const unsigned int block_size)
     {
-    if (N_fill == 0) return cudaSuccess;
+    const unsigned int N_tot = N_lo + N_hi;
+    if (N_tot == 0)
+        return cudaSuccess;
 
-    static unsigned int max_block_size = UINT_MAX;
-    if (max_block_size == UINT_MAX)
-        {
-        cudaFuncAttributes attr;
-        cudaFuncGetAttributes(&attr, (const void*)kernel::cosine_channel_draw_particles);
-        max_block_size = attr.maxThreadsPerBlock;
-        }
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)kernel::cosine_channel_draw_particles);
+    max_block_size = attr.maxThreadsPerBlock;
 
     // precompute factor for rescaling the velocities since it is the same for all particles
     const Scalar vel_factor = fast::sqrt(kT / mass);
 
     unsigned int run_block_size = min(block_size, max_block_size);
-    dim3 grid(N_fill / run_block_size + 1);
+    dim3 grid(N_tot / run_block_size + 1);
     kernel::cosine_channel_draw_particles<<<grid, run_block_size>>>(d_pos,
-                                                                  d_vel,
-                                                                  d_tag,
-                                                                  geom,
-                                                                  m_pi_period_div_L,
-                                                                  m_amplitude,
-                                                                  m_h,
-                                                                  m_thickness,
-                                                                  box,
-                                                                  type,
-                                                                  N_fill,
-                                                                  first_tag,
-                                                                  first_idx,
-                                                                  vel_factor,
-                                                                  timestep,
-                                                                  seed);
+                                                                    d_vel,
+                                                                    d_tag,
+                                                                    geom,
+                                                                    cell_size,
+                                                                    thickness_lo,
+                                                                    thickness_hi,
+                                                                    max_attempts,
+                                                                    box,
+                                                                    type,
+                                                                    N_lo,
+                                                                    N_tot,
+                                                                    first_tag,
+                                                                    first_idx,
+                                                                    vel_factor,
+                                                                    timestep,
+                                                                    seed);
 
     return cudaSuccess;
     }
 
-} // end namespace gpu
-} // end namespace mpcd
-} // end namespace hoomd
+    } // end namespace gpu
+    } // end namespace mpcd
+    } // end namespace hoomd
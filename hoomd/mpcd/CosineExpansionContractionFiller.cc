@@ -1,77 +1,127 @@
 // Copyright (c) 2018-2020, Michael P. Howard
 // Copyright (c) 2021-2022, Auburn University
-
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 /*!
  * \file mpcd/CosineExpansionContractionFiller.cc
- * \brief Definition of CosineExpansionContractionFiller
+ * \brief Definition of mpcd::CosineExpansionContractionFiller
  */
 
 #include "CosineExpansionContractionFiller.h"
+#include "hoomd/RNGIdentifiers.h"
 #include "hoomd/RandomNumbers.h"
-#include "RNGIdentifiers.h"
 
 namespace hoomd
-{
+    {
 mpcd::CosineExpansionContractionFiller::CosineExpansionContractionFiller(
-    std::shared_ptr<mpcd::SystemDefinition> sysdef,
+    std::shared_ptr<SystemDefinition> sysdef,
     Scalar density,
     unsigned int type,
-    std::shared_ptr<::Variant> T,
-    uint16_t seed,
-    std::shared_ptr<const detail::CosineExpansionContraction> geom)
-    : mpcd::VirtualParticleFiller(sysdef, density, type, T, seed), m_geom(geom)
+    std::shared_ptr<Variant> T,
+    std::shared_ptr<const mpcd::detail::CosineExpansionContraction> geom)
+    : mpcd::VirtualParticleFiller(sysdef, density, type, T), m_geom(geom), m_motion_version(0)
     {
-    m_exec_conf->msg->notice(5) << "Constructing MPCD CosineExpansionContractionFiller" << std::endl;
+    m_exec_conf->msg->notice(5) << "Constructing MPCD CosineExpansionContractionFiller"
+                                << std::endl;
     }
 
-CosineExpansionContractionFiller::~CosineExpansionContractionFiller()
+mpcd::CosineExpansionContractionFiller::~CosineExpansionContractionFiller()
     {
     m_exec_conf->msg->notice(5) << "Destroying MPCD CosineExpansionContractionFiller" << std::endl;
     }
 
-void CosineExpansionContractionFiller::computeNumFill()
+void mpcd::CosineExpansionContractionFiller::computeNumFill()
     {
+    // the saved positions cannot be reused once the walls move
+    if (m_motion && m_motion->getVersion() != m_motion_version)
+        {
+        m_motion_version = m_motion->getVersion();
+        invalidateReservoir();
+        }
+
     // as a precaution, validate the global box with the current cell list
     const BoxDim& global_box = m_pdata->getGlobalBox();
     const Scalar cell_size = m_cl->getCellSize();
-    const Scalar max_shift = m_cl->getMaxGridShift();
     if (!m_geom->validateBox(global_box, cell_size))
         {
-        m_exec_conf->msg->error() << "Invalid cosine geometry for global box, cannot fill virtual particles." << std::endl;
-        m_exec_conf->msg->error() << "Filler thickness is given by cell_size +  0.5*(H-h)*sin((cell_size+max_shift)*2*pi*p/L); " << std::endl;
-        throw std::runtime_error("Invalid SinsuodialExpansionConstriction geometry for global box");
+        m_exec_conf->msg->error()
+            << "Invalid cosine expansion-contraction geometry for global box, cannot fill virtual "
+               "particles."
+            << std::endl;
+        throw std::runtime_error("Invalid cosine expansion-contraction geometry for global box");
         }
 
-    // default is not to fill anything
-    m_thickness = 0;
-    m_N_fill = 0;
-    m_pi_period_div_L = 0;
-    m_amplitude = 0;
-
-    // box and sine geometry
+    // box and cosine geometry
     const BoxDim& box = m_pdata->getBox();
     const Scalar3 L = box.getL();
-    const Scalar Area = L.x * L.y;
+    const Scalar area = L.x * L.y;
     const Scalar H = m_geom->getHwide();
     const Scalar h = m_geom->getHnarrow();
-    const Scalar r = m_geom->getRepetitions();
-
-    m_amplitude = 0.5*(H-h);
-    m_pi_period_div_L = 2*M_PI*r/L.x;
-    m_H_narrow = h;
-
-    /* This geometry needs a larger filler thickness than just a single cell_size because of its curved bounds.
-     * Each cell along the wall boundary must be filled such that a cell shifted with max_shift is still entirely covered.
-     * At the top/bottom this is straightforward, so cell_size+max_shift should be enough (max_shift = 0.5*cell_size).
-     * At the steepest point of the sine (i.e., around the zero crossing), we actually need more thickness, such that the
-     * diagonal of cell_size+max_shift fits into the filler area. The equation below comes from calculating the minimum
-     * shift necessary to fit the diagonal of a by max_shift shifted cell at the narrowest point.
-     * It will fail when A=0 (but then the slit geometry should be used anyway). This creates a filler that is at least
-     * cell_size+max_shift wide everywhere.
+    const Scalar A = Scalar(0.5) * (H - h);
+    const Scalar k = m_geom->getWavenumber();
+
+    /*
+     * This geometry needs a larger filler thickness than just a single cell size because of its
+     * curved bounds. Each cell along the wall must be filled such that a cell shifted by the max
+     * shift is still entirely covered. At the top/bottom of the cosine, cell_size + max_shift is
+     * enough. At the steepest point of the cosine (around the zero crossing), we need more
+     * thickness so that the diagonal of a shifted cell fits into the filled layer. This creates a
+     * layer that is at least cell_size + max_shift wide everywhere.
      */
-    m_thickness = cell_size +  m_amplitude*fast::sin((cell_size+max_shift)*m_pi_period_div_L);
-    m_N_fill = 2*m_density*Area*m_thickness;
+    const Scalar max_shift = m_cl->getMaxGridShift();
+    m_thickness = cell_size + A * fast::sin((cell_size + max_shift) * k);
+
+    // default is not to fill anything
+    m_N_hi = m_N_lo = 0;
+
+    /*
+     * The layer has constant thickness in z, so its volume over the local domain is simply the
+     * cross-sectional area times the thickness. The layer above the channel spans z from h to
+     * H+thickness, and the layer below is its mirror image. Each layer is filled if it is fully
+     * contained in the local domain along z. It is an error for the layers to extend outside the
+     * global box, or for the domain boundaries to cut through a layer.
+     */
+    const Scalar3 lo = box.getLo();
+    const Scalar3 hi = box.getHi();
+    const Scalar layer_lo = h;
+    const Scalar layer_hi = H + m_thickness;
+    if (layer_hi > global_box.getHi().z || -layer_hi < global_box.getLo().z)
+        {
+        m_exec_conf->msg->error() << "Virtual particle layer of thickness " << m_thickness
+                                  << " does not fit in the global box. Increase box size in z."
+                                  << std::endl;
+        throw std::runtime_error(
+            "Simulation box too small for cosine expansion-contraction filler");
+        }
+    const unsigned int N_layer = (unsigned int)std::round(area * m_thickness * m_density);
+    if (lo.z <= layer_lo && hi.z >= layer_hi)
+        {
+        m_N_hi = N_layer;
+        }
+    else if (hi.z > layer_lo && lo.z < layer_hi)
+        {
+        m_exec_conf->msg->error() << "Domain decomposition cannot cut through cosine "
+                                     "expansion-contraction virtual particle layer."
+                                  << std::endl;
+        throw std::runtime_error(
+            "Invalid domain decomposition for cosine expansion-contraction filler");
+        }
+
+    if (lo.z <= -layer_hi && hi.z >= -layer_lo)
+        {
+        m_N_lo = N_layer;
+        }
+    else if (hi.z > -layer_hi && lo.z < -layer_lo)
+        {
+        m_exec_conf->msg->error() << "Domain decomposition cannot cut through cosine "
+                                     "expansion-contraction virtual particle layer."
+                                  << std::endl;
+        throw std::runtime_error(
+            "Invalid domain decomposition for cosine expansion-contraction filler");
+        }
+
+    // total number of fill particles
+    m_N_fill = m_N_hi + m_N_lo;
     }
 
 /*!
@@ -79,65 +129,88 @@ void CosineExpansionContractionFiller::computeNumFill()
  */
 void mpcd::CosineExpansionContractionFiller::drawParticles(uint64_t timestep)
     {
-    ArrayHandle<Scalar4> h_pos(m_mpcd_pdata->getPositions(), access_location::host, access_mode::readwrite);
-    ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(), access_location::host, access_mode::readwrite);
-    ArrayHandle<unsigned int> h_tag(m_mpcd_pdata->getTags(), access_location::host, access_mode::readwrite);
+    ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::host,
+                                      access_mode::readwrite);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::readwrite);
+    ArrayHandle<unsigned int> h_tag(m_mpcd_pdata->getTags(),
+                                    access_location::host,
+                                    access_mode::readwrite);
 
     const BoxDim& box = m_pdata->getBox();
-    Scalar3 lo = box.getLo();
-    Scalar3 hi = box.getHi();
-    const unsigned int N_half = 0.5*m_N_fill;
-    const Scalar vel_factor = fast::sqrt(m_T->getValue(timestep) / m_mpcd_pdata->getMass());
+    const Scalar3 lo = box.getLo();
+    const Scalar3 hi = box.getHi();
+
+    const Scalar vel_factor = fast::sqrt((*m_T)(timestep) / m_mpcd_pdata->getMass());
+
+    uint16_t seed = m_sysdef->getSeed();
+
+    // most particles draw 3 positions and 2 pairs of velocities
+    const hoomd::Seed rng_seed(hoomd::RNGIdentifier::CosineExpansionContractionFiller,
+                               timestep,
+                               seed);
+    hoomd::RandomGeneratorBatch<5> rng_batch;
 
     // index to start filling from
     const unsigned int first_idx = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual() - m_N_fill;
-
-    for (unsigned int i=0; i < m_N_fill; ++i)
+    for (unsigned int i = 0; i < m_N_fill; ++i)
         {
         const unsigned int tag = m_first_tag + i;
-        hoomd::RandomGenerator rng(RNGIdentifier::CosineExpansionContractionFiller, m_seed, tag, timestep);
-        signed char sign = (i >= N_half) - (i < N_half); // bottom -1 or top +1
 
-        Scalar x = hoomd::UniformDistribution<Scalar>(lo.x, hi.x)(rng);
-        Scalar y = hoomd::UniformDistribution<Scalar>(lo.y, hi.y)(rng);
-        Scalar z = hoomd::UniformDistribution<Scalar>(0, sign*m_thickness)(rng);
-        z += sign*(m_amplitude*fast::cos(x*m_pi_period_div_L)+m_amplitude + m_H_narrow);
+        // the streams of the next particles are drawn together
+        const unsigned int lane = i % rng_batch.width;
+        if (lane == 0)
+            {
+            for (unsigned int j = 0; j < rng_batch.width; ++j)
+                {
+                rng_batch.setStream(j, rng_seed, hoomd::Counter(tag + j));
+                }
+            rng_batch.generate();
+            }
+        auto rng = rng_batch.getGenerator(lane);
+        const signed char sign = (char)((i >= m_N_lo) - (i < m_N_lo));
+
+        // draw uniformly in x and y, then offset z from the wall
+        const Scalar x = hoomd::UniformDistribution<Scalar>(lo.x, hi.x)(rng);
+        const Scalar y = hoomd::UniformDistribution<Scalar>(lo.y, hi.y)(rng);
+        const Scalar dz = hoomd::UniformDistribution<Scalar>(0, m_thickness)(rng);
+        const Scalar z = sign * (m_geom->getWall(x) + dz);
 
         const unsigned int pidx = first_idx + i;
-        h_pos.data[pidx] = make_scalar4(x, y, z, __int_as_scalar(m_type));
+        h_pos.data[pidx] = make_solvent_scalar4(x, y, z, __int_as_solvent_scalar(m_type));
 
         hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
         Scalar3 vel;
         gen(vel.x, vel.y, rng);
         vel.z = gen(rng);
-
-        h_vel.data[pidx] = make_scalar4(vel.x,
-                                        vel.y,
-                                        vel.z,
-                                        __int_as_scalar(mpcd::detail::NO_CELL));
+        vel += m_geom->getWallVelocity(x, sign);
+        h_vel.data[pidx] = make_solvent_scalar4(vel.x,
+                                                vel.y,
+                                                vel.z,
+                                                __int_as_solvent_scalar(mpcd::detail::NO_CELL));
         h_tag.data[pidx] = tag;
         }
     }
 
-
 /*!
  * \param m Python module to export to
  */
-
 void mpcd::detail::export_CosineExpansionContractionFiller(pybind11::module& m)
     {
     pybind11::class_<mpcd::CosineExpansionContractionFiller,
                      mpcd::VirtualParticleFiller,
-                     std::shared_ptr<mpcd::CosineExpansionContractionFiller>>()
-        m, 
+                     std::shared_ptr<mpcd::CosineExpansionContractionFiller>>(
+        m,
         "CosineExpansionContractionFiller")
-        .def(py::init<std::shared_ptr<mpcd::SystemDefinition>,
-                      const std::string&,
-                      Scalar,
-                      std::shared_ptr<::Variant>,
-                      unsigned int,
-                      std::shared_ptr<const CosineExpansionContraction>>())
-        .def("geometry", &mpcd::CosineExpansionContractionFiller::getGeometry);
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            Scalar,
+                            unsigned int,
+                            std::shared_ptr<Variant>,
+                            std::shared_ptr<const mpcd::detail::CosineExpansionContraction>>())
+        .def("setGeometry", &mpcd::CosineExpansionContractionFiller::setGeometry)
+        .def("setWallMotion", &mpcd::CosineExpansionContractionFiller::setWallMotion);
     }
 
-} // end namespace hoomd
+    } // end namespace hoomd
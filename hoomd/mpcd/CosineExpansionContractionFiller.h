@@ -1,75 +1,105 @@
 // Copyright (c) 2018-2020, Michael P. Howard
 // Copyright (c) 2021-2022, Auburn University
-
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 /*!
- * \file CosineExpansionContractionFiller.h
- * \brief Definition of virtual particle filler for mpcd::CosineExpansionContraction.
+ * \file mpcd/CosineExpansionContractionFiller.h
+ * \brief Definition of virtual particle filler for mpcd::detail::CosineExpansionContraction.
  */
 
-#ifndef MPCD_COSINE_EXPANSION_CONSTRICTION_FILLER_H_
-#define MPCD_COSINE_EXPANSION_CONSTRICTION_FILLER_H_
+#ifndef MPCD_COSINE_EXPANSION_CONTRACTION_FILLER_H_
+#define MPCD_COSINE_EXPANSION_CONTRACTION_FILLER_H_
 
-#ifdef __HIPPC__
+#ifdef __HIPCC__
 #error This header cannot be compiled by nvcc
 #endif
 
 #include "CosineExpansionContractionGeometry.h"
-#include "hoomd/mpcd/VirtualParticleFiller.h"
-#include "hoomd/mpcd/SystemDefinition.h"
+#include "VirtualParticleFiller.h"
+#include "WallMotion.h"
 
 #include <pybind11/pybind11.h>
 
 namespace hoomd
-{
+    {
 namespace mpcd
+    {
 //! Adds virtual particles to the MPCD particle data for CosineExpansionContraction
 /*!
- * Particles are added to the volume that is overlapped by any of the cells that are also "inside" the channel,
- * subject to the grid shift.
+ * Particles are added to a layer of constant thickness (in z) that follows each cosine wall. The
+ * thickness is chosen so that every cell that overlaps the inside of the channel, subject to the
+ * grid shift, is covered by the layer.
+ *
+ * The walls can be moved by an mpcd::WallMotion shared with the streaming method. The virtual
+ * particles are then drawn with the local velocity of the wall as their mean velocity.
  */
 class PYBIND11_EXPORT CosineExpansionContractionFiller : public mpcd::VirtualParticleFiller
     {
     public:
-    CosineExpansionContractionFiller(std::shared_ptr<mpcd::SystemDefinition> sysdef,
-                                     Scalar density,
-                                     unsigned int type,
-                                     std::shared_ptr<::Variant> T,
-                                     unsigned int seed,
-                                     std::shared_ptr<const detail::CosineExpansionContraction> geom);
+    CosineExpansionContractionFiller(
+        std::shared_ptr<SystemDefinition> sysdef,
+        Scalar density,
+        unsigned int type,
+        std::shared_ptr<Variant> T,
+        std::shared_ptr<const mpcd::detail::CosineExpansionContraction> geom);
 
     virtual ~CosineExpansionContractionFiller();
 
-    std::shared_ptr<const mpcd::CosineExpansionContraction> getGeometry() const
-            {
-            return m_geom;
-            }
-
-    void setGeometry(std::shared_ptr<const detail::CosineExpansionContraction> geom)
+    void setGeometry(std::shared_ptr<const mpcd::detail::CosineExpansionContraction> geom)
         {
         m_geom = geom;
+        invalidateReservoir();
+        }
+
+    //! Set the motion of the walls
+    /*!
+     * \param motion Motion of the walls, or null to stop following them
+     */
+    void setWallMotion(
+        std::shared_ptr<mpcd::WallMotion<mpcd::detail::CosineExpansionContraction>> motion)
+        {
+        m_motion = motion;
+        if (m_motion)
+            {
+            m_geom = m_motion->getGeometry();
+            m_motion_version = m_motion->getVersion();
+            }
+        invalidateReservoir();
         }
 
     protected:
-    std::shared_ptr<const detail::CosineExpansionContraction> m_geom;
-    Scalar m_thickness;       //!< thickness of virtual particle buffer zone
-    Scalar m_amplitude;       //!< amplitude of  channel wall cosine: 0.5(H_wide - H_narrow)
-    Scalar m_pi_period_div_L; //!< period of channel wall cosine: 2*pi*period/Lx
-    Scalar m_H_narrow;        //!< half width of the narrowest height of the channel
+    std::shared_ptr<const mpcd::detail::CosineExpansionContraction> m_geom;
+    std::shared_ptr<mpcd::WallMotion<mpcd::detail::CosineExpansionContraction>>
+        m_motion;                  //!< Motion of the walls
+    unsigned int m_motion_version; //!< Version of the walls the particles were drawn for
+    Scalar m_thickness;  //!< Thickness of virtual particle layer
+    unsigned int m_N_lo; //!< Number of particles to fill below channel
+    unsigned int m_N_hi; //!< Number of particles to fill above channel
 
     //! Compute the total number of particles to fill
     virtual void computeNumFill();
 
     //! Draw particles within the fill volume
-    virtual void drawParticles(unsigned int timestep);
+    virtual void drawParticles(uint64_t timestep);
+
+    //! Get the mean velocity of a virtual particle at a position
+    /*!
+     * \param pos Position of the virtual particle
+     * \returns Velocity of the wall surface on the same side of the channel and at the same x
+     * as \a pos
+     */
+    virtual Scalar3 getMeanVelocity(const SolventScalar4& pos) const
+        {
+        const signed char sign = (pos.z >= Scalar(0)) ? 1 : -1;
+        return m_geom->getWallVelocity(pos.x, sign);
+        }
     };
 
 namespace detail
-{
+    {
 //! Export CosineExpansionContractionFiller to python
 void export_CosineExpansionContractionFiller(pybind11::module& m);
-} // end namespace detail
-} // end namespace mpcd
-} // end namespace hoomd
-
-#endif // MPCD_COSINE_EXPANSION_CONSTRICTION_FILLER_H_
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_COSINE_EXPANSION_CONTRACTION_FILLER_H_
@@ -1,73 +1,75 @@
 // Copyright (c) 2018-2020, Michael P. Howard
 // Copyright (c) 2021-2022, Auburn University
-
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 /*!
- * \file CosineExpansionContractionFillerGPU.cu
+ * \file mpcd/CosineExpansionContractionFillerGPU.cu
  * \brief Defines GPU functions and kernels used by mpcd::CosineExpansionContractionFillerGPU
  */
 
 #include "CosineExpansionContractionFillerGPU.cuh"
+#include "ParticleDataUtilities.h"
+#include "hoomd/RNGIdentifiers.h"
 #include "hoomd/RandomNumbers.h"
-#include "RNGIdentifiers.h"
-#include "hoomd/mpcd/ParticleDataUtilities.h"
 
 namespace hoomd
-{
+    {
 namespace mpcd
-{
+    {
 namespace gpu
-{
-
+    {
 namespace kernel
-{
+    {
 /*!
  * \param d_pos Particle positions
  * \param d_vel Particle velocities
  * \param d_tag Particle tags
- * \param geom geometry to fill
- * \param m_pi_period_div_L
- * \param m_amplitude
+ * \param geom Cosine expansion-contraction geometry to fill
+ * \param thickness Thickness of the fill layer in z
  * \param box Local simulation box
  * \param type Type of fill particles
  * \param N_lo Number of particles to fill in lower region
- * \param N_hi Number of particles to fill in upper region
+ * \param N_tot Total number of particles to fill
  * \param first_tag First tag of filled particles
  * \param first_idx First (local) particle index of filled particles
- * \param vel_factor Scale factor for uniform normal velocities consistent with particle mass / temperature
+ * \param vel_factor Scale factor for uniform normal velocities consistent with particle mass /
+ * temperature
  * \param timestep Current timestep
  * \param seed User seed to PRNG for drawing velocities
  *
  * \b Implementation:
  *
- * Using one thread per particle (in both slabs), the thread is assigned to fill either the lower
- * or upper region.  A random position is drawn within a cuboid, which is then shifted in z using the wall equation.
- * The thread index is translated into a particle tag and local particle index.
+ * Using one thread per particle (in both layers), the thread is assigned to fill either the lower
+ * or upper layer. The thread index is translated into a particle tag and local particle index. A
+ * random position is drawn in x and y within the local box, and the z position is drawn within the
+ * layer following the cosine wall at that x. The thermal velocity is drawn around the velocity of
+ * the wall at that x.
  */
-__global__ void sin_expansion_constriction_draw_particles(Scalar4 *d_pos,
-                                                          Scalar4 *d_vel,
-                                                          unsigned int *d_tag,
-                                                          const azplugins::detail::SinusoidalExpansionConstriction geom,
-                                                          const Scalar m_pi_period_div_L,
-                                                          const Scalar m_amplitude,
-                                                          const Scalar m_H_narrow,
-                                                          const Scalar m_thickness,
-                                                          const BoxDim box,
-                                                          const unsigned int type,
-                                                          const unsigned int N_fill,
-                                                          const unsigned int first_tag,
-                                                          const unsigned int first_idx,
-                                                          const Scalar vel_factor,
-                                                          const uint64_t timestep,
-                                                          const uint16_t int seed)
+__global__ void
+cosine_expansion_contraction_draw_particles(SolventScalar4* d_pos,
+                                            SolventScalar4* d_vel,
+                                            unsigned int* d_tag,
+                                            const mpcd::detail::CosineExpansionContraction geom,
+                                            const Scalar thickness,
+                                            const BoxDim box,
+                                            const unsigned int type,
+                                            const unsigned int N_lo,
+                                            const unsigned int N_tot,
+                                            const unsigned int first_tag,
+                                            const unsigned int first_idx,
+                                            const Scalar vel_factor,
+                                            const uint64_t timestep,
+                                            const uint16_t seed)
     {
     // one thread per particle
     const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
-    if (idx >= N_fill)
+    if (idx >= N_tot)
         return;
-    Scalar3 lo = box.getLo();
-    Scalar3 hi = box.getHi();
-    const unsigned int N_half = 0.5*N_fill;
+
+    // determine the fill region based on current index
+    const signed char sign = (idx >= N_lo) - (idx < N_lo);
+    const Scalar3 lo = box.getLo();
+    const Scalar3 hi = box.getHi();
 
     // particle tag and index
     const unsigned int tag = first_tag + idx;
@@ -75,35 +77,31 @@ __global__ void sin_expansion_constriction_draw_particles(Scalar4 *d_pos,
     d_tag[pidx] = tag;
 
     // initialize random number generator for positions and velocity
-    hoomd::RandomGenerator rng(RNGIdentifier::CosineExpansionContractionFiller, seed, tag, timestep);
-    signed char sign = (idx >= N_half) - (idx < N_half); // bottom -1 or top +1
-
-    Scalar x = hoomd::UniformDistribution<Scalar>(lo.x, hi.x)(rng);
-    Scalar y = hoomd::UniformDistribution<Scalar>(lo.y, hi.y)(rng);
-    Scalar z = hoomd::UniformDistribution<Scalar>(0, sign*m_thickness)(rng);
-    z += sign*(m_amplitude*fast::cos(x*m_pi_period_div_L)+m_amplitude + m_H_narrow );
-
-    d_pos[pidx] = make_scalar4(x, y, z, __int_as_scalar(type));
+    hoomd::RandomGenerator rng(
+        hoomd::Seed(hoomd::RNGIdentifier::CosineExpansionContractionFiller, timestep, seed),
+        hoomd::Counter(tag));
+    const Scalar x = hoomd::UniformDistribution<Scalar>(lo.x, hi.x)(rng);
+    const Scalar y = hoomd::UniformDistribution<Scalar>(lo.y, hi.y)(rng);
+    const Scalar dz = hoomd::UniformDistribution<Scalar>(0, thickness)(rng);
+    const Scalar z = sign * (geom.getWall(x) + dz);
+    d_pos[pidx] = make_solvent_scalar4(x, y, z, __int_as_solvent_scalar(type));
 
     hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
     Scalar3 vel;
     gen(vel.x, vel.y, rng);
     vel.z = gen(rng);
-
-    d_vel[pidx] = make_scalar4(vel.x,
-                               vel.y,
-                               vel.z,
-                               __int_as_scalar(mpcd::detail::NO_CELL));
+    vel += geom.getWallVelocity(x, sign);
+    d_vel[pidx]
+        = make_solvent_scalar4(vel.x, vel.y, vel.z, __int_as_solvent_scalar(mpcd::detail::NO_CELL));
     }
-} // end namespace kernel
+    } // end namespace kernel
 
 /*!
  * \param d_pos Particle positions
  * \param d_vel Particle velocities
  * \param d_tag Particle tags
- * \param geom Slit geometry to fill
- * \param z_min Lower bound to lower fill region
- * \param z_max Upper bound to upper fill region
+ * \param geom Cosine expansion-contraction geometry to fill
+ * \param thickness Thickness of the fill layer in z
  * \param box Local simulation box
  * \param mass Mass of fill particles
  * \param type Type of fill particles
@@ -116,62 +114,58 @@ __global__ void sin_expansion_constriction_draw_particles(Scalar4 *d_pos,
  * \param seed User seed to PRNG for drawing velocities
  * \param block_size Number of threads per block
  *
- * \sa kernel::sin_expansion_constriction_draw_particles
+ * \sa kernel::cosine_expansion_contraction_draw_particles
  */
-cudaError_t cosine_expansion_contraction_draw_particles(Scalar4 *d_pos,
-                                   Scalar4 *d_vel,
-                                   unsigned int *d_tag,
-                                   const azplugins::detail::SinusoidalExpansionConstriction& geom,
-                                   const Scalar m_pi_period_div_L,
-                                   const Scalar m_amplitude,
-                                   const Scalar m_H_narrow,
-                                   const Scalar m_thickness,
-                                   const BoxDim& box,
-                                   const Scalar mass,
-                                   const unsigned int type,
-                                   const unsigned int N_fill,
-                                   const unsigned int first_tag,
-                                   const unsigned int first_idx,
-                                   const Scalar kT,
-                                   const uint64_t timestep,
-                                   const uint16_t seed,
-                                   const unsigned int block_size)
+cudaError_t
+cosine_expansion_contraction_draw_particles(SolventScalar4* d_pos,
+                                            SolventScalar4* d_vel,
+                                            unsigned int* d_tag,
+                                            const mpcd::detail::CosineExpansionContraction& geom,
+                                            const Scalar thickness,
+                                            const BoxDim& box,
+                                            const Scalar mass,
+                                            const unsigned int type,
+                                            const unsigned int N_lo,
+                                            const unsigned int N_hi,
+                                            const unsigned int first_tag,
+                                            const unsigned int first_idx,
+                                            const Scalar kT,
+                                            const uint64_t timestep,
+                                            const uint16_t seed,
+                                            const unsigned int block_size)
     {
-    if (N_fill == 0) return cudaSuccess;
+    const unsigned int N_tot = N_lo + N_hi;
+    if (N_tot == 0)
+        return cudaSuccess;
 
-    static unsigned int max_block_size = UINT_MAX;
-    if (max_block_size == UINT_MAX)
-        {
-        cudaFuncAttributes attr;
-        cudaFuncGetAttributes(&attr, (const void*)kernel::sin_expansion_constriction_draw_particles);
-        max_block_size = attr.maxThreadsPerBlock;
-        }
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)kernel::cosine_expansion_contraction_draw_particles);
+    max_block_size = attr.maxThreadsPerBlock;
 
     // precompute factor for rescaling the velocities since it is the same for all particles
     const Scalar vel_factor = fast::sqrt(kT / mass);
 
     unsigned int run_block_size = min(block_size, max_block_size);
-    dim3 grid(N_fill / run_block_size + 1);
+    dim3 grid(N_tot / run_block_size + 1);
     kernel::cosine_expansion_contraction_draw_particles<<<grid, run_block_size>>>(d_pos,
-                                                             d_vel,
-                                                             d_tag,
-                                                             geom,
-                                                             m_pi_period_div_L,
-                                                             m_amplitude,
-                                                             m_H_narrow,
-                                                             m_thickness,
-                                                             box,
-                                                             type,
-                                                             N_fill,
-                                                             first_tag,
-                                                             first_idx,
-                                                             vel_factor,
-                                                             timestep,
-                                                             seed);
+                                                                                  d_vel,
+                                                                                  d_tag,
+                                                                                  geom,
+                                                                                  thickness,
+                                                                                  box,
+                                                                                  type,
+                                                                                  N_lo,
+                                                                                  N_tot,
+                                                                                  first_tag,
+                                                                                  first_idx,
+                                                                                  vel_factor,
+                                                                                  timestep,
+                                                                                  seed);
 
     return cudaSuccess;
     }
 
-} // end namespace gpu
-} // end namespace mpcd
-} // end namespace hoomd
+    } // end namespace gpu
+    } // end namespace mpcd
+    } // end namespace hoomd
@@ -1,51 +1,48 @@
 // Copyright (c) 2018-2020, Michael P. Howard
 // Copyright (c) 2021-2022, Auburn University
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
 
-
-
-#ifndef MPCD_COSINE_EXPANSION_CONSTRICTION_FILLER_GPU_CUH_
-#define MPCD_COSINE_EXPANSION_CONSTRICTION_FILLER_GPU_CUH_
+#ifndef MPCD_COSINE_EXPANSION_CONTRACTION_FILLER_GPU_CUH_
+#define MPCD_COSINE_EXPANSION_CONTRACTION_FILLER_GPU_CUH_
 
 /*!
- * \file CosineExpansionContractionFillerGPU.cuh
+ * \file mpcd/CosineExpansionContractionFillerGPU.cuh
  * \brief Declaration of CUDA kernels for mpcd::CosineExpansionContractionFillerGPU
  */
 
 #include <cuda_runtime.h>
 
 #include "CosineExpansionContractionGeometry.h"
-#include "hoomd/HOOMDMath.h"
+#include "ParticleDataUtilities.h"
 #include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
 
 namespace hoomd
-{
+    {
 namespace mpcd
-{
+    {
 namespace gpu
-{
-
-//! Draw virtual particles in the CoineGeometry
-cudaError_t cosine_expansion_contraction_draw_particles(Scalar4 *d_pos,
-                                                      Scalar4 *d_vel,
-                                                      unsigned int *d_tag,
-                                                      const azplugins::detail::SinusoidalExpansionConstriction& geom,
-                                                      const Scalar pi_period_div_L,
-                                                      const Scalar amplitude,
-                                                      const Scalar H_narrow,
-                                                      const Scalar thickness,
-                                                      const BoxDim& box,
-                                                      const Scalar mass,
-                                                      const unsigned int type,
-                                                      const unsigned int N_fill,
-                                                      const unsigned int first_tag,
-                                                      const unsigned int first_idx,
-                                                      const Scalar kT,
-                                                      const uint64_t timestep,
-                                                      const uints16_t seed,
-                                                      const unsigned int block_size);
-
-} // end namespace gpu
-} // end namespace mpcd
-} // end namespace azplugins
-
-#endif // MPCD_COSINE_EXPANSION_CONSTRICTION_FILLER_GPU_CUH_
+    {
+//! Draw virtual particles in the CosineExpansionContraction
+cudaError_t
+cosine_expansion_contraction_draw_particles(SolventScalar4* d_pos,
+                                            SolventScalar4* d_vel,
+                                            unsigned int* d_tag,
+                                            const mpcd::detail::CosineExpansionContraction& geom,
+                                            const Scalar thickness,
+                                            const BoxDim& box,
+                                            const Scalar mass,
+                                            const unsigned int type,
+                                            const unsigned int N_lo,
+                                            const unsigned int N_hi,
+                                            const unsigned int first_tag,
+                                            const unsigned int first_idx,
+                                            const Scalar kT,
+                                            const uint64_t timestep,
+                                            const uint16_t seed,
+                                            const unsigned int block_size);
+
+    } // end namespace gpu
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_COSINE_EXPANSION_CONTRACTION_FILLER_GPU_CUH_
@@ -1,14 +1,15 @@
 // Copyright (c) 2018-2020, Michael P. Howard
 // Copyright (c) 2021-2022, Auburn University
-
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 /*!
- * \file CosineExpansionContractionFillerGPU.h
- * \brief Definition of virtual particle filler for mpcd::detail::CosineExpansionContraction on the GPU.
+ * \file mpcd/CosineExpansionContractionFillerGPU.h
+ * \brief Definition of virtual particle filler for mpcd::detail::CosineExpansionContraction on the
+ * GPU.
  */
 
-#ifndef MPCD_COSINE_EXPANSION_CONSTRICTION_FILLER_GPU_H_
-#define MPCD_COSINE_EXPANSION_CONSTRICTION_FILLER_GPU_H_
+#ifndef MPCD_COSINE_EXPANSION_CONTRACTION_FILLER_GPU_H_
+#define MPCD_COSINE_EXPANSION_CONTRACTION_FILLER_GPU_H_
 
 #ifdef __HIPCC__
 #error This header cannot be compiled by nvcc
@@ -19,47 +20,35 @@
 #include <pybind11/pybind11.h>
 
 namespace hoomd
-{
+    {
 namespace mpcd
-{
-
-//! Adds virtual particles to the MPCD particle data for SinusoidalExpansionConstriction using the GPU
-class PYBIND11_EXPORT CosineExpansionContractionFillerGPU : public CosineExpansionContractionFiller
+    {
+//! Adds virtual particles to the MPCD particle data for CosineExpansionContraction using the GPU
+class PYBIND11_EXPORT CosineExpansionContractionFillerGPU
+    : public mpcd::CosineExpansionContractionFiller
     {
     public:
-        //! Constructor
-        CosineExpansionContractionFillerGPU(std::shared_ptr<mpcd::SystemDefinition> sysdef,
-                                                 Scalar density,
-                                                 unsigned int type,
-                                                 std::shared_ptr<::Variant> T,
-                                                 unsigned int seed,
-                                                 std::shared_ptr<const detail::CosineExpansionContraction> geom);
-
-        //! Set autotuner parameters
-        /*!
-         * \param enable Enable/disable autotuning
-         * \param period period (approximate) in time steps when returning occurs
-         */
-        virtual void setAutotunerParams(bool enable, unsigned int period)
-            {
-            SinusoidalExpansionConstrictionFiller::setAutotunerParams(enable, period);
-
-            m_tuner->setEnabled(enable); m_tuner->setPeriod(period);
-            }
+    //! Constructor
+    CosineExpansionContractionFillerGPU(
+        std::shared_ptr<SystemDefinition> sysdef,
+        Scalar density,
+        unsigned int type,
+        std::shared_ptr<Variant> T,
+        std::shared_ptr<const mpcd::detail::CosineExpansionContraction> geom);
 
     protected:
-        //! Draw particles within the fill volume on the GPU
-        virtual void drawParticles(unsigned int timestep);
+    //! Draw particles within the fill volume on the GPU
+    virtual void drawParticles(uint64_t timestep);
 
     private:
-        std::unique_ptr<::Autotuner> m_tuner;   //!< Autotuner for drawing particles
+    std::shared_ptr<hoomd::Autotuner<1>> m_tuner; //!< Autotuner for drawing particles
     };
 
 namespace detail
-{
-//! Export SinusoidalExpansionConstrictionFillerGPU to python
+    {
+//! Export CosineExpansionContractionFillerGPU to python
 void export_CosineExpansionContractionFillerGPU(pybind11::module& m);
-} // end namespace detail
-} // end namespace mpcd
-} // end namespace hoomd
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
 #endif // MPCD_COSINE_EXPANSION_CONTRACTION_FILLER_GPU_H_
@@ -1,15 +1,18 @@
 // Copyright (c) 2018-2020, Michael P. Howard
 // Copyright (c) 2021-2022, Auburn University
-
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 /*!
- * \file SinusoidalExpansionConstrictionGeometry.h
- * \brief Definition of the MPCD symmetric cosine channel geometry
+ * \file mpcd/CosineExpansionContractionGeometry.h
+ * \brief Definition of the MPCD symmetric cosine expansion-contraction channel geometry
  */
 
 #ifndef MPCD_COSINE_EXPANSION_CONTRACTION_GEOMETRY_H_
 #define MPCD_COSINE_EXPANSION_CONTRACTION_GEOMETRY_H_
 
+#include "BoundaryCondition.h"
+#include "BracketedRootFinder.h"
+
 #include "hoomd/BoxDim.h"
 #include "hoomd/HOOMDMath.h"
 
@@ -21,25 +24,26 @@
 #endif // __HIPCC__
 
 namespace hoomd
-{
+    {
 namespace mpcd
-{
-
-//! Sinusoidal expansion constriction channel geometry
+    {
+namespace detail
+    {
+//! Sinusoidal expansion-contraction channel geometry
 /*!
- * This class defines a channel with a series of expansions and constrictions. Symmetric cosines
- * given by the equations +/-(A cos(x*2*pi*p/Lx) + A + H_narrow) are used for the walls.
- * A = 0.5*(H_wide-H_narrow) is the amplitude and p is the period of the wall cosine.
- * H_wide is the half height of the channel at its widest point, H_narrow is the half height of the channel at its
- * narrowest point. The cosine wall wavelength/frenquency needs to be consumable with the periodic boundary conditions in x,
- * therefore the period p is specified and the wavelength 2*pi*p/Lx is calculated.
+ * This class defines a channel with a series of expansions and contractions. Symmetric cosines
+ * given by the equations \f$ z = \pm (A \cos(2\pi p x/L_x) + A + h) \f$ are used for the walls.
+ * \f$A = (H - h)/2\f$ is the amplitude and \a p is the number of repetitions of the wall cosine
+ * in the box. \a H is the half height of the channel at its widest point, and \a h is the half
+ * height of the channel at its narrowest point. The cosine wall wavelength needs to be
+ * commensurate with the periodic boundary conditions in \a x, so the number of repetitions \a p
+ * is specified and the wavenumber \f$2\pi p/L_x\f$ is calculated.
  *
- * Below is an example how a cosine channel looks like in a 30x30x30 box with H_wide=10, H_narrow=1, and p=1.
- * The wall cosine period p determines how many repetitions of the geometry are in the simulation cell and
- * there will be p wide sections, centered at the origin of the simulation box.
+ * Below is an example of a channel in a 30x30x30 box with H=10, h=1, and p=1. The number of
+ * repetitions p determines how many wide sections are in the simulation cell, one of which is
+ * centered at the origin of the simulation box.
  *
- *
- * 15 +-------------------------------------------------+
+ *  15 +-------------------------------------------------+
  *     |XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX|
  *     |XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX|
  *     |XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX|
@@ -67,269 +71,356 @@ namespace mpcd
  *
  * The wall boundary conditions can optionally be changed to slip conditions.
  *
+ * The walls can also move in the same way as the walls of CosineChannel. The cosine is shifted by
+ * a phase \f$\phi\f$ that advances as a wave traveling along \a x with phase velocity \a c,
+ * the walls may translate along \a x with velocity \a V, and the amplitude can change with the
+ * narrowest half height \a h held fixed. The walls are static unless their motion is set with
+ * setWallMotion().
  */
 class __attribute__((visibility("default"))) CosineExpansionContraction
     {
     public:
-        //! Constructor
-        /*!
-         * \param L Channel length (Simulation box length in x)
-           \param H_wide Channel half-width at widest point
-           \param H_narrow Channel half-width at narrowest point
-           \param Period Channel cosine period (integer >0)
-         * \param bc Boundary condition at the wall (slip or no-slip)
-         */
-        HOSTDEVICE CosineExpansionContraction(Scalar L, Scalar H_wide,Scalar H_narrow, unsigned int Repetitions, mpcd::detail::boundary bc)
-            : m_pi_period_div_L(2*M_PI*Repetitions/L), m_H_wide(H_wide), m_H_narrow(H_narrow), m_Repetitions(Repetitions), m_bc(bc)
-            {
-            }
+    //! Constructor
+    /*!
+     * \param L Channel length (simulation box length in x)
+     * \param H_wide Channel half-width at widest point
+     * \param H_narrow Channel half-width at narrowest point
+     * \param repetitions Number of repetitions of the cosine in the box (integer > 0)
+     * \param bc Boundary condition at the wall (slip or no-slip)
+     */
+    HOSTDEVICE CosineExpansionContraction(Scalar L,
+                                          Scalar H_wide,
+                                          Scalar H_narrow,
+                                          unsigned int repetitions,
+                                          boundary bc)
+        : m_pi_period_div_L(Scalar(2.0 * M_PI) * repetitions / L), m_H_wide(H_wide),
+          m_H_narrow(H_narrow), m_repetitions(repetitions), m_bc(bc), m_phase(0),
+          m_phase_velocity(0), m_V(0)
+        {
+        }
 
-        //! Detect collision between the particle and the boundary
-        /*!
-         * \param pos Proposed particle position
-         * \param vel Proposed particle velocity
-         * \param dt Integration time remaining
-         *
-         * \returns True if a collision occurred, and false otherwise
-         *
-         * \post The particle position \a pos is moved to the point of reflection, the velocity \a vel is updated
-         *       according to the appropriate bounce back rule, and the integration time \a dt is decreased to the
-         *       amount of time remaining.
-         */
-        HOSTDEVICE bool detectCollision(Scalar3& pos, Scalar3& vel, Scalar& dt) const
-            {
-            /*
-             * Detect if particle has left the box. The sign used
-             * in calculations is +1 if the particle is out-of-bounds at the top wall, -1 if the particle is
-             * out-of-bounds at the bottom wall, and 0 otherwise.
-             *
-             * We intentionally use > / < rather than >= / <= to make sure that spurious collisions do not get detected
-             * when a particle is reset to the boundary location. A particle landing exactly on the boundary from the bulk
-             * can be immediately reflected on the next streaming step, and so the motion is essentially equivalent up to
-             * an epsilon of difference in the channel width.
-             */
-            Scalar A = 0.5*(m_H_wide-m_H_narrow);
-            Scalar a = A*fast::cos(pos.x*m_pi_period_div_L) + A + m_H_narrow;
-            const signed char sign = (pos.z > a) - (pos.z < -a);
-
-            // exit immediately if no collision is found
-            if (sign == 0)
-                {
-                dt = Scalar(0);
-                return false;
-                }
-
-            /* Calculate position (x0,y0,z0) of collision with wall:
-            *  Because there is no analythical solution for equations like f(x) = cos(x)-x = 0, we use Newtons's method
-            *  or Bisection (if Newton fails) to nummerically estimate the
-            *  x positon of the intersection first. It is convinient to use the halfway point between the last particle
-            *  position outside the wall (at time t-dt) and the current position inside the wall (at time t) as initial
-            *  guess for the intersection.
-            *
-            *  We limit the number of iterations (max_iteration) and the desired presicion (target_precision) for
-            *  performance reasons. These values have been tested in python code seperately and gave satisfactory results.
-            *
-            */
-            const unsigned int max_iteration = 6;
-            const Scalar target_precision = 1e-5;
-
-            Scalar x0 = pos.x - 0.5*dt*vel.x;
-            Scalar y0;
-            Scalar z0;
-            Scalar n,n2;
-            Scalar s,c;
-            Scalar delta;
-
-            // excatly horizontal z-collision, has a solution:
-            if (vel.z == 0)
-                {
-                x0 = 1/m_pi_period_div_L*fast::acos((pos.z-A-m_H_narrow)/sign*A);
-                z0 = pos.z;
-                y0 = -(pos.x-dt*vel.x - x0)*vel.y/vel.x + (pos.y-dt*vel.y);
-                }
-            /* chatch the case where a particle collides exactly vertically (v_x=0 -> old x pos = new x pos)
-            * In this case in Newton's method one would get: y0 = -(0)*0/0 + (y-dt*v_y) == nan, should be y0 =(y-dt*v_y)
-            */
-            else if (vel.x == 0)
-                {
-                x0 = pos.x;
-                y0 = (pos.y-dt*vel.y);
-                z0 = sign*(A*fast::cos(x0*m_pi_period_div_L)+A+m_H_narrow);
-                }
-            else // not horizontal or vertical collision - do Newthon's method
-                {
-                delta = fabs(0 - (sign*(A*fast::cos(x0*m_pi_period_div_L)+ A + m_H_narrow) - vel.z/vel.x*(x0 - pos.x) - pos.z));
-
-                unsigned int counter = 0;
-                while( delta > target_precision && counter < max_iteration)
-                    {
-                    fast::sincos(x0*m_pi_period_div_L,s,c);
-                    n = sign*(A*c + A + m_H_narrow) - vel.z/vel.x*(x0 - pos.x) - pos.z;  // f
-                    n2 = -sign*m_pi_period_div_L*A*s - vel.z/vel.x;                      // df
-                    x0 = x0 - n/n2;                                                      // x = x - f/df
-                    delta = fabs(0-(sign*(A*fast::cos(x0*m_pi_period_div_L)+A+m_H_narrow) - vel.z/vel.x*(x0 - pos.x) - pos.z));
-                    ++counter;
-                    }
-                /* The new z position is calculated from the wall equation to guarantee that the new particle positon is exactly at the wall
-                 * and not accidentally slightly inside of the wall because of nummerical presicion.
-                 */
-                z0 = sign*(A*fast::cos(x0*m_pi_period_div_L)+A+m_H_narrow);
-
-                /* The new y position can be calculated from the fact that the last position outside of the wall, the current position inside
-                 * of the  wall, and the new position exactly at the wall are on a straight line.
-                 */
-                y0 = -(pos.x-dt*vel.x - x0)*vel.y/vel.x + (pos.y-dt*vel.y);
-
-                // Newton's method sometimes failes to converge (close to saddle points, df'==0, overshoot, bad initial guess,..)
-                // catch all of them here and do bisection if Newthon's method didn't work
-                Scalar lower_x = fmin(pos.x - dt*vel.x,pos.x);
-                Scalar upper_x = fmax(pos.x - dt*vel.x,pos.x);
-
-                // found intersection is NOT in between old and new point, ie intersection is wrong/inaccurate.
-                // do bisection to find intersection - slower but more robust than Newton's method
-                if (x0 < lower_x || x0 > upper_x)
-                    {
-                    counter = 0;
-                    Scalar3 point1 = pos;  // final position at t+dt
-                    Scalar3 point2 = pos-dt*vel; // initial position
-                    Scalar3 point3 = 0.5*(point1+point2); // halfway point
-                    Scalar fpoint3 = (sign*(A*fast::cos(point3.x*m_pi_period_div_L)+ A + m_H_narrow) - point3.z); // value at halfway point, f(x)
-                    // Note: technically, the presicion of Newton's method and bisection is slightly different, with
-                    // bisection being less precise and slower convergence.
-                    while (fabs(fpoint3) > target_precision && counter < max_iteration)
-                        {
-                        fpoint3 = (sign*(A*fast::cos(point3.x*m_pi_period_div_L)+ A + m_H_narrow) - point3.z);
-                        // because we know that point1 outside of the channel and point2 is inside of the channel, we
-                        // only need to check the halfway point3 - if it is inside, replace point2, if it is outside, replace point1
-                        if (isOutside(point3) == false)
-                            {
-                            point2 = point3;
-                            }
-                        else
-                            {
-                            point1 = point3;
-                            }
-                        point3 = 0.5*(point1+point2);
-                        ++counter;
-                        }
-                    // final point3 == intersection
-                    x0 = point3.x;
-                    z0 = sign*(A*fast::cos(x0*m_pi_period_div_L)+A+m_H_narrow);
-                    y0 = -(pos.x-dt*vel.x - x0)*vel.y/vel.x + (pos.y-dt*vel.y);
-                    }
-                }
-
-            // Remaining integration time dt is amount of time spent traveling distance out of bounds.
-            Scalar3 pos_new = make_scalar3(x0,y0,z0);
-            dt = fast::sqrt(dot((pos - pos_new),(pos - pos_new))/dot(vel,vel));
-            pos = pos_new;
-
-            /* update velocity according to boundary conditions.
-             *
-             * A upwards normal of the surface is given by (-df/dx,-df/dy,1) with f = sign*(A*cos(x*2*pi*p/L)+A+h), so
-             * normal  = (sign*A*2*pi*p/L*sin(x*2*pi*p/L),0,1)/|length|
-             * We define B = sign*A*2*pi*p/L*sin(x*2*pi*p/L), so then the normal is given by (B,0,1)/|length|
-             * The direction of the normal is not important for the reflection.
-             */
-            Scalar3 vel_new;
-            if (m_bc ==  mpcd::detail::boundary::no_slip) // No-slip requires reflection of both tangential and normal components:
-                {
-                vel_new = -vel;
-                }
-            else // Slip conditions require only tangential components to be reflected:
-                {
-                Scalar B = sign*A*m_pi_period_div_L*fast::sin(x0*m_pi_period_div_L);
-                // The reflected vector is given by v_reflected = -2*(v_normal*v_incoming)*v_normal + v_incoming
-                // Calculate components by hand to avoid sqrt in normalization of the normal of the surface.
-                vel_new.x = vel.x - 2*B*(B*vel.x + vel.z)/(B*B+1);
-                vel_new.y = vel.y;
-                vel_new.z = vel.z - 2*(B*vel.x + vel.z)/(B*B+1);
-                }
-            vel = vel_new;
-
-            return true;
-            }
+    //! Set the motion of the walls
+    /*!
+     * \param amplitude Channel cosine amplitude (H_wide - H_narrow)/2
+     * \param phase Phase of the wall cosine
+     * \param phase_velocity Phase velocity of the wall cosine along x
+     * \param V Velocity of the walls along x
+     */
+    HOSTDEVICE void setWallMotion(Scalar amplitude, Scalar phase, Scalar phase_velocity, Scalar V)
+        {
+        m_H_wide = m_H_narrow + Scalar(2) * amplitude;
+        m_phase = phase;
+        m_phase_velocity = phase_velocity;
+        m_V = V;
+        }
 
-        //! Check if a particle is out of bounds
-        /*!
-         * \param pos Current particle position
-         * \returns True if particle is out of bounds, and false otherwise
+    //! Detect collision between the particle and the boundary
+    /*!
+     * \param pos Proposed particle position
+     * \param vel Proposed particle velocity
+     * \param dt Integration time remaining
+     * \param stats Optional statistics to record the root finding into
+     *
+     * \returns True if a collision occurred, and false otherwise
+     *
+     * \post The particle position \a pos is moved to the point of reflection, the velocity \a vel
+     * is updated according to the appropriate bounce back rule, and the integration time \a dt is
+     * decreased to the amount of time remaining.
+     */
+    HOSTDEVICE bool detectCollision(Scalar3& pos,
+                                    Scalar3& vel,
+                                    Scalar& dt,
+                                    CollisionStatistics* stats = nullptr) const
+        {
+        /*
+         * Detect if particle has left the box. The sign used in calculations is +1 if the
+         * particle is out-of-bounds at the top wall, -1 if the particle is out-of-bounds at the
+         * bottom wall, and 0 otherwise.
+         *
+         * We intentionally use > / < rather than >= / <= to make sure that spurious collisions do
+         * not get detected when a particle is reset to the boundary location. A particle landing
+         * exactly on the boundary from the bulk can be immediately reflected on the next streaming
+         * step, and so the motion is essentially equivalent up to an epsilon of difference in the
+         * channel width.
          */
-        HOSTDEVICE bool isOutside(const Scalar3& pos) const
+        const Scalar A = Scalar(0.5) * (m_H_wide - m_H_narrow);
+        const Scalar a = A * fast::cos(pos.x * m_pi_period_div_L - m_phase) + A + m_H_narrow;
+        const signed char sign = (char)((pos.z > a) - (pos.z < -a));
+        // exit immediately if no collision is found
+        if (sign == 0)
             {
-            const Scalar a = 0.5*(m_H_wide-m_H_narrow)*fast::cos(pos.x*m_pi_period_div_L)+0.5*(m_H_wide-m_H_narrow)+m_H_narrow;
-            return (pos.z > a || pos.z < -a);
+            dt = Scalar(0);
+            return false;
             }
 
-        //! Validate that the simulation box is large enough for the geometry
-        /*!
-         * \param box Global simulation box
-         * \param cell_size Size of MPCD cell
+        /*
+         * Calculate the time s that the particle has spent outside the channel. The trajectory
+         * during the step is (x(s), z(s)) = pos - s*vel for 0 <= s <= dt, and the (signed)
+         * distance outside the wall along z is F(s) = sign*z(s) - (A*cos(k*x(s)) + A + h). There
+         * is no analytical solution for F(s) = 0, but the root is always bracketed because the
+         * particle is outside at s = 0 and was inside at s = dt. A safeguarded Newton's method on
+         * this interval handles the vertical and horizontal collisions without special cases and
+         * directly gives the remaining integration time.
          *
-         * The box is large enough for the cosine if it is padded along the z direction so that
-         * the cells just outside the highest point of the cosine would not interact with each
-         * other through the boundary.
+         * We limit the number of iterations (max_iteration) and the desired precision
+         * (target_precision) for performance reasons.
          */
-        HOSTDEVICE bool validateBox(const BoxDim& box, Scalar cell_size) const
+        const unsigned int max_iteration = 12;
+        const Scalar target_precision = 1e-5;
+
+        const WallDistance F(pos, vel, sign, A, A + m_H_narrow, m_pi_period_div_L, m_phase);
+        const Scalar F_out = sign * pos.z - a;
+        Scalar F_in, dF_in;
+        F(dt, F_in, dF_in);
+
+        // If the particle was already outside at the start of the step (e.g., due to roundoff),
+        // there is no crossing to find, so reflect it from where it started.
+        Scalar s_out = dt;
+        if (F_in <= Scalar(0))
             {
-            const Scalar hi = box.getHi().z;
-            const Scalar lo = box.getLo().z;
-            return ((hi-m_H_wide) >= cell_size && (-m_H_wide-lo) >= cell_size);
+            s_out = findBracketedRoot(F,
+                                      Scalar(0),
+                                      F_out,
+                                      dt,
+                                      F_in,
+                                      target_precision,
+                                      max_iteration,
+                                      stats);
             }
 
-        //! Get channel half width at widest point
-        /*!
-         * \returns Channel half width at widest point
+        // The new z position is calculated from the wall equation to guarantee that the new
+        // particle position is exactly at the wall and not accidentally slightly inside of the
+        // wall because of numerical precision.
+        const Scalar x0 = pos.x - s_out * vel.x;
+        pos = make_scalar3(x0, pos.y - s_out * vel.y, sign * getWall(x0));
+
+        // Remaining integration time dt is amount of time spent traveling distance out of bounds.
+        dt = s_out;
+
+        /*
+         * Update velocity according to boundary conditions.
+         *
+         * An upwards normal of the surface is given by (-df/dx,-df/dy,1) with
+         * f = sign*(A*cos(x*2*pi*p/L - phi)+A+h), so
+         * normal = (sign*A*2*pi*p/L*sin(x*2*pi*p/L - phi),0,1)/|length|.
+         * We define B = sign*A*2*pi*p/L*sin(x*2*pi*p/L - phi), so then the normal is given by
+         * (B,0,1)/sqrt(B^2+1). The direction of the normal is not important for the reflection.
+         *
+         * The reflections are applied to the velocity relative to the wall, which is zero unless
+         * the walls move.
          */
-        HOSTDEVICE Scalar getHwide() const
+        const Scalar3 wall_vel = getWallVelocity(x0, sign);
+        if (m_bc == boundary::no_slip)
             {
-            return m_H_wide;
+            // no-slip requires reflection of both tangential and normal components
+            vel = Scalar(2) * wall_vel - vel;
             }
-        //! Get channel half width at narrowest point
-        /*!
-         * \returns Channel half width at narrowest point
-         */
-        HOSTDEVICE Scalar getHnarrow() const
+        else
             {
-            return m_H_narrow;
+            // slip requires only the normal component to be reflected. the reflected vector is
+            // v_reflected = v_incoming - 2*(n.v_incoming)*n. the components are calculated by
+            // hand to avoid a sqrt in the normalization of the surface normal.
+            const Scalar B
+                = sign * A * m_pi_period_div_L * fast::sin(x0 * m_pi_period_div_L - m_phase);
+            const Scalar vn
+                = (B * (vel.x - wall_vel.x) + (vel.z - wall_vel.z)) / (B * B + Scalar(1));
+            vel.x -= Scalar(2) * B * vn;
+            vel.z -= Scalar(2) * vn;
             }
 
-        //! Get channel cosine wall repetitions
-        /*!
-         * \returns Channel cosine wall repetitions
-         */
-        HOSTDEVICE Scalar getRepetitions() const
-            {
-            return m_Repetitions;
-            }
+        return true;
+        }
 
-        //! Get the wall boundary condition
-        /*!
-         * \returns Boundary condition at wall
-         */
-        HOSTDEVICE  mpcd::detail::boundary getBoundaryCondition() const
+    //! Check if a particle is out of bounds
+    /*!
+     * \param pos Current particle position
+     * \returns True if particle is out of bounds, and false otherwise
+     */
+    HOSTDEVICE bool isOutside(const Scalar3& pos) const
+        {
+        const Scalar A = Scalar(0.5) * (m_H_wide - m_H_narrow);
+        const Scalar a = A * fast::cos(pos.x * m_pi_period_div_L - m_phase) + A + m_H_narrow;
+        return (pos.z > a || pos.z < -a);
+        }
+
+    //! Get the height of the upper wall at a point
+    /*!
+     * \param x Position along x
+     * \returns Height \f$ A \cos(k x - \phi) + A + h \f$ of the upper wall, which is mirrored by
+     * the lower wall
+     */
+    HOSTDEVICE Scalar getWall(Scalar x) const
+        {
+        const Scalar A = Scalar(0.5) * (m_H_wide - m_H_narrow);
+        return A * fast::cos(x * m_pi_period_div_L - m_phase) + A + m_H_narrow;
+        }
+
+    //! Get the velocity of a wall surface at a point
+    /*!
+     * \param x Position along x
+     * \param sign +1 for the upper wall and -1 for the lower wall
+     * \returns Velocity of the wall surface at \a x
+     *
+     * The surfaces of the walls move in opposite directions along z as the cosine travels, and
+     * the walls translate along x.
+     */
+    HOSTDEVICE Scalar3 getWallVelocity(Scalar x, signed char sign) const
+        {
+        const Scalar A = Scalar(0.5) * (m_H_wide - m_H_narrow);
+        const Scalar vz = sign * A * m_pi_period_div_L * m_phase_velocity
+                          * fast::sin(x * m_pi_period_div_L - m_phase);
+        return make_scalar3(m_V, 0, vz);
+        }
+
+    //! Validate that the simulation box is large enough for the geometry
+    /*!
+     * \param box Global simulation box
+     * \param cell_size Size of MPCD cell
+     *
+     * The box is large enough for the cosine if it is padded along the z direction so that
+     * the cells just outside the highest point of the cosine would not interact with each
+     * other through the boundary.
+     */
+    HOSTDEVICE bool validateBox(const BoxDim& box, Scalar cell_size) const
+        {
+        const Scalar hi = box.getHi().z;
+        const Scalar lo = box.getLo().z;
+        return ((hi - m_H_wide) >= cell_size && (-m_H_wide - lo) >= cell_size);
+        }
+
+    //! Get channel half width at widest point
+    /*!
+     * \returns Channel half width at widest point
+     */
+    HOSTDEVICE Scalar getHwide() const
+        {
+        return m_H_wide;
+        }
+
+    //! Get channel half width at narrowest point
+    /*!
+     * \returns Channel half width at narrowest point
+     */
+    HOSTDEVICE Scalar getHnarrow() const
+        {
+        return m_H_narrow;
+        }
+
+    //! Get the number of repetitions of the cosine wall
+    /*!
+     * \returns Number of repetitions of the cosine wall
+     */
+    HOSTDEVICE unsigned int getRepetitions() const
+        {
+        return m_repetitions;
+        }
+
+    //! Get the wavenumber of the cosine wall
+    /*!
+     * \returns Wavenumber 2*pi*p/Lx of the cosine wall
+     */
+    HOSTDEVICE Scalar getWavenumber() const
+        {
+        return m_pi_period_div_L;
+        }
+
+    //! Get the wall boundary condition
+    /*!
+     * \returns Boundary condition at wall
+     */
+    HOSTDEVICE boundary getBoundaryCondition() const
+        {
+        return m_bc;
+        }
+
+    //! Get the phase of the wall cosine
+    /*!
+     * \returns Phase of the wall cosine
+     */
+    HOSTDEVICE Scalar getPhase() const
+        {
+        return m_phase;
+        }
+
+    //! Get the phase velocity of the wall cosine
+    /*!
+     * \returns Phase velocity of the wall cosine along x
+     */
+    HOSTDEVICE Scalar getPhaseVelocity() const
+        {
+        return m_phase_velocity;
+        }
+
+    //! Get the wall velocity
+    /*!
+     * \returns Velocity of the walls along x
+     */
+    HOSTDEVICE Scalar getVelocity() const
+        {
+        return m_V;
+        }
+
+#ifndef __HIPCC__
+    //! Get the unique name of this geometry
+    static std::string getName()
+        {
+        return std::string("CosineExpansionContraction");
+        }
+#endif // __HIPCC__
+
+    private:
+    //! Distance of a point on the particle trajectory outside a wall
+    /*!
+     * The trajectory is traced backwards in time from the current position, and the distance is
+     * positive when the point is outside the wall given by \a sign.
+     */
+    class WallDistance
+        {
+        public:
+        HOSTDEVICE WallDistance(const Scalar3& pos,
+                                const Scalar3& vel,
+                                signed char sign,
+                                Scalar amplitude,
+                                Scalar offset,
+                                Scalar k,
+                                Scalar phase)
+            : m_pos(pos), m_vel(vel), m_sign(sign), m_amplitude(amplitude), m_offset(offset),
+              m_k(k), m_phase(phase)
             {
-            return m_bc;
             }
 
-        #ifndef __HIPCC__
-        //! Get the unique name of this geometry
-        static std::string getName()
+        //! Evaluate the distance and its derivative at time \a s before the current position
+        HOSTDEVICE void operator()(Scalar s, Scalar& f, Scalar& df) const
             {
-            return std::string("CosineExpansionContraction");
+            Scalar sin_kx, cos_kx;
+            fast::sincos(m_k * (m_pos.x - s * m_vel.x) - m_phase, sin_kx, cos_kx);
+            f = m_sign * (m_pos.z - s * m_vel.z) - (m_amplitude * cos_kx + m_offset);
+            df = -m_sign * m_vel.z - m_amplitude * m_k * sin_kx * m_vel.x;
             }
-        #endif // __HIPCC__
 
-    private:
-        const Scalar m_pi_period_div_L;     //!< Argument of the wall cosine (pi*period/Lx = 2*pi*repetitions/Lx)
-        const Scalar m_H_wide;              //!< Half of the channel widest width
-        const Scalar m_H_narrow;            //!< Half of the channel narrowest width
-        const unsigned int m_Repetitions;         //!< Number of repetitions of the wide sections in the channel =  period
-        const mpcd::detail::boundary m_bc; //!< Boundary condition
+        private:
+        const Scalar3 m_pos;
+        const Scalar3 m_vel;
+        const signed char m_sign;
+        const Scalar m_amplitude;
+        const Scalar m_offset; //!< Offset of the wall cosine from z = 0
+        const Scalar m_k;
+        const Scalar m_phase;
+        };
+
+    Scalar m_pi_period_div_L;   //!< Wavenumber of the wall cosine (2*pi*repetitions/Lx)
+    Scalar m_H_wide;            //!< Half of the channel widest width
+    Scalar m_H_narrow;          //!< Half of the channel narrowest width
+    unsigned int m_repetitions; //!< Number of repetitions of the cosine in the box
+    boundary m_bc;              //!< Boundary condition
+    Scalar m_phase;             //!< Phase of the wall cosine
+    Scalar m_phase_velocity;    //!< Phase velocity of the wall cosine
+    Scalar m_V;                 //!< Velocity of the walls along x
     };
 
-} // end namespace mpcd
-} // end namespace hoomd
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
 #undef HOSTDEVICE
 
 #endif // MPCD_COSINE_EXPANSION_CONTRACTION_GEOMETRY_H_
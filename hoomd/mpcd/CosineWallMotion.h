@@ -0,0 +1,121 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/CosineWallMotion.h
+ * \brief Declaration of mpcd::CosineWallMotion
+ */
+
+#ifndef MPCD_COSINE_WALL_MOTION_H_
+#define MPCD_COSINE_WALL_MOTION_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "WallMotion.h"
+
+#include "hoomd/Variant.h"
+#include <pybind11/pybind11.h>
+
+#include <cmath>
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Moves the walls of a cosine geometry
+/*!
+ * \tparam Geometry The cosine geometry (CosineChannel or CosineExpansionContraction).
+ *
+ * The amplitude of the wall cosine, the phase velocity \a c of the wave traveling along x, and
+ * the velocity \a V of the walls along x are given by Variants of the timestep. The phase of the
+ * cosine is integrated from the phase velocity, \f$ d\phi/dt = k c \f$ with the wavenumber \a k,
+ * starting from the phase of the geometry. The phase is kept in \f$ [0, 2\pi) \f$ so that it does
+ * not lose precision in long simulations.
+ */
+template<class Geometry> class PYBIND11_EXPORT CosineWallMotion : public mpcd::WallMotion<Geometry>
+    {
+    public:
+    //! Constructor
+    /*!
+     * \param geom Geometry to copy and move
+     * \param timestep Current timestep
+     * \param amplitude Amplitude of the wall cosine
+     * \param phase_velocity Phase velocity of the wall cosine along x
+     * \param velocity Velocity of the walls along x
+     */
+    CosineWallMotion(std::shared_ptr<const Geometry> geom,
+                     uint64_t timestep,
+                     std::shared_ptr<Variant> amplitude,
+                     std::shared_ptr<Variant> phase_velocity,
+                     std::shared_ptr<Variant> velocity)
+        : mpcd::WallMotion<Geometry>(geom), m_amplitude(amplitude),
+          m_phase_velocity(phase_velocity), m_velocity(velocity), m_timestep(timestep),
+          m_phase(geom->getPhase())
+        {
+        setWallMotion();
+        }
+
+    //! Move the walls to a timestep
+    virtual void update(uint64_t timestep, Scalar dt);
+
+    private:
+    std::shared_ptr<Variant> m_amplitude;      //!< Amplitude of the wall cosine
+    std::shared_ptr<Variant> m_phase_velocity; //!< Phase velocity of the wall cosine
+    std::shared_ptr<Variant> m_velocity;       //!< Velocity of the walls
+    uint64_t m_timestep;                       //!< Timestep the walls were last moved to
+    Scalar m_phase;                            //!< Phase of the wall cosine
+
+    //! Set the parameters of the geometry at the current timestep
+    void setWallMotion()
+        {
+        this->m_geom->setWallMotion((*m_amplitude)(m_timestep),
+                                    m_phase,
+                                    (*m_phase_velocity)(m_timestep),
+                                    (*m_velocity)(m_timestep));
+        ++this->m_version;
+        }
+    };
+
+/*!
+ * \param timestep Timestep to move the walls to
+ * \param dt Time elapsed since the last timestep the walls were moved to
+ *
+ * The phase is advanced with the phase velocity at the last timestep. The walls do not move if
+ * they were already moved to \a timestep.
+ */
+template<class Geometry> void CosineWallMotion<Geometry>::update(uint64_t timestep, Scalar dt)
+    {
+    if (timestep == m_timestep)
+        return;
+
+    const Scalar two_pi = Scalar(2.0 * M_PI);
+    m_phase += this->m_geom->getWavenumber() * (*m_phase_velocity)(m_timestep) * dt;
+    m_phase -= two_pi * std::floor(m_phase / two_pi);
+    m_timestep = timestep;
+    setWallMotion();
+    }
+
+namespace detail
+    {
+//! Export mpcd::CosineWallMotion to python
+/*!
+ * \param m Python module to export to
+ */
+template<class Geometry> void export_CosineWallMotion(pybind11::module& m)
+    {
+    const std::string name = "CosineWallMotion" + Geometry::getName();
+    pybind11::class_<mpcd::CosineWallMotion<Geometry>,
+                     mpcd::WallMotion<Geometry>,
+                     std::shared_ptr<mpcd::CosineWallMotion<Geometry>>>(m, name.c_str())
+        .def(pybind11::init<std::shared_ptr<const Geometry>,
+                            uint64_t,
+                            std::shared_ptr<Variant>,
+                            std::shared_ptr<Variant>,
+                            std::shared_ptr<Variant>>());
+    }
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_COSINE_WALL_MOTION_H_
@@ -0,0 +1,361 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/EvaluatorExternalCosineWall.h
+ * \brief Defines the external potential evaluator for the walls of the MPCD cosine geometries
+ */
+
+#ifndef MPCD_EVALUATOR_EXTERNAL_COSINE_WALL_H_
+#define MPCD_EVALUATOR_EXTERNAL_COSINE_WALL_H_
+
+#include "BracketedRootFinder.h"
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/VectorMath.h"
+
+#ifndef __HIPCC__
+#include "CosineChannelGeometry.h"
+#include "CosineExpansionContractionGeometry.h"
+#include <pybind11/pybind11.h>
+#include <string>
+#endif // __HIPCC__
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__ inline
+#define DEVICE __device__
+#else
+#define HOSTDEVICE inline __attribute__((always_inline))
+#define DEVICE
+#endif // __HIPCC__
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace detail
+    {
+//! A wall of a cosine geometry, \f$ z = c + a \cos(k x) \f$
+struct cosine_wall_t
+    {
+    Scalar amplitude; //!< Amplitude a of the wall cosine
+    Scalar offset;    //!< Offset c of the wall cosine
+    Scalar side;      //!< +1 if the fluid is above the wall, -1 if it is below, 0 for no fluid
+    };
+
+//! Distance from a point to a cosine wall and its derivatives along the wall
+/*!
+ * The function is \f$ g(x') = (x' - x) + (f(x') - z) f'(x') \f$, which is half the derivative of
+ * the squared distance from (x, z) to the point (x', f(x')) on the wall. It is zero at the closest
+ * point on the wall.
+ */
+class CosineWallClosestPoint
+    {
+    public:
+    HOSTDEVICE CosineWallClosestPoint(Scalar x, Scalar z, const cosine_wall_t& wall, Scalar k)
+        : m_x(x), m_z(z), m_amplitude(wall.amplitude), m_offset(wall.offset), m_k(k)
+        {
+        }
+
+    //! Evaluate the squared distance to the point on the wall at \a xp
+    HOSTDEVICE Scalar distanceSquared(Scalar xp) const
+        {
+        const Scalar dx = m_x - xp;
+        const Scalar dz = m_z - m_offset - m_amplitude * fast::cos(m_k * xp);
+        return dx * dx + dz * dz;
+        }
+
+    //! Evaluate g and its derivative at \a xp
+    HOSTDEVICE void operator()(Scalar xp, Scalar& g, Scalar& dg) const
+        {
+        Scalar sin_kx, cos_kx;
+        fast::sincos(m_k * xp, sin_kx, cos_kx);
+        const Scalar dz = m_offset + m_amplitude * cos_kx - m_z;
+        const Scalar df = -m_amplitude * m_k * sin_kx;
+        const Scalar d2f = -m_amplitude * m_k * m_k * cos_kx;
+        g = (xp - m_x) + dz * df;
+        dg = Scalar(1) + df * df + dz * d2f;
+        }
+
+    private:
+    const Scalar m_x;         //!< Particle position along x
+    const Scalar m_z;         //!< Particle position along z
+    const Scalar m_amplitude; //!< Amplitude of the wall cosine
+    const Scalar m_offset;    //!< Offset of the wall cosine
+    const Scalar m_k;         //!< Wavenumber of the wall cosine
+    };
+
+//! Find the closest point on a cosine wall within a cutoff
+/*!
+ * \param dr Vector from the closest point on the wall to the particle (x and z only)
+ * \param pos Particle position
+ * \param wall Cosine wall
+ * \param k Wavenumber of the wall cosine
+ * \param r_cut Cutoff distance
+ *
+ * \returns True if the particle is on the fluid side of the wall and closer than \a r_cut to it
+ *
+ * The vertical distance to the wall bounds the distance to the closest point, so the closest point
+ * is within a window around the particle whose half width is the smaller of the vertical distance
+ * and \a r_cut. Particles whose vertical gap to the wall over the whole window exceeds the cutoff
+ * are rejected without a search. Otherwise, the squared distance is sampled at a fixed number of
+ * points in the window to find the basin of the global minimum, and the minimum is refined with
+ * the safeguarded Newton's method between the samples adjacent to the best one. The sampling
+ * matters on the concave side of strongly curved walls, where the particle can be close to two
+ * points of the wall with a maximum of the distance between them. The fixed amount of work keeps
+ * threads in a warp converged.
+ */
+HOSTDEVICE bool findCosineWallClosestPoint(Scalar3& dr,
+                                           const Scalar3& pos,
+                                           const cosine_wall_t& wall,
+                                           Scalar k,
+                                           Scalar r_cut)
+    {
+    // signed distance from the wall along z, positive on the fluid side. the wall height can only
+    // be closer to the particle than this by twice the amplitude anywhere along x.
+    const Scalar dz = wall.side * (pos.z - wall.offset - wall.amplitude * fast::cos(k * pos.x));
+    if (dz <= Scalar(0) || dz - Scalar(2) * fabs(wall.amplitude) > r_cut)
+        return false;
+
+    // window that must contain the closest point, and quick rejection on the vertical gap
+    const Scalar reach = (dz < r_cut) ? dz : r_cut;
+        {
+        const Scalar two_pi = Scalar(2.0 * M_PI);
+        const Scalar lo = (pos.x - reach) * k;
+        const Scalar hi = (pos.x + reach) * k;
+        const Scalar cos_lo = fast::cos(lo);
+        const Scalar cos_hi = fast::cos(hi);
+        Scalar cos_min = (cos_lo < cos_hi) ? cos_lo : cos_hi;
+        Scalar cos_max = (cos_lo > cos_hi) ? cos_lo : cos_hi;
+        if (slow::floor(hi / two_pi) * two_pi >= lo)
+            cos_max = Scalar(1);
+        if (slow::floor((hi - Scalar(M_PI)) / two_pi) * two_pi + Scalar(M_PI) >= lo)
+            cos_min = Scalar(-1);
+        // the wall height nearest to the particle is the maximum for the fluid above the wall
+        const Scalar nearest = (wall.side * wall.amplitude > Scalar(0)) ? cos_max : cos_min;
+        const Scalar gap = wall.side * (pos.z - wall.offset - wall.amplitude * nearest);
+        if (gap > r_cut)
+            return false;
+        }
+
+    // sample the squared distance to find the basin of the global minimum
+    const unsigned int num_intervals = 16;
+    const Scalar spacing = Scalar(2) * reach / num_intervals;
+    const CosineWallClosestPoint g(pos.x, pos.z, wall, k);
+    unsigned int best = 0;
+    Scalar best_rsq = g.distanceSquared(pos.x - reach);
+    for (unsigned int i = 1; i <= num_intervals; ++i)
+        {
+        const Scalar rsq = g.distanceSquared(pos.x - reach + i * spacing);
+        best = (rsq < best_rsq) ? i : best;
+        best_rsq = (rsq < best_rsq) ? rsq : best_rsq;
+        }
+
+    // refine the minimum between the neighbors of the best sample if they bracket it
+    Scalar xp = pos.x - reach + best * spacing;
+    const Scalar lo = pos.x - reach + ((best > 0) ? best - 1 : 0) * spacing;
+    const Scalar hi = pos.x - reach + ((best < num_intervals) ? best + 1 : num_intervals) * spacing;
+    Scalar g_lo, g_hi, dg;
+    g(lo, g_lo, dg);
+    g(hi, g_hi, dg);
+    if (g_lo < Scalar(0) && g_hi > Scalar(0))
+        {
+        const unsigned int max_iteration = 8;
+        const Scalar target_precision = 1e-6;
+        xp = findBracketedRoot(g, lo, g_lo, hi, g_hi, target_precision, max_iteration);
+        }
+
+    dr = make_scalar3(pos.x - xp,
+                      Scalar(0),
+                      pos.z - wall.offset - wall.amplitude * fast::cos(k * xp));
+    return dot(dr, dr) < r_cut * r_cut;
+    }
+
+    } // end namespace detail
+
+//! Evaluates a Weeks-Chandler-Andersen potential from the walls of the MPCD cosine geometries
+/*!
+ * The walls of the mpcd::detail::CosineChannel and mpcd::detail::CosineExpansionContraction
+ * geometries are both pairs of cosines \f$ z = c + a \cos(k x) \f$. Each particle on the fluid
+ * side of a wall interacts with it through
+ *
+ * \f[
+ * U(r) = 4 \varepsilon \left[ \left(\frac{\sigma}{r}\right)^{12}
+ *        - \left(\frac{\sigma}{r}\right)^6 \right] + \varepsilon, \quad r < 2^{1/6} \sigma
+ * \f]
+ *
+ * where \a r is the distance to the closest point on the wall. The force points along the vector
+ * from the closest point to the particle. Particles on the other side of a wall do not interact
+ * with it, like the walls in hoomd::md::EvaluatorWalls without extrapolation.
+ */
+class EvaluatorExternalCosineWall
+    {
+    public:
+    //! type of parameters this external potential accepts
+    struct param_type
+        {
+        Scalar epsilon; //!< Energy scale of the wall potential
+        Scalar sigma;   //!< Length scale of the wall potential
+
+#ifndef __HIPCC__
+        param_type() : epsilon(0), sigma(0) { }
+
+        param_type(pybind11::dict params)
+            {
+            epsilon = params["epsilon"].cast<Scalar>();
+            sigma = params["sigma"].cast<Scalar>();
+            }
+
+        pybind11::dict toPython()
+            {
+            pybind11::dict d;
+            d["epsilon"] = epsilon;
+            d["sigma"] = sigma;
+            return d;
+            }
+#endif
+        } __attribute__((aligned(16)));
+
+    //! The walls of the geometry
+    struct field_type
+        {
+        Scalar k;                     //!< Wavenumber of the wall cosines
+        detail::cosine_wall_t top;    //!< Top wall, with the fluid below it
+        detail::cosine_wall_t bottom; //!< Bottom wall, with the fluid above it
+
+#ifndef __HIPCC__
+        //! Default walls have no fluid side, so they do not interact with any particle
+        field_type()
+            : k(0), top {Scalar(0), Scalar(0), Scalar(0)}, bottom {Scalar(0), Scalar(0), Scalar(0)}
+            {
+            }
+
+        //! Take the walls from a cosine channel
+        void setGeometry(const detail::CosineChannel& geom)
+            {
+            k = geom.getWavenumber();
+            top = {geom.getAmplitude(), geom.getH(), Scalar(-1)};
+            bottom = {geom.getAmplitude(), -geom.getH(), Scalar(1)};
+            }
+
+        //! Take the walls from a cosine expansion-contraction channel
+        void setGeometry(const detail::CosineExpansionContraction& geom)
+            {
+            const Scalar A = Scalar(0.5) * (geom.getHwide() - geom.getHnarrow());
+            k = geom.getWavenumber();
+            top = {A, A + geom.getHnarrow(), Scalar(-1)};
+            bottom = {-A, -(A + geom.getHnarrow()), Scalar(1)};
+            }
+#endif
+        };
+
+    //! Constructs the evaluator
+    /*!
+     * \param X position of particle
+     * \param q orientation of particle
+     * \param box box dimensions
+     * \param params per-type parameters of external potential
+     * \param field walls of the geometry
+     */
+    DEVICE EvaluatorExternalCosineWall(Scalar3 X,
+                                       quat<Scalar> q,
+                                       const BoxDim& box,
+                                       const param_type& params,
+                                       const field_type& field)
+        : m_pos(X), m_params(params), m_field(field)
+        {
+        }
+
+    DEVICE static bool isAnisotropic()
+        {
+        return false;
+        }
+
+    //! Cosine walls don't need charges
+    DEVICE static bool needsCharge()
+        {
+        return false;
+        }
+
+    //! Accept the optional charge value.
+    /*! \param qi Charge of particle i
+     */
+    DEVICE void setCharge(Scalar qi) { }
+
+    //! Declares additional virial contributions are needed for the external field
+    DEVICE static bool requestFieldVirialTerm()
+        {
+        return false; // volume change dependence is not currently defined
+        }
+
+    //! Evaluate the force, energy and virial
+    /*! \param F force vector
+        \param T torque vector
+        \param energy value of the energy
+        \param virial array of six scalars for the upper triangular virial tensor
+    */
+    DEVICE void
+    evalForceTorqueEnergyAndVirial(Scalar3& F, Scalar3& T, Scalar& energy, Scalar* virial)
+        {
+        F = make_scalar3(0, 0, 0);
+        T = make_scalar3(0, 0, 0);
+        energy = Scalar(0.0);
+
+        if (m_params.epsilon != Scalar(0.0))
+            {
+            evalWall(F, energy, m_field.top);
+            evalWall(F, energy, m_field.bottom);
+            }
+
+        virial[0] = F.x * m_pos.x;
+        virial[1] = F.x * m_pos.y;
+        virial[2] = F.x * m_pos.z;
+        virial[3] = F.y * m_pos.y;
+        virial[4] = F.y * m_pos.z;
+        virial[5] = F.z * m_pos.z;
+        }
+
+#ifndef __HIPCC__
+    //! Get the name of this potential
+    /*! \returns The potential name.
+     */
+    static std::string getName()
+        {
+        return std::string("cosine_wall");
+        }
+#endif
+
+    protected:
+    Scalar3 m_pos;       //!< particle position
+    param_type m_params; //!< parameters of the wall potential
+    field_type m_field;  //!< walls of the geometry
+
+    //! Add the force and energy of one wall
+    DEVICE void evalWall(Scalar3& F, Scalar& energy, const detail::cosine_wall_t& wall)
+        {
+        // 2^(1/6)
+        const Scalar r_cut = Scalar(1.122462048309373) * m_params.sigma;
+        Scalar3 dr;
+        if (!detail::findCosineWallClosestPoint(dr, m_pos, wall, m_field.k, r_cut))
+            return;
+
+        const Scalar rsq = dot(dr, dr);
+        if (rsq == Scalar(0.0))
+            return;
+        const Scalar r2inv = Scalar(1.0) / rsq;
+        const Scalar sr2 = m_params.sigma * m_params.sigma * r2inv;
+        const Scalar sr6 = sr2 * sr2 * sr2;
+        const Scalar force_divr
+            = Scalar(48.0) * m_params.epsilon * r2inv * sr6 * (sr6 - Scalar(0.5));
+        F += force_divr * dr;
+        energy += Scalar(4.0) * m_params.epsilon * sr6 * (sr6 - Scalar(1.0)) + m_params.epsilon;
+        }
+    };
+
+    } // end namespace mpcd
+    } // end namespace hoomd
+#undef HOSTDEVICE
+#undef DEVICE
+
+#endif // MPCD_EVALUATOR_EXTERNAL_COSINE_WALL_H_
@@ -22,6 +22,118 @@ namespace hoomd
     {
 namespace mpcd
     {
+namespace detail
+    {
+//! Evaluator for mpcd::BlockForce
+class BlockForceEvaluator
+    {
+    public:
+    //! Constructor
+    /*!
+     * \param F Force on all particles.
+     * \param H Half-width between block regions.
+     * \param w Half-width of blocks.
+     */
+    HOSTDEVICE BlockForceEvaluator(Scalar F, Scalar H, Scalar w) : m_F(F)
+        {
+        m_H_plus_w = H + w;
+        m_H_minus_w = H - w;
+        }
+
+    //! Force evaluation method
+    /*!
+     * \param r Particle position.
+     * \returns Force on the particle.
+     */
+    HOSTDEVICE Scalar3 evaluate(const Scalar3& r) const
+        {
+        // sign = +1 if in top slab, -1 if in bottom slab, 0 if neither
+        const signed char sign = (char)((r.z >= m_H_minus_w && r.z < m_H_plus_w)
+                                        - (r.z >= -m_H_plus_w && r.z < -m_H_minus_w));
+        return make_scalar3(sign * m_F, 0, 0);
+        }
+
+    //! Check if there is a field to evaluate
+    HOSTDEVICE bool hasField() const
+        {
+        return true;
+        }
+
+    private:
+    Scalar m_F;         //!< Constant force
+    Scalar m_H_plus_w;  //!< Upper bound on upper block, H + w
+    Scalar m_H_minus_w; //!< Lower bound on upper block, H - w
+    };
+
+//! Evaluator for mpcd::ConstantForce
+class ConstantForceEvaluator
+    {
+    public:
+    //! Constructor
+    /*!
+     * \param F Force on all particles.
+     */
+    HOSTDEVICE ConstantForceEvaluator(Scalar3 F) : m_F(F) { }
+
+    //! Force evaluation method
+    /*!
+     * \param r Particle position.
+     * \returns Force on the particle.
+     *
+     * Since the force is constant, just the constant value is returned.
+     */
+    HOSTDEVICE Scalar3 evaluate(const Scalar3& r) const
+        {
+        return m_F;
+        }
+
+    //! Check if there is a field to evaluate
+    HOSTDEVICE bool hasField() const
+        {
+        return true;
+        }
+
+    private:
+    Scalar3 m_F; //!< Constant force
+    };
+
+//! Evaluator for mpcd::SineForce
+class SineForceEvaluator
+    {
+    public:
+    //! Constructor
+    /*!
+     * \param F Amplitude of the force.
+     * \param k Wavenumber for the force.
+     */
+    HOSTDEVICE SineForceEvaluator(Scalar F, Scalar k) : m_F(F), m_k(k) { }
+
+    //! Force evaluation method
+    /*!
+     * \param r Particle position.
+     * \returns Force on the particle.
+     *
+     * Specifies the force to act in x as a function of z. Fast math
+     * routines are used since this is probably sufficiently accurate,
+     * given the other numerical errors already present.
+     */
+    HOSTDEVICE Scalar3 evaluate(const Scalar3& r) const
+        {
+        return make_scalar3(m_F * fast::sin(m_k * r.z), 0, 0);
+        }
+
+    //! Check if there is a field to evaluate
+    HOSTDEVICE bool hasField() const
+        {
+        return true;
+        }
+
+    private:
+    Scalar m_F; //!< Force constant
+    Scalar m_k; //!< Wavenumber for force in z
+    };
+    } // end namespace detail
+
 //! External force field on MPCD particles.
 /*!
  * The external field specifies a force that acts on the MPCD particles.
@@ -35,6 +147,11 @@ namespace mpcd
  * export the field to python. Then, add the python class to construct it. See ConstantForce
  * as an example.
  *
+ * The GPU streaming kernels call the field through a non-polymorphic evaluator so that the force
+ * can be inlined. The fields implemented in HOOMD wrap an evaluator from mpcd::detail, which
+ * the streaming methods select by the type of the field. Any other field is called through
+ * mpcd::detail::PolymorphicFieldEvaluator instead.
+ *
  * \warning
  * Because of the way __HIPCC__ handles compilation (see ExternalField.cu), new ExternalFields
  * can only be implemented within HOOMD and \b NOT through the plugin interface.
@@ -55,6 +172,44 @@ class ExternalField
     HOSTDEVICE virtual Scalar3 evaluate(const Scalar3& r) const = 0;
     };
 
+namespace detail
+    {
+//! Evaluator that calls a polymorphic mpcd::ExternalField
+/*!
+ * This evaluator is used when the type of the field is not known at compile time, e.g., for a
+ * field that does not have its own evaluator. It holds a pointer to the field, which may be null
+ * if there is no field.
+ */
+class PolymorphicFieldEvaluator
+    {
+    public:
+    //! Constructor
+    /*!
+     * \param field Polymorphic field to evaluate (may be null)
+     */
+    HOSTDEVICE PolymorphicFieldEvaluator(const mpcd::ExternalField* field) : m_field(field) { }
+
+    //! Force evaluation method
+    /*!
+     * \param r Particle position.
+     * \returns Force on the particle.
+     */
+    HOSTDEVICE Scalar3 evaluate(const Scalar3& r) const
+        {
+        return m_field->evaluate(r);
+        }
+
+    //! Check if there is a field to evaluate
+    HOSTDEVICE bool hasField() const
+        {
+        return (m_field != nullptr);
+        }
+
+    private:
+    const mpcd::ExternalField* m_field; //!< Polymorphic field
+    };
+    } // end namespace detail
+
 //! Constant, opposite force applied to particles in a block
 /*!
  * Imposes a constant force in x as a function of position in z:
@@ -81,11 +236,7 @@ class BlockForce : public ExternalField
      * \param H Half-width between block regions.
      * \param w Half-width of blocks.
      */
-    HOSTDEVICE BlockForce(Scalar F, Scalar H, Scalar w) : m_F(F)
-        {
-        m_H_plus_w = H + w;
-        m_H_minus_w = H - w;
-        }
+    HOSTDEVICE BlockForce(Scalar F, Scalar H, Scalar w) : m_evaluator(F, H, w) { }
 
     //! Force evaluation method
     /*!
@@ -94,16 +245,17 @@ class BlockForce : public ExternalField
      */
     HOSTDEVICE virtual Scalar3 evaluate(const Scalar3& r) const override
         {
-        // sign = +1 if in top slab, -1 if in bottom slab, 0 if neither
-        const signed char sign = (char)((r.z >= m_H_minus_w && r.z < m_H_plus_w)
-                                        - (r.z >= -m_H_plus_w && r.z < -m_H_minus_w));
-        return make_scalar3(sign * m_F, 0, 0);
+        return m_evaluator.evaluate(r);
+        }
+
+    //! Get the evaluator for the force
+    HOSTDEVICE const detail::BlockForceEvaluator& getEvaluator() const
+        {
+        return m_evaluator;
         }
 
     private:
-    Scalar m_F;         //!< Constant force
-    Scalar m_H_plus_w;  //!< Upper bound on upper block, H + w
-    Scalar m_H_minus_w; //!< Lower bound on upper block, H - w
+    detail::BlockForceEvaluator m_evaluator; //!< Evaluator for the force
     };
 
 //! Constant force on all particles
@@ -114,7 +266,7 @@ class ConstantForce : public ExternalField
     /*!
      * \param F Force on all particles.
      */
-    HOSTDEVICE ConstantForce(Scalar3 F) : m_F(F) { }
+    HOSTDEVICE ConstantForce(Scalar3 F) : m_evaluator(F) { }
 
     //! Force evaluation method
     /*!
@@ -126,11 +278,17 @@ class ConstantForce : public ExternalField
      */
     HOSTDEVICE virtual Scalar3 evaluate(const Scalar3& r) const override
         {
-        return m_F;
+        return m_evaluator.evaluate(r);
+        }
+
+    //! Get the evaluator for the force
+    HOSTDEVICE const detail::ConstantForceEvaluator& getEvaluator() const
+        {
+        return m_evaluator;
         }
 
     private:
-    Scalar3 m_F; //!< Constant force
+    detail::ConstantForceEvaluator m_evaluator; //!< Evaluator for the force
     };
 
 //! Shearing sine force
@@ -150,7 +308,7 @@ class SineForce : public ExternalField
      * \param F Amplitude of the force.
      * \param k Wavenumber for the force.
      */
-    HOSTDEVICE SineForce(Scalar F, Scalar k) : m_F(F), m_k(k) { }
+    HOSTDEVICE SineForce(Scalar F, Scalar k) : m_evaluator(F, k) { }
 
     //! Force evaluation method
     /*!
@@ -163,12 +321,17 @@ class SineForce : public ExternalField
      */
     HOSTDEVICE virtual Scalar3 evaluate(const Scalar3& r) const override
         {
-        return make_scalar3(m_F * fast::sin(m_k * r.z), 0, 0);
+        return m_evaluator.evaluate(r);
+        }
+
+    //! Get the evaluator for the force
+    HOSTDEVICE const detail::SineForceEvaluator& getEvaluator() const
+        {
+        return m_evaluator;
         }
 
     private:
-    Scalar m_F; //!< Force constant
-    Scalar m_k; //!< Wavenumber for force in z
+    detail::SineForceEvaluator m_evaluator; //!< Evaluator for the force
     };
 
 #ifndef __HIPCC__
@@ -0,0 +1,301 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/FlowFieldAnalyzer.cc
+ * \brief Definition of mpcd::FlowFieldAnalyzer
+ */
+
+#include "FlowFieldAnalyzer.h"
+
+#include <pybind11/numpy.h>
+
+namespace hoomd
+    {
+/*!
+ * \param sysdef System definition
+ * \param trigger Trigger for sampling the flow field
+ * \param nx Number of bins along the first lattice vector
+ * \param ny Number of bins along the second lattice vector
+ * \param nz Number of bins along the third lattice vector
+ * \param num_samples Number of samples in each averaging window
+ */
+mpcd::FlowFieldAnalyzer::FlowFieldAnalyzer(std::shared_ptr<SystemDefinition> sysdef,
+                                           std::shared_ptr<Trigger> trigger,
+                                           unsigned int nx,
+                                           unsigned int ny,
+                                           unsigned int nz,
+                                           unsigned int num_samples)
+    : Analyzer(sysdef, trigger), m_mpcd_pdata(sysdef->getMPCDParticleData()),
+      m_num_bins(make_uint3(nx, ny, nz)), m_num_samples(num_samples), m_sample(0),
+      m_num_windows(0)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing MPCD FlowFieldAnalyzer" << std::endl;
+
+    if (nx == 0 || ny == 0 || nz == 0)
+        {
+        m_exec_conf->msg->error() << "mpcd: flow field must have at least 1 bin in each direction"
+                                  << std::endl;
+        throw std::runtime_error("Invalid number of flow field bins");
+        }
+    if (num_samples == 0)
+        {
+        m_exec_conf->msg->error() << "mpcd: flow field must average at least 1 sample"
+                                  << std::endl;
+        throw std::runtime_error("Invalid number of flow field samples");
+        }
+
+    const unsigned int num_bins = nx * ny * nz;
+    GPUArray<double4> bin_vel(num_bins, m_exec_conf);
+    m_bin_vel.swap(bin_vel);
+    GPUArray<double> bin_vsq(num_bins, m_exec_conf);
+    m_bin_vsq.swap(bin_vsq);
+    resetAccumulators();
+    }
+
+mpcd::FlowFieldAnalyzer::~FlowFieldAnalyzer()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying MPCD FlowFieldAnalyzer" << std::endl;
+    }
+
+/*!
+ * \param timestep Current timestep
+ *
+ * The flow field is finalized after every \a num_samples calls.
+ */
+void mpcd::FlowFieldAnalyzer::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+
+    accumulate();
+    if (++m_sample == m_num_samples)
+        {
+        finalize();
+        }
+    }
+
+void mpcd::FlowFieldAnalyzer::accumulate()
+    {
+    const mpcd::detail::FlowFieldBins bins(m_pdata->getGlobalBox(), m_num_bins);
+
+    ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<double4> h_bin_vel(m_bin_vel, access_location::host, access_mode::readwrite);
+    ArrayHandle<double> h_bin_vsq(m_bin_vsq, access_location::host, access_mode::readwrite);
+
+    for (unsigned int idx = 0; idx < m_mpcd_pdata->getN(); ++idx)
+        {
+        const SolventScalar4 postype = h_pos.data[idx];
+        const unsigned int bin = bins.getBin(make_scalar3(postype.x, postype.y, postype.z));
+
+        const SolventScalar4 vel_cell = h_vel.data[idx];
+        const double3 vel = make_double3(vel_cell.x, vel_cell.y, vel_cell.z);
+        double4& bin_vel = h_bin_vel.data[bin];
+        bin_vel.x += vel.x;
+        bin_vel.y += vel.y;
+        bin_vel.z += vel.z;
+        bin_vel.w += 1.0;
+        h_bin_vsq.data[bin] += vel.x * vel.x + vel.y * vel.y + vel.z * vel.z;
+        }
+    }
+
+void mpcd::FlowFieldAnalyzer::resetAccumulators()
+    {
+    ArrayHandle<double4> h_bin_vel(m_bin_vel, access_location::host, access_mode::overwrite);
+    ArrayHandle<double> h_bin_vsq(m_bin_vsq, access_location::host, access_mode::overwrite);
+    memset(h_bin_vel.data, 0, sizeof(double4) * m_bin_vel.getNumElements());
+    memset(h_bin_vsq.data, 0, sizeof(double) * m_bin_vsq.getNumElements());
+    }
+
+/*!
+ * \returns Volume of each bin
+ *
+ * The bins divide the global box evenly, so they all have the same volume.
+ */
+std::vector<Scalar> mpcd::FlowFieldAnalyzer::getBinVolumes() const
+    {
+    const unsigned int ndim = m_sysdef->getNDimensions();
+    const unsigned int num_bins = m_num_bins.x * m_num_bins.y * m_num_bins.z;
+    return std::vector<Scalar>(num_bins,
+                               m_pdata->getGlobalBox().getVolume(ndim == 2) / num_bins);
+    }
+
+/*!
+ * The sums are packed into one buffer so that they are reduced onto the root rank with a single
+ * MPI call. This is also the only time they are copied from the GPU.
+ */
+void mpcd::FlowFieldAnalyzer::finalize()
+    {
+    const unsigned int num_bins = m_num_bins.x * m_num_bins.y * m_num_bins.z;
+    std::vector<double> sums(5 * num_bins);
+        {
+        ArrayHandle<double4> h_bin_vel(m_bin_vel, access_location::host, access_mode::read);
+        ArrayHandle<double> h_bin_vsq(m_bin_vsq, access_location::host, access_mode::read);
+        for (unsigned int bin = 0; bin < num_bins; ++bin)
+            {
+            const double4 bin_vel = h_bin_vel.data[bin];
+            sums[5 * bin] = bin_vel.x;
+            sums[5 * bin + 1] = bin_vel.y;
+            sums[5 * bin + 2] = bin_vel.z;
+            sums[5 * bin + 3] = bin_vel.w;
+            sums[5 * bin + 4] = h_bin_vsq.data[bin];
+            }
+        }
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+        if (m_exec_conf->isRoot())
+            {
+            MPI_Reduce(MPI_IN_PLACE,
+                       sums.data(),
+                       static_cast<int>(sums.size()),
+                       MPI_DOUBLE,
+                       MPI_SUM,
+                       0,
+                       mpi_comm);
+            }
+        else
+            {
+            MPI_Reduce(sums.data(),
+                       nullptr,
+                       static_cast<int>(sums.size()),
+                       MPI_DOUBLE,
+                       MPI_SUM,
+                       0,
+                       mpi_comm);
+            }
+        }
+#endif // ENABLE_MPI
+
+    if (m_exec_conf->isRoot())
+        {
+        const unsigned int ndim = m_sysdef->getNDimensions();
+        const std::vector<Scalar> bin_volume = getBinVolumes();
+        const Scalar mass = m_mpcd_pdata->getMass();
+
+        m_density.resize(num_bins);
+        m_velocity.resize(num_bins);
+        m_temperature.resize(num_bins);
+        for (unsigned int bin = 0; bin < num_bins; ++bin)
+            {
+            const double count = sums[5 * bin + 3];
+            m_density[bin] = Scalar(count / (m_num_samples * bin_volume[bin]));
+            if (count > 0)
+                {
+                const double3 vel = make_double3(sums[5 * bin] / count,
+                                                 sums[5 * bin + 1] / count,
+                                                 sums[5 * bin + 2] / count);
+                const double vsq = sums[5 * bin + 4] / count;
+                m_velocity[bin] = make_scalar3(vel.x, vel.y, vel.z);
+                m_temperature[bin] = Scalar(
+                    mass * (vsq - (vel.x * vel.x + vel.y * vel.y + vel.z * vel.z)) / ndim);
+                }
+            else
+                {
+                m_velocity[bin] = make_scalar3(0, 0, 0);
+                m_temperature[bin] = Scalar(0);
+                }
+            }
+        }
+
+    ++m_num_windows;
+    m_sample = 0;
+    resetAccumulators();
+    }
+
+namespace mpcd
+    {
+namespace detail
+    {
+namespace
+    {
+//! Copy a flow field into a numpy array
+/*!
+ * \param data Flow field in each bin, with \a ncomp components per bin
+ * \param num_bins Number of bins along each lattice vector
+ * \param ncomp Number of components per bin
+ * \returns Array with shape (nx, ny, nz) if \a ncomp is 1, and (nx, ny, nz, ncomp) otherwise
+ *
+ * The bins are indexed by Index3D, so the first index is the fastest-varying one.
+ */
+pybind11::array_t<Scalar> toArray(const Scalar* data, const uint3& num_bins, unsigned int ncomp)
+    {
+    if (!data)
+        return pybind11::array_t<Scalar>();
+
+    std::vector<size_t> shape = {num_bins.x, num_bins.y, num_bins.z};
+    const size_t s = sizeof(Scalar) * ncomp;
+    std::vector<size_t> strides = {s, s * num_bins.x, s * num_bins.x * num_bins.y};
+    if (ncomp > 1)
+        {
+        shape.push_back(ncomp);
+        strides.push_back(sizeof(Scalar));
+        }
+    return pybind11::array_t<Scalar>(shape, strides, data);
+    }
+    } // end namespace
+
+/*!
+ * \param m Python module to export to
+ *
+ * The flow fields are returned as copies with shape (nx, ny, nz) for scalars and (nx, ny, nz, 3)
+ * for vectors. They are empty until an averaging window has finished, and on ranks other than the
+ * root rank.
+ */
+void export_FlowFieldAnalyzer(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::FlowFieldAnalyzer, Analyzer, std::shared_ptr<mpcd::FlowFieldAnalyzer>>(
+        m,
+        "FlowFieldAnalyzer")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            unsigned int,
+                            unsigned int,
+                            unsigned int,
+                            unsigned int>())
+        .def_property_readonly("num_bins",
+                               [](const mpcd::FlowFieldAnalyzer& self)
+                               {
+                                   const uint3 n = self.getNumBins();
+                                   return pybind11::make_tuple(n.x, n.y, n.z);
+                               })
+        .def_property_readonly("num_samples", &mpcd::FlowFieldAnalyzer::getNumSamples)
+        .def_property_readonly("num_windows", &mpcd::FlowFieldAnalyzer::getNumWindows)
+        .def_property_readonly("density",
+                               [](const mpcd::FlowFieldAnalyzer& self)
+                               {
+                                   const auto& density = self.getDensity();
+                                   return toArray(density.empty() ? nullptr : density.data(),
+                                                  self.getNumBins(),
+                                                  1);
+                               })
+        .def_property_readonly(
+            "velocity",
+            [](const mpcd::FlowFieldAnalyzer& self)
+            {
+                const auto& velocity = self.getVelocity();
+                return toArray(velocity.empty()
+                                   ? nullptr
+                                   : reinterpret_cast<const Scalar*>(velocity.data()),
+                               self.getNumBins(),
+                               3);
+            })
+        .def_property_readonly("temperature",
+                               [](const mpcd::FlowFieldAnalyzer& self)
+                               {
+                                   const auto& temperature = self.getTemperature();
+                                   return toArray(temperature.empty() ? nullptr
+                                                                      : temperature.data(),
+                                                  self.getNumBins(),
+                                                  1);
+                               });
+    }
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
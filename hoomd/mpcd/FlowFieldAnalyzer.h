@@ -0,0 +1,140 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/FlowFieldAnalyzer.h
+ * \brief Declaration of mpcd::FlowFieldAnalyzer
+ */
+
+#ifndef MPCD_FLOW_FIELD_ANALYZER_H_
+#define MPCD_FLOW_FIELD_ANALYZER_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "FlowFieldBins.h"
+#include "ParticleData.h"
+
+#include "hoomd/Analyzer.h"
+#include "hoomd/GPUArray.h"
+#include <pybind11/pybind11.h>
+
+#include <vector>
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Accumulates time-averaged flow fields of the MPCD particles
+/*!
+ * The MPCD particles are binned on a regular grid (see mpcd::detail::FlowFieldBins) each time the
+ * analyzer is triggered, and the number of particles, their velocity, and their squared velocity
+ * are summed in each bin. The sums stay in device memory (on the GPU) until \a num_samples samples
+ * have been accumulated. They are then reduced onto the root rank in one MPI call and converted to
+ * the number density, mean velocity, and temperature in each bin, and accumulation restarts.
+ *
+ * The temperature is computed from the velocity fluctuations about the time-averaged velocity of
+ * the bin (with \f$k_{\rm B} = 1\f$). It includes any fluctuations of that velocity during the
+ * averaging window. Only the real MPCD particles are counted, so the virtual particles that fill
+ * the walls do not contribute to the flow field.
+ */
+class PYBIND11_EXPORT FlowFieldAnalyzer : public Analyzer
+    {
+    public:
+    //! Constructor
+    FlowFieldAnalyzer(std::shared_ptr<SystemDefinition> sysdef,
+                      std::shared_ptr<Trigger> trigger,
+                      unsigned int nx,
+                      unsigned int ny,
+                      unsigned int nz,
+                      unsigned int num_samples);
+
+    //! Destructor
+    virtual ~FlowFieldAnalyzer();
+
+    //! Accumulate the flow field
+    virtual void analyze(uint64_t timestep);
+
+    //! Get the number of bins along each lattice vector
+    uint3 getNumBins() const
+        {
+        return m_num_bins;
+        }
+
+    //! Get the number of samples in each averaging window
+    unsigned int getNumSamples() const
+        {
+        return m_num_samples;
+        }
+
+    //! Get the number of averaging windows that have finished
+    unsigned int getNumWindows() const
+        {
+        return m_num_windows;
+        }
+
+    //! Get the number density in each bin from the last averaging window
+    /*!
+     * \returns Number density, which is only valid on the root rank
+     */
+    const std::vector<Scalar>& getDensity() const
+        {
+        return m_density;
+        }
+
+    //! Get the mean velocity in each bin from the last averaging window
+    /*!
+     * \returns Velocity, which is only valid on the root rank
+     */
+    const std::vector<Scalar3>& getVelocity() const
+        {
+        return m_velocity;
+        }
+
+    //! Get the temperature in each bin from the last averaging window
+    /*!
+     * \returns Temperature, which is only valid on the root rank
+     */
+    const std::vector<Scalar>& getTemperature() const
+        {
+        return m_temperature;
+        }
+
+    protected:
+    std::shared_ptr<mpcd::ParticleData> m_mpcd_pdata; //!< MPCD particle data
+
+    const uint3 m_num_bins;           //!< Number of bins along each lattice vector
+    const unsigned int m_num_samples; //!< Number of samples in each averaging window
+    unsigned int m_sample;            //!< Number of samples in the current window
+    unsigned int m_num_windows;       //!< Number of averaging windows that have finished
+
+    GPUArray<double4> m_bin_vel; //!< Summed velocity and number of particles in each bin
+    GPUArray<double> m_bin_vsq;  //!< Summed squared velocity in each bin
+
+    std::vector<Scalar> m_density;     //!< Number density in each bin
+    std::vector<Scalar3> m_velocity;   //!< Mean velocity in each bin
+    std::vector<Scalar> m_temperature; //!< Temperature in each bin
+
+    //! Add the current particles to the sums in each bin
+    virtual void accumulate();
+
+    //! Zero the sums in each bin
+    virtual void resetAccumulators();
+
+    //! Get the volume of each bin
+    virtual std::vector<Scalar> getBinVolumes() const;
+
+    //! Reduce the sums and compute the flow field in each bin
+    void finalize();
+    };
+
+namespace detail
+    {
+//! Export the mpcd::FlowFieldAnalyzer to python
+void export_FlowFieldAnalyzer(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+
+#endif // MPCD_FLOW_FIELD_ANALYZER_H_
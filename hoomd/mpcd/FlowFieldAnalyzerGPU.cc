@@ -0,0 +1,86 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/FlowFieldAnalyzerGPU.cc
+ * \brief Definition of mpcd::FlowFieldAnalyzerGPU
+ */
+
+#include "FlowFieldAnalyzerGPU.h"
+#include "FlowFieldAnalyzerGPU.cuh"
+
+namespace hoomd
+    {
+/*!
+ * \param sysdef System definition
+ * \param trigger Trigger for sampling the flow field
+ * \param nx Number of bins along the first lattice vector
+ * \param ny Number of bins along the second lattice vector
+ * \param nz Number of bins along the third lattice vector
+ * \param num_samples Number of samples in each averaging window
+ */
+mpcd::FlowFieldAnalyzerGPU::FlowFieldAnalyzerGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                                 std::shared_ptr<Trigger> trigger,
+                                                 unsigned int nx,
+                                                 unsigned int ny,
+                                                 unsigned int nz,
+                                                 unsigned int num_samples)
+    : mpcd::FlowFieldAnalyzer(sysdef, trigger, nx, ny, nz, num_samples)
+    {
+    m_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                   m_exec_conf,
+                                   "mpcd_flow_field"));
+    m_autotuners.push_back(m_tuner);
+    }
+
+void mpcd::FlowFieldAnalyzerGPU::accumulate()
+    {
+    const mpcd::detail::FlowFieldBins bins(m_pdata->getGlobalBox(), m_num_bins);
+
+    ArrayHandle<SolventScalar4> d_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::device,
+                                      access_mode::read);
+    ArrayHandle<SolventScalar4> d_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::device,
+                                      access_mode::read);
+    ArrayHandle<double4> d_bin_vel(m_bin_vel, access_location::device, access_mode::readwrite);
+    ArrayHandle<double> d_bin_vsq(m_bin_vsq, access_location::device, access_mode::readwrite);
+
+    m_tuner->begin();
+    mpcd::gpu::flow_field_accumulate(d_bin_vel.data,
+                                     d_bin_vsq.data,
+                                     d_pos.data,
+                                     d_vel.data,
+                                     bins,
+                                     m_mpcd_pdata->getN(),
+                                     m_tuner->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner->end();
+    }
+
+void mpcd::FlowFieldAnalyzerGPU::resetAccumulators()
+    {
+    ArrayHandle<double4> d_bin_vel(m_bin_vel, access_location::device, access_mode::overwrite);
+    ArrayHandle<double> d_bin_vsq(m_bin_vsq, access_location::device, access_mode::overwrite);
+    hipMemset(d_bin_vel.data, 0, sizeof(double4) * m_bin_vel.getNumElements());
+    hipMemset(d_bin_vsq.data, 0, sizeof(double) * m_bin_vsq.getNumElements());
+    }
+
+/*!
+ * \param m Python module to export to
+ */
+void mpcd::detail::export_FlowFieldAnalyzerGPU(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::FlowFieldAnalyzerGPU,
+                     mpcd::FlowFieldAnalyzer,
+                     std::shared_ptr<mpcd::FlowFieldAnalyzerGPU>>(m, "FlowFieldAnalyzerGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            unsigned int,
+                            unsigned int,
+                            unsigned int,
+                            unsigned int>());
+    }
+
+    } // end namespace hoomd
@@ -0,0 +1,99 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/FlowFieldAnalyzerGPU.cu
+ * \brief Defines GPU functions and kernels used by mpcd::FlowFieldAnalyzerGPU
+ */
+
+#include "FlowFieldAnalyzerGPU.cuh"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace gpu
+    {
+namespace kernel
+    {
+/*!
+ * \param d_bin_vel Summed velocity and number of particles in each bin
+ * \param d_bin_vsq Summed squared velocity in each bin
+ * \param d_pos Particle positions
+ * \param d_vel Particle velocities
+ * \param bins Flow field bins
+ * \param N Number of particles
+ *
+ * \b Implementation:
+ *
+ * Using one thread per particle, the particle is binned and its velocity is added to the sums of
+ * its bin with atomic operations.
+ */
+__global__ void flow_field_accumulate(double4* d_bin_vel,
+                                      double* d_bin_vsq,
+                                      const SolventScalar4* d_pos,
+                                      const SolventScalar4* d_vel,
+                                      const mpcd::detail::FlowFieldBins bins,
+                                      const unsigned int N)
+    {
+    // one thread per particle
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    const SolventScalar4 postype = d_pos[idx];
+    const unsigned int bin = bins.getBin(make_scalar3(postype.x, postype.y, postype.z));
+
+    const SolventScalar4 vel_cell = d_vel[idx];
+    const double3 vel = make_double3(vel_cell.x, vel_cell.y, vel_cell.z);
+    double* bin_vel = reinterpret_cast<double*>(d_bin_vel + bin);
+    atomicAdd(bin_vel, vel.x);
+    atomicAdd(bin_vel + 1, vel.y);
+    atomicAdd(bin_vel + 2, vel.z);
+    atomicAdd(bin_vel + 3, 1.0);
+    atomicAdd(d_bin_vsq + bin, vel.x * vel.x + vel.y * vel.y + vel.z * vel.z);
+    }
+    } // end namespace kernel
+
+/*!
+ * \param d_bin_vel Summed velocity and number of particles in each bin
+ * \param d_bin_vsq Summed squared velocity in each bin
+ * \param d_pos Particle positions
+ * \param d_vel Particle velocities
+ * \param bins Flow field bins
+ * \param N Number of particles
+ * \param block_size Number of threads per block
+ *
+ * \sa kernel::flow_field_accumulate
+ */
+cudaError_t flow_field_accumulate(double4* d_bin_vel,
+                                  double* d_bin_vsq,
+                                  const SolventScalar4* d_pos,
+                                  const SolventScalar4* d_vel,
+                                  const mpcd::detail::FlowFieldBins& bins,
+                                  const unsigned int N,
+                                  const unsigned int block_size)
+    {
+    if (N == 0)
+        return cudaSuccess;
+
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)kernel::flow_field_accumulate);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid(N / run_block_size + 1);
+    kernel::flow_field_accumulate<<<grid, run_block_size>>>(d_bin_vel,
+                                                            d_bin_vsq,
+                                                            d_pos,
+                                                            d_vel,
+                                                            bins,
+                                                            N);
+
+    return cudaSuccess;
+    }
+
+    } // end namespace gpu
+    } // end namespace mpcd
+    } // end namespace hoomd
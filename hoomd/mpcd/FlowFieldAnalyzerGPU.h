@@ -0,0 +1,57 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/FlowFieldAnalyzerGPU.h
+ * \brief Declaration of mpcd::FlowFieldAnalyzerGPU
+ */
+
+#ifndef MPCD_FLOW_FIELD_ANALYZER_GPU_H_
+#define MPCD_FLOW_FIELD_ANALYZER_GPU_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "FlowFieldAnalyzer.h"
+#include "hoomd/Autotuner.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Accumulates time-averaged flow fields of the MPCD particles on the GPU
+/*!
+ * See mpcd::FlowFieldAnalyzer for design details.
+ */
+class PYBIND11_EXPORT FlowFieldAnalyzerGPU : public mpcd::FlowFieldAnalyzer
+    {
+    public:
+    //! Constructor
+    FlowFieldAnalyzerGPU(std::shared_ptr<SystemDefinition> sysdef,
+                         std::shared_ptr<Trigger> trigger,
+                         unsigned int nx,
+                         unsigned int ny,
+                         unsigned int nz,
+                         unsigned int num_samples);
+
+    protected:
+    //! Add the current particles to the sums in each bin on the GPU
+    virtual void accumulate();
+
+    //! Zero the sums in each bin on the GPU
+    virtual void resetAccumulators();
+
+    private:
+    std::shared_ptr<Autotuner<1>> m_tuner; //!< Kernel tuner
+    };
+
+namespace detail
+    {
+//! Export the mpcd::FlowFieldAnalyzerGPU to python
+void export_FlowFieldAnalyzerGPU(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+
+#endif // MPCD_FLOW_FIELD_ANALYZER_GPU_H_
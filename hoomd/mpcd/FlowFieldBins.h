@@ -0,0 +1,97 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/FlowFieldBins.h
+ * \brief Defines mpcd::detail::FlowFieldBins
+ */
+
+#ifndef MPCD_FLOW_FIELD_BINS_H_
+#define MPCD_FLOW_FIELD_BINS_H_
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/Index1D.h"
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__ inline
+#else
+#define HOSTDEVICE inline __attribute__((always_inline))
+#endif
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace detail
+    {
+//! Regular bins for accumulating a flow field
+/*!
+ * The global simulation box is divided into a regular grid of bins along its lattice vectors.
+ * Using only one bin along a direction averages the flow field along it, so 1D and 2D profiles are
+ * obtained by setting the number of bins in the other directions to 1. The bins are defined in
+ * fractional coordinates, so they follow the box if it changes. The bins are indexed by Index3D.
+ */
+class FlowFieldBins
+    {
+    public:
+    //! Constructor
+    /*!
+     * \param global_box Global simulation box
+     * \param num_bins Number of bins along each lattice vector
+     */
+    HOSTDEVICE FlowFieldBins(const BoxDim& global_box, const uint3& num_bins)
+        : m_global_box(global_box), m_num_bins(num_bins),
+          m_bin_indexer(num_bins.x, num_bins.y, num_bins.z)
+        {
+        }
+
+    //! Get the bin of a particle
+    /*!
+     * \param pos Particle position
+     * \returns Index of the bin that contains \a pos
+     *
+     * Particles that are slightly outside the box because of roundoff are put into the nearest
+     * bin.
+     */
+    HOSTDEVICE unsigned int getBin(const Scalar3& pos) const
+        {
+        const Scalar3 f = m_global_box.makeFraction(pos);
+        const int3 bin = make_int3(static_cast<int>(f.x * m_num_bins.x),
+                                   static_cast<int>(f.y * m_num_bins.y),
+                                   static_cast<int>(f.z * m_num_bins.z));
+        return m_bin_indexer(clampBin(bin.x, m_num_bins.x),
+                             clampBin(bin.y, m_num_bins.y),
+                             clampBin(bin.z, m_num_bins.z));
+        }
+
+    //! Get the bin indexer
+    HOSTDEVICE const Index3D& getBinIndexer() const
+        {
+        return m_bin_indexer;
+        }
+
+    private:
+    const BoxDim m_global_box;   //!< Global simulation box
+    const uint3 m_num_bins;      //!< Number of bins along each lattice vector
+    const Index3D m_bin_indexer; //!< Indexer for the bins
+
+    //! Clamp a bin index into the range [0, \a num_bins)
+    HOSTDEVICE static unsigned int clampBin(int bin, unsigned int num_bins)
+        {
+        if (bin < 0)
+            return 0;
+        else if (bin >= static_cast<int>(num_bins))
+            return num_bins - 1;
+        else
+            return bin;
+        }
+    };
+
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+
+#undef HOSTDEVICE
+
+#endif // MPCD_FLOW_FIELD_BINS_H_
@@ -0,0 +1,426 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/GSDWriter.cc
+ * \brief Definition of mpcd::GSDWriter
+ */
+
+#include "GSDWriter.h"
+
+#include "HOOMDVersion.h"
+#include "hoomd/Filesystem.h"
+#include "hoomd/GSD.h"
+
+#include <pybind11/stl.h>
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+namespace hoomd
+    {
+/*!
+ * \param sysdef System definition
+ * \param trigger Trigger for writing frames
+ * \param fname File name
+ * \param mode File open mode: "wb" (overwrite), "xb" (create), or "ab" (append)
+ *
+ * All fields are written for every particle by default.
+ */
+mpcd::GSDWriter::GSDWriter(std::shared_ptr<SystemDefinition> sysdef,
+                           std::shared_ptr<Trigger> trigger,
+                           const std::string& fname,
+                           const std::string& mode)
+    : Analyzer(sysdef, trigger), m_mpcd_pdata(sysdef->getMPCDParticleData()), m_fname(fname),
+      m_mode(mode), m_stride(1), m_use_region(false), m_region_lo(make_scalar3(0, 0, 0)),
+      m_region_hi(make_scalar3(0, 0, 0)), m_write_position(true), m_write_velocity(true),
+      m_write_typeid(true), m_write_tag(true)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing MPCD GSDWriter: " << fname << " " << mode
+                                << std::endl;
+
+    if (mode != "wb" && mode != "xb" && mode != "ab")
+        {
+        m_exec_conf->msg->error() << "mpcd: invalid GSD file mode " << mode << std::endl;
+        throw std::invalid_argument("Invalid GSD file mode: " + mode);
+        }
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        m_gather_tag_order = GatherTagOrder(m_exec_conf->getMPICommunicator());
+        }
+#endif // ENABLE_MPI
+
+    openFile();
+    }
+
+mpcd::GSDWriter::~GSDWriter()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying MPCD GSDWriter" << std::endl;
+    if (m_exec_conf->isRoot())
+        {
+        gsd_close(&m_handle);
+        }
+    }
+
+void mpcd::GSDWriter::openFile()
+    {
+    if (!m_exec_conf->isRoot())
+        return;
+
+    if (m_mode == "ab" && filesystem::exists(m_fname))
+        {
+        m_exec_conf->msg->notice(3) << "mpcd: open gsd file " << m_fname << std::endl;
+        int retval = gsd_open(&m_handle, m_fname.c_str(), GSD_OPEN_APPEND);
+        hoomd::detail::GSDUtils::checkError(retval, m_fname);
+
+        if (std::string(m_handle.header.schema) != std::string("hoomd")
+            || m_handle.header.schema_version >= gsd_make_version(2, 0))
+            {
+            gsd_close(&m_handle);
+            m_exec_conf->msg->error() << "mpcd: invalid schema in " << m_fname << std::endl;
+            throw std::runtime_error("Error opening GSD file");
+            }
+        }
+    else
+        {
+        std::ostringstream application;
+        application << "HOOMD-blue " << HOOMD_VERSION;
+
+        m_exec_conf->msg->notice(3) << "mpcd: create or overwrite gsd file " << m_fname
+                                    << std::endl;
+        int retval = gsd_create_and_open(&m_handle,
+                                         m_fname.c_str(),
+                                         application.str().c_str(),
+                                         "hoomd",
+                                         gsd_make_version(1, 4),
+                                         GSD_OPEN_APPEND,
+                                         m_mode == "xb");
+        hoomd::detail::GSDUtils::checkError(retval, m_fname);
+        }
+    }
+
+/*!
+ * \param timestep Current timestep
+ */
+void mpcd::GSDWriter::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+
+    selectParticles();
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        m_gather_tag_order.setLocalTagsSorted(m_tag);
+        if (m_write_position)
+            m_gather_tag_order.gatherArray(m_global_position, m_position);
+        if (m_write_velocity)
+            m_gather_tag_order.gatherArray(m_global_velocity, m_velocity);
+        if (m_write_typeid)
+            m_gather_tag_order.gatherArray(m_global_type, m_type);
+        // the tags are always gathered because their count is the number of particles
+        m_gather_tag_order.gatherArray(m_global_tag, m_tag);
+
+        if (m_exec_conf->isRoot())
+            {
+            writeFrame(timestep, m_global_tag, m_global_position, m_global_velocity, m_global_type);
+            }
+        }
+    else
+#endif // ENABLE_MPI
+        {
+        writeFrame(timestep, m_tag, m_position, m_velocity, m_type);
+        }
+    }
+
+/*!
+ * The selected particles are sorted by tag, which is the order that GatherTagOrder requires. Only
+ * the fields that are written are copied.
+ */
+void mpcd::GSDWriter::selectParticles()
+    {
+    const unsigned int N = m_mpcd_pdata->getN();
+    ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_mpcd_pdata->getTags(),
+                                    access_location::host,
+                                    access_mode::read);
+
+    m_order.clear();
+    for (unsigned int idx = 0; idx < N; ++idx)
+        {
+        if (h_tag.data[idx] % m_stride != 0)
+            continue;
+
+        if (m_use_region)
+            {
+            const SolventScalar4 pos = h_pos.data[idx];
+            if (pos.x < m_region_lo.x || pos.x >= m_region_hi.x || pos.y < m_region_lo.y
+                || pos.y >= m_region_hi.y || pos.z < m_region_lo.z || pos.z >= m_region_hi.z)
+                continue;
+            }
+
+        m_order.push_back(idx);
+        }
+    std::sort(m_order.begin(),
+              m_order.end(),
+              [&h_tag](unsigned int a, unsigned int b) { return h_tag.data[a] < h_tag.data[b]; });
+
+    const size_t N_select = m_order.size();
+    m_tag.resize(N_select);
+    m_position.resize(m_write_position ? N_select : 0);
+    m_velocity.resize(m_write_velocity ? N_select : 0);
+    m_type.resize(m_write_typeid ? N_select : 0);
+    for (size_t i = 0; i < N_select; ++i)
+        {
+        const unsigned int idx = m_order[i];
+        m_tag[i] = h_tag.data[idx];
+
+        const SolventScalar4 postype = h_pos.data[idx];
+        if (m_write_position)
+            {
+            m_position[i] = vec3<float>(float(postype.x), float(postype.y), float(postype.z));
+            }
+        if (m_write_typeid)
+            {
+            m_type[i] = __solvent_scalar_as_int(postype.w);
+            }
+        if (m_write_velocity)
+            {
+            // the fourth component of the velocity is the cell index, which is not written
+            const SolventScalar4 vel_cell = h_vel.data[idx];
+            m_velocity[i] = vec3<float>(float(vel_cell.x), float(vel_cell.y), float(vel_cell.z));
+            }
+        }
+    }
+
+/*!
+ * \param name Name of the chunk
+ * \param type Type of the data
+ * \param N Number of rows
+ * \param M Number of columns
+ * \param data Data to write
+ */
+void mpcd::GSDWriter::writeChunk(const char* name,
+                                 gsd_type type,
+                                 uint64_t N,
+                                 uint32_t M,
+                                 const void* data)
+    {
+    m_exec_conf->msg->notice(10) << "mpcd: writing " << name << std::endl;
+    int retval = gsd_write_chunk(&m_handle, name, type, N, M, 0, data);
+    hoomd::detail::GSDUtils::checkError(retval, m_fname);
+    }
+
+/*!
+ * \param timestep Current timestep
+ * \param tag Tags of the particles (only the size is used if the tags are not written)
+ * \param position Positions of the particles
+ * \param velocity Velocities of the particles
+ * \param type Types of the particles
+ *
+ * The box, dimensions, and types are written in every frame. They are small compared to the
+ * particle data, and writing them means the frames do not depend on the first frame in the file,
+ * which may have been written by a different writer when appending.
+ */
+void mpcd::GSDWriter::writeFrame(uint64_t timestep,
+                                 const std::vector<unsigned int>& tag,
+                                 const std::vector<vec3<float>>& position,
+                                 const std::vector<vec3<float>>& velocity,
+                                 const std::vector<unsigned int>& type)
+    {
+    writeChunk("configuration/step", GSD_TYPE_UINT64, 1, 1, &timestep);
+
+    const uint8_t dimensions = static_cast<uint8_t>(m_sysdef->getNDimensions());
+    writeChunk("configuration/dimensions", GSD_TYPE_UINT8, 1, 1, &dimensions);
+
+    const BoxDim& box = m_pdata->getGlobalBox();
+    const float box_a[6] = {static_cast<float>(box.getL().x),
+                            static_cast<float>(box.getL().y),
+                            static_cast<float>(box.getL().z),
+                            static_cast<float>(box.getTiltFactorXY()),
+                            static_cast<float>(box.getTiltFactorXZ()),
+                            static_cast<float>(box.getTiltFactorYZ())};
+    writeChunk("configuration/box", GSD_TYPE_FLOAT, 6, 1, box_a);
+
+    const uint32_t N = static_cast<uint32_t>(tag.size());
+    writeChunk("particles/N", GSD_TYPE_UINT32, 1, 1, &N);
+
+    const std::vector<std::string>& type_names = m_mpcd_pdata->getTypeNames();
+    size_t max_len = 0;
+    for (const auto& name : type_names)
+        {
+        max_len = std::max(max_len, name.size());
+        }
+    max_len += 1; // for null
+    std::vector<char> types(max_len * type_names.size(), 0);
+    for (size_t i = 0; i < type_names.size(); ++i)
+        {
+        std::strncpy(&types[max_len * i], type_names[i].c_str(), max_len);
+        }
+    writeChunk("particles/types",
+               GSD_TYPE_UINT8,
+               type_names.size(),
+               static_cast<uint32_t>(max_len),
+               types.data());
+
+    if (N > 0)
+        {
+        if (m_write_position)
+            writeChunk("particles/position", GSD_TYPE_FLOAT, N, 3, position.data());
+        if (m_write_velocity)
+            writeChunk("particles/velocity", GSD_TYPE_FLOAT, N, 3, velocity.data());
+        if (m_write_typeid)
+            writeChunk("particles/typeid", GSD_TYPE_UINT32, N, 1, type.data());
+        if (m_write_tag)
+            writeChunk("log/particles/mpcd/tag", GSD_TYPE_UINT32, N, 1, tag.data());
+        }
+
+    int retval = gsd_end_frame(&m_handle);
+    hoomd::detail::GSDUtils::checkError(retval, m_fname);
+    }
+
+void mpcd::GSDWriter::flush()
+    {
+    if (m_exec_conf->isRoot())
+        {
+        int retval = gsd_flush(&m_handle);
+        hoomd::detail::GSDUtils::checkError(retval, m_fname);
+        }
+    }
+
+/*!
+ * \param stride Only particles whose tag is a multiple of \a stride are written
+ */
+void mpcd::GSDWriter::setStride(unsigned int stride)
+    {
+    if (stride == 0)
+        {
+        m_exec_conf->msg->error() << "mpcd: GSD stride must be at least 1" << std::endl;
+        throw std::invalid_argument("Invalid GSD stride");
+        }
+    m_stride = stride;
+    }
+
+/*!
+ * \param lo Lower bound of the region (inclusive)
+ * \param hi Upper bound of the region (exclusive)
+ *
+ * The bounds are Cartesian coordinates in the global box.
+ */
+void mpcd::GSDWriter::setRegion(const Scalar3& lo, const Scalar3& hi)
+    {
+    if (!(lo.x < hi.x && lo.y < hi.y && lo.z < hi.z))
+        {
+        m_exec_conf->msg->error() << "mpcd: GSD region lower bound must be less than the upper "
+                                     "bound"
+                                  << std::endl;
+        throw std::invalid_argument("Invalid GSD region");
+        }
+    m_region_lo = lo;
+    m_region_hi = hi;
+    m_use_region = true;
+    }
+
+std::vector<std::string> mpcd::GSDWriter::getFields() const
+    {
+    std::vector<std::string> fields;
+    if (m_write_position)
+        fields.push_back("position");
+    if (m_write_velocity)
+        fields.push_back("velocity");
+    if (m_write_typeid)
+        fields.push_back("typeid");
+    if (m_write_tag)
+        fields.push_back("tag");
+    return fields;
+    }
+
+/*!
+ * \param fields Names of the fields to write: "position", "velocity", "typeid", and "tag"
+ */
+void mpcd::GSDWriter::setFields(const std::vector<std::string>& fields)
+    {
+    bool write_position = false;
+    bool write_velocity = false;
+    bool write_typeid = false;
+    bool write_tag = false;
+    for (const auto& field : fields)
+        {
+        if (field == "position")
+            write_position = true;
+        else if (field == "velocity")
+            write_velocity = true;
+        else if (field == "typeid")
+            write_typeid = true;
+        else if (field == "tag")
+            write_tag = true;
+        else
+            {
+            m_exec_conf->msg->error() << "mpcd: unknown GSD field " << field << std::endl;
+            throw std::invalid_argument("Invalid GSD field: " + field);
+            }
+        }
+
+    m_write_position = write_position;
+    m_write_velocity = write_velocity;
+    m_write_typeid = write_typeid;
+    m_write_tag = write_tag;
+    }
+
+namespace mpcd
+    {
+namespace detail
+    {
+/*!
+ * \param m Python module to export to
+ */
+void export_GSDWriter(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::GSDWriter, Analyzer, std::shared_ptr<mpcd::GSDWriter>>(m, "GSDWriter")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            const std::string&,
+                            const std::string&>())
+        .def_property_readonly("filename", &mpcd::GSDWriter::getFilename)
+        .def_property_readonly("mode", &mpcd::GSDWriter::getMode)
+        .def_property("stride", &mpcd::GSDWriter::getStride, &mpcd::GSDWriter::setStride)
+        .def_property("fields", &mpcd::GSDWriter::getFields, &mpcd::GSDWriter::setFields)
+        .def_property(
+            "region",
+            [](const mpcd::GSDWriter& self)
+            {
+                if (!self.hasRegion())
+                    return pybind11::object(pybind11::none());
+                const Scalar3 lo = self.getRegionLo();
+                const Scalar3 hi = self.getRegionHi();
+                return pybind11::object(
+                    pybind11::make_tuple(pybind11::make_tuple(lo.x, lo.y, lo.z),
+                                         pybind11::make_tuple(hi.x, hi.y, hi.z)));
+            },
+            [](mpcd::GSDWriter& self, pybind11::object region)
+            {
+                if (region.is_none())
+                    {
+                    self.clearRegion();
+                    return;
+                    }
+                const pybind11::tuple bounds = region.cast<pybind11::tuple>();
+                const pybind11::tuple lo = bounds[0].cast<pybind11::tuple>();
+                const pybind11::tuple hi = bounds[1].cast<pybind11::tuple>();
+                self.setRegion(
+                    make_scalar3(lo[0].cast<Scalar>(), lo[1].cast<Scalar>(), lo[2].cast<Scalar>()),
+                    make_scalar3(hi[0].cast<Scalar>(), hi[1].cast<Scalar>(), hi[2].cast<Scalar>()));
+            })
+        .def("flush", &mpcd::GSDWriter::flush);
+    }
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
@@ -0,0 +1,181 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/GSDWriter.h
+ * \brief Declaration of mpcd::GSDWriter
+ */
+
+#ifndef MPCD_GSD_WRITER_H_
+#define MPCD_GSD_WRITER_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "ParticleData.h"
+
+#include "hoomd/Analyzer.h"
+#include "hoomd/extern/gsd.h"
+#include <pybind11/pybind11.h>
+
+#ifdef ENABLE_MPI
+#include "hoomd/HOOMDMPI.h"
+#endif // ENABLE_MPI
+
+#include <string>
+#include <vector>
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Writes the MPCD particles to a GSD file
+/*!
+ * Each frame stores the box, the MPCD particle types, and a selection of the per-particle fields
+ * of the real MPCD particles (virtual particles are never written) using the hoomd schema, so the
+ * files can be read with gsd.hoomd. The particles are written in ascending tag order. The tags
+ * are stored in the log/particles/mpcd/tag chunk because the schema has no tag field.
+ *
+ * The file size can be reduced in three ways:
+ *
+ * - Decimation: only particles whose tag is a multiple of the stride are written. The subset of
+ *   particles is the same in every frame.
+ * - Region: only particles whose position lies in an axis-aligned region of the global box are
+ *   written. The number of particles can change from frame to frame, so the tags should be
+ *   written to identify them.
+ * - Fields: any of the position, velocity, typeid, and tag can be omitted.
+ *
+ * Particles are selected on each rank before they are gathered onto the root rank, which is the
+ * only rank that writes to the file.
+ */
+class PYBIND11_EXPORT GSDWriter : public Analyzer
+    {
+    public:
+    //! Constructor
+    GSDWriter(std::shared_ptr<SystemDefinition> sysdef,
+              std::shared_ptr<Trigger> trigger,
+              const std::string& fname,
+              const std::string& mode);
+
+    //! Destructor
+    virtual ~GSDWriter();
+
+    //! Write a frame
+    virtual void analyze(uint64_t timestep);
+
+    //! Flush the write buffer to the file
+    void flush();
+
+    //! Get the file name
+    const std::string& getFilename() const
+        {
+        return m_fname;
+        }
+
+    //! Get the file open mode
+    const std::string& getMode() const
+        {
+        return m_mode;
+        }
+
+    //! Get the decimation stride
+    unsigned int getStride() const
+        {
+        return m_stride;
+        }
+
+    //! Set the decimation stride
+    void setStride(unsigned int stride);
+
+    //! Check if the particles are filtered by region
+    bool hasRegion() const
+        {
+        return m_use_region;
+        }
+
+    //! Get the lower bound of the region
+    Scalar3 getRegionLo() const
+        {
+        return m_region_lo;
+        }
+
+    //! Get the upper bound of the region
+    Scalar3 getRegionHi() const
+        {
+        return m_region_hi;
+        }
+
+    //! Only write particles in a region
+    void setRegion(const Scalar3& lo, const Scalar3& hi);
+
+    //! Write particles anywhere in the box
+    void clearRegion()
+        {
+        m_use_region = false;
+        }
+
+    //! Get the names of the fields that are written
+    std::vector<std::string> getFields() const;
+
+    //! Set the names of the fields that are written
+    void setFields(const std::vector<std::string>& fields);
+
+    protected:
+    std::shared_ptr<mpcd::ParticleData> m_mpcd_pdata; //!< MPCD particle data
+
+    std::string m_fname;   //!< File name
+    std::string m_mode;    //!< File open mode
+    gsd_handle m_handle;   //!< Handle to the file (root rank only)
+    unsigned int m_stride; //!< Decimation stride
+
+    bool m_use_region;   //!< If true, filter the particles by region
+    Scalar3 m_region_lo; //!< Lower bound of the region
+    Scalar3 m_region_hi; //!< Upper bound of the region
+
+    bool m_write_position; //!< If true, write particles/position
+    bool m_write_velocity; //!< If true, write particles/velocity
+    bool m_write_typeid;   //!< If true, write particles/typeid
+    bool m_write_tag;      //!< If true, write log/particles/mpcd/tag
+
+    std::vector<unsigned int> m_order;   //!< Local indexes of the selected particles in tag order
+    std::vector<unsigned int> m_tag;     //!< Tags of the selected particles
+    std::vector<vec3<float>> m_position; //!< Positions of the selected particles
+    std::vector<vec3<float>> m_velocity; //!< Velocities of the selected particles
+    std::vector<unsigned int> m_type;    //!< Types of the selected particles
+
+#ifdef ENABLE_MPI
+    GatherTagOrder m_gather_tag_order; //!< Gathers the selected particles onto the root rank
+
+    std::vector<unsigned int> m_global_tag;     //!< Gathered tags
+    std::vector<vec3<float>> m_global_position; //!< Gathered positions
+    std::vector<vec3<float>> m_global_velocity; //!< Gathered velocities
+    std::vector<unsigned int> m_global_type;    //!< Gathered types
+#endif // ENABLE_MPI
+
+    //! Open the file
+    void openFile();
+
+    //! Select the local particles and copy their fields in tag order
+    void selectParticles();
+
+    //! Write a chunk to the file
+    void writeChunk(const char* name, gsd_type type, uint64_t N, uint32_t M, const void* data);
+
+    //! Write the current frame
+    void writeFrame(uint64_t timestep,
+                    const std::vector<unsigned int>& tag,
+                    const std::vector<vec3<float>>& position,
+                    const std::vector<vec3<float>>& velocity,
+                    const std::vector<unsigned int>& type);
+    };
+
+namespace detail
+    {
+//! Export the mpcd::GSDWriter to python
+void export_GSDWriter(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+
+#endif // MPCD_GSD_WRITER_H_
@@ -19,7 +19,7 @@ namespace hoomd
  * \param deltaT Fundamental integration timestep
  */
 mpcd::Integrator::Integrator(std::shared_ptr<SystemDefinition> sysdef, Scalar deltaT)
-    : IntegratorTwoStep(sysdef, deltaT)
+    : IntegratorTwoStep(sysdef, deltaT), m_fused_stream_collide(false)
     {
     m_exec_conf->msg->notice(5) << "Constructing MPCD Integrator" << std::endl;
     }
@@ -43,6 +43,7 @@ mpcd::Integrator::~Integrator()
 void mpcd::Integrator::update(uint64_t timestep)
     {
     IntegratorTwoStep::update(timestep);
+    Tracer& tracer = m_exec_conf->getTracer();
 
     // remove any leftover virtual particles
     if (checkCollide(timestep))
@@ -53,7 +54,10 @@ void mpcd::Integrator::update(uint64_t timestep)
 
 #ifdef ENABLE_MPI
     if (m_mpcd_comm)
+        {
+        ScopedTrace trace(tracer, "communicate", "mpcd");
         m_mpcd_comm->communicate(timestep);
+        }
 #endif // ENABLE_MPI
 
     // fill in any virtual particles
@@ -61,18 +65,25 @@ void mpcd::Integrator::update(uint64_t timestep)
         {
         for (auto filler = m_fillers.begin(); filler != m_fillers.end(); ++filler)
             {
+            ScopedTrace trace(tracer, typeid(**filler), "mpcd");
             (*filler)->fill(timestep);
             }
         }
 
     // optionally sort
     if (m_sorter)
+        {
+        ScopedTrace trace(tracer, typeid(*m_sorter), "mpcd");
         m_sorter->update(timestep);
+        }
 
     // call the MPCD collision rule before the first MD step so that any embedded velocities are
     // updated first
     if (m_collide)
+        {
+        ScopedTrace trace(tracer, typeid(*m_collide), "mpcd");
         m_collide->collide(timestep);
+        }
 
     // perform the first MD integration step
     for (auto method = m_methods.begin(); method != m_methods.end(); ++method)
@@ -101,8 +112,9 @@ void mpcd::Integrator::update(uint64_t timestep)
 
     // execute the MPCD streaming step now that MD particles are communicated onto their final
     // domains
-    if (m_stream)
+    if (m_stream && !streamFused(timestep))
         {
+        ScopedTrace trace(tracer, typeid(*m_stream), "mpcd");
         m_stream->stream(timestep);
         }
 
@@ -119,6 +131,48 @@ void mpcd::Integrator::update(uint64_t timestep)
         (*method)->integrateStepTwo(timestep);
     }
 
+/*!
+ * \param timestep Current time step of the simulation
+ * \returns True if the MPCD particles were streamed
+ *
+ * When fusing is enabled, the streaming method bins the particles into the cells of the next
+ * collision and accumulates their cell properties while it streams them. This skips building the
+ * cell list and computing the cell properties from it before the collision. Streaming and
+ * collisions are only fused if:
+ *
+ * 1. The simulation runs on the GPU and is not domain decomposed.
+ * 2. The collision period is a multiple of the streaming period, and the next collision happens
+ *    exactly when this streaming step ends.
+ * 3. The collision method supports it (currently, SRD without an embedded group).
+ * 4. The streaming method supports it (currently, all confined streaming methods).
+ *
+ * Virtual particles from the fillers are added to the accumulated cell properties before the
+ * collision. If any of the conditions are not met, or the cell list has changed by the time the
+ * collision happens, the regular streaming, cell list, and cell properties are used instead.
+ */
+bool mpcd::Integrator::streamFused(uint64_t timestep)
+    {
+    if (!m_fused_stream_collide || !m_collide || !m_exec_conf->isCUDAEnabled())
+        return false;
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        return false;
+#endif // ENABLE_MPI
+
+    // the next collision must be right when this streaming step ends, with none before
+    const uint64_t collide_timestep = timestep + m_stream->getPeriod();
+    if (m_collide->getPeriod() % m_stream->getPeriod() != 0 || !m_stream->peekStream(timestep)
+        || !m_collide->peekCollide(collide_timestep))
+        return false;
+
+    auto thermo = m_collide->beginFusedCollision(collide_timestep);
+    if (!thermo)
+        return false;
+
+    ScopedTrace trace(m_exec_conf->getTracer(), typeid(*m_stream), "mpcd");
+    return m_stream->streamFused(timestep, thermo);
+    }
+
 /*!
  * \param deltaT new deltaT to set
  * \post \a deltaT is also set on all contained integration methods
@@ -191,6 +245,9 @@ void mpcd::detail::export_Integrator(pybind11::module& m)
         .def("removeSorter", &mpcd::Integrator::removeSorter)
         .def("addFiller", &mpcd::Integrator::addFiller)
         .def("removeAllFillers", &mpcd::Integrator::removeAllFillers)
+        .def_property("fused_stream_collide",
+                      &mpcd::Integrator::getFusedStreamCollide,
+                      &mpcd::Integrator::setFusedStreamCollide)
 #ifdef ENABLE_MPI
         .def("setMPCDCommunicator", &mpcd::Integrator::setMPCDCommunicator)
 #endif // ENABLE_MPI
@@ -146,6 +146,21 @@ class PYBIND11_EXPORT Integrator : public hoomd::md::IntegratorTwoStep
         m_fillers.clear();
         }
 
+    //! Get if streaming and collisions are fused when possible
+    bool getFusedStreamCollide() const
+        {
+        return m_fused_stream_collide;
+        }
+
+    //! Set if streaming and collisions are fused when possible
+    /*!
+     * \param fused If true, accumulate the cell properties for a collision while streaming
+     */
+    void setFusedStreamCollide(bool fused)
+        {
+        m_fused_stream_collide = fused;
+        }
+
     protected:
     std::shared_ptr<mpcd::CollisionMethod> m_collide; //!< MPCD collision rule
     std::shared_ptr<mpcd::StreamingMethod> m_stream;  //!< MPCD streaming rule
@@ -157,6 +172,12 @@ class PYBIND11_EXPORT Integrator : public hoomd::md::IntegratorTwoStep
 
     std::vector<std::shared_ptr<mpcd::VirtualParticleFiller>>
         m_fillers; //!< MPCD virtual particle fillers
+
+    bool m_fused_stream_collide; //!< Flag to fuse streaming and collisions when possible
+
+    //! Stream and accumulate the cell properties for the next collision
+    bool streamFused(uint64_t timestep);
+
     private:
     //! Check if a collision will occur at the current timestep
     bool checkCollide(uint64_t timestep)
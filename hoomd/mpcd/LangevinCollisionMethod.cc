@@ -0,0 +1,74 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/LangevinCollisionMethod.cc
+ * \brief Definition of mpcd::LangevinCollisionMethod
+ */
+
+#include "LangevinCollisionMethod.h"
+
+namespace hoomd
+    {
+mpcd::LangevinCollisionMethod::LangevinCollisionMethod(std::shared_ptr<SystemDefinition> sysdef,
+                                                       uint64_t cur_timestep,
+                                                       uint64_t period,
+                                                       int phase,
+                                                       std::shared_ptr<Variant> T,
+                                                       Scalar friction)
+    : mpcd::ATCollisionMethod(sysdef, cur_timestep, period, phase, T)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing MPCD Langevin collision method" << std::endl;
+    setFriction(friction);
+    }
+
+mpcd::LangevinCollisionMethod::~LangevinCollisionMethod()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying MPCD Langevin collision method" << std::endl;
+    }
+
+/*!
+ * \param friction Dimensionless friction
+ */
+void mpcd::LangevinCollisionMethod::setFriction(Scalar friction)
+    {
+    mpcd::detail::checkLangevinFriction(m_exec_conf, friction);
+    m_friction = friction;
+    }
+
+/*!
+ * \param exec_conf Execution configuration
+ * \param friction Dimensionless friction
+ *
+ * \throws std::runtime_error if \a friction is negative
+ */
+void mpcd::detail::checkLangevinFriction(std::shared_ptr<const ExecutionConfiguration> exec_conf,
+                                         Scalar friction)
+    {
+    if (!(friction >= Scalar(0.0)))
+        {
+        exec_conf->msg->error() << "mpcd: Langevin friction must be nonnegative" << std::endl;
+        throw std::runtime_error("Invalid MPCD Langevin friction");
+        }
+    }
+
+/*!
+ * \param m Python module to export to
+ */
+void mpcd::detail::export_LangevinCollisionMethod(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::LangevinCollisionMethod,
+                     mpcd::ATCollisionMethod,
+                     std::shared_ptr<mpcd::LangevinCollisionMethod>>(m, "LangevinCollisionMethod")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            uint64_t,
+                            uint64_t,
+                            int,
+                            std::shared_ptr<Variant>,
+                            Scalar>())
+        .def_property("friction",
+                      &mpcd::LangevinCollisionMethod::getFriction,
+                      &mpcd::LangevinCollisionMethod::setFriction);
+    }
+
+    } // end namespace hoomd
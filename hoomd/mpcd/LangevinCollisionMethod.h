@@ -0,0 +1,66 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/LangevinCollisionMethod.h
+ * \brief Declaration of mpcd::LangevinCollisionMethod
+ */
+
+#ifndef MPCD_LANGEVIN_COLLISION_METHOD_H_
+#define MPCD_LANGEVIN_COLLISION_METHOD_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "ATCollisionMethod.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Implements the MPC-Langevin collision rule for MPCD.
+/*!
+ * The velocity of each particle relative to its cell is damped by the dimensionless friction
+ * \f$ \tilde\gamma = \gamma \Delta t \f$, where \f$ \Delta t \f$ is the time between collisions,
+ * and a random velocity is added so that the temperature is maintained (see
+ * mpcd::ATCollisionMethod). The friction must be nonnegative, and \f$ \tilde\gamma = 2 \f$ is the
+ * Andersen thermostat.
+ */
+class PYBIND11_EXPORT LangevinCollisionMethod : public mpcd::ATCollisionMethod
+    {
+    public:
+    //! Constructor
+    LangevinCollisionMethod(std::shared_ptr<SystemDefinition> sysdef,
+                            uint64_t cur_timestep,
+                            uint64_t period,
+                            int phase,
+                            std::shared_ptr<Variant> T,
+                            Scalar friction);
+
+    //! Destructor
+    virtual ~LangevinCollisionMethod();
+
+    //! Get the dimensionless friction
+    Scalar getFriction() const
+        {
+        return m_friction;
+        }
+
+    //! Set the dimensionless friction
+    void setFriction(Scalar friction);
+    };
+
+namespace detail
+    {
+//! Export LangevinCollisionMethod to python
+void export_LangevinCollisionMethod(pybind11::module& m);
+
+//! Validate the dimensionless friction of the MPC-Langevin rule
+void checkLangevinFriction(std::shared_ptr<const ExecutionConfiguration> exec_conf,
+                           Scalar friction);
+    } // end namespace detail
+
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_LANGEVIN_COLLISION_METHOD_H_
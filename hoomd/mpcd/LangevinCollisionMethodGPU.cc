@@ -0,0 +1,56 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/LangevinCollisionMethodGPU.cc
+ * \brief Definition of mpcd::LangevinCollisionMethodGPU
+ */
+
+#include "LangevinCollisionMethodGPU.h"
+#include "LangevinCollisionMethod.h"
+
+namespace hoomd
+    {
+mpcd::LangevinCollisionMethodGPU::LangevinCollisionMethodGPU(
+    std::shared_ptr<SystemDefinition> sysdef,
+    uint64_t cur_timestep,
+    uint64_t period,
+    int phase,
+    std::shared_ptr<Variant> T,
+    Scalar friction)
+    : mpcd::ATCollisionMethodGPU(sysdef, cur_timestep, period, phase, T)
+    {
+    setFriction(friction);
+    }
+
+/*!
+ * \param friction Dimensionless friction
+ */
+void mpcd::LangevinCollisionMethodGPU::setFriction(Scalar friction)
+    {
+    mpcd::detail::checkLangevinFriction(m_exec_conf, friction);
+    m_friction = friction;
+    }
+
+/*!
+ * \param m Python module to export to
+ */
+void mpcd::detail::export_LangevinCollisionMethodGPU(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::LangevinCollisionMethodGPU,
+                     mpcd::ATCollisionMethodGPU,
+                     std::shared_ptr<mpcd::LangevinCollisionMethodGPU>>(
+        m,
+        "LangevinCollisionMethodGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            uint64_t,
+                            uint64_t,
+                            int,
+                            std::shared_ptr<Variant>,
+                            Scalar>())
+        .def_property("friction",
+                      &mpcd::LangevinCollisionMethodGPU::getFriction,
+                      &mpcd::LangevinCollisionMethodGPU::setFriction);
+    }
+
+    } // end namespace hoomd
@@ -0,0 +1,56 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/LangevinCollisionMethodGPU.h
+ * \brief Declaration of mpcd::LangevinCollisionMethodGPU
+ */
+
+#ifndef MPCD_LANGEVIN_COLLISION_METHOD_GPU_H_
+#define MPCD_LANGEVIN_COLLISION_METHOD_GPU_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "ATCollisionMethodGPU.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Implements the MPC-Langevin collision rule for MPCD on the GPU.
+/*!
+ * The rule is applied by the kernels of mpcd::ATCollisionMethodGPU, so this class derives from it
+ * rather than from mpcd::LangevinCollisionMethod.
+ */
+class PYBIND11_EXPORT LangevinCollisionMethodGPU : public mpcd::ATCollisionMethodGPU
+    {
+    public:
+    //! Constructor
+    LangevinCollisionMethodGPU(std::shared_ptr<SystemDefinition> sysdef,
+                               uint64_t cur_timestep,
+                               uint64_t period,
+                               int phase,
+                               std::shared_ptr<Variant> T,
+                               Scalar friction);
+
+    //! Get the dimensionless friction
+    Scalar getFriction() const
+        {
+        return m_friction;
+        }
+
+    //! Set the dimensionless friction
+    void setFriction(Scalar friction);
+    };
+
+namespace detail
+    {
+//! Export LangevinCollisionMethodGPU to python
+void export_LangevinCollisionMethodGPU(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_LANGEVIN_COLLISION_METHOD_GPU_H_
@@ -0,0 +1,117 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/LoadBalancer.cc
+ * \brief Definition of mpcd::LoadBalancer
+ */
+
+#include "LoadBalancer.h"
+
+namespace hoomd
+    {
+/*!
+ * \param sysdef System definition
+ * \param trigger Trigger for load balancing
+ */
+mpcd::LoadBalancer::LoadBalancer(std::shared_ptr<SystemDefinition> sysdef,
+                                 std::shared_ptr<Trigger> trigger)
+    : hoomd::LoadBalancer(sysdef, trigger), m_mpcd_pdata(sysdef->getMPCDParticleData())
+#ifdef ENABLE_MPI
+      ,
+      m_N_virtual_global(0)
+#endif // ENABLE_MPI
+    {
+    m_exec_conf->msg->notice(5) << "Constructing MPCD LoadBalancer" << std::endl;
+    }
+
+mpcd::LoadBalancer::~LoadBalancer()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying MPCD LoadBalancer" << std::endl;
+    }
+
+/*!
+ * \param timestep Current time step of the simulation
+ *
+ * The global number of virtual particles is reduced before balancing because getNGlobal() must
+ * not make collective calls.
+ */
+void mpcd::LoadBalancer::update(uint64_t timestep)
+    {
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        if (!m_mpcd_comm)
+            {
+            m_exec_conf->msg->error()
+                << "mpcd: MPCD communicator must be set to balance MPCD particles" << std::endl;
+            throw std::runtime_error("MPCD communicator not set for load balancing");
+            }
+        m_N_virtual_global = m_mpcd_pdata->getNVirtualGlobal();
+        }
+#endif // ENABLE_MPI
+
+    hoomd::LoadBalancer::update(timestep);
+    }
+
+#ifdef ENABLE_MPI
+/*!
+ * \param timestep Current time step of the simulation
+ *
+ * The MPCD particles are migrated immediately so that they are owned by the adjusted domains when
+ * the particles are recounted.
+ */
+void mpcd::LoadBalancer::migrateParticles(uint64_t timestep)
+    {
+    hoomd::LoadBalancer::migrateParticles(timestep);
+
+    m_mpcd_comm->forceMigrate();
+    m_mpcd_comm->communicate(timestep);
+    }
+
+/*!
+ * \param cnts Map holding result of number of particles on each rank that neighbors the local rank
+ */
+void mpcd::LoadBalancer::countParticlesOffRank(std::map<unsigned int, unsigned int>& cnts)
+    {
+    hoomd::LoadBalancer::countParticlesOffRank(cnts);
+
+    ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::host,
+                                      access_mode::read);
+    countPositionsOffRank(cnts, h_pos.data, m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual());
+    }
+
+/*!
+ * \returns Number of MD, MPCD, and virtual particles on the rank
+ */
+unsigned int mpcd::LoadBalancer::getNLocal()
+    {
+    return m_pdata->getN() + m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
+    }
+
+/*!
+ * \returns Total number of MD, MPCD, and virtual particles
+ */
+unsigned int mpcd::LoadBalancer::getNGlobal()
+    {
+    return m_pdata->getNGlobal() + m_mpcd_pdata->getNGlobal() + m_N_virtual_global;
+    }
+#endif // ENABLE_MPI
+
+/*!
+ * \param m Python module to export to
+ */
+void mpcd::detail::export_LoadBalancer(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::LoadBalancer, hoomd::LoadBalancer, std::shared_ptr<mpcd::LoadBalancer>>(
+        m,
+        "LoadBalancer")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<Trigger>>())
+#ifdef ENABLE_MPI
+        .def("setMPCDCommunicator", &mpcd::LoadBalancer::setMPCDCommunicator)
+#endif // ENABLE_MPI
+        ;
+    }
+
+    } // end namespace hoomd
@@ -0,0 +1,89 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/LoadBalancer.h
+ * \brief Declaration of mpcd::LoadBalancer
+ */
+
+#ifndef MPCD_LOAD_BALANCER_H_
+#define MPCD_LOAD_BALANCER_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "ParticleData.h"
+#ifdef ENABLE_MPI
+#include "Communicator.h"
+#endif // ENABLE_MPI
+
+#include "hoomd/LoadBalancer.h"
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Updates domain decompositions to balance the MD and MPCD particle load
+/*!
+ * The MPCD solvent usually dominates the cost of a simulation, so balancing only the MD particles
+ * can leave the ranks very unevenly loaded. This load balancer counts the MPCD particles owned by
+ * each rank in addition to the MD particles. The virtual particles on each rank are also counted
+ * because they are binned into cells and collided like the solvent. In confined geometries, ranks
+ * that contain a wall are filled with virtual particles, and so they are given fewer real solvent
+ * particles.
+ *
+ * The virtual particles are counted where they were drawn for the last collision. They are
+ * regenerated by the fillers on each collision step, and so they are not migrated.
+ */
+class PYBIND11_EXPORT LoadBalancer : public hoomd::LoadBalancer
+    {
+    public:
+    //! Constructor
+    LoadBalancer(std::shared_ptr<SystemDefinition> sysdef, std::shared_ptr<Trigger> trigger);
+
+    //! Destructor
+    virtual ~LoadBalancer();
+
+    //! Take one timestep forward
+    virtual void update(uint64_t timestep);
+
+#ifdef ENABLE_MPI
+    //! Set the MPCD communicator used to migrate the MPCD particles
+    void setMPCDCommunicator(std::shared_ptr<mpcd::Communicator> comm)
+        {
+        m_mpcd_comm = comm;
+        }
+#endif // ENABLE_MPI
+
+    protected:
+    std::shared_ptr<mpcd::ParticleData> m_mpcd_pdata; //!< MPCD particle data
+
+#ifdef ENABLE_MPI
+    std::shared_ptr<mpcd::Communicator> m_mpcd_comm; //!< MPCD communicator
+    unsigned int m_N_virtual_global;                 //!< Global number of virtual particles
+
+    //! Migrate the MD and MPCD particles onto the adjusted domains
+    virtual void migrateParticles(uint64_t timestep);
+
+    //! Count the number of MD and MPCD particles that have gone off the rank
+    virtual void countParticlesOffRank(std::map<unsigned int, unsigned int>& cnts);
+
+    //! Get the number of MD and MPCD particles currently on the rank
+    virtual unsigned int getNLocal();
+
+    //! Get the total number of MD and MPCD particles to balance
+    virtual unsigned int getNGlobal();
+#endif // ENABLE_MPI
+    };
+
+namespace detail
+    {
+//! Export the mpcd::LoadBalancer to python
+void export_LoadBalancer(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+
+#endif // MPCD_LOAD_BALANCER_H_
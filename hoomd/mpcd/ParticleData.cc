@@ -16,6 +16,7 @@
 
 #include <pybind11/stl.h>
 
+#include <algorithm>
 #include <iomanip>
 #include <random>
 using namespace std;
@@ -44,8 +45,8 @@ mpcd::ParticleData::ParticleData(unsigned int N,
                                  unsigned int ndimensions,
                                  std::shared_ptr<ExecutionConfiguration> exec_conf,
                                  std::shared_ptr<DomainDecomposition> decomposition)
-    : m_N(0), m_N_virtual(0), m_N_global(0), m_N_max(0), m_exec_conf(exec_conf), m_mass(1.0),
-      m_valid_cell_cache(false)
+    : m_N(0), m_N_virtual(0), m_N_global(0), m_N_max(0), m_N_virtual_max(0),
+      m_exec_conf(exec_conf), m_mass(1.0), m_valid_cell_cache(false)
     {
     m_exec_conf->msg->notice(5) << "Constructing MPCD ParticleData" << endl;
 
@@ -74,8 +75,8 @@ mpcd::ParticleData::ParticleData(const mpcd::ParticleDataSnapshot& snapshot,
                                  std::shared_ptr<const BoxDim> global_box,
                                  std::shared_ptr<const ExecutionConfiguration> exec_conf,
                                  std::shared_ptr<DomainDecomposition> decomposition)
-    : m_N(0), m_N_virtual(0), m_N_global(0), m_N_max(0), m_exec_conf(exec_conf), m_mass(1.0),
-      m_valid_cell_cache(false)
+    : m_N(0), m_N_virtual(0), m_N_global(0), m_N_max(0), m_N_virtual_max(0),
+      m_exec_conf(exec_conf), m_mass(1.0), m_valid_cell_cache(false)
     {
     m_exec_conf->msg->notice(5) << "Constructing MPCD ParticleData" << endl;
 
@@ -261,20 +262,22 @@ void mpcd::ParticleData::initializeFromSnapshot(const mpcd::ParticleDataSnapshot
             allocate(m_N);
 
         // Fill-up particle data arrays
-        ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::overwrite);
-        ArrayHandle<Scalar4> h_vel(m_vel, access_location::host, access_mode::overwrite);
+        ArrayHandle<SolventScalar4> h_pos(m_pos, access_location::host, access_mode::overwrite);
+        ArrayHandle<SolventScalar4> h_vel(m_vel, access_location::host, access_mode::overwrite);
         ArrayHandle<unsigned int> h_tag(m_tag, access_location::host, access_mode::overwrite);
         ArrayHandle<unsigned int> h_comm_flag(m_comm_flags,
                                               access_location::host,
                                               access_mode::overwrite);
         for (unsigned int idx = 0; idx < m_N; idx++)
             {
-            h_pos.data[idx]
-                = make_scalar4(pos[idx].x, pos[idx].y, pos[idx].z, __int_as_scalar(type[idx]));
-            h_vel.data[idx] = make_scalar4(vel[idx].x,
-                                           vel[idx].y,
-                                           vel[idx].z,
-                                           __int_as_scalar(mpcd::detail::NO_CELL));
+            h_pos.data[idx] = make_solvent_scalar4(pos[idx].x,
+                                                   pos[idx].y,
+                                                   pos[idx].z,
+                                                   __int_as_solvent_scalar(type[idx]));
+            h_vel.data[idx] = make_solvent_scalar4(vel[idx].x,
+                                                   vel[idx].y,
+                                                   vel[idx].z,
+                                                   __int_as_solvent_scalar(mpcd::detail::NO_CELL));
             h_tag.data[idx] = tag[idx];
             h_comm_flag.data[idx] = 0; // initialize with zero by default
             }
@@ -284,20 +287,22 @@ void mpcd::ParticleData::initializeFromSnapshot(const mpcd::ParticleDataSnapshot
         {
         allocate(snapshot.size);
 
-        ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::overwrite);
-        ArrayHandle<Scalar4> h_vel(m_vel, access_location::host, access_mode::overwrite);
+        ArrayHandle<SolventScalar4> h_pos(m_pos, access_location::host, access_mode::overwrite);
+        ArrayHandle<SolventScalar4> h_vel(m_vel, access_location::host, access_mode::overwrite);
         ArrayHandle<unsigned int> h_tag(m_tag, access_location::host, access_mode::overwrite);
 
         for (unsigned int snap_idx = 0; snap_idx < snapshot.size; ++snap_idx)
             {
-            h_pos.data[nglobal] = make_scalar4(snapshot.position[snap_idx].x,
-                                               snapshot.position[snap_idx].y,
-                                               snapshot.position[snap_idx].z,
-                                               __int_as_scalar(snapshot.type[snap_idx]));
-            h_vel.data[nglobal] = make_scalar4(snapshot.velocity[snap_idx].x,
-                                               snapshot.velocity[snap_idx].y,
-                                               snapshot.velocity[snap_idx].z,
-                                               __int_as_scalar(mpcd::detail::NO_CELL));
+            h_pos.data[nglobal]
+                = make_solvent_scalar4(snapshot.position[snap_idx].x,
+                                       snapshot.position[snap_idx].y,
+                                       snapshot.position[snap_idx].z,
+                                       __int_as_solvent_scalar(snapshot.type[snap_idx]));
+            h_vel.data[nglobal]
+                = make_solvent_scalar4(snapshot.velocity[snap_idx].x,
+                                       snapshot.velocity[snap_idx].y,
+                                       snapshot.velocity[snap_idx].z,
+                                       __int_as_solvent_scalar(mpcd::detail::NO_CELL));
             h_tag.data[nglobal] = nglobal;
             nglobal++;
             }
@@ -382,20 +387,20 @@ void mpcd::ParticleData::initializeRandom(unsigned int N,
 
     // allocate and fill up with random values
     allocate(m_N);
-    ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::overwrite);
-    ArrayHandle<Scalar4> h_vel(m_vel, access_location::host, access_mode::overwrite);
+    ArrayHandle<SolventScalar4> h_pos(m_pos, access_location::host, access_mode::overwrite);
+    ArrayHandle<SolventScalar4> h_vel(m_vel, access_location::host, access_mode::overwrite);
     ArrayHandle<unsigned int> h_tag(m_tag, access_location::host, access_mode::overwrite);
     double3 vel_cm = make_double3(0, 0, 0);
     for (unsigned int i = 0; i < m_N; ++i)
         {
-        h_pos.data[i] = make_scalar4(pos_x(mt),
-                                     pos_y(mt),
-                                     (ndimensions == 3) ? pos_z(mt) : Scalar(0.0),
-                                     __int_as_scalar(0));
-        h_vel.data[i] = make_scalar4(vel(mt),
-                                     vel(mt),
-                                     (ndimensions == 3) ? vel(mt) : Scalar(0.0),
-                                     __int_as_scalar(mpcd::detail::NO_CELL));
+        h_pos.data[i] = make_solvent_scalar4(pos_x(mt),
+                                             pos_y(mt),
+                                             (ndimensions == 3) ? pos_z(mt) : Scalar(0.0),
+                                             __int_as_solvent_scalar(0));
+        h_vel.data[i] = make_solvent_scalar4(vel(mt),
+                                             vel(mt),
+                                             (ndimensions == 3) ? vel(mt) : Scalar(0.0),
+                                             __int_as_solvent_scalar(mpcd::detail::NO_CELL));
         h_tag.data[i] = tag_start + i;
 
         // add up total velocity
@@ -432,6 +437,43 @@ void mpcd::ParticleData::initializeRandom(unsigned int N,
         }
     }
 
+/*!
+ * \param N Number of particles on this rank
+ * \param N_global Number of particles on all ranks
+ * \post The particle data holds \a N particles of a single type "A" on this rank, and all
+ *       virtual particles are removed. The positions, velocities, and tags are not set.
+ *
+ * This is used to initialize the particles in place on each rank (e.g., on the GPU) without
+ * distributing a snapshot from the root rank. The caller must set the position, velocity, and
+ * tag of every particle, and \a N_global must be the sum of \a N over all ranks.
+ */
+void mpcd::ParticleData::resetParticles(unsigned int N, unsigned int N_global)
+    {
+    m_exec_conf->msg->notice(4) << "MPCD ParticleData: resetting " << N << " particles"
+                                << std::endl;
+
+    m_type_mapping.clear();
+    m_type_mapping.push_back("A");
+
+    // we have to allocate even if the number of particles is zero, so that the arrays can be
+    // resized later
+    allocate((N > 0) ? N : 1);
+    m_N = N;
+    m_N_virtual = 0;
+    setNGlobal(N_global);
+    invalidateCellCache();
+
+#ifdef ENABLE_MPI
+    if (m_decomposition)
+        {
+        ArrayHandle<unsigned int> h_comm_flags(m_comm_flags,
+                                               access_location::host,
+                                               access_mode::overwrite);
+        std::fill(h_comm_flags.data, h_comm_flags.data + m_N_max, 0);
+        }
+#endif // ENABLE_MPI
+    }
+
 /*!
  * \param snapshot mpcd::ParticleDataSnapshot to fill
  * \param global_box Current global box
@@ -442,8 +484,8 @@ void mpcd::ParticleData::takeSnapshot(mpcd::ParticleDataSnapshot& snapshot,
     {
     m_exec_conf->msg->notice(4) << "MPCD ParticleData: taking snapshot" << std::endl;
 
-    ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::read);
-    ArrayHandle<Scalar4> h_vel(m_vel, access_location::host, access_mode::read);
+    ArrayHandle<SolventScalar4> h_pos(m_pos, access_location::host, access_mode::read);
+    ArrayHandle<SolventScalar4> h_vel(m_vel, access_location::host, access_mode::read);
     ArrayHandle<unsigned int> h_tag(m_tag, access_location::host, access_mode::read);
 
 #ifdef ENABLE_MPI
@@ -458,7 +500,7 @@ void mpcd::ParticleData::takeSnapshot(mpcd::ParticleDataSnapshot& snapshot,
             {
             pos[idx] = make_scalar3(h_pos.data[idx].x, h_pos.data[idx].y, h_pos.data[idx].z);
             vel[idx] = make_scalar3(h_vel.data[idx].x, h_vel.data[idx].y, h_vel.data[idx].z);
-            type[idx] = __scalar_as_int(h_pos.data[idx].w);
+            type[idx] = __solvent_scalar_as_int(h_pos.data[idx].w);
             tag[idx] = h_tag.data[idx];
             }
 
@@ -522,15 +564,16 @@ void mpcd::ParticleData::takeSnapshot(mpcd::ParticleDataSnapshot& snapshot,
             const unsigned int snap_idx = h_tag.data[idx];
 
             // make sure the position stored in the snapshot is within the boundaries
-            Scalar4 postype = h_pos.data[idx];
+            SolventScalar4 postype = h_pos.data[idx];
             Scalar3 pos_i = make_scalar3(postype.x, postype.y, postype.z);
-            const unsigned int type_i = __scalar_as_int(postype.w);
+            const unsigned int type_i = __solvent_scalar_as_int(postype.w);
             int3 img = make_int3(0, 0, 0);
             global_box->wrap(pos_i, img);
 
             // push particle into the snapshot
             snapshot.position[snap_idx] = vec3<Scalar>(pos_i);
-            snapshot.velocity[snap_idx] = vec3<Scalar>(h_vel.data[idx]);
+            const SolventScalar4 vel_i = h_vel.data[idx];
+            snapshot.velocity[snap_idx] = vec3<Scalar>(vel_i.x, vel_i.y, vel_i.z);
             snapshot.type[snap_idx] = type_i;
             }
         }
@@ -634,10 +677,10 @@ void mpcd::ParticleData::allocate(unsigned int N_max)
     m_N_max = N_max;
 
     //! Allocate the particle data
-    GPUArray<Scalar4> pos(N_max, m_exec_conf);
+    GPUArray<SolventScalar4> pos(N_max, m_exec_conf);
     m_pos.swap(pos);
 
-    GPUArray<Scalar4> vel(N_max, m_exec_conf);
+    GPUArray<SolventScalar4> vel(N_max, m_exec_conf);
     m_vel.swap(vel);
 
     GPUArray<unsigned int> tag(N_max, m_exec_conf);
@@ -652,10 +695,10 @@ void mpcd::ParticleData::allocate(unsigned int N_max)
 #endif // ENABLE_MPI
 
     // Allocate the alternate data
-    GPUArray<Scalar4> pos_alt(N_max, m_exec_conf);
+    GPUArray<SolventScalar4> pos_alt(N_max, m_exec_conf);
     m_pos_alt.swap(pos_alt);
 
-    GPUArray<Scalar4> vel_alt(N_max, m_exec_conf);
+    GPUArray<SolventScalar4> vel_alt(N_max, m_exec_conf);
     m_vel_alt.swap(vel_alt);
 
     GPUArray<unsigned int> tag_alt(N_max, m_exec_conf);
@@ -724,24 +767,34 @@ void mpcd::ParticleData::reallocate(unsigned int N_max)
 /*!
  * \param N New number of particles held by the data
  *
- * A new size for the particle data arrays is chosen using amortized growth
- * (set by growth_factor), and the particle data is resized. If N is less than
- * m_N_max, then nothing needs to be reallocated, and the current number of
- * owned particles is simply changed.
+ * The particle data is grown to hold \a N owned particles plus the most virtual particles that
+ * have been added so far, so that migration does not need to be followed by another reallocation
+ * when the virtual particles are filled again. If this fits in m_N_max, then nothing needs to be
+ * reallocated, and the current number of owned particles is simply changed.
  */
 void mpcd::ParticleData::resize(unsigned int N)
     {
-    // compute the new size of the array using amortized growth
+    reserve(N + m_N_virtual_max);
+    m_N = N;
+    }
+
+/*!
+ * \param N_min Minimum number of particles the data arrays must hold
+ *
+ * A new size for the particle data arrays is chosen using amortized growth (set by resize_factor),
+ * and the particle data is reallocated only if \a N_min exceeds m_N_max.
+ */
+void mpcd::ParticleData::reserve(unsigned int N_min)
+    {
     unsigned int N_max = m_N_max;
-    if (N > N_max)
+    if (N_min > N_max)
         {
-        while (N > N_max)
+        while (N_min > N_max)
             {
             N_max = ((unsigned int)(((float)N_max) * resize_factor)) + 1;
             }
         reallocate(N_max);
         }
-    m_N = N;
     }
 
 /*!
@@ -817,8 +870,8 @@ Scalar3 mpcd::ParticleData::getPosition(unsigned int idx) const
                                   << " is out of range" << endl;
         throw std::runtime_error("Error accessing MPCD particle data.");
         }
-    ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::read);
-    const Scalar4 postype = h_pos.data[idx];
+    ArrayHandle<SolventScalar4> h_pos(m_pos, access_location::host, access_mode::read);
+    const SolventScalar4 postype = h_pos.data[idx];
     return make_scalar3(postype.x, postype.y, postype.z);
     }
 
@@ -835,9 +888,9 @@ unsigned int mpcd::ParticleData::getType(unsigned int idx) const
                                   << " is out of range" << endl;
         throw std::runtime_error("Error accessing MPCD particle data.");
         }
-    ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::read);
-    const Scalar4 postype = h_pos.data[idx];
-    return __scalar_as_int(postype.w);
+    ArrayHandle<SolventScalar4> h_pos(m_pos, access_location::host, access_mode::read);
+    const SolventScalar4 postype = h_pos.data[idx];
+    return __solvent_scalar_as_int(postype.w);
     }
 
 /*!
@@ -853,8 +906,8 @@ Scalar3 mpcd::ParticleData::getVelocity(unsigned int idx) const
                                   << " is out of range" << endl;
         throw std::runtime_error("Error accessing MPCD particle data.");
         }
-    ArrayHandle<Scalar4> h_vel(m_vel, access_location::host, access_mode::read);
-    const Scalar4 velcell = h_vel.data[idx];
+    ArrayHandle<SolventScalar4> h_vel(m_vel, access_location::host, access_mode::read);
+    const SolventScalar4 velcell = h_vel.data[idx];
     return make_scalar3(velcell.x, velcell.y, velcell.z);
     }
 
@@ -876,29 +929,27 @@ unsigned int mpcd::ParticleData::getTag(unsigned int idx) const
     }
 
 /*!
- * \param N Allocate space for \a N additional virtualq particles in the particle data arrays
+ * \param N Allocate space for \a N additional virtual particles in the particle data arrays
+ *
+ * The virtual particles live past the owned particles. The largest number of virtual particles is
+ * remembered, and that space stays reserved, so the arrays are only reallocated when more virtual
+ * particles are needed than on any previous collision step.
+ *
+ * Subscribers to the virtual particle signal are still notified every time because the virtual
+ * particles are new even if their number and the capacity are unchanged, and anything computed
+ * from the old ones at the same timestep (e.g., by an analyzer) must be recomputed.
  */
 void mpcd::ParticleData::addVirtualParticles(unsigned int N)
     {
     if (N == 0)
         return;
 
-    // increase number of virtual particles
+    // increase number of virtual particles, remembering the high-water mark
     m_N_virtual += N;
+    m_N_virtual_max = std::max(m_N_virtual_max, m_N_virtual);
 
     // minimum size of new arrays must accommodate current particles plus virtual
-    const unsigned int N_min = m_N + m_N_virtual;
-
-    // compute the new size of the array using amortized growth
-    unsigned int N_max = m_N_max;
-    if (N_min > N_max)
-        {
-        while (N_min > N_max)
-            {
-            N_max = ((unsigned int)(((float)N_max) * resize_factor)) + 1;
-            }
-        reallocate(N_max);
-        }
+    reserve(m_N + m_N_virtual);
 
     notifyNumVirtual();
     }
@@ -962,8 +1013,8 @@ void mpcd::ParticleData::removeParticles(GPUVector<mpcd::detail::pdata_element>&
                                                access_location::host,
                                                access_mode::read);
 
-        ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::readwrite);
-        ArrayHandle<Scalar4> h_vel(m_vel, access_location::host, access_mode::readwrite);
+        ArrayHandle<SolventScalar4> h_pos(m_pos, access_location::host, access_mode::readwrite);
+        ArrayHandle<SolventScalar4> h_vel(m_vel, access_location::host, access_mode::readwrite);
         ArrayHandle<unsigned int> h_tag(m_tag, access_location::host, access_mode::readwrite);
         ArrayHandle<unsigned int> h_comm_flags(m_comm_flags,
                                                access_location::host,
@@ -1026,8 +1077,12 @@ void mpcd::ParticleData::addParticles(const GPUVector<mpcd::detail::pdata_elemen
 
         {
         // access particle data arrays
-        ArrayHandle<Scalar4> h_pos(getPositions(), access_location::host, access_mode::readwrite);
-        ArrayHandle<Scalar4> h_vel(getVelocities(), access_location::host, access_mode::readwrite);
+        ArrayHandle<SolventScalar4> h_pos(getPositions(),
+                                          access_location::host,
+                                          access_mode::readwrite);
+        ArrayHandle<SolventScalar4> h_vel(getVelocities(),
+                                          access_location::host,
+                                          access_mode::readwrite);
         ArrayHandle<unsigned int> h_tag(getTags(), access_location::host, access_mode::readwrite);
         ArrayHandle<unsigned int> h_comm_flags(m_comm_flags,
                                                access_location::host,
@@ -1151,8 +1206,8 @@ void mpcd::ParticleData::removeParticlesGPU(GPUVector<mpcd::detail::pdata_elemen
                                                        access_mode::overwrite);
 
         // access particle data arrays to read from
-        ArrayHandle<Scalar4> d_pos(m_pos, access_location::device, access_mode::readwrite);
-        ArrayHandle<Scalar4> d_vel(m_vel, access_location::device, access_mode::readwrite);
+        ArrayHandle<SolventScalar4> d_pos(m_pos, access_location::device, access_mode::readwrite);
+        ArrayHandle<SolventScalar4> d_vel(m_vel, access_location::device, access_mode::readwrite);
         ArrayHandle<unsigned int> d_tag(m_tag, access_location::device, access_mode::readwrite);
         ArrayHandle<unsigned int> d_comm_flags(m_comm_flags,
                                                access_location::device,
@@ -1206,8 +1261,8 @@ void mpcd::ParticleData::addParticlesGPU(const GPUVector<mpcd::detail::pdata_ele
 
         {
         // access particle data arrays
-        ArrayHandle<Scalar4> d_pos(m_pos, access_location::device, access_mode::readwrite);
-        ArrayHandle<Scalar4> d_vel(m_vel, access_location::device, access_mode::readwrite);
+        ArrayHandle<SolventScalar4> d_pos(m_pos, access_location::device, access_mode::readwrite);
+        ArrayHandle<SolventScalar4> d_vel(m_vel, access_location::device, access_mode::readwrite);
         ArrayHandle<unsigned int> d_tag(m_tag, access_location::device, access_mode::readwrite);
         ArrayHandle<unsigned int> d_comm_flags(m_comm_flags,
                                                access_location::device,
@@ -30,6 +30,7 @@
 #include "hoomd/GPUArray.h"
 #include "hoomd/GPUFlags.h"
 #include "hoomd/GPUVector.h"
+#include "hoomd/PythonLocalDataAccess.h"
 
 #include "hoomd/extern/nano-signal-slot/nano_signal_slot.hpp"
 
@@ -44,8 +45,8 @@ namespace mpcd
 /*!
  * MPCD particles are characterized by position, velocity, and mass. We assume all
  * particles have the same mass. The data is laid out as follows:
- * - position + type in array of Scalar4
- * - velocity + cell index in array of Scalar4
+ * - position + type in array of SolventScalar4
+ * - velocity + cell index in array of SolventScalar4
  * - tag in array of unsigned int
  *
  * Unlike the standard ParticleData, a reverse tag mapping is not currently maintained
@@ -57,6 +58,10 @@ namespace mpcd
  * are based on around the velocity and cell. For details of what the cell means,
  * refer to the mpcd::CellList.
  *
+ * The positions and velocities are single precision when HOOMD is built with
+ * HOOMD_MPCD_SINGLE_PRECISION (see SolventScalar4). The type and cell index must then be
+ * packed with __int_as_solvent_scalar and unpacked with __solvent_scalar_as_int.
+ *
  * \todo Because the local cell index changes with position, a signal will be put
  * in place to indicate when the cached cell index is still valid.
  *
@@ -102,6 +107,9 @@ class PYBIND11_EXPORT ParticleData : public Autotuned
                           unsigned int seed,
                           unsigned int ndimensions);
 
+    //! Replace the particles on this rank with uninitialized particles
+    void resetParticles(unsigned int N, unsigned int N_global);
+
     //! Take a snapshot of the MPCD particle data
     void takeSnapshot(mpcd::ParticleDataSnapshot& snapshot,
                       std::shared_ptr<const BoxDim> global_box) const;
@@ -171,13 +179,13 @@ class PYBIND11_EXPORT ParticleData : public Autotuned
     std::string getNameByType(unsigned int type) const;
 
     //! Get array of MPCD particle positions
-    const GPUArray<Scalar4>& getPositions() const
+    const GPUArray<SolventScalar4>& getPositions() const
         {
         return m_pos;
         }
 
     //! Get array of MPCD particle velocities
-    const GPUArray<Scalar4>& getVelocities() const
+    const GPUArray<SolventScalar4>& getVelocities() const
         {
         return m_vel;
         }
@@ -214,7 +222,7 @@ class PYBIND11_EXPORT ParticleData : public Autotuned
     //! \name swap methods
     //@{
     //! Get alternate array of MPCD particle positions
-    const GPUArray<Scalar4>& getAltPositions() const
+    const GPUArray<SolventScalar4>& getAltPositions() const
         {
         return m_pos_alt;
         }
@@ -226,7 +234,7 @@ class PYBIND11_EXPORT ParticleData : public Autotuned
         }
 
     //! Get alternate array of MPCD particle velocities
-    const GPUArray<Scalar4>& getAltVelocities() const
+    const GPUArray<SolventScalar4>& getAltVelocities() const
         {
         return m_vel_alt;
         }
@@ -343,7 +351,9 @@ class PYBIND11_EXPORT ParticleData : public Autotuned
      * \post The virtual particle counter is reset to zero.
      *
      * The memory associated with the previous virtual particle allocation is not freed
-     * since the array growth is amortized in allocateVirtualParticles.
+     * since the array growth is amortized in addVirtualParticles. The space stays reserved past
+     * the owned particles, so refilling the same number of virtual particles on the next
+     * collision step does not reallocate.
      */
     void removeVirtualParticles()
         {
@@ -404,16 +414,17 @@ class PYBIND11_EXPORT ParticleData : public Autotuned
 #endif // ENABLE_MPI
 
     private:
-    unsigned int m_N;         //!< Number of MPCD particles
-    unsigned int m_N_virtual; //!< Number of virtual MPCD particles
-    unsigned int m_N_global;  //!< Total number of MPCD particles
-    unsigned int m_N_max;     //!< Maximum number of MPCD particles arrays can hold
+    unsigned int m_N;             //!< Number of MPCD particles
+    unsigned int m_N_virtual;     //!< Number of virtual MPCD particles
+    unsigned int m_N_global;      //!< Total number of MPCD particles
+    unsigned int m_N_max;         //!< Maximum number of MPCD particles arrays can hold
+    unsigned int m_N_virtual_max; //!< Largest number of virtual MPCD particles held so far
 
     std::shared_ptr<const ExecutionConfiguration> m_exec_conf; //!< GPU execution configuration
     std::shared_ptr<DomainDecomposition> m_decomposition;      //!< Domain decomposition
 
-    GPUArray<Scalar4> m_pos;                 //!< MPCD particle positions plus type
-    GPUArray<Scalar4> m_vel;                 //!< MPCD particle velocities plus cell list id
+    GPUArray<SolventScalar4> m_pos;          //!< MPCD particle positions plus type
+    GPUArray<SolventScalar4> m_vel;          //!< MPCD particle velocities plus cell list id
     Scalar m_mass;                           //!< MPCD particle mass
     GPUArray<unsigned int> m_tag;            //!< MPCD particle tags
     std::vector<std::string> m_type_mapping; //!< Type name mapping
@@ -421,9 +432,9 @@ class PYBIND11_EXPORT ParticleData : public Autotuned
     GPUArray<unsigned int> m_comm_flags; //!< MPCD particle communication flags
 #endif                                   // ENABLE_MPI
 
-    GPUArray<Scalar4> m_pos_alt;      //!< Alternate position array
-    GPUArray<Scalar4> m_vel_alt;      //!< Alternate velocity array
-    GPUArray<unsigned int> m_tag_alt; //!< Alternate tag array
+    GPUArray<SolventScalar4> m_pos_alt; //!< Alternate position array
+    GPUArray<SolventScalar4> m_vel_alt; //!< Alternate velocity array
+    GPUArray<unsigned int> m_tag_alt;   //!< Alternate tag array
 #ifdef ENABLE_MPI
     GPUArray<unsigned int> m_comm_flags_alt; //!< Alternate communication flags
     GPUArray<unsigned int> m_remove_ids;     //!< Partitioned indexes of particles to keep
@@ -460,16 +471,115 @@ class PYBIND11_EXPORT ParticleData : public Autotuned
     //! Resize the data
     void resize(unsigned int N);
 
+    //! Grow the data arrays to hold at least a number of particles
+    void reserve(unsigned int N_min);
+
 #ifdef ENABLE_MPI
     //! Setup MPI
     void setupMPI(std::shared_ptr<DomainDecomposition> decomposition);
 #endif // ENABLE_MPI
     };
 
+//! Zero-copy access to the MPCD particle data from Python
+/*!
+ * The buffers cover the particles owned by this rank, excluding virtual particles. The type and
+ * cell index are stored in the w components of the position and velocity, so they are exposed as
+ * strided views of those arrays. Tags and cell indexes are read only.
+ *
+ * \tparam Output The buffer output type (either HOOMDHostBuffer or HOOMDDeviceBuffer)
+ */
+template<class Output>
+class PYBIND11_EXPORT LocalParticleData : public LocalDataAccess<Output, mpcd::ParticleData>
+    {
+    public:
+    LocalParticleData(mpcd::ParticleData& data)
+        : LocalDataAccess<Output, mpcd::ParticleData>(data), m_position_handle(),
+          m_velocity_handle(), m_tag_handle()
+        {
+        }
+
+    virtual ~LocalParticleData() = default;
+
+    Output getPosition()
+        {
+        return this->template getBuffer<SolventScalar4, SolventScalar, GPUArray>(
+            m_position_handle,
+            &ParticleData::getPositions,
+            {this->m_data.getN(), 3},
+            true);
+        }
+
+    Output getTypes()
+        {
+        return this->template getBuffer<SolventScalar4, int, GPUArray>(m_position_handle,
+                                                                       &ParticleData::getPositions,
+                                                                       {this->m_data.getN()},
+                                                                       true,
+                                                                       3 * sizeof(SolventScalar));
+        }
+
+    Output getVelocities()
+        {
+        return this->template getBuffer<SolventScalar4, SolventScalar, GPUArray>(
+            m_velocity_handle,
+            &ParticleData::getVelocities,
+            {this->m_data.getN(), 3},
+            true);
+        }
+
+    Output getCellIDs()
+        {
+        return this->template getBuffer<SolventScalar4, unsigned int, GPUArray>(
+            m_velocity_handle,
+            &ParticleData::getVelocities,
+            {this->m_data.getN()},
+            false,
+            3 * sizeof(SolventScalar));
+        }
+
+    Output getTags()
+        {
+        return this->template getBuffer<unsigned int, unsigned int, GPUArray>(
+            m_tag_handle,
+            &ParticleData::getTags,
+            {this->m_data.getN()},
+            false);
+        }
+
+    protected:
+    void clear()
+        {
+        m_position_handle.reset(nullptr);
+        m_velocity_handle.reset(nullptr);
+        m_tag_handle.reset(nullptr);
+        }
+
+    private:
+    std::unique_ptr<ArrayHandle<SolventScalar4>> m_position_handle;
+    std::unique_ptr<ArrayHandle<SolventScalar4>> m_velocity_handle;
+    std::unique_ptr<ArrayHandle<unsigned int>> m_tag_handle;
+    };
+
 namespace detail
     {
 //! Export MPCD ParticleData to python
 void export_ParticleData(pybind11::module& m);
+
+//! Export the zero-copy access to the MPCD particle data to python
+template<class Output> void export_LocalParticleData(pybind11::module& m, std::string name)
+    {
+    pybind11::class_<LocalParticleData<Output>, std::shared_ptr<LocalParticleData<Output>>>(
+        m,
+        name.c_str())
+        .def(pybind11::init<mpcd::ParticleData&>())
+        .def("getPosition", &LocalParticleData<Output>::getPosition)
+        .def("getTypes", &LocalParticleData<Output>::getTypes)
+        .def("getVelocities", &LocalParticleData<Output>::getVelocities)
+        .def("getCellIDs", &LocalParticleData<Output>::getCellIDs)
+        .def("getTags", &LocalParticleData<Output>::getTags)
+        .def("enter", &LocalParticleData<Output>::enter)
+        .def("exit", &LocalParticleData<Output>::exit);
+    }
     } // end namespace detail
 
     } // end namespace mpcd
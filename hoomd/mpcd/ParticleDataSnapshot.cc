@@ -12,6 +12,10 @@
 #endif
 #include <pybind11/numpy.h>
 
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
 namespace hoomd
     {
 mpcd::ParticleDataSnapshot::ParticleDataSnapshot() : size(0), mass(1.0) { }
@@ -100,43 +104,57 @@ void mpcd::ParticleDataSnapshot::replicate(unsigned int nx,
     assert(nz > 0);
 
     const unsigned int old_size = size;
+    const uint64_t new_size = uint64_t(old_size) * nx * ny * nz;
+    if (new_size > std::numeric_limits<unsigned int>::max())
+        {
+        throw std::runtime_error("Replication would create more MPCD particles than HOOMD "
+                                 "supports!");
+        }
 
-    resize(old_size * nx * ny * nz);
-
+    // fractional positions of the original particles in the old box, before the first replica
+    // overwrites them
+    std::vector<vec3<Scalar>> f(old_size);
     for (unsigned int i = 0; i < old_size; ++i)
         {
-        // unwrap position of particle i in old box using image flags
-        vec3<Scalar> p = position[i];
-        vec3<Scalar> f = old_box.makeFraction(p);
+        f[i] = old_box.makeFraction(position[i]);
+        }
+
+    resize((unsigned int)new_size);
 
-        unsigned int j = 0;
-        for (unsigned int l = 0; l < nx; ++l)
+    // fill one replica at a time so that the velocities and types are copied as contiguous blocks
+    for (unsigned int l = 0; l < nx; ++l)
+        {
+        for (unsigned int m = 0; m < ny; ++m)
             {
-            for (unsigned int m = 0; m < ny; ++m)
+            for (unsigned int n = 0; n < nz; ++n)
                 {
-                for (unsigned int n = 0; n < nz; ++n)
+                const unsigned int offset = ((l * ny + m) * nz + n) * old_size;
+                for (unsigned int i = 0; i < old_size; ++i)
                     {
                     Scalar3 f_new;
                     // replicate particle
-                    f_new.x = f.x / (Scalar)nx + (Scalar)l / (Scalar)nx;
-                    f_new.y = f.y / (Scalar)ny + (Scalar)m / (Scalar)ny;
-                    f_new.z = f.z / (Scalar)nz + (Scalar)n / (Scalar)nz;
-
-                    unsigned int k = j * old_size + i;
+                    f_new.x = f[i].x / (Scalar)nx + (Scalar)l / (Scalar)nx;
+                    f_new.y = f[i].y / (Scalar)ny + (Scalar)m / (Scalar)ny;
+                    f_new.z = f[i].z / (Scalar)nz + (Scalar)n / (Scalar)nz;
 
                     // coordinates in new box
                     Scalar3 q = new_box.makeCoordinates(f_new);
                     int3 image = make_int3(0, 0, 0);
                     new_box.wrap(q, image);
 
-                    position[k] = vec3<Scalar>(q);
-                    velocity[k] = velocity[i];
-                    type[k] = type[i];
-                    ++j;
-                    } // n
-                } // m
-            } // l
-        } // i
+                    position[offset + i] = vec3<Scalar>(q);
+                    } // i
+
+                if (offset > 0)
+                    {
+                    std::copy(velocity.begin(),
+                              velocity.begin() + old_size,
+                              velocity.begin() + offset);
+                    std::copy(type.begin(), type.begin() + old_size, type.begin() + offset);
+                    }
+                } // n
+            } // m
+        } // l
     }
 
 /*!
@@ -17,10 +17,71 @@
  */
 
 #include "hoomd/HOOMDMath.h"
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__ inline
+#else
+#define HOSTDEVICE inline __attribute__((always_inline))
+#endif // __HIPCC__
+
 namespace hoomd
     {
 namespace mpcd
     {
+/*!
+ * \typedef SolventScalar
+ * \brief Floating-point type of the MPCD particle positions and velocities
+ *
+ * \typedef SolventScalar4
+ * \brief Storage type of the MPCD particle positions and velocities
+ *
+ * The MPCD particles are stored in Scalar4 by default. When HOOMD is built with
+ * HOOMD_MPCD_SINGLE_PRECISION, they are stored in float4 instead, which halves the memory and
+ * bandwidth of the solvent while the MD particles stay in Scalar. Positions, velocities, and
+ * everything computed from them are still evaluated in Scalar, so the single-precision values
+ * only need to be converted when they are loaded and stored. Positions are relative to the center
+ * of the global box, so their absolute precision is about \f$ 2^{-24} L/2 \f$.
+ */
+#ifdef HOOMD_MPCD_SINGLE_PRECISION
+typedef float SolventScalar;
+typedef float4 SolventScalar4;
+#else
+typedef Scalar SolventScalar;
+typedef Scalar4 SolventScalar4;
+#endif
+
+//! Make a SolventScalar4 from its components
+HOSTDEVICE SolventScalar4
+make_solvent_scalar4(SolventScalar x, SolventScalar y, SolventScalar z, SolventScalar w)
+    {
+    SolventScalar4 a;
+    a.x = x;
+    a.y = y;
+    a.z = z;
+    a.w = w;
+    return a;
+    }
+
+//! Stuff an integer into the w component of a SolventScalar4
+HOSTDEVICE SolventScalar __int_as_solvent_scalar(int a)
+    {
+#ifdef HOOMD_MPCD_SINGLE_PRECISION
+    return __int_as_float(a);
+#else
+    return __int_as_scalar(a);
+#endif
+    }
+
+//! Extract an integer stuffed by __int_as_solvent_scalar()
+HOSTDEVICE int __solvent_scalar_as_int(SolventScalar b)
+    {
+#ifdef HOOMD_MPCD_SINGLE_PRECISION
+    return __float_as_int(b);
+#else
+    return __scalar_as_int(b);
+#endif
+    }
+
 namespace detail
     {
 //! Sentinel value to signify that this particle is not placed in a cell
@@ -36,8 +97,8 @@ const unsigned int NO_CELL = 0xffffffff;
  */
 struct pdata_element
     {
-    Scalar4 pos;            //!< Position
-    Scalar4 vel;            //!< Velocity
+    SolventScalar4 pos;     //!< Position
+    SolventScalar4 vel;     //!< Velocity
     unsigned int tag;       //!< Global tag
     unsigned int comm_flag; //!< Communication flag
     };
@@ -46,4 +107,7 @@ struct pdata_element
     } // end namespace detail
     } // end namespace mpcd
     } // end namespace hoomd
+
+#undef HOSTDEVICE
+
 #endif // MPCD_PARTICLE_DATA_UTILITIES_H_
@@ -0,0 +1,306 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/ParticleInitializer.h
+ * \brief Declaration of mpcd::ParticleInitializer
+ */
+
+#ifndef MPCD_PARTICLE_INITIALIZER_H_
+#define MPCD_PARTICLE_INITIALIZER_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "ParticleData.h"
+#include "ParticleDataUtilities.h"
+#include "ParticleInitializerUtilities.h"
+
+#include "hoomd/SystemDefinition.h"
+#include <pybind11/pybind11.h>
+
+#include <cmath>
+#include <vector>
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Initializes the MPCD particles inside a confining geometry
+/*!
+ * \tparam Geometry The confining geometry (e.g., BulkGeometry, SlitGeometry).
+ *
+ * The particles are generated directly on the rank that owns them, so no snapshot of the solvent
+ * needs to be built or distributed. Each rank draws candidate particles uniformly in its local
+ * box at the requested density, and keeps only the candidates that lie inside the Geometry. The
+ * density is hence the number density in the fluid volume of the Geometry. The candidates are
+ * numbered globally by a prefix sum over the ranks, and their random numbers are keyed by this
+ * number, so the same particles are generated on the CPU and the GPU for a given decomposition.
+ *
+ * The velocities are drawn from the Maxwell-Boltzmann distribution at temperature \a kT, and the
+ * mean velocity of all particles is then removed so that the solvent has no net momentum. All
+ * particles are given type 0, and any particles already in the particle data are replaced.
+ *
+ * Deriving classes may override drawCandidates(), writeParticles(), and removeVelocity() to
+ * perform these steps on a different device.
+ */
+template<class Geometry> class PYBIND11_EXPORT ParticleInitializer
+    {
+    public:
+    //! Constructor
+    /*!
+     * \param sysdef System definition
+     * \param density Number density of particles in the fluid volume
+     * \param kT Temperature of the particles
+     * \param geom Confining geometry
+     */
+    ParticleInitializer(std::shared_ptr<SystemDefinition> sysdef,
+                        Scalar density,
+                        Scalar kT,
+                        std::shared_ptr<const Geometry> geom)
+        : m_sysdef(sysdef), m_pdata(m_sysdef->getParticleData()),
+          m_exec_conf(m_pdata->getExecConf()), m_mpcd_pdata(m_sysdef->getMPCDParticleData()),
+          m_density(density), m_kT(kT), m_geom(geom)
+        {
+        if (m_density < Scalar(0))
+            {
+            throw std::runtime_error("MPCD particle density cannot be negative");
+            }
+        if (m_kT < Scalar(0))
+            {
+            throw std::runtime_error("MPCD particle temperature cannot be negative");
+            }
+        }
+
+    virtual ~ParticleInitializer() { }
+
+    //! Initialize the particles
+    void initialize(uint64_t timestep);
+
+    protected:
+    std::shared_ptr<SystemDefinition> m_sysdef;                //!< System definition
+    std::shared_ptr<hoomd::ParticleData> m_pdata;              //!< HOOMD particle data
+    std::shared_ptr<const ExecutionConfiguration> m_exec_conf; //!< Execution configuration
+    std::shared_ptr<mpcd::ParticleData> m_mpcd_pdata;          //!< MPCD particle data
+    Scalar m_density;                                          //!< Fluid number density
+    Scalar m_kT;                                               //!< Particle temperature
+    std::shared_ptr<const Geometry> m_geom;                    //!< Confining geometry
+
+    //! Get the standard deviation of each velocity component
+    Scalar getVelocityFactor() const
+        {
+        return fast::sqrt(m_kT / m_mpcd_pdata->getMass());
+        }
+
+    //! Draw the candidates and decide which are kept
+    virtual unsigned int
+    drawCandidates(uint64_t timestep, unsigned int N_cand, unsigned int first_candidate);
+
+    //! Write the kept candidates into the particle data
+    virtual Scalar3 writeParticles(uint64_t timestep, unsigned int first_tag);
+
+    //! Subtract a velocity from all particles
+    virtual void removeVelocity(const Scalar3& vel);
+
+    private:
+    std::vector<unsigned int> m_keep; //!< Global indexes of the kept candidates
+    };
+
+/*!
+ * \param timestep Current timestep, which (with the system seed) keys the random numbers
+ */
+template<class Geometry> void ParticleInitializer<Geometry>::initialize(uint64_t timestep)
+    {
+    // candidates at the requested density in the local box
+    const BoxDim box = m_pdata->getBox();
+    const Scalar volume = box.getVolume(m_sysdef->getNDimensions() == 2);
+    const unsigned int N_cand = static_cast<unsigned int>(std::round(m_density * volume));
+
+    // number the candidates and the kept particles globally across the ranks
+    unsigned int first_candidate = 0;
+#ifdef ENABLE_MPI
+    if (m_exec_conf->getNRanks() > 1)
+        {
+        MPI_Exscan(&N_cand,
+                   &first_candidate,
+                   1,
+                   MPI_UNSIGNED,
+                   MPI_SUM,
+                   m_exec_conf->getMPICommunicator());
+        }
+#endif // ENABLE_MPI
+
+    const unsigned int N_keep = drawCandidates(timestep, N_cand, first_candidate);
+
+    unsigned int first_tag = 0;
+    unsigned int N_global = N_keep;
+#ifdef ENABLE_MPI
+    if (m_exec_conf->getNRanks() > 1)
+        {
+        MPI_Exscan(&N_keep,
+                   &first_tag,
+                   1,
+                   MPI_UNSIGNED,
+                   MPI_SUM,
+                   m_exec_conf->getMPICommunicator());
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &N_global,
+                      1,
+                      MPI_UNSIGNED,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif // ENABLE_MPI
+
+    m_mpcd_pdata->resetParticles(N_keep, N_global);
+    Scalar3 vel_sum = writeParticles(timestep, first_tag);
+
+    // remove the mean velocity of all particles
+#ifdef ENABLE_MPI
+    if (m_exec_conf->getNRanks() > 1)
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &vel_sum,
+                      3,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif // ENABLE_MPI
+    if (N_global > 0)
+        {
+        removeVelocity(vel_sum / Scalar(N_global));
+        }
+
+    m_exec_conf->msg->notice(2) << "Initialized " << N_global << " MPCD particles in the "
+                                << Geometry::getName() << " geometry" << std::endl;
+    }
+
+/*!
+ * \param timestep Current timestep
+ * \param N_cand Number of candidates in the local box
+ * \param first_candidate Global index of the first local candidate
+ * \returns Number of kept candidates
+ */
+template<class Geometry>
+unsigned int ParticleInitializer<Geometry>::drawCandidates(uint64_t timestep,
+                                                           unsigned int N_cand,
+                                                           unsigned int first_candidate)
+    {
+    const BoxDim box = m_pdata->getBox();
+    const Scalar vel_factor = getVelocityFactor();
+    const uint16_t seed = m_sysdef->getSeed();
+    const bool two_d = (m_sysdef->getNDimensions() == 2);
+
+    m_keep.clear();
+    m_keep.reserve(N_cand);
+    for (unsigned int i = 0; i < N_cand; ++i)
+        {
+        const unsigned int candidate = first_candidate + i;
+        Scalar3 pos, vel;
+        mpcd::detail::drawCandidateParticle(pos,
+                                            vel,
+                                            box,
+                                            vel_factor,
+                                            timestep,
+                                            seed,
+                                            candidate,
+                                            two_d);
+        if (!m_geom->isOutside(pos))
+            m_keep.push_back(candidate);
+        }
+
+    return static_cast<unsigned int>(m_keep.size());
+    }
+
+/*!
+ * \param timestep Current timestep
+ * \param first_tag Tag of the first local particle
+ * \returns Sum of the velocities of the local particles
+ *
+ * The kept candidates are drawn again from their global index, which is cheaper than storing them.
+ */
+template<class Geometry>
+Scalar3 ParticleInitializer<Geometry>::writeParticles(uint64_t timestep, unsigned int first_tag)
+    {
+    const BoxDim box = m_pdata->getBox();
+    const Scalar vel_factor = getVelocityFactor();
+    const uint16_t seed = m_sysdef->getSeed();
+    const bool two_d = (m_sysdef->getNDimensions() == 2);
+
+    ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::host,
+                                      access_mode::overwrite);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::overwrite);
+    ArrayHandle<unsigned int> h_tag(m_mpcd_pdata->getTags(),
+                                    access_location::host,
+                                    access_mode::overwrite);
+
+    Scalar3 vel_sum = make_scalar3(0, 0, 0);
+    for (unsigned int idx = 0; idx < m_keep.size(); ++idx)
+        {
+        Scalar3 pos, vel;
+        mpcd::detail::drawCandidateParticle(pos,
+                                            vel,
+                                            box,
+                                            vel_factor,
+                                            timestep,
+                                            seed,
+                                            m_keep[idx],
+                                            two_d);
+        h_pos.data[idx] = make_solvent_scalar4(pos.x, pos.y, pos.z, __int_as_solvent_scalar(0));
+        h_vel.data[idx] = make_solvent_scalar4(vel.x,
+                                               vel.y,
+                                               vel.z,
+                                               __int_as_solvent_scalar(mpcd::detail::NO_CELL));
+        h_tag.data[idx] = first_tag + idx;
+        vel_sum += vel;
+        }
+
+    // the candidates are no longer needed
+    std::vector<unsigned int>().swap(m_keep);
+
+    return vel_sum;
+    }
+
+/*!
+ * \param vel Velocity to subtract
+ */
+template<class Geometry> void ParticleInitializer<Geometry>::removeVelocity(const Scalar3& vel)
+    {
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::readwrite);
+    for (unsigned int idx = 0; idx < m_mpcd_pdata->getN(); ++idx)
+        {
+        SolventScalar4& v = h_vel.data[idx];
+        v.x -= vel.x;
+        v.y -= vel.y;
+        v.z -= vel.z;
+        }
+    }
+
+namespace detail
+    {
+//! Export mpcd::ParticleInitializer to python
+/*!
+ * \param m Python module to export to
+ */
+template<class Geometry> void export_ParticleInitializer(pybind11::module& m)
+    {
+    const std::string name = "ParticleInitializer" + Geometry::getName();
+    pybind11::class_<mpcd::ParticleInitializer<Geometry>,
+                     std::shared_ptr<mpcd::ParticleInitializer<Geometry>>>(m, name.c_str())
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            Scalar,
+                            Scalar,
+                            std::shared_ptr<const Geometry>>())
+        .def("initialize", &mpcd::ParticleInitializer<Geometry>::initialize);
+    }
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_PARTICLE_INITIALIZER_H_
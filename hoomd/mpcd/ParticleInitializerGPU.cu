@@ -0,0 +1,338 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/ParticleInitializerGPU.cu
+ * \brief Defines GPU functions and kernels used by mpcd::ParticleInitializerGPU
+ */
+
+#include "ParticleDataUtilities.h"
+#include "ParticleInitializerGPU.cuh"
+#include "StreamingGeometry.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#include <cub/device/device_reduce.cuh>
+#include <cub/device/device_select.cuh>
+#include <cub/iterator/counting_input_iterator.cuh>
+#pragma GCC diagnostic pop
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace gpu
+    {
+namespace kernel
+    {
+/*!
+ * \param d_pos Particle positions (output)
+ * \param d_vel Particle velocities (output)
+ * \param d_tag Particle tags (output)
+ * \param d_vel_out Particle velocities for the reduction (output)
+ * \param d_keep Global indexes of the kept candidates
+ * \param box Local simulation box
+ * \param vel_factor Square root of the temperature divided by the particle mass
+ * \param timestep Current timestep
+ * \param seed User seed to the PRNG
+ * \param first_tag Tag of the first local particle
+ * \param N Number of kept candidates
+ * \param two_d If true, the candidates are drawn in the plane z = 0
+ *
+ * \b Implementation:
+ * Using one thread per particle, the kept candidate is drawn again from its global index and
+ * written into the particle data, which is cheaper than storing all candidates.
+ */
+__global__ void write_candidates(SolventScalar4* d_pos,
+                                 SolventScalar4* d_vel,
+                                 unsigned int* d_tag,
+                                 Scalar3* d_vel_out,
+                                 const unsigned int* d_keep,
+                                 const BoxDim box,
+                                 const Scalar vel_factor,
+                                 const uint64_t timestep,
+                                 const uint16_t seed,
+                                 const unsigned int first_tag,
+                                 const unsigned int N,
+                                 const bool two_d)
+    {
+    // one thread per particle
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    Scalar3 pos, vel;
+    mpcd::detail::drawCandidateParticle(pos,
+                                        vel,
+                                        box,
+                                        vel_factor,
+                                        timestep,
+                                        seed,
+                                        d_keep[idx],
+                                        two_d);
+    d_pos[idx] = make_solvent_scalar4(pos.x, pos.y, pos.z, __int_as_solvent_scalar(0));
+    d_vel[idx]
+        = make_solvent_scalar4(vel.x, vel.y, vel.z, __int_as_solvent_scalar(mpcd::detail::NO_CELL));
+    d_tag[idx] = first_tag + idx;
+    d_vel_out[idx] = vel;
+    }
+
+/*!
+ * \param d_vel Particle velocities
+ * \param vel Velocity to subtract
+ * \param N Number of particles
+ *
+ * \b Implementation:
+ * Using one thread per particle, \a vel is subtracted from the particle velocity.
+ */
+__global__ void remove_velocity(SolventScalar4* d_vel, const Scalar3 vel, const unsigned int N)
+    {
+    // one thread per particle
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    SolventScalar4 v = d_vel[idx];
+    v.x -= vel.x;
+    v.y -= vel.y;
+    v.z -= vel.z;
+    d_vel[idx] = v;
+    }
+    } // end namespace kernel
+
+/*!
+ * \param d_tmp Temporary storage
+ * \param tmp_bytes Number of bytes in temporary storage
+ * \param d_keep Global indexes of the kept candidates (output)
+ * \param d_num_keep Number of kept candidates (output)
+ * \param d_flags Flags for the candidates to keep
+ * \param first_candidate Global index of the first local candidate
+ * \param N_cand Number of local candidates
+ *
+ * \returns cudaSuccess on completion
+ *
+ * \b Implementation
+ * This is a wrapper to a cub::DeviceSelect::Flagged, and as such requires two calls. The first
+ * call sizes the temporary storage, which is returned in \a tmp_bytes. The caller must then
+ * allocate this memory into \a d_tmp, and call the method a second time. The global indexes of
+ * the kept candidates are then compacted in order into \a d_keep.
+ */
+cudaError_t select_candidates(void* d_tmp,
+                              size_t& tmp_bytes,
+                              unsigned int* d_keep,
+                              unsigned int* d_num_keep,
+                              const unsigned char* d_flags,
+                              const unsigned int first_candidate,
+                              const unsigned int N_cand)
+    {
+    cub::CountingInputIterator<unsigned int> ids(first_candidate);
+    cub::DeviceSelect::Flagged(d_tmp, tmp_bytes, ids, d_flags, d_keep, d_num_keep, N_cand);
+    return cudaSuccess;
+    }
+
+/*!
+ * \param d_pos Particle positions (output)
+ * \param d_vel Particle velocities (output)
+ * \param d_tag Particle tags (output)
+ * \param d_vel_out Particle velocities for the reduction (output)
+ * \param d_keep Global indexes of the kept candidates
+ * \param box Local simulation box
+ * \param vel_factor Square root of the temperature divided by the particle mass
+ * \param timestep Current timestep
+ * \param seed User seed to the PRNG
+ * \param first_tag Tag of the first local particle
+ * \param N Number of kept candidates
+ * \param two_d If true, the candidates are drawn in the plane z = 0
+ * \param block_size Number of threads per block
+ *
+ * \returns cudaSuccess on completion
+ *
+ * \sa mpcd::gpu::kernel::write_candidates
+ */
+cudaError_t write_candidates(SolventScalar4* d_pos,
+                             SolventScalar4* d_vel,
+                             unsigned int* d_tag,
+                             Scalar3* d_vel_out,
+                             const unsigned int* d_keep,
+                             const BoxDim& box,
+                             const Scalar vel_factor,
+                             const uint64_t timestep,
+                             const uint16_t seed,
+                             const unsigned int first_tag,
+                             const unsigned int N,
+                             const bool two_d,
+                             const unsigned int block_size)
+    {
+    if (N == 0)
+        return cudaSuccess;
+
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)kernel::write_candidates);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid(N / run_block_size + 1);
+    kernel::write_candidates<<<grid, run_block_size>>>(d_pos,
+                                                       d_vel,
+                                                       d_tag,
+                                                       d_vel_out,
+                                                       d_keep,
+                                                       box,
+                                                       vel_factor,
+                                                       timestep,
+                                                       seed,
+                                                       first_tag,
+                                                       N,
+                                                       two_d);
+
+    return cudaSuccess;
+    }
+
+/*!
+ * \param d_sum Sum of the velocities (output on second call)
+ * \param d_tmp Temporary storage for reduction (output on first call)
+ * \param tmp_bytes Number of bytes allocated for temporary storage (output on first call)
+ * \param d_vel Particle velocities
+ * \param N Number of particles
+ *
+ * \returns cudaSuccess on completion
+ *
+ * \b Implementation details:
+ * CUB DeviceReduce is used to perform the reduction. Hence, this function requires two calls to
+ * perform the reduction, like mpcd::gpu::select_candidates.
+ */
+cudaError_t sum_velocities(Scalar3* d_sum,
+                           void* d_tmp,
+                           size_t& tmp_bytes,
+                           const Scalar3* d_vel,
+                           const unsigned int N)
+    {
+    cub::DeviceReduce::Sum(d_tmp, tmp_bytes, d_vel, d_sum, N);
+    return cudaSuccess;
+    }
+
+/*!
+ * \param d_vel Particle velocities
+ * \param vel Velocity to subtract
+ * \param N Number of particles
+ * \param block_size Number of threads per block
+ *
+ * \returns cudaSuccess on completion
+ *
+ * \sa mpcd::gpu::kernel::remove_velocity
+ */
+cudaError_t remove_velocity(SolventScalar4* d_vel,
+                            const Scalar3 vel,
+                            const unsigned int N,
+                            const unsigned int block_size)
+    {
+    if (N == 0)
+        return cudaSuccess;
+
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)kernel::remove_velocity);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid(N / run_block_size + 1);
+    kernel::remove_velocity<<<grid, run_block_size>>>(d_vel, vel, N);
+
+    return cudaSuccess;
+    }
+
+//! Template instantiation of bulk geometry candidates
+template cudaError_t draw_candidates<mpcd::detail::BulkGeometry>(
+    unsigned char* d_flags,
+    const mpcd::detail::BulkGeometry& geom,
+    const BoxDim& box,
+    const Scalar vel_factor,
+    const uint64_t timestep,
+    const uint16_t seed,
+    const unsigned int first_candidate,
+    const unsigned int N_cand,
+    const bool two_d,
+    const unsigned int block_size);
+
+//! Template instantiation of slit geometry candidates
+template cudaError_t draw_candidates<mpcd::detail::SlitGeometry>(
+    unsigned char* d_flags,
+    const mpcd::detail::SlitGeometry& geom,
+    const BoxDim& box,
+    const Scalar vel_factor,
+    const uint64_t timestep,
+    const uint16_t seed,
+    const unsigned int first_candidate,
+    const unsigned int N_cand,
+    const bool two_d,
+    const unsigned int block_size);
+
+//! Template instantiation of slit pore geometry candidates
+template cudaError_t draw_candidates<mpcd::detail::SlitPoreGeometry>(
+    unsigned char* d_flags,
+    const mpcd::detail::SlitPoreGeometry& geom,
+    const BoxDim& box,
+    const Scalar vel_factor,
+    const uint64_t timestep,
+    const uint16_t seed,
+    const unsigned int first_candidate,
+    const unsigned int N_cand,
+    const bool two_d,
+    const unsigned int block_size);
+
+//! Template instantiation of cosine channel geometry candidates
+template cudaError_t draw_candidates<mpcd::detail::CosineChannel>(
+    unsigned char* d_flags,
+    const mpcd::detail::CosineChannel& geom,
+    const BoxDim& box,
+    const Scalar vel_factor,
+    const uint64_t timestep,
+    const uint16_t seed,
+    const unsigned int first_candidate,
+    const unsigned int N_cand,
+    const bool two_d,
+    const unsigned int block_size);
+
+//! Template instantiation of cosine expansion-contraction geometry candidates
+template cudaError_t draw_candidates<mpcd::detail::CosineExpansionContraction>(
+    unsigned char* d_flags,
+    const mpcd::detail::CosineExpansionContraction& geom,
+    const BoxDim& box,
+    const Scalar vel_factor,
+    const uint64_t timestep,
+    const uint16_t seed,
+    const unsigned int first_candidate,
+    const unsigned int N_cand,
+    const bool two_d,
+    const unsigned int block_size);
+
+//! Template instantiation of signed distance field geometry candidates
+template cudaError_t draw_candidates<mpcd::detail::SDFGeometry>(
+    unsigned char* d_flags,
+    const mpcd::detail::SDFGeometry& geom,
+    const BoxDim& box,
+    const Scalar vel_factor,
+    const uint64_t timestep,
+    const uint16_t seed,
+    const unsigned int first_candidate,
+    const unsigned int N_cand,
+    const bool two_d,
+    const unsigned int block_size);
+
+//! Template instantiation of cosine channel with a pore geometry candidates
+template cudaError_t draw_candidates<mpcd::detail::CosineChannelPore>(
+    unsigned char* d_flags,
+    const mpcd::detail::CosineChannelPore& geom,
+    const BoxDim& box,
+    const Scalar vel_factor,
+    const uint64_t timestep,
+    const uint16_t seed,
+    const unsigned int first_candidate,
+    const unsigned int N_cand,
+    const bool two_d,
+    const unsigned int block_size);
+
+    } // end namespace gpu
+    } // end namespace mpcd
+    } // end namespace hoomd
@@ -0,0 +1,180 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef MPCD_PARTICLE_INITIALIZER_GPU_CUH_
+#define MPCD_PARTICLE_INITIALIZER_GPU_CUH_
+
+/*!
+ * \file mpcd/ParticleInitializerGPU.cuh
+ * \brief Declaration of CUDA kernels for mpcd::ParticleInitializerGPU
+ */
+
+#include <cuda_runtime.h>
+
+#include "ParticleDataUtilities.h"
+#include "ParticleInitializerUtilities.h"
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace gpu
+    {
+//! Kernel driver to draw the candidates and flag those inside the geometry
+template<class Geometry>
+cudaError_t draw_candidates(unsigned char* d_flags,
+                            const Geometry& geom,
+                            const BoxDim& box,
+                            const Scalar vel_factor,
+                            const uint64_t timestep,
+                            const uint16_t seed,
+                            const unsigned int first_candidate,
+                            const unsigned int N_cand,
+                            const bool two_d,
+                            const unsigned int block_size);
+
+//! Compact the global indexes of the flagged candidates
+cudaError_t select_candidates(void* d_tmp,
+                              size_t& tmp_bytes,
+                              unsigned int* d_keep,
+                              unsigned int* d_num_keep,
+                              const unsigned char* d_flags,
+                              const unsigned int first_candidate,
+                              const unsigned int N_cand);
+
+//! Kernel driver to write the kept candidates into the particle data
+cudaError_t write_candidates(SolventScalar4* d_pos,
+                             SolventScalar4* d_vel,
+                             unsigned int* d_tag,
+                             Scalar3* d_vel_out,
+                             const unsigned int* d_keep,
+                             const BoxDim& box,
+                             const Scalar vel_factor,
+                             const uint64_t timestep,
+                             const uint16_t seed,
+                             const unsigned int first_tag,
+                             const unsigned int N,
+                             const bool two_d,
+                             const unsigned int block_size);
+
+//! Sum the velocities of the particles
+cudaError_t sum_velocities(Scalar3* d_sum,
+                           void* d_tmp,
+                           size_t& tmp_bytes,
+                           const Scalar3* d_vel,
+                           const unsigned int N);
+
+//! Kernel driver to subtract a velocity from all particles
+cudaError_t remove_velocity(SolventScalar4* d_vel,
+                            const Scalar3 vel,
+                            const unsigned int N,
+                            const unsigned int block_size);
+
+#ifdef __HIPCC__
+namespace kernel
+    {
+//! Kernel to draw the candidates and flag those inside the geometry
+/*!
+ * \param d_flags Flags for the candidates to keep (output)
+ * \param geom Confining geometry
+ * \param box Local simulation box
+ * \param vel_factor Square root of the temperature divided by the particle mass
+ * \param timestep Current timestep
+ * \param seed User seed to the PRNG
+ * \param first_candidate Global index of the first local candidate
+ * \param N_cand Number of local candidates
+ * \param two_d If true, the candidates are drawn in the plane z = 0
+ *
+ * \tparam Geometry Confining geometry
+ *
+ * \b Implementation:
+ * Using one thread per candidate, the candidate is drawn from its global index, and is flagged to
+ * be kept if it lies inside the geometry.
+ */
+template<class Geometry>
+__global__ void draw_candidates(unsigned char* d_flags,
+                                const Geometry geom,
+                                const BoxDim box,
+                                const Scalar vel_factor,
+                                const uint64_t timestep,
+                                const uint16_t seed,
+                                const unsigned int first_candidate,
+                                const unsigned int N_cand,
+                                const bool two_d)
+    {
+    // one thread per candidate
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N_cand)
+        return;
+
+    Scalar3 pos, vel;
+    mpcd::detail::drawCandidateParticle(pos,
+                                        vel,
+                                        box,
+                                        vel_factor,
+                                        timestep,
+                                        seed,
+                                        first_candidate + idx,
+                                        two_d);
+    d_flags[idx] = !geom.isOutside(pos);
+    }
+    } // end namespace kernel
+
+/*!
+ * \param d_flags Flags for the candidates to keep (output)
+ * \param geom Confining geometry
+ * \param box Local simulation box
+ * \param vel_factor Square root of the temperature divided by the particle mass
+ * \param timestep Current timestep
+ * \param seed User seed to the PRNG
+ * \param first_candidate Global index of the first local candidate
+ * \param N_cand Number of local candidates
+ * \param two_d If true, the candidates are drawn in the plane z = 0
+ * \param block_size Number of threads per block
+ *
+ * \returns cudaSuccess on completion
+ *
+ * \sa mpcd::gpu::kernel::draw_candidates
+ */
+template<class Geometry>
+cudaError_t draw_candidates(unsigned char* d_flags,
+                            const Geometry& geom,
+                            const BoxDim& box,
+                            const Scalar vel_factor,
+                            const uint64_t timestep,
+                            const uint16_t seed,
+                            const unsigned int first_candidate,
+                            const unsigned int N_cand,
+                            const bool two_d,
+                            const unsigned int block_size)
+    {
+    if (N_cand == 0)
+        return cudaSuccess;
+
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)kernel::draw_candidates<Geometry>);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid(N_cand / run_block_size + 1);
+    mpcd::gpu::kernel::draw_candidates<Geometry><<<grid, run_block_size>>>(d_flags,
+                                                                          geom,
+                                                                          box,
+                                                                          vel_factor,
+                                                                          timestep,
+                                                                          seed,
+                                                                          first_candidate,
+                                                                          N_cand,
+                                                                          two_d);
+
+    return cudaSuccess;
+    }
+#endif // __HIPCC__
+
+    } // end namespace gpu
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_PARTICLE_INITIALIZER_GPU_CUH_
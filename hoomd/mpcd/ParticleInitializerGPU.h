@@ -0,0 +1,259 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/ParticleInitializerGPU.h
+ * \brief Declaration of mpcd::ParticleInitializerGPU
+ */
+
+#ifndef MPCD_PARTICLE_INITIALIZER_GPU_H_
+#define MPCD_PARTICLE_INITIALIZER_GPU_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "ParticleInitializer.h"
+#include "ParticleInitializerGPU.cuh"
+#include "hoomd/CachedAllocator.h"
+#include "hoomd/GPUFlags.h"
+#include "hoomd/GPUVector.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Initializes the MPCD particles inside a confining geometry on the GPU
+/*!
+ * The candidates are drawn and tested against the geometry with one thread each. The global
+ * indexes of the kept candidates are compacted by a device-wide select, and the kept candidates
+ * are then drawn again directly into the particle data. Only the number of kept candidates and the
+ * sum of their velocities are copied back to the host.
+ *
+ * The kernels run once per initialization, so they use a fixed block size instead of an autotuner.
+ */
+template<class Geometry>
+class PYBIND11_EXPORT ParticleInitializerGPU : public mpcd::ParticleInitializer<Geometry>
+    {
+    public:
+    //! Constructor
+    /*!
+     * \param sysdef System definition
+     * \param density Number density of particles in the fluid volume
+     * \param kT Temperature of the particles
+     * \param geom Confining geometry
+     */
+    ParticleInitializerGPU(std::shared_ptr<SystemDefinition> sysdef,
+                           Scalar density,
+                           Scalar kT,
+                           std::shared_ptr<const Geometry> geom)
+        : mpcd::ParticleInitializer<Geometry>(sysdef, density, kT, geom),
+          m_flags(this->m_exec_conf), m_keep(this->m_exec_conf), m_vel(this->m_exec_conf),
+          m_num_keep(this->m_exec_conf), m_vel_sum(this->m_exec_conf), m_N_keep(0)
+        {
+        }
+
+    protected:
+    //! Draw the candidates and decide which are kept
+    virtual unsigned int
+    drawCandidates(uint64_t timestep, unsigned int N_cand, unsigned int first_candidate);
+
+    //! Write the kept candidates into the particle data
+    virtual Scalar3 writeParticles(uint64_t timestep, unsigned int first_tag);
+
+    //! Subtract a velocity from all particles
+    virtual void removeVelocity(const Scalar3& vel);
+
+    private:
+    GPUVector<unsigned char> m_flags; //!< Flags for the candidates to keep
+    GPUVector<unsigned int> m_keep;   //!< Global indexes of the kept candidates
+    GPUVector<Scalar3> m_vel;         //!< Velocities of the kept candidates for the reduction
+    GPUFlags<unsigned int> m_num_keep; //!< Number of kept candidates
+    GPUFlags<Scalar3> m_vel_sum;       //!< Sum of the velocities
+    unsigned int m_N_keep;             //!< Number of kept candidates
+
+    static const unsigned int block_size = 256; //!< Number of threads per block
+    };
+
+/*!
+ * \param timestep Current timestep
+ * \param N_cand Number of candidates in the local box
+ * \param first_candidate Global index of the first local candidate
+ * \returns Number of kept candidates
+ */
+template<class Geometry>
+unsigned int ParticleInitializerGPU<Geometry>::drawCandidates(uint64_t timestep,
+                                                              unsigned int N_cand,
+                                                              unsigned int first_candidate)
+    {
+    m_N_keep = 0;
+    if (N_cand == 0)
+        return 0;
+
+    m_flags.resize(N_cand);
+    m_keep.resize(N_cand);
+
+        {
+        ArrayHandle<unsigned char> d_flags(m_flags,
+                                           access_location::device,
+                                           access_mode::overwrite);
+        mpcd::gpu::draw_candidates<Geometry>(d_flags.data,
+                                             *(this->m_geom),
+                                             this->m_pdata->getBox(),
+                                             this->getVelocityFactor(),
+                                             timestep,
+                                             this->m_sysdef->getSeed(),
+                                             first_candidate,
+                                             N_cand,
+                                             this->m_sysdef->getNDimensions() == 2,
+                                             block_size);
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+        {
+        ArrayHandle<unsigned char> d_flags(m_flags, access_location::device, access_mode::read);
+        ArrayHandle<unsigned int> d_keep(m_keep, access_location::device, access_mode::overwrite);
+
+        void* d_tmp = NULL;
+        size_t tmp_bytes = 0;
+        mpcd::gpu::select_candidates(d_tmp,
+                                     tmp_bytes,
+                                     d_keep.data,
+                                     m_num_keep.getDeviceFlags(),
+                                     d_flags.data,
+                                     first_candidate,
+                                     N_cand);
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+
+        ScopedAllocation<unsigned char> d_tmp_alloc(this->m_exec_conf->getCachedAllocator(),
+                                                    (tmp_bytes > 0) ? tmp_bytes : 1);
+        d_tmp = (void*)d_tmp_alloc();
+
+        mpcd::gpu::select_candidates(d_tmp,
+                                     tmp_bytes,
+                                     d_keep.data,
+                                     m_num_keep.getDeviceFlags(),
+                                     d_flags.data,
+                                     first_candidate,
+                                     N_cand);
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+    m_N_keep = m_num_keep.readFlags();
+    return m_N_keep;
+    }
+
+/*!
+ * \param timestep Current timestep
+ * \param first_tag Tag of the first local particle
+ * \returns Sum of the velocities of the local particles
+ */
+template<class Geometry>
+Scalar3 ParticleInitializerGPU<Geometry>::writeParticles(uint64_t timestep, unsigned int first_tag)
+    {
+    if (m_N_keep == 0)
+        return make_scalar3(0, 0, 0);
+
+    m_vel.resize(m_N_keep);
+
+        {
+        ArrayHandle<SolventScalar4> d_pos(this->m_mpcd_pdata->getPositions(),
+                                          access_location::device,
+                                          access_mode::overwrite);
+        ArrayHandle<SolventScalar4> d_vel(this->m_mpcd_pdata->getVelocities(),
+                                          access_location::device,
+                                          access_mode::overwrite);
+        ArrayHandle<unsigned int> d_tag(this->m_mpcd_pdata->getTags(),
+                                        access_location::device,
+                                        access_mode::overwrite);
+        ArrayHandle<Scalar3> d_vel_out(m_vel, access_location::device, access_mode::overwrite);
+        ArrayHandle<unsigned int> d_keep(m_keep, access_location::device, access_mode::read);
+
+        mpcd::gpu::write_candidates(d_pos.data,
+                                    d_vel.data,
+                                    d_tag.data,
+                                    d_vel_out.data,
+                                    d_keep.data,
+                                    this->m_pdata->getBox(),
+                                    this->getVelocityFactor(),
+                                    timestep,
+                                    this->m_sysdef->getSeed(),
+                                    first_tag,
+                                    m_N_keep,
+                                    this->m_sysdef->getNDimensions() == 2,
+                                    block_size);
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+        {
+        ArrayHandle<Scalar3> d_vel(m_vel, access_location::device, access_mode::read);
+
+        void* d_tmp = NULL;
+        size_t tmp_bytes = 0;
+        mpcd::gpu::sum_velocities(m_vel_sum.getDeviceFlags(),
+                                  d_tmp,
+                                  tmp_bytes,
+                                  d_vel.data,
+                                  m_N_keep);
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+
+        ScopedAllocation<unsigned char> d_tmp_alloc(this->m_exec_conf->getCachedAllocator(),
+                                                    (tmp_bytes > 0) ? tmp_bytes : 1);
+        d_tmp = (void*)d_tmp_alloc();
+
+        mpcd::gpu::sum_velocities(m_vel_sum.getDeviceFlags(),
+                                  d_tmp,
+                                  tmp_bytes,
+                                  d_vel.data,
+                                  m_N_keep);
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+    // the candidates are no longer needed
+    m_flags.resize(0);
+    m_keep.resize(0);
+    m_vel.resize(0);
+
+    return m_vel_sum.readFlags();
+    }
+
+/*!
+ * \param vel Velocity to subtract
+ */
+template<class Geometry> void ParticleInitializerGPU<Geometry>::removeVelocity(const Scalar3& vel)
+    {
+    ArrayHandle<SolventScalar4> d_vel(this->m_mpcd_pdata->getVelocities(),
+                                      access_location::device,
+                                      access_mode::readwrite);
+    mpcd::gpu::remove_velocity(d_vel.data, vel, this->m_mpcd_pdata->getN(), block_size);
+    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    }
+
+namespace detail
+    {
+//! Export mpcd::ParticleInitializerGPU to python
+/*!
+ * \param m Python module to export to
+ */
+template<class Geometry> void export_ParticleInitializerGPU(pybind11::module& m)
+    {
+    const std::string name = "ParticleInitializerGPU" + Geometry::getName();
+    pybind11::class_<mpcd::ParticleInitializerGPU<Geometry>,
+                     mpcd::ParticleInitializer<Geometry>,
+                     std::shared_ptr<mpcd::ParticleInitializerGPU<Geometry>>>(m, name.c_str())
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            Scalar,
+                            Scalar,
+                            std::shared_ptr<const Geometry>>());
+    }
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_PARTICLE_INITIALIZER_GPU_H_
@@ -0,0 +1,79 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef MPCD_PARTICLE_INITIALIZER_UTILITIES_H_
+#define MPCD_PARTICLE_INITIALIZER_UTILITIES_H_
+
+/*!
+ * \file mpcd/ParticleInitializerUtilities.h
+ * \brief Utilities for mpcd::ParticleInitializer on the CPU and GPU
+ */
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__
+#else
+#define HOSTDEVICE
+#endif // __HIPCC__
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace detail
+    {
+//! Draw a candidate particle for initialization
+/*!
+ * \param pos Position of the candidate (output)
+ * \param vel Velocity of the candidate (output)
+ * \param box Local simulation box to draw the position in
+ * \param vel_factor Square root of the temperature divided by the particle mass
+ * \param timestep Current timestep
+ * \param seed User seed to the PRNG
+ * \param candidate Global index of the candidate
+ * \param two_d If true, the candidate is placed in the plane z = 0 with no velocity in z
+ *
+ * The random numbers of each candidate are keyed by its global index, so the same candidates are
+ * drawn on the CPU and the GPU, and in any order.
+ */
+HOSTDEVICE inline void drawCandidateParticle(Scalar3& pos,
+                                             Scalar3& vel,
+                                             const BoxDim& box,
+                                             const Scalar vel_factor,
+                                             const uint64_t timestep,
+                                             const uint16_t seed,
+                                             const unsigned int candidate,
+                                             const bool two_d)
+    {
+    hoomd::RandomGenerator rng(
+        hoomd::Seed(hoomd::RNGIdentifier::ParticleInitializer, timestep, seed),
+        hoomd::Counter(candidate));
+
+    hoomd::UniformDistribution<Scalar> uniform(Scalar(0), Scalar(1));
+    Scalar3 f;
+    f.x = uniform(rng);
+    f.y = uniform(rng);
+    f.z = uniform(rng);
+    pos = box.makeCoordinates(f);
+
+    hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
+    gen(vel.x, vel.y, rng);
+    vel.z = gen(rng);
+
+    if (two_d)
+        {
+        pos.z = Scalar(0);
+        vel.z = Scalar(0);
+        }
+    }
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+
+#undef HOSTDEVICE
+
+#endif // MPCD_PARTICLE_INITIALIZER_UTILITIES_H_
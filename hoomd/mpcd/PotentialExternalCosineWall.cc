@@ -0,0 +1,41 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/PotentialExternalCosineWall.cc
+ * \brief Exports the MD external potential from the walls of the MPCD cosine geometries
+ */
+
+#include "PotentialExternalCosineWall.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace detail
+    {
+/*!
+ * \param m Python module to export to
+ *
+ * The walls are taken from the geometry passed to setGeometry, which can be either of the cosine
+ * geometries. The geometry is copied, so it must be set again if it changes.
+ */
+void export_PotentialExternalCosineWall(pybind11::module& m)
+    {
+    pybind11::class_<PotentialExternalCosineWall,
+                     ForceCompute,
+                     std::shared_ptr<PotentialExternalCosineWall>>(m,
+                                                                   "PotentialExternalCosineWall")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>>())
+        .def("setParams", &PotentialExternalCosineWall::setParamsPython)
+        .def("getParams", &PotentialExternalCosineWall::getParams)
+        .def("setGeometry",
+             [](PotentialExternalCosineWall& self, const CosineChannel& geom)
+             { self.getField()->setGeometry(geom); })
+        .def("setGeometry",
+             [](PotentialExternalCosineWall& self, const CosineExpansionContraction& geom)
+             { self.getField()->setGeometry(geom); });
+    }
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
@@ -0,0 +1,36 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/PotentialExternalCosineWall.h
+ * \brief Declares the MD external potential from the walls of the MPCD cosine geometries
+ */
+
+#ifndef MPCD_POTENTIAL_EXTERNAL_COSINE_WALL_H_
+#define MPCD_POTENTIAL_EXTERNAL_COSINE_WALL_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "EvaluatorExternalCosineWall.h"
+
+#include "hoomd/md/PotentialExternal.h"
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! External potential on MD particles from the walls of a cosine geometry
+typedef md::PotentialExternal<EvaluatorExternalCosineWall> PotentialExternalCosineWall;
+
+namespace detail
+    {
+//! Export PotentialExternalCosineWall to python
+void export_PotentialExternalCosineWall(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+
+#endif // MPCD_POTENTIAL_EXTERNAL_COSINE_WALL_H_
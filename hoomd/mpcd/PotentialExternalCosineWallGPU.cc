@@ -0,0 +1,29 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/PotentialExternalCosineWallGPU.cc
+ * \brief Exports the MD external potential from the walls of the MPCD cosine geometries on the
+ *        GPU
+ */
+
+#include "PotentialExternalCosineWallGPU.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace detail
+    {
+/*!
+ * \param m Python module to export to
+ */
+void export_PotentialExternalCosineWallGPU(pybind11::module& m)
+    {
+    md::detail::export_PotentialExternalGPU<EvaluatorExternalCosineWall>(
+        m,
+        "PotentialExternalCosineWallGPU");
+    }
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
@@ -0,0 +1,28 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/PotentialExternalCosineWallGPU.cu
+ * \brief Template instantiation of the external potential kernel for the walls of the MPCD cosine
+ *        geometries
+ */
+
+#include "EvaluatorExternalCosineWall.h"
+
+#include "hoomd/md/PotentialExternalGPU.cuh"
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Template instantiation of the cosine wall potential
+template __attribute__((visibility("default"))) hipError_t
+gpu_compute_potential_external_forces<mpcd::EvaluatorExternalCosineWall>(
+    const external_potential_args_t& external_potential_args,
+    const typename mpcd::EvaluatorExternalCosineWall::param_type* d_params,
+    const typename mpcd::EvaluatorExternalCosineWall::field_type* d_field);
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,36 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/PotentialExternalCosineWallGPU.h
+ * \brief Declares the MD external potential from the walls of the MPCD cosine geometries on the
+ *        GPU
+ */
+
+#ifndef MPCD_POTENTIAL_EXTERNAL_COSINE_WALL_GPU_H_
+#define MPCD_POTENTIAL_EXTERNAL_COSINE_WALL_GPU_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "PotentialExternalCosineWall.h"
+
+#include "hoomd/md/PotentialExternalGPU.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! External potential on MD particles from the walls of a cosine geometry on the GPU
+typedef md::PotentialExternalGPU<EvaluatorExternalCosineWall> PotentialExternalCosineWallGPU;
+
+namespace detail
+    {
+//! Export PotentialExternalCosineWallGPU to python
+void export_PotentialExternalCosineWallGPU(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+
+#endif // MPCD_POTENTIAL_EXTERNAL_COSINE_WALL_GPU_H_
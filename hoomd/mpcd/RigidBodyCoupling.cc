@@ -0,0 +1,166 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/RigidBodyCoupling.cc
+ * \brief Definition of mpcd::RigidBodyCoupling
+ */
+
+#include "RigidBodyCoupling.h"
+
+namespace hoomd
+    {
+/*!
+ * \param sysdef System definition
+ * \param group Central particles of the coupled bodies
+ * \param radius Radius of the bodies
+ * \param bc Boundary condition at the surface of the bodies
+ */
+mpcd::RigidBodyCoupling::RigidBodyCoupling(std::shared_ptr<SystemDefinition> sysdef,
+                                           std::shared_ptr<ParticleGroup> group,
+                                           Scalar radius,
+                                           mpcd::detail::boundary bc)
+    : ForceCompute(sysdef), m_group(group), m_radius(0), m_bc(bc), m_bodies(m_exec_conf),
+      m_impulse(m_exec_conf), m_angular_impulse(m_exec_conf), m_has_impulse(false)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing MPCD RigidBodyCoupling" << std::endl;
+    setRadius(radius);
+    }
+
+mpcd::RigidBodyCoupling::~RigidBodyCoupling()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying MPCD RigidBodyCoupling" << std::endl;
+    }
+
+/*!
+ * \param radius Radius of the bodies
+ */
+void mpcd::RigidBodyCoupling::setRadius(Scalar radius)
+    {
+    if (!(radius > Scalar(0)))
+        {
+        m_exec_conf->msg->error() << "mpcd: rigid body radius must be positive" << std::endl;
+        throw std::runtime_error("Invalid MPCD rigid body radius");
+        }
+    m_radius = radius;
+    }
+
+/*!
+ * The state of each body is computed from its central particle, and the impulses are zeroed. The
+ * impulses that are summed while streaming are applied the next time the forces are computed.
+ */
+void mpcd::RigidBodyCoupling::beginStreaming()
+    {
+    checkSystem();
+
+    const unsigned int N = m_group->getNumMembers();
+    m_bodies.resize(N);
+    m_impulse.resize(N);
+    m_angular_impulse.resize(N);
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(),
+                                  access_location::host,
+                                  access_mode::read);
+    ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(),
+                                   access_location::host,
+                                   access_mode::read);
+    ArrayHandle<unsigned int> h_index(m_group->getIndexArray(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<mpcd::detail::RigidBodyState> h_bodies(m_bodies,
+                                                       access_location::host,
+                                                       access_mode::overwrite);
+    ArrayHandle<Scalar3> h_impulse(m_impulse, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar3> h_angular_impulse(m_angular_impulse,
+                                           access_location::host,
+                                           access_mode::overwrite);
+
+    for (unsigned int i = 0; i < N; ++i)
+        {
+        const unsigned int idx = h_index.data[i];
+        h_bodies.data[i] = mpcd::detail::makeRigidBodyState(h_pos.data[idx],
+                                                            h_vel.data[idx],
+                                                            h_orientation.data[idx],
+                                                            h_angmom.data[idx],
+                                                            h_inertia.data[idx]);
+        h_impulse.data[i] = make_scalar3(0, 0, 0);
+        h_angular_impulse.data[i] = make_scalar3(0, 0, 0);
+        }
+    m_has_impulse = true;
+    }
+
+/*!
+ * \param timestep Current timestep
+ *
+ * The impulses from the last streaming step are converted to forces and torques on the central
+ * particles. They are only applied once, and the forces are zero until the next streaming step.
+ */
+void mpcd::RigidBodyCoupling::computeForces(uint64_t timestep)
+    {
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar4> h_torque(m_torque, access_location::host, access_mode::overwrite);
+    memset(h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+    memset(h_torque.data, 0, sizeof(Scalar4) * m_torque.getNumElements());
+    if (!m_has_impulse)
+        return;
+
+    ArrayHandle<unsigned int> h_index(m_group->getIndexArray(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<Scalar3> h_impulse(m_impulse, access_location::host, access_mode::read);
+    ArrayHandle<Scalar3> h_angular_impulse(m_angular_impulse,
+                                           access_location::host,
+                                           access_mode::read);
+    const Scalar inv_dt = Scalar(1) / m_deltaT;
+    for (unsigned int i = 0; i < getNumBodies(); ++i)
+        {
+        const unsigned int idx = h_index.data[i];
+        const Scalar3 dp = h_impulse.data[i];
+        const Scalar3 dL = h_angular_impulse.data[i];
+        h_force.data[idx] = make_scalar4(dp.x * inv_dt, dp.y * inv_dt, dp.z * inv_dt, 0);
+        h_torque.data[idx] = make_scalar4(dL.x * inv_dt, dL.y * inv_dt, dL.z * inv_dt, 0);
+        }
+    m_has_impulse = false;
+    }
+
+void mpcd::RigidBodyCoupling::checkSystem() const
+    {
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        m_exec_conf->msg->error()
+            << "mpcd: rigid body coupling is not supported with domain decomposition" << std::endl;
+        throw std::runtime_error("MPCD rigid body coupling does not support domain decomposition");
+        }
+#endif // ENABLE_MPI
+    }
+
+/*!
+ * \param m Python module to export to
+ */
+void mpcd::detail::export_RigidBodyCoupling(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::RigidBodyCoupling,
+                     ForceCompute,
+                     std::shared_ptr<mpcd::RigidBodyCoupling>>(m, "RigidBodyCoupling")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<ParticleGroup>,
+                            Scalar,
+                            mpcd::detail::boundary>())
+        .def_property_readonly("filter",
+                               [](const mpcd::RigidBodyCoupling& self)
+                               { return self.getGroup()->getFilter(); })
+        .def_property("radius",
+                      &mpcd::RigidBodyCoupling::getRadius,
+                      &mpcd::RigidBodyCoupling::setRadius)
+        .def_property("boundary",
+                      &mpcd::RigidBodyCoupling::getBoundaryCondition,
+                      &mpcd::RigidBodyCoupling::setBoundaryCondition);
+    }
+
+    } // end namespace hoomd
@@ -0,0 +1,151 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/RigidBodyCoupling.h
+ * \brief Declaration of mpcd::RigidBodyCoupling
+ */
+
+#ifndef MPCD_RIGID_BODY_COUPLING_H_
+#define MPCD_RIGID_BODY_COUPLING_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "RigidBodyObstacles.h"
+
+#include "hoomd/ForceCompute.h"
+#include "hoomd/GPUVector.h"
+#include "hoomd/ParticleGroup.h"
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Couples MD rigid bodies to the MPCD solvent by momentum exchange at their surfaces
+/*!
+ * The particles in the group (typically the central particles of the rigid bodies defined by
+ * md::ForceComposite) are treated as spherical obstacles by the mpcd::ConfinedStreamingMethod. The
+ * MPCD particles are reflected from the surfaces of the bodies while they stream (see
+ * mpcd::detail::RigidBodyObstacles), and the momentum and angular momentum they lose is summed for
+ * each body. This replaces filling the bodies with frozen MD particles that are embedded in the
+ * collision.
+ *
+ * The summed impulses are applied to the bodies as a force and torque during the next MD step,
+ * which comes right after the streaming step, so that both the MPCD particles and the bodies see
+ * the exchange in the same step. The force is \f$ \Delta\mathbf{p} / \Delta t \f$, where
+ * \f$ \Delta t \f$ is the MD timestep, and it is zero in MD steps with no streaming. The force
+ * must be added to the MD integrator for the momentum to be conserved.
+ *
+ * The bodies are approximated as not moving while the MPCD particles stream, and their velocities
+ * and angular velocities are taken when streaming starts. Only simulations that are not domain
+ * decomposed are currently supported because the impulses on ghost bodies are not communicated.
+ */
+class PYBIND11_EXPORT RigidBodyCoupling : public ForceCompute
+    {
+    public:
+    //! Constructor
+    RigidBodyCoupling(std::shared_ptr<SystemDefinition> sysdef,
+                      std::shared_ptr<ParticleGroup> group,
+                      Scalar radius,
+                      mpcd::detail::boundary bc);
+
+    //! Destructor
+    virtual ~RigidBodyCoupling();
+
+    //! Get the group of coupled bodies
+    std::shared_ptr<ParticleGroup> getGroup() const
+        {
+        return m_group;
+        }
+
+    //! Get the radius of the bodies
+    Scalar getRadius() const
+        {
+        return m_radius;
+        }
+
+    //! Set the radius of the bodies
+    void setRadius(Scalar radius);
+
+    //! Get the boundary condition at the surface of the bodies
+    mpcd::detail::boundary getBoundaryCondition() const
+        {
+        return m_bc;
+        }
+
+    //! Set the boundary condition at the surface of the bodies
+    void setBoundaryCondition(mpcd::detail::boundary bc)
+        {
+        m_bc = bc;
+        }
+
+    //! Prepare the bodies for a streaming step
+    virtual void beginStreaming();
+
+    //! Get the number of coupled bodies in the current streaming step
+    unsigned int getNumBodies() const
+        {
+        return static_cast<unsigned int>(m_bodies.size());
+        }
+
+    //! Get the state of the bodies
+    const GPUVector<mpcd::detail::RigidBodyState>& getBodies() const
+        {
+        return m_bodies;
+        }
+
+    //! Get the momentum transferred to each body
+    GPUVector<Scalar3>& getImpulses()
+        {
+        return m_impulse;
+        }
+
+    //! Get the angular momentum transferred to each body
+    GPUVector<Scalar3>& getAngularImpulses()
+        {
+        return m_angular_impulse;
+        }
+
+    //! Get the obstacles for streaming
+    /*!
+     * \param bodies State of the bodies, accessed from getBodies()
+     * \returns Obstacles that use \a bodies
+     */
+    mpcd::detail::RigidBodyObstacles getObstacles(const mpcd::detail::RigidBodyState* bodies) const
+        {
+        return mpcd::detail::RigidBodyObstacles(bodies,
+                                                getNumBodies(),
+                                                m_radius,
+                                                m_bc,
+                                                m_pdata->getGlobalBox());
+        }
+
+    protected:
+    std::shared_ptr<ParticleGroup> m_group; //!< Central particles of the coupled bodies
+    Scalar m_radius;                        //!< Radius of the bodies
+    mpcd::detail::boundary m_bc;            //!< Boundary condition at the surface of the bodies
+
+    GPUVector<mpcd::detail::RigidBodyState> m_bodies; //!< State of the bodies
+    GPUVector<Scalar3> m_impulse;                     //!< Momentum transferred to the bodies
+    GPUVector<Scalar3> m_angular_impulse; //!< Angular momentum transferred to the bodies
+    bool m_has_impulse; //!< If true, the impulses have not been applied yet
+
+    //! Apply the transferred momentum as forces
+    virtual void computeForces(uint64_t timestep);
+
+    //! Check that the coupling is supported by the system
+    void checkSystem() const;
+    };
+
+namespace detail
+    {
+//! Export mpcd::RigidBodyCoupling to python
+void export_RigidBodyCoupling(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+
+#endif // MPCD_RIGID_BODY_COUPLING_H_
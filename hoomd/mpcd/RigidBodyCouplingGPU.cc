@@ -0,0 +1,135 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/RigidBodyCouplingGPU.cc
+ * \brief Definition of mpcd::RigidBodyCouplingGPU
+ */
+
+#include "RigidBodyCouplingGPU.h"
+#include "RigidBodyCouplingGPU.cuh"
+
+namespace hoomd
+    {
+/*!
+ * \param sysdef System definition
+ * \param group Central particles of the coupled bodies
+ * \param radius Radius of the bodies
+ * \param bc Boundary condition at the surface of the bodies
+ */
+mpcd::RigidBodyCouplingGPU::RigidBodyCouplingGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                                 std::shared_ptr<ParticleGroup> group,
+                                                 Scalar radius,
+                                                 mpcd::detail::boundary bc)
+    : mpcd::RigidBodyCoupling(sysdef, group, radius, bc)
+    {
+    m_prepare_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                           m_exec_conf,
+                                           "mpcd_rigid_body_prepare"));
+    m_force_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                         m_exec_conf,
+                                         "mpcd_rigid_body_force"));
+    m_autotuners.insert(m_autotuners.end(), {m_prepare_tuner, m_force_tuner});
+    }
+
+void mpcd::RigidBodyCouplingGPU::beginStreaming()
+    {
+    checkSystem();
+
+    const unsigned int N = m_group->getNumMembers();
+    m_bodies.resize(N);
+    m_impulse.resize(N);
+    m_angular_impulse.resize(N);
+
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                               access_location::device,
+                               access_mode::read);
+    ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
+                                       access_location::device,
+                                       access_mode::read);
+    ArrayHandle<Scalar4> d_angmom(m_pdata->getAngularMomentumArray(),
+                                  access_location::device,
+                                  access_mode::read);
+    ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(),
+                                   access_location::device,
+                                   access_mode::read);
+    ArrayHandle<unsigned int> d_index(m_group->getIndexArray(),
+                                      access_location::device,
+                                      access_mode::read);
+    ArrayHandle<mpcd::detail::RigidBodyState> d_bodies(m_bodies,
+                                                       access_location::device,
+                                                       access_mode::overwrite);
+    ArrayHandle<Scalar3> d_impulse(m_impulse, access_location::device, access_mode::overwrite);
+    ArrayHandle<Scalar3> d_angular_impulse(m_angular_impulse,
+                                           access_location::device,
+                                           access_mode::overwrite);
+
+    m_prepare_tuner->begin();
+    mpcd::gpu::rigid_body_coupling_prepare(d_bodies.data,
+                                           d_impulse.data,
+                                           d_angular_impulse.data,
+                                           d_pos.data,
+                                           d_vel.data,
+                                           d_orientation.data,
+                                           d_angmom.data,
+                                           d_inertia.data,
+                                           d_index.data,
+                                           N,
+                                           m_prepare_tuner->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_prepare_tuner->end();
+    m_has_impulse = true;
+    }
+
+/*!
+ * \param timestep Current timestep
+ */
+void mpcd::RigidBodyCouplingGPU::computeForces(uint64_t timestep)
+    {
+    ArrayHandle<Scalar4> d_force(m_force, access_location::device, access_mode::overwrite);
+    ArrayHandle<Scalar4> d_torque(m_torque, access_location::device, access_mode::overwrite);
+    hipMemset(d_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+    hipMemset(d_torque.data, 0, sizeof(Scalar4) * m_torque.getNumElements());
+    if (!m_has_impulse)
+        return;
+
+    ArrayHandle<unsigned int> d_index(m_group->getIndexArray(),
+                                      access_location::device,
+                                      access_mode::read);
+    ArrayHandle<Scalar3> d_impulse(m_impulse, access_location::device, access_mode::read);
+    ArrayHandle<Scalar3> d_angular_impulse(m_angular_impulse,
+                                           access_location::device,
+                                           access_mode::read);
+
+    m_force_tuner->begin();
+    mpcd::gpu::rigid_body_coupling_force(d_force.data,
+                                         d_torque.data,
+                                         d_impulse.data,
+                                         d_angular_impulse.data,
+                                         d_index.data,
+                                         Scalar(1) / m_deltaT,
+                                         getNumBodies(),
+                                         m_force_tuner->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_force_tuner->end();
+    m_has_impulse = false;
+    }
+
+/*!
+ * \param m Python module to export to
+ */
+void mpcd::detail::export_RigidBodyCouplingGPU(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::RigidBodyCouplingGPU,
+                     mpcd::RigidBodyCoupling,
+                     std::shared_ptr<mpcd::RigidBodyCouplingGPU>>(m, "RigidBodyCouplingGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<ParticleGroup>,
+                            Scalar,
+                            mpcd::detail::boundary>());
+    }
+
+    } // end namespace hoomd
@@ -0,0 +1,192 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/RigidBodyCouplingGPU.cu
+ * \brief Defines GPU functions and kernels used by mpcd::RigidBodyCouplingGPU
+ */
+
+#include "RigidBodyCouplingGPU.cuh"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace gpu
+    {
+namespace kernel
+    {
+/*!
+ * \param d_bodies State of the bodies (output)
+ * \param d_impulse Momentum transferred to the bodies (output)
+ * \param d_angular_impulse Angular momentum transferred to the bodies (output)
+ * \param d_pos MD particle positions
+ * \param d_vel MD particle velocities
+ * \param d_orientation MD particle orientations
+ * \param d_angmom MD particle angular momenta
+ * \param d_inertia MD particle moments of inertia
+ * \param d_index Indexes of the central particles of the bodies
+ * \param N Number of bodies
+ *
+ * \b Implementation:
+ *
+ * Using one thread per body, the state of the body is computed from its central particle and its
+ * impulses are zeroed.
+ */
+__global__ void rigid_body_coupling_prepare(mpcd::detail::RigidBodyState* d_bodies,
+                                            Scalar3* d_impulse,
+                                            Scalar3* d_angular_impulse,
+                                            const Scalar4* d_pos,
+                                            const Scalar4* d_vel,
+                                            const Scalar4* d_orientation,
+                                            const Scalar4* d_angmom,
+                                            const Scalar3* d_inertia,
+                                            const unsigned int* d_index,
+                                            const unsigned int N)
+    {
+    // one thread per body
+    const unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= N)
+        return;
+
+    const unsigned int idx = d_index[i];
+    d_bodies[i] = mpcd::detail::makeRigidBodyState(d_pos[idx],
+                                                   d_vel[idx],
+                                                   d_orientation[idx],
+                                                   d_angmom[idx],
+                                                   d_inertia[idx]);
+    d_impulse[i] = make_scalar3(0, 0, 0);
+    d_angular_impulse[i] = make_scalar3(0, 0, 0);
+    }
+
+/*!
+ * \param d_force Forces on the MD particles
+ * \param d_torque Torques on the MD particles
+ * \param d_impulse Momentum transferred to the bodies
+ * \param d_angular_impulse Angular momentum transferred to the bodies
+ * \param d_index Indexes of the central particles of the bodies
+ * \param inv_dt Inverse of the MD timestep
+ * \param N Number of bodies
+ *
+ * \b Implementation:
+ *
+ * Using one thread per body, the impulses are divided by the timestep and written as the force and
+ * torque on the central particle.
+ */
+__global__ void rigid_body_coupling_force(Scalar4* d_force,
+                                          Scalar4* d_torque,
+                                          const Scalar3* d_impulse,
+                                          const Scalar3* d_angular_impulse,
+                                          const unsigned int* d_index,
+                                          const Scalar inv_dt,
+                                          const unsigned int N)
+    {
+    // one thread per body
+    const unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= N)
+        return;
+
+    const unsigned int idx = d_index[i];
+    const Scalar3 dp = d_impulse[i];
+    const Scalar3 dL = d_angular_impulse[i];
+    d_force[idx] = make_scalar4(dp.x * inv_dt, dp.y * inv_dt, dp.z * inv_dt, 0);
+    d_torque[idx] = make_scalar4(dL.x * inv_dt, dL.y * inv_dt, dL.z * inv_dt, 0);
+    }
+    } // end namespace kernel
+
+/*!
+ * \param d_bodies State of the bodies (output)
+ * \param d_impulse Momentum transferred to the bodies (output)
+ * \param d_angular_impulse Angular momentum transferred to the bodies (output)
+ * \param d_pos MD particle positions
+ * \param d_vel MD particle velocities
+ * \param d_orientation MD particle orientations
+ * \param d_angmom MD particle angular momenta
+ * \param d_inertia MD particle moments of inertia
+ * \param d_index Indexes of the central particles of the bodies
+ * \param N Number of bodies
+ * \param block_size Number of threads per block
+ *
+ * \sa kernel::rigid_body_coupling_prepare
+ */
+cudaError_t rigid_body_coupling_prepare(mpcd::detail::RigidBodyState* d_bodies,
+                                        Scalar3* d_impulse,
+                                        Scalar3* d_angular_impulse,
+                                        const Scalar4* d_pos,
+                                        const Scalar4* d_vel,
+                                        const Scalar4* d_orientation,
+                                        const Scalar4* d_angmom,
+                                        const Scalar3* d_inertia,
+                                        const unsigned int* d_index,
+                                        const unsigned int N,
+                                        const unsigned int block_size)
+    {
+    if (N == 0)
+        return cudaSuccess;
+
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)kernel::rigid_body_coupling_prepare);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid(N / run_block_size + 1);
+    kernel::rigid_body_coupling_prepare<<<grid, run_block_size>>>(d_bodies,
+                                                                  d_impulse,
+                                                                  d_angular_impulse,
+                                                                  d_pos,
+                                                                  d_vel,
+                                                                  d_orientation,
+                                                                  d_angmom,
+                                                                  d_inertia,
+                                                                  d_index,
+                                                                  N);
+
+    return cudaSuccess;
+    }
+
+/*!
+ * \param d_force Forces on the MD particles
+ * \param d_torque Torques on the MD particles
+ * \param d_impulse Momentum transferred to the bodies
+ * \param d_angular_impulse Angular momentum transferred to the bodies
+ * \param d_index Indexes of the central particles of the bodies
+ * \param inv_dt Inverse of the MD timestep
+ * \param N Number of bodies
+ * \param block_size Number of threads per block
+ *
+ * \sa kernel::rigid_body_coupling_force
+ */
+cudaError_t rigid_body_coupling_force(Scalar4* d_force,
+                                      Scalar4* d_torque,
+                                      const Scalar3* d_impulse,
+                                      const Scalar3* d_angular_impulse,
+                                      const unsigned int* d_index,
+                                      const Scalar inv_dt,
+                                      const unsigned int N,
+                                      const unsigned int block_size)
+    {
+    if (N == 0)
+        return cudaSuccess;
+
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)kernel::rigid_body_coupling_force);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid(N / run_block_size + 1);
+    kernel::rigid_body_coupling_force<<<grid, run_block_size>>>(d_force,
+                                                                d_torque,
+                                                                d_impulse,
+                                                                d_angular_impulse,
+                                                                d_index,
+                                                                inv_dt,
+                                                                N);
+
+    return cudaSuccess;
+    }
+
+    } // end namespace gpu
+    } // end namespace mpcd
+    } // end namespace hoomd
@@ -0,0 +1,49 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef MPCD_RIGID_BODY_COUPLING_GPU_CUH_
+#define MPCD_RIGID_BODY_COUPLING_GPU_CUH_
+
+/*!
+ * \file mpcd/RigidBodyCouplingGPU.cuh
+ * \brief Declaration of CUDA kernels for mpcd::RigidBodyCouplingGPU
+ */
+
+#include <cuda_runtime.h>
+
+#include "RigidBodyObstacles.h"
+#include "hoomd/HOOMDMath.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace gpu
+    {
+//! Kernel driver to prepare the rigid bodies for a streaming step
+cudaError_t rigid_body_coupling_prepare(mpcd::detail::RigidBodyState* d_bodies,
+                                        Scalar3* d_impulse,
+                                        Scalar3* d_angular_impulse,
+                                        const Scalar4* d_pos,
+                                        const Scalar4* d_vel,
+                                        const Scalar4* d_orientation,
+                                        const Scalar4* d_angmom,
+                                        const Scalar3* d_inertia,
+                                        const unsigned int* d_index,
+                                        const unsigned int N,
+                                        const unsigned int block_size);
+
+//! Kernel driver to apply the transferred momentum to the rigid bodies as forces
+cudaError_t rigid_body_coupling_force(Scalar4* d_force,
+                                      Scalar4* d_torque,
+                                      const Scalar3* d_impulse,
+                                      const Scalar3* d_angular_impulse,
+                                      const unsigned int* d_index,
+                                      const Scalar inv_dt,
+                                      const unsigned int N,
+                                      const unsigned int block_size);
+
+    } // end namespace gpu
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_RIGID_BODY_COUPLING_GPU_CUH_
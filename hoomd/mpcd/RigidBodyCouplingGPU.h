@@ -0,0 +1,56 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/RigidBodyCouplingGPU.h
+ * \brief Declaration of mpcd::RigidBodyCouplingGPU
+ */
+
+#ifndef MPCD_RIGID_BODY_COUPLING_GPU_H_
+#define MPCD_RIGID_BODY_COUPLING_GPU_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "RigidBodyCoupling.h"
+#include "hoomd/Autotuner.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Couples MD rigid bodies to the MPCD solvent on the GPU
+/*!
+ * See mpcd::RigidBodyCoupling for design details.
+ */
+class PYBIND11_EXPORT RigidBodyCouplingGPU : public mpcd::RigidBodyCoupling
+    {
+    public:
+    //! Constructor
+    RigidBodyCouplingGPU(std::shared_ptr<SystemDefinition> sysdef,
+                         std::shared_ptr<ParticleGroup> group,
+                         Scalar radius,
+                         mpcd::detail::boundary bc);
+
+    //! Prepare the bodies for a streaming step on the GPU
+    virtual void beginStreaming();
+
+    protected:
+    //! Apply the transferred momentum as forces on the GPU
+    virtual void computeForces(uint64_t timestep);
+
+    private:
+    std::shared_ptr<Autotuner<1>> m_prepare_tuner; //!< Tuner for preparing the bodies
+    std::shared_ptr<Autotuner<1>> m_force_tuner;   //!< Tuner for applying the forces
+    };
+
+namespace detail
+    {
+//! Export mpcd::RigidBodyCouplingGPU to python
+void export_RigidBodyCouplingGPU(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+
+#endif // MPCD_RIGID_BODY_COUPLING_GPU_H_
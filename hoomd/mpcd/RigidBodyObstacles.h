@@ -0,0 +1,228 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/RigidBodyObstacles.h
+ * \brief Definition of the moving obstacles used by mpcd::RigidBodyCoupling
+ */
+
+#ifndef MPCD_RIGID_BODY_OBSTACLES_H_
+#define MPCD_RIGID_BODY_OBSTACLES_H_
+
+#include "BoundaryCondition.h"
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/VectorMath.h"
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__ inline
+#else
+#define HOSTDEVICE inline __attribute__((always_inline))
+#endif // __HIPCC__
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace detail
+    {
+//! Kinematic state of a rigid body during a streaming step
+struct RigidBodyState
+    {
+    Scalar3 pos;   //!< Position of the center of the body
+    Scalar3 vel;   //!< Translational velocity of the body
+    Scalar3 omega; //!< Angular velocity of the body in the space frame
+    };
+
+//! Get the kinematic state of a rigid body from its central particle
+/*!
+ * \param postype Position and type of the central particle
+ * \param velmass Velocity and mass of the central particle
+ * \param orientation Orientation of the body
+ * \param angmom Angular momentum quaternion of the body (the same as used by the MD methods)
+ * \param inertia Principal moments of inertia of the body
+ *
+ * \returns State of the body. The angular velocity is zero about any axis with no inertia.
+ */
+HOSTDEVICE RigidBodyState makeRigidBodyState(const Scalar4& postype,
+                                             const Scalar4& velmass,
+                                             const Scalar4& orientation,
+                                             const Scalar4& angmom,
+                                             const Scalar3& inertia)
+    {
+    const quat<Scalar> q(orientation);
+    const quat<Scalar> p(angmom);
+    const vec3<Scalar> s = (conj(q) * p).v * Scalar(0.5);
+    const vec3<Scalar> omega_body((inertia.x > Scalar(0)) ? s.x / inertia.x : Scalar(0),
+                                  (inertia.y > Scalar(0)) ? s.y / inertia.y : Scalar(0),
+                                  (inertia.z > Scalar(0)) ? s.z / inertia.z : Scalar(0));
+
+    RigidBodyState state;
+    state.pos = make_scalar3(postype.x, postype.y, postype.z);
+    state.vel = make_scalar3(velmass.x, velmass.y, velmass.z);
+    state.omega = vec_to_scalar3(rotate(q, omega_body));
+    return state;
+    }
+
+//! Spherical obstacles that move with rigid bodies
+/*!
+ * Each body is a sphere of radius \a R centered on its central particle. The bodies do not move
+ * while the MPCD particles stream, but their surfaces have the velocity
+ * \f$ \mathbf{u} = \mathbf{V} + \boldsymbol{\omega} \times \mathbf{r} \f$ at a point
+ * \f$ \mathbf{r} \f$ relative to the center. An MPCD particle that streams into a body is moved
+ * back along its trajectory to the surface, and its velocity is updated with the boundary
+ * condition:
+ *
+ *  - no slip: \f$ \mathbf{v}' = 2\mathbf{u} - \mathbf{v} \f$ (bounce back)
+ *  - slip: \f$ \mathbf{v}' = \mathbf{v} - 2 [(\mathbf{v}-\mathbf{u})\cdot\mathbf{n}]\mathbf{n} \f$
+ *
+ * The change in velocity is returned so that the caller can transfer the momentum to the body.
+ * A particle that is already inside a body at the start of the step (because the body moved onto
+ * it) is placed on the surface along the radial direction through its starting position, and it
+ * stops streaming for the rest of the step.
+ */
+struct RigidBodyObstacles
+    {
+    //! Default constructor (no bodies)
+    HOSTDEVICE RigidBodyObstacles()
+        : bodies(nullptr), N(0), radius(0), bc(boundary::no_slip), box(BoxDim())
+        {
+        }
+
+    //! Constructor
+    /*!
+     * \param bodies_ State of the bodies
+     * \param N_ Number of bodies
+     * \param radius_ Radius of the bodies
+     * \param bc_ Boundary condition at the surface of the bodies
+     * \param box_ Global simulation box
+     */
+    HOSTDEVICE RigidBodyObstacles(const RigidBodyState* bodies_,
+                                  unsigned int N_,
+                                  Scalar radius_,
+                                  boundary bc_,
+                                  const BoxDim& box_)
+        : bodies(bodies_), N(N_), radius(radius_), bc(bc_), box(box_)
+        {
+        }
+
+    //! Detect and resolve a collision with a body
+    /*!
+     * \param pos Proposed particle position
+     * \param vel Proposed particle velocity
+     * \param dt Integration time remaining
+     * \param body Index of the body that was hit (output)
+     * \param r Position of the collision relative to the center of the body (output)
+     * \param dv Change in the velocity of the particle (output)
+     *
+     * \returns True if a collision occurred, and false otherwise
+     *
+     * \post If a collision occurred, the particle is moved to the surface of the body with its new
+     * velocity, and \a dt is set to the time that is left to stream.
+     *
+     * If the particle has entered more than one body, the collision with the body that it entered
+     * first is resolved. The bodies are checked with a loop over all of them, which is cheaper than
+     * a neighbor search as long as there are only a few bodies.
+     */
+    HOSTDEVICE bool detectCollision(Scalar3& pos,
+                                    Scalar3& vel,
+                                    Scalar& dt,
+                                    unsigned int& body,
+                                    Scalar3& r,
+                                    Scalar3& dv) const
+        {
+        const Scalar rsq = radius * radius;
+        const vec3<Scalar> v(vel);
+        const Scalar vsq = dot(v, v);
+
+        // find the body that the particle entered first, which is the one with the longest time
+        // since the particle crossed its surface
+        bool hit = false;
+        Scalar dt_back(0);
+        vec3<Scalar> d_hit;
+        for (unsigned int i = 0; i < N; ++i)
+            {
+            const vec3<Scalar> d(box.minImage(pos - bodies[i].pos));
+            const Scalar dsq = dot(d, d);
+            if (dsq >= rsq)
+                continue;
+
+            // solve |d - s v|^2 = R^2 for the time s > 0 since the particle crossed the surface
+            Scalar s = dt;
+            if (vsq > Scalar(0))
+                {
+                const Scalar b = dot(d, v);
+                s = (b + slow::sqrt(b * b - vsq * (dsq - rsq))) / vsq;
+                }
+            if (!hit || s > dt_back)
+                {
+                hit = true;
+                body = i;
+                dt_back = s;
+                d_hit = d;
+                }
+            }
+        if (!hit)
+            return false;
+
+        // find the point on the surface where the particle is put
+        vec3<Scalar> rc;
+        if (dt_back < dt)
+            {
+            rc = d_hit - dt_back * v;
+            }
+        else
+            {
+            // particle started inside the body, so it is pushed out radially from where it started
+            const vec3<Scalar> d_start = d_hit - dt * v;
+            const Scalar dsq = dot(d_start, d_start);
+            rc = (dsq > Scalar(0)) ? (radius * fast::rsqrt(dsq)) * d_start
+                                   : vec3<Scalar>(radius, 0, 0);
+            dt_back = Scalar(0);
+            }
+        pos += vec_to_scalar3(rc - d_hit);
+        dt = dt_back;
+
+        // velocity of the surface and the outward normal at the collision
+        const RigidBodyState state = bodies[body];
+        const vec3<Scalar> u = vec3<Scalar>(state.vel) + cross(vec3<Scalar>(state.omega), rc);
+        const vec3<Scalar> n = rc / radius;
+        const Scalar vn = dot(v - u, n);
+
+        // only a particle moving into the surface is reflected, otherwise it stays at the surface
+        vec3<Scalar> v_new = v;
+        if (vn < Scalar(0))
+            {
+            if (bc == boundary::no_slip)
+                {
+                v_new = Scalar(2) * u - v;
+                }
+            else
+                {
+                v_new = v - Scalar(2) * vn * n;
+                }
+            }
+        else
+            {
+            dt = Scalar(0);
+            }
+
+        vel = vec_to_scalar3(v_new);
+        r = vec_to_scalar3(rc);
+        dv = vec_to_scalar3(v_new - v);
+        return true;
+        }
+
+    const RigidBodyState* bodies; //!< State of the bodies
+    unsigned int N;               //!< Number of bodies
+    Scalar radius;                //!< Radius of the bodies
+    boundary bc;                  //!< Boundary condition at the surface of the bodies
+    BoxDim box;                   //!< Global simulation box
+    };
+
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+#undef HOSTDEVICE
+#endif // MPCD_RIGID_BODY_OBSTACLES_H_
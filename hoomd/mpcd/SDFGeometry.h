@@ -0,0 +1,363 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/SDFGeometry.h
+ * \brief Definition of the MPCD signed-distance-field geometry
+ */
+
+#ifndef MPCD_SDF_GEOMETRY_H_
+#define MPCD_SDF_GEOMETRY_H_
+
+#include "BoundaryCondition.h"
+#include "BracketedRootFinder.h"
+#include "CollisionStatistics.h"
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/Index1D.h"
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__ inline
+#else
+#define HOSTDEVICE inline __attribute__((always_inline))
+#include <string>
+#endif // __HIPCC__
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace detail
+    {
+//! Geometry defined by a signed distance field
+/*!
+ * The walls of this geometry are the zero level set of a signed distance field that is tabulated
+ * on a regular grid spanning the periodic simulation box. The distance is negative inside the
+ * fluid and positive inside the walls. Grid point (i,j,k) is at lo + (i,j,k) * spacing, and the
+ * field is periodic, so the spacing along each dimension is the box length divided by the number
+ * of grid points. A dimension with only one grid point is uniform along that direction, which
+ * allows a 2D profile to be extruded through the box.
+ *
+ * The distance is evaluated by trilinear interpolation of the grid, and the gradient of this
+ * interpolant is used as the wall normal. The collision point is found by sphere tracing along
+ * the trajectory from the last position inside the fluid, which narrows in on the first crossing
+ * of the wall even for thin features, and the crossing is then refined with a safeguarded Newton's
+ * method.
+ *
+ * The geometry does not own the grid values. It only holds a pointer to memory that must be
+ * accessible on both the host and the device (e.g., a ManagedArray) and must outlive the geometry.
+ */
+class __attribute__((visibility("default"))) SDFGeometry
+    {
+    public:
+    //! Constructor
+    /*!
+     * \param values Signed distance at the grid points, indexed by Index3D
+     * \param dim Number of grid points in each dimension
+     * \param L Box lengths spanned by the grid
+     * \param bc Boundary condition at the wall (slip or no-slip)
+     */
+    HOSTDEVICE SDFGeometry(const Scalar* values, uint3 dim, Scalar3 L, boundary bc)
+        : m_values(values), m_dim(dim), m_indexer(dim.x, dim.y, dim.z), m_L(L),
+          m_lo(Scalar(-0.5) * L),
+          m_inv_spacing(make_scalar3(dim.x / L.x, dim.y / L.y, dim.z / L.z)), m_bc(bc)
+        {
+        }
+
+    //! Detect collision between the particle and the boundary
+    /*!
+     * \param pos Proposed particle position
+     * \param vel Proposed particle velocity
+     * \param dt Integration time remaining
+     * \param stats Optional statistics to record the root finding into
+     *
+     * \returns True if a collision occurred, and false otherwise
+     *
+     * \post The particle position \a pos is moved to the point of reflection, the velocity \a vel
+     * is updated according to the appropriate bounce back rule, and the integration time \a dt is
+     * decreased to the amount of time remaining.
+     */
+    HOSTDEVICE bool detectCollision(Scalar3& pos,
+                                    Scalar3& vel,
+                                    Scalar& dt,
+                                    CollisionStatistics* stats = nullptr) const
+        {
+        // exit immediately if the particle is inside the fluid
+        Scalar3 grad;
+        const Scalar F_out = evaluate(pos, grad);
+        if (!(F_out > Scalar(0)))
+            {
+            dt = Scalar(0);
+            return false;
+            }
+
+        /*
+         * Find the time s that the particle has spent outside the fluid. The trajectory during
+         * the step is pos - s*vel for 0 <= s <= dt, so the crossing is bracketed by s = 0 (outside)
+         * and s = dt (inside). Sphere tracing marches the inside end of the bracket forward in time
+         * by the distance to the wall, which cannot skip over a wall for a true distance field, so
+         * the bracket is narrowed onto the first crossing. Sphere tracing converges slowly for
+         * trajectories that graze the wall, so it is only used for a few steps before the crossing
+         * is refined by findBracketedRoot.
+         */
+        const unsigned int max_trace = 4;
+        const unsigned int max_iteration = 16;
+        const Scalar target_precision = 1e-5;
+
+        const WallDistance F(*this, pos, vel);
+        Scalar s_lo = Scalar(0);
+        Scalar F_lo = F_out;
+        Scalar s_hi = dt;
+        Scalar F_hi, dF;
+        F(s_hi, F_hi, dF);
+
+        Scalar s_out = dt;
+        if (!(F_hi > Scalar(0)))
+            {
+            const Scalar inv_speed = fast::rsqrt(dot(vel, vel));
+            unsigned int iteration = 0;
+            while (iteration < max_trace && F_hi < -target_precision)
+                {
+                const Scalar s = s_hi + F_hi * inv_speed;
+                if (s <= s_lo)
+                    break;
+
+                Scalar F_s;
+                F(s, F_s, dF);
+                ++iteration;
+                if (F_s > Scalar(0))
+                    {
+                    s_lo = s;
+                    F_lo = F_s;
+                    break;
+                    }
+                s_hi = s;
+                F_hi = F_s;
+                }
+            if (stats)
+                {
+                stats->iterations += iteration;
+                }
+
+            s_out = findBracketedRoot(F,
+                                      s_lo,
+                                      F_lo,
+                                      s_hi,
+                                      F_hi,
+                                      target_precision,
+                                      max_iteration,
+                                      stats);
+            }
+
+        // Remaining integration time dt is amount of time spent traveling distance out of bounds.
+        pos -= s_out * vel;
+        dt = s_out;
+
+        /*
+         * Update velocity according to boundary conditions.
+         *
+         * The normal of the surface is the gradient of the distance field. If the gradient
+         * vanishes (e.g., on a ridge of the interpolated field), the particle is reflected back
+         * along its trajectory.
+         */
+        evaluate(pos, grad);
+        const Scalar grad_sq = dot(grad, grad);
+        if (m_bc == boundary::no_slip || !(grad_sq > Scalar(0)))
+            {
+            // no-slip requires reflection of both tangential and normal components
+            vel = -vel;
+            }
+        else
+            {
+            // slip requires only the normal component to be reflected. the reflected vector is
+            // v_reflected = v_incoming - 2*(n.v_incoming)*n.
+            vel -= (Scalar(2) * dot(vel, grad) / grad_sq) * grad;
+            }
+
+        return true;
+        }
+
+    //! Check if a particle is out of bounds
+    /*!
+     * \param pos Current particle position
+     * \returns True if particle is out of bounds, and false otherwise
+     */
+    HOSTDEVICE bool isOutside(const Scalar3& pos) const
+        {
+        Scalar3 grad;
+        return (evaluate(pos, grad) > Scalar(0));
+        }
+
+    //! Validate that the simulation box is consistent with the geometry
+    /*!
+     * \param box Global simulation box
+     * \param cell_size Size of MPCD cell
+     *
+     * The grid must span the global box, which must be orthorhombic. It is the responsibility of
+     * the user to pad the walls so that cells do not interact through the periodic boundaries.
+     */
+    HOSTDEVICE bool validateBox(const BoxDim& box, Scalar cell_size) const
+        {
+        const Scalar3 L = box.getL();
+        const Scalar tol = Scalar(1e-5);
+        return (fabs(L.x - m_L.x) <= tol * m_L.x && fabs(L.y - m_L.y) <= tol * m_L.y
+                && fabs(L.z - m_L.z) <= tol * m_L.z && box.getTiltFactorXY() == Scalar(0)
+                && box.getTiltFactorXZ() == Scalar(0) && box.getTiltFactorYZ() == Scalar(0));
+        }
+
+    //! Evaluate the signed distance and its gradient
+    /*!
+     * \param pos Position to evaluate at
+     * \param grad Gradient of the signed distance at \a pos (output)
+     * \returns Signed distance at \a pos
+     */
+    HOSTDEVICE Scalar evaluate(const Scalar3& pos, Scalar3& grad) const
+        {
+        unsigned int i0, i1, j0, j1, k0, k1;
+        const Scalar fx = locate((pos.x - m_lo.x) * m_inv_spacing.x, m_dim.x, i0, i1);
+        const Scalar fy = locate((pos.y - m_lo.y) * m_inv_spacing.y, m_dim.y, j0, j1);
+        const Scalar fz = locate((pos.z - m_lo.z) * m_inv_spacing.z, m_dim.z, k0, k1);
+
+        // interpolate along x
+        const Scalar c000 = fetch(i0, j0, k0);
+        const Scalar c100 = fetch(i1, j0, k0);
+        const Scalar c010 = fetch(i0, j1, k0);
+        const Scalar c110 = fetch(i1, j1, k0);
+        const Scalar c001 = fetch(i0, j0, k1);
+        const Scalar c101 = fetch(i1, j0, k1);
+        const Scalar c011 = fetch(i0, j1, k1);
+        const Scalar c111 = fetch(i1, j1, k1);
+        const Scalar c00 = c000 + fx * (c100 - c000);
+        const Scalar c10 = c010 + fx * (c110 - c010);
+        const Scalar c01 = c001 + fx * (c101 - c001);
+        const Scalar c11 = c011 + fx * (c111 - c011);
+
+        // interpolate along y
+        const Scalar c0 = c00 + fy * (c10 - c00);
+        const Scalar c1 = c01 + fy * (c11 - c01);
+
+        // gradient of the trilinear interpolant
+        const Scalar dx0 = (c100 - c000) + fy * ((c110 - c010) - (c100 - c000));
+        const Scalar dx1 = (c101 - c001) + fy * ((c111 - c011) - (c101 - c001));
+        grad.x = (dx0 + fz * (dx1 - dx0)) * m_inv_spacing.x;
+        grad.y = ((c10 - c00) + fz * ((c11 - c01) - (c10 - c00))) * m_inv_spacing.y;
+        grad.z = (c1 - c0) * m_inv_spacing.z;
+
+        // interpolate along z
+        return c0 + fz * (c1 - c0);
+        }
+
+    //! Get the number of grid points
+    HOSTDEVICE uint3 getDimensions() const
+        {
+        return m_dim;
+        }
+
+    //! Get the box lengths spanned by the grid
+    HOSTDEVICE Scalar3 getL() const
+        {
+        return m_L;
+        }
+
+    //! Get the position of the first grid point
+    HOSTDEVICE Scalar3 getLo() const
+        {
+        return m_lo;
+        }
+
+    //! Get the grid spacing
+    HOSTDEVICE Scalar3 getSpacing() const
+        {
+        return make_scalar3(m_L.x / m_dim.x, m_L.y / m_dim.y, m_L.z / m_dim.z);
+        }
+
+    //! Get the wall boundary condition
+    /*!
+     * \returns Boundary condition at wall
+     */
+    HOSTDEVICE boundary getBoundaryCondition() const
+        {
+        return m_bc;
+        }
+
+#ifndef __HIPCC__
+    //! Get the unique name of this geometry
+    static std::string getName()
+        {
+        return std::string("SDF");
+        }
+#endif // __HIPCC__
+
+    private:
+    //! Signed distance of a point on the particle trajectory
+    /*!
+     * The trajectory is traced backwards in time from the current position.
+     */
+    class WallDistance
+        {
+        public:
+        HOSTDEVICE WallDistance(const SDFGeometry& geom, const Scalar3& pos, const Scalar3& vel)
+            : m_geom(geom), m_pos(pos), m_vel(vel)
+            {
+            }
+
+        //! Evaluate the distance and its derivative at time \a s before the current position
+        HOSTDEVICE void operator()(Scalar s, Scalar& f, Scalar& df) const
+            {
+            Scalar3 grad;
+            f = m_geom.evaluate(m_pos - s * m_vel, grad);
+            df = -dot(grad, m_vel);
+            }
+
+        private:
+        const SDFGeometry& m_geom;
+        const Scalar3 m_pos;
+        const Scalar3 m_vel;
+        };
+
+    //! Locate a fractional grid coordinate on the periodic grid
+    /*!
+     * \param u Fractional grid coordinate
+     * \param n Number of grid points
+     * \param i0 Grid point at or below \a u (output)
+     * \param i1 Grid point above \a u (output)
+     * \returns Interpolation weight of \a i1
+     */
+    HOSTDEVICE static Scalar
+    locate(Scalar u, unsigned int n, unsigned int& i0, unsigned int& i1)
+        {
+        const Scalar u0 = floor(u);
+        int i = ((int)u0) % (int)n;
+        if (i < 0)
+            i += n;
+        i0 = i;
+        i1 = (i0 + 1 < n) ? i0 + 1 : 0;
+        return u - u0;
+        }
+
+    //! Load a grid value through the read-only cache
+    HOSTDEVICE Scalar fetch(unsigned int i, unsigned int j, unsigned int k) const
+        {
+#ifdef __HIP_DEVICE_COMPILE__
+        return __ldg(m_values + m_indexer(i, j, k));
+#else
+        return m_values[m_indexer(i, j, k)];
+#endif
+        }
+
+    const Scalar* m_values;      //!< Signed distance at the grid points
+    const uint3 m_dim;           //!< Number of grid points
+    const Index3D m_indexer;     //!< Indexer into the grid
+    const Scalar3 m_L;           //!< Box lengths spanned by the grid
+    const Scalar3 m_lo;          //!< Position of the first grid point
+    const Scalar3 m_inv_spacing; //!< Inverse of the grid spacing
+    const boundary m_bc;         //!< Boundary condition
+    };
+
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+#undef HOSTDEVICE
+
+#endif // MPCD_SDF_GEOMETRY_H_
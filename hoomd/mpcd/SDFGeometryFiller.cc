@@ -0,0 +1,273 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/SDFGeometryFiller.cc
+ * \brief Definition of mpcd::SDFGeometryFiller
+ */
+
+#include "SDFGeometryFiller.h"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace hoomd
+    {
+mpcd::SDFGeometryFiller::SDFGeometryFiller(std::shared_ptr<SystemDefinition> sysdef,
+                                           Scalar density,
+                                           unsigned int type,
+                                           std::shared_ptr<Variant> T,
+                                           std::shared_ptr<const mpcd::detail::SDFGeometry> geom)
+    : mpcd::VirtualParticleFiller(sysdef, density, type, T), m_thickness(0),
+      m_voxels(m_exec_conf)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing MPCD SDFGeometryFiller" << std::endl;
+
+    setGeometry(geom);
+
+    // unphysical values in cache to always force recompute
+    m_needs_recompute = true;
+    m_recompute_cache = make_scalar3(-1, -1, -1);
+    m_pdata->getBoxChangeSignal()
+        .connect<mpcd::SDFGeometryFiller, &mpcd::SDFGeometryFiller::notifyRecompute>(this);
+    }
+
+mpcd::SDFGeometryFiller::~SDFGeometryFiller()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying MPCD SDFGeometryFiller" << std::endl;
+    m_pdata->getBoxChangeSignal()
+        .disconnect<mpcd::SDFGeometryFiller, &mpcd::SDFGeometryFiller::notifyRecompute>(this);
+    }
+
+void mpcd::SDFGeometryFiller::computeNumFill()
+    {
+    const Scalar cell_size = m_cl->getCellSize();
+    const Scalar max_shift = m_cl->getMaxGridShift();
+
+    // check if fill-relevant variables have changed (can't use signal because cell list build may
+    // not have triggered yet)
+    m_needs_recompute |= (m_recompute_cache.x != cell_size || m_recompute_cache.y != max_shift
+                          || m_recompute_cache.z != m_density);
+
+    // only recompute if needed
+    if (!m_needs_recompute)
+        return;
+
+    // as a precaution, validate the global box with the current cell list
+    const BoxDim& global_box = m_pdata->getGlobalBox();
+    if (!m_geom->validateBox(global_box, cell_size))
+        {
+        m_exec_conf->msg->error()
+            << "Invalid SDF geometry for global box, cannot fill virtual particles." << std::endl;
+        throw std::runtime_error("Invalid SDF geometry for global box");
+        }
+
+    /*
+     * Any point in a cell that overlaps the inside of the geometry is within one cell diagonal of
+     * the wall, regardless of the grid shift, so this is the thickness of the layer to fill.
+     */
+    m_thickness = fast::sqrt(Scalar(3.0)) * cell_size;
+
+    // local box and grid
+    const BoxDim& box = m_pdata->getBox();
+    const Scalar3 lo = box.getLo();
+    const Scalar3 hi = box.getHi();
+    const uint3 dim = m_geom->getDimensions();
+    const Index3D indexer(dim.x, dim.y, dim.z);
+    const Scalar3 grid_lo = m_geom->getLo();
+    const Scalar3 h = m_geom->getSpacing();
+
+    // range of voxels overlapping the local box
+    const uint3 first = make_uint3(
+        (unsigned int)std::max(Scalar(0), std::floor((lo.x - grid_lo.x) / h.x)),
+        (unsigned int)std::max(Scalar(0), std::floor((lo.y - grid_lo.y) / h.y)),
+        (unsigned int)std::max(Scalar(0), std::floor((lo.z - grid_lo.z) / h.z)));
+    const uint3 last
+        = make_uint3(std::min(dim.x, (unsigned int)std::ceil((hi.x - grid_lo.x) / h.x)),
+                     std::min(dim.y, (unsigned int)std::ceil((hi.y - grid_lo.y) / h.y)),
+                     std::min(dim.z, (unsigned int)std::ceil((hi.z - grid_lo.z) / h.z)));
+
+    /*
+     * The volume of the layer in each voxel is estimated from a regular grid of sample points, with
+     * enough points to resolve the local box (and cells) in voxels that are large. The field does
+     * not vary along dimensions with only one grid point, so the largest distance from the voxel
+     * center to a point in the voxel only accounts for the others. The field is (approximately)
+     * a distance, so voxels whose centers are farther than this from the layer are skipped.
+     */
+    auto num_samples = [cell_size](Scalar spacing)
+    { return std::min(64u, std::max(4u, (unsigned int)std::ceil(4 * spacing / cell_size))); };
+    const uint3 n = make_uint3(num_samples(h.x), num_samples(h.y), num_samples(h.z));
+    const Scalar3 h_sample = make_scalar3(h.x / n.x, h.y / n.y, h.z / n.z);
+    const Scalar sample_volume = h_sample.x * h_sample.y * h_sample.z;
+    const Scalar half_diagonal = Scalar(0.5)
+                                 * fast::sqrt(((dim.x > 1) ? h.x * h.x : Scalar(0))
+                                              + ((dim.y > 1) ? h.y * h.y : Scalar(0))
+                                              + ((dim.z > 1) ? h.z * h.z : Scalar(0)));
+    const Scalar margin = Scalar(2.0) * half_diagonal;
+
+    std::vector<Scalar4> voxels;
+    Scalar volume(0);
+    for (unsigned int k = first.z; k < last.z; ++k)
+        {
+        for (unsigned int j = first.y; j < last.y; ++j)
+            {
+            for (unsigned int i = first.x; i < last.x; ++i)
+                {
+                const Scalar3 voxel_lo = grid_lo + make_scalar3(i * h.x, j * h.y, k * h.z);
+                Scalar3 grad;
+                const Scalar center = m_geom->evaluate(voxel_lo + Scalar(0.5) * h, grad);
+                if (center < -margin || center > m_thickness + margin)
+                    continue;
+
+                unsigned int num_inside = 0;
+                Scalar3 found = make_scalar3(0, 0, 0);
+                for (unsigned int c = 0; c < n.z; ++c)
+                    {
+                    for (unsigned int b = 0; b < n.y; ++b)
+                        {
+                        for (unsigned int a = 0; a < n.x; ++a)
+                            {
+                            const Scalar3 r
+                                = voxel_lo
+                                  + make_scalar3((a + Scalar(0.5)) * h_sample.x,
+                                                 (b + Scalar(0.5)) * h_sample.y,
+                                                 (c + Scalar(0.5)) * h_sample.z);
+                            if (r.x < lo.x || r.x >= hi.x || r.y < lo.y || r.y >= hi.y
+                                || r.z < lo.z || r.z >= hi.z)
+                                continue;
+
+                            const Scalar sdf = m_geom->evaluate(r, grad);
+                            if (sdf > Scalar(0) && sdf <= m_thickness)
+                                {
+                                found = r;
+                                ++num_inside;
+                                }
+                            }
+                        }
+                    }
+
+                if (num_inside > 0)
+                    {
+                    voxels.push_back(make_scalar4(found.x,
+                                                  found.y,
+                                                  found.z,
+                                                  __int_as_scalar(indexer(i, j, k))));
+                    volume += num_inside * sample_volume;
+                    }
+                }
+            }
+        }
+
+    m_voxels.resize(static_cast<unsigned int>(voxels.size()));
+        {
+        ArrayHandle<Scalar4> h_voxels(m_voxels, access_location::host, access_mode::overwrite);
+        std::copy(voxels.begin(), voxels.end(), h_voxels.data);
+        }
+    m_N_fill = (voxels.empty()) ? 0 : (unsigned int)std::round(volume * m_density);
+
+    // size is now updated, cache the cell dimensions used
+    m_needs_recompute = false;
+    m_recompute_cache = make_scalar3(cell_size, max_shift, m_density);
+    }
+
+/*!
+ * \param timestep Current timestep to draw particles
+ */
+void mpcd::SDFGeometryFiller::drawParticles(uint64_t timestep)
+    {
+    // quit early if not filling to ensure we don't access any memory that hasn't been set
+    if (m_N_fill == 0)
+        return;
+
+    ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::host,
+                                      access_mode::readwrite);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::readwrite);
+    ArrayHandle<unsigned int> h_tag(m_mpcd_pdata->getTags(),
+                                    access_location::host,
+                                    access_mode::readwrite);
+    ArrayHandle<Scalar4> h_voxels(m_voxels, access_location::host, access_mode::read);
+    const unsigned int num_voxels = static_cast<unsigned int>(m_voxels.size());
+
+    const BoxDim& box = m_pdata->getBox();
+    const Scalar3 lo = box.getLo();
+    const Scalar3 hi = box.getHi();
+    const uint3 dim = m_geom->getDimensions();
+    const Index3D indexer(dim.x, dim.y, dim.z);
+    const Scalar3 grid_lo = m_geom->getLo();
+    const Scalar3 h = m_geom->getSpacing();
+
+    const Scalar vel_factor = fast::sqrt((*m_T)(timestep) / m_mpcd_pdata->getMass());
+
+    uint16_t seed = m_sysdef->getSeed();
+
+    // index to start filling from
+    const unsigned int first_idx = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual() - m_N_fill;
+    for (unsigned int i = 0; i < m_N_fill; ++i)
+        {
+        const unsigned int tag = m_first_tag + i;
+        hoomd::RandomGenerator rng(
+            hoomd::Seed(hoomd::RNGIdentifier::SDFGeometryFiller, timestep, seed),
+            hoomd::Counter(tag));
+
+        // rejection sample a point in the layer
+        hoomd::UniformDistribution<Scalar> uniform(0, 1);
+        Scalar3 r;
+        Scalar4 voxel;
+        bool accept = false;
+        for (unsigned int attempt = 0; attempt < MAX_ATTEMPTS && !accept; ++attempt)
+            {
+            voxel = h_voxels.data[hoomd::UniformIntDistribution(num_voxels - 1)(rng)];
+            const uint3 ijk = indexer.getTriple(__scalar_as_int(voxel.w));
+            r.x = grid_lo.x + (ijk.x + uniform(rng)) * h.x;
+            r.y = grid_lo.y + (ijk.y + uniform(rng)) * h.y;
+            r.z = grid_lo.z + (ijk.z + uniform(rng)) * h.z;
+            if (r.x < lo.x || r.x >= hi.x || r.y < lo.y || r.y >= hi.y || r.z < lo.z
+                || r.z >= hi.z)
+                continue;
+
+            Scalar3 grad;
+            const Scalar sdf = m_geom->evaluate(r, grad);
+            accept = (sdf > Scalar(0) && sdf <= m_thickness);
+            }
+        if (!accept)
+            {
+            r = make_scalar3(voxel.x, voxel.y, voxel.z);
+            }
+
+        const unsigned int pidx = first_idx + i;
+        h_pos.data[pidx] = make_solvent_scalar4(r.x, r.y, r.z, __int_as_solvent_scalar(m_type));
+
+        hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
+        Scalar3 vel;
+        gen(vel.x, vel.y, rng);
+        vel.z = gen(rng);
+        h_vel.data[pidx] = make_solvent_scalar4(vel.x,
+                                                vel.y,
+                                                vel.z,
+                                                __int_as_solvent_scalar(mpcd::detail::NO_CELL));
+        h_tag.data[pidx] = tag;
+        }
+    }
+
+/*!
+ * \param m Python module to export to
+ */
+void mpcd::detail::export_SDFGeometryFiller(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::SDFGeometryFiller,
+                     mpcd::VirtualParticleFiller,
+                     std::shared_ptr<mpcd::SDFGeometryFiller>>(m, "SDFGeometryFiller")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            Scalar,
+                            unsigned int,
+                            std::shared_ptr<Variant>,
+                            std::shared_ptr<const mpcd::detail::SDFGeometry>>())
+        .def("setGeometry", &mpcd::SDFGeometryFiller::setGeometry);
+    }
+
+    } // end namespace hoomd
@@ -0,0 +1,89 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/SDFGeometryFiller.h
+ * \brief Definition of virtual particle filler for mpcd::detail::SDFGeometry.
+ */
+
+#ifndef MPCD_SDF_GEOMETRY_FILLER_H_
+#define MPCD_SDF_GEOMETRY_FILLER_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "SDFGeometry.h"
+#include "VirtualParticleFiller.h"
+
+#include "hoomd/GPUVector.h"
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Adds virtual particles to the MPCD particle data for SDFGeometry
+/*!
+ * Particles are added to the layer outside the walls where the signed distance is between zero
+ * and the length of a cell diagonal, which covers every cell that overlaps the inside of the
+ * geometry, subject to the grid shift.
+ *
+ * The walls have no simple shape, so the voxels of the signed distance grid that overlap both the
+ * layer and the local domain are found once (and again if the box, cell size, or geometry
+ * changes), and the volume of the layer is estimated by sampling points within these voxels.
+ * Particles are then drawn uniformly in the layer by rejection sampling: a voxel is chosen
+ * uniformly, a point is drawn uniformly inside it, and the point is accepted if it is in the layer
+ * and in the local domain. If no point is accepted after MAX_ATTEMPTS, a point in the layer that
+ * was found when the voxel was sampled is used instead.
+ */
+class PYBIND11_EXPORT SDFGeometryFiller : public mpcd::VirtualParticleFiller
+    {
+    public:
+    SDFGeometryFiller(std::shared_ptr<SystemDefinition> sysdef,
+                      Scalar density,
+                      unsigned int type,
+                      std::shared_ptr<Variant> T,
+                      std::shared_ptr<const mpcd::detail::SDFGeometry> geom);
+
+    virtual ~SDFGeometryFiller();
+
+    void setGeometry(std::shared_ptr<const mpcd::detail::SDFGeometry> geom)
+        {
+        m_geom = geom;
+        invalidateReservoir();
+        notifyRecompute();
+        }
+
+    //! Maximum number of rejection sampling attempts per particle
+    const static unsigned int MAX_ATTEMPTS = 256;
+
+    protected:
+    std::shared_ptr<const mpcd::detail::SDFGeometry> m_geom;
+    Scalar m_thickness;          //!< Thickness of virtual particle layer
+    GPUVector<Scalar4> m_voxels; //!< Voxels to fill (point in layer, and voxel index as int)
+
+    //! Compute the total number of particles to fill
+    virtual void computeNumFill();
+
+    //! Draw particles within the fill volume
+    virtual void drawParticles(uint64_t timestep);
+
+    private:
+    bool m_needs_recompute;
+    Scalar3 m_recompute_cache;
+    void notifyRecompute()
+        {
+        m_needs_recompute = true;
+        }
+    };
+
+namespace detail
+    {
+//! Export SDFGeometryFiller to python
+void export_SDFGeometryFiller(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_SDF_GEOMETRY_FILLER_H_
@@ -0,0 +1,198 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/SDFGeometryFillerGPU.cu
+ * \brief Defines GPU functions and kernels used by mpcd::SDFGeometryFillerGPU
+ */
+
+#include "ParticleDataUtilities.h"
+#include "SDFGeometryFillerGPU.cuh"
+#include "hoomd/Index1D.h"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace gpu
+    {
+namespace kernel
+    {
+/*!
+ * \param d_pos Particle positions
+ * \param d_vel Particle velocities
+ * \param d_tag Particle tags
+ * \param geom SDF geometry to fill
+ * \param d_voxels Voxels to fill (point in layer, and voxel index as int)
+ * \param num_voxels Number of voxels to fill
+ * \param thickness Thickness of the fill layer
+ * \param max_attempts Maximum number of rejection sampling attempts per particle
+ * \param box Local simulation box
+ * \param type Type of fill particles
+ * \param N_fill Number of particles to fill
+ * \param first_tag First tag of filled particles
+ * \param first_idx First (local) particle index of filled particles
+ * \param vel_factor Scale factor for uniform normal velocities consistent with particle mass /
+ * temperature
+ * \param timestep Current timestep
+ * \param seed User seed to PRNG for drawing velocities
+ *
+ * \b Implementation:
+ *
+ * Using one thread per particle, the thread index is translated into a particle tag and local
+ * particle index. A position is rejection sampled in the layer by drawing points uniformly in
+ * randomly chosen voxels, falling back to the known point in the last voxel if no point is
+ * accepted within \a max_attempts.
+ */
+__global__ void sdf_draw_particles(SolventScalar4* d_pos,
+                                   SolventScalar4* d_vel,
+                                   unsigned int* d_tag,
+                                   const mpcd::detail::SDFGeometry geom,
+                                   const Scalar4* d_voxels,
+                                   const unsigned int num_voxels,
+                                   const Scalar thickness,
+                                   const unsigned int max_attempts,
+                                   const BoxDim box,
+                                   const unsigned int type,
+                                   const unsigned int N_fill,
+                                   const unsigned int first_tag,
+                                   const unsigned int first_idx,
+                                   const Scalar vel_factor,
+                                   const uint64_t timestep,
+                                   const uint16_t seed)
+    {
+    // one thread per particle
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N_fill)
+        return;
+
+    const Scalar3 lo = box.getLo();
+    const Scalar3 hi = box.getHi();
+    const uint3 dim = geom.getDimensions();
+    const Index3D indexer(dim.x, dim.y, dim.z);
+    const Scalar3 grid_lo = geom.getLo();
+    const Scalar3 h = geom.getSpacing();
+
+    // particle tag and index
+    const unsigned int tag = first_tag + idx;
+    const unsigned int pidx = first_idx + idx;
+    d_tag[pidx] = tag;
+
+    // initialize random number generator for positions and velocity
+    hoomd::RandomGenerator rng(
+        hoomd::Seed(hoomd::RNGIdentifier::SDFGeometryFiller, timestep, seed),
+        hoomd::Counter(tag));
+
+    // rejection sample a point in the layer
+    hoomd::UniformDistribution<Scalar> uniform(0, 1);
+    Scalar3 r;
+    Scalar4 voxel;
+    bool accept = false;
+    for (unsigned int attempt = 0; attempt < max_attempts && !accept; ++attempt)
+        {
+        voxel = d_voxels[hoomd::UniformIntDistribution(num_voxels - 1)(rng)];
+        const uint3 ijk = indexer.getTriple(__scalar_as_int(voxel.w));
+        r.x = grid_lo.x + (ijk.x + uniform(rng)) * h.x;
+        r.y = grid_lo.y + (ijk.y + uniform(rng)) * h.y;
+        r.z = grid_lo.z + (ijk.z + uniform(rng)) * h.z;
+        if (r.x < lo.x || r.x >= hi.x || r.y < lo.y || r.y >= hi.y || r.z < lo.z || r.z >= hi.z)
+            continue;
+
+        Scalar3 grad;
+        const Scalar sdf = geom.evaluate(r, grad);
+        accept = (sdf > Scalar(0) && sdf <= thickness);
+        }
+    if (!accept)
+        {
+        r = make_scalar3(voxel.x, voxel.y, voxel.z);
+        }
+    d_pos[pidx] = make_solvent_scalar4(r.x, r.y, r.z, __int_as_solvent_scalar(type));
+
+    hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
+    Scalar3 vel;
+    gen(vel.x, vel.y, rng);
+    vel.z = gen(rng);
+    d_vel[pidx]
+        = make_solvent_scalar4(vel.x, vel.y, vel.z, __int_as_solvent_scalar(mpcd::detail::NO_CELL));
+    }
+    } // end namespace kernel
+
+/*!
+ * \param d_pos Particle positions
+ * \param d_vel Particle velocities
+ * \param d_tag Particle tags
+ * \param geom SDF geometry to fill
+ * \param d_voxels Voxels to fill (point in layer, and voxel index as int)
+ * \param num_voxels Number of voxels to fill
+ * \param thickness Thickness of the fill layer
+ * \param max_attempts Maximum number of rejection sampling attempts per particle
+ * \param box Local simulation box
+ * \param mass Mass of fill particles
+ * \param type Type of fill particles
+ * \param N_fill Number of particles to fill
+ * \param first_tag First tag of filled particles
+ * \param first_idx First (local) particle index of filled particles
+ * \param kT Temperature for fill particles
+ * \param timestep Current timestep
+ * \param seed User seed to PRNG for drawing velocities
+ * \param block_size Number of threads per block
+ *
+ * \sa kernel::sdf_draw_particles
+ */
+cudaError_t sdf_draw_particles(SolventScalar4* d_pos,
+                               SolventScalar4* d_vel,
+                               unsigned int* d_tag,
+                               const mpcd::detail::SDFGeometry& geom,
+                               const Scalar4* d_voxels,
+                               const unsigned int num_voxels,
+                               const Scalar thickness,
+                               const unsigned int max_attempts,
+                               const BoxDim& box,
+                               const Scalar mass,
+                               const unsigned int type,
+                               const unsigned int N_fill,
+                               const unsigned int first_tag,
+                               const unsigned int first_idx,
+                               const Scalar kT,
+                               const uint64_t timestep,
+                               const uint16_t seed,
+                               const unsigned int block_size)
+    {
+    if (N_fill == 0 || num_voxels == 0)
+        return cudaSuccess;
+
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)kernel::sdf_draw_particles);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    // precompute factor for rescaling the velocities since it is the same for all particles
+    const Scalar vel_factor = fast::sqrt(kT / mass);
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid(N_fill / run_block_size + 1);
+    kernel::sdf_draw_particles<<<grid, run_block_size>>>(d_pos,
+                                                         d_vel,
+                                                         d_tag,
+                                                         geom,
+                                                         d_voxels,
+                                                         num_voxels,
+                                                         thickness,
+                                                         max_attempts,
+                                                         box,
+                                                         type,
+                                                         N_fill,
+                                                         first_tag,
+                                                         first_idx,
+                                                         vel_factor,
+                                                         timestep,
+                                                         seed);
+
+    return cudaSuccess;
+    }
+
+    } // end namespace gpu
+    } // end namespace mpcd
+    } // end namespace hoomd
@@ -0,0 +1,48 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef MPCD_SDF_GEOMETRY_FILLER_GPU_CUH_
+#define MPCD_SDF_GEOMETRY_FILLER_GPU_CUH_
+
+/*!
+ * \file mpcd/SDFGeometryFillerGPU.cuh
+ * \brief Declaration of CUDA kernels for mpcd::SDFGeometryFillerGPU
+ */
+
+#include <cuda_runtime.h>
+
+#include "ParticleDataUtilities.h"
+#include "SDFGeometry.h"
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace gpu
+    {
+//! Draw virtual particles in the SDFGeometry
+cudaError_t sdf_draw_particles(SolventScalar4* d_pos,
+                               SolventScalar4* d_vel,
+                               unsigned int* d_tag,
+                               const mpcd::detail::SDFGeometry& geom,
+                               const Scalar4* d_voxels,
+                               const unsigned int num_voxels,
+                               const Scalar thickness,
+                               const unsigned int max_attempts,
+                               const BoxDim& box,
+                               const Scalar mass,
+                               const unsigned int type,
+                               const unsigned int N_fill,
+                               const unsigned int first_tag,
+                               const unsigned int first_idx,
+                               const Scalar kT,
+                               const uint64_t timestep,
+                               const uint16_t seed,
+                               const unsigned int block_size);
+
+    } // end namespace gpu
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_SDF_GEOMETRY_FILLER_GPU_CUH_
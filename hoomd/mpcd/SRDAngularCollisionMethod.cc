@@ -0,0 +1,320 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/SRDAngularCollisionMethod.cc
+ * \brief Definition of mpcd::SRDAngularCollisionMethod
+ */
+
+#include "SRDAngularCollisionMethod.h"
+
+namespace hoomd
+    {
+mpcd::SRDAngularCollisionMethod::SRDAngularCollisionMethod(std::shared_ptr<SystemDefinition> sysdef,
+                                                           unsigned int cur_timestep,
+                                                           unsigned int period,
+                                                           int phase,
+                                                           uint16_t seed)
+    : mpcd::SRDCollisionMethod(sysdef, cur_timestep, period, phase, seed),
+      m_cell_moments(m_exec_conf), m_cell_com(m_exec_conf), m_cell_omega(m_exec_conf)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing MPCD SRD+a collision method" << std::endl;
+    }
+
+mpcd::SRDAngularCollisionMethod::~SRDAngularCollisionMethod()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying MPCD SRD+a collision method" << std::endl;
+    }
+
+void mpcd::SRDAngularCollisionMethod::setCellList(std::shared_ptr<mpcd::CellList> cl)
+    {
+    if (cl != m_cl)
+        {
+        mpcd::SRDCollisionMethod::setCellList(cl);
+#ifdef ENABLE_MPI
+        if (m_cl && m_exec_conf->getNRanks() > 1)
+            {
+            m_moments_comm = std::make_shared<mpcd::CellCommunicator>(m_sysdef, m_cl);
+            }
+        else
+            {
+            m_moments_comm = std::shared_ptr<mpcd::CellCommunicator>();
+            }
+#endif // ENABLE_MPI
+        }
+    }
+
+/*!
+ * \param timestep Current timestep
+ *
+ * The moments are summed from the velocities before the rotation.
+ */
+void mpcd::SRDAngularCollisionMethod::rotate(uint64_t timestep)
+    {
+    const unsigned int ncells = m_cl->getNCells();
+    m_cell_moments.resize(ncells);
+    m_cell_com.resize(ncells);
+    m_cell_omega.resize(ncells);
+
+    computeCellMoments();
+#ifdef ENABLE_MPI
+    if (m_moments_comm)
+        {
+        m_moments_comm->communicate(m_cell_moments, mpcd::detail::CellAngularMomentsPackOp());
+        }
+#endif // ENABLE_MPI
+    computeAngularVelocities();
+
+    mpcd::SRDCollisionMethod::rotate(timestep);
+    applyAngularVelocities();
+    }
+
+void mpcd::SRDAngularCollisionMethod::computeCellMoments()
+    {
+    ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::read);
+    const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
+    unsigned int N_tot = N_mpcd;
+    const Scalar mpcd_mass = m_mpcd_pdata->getMass();
+
+    // embedded particle data
+    std::unique_ptr<ArrayHandle<unsigned int>> h_embed_group;
+    std::unique_ptr<ArrayHandle<Scalar4>> h_pos_embed;
+    std::unique_ptr<ArrayHandle<Scalar4>> h_vel_embed;
+    std::unique_ptr<ArrayHandle<unsigned int>> h_embed_cell_ids;
+    if (m_embed_group)
+        {
+        h_embed_group.reset(new ArrayHandle<unsigned int>(m_embed_group->getIndexArray(),
+                                                          access_location::host,
+                                                          access_mode::read));
+        h_pos_embed.reset(new ArrayHandle<Scalar4>(m_pdata->getPositions(),
+                                                   access_location::host,
+                                                   access_mode::read));
+        h_vel_embed.reset(new ArrayHandle<Scalar4>(m_pdata->getVelocities(),
+                                                   access_location::host,
+                                                   access_mode::read));
+        h_embed_cell_ids.reset(new ArrayHandle<unsigned int>(m_cl->getEmbeddedGroupCellIds(),
+                                                             access_location::host,
+                                                             access_mode::read));
+        N_tot += m_embed_group->getNumMembers();
+        }
+
+    ArrayHandle<mpcd::detail::CellAngularMoments> h_moments(m_cell_moments,
+                                                            access_location::host,
+                                                            access_mode::overwrite);
+    memset(h_moments.data,
+           0,
+           sizeof(mpcd::detail::CellAngularMoments) * m_cell_moments.getNumElements());
+
+    const Index3D& ci = m_cl->getCellIndexer();
+    const int3 origin = m_cl->getOriginIndex();
+    const BoxDim& global_box = m_pdata->getGlobalBox();
+    const Scalar3 lo = global_box.getLo() + m_cl->getGridShift();
+    const Scalar cell_size = m_cl->getCellSize();
+    const bool two_d = (m_sysdef->getNDimensions() == 2);
+
+    for (unsigned int cur_p = 0; cur_p < N_tot; ++cur_p)
+        {
+        Scalar3 pos, vel;
+        unsigned int cell;
+        double mass;
+        if (cur_p < N_mpcd)
+            {
+            const SolventScalar4 postype = h_pos.data[cur_p];
+            pos = make_scalar3(postype.x, postype.y, postype.z);
+            const SolventScalar4 vel_cell = h_vel.data[cur_p];
+            vel = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
+            cell = __solvent_scalar_as_int(vel_cell.w);
+            mass = mpcd_mass;
+            }
+        else
+            {
+            const unsigned int idx = h_embed_group->data[cur_p - N_mpcd];
+            const Scalar4 postype = h_pos_embed->data[idx];
+            pos = make_scalar3(postype.x, postype.y, postype.z);
+            const Scalar4 vel_mass = h_vel_embed->data[idx];
+            vel = make_scalar3(vel_mass.x, vel_mass.y, vel_mass.z);
+            cell = h_embed_cell_ids->data[cur_p - N_mpcd];
+            mass = vel_mass.w;
+            }
+
+        const Scalar3 r = mpcd::detail::getCellRelativePosition(pos,
+                                                                ci.getTriple(cell),
+                                                                origin,
+                                                                lo,
+                                                                cell_size,
+                                                                global_box,
+                                                                two_d);
+        const double3 mr = make_double3(mass * r.x, mass * r.y, mass * r.z);
+
+        mpcd::detail::CellAngularMoments& moments = h_moments.data[cell];
+        moments.mr.x += mr.x;
+        moments.mr.y += mr.y;
+        moments.mr.z += mr.z;
+        moments.mrr.x += mr.x * r.x;
+        moments.mrr.y += mr.y * r.y;
+        moments.mrr.z += mr.z * r.z;
+        moments.mrr_off.x += mr.x * r.y;
+        moments.mrr_off.y += mr.x * r.z;
+        moments.mrr_off.z += mr.y * r.z;
+        moments.mrvx.x += mr.x * vel.x;
+        moments.mrvx.y += mr.y * vel.x;
+        moments.mrvx.z += mr.z * vel.x;
+        moments.mrvy.x += mr.x * vel.y;
+        moments.mrvy.y += mr.y * vel.y;
+        moments.mrvy.z += mr.z * vel.y;
+        moments.mrvz.x += mr.x * vel.z;
+        moments.mrvz.y += mr.y * vel.z;
+        moments.mrvz.z += mr.z * vel.z;
+        }
+    }
+
+void mpcd::SRDAngularCollisionMethod::computeAngularVelocities()
+    {
+    ArrayHandle<mpcd::detail::CellAngularMoments> h_moments(m_cell_moments,
+                                                            access_location::host,
+                                                            access_mode::read);
+    ArrayHandle<double4> h_cell_vel(m_thermo->getCellVelocities(),
+                                    access_location::host,
+                                    access_mode::read);
+    ArrayHandle<double3> h_rotvec(m_rotvec, access_location::host, access_mode::read);
+    ArrayHandle<double3> h_com(m_cell_com, access_location::host, access_mode::overwrite);
+    ArrayHandle<double3> h_omega(m_cell_omega, access_location::host, access_mode::overwrite);
+
+    std::unique_ptr<ArrayHandle<double>> h_factors;
+    if (m_T)
+        {
+        h_factors.reset(
+            new ArrayHandle<double>(m_factors, access_location::host, access_mode::read));
+        }
+
+    const double cos_a = slow::cos(m_angle);
+    const double sin_a = slow::sin(m_angle);
+    const bool two_d = (m_sysdef->getNDimensions() == 2);
+    for (unsigned int cell = 0; cell < m_cl->getNCells(); ++cell)
+        {
+        const double factor = (m_T) ? h_factors->data[cell] : 1.0;
+        h_omega.data[cell] = mpcd::detail::computeAngularCorrection(h_com.data[cell],
+                                                                    h_moments.data[cell],
+                                                                    h_cell_vel.data[cell],
+                                                                    h_rotvec.data[cell],
+                                                                    cos_a,
+                                                                    sin_a,
+                                                                    factor,
+                                                                    two_d);
+        }
+    }
+
+void mpcd::SRDAngularCollisionMethod::applyAngularVelocities()
+    {
+    ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::readwrite);
+    const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
+    unsigned int N_tot = N_mpcd;
+
+    // embedded particle data
+    std::unique_ptr<ArrayHandle<unsigned int>> h_embed_group;
+    std::unique_ptr<ArrayHandle<Scalar4>> h_pos_embed;
+    std::unique_ptr<ArrayHandle<Scalar4>> h_vel_embed;
+    std::unique_ptr<ArrayHandle<unsigned int>> h_embed_cell_ids;
+    if (m_embed_group)
+        {
+        h_embed_group.reset(new ArrayHandle<unsigned int>(m_embed_group->getIndexArray(),
+                                                          access_location::host,
+                                                          access_mode::read));
+        h_pos_embed.reset(new ArrayHandle<Scalar4>(m_pdata->getPositions(),
+                                                   access_location::host,
+                                                   access_mode::read));
+        h_vel_embed.reset(new ArrayHandle<Scalar4>(m_pdata->getVelocities(),
+                                                   access_location::host,
+                                                   access_mode::readwrite));
+        h_embed_cell_ids.reset(new ArrayHandle<unsigned int>(m_cl->getEmbeddedGroupCellIds(),
+                                                             access_location::host,
+                                                             access_mode::read));
+        N_tot += m_embed_group->getNumMembers();
+        }
+
+    ArrayHandle<double3> h_com(m_cell_com, access_location::host, access_mode::read);
+    ArrayHandle<double3> h_omega(m_cell_omega, access_location::host, access_mode::read);
+
+    const Index3D& ci = m_cl->getCellIndexer();
+    const int3 origin = m_cl->getOriginIndex();
+    const BoxDim& global_box = m_pdata->getGlobalBox();
+    const Scalar3 lo = global_box.getLo() + m_cl->getGridShift();
+    const Scalar cell_size = m_cl->getCellSize();
+    const bool two_d = (m_sysdef->getNDimensions() == 2);
+
+    for (unsigned int cur_p = 0; cur_p < N_tot; ++cur_p)
+        {
+        Scalar3 pos;
+        unsigned int cell;
+        if (cur_p < N_mpcd)
+            {
+            const SolventScalar4 postype = h_pos.data[cur_p];
+            pos = make_scalar3(postype.x, postype.y, postype.z);
+            cell = __solvent_scalar_as_int(h_vel.data[cur_p].w);
+            }
+        else
+            {
+            const unsigned int idx = h_embed_group->data[cur_p - N_mpcd];
+            const Scalar4 postype = h_pos_embed->data[idx];
+            pos = make_scalar3(postype.x, postype.y, postype.z);
+            cell = h_embed_cell_ids->data[cur_p - N_mpcd];
+            }
+
+        const Scalar3 r = mpcd::detail::getCellRelativePosition(pos,
+                                                                ci.getTriple(cell),
+                                                                origin,
+                                                                lo,
+                                                                cell_size,
+                                                                global_box,
+                                                                two_d);
+        const double3 com = h_com.data[cell];
+        const double3 dr = make_double3(r.x - com.x, r.y - com.y, r.z - com.z);
+        const double3 omega = h_omega.data[cell];
+
+        const double3 dv = make_double3(omega.y * dr.z - omega.z * dr.y,
+                                        omega.z * dr.x - omega.x * dr.z,
+                                        omega.x * dr.y - omega.y * dr.x);
+        if (cur_p < N_mpcd)
+            {
+            SolventScalar4& vel = h_vel.data[cur_p];
+            vel.x += dv.x;
+            vel.y += dv.y;
+            vel.z += dv.z;
+            }
+        else
+            {
+            Scalar4& vel = h_vel_embed->data[h_embed_group->data[cur_p - N_mpcd]];
+            vel.x += dv.x;
+            vel.y += dv.y;
+            vel.z += dv.z;
+            }
+        }
+    }
+
+/*!
+ * \param m Python module to export to
+ */
+void mpcd::detail::export_SRDAngularCollisionMethod(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::SRDAngularCollisionMethod,
+                     mpcd::SRDCollisionMethod,
+                     std::shared_ptr<mpcd::SRDAngularCollisionMethod>>(m,
+                                                                        "SRDAngularCollisionMethod")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            unsigned int,
+                            unsigned int,
+                            int,
+                            unsigned int>());
+    }
+
+    } // end namespace hoomd
@@ -0,0 +1,84 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/SRDAngularCollisionMethod.h
+ * \brief Declaration of mpcd::SRDAngularCollisionMethod
+ */
+
+#ifndef MPCD_SRD_ANGULAR_COLLISION_METHOD_H_
+#define MPCD_SRD_ANGULAR_COLLISION_METHOD_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "SRDAngularMomentum.h"
+#include "SRDCollisionMethod.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Implements the angular-momentum-conserving SRD collision rule (SRD+a)
+/*!
+ * The velocities are rotated as in mpcd::SRDCollisionMethod, and then the rigid rotation
+ * \f$ \boldsymbol{\omega} \times (\mathbf{r}_i - \mathbf{r}_{\rm cm}) \f$ that restores the
+ * angular momentum of the cell about its center of mass is added to each particle (see
+ * mpcd::detail::computeAngularCorrection()). The correction is computed after the thermostat
+ * rescales the velocities, so angular momentum is also conserved with the thermostat.
+ *
+ * The cell moments of the particle positions are summed in an extra pass over the particles and
+ * reduced across ranks, and the correction is added in a second extra pass.
+ */
+class PYBIND11_EXPORT SRDAngularCollisionMethod : public mpcd::SRDCollisionMethod
+    {
+    public:
+    //! Constructor
+    SRDAngularCollisionMethod(std::shared_ptr<SystemDefinition> sysdef,
+                              unsigned int cur_timestep,
+                              unsigned int period,
+                              int phase,
+                              uint16_t seed);
+
+    //! Destructor
+    virtual ~SRDAngularCollisionMethod();
+
+    void setCellList(std::shared_ptr<mpcd::CellList> cl);
+
+    //! Get the cell angular velocities from the last call
+    const GPUVector<double3>& getAngularVelocities() const
+        {
+        return m_cell_omega;
+        }
+
+    protected:
+    GPUVector<mpcd::detail::CellAngularMoments> m_cell_moments; //!< Moments of the cells
+    GPUVector<double3> m_cell_com;                              //!< Cell centers of mass
+    GPUVector<double3> m_cell_omega;                            //!< Cell angular velocities
+#ifdef ENABLE_MPI
+    std::shared_ptr<mpcd::CellCommunicator> m_moments_comm; //!< Communicator for cell moments
+#endif // ENABLE_MPI
+
+    //! Apply rotation matrix and angular momentum correction to velocities
+    virtual void rotate(uint64_t timestep);
+
+    //! Sum the moments of the particles in each cell
+    virtual void computeCellMoments();
+
+    //! Compute the angular velocity correction of each cell
+    virtual void computeAngularVelocities();
+
+    //! Add the angular velocity correction to the particles
+    virtual void applyAngularVelocities();
+    };
+
+namespace detail
+    {
+//! Export SRDAngularCollisionMethod to python
+void export_SRDAngularCollisionMethod(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_SRD_ANGULAR_COLLISION_METHOD_H_
@@ -0,0 +1,252 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/SRDAngularCollisionMethodGPU.cc
+ * \brief Definition of mpcd::SRDAngularCollisionMethodGPU
+ */
+
+#include "SRDAngularCollisionMethodGPU.h"
+#include "SRDCollisionMethodGPU.cuh"
+
+namespace hoomd
+    {
+mpcd::SRDAngularCollisionMethodGPU::SRDAngularCollisionMethodGPU(
+    std::shared_ptr<SystemDefinition> sysdef,
+    unsigned int cur_timestep,
+    unsigned int period,
+    int phase,
+    uint16_t seed)
+    : mpcd::SRDCollisionMethodGPU(sysdef, cur_timestep, period, phase, seed),
+      m_cell_moments(m_exec_conf), m_cell_com(m_exec_conf), m_cell_omega(m_exec_conf)
+    {
+    m_tuner_moments.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                           m_exec_conf,
+                                           "mpcd_srda_moments"));
+    m_tuner_omega.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                         m_exec_conf,
+                                         "mpcd_srda_omega"));
+    m_tuner_apply.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                         m_exec_conf,
+                                         "mpcd_srda_apply"));
+    m_autotuners.insert(m_autotuners.end(), {m_tuner_moments, m_tuner_omega, m_tuner_apply});
+    }
+
+void mpcd::SRDAngularCollisionMethodGPU::setCellList(std::shared_ptr<mpcd::CellList> cl)
+    {
+    if (cl != m_cl)
+        {
+        mpcd::SRDCollisionMethodGPU::setCellList(cl);
+#ifdef ENABLE_MPI
+        if (m_cl && m_exec_conf->getNRanks() > 1)
+            {
+            m_moments_comm = std::make_shared<mpcd::CellCommunicator>(m_sysdef, m_cl);
+            }
+        else
+            {
+            m_moments_comm = std::shared_ptr<mpcd::CellCommunicator>();
+            }
+#endif // ENABLE_MPI
+        }
+    }
+
+/*!
+ * \param timestep Current timestep
+ *
+ * The moments are summed from the velocities before the rotation.
+ */
+void mpcd::SRDAngularCollisionMethodGPU::rotate(uint64_t timestep)
+    {
+    const unsigned int ncells = m_cl->getNCells();
+    m_cell_moments.resize(ncells);
+    m_cell_com.resize(ncells);
+    m_cell_omega.resize(ncells);
+
+    const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
+    const unsigned int N_tot = N_mpcd + ((m_embed_group) ? m_embed_group->getNumMembers() : 0);
+    const Index3D& ci = m_cl->getCellIndexer();
+    const int3 origin = m_cl->getOriginIndex();
+    const BoxDim& global_box = m_pdata->getGlobalBox();
+    const Scalar3 lo = global_box.getLo() + m_cl->getGridShift();
+    const Scalar cell_size = m_cl->getCellSize();
+    const bool two_d = (m_sysdef->getNDimensions() == 2);
+
+    // sum the moments of the cells
+        {
+        ArrayHandle<SolventScalar4> d_pos(m_mpcd_pdata->getPositions(),
+                                          access_location::device,
+                                          access_mode::read);
+        ArrayHandle<SolventScalar4> d_vel(m_mpcd_pdata->getVelocities(),
+                                          access_location::device,
+                                          access_mode::read);
+        ArrayHandle<mpcd::detail::CellAngularMoments> d_moments(m_cell_moments,
+                                                                access_location::device,
+                                                                access_mode::overwrite);
+        hipMemset(d_moments.data,
+                  0,
+                  sizeof(mpcd::detail::CellAngularMoments) * m_cell_moments.getNumElements());
+
+        std::unique_ptr<ArrayHandle<unsigned int>> d_embed_group;
+        std::unique_ptr<ArrayHandle<Scalar4>> d_pos_embed;
+        std::unique_ptr<ArrayHandle<Scalar4>> d_vel_embed;
+        std::unique_ptr<ArrayHandle<unsigned int>> d_embed_cell_ids;
+        if (m_embed_group)
+            {
+            d_embed_group.reset(new ArrayHandle<unsigned int>(m_embed_group->getIndexArray(),
+                                                              access_location::device,
+                                                              access_mode::read));
+            d_pos_embed.reset(new ArrayHandle<Scalar4>(m_pdata->getPositions(),
+                                                       access_location::device,
+                                                       access_mode::read));
+            d_vel_embed.reset(new ArrayHandle<Scalar4>(m_pdata->getVelocities(),
+                                                       access_location::device,
+                                                       access_mode::read));
+            d_embed_cell_ids.reset(new ArrayHandle<unsigned int>(m_cl->getEmbeddedGroupCellIds(),
+                                                                 access_location::device,
+                                                                 access_mode::read));
+            }
+
+        m_tuner_moments->begin();
+        mpcd::gpu::srd_angular_moments(d_moments.data,
+                                       d_pos.data,
+                                       d_vel.data,
+                                       m_mpcd_pdata->getMass(),
+                                       (m_embed_group) ? d_embed_group->data : NULL,
+                                       (m_embed_group) ? d_pos_embed->data : NULL,
+                                       (m_embed_group) ? d_vel_embed->data : NULL,
+                                       (m_embed_group) ? d_embed_cell_ids->data : NULL,
+                                       ci,
+                                       origin,
+                                       lo,
+                                       cell_size,
+                                       global_box,
+                                       two_d,
+                                       N_mpcd,
+                                       N_tot,
+                                       m_tuner_moments->getParam()[0]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_moments->end();
+        }
+
+#ifdef ENABLE_MPI
+    if (m_moments_comm)
+        {
+        m_moments_comm->communicate(m_cell_moments, mpcd::detail::CellAngularMomentsPackOp());
+        }
+#endif // ENABLE_MPI
+
+    // compute the angular velocity of each cell
+        {
+        ArrayHandle<double3> d_com(m_cell_com, access_location::device, access_mode::overwrite);
+        ArrayHandle<double3> d_omega(m_cell_omega,
+                                     access_location::device,
+                                     access_mode::overwrite);
+        ArrayHandle<mpcd::detail::CellAngularMoments> d_moments(m_cell_moments,
+                                                                access_location::device,
+                                                                access_mode::read);
+        ArrayHandle<double4> d_cell_vel(m_thermo->getCellVelocities(),
+                                        access_location::device,
+                                        access_mode::read);
+        std::unique_ptr<ArrayHandle<double>> d_factors;
+        if (m_T)
+            {
+            d_factors.reset(
+                new ArrayHandle<double>(m_factors, access_location::device, access_mode::read));
+            }
+
+        m_tuner_omega->begin();
+        mpcd::gpu::srd_angular_velocities(d_com.data,
+                                          d_omega.data,
+                                          d_moments.data,
+                                          d_cell_vel.data,
+                                          (m_T) ? d_factors->data : NULL,
+                                          ci,
+                                          origin,
+                                          m_cl->getGlobalDim(),
+                                          m_cl->getGlobalCellIndexer(),
+                                          timestep,
+                                          m_sysdef->getSeed(),
+                                          m_angle,
+                                          two_d,
+                                          m_tuner_omega->getParam()[0]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_omega->end();
+        }
+
+    mpcd::SRDCollisionMethodGPU::rotate(timestep);
+
+    // add the correction to the rotated velocities
+        {
+        ArrayHandle<SolventScalar4> d_pos(m_mpcd_pdata->getPositions(),
+                                          access_location::device,
+                                          access_mode::read);
+        ArrayHandle<SolventScalar4> d_vel(m_mpcd_pdata->getVelocities(),
+                                          access_location::device,
+                                          access_mode::readwrite);
+        ArrayHandle<double3> d_com(m_cell_com, access_location::device, access_mode::read);
+        ArrayHandle<double3> d_omega(m_cell_omega, access_location::device, access_mode::read);
+
+        std::unique_ptr<ArrayHandle<unsigned int>> d_embed_group;
+        std::unique_ptr<ArrayHandle<Scalar4>> d_pos_embed;
+        std::unique_ptr<ArrayHandle<Scalar4>> d_vel_embed;
+        std::unique_ptr<ArrayHandle<unsigned int>> d_embed_cell_ids;
+        if (m_embed_group)
+            {
+            d_embed_group.reset(new ArrayHandle<unsigned int>(m_embed_group->getIndexArray(),
+                                                              access_location::device,
+                                                              access_mode::read));
+            d_pos_embed.reset(new ArrayHandle<Scalar4>(m_pdata->getPositions(),
+                                                       access_location::device,
+                                                       access_mode::read));
+            d_vel_embed.reset(new ArrayHandle<Scalar4>(m_pdata->getVelocities(),
+                                                       access_location::device,
+                                                       access_mode::readwrite));
+            d_embed_cell_ids.reset(new ArrayHandle<unsigned int>(m_cl->getEmbeddedGroupCellIds(),
+                                                                 access_location::device,
+                                                                 access_mode::read));
+            }
+
+        m_tuner_apply->begin();
+        mpcd::gpu::srd_angular_apply(d_vel.data,
+                                     (m_embed_group) ? d_vel_embed->data : NULL,
+                                     d_pos.data,
+                                     (m_embed_group) ? d_embed_group->data : NULL,
+                                     (m_embed_group) ? d_pos_embed->data : NULL,
+                                     (m_embed_group) ? d_embed_cell_ids->data : NULL,
+                                     d_com.data,
+                                     d_omega.data,
+                                     ci,
+                                     origin,
+                                     lo,
+                                     cell_size,
+                                     global_box,
+                                     two_d,
+                                     N_mpcd,
+                                     N_tot,
+                                     m_tuner_apply->getParam()[0]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_apply->end();
+        }
+    }
+
+/*!
+ * \param m Python module to export to
+ */
+void mpcd::detail::export_SRDAngularCollisionMethodGPU(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::SRDAngularCollisionMethodGPU,
+                     mpcd::SRDCollisionMethodGPU,
+                     std::shared_ptr<mpcd::SRDAngularCollisionMethodGPU>>(
+        m,
+        "SRDAngularCollisionMethodGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            unsigned int,
+                            unsigned int,
+                            int,
+                            unsigned int>());
+    }
+
+    } // end namespace hoomd
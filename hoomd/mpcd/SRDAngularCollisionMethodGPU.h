@@ -0,0 +1,72 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/SRDAngularCollisionMethodGPU.h
+ * \brief Declaration of mpcd::SRDAngularCollisionMethodGPU
+ */
+
+#ifndef MPCD_SRD_ANGULAR_COLLISION_METHOD_GPU_H_
+#define MPCD_SRD_ANGULAR_COLLISION_METHOD_GPU_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "SRDAngularMomentum.h"
+#include "SRDCollisionMethodGPU.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Implements the angular-momentum-conserving SRD collision rule (SRD+a) on the GPU
+/*!
+ * The rotation is done by the kernels of mpcd::SRDCollisionMethodGPU, so this class derives from
+ * it rather than from mpcd::SRDAngularCollisionMethod. The correction is the same (see
+ * mpcd::detail::computeAngularCorrection()).
+ */
+class PYBIND11_EXPORT SRDAngularCollisionMethodGPU : public mpcd::SRDCollisionMethodGPU
+    {
+    public:
+    //! Constructor
+    SRDAngularCollisionMethodGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                 unsigned int cur_timestep,
+                                 unsigned int period,
+                                 int phase,
+                                 uint16_t seed);
+
+    void setCellList(std::shared_ptr<mpcd::CellList> cl);
+
+    //! Get the cell angular velocities from the last call
+    const GPUVector<double3>& getAngularVelocities() const
+        {
+        return m_cell_omega;
+        }
+
+    protected:
+    GPUVector<mpcd::detail::CellAngularMoments> m_cell_moments; //!< Moments of the cells
+    GPUVector<double3> m_cell_com;                              //!< Cell centers of mass
+    GPUVector<double3> m_cell_omega;                            //!< Cell angular velocities
+#ifdef ENABLE_MPI
+    std::shared_ptr<mpcd::CellCommunicator> m_moments_comm; //!< Communicator for cell moments
+#endif // ENABLE_MPI
+
+    //! Apply rotation matrix and angular momentum correction to velocities
+    virtual void rotate(uint64_t timestep);
+
+    private:
+    std::shared_ptr<Autotuner<1>> m_tuner_moments; //!< Tuner for summing cell moments
+    std::shared_ptr<Autotuner<1>> m_tuner_omega;   //!< Tuner for computing angular velocities
+    std::shared_ptr<Autotuner<1>> m_tuner_apply;   //!< Tuner for applying angular velocities
+    };
+
+namespace detail
+    {
+//! Export SRDAngularCollisionMethodGPU to python
+void export_SRDAngularCollisionMethodGPU(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_SRD_ANGULAR_COLLISION_METHOD_GPU_H_
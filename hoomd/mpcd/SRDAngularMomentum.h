@@ -0,0 +1,238 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/SRDAngularMomentum.h
+ * \brief Defines the cell sums and correction used by mpcd::SRDAngularCollisionMethod
+ */
+
+#ifndef MPCD_SRD_ANGULAR_MOMENTUM_H_
+#define MPCD_SRD_ANGULAR_MOMENTUM_H_
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__ inline
+#else
+#define HOSTDEVICE inline __attribute__((always_inline))
+#endif
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace detail
+    {
+//! Mass-weighted moments of the particle positions in a cell
+/*!
+ * The positions \f$ \mathbf{r} \f$ are relative to the center of the cell (see
+ * getCellRelativePosition()), so that the sums from different ranks can be added together.
+ */
+struct CellAngularMoments
+    {
+    double3 mr;      //!< Sum of \f$ m \mathbf{r} \f$
+    double3 mrr;     //!< Sum of \f$ m \mathbf{r} \mathbf{r} \f$ (xx, yy, zz)
+    double3 mrr_off; //!< Sum of \f$ m \mathbf{r} \mathbf{r} \f$ (xy, xz, yz)
+    double3 mrvx;    //!< Sum of \f$ m \mathbf{r} v_x \f$
+    double3 mrvy;    //!< Sum of \f$ m \mathbf{r} v_y \f$
+    double3 mrvz;    //!< Sum of \f$ m \mathbf{r} v_z \f$
+    };
+
+//! Operator to sum cell angular moments from different ranks
+struct CellAngularMomentsPackOp
+    {
+    typedef CellAngularMoments element;
+
+    HOSTDEVICE element pack(const CellAngularMoments& val) const
+        {
+        return val;
+        }
+
+    HOSTDEVICE CellAngularMoments unpack(const element& e, const CellAngularMoments& val) const
+        {
+        CellAngularMoments sum;
+        sum.mr = add(e.mr, val.mr);
+        sum.mrr = add(e.mrr, val.mrr);
+        sum.mrr_off = add(e.mrr_off, val.mrr_off);
+        sum.mrvx = add(e.mrvx, val.mrvx);
+        sum.mrvy = add(e.mrvy, val.mrvy);
+        sum.mrvz = add(e.mrvz, val.mrvz);
+        return sum;
+        }
+
+    private:
+    HOSTDEVICE static double3 add(const double3& a, const double3& b)
+        {
+        return make_double3(a.x + b.x, a.y + b.y, a.z + b.z);
+        }
+    };
+
+//! Get the position of a particle relative to the center of its cell
+/*!
+ * \param pos Particle position
+ * \param cell Local cell of the particle
+ * \param origin Global index of the local origin cell
+ * \param lo Lower corner of the global box, shifted by the grid shift
+ * \param cell_size Size of a cell
+ * \param global_box Global simulation box
+ * \param two_d If true, the simulation is 2D and the z component is zeroed
+ *
+ * \returns Position relative to the cell center, wrapped by the minimum image convention
+ */
+HOSTDEVICE Scalar3 getCellRelativePosition(const Scalar3& pos,
+                                           const uint3& cell,
+                                           const int3& origin,
+                                           const Scalar3& lo,
+                                           const Scalar cell_size,
+                                           const BoxDim& global_box,
+                                           const bool two_d)
+    {
+    const Scalar3 center
+        = make_scalar3(lo.x + (Scalar(origin.x + (int)cell.x) + Scalar(0.5)) * cell_size,
+                       lo.y + (Scalar(origin.y + (int)cell.y) + Scalar(0.5)) * cell_size,
+                       lo.z + (Scalar(origin.z + (int)cell.z) + Scalar(0.5)) * cell_size);
+    Scalar3 r = global_box.minImage(pos - center);
+    if (two_d)
+        r.z = Scalar(0.0);
+    return r;
+    }
+
+//! Compute the angular velocity that restores the angular momentum of a cell
+/*!
+ * \param com Center of mass of the cell, relative to the cell center (output)
+ * \param moments Moments of the particles in the cell
+ * \param cell_vel Center-of-mass velocity (xyz) and mass (w) of the cell
+ * \param rotvec Rotation vector of the cell
+ * \param cos_a Cosine of the rotation angle
+ * \param sin_a Sine of the rotation angle
+ * \param factor Scale factor of the rotated relative velocities
+ * \param two_d If true, the simulation is 2D and only rotations about z are corrected
+ *
+ * \returns Angular velocity \f$ \boldsymbol{\omega} \f$ that is added to the particles as
+ *          \f$ \boldsymbol{\omega} \times (\mathbf{r}_i - \mathbf{r}_{\rm cm}) \f$
+ *
+ * The change in angular momentum of the cell about its center of mass is computed from the
+ * moments, without visiting the particles again, and \f$ \boldsymbol{\omega} = \mathbf{I}^{-1}
+ * \Delta\mathbf{L} \f$ using the moment of inertia tensor \f$ \mathbf{I} \f$ of the cell. If the
+ * particles in the cell are collinear, \f$ \mathbf{I} \f$ is singular but \f$ \Delta\mathbf{L} \f$
+ * is perpendicular to the line, so the (pseudo) inverse is taken in that plane. Cells with fewer
+ * than two (separated) particles are not corrected.
+ */
+HOSTDEVICE double3 computeAngularCorrection(double3& com,
+                                            const CellAngularMoments& moments,
+                                            const double4& cell_vel,
+                                            const double3& rotvec,
+                                            const double cos_a,
+                                            const double sin_a,
+                                            const double factor,
+                                            const bool two_d)
+    {
+    const double mass = cell_vel.w;
+    if (!(mass > 0.0))
+        {
+        com = make_double3(0.0, 0.0, 0.0);
+        return make_double3(0.0, 0.0, 0.0);
+        }
+    const double3 mr = moments.mr;
+    com = make_double3(mr.x / mass, mr.y / mass, mr.z / mass);
+
+    // B_ab = sum m (r-r_cm)_a (v-u)_b, which simplifies because the relative quantities sum to 0
+    const double u[3] = {cell_vel.x, cell_vel.y, cell_vel.z};
+    const double r[3] = {mr.x, mr.y, mr.z};
+    const double3 mrv[3] = {moments.mrvx, moments.mrvy, moments.mrvz};
+    double B[3][3];
+    for (unsigned int b = 0; b < 3; ++b)
+        {
+        B[0][b] = mrv[b].x - r[0] * u[b];
+        B[1][b] = mrv[b].y - r[1] * u[b];
+        B[2][b] = mrv[b].z - r[2] * u[b];
+        }
+
+    // rotation matrix (same convention as the SRD rotation)
+    const double n[3] = {rotvec.x, rotvec.y, rotvec.z};
+    const double one_minus_cos_a = 1.0 - cos_a;
+    double R[3][3];
+    for (unsigned int a = 0; a < 3; ++a)
+        {
+        for (unsigned int b = 0; b < 3; ++b)
+            {
+            R[a][b] = n[a] * n[b] * one_minus_cos_a;
+            }
+        R[a][a] += cos_a;
+        }
+    R[0][1] -= sin_a * n[2];
+    R[0][2] += sin_a * n[1];
+    R[1][0] += sin_a * n[2];
+    R[1][2] -= sin_a * n[0];
+    R[2][0] -= sin_a * n[1];
+    R[2][1] += sin_a * n[0];
+
+    // C = factor * B R^T gives the relative moments of the rotated velocities
+    double C[3][3];
+    for (unsigned int a = 0; a < 3; ++a)
+        {
+        for (unsigned int b = 0; b < 3; ++b)
+            {
+            C[a][b] = factor * (B[a][0] * R[b][0] + B[a][1] * R[b][1] + B[a][2] * R[b][2]);
+            }
+        }
+
+    // change in angular momentum: L_k = eps_kab B_ab
+    const double3 dL = make_double3((B[1][2] - B[2][1]) - (C[1][2] - C[2][1]),
+                                    (B[2][0] - B[0][2]) - (C[2][0] - C[0][2]),
+                                    (B[0][1] - B[1][0]) - (C[0][1] - C[1][0]));
+
+    // A = sum m (r-r_cm)(r-r_cm), and the moment of inertia is I = tr(A) - A
+    const double Axx = moments.mrr.x - mr.x * com.x;
+    const double Ayy = moments.mrr.y - mr.y * com.y;
+    const double Azz = moments.mrr.z - mr.z * com.z;
+    const double Axy = moments.mrr_off.x - mr.x * com.y;
+    const double Axz = moments.mrr_off.y - mr.x * com.z;
+    const double Ayz = moments.mrr_off.z - mr.y * com.z;
+    const double trA = Axx + Ayy + Azz;
+    if (!(trA > 0.0))
+        {
+        return make_double3(0.0, 0.0, 0.0);
+        }
+
+    if (two_d)
+        {
+        const double Izz = Axx + Ayy;
+        return make_double3(0.0, 0.0, dL.z / Izz);
+        }
+
+    const double Ixx = trA - Axx;
+    const double Iyy = trA - Ayy;
+    const double Izz = trA - Azz;
+    const double Ixy = -Axy;
+    const double Ixz = -Axz;
+    const double Iyz = -Ayz;
+
+    // invert the symmetric tensor by cofactors
+    const double cxx = Iyy * Izz - Iyz * Iyz;
+    const double cxy = Ixz * Iyz - Ixy * Izz;
+    const double cxz = Ixy * Iyz - Ixz * Iyy;
+    const double det = Ixx * cxx + Ixy * cxy + Ixz * cxz;
+    const double trI = 2.0 * trA;
+    if (!(det > 1e-10 * trI * trI * trI))
+        {
+        // collinear particles: I = s (1 - d d) with s = tr(I)/2, and dL is perpendicular to d
+        const double s = 0.5 * trI;
+        return make_double3(dL.x / s, dL.y / s, dL.z / s);
+        }
+    const double cyy = Ixx * Izz - Ixz * Ixz;
+    const double cyz = Ixy * Ixz - Ixx * Iyz;
+    const double czz = Ixx * Iyy - Ixy * Ixy;
+    return make_double3((cxx * dL.x + cxy * dL.y + cxz * dL.z) / det,
+                        (cxy * dL.x + cyy * dL.y + cyz * dL.z) / det,
+                        (cxz * dL.x + cyz * dL.y + czz * dL.z) / det);
+    }
+
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+
+#undef HOSTDEVICE
+
+#endif // MPCD_SRD_ANGULAR_MOMENTUM_H_
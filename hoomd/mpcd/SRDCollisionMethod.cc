@@ -9,6 +9,7 @@
 #include "SRDCollisionMethod.h"
 #include "hoomd/RNGIdentifiers.h"
 #include "hoomd/RandomNumbers.h"
+#include "hoomd/ThreadLoops.h"
 
 namespace hoomd
     {
@@ -18,7 +19,7 @@ mpcd::SRDCollisionMethod::SRDCollisionMethod(std::shared_ptr<SystemDefinition> s
                                              int phase,
                                              uint16_t seed)
     : mpcd::CollisionMethod(sysdef, cur_timestep, period, phase), m_rotvec(m_exec_conf),
-      m_angle(0.0), m_factors(m_exec_conf)
+      m_rotvec_deferred(false), m_rotvec_timestep(0), m_angle(0.0), m_factors(m_exec_conf)
     {
     m_exec_conf->msg->notice(5) << "Constructing MPCD SRD collision method" << std::endl;
     }
@@ -71,10 +72,13 @@ void mpcd::SRDCollisionMethod::drawRotationVectors(uint64_t timestep)
 
     uint16_t seed = m_sysdef->getSeed();
 
-    for (unsigned int k = 0; k < ci.getD(); ++k)
-        {
-        for (unsigned int j = 0; j < ci.getH(); ++j)
+    // the random numbers are keyed to the global cell, so rows of cells can be drawn on the threads
+    auto draw_rows = [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int row = begin; row < end; ++row)
             {
+            const unsigned int j = row % ci.getH();
+            const unsigned int k = row / ci.getH();
             for (unsigned int i = 0; i < ci.getW(); ++i)
                 {
                 const int3 global_cell = m_cl->getGlobalCell(make_int3(i, j, k));
@@ -117,15 +121,16 @@ void mpcd::SRDCollisionMethod::drawRotationVectors(uint64_t timestep)
                     }
                 }
             }
-        }
+    };
+    hoomd::detail::parallelForEach(*m_exec_conf, ci.getH() * ci.getD(), draw_rows);
     }
 
 void mpcd::SRDCollisionMethod::rotate(uint64_t timestep)
     {
     // acquire MPCD particle data
-    ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(),
-                               access_location::host,
-                               access_mode::readwrite);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::readwrite);
     const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
     unsigned int N_tot = N_mpcd;
     // acquire additionally embedded particle data
@@ -166,78 +171,85 @@ void mpcd::SRDCollisionMethod::rotate(uint64_t timestep)
             new ArrayHandle<double>(m_factors, access_location::host, access_mode::read));
         }
 
-    for (unsigned int cur_p = 0; cur_p < N_tot; ++cur_p)
-        {
-        double3 vel;
-        unsigned int cell;
-        // these properties are needed for the embedded particles only
-        unsigned int idx(0);
-        double mass(0);
-        if (cur_p < N_mpcd)
-            {
-            const Scalar4 vel_cell = h_vel.data[cur_p];
-            vel = make_double3(vel_cell.x, vel_cell.y, vel_cell.z);
-            cell = __scalar_as_int(vel_cell.w);
-            }
-        else
+    // every particle is rotated independently, so ranges of particles can be done on the threads
+    auto rotate_range = [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int cur_p = begin; cur_p < end; ++cur_p)
             {
-            idx = h_embed_group->data[cur_p - N_mpcd];
+            double3 vel;
+            unsigned int cell;
+            // these properties are needed for the embedded particles only
+            unsigned int idx(0);
+            double mass(0);
+            if (cur_p < N_mpcd)
+                {
+                const SolventScalar4 vel_cell = h_vel.data[cur_p];
+                vel = make_double3(vel_cell.x, vel_cell.y, vel_cell.z);
+                cell = __solvent_scalar_as_int(vel_cell.w);
+                }
+            else
+                {
+                idx = h_embed_group->data[cur_p - N_mpcd];
 
-            const Scalar4 vel_mass = h_vel_embed->data[idx];
-            vel = make_double3(vel_mass.x, vel_mass.y, vel_mass.z);
-            mass = vel_mass.w;
-            cell = h_embed_cell_ids->data[cur_p - N_mpcd];
-            }
+                const Scalar4 vel_mass = h_vel_embed->data[idx];
+                vel = make_double3(vel_mass.x, vel_mass.y, vel_mass.z);
+                mass = vel_mass.w;
+                cell = h_embed_cell_ids->data[cur_p - N_mpcd];
+                }
 
-        // subtract average velocity
-        const double4 avg_vel = h_cell_vel.data[cell];
-        vel.x -= avg_vel.x;
-        vel.y -= avg_vel.y;
-        vel.z -= avg_vel.z;
-
-        // get rotation vector
-        double3 rot_vec = h_rotvec.data[cell];
-
-        // perform the rotation in double precision
-        // TODO: should we optimize out the matrix construction for the CPU?
-        //       Or, consider using vectorization and/or Eigen?
-        double3 new_vel;
-        new_vel.x = (cos_a + rot_vec.x * rot_vec.x * one_minus_cos_a) * vel.x;
-        new_vel.x += (rot_vec.x * rot_vec.y * one_minus_cos_a - sin_a * rot_vec.z) * vel.y;
-        new_vel.x += (rot_vec.x * rot_vec.z * one_minus_cos_a + sin_a * rot_vec.y) * vel.z;
-
-        new_vel.y = (cos_a + rot_vec.y * rot_vec.y * one_minus_cos_a) * vel.y;
-        new_vel.y += (rot_vec.x * rot_vec.y * one_minus_cos_a + sin_a * rot_vec.z) * vel.x;
-        new_vel.y += (rot_vec.y * rot_vec.z * one_minus_cos_a - sin_a * rot_vec.x) * vel.z;
-
-        new_vel.z = (cos_a + rot_vec.z * rot_vec.z * one_minus_cos_a) * vel.z;
-        new_vel.z += (rot_vec.x * rot_vec.z * one_minus_cos_a - sin_a * rot_vec.y) * vel.x;
-        new_vel.z += (rot_vec.y * rot_vec.z * one_minus_cos_a + sin_a * rot_vec.x) * vel.y;
-
-        // rescale the temperature if thermostatting is enabled
-        if (use_thermostat)
-            {
-            double factor = h_factors->data[cell];
-            new_vel.x *= factor;
-            new_vel.y *= factor;
-            new_vel.z *= factor;
-            }
+            // subtract average velocity
+            const double4 avg_vel = h_cell_vel.data[cell];
+            vel.x -= avg_vel.x;
+            vel.y -= avg_vel.y;
+            vel.z -= avg_vel.z;
+
+            // get rotation vector
+            double3 rot_vec = h_rotvec.data[cell];
+
+            // perform the rotation in double precision
+            // TODO: should we optimize out the matrix construction for the CPU?
+            //       Or, consider using vectorization and/or Eigen?
+            double3 new_vel;
+            new_vel.x = (cos_a + rot_vec.x * rot_vec.x * one_minus_cos_a) * vel.x;
+            new_vel.x += (rot_vec.x * rot_vec.y * one_minus_cos_a - sin_a * rot_vec.z) * vel.y;
+            new_vel.x += (rot_vec.x * rot_vec.z * one_minus_cos_a + sin_a * rot_vec.y) * vel.z;
+
+            new_vel.y = (cos_a + rot_vec.y * rot_vec.y * one_minus_cos_a) * vel.y;
+            new_vel.y += (rot_vec.x * rot_vec.y * one_minus_cos_a + sin_a * rot_vec.z) * vel.x;
+            new_vel.y += (rot_vec.y * rot_vec.z * one_minus_cos_a - sin_a * rot_vec.x) * vel.z;
+
+            new_vel.z = (cos_a + rot_vec.z * rot_vec.z * one_minus_cos_a) * vel.z;
+            new_vel.z += (rot_vec.x * rot_vec.z * one_minus_cos_a - sin_a * rot_vec.y) * vel.x;
+            new_vel.z += (rot_vec.y * rot_vec.z * one_minus_cos_a + sin_a * rot_vec.x) * vel.y;
+
+            // rescale the temperature if thermostatting is enabled
+            if (use_thermostat)
+                {
+                double factor = h_factors->data[cell];
+                new_vel.x *= factor;
+                new_vel.y *= factor;
+                new_vel.z *= factor;
+                }
 
-        new_vel.x += avg_vel.x;
-        new_vel.y += avg_vel.y;
-        new_vel.z += avg_vel.z;
+            new_vel.x += avg_vel.x;
+            new_vel.y += avg_vel.y;
+            new_vel.z += avg_vel.z;
 
-        // set the new velocity
-        if (cur_p < N_mpcd)
-            {
-            h_vel.data[cur_p]
-                = make_scalar4(new_vel.x, new_vel.y, new_vel.z, __int_as_scalar(cell));
-            }
-        else
-            {
-            h_vel_embed->data[idx] = make_scalar4(new_vel.x, new_vel.y, new_vel.z, mass);
+            // set the new velocity
+            if (cur_p < N_mpcd)
+                {
+                h_vel.data[cur_p] = make_solvent_scalar4(new_vel.x,
+                                                         new_vel.y,
+                                                         new_vel.z,
+                                                         __int_as_solvent_scalar(cell));
+                }
+            else
+                {
+                h_vel_embed->data[idx] = make_scalar4(new_vel.x, new_vel.y, new_vel.z, mass);
+                }
             }
-        }
+    };
+    hoomd::detail::parallelForEach(*m_exec_conf, N_tot, rotate_range);
     }
 
 void mpcd::SRDCollisionMethod::setCellList(std::shared_ptr<mpcd::CellList> cl)
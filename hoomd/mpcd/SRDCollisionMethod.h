@@ -53,8 +53,18 @@ class PYBIND11_EXPORT SRDCollisionMethod : public mpcd::CollisionMethod
         }
 
     //! Get the cell rotation vectors from the last call
-    const GPUVector<double3>& getRotationVectors() const
+    /*!
+     * Subclasses that generate the rotation vectors where they are used can defer drawing them,
+     * in which case they are drawn for the last collision only when they are requested.
+     */
+    const GPUVector<double3>& getRotationVectors()
         {
+        if (m_rotvec_deferred)
+            {
+            m_rotvec.resize(m_cl->getNCells());
+            drawRotationVectors(m_rotvec_timestep);
+            m_rotvec_deferred = false;
+            }
         return m_rotvec;
         }
 
@@ -89,6 +99,8 @@ class PYBIND11_EXPORT SRDCollisionMethod : public mpcd::CollisionMethod
     protected:
     std::shared_ptr<mpcd::CellThermoCompute> m_thermo; //!< Cell thermo
     GPUVector<double3> m_rotvec;                       //!< MPCD rotation vectors
+    bool m_rotvec_deferred;                            //!< If true, m_rotvec has not been drawn
+    uint64_t m_rotvec_timestep;                        //!< Timestep of deferred rotation vectors
     double m_angle;                                    //!< MPCD rotation angle (radians)
 
     std::shared_ptr<Variant> m_T; //!< Temperature for thermostat
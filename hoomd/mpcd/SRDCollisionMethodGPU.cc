@@ -28,71 +28,96 @@ mpcd::SRDCollisionMethodGPU::SRDCollisionMethodGPU(std::shared_ptr<SystemDefinit
     m_autotuners.insert(m_autotuners.end(), {m_tuner_rotvec, m_tuner_rotate});
     }
 
-void mpcd::SRDCollisionMethodGPU::drawRotationVectors(uint64_t timestep)
+/*!
+ * \param timestep Current timestep
+ *
+ * The rotation vectors are generated inside the rotation kernel, so they are not drawn here. They
+ * are only drawn (see drawRotationVectors()) if they are requested with getRotationVectors().
+ */
+void mpcd::SRDCollisionMethodGPU::rule(uint64_t timestep)
     {
-    ArrayHandle<double3> d_rotvec(m_rotvec, access_location::device, access_mode::overwrite);
-
-    uint16_t seed = m_sysdef->getSeed();
+    m_thermo->compute(timestep);
 
     if (m_T)
         {
-        ArrayHandle<double> d_factors(m_factors, access_location::device, access_mode::overwrite);
-        ArrayHandle<double3> d_cell_energy(m_thermo->getCellEnergies(),
-                                           access_location::device,
-                                           access_mode::read);
-
-        m_tuner_rotvec->begin();
-        mpcd::gpu::srd_draw_vectors(d_rotvec.data,
-                                    d_factors.data,
-                                    d_cell_energy.data,
-                                    m_cl->getCellIndexer(),
-                                    m_cl->getOriginIndex(),
-                                    m_cl->getGlobalDim(),
-                                    m_cl->getGlobalCellIndexer(),
-                                    timestep,
-                                    seed,
-                                    (*m_T)(timestep),
-                                    m_sysdef->getNDimensions(),
-                                    m_tuner_rotvec->getParam()[0]);
-        if (m_exec_conf->isCUDAErrorCheckingEnabled())
-            CHECK_CUDA_ERROR();
-        m_tuner_rotvec->end();
-        }
-    else
-        {
-        m_tuner_rotvec->begin();
-        mpcd::gpu::srd_draw_vectors(d_rotvec.data,
-                                    NULL,
-                                    NULL,
-                                    m_cl->getCellIndexer(),
-                                    m_cl->getOriginIndex(),
-                                    m_cl->getGlobalDim(),
-                                    m_cl->getGlobalCellIndexer(),
-                                    timestep,
-                                    seed,
-                                    1.0,
-                                    m_sysdef->getNDimensions(),
-                                    m_tuner_rotvec->getParam()[0]);
-        if (m_exec_conf->isCUDAErrorCheckingEnabled())
-            CHECK_CUDA_ERROR();
-        m_tuner_rotvec->end();
+        m_factors.resize(m_cl->getNCells());
+        drawScaleFactors(timestep);
         }
+
+    rotate(timestep);
+
+    m_rotvec_deferred = true;
+    m_rotvec_timestep = timestep;
+    }
+
+/*!
+ * \param timestep Timestep of the collision
+ *
+ * Only the rotation vectors are drawn. The scale factors are drawn by drawScaleFactors().
+ */
+void mpcd::SRDCollisionMethodGPU::drawRotationVectors(uint64_t timestep)
+    {
+    ArrayHandle<double3> d_rotvec(m_rotvec, access_location::device, access_mode::overwrite);
+
+    m_tuner_rotvec->begin();
+    mpcd::gpu::srd_draw_vectors(d_rotvec.data,
+                                NULL,
+                                NULL,
+                                m_cl->getCellIndexer(),
+                                m_cl->getOriginIndex(),
+                                m_cl->getGlobalDim(),
+                                m_cl->getGlobalCellIndexer(),
+                                timestep,
+                                m_sysdef->getSeed(),
+                                1.0,
+                                m_sysdef->getNDimensions(),
+                                m_tuner_rotvec->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_rotvec->end();
+    }
+
+/*!
+ * \param timestep Current timestep
+ */
+void mpcd::SRDCollisionMethodGPU::drawScaleFactors(uint64_t timestep)
+    {
+    ArrayHandle<double> d_factors(m_factors, access_location::device, access_mode::overwrite);
+    ArrayHandle<double3> d_cell_energy(m_thermo->getCellEnergies(),
+                                       access_location::device,
+                                       access_mode::read);
+
+    m_tuner_rotvec->begin();
+    mpcd::gpu::srd_draw_vectors(NULL,
+                                d_factors.data,
+                                d_cell_energy.data,
+                                m_cl->getCellIndexer(),
+                                m_cl->getOriginIndex(),
+                                m_cl->getGlobalDim(),
+                                m_cl->getGlobalCellIndexer(),
+                                timestep,
+                                m_sysdef->getSeed(),
+                                (*m_T)(timestep),
+                                m_sysdef->getNDimensions(),
+                                m_tuner_rotvec->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_rotvec->end();
     }
 
 void mpcd::SRDCollisionMethodGPU::rotate(uint64_t timestep)
     {
     // acquire MPCD particle data
-    ArrayHandle<Scalar4> d_vel(m_mpcd_pdata->getVelocities(),
-                               access_location::device,
-                               access_mode::readwrite);
+    ArrayHandle<SolventScalar4> d_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::device,
+                                      access_mode::readwrite);
     const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
     unsigned int N_tot = N_mpcd;
 
-    // acquire cell velocities and rotation vectors
+    // acquire cell velocities
     ArrayHandle<double4> d_cell_vel(m_thermo->getCellVelocities(),
                                     access_location::device,
                                     access_mode::read);
-    ArrayHandle<double3> d_rotvec(m_rotvec, access_location::device, access_mode::read);
 
     // load scale factors if required
     std::unique_ptr<ArrayHandle<double>> d_factors;
@@ -122,7 +147,12 @@ void mpcd::SRDCollisionMethodGPU::rotate(uint64_t timestep)
                               d_embed_group.data,
                               d_embed_cell_ids.data,
                               d_cell_vel.data,
-                              d_rotvec.data,
+                              m_cl->getCellIndexer(),
+                              m_cl->getOriginIndex(),
+                              m_cl->getGlobalDim(),
+                              m_cl->getGlobalCellIndexer(),
+                              timestep,
+                              m_sysdef->getSeed(),
                               m_angle,
                               (m_T) ? d_factors->data : NULL,
                               N_mpcd,
@@ -140,7 +170,12 @@ void mpcd::SRDCollisionMethodGPU::rotate(uint64_t timestep)
                               NULL,
                               NULL,
                               d_cell_vel.data,
-                              d_rotvec.data,
+                              m_cl->getCellIndexer(),
+                              m_cl->getOriginIndex(),
+                              m_cl->getGlobalDim(),
+                              m_cl->getGlobalCellIndexer(),
+                              timestep,
+                              m_sysdef->getSeed(),
                               m_angle,
                               (m_T) ? d_factors->data : NULL,
                               N_mpcd,
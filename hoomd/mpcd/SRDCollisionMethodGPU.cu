@@ -6,6 +6,7 @@
  * \brief Defines GPU functions and kernels used by mpcd::SRDCollisionMethodGPU
  */
 
+#include "CellCommunicator.cuh"
 #include "SRDCollisionMethodGPU.cuh"
 #include "hoomd/RNGIdentifiers.h"
 #include "hoomd/RandomNumbers.h"
@@ -18,30 +19,28 @@ namespace gpu
     {
 namespace kernel
     {
-template<bool use_thermostat>
-__global__ void srd_draw_vectors(double3* d_rotvec,
-                                 double* d_factors,
-                                 const double3* d_cell_energy,
-                                 const Index3D ci,
-                                 const int3 origin,
-                                 const uint3 global_dim,
-                                 const Index3D global_ci,
-                                 const uint64_t timestep,
-                                 const uint16_t seed,
-                                 const Scalar T_set,
-                                 const unsigned int n_dimensions,
-                                 const unsigned int Ncell)
+//! Get the global index of a local cell
+/*!
+ * \param cell Local cell index
+ * \param ci Cell indexer
+ * \param origin Global index of the local origin cell
+ * \param global_dim Global cell dimensions
+ * \param global_ci Global cell indexer
+ *
+ * \returns Global index of \a cell, after wrapping through the global boundaries
+ */
+__device__ unsigned int srd_global_cell_index(const unsigned int cell,
+                                              const Index3D& ci,
+                                              const int3& origin,
+                                              const uint3& global_dim,
+                                              const Index3D& global_ci)
     {
-    // one thread per cell
-    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
-    if (idx >= Ncell)
-        return;
-
     // get local cell triple from 1d index
-    const uint3 cell = ci.getTriple(idx);
+    const uint3 local_cell = ci.getTriple(cell);
     // shift local cell by local origin, and wrap through global boundaries
-    int3 global_cell
-        = make_int3(origin.x + (int)cell.x, origin.y + (int)cell.y, origin.z + (int)cell.z);
+    int3 global_cell = make_int3(origin.x + (int)local_cell.x,
+                                 origin.y + (int)local_cell.y,
+                                 origin.z + (int)local_cell.z);
     if (global_cell.x >= (int)global_dim.x)
         global_cell.x -= global_dim.x;
     else if (global_cell.x < 0)
@@ -58,7 +57,35 @@ __global__ void srd_draw_vectors(double3* d_rotvec,
         global_cell.z += global_dim.z;
 
     // convert global triple to 1d global index
-    const unsigned int global_idx = global_ci(global_cell.x, global_cell.y, global_cell.z);
+    return global_ci(global_cell.x, global_cell.y, global_cell.z);
+    }
+
+//! Draw the rotation vectors and/or scale factors of the cells
+/*!
+ * The rotation vector is always drawn first so that the random number stream for the scale
+ * factor is the same as in srd_rotate and on the CPU. Either \a d_rotvec or \a d_factors
+ * may be NULL if that quantity is not needed.
+ */
+template<bool use_thermostat>
+__global__ void srd_draw_vectors(double3* d_rotvec,
+                                 double* d_factors,
+                                 const double3* d_cell_energy,
+                                 const Index3D ci,
+                                 const int3 origin,
+                                 const uint3 global_dim,
+                                 const Index3D global_ci,
+                                 const uint64_t timestep,
+                                 const uint16_t seed,
+                                 const Scalar T_set,
+                                 const unsigned int n_dimensions,
+                                 const unsigned int Ncell)
+    {
+    // one thread per cell
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= Ncell)
+        return;
+
+    const unsigned int global_idx = srd_global_cell_index(idx, ci, origin, global_dim, global_ci);
 
     // Initialize the PRNG using the cell index, timestep, and seed for the hash
     hoomd::RandomGenerator rng(
@@ -69,7 +96,8 @@ __global__ void srd_draw_vectors(double3* d_rotvec,
     double3 rotvec;
     hoomd::SpherePointGenerator<double> sphgen;
     sphgen(rng, rotvec);
-    d_rotvec[idx] = rotvec;
+    if (d_rotvec != NULL)
+        d_rotvec[idx] = rotvec;
 
     if (use_thermostat)
         {
@@ -94,12 +122,25 @@ __global__ void srd_draw_vectors(double3* d_rotvec,
         d_factors[idx] = factor;
         }
     }
-__global__ void srd_rotate(Scalar4* d_vel,
+
+//! Rotate the particle velocities
+/*!
+ * The rotation vector of each cell is regenerated from the same random number stream as
+ * srd_draw_vectors by every particle in the cell, rather than being drawn in a separate kernel
+ * and read back from global memory. A few extra random numbers per particle are cheaper than the
+ * additional launch and the round trip through memory.
+ */
+__global__ void srd_rotate(SolventScalar4* d_vel,
                            Scalar4* d_vel_embed,
                            const unsigned int* d_embed_group,
                            const unsigned int* d_embed_cell_ids,
                            const double4* d_cell_vel,
-                           const double3* d_rotvec,
+                           const Index3D ci,
+                           const int3 origin,
+                           const uint3 global_dim,
+                           const Index3D global_ci,
+                           const uint64_t timestep,
+                           const uint16_t seed,
                            const double cos_a,
                            const double one_minus_cos_a,
                            const double sin_a,
@@ -120,9 +161,9 @@ __global__ void srd_rotate(Scalar4* d_vel,
     double mass(0);
     if (tid < N_mpcd)
         {
-        const Scalar4 vel_cell = d_vel[tid];
+        const SolventScalar4 vel_cell = d_vel[tid];
         vel = make_double3(vel_cell.x, vel_cell.y, vel_cell.z);
-        cell = __scalar_as_int(vel_cell.w);
+        cell = __solvent_scalar_as_int(vel_cell.w);
         }
     else
         {
@@ -140,8 +181,14 @@ __global__ void srd_rotate(Scalar4* d_vel,
     vel.y -= avg_vel.y;
     vel.z -= avg_vel.z;
 
-    // get rotation vector
-    double3 rot_vec = d_rotvec[cell];
+    // draw the rotation vector of the cell
+    const unsigned int global_idx = srd_global_cell_index(cell, ci, origin, global_dim, global_ci);
+    hoomd::RandomGenerator rng(
+        hoomd::Seed(hoomd::RNGIdentifier::SRDCollisionMethod, timestep, seed),
+        hoomd::Counter(global_idx));
+    double3 rot_vec;
+    hoomd::SpherePointGenerator<double> sphgen;
+    sphgen(rng, rot_vec);
 
     // perform the rotation in double precision
     double3 new_vel;
@@ -173,13 +220,211 @@ __global__ void srd_rotate(Scalar4* d_vel,
     // set the new velocity
     if (tid < N_mpcd)
         {
-        d_vel[tid] = make_scalar4(new_vel.x, new_vel.y, new_vel.z, __int_as_scalar(cell));
+        d_vel[tid]
+            = make_solvent_scalar4(new_vel.x, new_vel.y, new_vel.z, __int_as_solvent_scalar(cell));
         }
     else
         {
         d_vel_embed[idx] = make_scalar4(new_vel.x, new_vel.y, new_vel.z, mass);
         }
     }
+
+//! Sum the moments of the particles in each cell
+/*!
+ * The sums are accumulated with atomic operations, so \a d_moments must be zeroed first.
+ */
+__global__ void srd_angular_moments(mpcd::detail::CellAngularMoments* d_moments,
+                                    const SolventScalar4* d_pos,
+                                    const SolventScalar4* d_vel,
+                                    const Scalar mpcd_mass,
+                                    const unsigned int* d_embed_group,
+                                    const Scalar4* d_pos_embed,
+                                    const Scalar4* d_vel_embed,
+                                    const unsigned int* d_embed_cell_ids,
+                                    const Index3D ci,
+                                    const int3 origin,
+                                    const Scalar3 lo,
+                                    const Scalar cell_size,
+                                    const BoxDim global_box,
+                                    const bool two_d,
+                                    const unsigned int N_mpcd,
+                                    const unsigned int N_tot)
+    {
+    // one thread per particle
+    unsigned int tid = blockIdx.x * blockDim.x + threadIdx.x;
+    if (tid >= N_tot)
+        return;
+
+    Scalar3 pos, vel;
+    unsigned int cell;
+    double mass;
+    if (tid < N_mpcd)
+        {
+        const SolventScalar4 postype = d_pos[tid];
+        pos = make_scalar3(postype.x, postype.y, postype.z);
+        const SolventScalar4 vel_cell = d_vel[tid];
+        vel = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
+        cell = __solvent_scalar_as_int(vel_cell.w);
+        mass = mpcd_mass;
+        }
+    else
+        {
+        const unsigned int idx = d_embed_group[tid - N_mpcd];
+        const Scalar4 postype = d_pos_embed[idx];
+        pos = make_scalar3(postype.x, postype.y, postype.z);
+        const Scalar4 vel_mass = d_vel_embed[idx];
+        vel = make_scalar3(vel_mass.x, vel_mass.y, vel_mass.z);
+        cell = d_embed_cell_ids[tid - N_mpcd];
+        mass = vel_mass.w;
+        }
+
+    const Scalar3 r = mpcd::detail::getCellRelativePosition(pos,
+                                                            ci.getTriple(cell),
+                                                            origin,
+                                                            lo,
+                                                            cell_size,
+                                                            global_box,
+                                                            two_d);
+    const double3 mr = make_double3(mass * r.x, mass * r.y, mass * r.z);
+
+    mpcd::detail::CellAngularMoments* moments = d_moments + cell;
+    atomicAdd(&moments->mr.x, mr.x);
+    atomicAdd(&moments->mr.y, mr.y);
+    atomicAdd(&moments->mr.z, mr.z);
+    atomicAdd(&moments->mrr.x, mr.x * r.x);
+    atomicAdd(&moments->mrr.y, mr.y * r.y);
+    atomicAdd(&moments->mrr.z, mr.z * r.z);
+    atomicAdd(&moments->mrr_off.x, mr.x * r.y);
+    atomicAdd(&moments->mrr_off.y, mr.x * r.z);
+    atomicAdd(&moments->mrr_off.z, mr.y * r.z);
+    atomicAdd(&moments->mrvx.x, mr.x * vel.x);
+    atomicAdd(&moments->mrvx.y, mr.y * vel.x);
+    atomicAdd(&moments->mrvx.z, mr.z * vel.x);
+    atomicAdd(&moments->mrvy.x, mr.x * vel.y);
+    atomicAdd(&moments->mrvy.y, mr.y * vel.y);
+    atomicAdd(&moments->mrvy.z, mr.z * vel.y);
+    atomicAdd(&moments->mrvz.x, mr.x * vel.z);
+    atomicAdd(&moments->mrvz.y, mr.y * vel.z);
+    atomicAdd(&moments->mrvz.z, mr.z * vel.z);
+    }
+
+//! Compute the angular velocity correction of each cell
+/*!
+ * The rotation vector is drawn from the same random number stream as srd_rotate.
+ */
+__global__ void srd_angular_velocities(double3* d_com,
+                                       double3* d_omega,
+                                       const mpcd::detail::CellAngularMoments* d_moments,
+                                       const double4* d_cell_vel,
+                                       const double* d_factors,
+                                       const Index3D ci,
+                                       const int3 origin,
+                                       const uint3 global_dim,
+                                       const Index3D global_ci,
+                                       const uint64_t timestep,
+                                       const uint16_t seed,
+                                       const double cos_a,
+                                       const double sin_a,
+                                       const bool two_d,
+                                       const unsigned int Ncell)
+    {
+    // one thread per cell
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= Ncell)
+        return;
+
+    const unsigned int global_idx = srd_global_cell_index(idx, ci, origin, global_dim, global_ci);
+    hoomd::RandomGenerator rng(
+        hoomd::Seed(hoomd::RNGIdentifier::SRDCollisionMethod, timestep, seed),
+        hoomd::Counter(global_idx));
+    double3 rotvec;
+    hoomd::SpherePointGenerator<double> sphgen;
+    sphgen(rng, rotvec);
+
+    const double factor = (d_factors != NULL) ? d_factors[idx] : 1.0;
+    double3 com;
+    d_omega[idx] = mpcd::detail::computeAngularCorrection(com,
+                                                          d_moments[idx],
+                                                          d_cell_vel[idx],
+                                                          rotvec,
+                                                          cos_a,
+                                                          sin_a,
+                                                          factor,
+                                                          two_d);
+    d_com[idx] = com;
+    }
+
+//! Add the angular velocity correction to the particles
+__global__ void srd_angular_apply(SolventScalar4* d_vel,
+                                  Scalar4* d_vel_embed,
+                                  const SolventScalar4* d_pos,
+                                  const unsigned int* d_embed_group,
+                                  const Scalar4* d_pos_embed,
+                                  const unsigned int* d_embed_cell_ids,
+                                  const double3* d_com,
+                                  const double3* d_omega,
+                                  const Index3D ci,
+                                  const int3 origin,
+                                  const Scalar3 lo,
+                                  const Scalar cell_size,
+                                  const BoxDim global_box,
+                                  const bool two_d,
+                                  const unsigned int N_mpcd,
+                                  const unsigned int N_tot)
+    {
+    // one thread per particle
+    unsigned int tid = blockIdx.x * blockDim.x + threadIdx.x;
+    if (tid >= N_tot)
+        return;
+
+    Scalar3 pos;
+    unsigned int cell;
+    if (tid < N_mpcd)
+        {
+        const SolventScalar4 postype = d_pos[tid];
+        pos = make_scalar3(postype.x, postype.y, postype.z);
+        cell = __solvent_scalar_as_int(d_vel[tid].w);
+        }
+    else
+        {
+        const unsigned int idx = d_embed_group[tid - N_mpcd];
+        const Scalar4 postype = d_pos_embed[idx];
+        pos = make_scalar3(postype.x, postype.y, postype.z);
+        cell = d_embed_cell_ids[tid - N_mpcd];
+        }
+
+    const Scalar3 r = mpcd::detail::getCellRelativePosition(pos,
+                                                            ci.getTriple(cell),
+                                                            origin,
+                                                            lo,
+                                                            cell_size,
+                                                            global_box,
+                                                            two_d);
+    const double3 com = d_com[cell];
+    const double3 dr = make_double3(r.x - com.x, r.y - com.y, r.z - com.z);
+    const double3 omega = d_omega[cell];
+
+    const double3 dv = make_double3(omega.y * dr.z - omega.z * dr.y,
+                                    omega.z * dr.x - omega.x * dr.z,
+                                    omega.x * dr.y - omega.y * dr.x);
+    if (tid < N_mpcd)
+        {
+        SolventScalar4 new_vel = d_vel[tid];
+        new_vel.x += dv.x;
+        new_vel.y += dv.y;
+        new_vel.z += dv.z;
+        d_vel[tid] = new_vel;
+        }
+    else
+        {
+        const unsigned int idx = d_embed_group[tid - N_mpcd];
+        Scalar4 new_vel = d_vel_embed[idx];
+        new_vel.x += dv.x;
+        new_vel.y += dv.y;
+        new_vel.z += dv.z;
+        d_vel_embed[idx] = new_vel;
+        }
+    }
     } // end namespace kernel
 
 cudaError_t srd_draw_vectors(double3* d_rotvec,
@@ -247,12 +492,17 @@ cudaError_t srd_draw_vectors(double3* d_rotvec,
     return cudaSuccess;
     }
 
-cudaError_t srd_rotate(Scalar4* d_vel,
+cudaError_t srd_rotate(SolventScalar4* d_vel,
                        Scalar4* d_vel_embed,
                        const unsigned int* d_embed_group,
                        const unsigned int* d_embed_cell_ids,
                        const double4* d_cell_vel,
-                       const double3* d_rotvec,
+                       const Index3D& ci,
+                       const int3 origin,
+                       const uint3 global_dim,
+                       const Index3D& global_ci,
+                       const uint64_t timestep,
+                       const uint16_t seed,
                        const double angle,
                        const double* d_factors,
                        const unsigned int N_mpcd,
@@ -276,7 +526,12 @@ cudaError_t srd_rotate(Scalar4* d_vel,
                                                             d_embed_group,
                                                             d_embed_cell_ids,
                                                             d_cell_vel,
-                                                            d_rotvec,
+                                                            ci,
+                                                            origin,
+                                                            global_dim,
+                                                            global_ci,
+                                                            timestep,
+                                                            seed,
                                                             cos_a,
                                                             one_minus_cos_a,
                                                             sin_a,
@@ -287,6 +542,163 @@ cudaError_t srd_rotate(Scalar4* d_vel,
     return cudaSuccess;
     }
 
+cudaError_t srd_angular_moments(mpcd::detail::CellAngularMoments* d_moments,
+                                const SolventScalar4* d_pos,
+                                const SolventScalar4* d_vel,
+                                const Scalar mpcd_mass,
+                                const unsigned int* d_embed_group,
+                                const Scalar4* d_pos_embed,
+                                const Scalar4* d_vel_embed,
+                                const unsigned int* d_embed_cell_ids,
+                                const Index3D& ci,
+                                const int3 origin,
+                                const Scalar3 lo,
+                                const Scalar cell_size,
+                                const BoxDim& global_box,
+                                const bool two_d,
+                                const unsigned int N_mpcd,
+                                const unsigned int N_tot,
+                                const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)mpcd::gpu::kernel::srd_angular_moments);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid(N_tot / run_block_size + 1);
+    mpcd::gpu::kernel::srd_angular_moments<<<grid, run_block_size>>>(d_moments,
+                                                                     d_pos,
+                                                                     d_vel,
+                                                                     mpcd_mass,
+                                                                     d_embed_group,
+                                                                     d_pos_embed,
+                                                                     d_vel_embed,
+                                                                     d_embed_cell_ids,
+                                                                     ci,
+                                                                     origin,
+                                                                     lo,
+                                                                     cell_size,
+                                                                     global_box,
+                                                                     two_d,
+                                                                     N_mpcd,
+                                                                     N_tot);
+
+    return cudaSuccess;
+    }
+
+cudaError_t srd_angular_velocities(double3* d_com,
+                                   double3* d_omega,
+                                   const mpcd::detail::CellAngularMoments* d_moments,
+                                   const double4* d_cell_vel,
+                                   const double* d_factors,
+                                   const Index3D& ci,
+                                   const int3 origin,
+                                   const uint3 global_dim,
+                                   const Index3D& global_ci,
+                                   const uint64_t timestep,
+                                   const uint16_t seed,
+                                   const double angle,
+                                   const bool two_d,
+                                   const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)mpcd::gpu::kernel::srd_angular_velocities);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    const double cos_a = slow::cos(angle);
+    const double sin_a = slow::sin(angle);
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    const unsigned int Ncell = ci.getNumElements();
+    dim3 grid(Ncell / run_block_size + 1);
+    mpcd::gpu::kernel::srd_angular_velocities<<<grid, run_block_size>>>(d_com,
+                                                                        d_omega,
+                                                                        d_moments,
+                                                                        d_cell_vel,
+                                                                        d_factors,
+                                                                        ci,
+                                                                        origin,
+                                                                        global_dim,
+                                                                        global_ci,
+                                                                        timestep,
+                                                                        seed,
+                                                                        cos_a,
+                                                                        sin_a,
+                                                                        two_d,
+                                                                        Ncell);
+
+    return cudaSuccess;
+    }
+
+cudaError_t srd_angular_apply(SolventScalar4* d_vel,
+                              Scalar4* d_vel_embed,
+                              const SolventScalar4* d_pos,
+                              const unsigned int* d_embed_group,
+                              const Scalar4* d_pos_embed,
+                              const unsigned int* d_embed_cell_ids,
+                              const double3* d_com,
+                              const double3* d_omega,
+                              const Index3D& ci,
+                              const int3 origin,
+                              const Scalar3 lo,
+                              const Scalar cell_size,
+                              const BoxDim& global_box,
+                              const bool two_d,
+                              const unsigned int N_mpcd,
+                              const unsigned int N_tot,
+                              const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)mpcd::gpu::kernel::srd_angular_apply);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid(N_tot / run_block_size + 1);
+    mpcd::gpu::kernel::srd_angular_apply<<<grid, run_block_size>>>(d_vel,
+                                                                   d_vel_embed,
+                                                                   d_pos,
+                                                                   d_embed_group,
+                                                                   d_pos_embed,
+                                                                   d_embed_cell_ids,
+                                                                   d_com,
+                                                                   d_omega,
+                                                                   ci,
+                                                                   origin,
+                                                                   lo,
+                                                                   cell_size,
+                                                                   global_box,
+                                                                   two_d,
+                                                                   N_mpcd,
+                                                                   N_tot);
+
+    return cudaSuccess;
+    }
+
+//! Explicit template instantiation of pack for cell angular moments
+template cudaError_t __attribute__((visibility("default")))
+pack_cell_buffer(typename mpcd::detail::CellAngularMomentsPackOp::element* d_send_buf,
+                 const mpcd::detail::CellAngularMoments* d_props,
+                 const unsigned int* d_send_idx,
+                 const mpcd::detail::CellAngularMomentsPackOp op,
+                 const unsigned int num_send,
+                 unsigned int block_size,
+                 cudaStream_t stream);
+
+//! Explicit template instantiation of unpack for cell angular moments
+template cudaError_t __attribute__((visibility("default")))
+unpack_cell_buffer(mpcd::detail::CellAngularMoments* d_props,
+                   const unsigned int* d_cells,
+                   const unsigned int* d_recv,
+                   const unsigned int* d_recv_begin,
+                   const unsigned int* d_recv_end,
+                   const typename mpcd::detail::CellAngularMomentsPackOp::element* d_recv_buf,
+                   const mpcd::detail::CellAngularMomentsPackOp op,
+                   const unsigned int num_cells,
+                   const unsigned int block_size);
+
     } // end namespace gpu
     } // end namespace mpcd
     } // end namespace hoomd
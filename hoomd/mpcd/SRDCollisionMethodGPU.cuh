@@ -11,6 +11,9 @@
 
 #include <cuda_runtime.h>
 
+#include "ParticleDataUtilities.h"
+#include "SRDAngularMomentum.h"
+#include "hoomd/BoxDim.h"
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/Index1D.h"
 
@@ -33,18 +36,77 @@ cudaError_t srd_draw_vectors(double3* d_rotvec,
                              const unsigned int n_dimensions,
                              const unsigned int block_size);
 
-cudaError_t srd_rotate(Scalar4* d_vel,
+cudaError_t srd_rotate(SolventScalar4* d_vel,
                        Scalar4* d_vel_embed,
                        const unsigned int* d_embed_group,
                        const unsigned int* d_embed_cell_ids,
                        const double4* d_cell_vel,
-                       const double3* d_rotvec,
+                       const Index3D& ci,
+                       const int3 origin,
+                       const uint3 global_dim,
+                       const Index3D& global_ci,
+                       const uint64_t timestep,
+                       const uint16_t seed,
                        const double angle,
                        const double* d_factors,
                        const unsigned int N_mpcd,
                        const unsigned int N_tot,
                        const unsigned int block_size);
 
+//! Sum the moments of the particles in each cell for SRD+a
+cudaError_t srd_angular_moments(mpcd::detail::CellAngularMoments* d_moments,
+                                const SolventScalar4* d_pos,
+                                const SolventScalar4* d_vel,
+                                const Scalar mpcd_mass,
+                                const unsigned int* d_embed_group,
+                                const Scalar4* d_pos_embed,
+                                const Scalar4* d_vel_embed,
+                                const unsigned int* d_embed_cell_ids,
+                                const Index3D& ci,
+                                const int3 origin,
+                                const Scalar3 lo,
+                                const Scalar cell_size,
+                                const BoxDim& global_box,
+                                const bool two_d,
+                                const unsigned int N_mpcd,
+                                const unsigned int N_tot,
+                                const unsigned int block_size);
+
+//! Compute the angular velocity correction of each cell for SRD+a
+cudaError_t srd_angular_velocities(double3* d_com,
+                                   double3* d_omega,
+                                   const mpcd::detail::CellAngularMoments* d_moments,
+                                   const double4* d_cell_vel,
+                                   const double* d_factors,
+                                   const Index3D& ci,
+                                   const int3 origin,
+                                   const uint3 global_dim,
+                                   const Index3D& global_ci,
+                                   const uint64_t timestep,
+                                   const uint16_t seed,
+                                   const double angle,
+                                   const bool two_d,
+                                   const unsigned int block_size);
+
+//! Add the angular velocity correction to the particles for SRD+a
+cudaError_t srd_angular_apply(SolventScalar4* d_vel,
+                              Scalar4* d_vel_embed,
+                              const SolventScalar4* d_pos,
+                              const unsigned int* d_embed_group,
+                              const Scalar4* d_pos_embed,
+                              const unsigned int* d_embed_cell_ids,
+                              const double3* d_com,
+                              const double3* d_omega,
+                              const Index3D& ci,
+                              const int3 origin,
+                              const Scalar3 lo,
+                              const Scalar cell_size,
+                              const BoxDim& global_box,
+                              const bool two_d,
+                              const unsigned int N_mpcd,
+                              const unsigned int N_tot,
+                              const unsigned int block_size);
+
     } // end namespace gpu
     } // end namespace mpcd
     } // end namespace hoomd
@@ -33,12 +33,28 @@ class PYBIND11_EXPORT SRDCollisionMethodGPU : public mpcd::SRDCollisionMethod
     void setCellList(std::shared_ptr<mpcd::CellList> cl);
 
     protected:
+    //! Implementation of the collision rule
+    virtual void rule(uint64_t timestep);
+
     //! Randomly draw cell rotation vectors
     virtual void drawRotationVectors(uint64_t timestep);
 
+    //! Randomly draw cell-level rescale factors for the thermostat
+    void drawScaleFactors(uint64_t timestep);
+
     //! Apply rotation matrix to velocities
     virtual void rotate(uint64_t timestep);
 
+    //! Get the cell thermo compute whose properties can be accumulated while streaming
+    /*!
+     * The SRD rule only needs the cell velocities (and energies, if thermostatted) and the cells
+     * stashed in the particle velocities, so it does not need the cell list once these are known.
+     */
+    virtual std::shared_ptr<mpcd::CellThermoCompute> getFusedThermo()
+        {
+        return m_thermo;
+        }
+
     private:
     std::shared_ptr<Autotuner<1>> m_tuner_rotvec; //!< Tuner for drawing rotation vectors
     std::shared_ptr<Autotuner<1>> m_tuner_rotate; //!< Tuner for rotating velocities
@@ -0,0 +1,101 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/SignedDistanceField.cc
+ * \brief Definition of mpcd::SignedDistanceField
+ */
+
+#include "SignedDistanceField.h"
+
+#include <pybind11/numpy.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace hoomd
+    {
+/*!
+ * \param exec_conf Execution configuration
+ * \param values Signed distance at the grid points, in Index3D order
+ * \param dim Number of grid points in each dimension
+ * \param L Box lengths spanned by the grid
+ */
+mpcd::SignedDistanceField::SignedDistanceField(
+    std::shared_ptr<const ExecutionConfiguration> exec_conf,
+    const std::vector<Scalar>& values,
+    uint3 dim,
+    Scalar3 L)
+    : m_exec_conf(exec_conf), m_dim(dim), m_L(L)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing MPCD SignedDistanceField" << std::endl;
+
+    if (dim.x == 0 || dim.y == 0 || dim.z == 0)
+        {
+        m_exec_conf->msg->error() << "Signed distance field must have at least one grid point "
+                                     "in each dimension."
+                                  << std::endl;
+        throw std::runtime_error("Invalid signed distance field dimensions");
+        }
+    if (values.size() != size_t(dim.x) * dim.y * dim.z)
+        {
+        m_exec_conf->msg->error() << "Signed distance field has " << values.size()
+                                  << " values, but " << size_t(dim.x) * dim.y * dim.z
+                                  << " grid points." << std::endl;
+        throw std::runtime_error("Invalid signed distance field size");
+        }
+    if (!(L.x > Scalar(0) && L.y > Scalar(0) && L.z > Scalar(0)))
+        {
+        m_exec_conf->msg->error() << "Signed distance field must span a positive length."
+                                  << std::endl;
+        throw std::runtime_error("Invalid signed distance field length");
+        }
+
+    m_values = ManagedArray<Scalar>(static_cast<unsigned int>(values.size()),
+                                    m_exec_conf->isCUDAEnabled());
+    std::copy(values.begin(), values.end(), m_values.get());
+    }
+
+mpcd::SignedDistanceField::~SignedDistanceField()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying MPCD SignedDistanceField" << std::endl;
+    }
+
+/*!
+ * \param m Python module to export to
+ *
+ * The field is constructed from a 3D array of shape (nx, ny, nz), which is reordered so that x
+ * varies fastest.
+ */
+void mpcd::detail::export_SignedDistanceField(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::SignedDistanceField, std::shared_ptr<mpcd::SignedDistanceField>>(
+        m,
+        "SignedDistanceField")
+        .def(pybind11::init(
+            [](std::shared_ptr<const ExecutionConfiguration> exec_conf,
+               pybind11::array_t<Scalar, pybind11::array::c_style | pybind11::array::forcecast>
+                   values,
+               Scalar3 L)
+            {
+                if (values.ndim() != 3)
+                    {
+                    throw std::runtime_error("Signed distance field must be a 3D array");
+                    }
+                const uint3 dim = make_uint3(static_cast<unsigned int>(values.shape(0)),
+                                             static_cast<unsigned int>(values.shape(1)),
+                                             static_cast<unsigned int>(values.shape(2)));
+                const Index3D indexer(dim.x, dim.y, dim.z);
+                auto v = values.unchecked<3>();
+                std::vector<Scalar> h_values(indexer.getNumElements());
+                for (unsigned int i = 0; i < dim.x; ++i)
+                    for (unsigned int j = 0; j < dim.y; ++j)
+                        for (unsigned int k = 0; k < dim.z; ++k)
+                            h_values[indexer(i, j, k)] = v(i, j, k);
+                return std::make_shared<mpcd::SignedDistanceField>(exec_conf, h_values, dim, L);
+            }))
+        .def("getDimensions", &mpcd::SignedDistanceField::getDimensions)
+        .def("getL", &mpcd::SignedDistanceField::getL);
+    }
+
+    } // end namespace hoomd
@@ -0,0 +1,79 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/SignedDistanceField.h
+ * \brief Definition of mpcd::SignedDistanceField
+ */
+
+#ifndef MPCD_SIGNED_DISTANCE_FIELD_H_
+#define MPCD_SIGNED_DISTANCE_FIELD_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "SDFGeometry.h"
+
+#include "hoomd/ExecutionConfiguration.h"
+#include "hoomd/ManagedArray.h"
+
+#include <pybind11/pybind11.h>
+#include <memory>
+#include <vector>
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Tabulated signed distance field for mpcd::detail::SDFGeometry
+/*!
+ * The signed distance is stored on a regular grid in memory that is accessible from both the host
+ * and the device, so that the (trivially copyable) geometry can be passed by value to kernels and
+ * simply point into the table. The field must outlive every geometry made from it.
+ */
+class PYBIND11_EXPORT SignedDistanceField
+    {
+    public:
+    //! Constructor
+    SignedDistanceField(std::shared_ptr<const ExecutionConfiguration> exec_conf,
+                        const std::vector<Scalar>& values,
+                        uint3 dim,
+                        Scalar3 L);
+
+    //! Destructor
+    ~SignedDistanceField();
+
+    //! Make a geometry that uses this field
+    mpcd::detail::SDFGeometry makeGeometry(mpcd::detail::boundary bc) const
+        {
+        return mpcd::detail::SDFGeometry(m_values.get(), m_dim, m_L, bc);
+        }
+
+    //! Get the number of grid points
+    uint3 getDimensions() const
+        {
+        return m_dim;
+        }
+
+    //! Get the box lengths spanned by the grid
+    Scalar3 getL() const
+        {
+        return m_L;
+        }
+
+    private:
+    std::shared_ptr<const ExecutionConfiguration> m_exec_conf; //!< Execution configuration
+    ManagedArray<Scalar> m_values;                             //!< Signed distance at grid points
+    const uint3 m_dim;                                         //!< Number of grid points
+    const Scalar3 m_L;                                         //!< Box lengths spanned by grid
+    };
+
+namespace detail
+    {
+//! Export SignedDistanceField to python
+void export_SignedDistanceField(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_SIGNED_DISTANCE_FIELD_H_
@@ -10,6 +10,7 @@
 #define MPCD_SLIT_GEOMETRY_H_
 
 #include "BoundaryCondition.h"
+#include "CollisionStatistics.h"
 
 #include "hoomd/BoxDim.h"
 #include "hoomd/HOOMDMath.h"
@@ -69,6 +70,7 @@ class __attribute__((visibility("default"))) SlitGeometry
      * \param pos Proposed particle position
      * \param vel Proposed particle velocity
      * \param dt Integration time remaining
+     * \param stats Optional collision statistics (unused because there is no root finding)
      *
      * \returns True if a collision occurred, and false otherwise
      *
@@ -76,7 +78,10 @@ class __attribute__((visibility("default"))) SlitGeometry
      * is updated according to the appropriate bounce back rule, and the integration time \a dt is
      * decreased to the amount of time remaining.
      */
-    HOSTDEVICE bool detectCollision(Scalar3& pos, Scalar3& vel, Scalar& dt) const
+    HOSTDEVICE bool detectCollision(Scalar3& pos,
+                                    Scalar3& vel,
+                                    Scalar& dt,
+                                    CollisionStatistics* stats = nullptr) const
         {
         /*
          * Detect if particle has left the box, and try to avoid branching or absolute value calls.
@@ -41,6 +41,7 @@ class PYBIND11_EXPORT SlitGeometryFiller : public mpcd::VirtualParticleFiller
     void setGeometry(std::shared_ptr<const mpcd::detail::SlitGeometry> geom)
         {
         m_geom = geom;
+        invalidateReservoir();
         }
 
     protected:
@@ -55,6 +56,17 @@ class PYBIND11_EXPORT SlitGeometryFiller : public mpcd::VirtualParticleFiller
 
     //! Draw particles within the fill volume
     virtual void drawParticles(uint64_t timestep);
+
+    //! Get the mean velocity of a virtual particle at a position
+    /*!
+     * \param pos Position of the virtual particle
+     * \returns Velocity of the wall on the same side of the channel as \a pos
+     */
+    virtual Scalar3 getMeanVelocity(const SolventScalar4& pos) const
+        {
+        const Scalar sign = (pos.z >= Scalar(0)) ? Scalar(1) : Scalar(-1);
+        return make_scalar3(sign * m_geom->getVelocity(), 0, 0);
+        }
     };
 
 namespace detail
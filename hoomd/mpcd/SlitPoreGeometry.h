@@ -10,6 +10,7 @@
 #define MPCD_SLIT_PORE_GEOMETRY_H_
 
 #include "BoundaryCondition.h"
+#include "CollisionStatistics.h"
 
 #include "hoomd/BoxDim.h"
 #include "hoomd/HOOMDMath.h"
@@ -59,6 +60,7 @@ class __attribute__((visibility("default"))) SlitPoreGeometry
      * \param pos Proposed particle position
      * \param vel Proposed particle velocity
      * \param dt Integration time remaining (inout).
+     * \param stats Optional collision statistics (unused because there is no root finding)
      *
      * \returns True if a collision occurred, and false otherwise
      *
@@ -69,7 +71,10 @@ class __attribute__((visibility("default"))) SlitPoreGeometry
      * The passed value of \a dt must be the time taken to arrive at pos. The returned value of \a
      * dt will be less than this time.
      */
-    HOSTDEVICE bool detectCollision(Scalar3& pos, Scalar3& vel, Scalar& dt) const
+    HOSTDEVICE bool detectCollision(Scalar3& pos,
+                                    Scalar3& vel,
+                                    Scalar& dt,
+                                    CollisionStatistics* stats = nullptr) const
         {
         /* First check that the particle ended up inside the pore or walls.
          * sign.x is +1 if outside pore in +x, -1 if outside pore in -x, and 0 otherwise.
@@ -150,12 +150,12 @@ void mpcd::SlitPoreGeometryFiller::drawParticles(uint64_t timestep)
     if (m_N_fill == 0)
         return;
 
-    ArrayHandle<Scalar4> h_pos(m_mpcd_pdata->getPositions(),
-                               access_location::host,
-                               access_mode::readwrite);
-    ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(),
-                               access_location::host,
-                               access_mode::readwrite);
+    ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                      access_location::host,
+                                      access_mode::readwrite);
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::readwrite);
     ArrayHandle<unsigned int> h_tag(m_mpcd_pdata->getTags(),
                                     access_location::host,
                                     access_mode::readwrite);
@@ -174,14 +174,27 @@ void mpcd::SlitPoreGeometryFiller::drawParticles(uint64_t timestep)
 
     uint16_t seed = m_sysdef->getSeed();
 
+    // most particles draw 3 positions and 2 pairs of velocities
+    const hoomd::Seed rng_seed(hoomd::RNGIdentifier::SlitPoreGeometryFiller, timestep, seed);
+    hoomd::RandomGeneratorBatch<5> rng_batch;
+
     // index to start filling from
     const unsigned int first_idx = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual() - m_N_fill;
     for (unsigned int i = 0; i < m_N_fill; ++i)
         {
         const unsigned int tag = m_first_tag + i;
-        hoomd::RandomGenerator rng(
-            hoomd::Seed(hoomd::RNGIdentifier::SlitPoreGeometryFiller, timestep, seed),
-            hoomd::Counter(tag));
+
+        // the streams of the next particles are drawn together
+        const unsigned int lane = i % rng_batch.width;
+        if (lane == 0)
+            {
+            for (unsigned int j = 0; j < rng_batch.width; ++j)
+                {
+                rng_batch.setStream(j, rng_seed, hoomd::Counter(tag + j));
+                }
+            rng_batch.generate();
+            }
+        auto rng = rng_batch.getGenerator(lane);
 
         // advanced past end of this box range, take the next
         if (i >= boxlast)
@@ -196,10 +209,10 @@ void mpcd::SlitPoreGeometryFiller::drawParticles(uint64_t timestep)
             }
 
         const unsigned int pidx = first_idx + i;
-        h_pos.data[pidx] = make_scalar4(hoomd::UniformDistribution<Scalar>(lo.x, hi.x)(rng),
-                                        hoomd::UniformDistribution<Scalar>(lo.y, hi.y)(rng),
-                                        hoomd::UniformDistribution<Scalar>(lo.z, hi.z)(rng),
-                                        __int_as_scalar(m_type));
+        h_pos.data[pidx] = make_solvent_scalar4(hoomd::UniformDistribution<Scalar>(lo.x, hi.x)(rng),
+                                                hoomd::UniformDistribution<Scalar>(lo.y, hi.y)(rng),
+                                                hoomd::UniformDistribution<Scalar>(lo.z, hi.z)(rng),
+                                                __int_as_solvent_scalar(m_type));
 
         hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
         Scalar3 vel;
@@ -207,8 +220,10 @@ void mpcd::SlitPoreGeometryFiller::drawParticles(uint64_t timestep)
         vel.z = gen(rng);
         // TODO: should these be given zero net-momentum contribution (relative to the frame of
         // reference?)
-        h_vel.data[pidx]
-            = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
+        h_vel.data[pidx] = make_solvent_scalar4(vel.x,
+                                                vel.y,
+                                                vel.z,
+                                                __int_as_solvent_scalar(mpcd::detail::NO_CELL));
         h_tag.data[pidx] = tag;
         }
     }
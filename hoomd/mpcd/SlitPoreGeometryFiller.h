@@ -42,6 +42,7 @@ class PYBIND11_EXPORT SlitPoreGeometryFiller : public mpcd::VirtualParticleFille
     void setGeometry(std::shared_ptr<const mpcd::detail::SlitPoreGeometry> geom)
         {
         m_geom = geom;
+        invalidateReservoir();
         notifyRecompute();
         }
 
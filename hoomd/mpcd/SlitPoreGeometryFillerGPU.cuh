@@ -11,6 +11,7 @@
 
 #include <cuda_runtime.h>
 
+#include "ParticleDataUtilities.h"
 #include "SlitPoreGeometry.h"
 #include "hoomd/BoxDim.h"
 #include "hoomd/HOOMDMath.h"
@@ -22,8 +23,8 @@ namespace mpcd
 namespace gpu
     {
 //! Draw virtual particles in the SlitPoreGeometry
-cudaError_t slit_pore_draw_particles(Scalar4* d_pos,
-                                     Scalar4* d_vel,
+cudaError_t slit_pore_draw_particles(SolventScalar4* d_pos,
+                                     SolventScalar4* d_vel,
                                      unsigned int* d_tag,
                                      const BoxDim& box,
                                      const Scalar4* d_boxes,
@@ -8,8 +8,94 @@
 
 #include "Sorter.h"
 
+#include <algorithm>
+
 namespace hoomd
     {
+namespace
+    {
+//! Compute the index of a cell along a Morton curve
+/*!
+ * \param cell Cell coordinates
+ * \param bits Number of bits per coordinate
+ * \param ndim Number of dimensions
+ *
+ * \returns Index of the cell along the curve
+ *
+ * The bits of the coordinates are interleaved, starting from the most significant bit.
+ */
+uint64_t mortonIndex(const uint3& cell, unsigned int bits, unsigned int ndim)
+    {
+    const unsigned int x[3] = {cell.x, cell.y, cell.z};
+    uint64_t index = 0;
+    for (int b = bits - 1; b >= 0; --b)
+        {
+        for (unsigned int i = 0; i < ndim; ++i)
+            {
+            index = (index << 1) | ((x[i] >> b) & 1);
+            }
+        }
+    return index;
+    }
+
+//! Compute the index of a cell along a Hilbert curve
+/*!
+ * \param cell Cell coordinates
+ * \param bits Number of bits per coordinate
+ * \param ndim Number of dimensions
+ *
+ * \returns Index of the cell along the curve
+ *
+ * The coordinates are transformed into the transposed Hilbert index using the algorithm of
+ * J. Skilling, AIP Conf. Proc. 707, 381 (2004), and the bits of the transposed index are then
+ * interleaved like for the Morton curve.
+ */
+uint64_t hilbertIndex(const uint3& cell, unsigned int bits, unsigned int ndim)
+    {
+    unsigned int x[3] = {cell.x, cell.y, cell.z};
+    const unsigned int M = 1u << (bits - 1);
+
+    // inverse undo
+    for (unsigned int Q = M; Q > 1; Q >>= 1)
+        {
+        const unsigned int P = Q - 1;
+        for (unsigned int i = 0; i < ndim; ++i)
+            {
+            if (x[i] & Q)
+                {
+                // invert
+                x[0] ^= P;
+                }
+            else
+                {
+                // exchange
+                const unsigned int t = (x[0] ^ x[i]) & P;
+                x[0] ^= t;
+                x[i] ^= t;
+                }
+            }
+        }
+
+    // Gray encode
+    for (unsigned int i = 1; i < ndim; ++i)
+        {
+        x[i] ^= x[i - 1];
+        }
+    unsigned int t = 0;
+    for (unsigned int Q = M; Q > 1; Q >>= 1)
+        {
+        if (x[ndim - 1] & Q)
+            t ^= Q - 1;
+        }
+    for (unsigned int i = 0; i < ndim; ++i)
+        {
+        x[i] ^= t;
+        }
+
+    return mortonIndex(make_uint3(x[0], x[1], x[2]), bits, ndim);
+    }
+    } // end anonymous namespace
+
 /*!
  * \param sysdef System definition
  */
@@ -18,7 +104,9 @@ mpcd::Sorter::Sorter(std::shared_ptr<SystemDefinition> sysdef,
                      unsigned int period)
     : m_sysdef(sysdef), m_pdata(m_sysdef->getParticleData()), m_exec_conf(m_pdata->getExecConf()),
       m_mpcd_pdata(m_sysdef->getMPCDParticleData()), m_order(m_exec_conf), m_rorder(m_exec_conf),
-      m_period(period)
+      m_period(period), m_ordering(CellOrdering::cell), m_cell_order(m_exec_conf),
+      m_cell_order_dim(make_uint3(0, 0, 0)), m_disorder_threshold(0.0), m_disorder(0.0),
+      m_sorted(false)
     {
     m_exec_conf->msg->notice(5) << "Constructing MPCD Sorter" << std::endl;
 
@@ -34,6 +122,8 @@ mpcd::Sorter::~Sorter()
  * \param timestep Current simulation timestep
  *
  * This method is just a driver for the computeOrder() and applyOrder() methods.
+ * When sorting adaptively, the particles are only sorted if their disorder
+ * reaches the threshold.
  */
 void mpcd::Sorter::update(uint64_t timestep)
     {
@@ -45,6 +135,15 @@ void mpcd::Sorter::update(uint64_t timestep)
         throw std::runtime_error("Cell list has not been set");
         }
 
+    m_sorted = false;
+    if (m_disorder_threshold > Scalar(0.0))
+        {
+        m_disorder = computeDisorder(timestep);
+        if (m_disorder < m_disorder_threshold)
+            return;
+        }
+    m_sorted = true;
+
     // resize the sorted order vector to the current number of particles
     m_order.resize(m_mpcd_pdata->getN());
     m_rorder.resize(m_mpcd_pdata->getN());
@@ -68,6 +167,7 @@ void mpcd::Sorter::computeOrder(uint64_t timestep)
     {
     // compute the cell list at current timestep, guarantees owned particles are on rank
     m_cl->compute(timestep);
+    updateCellOrder();
 
     ArrayHandle<unsigned int> h_cell_list(m_cl->getCellList(),
                                           access_location::host,
@@ -81,9 +181,15 @@ void mpcd::Sorter::computeOrder(uint64_t timestep)
     ArrayHandle<unsigned int> h_order(m_order, access_location::host, access_mode::overwrite);
     ArrayHandle<unsigned int> h_rorder(m_rorder, access_location::host, access_mode::overwrite);
     const unsigned int N_mpcd = m_mpcd_pdata->getN();
+
+    // cells are traversed in row-major order unless another order has been generated
+    const bool use_cell_order = (m_ordering != CellOrdering::cell);
+    ArrayHandle<unsigned int> h_cell_order(m_cell_order, access_location::host, access_mode::read);
+
     unsigned int cur_p = 0;
-    for (unsigned int idx = 0; idx < m_cl->getNCells(); ++idx)
+    for (unsigned int cell = 0; cell < m_cl->getNCells(); ++cell)
         {
+        const unsigned int idx = (use_cell_order) ? h_cell_order.data[cell] : cell;
         const unsigned int np = h_cell_np.data[idx];
         for (unsigned int offset = 0; offset < np; ++offset)
             {
@@ -114,22 +220,22 @@ void mpcd::Sorter::applyOrder() const
         {
         ArrayHandle<unsigned int> h_order(m_order, access_location::host, access_mode::read);
 
-        ArrayHandle<Scalar4> h_pos(m_mpcd_pdata->getPositions(),
-                                   access_location::host,
-                                   access_mode::read);
-        ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(),
-                                   access_location::host,
-                                   access_mode::read);
+        ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                          access_location::host,
+                                          access_mode::read);
+        ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                          access_location::host,
+                                          access_mode::read);
         ArrayHandle<unsigned int> h_tag(m_mpcd_pdata->getTags(),
                                         access_location::host,
                                         access_mode::read);
 
-        ArrayHandle<Scalar4> h_pos_alt(m_mpcd_pdata->getAltPositions(),
-                                       access_location::host,
-                                       access_mode::overwrite);
-        ArrayHandle<Scalar4> h_vel_alt(m_mpcd_pdata->getAltVelocities(),
-                                       access_location::host,
-                                       access_mode::overwrite);
+        ArrayHandle<SolventScalar4> h_pos_alt(m_mpcd_pdata->getAltPositions(),
+                                              access_location::host,
+                                              access_mode::overwrite);
+        ArrayHandle<SolventScalar4> h_vel_alt(m_mpcd_pdata->getAltVelocities(),
+                                              access_location::host,
+                                              access_mode::overwrite);
         ArrayHandle<unsigned int> h_tag_alt(m_mpcd_pdata->getAltTags(),
                                             access_location::host,
                                             access_mode::overwrite);
@@ -159,6 +265,171 @@ void mpcd::Sorter::applyOrder() const
     m_mpcd_pdata->swapTags();
     }
 
+/*!
+ * \returns Name of the order that the cells are traversed in
+ */
+std::string mpcd::Sorter::getCellOrdering() const
+    {
+    if (m_ordering == CellOrdering::morton)
+        return "morton";
+    else if (m_ordering == CellOrdering::hilbert)
+        return "hilbert";
+    else
+        return "cell";
+    }
+
+/*!
+ * \param ordering Name of the order that the cells are traversed in
+ *
+ * The \a ordering must be one of "cell" (row-major order of the cell indexer), "morton", or
+ * "hilbert".
+ */
+void mpcd::Sorter::setCellOrdering(const std::string& ordering)
+    {
+    if (ordering == "cell")
+        {
+        m_ordering = CellOrdering::cell;
+        }
+    else if (ordering == "morton")
+        {
+        m_ordering = CellOrdering::morton;
+        }
+    else if (ordering == "hilbert")
+        {
+        m_ordering = CellOrdering::hilbert;
+        }
+    else
+        {
+        m_exec_conf->msg->error() << "mpcd.sort: unknown cell ordering " << ordering << std::endl;
+        throw std::runtime_error("Unknown MPCD sorter cell ordering");
+        }
+
+    // force the traversal order to be regenerated
+    m_cell_order_dim = make_uint3(0, 0, 0);
+    }
+
+/*!
+ * The traversal order is only regenerated when the dimensions of the cell list change. The cells
+ * are sorted by their index along the curve, which is computed for the smallest power-of-two grid
+ * that contains the cell list. This keeps the order well defined for grids that are not cubic or
+ * have dimensions that are not powers of two. Two-dimensional grids use the two-dimensional curve.
+ */
+void mpcd::Sorter::updateCellOrder()
+    {
+    if (m_ordering == CellOrdering::cell)
+        return;
+
+    const uint3 dim = m_cl->getDim();
+    if (dim.x == m_cell_order_dim.x && dim.y == m_cell_order_dim.y
+        && dim.z == m_cell_order_dim.z)
+        return;
+
+    // number of bits needed to represent the largest coordinate
+    const unsigned int max_dim = std::max(dim.x, std::max(dim.y, dim.z));
+    unsigned int bits = 1;
+    while ((1u << bits) < max_dim)
+        ++bits;
+    const unsigned int ndim = (dim.z == 1) ? 2 : 3;
+
+    const Index3D& ci = m_cl->getCellIndexer();
+    std::vector<std::pair<uint64_t, unsigned int>> keys(ci.getNumElements());
+    for (unsigned int k = 0; k < dim.z; ++k)
+        {
+        for (unsigned int j = 0; j < dim.y; ++j)
+            {
+            for (unsigned int i = 0; i < dim.x; ++i)
+                {
+                const uint3 cell = make_uint3(i, j, k);
+                const unsigned int idx = ci(i, j, k);
+                const uint64_t key = (m_ordering == CellOrdering::hilbert)
+                                         ? hilbertIndex(cell, bits, ndim)
+                                         : mortonIndex(cell, bits, ndim);
+                keys[idx] = std::make_pair(key, idx);
+                }
+            }
+        }
+    std::sort(keys.begin(), keys.end());
+
+    m_cell_order.resize(keys.size());
+    ArrayHandle<unsigned int> h_cell_order(m_cell_order,
+                                           access_location::host,
+                                           access_mode::overwrite);
+    for (unsigned int idx = 0; idx < keys.size(); ++idx)
+        {
+        h_cell_order.data[idx] = keys[idx].second;
+        }
+
+    m_cell_order_dim = dim;
+    }
+
+/*!
+ * \param threshold Fraction of particles in a different cell than their preceding particle
+ *                  needed to sort
+ *
+ * Setting \a threshold to zero sorts unconditionally.
+ */
+void mpcd::Sorter::setDisorderThreshold(Scalar threshold)
+    {
+    if (threshold < Scalar(0.0) || threshold > Scalar(1.0))
+        {
+        m_exec_conf->msg->error() << "mpcd.sort: disorder threshold must be between 0 and 1"
+                                  << std::endl;
+        throw std::runtime_error("Invalid MPCD sorter disorder threshold");
+        }
+    m_disorder_threshold = threshold;
+    }
+
+/*!
+ * \returns Number of MPCD particles whose cell differs from the preceding particle in memory
+ *
+ * The cell is read from the cell cache in the MPCD particle velocities, so the cell list must be
+ * up to date.
+ */
+unsigned int mpcd::Sorter::countDisordered()
+    {
+    ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::host,
+                                      access_mode::read);
+    unsigned int N_disordered = 0;
+    for (unsigned int idx = 1; idx < m_mpcd_pdata->getN(); ++idx)
+        {
+        if (__solvent_scalar_as_int(h_vel.data[idx].w)
+            != __solvent_scalar_as_int(h_vel.data[idx - 1].w))
+            ++N_disordered;
+        }
+    return N_disordered;
+    }
+
+/*!
+ * \param timestep Current timestep
+ *
+ * \returns Fraction of MPCD particles in a different cell than the preceding particle in memory
+ *
+ * The cell list is computed at the current timestep, so no additional cell list build is needed
+ * if the particles are subsequently sorted or the collision occurs at the same timestep. The
+ * counts are summed over all ranks so that the disorder is the same on every rank.
+ */
+Scalar mpcd::Sorter::computeDisorder(uint64_t timestep)
+    {
+    m_cl->compute(timestep);
+
+    unsigned int counts[2]
+        = {countDisordered(), (m_mpcd_pdata->getN() > 0) ? m_mpcd_pdata->getN() - 1 : 0};
+#ifdef ENABLE_MPI
+    if (m_exec_conf->getNRanks() > 1)
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      counts,
+                      2,
+                      MPI_UNSIGNED,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif // ENABLE_MPI
+
+    return (counts[1] > 0) ? Scalar(counts[0]) / Scalar(counts[1]) : Scalar(0.0);
+    }
+
 bool mpcd::Sorter::peekSort(uint64_t timestep) const
     {
     if (timestep < m_next_timestep)
@@ -185,7 +456,15 @@ void mpcd::detail::export_Sorter(pybind11::module& m)
     {
     pybind11::class_<mpcd::Sorter, std::shared_ptr<mpcd::Sorter>>(m, "Sorter")
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, unsigned int, unsigned int>())
-        .def("setPeriod", &mpcd::Sorter::setPeriod);
+        .def("setPeriod", &mpcd::Sorter::setPeriod)
+        .def_property("ordering",
+                      &mpcd::Sorter::getCellOrdering,
+                      &mpcd::Sorter::setCellOrdering)
+        .def_property("disorder_threshold",
+                      &mpcd::Sorter::getDisorderThreshold,
+                      &mpcd::Sorter::setDisorderThreshold)
+        .def_property_readonly("disorder", &mpcd::Sorter::getDisorder)
+        .def_property_readonly("sorted", &mpcd::Sorter::getSorted);
     }
 
     } // end namespace hoomd
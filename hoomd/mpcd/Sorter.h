@@ -37,6 +37,19 @@ namespace mpcd
  * the virtual particles and leave them in place at the end of the arrays. This is
  * because they cannot be removed easily if they are sorted with the rest of the particles,
  * and the performance gains from doing a separate (segmented) sort on them is probably small.
+ *
+ * By default, the cells are traversed in the row-major order of the cell indexer. The cells
+ * can instead be traversed along a Morton (Z-order) or Hilbert space-filling curve over the
+ * cell grid, which keeps neighboring cells in all directions closer together in memory. This
+ * is useful for strongly anisotropic cell grids, where neighbors along the slow index of the
+ * row-major order are far apart.
+ *
+ * The Sorter can also sort adaptively. Every \a period steps, the fraction of MPCD particles that
+ * are in a different cell than the preceding particle in memory is measured from the cell list.
+ * This fraction is small right after sorting (about one over the average number of particles per
+ * cell) and approaches one as the order decays. The particles are only sorted if the fraction
+ * reaches the disorder threshold. A threshold of zero sorts unconditionally every \a period steps,
+ * and the disorder is not measured.
  */
 class PYBIND11_EXPORT Sorter : public Autotuned
     {
@@ -71,6 +84,41 @@ class PYBIND11_EXPORT Sorter : public Autotuned
             }
         }
 
+    //! Get the order that the cells are traversed in
+    std::string getCellOrdering() const;
+
+    //! Set the order that the cells are traversed in
+    void setCellOrdering(const std::string& ordering);
+
+    //! Get the disorder threshold for adaptive sorting
+    Scalar getDisorderThreshold() const
+        {
+        return m_disorder_threshold;
+        }
+
+    //! Set the disorder threshold for adaptive sorting
+    void setDisorderThreshold(Scalar threshold);
+
+    //! Get the disorder measured at the last check
+    Scalar getDisorder() const
+        {
+        return m_disorder;
+        }
+
+    //! Get whether the particles were sorted at the last check
+    bool getSorted() const
+        {
+        return m_sorted;
+        }
+
+    //! Orders that the cells can be traversed in
+    enum class CellOrdering
+        {
+        cell,    //!< Row-major order of the cell indexer
+        morton,  //!< Morton (Z-order) curve
+        hilbert, //!< Hilbert curve
+        };
+
     protected:
     std::shared_ptr<SystemDefinition> m_sysdef;                //!< HOOMD system definition
     std::shared_ptr<hoomd::ParticleData> m_pdata;              //!< HOOMD particle data
@@ -85,6 +133,23 @@ class PYBIND11_EXPORT Sorter : public Autotuned
     unsigned int m_period;    //!< Sorting period
     uint64_t m_next_timestep; //!< Next step to apply sorting
 
+    CellOrdering m_ordering;              //!< Order that the cells are traversed in
+    GPUVector<unsigned int> m_cell_order; //!< Cells in the order they are traversed
+    uint3 m_cell_order_dim;               //!< Cell list dimensions of the traversal order
+
+    //! Update the traversal order of the cells for the current cell list
+    void updateCellOrder();
+
+    Scalar m_disorder_threshold; //!< Disorder needed to sort
+    Scalar m_disorder;           //!< Disorder measured at the last check
+    bool m_sorted;               //!< True if the particles were sorted at the last check
+
+    //! Count the MPCD particles in a different cell than the preceding particle
+    virtual unsigned int countDisordered();
+
+    //! Measure the disorder of the particles relative to the cell list
+    Scalar computeDisorder(uint64_t timestep);
+
     //! Compute the sorting order at the current timestep
     virtual void computeOrder(uint64_t timestep);
 
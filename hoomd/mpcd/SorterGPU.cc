@@ -42,6 +42,7 @@ void mpcd::SorterGPU::computeOrder(uint64_t timestep)
     {
     // compute the cell list at current timestep, guarantees owned particles are on rank
     m_cl->compute(timestep);
+    updateCellOrder();
 
         // fill the empty cell list entries with a sentinel larger than number of MPCD particles
         {
@@ -69,11 +70,26 @@ void mpcd::SorterGPU::computeOrder(uint64_t timestep)
                                               access_location::device,
                                               access_mode::read);
         ArrayHandle<unsigned int> d_order(m_order, access_location::device, access_mode::overwrite);
-        const unsigned int num_select
-            = mpcd::gpu::sort_cell_compact(d_order.data,
-                                           d_cell_list.data,
-                                           m_cl->getCellListIndexer().getNumElements(),
-                                           m_mpcd_pdata->getN());
+        unsigned int num_select;
+        if (m_ordering != CellOrdering::cell)
+            {
+            ArrayHandle<unsigned int> d_cell_order(m_cell_order,
+                                                   access_location::device,
+                                                   access_mode::read);
+            num_select = mpcd::gpu::sort_cell_compact(d_order.data,
+                                                      d_cell_list.data,
+                                                      d_cell_order.data,
+                                                      m_cl->getCellListIndexer(),
+                                                      m_mpcd_pdata->getN());
+            }
+        else
+            {
+            num_select
+                = mpcd::gpu::sort_cell_compact(d_order.data,
+                                               d_cell_list.data,
+                                               m_cl->getCellListIndexer().getNumElements(),
+                                               m_mpcd_pdata->getN());
+            }
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
         if (num_select != m_mpcd_pdata->getN())
@@ -101,6 +117,21 @@ void mpcd::SorterGPU::computeOrder(uint64_t timestep)
         }
     }
 
+/*!
+ * \returns Number of MPCD particles whose cell differs from the preceding particle in memory
+ */
+unsigned int mpcd::SorterGPU::countDisordered()
+    {
+    ArrayHandle<SolventScalar4> d_vel(m_mpcd_pdata->getVelocities(),
+                                      access_location::device,
+                                      access_mode::read);
+    const unsigned int N_disordered
+        = mpcd::gpu::sort_count_disordered(d_vel.data, m_mpcd_pdata->getN());
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    return N_disordered;
+    }
+
 /*!
  * The sorted order is applied by swapping out the alternate per-particle data
  * arrays. The communication flags are \b not sorted in MPI because by design,
@@ -112,22 +143,22 @@ void mpcd::SorterGPU::applyOrder() const
         {
         ArrayHandle<unsigned int> d_order(m_order, access_location::device, access_mode::read);
 
-        ArrayHandle<Scalar4> d_pos(m_mpcd_pdata->getPositions(),
-                                   access_location::device,
-                                   access_mode::read);
-        ArrayHandle<Scalar4> d_vel(m_mpcd_pdata->getVelocities(),
-                                   access_location::device,
-                                   access_mode::read);
+        ArrayHandle<SolventScalar4> d_pos(m_mpcd_pdata->getPositions(),
+                                          access_location::device,
+                                          access_mode::read);
+        ArrayHandle<SolventScalar4> d_vel(m_mpcd_pdata->getVelocities(),
+                                          access_location::device,
+                                          access_mode::read);
         ArrayHandle<unsigned int> d_tag(m_mpcd_pdata->getTags(),
                                         access_location::device,
                                         access_mode::read);
 
-        ArrayHandle<Scalar4> d_pos_alt(m_mpcd_pdata->getAltPositions(),
-                                       access_location::device,
-                                       access_mode::overwrite);
-        ArrayHandle<Scalar4> d_vel_alt(m_mpcd_pdata->getAltVelocities(),
-                                       access_location::device,
-                                       access_mode::overwrite);
+        ArrayHandle<SolventScalar4> d_pos_alt(m_mpcd_pdata->getAltPositions(),
+                                              access_location::device,
+                                              access_mode::overwrite);
+        ArrayHandle<SolventScalar4> d_vel_alt(m_mpcd_pdata->getAltVelocities(),
+                                              access_location::device,
+                                              access_mode::overwrite);
         ArrayHandle<unsigned int> d_tag_alt(m_mpcd_pdata->getAltTags(),
                                             access_location::device,
                                             access_mode::overwrite);
@@ -153,11 +184,11 @@ void mpcd::SorterGPU::applyOrder() const
             const unsigned int Nvirtual = m_mpcd_pdata->getNVirtual();
             cudaMemcpyAsync(d_pos_alt.data + N,
                             d_pos.data + N,
-                            Nvirtual * sizeof(Scalar4),
+                            Nvirtual * sizeof(SolventScalar4),
                             cudaMemcpyDeviceToDevice);
             cudaMemcpyAsync(d_vel_alt.data + N,
                             d_vel.data + N,
-                            Nvirtual * sizeof(Scalar4),
+                            Nvirtual * sizeof(SolventScalar4),
                             cudaMemcpyDeviceToDevice);
             cudaMemcpyAsync(d_tag_alt.data + N,
                             d_tag.data + N,
@@ -11,7 +11,11 @@
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
 #include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #pragma GCC diagnostic pop
 
 namespace hoomd
@@ -37,11 +41,11 @@ namespace kernel
  * Using one thread per particle, particle data is reordered from the old arrays
  * into the new arrays. This coalesces writes but fragments reads.
  */
-__global__ void sort_apply(Scalar4* d_pos_alt,
-                           Scalar4* d_vel_alt,
+__global__ void sort_apply(SolventScalar4* d_pos_alt,
+                           SolventScalar4* d_vel_alt,
                            unsigned int* d_tag_alt,
-                           const Scalar4* d_pos,
-                           const Scalar4* d_vel,
+                           const SolventScalar4* d_pos,
+                           const SolventScalar4* d_vel,
                            const unsigned int* d_tag,
                            const unsigned int* d_order,
                            const unsigned int N)
@@ -135,11 +139,11 @@ sort_gen_reverse(unsigned int* d_rorder, const unsigned int* d_order, const unsi
  *
  * \sa mpcd::gpu::kernel::sort_apply
  */
-cudaError_t sort_apply(Scalar4* d_pos_alt,
-                       Scalar4* d_vel_alt,
+cudaError_t sort_apply(SolventScalar4* d_pos_alt,
+                       SolventScalar4* d_vel_alt,
                        unsigned int* d_tag_alt,
-                       const Scalar4* d_pos,
-                       const Scalar4* d_vel,
+                       const SolventScalar4* d_pos,
+                       const SolventScalar4* d_vel,
                        const unsigned int* d_tag,
                        const unsigned int* d_order,
                        const unsigned int N,
@@ -259,6 +263,104 @@ unsigned int sort_cell_compact(unsigned int* d_order,
     return (unsigned int)(last - d_order);
     }
 
+//! Functor mapping entries of a reordered cell list onto entries of the cell list
+struct CellOrderEntry
+    {
+    //! Constructor
+    /*!
+     * \param cell_order_ Cells in the order they are traversed
+     * \param cli_ Two-dimensional cell-list indexer
+     */
+    __host__ __device__ CellOrderEntry(const unsigned int* cell_order_, const Index2D& cli_)
+        : cell_order(cell_order_), cli(cli_)
+        {
+        }
+
+    //! Map an entry of the reordered cell list
+    /*!
+     * \param idx Entry of the reordered cell list
+     * \returns Entry of the cell list
+     */
+    __host__ __device__ unsigned int operator()(const unsigned int& idx) const
+        {
+        const unsigned int cell = idx / cli.getW();
+        const unsigned int offset = idx - (cell * cli.getW());
+        return cli(offset, cell_order[cell]);
+        }
+
+    const unsigned int* cell_order; //!< Cells in the order they are traversed
+    Index2D cli;                    //!< Two-dimensional cell-list indexer
+    };
+
+/*!
+ * \param d_order Compacted MPCD particle indexes in cell-list order (output)
+ * \param d_cell_list Cell list array to compact
+ * \param d_cell_order Cells in the order they are traversed
+ * \param cli Two-dimensional cell-list indexer
+ * \param N_mpcd Number of MPCD particles
+ *
+ * \returns Number of items selected (should be equal to N_mpcd).
+ *
+ * \b Implementation
+ * This is the same compaction as mpcd::gpu::sort_cell_compact, but the cell list is read through
+ * a permutation iterator so that the cells are visited in the order given by \a d_cell_order.
+ */
+unsigned int sort_cell_compact(unsigned int* d_order,
+                               const unsigned int* d_cell_list,
+                               const unsigned int* d_cell_order,
+                               const Index2D& cli,
+                               const unsigned int N_mpcd)
+    {
+    auto entries = thrust::make_transform_iterator(thrust::counting_iterator<unsigned int>(0),
+                                                   CellOrderEntry(d_cell_order, cli));
+    auto cell_list = thrust::make_permutation_iterator(d_cell_list, entries);
+    unsigned int* last = thrust::copy_if(thrust::device,
+                                         cell_list,
+                                         cell_list + cli.getNumElements(),
+                                         d_order,
+                                         LessThan(N_mpcd));
+    return (unsigned int)(last - d_order);
+    }
+
+//! Functor to check if a particle is in a different cell than the preceding particle
+struct CellChanged
+    {
+    //! Constructor
+    /*!
+     * \param vel_ Particle velocities, with the cell cached in the last element
+     */
+    __host__ __device__ CellChanged(const SolventScalar4* vel_) : vel(vel_) { }
+
+    //! Check if the cell changed
+    /*!
+     * \param idx Particle index, which must be at least 1
+     * \returns True if particle \a idx is in a different cell than particle \a idx - 1
+     */
+    __host__ __device__ bool operator()(const unsigned int& idx) const
+        {
+        return (__solvent_scalar_as_int(vel[idx].w) != __solvent_scalar_as_int(vel[idx - 1].w));
+        }
+
+    const SolventScalar4* vel; //!< Particle velocities
+    };
+
+/*!
+ * \param d_vel Particle velocities, with the cell cached in the last element
+ * \param N Number of particles
+ *
+ * \returns Number of particles in a different cell than the preceding particle
+ */
+unsigned int sort_count_disordered(const SolventScalar4* d_vel, const unsigned int N)
+    {
+    if (N < 2)
+        return 0;
+
+    return (unsigned int)thrust::count_if(thrust::device,
+                                          thrust::counting_iterator<unsigned int>(1),
+                                          thrust::counting_iterator<unsigned int>(N),
+                                          CellChanged(d_vel));
+    }
+
 /*!
  * \param d_rorder Map of old particle indexes onto new particle indexes (output)
  * \param d_order Map of new particle indexes onto old particle indexes
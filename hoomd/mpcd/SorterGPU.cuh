@@ -11,6 +11,7 @@
 
 #include <cuda_runtime.h>
 
+#include "ParticleDataUtilities.h"
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/Index1D.h"
 
@@ -21,11 +22,11 @@ namespace mpcd
 namespace gpu
     {
 //! Kernel driver to apply sorted particle order
-cudaError_t sort_apply(Scalar4* d_pos_alt,
-                       Scalar4* d_vel_alt,
+cudaError_t sort_apply(SolventScalar4* d_pos_alt,
+                       SolventScalar4* d_vel_alt,
                        unsigned int* d_tag_alt,
-                       const Scalar4* d_pos,
-                       const Scalar4* d_vel,
+                       const SolventScalar4* d_pos,
+                       const SolventScalar4* d_vel,
                        const unsigned int* d_tag,
                        const unsigned int* d_order,
                        const unsigned int N,
@@ -44,6 +45,16 @@ unsigned int sort_cell_compact(unsigned int* d_order,
                                const unsigned int num_items,
                                const unsigned int N_mpcd);
 
+//! Driver for thrust to perform cell-list stream compaction in a given cell order
+unsigned int sort_cell_compact(unsigned int* d_order,
+                               const unsigned int* d_cell_list,
+                               const unsigned int* d_cell_order,
+                               const Index2D& cli,
+                               const unsigned int N_mpcd);
+
+//! Driver for thrust to count particles in a different cell than the preceding particle
+unsigned int sort_count_disordered(const SolventScalar4* d_vel, const unsigned int N);
+
 //! Kernel driver to reverse map the particle ordering
 cudaError_t sort_gen_reverse(unsigned int* d_rorder,
                              const unsigned int* d_order,
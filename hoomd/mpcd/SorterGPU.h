@@ -48,6 +48,9 @@ class PYBIND11_EXPORT SorterGPU : public mpcd::Sorter
 
     //! Apply the sorting order on the GPU
     virtual void applyOrder() const;
+
+    //! Count the MPCD particles in a different cell than the preceding particle on the GPU
+    virtual unsigned int countDisordered();
     };
 
 namespace detail
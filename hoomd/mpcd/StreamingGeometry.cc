@@ -7,6 +7,7 @@
  */
 
 #include "StreamingGeometry.h"
+#include "SignedDistanceField.h"
 
 namespace hoomd
     {
@@ -45,6 +46,50 @@ void export_SlitPoreGeometry(pybind11::module& m)
         .def("getBoundaryCondition", &SlitPoreGeometry::getBoundaryCondition);
     }
 
+void export_CosineChannel(pybind11::module& m)
+    {
+    pybind11::class_<CosineChannel, std::shared_ptr<CosineChannel>>(m, "CosineChannel")
+        .def(pybind11::init<Scalar, Scalar, Scalar, unsigned int, boundary>())
+        .def("getAmplitude", &CosineChannel::getAmplitude)
+        .def("getH", &CosineChannel::getH)
+        .def("getRepetitions", &CosineChannel::getRepetitions)
+        .def("getBoundaryCondition", &CosineChannel::getBoundaryCondition)
+        .def("getPhase", &CosineChannel::getPhase)
+        .def("getPhaseVelocity", &CosineChannel::getPhaseVelocity)
+        .def("getVelocity", &CosineChannel::getVelocity);
+    }
+
+void export_CosineExpansionContraction(pybind11::module& m)
+    {
+    pybind11::class_<CosineExpansionContraction, std::shared_ptr<CosineExpansionContraction>>(
+        m,
+        "CosineExpansionContraction")
+        .def(pybind11::init<Scalar, Scalar, Scalar, unsigned int, boundary>())
+        .def("getHwide", &CosineExpansionContraction::getHwide)
+        .def("getHnarrow", &CosineExpansionContraction::getHnarrow)
+        .def("getRepetitions", &CosineExpansionContraction::getRepetitions)
+        .def("getBoundaryCondition", &CosineExpansionContraction::getBoundaryCondition)
+        .def("getPhase", &CosineExpansionContraction::getPhase)
+        .def("getPhaseVelocity", &CosineExpansionContraction::getPhaseVelocity)
+        .def("getVelocity", &CosineExpansionContraction::getVelocity);
+    }
+
+/*!
+ * The geometry points into the values of the signed distance field, so the field is kept alive
+ * for as long as the geometry.
+ */
+void export_SDFGeometry(pybind11::module& m)
+    {
+    pybind11::class_<SDFGeometry, std::shared_ptr<SDFGeometry>>(m, "SDFGeometry")
+        .def(pybind11::init(
+                 [](std::shared_ptr<const mpcd::SignedDistanceField> field, boundary bc)
+                 { return std::make_shared<SDFGeometry>(field->makeGeometry(bc)); }),
+             pybind11::keep_alive<1, 2>())
+        .def("getDimensions", &SDFGeometry::getDimensions)
+        .def("getL", &SDFGeometry::getL)
+        .def("getBoundaryCondition", &SDFGeometry::getBoundaryCondition);
+    }
+
     } // end namespace detail
     } // end namespace mpcd
     } // end namespace hoomd
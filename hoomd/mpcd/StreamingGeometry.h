@@ -11,9 +11,25 @@
 
 #include "BoundaryCondition.h"
 #include "BulkGeometry.h"
+#include "CompositeGeometry.h"
+#include "CosineChannelGeometry.h"
+#include "CosineExpansionContractionGeometry.h"
+#include "SDFGeometry.h"
 #include "SlitGeometry.h"
 #include "SlitPoreGeometry.h"
 
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace detail
+    {
+//! Cosine channel with a slit pore constriction
+typedef CompositeGeometry<CosineChannel, SlitPoreGeometry> CosineChannelPore;
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+
 #ifndef __HIPCC__
 #include <pybind11/pybind11.h>
 
@@ -35,6 +51,25 @@ void export_SlitGeometry(pybind11::module& m);
 //! Export SlitPoreGeometry to python
 void export_SlitPoreGeometry(pybind11::module& m);
 
+//! Export CosineChannel to python
+void export_CosineChannel(pybind11::module& m);
+
+//! Export CosineExpansionContraction to python
+void export_CosineExpansionContraction(pybind11::module& m);
+
+//! Export SDFGeometry to python
+void export_SDFGeometry(pybind11::module& m);
+
+//! Export a CompositeGeometry to python
+template<class First, class Second> void export_CompositeGeometry(pybind11::module& m)
+    {
+    typedef CompositeGeometry<First, Second> Geometry;
+    pybind11::class_<Geometry, std::shared_ptr<Geometry>>(m, Geometry::getName().c_str())
+        .def(pybind11::init<const First&, const Second&>())
+        .def("getFirst", &Geometry::getFirst)
+        .def("getSecond", &Geometry::getSecond);
+    }
+
     } // end namespace detail
     } // end namespace mpcd
     } // end namespace hoomd
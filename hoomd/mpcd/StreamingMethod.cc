@@ -7,6 +7,7 @@
  */
 
 #include "StreamingMethod.h"
+#include "CollisionStatistics.h"
 
 namespace hoomd
     {
@@ -125,4 +126,18 @@ void mpcd::detail::export_StreamingMethod(pybind11::module& m)
         .def("removeField", &mpcd::StreamingMethod::removeField);
     }
 
+/*!
+ * \param m Python module to export to
+ */
+void mpcd::detail::export_CollisionStatistics(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::detail::CollisionStatistics>(m, "CollisionStatistics")
+        .def(pybind11::init<>())
+        .def_readonly("collisions", &mpcd::detail::CollisionStatistics::collisions)
+        .def_readonly("multiple", &mpcd::detail::CollisionStatistics::multiple)
+        .def_readonly("iterations", &mpcd::detail::CollisionStatistics::iterations)
+        .def_readonly("fallbacks", &mpcd::detail::CollisionStatistics::fallbacks)
+        .def_readonly("unconverged", &mpcd::detail::CollisionStatistics::unconverged);
+    }
+
     } // end namespace hoomd
@@ -25,6 +25,8 @@ namespace hoomd
     {
 namespace mpcd
     {
+class CellThermoCompute;
+
 //! MPCD streaming method
 /*!
  * This method implements the base version of ballistic propagation of MPCD
@@ -44,6 +46,20 @@ class PYBIND11_EXPORT StreamingMethod : public Autotuned
     //! Implementation of the streaming rule
     virtual void stream(uint64_t timestep) { }
 
+    //! Stream the particles and accumulate their cell properties for the next collision
+    /*!
+     * \param timestep Current timestep
+     * \param thermo Cell thermo compute to accumulate into
+     * \returns True if the particles were streamed, false if they still need to be streamed
+     *
+     * The base class does not support accumulating the cell properties, so the particles are
+     * not streamed.
+     */
+    virtual bool streamFused(uint64_t timestep, std::shared_ptr<mpcd::CellThermoCompute> thermo)
+        {
+        return false;
+        }
+
     //! Peek if the next step requires streaming
     virtual bool peekStream(uint64_t timestep) const;
 
@@ -81,6 +97,12 @@ class PYBIND11_EXPORT StreamingMethod : public Autotuned
     //! Set the period of the streaming method
     void setPeriod(unsigned int cur_timestep, unsigned int period);
 
+    //! Get the period of the streaming method
+    unsigned int getPeriod() const
+        {
+        return m_period;
+        }
+
     //! Set the cell list used for collisions
     virtual void setCellList(std::shared_ptr<mpcd::CellList> cl)
         {
@@ -108,6 +130,9 @@ namespace detail
     {
 //! Export mpcd::StreamingMethod to python
 void export_StreamingMethod(pybind11::module& m);
+
+//! Export mpcd::detail::CollisionStatistics to python
+void export_CollisionStatistics(pybind11::module& m);
     } // end namespace detail
     } // end namespace mpcd
     } // end namespace hoomd
@@ -7,6 +7,12 @@
  */
 
 #include "VirtualParticleFiller.h"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+
+#ifdef ENABLE_HIP
+#include "VirtualParticleFiller.cuh"
+#endif // ENABLE_HIP
 
 namespace hoomd
     {
@@ -16,8 +22,19 @@ mpcd::VirtualParticleFiller::VirtualParticleFiller(std::shared_ptr<SystemDefinit
                                                    std::shared_ptr<Variant> T)
     : m_sysdef(sysdef), m_pdata(m_sysdef->getParticleData()), m_exec_conf(m_pdata->getExecConf()),
       m_mpcd_pdata(m_sysdef->getMPCDParticleData()), m_density(density), m_type(type), m_T(T),
-      m_N_fill(0), m_first_tag(0)
+      m_N_fill(0), m_first_tag(0), m_reuse_positions(false), m_reservoir_valid(false),
+      m_reservoir_pos(m_exec_conf), m_reservoir_vel(m_exec_conf), m_reservoir_cell_size(0),
+      m_reservoir_max_shift(0)
     {
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        m_reservoir_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                                 m_exec_conf,
+                                                 "mpcd_virtual_particle_reservoir"));
+        m_autotuners.push_back(m_reservoir_tuner);
+        }
+#endif // ENABLE_HIP
     }
 
 void mpcd::VirtualParticleFiller::fill(uint64_t timestep)
@@ -51,8 +68,17 @@ void mpcd::VirtualParticleFiller::fill(uint64_t timestep)
     // add the new virtual particles locally
     m_mpcd_pdata->addVirtualParticles(m_N_fill);
 
-    // draw the particles consistent with those tags
-    drawParticles(timestep);
+    // draw the particles consistent with those tags, reusing the saved positions if possible
+    if (m_reuse_positions && checkReservoir())
+        {
+        drawReservoirParticles(timestep);
+        }
+    else
+        {
+        drawParticles(timestep);
+        if (m_reuse_positions)
+            saveReservoir();
+        }
 
     m_mpcd_pdata->invalidateCellCache();
     }
@@ -65,6 +91,7 @@ void mpcd::VirtualParticleFiller::setDensity(Scalar density)
         throw std::runtime_error("Invalid virtual particle density");
         }
     m_density = density;
+    invalidateReservoir();
     }
 
 void mpcd::VirtualParticleFiller::setType(unsigned int type)
@@ -76,6 +103,166 @@ void mpcd::VirtualParticleFiller::setType(unsigned int type)
         throw std::runtime_error("Invalid type id");
         }
     m_type = type;
+    invalidateReservoir();
+    }
+
+/*!
+ * \returns True if the saved positions were drawn for the current fill
+ *
+ * The saved positions are only valid if they were drawn for the same number of particles, local
+ * box, and cell list. Changes to the filler parameters are flagged by invalidateReservoir().
+ */
+bool mpcd::VirtualParticleFiller::checkReservoir() const
+    {
+    return m_reservoir_valid && m_reservoir_pos.size() == m_N_fill
+           && m_reservoir_box == m_pdata->getBox()
+           && m_reservoir_cell_size == m_cl->getCellSize()
+           && m_reservoir_max_shift == m_cl->getMaxGridShift();
+    }
+
+/*!
+ * The positions of the last \a m_N_fill virtual particles, which were just drawn, are copied
+ * into the reservoir along with their mean velocities. This is done on the host, even on the GPU,
+ * because the positions are only saved when the reservoir needs to be redrawn.
+ */
+void mpcd::VirtualParticleFiller::saveReservoir()
+    {
+    m_reservoir_pos.resize(m_N_fill);
+    m_reservoir_vel.resize(m_N_fill);
+    const unsigned int first_idx = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual() - m_N_fill;
+
+        {
+        ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                          access_location::host,
+                                          access_mode::read);
+        ArrayHandle<SolventScalar4> h_reservoir_pos(m_reservoir_pos,
+                                                    access_location::host,
+                                                    access_mode::overwrite);
+        ArrayHandle<Scalar3> h_reservoir_vel(m_reservoir_vel,
+                                             access_location::host,
+                                             access_mode::overwrite);
+        for (unsigned int i = 0; i < m_N_fill; ++i)
+            {
+            const SolventScalar4 pos = h_pos.data[first_idx + i];
+            h_reservoir_pos.data[i] = pos;
+            h_reservoir_vel.data[i] = getMeanVelocity(pos);
+            }
+        }
+
+    m_reservoir_box = m_pdata->getBox();
+    m_reservoir_cell_size = m_cl->getCellSize();
+    m_reservoir_max_shift = m_cl->getMaxGridShift();
+    m_reservoir_valid = true;
+    }
+
+/*!
+ * \param timestep Current timestep to draw particles
+ *
+ * The saved positions are copied into the particle data, and new tags and velocities are assigned.
+ * The velocities are drawn from a normal distribution consistent with the temperature around the
+ * saved mean velocities. On the CPU, the particles are also binned into the cell list.
+ */
+void mpcd::VirtualParticleFiller::drawReservoirParticles(uint64_t timestep)
+    {
+    const unsigned int first_idx = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual() - m_N_fill;
+    const uint16_t seed = m_sysdef->getSeed();
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        ArrayHandle<SolventScalar4> d_pos(m_mpcd_pdata->getPositions(),
+                                          access_location::device,
+                                          access_mode::readwrite);
+        ArrayHandle<SolventScalar4> d_vel(m_mpcd_pdata->getVelocities(),
+                                          access_location::device,
+                                          access_mode::readwrite);
+        ArrayHandle<unsigned int> d_tag(m_mpcd_pdata->getTags(),
+                                        access_location::device,
+                                        access_mode::readwrite);
+        ArrayHandle<SolventScalar4> d_reservoir_pos(m_reservoir_pos,
+                                                    access_location::device,
+                                                    access_mode::read);
+        ArrayHandle<Scalar3> d_reservoir_vel(m_reservoir_vel,
+                                             access_location::device,
+                                             access_mode::read);
+
+        m_reservoir_tuner->begin();
+        mpcd::gpu::draw_reservoir_particles(d_pos.data,
+                                            d_vel.data,
+                                            d_tag.data,
+                                            d_reservoir_pos.data,
+                                            d_reservoir_vel.data,
+                                            m_mpcd_pdata->getMass(),
+                                            m_N_fill,
+                                            m_first_tag,
+                                            first_idx,
+                                            (*m_T)(timestep),
+                                            timestep,
+                                            seed,
+                                            m_reservoir_tuner->getParam()[0]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_reservoir_tuner->end();
+        }
+    else
+#endif // ENABLE_HIP
+        {
+        ArrayHandle<SolventScalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                          access_location::host,
+                                          access_mode::readwrite);
+        ArrayHandle<SolventScalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                          access_location::host,
+                                          access_mode::readwrite);
+        ArrayHandle<unsigned int> h_tag(m_mpcd_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::readwrite);
+        ArrayHandle<SolventScalar4> h_reservoir_pos(m_reservoir_pos,
+                                                    access_location::host,
+                                                    access_mode::read);
+        ArrayHandle<Scalar3> h_reservoir_vel(m_reservoir_vel,
+                                             access_location::host,
+                                             access_mode::read);
+
+        // bin the particles while they are copied if the cell list is ready
+        const bool bin = canBinParticles();
+        const uint3 n_global_cells = bin ? m_cl->getNumGlobalCells() : make_uint3(0, 0, 0);
+        const Scalar3 global_lo = m_pdata->getGlobalBox().getLo();
+        const uchar3 periodic = m_pdata->getBox().getPeriodic();
+
+        const Scalar vel_factor = fast::sqrt((*m_T)(timestep) / m_mpcd_pdata->getMass());
+        for (unsigned int i = 0; i < m_N_fill; ++i)
+            {
+            const unsigned int tag = m_first_tag + i;
+            const unsigned int pidx = first_idx + i;
+            h_tag.data[pidx] = tag;
+            h_pos.data[pidx] = h_reservoir_pos.data[i];
+
+            hoomd::RandomGenerator rng(
+                hoomd::Seed(hoomd::RNGIdentifier::VirtualParticleFiller, timestep, seed),
+                hoomd::Counter(tag));
+            hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
+            Scalar3 vel;
+            gen(vel.x, vel.y, rng);
+            vel.z = gen(rng);
+            vel += h_reservoir_vel.data[i];
+
+            const SolventScalar4 pos = h_reservoir_pos.data[i];
+            unsigned int cell = mpcd::detail::NO_CELL;
+            if (bin
+                && !m_cl->binParticle(cell,
+                                      make_scalar3(pos.x, pos.y, pos.z),
+                                      n_global_cells,
+                                      global_lo,
+                                      periodic))
+                {
+                cell = mpcd::detail::NO_CELL;
+                }
+            h_vel.data[pidx]
+                = make_solvent_scalar4(vel.x, vel.y, vel.z, __int_as_solvent_scalar(cell));
+            }
+
+        if (bin)
+            m_cl->validateVirtualCells();
+        }
     }
 
 /*!
@@ -92,7 +279,10 @@ void mpcd::detail::export_VirtualParticleFiller(pybind11::module& m)
                             std::shared_ptr<Variant>>())
         .def("setDensity", &mpcd::VirtualParticleFiller::setDensity)
         .def("setType", &mpcd::VirtualParticleFiller::setType)
-        .def("setTemperature", &mpcd::VirtualParticleFiller::setTemperature);
+        .def("setTemperature", &mpcd::VirtualParticleFiller::setTemperature)
+        .def_property("reuse_positions",
+                      &mpcd::VirtualParticleFiller::getReusePositions,
+                      &mpcd::VirtualParticleFiller::setReusePositions);
     }
 
     } // end namespace hoomd
@@ -0,0 +1,138 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/VirtualParticleFiller.cu
+ * \brief Defines GPU functions and kernels used by mpcd::VirtualParticleFiller
+ */
+
+#include "ParticleDataUtilities.h"
+#include "VirtualParticleFiller.cuh"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace gpu
+    {
+namespace kernel
+    {
+/*!
+ * \param d_pos Particle positions
+ * \param d_vel Particle velocities
+ * \param d_tag Particle tags
+ * \param d_reservoir_pos Saved positions of the virtual particles
+ * \param d_reservoir_vel Mean velocities at the saved positions
+ * \param N_fill Number of particles to fill
+ * \param first_tag First tag of filled particles
+ * \param first_idx First (local) particle index of filled particles
+ * \param vel_factor Scale factor for uniform normal velocities consistent with particle mass /
+ * temperature
+ * \param timestep Current timestep
+ * \param seed User seed to PRNG for drawing velocities
+ *
+ * \b Implementation:
+ *
+ * Using one thread per particle, the saved position is copied into the particle data and a new
+ * velocity is drawn for the particle's tag around the saved mean velocity.
+ */
+__global__ void draw_reservoir_particles(SolventScalar4* d_pos,
+                                         SolventScalar4* d_vel,
+                                         unsigned int* d_tag,
+                                         const SolventScalar4* d_reservoir_pos,
+                                         const Scalar3* d_reservoir_vel,
+                                         const unsigned int N_fill,
+                                         const unsigned int first_tag,
+                                         const unsigned int first_idx,
+                                         const Scalar vel_factor,
+                                         const uint64_t timestep,
+                                         const uint16_t seed)
+    {
+    // one thread per particle
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N_fill)
+        return;
+
+    // particle tag and index
+    const unsigned int tag = first_tag + idx;
+    const unsigned int pidx = first_idx + idx;
+    d_tag[pidx] = tag;
+    d_pos[pidx] = d_reservoir_pos[idx];
+
+    hoomd::RandomGenerator rng(
+        hoomd::Seed(hoomd::RNGIdentifier::VirtualParticleFiller, timestep, seed),
+        hoomd::Counter(tag));
+    hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
+    Scalar3 vel;
+    gen(vel.x, vel.y, rng);
+    vel.z = gen(rng);
+    vel += d_reservoir_vel[idx];
+    d_vel[pidx]
+        = make_solvent_scalar4(vel.x, vel.y, vel.z, __int_as_solvent_scalar(mpcd::detail::NO_CELL));
+    }
+    } // end namespace kernel
+
+/*!
+ * \param d_pos Particle positions
+ * \param d_vel Particle velocities
+ * \param d_tag Particle tags
+ * \param d_reservoir_pos Saved positions of the virtual particles
+ * \param d_reservoir_vel Mean velocities at the saved positions
+ * \param mass Mass of fill particles
+ * \param N_fill Number of particles to fill
+ * \param first_tag First tag of filled particles
+ * \param first_idx First (local) particle index of filled particles
+ * \param kT Temperature for fill particles
+ * \param timestep Current timestep
+ * \param seed User seed to PRNG for drawing velocities
+ * \param block_size Number of threads per block
+ *
+ * \sa kernel::draw_reservoir_particles
+ */
+cudaError_t draw_reservoir_particles(SolventScalar4* d_pos,
+                                     SolventScalar4* d_vel,
+                                     unsigned int* d_tag,
+                                     const SolventScalar4* d_reservoir_pos,
+                                     const Scalar3* d_reservoir_vel,
+                                     const Scalar mass,
+                                     const unsigned int N_fill,
+                                     const unsigned int first_tag,
+                                     const unsigned int first_idx,
+                                     const Scalar kT,
+                                     const uint64_t timestep,
+                                     const uint16_t seed,
+                                     const unsigned int block_size)
+    {
+    if (N_fill == 0)
+        return cudaSuccess;
+
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)kernel::draw_reservoir_particles);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    // precompute factor for rescaling the velocities since it is the same for all particles
+    const Scalar vel_factor = fast::sqrt(kT / mass);
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid(N_fill / run_block_size + 1);
+    kernel::draw_reservoir_particles<<<grid, run_block_size>>>(d_pos,
+                                                               d_vel,
+                                                               d_tag,
+                                                               d_reservoir_pos,
+                                                               d_reservoir_vel,
+                                                               N_fill,
+                                                               first_tag,
+                                                               first_idx,
+                                                               vel_factor,
+                                                               timestep,
+                                                               seed);
+
+    return cudaSuccess;
+    }
+
+    } // end namespace gpu
+    } // end namespace mpcd
+    } // end namespace hoomd
@@ -0,0 +1,41 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef MPCD_VIRTUAL_PARTICLE_FILLER_CUH_
+#define MPCD_VIRTUAL_PARTICLE_FILLER_CUH_
+
+/*!
+ * \file mpcd/VirtualParticleFiller.cuh
+ * \brief Declaration of CUDA kernels for mpcd::VirtualParticleFiller
+ */
+
+#include <cuda_runtime.h>
+
+#include "ParticleDataUtilities.h"
+#include "hoomd/HOOMDMath.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace gpu
+    {
+//! Draw virtual particles from the reservoir of saved positions
+cudaError_t draw_reservoir_particles(SolventScalar4* d_pos,
+                                     SolventScalar4* d_vel,
+                                     unsigned int* d_tag,
+                                     const SolventScalar4* d_reservoir_pos,
+                                     const Scalar3* d_reservoir_vel,
+                                     const Scalar mass,
+                                     const unsigned int N_fill,
+                                     const unsigned int first_tag,
+                                     const unsigned int first_idx,
+                                     const Scalar kT,
+                                     const uint64_t timestep,
+                                     const uint16_t seed,
+                                     const unsigned int block_size);
+
+    } // end namespace gpu
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_VIRTUAL_PARTICLE_FILLER_CUH_
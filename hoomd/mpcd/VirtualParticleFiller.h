@@ -16,6 +16,7 @@
 #include "CellList.h"
 
 #include "hoomd/Autotuned.h"
+#include "hoomd/GPUVector.h"
 #include "hoomd/SystemDefinition.h"
 #include "hoomd/Variant.h"
 #include <pybind11/pybind11.h>
@@ -33,6 +34,18 @@ namespace mpcd
  * class must then implement two methods:
  *  1. computeNumFill(), which is the number of virtual particles to add.
  *  2. drawParticles(), which is the rule to determine where to put the particles.
+ *
+ * The filler can optionally reuse the positions of the virtual particles. The positions drawn by
+ * drawParticles() are saved, and on later fills they are copied back into the particle data and
+ * only new velocities are drawn. The saved positions are redrawn whenever the number of particles
+ * to fill, the local box, the cell list, or any of the filler's parameters change. Reusing the
+ * positions is an approximation because the virtual particles no longer decorrelate between
+ * collisions, but the random grid shift still changes the cells they are binned into.
+ *
+ * On the CPU, a filler can also bin the particles into the cell list while it draws them, which
+ * saves the cell list from reading their positions back and binning them again. The local cell
+ * of each particle is written into its velocity, see mpcd::CellList::validateVirtualCells().
+ * Particles drawn from the saved positions are always binned this way.
  */
 class PYBIND11_EXPORT VirtualParticleFiller : public Autotuned
     {
@@ -63,6 +76,20 @@ class PYBIND11_EXPORT VirtualParticleFiller : public Autotuned
     virtual void setCellList(std::shared_ptr<mpcd::CellList> cl)
         {
         m_cl = cl;
+        invalidateReservoir();
+        }
+
+    //! Get whether the virtual particle positions are reused
+    bool getReusePositions() const
+        {
+        return m_reuse_positions;
+        }
+
+    //! Set whether the virtual particle positions are reused
+    void setReusePositions(bool reuse_positions)
+        {
+        m_reuse_positions = reuse_positions;
+        invalidateReservoir();
         }
 
     protected:
@@ -79,6 +106,57 @@ class PYBIND11_EXPORT VirtualParticleFiller : public Autotuned
     unsigned int m_N_fill;    //!< Number of particles to fill locally
     unsigned int m_first_tag; //!< First tag of locally held particles
 
+    bool m_reuse_positions;                    //!< If true, reuse saved virtual particle positions
+    bool m_reservoir_valid;                    //!< If true, the saved positions can be reused
+    GPUVector<SolventScalar4> m_reservoir_pos; //!< Saved virtual particle positions
+    GPUVector<Scalar3> m_reservoir_vel;        //!< Mean velocities at the saved positions
+    BoxDim m_reservoir_box;                    //!< Local box when the positions were saved
+    Scalar m_reservoir_cell_size;              //!< Cell size when the positions were saved
+    Scalar m_reservoir_max_shift;              //!< Maximum grid shift when positions were saved
+
+    //! Mark the saved positions as needing to be redrawn
+    void invalidateReservoir()
+        {
+        m_reservoir_valid = false;
+        }
+
+    //! Get the mean velocity of a virtual particle at a position
+    /*!
+     * \param pos Position of the virtual particle
+     * \returns Mean velocity that the thermal velocity is drawn around
+     *
+     * Deriving classes that draw velocities around a nonzero mean must override this method so
+     * that the saved positions are given the same mean.
+     */
+    virtual Scalar3 getMeanVelocity(const SolventScalar4& pos) const
+        {
+        return make_scalar3(0, 0, 0);
+        }
+
+    //! Check if the saved positions can be reused
+    bool checkReservoir() const;
+
+    //! Check if the particles can be binned into the cell list while they are drawn
+    /*!
+     * The grid shift is set before the fillers are called, but the dimensions of the cell list
+     * may still need to be computed, e.g., after the box changes. The particles are then left for
+     * the cell list to bin.
+     */
+    bool canBinParticles() const
+        {
+        return !m_cl->needsComputeDimensions();
+        }
+
+    //! Save the positions of the particles that were just drawn
+    void saveReservoir();
+
+    //! Draw particles from the saved positions
+    void drawReservoirParticles(uint64_t timestep);
+
+#ifdef ENABLE_HIP
+    std::shared_ptr<hoomd::Autotuner<1>> m_reservoir_tuner; //!< Tuner for drawing saved particles
+#endif // ENABLE_HIP
+
     //! Compute the total number of particles to fill
     virtual void computeNumFill() { }
 
@@ -0,0 +1,94 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/WallMotion.h
+ * \brief Declaration of mpcd::WallMotion
+ */
+
+#ifndef MPCD_WALL_MOTION_H_
+#define MPCD_WALL_MOTION_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "hoomd/HOOMDMath.h"
+#include <pybind11/pybind11.h>
+
+#include <memory>
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Moves the walls of a streaming geometry over time
+/*!
+ * \tparam Geometry The confining geometry (e.g., CosineChannel).
+ *
+ * The WallMotion owns a copy of the geometry and changes its parameters in place as the
+ * simulation advances. The streaming method and the virtual particle fillers that share this
+ * geometry hence follow the same walls without creating a new geometry, and without validating
+ * the particles against it, each time the walls move. The geometry is a small object that is
+ * passed to the GPU kernels by value, so the current parameters are used on the device as well.
+ *
+ * Deriving classes must implement update() to set the parameters of the geometry at a timestep.
+ * Each change to the parameters increments the version so that users of the geometry can tell
+ * when cached quantities (e.g., the volume to fill) need to be recomputed.
+ */
+template<class Geometry> class PYBIND11_EXPORT WallMotion
+    {
+    public:
+    //! Constructor
+    /*!
+     * \param geom Geometry to copy and move
+     */
+    WallMotion(std::shared_ptr<const Geometry> geom)
+        : m_geom(std::make_shared<Geometry>(*geom)), m_version(0)
+        {
+        }
+
+    virtual ~WallMotion() { }
+
+    //! Move the walls to a timestep
+    /*!
+     * \param timestep Timestep to move the walls to
+     * \param dt Time elapsed since the last timestep the walls were moved to
+     */
+    virtual void update(uint64_t timestep, Scalar dt) = 0;
+
+    //! Get the moving geometry
+    std::shared_ptr<const Geometry> getGeometry() const
+        {
+        return m_geom;
+        }
+
+    //! Get the number of times the walls have moved
+    unsigned int getVersion() const
+        {
+        return m_version;
+        }
+
+    protected:
+    std::shared_ptr<Geometry> m_geom; //!< Moving geometry
+    unsigned int m_version;           //!< Number of times the walls have moved
+    };
+
+namespace detail
+    {
+//! Export mpcd::WallMotion to python
+/*!
+ * \param m Python module to export to
+ */
+template<class Geometry> void export_WallMotion(pybind11::module& m)
+    {
+    const std::string name = "WallMotion" + Geometry::getName();
+    pybind11::class_<mpcd::WallMotion<Geometry>, std::shared_ptr<mpcd::WallMotion<Geometry>>>(
+        m,
+        name.c_str())
+        .def_property_readonly("geometry", &mpcd::WallMotion<Geometry>::getGeometry);
+    }
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_WALL_MOTION_H_
@@ -97,8 +97,10 @@ from hoomd import _hoomd
 from hoomd.md import _md
 
 from hoomd.mpcd import collide
+from hoomd.mpcd import external
 from hoomd.mpcd import force
 from hoomd.mpcd import integrate
+from hoomd.mpcd import local_access
 from hoomd.mpcd import stream
 from hoomd.mpcd import update
 
@@ -170,17 +172,29 @@ class integrator():
 
     _aniso_modes = {}
 
-    def set_params(self, dt=None, aniso=None):
+    def set_params(self, dt=None, aniso=None, fused_stream_collide=None):
         """ Changes parameters of an existing integration mode.
 
         Args:
             dt (float): New time step delta (if set) (in time units).
             aniso (bool): Anisotropic integration mode (bool), default None (autodetect).
+            fused_stream_collide (bool): If True, fuse the streaming and collision
+                steps when possible (default False).
+
+        When *fused_stream_collide* is True, the streaming method bins the MPCD
+        particles into the cells of the next collision and accumulates the cell
+        properties while it streams them, which saves passes over the particle
+        data. This is currently supported on the GPU for the
+        :py:class:`~hoomd.mpcd.collide.srd` collision method without embedded
+        particles in simulations that are not domain decomposed. The regular
+        steps are used when it is not supported, so the results are the same
+        up to floating-point round-off.
 
         Examples::
 
             integrator.set_params(dt=0.007)
             integrator.set_params(dt=0.005, aniso=False)
+            integrator.set_params(fused_stream_collide=True)
 
         """
         self.check_initialization()
@@ -190,6 +204,9 @@ class integrator():
             self.dt = dt
             self.cpp_integrator.setDeltaT(dt)
 
+        if fused_stream_collide is not None:
+            self.cpp_integrator.fused_stream_collide = fused_stream_collide
+
         if aniso is not None:
             if aniso in self._aniso_modes:
                 anisoMode = self._aniso_modes[aniso]
@@ -218,6 +235,7 @@ class integrator():
         if stream is not None:
             self.cpp_integrator.setStreamingMethod(stream._cpp)
             if stream._filler is not None:
+                stream._filler.reuse_positions = stream.reuse_filler_positions
                 self.cpp_integrator.addFiller(stream._filler)
         else:
             hoomd.context.current.device.cpp_msg.warning(
@@ -0,0 +1,187 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+r"""MD forces from the walls of the MPCD geometries.
+
+The forces in this module act on the MD particles with the walls of an MPCD
+streaming geometry, so that a solute embedded in the solvent is confined by the
+same surfaces that the solvent bounces back from. They replace a layer of wall
+particles interacting with the solute through pair forces, which needs many
+extra particles and neighbors.
+
+The walls are described by the same parameters as the matching geometry in
+:py:mod:`.mpcd.stream`. The wavenumber of the walls is computed from the length
+of the simulation box in *x* when the force is attached.
+"""
+
+import hoomd
+from hoomd.md.external.field import Field
+from hoomd.data.typeparam import TypeParameter
+from hoomd.data.parameterdicts import TypeParameterDict
+from hoomd.mpcd import _mpcd
+
+
+class _CosineWall(Field):
+    r"""Base class for the Weeks-Chandler-Andersen force from cosine walls.
+
+    Warning:
+        This class should not be instantiated by users. The class can be used
+        for `isinstance` or `issubclass` checks.
+    """
+    _cpp_class_name = "PotentialExternalCosineWall"
+
+    def __init__(self):
+        params = TypeParameter(
+            'params', 'particle_types',
+            TypeParameterDict(epsilon=float, sigma=float, len_keys=1))
+        self._add_typeparam(params)
+
+    def _attach_hook(self):
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            cls = getattr(_mpcd, self._cpp_class_name)
+        else:
+            cls = getattr(_mpcd, self._cpp_class_name + "GPU")
+
+        self._cpp_obj = cls(self._simulation.state._cpp_sys_def)
+        Lx = self._simulation.state.box.Lx
+        self._cpp_obj.setGeometry(self._make_geometry(Lx))
+
+
+class CosineChannel(_CosineWall):
+    r"""Weeks-Chandler-Andersen force from the walls of a cosine channel.
+
+    Args:
+        A (float): Amplitude of the cosine walls :math:`[\mathrm{length}]`.
+        h (float): Channel half-width :math:`[\mathrm{length}]`.
+        p (int): Number of repetitions of the cosine in the box.
+
+    `CosineChannel` computes forces and energies on the particles inside the
+    channel bounded by the walls
+
+    .. math::
+
+        z_{\pm}(x) = A \cos\left(\frac{2 \pi p x}{L_x}\right) \pm h
+
+    of :py:class:`.mpcd.stream.cosine_channel`. Each particle interacts with
+    each wall through
+
+    .. math::
+
+        U(r) = 4 \varepsilon \left[ \left( \frac{\sigma}{r} \right)^{12} -
+        \left( \frac{\sigma}{r} \right)^{6} \right] + \varepsilon
+
+    for :math:`r < 2^{1/6} \sigma`, where :math:`r` is the distance to the
+    closest point on the wall. Particles outside the channel do not interact
+    with the walls.
+
+    .. py:attribute:: params
+
+        The wall potential parameters. The dictionary has the following keys:
+
+        * ``epsilon`` (`float`, **required**) - Energy parameter
+          :math:`\varepsilon` :math:`[\mathrm{energy}]`.
+        * ``sigma`` (`float`, **required**) - Particle size :math:`\sigma`
+          :math:`[\mathrm{length}]`.
+
+        Type: `TypeParameter` [``particle_type``, `dict`]
+
+    Example::
+
+        walls = hoomd.mpcd.external.CosineChannel(A=5.0, h=2.0, p=1)
+        walls.params['A'] = dict(epsilon=1.0, sigma=1.0)
+        simulation.operations.integrator.forces = [walls]
+    """
+
+    def __init__(self, A, h, p):
+        super().__init__()
+        self._A = float(A)
+        self._h = float(h)
+        self._p = int(p)
+
+    @property
+    def A(self):
+        """float: Amplitude of the cosine walls :math:`[\\mathrm{length}]`."""
+        return self._A
+
+    @property
+    def h(self):
+        """float: Channel half-width :math:`[\\mathrm{length}]`."""
+        return self._h
+
+    @property
+    def p(self):
+        """int: Number of repetitions of the cosine in the box."""
+        return self._p
+
+    def _make_geometry(self, Lx):
+        return _mpcd.CosineChannel(Lx, self._A, self._h, self._p,
+                                   _mpcd.boundary.no_slip)
+
+
+class CosineExpansionContraction(_CosineWall):
+    r"""Weeks-Chandler-Andersen force from cosine expansion-contraction walls.
+
+    Args:
+        H (float): Channel half-width at the widest point
+            :math:`[\mathrm{length}]`.
+        h (float): Channel half-width at the narrowest point
+            :math:`[\mathrm{length}]`.
+        p (int): Number of repetitions of the cosine in the box.
+
+    `CosineExpansionContraction` computes forces and energies on the particles
+    inside the channel bounded by the walls
+
+    .. math::
+
+        z_{\pm}(x) = \pm \left[ \frac{H - h}{2}
+        \left( 1 + \cos\left(\frac{2 \pi p x}{L_x}\right) \right) + h \right]
+
+    of :py:class:`.mpcd.stream.cosine_expansion_contraction`. The particles
+    interact with the walls through the same potential as in `CosineChannel`.
+
+    .. py:attribute:: params
+
+        The wall potential parameters. The dictionary has the following keys:
+
+        * ``epsilon`` (`float`, **required**) - Energy parameter
+          :math:`\varepsilon` :math:`[\mathrm{energy}]`.
+        * ``sigma`` (`float`, **required**) - Particle size :math:`\sigma`
+          :math:`[\mathrm{length}]`.
+
+        Type: `TypeParameter` [``particle_type``, `dict`]
+
+    Example::
+
+        walls = hoomd.mpcd.external.CosineExpansionContraction(H=10.0,
+                                                               h=1.0,
+                                                               p=1)
+        walls.params['A'] = dict(epsilon=1.0, sigma=1.0)
+        simulation.operations.integrator.forces = [walls]
+    """
+
+    def __init__(self, H, h, p):
+        super().__init__()
+        self._H = float(H)
+        self._h = float(h)
+        self._p = int(p)
+
+    @property
+    def H(self):
+        """float: Channel half-width at the widest point \
+        :math:`[\\mathrm{length}]`."""
+        return self._H
+
+    @property
+    def h(self):
+        """float: Channel half-width at the narrowest point \
+        :math:`[\\mathrm{length}]`."""
+        return self._h
+
+    @property
+    def p(self):
+        """int: Number of repetitions of the cosine in the box."""
+        return self._p
+
+    def _make_geometry(self, Lx):
+        return _mpcd.CosineExpansionContraction(Lx, self._H, self._h, self._p,
+                                                _mpcd.boundary.no_slip)
@@ -37,6 +37,7 @@ import hoomd
 from hoomd import _hoomd
 
 from . import _mpcd
+from .stream import _make_signed_distance_field
 
 
 class _bounce_back():
@@ -239,3 +240,225 @@ class slit_pore(_bounce_back):
 
         bc = self._process_boundary(self.boundary)
         self.cpp_method.geometry = _mpcd.SlitPoreGeometry(self.H, self.L, bc)
+
+
+class cosine_channel(_bounce_back):
+    """ NVE integration with bounce-back rules in a sinusoidal channel.
+
+    Args:
+        group (``hoomd.group``): Group of particles on which to apply this method.
+        A (float): amplitude of the cosine walls
+        h (float): channel half-width
+        p (int): number of repetitions of the cosine in the box
+        boundary : 'slip' or 'no_slip' boundary condition at wall (default: 'no_slip')
+
+    This integration method applies to particles in *group* in the cosine channel geometry.
+    This method is the MD analog of :py:class:`.stream.cosine_channel`, which documents
+    additional details about the geometry.
+
+    Examples::
+
+        polymer = group.type('P')
+        channel = mpcd.integrate.cosine_channel(group=polymer, A=5., h=2., p=1)
+
+    """
+
+    def __init__(self, group, A, h, p, boundary="no_slip"):
+        # initialize base class
+        _bounce_back.__init__(self, group)
+        self.metadata_fields += ['A', 'h', 'p']
+
+        # initialize the c++ class
+        if not hoomd.context.current.device.mode == 'gpu':
+            cpp_class = _mpcd.BounceBackNVECosineChannel
+        else:
+            cpp_class = _mpcd.BounceBackNVECosineChannelGPU
+
+        self.A = A
+        self.h = h
+        self.p = p
+        self.boundary = boundary
+
+        bc = self._process_boundary(boundary)
+        geom = self._make_geometry(bc)
+
+        self.cpp_method = cpp_class(hoomd.context.current.system_definition,
+                                    group.cpp_group, geom)
+        self.cpp_method.validateGroup()
+
+    def _make_geometry(self, bc):
+        Lx = hoomd.context.current.system_definition.getParticleData(
+        ).getGlobalBox().getL().x
+        return _mpcd.CosineChannel(Lx, self.A, self.h, self.p, bc)
+
+    def set_params(self, A=None, h=None, p=None, boundary=None):
+        """ Set parameters for the cosine channel geometry.
+
+        Args:
+            A (float): amplitude of the cosine walls
+            h (float): channel half-width
+            p (int): number of repetitions of the cosine in the box
+            boundary : 'slip' or 'no_slip' boundary condition at wall (default: 'no_slip')
+
+        Examples::
+
+            channel.set_params(A=4.)
+            channel.set_params(h=2.0, boundary='slip')
+
+        """
+        if A is not None:
+            self.A = A
+
+        if h is not None:
+            self.h = h
+
+        if p is not None:
+            self.p = p
+
+        if boundary is not None:
+            self.boundary = boundary
+
+        bc = self._process_boundary(self.boundary)
+        self.cpp_method.geometry = self._make_geometry(bc)
+
+
+class cosine_expansion_contraction(_bounce_back):
+    """ NVE integration with bounce-back rules in a sinusoidal expansion-contraction channel.
+
+    Args:
+        group (``hoomd.group``): Group of particles on which to apply this method.
+        H (float): channel half-width at the widest point
+        h (float): channel half-width at the narrowest point
+        p (int): number of repetitions of the cosine in the box
+        boundary : 'slip' or 'no_slip' boundary condition at wall (default: 'no_slip')
+
+    This integration method applies to particles in *group* in the cosine expansion-contraction
+    geometry. This method is the MD analog of :py:class:`.stream.cosine_expansion_contraction`,
+    which documents additional details about the geometry.
+
+    Examples::
+
+        polymer = group.type('P')
+        channel = mpcd.integrate.cosine_expansion_contraction(group=polymer,
+                                                              H=10., h=2., p=1)
+
+    """
+
+    def __init__(self, group, H, h, p, boundary="no_slip"):
+        # initialize base class
+        _bounce_back.__init__(self, group)
+        self.metadata_fields += ['H', 'h', 'p']
+
+        # initialize the c++ class
+        if not hoomd.context.current.device.mode == 'gpu':
+            cpp_class = _mpcd.BounceBackNVECosineExpansionContraction
+        else:
+            cpp_class = _mpcd.BounceBackNVECosineExpansionContractionGPU
+
+        self.H = H
+        self.h = h
+        self.p = p
+        self.boundary = boundary
+
+        bc = self._process_boundary(boundary)
+        geom = self._make_geometry(bc)
+
+        self.cpp_method = cpp_class(hoomd.context.current.system_definition,
+                                    group.cpp_group, geom)
+        self.cpp_method.validateGroup()
+
+    def _make_geometry(self, bc):
+        Lx = hoomd.context.current.system_definition.getParticleData(
+        ).getGlobalBox().getL().x
+        return _mpcd.CosineExpansionContraction(Lx, self.H, self.h, self.p, bc)
+
+    def set_params(self, H=None, h=None, p=None, boundary=None):
+        """ Set parameters for the cosine expansion-contraction geometry.
+
+        Args:
+            H (float): channel half-width at the widest point
+            h (float): channel half-width at the narrowest point
+            p (int): number of repetitions of the cosine in the box
+            boundary : 'slip' or 'no_slip' boundary condition at wall (default: 'no_slip')
+
+        Examples::
+
+            channel.set_params(H=8.)
+            channel.set_params(h=2.0, boundary='slip')
+
+        """
+        if H is not None:
+            self.H = H
+
+        if h is not None:
+            self.h = h
+
+        if p is not None:
+            self.p = p
+
+        if boundary is not None:
+            self.boundary = boundary
+
+        bc = self._process_boundary(self.boundary)
+        self.cpp_method.geometry = self._make_geometry(bc)
+
+
+class sdf(_bounce_back):
+    """ NVE integration with bounce-back rules in a signed distance field geometry.
+
+    Args:
+        group (``hoomd.group``): Group of particles on which to apply this method.
+        sdf (array): signed distance at the grid points
+        boundary : 'slip' or 'no_slip' boundary condition at wall (default: 'no_slip')
+
+    This integration method applies to particles in *group* in a geometry with walls given by a
+    signed distance field. This method is the MD analog of :py:class:`.stream.sdf`, which documents
+    additional details about the geometry.
+
+    Examples::
+
+        all = group.all()
+        walls = mpcd.integrate.sdf(group=all, sdf=distance)
+
+    """
+
+    def __init__(self, group, sdf, boundary="no_slip"):
+        # initialize base class
+        _bounce_back.__init__(self, group)
+
+        # initialize the c++ class
+        if not hoomd.context.current.device.mode == 'gpu':
+            cpp_class = _mpcd.BounceBackNVESDF
+        else:
+            cpp_class = _mpcd.BounceBackNVESDFGPU
+
+        self.boundary = boundary
+        self._field = _make_signed_distance_field(sdf)
+
+        bc = self._process_boundary(boundary)
+        geom = _mpcd.SDFGeometry(self._field, bc)
+
+        self.cpp_method = cpp_class(hoomd.context.current.system_definition,
+                                    group.cpp_group, geom)
+        self.cpp_method.validateGroup()
+
+    def set_params(self, sdf=None, boundary=None):
+        """ Set parameters for the signed distance field geometry.
+
+        Args:
+            sdf (array): signed distance at the grid points
+            boundary : 'slip' or 'no_slip' boundary condition at wall (default: 'no_slip')
+
+        Examples::
+
+            walls.set_params(boundary='slip')
+
+        """
+        if sdf is not None:
+            self._field = _make_signed_distance_field(sdf)
+
+        if boundary is not None:
+            self.boundary = boundary
+
+        bc = self._process_boundary(self.boundary)
+        self.cpp_method.geometry = _mpcd.SDFGeometry(self._field, bc)
@@ -0,0 +1,180 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Zero-copy access to the MPCD particle and cell data.
+
+The classes in this module expose the MPCD data owned by the local MPI rank
+through `hoomd.data.array.HOOMDArray` (CPU) or
+`hoomd.data.array.HOOMDGPUArray` (GPU) objects without copying or gathering
+it. The arrays are only valid inside the context manager::
+
+    with hoomd.mpcd.local_access.ParticleLocalAccess(sim.state) as data:
+        vx = numpy.mean(data.velocity[:, 0])
+
+Both array types implement ``__dlpack__`` (see `hoomd.data.array`), so
+libraries such as PyTorch and JAX can also view the data in place with their
+``from_dlpack`` functions.
+"""
+
+from abc import abstractmethod
+
+import hoomd
+from hoomd import _hoomd
+from hoomd.data.array import HOOMDArray, HOOMDGPUArray
+from hoomd.data.local_access import _LocalAccess
+from hoomd.mpcd import _mpcd
+
+
+class _ParticleLocalAccessBase(_LocalAccess):
+    __slots__ = ('_entered', '_accessed_fields', '_cpp_obj', '_state')
+
+    @property
+    @abstractmethod
+    def _cpp_cls(self):
+        pass
+
+    _fields = {}
+
+    _global_fields = {
+        'position': 'getPosition',
+        'typeid': 'getTypes',
+        'velocity': 'getVelocities',
+        'cell': 'getCellIDs',
+        'tag': 'getTags'
+    }
+
+    def __init__(self, state):
+        super().__init__()
+        self._state = state
+        self._cpp_obj = self._cpp_cls(
+            state._cpp_sys_def.getMPCDParticleData())
+
+    def __enter__(self):
+        if self._state._in_context_manager:
+            raise RuntimeError(
+                "Cannot enter MPCD particle access inside another local "
+                "snapshot context manager.")
+        self._state._in_context_manager = True
+        self._enter()
+        return self
+
+    def __exit__(self, type, value, traceback):
+        self._state._in_context_manager = False
+        self._exit()
+
+
+class _CellThermoLocalAccessBase(_LocalAccess):
+    __slots__ = ('_entered', '_accessed_fields', '_cpp_obj')
+
+    @property
+    @abstractmethod
+    def _cpp_cls(self):
+        pass
+
+    _fields = {}
+
+    _global_fields = {
+        'velocity': 'getVelocities',
+        'mass': 'getMasses',
+        'kinetic_energy': 'getKineticEnergies',
+        'temperature': 'getTemperatures',
+        'num_particles': 'getNumParticles'
+    }
+
+    @property
+    def cell_dims(self):
+        """tuple[int, int, int]: Number of local cells along x, y, and z."""
+        return self._cpp_obj.getCellDims()
+
+    def __init__(self, thermo):
+        super().__init__()
+        self._cpp_obj = self._cpp_cls(getattr(thermo, '_cpp_obj', thermo))
+
+    def __enter__(self):
+        self._enter()
+        return self
+
+    def __exit__(self, type, value, traceback):
+        self._exit()
+
+
+class ParticleLocalAccess(_ParticleLocalAccessBase):
+    """Access the MPCD particle data on the CPU.
+
+    Args:
+        state (hoomd.State): State holding the MPCD particles.
+
+    The arrays hold the particles owned by this rank in their current memory
+    order. The order changes when the particles are sorted or migrate between
+    ranks, so use ``tag`` to identify particles.
+
+    Attributes:
+        position ((N_mpcd, 3) `hoomd.data.array` of ``float``):
+            Particle positions :math:`[\\mathrm{length}]`.
+        typeid ((N_mpcd,) `hoomd.data.array` of ``int``):
+            Particle type ids.
+        velocity ((N_mpcd, 3) `hoomd.data.array` of ``float``):
+            Particle velocities :math:`[\\mathrm{velocity}]`.
+        cell ((N_mpcd,) `hoomd.data.array` of ``unsigned int``):
+            Index of the cell of each particle at the last cell list build
+            (*read only*).
+        tag ((N_mpcd,) `hoomd.data.array` of ``unsigned int``):
+            Particle tags (*read only*).
+    """
+
+    _cpp_cls = _hoomd.LocalMPCDParticleDataHost
+    _array_cls = HOOMDArray
+
+
+class CellThermoLocalAccess(_CellThermoLocalAccessBase):
+    """Access the MPCD cell properties on the CPU.
+
+    Args:
+        thermo: The cell thermo compute (``_mpcd.CellThermoCompute``), or an
+            object holding it in ``_cpp_obj``.
+
+    The arrays hold the properties from the last cell property calculation for
+    every cell on this rank, including the cells shared with neighboring ranks.
+    Reshape them to ``cell_dims[::-1]`` to index cells as ``[k, j, i]``. All
+    arrays are read only.
+
+    Attributes:
+        velocity ((N_cells, 3) `hoomd.data.array` of ``float``):
+            Center of mass velocity of each cell :math:`[\\mathrm{velocity}]`.
+        mass ((N_cells,) `hoomd.data.array` of ``float``):
+            Mass of each cell :math:`[\\mathrm{mass}]`.
+        kinetic_energy ((N_cells,) `hoomd.data.array` of ``float``):
+            Kinetic energy of each cell :math:`[\\mathrm{energy}]`.
+        temperature ((N_cells,) `hoomd.data.array` of ``float``):
+            Temperature of each cell, when the collision method computes it
+            :math:`[\\mathrm{energy}]`.
+        num_particles ((N_cells,) `hoomd.data.array` of ``unsigned int``):
+            Number of particles in each cell.
+    """
+
+    _cpp_cls = _mpcd.LocalCellThermoDataHost
+    _array_cls = HOOMDArray
+
+
+if hoomd.version.gpu_enabled:
+
+    class ParticleLocalAccessGPU(_ParticleLocalAccessBase):
+        """Access the MPCD particle data on the GPU."""
+        _cpp_cls = _hoomd.LocalMPCDParticleDataDevice
+        _array_cls = HOOMDGPUArray
+
+    class CellThermoLocalAccessGPU(_CellThermoLocalAccessBase):
+        """Access the MPCD cell properties on the GPU."""
+        _cpp_cls = _mpcd.LocalCellThermoDataDevice
+        _array_cls = HOOMDGPUArray
+
+else:
+    from hoomd.error import _NoGPU
+
+    class ParticleLocalAccessGPU(_NoGPU):
+        """GPU data access is not available in CPU builds."""
+        pass
+
+    class CellThermoLocalAccessGPU(_NoGPU):
+        """GPU data access is not available in CPU builds."""
+        pass
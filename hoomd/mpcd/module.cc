@@ -17,35 +17,75 @@
 
 // integration
 #include "Integrator.h"
+#include "LoadBalancer.h"
+
+// analysis
+#include "ChannelFlowFieldAnalyzer.h"
+#include "FlowFieldAnalyzer.h"
+#ifdef ENABLE_HIP
+#include "ChannelFlowFieldAnalyzerGPU.h"
+#include "FlowFieldAnalyzerGPU.h"
+#endif // ENABLE_HIP
+#include "GSDWriter.h"
 
 // Collision methods
 #include "ATCollisionMethod.h"
 #include "CollisionMethod.h"
+#include "LangevinCollisionMethod.h"
+#include "SRDAngularCollisionMethod.h"
 #include "SRDCollisionMethod.h"
 #ifdef ENABLE_HIP
 #include "ATCollisionMethodGPU.h"
+#include "LangevinCollisionMethodGPU.h"
+#include "SRDAngularCollisionMethodGPU.h"
 #include "SRDCollisionMethodGPU.h"
 #endif // ENABLE_HIP
 
 // Streaming methods
 #include "ConfinedStreamingMethod.h"
+#include "CosineWallMotion.h"
 #include "StreamingGeometry.h"
 #include "StreamingMethod.h"
 #ifdef ENABLE_HIP
 #include "ConfinedStreamingMethodGPU.h"
 #endif // ENABLE_HIP
 
+// particle initializers
+#include "ParticleInitializer.h"
+#ifdef ENABLE_HIP
+#include "ParticleInitializerGPU.h"
+#endif // ENABLE_HIP
+
 // integration methods
 #include "BounceBackNVE.h"
 #ifdef ENABLE_HIP
 #include "BounceBackNVEGPU.h"
 #endif
 
+// MD potentials from the geometries
+#include "PotentialExternalCosineWall.h"
+#ifdef ENABLE_HIP
+#include "PotentialExternalCosineWallGPU.h"
+#endif // ENABLE_HIP
+
+// rigid body coupling
+#include "RigidBodyCoupling.h"
+#ifdef ENABLE_HIP
+#include "RigidBodyCouplingGPU.h"
+#endif // ENABLE_HIP
+
 // virtual particle fillers
+#include "CosineChannelFiller.h"
+#include "CosineExpansionContractionFiller.h"
+#include "SDFGeometryFiller.h"
+#include "SignedDistanceField.h"
 #include "SlitGeometryFiller.h"
 #include "SlitPoreGeometryFiller.h"
 #include "VirtualParticleFiller.h"
 #ifdef ENABLE_HIP
+#include "CosineChannelFillerGPU.h"
+#include "CosineExpansionContractionFillerGPU.h"
+#include "SDFGeometryFillerGPU.h"
 #include "SlitGeometryFillerGPU.h"
 #include "SlitPoreGeometryFillerGPU.h"
 #endif // ENABLE_HIP
@@ -113,50 +153,123 @@ PYBIND11_MODULE(_mpcd, m)
 
     mpcd::detail::export_CellList(m);
     mpcd::detail::export_CellThermoCompute(m);
+    mpcd::detail::export_LocalCellThermoData<HOOMDHostBuffer>(m, "LocalCellThermoDataHost");
 #ifdef ENABLE_HIP
     mpcd::detail::export_CellListGPU(m);
     mpcd::detail::export_CellThermoComputeGPU(m);
+    mpcd::detail::export_LocalCellThermoData<HOOMDDeviceBuffer>(m, "LocalCellThermoDataDevice");
 #endif // ENABLE_HIP
 
     mpcd::detail::export_Integrator(m);
+    mpcd::detail::export_LoadBalancer(m);
+
+    mpcd::detail::export_FlowFieldAnalyzer(m);
+    mpcd::detail::export_ChannelFlowFieldAnalyzer(m);
+#ifdef ENABLE_HIP
+    mpcd::detail::export_FlowFieldAnalyzerGPU(m);
+    mpcd::detail::export_ChannelFlowFieldAnalyzerGPU(m);
+#endif // ENABLE_HIP
+    mpcd::detail::export_GSDWriter(m);
 
     mpcd::detail::export_CollisionMethod(m);
     mpcd::detail::export_ATCollisionMethod(m);
     mpcd::detail::export_SRDCollisionMethod(m);
+    mpcd::detail::export_LangevinCollisionMethod(m);
+    mpcd::detail::export_SRDAngularCollisionMethod(m);
 #ifdef ENABLE_HIP
     mpcd::detail::export_ATCollisionMethodGPU(m);
     mpcd::detail::export_SRDCollisionMethodGPU(m);
+    mpcd::detail::export_LangevinCollisionMethodGPU(m);
+    mpcd::detail::export_SRDAngularCollisionMethodGPU(m);
 #endif // ENABLE_HIP
 
     mpcd::detail::export_boundary(m);
     mpcd::detail::export_BulkGeometry(m);
     mpcd::detail::export_SlitGeometry(m);
     mpcd::detail::export_SlitPoreGeometry(m);
+    mpcd::detail::export_CosineChannel(m);
+    mpcd::detail::export_CosineExpansionContraction(m);
+    mpcd::detail::export_SignedDistanceField(m);
+    mpcd::detail::export_SDFGeometry(m);
+    mpcd::detail::export_CompositeGeometry<mpcd::detail::CosineChannel,
+                                           mpcd::detail::SlitPoreGeometry>(m);
+    mpcd::detail::export_WallMotion<mpcd::detail::CosineChannel>(m);
+    mpcd::detail::export_WallMotion<mpcd::detail::CosineExpansionContraction>(m);
+    mpcd::detail::export_CosineWallMotion<mpcd::detail::CosineChannel>(m);
+    mpcd::detail::export_CosineWallMotion<mpcd::detail::CosineExpansionContraction>(m);
 
     mpcd::detail::export_StreamingMethod(m);
+    mpcd::detail::export_CollisionStatistics(m);
     mpcd::detail::export_ExternalFieldPolymorph(m);
     mpcd::detail::export_ConfinedStreamingMethod<mpcd::detail::BulkGeometry>(m);
     mpcd::detail::export_ConfinedStreamingMethod<mpcd::detail::SlitGeometry>(m);
     mpcd::detail::export_ConfinedStreamingMethod<mpcd::detail::SlitPoreGeometry>(m);
+    mpcd::detail::export_ConfinedStreamingMethod<mpcd::detail::CosineChannel>(m);
+    mpcd::detail::export_ConfinedStreamingMethod<mpcd::detail::CosineExpansionContraction>(m);
+    mpcd::detail::export_ConfinedStreamingMethod<mpcd::detail::SDFGeometry>(m);
+    mpcd::detail::export_ConfinedStreamingMethod<mpcd::detail::CosineChannelPore>(m);
 #ifdef ENABLE_HIP
     mpcd::detail::export_ConfinedStreamingMethodGPU<mpcd::detail::BulkGeometry>(m);
     mpcd::detail::export_ConfinedStreamingMethodGPU<mpcd::detail::SlitGeometry>(m);
     mpcd::detail::export_ConfinedStreamingMethodGPU<mpcd::detail::SlitPoreGeometry>(m);
+    mpcd::detail::export_ConfinedStreamingMethodGPU<mpcd::detail::CosineChannel>(m);
+    mpcd::detail::export_ConfinedStreamingMethodGPU<mpcd::detail::CosineExpansionContraction>(m);
+    mpcd::detail::export_ConfinedStreamingMethodGPU<mpcd::detail::SDFGeometry>(m);
+    mpcd::detail::export_ConfinedStreamingMethodGPU<mpcd::detail::CosineChannelPore>(m);
+#endif // ENABLE_HIP
+
+    mpcd::detail::export_ParticleInitializer<mpcd::detail::BulkGeometry>(m);
+    mpcd::detail::export_ParticleInitializer<mpcd::detail::SlitGeometry>(m);
+    mpcd::detail::export_ParticleInitializer<mpcd::detail::SlitPoreGeometry>(m);
+    mpcd::detail::export_ParticleInitializer<mpcd::detail::CosineChannel>(m);
+    mpcd::detail::export_ParticleInitializer<mpcd::detail::CosineExpansionContraction>(m);
+    mpcd::detail::export_ParticleInitializer<mpcd::detail::SDFGeometry>(m);
+    mpcd::detail::export_ParticleInitializer<mpcd::detail::CosineChannelPore>(m);
+#ifdef ENABLE_HIP
+    mpcd::detail::export_ParticleInitializerGPU<mpcd::detail::BulkGeometry>(m);
+    mpcd::detail::export_ParticleInitializerGPU<mpcd::detail::SlitGeometry>(m);
+    mpcd::detail::export_ParticleInitializerGPU<mpcd::detail::SlitPoreGeometry>(m);
+    mpcd::detail::export_ParticleInitializerGPU<mpcd::detail::CosineChannel>(m);
+    mpcd::detail::export_ParticleInitializerGPU<mpcd::detail::CosineExpansionContraction>(m);
+    mpcd::detail::export_ParticleInitializerGPU<mpcd::detail::SDFGeometry>(m);
+    mpcd::detail::export_ParticleInitializerGPU<mpcd::detail::CosineChannelPore>(m);
 #endif // ENABLE_HIP
 
     mpcd::detail::export_BounceBackNVE<mpcd::detail::SlitGeometry>(m);
     mpcd::detail::export_BounceBackNVE<mpcd::detail::SlitPoreGeometry>(m);
+    mpcd::detail::export_BounceBackNVE<mpcd::detail::CosineChannel>(m);
+    mpcd::detail::export_BounceBackNVE<mpcd::detail::CosineExpansionContraction>(m);
+    mpcd::detail::export_BounceBackNVE<mpcd::detail::SDFGeometry>(m);
 #ifdef ENABLE_HIP
     mpcd::detail::export_BounceBackNVEGPU<mpcd::detail::SlitGeometry>(m);
     mpcd::detail::export_BounceBackNVEGPU<mpcd::detail::SlitPoreGeometry>(m);
+    mpcd::detail::export_BounceBackNVEGPU<mpcd::detail::CosineChannel>(m);
+    mpcd::detail::export_BounceBackNVEGPU<mpcd::detail::CosineExpansionContraction>(m);
+    mpcd::detail::export_BounceBackNVEGPU<mpcd::detail::SDFGeometry>(m);
+#endif // ENABLE_HIP
+
+    mpcd::detail::export_PotentialExternalCosineWall(m);
+#ifdef ENABLE_HIP
+    mpcd::detail::export_PotentialExternalCosineWallGPU(m);
+#endif // ENABLE_HIP
+
+    mpcd::detail::export_RigidBodyCoupling(m);
+#ifdef ENABLE_HIP
+    mpcd::detail::export_RigidBodyCouplingGPU(m);
 #endif // ENABLE_HIP
 
     mpcd::detail::export_VirtualParticleFiller(m);
     mpcd::detail::export_SlitGeometryFiller(m);
     mpcd::detail::export_SlitPoreGeometryFiller(m);
+    mpcd::detail::export_CosineChannelFiller(m);
+    mpcd::detail::export_CosineExpansionContractionFiller(m);
+    mpcd::detail::export_SDFGeometryFiller(m);
 #ifdef ENABLE_HIP
     mpcd::detail::export_SlitGeometryFillerGPU(m);
     mpcd::detail::export_SlitPoreGeometryFillerGPU(m);
+    mpcd::detail::export_CosineChannelFillerGPU(m);
+    mpcd::detail::export_CosineExpansionContractionFillerGPU(m);
+    mpcd::detail::export_SDFGeometryFillerGPU(m);
 #endif // ENABLE_HIP
 
 #ifdef ENABLE_MPI
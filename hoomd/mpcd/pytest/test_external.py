@@ -0,0 +1,85 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+import numpy as np
+import pytest
+
+
+def _wall_forces(positions, walls, k, epsilon, sigma):
+    """Compute the cosine wall forces with a dense search for the closest point.
+
+    Each wall is a tuple (amplitude, offset, side) for z = offset + amplitude *
+    cos(k x), where side is +1 if the fluid is above the wall.
+    """
+    r_cut = 2**(1 / 6) * sigma
+    forces = np.zeros_like(positions)
+    energies = np.zeros(len(positions))
+    for i, (x, _, z) in enumerate(positions):
+        for amplitude, offset, side in walls:
+            if side * (z - offset - amplitude * np.cos(k * x)) <= 0:
+                continue
+            xp = np.linspace(x - r_cut, x + r_cut, 200001)
+            dx = x - xp
+            dz = z - offset - amplitude * np.cos(k * xp)
+            rsq = dx * dx + dz * dz
+            j = np.argmin(rsq)
+            if rsq[j] >= r_cut * r_cut:
+                continue
+            sr6 = (sigma * sigma / rsq[j])**3
+            force_divr = 48 * epsilon / rsq[j] * sr6 * (sr6 - 0.5)
+            forces[i] += force_divr * np.array([dx[j], 0, dz[j]])
+            energies[i] += 4 * epsilon * sr6 * (sr6 - 1) + epsilon
+    return forces, energies
+
+
+_geometries = [
+    (hoomd.mpcd.external.CosineChannel, dict(A=2.0, h=2.0, p=1),
+     [(2.0, 2.0, -1), (2.0, -2.0, 1)]),
+    (hoomd.mpcd.external.CosineExpansionContraction, dict(H=4.0, h=1.0, p=2),
+     [(1.5, 2.5, -1), (-1.5, -2.5, 1)]),
+]
+
+
+@pytest.mark.parametrize("cls, geometry, walls", _geometries)
+def test_cosine_walls(simulation_factory, cls, geometry, walls):
+    L = 20.0
+    k = 2 * np.pi * geometry["p"] / L
+
+    # place particles just inside and outside of each wall along x
+    rng = np.random.default_rng(42)
+    positions = []
+    for amplitude, offset, side in walls:
+        x = rng.uniform(-L / 2, L / 2, size=20)
+        z = offset + amplitude * np.cos(k * x) + side * rng.uniform(
+            -0.3, 1.2, size=20)
+        positions.append(np.column_stack((x, rng.uniform(-1, 1, size=20), z)))
+    positions = np.concatenate(positions)
+
+    snap = hoomd.Snapshot()
+    if snap.communicator.rank == 0:
+        snap.configuration.box = [L, L, L, 0, 0, 0]
+        snap.particles.N = len(positions)
+        snap.particles.types = ["A"]
+        snap.particles.position[:] = positions
+    sim = simulation_factory(snap)
+
+    epsilon, sigma = 1.5, 0.8
+    force = cls(**geometry)
+    force.params["A"] = dict(epsilon=epsilon, sigma=sigma)
+    for key, value in geometry.items():
+        assert getattr(force, key) == value
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.001, forces=[force])
+    sim.run(0)
+
+    forces = force.forces
+    energies = force.energies
+    if snap.communicator.rank == 0:
+        ref_forces, ref_energies = _wall_forces(positions, walls, k, epsilon,
+                                                sigma)
+        assert np.count_nonzero(ref_energies) > 0
+        np.testing.assert_allclose(forces, ref_forces, rtol=1e-4, atol=1e-4)
+        np.testing.assert_allclose(energies,
+                                   ref_energies,
+                                   rtol=1e-4,
+                                   atol=1e-5)
@@ -0,0 +1,165 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import types
+
+import hoomd
+from hoomd.mpcd import _mpcd
+import numpy as np
+import pytest
+
+
+class _BounceBackMethod(hoomd.md.methods.Method):
+    """Attach a mpcd.integrate bounce-back method to a md.Integrator."""
+
+    def __init__(self, make_method):
+        super().__init__()
+        self._make_method = make_method
+        self.method = None
+
+    def _attach_hook(self):
+        self.method = self._make_method()
+        self._cpp_obj = self.method.cpp_method
+        super()._attach_hook()
+
+
+@pytest.fixture
+def legacy_context(monkeypatch):
+    """Provide the context that mpcd.integrate reads from a Simulation."""
+
+    def make_context(sim):
+        device = sim.device
+        mode = "gpu" if isinstance(device, hoomd.device.GPU) else "cpu"
+        current = types.SimpleNamespace(
+            device=types.SimpleNamespace(mode=mode, cpp_msg=device._cpp_msg),
+            system_definition=sim.state._cpp_sys_def)
+        monkeypatch.setattr(hoomd,
+                            "context",
+                            types.SimpleNamespace(current=current),
+                            raising=False)
+        monkeypatch.setattr(hoomd,
+                            "compute",
+                            types.SimpleNamespace(
+                                _get_unique_thermo=lambda group: None),
+                            raising=False)
+        return types.SimpleNamespace(
+            cpp_group=sim.state._get_group(hoomd.filter.All()))
+
+    return make_context
+
+
+def _cosine(x, L, p):
+    return np.cos(2 * np.pi * p * x / L)
+
+
+_geometry_names = "cls, geometry, new_geometry, get_params, middle, distance"
+_geometries = [
+    (
+        hoomd.mpcd.integrate.cosine_channel,
+        dict(A=2.0, h=1.5, p=1),
+        dict(A=1.5, h=2.0, p=2, boundary="slip"),
+        lambda g: dict(A=g.getAmplitude(),
+                       h=g.getH(),
+                       p=g.getRepetitions(),
+                       boundary=g.getBoundaryCondition()),
+        lambda x, L, A, h, p: A * _cosine(x, L, p),
+        lambda x, z, L, A, h, p: np.abs(z - A * _cosine(x, L, p)) - h,
+    ),
+    (
+        hoomd.mpcd.integrate.cosine_expansion_contraction,
+        dict(H=4.0, h=1.5, p=1),
+        dict(H=5.0, h=2.0, p=2, boundary="slip"),
+        lambda g: dict(H=g.getHwide(),
+                       h=g.getHnarrow(),
+                       p=g.getRepetitions(),
+                       boundary=g.getBoundaryCondition()),
+        lambda x, L, H, h, p: np.zeros_like(x),
+        lambda x, z, L, H, h, p: np.abs(z) -
+        (0.5 * (H - h) * (_cosine(x, L, p) + 1) + h),
+    ),
+]
+
+
+def _make_snapshot(L, N, middle, geometry):
+    """Place particles between the walls with random velocities."""
+    snap = hoomd.Snapshot()
+    if snap.communicator.rank == 0:
+        rng = np.random.default_rng(42)
+        x = rng.uniform(-L / 2, L / 2, size=N)
+        z = middle(x, L, **geometry) + rng.uniform(-0.5, 0.5, size=N)
+        snap.configuration.box = [L, L, L, 0, 0, 0]
+        snap.particles.N = N
+        snap.particles.types = ["A"]
+        snap.particles.position[:] = np.column_stack(
+            (x, rng.uniform(-L / 2, L / 2, size=N), z))
+        snap.particles.velocity[:] = rng.normal(0.0, 2.0, size=(N, 3))
+    return snap
+
+
+@pytest.mark.parametrize(_geometry_names, _geometries)
+def test_construct(simulation_factory, legacy_context, cls, geometry,
+                   new_geometry, get_params, middle, distance):
+    L = 20.0
+    sim = simulation_factory(_make_snapshot(L, 10, middle, geometry))
+    group = legacy_context(sim)
+
+    method = cls(group=group, **geometry)
+    for key, value in geometry.items():
+        assert getattr(method, key) == value
+    assert method.boundary == "no_slip"
+    params = get_params(method.cpp_method.geometry)
+    assert params.pop("boundary") == _mpcd.boundary.no_slip
+    assert params == pytest.approx(geometry)
+
+    with pytest.raises(ValueError):
+        cls(group=group, boundary="invalid", **geometry)
+
+
+@pytest.mark.parametrize(_geometry_names, _geometries)
+def test_set_params(simulation_factory, legacy_context, cls, geometry,
+                    new_geometry, get_params, middle, distance):
+    L = 20.0
+    sim = simulation_factory(_make_snapshot(L, 10, middle, geometry))
+    method = cls(group=legacy_context(sim), **geometry)
+
+    method.set_params(**new_geometry)
+    for key, value in new_geometry.items():
+        assert getattr(method, key) == value
+    params = get_params(method.cpp_method.geometry)
+    assert params.pop("boundary") == _mpcd.boundary.slip
+    expected = dict(new_geometry)
+    expected.pop("boundary")
+    assert params == pytest.approx(expected)
+
+    # parameters that are not set keep their values
+    method.set_params(p=1)
+    params = get_params(method.cpp_method.geometry)
+    assert params.pop("boundary") == _mpcd.boundary.slip
+    assert params == pytest.approx(dict(expected, p=1))
+
+
+@pytest.mark.parametrize(_geometry_names, _geometries)
+def test_run(simulation_factory, legacy_context, cls, geometry, new_geometry,
+             get_params, middle, distance):
+    L = 20.0
+    N = 50
+    snap = _make_snapshot(L, N, middle, geometry)
+    if snap.communicator.rank == 0:
+        kinetic_energy = np.sum(snap.particles.velocity**2)
+    sim = simulation_factory(snap)
+    group = legacy_context(sim)
+
+    bounce_back = _BounceBackMethod(lambda: cls(group=group, **geometry))
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.05,
+                                                    methods=[bounce_back])
+    sim.run(100)
+
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        x = snap.particles.position[:, 0]
+        z = snap.particles.position[:, 2]
+        assert np.all(distance(x, z, L, **geometry) <= 1e-4)
+        # there are no forces and the walls only reflect the velocities
+        np.testing.assert_allclose(np.sum(snap.particles.velocity**2),
+                                   kinetic_energy,
+                                   rtol=1e-4)
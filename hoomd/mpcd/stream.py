@@ -46,13 +46,38 @@ a few important caveats:
 
 """
 
+import numpy as np
+
 import hoomd
 from hoomd import _hoomd
+from hoomd.logging import log, Loggable
 
 from . import _mpcd
 
 
-class _streaming_method:
+def _make_signed_distance_field(sdf):
+    """Tabulate a signed distance field spanning the global box.
+
+    Args:
+        sdf (array): signed distance with shape (nx, ny, nz), or (nx, nz) if
+            it is uniform in *y*
+
+    """
+    values = np.asarray(sdf, dtype=np.float64)
+    if values.ndim == 2:
+        values = values[:, np.newaxis, :]
+    if values.ndim != 3:
+        hoomd.context.current.device.cpp_msg.error(
+            "mpcd.stream: signed distance field must be 2D or 3D.\n")
+        raise ValueError("Signed distance field must be 2D or 3D")
+
+    L = hoomd.context.current.system_definition.getParticleData(
+    ).getGlobalBox().getL()
+    return _mpcd.SignedDistanceField(
+        hoomd.context.current.device.cpp_exec_conf, values, L)
+
+
+class _streaming_method(metaclass=Loggable):
     """Base streaming method
 
     Args:
@@ -62,6 +87,11 @@ class _streaming_method:
     initialize a specific streaming method directly. It is included in the documentation
     to supply signatures for common methods.
 
+    Statistics about the collisions of MPCD particles with the streaming
+    geometry can be collected by setting :py:attr:`track_collisions`. All
+    statistics are for the most recent streaming step and can be logged with
+    :py:class:`hoomd.logging.Logger`.
+
     """
 
     def __init__(self, period):
@@ -89,6 +119,7 @@ class _streaming_method:
         self.force = None
         self._cpp = None
         self._filler = None
+        self._reuse_filler_positions = False
 
         # attach the streaming method to the system
         self.enable()
@@ -127,6 +158,42 @@ class _streaming_method:
         self.enabled = False
         hoomd.context.current.mpcd._stream = None
 
+    def fill_solvent(self, density, kT):
+        r"""Initialize the MPCD particles inside the streaming geometry.
+
+        Args:
+            density (float): Number density of the particles in the fluid.
+            kT (float): Temperature of the particles.
+
+        The MPCD particles are replaced by new particles drawn uniformly inside
+        the geometry at *density*, so *density* is the number density in the
+        volume between the walls. Each rank generates the particles in its own
+        domain directly (on the GPU when it is available), so a snapshot of the
+        solvent is not needed. The velocities are drawn from the
+        Maxwell-Boltzmann distribution at *kT*, and the mean velocity is
+        removed so that the solvent has no net momentum. All particles are
+        given the first MPCD particle type.
+
+        The particles are reproducible for a fixed seed of the system, timestep,
+        and domain decomposition.
+
+        Example::
+
+            stream = mpcd.stream.cosine_channel(A=2.0, h=4.0, p=1)
+            stream.fill_solvent(density=5.0, kT=1.0)
+
+        """
+        class_name = type(self._cpp).__name__.replace(
+            "ConfinedStreamingMethod", "ParticleInitializer")
+        initializer = getattr(_mpcd, class_name)(
+            hoomd.context.current.mpcd.data,
+            float(density),
+            float(kT),
+            self._cpp.geometry,
+        )
+        initializer.initialize(
+            hoomd.context.current.system.getCurrentTimeStep())
+
     def set_period(self, period):
         """Set the streaming period.
 
@@ -202,6 +269,83 @@ class _streaming_method:
         self.force = None
         self._cpp.removeField()
 
+    @property
+    def reuse_filler_positions(self):
+        """bool: Reuse the positions of the virtual particles.
+
+        By default, the virtual particle filler redraws the positions and
+        velocities of all virtual particles on every collision step. When
+        *reuse_filler_positions* is True, the positions are drawn once and
+        saved, and only the velocities are redrawn on later collision steps.
+        The positions are redrawn if the box, cell list, or filler parameters
+        change. Reusing the positions is an approximation because the virtual
+        particles do not decorrelate between collisions, but the random grid
+        shift still changes which cells they are in.
+
+        Example::
+
+            streamer.reuse_filler_positions = True
+
+        """
+        return self._reuse_filler_positions
+
+    @reuse_filler_positions.setter
+    def reuse_filler_positions(self, value):
+        self._reuse_filler_positions = bool(value)
+        if self._filler is not None:
+            self._filler.reuse_positions = self._reuse_filler_positions
+
+    @property
+    def track_collisions(self):
+        """bool: Collect statistics about collisions with the geometry.
+
+        Tracking the statistics requires an additional reduction over all MPCD
+        particles on every streaming step, so it is disabled by default.
+
+        Example::
+
+            streamer.track_collisions = True
+
+        """
+        return self._cpp.track_collisions
+
+    @track_collisions.setter
+    def track_collisions(self, value):
+        self._cpp.track_collisions = bool(value)
+
+    @log(default=False)
+    def num_collisions(self):
+        """int: Number of collisions with the geometry in the last step."""
+        return self._cpp.collision_statistics.collisions
+
+    @log(default=False)
+    def num_multiple_collisions(self):
+        """int: Number of particles that collided more than once."""
+        return self._cpp.collision_statistics.multiple
+
+    @log(default=False)
+    def mean_collision_iterations(self):
+        """float: Average number of root-finding iterations per collision.
+
+        This is zero for geometries where the collision point is computed
+        analytically.
+
+        """
+        stats = self._cpp.collision_statistics
+        if stats.collisions == 0:
+            return 0.0
+        return stats.iterations / stats.collisions
+
+    @log(default=False)
+    def num_collision_fallbacks(self):
+        """int: Number of collisions where root finding used bisection."""
+        return self._cpp.collision_statistics.fallbacks
+
+    @log(default=False)
+    def num_unconverged_collisions(self):
+        """int: Number of collisions where root finding did not converge."""
+        return self._cpp.collision_statistics.unconverged
+
     def _process_boundary(self, bc):
         """Process boundary condition string into enum
 
@@ -566,3 +710,588 @@ class slit_pore(_streaming_method):
         self._cpp.geometry = _mpcd.SlitPoreGeometry(self.H, self.L, bc)
         if self._filler is not None:
             self._filler.setGeometry(self._cpp.geometry)
+
+
+class cosine_channel(_streaming_method):
+    r"""Sinusoidal channel streaming geometry.
+
+    Args:
+        A (float): amplitude of the cosine walls
+        h (float): channel half-width
+        p (int): number of repetitions of the cosine in the box
+        boundary (str): boundary condition at wall ("slip" or "no_slip"")
+        period (int): Number of integration steps between collisions
+
+    The cosine channel geometry represents a fluid confined between two walls
+    described by the anti-symmetric cosines
+
+    .. math::
+
+        z_{\pm}(x) = A \cos\left(\frac{2 \pi p x}{L_x}\right) \pm h
+
+    where :math:`L_x` is the length of the simulation box in *x*. The walls
+    are infinite in *y*, and *p* must be an integer so that the walls are
+    commensurate with the periodic boundary in *x*.
+
+    The "inside" of the :py:class:`cosine_channel` is the space where
+    :math:`|z - A \cos(2 \pi p x / L_x)| < h`.
+
+    Examples::
+
+        stream.cosine_channel(period=10, A=5., h=2., p=1)
+
+    """
+
+    def __init__(self, A, h, p, boundary="no_slip", period=1):
+        _streaming_method.__init__(self, period)
+
+        self.A = A
+        self.h = h
+        self.p = p
+        self.boundary = boundary
+
+        bc = self._process_boundary(boundary)
+
+        # create the base streaming class
+        if not hoomd.context.current.device.cpp_exec_conf.isCUDAEnabled():
+            stream_class = _mpcd.ConfinedStreamingMethodCosineChannel
+        else:
+            stream_class = _mpcd.ConfinedStreamingMethodGPUCosineChannel
+        self._cpp = stream_class(
+            hoomd.context.current.mpcd.data,
+            hoomd.context.current.system.getCurrentTimeStep(),
+            self.period,
+            0,
+            self._make_geometry(bc),
+        )
+
+        self._wall_motion = None
+        self._motion = None
+
+    def _make_geometry(self, bc):
+        Lx = hoomd.context.current.system_definition.getParticleData(
+        ).getGlobalBox().getL().x
+        return _mpcd.CosineChannel(Lx, self.A, self.h, self.p, bc)
+
+    def set_filler(self, density, kT, type="A"):
+        r"""Add virtual particles to cosine channel.
+
+        Args:
+            density (float): Density of virtual particles.
+            kT (float): Temperature of virtual particles.
+            type (str): Type of the MPCD particles to fill with.
+
+        The virtual particle filler draws particles within a layer *outside*
+        each cosine wall that is thick enough to cover any cell that is
+        partially *inside* the channel. The particles are drawn from the
+        velocity distribution consistent with *kT* and with the given
+        *density*. The mean of the distribution is zero in *x*, *y*, and *z*
+        unless the walls move, in which case it is the local velocity of the
+        wall.
+
+        Example::
+
+            channel.set_filler(density=5.0, kT=1.0)
+
+        """
+
+        type_id = hoomd.context.current.mpcd.particles.getTypeByName(type)
+        T = hoomd.variant._setup_variant_input(kT)
+
+        if self._filler is None:
+            if not hoomd.context.current.device.cpp_exec_conf.isCUDAEnabled():
+                fill_class = _mpcd.CosineChannelFiller
+            else:
+                fill_class = _mpcd.CosineChannelFillerGPU
+            self._filler = fill_class(
+                hoomd.context.current.mpcd.data,
+                density,
+                type_id,
+                T.cpp_variant,
+                self._cpp.geometry,
+            )
+            if self._motion is not None:
+                self._filler.setWallMotion(self._motion)
+        else:
+            self._filler.setDensity(density)
+            self._filler.setType(type_id)
+            self._filler.setTemperature(T.cpp_variant)
+
+    def remove_filler(self):
+        """Remove the virtual particle filler.
+
+        Example::
+
+            channel.remove_filler()
+
+        """
+
+        self._filler = None
+
+    def set_params(self, A=None, h=None, p=None, boundary=None):
+        """Set parameters for the cosine channel geometry.
+
+        Args:
+            A (float): amplitude of the cosine walls
+            h (float): channel half-width
+            p (int): number of repetitions of the cosine in the box
+            boundary (str): boundary condition at wall ("slip" or "no_slip"")
+
+        Changing any of these parameters will require the geometry to be
+        constructed and validated, so do not change these too often.
+
+        Examples::
+
+            channel.set_params(A=4.0)
+            channel.set_params(h=2.0, boundary="slip")
+
+        """
+
+        if A is not None:
+            self.A = A
+
+        if h is not None:
+            self.h = h
+
+        if p is not None:
+            self.p = p
+
+        if boundary is not None:
+            self.boundary = boundary
+
+        bc = self._process_boundary(self.boundary)
+        self._cpp.geometry = self._make_geometry(bc)
+        if self._filler is not None:
+            self._filler.setGeometry(self._cpp.geometry)
+        self._set_motion()
+
+    def set_wall_motion(self, A=None, c=0.0, V=0.0):
+        r"""Move the cosine walls.
+
+        Args:
+            A (:py:mod:`hoomd.variant` or :py:obj:`float`): amplitude of the
+                cosine walls (default: the current amplitude)
+            c (:py:mod:`hoomd.variant` or :py:obj:`float`): phase velocity of
+                the wall cosine along *x*
+            V (:py:mod:`hoomd.variant` or :py:obj:`float`): velocity of the
+                walls along *x*
+
+        The wall cosine is shifted by a phase :math:`\phi` that is integrated
+        from the phase velocity, :math:`d\phi/dt = 2 \pi p c / L_x`, so that
+        the walls form a wave traveling along *x* (e.g., for peristaltic
+        pumping). The phase starts from zero. The walls can additionally
+        translate along *x* with velocity *V*. Each parameter can vary with
+        the timestep.
+
+        The walls are treated as stationary during each streaming step, and
+        they are moved at the end of the step. The bounce-back rules reflect
+        the particle velocities relative to the local velocity of the wall
+        surface, and the virtual particle filler follows the walls. The
+        particles are not validated against the geometry when the walls move,
+        although the box is. Particles that the walls sweep over are pushed
+        back inside the channel when they next collide with the walls.
+
+        Examples::
+
+            channel.set_wall_motion(c=0.1)
+            ramp = hoomd.variant.Ramp(A=5., B=4., t_start=0, t_ramp=10000)
+            channel.set_wall_motion(A=ramp, c=0.1)
+
+        """
+        self._wall_motion = tuple(
+            hoomd.variant._setup_variant_input(v)
+            for v in (self.A if A is None else A, c, V))
+        self._set_motion()
+
+    def remove_wall_motion(self):
+        """Stop moving the cosine walls.
+
+        The walls stay where they were last moved to until the geometry
+        parameters are set again.
+
+        Example::
+
+            channel.remove_wall_motion()
+
+        """
+        self._wall_motion = None
+        self._set_motion()
+
+    def _set_motion(self):
+        if self._wall_motion is None:
+            self._motion = None
+        else:
+            A, c, V = self._wall_motion
+            self._motion = _mpcd.CosineWallMotionCosineChannel(
+                self._cpp.geometry,
+                hoomd.context.current.system.getCurrentTimeStep(),
+                A.cpp_variant,
+                c.cpp_variant,
+                V.cpp_variant,
+            )
+        self._cpp.wall_motion = self._motion
+        if self._filler is not None and self._motion is not None:
+            self._filler.setWallMotion(self._motion)
+
+
+class cosine_expansion_contraction(_streaming_method):
+    r"""Sinusoidal expansion-contraction streaming geometry.
+
+    Args:
+        H (float): channel half-width at the widest point
+        h (float): channel half-width at the narrowest point
+        p (int): number of repetitions of the cosine in the box
+        boundary (str): boundary condition at wall ("slip" or "no_slip"")
+        period (int): Number of integration steps between collisions
+
+    The cosine expansion-contraction geometry represents a fluid confined
+    between two walls described by the symmetric cosines
+
+    .. math::
+
+        z_{\pm}(x) = \pm\left[\frac{H-h}{2}
+            \left(1 + \cos\left(\frac{2 \pi p x}{L_x}\right)\right) + h \right]
+
+    where :math:`L_x` is the length of the simulation box in *x*. The walls
+    are infinite in *y*, and *p* must be an integer so that the walls are
+    commensurate with the periodic boundary in *x*. The channel is widest at
+    :math:`x = 0`.
+
+    The "inside" of the :py:class:`cosine_expansion_contraction` is the space
+    between the walls.
+
+    Examples::
+
+        stream.cosine_expansion_contraction(period=10, H=10., h=2., p=1)
+
+    """
+
+    def __init__(self, H, h, p, boundary="no_slip", period=1):
+        _streaming_method.__init__(self, period)
+
+        self.H = H
+        self.h = h
+        self.p = p
+        self.boundary = boundary
+
+        bc = self._process_boundary(boundary)
+
+        # create the base streaming class
+        if not hoomd.context.current.device.cpp_exec_conf.isCUDAEnabled():
+            stream_class = _mpcd.ConfinedStreamingMethodCosineExpansionContraction
+        else:
+            stream_class = _mpcd.ConfinedStreamingMethodGPUCosineExpansionContraction
+        self._cpp = stream_class(
+            hoomd.context.current.mpcd.data,
+            hoomd.context.current.system.getCurrentTimeStep(),
+            self.period,
+            0,
+            self._make_geometry(bc),
+        )
+
+        self._wall_motion = None
+        self._motion = None
+
+    def _make_geometry(self, bc):
+        Lx = hoomd.context.current.system_definition.getParticleData(
+        ).getGlobalBox().getL().x
+        return _mpcd.CosineExpansionContraction(Lx, self.H, self.h, self.p, bc)
+
+    def set_filler(self, density, kT, type="A"):
+        r"""Add virtual particles to cosine expansion-contraction channel.
+
+        Args:
+            density (float): Density of virtual particles.
+            kT (float): Temperature of virtual particles.
+            type (str): Type of the MPCD particles to fill with.
+
+        The virtual particle filler draws particles within a layer *outside*
+        each cosine wall that is thick enough to cover any cell that is
+        partially *inside* the channel. The particles are drawn from the
+        velocity distribution consistent with *kT* and with the given
+        *density*. The mean of the distribution is zero in *x*, *y*, and *z*
+        unless the walls move, in which case it is the local velocity of the
+        wall.
+
+        Example::
+
+            channel.set_filler(density=5.0, kT=1.0)
+
+        """
+
+        type_id = hoomd.context.current.mpcd.particles.getTypeByName(type)
+        T = hoomd.variant._setup_variant_input(kT)
+
+        if self._filler is None:
+            if not hoomd.context.current.device.cpp_exec_conf.isCUDAEnabled():
+                fill_class = _mpcd.CosineExpansionContractionFiller
+            else:
+                fill_class = _mpcd.CosineExpansionContractionFillerGPU
+            self._filler = fill_class(
+                hoomd.context.current.mpcd.data,
+                density,
+                type_id,
+                T.cpp_variant,
+                self._cpp.geometry,
+            )
+            if self._motion is not None:
+                self._filler.setWallMotion(self._motion)
+        else:
+            self._filler.setDensity(density)
+            self._filler.setType(type_id)
+            self._filler.setTemperature(T.cpp_variant)
+
+    def remove_filler(self):
+        """Remove the virtual particle filler.
+
+        Example::
+
+            channel.remove_filler()
+
+        """
+
+        self._filler = None
+
+    def set_params(self, H=None, h=None, p=None, boundary=None):
+        """Set parameters for the cosine expansion-contraction geometry.
+
+        Args:
+            H (float): channel half-width at the widest point
+            h (float): channel half-width at the narrowest point
+            p (int): number of repetitions of the cosine in the box
+            boundary (str): boundary condition at wall ("slip" or "no_slip"")
+
+        Changing any of these parameters will require the geometry to be
+        constructed and validated, so do not change these too often.
+
+        Examples::
+
+            channel.set_params(H=8.0)
+            channel.set_params(h=2.0, boundary="slip")
+
+        """
+
+        if H is not None:
+            self.H = H
+
+        if h is not None:
+            self.h = h
+
+        if p is not None:
+            self.p = p
+
+        if boundary is not None:
+            self.boundary = boundary
+
+        bc = self._process_boundary(self.boundary)
+        self._cpp.geometry = self._make_geometry(bc)
+        if self._filler is not None:
+            self._filler.setGeometry(self._cpp.geometry)
+        self._set_motion()
+
+    def set_wall_motion(self, A=None, c=0.0, V=0.0):
+        r"""Move the cosine walls.
+
+        Args:
+            A (:py:mod:`hoomd.variant` or :py:obj:`float`): amplitude of the
+                cosine walls (default: the current amplitude :math:`(H-h)/2`)
+            c (:py:mod:`hoomd.variant` or :py:obj:`float`): phase velocity of
+                the wall cosine along *x*
+            V (:py:mod:`hoomd.variant` or :py:obj:`float`): velocity of the
+                walls along *x*
+
+        The wall cosine is shifted by a phase :math:`\phi` that is integrated
+        from the phase velocity, :math:`d\phi/dt = 2 \pi p c / L_x`, so that
+        the walls form a wave traveling along *x* (e.g., for peristaltic
+        pumping). The phase starts from zero. The walls can additionally
+        translate along *x* with velocity *V*. Each parameter can vary with
+        the timestep.
+
+        The walls are treated as stationary during each streaming step, and
+        they are moved at the end of the step. The bounce-back rules reflect
+        the particle velocities relative to the local velocity of the wall
+        surface, and the virtual particle filler follows the walls. The
+        particles are not validated against the geometry when the walls move,
+        although the box is. Particles that the walls sweep over are pushed
+        back inside the channel when they next collide with the walls.
+
+        Examples::
+
+            channel.set_wall_motion(c=0.1)
+            channel.set_wall_motion(A=4., c=0.1, V=0.5)
+
+        """
+        self._wall_motion = tuple(
+            hoomd.variant._setup_variant_input(v)
+            for v in (0.5 * (self.H - self.h) if A is None else A, c, V))
+        self._set_motion()
+
+    def remove_wall_motion(self):
+        """Stop moving the cosine walls.
+
+        The walls stay where they were last moved to until the geometry
+        parameters are set again.
+
+        Example::
+
+            channel.remove_wall_motion()
+
+        """
+        self._wall_motion = None
+        self._set_motion()
+
+    def _set_motion(self):
+        if self._wall_motion is None:
+            self._motion = None
+        else:
+            A, c, V = self._wall_motion
+            self._motion = _mpcd.CosineWallMotionCosineExpansionContraction(
+                self._cpp.geometry,
+                hoomd.context.current.system.getCurrentTimeStep(),
+                A.cpp_variant,
+                c.cpp_variant,
+                V.cpp_variant,
+            )
+        self._cpp.wall_motion = self._motion
+        if self._filler is not None and self._motion is not None:
+            self._filler.setWallMotion(self._motion)
+
+
+class sdf(_streaming_method):
+    r"""Signed distance field streaming geometry.
+
+    Args:
+        sdf (array): signed distance at the grid points
+        boundary (str): boundary condition at wall ("slip" or "no_slip"")
+        period (int): Number of integration steps between collisions
+
+    The signed distance field geometry represents a fluid confined by walls of
+    arbitrary shape. The walls are the zero level set of the signed distance
+    *sdf*, which is negative inside the fluid and positive inside the walls.
+    The distance is tabulated on a regular grid with shape (nx, ny, nz) that
+    spans the periodic simulation box, with grid point (i, j, k) at
+
+    .. math::
+
+        \mathbf{r}_{ijk} = -\frac{\mathbf{L}}{2} + \left(
+            \frac{i L_x}{n_x}, \frac{j L_y}{n_y}, \frac{k L_z}{n_z}\right)
+
+    where :math:`\mathbf{L}` are the lengths of the simulation box, which
+    must be orthorhombic. The distance is interpolated trilinearly between the
+    grid points. A 2D array with shape (nx, nz) is uniform in *y*.
+
+    The collision with the wall is found by sphere tracing along the particle
+    trajectory, so *sdf* should be (close to) a true distance near the walls
+    for thin features to be resolved.
+
+    The "inside" of the :py:class:`sdf` is the space where the interpolated
+    distance is not positive.
+
+    Examples::
+
+        x = np.linspace(-10., 10., 64, endpoint=False)
+        z = np.linspace(-10., 10., 64, endpoint=False)
+        X, Z = np.meshgrid(x, z, indexing="ij")
+        stream.sdf(sdf=np.abs(Z - np.cos(X)) - 2.)
+
+    """
+
+    def __init__(self, sdf, boundary="no_slip", period=1):
+        _streaming_method.__init__(self, period)
+
+        self.boundary = boundary
+        self._field = _make_signed_distance_field(sdf)
+
+        bc = self._process_boundary(boundary)
+
+        # create the base streaming class
+        if not hoomd.context.current.device.cpp_exec_conf.isCUDAEnabled():
+            stream_class = _mpcd.ConfinedStreamingMethodSDF
+        else:
+            stream_class = _mpcd.ConfinedStreamingMethodGPUSDF
+        self._cpp = stream_class(
+            hoomd.context.current.mpcd.data,
+            hoomd.context.current.system.getCurrentTimeStep(),
+            self.period,
+            0,
+            _mpcd.SDFGeometry(self._field, bc),
+        )
+
+    def set_filler(self, density, kT, type="A"):
+        r"""Add virtual particles to signed distance field geometry.
+
+        Args:
+            density (float): Density of virtual particles.
+            kT (float): Temperature of virtual particles.
+            type (str): Type of the MPCD particles to fill with.
+
+        The virtual particle filler draws particles within a layer *outside*
+        the walls where the signed distance is at most the length of a cell
+        diagonal, which covers any cell that is partially *inside* the
+        geometry. The particles are drawn from the velocity distribution
+        consistent with *kT* and with the given *density*. The mean of the
+        distribution is zero in *x*, *y*, and *z*.
+
+        Example::
+
+            geometry.set_filler(density=5.0, kT=1.0)
+
+        """
+
+        type_id = hoomd.context.current.mpcd.particles.getTypeByName(type)
+        T = hoomd.variant._setup_variant_input(kT)
+
+        if self._filler is None:
+            if not hoomd.context.current.device.cpp_exec_conf.isCUDAEnabled():
+                fill_class = _mpcd.SDFGeometryFiller
+            else:
+                fill_class = _mpcd.SDFGeometryFillerGPU
+            self._filler = fill_class(
+                hoomd.context.current.mpcd.data,
+                density,
+                type_id,
+                T.cpp_variant,
+                self._cpp.geometry,
+            )
+        else:
+            self._filler.setDensity(density)
+            self._filler.setType(type_id)
+            self._filler.setTemperature(T.cpp_variant)
+
+    def remove_filler(self):
+        """Remove the virtual particle filler.
+
+        Example::
+
+            geometry.remove_filler()
+
+        """
+
+        self._filler = None
+
+    def set_params(self, sdf=None, boundary=None):
+        """Set parameters for the signed distance field geometry.
+
+        Args:
+            sdf (array): signed distance at the grid points
+            boundary (str): boundary condition at wall ("slip" or "no_slip"")
+
+        Changing any of these parameters will require the geometry to be
+        constructed and validated, so do not change these too often.
+
+        Examples::
+
+            geometry.set_params(boundary="slip")
+
+        """
+
+        if sdf is not None:
+            self._field = _make_signed_distance_field(sdf)
+
+        if boundary is not None:
+            self.boundary = boundary
+
+        bc = self._process_boundary(self.boundary)
+        self._cpp.geometry = _mpcd.SDFGeometry(self._field, bc)
+        if self._filler is not None:
+            self._filler.setGeometry(self._cpp.geometry)
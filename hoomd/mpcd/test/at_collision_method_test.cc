@@ -2,9 +2,11 @@
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 #include "hoomd/mpcd/ATCollisionMethod.h"
+#include "hoomd/mpcd/LangevinCollisionMethod.h"
 #include "utils.h"
 #ifdef ENABLE_HIP
 #include "hoomd/mpcd/ATCollisionMethodGPU.h"
+#include "hoomd/mpcd/LangevinCollisionMethodGPU.h"
 #endif // ENABLE_HIP
 
 #include "hoomd/SnapshotSystemData.h"
@@ -165,6 +167,90 @@ void at_collision_method_embed_test(std::shared_ptr<ExecutionConfiguration> exec
     CHECK_CLOSE(orig_mom.z, mom.z, tol_small);
     }
 
+//! Test that the MPC-Langevin collision method conserves momentum and thermalizes the particles
+template<class CM>
+void langevin_collision_method_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(2.0);
+    snap->particle_data.type_mapping.push_back("A");
+    // 4 particle system
+    snap->mpcd_data.resize(4);
+    snap->mpcd_data.type_mapping.push_back("A");
+    snap->mpcd_data.position[0] = vec3<Scalar>(-0.6, -0.6, -0.6);
+    snap->mpcd_data.position[1] = vec3<Scalar>(-0.6, -0.6, -0.6);
+    snap->mpcd_data.position[2] = vec3<Scalar>(0.5, 0.5, 0.5);
+    snap->mpcd_data.position[3] = vec3<Scalar>(0.5, 0.5, 0.5);
+    snap->mpcd_data.velocity[0] = vec3<Scalar>(2.0, 0.0, 0.0);
+    snap->mpcd_data.velocity[1] = vec3<Scalar>(1.0, 0.0, 0.0);
+    snap->mpcd_data.velocity[2] = vec3<Scalar>(5.0, -2.0, 3.0);
+    snap->mpcd_data.velocity[3] = vec3<Scalar>(-1.0, 2.0, -5.0);
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+    const Scalar3 orig_mom = make_scalar3(7.0, 0.0, -2.0);
+
+    std::shared_ptr<mpcd::ParticleData> pdata_4 = sysdef->getMPCDParticleData();
+    auto cl = std::make_shared<mpcd::CellList>(sysdef);
+    std::shared_ptr<Variant> T = std::make_shared<VariantConstant>(1.5);
+    std::shared_ptr<mpcd::LangevinCollisionMethod> collide
+        = std::make_shared<CM>(sysdef, 0, 1, -1, T, 0.0);
+    collide->setCellList(cl);
+    collide->enableGridShifting(false);
+    CHECK_SMALL(collide->getFriction(), tol_small);
+
+    // negative friction is not allowed
+    UP_ASSERT_EXCEPTION(std::runtime_error, [&] { collide->setFriction(-1.0); });
+
+    // without friction, the velocities should be unchanged
+    collide->collide(0);
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata_4->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        CHECK_CLOSE(h_vel.data[0].x, 2.0, tol_small);
+        CHECK_SMALL(h_vel.data[0].y, tol_small);
+        CHECK_SMALL(h_vel.data[0].z, tol_small);
+        CHECK_CLOSE(h_vel.data[2].x, 5.0, tol_small);
+        CHECK_CLOSE(h_vel.data[2].y, -2.0, tol_small);
+        CHECK_CLOSE(h_vel.data[2].z, 3.0, tol_small);
+        CHECK_CLOSE(h_vel.data[3].x, -1.0, tol_small);
+        CHECK_CLOSE(h_vel.data[3].y, 2.0, tol_small);
+        CHECK_CLOSE(h_vel.data[3].z, -5.0, tol_small);
+        }
+
+    // thermo to test properties
+    auto thermo = std::make_shared<mpcd::CellThermoCompute>(sysdef, cl);
+    AllThermoRequest thermo_req(thermo);
+
+    // with friction, momentum is conserved and the temperature relaxes to the set point
+    collide->setFriction(1.0);
+    CHECK_CLOSE(collide->getFriction(), 1.0, tol_small);
+    collide->collide(1);
+    thermo->compute(2);
+        {
+        const Scalar3 mom = thermo->getNetMomentum();
+        CHECK_CLOSE(mom.x, orig_mom.x, tol_small);
+        CHECK_SMALL(mom.y, tol_small);
+        CHECK_CLOSE(mom.z, orig_mom.z, tol_small);
+        }
+
+    // relax for a few steps first because the velocities are only partially randomized
+    for (uint64_t timestep = 2; timestep < 100; ++timestep)
+        {
+        collide->collide(timestep);
+        }
+    const unsigned int num_sample = 20000;
+    double Tavg = 0.0;
+    for (uint64_t timestep = 100; timestep < 100 + num_sample; ++timestep)
+        {
+        thermo->compute(timestep);
+        Tavg += thermo->getTemperature();
+
+        collide->collide(timestep);
+        }
+    Tavg /= num_sample;
+    CHECK_CLOSE(Tavg, 1.5, 0.05);
+    }
+
 //! basic test case for MPCD ATCollisionMethod class
 UP_TEST(at_collision_method_basic)
     {
@@ -177,6 +263,12 @@ UP_TEST(at_collision_method_embed)
     at_collision_method_embed_test<mpcd::ATCollisionMethod>(
         std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU));
     }
+//! test the MPCD LangevinCollisionMethod class
+UP_TEST(langevin_collision_method)
+    {
+    langevin_collision_method_test<mpcd::LangevinCollisionMethod>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU));
+    }
 #ifdef ENABLE_HIP
 //! basic test case for MPCD ATCollisionMethodGPU class
 UP_TEST(at_collision_method_basic_gpu)
@@ -190,4 +282,10 @@ UP_TEST(at_collision_method_embed_gpu)
     at_collision_method_embed_test<mpcd::ATCollisionMethodGPU>(
         std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU));
     }
+//! test the MPCD LangevinCollisionMethodGPU class
+UP_TEST(langevin_collision_method_gpu)
+    {
+    langevin_collision_method_test<mpcd::LangevinCollisionMethodGPU>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU));
+    }
 #endif // ENABLE_HIP
@@ -3,14 +3,18 @@
 
 #include "hoomd/mpcd/CellList.h"
 #ifdef ENABLE_HIP
+#include "hoomd/SFCPackTunerGPU.h"
 #include "hoomd/mpcd/CellListGPU.h"
 #endif // ENABLE_HIP
 
+#include "hoomd/SFCPackTuner.h"
 #include "hoomd/SnapshotSystemData.h"
 #include "hoomd/filter/ParticleFilterAll.h"
 #include "hoomd/filter/ParticleFilterType.h"
 #include "hoomd/test/upp11_config.h"
 
+#include <algorithm>
+
 HOOMD_UP_MAIN()
 
 using namespace hoomd;
@@ -151,27 +155,27 @@ template<class CL> void celllist_small_test(std::shared_ptr<ExecutionConfigurati
         CHECK_EQUAL_UINT(h_cell_list.data[cli(0, ci(1, 1, 0))], 3);
         CHECK_EQUAL_UINT(h_cell_list.data[cli(0, ci(1, 1, 1))], 7);
 
-        ArrayHandle<Scalar4> h_vel(pdata_9->getVelocities(),
-                                   access_location::host,
-                                   access_mode::read);
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[0].w), ci(0, 0, 0));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[1].w), ci(1, 0, 0));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[2].w), ci(0, 1, 0));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[3].w), ci(1, 1, 0));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[4].w), ci(0, 0, 1));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[5].w), ci(1, 0, 1));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[6].w), ci(0, 1, 1));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[7].w), ci(1, 1, 1));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[8].w), ci(0, 0, 0));
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata_9->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[0].w), ci(0, 0, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[1].w), ci(1, 0, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[2].w), ci(0, 1, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[3].w), ci(1, 1, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[4].w), ci(0, 0, 1));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[5].w), ci(1, 0, 1));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[6].w), ci(0, 1, 1));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[7].w), ci(1, 1, 1));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[8].w), ci(0, 0, 0));
         }
 
         // condense particles into two bins
         {
-        ArrayHandle<Scalar4> h_pos(pdata_9->getPositions(),
-                                   access_location::host,
-                                   access_mode::overwrite);
-        h_pos.data[0] = make_scalar4(-0.3, -0.3, -0.3, 0.0);
-        h_pos.data[1] = make_scalar4(0.3, 0.3, 0.3, 0.0);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata_9->getPositions(),
+                                                access_location::host,
+                                                access_mode::overwrite);
+        h_pos.data[0] = mpcd::make_solvent_scalar4(-0.3, -0.3, -0.3, 0.0);
+        h_pos.data[1] = mpcd::make_solvent_scalar4(0.3, 0.3, 0.3, 0.0);
         h_pos.data[2] = h_pos.data[0];
         h_pos.data[3] = h_pos.data[1];
         h_pos.data[4] = h_pos.data[0];
@@ -230,10 +234,10 @@ template<class CL> void celllist_small_test(std::shared_ptr<ExecutionConfigurati
         // bring all particles into one box, which triggers a resize, and check that all particles
         // are in this bin
         {
-        ArrayHandle<Scalar4> h_pos(pdata_9->getPositions(),
-                                   access_location::host,
-                                   access_mode::overwrite);
-        h_pos.data[0] = make_scalar4(0.9, -0.4, 0.0, 0.0);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata_9->getPositions(),
+                                                access_location::host,
+                                                access_mode::overwrite);
+        h_pos.data[0] = mpcd::make_solvent_scalar4(0.9, -0.4, 0.0, 0.0);
         for (unsigned int i = 1; i < 9; ++i)
             h_pos.data[i] = h_pos.data[0];
         }
@@ -257,18 +261,19 @@ template<class CL> void celllist_small_test(std::shared_ptr<ExecutionConfigurati
 
         // send a particle out of bounds and check that an exception is raised
         {
-        ArrayHandle<Scalar4> h_pos(pdata_9->getPositions(),
-                                   access_location::host,
-                                   access_mode::overwrite);
-        h_pos.data[0] = make_scalar4(2.1, 2.1, 2.1, __int_as_scalar(0));
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata_9->getPositions(),
+                                                access_location::host,
+                                                access_mode::overwrite);
+        h_pos.data[0] = mpcd::make_solvent_scalar4(2.1, 2.1, 2.1, mpcd::__int_as_solvent_scalar(0));
         }
     UP_ASSERT_EXCEPTION(std::runtime_error, [&] { cl->compute(3); });
         // check the other side as well
         {
-        ArrayHandle<Scalar4> h_pos(pdata_9->getPositions(),
-                                   access_location::host,
-                                   access_mode::overwrite);
-        h_pos.data[0] = make_scalar4(-2.1, -2.1, -2.1, __int_as_scalar(0));
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata_9->getPositions(),
+                                                access_location::host,
+                                                access_mode::overwrite);
+        h_pos.data[0]
+            = mpcd::make_solvent_scalar4(-2.1, -2.1, -2.1, mpcd::__int_as_solvent_scalar(0));
         }
     UP_ASSERT_EXCEPTION(std::runtime_error, [&] { cl->compute(4); });
     }
@@ -308,10 +313,10 @@ template<class CL> void celllist_grid_shift_test(std::shared_ptr<ExecutionConfig
 
         // move to the other side and retry
         {
-        ArrayHandle<Scalar4> h_pos(pdata_1->getPositions(),
-                                   access_location::host,
-                                   access_mode::overwrite);
-        h_pos.data[0] = make_scalar4(-0.1, -0.1, -0.1, 0.0);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata_1->getPositions(),
+                                                access_location::host,
+                                                access_mode::overwrite);
+        h_pos.data[0] = mpcd::make_solvent_scalar4(-0.1, -0.1, -0.1, 0.0);
         }
     cl->setGridShift(make_scalar3(-0.5, -0.5, -0.5));
     cl->compute(2);
@@ -325,10 +330,10 @@ template<class CL> void celllist_grid_shift_test(std::shared_ptr<ExecutionConfig
 
         // check for cell periodic wrapping by putting particles near the box boundary
         {
-        ArrayHandle<Scalar4> h_pos(pdata_1->getPositions(),
-                                   access_location::host,
-                                   access_mode::overwrite);
-        h_pos.data[0] = make_scalar4(-2.9, -2.9, -2.9, 0.0);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata_1->getPositions(),
+                                                access_location::host,
+                                                access_mode::overwrite);
+        h_pos.data[0] = mpcd::make_solvent_scalar4(-2.9, -2.9, -2.9, 0.0);
         }
     cl->setGridShift(make_scalar3(0.5, 0.5, 0.5));
     cl->compute(3);
@@ -342,10 +347,10 @@ template<class CL> void celllist_grid_shift_test(std::shared_ptr<ExecutionConfig
 
         // and the other way
         {
-        ArrayHandle<Scalar4> h_pos(pdata_1->getPositions(),
-                                   access_location::host,
-                                   access_mode::overwrite);
-        h_pos.data[0] = make_scalar4(2.9, 2.9, 2.9, 0.0);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata_1->getPositions(),
+                                                access_location::host,
+                                                access_mode::overwrite);
+        h_pos.data[0] = mpcd::make_solvent_scalar4(2.9, 2.9, 2.9, 0.0);
         }
     cl->setGridShift(make_scalar3(-0.5, -0.5, -0.5));
     cl->compute(4);
@@ -440,17 +445,17 @@ template<class CL> void celllist_embed_test(std::shared_ptr<ExecutionConfigurati
         CHECK_EQUAL_UINT(h_cell_list.data[cli(0, ci(1, 1, 0))], 3);
         CHECK_EQUAL_UINT(h_cell_list.data[cli(0, ci(1, 1, 1))], 7);
 
-        ArrayHandle<Scalar4> h_vel(pdata_8->getVelocities(),
-                                   access_location::host,
-                                   access_mode::read);
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[0].w), ci(0, 0, 0));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[1].w), ci(1, 0, 0));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[2].w), ci(0, 1, 0));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[3].w), ci(1, 1, 0));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[4].w), ci(0, 0, 1));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[5].w), ci(1, 0, 1));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[6].w), ci(0, 1, 1));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[7].w), ci(1, 1, 1));
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata_8->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[0].w), ci(0, 0, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[1].w), ci(1, 0, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[2].w), ci(0, 1, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[3].w), ci(1, 1, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[4].w), ci(0, 0, 1));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[5].w), ci(1, 0, 1));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[6].w), ci(0, 1, 1));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[7].w), ci(1, 1, 1));
         }
 
     // now we include the half embedded group
@@ -520,17 +525,17 @@ template<class CL> void celllist_embed_test(std::shared_ptr<ExecutionConfigurati
             UP_ASSERT_EQUAL(result, std::vector<unsigned int> {7, 11});
             }
 
-        ArrayHandle<Scalar4> h_vel(pdata_8->getVelocities(),
-                                   access_location::host,
-                                   access_mode::read);
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[0].w), ci(0, 0, 0));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[1].w), ci(1, 0, 0));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[2].w), ci(0, 1, 0));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[3].w), ci(1, 1, 0));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[4].w), ci(0, 0, 1));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[5].w), ci(1, 0, 1));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[6].w), ci(0, 1, 1));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[7].w), ci(1, 1, 1));
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata_8->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[0].w), ci(0, 0, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[1].w), ci(1, 0, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[2].w), ci(0, 1, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[3].w), ci(1, 1, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[4].w), ci(0, 0, 1));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[5].w), ci(1, 0, 1));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[6].w), ci(0, 1, 1));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[7].w), ci(1, 1, 1));
 
         ArrayHandle<unsigned int> h_embed_cell_ids(cl->getEmbeddedGroupCellIds(),
                                                    access_location::host,
@@ -616,17 +621,17 @@ template<class CL> void celllist_embed_test(std::shared_ptr<ExecutionConfigurati
             UP_ASSERT_EQUAL(result, std::vector<unsigned int> {7, 11});
             }
 
-        ArrayHandle<Scalar4> h_vel(pdata_8->getVelocities(),
-                                   access_location::host,
-                                   access_mode::read);
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[0].w), ci(0, 0, 0));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[1].w), ci(1, 0, 0));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[2].w), ci(0, 1, 0));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[3].w), ci(1, 1, 0));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[4].w), ci(0, 0, 1));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[5].w), ci(1, 0, 1));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[6].w), ci(0, 1, 1));
-        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[7].w), ci(1, 1, 1));
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata_8->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[0].w), ci(0, 0, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[1].w), ci(1, 0, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[2].w), ci(0, 1, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[3].w), ci(1, 1, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[4].w), ci(0, 0, 1));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[5].w), ci(1, 0, 1));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[6].w), ci(0, 1, 1));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[7].w), ci(1, 1, 1));
 
         ArrayHandle<unsigned int> h_embed_cell_ids(cl->getEmbeddedGroupCellIds(),
                                                    access_location::host,
@@ -651,6 +656,167 @@ template<class CL> void celllist_embed_test(std::shared_ptr<ExecutionConfigurati
         }
     }
 
+//! Test that the embedded particles are sorted by their cells
+template<class CL, class SFC>
+void celllist_sort_keys_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    // one MD particle in each cell, with every other particle embedded
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(2.0);
+        {
+        SnapshotParticleData<Scalar>& pdata_snap = snap->particle_data;
+        pdata_snap.type_mapping.push_back("A");
+        pdata_snap.type_mapping.push_back("B");
+        pdata_snap.resize(8);
+        pdata_snap.pos[0] = vec3<Scalar>(-0.5, -0.5, -0.5);
+        pdata_snap.pos[1] = vec3<Scalar>(0.5, 0.5, 0.5);
+        pdata_snap.pos[2] = vec3<Scalar>(-0.5, 0.5, -0.5);
+        pdata_snap.pos[3] = vec3<Scalar>(0.5, -0.5, 0.5);
+        pdata_snap.pos[4] = vec3<Scalar>(-0.5, -0.5, 0.5);
+        pdata_snap.pos[5] = vec3<Scalar>(0.5, 0.5, -0.5);
+        pdata_snap.pos[6] = vec3<Scalar>(-0.5, 0.5, 0.5);
+        pdata_snap.pos[7] = vec3<Scalar>(0.5, -0.5, -0.5);
+        for (unsigned int i = 0; i < 8; ++i)
+            pdata_snap.type[i] = i % 2;
+        }
+    snap->mpcd_data.resize(1);
+    snap->mpcd_data.type_mapping.push_back("A");
+    snap->mpcd_data.position[0] = vec3<Scalar>(-0.5, -0.5, -0.5);
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+
+    std::shared_ptr<mpcd::CellList> cl(new CL(sysdef));
+    const Index3D ci = cl->getCellIndexer();
+
+    // without embedded particles, there are no keys
+    std::vector<unsigned int> keys;
+    CHECK_EQUAL_UINT(cl->computeSortKeys(keys), 0);
+
+    std::shared_ptr<ParticleFilter> selector_B(new ParticleFilterType({"B"}));
+    std::shared_ptr<ParticleGroup> group_B(new ParticleGroup(sysdef, selector_B));
+    cl->setEmbeddedGroup(group_B);
+
+    // the embedded particles are keyed by their cell, the others have no key
+    const unsigned int n_cells = cl->computeSortKeys(keys);
+    CHECK_EQUAL_UINT(n_cells, 8);
+    CHECK_EQUAL_UINT((unsigned int)keys.size(), 8);
+    CHECK_EQUAL_UINT(keys[1], ci(1, 1, 1));
+    CHECK_EQUAL_UINT(keys[3], ci(1, 0, 1));
+    CHECK_EQUAL_UINT(keys[5], ci(1, 1, 0));
+    CHECK_EQUAL_UINT(keys[7], ci(1, 0, 0));
+    for (unsigned int i = 0; i < 8; i += 2)
+        UP_ASSERT(keys[i] >= n_cells);
+
+    // the sorter puts the embedded particles first in the order of the cells
+    auto trigger = std::make_shared<PeriodicTrigger>(1);
+    std::shared_ptr<SFCPackTuner> sorter(new SFC(sysdef, trigger));
+    sorter->setGrid(8);
+    sorter->setSortKeyProvider(cl);
+    sorter->update(0);
+        {
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+        CHECK_EQUAL_UINT(h_tag.data[0], 7);
+        CHECK_EQUAL_UINT(h_tag.data[1], 5);
+        CHECK_EQUAL_UINT(h_tag.data[2], 3);
+        CHECK_EQUAL_UINT(h_tag.data[3], 1);
+        for (unsigned int i = 4; i < 8; ++i)
+            CHECK_EQUAL_UINT(h_tag.data[i] % 2, 0);
+
+        ArrayHandle<unsigned int> h_rtag(pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::read);
+        for (unsigned int i = 0; i < 8; ++i)
+            CHECK_EQUAL_UINT(h_rtag.data[h_tag.data[i]], i);
+        }
+    }
+
+//! Test that incremental builds give the same cells as full builds
+template<class CL>
+void celllist_incremental_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    auto box = std::make_shared<BoxDim>(6.0);
+    auto sysdef = std::make_shared<hoomd::SystemDefinition>(0, box, 1, 0, 0, 0, 0, exec_conf);
+    auto pdata = std::make_shared<mpcd::ParticleData>(1000, box, 1.0, 42, 3, exec_conf);
+    sysdef->setMPCDParticleData(pdata);
+
+    std::shared_ptr<mpcd::CellList> cl_full(new CL(sysdef));
+    std::shared_ptr<mpcd::CellList> cl(new CL(sysdef));
+    UP_ASSERT(!cl->getIncremental());
+    cl->setIncremental(true);
+    UP_ASSERT(cl->getIncremental());
+
+    for (uint64_t timestep = 0; timestep < 10; ++timestep)
+        {
+        // stream the particles a small amount, and add virtual particles on every other step
+        pdata->removeVirtualParticles();
+        if (timestep % 2 == 0)
+            pdata->addVirtualParticles(3);
+            {
+            ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                    access_location::host,
+                                                    access_mode::readwrite);
+            ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                    access_location::host,
+                                                    access_mode::read);
+            for (unsigned int i = 0; i < pdata->getN(); ++i)
+                {
+                const mpcd::SolventScalar4 vel = h_vel.data[i];
+                Scalar3 pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+                pos += Scalar(0.2) * make_scalar3(vel.x, vel.y, vel.z);
+                int3 image = make_int3(0, 0, 0);
+                box->wrap(pos, image);
+                h_pos.data[i] = mpcd::make_solvent_scalar4(pos.x, pos.y, pos.z, h_pos.data[i].w);
+                }
+            for (unsigned int i = 0; i < pdata->getNVirtual(); ++i)
+                {
+                const Scalar x = Scalar(-2.5) + Scalar(0.3) * timestep;
+                h_pos.data[pdata->getN() + i] = mpcd::make_solvent_scalar4(x, x, x, 0);
+                }
+            }
+
+        // shift the grid by a different amount on each step
+        const Scalar shift = Scalar(0.1) * (timestep % 4) - Scalar(0.15);
+        cl_full->setGridShift(make_scalar3(shift, -shift, shift));
+        cl->setGridShift(make_scalar3(shift, -shift, shift));
+        cl_full->compute(timestep);
+        cl->compute(timestep);
+
+        // each cell should have the same particles, possibly in a different order
+        ArrayHandle<unsigned int> h_np_full(cl_full->getCellSizeArray(),
+                                            access_location::host,
+                                            access_mode::read);
+        ArrayHandle<unsigned int> h_cl_full(cl_full->getCellList(),
+                                            access_location::host,
+                                            access_mode::read);
+        ArrayHandle<unsigned int> h_np(cl->getCellSizeArray(),
+                                       access_location::host,
+                                       access_mode::read);
+        ArrayHandle<unsigned int> h_cl(cl->getCellList(), access_location::host, access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        const Index2D cli_full = cl_full->getCellListIndexer();
+        const Index2D cli = cl->getCellListIndexer();
+        unsigned int N_cells = 0;
+        for (unsigned int cell = 0; cell < cl->getNCells(); ++cell)
+            {
+            UP_ASSERT_EQUAL(h_np.data[cell], h_np_full.data[cell]);
+            std::vector<unsigned int> members_full, members;
+            for (unsigned int offset = 0; offset < h_np.data[cell]; ++offset)
+                {
+                members_full.push_back(h_cl_full.data[cli_full(offset, cell)]);
+                members.push_back(h_cl.data[cli(offset, cell)]);
+                UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[members.back()].w), cell);
+                }
+            std::sort(members_full.begin(), members_full.end());
+            std::sort(members.begin(), members.end());
+            UP_ASSERT_EQUAL(members, members_full);
+            N_cells += h_np.data[cell];
+            }
+        CHECK_EQUAL_UINT(N_cells, pdata->getN() + pdata->getNVirtual());
+        }
+    }
+
 //! dimension test case for MPCD CellList class
 UP_TEST(mpcd_cell_list_dimensions)
     {
@@ -679,6 +845,20 @@ UP_TEST(mpcd_cell_list_embed_test)
         new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
 
+//! incremental build test case for MPCD CellList class
+UP_TEST(mpcd_cell_list_incremental_test)
+    {
+    celllist_incremental_test<mpcd::CellList>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
+//! embedded particle sort test case for MPCD CellList class
+UP_TEST(mpcd_cell_list_sort_keys_test)
+    {
+    celllist_sort_keys_test<mpcd::CellList, SFCPackTuner>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
 #ifdef ENABLE_HIP
 //! dimension test case for MPCD CellListGPU class
 UP_TEST(mpcd_cell_list_gpu_dimensions)
@@ -707,4 +887,12 @@ UP_TEST(mpcd_cell_list_gpu_embed_test)
     celllist_embed_test<mpcd::CellListGPU>(std::shared_ptr<ExecutionConfiguration>(
         new ExecutionConfiguration(ExecutionConfiguration::GPU)));
     }
+
+//! embedded particle sort test case for MPCD CellListGPU class
+UP_TEST(mpcd_cell_list_gpu_sort_keys_test)
+    {
+    celllist_sort_keys_test<mpcd::CellListGPU, SFCPackTunerGPU>(
+        std::shared_ptr<ExecutionConfiguration>(
+            new ExecutionConfiguration(ExecutionConfiguration::GPU)));
+    }
 #endif // ENABLE_HIP
@@ -12,6 +12,9 @@
 #include "hoomd/filter/ParticleFilterAll.h"
 #include "hoomd/test/upp11_config.h"
 
+#include <cstring>
+#include <random>
+
 HOOMD_UP_MAIN()
 
 using namespace hoomd;
@@ -155,10 +158,10 @@ template<class CT> void cell_thermo_basic_test(std::shared_ptr<ExecutionConfigur
     // switch a particle into a different cell, and make sure the DOF are reduced accordingly
     pdata_5->setMass(1.0);
         {
-        ArrayHandle<Scalar4> h_pos(pdata_5->getPositions(),
-                                   access_location::host,
-                                   access_mode::readwrite);
-        h_pos.data[2] = make_scalar4(-0.5, -0.5, -0.5, 0.0);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata_5->getPositions(),
+                                                access_location::host,
+                                                access_mode::readwrite);
+        h_pos.data[2] = mpcd::make_solvent_scalar4(-0.5, -0.5, -0.5, 0.0);
         }
     thermo->compute(2);
         {
@@ -325,6 +328,83 @@ template<class CT> void cell_thermo_embed_test(std::shared_ptr<ExecutionConfigur
         }
     }
 
+#if defined(ENABLE_HIP) && defined(HOOMD_FIXED_POINT_ACCUMULATION)
+//! Test that the cell thermo properties are reproducible in fixed point
+/*!
+ * The cell properties are computed with every parameter of the autotuners, which changes the
+ * threads per cell and the block sizes, and for two orders of the particles. The cell list also
+ * orders the particles within each cell differently from build to build. In fixed point, every
+ * cell property should be bitwise identical.
+ */
+void cell_thermo_fixed_point_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    const unsigned int N = 5000;
+    std::vector<vec3<Scalar>> pos(N), vel(N);
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<Scalar> pos_dist(-5.0, 5.0);
+    std::normal_distribution<Scalar> vel_dist(0.0, 1.0);
+    for (unsigned int i = 0; i < N; ++i)
+        {
+        pos[i] = vec3<Scalar>(pos_dist(gen), pos_dist(gen), pos_dist(gen));
+        vel[i] = vec3<Scalar>(vel_dist(gen), vel_dist(gen), vel_dist(gen));
+        }
+
+    std::vector<double4> ref_vel;
+    std::vector<double3> ref_energy;
+    for (unsigned int reverse = 0; reverse < 2; ++reverse)
+        {
+        std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+        snap->global_box = std::make_shared<BoxDim>(10.0);
+        snap->particle_data.type_mapping.push_back("A");
+        snap->mpcd_data.resize(N);
+        snap->mpcd_data.type_mapping.push_back("A");
+        for (unsigned int i = 0; i < N; ++i)
+            {
+            const unsigned int j = (reverse) ? N - 1 - i : i;
+            snap->mpcd_data.position[i] = pos[j];
+            snap->mpcd_data.velocity[i] = vel[j];
+            }
+        std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+
+        auto cl = std::make_shared<mpcd::CellList>(sysdef);
+        auto thermo = std::make_shared<mpcd::CellThermoComputeGPU>(sysdef, cl);
+        AllThermoRequest thermo_req(thermo);
+        cl->startAutotuning();
+        thermo->startAutotuning();
+
+        uint64_t timestep = 0;
+        do
+            {
+            thermo->compute(timestep++);
+
+            const unsigned int n_cells = cl->getCellIndexer().getNumElements();
+            ArrayHandle<double4> h_cell_vel(thermo->getCellVelocities(),
+                                            access_location::host,
+                                            access_mode::read);
+            ArrayHandle<double3> h_cell_energy(thermo->getCellEnergies(),
+                                               access_location::host,
+                                               access_mode::read);
+            if (ref_vel.empty())
+                {
+                ref_vel.assign(h_cell_vel.data, h_cell_vel.data + n_cells);
+                ref_energy.assign(h_cell_energy.data, h_cell_energy.data + n_cells);
+                }
+            else
+                {
+                UP_ASSERT_EQUAL(ref_vel.size(), n_cells);
+                UP_ASSERT(std::memcmp(h_cell_vel.data, ref_vel.data(), sizeof(double4) * n_cells)
+                          == 0);
+                UP_ASSERT(
+                    std::memcmp(h_cell_energy.data, ref_energy.data(), sizeof(double3) * n_cells)
+                    == 0);
+                }
+            } while ((!thermo->isAutotuningComplete() || !cl->isAutotuningComplete())
+                     && timestep < 10000);
+        UP_ASSERT(thermo->isAutotuningComplete());
+        }
+    }
+#endif // ENABLE_HIP && HOOMD_FIXED_POINT_ACCUMULATION
+
 UP_TEST(mpcd_cell_thermo_basic)
     {
     cell_thermo_basic_test<mpcd::CellThermoCompute>(std::shared_ptr<ExecutionConfiguration>(
@@ -347,4 +427,11 @@ UP_TEST(mpcd_cell_thermo_embed_gpu)
     cell_thermo_embed_test<mpcd::CellThermoComputeGPU>(std::shared_ptr<ExecutionConfiguration>(
         new ExecutionConfiguration(ExecutionConfiguration::GPU)));
     }
+#ifdef HOOMD_FIXED_POINT_ACCUMULATION
+UP_TEST(mpcd_cell_thermo_fixed_point_gpu)
+    {
+    cell_thermo_fixed_point_test(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU)));
+    }
+#endif // HOOMD_FIXED_POINT_ACCUMULATION
 #endif // ENABLE_HIP
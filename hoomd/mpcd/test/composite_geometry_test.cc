@@ -0,0 +1,114 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/mpcd/StreamingGeometry.h"
+
+#include "hoomd/test/upp11_config.h"
+
+HOOMD_UP_MAIN()
+
+using namespace hoomd;
+
+//! Test collisions with the walls of a cosine channel composed with a slit pore
+/*!
+ * The channel walls are flat at z = +/-5, and the pore walls are at z = +/-2 for |x| < 1. The
+ * composite is checked for collisions with each geometry separately and for a particle that ended
+ * up outside both, which must be reflected from the pore wall that it crossed first.
+ */
+UP_TEST(composite_geometry_collision)
+    {
+    const mpcd::detail::CosineChannel channel(20, 0, 5, 1, mpcd::detail::boundary::no_slip);
+    const mpcd::detail::SlitPoreGeometry pore(2, 1, mpcd::detail::boundary::no_slip);
+    const mpcd::detail::CosineChannelPore geom(channel, pore);
+    UP_ASSERT_EQUAL(mpcd::detail::CosineChannelPore::getName(),
+                    std::string("CompositeCosineChannelSlitPore"));
+
+    // particle inside both geometries does not collide
+        {
+        Scalar3 pos = make_scalar3(0, 0, 0);
+        Scalar3 vel = make_scalar3(1, 1, 1);
+        Scalar dt = 0.1;
+        UP_ASSERT(!geom.isOutside(pos));
+        UP_ASSERT(!geom.detectCollision(pos, vel, dt));
+        CHECK_SMALL(dt, tol_small);
+        }
+
+    // particle inside the channel collides with the top wall of the pore
+        {
+        Scalar3 pos = make_scalar3(0, 1, 2.5);
+        Scalar3 vel = make_scalar3(0, 1, 1);
+        Scalar dt = 1.0;
+        UP_ASSERT(geom.isOutside(pos));
+        UP_ASSERT(geom.detectCollision(pos, vel, dt));
+        CHECK_SMALL(pos.x, tol_small);
+        CHECK_CLOSE(pos.y, 0.5, tol_small);
+        CHECK_CLOSE(pos.z, 2, tol_small);
+        CHECK_CLOSE(dt, 0.5, tol_small);
+        CHECK_SMALL(vel.x, tol_small);
+        CHECK_CLOSE(vel.y, -1, tol_small);
+        CHECK_CLOSE(vel.z, -1, tol_small);
+        }
+
+    // particle away from the pore collides with the bottom wall of the channel
+        {
+        Scalar3 pos = make_scalar3(3, 1, -5.5);
+        Scalar3 vel = make_scalar3(0, 1, -1);
+        Scalar dt = 1.0;
+        UP_ASSERT(geom.isOutside(pos));
+        UP_ASSERT(geom.detectCollision(pos, vel, dt));
+        CHECK_CLOSE(pos.x, 3, tol_small);
+        CHECK_CLOSE(pos.y, 0.5, tol_small);
+        CHECK_CLOSE(pos.z, -5, tol_small);
+        CHECK_CLOSE(dt, 0.5, tol_small);
+        CHECK_SMALL(vel.x, tol_small);
+        CHECK_CLOSE(vel.y, -1, tol_small);
+        CHECK_CLOSE(vel.z, 1, tol_small);
+        }
+
+    // particle moving in x collides with the side of the pore
+        {
+        Scalar3 pos = make_scalar3(-0.75, 0, 3);
+        Scalar3 vel = make_scalar3(1, 0, 0);
+        Scalar dt = 1.0;
+        UP_ASSERT(geom.isOutside(pos));
+        UP_ASSERT(geom.detectCollision(pos, vel, dt));
+        CHECK_CLOSE(pos.x, -1, tol_small);
+        CHECK_SMALL(pos.y, tol_small);
+        CHECK_CLOSE(pos.z, 3, tol_small);
+        CHECK_CLOSE(dt, 0.25, tol_small);
+        CHECK_CLOSE(vel.x, -1, tol_small);
+        CHECK_SMALL(vel.y, tol_small);
+        CHECK_SMALL(vel.z, tol_small);
+        }
+
+    // particle outside both geometries is reflected from the pore, which it crossed first
+        {
+        Scalar3 pos = make_scalar3(0, 0, 5.5);
+        Scalar3 vel = make_scalar3(0, 0, 1);
+        Scalar dt = 4.0;
+        UP_ASSERT(channel.isOutside(pos));
+        UP_ASSERT(pore.isOutside(pos));
+        UP_ASSERT(geom.isOutside(pos));
+        UP_ASSERT(geom.detectCollision(pos, vel, dt));
+        CHECK_SMALL(pos.x, tol_small);
+        CHECK_SMALL(pos.y, tol_small);
+        CHECK_CLOSE(pos.z, 2, tol_small);
+        CHECK_CLOSE(dt, 3.5, tol_small);
+        CHECK_SMALL(vel.x, tol_small);
+        CHECK_SMALL(vel.y, tol_small);
+        CHECK_CLOSE(vel.z, -1, tol_small);
+        }
+    }
+
+//! Test that the box must be valid for both geometries
+UP_TEST(composite_geometry_validate_box)
+    {
+    const mpcd::detail::CosineChannel channel(20, 0, 5, 1, mpcd::detail::boundary::no_slip);
+    const mpcd::detail::SlitPoreGeometry pore(2, 1, mpcd::detail::boundary::no_slip);
+    const mpcd::detail::CosineChannelPore geom(channel, pore);
+
+    UP_ASSERT(geom.validateBox(BoxDim(20, 20, 14), 1.0));
+    // too small in z for the channel, but still fine for the pore
+    UP_ASSERT(pore.validateBox(BoxDim(20, 20, 10), 1.0));
+    UP_ASSERT(!geom.validateBox(BoxDim(20, 20, 10), 1.0));
+    }
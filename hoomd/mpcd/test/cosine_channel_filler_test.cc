@@ -0,0 +1,280 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/mpcd/CosineChannelFiller.h"
+#ifdef ENABLE_HIP
+#include "hoomd/mpcd/CosineChannelFillerGPU.h"
+#endif // ENABLE_HIP
+
+#include "hoomd/SnapshotSystemData.h"
+#include "hoomd/test/upp11_config.h"
+
+HOOMD_UP_MAIN()
+
+using namespace hoomd;
+
+template<class F>
+void cosine_channel_fill_basic_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(20.0);
+    snap->particle_data.type_mapping.push_back("A");
+    snap->mpcd_data.resize(1);
+    snap->mpcd_data.type_mapping.push_back("A");
+    snap->mpcd_data.position[0] = vec3<Scalar>(1, -2, 3);
+    snap->mpcd_data.velocity[0] = vec3<Scalar>(123, 456, 789);
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+
+    auto pdata = sysdef->getMPCDParticleData();
+    auto cl = std::make_shared<mpcd::CellList>(sysdef);
+    cl->setCellSize(2.0);
+    UP_ASSERT_EQUAL(pdata->getNVirtual(), 0);
+
+    // create cosine channel with amplitude 2, half width 2, and one repetition
+    const auto bc = mpcd::detail::boundary::no_slip;
+    auto geom = std::make_shared<const mpcd::detail::CosineChannel>(20.0, 2.0, 2.0, 1, bc);
+    std::shared_ptr<Variant> kT = std::make_shared<VariantConstant>(1.5);
+    std::shared_ptr<mpcd::CosineChannelFiller> filler
+        = std::make_shared<F>(sysdef, 2.0, 1, kT, geom);
+    filler->setCellList(cl);
+
+    /*
+     * The layer extends one cell size past the highest point of the wall within one cell size
+     * along x. Over one period, its cross-sectional area is the cell size times the box length,
+     * plus the area between this height and the wall: 2 a A + (2 A / k) sin(k (L/2 - a)).
+     */
+    const Scalar k = Scalar(2.0 * M_PI) / Scalar(20.0);
+    const Scalar area = Scalar(2.0) * Scalar(20.0) + Scalar(2.0 * 2.0 * 2.0)
+                        + Scalar(2.0 * 2.0) / k * std::sin(k * Scalar(8.0));
+    const unsigned int N_layer = (unsigned int)std::round(20.0 * area * 2.0);
+
+    // local thickness of the layer at x, computed by searching the wall within one cell size
+    auto thickness = [k](Scalar x, signed char sign)
+    {
+        const Scalar wall = Scalar(2.0) * std::cos(k * x);
+        Scalar wall_min(wall), wall_max(wall);
+        for (unsigned int i = 0; i <= 1000; ++i)
+            {
+            const Scalar w = Scalar(2.0) * std::cos(k * (x - Scalar(2.0) + i * Scalar(0.004)));
+            wall_min = std::min(wall_min, w);
+            wall_max = std::max(wall_max, w);
+            }
+        return Scalar(2.0) + ((sign < 0) ? wall - wall_min : wall_max - wall);
+    };
+
+    /*
+     * Test basic filling up for this cell list
+     */
+    filler->fill(0);
+    UP_ASSERT_EQUAL(pdata->getNVirtual(), 2 * N_layer);
+        // count that particles have been placed on the right sides
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+
+        // ensure first particle did not get overwritten
+        CHECK_CLOSE(h_pos.data[0].x, 1, tol_small);
+        CHECK_CLOSE(h_pos.data[0].y, -2, tol_small);
+        CHECK_CLOSE(h_pos.data[0].z, 3, tol_small);
+        CHECK_CLOSE(h_vel.data[0].x, 123, tol_small);
+        CHECK_CLOSE(h_vel.data[0].y, 456, tol_small);
+        CHECK_CLOSE(h_vel.data[0].z, 789, tol_small);
+        UP_ASSERT_EQUAL(h_tag.data[0], 0);
+
+        unsigned int N_lo(0), N_hi(0);
+        for (unsigned int i = pdata->getN(); i < pdata->getN() + pdata->getNVirtual(); ++i)
+            {
+            // tag should equal index on one rank with one filler
+            UP_ASSERT_EQUAL(h_tag.data[i], i);
+            // type should be set
+            UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[i].w), 1);
+
+            // particle should lie outside the channel, within the layer
+            const Scalar x = h_pos.data[i].x;
+            const Scalar dz = h_pos.data[i].z - Scalar(2.0) * std::cos(k * x);
+            if (dz < 0)
+                {
+                UP_ASSERT(dz <= -Scalar(2.0) + tol_small);
+                UP_ASSERT(dz >= -Scalar(2.0) - thickness(x, -1) - tol_small);
+                ++N_lo;
+                }
+            else
+                {
+                UP_ASSERT(dz >= Scalar(2.0) - tol_small);
+                UP_ASSERT(dz <= Scalar(2.0) + thickness(x, 1) + tol_small);
+                ++N_hi;
+                }
+            }
+        UP_ASSERT_EQUAL(N_lo, N_layer);
+        UP_ASSERT_EQUAL(N_hi, N_layer);
+        }
+
+    /*
+     * Fill the volume again, which should double the number of virtual particles
+     */
+    filler->fill(1);
+    UP_ASSERT_EQUAL(pdata->getNVirtual(), 2 * 2 * N_layer);
+        {
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+        for (unsigned int i = pdata->getN(); i < pdata->getN() + pdata->getNVirtual(); ++i)
+            {
+            UP_ASSERT_EQUAL(h_tag.data[i], i);
+            }
+        }
+
+    /*
+     * Test the average properties of the virtual particles.
+     */
+    unsigned int N_avg(0);
+    Scalar3 v_avg = make_scalar3(0, 0, 0);
+    Scalar T_avg(0);
+    for (unsigned int t = 0; t < 500; ++t)
+        {
+        pdata->removeVirtualParticles();
+        filler->fill(2 + t);
+
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        for (unsigned int i = pdata->getN(); i < pdata->getN() + pdata->getNVirtual(); ++i)
+            {
+            const mpcd::SolventScalar4 vel_cell = h_vel.data[i];
+            const Scalar3 vel = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
+            v_avg += vel;
+            T_avg += dot(vel, vel);
+            ++N_avg;
+            }
+        }
+    UP_ASSERT_EQUAL(N_avg, 500 * 2 * N_layer);
+    v_avg /= N_avg;
+    T_avg /= (3 * (N_avg - 1));
+
+    CHECK_SMALL(v_avg.x, tol);
+    CHECK_SMALL(v_avg.y, tol);
+    CHECK_SMALL(v_avg.z, tol);
+    CHECK_CLOSE(T_avg, 1.5, tol);
+    }
+
+//! Test that the virtual particles are binned into the same cells as the cell list bins them
+void cosine_channel_fill_bin_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(20.0);
+    snap->particle_data.type_mapping.push_back("A");
+    snap->mpcd_data.resize(1);
+    snap->mpcd_data.type_mapping.push_back("A");
+    snap->mpcd_data.position[0] = vec3<Scalar>(1, -2, 3);
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+
+    auto pdata = sysdef->getMPCDParticleData();
+    auto cl = std::make_shared<mpcd::CellList>(sysdef);
+    cl->setCellSize(2.0);
+
+    const auto bc = mpcd::detail::boundary::no_slip;
+    auto geom = std::make_shared<const mpcd::detail::CosineChannel>(20.0, 2.0, 2.0, 1, bc);
+    std::shared_ptr<Variant> kT = std::make_shared<VariantConstant>(1.5);
+    auto filler = std::make_shared<mpcd::CosineChannelFiller>(sysdef, 2.0, 1, kT, geom);
+    filler->setCellList(cl);
+
+    // the particles are not binned until the dimensions are computed
+    filler->fill(0);
+    UP_ASSERT(!cl->getVirtualCellsValid());
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        for (unsigned int i = pdata->getN(); i < pdata->getN() + pdata->getNVirtual(); ++i)
+            {
+            UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[i].w), mpcd::detail::NO_CELL);
+            }
+        }
+
+    // the particles are binned while they are drawn once the dimensions are known
+    const Scalar3 shift = make_scalar3(0.5, -0.25, 0.75);
+    cl->computeDimensions();
+    cl->setGridShift(shift);
+    pdata->removeVirtualParticles();
+    filler->fill(1);
+    UP_ASSERT(cl->getVirtualCellsValid());
+    std::vector<unsigned int> cells(pdata->getNVirtual());
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        for (unsigned int i = 0; i < pdata->getNVirtual(); ++i)
+            {
+            cells[i] = mpcd::__solvent_scalar_as_int(h_vel.data[pdata->getN() + i].w);
+            UP_ASSERT(cells[i] != mpcd::detail::NO_CELL);
+            }
+        }
+
+    // the binned particles are appended to their cells after the MPCD particle
+    cl->compute(1);
+        {
+        ArrayHandle<unsigned int> h_cell_list(cl->getCellList(),
+                                              access_location::host,
+                                              access_mode::read);
+        ArrayHandle<unsigned int> h_cell_np(cl->getCellSizeArray(),
+                                            access_location::host,
+                                            access_mode::read);
+        const Index2D& cli = cl->getCellListIndexer();
+        std::vector<unsigned int> found(pdata->getNVirtual(), 0);
+        for (unsigned int cell = 0; cell < cl->getNCells(); ++cell)
+            {
+            for (unsigned int offset = 0; offset < h_cell_np.data[cell]; ++offset)
+                {
+                const unsigned int pid = h_cell_list.data[cli(offset, cell)];
+                if (pid < pdata->getN())
+                    {
+                    UP_ASSERT_EQUAL(offset, 0);
+                    continue;
+                    }
+                UP_ASSERT_EQUAL(cell, cells[pid - pdata->getN()]);
+                ++found[pid - pdata->getN()];
+                }
+            }
+        for (unsigned int i = 0; i < pdata->getNVirtual(); ++i)
+            {
+            UP_ASSERT_EQUAL(found[i], 1);
+            }
+        }
+
+    // changing the grid shift makes the cell list bin them again, into the same cells
+    cl->setGridShift(make_scalar3(0, 0, 0));
+    cl->setGridShift(shift);
+    UP_ASSERT(!cl->getVirtualCellsValid());
+    cl->compute(2);
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        for (unsigned int i = 0; i < pdata->getNVirtual(); ++i)
+            {
+            UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[pdata->getN() + i].w),
+                            cells[i]);
+            }
+        }
+    }
+
+UP_TEST(cosine_channel_fill_basic)
+    {
+    cosine_channel_fill_basic_test<mpcd::CosineChannelFiller>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU));
+    }
+UP_TEST(cosine_channel_fill_bin)
+    {
+    cosine_channel_fill_bin_test(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU));
+    }
+#ifdef ENABLE_HIP
+UP_TEST(cosine_channel_fill_basic_gpu)
+    {
+    cosine_channel_fill_basic_test<mpcd::CosineChannelFillerGPU>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU));
+    }
+#endif // ENABLE_HIP
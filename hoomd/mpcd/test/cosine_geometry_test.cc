@@ -0,0 +1,181 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/mpcd/CosineChannelGeometry.h"
+#include "hoomd/mpcd/CosineExpansionContractionGeometry.h"
+#include "hoomd/mpcd/CosineWallMotion.h"
+
+#include "hoomd/test/upp11_config.h"
+
+HOOMD_UP_MAIN()
+
+using namespace hoomd;
+
+//! Test collisions with the walls of a cosine geometry
+/*!
+ * The top wall of the geometry must be z = amplitude*cos(k*x) + offset, and the bottom wall must be
+ * at z = bottom for x = 0. The geometry is checked for a vertical collision at the top and bottom
+ * walls, a horizontal collision with slip, and a particle that stays inside the channel.
+ */
+template<class Geometry>
+void cosine_geometry_collision_test(const Geometry& no_slip,
+                                    const Geometry& slip,
+                                    Scalar amplitude,
+                                    Scalar offset,
+                                    Scalar bottom,
+                                    Scalar k)
+    {
+    // particle inside the channel does not collide
+        {
+        Scalar3 pos = make_scalar3(0, 0, 0);
+        Scalar3 vel = make_scalar3(1, 1, 0);
+        Scalar dt = 0.1;
+        UP_ASSERT(!no_slip.isOutside(pos));
+        UP_ASSERT(!no_slip.detectCollision(pos, vel, dt));
+        CHECK_SMALL(dt, tol_small);
+        }
+
+    // vertical collision with the top wall at x = 0, ending 0.5 outside the wall
+        {
+        const Scalar z_wall = amplitude + offset;
+        Scalar3 pos = make_scalar3(0, 1, z_wall + Scalar(0.5));
+        Scalar3 vel = make_scalar3(0, 1, 1);
+        Scalar dt = 1.0;
+        UP_ASSERT(no_slip.isOutside(pos));
+        UP_ASSERT(no_slip.detectCollision(pos, vel, dt));
+        CHECK_SMALL(pos.x, tol_small);
+        CHECK_CLOSE(pos.y, 0.5, tol_small);
+        CHECK_CLOSE(pos.z, z_wall, tol_small);
+        CHECK_CLOSE(dt, 0.5, tol_small);
+        CHECK_SMALL(vel.x, tol_small);
+        CHECK_CLOSE(vel.y, -1, tol_small);
+        CHECK_CLOSE(vel.z, -1, tol_small);
+        }
+
+    // same collision with the bottom wall
+        {
+        const Scalar z_wall = bottom;
+        Scalar3 pos = make_scalar3(0, 1, z_wall - Scalar(0.5));
+        Scalar3 vel = make_scalar3(0, 1, -1);
+        Scalar dt = 1.0;
+        UP_ASSERT(no_slip.isOutside(pos));
+        UP_ASSERT(no_slip.detectCollision(pos, vel, dt));
+        CHECK_SMALL(pos.x, tol_small);
+        CHECK_CLOSE(pos.y, 0.5, tol_small);
+        CHECK_CLOSE(pos.z, z_wall, tol_small);
+        CHECK_CLOSE(dt, 0.5, tol_small);
+        CHECK_SMALL(vel.x, tol_small);
+        CHECK_CLOSE(vel.y, -1, tol_small);
+        CHECK_CLOSE(vel.z, 1, tol_small);
+        }
+
+    // horizontal collision with the top wall where cos(k*x) = 1/2, which is at x = pi/(3k)
+        {
+        const Scalar x_wall = Scalar(M_PI) / (Scalar(3) * k);
+        const Scalar z_wall = Scalar(0.5) * amplitude + offset;
+        Scalar3 pos = make_scalar3(x_wall + Scalar(0.25), 0, z_wall);
+        Scalar3 vel = make_scalar3(1, 0, 0);
+        Scalar dt = 1.0;
+        UP_ASSERT(slip.isOutside(pos));
+        UP_ASSERT(slip.detectCollision(pos, vel, dt));
+        CHECK_CLOSE(pos.x, x_wall, tol_small);
+        CHECK_SMALL(pos.y, tol_small);
+        CHECK_CLOSE(pos.z, z_wall, tol_small);
+        CHECK_CLOSE(dt, 0.25, tol_small);
+
+        // normal component of the velocity is reflected
+        const Scalar B = amplitude * k * std::sin(k * x_wall);
+        const Scalar vn = B / (B * B + Scalar(1));
+        CHECK_CLOSE(vel.x, Scalar(1) - Scalar(2) * B * vn, tol_small);
+        CHECK_SMALL(vel.y, tol_small);
+        CHECK_CLOSE(vel.z, -Scalar(2) * vn, tol_small);
+        }
+    }
+
+UP_TEST(cosine_channel_collision)
+    {
+    const Scalar L = 10;
+    const Scalar A = 1;
+    const Scalar h = 2;
+    const mpcd::detail::CosineChannel no_slip(L, A, h, 1, mpcd::detail::boundary::no_slip);
+    const mpcd::detail::CosineChannel slip(L, A, h, 1, mpcd::detail::boundary::slip);
+    cosine_geometry_collision_test(no_slip, slip, A, h, A - h, Scalar(2.0 * M_PI) / L);
+    }
+
+UP_TEST(cosine_expansion_contraction_collision)
+    {
+    const Scalar L = 10;
+    const Scalar H = 4;
+    const Scalar h = 2;
+    const Scalar A = Scalar(0.5) * (H - h);
+    const mpcd::detail::CosineExpansionContraction no_slip(L,
+                                                           H,
+                                                           h,
+                                                           1,
+                                                           mpcd::detail::boundary::no_slip);
+    const mpcd::detail::CosineExpansionContraction slip(L, H, h, 1, mpcd::detail::boundary::slip);
+    cosine_geometry_collision_test(no_slip, slip, A, A + h, -H, Scalar(2.0 * M_PI) / L);
+    }
+
+//! Test collisions with moving cosine channel walls
+UP_TEST(cosine_channel_moving_walls)
+    {
+    const Scalar L = 10;
+    const Scalar A = 1;
+    const Scalar h = 2;
+    const Scalar k = Scalar(2.0 * M_PI) / L;
+    mpcd::detail::CosineChannel geom(L, A, h, 1, mpcd::detail::boundary::no_slip);
+
+    // a quarter phase puts the wall zero crossing at x = 0, where the wall moves down fastest
+    const Scalar c = 0.5;
+    const Scalar V = 0.3;
+    geom.setWallMotion(A, Scalar(0.5 * M_PI), c, V);
+    UP_ASSERT(!geom.isOutside(make_scalar3(0, 0, 1.9)));
+    UP_ASSERT(geom.isOutside(make_scalar3(0, 0, 2.1)));
+
+    // vertical collision with the top wall reflects the velocity relative to the wall
+        {
+        Scalar3 pos = make_scalar3(0, 1, 2.5);
+        Scalar3 vel = make_scalar3(0, 1, 1);
+        Scalar dt = 1.0;
+        UP_ASSERT(geom.detectCollision(pos, vel, dt));
+        CHECK_SMALL(pos.x, tol_small);
+        CHECK_CLOSE(pos.y, 0.5, tol_small);
+        CHECK_CLOSE(pos.z, 2, tol_small);
+        CHECK_CLOSE(dt, 0.5, tol_small);
+        CHECK_CLOSE(vel.x, 2 * V, tol_small);
+        CHECK_CLOSE(vel.y, -1, tol_small);
+        CHECK_CLOSE(vel.z, -2 * A * k * c - 1, tol_small);
+        }
+
+    // the motion advances the phase with the phase velocity and sets the other parameters
+    auto base = std::make_shared<const mpcd::detail::CosineChannel>(L,
+                                                                    A,
+                                                                    h,
+                                                                    1,
+                                                                    mpcd::detail::boundary::slip);
+    mpcd::CosineWallMotion<mpcd::detail::CosineChannel> motion(
+        base,
+        10,
+        std::make_shared<VariantConstant>(2.0),
+        std::make_shared<VariantConstant>(c),
+        std::make_shared<VariantConstant>(V));
+    auto moving = motion.getGeometry();
+    UP_ASSERT(moving != base);
+    UP_ASSERT_EQUAL(motion.getVersion(), 1);
+    CHECK_CLOSE(moving->getAmplitude(), 2, tol_small);
+    CHECK_SMALL(moving->getPhase(), tol_small);
+    CHECK_CLOSE(moving->getPhaseVelocity(), c, tol_small);
+    CHECK_CLOSE(moving->getVelocity(), V, tol_small);
+    CHECK_CLOSE(base->getAmplitude(), A, tol_small);
+
+    motion.update(10, 1.0);
+    UP_ASSERT_EQUAL(motion.getVersion(), 1);
+    motion.update(12, 2.0);
+    UP_ASSERT_EQUAL(motion.getVersion(), 2);
+    CHECK_CLOSE(moving->getPhase(), 2 * k * c, tol_small);
+
+    // the phase wraps into [0, 2 pi)
+    motion.update(32, 2.0 * M_PI / (k * c));
+    CHECK_CLOSE(moving->getPhase(), 2 * k * c, tol);
+    }
@@ -110,6 +110,46 @@ UP_TEST(sine_force_cpu)
     test_external_field(exec_conf, field, ref_pos, ref_force);
     }
 
+//! Test that the evaluators give the same force as the polymorphic fields
+UP_TEST(field_evaluators)
+    {
+    const mpcd::BlockForce block(2.0, 1.5, 0.5);
+    const mpcd::ConstantForce constant(make_scalar3(6, 7, 8));
+    const mpcd::SineForce sine(2.0, M_PI);
+    UP_ASSERT(block.getEvaluator().hasField());
+    UP_ASSERT(constant.getEvaluator().hasField());
+    UP_ASSERT(sine.getEvaluator().hasField());
+
+    const mpcd::detail::PolymorphicFieldEvaluator no_field(nullptr);
+    UP_ASSERT(!no_field.hasField());
+    const mpcd::detail::PolymorphicFieldEvaluator polymorphic(&sine);
+    UP_ASSERT(polymorphic.hasField());
+
+    const std::vector<Scalar3> ref_pos
+        = {make_scalar3(1, 2, 1.25), make_scalar3(-1, 0, -1.75), make_scalar3(0, 0, 0.25)};
+    for (const auto& r : ref_pos)
+        {
+        const Scalar3 f_block = block.getEvaluator().evaluate(r);
+        UP_ASSERT_CLOSE(f_block.x, block.evaluate(r).x, tol_small);
+        UP_ASSERT_SMALL(f_block.y, tol_small);
+        UP_ASSERT_SMALL(f_block.z, tol_small);
+
+        const Scalar3 f_constant = constant.getEvaluator().evaluate(r);
+        UP_ASSERT_CLOSE(f_constant.x, 6, tol_small);
+        UP_ASSERT_CLOSE(f_constant.y, 7, tol_small);
+        UP_ASSERT_CLOSE(f_constant.z, 8, tol_small);
+
+        const Scalar3 f_sine = sine.getEvaluator().evaluate(r);
+        UP_ASSERT_CLOSE(f_sine.x, sine.evaluate(r).x, tol_small);
+        UP_ASSERT_CLOSE(polymorphic.evaluate(r).x, f_sine.x, tol_small);
+        }
+
+    // block force is +F in the upper block, -F in the lower block, and zero otherwise
+    UP_ASSERT_CLOSE(block.getEvaluator().evaluate(ref_pos[0]).x, 2.0, tol_small);
+    UP_ASSERT_CLOSE(block.getEvaluator().evaluate(ref_pos[1]).x, -2.0, tol_small);
+    UP_ASSERT_SMALL(block.getEvaluator().evaluate(ref_pos[2]).x, tol_small);
+    }
+
 #ifdef ENABLE_HIP
 //! Test constant force on GPU
 UP_TEST(constant_force_gpu)
@@ -0,0 +1,187 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/mpcd/ChannelFlowFieldAnalyzer.h"
+#include "hoomd/mpcd/FlowFieldAnalyzer.h"
+#ifdef ENABLE_HIP
+#include "hoomd/mpcd/ChannelFlowFieldAnalyzerGPU.h"
+#include "hoomd/mpcd/FlowFieldAnalyzerGPU.h"
+#endif // ENABLE_HIP
+
+#include "hoomd/SnapshotSystemData.h"
+#include "hoomd/test/upp11_config.h"
+
+HOOMD_UP_MAIN()
+
+using namespace hoomd;
+
+//! Test for accumulating a flow field in two bins along x
+template<class T> void flow_field_analyzer_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(2.0);
+    snap->particle_data.type_mapping.push_back("A");
+
+    // two particles in each bin
+    snap->mpcd_data.resize(4);
+    snap->mpcd_data.type_mapping.push_back("A");
+    snap->mpcd_data.position[0] = vec3<Scalar>(-0.5, -0.5, -0.5);
+    snap->mpcd_data.position[1] = vec3<Scalar>(-0.25, 0.5, 0.5);
+    snap->mpcd_data.position[2] = vec3<Scalar>(0.5, -0.5, 0.5);
+    snap->mpcd_data.position[3] = vec3<Scalar>(0.75, 0.5, -0.5);
+    snap->mpcd_data.velocity[0] = vec3<Scalar>(1, 0, 0);
+    snap->mpcd_data.velocity[1] = vec3<Scalar>(3, 0, 0);
+    snap->mpcd_data.velocity[2] = vec3<Scalar>(0, 0, 2);
+    snap->mpcd_data.velocity[3] = vec3<Scalar>(0, 0, -2);
+    snap->mpcd_data.mass = 1.5;
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+
+    auto trigger = std::make_shared<PeriodicTrigger>(1);
+    auto analyzer = std::make_shared<T>(sysdef, trigger, 2, 1, 1, 2);
+    UP_ASSERT_EQUAL(analyzer->getNumSamples(), 2);
+
+    for (unsigned int window = 1; window <= 2; ++window)
+        {
+        // the flow field is not available until the window finishes
+        analyzer->analyze(2 * window);
+        UP_ASSERT_EQUAL(analyzer->getNumWindows(), window - 1);
+        analyzer->analyze(2 * window + 1);
+        UP_ASSERT_EQUAL(analyzer->getNumWindows(), window);
+
+        const auto& density = analyzer->getDensity();
+        const auto& velocity = analyzer->getVelocity();
+        const auto& temperature = analyzer->getTemperature();
+        UP_ASSERT_EQUAL(density.size(), 2);
+        UP_ASSERT_EQUAL(velocity.size(), 2);
+        UP_ASSERT_EQUAL(temperature.size(), 2);
+
+        // each bin has a volume of 4 and two particles
+        CHECK_CLOSE(density[0], 0.5, tol_small);
+        CHECK_CLOSE(density[1], 0.5, tol_small);
+
+        // lower bin flows in x, and the upper bin fluctuates in z with no net flow
+        CHECK_CLOSE(velocity[0].x, 2.0, tol_small);
+        CHECK_SMALL(velocity[0].y, tol_small);
+        CHECK_SMALL(velocity[0].z, tol_small);
+        CHECK_SMALL(velocity[1].x, tol_small);
+        CHECK_SMALL(velocity[1].y, tol_small);
+        CHECK_SMALL(velocity[1].z, tol_small);
+
+        // temperature is from fluctuations about the mean velocity
+        CHECK_CLOSE(temperature[0], 1.5 * (5.0 - 4.0) / 3.0, tol_small);
+        CHECK_CLOSE(temperature[1], 1.5 * 4.0 / 3.0, tol_small);
+        }
+    }
+
+//! Test for accumulating a flow field in the coordinates along a cosine channel
+template<class T>
+void channel_flow_field_analyzer_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(20.0);
+    snap->particle_data.type_mapping.push_back("A");
+
+    // the centerline is z = 2 cos(k x) with one period along x
+    const Scalar A = 2.0;
+    const Scalar k = Scalar(2.0 * M_PI / 20.0);
+    const auto bc = mpcd::detail::boundary::no_slip;
+    auto geom = std::make_shared<const mpcd::detail::CosineChannel>(20.0, A, 2.0, 1, bc);
+
+    // one particle above the centerline at x = 5 moving along it, and one particle below the
+    // centerline at x = -5 moving along its normal. the centerline has slope -Ak and Ak there.
+    const Scalar norm = fast::sqrt(1 + A * k * A * k);
+    snap->mpcd_data.resize(2);
+    snap->mpcd_data.type_mapping.push_back("A");
+    snap->mpcd_data.position[0] = vec3<Scalar>(5 + 0.5 * A * k / norm, 0, 0.5 / norm);
+    snap->mpcd_data.position[1] = vec3<Scalar>(-5 + 0.5 * A * k / norm, 0, -0.5 / norm);
+    snap->mpcd_data.velocity[0] = vec3<Scalar>(2 / norm, 0, -2 * A * k / norm);
+    snap->mpcd_data.velocity[1] = vec3<Scalar>(-3 * A * k / norm, 0, 3 / norm);
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+
+    // two bins along the arc length and the normal distance
+    auto trigger = std::make_shared<PeriodicTrigger>(1);
+    auto analyzer = std::make_shared<T>(sysdef, trigger, geom, 2, 1, 2, 1.0, 1);
+    analyzer->analyze(0);
+    UP_ASSERT_EQUAL(analyzer->getNumWindows(), 1);
+
+    const auto& density = analyzer->getDensity();
+    const auto& velocity = analyzer->getVelocity();
+    UP_ASSERT_EQUAL(density.size(), 4);
+
+    // the first particle is at 3/4 of the arc length, and the second one is at 1/4. each bin
+    // spans half a period, so the curvature does not change its volume.
+    Scalar length(0);
+    for (unsigned int i = 0; i < 1000; ++i)
+        {
+        const Scalar slope = A * k * fast::sin(k * (i + Scalar(0.5)) * Scalar(0.02));
+        length += Scalar(0.02) * fast::sqrt(1 + slope * slope);
+        }
+    const Scalar bin_volume = Scalar(0.5) * length * 1.0 * 20.0;
+    CHECK_CLOSE(density[0], 1.0 / bin_volume, tol_small);
+    CHECK_SMALL(density[1], tol_small);
+    CHECK_SMALL(density[2], tol_small);
+    CHECK_CLOSE(density[3], 1.0 / bin_volume, tol_small);
+
+    // the velocity is along the tangent for the first particle, and the normal for the second
+    CHECK_SMALL(velocity[0].x, tol_small);
+    CHECK_SMALL(velocity[0].y, tol_small);
+    CHECK_CLOSE(velocity[0].z, 3.0, tol_small);
+    CHECK_CLOSE(velocity[3].x, 2.0, tol_small);
+    CHECK_SMALL(velocity[3].y, tol_small);
+    CHECK_SMALL(velocity[3].z, tol_small);
+    }
+
+//! Test that invalid bins are rejected
+UP_TEST(flow_field_analyzer_invalid)
+    {
+    auto exec_conf = std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU);
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(2.0);
+    snap->particle_data.type_mapping.push_back("A");
+    snap->mpcd_data.type_mapping.push_back("A");
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+
+    auto trigger = std::make_shared<PeriodicTrigger>(1);
+    UP_ASSERT_EXCEPTION(std::runtime_error,
+                        [&] { mpcd::FlowFieldAnalyzer(sysdef, trigger, 2, 0, 1, 1); });
+    UP_ASSERT_EXCEPTION(std::runtime_error,
+                        [&] { mpcd::FlowFieldAnalyzer(sysdef, trigger, 2, 1, 1, 0); });
+
+    const auto bc = mpcd::detail::boundary::no_slip;
+    auto geom = std::make_shared<const mpcd::detail::CosineChannel>(2.0, 0.5, 0.5, 1, bc);
+    UP_ASSERT_EXCEPTION(std::runtime_error,
+                        [&]
+                        { mpcd::ChannelFlowFieldAnalyzer(sysdef, trigger, geom, 2, 1, 2, 0, 1); });
+    }
+
+//! Test flow field on the CPU
+UP_TEST(flow_field_analyzer_cpu)
+    {
+    flow_field_analyzer_test<mpcd::FlowFieldAnalyzer>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU));
+    }
+
+#ifdef ENABLE_HIP
+//! Test flow field on the GPU
+UP_TEST(flow_field_analyzer_gpu)
+    {
+    flow_field_analyzer_test<mpcd::FlowFieldAnalyzerGPU>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU));
+    }
+#endif // ENABLE_HIP
+
+//! Test channel flow field on the CPU
+UP_TEST(channel_flow_field_analyzer_cpu)
+    {
+    channel_flow_field_analyzer_test<mpcd::ChannelFlowFieldAnalyzer>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU));
+    }
+
+#ifdef ENABLE_HIP
+//! Test channel flow field on the GPU
+UP_TEST(channel_flow_field_analyzer_gpu)
+    {
+    channel_flow_field_analyzer_test<mpcd::ChannelFlowFieldAnalyzerGPU>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU));
+    }
+#endif // ENABLE_HIP
@@ -0,0 +1,181 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/mpcd/GSDWriter.h"
+
+#include "hoomd/SnapshotSystemData.h"
+#include "hoomd/test/upp11_config.h"
+
+#include <cstdio>
+
+HOOMD_UP_MAIN()
+
+using namespace hoomd;
+
+//! Make a system with 4 MPCD particles, one in each quadrant of the xy plane
+std::shared_ptr<SystemDefinition> make_system(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(2.0);
+    snap->particle_data.type_mapping.push_back("A");
+
+    snap->mpcd_data.resize(4);
+    snap->mpcd_data.type_mapping.push_back("A");
+    snap->mpcd_data.type_mapping.push_back("B");
+    snap->mpcd_data.position[0] = vec3<Scalar>(-0.5, -0.5, 0.0);
+    snap->mpcd_data.position[1] = vec3<Scalar>(0.5, -0.5, 0.0);
+    snap->mpcd_data.position[2] = vec3<Scalar>(-0.5, 0.5, 0.0);
+    snap->mpcd_data.position[3] = vec3<Scalar>(0.5, 0.5, 0.0);
+    for (unsigned int i = 0; i < 4; ++i)
+        {
+        snap->mpcd_data.velocity[i] = vec3<Scalar>(i, 2 * i, 3 * i);
+        snap->mpcd_data.type[i] = i % 2;
+        }
+    return std::make_shared<SystemDefinition>(snap, exec_conf);
+    }
+
+//! Read a chunk from a frame of a GSD file
+/*!
+ * \returns The data, which is empty if the chunk is missing
+ */
+template<class T>
+std::vector<T> read_chunk(gsd_handle& handle, uint64_t frame, const char* name)
+    {
+    std::vector<T> data;
+    const gsd_index_entry* entry = gsd_find_chunk(&handle, frame, name);
+    if (entry)
+        {
+        data.resize(entry->N * entry->M * gsd_sizeof_type((gsd_type)entry->type) / sizeof(T));
+        gsd_read_chunk(&handle, data.data(), entry);
+        }
+    return data;
+    }
+
+//! Test that all particles and fields are written by default
+UP_TEST(gsd_writer_all)
+    {
+    auto exec_conf = std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU);
+    auto sysdef = make_system(exec_conf);
+    const std::string fname = "test_mpcd_gsd_writer_all.gsd";
+
+        {
+        auto trigger = std::make_shared<PeriodicTrigger>(1);
+        mpcd::GSDWriter writer(sysdef, trigger, fname, "wb");
+        UP_ASSERT_EQUAL(writer.getStride(), 1);
+        UP_ASSERT(!writer.hasRegion());
+        UP_ASSERT_EQUAL(writer.getFields().size(), 4);
+        writer.analyze(7);
+        }
+
+    gsd_handle handle;
+    UP_ASSERT_EQUAL(gsd_open(&handle, fname.c_str(), GSD_OPEN_READONLY), GSD_SUCCESS);
+    UP_ASSERT_EQUAL(gsd_get_nframes(&handle), 1);
+
+    auto step = read_chunk<uint64_t>(handle, 0, "configuration/step");
+    UP_ASSERT_EQUAL(step.size(), 1);
+    UP_ASSERT_EQUAL(step[0], 7);
+
+    auto N = read_chunk<uint32_t>(handle, 0, "particles/N");
+    UP_ASSERT_EQUAL(N[0], 4);
+
+    auto pos = read_chunk<float>(handle, 0, "particles/position");
+    auto vel = read_chunk<float>(handle, 0, "particles/velocity");
+    auto type = read_chunk<uint32_t>(handle, 0, "particles/typeid");
+    auto tag = read_chunk<uint32_t>(handle, 0, "log/particles/mpcd/tag");
+    UP_ASSERT_EQUAL(pos.size(), 12);
+    UP_ASSERT_EQUAL(vel.size(), 12);
+    UP_ASSERT_EQUAL(type.size(), 4);
+    UP_ASSERT_EQUAL(tag.size(), 4);
+    for (unsigned int i = 0; i < 4; ++i)
+        {
+        UP_ASSERT_EQUAL(tag[i], i);
+        UP_ASSERT_EQUAL(type[i], i % 2);
+        CHECK_CLOSE(vel[3 * i], i, tol_small);
+        CHECK_CLOSE(vel[3 * i + 1], 2 * i, tol_small);
+        CHECK_CLOSE(vel[3 * i + 2], 3 * i, tol_small);
+        }
+    CHECK_CLOSE(pos[3], 0.5, tol_small);
+    CHECK_CLOSE(pos[4], -0.5, tol_small);
+
+    auto types = read_chunk<char>(handle, 0, "particles/types");
+    UP_ASSERT_EQUAL(std::string(types.data()), "A");
+    UP_ASSERT_EQUAL(std::string(types.data() + types.size() / 2), "B");
+
+    gsd_close(&handle);
+    std::remove(fname.c_str());
+    }
+
+//! Test decimation, region filtering, and field selection
+UP_TEST(gsd_writer_subset)
+    {
+    auto exec_conf = std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU);
+    auto sysdef = make_system(exec_conf);
+    const std::string fname = "test_mpcd_gsd_writer_subset.gsd";
+
+        {
+        auto trigger = std::make_shared<PeriodicTrigger>(1);
+        mpcd::GSDWriter writer(sysdef, trigger, fname, "wb");
+
+        // every other particle, so tags 0 and 2
+        writer.setStride(2);
+        writer.setFields({"velocity", "tag"});
+        writer.analyze(1);
+
+        // only the upper half of the box, so tag 2
+        writer.setRegion(make_scalar3(-1, 0, -1), make_scalar3(1, 1, 1));
+        writer.analyze(2);
+
+        // the region keeps tags 2 and 3 without decimation
+        writer.setStride(1);
+        writer.setFields({"position"});
+        writer.analyze(3);
+
+        UP_ASSERT_EXCEPTION(std::invalid_argument, [&] { writer.setStride(0); });
+        UP_ASSERT_EXCEPTION(
+            std::invalid_argument,
+            [&] { writer.setRegion(make_scalar3(0, 0, 0), make_scalar3(1, 0, 1)); });
+        UP_ASSERT_EXCEPTION(std::invalid_argument, [&] { writer.setFields({"mass"}); });
+        }
+
+    gsd_handle handle;
+    UP_ASSERT_EQUAL(gsd_open(&handle, fname.c_str(), GSD_OPEN_READONLY), GSD_SUCCESS);
+    UP_ASSERT_EQUAL(gsd_get_nframes(&handle), 3);
+
+        {
+        auto N = read_chunk<uint32_t>(handle, 0, "particles/N");
+        UP_ASSERT_EQUAL(N[0], 2);
+        auto tag = read_chunk<uint32_t>(handle, 0, "log/particles/mpcd/tag");
+        UP_ASSERT_EQUAL(tag.size(), 2);
+        UP_ASSERT_EQUAL(tag[0], 0);
+        UP_ASSERT_EQUAL(tag[1], 2);
+        auto vel = read_chunk<float>(handle, 0, "particles/velocity");
+        UP_ASSERT_EQUAL(vel.size(), 6);
+        CHECK_CLOSE(vel[3], 2, tol_small);
+        UP_ASSERT(read_chunk<float>(handle, 0, "particles/position").empty());
+        UP_ASSERT(read_chunk<uint32_t>(handle, 0, "particles/typeid").empty());
+        }
+
+        {
+        auto N = read_chunk<uint32_t>(handle, 1, "particles/N");
+        UP_ASSERT_EQUAL(N[0], 1);
+        auto tag = read_chunk<uint32_t>(handle, 1, "log/particles/mpcd/tag");
+        UP_ASSERT_EQUAL(tag.size(), 1);
+        UP_ASSERT_EQUAL(tag[0], 2);
+        }
+
+        {
+        auto N = read_chunk<uint32_t>(handle, 2, "particles/N");
+        UP_ASSERT_EQUAL(N[0], 2);
+        auto pos = read_chunk<float>(handle, 2, "particles/position");
+        UP_ASSERT_EQUAL(pos.size(), 6);
+        CHECK_CLOSE(pos[0], -0.5, tol_small);
+        CHECK_CLOSE(pos[1], 0.5, tol_small);
+        CHECK_CLOSE(pos[3], 0.5, tol_small);
+        CHECK_CLOSE(pos[4], 0.5, tol_small);
+        UP_ASSERT(read_chunk<float>(handle, 2, "particles/velocity").empty());
+        UP_ASSERT(read_chunk<uint32_t>(handle, 2, "log/particles/mpcd/tag").empty());
+        }
+
+    gsd_close(&handle);
+    std::remove(fname.c_str());
+    }
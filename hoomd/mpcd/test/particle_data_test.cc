@@ -0,0 +1,123 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/mpcd/CellList.h"
+#include "hoomd/mpcd/ParticleData.h"
+#ifdef ENABLE_HIP
+#include "hoomd/mpcd/CellListGPU.h"
+#endif // ENABLE_HIP
+
+#include "hoomd/SnapshotSystemData.h"
+#include "hoomd/SystemDefinition.h"
+#include "hoomd/test/upp11_config.h"
+
+#include <limits>
+
+HOOMD_UP_MAIN()
+
+using namespace hoomd;
+
+//! Test that the type and cell indexes survive packing into the MPCD particle storage
+UP_TEST(mpcd_particle_data_pack_test)
+    {
+    UP_ASSERT_EQUAL(sizeof(mpcd::SolventScalar4), 4 * sizeof(mpcd::SolventScalar));
+#ifdef HOOMD_MPCD_SINGLE_PRECISION
+    UP_ASSERT_EQUAL(sizeof(mpcd::SolventScalar), sizeof(float));
+#else
+    UP_ASSERT_EQUAL(sizeof(mpcd::SolventScalar), sizeof(Scalar));
+#endif
+
+    const unsigned int values[] = {0, 1, 42, 0x7fffffff, mpcd::detail::NO_CELL};
+    for (const unsigned int value : values)
+        {
+        const mpcd::SolventScalar4 v
+            = mpcd::make_solvent_scalar4(1.0, 2.0, 3.0, mpcd::__int_as_solvent_scalar(value));
+        UP_ASSERT_EQUAL(static_cast<unsigned int>(mpcd::__solvent_scalar_as_int(v.w)), value);
+        }
+    }
+
+//! Test that the MPCD particles keep their precision and cells in a large box
+template<class CL>
+void particle_data_large_box_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    const Scalar L = 1024.0;
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(L, 4.0, 4.0);
+    snap->particle_data.type_mapping.push_back("A");
+    snap->mpcd_data.resize(4);
+    snap->mpcd_data.type_mapping.push_back("A");
+    snap->mpcd_data.type_mapping.push_back("B");
+    snap->mpcd_data.position[0] = vec3<Scalar>(-511.9, -1.5, 0.25);
+    snap->mpcd_data.position[1] = vec3<Scalar>(-0.1, 0.3, -1.7);
+    snap->mpcd_data.position[2] = vec3<Scalar>(255.3, 1.9, 0.0);
+    snap->mpcd_data.position[3] = vec3<Scalar>(511.9, -0.6, 1.1);
+    snap->mpcd_data.velocity[0] = vec3<Scalar>(1.1, -2.3, 0.7);
+    snap->mpcd_data.velocity[1] = vec3<Scalar>(-0.4, 0.9, 3.2);
+    snap->mpcd_data.velocity[2] = vec3<Scalar>(2.6, 0.1, -1.3);
+    snap->mpcd_data.velocity[3] = vec3<Scalar>(-1.8, -0.5, 0.2);
+    snap->mpcd_data.type[0] = 0;
+    snap->mpcd_data.type[1] = 1;
+    snap->mpcd_data.type[2] = 0;
+    snap->mpcd_data.type[3] = 1;
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+    auto pdata = sysdef->getMPCDParticleData();
+
+    // the positions are relative to the center of the box, so their error scales with its size
+    const Scalar pos_tol = std::numeric_limits<mpcd::SolventScalar>::epsilon() * L;
+    const Scalar vel_tol = std::numeric_limits<mpcd::SolventScalar>::epsilon() * Scalar(4.0);
+        {
+        mpcd::ParticleDataSnapshot new_snap;
+        pdata->takeSnapshot(new_snap, snap->global_box);
+        UP_ASSERT_EQUAL(new_snap.size, 4);
+        for (unsigned int i = 0; i < 4; ++i)
+            {
+            const vec3<Scalar> pos = snap->mpcd_data.position[i];
+            const vec3<Scalar> vel = snap->mpcd_data.velocity[i];
+            UP_ASSERT_SMALL(new_snap.position[i].x - pos.x, pos_tol);
+            UP_ASSERT_SMALL(new_snap.position[i].y - pos.y, pos_tol);
+            UP_ASSERT_SMALL(new_snap.position[i].z - pos.z, pos_tol);
+            UP_ASSERT_SMALL(new_snap.velocity[i].x - vel.x, vel_tol);
+            UP_ASSERT_SMALL(new_snap.velocity[i].y - vel.y, vel_tol);
+            UP_ASSERT_SMALL(new_snap.velocity[i].z - vel.z, vel_tol);
+            UP_ASSERT_EQUAL(new_snap.type[i], snap->mpcd_data.type[i]);
+            }
+        }
+
+    // bin the particles, which caches their cells in the storage
+    std::shared_ptr<mpcd::CellList> cl(new CL(sysdef));
+    cl->compute(0);
+        {
+        Index3D ci = cl->getCellIndexer();
+        UP_ASSERT_EQUAL(ci.getW(), 1024);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[0].w), ci(0, 0, 2));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[1].w), ci(511, 2, 0));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[2].w), ci(767, 3, 2));
+        CHECK_EQUAL_UINT(mpcd::__solvent_scalar_as_int(h_vel.data[3].w), ci(1023, 1, 3));
+        for (unsigned int i = 0; i < 4; ++i)
+            {
+            const unsigned int type = mpcd::__solvent_scalar_as_int(h_pos.data[i].w);
+            UP_ASSERT_EQUAL(type, snap->mpcd_data.type[i]);
+            }
+        }
+    }
+
+//! Test that the particles keep their precision and cells in a large box on the CPU
+UP_TEST(mpcd_particle_data_large_box_test)
+    {
+    particle_data_large_box_test<mpcd::CellList>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+#ifdef ENABLE_HIP
+//! Test that the particles keep their precision and cells in a large box on the GPU
+UP_TEST(mpcd_particle_data_large_box_test_gpu)
+    {
+    particle_data_large_box_test<mpcd::CellListGPU>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU)));
+    }
+#endif // ENABLE_HIP
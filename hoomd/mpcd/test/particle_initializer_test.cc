@@ -0,0 +1,119 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/mpcd/ParticleInitializer.h"
+#include "hoomd/mpcd/StreamingGeometry.h"
+#ifdef ENABLE_HIP
+#include "hoomd/mpcd/ParticleInitializerGPU.h"
+#endif // ENABLE_HIP
+
+#include "hoomd/SnapshotSystemData.h"
+#include "hoomd/test/upp11_config.h"
+
+HOOMD_UP_MAIN()
+
+using namespace hoomd;
+
+template<class I> void particle_initializer_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(20.0);
+    snap->particle_data.type_mapping.push_back("A");
+    snap->mpcd_data.resize(1);
+    snap->mpcd_data.type_mapping.push_back("A");
+    snap->mpcd_data.position[0] = vec3<Scalar>(1, -2, 3);
+    snap->mpcd_data.velocity[0] = vec3<Scalar>(123, 456, 789);
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+    auto pdata = sysdef->getMPCDParticleData();
+
+    // cosine channel with amplitude 2, half width 2, and one repetition
+    const auto bc = mpcd::detail::boundary::no_slip;
+    auto geom = std::make_shared<const mpcd::detail::CosineChannel>(20.0, 2.0, 2.0, 1, bc);
+    auto init = std::make_shared<I>(sysdef, 5.0, 1.5, geom);
+    init->initialize(0);
+
+    // the channel has the cross section 2 h L regardless of its amplitude
+    const Scalar N_expected = Scalar(5.0 * 20.0 * 20.0 * 4.0);
+    UP_ASSERT_EQUAL(pdata->getNGlobal(), pdata->getN());
+    UP_ASSERT_EQUAL(pdata->getNVirtual(), 0);
+    CHECK_CLOSE(Scalar(pdata->getN()), N_expected, 0.05);
+
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+
+        Scalar3 v_sum = make_scalar3(0, 0, 0);
+        Scalar T_avg(0);
+        for (unsigned int i = 0; i < pdata->getN(); ++i)
+            {
+            // tags should be compact, and all particles should have the first type
+            UP_ASSERT_EQUAL(h_tag.data[i], i);
+            UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[i].w), 0);
+            UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[i].w), mpcd::detail::NO_CELL);
+
+            const Scalar3 pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            UP_ASSERT(!geom->isOutside(pos));
+
+            const Scalar3 vel = make_scalar3(h_vel.data[i].x, h_vel.data[i].y, h_vel.data[i].z);
+            v_sum += vel;
+            T_avg += dot(vel, vel);
+            }
+        T_avg /= (3 * (pdata->getN() - 1));
+
+        // the net momentum is removed exactly, and the temperature is set statistically
+        CHECK_SMALL(v_sum.x, tol);
+        CHECK_SMALL(v_sum.y, tol);
+        CHECK_SMALL(v_sum.z, tol);
+        CHECK_CLOSE(T_avg, 1.5, 0.05);
+        }
+
+    // initializing at the same timestep gives the same particles, also on the CPU
+    const unsigned int N = pdata->getN();
+    std::vector<mpcd::SolventScalar4> pos(N);
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        std::copy(h_pos.data, h_pos.data + N, pos.begin());
+        }
+    mpcd::ParticleInitializer<mpcd::detail::CosineChannel>(sysdef, 5.0, 1.5, geom).initialize(0);
+    UP_ASSERT_EQUAL(pdata->getN(), N);
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        for (unsigned int i = 0; i < N; ++i)
+            {
+            CHECK_SMALL(h_pos.data[i].x - pos[i].x, tol_small);
+            CHECK_SMALL(h_pos.data[i].y - pos[i].y, tol_small);
+            CHECK_SMALL(h_pos.data[i].z - pos[i].z, tol_small);
+            }
+        }
+
+    // a different timestep gives different particles
+    init->initialize(1);
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        UP_ASSERT(pdata->getN() != N || h_pos.data[0].x != pos[0].x);
+        }
+    }
+
+UP_TEST(particle_initializer)
+    {
+    particle_initializer_test<mpcd::ParticleInitializer<mpcd::detail::CosineChannel>>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU));
+    }
+#ifdef ENABLE_HIP
+UP_TEST(particle_initializer_gpu)
+    {
+    particle_initializer_test<mpcd::ParticleInitializerGPU<mpcd::detail::CosineChannel>>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU));
+    }
+#endif // ENABLE_HIP
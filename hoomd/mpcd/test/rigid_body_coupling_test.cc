@@ -0,0 +1,177 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/mpcd/ConfinedStreamingMethod.h"
+#include "hoomd/mpcd/RigidBodyCoupling.h"
+#include "hoomd/mpcd/StreamingGeometry.h"
+#ifdef ENABLE_HIP
+#include "hoomd/mpcd/ConfinedStreamingMethodGPU.h"
+#include "hoomd/mpcd/RigidBodyCouplingGPU.h"
+#endif // ENABLE_HIP
+
+#include "hoomd/SnapshotSystemData.h"
+#include "hoomd/filter/ParticleFilterAll.h"
+#include "hoomd/test/upp11_config.h"
+
+HOOMD_UP_MAIN()
+
+using namespace hoomd;
+
+//! Test for reflecting particles from a moving, rotating body and transferring their momentum
+template<class SM, class RB>
+void rigid_body_coupling_test(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                              mpcd::detail::boundary bc)
+    {
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(10.0);
+    snap->particle_data.type_mapping.push_back("A");
+        {
+        // body at the origin translating along x and rotating about z with unit angular velocity
+        SnapshotParticleData<Scalar>& pdata_snap = snap->particle_data;
+        pdata_snap.resize(1);
+        pdata_snap.pos[0] = vec3<Scalar>(0, 0, 0);
+        pdata_snap.vel[0] = vec3<Scalar>(0.5, 0, 0);
+        pdata_snap.inertia[0] = vec3<Scalar>(1, 1, 1);
+        pdata_snap.angmom[0] = quat<Scalar>(0, vec3<Scalar>(0, 0, 2));
+        }
+
+    // one particle that streams into the body, one that starts inside, and one that misses
+    snap->mpcd_data.resize(3);
+    snap->mpcd_data.type_mapping.push_back("A");
+    snap->mpcd_data.position[0] = vec3<Scalar>(-1.5, 0, 0);
+    snap->mpcd_data.position[1] = vec3<Scalar>(0, 0.5, 0);
+    snap->mpcd_data.position[2] = vec3<Scalar>(4, 4, 4);
+    snap->mpcd_data.velocity[0] = vec3<Scalar>(1, 0, 0);
+    snap->mpcd_data.velocity[1] = vec3<Scalar>(0, -1, 0);
+    snap->mpcd_data.velocity[2] = vec3<Scalar>(0.1, 0, 0);
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+
+    auto group = std::make_shared<ParticleGroup>(sysdef, std::make_shared<ParticleFilterAll>());
+    auto bodies = std::make_shared<RB>(sysdef, group, 1.0, bc);
+    UP_ASSERT_EXCEPTION(std::runtime_error, [&] { bodies->setRadius(-1.0); });
+    CHECK_CLOSE(bodies->getRadius(), 1.0, tol_small);
+
+    auto geom = std::make_shared<const mpcd::detail::BulkGeometry>();
+    auto stream = std::make_shared<SM>(sysdef, 0, 1, -1, geom);
+    stream->setCellList(std::make_shared<mpcd::CellList>(sysdef));
+    stream->setRigidBodyCoupling(bodies);
+    stream->setDeltaT(1.0);
+    bodies->setDeltaT(0.5);
+
+    stream->stream(0);
+        {
+        std::shared_ptr<mpcd::ParticleData> pdata = sysdef->getMPCDParticleData();
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        if (bc == mpcd::detail::boundary::no_slip)
+            {
+            // hits at (-1,0,0) after 0.5 where the surface moves with (0.5,-1,0)
+            CHECK_CLOSE(h_pos.data[0].x, -1.0, tol_small);
+            CHECK_CLOSE(h_pos.data[0].y, -1.0, tol_small);
+            CHECK_SMALL(h_vel.data[0].x, tol_small);
+            CHECK_CLOSE(h_vel.data[0].y, -2.0, tol_small);
+
+            // pushed out to (0,1,0) where the surface moves with (-0.5,0,0)
+            CHECK_SMALL(h_pos.data[1].x, tol_small);
+            CHECK_CLOSE(h_pos.data[1].y, 1.0, tol_small);
+            CHECK_CLOSE(h_vel.data[1].x, -1.0, tol_small);
+            CHECK_CLOSE(h_vel.data[1].y, 1.0, tol_small);
+            }
+        else
+            {
+            // only the normal component of the relative velocity is reversed
+            CHECK_CLOSE(h_pos.data[0].x, -1.0, tol_small);
+            CHECK_SMALL(h_pos.data[0].y, tol_small);
+            CHECK_SMALL(h_vel.data[0].x, tol_small);
+            CHECK_SMALL(h_vel.data[0].y, tol_small);
+
+            CHECK_SMALL(h_pos.data[1].x, tol_small);
+            CHECK_CLOSE(h_pos.data[1].y, 1.0, tol_small);
+            CHECK_SMALL(h_vel.data[1].x, tol_small);
+            CHECK_CLOSE(h_vel.data[1].y, 1.0, tol_small);
+            }
+        for (unsigned int i = 0; i < 2; ++i)
+            {
+            CHECK_SMALL(h_pos.data[i].z, tol_small);
+            CHECK_SMALL(h_vel.data[i].z, tol_small);
+            }
+
+        // the last particle streams freely
+        CHECK_CLOSE(h_pos.data[2].x, 4.1, tol_small);
+        CHECK_CLOSE(h_vel.data[2].x, 0.1, tol_small);
+        }
+
+    // the impulse is applied once as a force over the MD timestep
+    bodies->compute(1);
+        {
+        ArrayHandle<Scalar4> h_force(bodies->getForceArray(),
+                                     access_location::host,
+                                     access_mode::read);
+        ArrayHandle<Scalar4> h_torque(bodies->getTorqueArray(),
+                                      access_location::host,
+                                      access_mode::read);
+        const Scalar3 force = (bc == mpcd::detail::boundary::no_slip) ? make_scalar3(4, 0, 0)
+                                                                      : make_scalar3(2, -4, 0);
+        const Scalar torque_z = (bc == mpcd::detail::boundary::no_slip) ? -6 : 0;
+        CHECK_CLOSE(h_force.data[0].x, force.x, tol_small);
+        CHECK_CLOSE(h_force.data[0].y, force.y, tol_small);
+        CHECK_SMALL(h_force.data[0].z, tol_small);
+        CHECK_SMALL(h_torque.data[0].x, tol_small);
+        CHECK_SMALL(h_torque.data[0].y, tol_small);
+        CHECK_CLOSE(h_torque.data[0].z, torque_z, tol_small);
+        }
+    bodies->compute(2);
+        {
+        ArrayHandle<Scalar4> h_force(bodies->getForceArray(),
+                                     access_location::host,
+                                     access_mode::read);
+        ArrayHandle<Scalar4> h_torque(bodies->getTorqueArray(),
+                                      access_location::host,
+                                      access_mode::read);
+        CHECK_SMALL(h_force.data[0].x, tol_small);
+        CHECK_SMALL(h_force.data[0].y, tol_small);
+        CHECK_SMALL(h_torque.data[0].z, tol_small);
+        }
+    }
+
+//! Test no-slip coupling on the CPU
+UP_TEST(rigid_body_coupling_no_slip)
+    {
+    rigid_body_coupling_test<mpcd::ConfinedStreamingMethod<mpcd::detail::BulkGeometry>,
+                             mpcd::RigidBodyCoupling>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU),
+        mpcd::detail::boundary::no_slip);
+    }
+
+//! Test slip coupling on the CPU
+UP_TEST(rigid_body_coupling_slip)
+    {
+    rigid_body_coupling_test<mpcd::ConfinedStreamingMethod<mpcd::detail::BulkGeometry>,
+                             mpcd::RigidBodyCoupling>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU),
+        mpcd::detail::boundary::slip);
+    }
+
+#ifdef ENABLE_HIP
+//! Test no-slip coupling on the GPU
+UP_TEST(rigid_body_coupling_no_slip_gpu)
+    {
+    rigid_body_coupling_test<mpcd::ConfinedStreamingMethodGPU<mpcd::detail::BulkGeometry>,
+                             mpcd::RigidBodyCouplingGPU>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU),
+        mpcd::detail::boundary::no_slip);
+    }
+
+//! Test slip coupling on the GPU
+UP_TEST(rigid_body_coupling_slip_gpu)
+    {
+    rigid_body_coupling_test<mpcd::ConfinedStreamingMethodGPU<mpcd::detail::BulkGeometry>,
+                             mpcd::RigidBodyCouplingGPU>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU),
+        mpcd::detail::boundary::slip);
+    }
+#endif // ENABLE_HIP
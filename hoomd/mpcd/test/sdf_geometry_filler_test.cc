@@ -0,0 +1,157 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/mpcd/SDFGeometryFiller.h"
+#include "hoomd/mpcd/SignedDistanceField.h"
+#ifdef ENABLE_HIP
+#include "hoomd/mpcd/SDFGeometryFillerGPU.h"
+#endif // ENABLE_HIP
+
+#include "hoomd/SnapshotSystemData.h"
+#include "hoomd/test/upp11_config.h"
+
+HOOMD_UP_MAIN()
+
+using namespace hoomd;
+
+template<class F> void sdf_fill_basic_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(20.0);
+    snap->particle_data.type_mapping.push_back("A");
+    snap->mpcd_data.resize(1);
+    snap->mpcd_data.type_mapping.push_back("A");
+    snap->mpcd_data.position[0] = vec3<Scalar>(1, -2, 3);
+    snap->mpcd_data.velocity[0] = vec3<Scalar>(123, 456, 789);
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+
+    auto pdata = sysdef->getMPCDParticleData();
+    auto cl = std::make_shared<mpcd::CellList>(sysdef);
+    cl->setCellSize(2.0);
+    UP_ASSERT_EQUAL(pdata->getNVirtual(), 0);
+
+    // tabulate a slit of half width 4 that is uniform in x and y
+    const unsigned int nz = 40;
+    std::vector<Scalar> values(nz);
+    for (unsigned int k = 0; k < nz; ++k)
+        {
+        values[k] = std::abs(Scalar(-10.0) + k * Scalar(20.0) / nz) - Scalar(4.0);
+        }
+    auto field = std::make_shared<mpcd::SignedDistanceField>(exec_conf,
+                                                             values,
+                                                             make_uint3(1, 1, nz),
+                                                             make_scalar3(20, 20, 20));
+    auto geom = std::make_shared<const mpcd::detail::SDFGeometry>(
+        field->makeGeometry(mpcd::detail::boundary::no_slip));
+    std::shared_ptr<Variant> kT = std::make_shared<VariantConstant>(1.5);
+    std::shared_ptr<mpcd::SDFGeometryFiller> filler
+        = std::make_shared<F>(sysdef, 2.0, 1, kT, geom);
+    filler->setCellList(cl);
+
+    // layer thickness is the cell diagonal, and its volume is sampled so it is close to exact
+    const Scalar thickness = std::sqrt(Scalar(3.0)) * Scalar(2.0);
+    const Scalar N_layer = Scalar(20.0 * 20.0 * 2.0) * thickness;
+
+    /*
+     * Test basic filling up for this cell list
+     */
+    filler->fill(0);
+    const unsigned int N_fill = pdata->getNVirtual();
+    CHECK_CLOSE(Scalar(N_fill), Scalar(2.0) * N_layer, 0.02);
+        // count that particles have been placed on the right sides
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+
+        // ensure first particle did not get overwritten
+        CHECK_CLOSE(h_pos.data[0].x, 1, tol_small);
+        CHECK_CLOSE(h_pos.data[0].y, -2, tol_small);
+        CHECK_CLOSE(h_pos.data[0].z, 3, tol_small);
+        CHECK_CLOSE(h_vel.data[0].x, 123, tol_small);
+        CHECK_CLOSE(h_vel.data[0].y, 456, tol_small);
+        CHECK_CLOSE(h_vel.data[0].z, 789, tol_small);
+        UP_ASSERT_EQUAL(h_tag.data[0], 0);
+
+        unsigned int N_lo(0), N_hi(0);
+        for (unsigned int i = pdata->getN(); i < pdata->getN() + pdata->getNVirtual(); ++i)
+            {
+            // tag should equal index on one rank with one filler
+            UP_ASSERT_EQUAL(h_tag.data[i], i);
+            // type should be set
+            UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[i].w), 1);
+
+            // particle should lie outside the slit, within the layer
+            const Scalar z = h_pos.data[i].z;
+            UP_ASSERT(std::abs(z) >= Scalar(4.0) - tol_small);
+            UP_ASSERT(std::abs(z) <= Scalar(4.0) + thickness + tol_small);
+            if (z < 0)
+                ++N_lo;
+            else
+                ++N_hi;
+            }
+        CHECK_CLOSE(Scalar(N_lo), Scalar(N_hi), 0.1);
+        }
+
+    /*
+     * Fill the volume again, which should double the number of virtual particles
+     */
+    filler->fill(1);
+    UP_ASSERT_EQUAL(pdata->getNVirtual(), 2 * N_fill);
+        {
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+        for (unsigned int i = pdata->getN(); i < pdata->getN() + pdata->getNVirtual(); ++i)
+            {
+            UP_ASSERT_EQUAL(h_tag.data[i], i);
+            }
+        }
+
+    /*
+     * Test the average properties of the virtual particles.
+     */
+    unsigned int N_avg(0);
+    Scalar3 v_avg = make_scalar3(0, 0, 0);
+    Scalar T_avg(0);
+    for (unsigned int t = 0; t < 500; ++t)
+        {
+        pdata->removeVirtualParticles();
+        filler->fill(2 + t);
+
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        for (unsigned int i = pdata->getN(); i < pdata->getN() + pdata->getNVirtual(); ++i)
+            {
+            const mpcd::SolventScalar4 vel_cell = h_vel.data[i];
+            const Scalar3 vel = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
+            v_avg += vel;
+            T_avg += dot(vel, vel);
+            ++N_avg;
+            }
+        }
+    UP_ASSERT_EQUAL(N_avg, 500 * N_fill);
+    v_avg /= N_avg;
+    T_avg /= (3 * (N_avg - 1));
+
+    CHECK_SMALL(v_avg.x, tol);
+    CHECK_SMALL(v_avg.y, tol);
+    CHECK_SMALL(v_avg.z, tol);
+    CHECK_CLOSE(T_avg, 1.5, tol);
+    }
+
+UP_TEST(sdf_fill_basic)
+    {
+    sdf_fill_basic_test<mpcd::SDFGeometryFiller>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU));
+    }
+#ifdef ENABLE_HIP
+UP_TEST(sdf_fill_basic_gpu)
+    {
+    sdf_fill_basic_test<mpcd::SDFGeometryFillerGPU>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU));
+    }
+#endif // ENABLE_HIP
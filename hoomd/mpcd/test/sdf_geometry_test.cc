@@ -0,0 +1,128 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/mpcd/SDFGeometry.h"
+#include "hoomd/mpcd/SlitGeometry.h"
+
+#include "hoomd/test/upp11_config.h"
+
+#include <vector>
+
+HOOMD_UP_MAIN()
+
+using namespace hoomd;
+
+//! Tabulate the signed distance of a slit of half width H on a grid that is uniform in x and y
+std::vector<Scalar> make_slit_sdf(Scalar H, unsigned int nz, Scalar Lz)
+    {
+    std::vector<Scalar> values(nz);
+    for (unsigned int k = 0; k < nz; ++k)
+        {
+        const Scalar z = -Scalar(0.5) * Lz + k * Lz / nz;
+        values[k] = std::abs(z) - H;
+        }
+    return values;
+    }
+
+//! Test interpolation of the signed distance field
+UP_TEST(sdf_geometry_evaluate)
+    {
+    // linear field in x on a 3D grid, 4 points per dimension in a box of length 8
+    const uint3 dim = make_uint3(4, 4, 4);
+    const Index3D indexer(dim.x, dim.y, dim.z);
+    std::vector<Scalar> values(indexer.getNumElements());
+    for (unsigned int k = 0; k < dim.z; ++k)
+        for (unsigned int j = 0; j < dim.y; ++j)
+            for (unsigned int i = 0; i < dim.x; ++i)
+                values[indexer(i, j, k)] = Scalar(i) + Scalar(2 * j) - Scalar(k);
+    const mpcd::detail::SDFGeometry geom(values.data(),
+                                         dim,
+                                         make_scalar3(8, 8, 8),
+                                         mpcd::detail::boundary::no_slip);
+    CHECK_CLOSE(geom.getSpacing().x, 2, tol_small);
+    CHECK_CLOSE(geom.getLo().z, -4, tol_small);
+
+    // grid point (1,2,3) is at (-2,0,2)
+    Scalar3 grad;
+    CHECK_CLOSE(geom.evaluate(make_scalar3(-2, 0, 2), grad), 2, tol_small);
+
+    // interpolation between grid points is linear, with the gradient scaled by the spacing
+    CHECK_CLOSE(geom.evaluate(make_scalar3(-1.5, 0.5, 1), grad), 3.25, tol_small);
+    CHECK_CLOSE(grad.x, 0.5, tol_small);
+    CHECK_CLOSE(grad.y, 1, tol_small);
+    CHECK_CLOSE(grad.z, -0.5, tol_small);
+
+    // field is periodic, so interpolation between the last and first point wraps around
+    CHECK_SMALL(geom.evaluate(make_scalar3(-4, -4, -4), grad), tol_small);
+    CHECK_CLOSE(geom.evaluate(make_scalar3(3, -4, -4), grad), 1.5, tol_small);
+    CHECK_CLOSE(geom.evaluate(make_scalar3(-5, -4, -4), grad), 1.5, tol_small);
+    CHECK_CLOSE(grad.x, -1.5, tol_small);
+    }
+
+//! Test collisions with a slit tabulated as a signed distance field
+/*!
+ * The collisions are checked against the analytical slit geometry.
+ */
+UP_TEST(sdf_geometry_slit_collision)
+    {
+    const Scalar H = 2.25;
+    const std::vector<Scalar> values = make_slit_sdf(H, 40, 20);
+    const uint3 dim = make_uint3(1, 1, 40);
+    const Scalar3 L = make_scalar3(10, 10, 20);
+    const mpcd::detail::SDFGeometry no_slip(values.data(),
+                                            dim,
+                                            L,
+                                            mpcd::detail::boundary::no_slip);
+    const mpcd::detail::SDFGeometry slip(values.data(), dim, L, mpcd::detail::boundary::slip);
+    const mpcd::detail::SlitGeometry slit_no_slip(H, 0, mpcd::detail::boundary::no_slip);
+    const mpcd::detail::SlitGeometry slit_slip(H, 0, mpcd::detail::boundary::slip);
+
+    BoxDim box(L);
+    UP_ASSERT(no_slip.validateBox(box, 1.0));
+    UP_ASSERT(!no_slip.validateBox(BoxDim(10, 10, 10), 1.0));
+
+    // particle inside the channel does not collide
+        {
+        Scalar3 pos = make_scalar3(0.3, -0.2, 1.0);
+        Scalar3 vel = make_scalar3(1, 1, 1);
+        Scalar dt = 0.1;
+        UP_ASSERT(!no_slip.isOutside(pos));
+        UP_ASSERT(!no_slip.detectCollision(pos, vel, dt));
+        CHECK_SMALL(dt, tol_small);
+        }
+
+    // collisions with the top and bottom walls, including one that travels far inside the fluid
+    const Scalar3 starts[] = {make_scalar3(0.1, 0.2, H + 0.5),
+                              make_scalar3(-0.3, 0.4, -H - 0.25),
+                              make_scalar3(0.7, -0.1, H + 0.125)};
+    const Scalar3 velocities[] = {make_scalar3(0.5, -1, 1),
+                                  make_scalar3(1, 0, -1),
+                                  make_scalar3(0.25, 0.5, 1)};
+    const Scalar dts[] = {1.0, 0.5, 4.0};
+    for (unsigned int i = 0; i < 3; ++i)
+        {
+        for (unsigned int b = 0; b < 2; ++b)
+            {
+            const auto& geom = (b == 0) ? no_slip : slip;
+            const auto& ref = (b == 0) ? slit_no_slip : slit_slip;
+
+            Scalar3 pos = starts[i], vel = velocities[i];
+            Scalar dt = dts[i];
+            Scalar3 ref_pos = starts[i], ref_vel = velocities[i];
+            Scalar ref_dt = dts[i];
+            mpcd::detail::CollisionStatistics stats;
+            UP_ASSERT(geom.isOutside(pos));
+            UP_ASSERT(geom.detectCollision(pos, vel, dt, &stats));
+            UP_ASSERT(ref.detectCollision(ref_pos, ref_vel, ref_dt));
+            CHECK_CLOSE(pos.x, ref_pos.x, tol_small);
+            CHECK_CLOSE(pos.y, ref_pos.y, tol_small);
+            CHECK_CLOSE(pos.z, ref_pos.z, tol_small);
+            CHECK_CLOSE(dt, ref_dt, tol_small);
+            CHECK_CLOSE(vel.x, ref_vel.x, tol_small);
+            CHECK_CLOSE(vel.y, ref_vel.y, tol_small);
+            CHECK_CLOSE(vel.z, ref_vel.z, tol_small);
+            UP_ASSERT(stats.iterations > 0);
+            UP_ASSERT_EQUAL(stats.unconverged, 0);
+            }
+        }
+    }
@@ -46,10 +46,12 @@ template<class F> void slit_fill_basic_test(std::shared_ptr<ExecutionConfigurati
     UP_ASSERT_EQUAL(pdata->getNVirtual(), 2 * (2 * 20 * 20) * 2);
         // count that particles have been placed on the right sides
         {
-        ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::read);
-        ArrayHandle<Scalar4> h_vel(pdata->getVelocities(),
-                                   access_location::host,
-                                   access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
         ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
 
         // ensure first particle did not get overwritten
@@ -67,7 +69,7 @@ template<class F> void slit_fill_basic_test(std::shared_ptr<ExecutionConfigurati
             // tag should equal index on one rank with one filler
             UP_ASSERT_EQUAL(h_tag.data[i], i);
             // type should be set
-            UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[i].w), 1);
+            UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[i].w), 1);
 
             const Scalar z = h_pos.data[i].z;
             if (z < Scalar(-5.0))
@@ -86,10 +88,12 @@ template<class F> void slit_fill_basic_test(std::shared_ptr<ExecutionConfigurati
     UP_ASSERT_EQUAL(pdata->getNVirtual(), 2 * 2 * (2 * 20 * 20) * 2);
         // count that particles have been placed on the right sides
         {
-        ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::read);
-        ArrayHandle<Scalar4> h_vel(pdata->getVelocities(),
-                                   access_location::host,
-                                   access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
         ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
 
         unsigned int N_lo(0), N_hi(0);
@@ -118,7 +122,9 @@ template<class F> void slit_fill_basic_test(std::shared_ptr<ExecutionConfigurati
     UP_ASSERT_EQUAL(pdata->getNVirtual(), 2 * (20 * 20 / 2) * 2);
         // count that particles have been placed on the right sides
         {
-        ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
         unsigned int N_lo(0), N_hi(0);
         for (unsigned int i = pdata->getN(); i < pdata->getN() + pdata->getNVirtual(); ++i)
             {
@@ -145,15 +151,17 @@ template<class F> void slit_fill_basic_test(std::shared_ptr<ExecutionConfigurati
         pdata->removeVirtualParticles();
         filler->fill(3 + t);
 
-        ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::read);
-        ArrayHandle<Scalar4> h_vel(pdata->getVelocities(),
-                                   access_location::host,
-                                   access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
 
         for (unsigned int i = pdata->getN(); i < pdata->getN() + pdata->getNVirtual(); ++i)
             {
             const Scalar z = h_pos.data[i].z;
-            const Scalar4 vel_cell = h_vel.data[i];
+            const mpcd::SolventScalar4 vel_cell = h_vel.data[i];
             const Scalar3 vel = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
             if (z < Scalar(-5.0))
                 {
@@ -185,6 +193,121 @@ template<class F> void slit_fill_basic_test(std::shared_ptr<ExecutionConfigurati
     CHECK_CLOSE(T_avg, 1.5, tol);
     }
 
+template<class F> void slit_fill_reuse_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(20.0);
+    snap->particle_data.type_mapping.push_back("A");
+    snap->mpcd_data.resize(1);
+    snap->mpcd_data.type_mapping.push_back("A");
+    snap->mpcd_data.position[0] = vec3<Scalar>(1, -2, 3);
+    snap->mpcd_data.velocity[0] = vec3<Scalar>(123, 456, 789);
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+
+    auto pdata = sysdef->getMPCDParticleData();
+    auto cl = std::make_shared<mpcd::CellList>(sysdef);
+    cl->setCellSize(2.0);
+
+    auto slit = std::make_shared<const mpcd::detail::SlitGeometry>(5.0,
+                                                                   1.0,
+                                                                   mpcd::detail::boundary::no_slip);
+    std::shared_ptr<Variant> kT = std::make_shared<VariantConstant>(1.5);
+    std::shared_ptr<mpcd::SlitGeometryFiller> filler
+        = std::make_shared<F>(sysdef, 2.0, 1, kT, slit);
+    filler->setCellList(cl);
+    filler->setReusePositions(true);
+    UP_ASSERT(filler->getReusePositions());
+
+    // first fill draws and saves the positions
+    filler->fill(0);
+    const unsigned int N_virtual = pdata->getNVirtual();
+    UP_ASSERT_EQUAL(N_virtual, 2 * (2 * 20 * 20) * 2);
+    std::vector<mpcd::SolventScalar4> pos(N_virtual), vel(N_virtual);
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        std::copy(h_pos.data + 1, h_pos.data + 1 + N_virtual, pos.begin());
+        std::copy(h_vel.data + 1, h_vel.data + 1 + N_virtual, vel.begin());
+        }
+
+    /*
+     * Refill, which should give the same positions but new velocities around the wall velocity.
+     */
+    unsigned int N_lo(0), N_hi(0);
+    Scalar3 v_lo = make_scalar3(0, 0, 0);
+    Scalar3 v_hi = make_scalar3(0, 0, 0);
+    for (unsigned int t = 0; t < 500; ++t)
+        {
+        pdata->removeVirtualParticles();
+        filler->fill(1 + t);
+        UP_ASSERT_EQUAL(pdata->getNVirtual(), N_virtual);
+
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+        for (unsigned int i = 0; i < N_virtual; ++i)
+            {
+            const unsigned int pidx = pdata->getN() + i;
+            UP_ASSERT_EQUAL(h_tag.data[pidx], pidx);
+            UP_ASSERT_EQUAL(h_pos.data[pidx].x, pos[i].x);
+            UP_ASSERT_EQUAL(h_pos.data[pidx].y, pos[i].y);
+            UP_ASSERT_EQUAL(h_pos.data[pidx].z, pos[i].z);
+            UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[pidx].w), 1);
+            if (t == 0)
+                UP_ASSERT(h_vel.data[pidx].x != vel[i].x);
+
+            const mpcd::SolventScalar4 vel_cell = h_vel.data[pidx];
+            const Scalar3 v = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
+            if (h_pos.data[pidx].z < Scalar(-5.0))
+                {
+                v_lo += v;
+                ++N_lo;
+                }
+            else if (h_pos.data[pidx].z >= Scalar(5.0))
+                {
+                v_hi += v;
+                ++N_hi;
+                }
+            }
+        }
+    UP_ASSERT_EQUAL(N_lo, 500 * 2 * (2 * 20 * 20));
+    UP_ASSERT_EQUAL(N_hi, 500 * 2 * (2 * 20 * 20));
+    v_lo /= N_lo;
+    v_hi /= N_hi;
+    CHECK_CLOSE(v_lo.x, -1.0, tol);
+    CHECK_SMALL(v_lo.y, tol);
+    CHECK_SMALL(v_lo.z, tol);
+    CHECK_CLOSE(v_hi.x, 1.0, tol);
+    CHECK_SMALL(v_hi.y, tol);
+    CHECK_SMALL(v_hi.z, tol);
+
+    /*
+     * Changing the cell size should redraw the positions.
+     */
+    pdata->removeVirtualParticles();
+    cl->setCellSize(1.0);
+    filler->fill(501);
+    UP_ASSERT_EQUAL(pdata->getNVirtual(), 2 * (20 * 20 / 2) * 2);
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        for (unsigned int i = pdata->getN(); i < pdata->getN() + pdata->getNVirtual(); ++i)
+            {
+            const Scalar z = h_pos.data[i].z;
+            UP_ASSERT((z >= Scalar(-5.5) && z < Scalar(-5.0)) || (z >= Scalar(5.0) && z < 5.5));
+            }
+        }
+    }
+
 UP_TEST(slit_fill_basic)
     {
     slit_fill_basic_test<mpcd::SlitGeometryFiller>(
@@ -197,3 +320,16 @@ UP_TEST(slit_fill_basic_gpu)
         std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU));
     }
 #endif // ENABLE_HIP
+
+UP_TEST(slit_fill_reuse)
+    {
+    slit_fill_reuse_test<mpcd::SlitGeometryFiller>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU));
+    }
+#ifdef ENABLE_HIP
+UP_TEST(slit_fill_reuse_gpu)
+    {
+    slit_fill_reuse_test<mpcd::SlitGeometryFillerGPU>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU));
+    }
+#endif // ENABLE_HIP
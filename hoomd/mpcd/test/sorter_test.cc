@@ -95,7 +95,9 @@ template<class T> void sorter_test(std::shared_ptr<ExecutionConfiguration> exec_
         UP_ASSERT_EQUAL(h_tag.data[7], 0);
 
         // positions should be in order now
-        ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
         CHECK_CLOSE(h_pos.data[0].x, -0.5, tol);
         CHECK_CLOSE(h_pos.data[0].y, -0.5, tol);
         CHECK_CLOSE(h_pos.data[0].z, -0.5, tol);
@@ -121,19 +123,19 @@ template<class T> void sorter_test(std::shared_ptr<ExecutionConfiguration> exec_
         CHECK_CLOSE(h_pos.data[7].y, 0.5, tol);
         CHECK_CLOSE(h_pos.data[7].z, 0.5, tol);
         // types were set to the actual order of things
-        UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[0].w), 0);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[1].w), 1);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[2].w), 2);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[3].w), 3);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[4].w), 4);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[5].w), 5);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[6].w), 6);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[7].w), 7);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[0].w), 0);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[1].w), 1);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[2].w), 2);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[3].w), 3);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[4].w), 4);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[5].w), 5);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[6].w), 6);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[7].w), 7);
 
         // velocities should also be sorted
-        ArrayHandle<Scalar4> h_vel(pdata->getVelocities(),
-                                   access_location::host,
-                                   access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
         CHECK_CLOSE(h_vel.data[0].x, 0., tol);
         CHECK_CLOSE(h_vel.data[0].y, -0.5, tol);
         CHECK_CLOSE(h_vel.data[0].z, 0.5, tol);
@@ -159,14 +161,14 @@ template<class T> void sorter_test(std::shared_ptr<ExecutionConfiguration> exec_
         CHECK_CLOSE(h_vel.data[7].y, -7.5, tol);
         CHECK_CLOSE(h_vel.data[7].z, 7.5, tol);
         // cells should be in the right order now too
-        UP_ASSERT_EQUAL(__scalar_as_int(h_vel.data[0].w), 0);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_vel.data[1].w), 1);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_vel.data[2].w), 2);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_vel.data[3].w), 3);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_vel.data[4].w), 4);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_vel.data[5].w), 5);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_vel.data[6].w), 6);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_vel.data[7].w), 7);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[0].w), 0);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[1].w), 1);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[2].w), 2);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[3].w), 3);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[4].w), 4);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[5].w), 5);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[6].w), 6);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[7].w), 7);
         }
 
         // check that the cell list has been updated as well
@@ -251,24 +253,32 @@ template<class T> void sorter_virtual_test(std::shared_ptr<ExecutionConfiguratio
     auto pdata = sysdef->getMPCDParticleData();
     pdata->addVirtualParticles(2);
         {
-        ArrayHandle<Scalar4> h_pos(pdata->getPositions(),
-                                   access_location::host,
-                                   access_mode::readwrite);
-        ArrayHandle<Scalar4> h_vel(pdata->getVelocities(),
-                                   access_location::host,
-                                   access_mode::readwrite);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::readwrite);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::readwrite);
         ArrayHandle<unsigned int> h_tag(pdata->getTags(),
                                         access_location::host,
                                         access_mode::readwrite);
 
-        h_pos.data[pdata->getN() + 0] = make_scalar4(0.5, -0.5, -0.5, __int_as_scalar(1));
+        h_pos.data[pdata->getN() + 0]
+            = mpcd::make_solvent_scalar4(0.5, -0.5, -0.5, mpcd::__int_as_solvent_scalar(1));
         h_vel.data[pdata->getN() + 0]
-            = make_scalar4(1., -1.5, 1.5, __int_as_scalar(mpcd::detail::NO_CELL));
+            = mpcd::make_solvent_scalar4(1.,
+                                         -1.5,
+                                         1.5,
+                                         mpcd::__int_as_solvent_scalar(mpcd::detail::NO_CELL));
         h_tag.data[pdata->getN() + 0] = 6;
 
-        h_pos.data[pdata->getN() + 1] = make_scalar4(0.5, 0.5, -0.5, __int_as_scalar(3));
+        h_pos.data[pdata->getN() + 1]
+            = mpcd::make_solvent_scalar4(0.5, 0.5, -0.5, mpcd::__int_as_solvent_scalar(3));
         h_vel.data[pdata->getN() + 1]
-            = make_scalar4(3., -3.5, 3.5, __int_as_scalar(mpcd::detail::NO_CELL));
+            = mpcd::make_solvent_scalar4(3.,
+                                         -3.5,
+                                         3.5,
+                                         mpcd::__int_as_solvent_scalar(mpcd::detail::NO_CELL));
         h_tag.data[pdata->getN() + 1] = 7;
         }
 
@@ -292,7 +302,9 @@ template<class T> void sorter_virtual_test(std::shared_ptr<ExecutionConfiguratio
         UP_ASSERT_EQUAL(h_tag.data[7], 7);
 
         // positions should be in order now, with virtual particles at the end unsorted
-        ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
         CHECK_CLOSE(h_pos.data[0].x, -0.5, tol);
         CHECK_CLOSE(h_pos.data[0].y, -0.5, tol);
         CHECK_CLOSE(h_pos.data[0].z, -0.5, tol);
@@ -320,20 +332,20 @@ template<class T> void sorter_virtual_test(std::shared_ptr<ExecutionConfiguratio
         CHECK_CLOSE(h_pos.data[7].z, -0.5, tol);
 
         // types were set to the actual order of things
-        UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[0].w), 0);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[1].w), 2);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[2].w), 4);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[3].w), 5);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[4].w), 6);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[5].w), 7);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[0].w), 0);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[1].w), 2);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[2].w), 4);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[3].w), 5);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[4].w), 6);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[5].w), 7);
         // VPs
-        UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[6].w), 1);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_pos.data[7].w), 3);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[6].w), 1);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_pos.data[7].w), 3);
 
         // velocities should also be sorted
-        ArrayHandle<Scalar4> h_vel(pdata->getVelocities(),
-                                   access_location::host,
-                                   access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
         CHECK_CLOSE(h_vel.data[0].x, 0., tol);
         CHECK_CLOSE(h_vel.data[0].y, -0.5, tol);
         CHECK_CLOSE(h_vel.data[0].z, 0.5, tol);
@@ -360,15 +372,15 @@ template<class T> void sorter_virtual_test(std::shared_ptr<ExecutionConfiguratio
         CHECK_CLOSE(h_vel.data[7].y, -3.5, tol);
         CHECK_CLOSE(h_vel.data[7].z, 3.5, tol);
         // cells should be in the right order now too
-        UP_ASSERT_EQUAL(__scalar_as_int(h_vel.data[0].w), 0);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_vel.data[1].w), 2);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_vel.data[2].w), 4);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_vel.data[3].w), 5);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_vel.data[4].w), 6);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_vel.data[5].w), 7);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[0].w), 0);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[1].w), 2);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[2].w), 4);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[3].w), 5);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[4].w), 6);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[5].w), 7);
         // VPs
-        UP_ASSERT_EQUAL(__scalar_as_int(h_vel.data[6].w), 1);
-        UP_ASSERT_EQUAL(__scalar_as_int(h_vel.data[7].w), 3);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[6].w), 1);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[7].w), 3);
         }
 
         // check that the cell list has been updated as well
@@ -402,6 +414,130 @@ template<class T> void sorter_virtual_test(std::shared_ptr<ExecutionConfiguratio
         }
     }
 
+//! Test for sorting MPCD particles along space-filling curves
+template<class T> void sorter_curve_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    // place one mpcd particle per cell in a 4x4x4 grid, in reverse row-major order
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(4.0);
+    snap->particle_data.type_mapping.push_back("A");
+    snap->mpcd_data.resize(64);
+    snap->mpcd_data.type_mapping.push_back("A");
+    for (unsigned int i = 0; i < 64; ++i)
+        {
+        const unsigned int cell = 63 - i;
+        snap->mpcd_data.position[i] = vec3<Scalar>(Scalar(cell % 4) - 1.5,
+                                                   Scalar((cell / 4) % 4) - 1.5,
+                                                   Scalar(cell / 16) - 1.5);
+        }
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+    std::shared_ptr<mpcd::ParticleData> pdata = sysdef->getMPCDParticleData();
+
+    auto cl = std::make_shared<mpcd::CellList>(sysdef);
+    std::shared_ptr<T> sorter = std::make_shared<T>(sysdef, 0, 1);
+    sorter->setCellList(cl);
+    UP_ASSERT_EQUAL(sorter->getCellOrdering(), "cell");
+    UP_ASSERT_EXCEPTION(std::runtime_error, [&] { sorter->setCellOrdering("peano"); });
+
+    // along the Hilbert curve, consecutive particles must be in neighboring cells
+    sorter->setCellOrdering("hilbert");
+    UP_ASSERT_EQUAL(sorter->getCellOrdering(), "hilbert");
+    sorter->update(0);
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        std::vector<unsigned int> tags(64);
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+        for (unsigned int i = 0; i < 64; ++i)
+            {
+            tags[i] = h_tag.data[i];
+            }
+        std::sort(tags.begin(), tags.end());
+        for (unsigned int i = 0; i < 64; ++i)
+            {
+            UP_ASSERT_EQUAL(tags[i], i);
+            }
+        for (unsigned int i = 1; i < 64; ++i)
+            {
+            const mpcd::SolventScalar4 a = h_pos.data[i - 1];
+            const mpcd::SolventScalar4 b = h_pos.data[i];
+            const Scalar dist = std::abs(a.x - b.x) + std::abs(a.y - b.y) + std::abs(a.z - b.z);
+            CHECK_CLOSE(dist, 1.0, tol_small);
+            }
+        }
+
+    // along the Morton curve, the first eight particles fill the first octant
+    sorter->setCellOrdering("morton");
+    UP_ASSERT_EQUAL(sorter->getCellOrdering(), "morton");
+    sorter->update(1);
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        for (unsigned int i = 0; i < 8; ++i)
+            {
+            const mpcd::SolventScalar4 pos = h_pos.data[i];
+            UP_ASSERT(pos.x < 0 && pos.y < 0 && pos.z < 0);
+            }
+        }
+    }
+
+//! Test for adaptive sorting based on the disorder of MPCD particles
+template<class T> void sorter_adaptive_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    // place two mpcd particles per cell, cycling through the cells so no neighbors share a cell
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(2.0);
+    snap->particle_data.type_mapping.push_back("A");
+    snap->mpcd_data.resize(16);
+    snap->mpcd_data.type_mapping.push_back("A");
+    for (unsigned int i = 0; i < 16; ++i)
+        {
+        const unsigned int cell = i % 8;
+        snap->mpcd_data.position[i] = vec3<Scalar>(Scalar(cell % 2) - 0.5,
+                                                   Scalar((cell / 2) % 2) - 0.5,
+                                                   Scalar(cell / 4) - 0.5);
+        }
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+    std::shared_ptr<mpcd::ParticleData> pdata = sysdef->getMPCDParticleData();
+
+    auto cl = std::make_shared<mpcd::CellList>(sysdef);
+    std::shared_ptr<T> sorter = std::make_shared<T>(sysdef, 0, 1);
+    sorter->setCellList(cl);
+    UP_ASSERT_EXCEPTION(std::runtime_error, [&] { sorter->setDisorderThreshold(-0.1); });
+    UP_ASSERT_EXCEPTION(std::runtime_error, [&] { sorter->setDisorderThreshold(1.1); });
+    sorter->setDisorderThreshold(0.75);
+    CHECK_CLOSE(sorter->getDisorderThreshold(), 0.75, tol_small);
+
+    // every particle is in a different cell than its neighbor, so the particles are sorted
+    sorter->update(0);
+    UP_ASSERT(sorter->getSorted());
+    CHECK_CLOSE(sorter->getDisorder(), 1.0, tol_small);
+
+    // after sorting, pairs of particles share a cell, which is below the threshold
+    std::vector<unsigned int> tags(16);
+        {
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+        std::copy(h_tag.data, h_tag.data + 16, tags.begin());
+        }
+    sorter->update(1);
+    UP_ASSERT(!sorter->getSorted());
+    CHECK_CLOSE(sorter->getDisorder(), 7.0 / 15.0, tol_small);
+        {
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+        for (unsigned int i = 0; i < 16; ++i)
+            {
+            UP_ASSERT_EQUAL(h_tag.data[i], tags[i]);
+            }
+        }
+
+    // a zero threshold always sorts
+    sorter->setDisorderThreshold(0.0);
+    sorter->update(2);
+    UP_ASSERT(sorter->getSorted());
+    }
+
 //! basic test case for MPCD sorter
 UP_TEST(mpcd_sorter_test)
     {
@@ -414,6 +550,18 @@ UP_TEST(mpcd_sorter_virtual_test)
     sorter_virtual_test<mpcd::Sorter>(std::shared_ptr<ExecutionConfiguration>(
         new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
+//! test case for MPCD sorter along space-filling curves
+UP_TEST(mpcd_sorter_curve_test)
+    {
+    sorter_curve_test<mpcd::Sorter>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! test case for adaptive MPCD sorter
+UP_TEST(mpcd_sorter_adaptive_test)
+    {
+    sorter_adaptive_test<mpcd::Sorter>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
 #ifdef ENABLE_HIP
 UP_TEST(mpcd_sorter_test_gpu)
     {
@@ -425,4 +573,14 @@ UP_TEST(mpcd_sorter_virtual_test_gpu)
     sorter_virtual_test<mpcd::SorterGPU>(std::shared_ptr<ExecutionConfiguration>(
         new ExecutionConfiguration(ExecutionConfiguration::GPU)));
     }
+UP_TEST(mpcd_sorter_curve_test_gpu)
+    {
+    sorter_curve_test<mpcd::SorterGPU>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU)));
+    }
+UP_TEST(mpcd_sorter_adaptive_test_gpu)
+    {
+    sorter_adaptive_test<mpcd::SorterGPU>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU)));
+    }
 #endif // ENABLE_HIP
@@ -1,10 +1,15 @@
 // Copyright (c) 2009-2024 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "hoomd/mpcd/SRDAngularCollisionMethod.h"
 #include "hoomd/mpcd/SRDCollisionMethod.h"
 #include "utils.h"
 #ifdef ENABLE_HIP
+#include "hoomd/mpcd/CellThermoCompute.h"
+#include "hoomd/mpcd/ConfinedStreamingMethodGPU.h"
+#include "hoomd/mpcd/SRDAngularCollisionMethodGPU.h"
 #include "hoomd/mpcd/SRDCollisionMethodGPU.h"
+#include "hoomd/mpcd/StreamingGeometry.h"
 #endif // ENABLE_HIP
 
 #include "hoomd/SnapshotSystemData.h"
@@ -68,9 +73,9 @@ void srd_collision_method_basic_test(std::shared_ptr<ExecutionConfiguration> exe
     UP_ASSERT(!collide->peekCollide(0));
     collide->collide(0);
         {
-        ArrayHandle<Scalar4> h_vel(pdata_4->getVelocities(),
-                                   access_location::host,
-                                   access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata_4->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
         for (unsigned int i = 0; i < pdata_4->getN(); ++i)
             {
             CHECK_CLOSE(h_vel.data[i].x, orig_vel[i].x, tol_small);
@@ -95,9 +100,9 @@ void srd_collision_method_basic_test(std::shared_ptr<ExecutionConfiguration> exe
     UP_ASSERT(collide->peekCollide(1));
     collide->collide(1);
         {
-        ArrayHandle<Scalar4> h_vel(pdata_4->getVelocities(),
-                                   access_location::host,
-                                   access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata_4->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
         ArrayHandle<double3> h_rotvec(collide->getRotationVectors(),
                                       access_location::host,
                                       access_mode::read);
@@ -119,7 +124,7 @@ void srd_collision_method_basic_test(std::shared_ptr<ExecutionConfiguration> exe
                 }
 
             // all rotation vectors should be unit norm
-            const unsigned int cell = __scalar_as_int(h_vel.data[i].w);
+            const unsigned int cell = mpcd::__solvent_scalar_as_int(h_vel.data[i].w);
             const Scalar3 rot_vec
                 = make_scalar3(h_rotvec.data[cell].x, h_rotvec.data[cell].y, h_rotvec.data[cell].z);
             CHECK_CLOSE(dot(rot_vec, rot_vec), 1.0, tol_small);
@@ -380,6 +385,182 @@ void srd_collision_method_thermostat_test(std::shared_ptr<ExecutionConfiguration
         }
     }
 
+#ifdef ENABLE_HIP
+//! Test that fusing the streaming and collision gives the same result as doing them separately
+/*!
+ * Two identical systems are streamed and collided, one by streaming then building the cell list
+ * for the collision, and one by accumulating the cell properties while streaming. Virtual
+ * particles are added after streaming to check that they are included in the collision.
+ */
+void srd_collision_method_fused_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    auto box = std::make_shared<BoxDim>(10.0);
+    std::vector<std::shared_ptr<mpcd::ParticleData>> pdatas;
+    for (unsigned int fused = 0; fused < 2; ++fused)
+        {
+        auto sysdef = std::make_shared<hoomd::SystemDefinition>(0, box, 1, 0, 0, 0, 0, exec_conf);
+        auto pdata = std::make_shared<mpcd::ParticleData>(10000, box, 1.0, 42, 3, exec_conf);
+        sysdef->setMPCDParticleData(pdata);
+        pdatas.push_back(pdata);
+
+        auto cl = std::make_shared<mpcd::CellList>(sysdef);
+        auto collide = std::make_shared<mpcd::SRDCollisionMethodGPU>(sysdef, 0, 2, 0, 827);
+        collide->setCellList(cl);
+        std::shared_ptr<Variant> T = std::make_shared<VariantConstant>(1.5);
+        collide->setTemperature(T);
+
+        auto geom = std::make_shared<const mpcd::detail::BulkGeometry>();
+        auto stream
+            = std::make_shared<mpcd::ConfinedStreamingMethodGPU<mpcd::detail::BulkGeometry>>(
+                sysdef,
+                0,
+                2,
+                0,
+                geom);
+        stream->setCellList(cl);
+        stream->setDeltaT(0.05);
+
+        for (uint64_t timestep = 0; timestep < 10; timestep += 2)
+            {
+            pdata->removeVirtualParticles();
+            if (fused)
+                {
+                auto thermo = collide->beginFusedCollision(timestep + 2);
+                UP_ASSERT(thermo);
+                UP_ASSERT(stream->streamFused(timestep, thermo));
+                }
+            else
+                {
+                stream->stream(timestep);
+                }
+
+            // add two virtual particles into the same cell
+            pdata->addVirtualParticles(2);
+                {
+                ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                        access_location::host,
+                                                        access_mode::readwrite);
+                ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                        access_location::host,
+                                                        access_mode::readwrite);
+                const unsigned int N = pdata->getN();
+                h_pos.data[N]
+                    = mpcd::make_solvent_scalar4(0.5, 0.5, 0.5, mpcd::__int_as_solvent_scalar(0));
+                h_pos.data[N + 1]
+                    = mpcd::make_solvent_scalar4(0.5, 0.5, 0.5, mpcd::__int_as_solvent_scalar(0));
+                h_vel.data[N]
+                    = mpcd::make_solvent_scalar4(1.0, 0.0, 0.0, mpcd::__int_as_solvent_scalar(0));
+                h_vel.data[N + 1]
+                    = mpcd::make_solvent_scalar4(-1.0, 1.0, 0.0, mpcd::__int_as_solvent_scalar(0));
+                }
+
+            UP_ASSERT(collide->peekCollide(timestep + 2));
+            collide->collide(timestep + 2);
+            }
+        }
+
+    // particles should still match
+    UP_ASSERT_EQUAL(pdatas[0]->getN() + pdatas[0]->getNVirtual(),
+                    pdatas[1]->getN() + pdatas[1]->getNVirtual());
+    ArrayHandle<mpcd::SolventScalar4> h_pos_ref(pdatas[0]->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+    ArrayHandle<mpcd::SolventScalar4> h_vel_ref(pdatas[0]->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+    ArrayHandle<mpcd::SolventScalar4> h_pos(pdatas[1]->getPositions(),
+                                            access_location::host,
+                                            access_mode::read);
+    ArrayHandle<mpcd::SolventScalar4> h_vel(pdatas[1]->getVelocities(),
+                                            access_location::host,
+                                            access_mode::read);
+    for (unsigned int i = 0; i < pdatas[0]->getN() + pdatas[0]->getNVirtual(); ++i)
+        {
+        CHECK_CLOSE(h_pos.data[i].x, h_pos_ref.data[i].x, tol_small);
+        CHECK_CLOSE(h_pos.data[i].y, h_pos_ref.data[i].y, tol_small);
+        CHECK_CLOSE(h_pos.data[i].z, h_pos_ref.data[i].z, tol_small);
+        CHECK_CLOSE(h_vel.data[i].x, h_vel_ref.data[i].x, tol_small);
+        CHECK_CLOSE(h_vel.data[i].y, h_vel_ref.data[i].y, tol_small);
+        CHECK_CLOSE(h_vel.data[i].z, h_vel_ref.data[i].z, tol_small);
+        UP_ASSERT_EQUAL(mpcd::__solvent_scalar_as_int(h_vel.data[i].w),
+                        mpcd::__solvent_scalar_as_int(h_vel_ref.data[i].w));
+        }
+    }
+#endif // ENABLE_HIP
+
+//! Test that the SRD+a collision method conserves angular momentum
+template<class CM>
+void srd_angular_collision_method_test(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                                       bool thermostat)
+    {
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(2.0);
+    snap->particle_data.type_mapping.push_back("A");
+    // three particles in one cell, two (collinear) particles in another
+    snap->mpcd_data.resize(5);
+    snap->mpcd_data.type_mapping.push_back("A");
+    snap->mpcd_data.position[0] = vec3<Scalar>(-0.8, -0.2, -0.5);
+    snap->mpcd_data.position[1] = vec3<Scalar>(-0.3, -0.7, -0.1);
+    snap->mpcd_data.position[2] = vec3<Scalar>(-0.5, -0.5, -0.9);
+    snap->mpcd_data.position[3] = vec3<Scalar>(0.2, 0.2, 0.2);
+    snap->mpcd_data.position[4] = vec3<Scalar>(0.8, 0.8, 0.8);
+    snap->mpcd_data.velocity[0] = vec3<Scalar>(2.0, 0.0, 1.0);
+    snap->mpcd_data.velocity[1] = vec3<Scalar>(1.0, -1.0, 0.0);
+    snap->mpcd_data.velocity[2] = vec3<Scalar>(0.0, 3.0, -2.0);
+    snap->mpcd_data.velocity[3] = vec3<Scalar>(5.0, -2.0, 3.0);
+    snap->mpcd_data.velocity[4] = vec3<Scalar>(-1.0, 2.0, -5.0);
+    snap->mpcd_data.mass = 1.5;
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+    std::shared_ptr<mpcd::ParticleData> pdata = sysdef->getMPCDParticleData();
+
+    auto cl = std::make_shared<mpcd::CellList>(sysdef);
+    std::shared_ptr<mpcd::SRDCollisionMethod> collide = std::make_shared<CM>(sysdef, 0, 1, -1, 42);
+    collide->setCellList(cl);
+    collide->enableGridShifting(false);
+    collide->setRotationAngle(130. * M_PI / 180.);
+    if (thermostat)
+        {
+        collide->setTemperature(std::make_shared<VariantConstant>(2.0));
+        }
+
+    // net momentum and angular momentum about the origin (the cells do not cross the boundaries)
+    auto compute_momenta = [&](Scalar3& P, Scalar3& L)
+    {
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        P = make_scalar3(0, 0, 0);
+        L = make_scalar3(0, 0, 0);
+        for (unsigned int i = 0; i < pdata->getN(); ++i)
+            {
+            const Scalar3 r = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            const Scalar3 p = pdata->getMass()
+                              * make_scalar3(h_vel.data[i].x, h_vel.data[i].y, h_vel.data[i].z);
+            P += p;
+            L += make_scalar3(r.y * p.z - r.z * p.y, r.z * p.x - r.x * p.z, r.x * p.y - r.y * p.x);
+            }
+    };
+    Scalar3 orig_P, orig_L;
+    compute_momenta(orig_P, orig_L);
+
+    for (uint64_t timestep = 0; timestep < 5; ++timestep)
+        {
+        collide->collide(timestep);
+
+        Scalar3 P, L;
+        compute_momenta(P, L);
+        CHECK_CLOSE(P.x, orig_P.x, tol_small);
+        CHECK_CLOSE(P.y, orig_P.y, tol_small);
+        CHECK_CLOSE(P.z, orig_P.z, tol_small);
+        CHECK_CLOSE(L.x, orig_L.x, tol_small);
+        CHECK_CLOSE(L.y, orig_L.y, tol_small);
+        CHECK_CLOSE(L.z, orig_L.z, tol_small);
+        }
+    }
+
 //! basic test case for MPCD SRDCollisionMethod class
 UP_TEST(srd_collision_method_basic)
     {
@@ -403,6 +584,13 @@ UP_TEST(srd_collision_method_thermostat)
     srd_collision_method_thermostat_test<mpcd::SRDCollisionMethod>(
         std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU));
     }
+//! test angular momentum conservation of the MPCD SRDAngularCollisionMethod class
+UP_TEST(srd_angular_collision_method)
+    {
+    auto exec_conf = std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU);
+    srd_angular_collision_method_test<mpcd::SRDAngularCollisionMethod>(exec_conf, false);
+    srd_angular_collision_method_test<mpcd::SRDAngularCollisionMethod>(exec_conf, true);
+    }
 #ifdef ENABLE_HIP
 //! basic test case for MPCD SRDCollisionMethodGPU class
 UP_TEST(srd_collision_method_basic_gpu)
@@ -427,4 +615,17 @@ UP_TEST(srd_collision_method_thermostat_gpu)
     srd_collision_method_thermostat_test<mpcd::SRDCollisionMethodGPU>(
         std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU));
     }
+//! test angular momentum conservation of the MPCD SRDAngularCollisionMethodGPU class
+UP_TEST(srd_angular_collision_method_gpu)
+    {
+    auto exec_conf = std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU);
+    srd_angular_collision_method_test<mpcd::SRDAngularCollisionMethodGPU>(exec_conf, false);
+    srd_angular_collision_method_test<mpcd::SRDAngularCollisionMethodGPU>(exec_conf, true);
+    }
+//! test fusing the streaming and collision of the MPCD SRDCollisionMethodGPU class
+UP_TEST(srd_collision_method_fused_gpu)
+    {
+    srd_collision_method_fused_test(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU));
+    }
 #endif // ENABLE_HIP
@@ -7,9 +7,13 @@
 #include "hoomd/mpcd/ConfinedStreamingMethodGPU.h"
 #endif // ENABLE_HIP
 
+#include "hoomd/GPUPolymorph.h"
 #include "hoomd/SnapshotSystemData.h"
+#include "hoomd/mpcd/ExternalField.h"
 #include "hoomd/test/upp11_config.h"
 
+#include <random>
+
 HOOMD_UP_MAIN()
 
 using namespace hoomd;
@@ -47,9 +51,9 @@ void streaming_method_basic_test(std::shared_ptr<ExecutionConfiguration> exec_co
     stream->stream(2);
     std::shared_ptr<mpcd::ParticleData> pdata_2 = sysdef->getMPCDParticleData();
         {
-        ArrayHandle<Scalar4> h_pos(pdata_2->getPositions(),
-                                   access_location::host,
-                                   access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata_2->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
         CHECK_CLOSE(h_pos.data[0].x, 1.0, tol);
         CHECK_CLOSE(h_pos.data[0].y, 4.85, tol);
         CHECK_CLOSE(h_pos.data[0].z, 3.0, tol);
@@ -63,9 +67,9 @@ void streaming_method_basic_test(std::shared_ptr<ExecutionConfiguration> exec_co
     UP_ASSERT(stream->peekStream(3));
     stream->stream(3);
         {
-        ArrayHandle<Scalar4> h_pos(pdata_2->getPositions(),
-                                   access_location::host,
-                                   access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata_2->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
         CHECK_CLOSE(h_pos.data[0].x, 1.1, tol);
         CHECK_CLOSE(h_pos.data[0].y, 4.95, tol);
         CHECK_CLOSE(h_pos.data[0].z, 3.1, tol);
@@ -81,9 +85,9 @@ void streaming_method_basic_test(std::shared_ptr<ExecutionConfiguration> exec_co
     UP_ASSERT(stream->peekStream(5));
     stream->stream(5);
         {
-        ArrayHandle<Scalar4> h_pos(pdata_2->getPositions(),
-                                   access_location::host,
-                                   access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata_2->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
         CHECK_CLOSE(h_pos.data[0].x, 1.2, tol);
         CHECK_CLOSE(h_pos.data[0].y, -4.95, tol);
         CHECK_CLOSE(h_pos.data[0].z, 3.2, tol);
@@ -97,9 +101,9 @@ void streaming_method_basic_test(std::shared_ptr<ExecutionConfiguration> exec_co
     stream->setDeltaT(0.1);
     stream->stream(7);
         {
-        ArrayHandle<Scalar4> h_pos(pdata_2->getPositions(),
-                                   access_location::host,
-                                   access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata_2->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
         CHECK_CLOSE(h_pos.data[0].x, 1.4, tol);
         CHECK_CLOSE(h_pos.data[0].y, -4.75, tol);
         CHECK_CLOSE(h_pos.data[0].z, 3.4, tol);
@@ -110,6 +114,186 @@ void streaming_method_basic_test(std::shared_ptr<ExecutionConfiguration> exec_co
         }
     }
 
+//! Test for collision statistics of the confined streaming method
+template<class SM>
+void streaming_method_collision_statistics_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(20.0);
+    snap->particle_data.type_mapping.push_back("A");
+
+    // 3 particle system: one does not collide, one collides once, and one collides three times
+    snap->mpcd_data.resize(3);
+    snap->mpcd_data.type_mapping.push_back("A");
+    snap->mpcd_data.position[0] = vec3<Scalar>(0.0, 0.0, 0.0);
+    snap->mpcd_data.position[1] = vec3<Scalar>(0.0, 0.0, 2.5);
+    snap->mpcd_data.position[2] = vec3<Scalar>(0.0, 0.0, 2.0);
+
+    snap->mpcd_data.velocity[0] = vec3<Scalar>(0.0, 0.0, 0.1);
+    snap->mpcd_data.velocity[1] = vec3<Scalar>(0.0, 0.0, 1.0);
+    snap->mpcd_data.velocity[2] = vec3<Scalar>(0.0, 0.0, 10.0);
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+
+    // cosine channel with walls at z = -1 and z = 3 for x = 0
+    const auto bc = mpcd::detail::boundary::no_slip;
+    auto geom = std::make_shared<const mpcd::detail::CosineChannel>(20.0, 1.0, 2.0, 1, bc);
+    std::shared_ptr<SM> stream = std::make_shared<SM>(sysdef, 0, 1, 0, geom);
+    auto cl = std::make_shared<mpcd::CellList>(sysdef);
+    stream->setCellList(cl);
+    stream->setDeltaT(1.0);
+
+    // statistics are not tracked by default
+    UP_ASSERT(!stream->getTrackCollisions());
+    stream->setTrackCollisions(true);
+    UP_ASSERT(stream->getTrackCollisions());
+    stream->stream(0);
+        {
+        const mpcd::detail::CollisionStatistics& stats = stream->getCollisionStatistics();
+        UP_ASSERT_EQUAL(stats.collisions, 4);
+        UP_ASSERT_EQUAL(stats.multiple, 1);
+        // vertical collisions have a linear wall distance, so the first guess converges
+        UP_ASSERT_EQUAL(stats.iterations, 4);
+        UP_ASSERT_EQUAL(stats.fallbacks, 0);
+        UP_ASSERT_EQUAL(stats.unconverged, 0);
+        }
+
+    std::shared_ptr<mpcd::ParticleData> pdata = sysdef->getMPCDParticleData();
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<mpcd::SolventScalar4> h_vel(pdata->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+        CHECK_CLOSE(h_pos.data[0].z, 0.1, tol_small);
+        CHECK_CLOSE(h_vel.data[0].z, 0.1, tol_small);
+        CHECK_CLOSE(h_pos.data[1].z, 2.5, tol_small);
+        CHECK_CLOSE(h_vel.data[1].z, -1.0, tol_small);
+        CHECK_CLOSE(h_pos.data[2].z, 2.0, tol_small);
+        CHECK_CLOSE(h_vel.data[2].z, -10.0, tol_small);
+        }
+
+    // turning off the statistics resets them, even though the last particle collides twice
+    stream->setTrackCollisions(false);
+    stream->stream(1);
+        {
+        const mpcd::detail::CollisionStatistics& stats = stream->getCollisionStatistics();
+        UP_ASSERT_EQUAL(stats.collisions, 0);
+        UP_ASSERT_EQUAL(stats.multiple, 0);
+        UP_ASSERT_EQUAL(stats.iterations, 0);
+        }
+        {
+        ArrayHandle<mpcd::SolventScalar4> h_pos(pdata->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+        CHECK_SMALL(h_pos.data[2].z, tol_small);
+        }
+    }
+
+#ifdef ENABLE_HIP
+//! Test that bulk streaming gives the same result on the CPU and the GPU
+/*!
+ * Without a field, the GPU streams with the specialized bulk kernel. With a field, it takes the
+ * generic path. In both cases, the particles should match the CPU.
+ */
+void streaming_method_bulk_cpu_gpu_test(bool with_field)
+    {
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(10.0);
+    snap->particle_data.type_mapping.push_back("A");
+
+    // random particles that are fast enough to cross the boundaries
+    const unsigned int N = 1000;
+    snap->mpcd_data.resize(N);
+    snap->mpcd_data.type_mapping.push_back("A");
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<Scalar> pos_dist(-5.0, 5.0);
+    std::uniform_real_distribution<Scalar> vel_dist(-20.0, 20.0);
+    for (unsigned int i = 0; i < N; ++i)
+        {
+        snap->mpcd_data.position[i] = vec3<Scalar>(pos_dist(gen), pos_dist(gen), pos_dist(gen));
+        snap->mpcd_data.velocity[i] = vec3<Scalar>(vel_dist(gen), vel_dist(gen), vel_dist(gen));
+        }
+
+    std::vector<std::shared_ptr<ExecutionConfiguration>> exec_confs
+        = {std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU),
+           std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU)};
+    std::vector<std::shared_ptr<mpcd::ParticleData>> pdatas;
+    for (const auto& exec_conf : exec_confs)
+        {
+        std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+        pdatas.push_back(sysdef->getMPCDParticleData());
+
+        auto geom = std::make_shared<const mpcd::detail::BulkGeometry>();
+        std::shared_ptr<mpcd::StreamingMethod> stream;
+        if (exec_conf->isCUDAEnabled())
+            {
+            stream = std::make_shared<mpcd::ConfinedStreamingMethodGPU<mpcd::detail::BulkGeometry>>(
+                sysdef,
+                0,
+                1,
+                0,
+                geom);
+            }
+        else
+            {
+            stream = std::make_shared<mpcd::ConfinedStreamingMethod<mpcd::detail::BulkGeometry>>(
+                sysdef,
+                0,
+                1,
+                0,
+                geom);
+            }
+        auto cl = std::make_shared<mpcd::CellList>(sysdef);
+        stream->setCellList(cl);
+        stream->setDeltaT(0.1);
+
+        if (with_field)
+            {
+            auto field = std::make_shared<hoomd::GPUPolymorph<mpcd::ExternalField>>(exec_conf);
+            field->reset<mpcd::ConstantForce>(make_scalar3(1.0, -2.0, 0.5));
+            stream->setField(field);
+            }
+
+        for (uint64_t timestep = 0; timestep < 5; ++timestep)
+            {
+            stream->stream(timestep);
+            }
+        }
+
+    // particles should match, up to wrapping across the boundaries
+    const BoxDim& box = *snap->global_box;
+    ArrayHandle<mpcd::SolventScalar4> h_pos_cpu(pdatas[0]->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+    ArrayHandle<mpcd::SolventScalar4> h_vel_cpu(pdatas[0]->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+    ArrayHandle<mpcd::SolventScalar4> h_pos_gpu(pdatas[1]->getPositions(),
+                                                access_location::host,
+                                                access_mode::read);
+    ArrayHandle<mpcd::SolventScalar4> h_vel_gpu(pdatas[1]->getVelocities(),
+                                                access_location::host,
+                                                access_mode::read);
+    UP_ASSERT_EQUAL(pdatas[0]->getN(), N);
+    UP_ASSERT_EQUAL(pdatas[1]->getN(), N);
+    for (unsigned int i = 0; i < N; ++i)
+        {
+        const Scalar3 dr = box.minImage(
+            make_scalar3(h_pos_gpu.data[i].x - h_pos_cpu.data[i].x,
+                         h_pos_gpu.data[i].y - h_pos_cpu.data[i].y,
+                         h_pos_gpu.data[i].z - h_pos_cpu.data[i].z));
+        CHECK_SMALL(dr.x, tol_small);
+        CHECK_SMALL(dr.y, tol_small);
+        CHECK_SMALL(dr.z, tol_small);
+
+        CHECK_SMALL(h_vel_gpu.data[i].x - h_vel_cpu.data[i].x, tol_small);
+        CHECK_SMALL(h_vel_gpu.data[i].y - h_vel_cpu.data[i].y, tol_small);
+        CHECK_SMALL(h_vel_gpu.data[i].z - h_vel_cpu.data[i].z, tol_small);
+        }
+    }
+#endif // ENABLE_HIP
+
 //! basic test case for MPCD StreamingMethod class
 UP_TEST(mpcd_streaming_method_basic)
     {
@@ -126,3 +310,34 @@ UP_TEST(mpcd_streaming_method_setup)
         std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU));
     }
 #endif // ENABLE_HIP
+
+//! test case for collision statistics of MPCD ConfinedStreamingMethod class
+UP_TEST(mpcd_streaming_method_collision_statistics)
+    {
+    typedef mpcd::ConfinedStreamingMethod<mpcd::detail::CosineChannel> method;
+    streaming_method_collision_statistics_test<method>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU));
+    }
+#ifdef ENABLE_HIP
+//! test case for collision statistics of MPCD ConfinedStreamingMethodGPU class
+UP_TEST(mpcd_streaming_method_collision_statistics_gpu)
+    {
+    typedef mpcd::ConfinedStreamingMethodGPU<mpcd::detail::CosineChannel> method;
+    streaming_method_collision_statistics_test<method>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU));
+    }
+#endif // ENABLE_HIP
+
+#ifdef ENABLE_HIP
+//! test case for bulk streaming with the specialized GPU kernel
+UP_TEST(mpcd_streaming_method_bulk_cpu_gpu)
+    {
+    streaming_method_bulk_cpu_gpu_test(false);
+    }
+
+//! test case for bulk streaming in a field with the generic GPU kernel
+UP_TEST(mpcd_streaming_method_bulk_field_cpu_gpu)
+    {
+    streaming_method_bulk_cpu_gpu_test(true);
+    }
+#endif // ENABLE_HIP
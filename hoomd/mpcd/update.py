@@ -8,12 +8,13 @@ Updates properties of MPCD particles.
 """
 
 import hoomd
+from hoomd.logging import log, Loggable
 from hoomd.md import _md
 
 from . import _mpcd
 
 
-class sort():
+class sort(metaclass=Loggable):
     r""" Sorts MPCD particles in memory to improve cache coherency.
 
     Args:
@@ -44,6 +45,10 @@ class sort():
         s.sorter.set_period(period=5)
         s.sorter.disable()
 
+    The sorter can also sort adaptively using :py:meth:`set_disorder_threshold`.
+    The measured disorder and whether the particles were sorted at the last check
+    can be logged with :py:class:`hoomd.logging.Logger`.
+
     """
 
     def __init__(self, system, period=50):
@@ -93,6 +98,68 @@ class sort():
         self._cpp.setPeriod(hoomd.context.current.system.getCurrentTimeStep(),
                             self.period)
 
+    def set_ordering(self, ordering):
+        """ Change the order that the cells are traversed in.
+
+        Args:
+            ordering (str): Cell ordering, one of ``'cell'``, ``'morton'``,
+                or ``'hilbert'``.
+
+        Examples::
+
+            sorter.set_ordering('hilbert')
+
+        By default, particles are sorted in the row-major order of the cell
+        list (``'cell'``). The cells can instead be traversed along a Morton
+        (``'morton'``) or Hilbert (``'hilbert'``) space-filling curve over
+        the cell grid. This keeps neighboring cells in all directions closer
+        together in memory, which can improve performance for strongly
+        anisotropic cell grids such as long, narrow channels.
+
+        """
+
+        self._cpp.ordering = ordering
+
+    def set_disorder_threshold(self, threshold):
+        """ Sort adaptively based on the disorder of the particles.
+
+        Args:
+            threshold (float): Fraction of particles in a different cell than
+                the preceding particle in memory needed to sort, between 0 and 1.
+
+        Examples::
+
+            sorter.set_disorder_threshold(0.5)
+            sorter.set_disorder_threshold(0)
+
+        Every *period* time steps, the fraction of MPCD particles that are in a
+        different cell than the preceding particle in memory is measured. The
+        particles are only sorted if this fraction is at least *threshold*.
+        Right after sorting, the fraction is about one over the average number
+        of particles per cell, and it approaches one as the order decays. A
+        *threshold* of zero (the default) sorts every *period* time steps
+        without measuring the disorder.
+
+        """
+
+        self._cpp.disorder_threshold = threshold
+
+    @log(default=False)
+    def disorder(self):
+        """float: Disorder of the particles measured at the last check.
+
+        The disorder is the fraction of particles in a different cell than the
+        preceding particle in memory. It is only measured when sorting
+        adaptively.
+
+        """
+        return self._cpp.disorder
+
+    @log(default=False)
+    def sorted(self):
+        """bool: True if the particles were sorted at the last check."""
+        return self._cpp.sorted
+
     def tune(self, start, stop, step, tsteps, quiet=False):
         """ Tune the sorting period.
 
@@ -16,6 +16,7 @@ See Also:
 
     simulation = hoomd.util.make_example_simulation()
     operation = simulation.operations.tuners[0]
+    logger = hoomd.logging.Logger()
 """
 
 # Operation is a parent class of almost all other HOOMD objects.
@@ -25,7 +26,7 @@ import itertools
 import weakref
 
 import hoomd
-from hoomd.logging import Loggable
+from hoomd.logging import Loggable, log
 from hoomd.data.parameterdicts import ParameterDict
 
 
@@ -227,6 +228,9 @@ class _HOOMDBaseObject(_HOOMDGetSetAttrBase,
     # _use_count must be included or attaching and detaching won't work as
     # expected as _use_count may not equal 0.
     _remove_for_pickling = ('_simulation_', '_cpp_obj', "_use_count")
+    # Attributes that hoomd.write.Checkpoint saves and restores in addition to
+    # the snapshot.
+    _checkpoint_parameters = ()
 
     def _detach(self, force=False):
         """Decrement attach count and destroy C++ object if count == 0.
@@ -466,6 +470,25 @@ class AutotunedObject(_HOOMDBaseObject):
             raise hoomd.error.DataAccessError("kernel_parameters")
         return self._cpp_obj.setAutotunerParameters(parameters)
 
+    @property
+    def kernel_times(self):
+        """dict[str, float]: Kernel execution times :math:`[\\mathrm{ms}]`.
+
+        The dictionary maps GPU kernel names to the median execution time that
+        the last tuning scan measured for the chosen kernel parameters. The
+        time is 0 for kernels that have not completed a scan, including those
+        with parameters set by the user.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            kernel_times = operation.kernel_times
+        """
+        if not self._attached:
+            raise hoomd.error.DataAccessError("kernel_times")
+        return self._cpp_obj.getAutotunerTimes()
+
     @property
     def is_tuning_complete(self):
         """bool: Check if kernel parameter tuning is complete.
@@ -526,6 +549,86 @@ class Operation(AutotunedObject):
         ARCHITECTURE.md
     """
 
+    def _timer(self, name):
+        if not self._attached:
+            raise hoomd.error.DataAccessError(name)
+        return self._cpp_obj.getTimer()
+
+    @log(default=False, requires_run=True)
+    def call_count(self):
+        """int: Number of calls timed.
+
+        Counts the calls since the operation was attached. The run loop times
+        each call to a tuner, updater, integrator, and writer. Force computes
+        time each evaluation of the forces and neighbor lists time each
+        rebuild. Other computes report 0.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(operation, quantities=['call_count'])
+        """
+        return self._timer('call_count').getNumCalls()
+
+    @log(default=False, requires_run=True)
+    def call_time_mean(self):
+        """float: Mean wall clock time per call :math:`[\\mathrm{s}]`.
+
+        The mean over the most recent 1000 calls (see `call_count`).
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(operation, quantities=['call_time_mean'])
+        """
+        return self._timer('call_time_mean').getMean()
+
+    @log(default=False, requires_run=True)
+    def call_time_p50(self):
+        """float: Median wall clock time per call :math:`[\\mathrm{s}]`.
+
+        The median of the most recent 1000 calls (see `call_count`).
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(operation, quantities=['call_time_p50'])
+        """
+        return self._timer('call_time_p50').getPercentile(50)
+
+    @log(default=False, requires_run=True)
+    def call_time_p99(self):
+        """float: 99th percentile wall time per call :math:`[\\mathrm{s}]`.
+
+        The 99th percentile of the most recent 1000 calls (see `call_count`).
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(operation, quantities=['call_time_p99'])
+        """
+        return self._timer('call_time_p99').getPercentile(99)
+
+    @log(default=False, requires_run=True)
+    def call_gpu_time_mean(self):
+        """float: Mean GPU time per call :math:`[\\mathrm{s}]`.
+
+        The mean over the most recent 1000 calls timed on the GPU. Set
+        `hoomd.device.GPU.operation_gpu_timing` to time calls on the GPU.
+        Reports 0 when no calls have been timed on the GPU.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(operation, quantities=['call_gpu_time_mean'])
+        """
+        return self._timer('call_gpu_time_mean').getGPUMean()
+
 
 class TriggeredOperation(Operation):
     """Operations that include a trigger to determine when to run.
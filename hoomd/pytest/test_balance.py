@@ -37,6 +37,17 @@ def test_balance_properties():
     balance.max_iterations = 5
     assert balance.max_iterations == 5
 
+    assert balance.objective == 'particles'
+    balance.objective = 'time'
+    assert balance.objective == 'time'
+
+    assert balance.damping == 0.5
+    balance.damping = 0.75
+    assert balance.damping == 0.75
+
+    with pytest.raises(ValueError):
+        balance.objective = 'energy'
+
 
 def test_attach_detach(simulation_factory, lattice_snapshot_factory):
     snapshot = lattice_snapshot_factory()
@@ -114,3 +125,24 @@ def test_balance_action(device, simulation_factory, lattice_snapshot_factory):
 
     # the load balance should move the split place down toward the particles
     assert sim.state.domain_decomposition_split_fractions[2][0] < 0.5
+
+
+def test_balance_time(simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory(lattice_snapshot_factory())
+    balance = hoomd.tune.LoadBalancer(trigger=hoomd.trigger.Periodic(5),
+                                      objective='time',
+                                      damping=0.25,
+                                      tolerance=1.1)
+    sim.operations.tuners.append(balance)
+    sim.run(20)
+
+    assert balance.objective == 'time'
+    assert balance.damping == 0.25
+    assert balance.imbalance >= 0.999999
+    assert balance.average_imbalance >= 0.999999
+    assert balance.peak_imbalance >= balance.imbalance
+    assert balance.rebalances >= 0
+
+    balance.objective = 'particles'
+    sim.run(5)
+    assert balance.objective == 'particles'
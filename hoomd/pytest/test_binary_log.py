@@ -0,0 +1,73 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+import numpy as np
+import pytest
+
+pytestmark = pytest.mark.skipif(not hoomd.version.md_built,
+                                reason="BUILD_MD=on required")
+
+
+def _make_simulation(simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory(lattice_snapshot_factory(n=4, a=1.5))
+    sim.state.thermalize_particle_momenta(filter=hoomd.filter.All(), kT=1.0)
+
+    lj = hoomd.md.pair.LJ(nlist=hoomd.md.nlist.Cell(buffer=0.4),
+                          default_r_cut=2.5)
+    lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+    integrator = hoomd.md.Integrator(
+        dt=0.005,
+        forces=[lj],
+        methods=[hoomd.md.methods.ConstantVolume(hoomd.filter.All())])
+    sim.operations.integrator = integrator
+
+    thermo = hoomd.md.compute.ThermodynamicQuantities(hoomd.filter.All())
+    sim.operations.computes.append(thermo)
+    return sim, lj, thermo
+
+
+def test_write(simulation_factory, lattice_snapshot_factory, tmp_path):
+    sim, lj, thermo = _make_simulation(simulation_factory,
+                                       lattice_snapshot_factory)
+    logger = hoomd.logging.Logger(categories=['scalar'])
+    logger.add(thermo,
+               quantities=['kinetic_temperature', 'pressure', 'num_particles'])
+    logger.add(lj, quantities=['energy'])
+
+    filename = tmp_path / "log.bin"
+    binary_log = hoomd.write.BinaryLog(trigger=hoomd.trigger.Periodic(1),
+                                       filename=filename,
+                                       logger=logger,
+                                       buffer_size=4)
+    sim.operations.writers.append(binary_log)
+    sim.run(10)
+    binary_log.flush()
+
+    kinetic_temperature = thermo.kinetic_temperature
+    pressure = thermo.pressure
+    energy = lj.energy
+    if sim.device.communicator.rank == 0:
+        data = hoomd.write.BinaryLog.read(filename)
+        np.testing.assert_array_equal(data['timestep'], np.arange(1, 11))
+        namespace = 'md/compute/ThermodynamicQuantities/'
+        assert len(data[namespace + 'kinetic_temperature']) == 10
+        np.testing.assert_allclose(
+            data[namespace + 'kinetic_temperature'][-1], kinetic_temperature)
+        np.testing.assert_allclose(data[namespace + 'pressure'][-1], pressure)
+        np.testing.assert_array_equal(data[namespace + 'num_particles'], 64)
+        np.testing.assert_allclose(data['md/pair/LJ/energy'][-1], energy)
+
+
+def test_invalid_quantity(simulation_factory, lattice_snapshot_factory,
+                          tmp_path):
+    sim, lj, thermo = _make_simulation(simulation_factory,
+                                       lattice_snapshot_factory)
+    logger = hoomd.logging.Logger()
+    logger.add(thermo, quantities=['pressure_tensor'])
+    binary_log = hoomd.write.BinaryLog(trigger=hoomd.trigger.Periodic(1),
+                                       filename=tmp_path / "log.bin",
+                                       logger=logger)
+    sim.operations.writers.append(binary_log)
+    with pytest.raises(ValueError):
+        sim.run(0)
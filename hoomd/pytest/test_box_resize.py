@@ -316,3 +316,55 @@ def test_invalid_api(variant, trigger):
         box_resize.box2 = box2
     with pytest.raises(RuntimeError):
         box_resize.variant = variant
+
+
+@pytest.mark.skipif(not hoomd.version.mpcd_built, reason="MPCD is not built.")
+def test_mpcd_scale(simulation_factory, lattice_snapshot_factory):
+    snap = lattice_snapshot_factory(n=2, a=2.0)
+    position = np.array([[-1.5, -1.5, -1.5], [0.5, -1.0, 1.5], [1.0, 1.0, 1.0]])
+    if snap.communicator.rank == 0:
+        snap.mpcd.N = 3
+        snap.mpcd.types = ['A']
+        snap.mpcd.position[:] = position
+    sim = simulation_factory(snap)
+
+    hoomd.update.BoxResize.update(sim.state,
+                                  hoomd.Box(Lx=8, Ly=4, Lz=2),
+                                  filter=hoomd.filter.Null())
+
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        npt.assert_allclose(snap.mpcd.position, position * [2, 1, 0.5])
+
+
+@pytest.mark.gpu
+@pytest.mark.skipif(not hoomd.version.mpcd_built, reason="MPCD is not built.")
+def test_mpcd_scale_cpu_gpu(device, lattice_snapshot_factory):
+    """Compare the MPCD particles scaled on the GPU to the CPU."""
+    box1 = hoomd.Box(Lx=6, Ly=8, Lz=10, xy=0.2, xz=-0.1, yz=0.3)
+    box2 = hoomd.Box(Lx=9, Ly=5, Lz=12, xy=-0.4, xz=0.2, yz=0.1)
+
+    snap = lattice_snapshot_factory(n=2, a=2.0)
+    if snap.communicator.rank == 0:
+        snap.configuration.box = box1
+        rng = np.random.default_rng(7)
+        fractions = rng.uniform(0.0, 1.0, size=(1000, 3))
+        snap.mpcd.N = len(fractions)
+        snap.mpcd.types = ['A']
+        snap.mpcd.position[:] = (fractions - 0.5) @ box1.to_matrix().T
+        snap.particles.position[:] = (
+            (snap.particles.position / 4.0) @ box1.to_matrix().T)
+
+    positions = []
+    for dev in (hoomd.device.CPU(), device):
+        sim = hoomd.Simulation(dev)
+        sim.create_state_from_snapshot(snap)
+        hoomd.update.BoxResize.update(sim.state,
+                                      box2,
+                                      filter=hoomd.filter.Null())
+        positions.append(sim.state.get_snapshot().mpcd.position)
+
+    if snap.communicator.rank == 0:
+        npt.assert_allclose(positions[1], positions[0], rtol=1e-5, atol=1e-5)
+        fractions = np.linalg.solve(box2.to_matrix(), positions[1].T).T + 0.5
+        assert np.all(fractions >= -1e-6) and np.all(fractions < 1 + 1e-6)
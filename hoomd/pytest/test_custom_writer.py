@@ -95,3 +95,36 @@ class TestCustomWriter:
         sim.operations += writer
         sim.run(10)
         assert writer.timesteps_run == [2, 4, 6, 8, 10]
+
+
+class CountPositive(hoomd.custom.DeviceAction):
+    fields = ('position', 'tag')
+
+    def __init__(self):
+        self.counts = []
+
+    def launch(self, timestep, arrays, stream):
+        import cupy
+        position = cupy.from_dlpack(arrays['position'])
+        tag = cupy.from_dlpack(arrays['tag'])
+        assert position.shape == (tag.shape[0], 3)
+        with cupy.cuda.ExternalStream(stream):
+            self.counts.append(cupy.count_nonzero(position[:, 0] > 0))
+
+
+def test_device_action(simulation_factory, two_particle_snapshot_factory):
+    sim = simulation_factory(two_particle_snapshot_factory(d=2.0))
+    action = CountPositive()
+    writer = hoomd.write.CustomWriter(1, action)
+    sim.operations += writer
+
+    if not isinstance(sim.device, hoomd.device.GPU):
+        with pytest.raises(RuntimeError):
+            sim.run(0)
+        return
+
+    pytest.importorskip("cupy")
+    sim.run(3)
+    assert len(action.counts) == 3
+    if sim.device.communicator.num_ranks == 1:
+        assert [int(count) for count in action.counts] == [1, 1, 1]
@@ -67,3 +67,63 @@ def test_mutability_error(simulation_factory, two_particle_snapshot_factory,
 
     with pytest.raises(MutabilityError):
         dcd_dump.overwrite = True
+
+
+def read_dcd_positions(filename, N):
+    """Read the positions in every frame of a DCD file."""
+    with open(filename, 'rb') as dcdfile:
+        data = dcdfile.read()
+
+    # skip the header, title, and atom count records
+    offset = 92 + 172 + 12
+    frame_size = 56 + 3 * (8 + 4 * N)
+    frames = []
+    while offset + frame_size <= len(data):
+        frame = np.empty((N, 3), dtype=np.float32)
+        block = offset + 56
+        for component in range(3):
+            frame[:, component] = np.frombuffer(data,
+                                                dtype=np.float32,
+                                                count=N,
+                                                offset=block + 4)
+            block += 8 + 4 * N
+        frames.append(frame)
+        offset += frame_size
+    return frames
+
+
+def test_write_tag_order(simulation_factory, lattice_snapshot_factory,
+                         tmp_path):
+    filename = tmp_path / "temporary_test_file.dcd"
+    snap = lattice_snapshot_factory(n=4, a=2.0)
+    tags = [1, 6, 12, 30, 45, 63]
+    if snap.communicator.rank == 0:
+        snap.particles.image[tags[0]] = [1, 0, -1]
+    sim = simulation_factory(snap)
+
+    dcd_dump = hoomd.write.DCD(filename=filename,
+                               trigger=hoomd.trigger.Periodic(1),
+                               filter=hoomd.filter.Tags(tags),
+                               unwrap_full=True)
+    sim.operations.writers.append(dcd_dump)
+
+    expected = []
+    for step in range(3):
+        snap = sim.state.get_snapshot()
+        # move particles across domains to change the gather plan
+        if step == 1:
+            if snap.communicator.rank == 0:
+                position = snap.particles.position[tags]
+                snap.particles.position[tags] = position[::-1]
+            sim.state.set_snapshot(snap)
+        if snap.communicator.rank == 0:
+            L = snap.configuration.box[:3]
+            expected.append(snap.particles.position[tags]
+                            + snap.particles.image[tags] * L)
+        sim.run(1)
+
+    if sim.device.communicator.rank == 0:
+        frames = read_dcd_positions(filename, len(tags))
+        assert len(frames) == 3
+        for frame, positions in zip(frames, expected):
+            np.testing.assert_allclose(frame, positions, rtol=1e-6)
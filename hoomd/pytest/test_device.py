@@ -2,6 +2,7 @@
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 import hoomd
+import json
 import pytest
 
 
@@ -14,6 +15,39 @@ def test_gpu_profile(device):
         pass
 
 
+class _NoOp(hoomd.custom.Action):
+
+    def act(self, timestep):
+        pass
+
+
+def test_tracing(device, simulation_factory, lattice_snapshot_factory,
+                 tmp_path):
+    sim = simulation_factory(lattice_snapshot_factory())
+    sim.operations.writers.append(hoomd.write.CustomWriter(1, _NoOp()))
+    sim.run(0)
+
+    filename = str(tmp_path / 'trace.{rank}.json')
+    with device.enable_tracing(filename, capacity=1000):
+        sim.run(5)
+
+    filename = filename.format(rank=device.communicator.rank)
+    with open(filename) as f:
+        trace = json.load(f)
+
+    spans = [e for e in trace['traceEvents'] if e['ph'] == 'X']
+    assert all(e['pid'] == device.communicator.rank for e in spans)
+    assert all(e['dur'] >= 0 for e in spans)
+    assert len([e for e in spans if e['name'] == 'step']) == 5
+    assert len([e for e in spans if e['cat'] == 'analyzer']) == 5
+    assert not device._cpp_exec_conf.getTracer().isEnabled()
+
+    if device.communicator.num_ranks > 1:
+        with pytest.raises(ValueError):
+            with device.enable_tracing(str(tmp_path / 'trace.json')):
+                pass
+
+
 def _assert_common_properties(dev,
                               notice_level,
                               message_filename,
@@ -71,6 +105,39 @@ def test_gpu_specific_properties(device):
     assert c[1] >= 0
 
 
+@pytest.mark.gpu
+def test_memory_pool(device, lattice_snapshot_factory):
+    gpu = hoomd.device.GPU(communicator=device.communicator)
+    assert not gpu.memory_pool
+
+    gpu.memory_pool_release_threshold = 1024
+    assert gpu.memory_pool_release_threshold == 1024
+    with pytest.raises(ValueError):
+        gpu.memory_pool_release_threshold = -1
+
+    stats = gpu.memory_pool_stats
+    assert set(stats.keys()) == {
+        'reserved', 'used', 'peak_reserved', 'peak_used', 'fragmentation'
+    }
+
+    if not gpu._cpp_exec_conf.getMemoryPool().isSupported():
+        with pytest.raises(RuntimeError):
+            gpu.memory_pool = True
+        return
+
+    gpu.memory_pool = True
+    assert gpu.memory_pool
+
+    sim = hoomd.Simulation(device=gpu, seed=1)
+    sim.create_state_from_snapshot(lattice_snapshot_factory())
+    sim.run(10)
+
+    stats = gpu.memory_pool_stats
+    assert stats['used'] > 0
+    assert stats['peak_reserved'] >= stats['reserved'] >= stats['used']
+    assert 0 <= stats['fragmentation'] < 1
+
+
 @pytest.mark.gpu
 def test_other_gpu_specifics(device):
     # make sure GPU is available and auto-select gives a GPU
@@ -162,3 +229,106 @@ def test_noticefile(device, tmp_path):
     if device.communicator.rank == 0:
         with open(device.message_filename) as fh:
             assert fh.read() == ""
+
+
+@pytest.mark.gpu
+@pytest.mark.serial
+def test_autotuner_cache(device, lattice_snapshot_factory, tmp_path):
+    gpu = hoomd.device.GPU(communicator=device.communicator)
+    assert gpu.autotuner_cache is None
+    filename = str(tmp_path / 'autotuner_cache.json')
+    gpu.autotuner_cache = filename
+    assert gpu.autotuner_cache == filename
+
+    def make_simulation():
+        sim = hoomd.Simulation(device=gpu, seed=1)
+        sim.create_state_from_snapshot(lattice_snapshot_factory())
+        method = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())
+        sim.operations.integrator = hoomd.md.Integrator(dt=0.001,
+                                                        methods=[method])
+        return sim, method
+
+    sim, method = make_simulation()
+    while not sim.operations.is_tuning_complete:
+        sim.run(100)
+    parameters = method.kernel_parameters
+
+    with open(filename) as f:
+        data = json.load(f)
+    assert data['schema'] == 'hoomd-autotuner-cache'
+    assert len(data['entries']) > 0
+
+    # a new simulation starts with the cached parameters
+    sim, method = make_simulation()
+    sim.run(0)
+    assert method.is_tuning_complete
+    assert method.kernel_parameters == parameters
+
+
+@pytest.mark.gpu
+def test_autotuner_drift_threshold(device, lattice_snapshot_factory):
+    gpu = hoomd.device.GPU(communicator=device.communicator)
+    assert gpu.autotuner_drift_threshold == 0
+    gpu.autotuner_drift_threshold = 0.2
+    assert gpu.autotuner_drift_threshold == pytest.approx(0.2)
+    with pytest.raises(ValueError):
+        gpu.autotuner_drift_threshold = -1
+
+    sim = hoomd.Simulation(device=gpu, seed=1)
+    sim.create_state_from_snapshot(lattice_snapshot_factory())
+    method = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.001, methods=[method])
+    while not sim.operations.is_tuning_complete:
+        sim.run(100)
+
+    # idle autotuners time some launches and may scan again
+    sim.run(1000)
+    assert len(method.kernel_parameters) > 0
+
+
+@pytest.mark.gpu
+def test_kernel_times(device, lattice_snapshot_factory):
+    sim = hoomd.Simulation(device=device, seed=1)
+    sim.create_state_from_snapshot(lattice_snapshot_factory())
+    method = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.001, methods=[method])
+    while not sim.operations.is_tuning_complete:
+        sim.run(100)
+
+    kernel_times = method.kernel_times
+    assert kernel_times.keys() == method.kernel_parameters.keys()
+    assert all(time > 0 for time in kernel_times.values())
+
+
+def test_memory_usage(device, simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory(lattice_snapshot_factory(n=10))
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+    lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.005, forces=[lj])
+    sim.run(1)
+
+    usage = device.memory_usage
+    for owner in ['ParticleData::m_pos', 'NeighborList::m_nlist']:
+        assert usage[owner]['host'] + usage[owner]['device'] > 0
+
+    for value in usage.values():
+        assert value['peak_host'] >= value['host']
+        assert value['peak_device'] >= value['device']
+
+    total = device.memory_total
+    assert total['host'] == sum(value['host'] for value in usage.values())
+    assert total['device'] == sum(value['device'] for value in usage.values())
+
+    report = device.memory_report(limit=3).split('\n')
+    assert len(report) == 6
+    assert report[-1].startswith('total')
+
+    device.reset_memory_peaks()
+    for value in device.memory_usage.values():
+        assert value['peak_host'] == value['host']
+        assert value['peak_device'] == value['device']
+
+    assert sim.host_memory == device.memory_total['host']
+    assert sim.device_memory == device.memory_total['device']
+    assert 'ParticleData::m_pos' in sim.memory_usage
@@ -0,0 +1,61 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import pytest
+
+import hoomd
+
+
+def make_replica(device, lattice_snapshot_factory):
+    replica_device = type(device)(communicator=device.communicator)
+    simulation = hoomd.Simulation(device=replica_device, seed=1)
+    simulation.create_state_from_snapshot(lattice_snapshot_factory(n=4))
+    method = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())
+    simulation.operations.integrator = hoomd.md.Integrator(dt=0.005,
+                                                           methods=[method])
+    return simulation
+
+
+@pytest.mark.serial
+def test_run(device, lattice_snapshot_factory):
+    replicas = [
+        make_replica(device, lattice_snapshot_factory) for i in range(4)
+    ]
+    ensemble = hoomd.Ensemble(replicas)
+    assert ensemble.simulations == tuple(replicas)
+
+    ensemble.run(10)
+    assert ensemble.timesteps == [10] * 4
+
+    ensemble.run(5, max_workers=2)
+    assert ensemble.timesteps == [15] * 4
+
+
+@pytest.mark.serial
+def test_invalid(device, lattice_snapshot_factory):
+    with pytest.raises(ValueError):
+        hoomd.Ensemble([])
+
+    with pytest.raises(TypeError):
+        hoomd.Ensemble([1])
+
+    simulation = make_replica(device, lattice_snapshot_factory)
+    shared = hoomd.Simulation(device=simulation.device, seed=2)
+    with pytest.raises(ValueError):
+        hoomd.Ensemble([simulation, shared])
+
+
+@pytest.mark.serial
+def test_exception(device, lattice_snapshot_factory):
+    replicas = [
+        make_replica(device, lattice_snapshot_factory) for i in range(2)
+    ]
+    # a replica without a state raises when it runs
+    replicas.append(hoomd.Simulation(device=type(device)(), seed=1))
+    ensemble = hoomd.Ensemble(replicas)
+
+    with pytest.raises(RuntimeError):
+        ensemble.run(10)
+
+    # the other replicas complete their steps
+    assert ensemble.timesteps[:2] == [10, 10]
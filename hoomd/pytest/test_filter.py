@@ -2,8 +2,9 @@
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 import pytest
+from hoomd import _hoomd
 from hoomd.filter import (Type, Tags, SetDifference, Union, Intersection, All,
-                          Null, Rigid)
+                          Null, Rigid, CustomFilter)
 from hoomd.snapshot import Snapshot
 from copy import deepcopy
 from itertools import combinations
@@ -210,6 +211,88 @@ def test_difference(make_filter_snapshot, simulation_factory, set_indices):
         assert difference_filter(sim.state) == combo_filter(sim.state)
 
 
+class _EvenTags(CustomFilter):
+    """Select the particles with even tags."""
+
+    def __call__(self, state):
+        with state.cpu_local_snapshot as snap:
+            tags = snap.particles.tag
+            return np.copy(tags[tags % 2 == 0])
+
+    def __hash__(self):
+        return hash(self.__class__.__name__)
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__)
+
+
+_membership_filters = [
+    All(),
+    Type(['A', 'C']),
+    Tags([0, 3, 4, 8, 10, 11]),
+    Rigid(('center', 'free')),
+    Rigid(('constituent',)),
+    Union(Type(['B']), Tags([1, 2, 8])),
+    Intersection(Type(['A', 'B']), Tags([0, 1, 3, 8, 10])),
+    SetDifference(All(), Type(['B'])),
+    _EvenTags(),
+]
+
+# each step is a list of (operation, argument) pairs applied before the group
+# is checked, recycled tags are reused by the following additions
+_membership_steps = [
+    [('remove', 3)],
+    [('add', 1)],
+    [('add', 0)],
+    [('remove', 1)],
+    [('remove', 10), ('add', 2)],
+    [('remove', 8), ('add', 0), ('add', 1), ('remove', 4)],
+    [('add', 2), ('remove', 0), ('add', 0)],
+]
+
+
+def _make_group(sim, filter_):
+    if isinstance(filter_, CustomFilter):
+        filter_ = _hoomd.ParticleFilterCustom(filter_, sim.state)
+    return _hoomd.ParticleGroup(sim.state._cpp_sys_def, filter_, True)
+
+
+@pytest.mark.parametrize('filter_',
+                         _membership_filters,
+                         ids=lambda f: f.__class__.__name__)
+def test_add_remove_membership(make_filter_snapshot, simulation_factory,
+                               filter_):
+    """Test that groups follow single particle additions and removals.
+
+    Run on more than one rank, this also covers the domain decomposed case,
+    since the membership is combined over the ranks.
+    """
+    particle_types = ['A', 'B', 'C']
+    N = 10
+    snap = make_filter_snapshot(n=N, particle_types=particle_types)
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[:] = [0, 1, 2, 0, 1, 2, 0, 1, 2, 0]
+        snap.particles.body[:] = [0, 0, 0, -1, -1, 5, 5, -1, -1, -1]
+    sim = simulation_factory(snap)
+    particle_data = sim.state._cpp_sys_def.getParticleData()
+
+    group = _make_group(sim, filter_)
+    assert group.getNumMembersGlobal() == _make_group(
+        sim, filter_).getNumMembersGlobal()
+
+    for step in _membership_steps:
+        for operation, argument in step:
+            if operation == 'add':
+                particle_data.addParticle(argument)
+            else:
+                particle_data.removeParticle(argument)
+
+        # compare the incrementally updated group to a full rebuild
+        rebuilt = _make_group(sim, filter_)
+        assert group.getNumMembersGlobal() == rebuilt.getNumMembersGlobal()
+        np.testing.assert_array_equal(group.member_tags, rebuilt.member_tags)
+
+
 _filter_classes = [
     All,
     Tags,
@@ -529,3 +529,42 @@ class TestLocalSnapshots:
         else:
             yield 'cpu_local_snapshot'
             yield 'gpu_local_snapshot'
+
+
+@pytest.mark.skipif(not hoomd.version.mpcd_built, reason="MPCD is not built.")
+def test_mpcd_particle_local_access(simulation_factory,
+                                    lattice_snapshot_factory):
+    from hoomd.mpcd.local_access import ParticleLocalAccess
+
+    position = np.array([[-1, -1, -1], [1, -1, -1], [-1, 1, 1], [1, 1, 1]])
+    velocity = np.arange(12).reshape(4, 3)
+    snap = lattice_snapshot_factory(n=2, a=2.0)
+    if snap.communicator.rank == 0:
+        snap.mpcd.N = 4
+        snap.mpcd.types = ['A', 'B']
+        snap.mpcd.position[:] = position
+        snap.mpcd.velocity[:] = velocity
+        snap.mpcd.typeid[:] = [0, 1, 0, 1]
+    sim = simulation_factory(snap)
+
+    access = ParticleLocalAccess(sim.state)
+    with access as data:
+        with pytest.raises(RuntimeError):
+            sim.run(0)
+
+        tags = np.array(data.tag)
+        np.testing.assert_allclose(data.position, position[tags])
+        np.testing.assert_allclose(data.velocity, velocity[tags])
+        np.testing.assert_equal(data.typeid, tags % 2)
+        assert data.cell.shape == (len(tags),)
+
+        with pytest.raises(RuntimeError):
+            data.tag = 0
+        data.velocity[:, 0] = -tags
+
+    with pytest.raises(hoomd.data.array.HOOMDArrayError):
+        data.velocity.sum()
+
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        np.testing.assert_allclose(snap.mpcd.velocity[:, 0], -np.arange(4))
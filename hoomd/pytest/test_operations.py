@@ -2,6 +2,7 @@
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 import hoomd
+import pytest
 
 
 class FakeIntegrator(hoomd.operation.Integrator):
@@ -39,3 +40,25 @@ def test_iter():
     operations.integrator = FakeIntegrator()
     expected_list.insert(2, operations.integrator)
     assert list(operations) == expected_list
+
+
+def test_timing(simulation_factory, two_particle_snapshot_factory):
+    updater = hoomd.update.FilterUpdater(2, [hoomd.filter.All()])
+    with pytest.raises(hoomd.error.DataAccessError):
+        updater.call_count
+
+    sim = simulation_factory(two_particle_snapshot_factory())
+    sim.operations.updaters.append(updater)
+    sim.run(10)
+    assert updater.call_count == 5
+    assert updater.call_time_mean >= 0
+    assert 0 <= updater.call_time_p50 <= updater.call_time_p99
+    assert updater.call_gpu_time_mean >= 0
+
+    logger = hoomd.logging.Logger(categories=['scalar'])
+    logger.add(updater, quantities=['call_count', 'call_time_p99'])
+    log = logger.log()
+    for key in updater._export_dict['call_count'].namespace:
+        log = log[key]
+    assert log['call_count'][0] == 5
+    assert log['call_time_p99'][0] == updater.call_time_p99
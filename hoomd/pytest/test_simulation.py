@@ -116,6 +116,77 @@ def test_allows_compute_pressure(simulation_factory, lattice_snapshot_factory):
     assert sim.always_compute_pressure is True
 
 
+def test_allows_compute_energy(simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory()
+    assert sim.always_compute_energy
+    with pytest.raises(RuntimeError):
+        sim.always_compute_energy = False
+    sim.create_state_from_snapshot(lattice_snapshot_factory())
+    assert sim.always_compute_energy is True
+    sim.always_compute_energy = False
+    assert sim.always_compute_energy is False
+    sim.always_compute_energy = True
+    assert sim.always_compute_energy is True
+
+
+def test_persistent_ghost_updates(simulation_factory,
+                                  lattice_snapshot_factory):
+    sim = simulation_factory()
+    assert sim.persistent_ghost_updates is False
+    sim.persistent_ghost_updates = True
+    sim.create_state_from_snapshot(lattice_snapshot_factory())
+    assert sim.persistent_ghost_updates is True
+    if sim._system_communicator is not None:
+        assert sim._system_communicator.persistent_ghost_updates
+    sim.run(2)
+    sim.persistent_ghost_updates = False
+    assert sim.persistent_ghost_updates is False
+    sim.run(2)
+
+
+def test_compress_ghost_updates(simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory()
+    assert sim.compress_ghost_updates is False
+    sim.compress_ghost_updates = True
+    sim.create_state_from_snapshot(lattice_snapshot_factory())
+    assert sim.compress_ghost_updates is True
+    if sim._system_communicator is not None:
+        assert sim._system_communicator.compress_ghost_updates
+    sim.run(2)
+    sim.compress_ghost_updates = False
+    assert sim.compress_ghost_updates is False
+
+
+def test_delta_ghost_updates(simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory()
+    assert sim.delta_ghost_updates is False
+    sim.delta_ghost_updates = True
+    sim.create_state_from_snapshot(lattice_snapshot_factory())
+    assert sim.delta_ghost_updates is True
+    if sim._system_communicator is not None:
+        assert sim._system_communicator.delta_ghost_updates
+    sim.run(2)
+    sim.delta_ghost_updates = False
+    assert sim.delta_ghost_updates is False
+
+
+def test_ghost_shell(simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory()
+    assert sim.ghost_shell == 0
+    sim.ghost_shell = 0.3
+    sim.create_state_from_snapshot(lattice_snapshot_factory())
+    assert sim.ghost_shell == 0.3
+    if sim._system_communicator is not None:
+        assert sim._system_communicator.ghost_shell == pytest.approx(0.3)
+    sim.run(2)
+    sim.ghost_shell = 0
+    assert sim.ghost_shell == 0
+    sim.run(2)
+
+    with pytest.raises(ValueError):
+        sim.ghost_shell = -1
+
+
 def test_run(simulation_factory, lattice_snapshot_factory):
     sim = simulation_factory()
     with pytest.raises(RuntimeError):
@@ -280,6 +351,50 @@ def test_state_from_gsd_box_dims(device, simulation_factory,
         assert sim.state.box.yz == 0.0
 
 
+@skip_gsd
+def test_state_from_gsd_fallback(device, simulation_factory, tmp_path):
+    """Read particles that do not split evenly over the ranks.
+
+    The masses are only in frame 0, the positions and orientations change in
+    frame 1.
+    """
+    filename = tmp_path / "temporary_test_file.gsd"
+    frames = []
+    for step in range(2):
+        frame = gsd.hoomd.Frame()
+        frame.configuration.box = [10, 10, 10, 0, 0, 0]
+        frame.configuration.step = step
+        frame.particles.N = 7
+        frame.particles.types = ['A', 'B']
+        frame.particles.typeid = [i % 2 for i in range(7)]
+        frame.particles.position = [[i - 3, 0.5 * step, -1] for i in range(7)]
+        frame.particles.orientation = [[1, 0, 0, 0]] * 6 + [[0, 1, 0, 0]]
+        if step == 0:
+            frame.particles.mass = [1 + i for i in range(7)]
+        frames.append(frame)
+
+    if device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='w') as f:
+            for frame in frames:
+                f.append(frame)
+
+    sim = simulation_factory()
+    sim.create_state_from_gsd(filename, frame=1)
+    assert sim.timestep == 1
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        assert snap.particles.N == 7
+        assert snap.particles.types == ['A', 'B']
+        np.testing.assert_allclose(snap.particles.position,
+                                   frames[1].particles.position)
+        np.testing.assert_allclose(snap.particles.orientation,
+                                   frames[1].particles.orientation)
+        np.testing.assert_array_equal(snap.particles.typeid,
+                                      frames[1].particles.typeid)
+        np.testing.assert_allclose(snap.particles.mass,
+                                   frames[0].particles.mass)
+
+
 @skip_gsd
 def test_state_from_gsd_frame(simulation_factory, lattice_snapshot_factory,
                               device, state_args, tmp_path):
@@ -501,10 +616,22 @@ def test_mutability_error(simulation_factory, two_particle_snapshot_factory,
 def test_logging():
     logging_check(
         hoomd.Simulation, (), {
+            'device_memory': {
+                'category': LoggerCategories.scalar,
+                'default': False
+            },
             'final_timestep': {
                 'category': LoggerCategories.scalar,
                 'default': True
             },
+            'host_memory': {
+                'category': LoggerCategories.scalar,
+                'default': False
+            },
+            'memory_usage': {
+                'category': LoggerCategories.object,
+                'default': False
+            },
             'seed': {
                 'category': LoggerCategories.scalar,
                 'default': True
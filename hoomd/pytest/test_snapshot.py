@@ -535,3 +535,73 @@ def test_invalid_bond_typeids(
         group.N = 0
 
     simulation_factory(snap)
+
+
+def test_replicate(s):
+    if s.communicator.rank == 0:
+        L = numpy.array([4.0, 5.0, 6.0])
+        s.configuration.box = [*L, 0, 0, 0]
+        s.particles.N = 3
+        s.particles.types = ['A', 'B']
+        s.particles.position[:] = [[-1.5, 0.5, 2.5], [1.0, -2.0, 0], [0, 0, -1]]
+        s.particles.image[:] = [[0, 0, 0], [1, 0, -1], [0, 0, 0]]
+        s.particles.velocity[:] = [[1, 2, 3], [4, 5, 6], [7, 8, 9]]
+        s.particles.typeid[:] = [0, 1, 0]
+        s.particles.mass[:] = [1, 2, 3]
+        s.particles.orientation[:] = [[1, 0, 0, 0], [0, 1, 0, 0], [0, 0, 1, 0]]
+        s.particles.body[:] = [0, 0, -1]
+
+        s.bonds.N = 2
+        s.bonds.types = ['a', 'b']
+        s.bonds.typeid[:] = [0, 1]
+        s.bonds.group[:] = [[0, 1], [1, 2]]
+        s.angles.N = 1
+        s.angles.types = ['a']
+        s.angles.group[:] = [[0, 1, 2]]
+
+        original_unwrapped = s.particles.position + s.particles.image * L
+        original = dict(velocity=s.particles.velocity.copy(),
+                        typeid=s.particles.typeid.copy(),
+                        mass=s.particles.mass.copy(),
+                        orientation=s.particles.orientation.copy())
+        bond_group = s.bonds.group.copy()
+        bond_typeid = s.bonds.typeid.copy()
+        angle_group = s.angles.group.copy()
+
+    nx, ny, nz = 2, 3, 1
+    s.replicate(nx, ny, nz)
+
+    if s.communicator.rank == 0:
+        new_L = L * [nx, ny, nz]
+        numpy.testing.assert_allclose(s.configuration.box, [*new_L, 0, 0, 0])
+        assert s.particles.N == 3 * nx * ny * nz
+        assert s.bonds.N == 2 * nx * ny * nz
+        assert s.angles.N == nx * ny * nz
+        assert s.particles.types == ['A', 'B']
+        assert s.bonds.types == ['a', 'b']
+
+        # the replicas are ordered with the z index varying fastest
+        for j, (l, m, n) in enumerate(numpy.ndindex(nx, ny, nz)):
+            p = slice(3 * j, 3 * (j + 1))
+            shift = (numpy.array([l, m, n]) + 0.5) * L - new_L / 2
+            numpy.testing.assert_allclose(
+                s.particles.position[p] + s.particles.image[p] * new_L,
+                original_unwrapped + shift,
+                atol=1e-12)
+            for name, value in original.items():
+                numpy.testing.assert_equal(getattr(s.particles, name)[p],
+                                           value)
+
+            # rigid bodies and bonded groups point to the particles of the
+            # same replica
+            numpy.testing.assert_equal(s.particles.body[p],
+                                       [3 * j, 3 * j, -1])
+            numpy.testing.assert_equal(s.bonds.group[2 * j:2 * (j + 1)],
+                                       bond_group + 3 * j)
+            numpy.testing.assert_equal(s.bonds.typeid[2 * j:2 * (j + 1)],
+                                       bond_typeid)
+            numpy.testing.assert_equal(s.angles.group[j:j + 1],
+                                       angle_group + 3 * j)
+
+        # every particle is in the new box
+        assert numpy.all(numpy.abs(s.particles.position) <= new_L / 2)
@@ -5,6 +5,7 @@
 
 from hoomd.conftest import operation_pickling_check
 import hoomd
+import numpy
 
 
 def test_attributes():
@@ -14,6 +15,10 @@ def test_attributes():
 
     assert sorter.trigger is trigger
     assert sorter.grid == 32
+    assert sorter.sort_groups
+
+    sorter.sort_groups = False
+    assert not sorter.sort_groups
 
 
 def test_attributes_attached(simulation_factory, two_particle_snapshot_factory):
@@ -27,6 +32,10 @@ def test_attributes_attached(simulation_factory, two_particle_snapshot_factory):
 
     assert sorter.trigger is trigger
     assert sorter.grid == 32
+    assert sorter.sort_groups
+
+    sorter.sort_groups = False
+    assert not sorter.sort_groups
 
 
 def test_default_sorter(simulation_factory, two_particle_snapshot_factory):
@@ -44,3 +53,27 @@ def test_pickling(simulation_factory, two_particle_snapshot_factory):
     # simulation
     sorter = sim.operations.tuners.pop()
     operation_pickling_check(sorter, sim)
+
+
+def test_sort_groups(simulation_factory, lattice_snapshot_factory):
+    """Test that sorting the bonded groups preserves them."""
+    snapshot = lattice_snapshot_factory(n=6, r=0.1)
+    if snapshot.communicator.rank == 0:
+        # bond particles in reverse order so that sorting reorders the bonds
+        N = snapshot.particles.N
+        snapshot.bonds.N = N - 1
+        tags = numpy.arange(N - 1, 0, -1)
+        snapshot.bonds.group[:] = numpy.stack([tags, tags - 1], axis=1)
+        snapshot.bonds.typeid[:] = numpy.arange(N - 1) % 2
+        snapshot.bonds.types = ['A', 'B']
+
+    sim = simulation_factory(snapshot)
+    sim.operations.tuners[0].trigger = hoomd.trigger.Periodic(1)
+    sim.run(1)
+
+    new_snapshot = sim.state.get_snapshot()
+    if new_snapshot.communicator.rank == 0:
+        numpy.testing.assert_array_equal(new_snapshot.bonds.group,
+                                         snapshot.bonds.group)
+        numpy.testing.assert_array_equal(new_snapshot.bonds.typeid,
+                                         snapshot.bonds.typeid)
@@ -248,6 +248,27 @@ def test_zero_particle_velocity_angmom():
                                       [0, 0, 0, 0])
 
 
+def test_create_from_large_snapshot(simulation_factory,
+                                    lattice_snapshot_factory):
+    """Distribute a snapshot that is sent to the ranks in several chunks."""
+    snapshot = lattice_snapshot_factory(n=42, r=0.1)
+    if snapshot.communicator.rank == 0:
+        N = snapshot.particles.N
+        snapshot.particles.velocity[:] = numpy.arange(3 * N).reshape(N, 3)
+        snapshot.particles.mass[:] = numpy.arange(N) + 1
+
+    sim = simulation_factory(snapshot)
+    new_snapshot = sim.state.get_snapshot()
+    if snapshot.communicator.rank == 0:
+        assert new_snapshot.particles.N == snapshot.particles.N
+        numpy.testing.assert_allclose(new_snapshot.particles.position,
+                                      snapshot.particles.position)
+        numpy.testing.assert_allclose(new_snapshot.particles.velocity,
+                                      snapshot.particles.velocity)
+        numpy.testing.assert_allclose(new_snapshot.particles.mass,
+                                      snapshot.particles.mass)
+
+
 def test_replicate(simulation_factory, lattice_snapshot_factory):
     initial_snapshot = lattice_snapshot_factory(a=10, n=1)
 
@@ -271,6 +292,40 @@ def test_replicate(simulation_factory, lattice_snapshot_factory):
     assert_snapshots_equal(initial_snapshot, new_snapshot)
 
 
+def test_replicate_bonds(simulation_factory, lattice_snapshot_factory):
+    initial_snapshot = lattice_snapshot_factory(particle_types=['A', 'B'],
+                                                a=2,
+                                                n=(2, 2, 1))
+    if initial_snapshot.communicator.rank == 0:
+        initial_snapshot.particles.typeid[:] = [0, 1, 0, 1]
+        initial_snapshot.bonds.N = 3
+        initial_snapshot.bonds.types = ['a', 'b']
+        initial_snapshot.bonds.typeid[:] = [0, 1, 0]
+        initial_snapshot.bonds.group[:] = [[0, 1], [1, 2], [2, 3]]
+        initial_snapshot.angles.N = 1
+        initial_snapshot.angles.types = ['a']
+        initial_snapshot.angles.group[:] = [[0, 1, 2]]
+
+    sim = simulation_factory(initial_snapshot)
+    sim.state.replicate(2, 3, 2)
+    assert sim.state.N_particles == 4 * 12
+    assert sim.state.N_bonds == 3 * 12
+    assert sim.state.N_angles == 12
+    numpy.testing.assert_allclose(sim.state.box.L, [8, 12, 4])
+
+    # the state replicates its topology in the same way as the snapshot
+    initial_snapshot.replicate(2, 3, 2)
+    new_snapshot = sim.state.get_snapshot()
+    assert_snapshots_equal(initial_snapshot, new_snapshot)
+    if new_snapshot.communicator.rank == 0:
+        bond_group = numpy.array([[0, 1], [1, 2], [2, 3]])
+        for j in range(12):
+            numpy.testing.assert_equal(
+                new_snapshot.bonds.group[3 * j:3 * (j + 1)], bond_group + 4 * j)
+            numpy.testing.assert_equal(new_snapshot.angles.group[j],
+                                       [4 * j, 4 * j + 1, 4 * j + 2])
+
+
 def test_domain_decomposition(device, simulation_factory,
                               lattice_snapshot_factory):
     snapshot = lattice_snapshot_factory()
@@ -308,3 +363,32 @@ def test_domain_decomposition(device, simulation_factory,
                                                                   [0.25])
     else:
         raise RuntimeError("Test only supports 1 and 2 ranks")
+
+
+def test_bisect_domains(device, lattice_snapshot_factory):
+    snapshot = lattice_snapshot_factory(n=8)
+    if snapshot.communicator.rank == 0:
+        # pack all the particles into the lower half of the box in z
+        z = snapshot.particles.position[:, 2]
+        snapshot.particles.position[:, 2] = (z + 4) / 2 - 4 + 0.03
+
+    sim = hoomd.Simulation(device)
+    with pytest.raises(ValueError):
+        sim.create_state_from_snapshot(snapshot,
+                                       domain_decomposition=(None, None,
+                                                             [0.25, 0.75]),
+                                       bisect_domains=True)
+
+    sim.create_state_from_snapshot(snapshot,
+                                   domain_decomposition=(1, 1, None),
+                                   bisect_domains=True)
+
+    if device.communicator.num_ranks == 1:
+        assert sim.state.domain_decomposition_split_fractions == ([], [], [])
+    elif device.communicator.num_ranks == 2:
+        fractions = sim.state.domain_decomposition_split_fractions
+        assert 0.2 < fractions[2][0] < 0.3
+        with sim.state.cpu_local_snapshot as data:
+            assert len(data.particles.position) == 256
+    else:
+        raise RuntimeError("Test only supports 1 and 2 ranks")
@@ -3,6 +3,7 @@
 
 """Test the Trigger classes."""
 import itertools
+import math
 from inspect import isclass
 import pickle
 
@@ -124,12 +125,111 @@ def test_eval(trigger, eval_func):
         assert trigger(i) == eval_func(i)
 
 
+@pytest.mark.parametrize('trigger', triggers(), ids=_test_name)
+def test_deterministic(trigger):
+    # only the custom trigger calls into Python
+    assert trigger.isDeterministic() == (not isinstance(trigger, CustomTrigger))
+
+
+def test_deterministic_composite():
+    custom = CustomTrigger()
+    assert not hoomd.trigger.Not(custom).isDeterministic()
+    assert not hoomd.trigger.And([hoomd.trigger.Periodic(10),
+                                  custom]).isDeterministic()
+    assert not hoomd.trigger.Or([custom,
+                                 hoomd.trigger.Before(10)]).isDeterministic()
+
+
 @pytest.mark.parametrize('trigger', triggers(), ids=_test_name)
 def test_pickling(trigger):
     pkled_trigger = pickle.loads(pickle.dumps(trigger))
     assert trigger == pkled_trigger
 
 
+@pytest.mark.parametrize('trigger, eval_func',
+                         zip(triggers(), _eval_funcs),
+                         ids=_test_name)
+def test_next_timestep(trigger, eval_func):
+    for i in range(1000):
+        next_timestep = trigger.next_timestep(i)
+        assert next_timestep >= i
+        assert not any(eval_func(j) for j in range(i, min(next_timestep, 1000)))
+
+
+class ScheduledTrigger(CustomTrigger):
+
+    def __init__(self):
+        super().__init__()
+        self.num_computes = 0
+
+    def compute(self, timestep):
+        self.num_computes += 1
+        return super().compute(timestep)
+
+    def next_timestep(self, timestep):
+        return math.ceil(timestep**(1 / 2))**2
+
+
+def test_custom_next_timestep():
+    trigger = ScheduledTrigger()
+    for i in range(10000):
+        assert trigger(i) == (i**(1 / 2)).is_integer()
+
+    # compute is only called on the scheduled timesteps
+    assert trigger.num_computes == 100
+
+
+class MultipleTrigger(hoomd.trigger.Trigger):
+
+    def __init__(self, period):
+        hoomd.trigger.Trigger.__init__(self)
+        self._period = period
+        self.num_computes = 0
+
+    @property
+    def period(self):
+        return self._period
+
+    @period.setter
+    def period(self, value):
+        self._period = value
+        self.invalidate_schedule()
+
+    def compute(self, timestep):
+        self.num_computes += 1
+        return timestep % self._period == 0
+
+    def next_timestep(self, timestep):
+        return -(-timestep // self._period) * self._period
+
+
+class EarlyTrigger(MultipleTrigger):
+
+    def next_timestep(self, timestep):
+        # earlier than timestep, which makes the trigger compute on every step
+        return 0
+
+
+def test_custom_next_timestep_state():
+    trigger = MultipleTrigger(10)
+    activations = [i for i in range(100) if trigger(i)]
+    assert activations == list(range(0, 100, 10))
+    assert trigger.num_computes == 10
+
+    # after step 100 the trigger skips the steps before 110, changing the
+    # period discards that window
+    assert trigger(100)
+    trigger.period = 7
+    activations = [i for i in range(101, 200) if trigger(i)]
+    assert activations == [i for i in range(101, 200) if i % 7 == 0]
+    assert trigger.num_computes == 12 + len(activations)
+
+    trigger = EarlyTrigger(10)
+    activations = [i for i in range(100) if trigger(i)]
+    assert activations == list(range(0, 100, 10))
+    assert trigger.num_computes == 100
+
+
 def test_custom():
     c = CustomTrigger()
 
@@ -45,8 +45,8 @@ class Simulation(metaclass=Loggable):
     added to this `Simulation`.
 
     Newly initialized `Simulation` objects have no state. Call
-    `create_state_from_gsd` or `create_state_from_snapshot` to initialize the
-    simulation's `state`.
+    `create_state_from_gsd`, `create_state_from_checkpoint`, or
+    `create_state_from_snapshot` to initialize the simulation's `state`.
 
     .. rubric:: Example:
 
@@ -62,6 +62,11 @@ class Simulation(metaclass=Loggable):
         self._operations._simulation = self
         self._timestep = None
         self._seed = None
+        self._pending_checkpoint_state = None
+        self._persistent_ghost_updates = False
+        self._compress_ghost_updates = False
+        self._delta_ghost_updates = False
+        self._ghost_shell = 0.0
         if seed is not None:
             self.seed = seed
 
@@ -171,6 +176,14 @@ class Simulation(metaclass=Loggable):
                     cpp_communicator = _hoomd.CommunicatorGPU(
                         self.state._cpp_sys_def, decomposition)
 
+                cpp_communicator.persistent_ghost_updates = \
+                    self._persistent_ghost_updates
+                cpp_communicator.compress_ghost_updates = \
+                    self._compress_ghost_updates
+                cpp_communicator.delta_ghost_updates = \
+                    self._delta_ghost_updates
+                cpp_communicator.ghost_shell = self._ghost_shell
+
                 # set Communicator in C++ System and SystemDefinition
                 self._cpp_sys.setCommunicator(cpp_communicator)
                 self.state._cpp_sys_def.setCommunicator(cpp_communicator)
@@ -188,7 +201,8 @@ class Simulation(metaclass=Loggable):
     def create_state_from_gsd(self,
                               filename,
                               frame=-1,
-                              domain_decomposition=(None, None, None)):
+                              domain_decomposition=(None, None, None),
+                              bisect_domains=False):
         """Create the simulation state from a GSD file.
 
         Args:
@@ -205,9 +219,18 @@ class Simulation(metaclass=Loggable):
                 to include in each domain. The sum of each list of floats must
                 be 1.0 (e.g. ``([0.25, 0.75], [0.2, 0.8], [1.0])``).
 
+            bisect_domains (bool): When `True`, place the domain boundaries
+                by recursive bisection of the particle positions so that
+                every slab of domains holds the same number of particles.
+                Use with a tuple of integers or `None` values.
+
         When `timestep` is `None` before calling, `create_state_from_gsd`
         sets `timestep` to the value in the selected GSD frame in the file.
 
+        In MPI simulations, every rank reads a part of the particles with
+        MPI-IO and sends the particles directly to the ranks that own them.
+        The root rank does not need to hold all the particles in memory.
+
         Note:
             Set any or all of the ``domain_decomposition`` tuple elements to
             `None` and `create_state_from_gsd` will select a value that
@@ -228,12 +251,82 @@ class Simulation(metaclass=Loggable):
         filename = _hoomd.mpi_bcast_str(filename, self.device._cpp_exec_conf)
         # Grab snapshot and timestep
         reader = _hoomd.GSDReader(self.device._cpp_exec_conf, filename,
-                                  abs(frame), frame < 0)
+                                  abs(frame), frame < 0,
+                                  self.device.communicator.num_ranks > 1)
+        snapshot = Snapshot._from_cpp_snapshot(reader.getSnapshot(),
+                                               self.device.communicator)
+
+        step = reader.getTimeStep() if self.timestep is None else self.timestep
+        self._state = State(self, snapshot, domain_decomposition,
+                            bisect_domains)
+
+        reader.clearSnapshot()
+
+        self._init_system(step)
+
+    def create_state_from_checkpoint(self,
+                                     filename,
+                                     domain_decomposition=(None, None, None),
+                                     bisect_domains=False):
+        """Create the simulation state from a checkpoint.
+
+        Args:
+            filename (str): Checkpoint file written by `hoomd.write.Checkpoint`.
+
+            domain_decomposition (tuple): Choose how to distribute the state
+                across MPI ranks with domain decomposition. Provide a tuple
+                of 3 integers indicating the number of evenly spaced domains in
+                the x, y, and z directions (e.g. ``(8,4,2)``). Provide a tuple
+                of 3 lists of floats to set the fraction of the simulation box
+                to include in each domain. The sum of each list of floats must
+                be 1.0 (e.g. ``([0.25, 0.75], [0.2, 0.8], [1.0])``).
+
+            bisect_domains (bool): When `True`, place the domain boundaries
+                by recursive bisection of the particle positions so that
+                every slab of domains holds the same number of particles.
+                Use with a tuple of integers or `None` values.
+
+        When `timestep` is `None` before calling,
+        `create_state_from_checkpoint` sets `timestep` to the value in the
+        checkpoint. When `seed` is `None` before calling, it sets `seed` to the
+        value in the checkpoint.
+
+        Add the same operations to the simulation that were present when the
+        checkpoint was written. The first call to `run` restores the state of
+        the operations saved in the checkpoint (see `hoomd.write.Checkpoint`).
+        Kernel parameters that do not apply to the current device issue a
+        warning and are tuned again.
+
+        .. rubric:: Example:
+
+        .. invisible-code-block: python
+
+            checkpoint_filename = path / 'checkpoint.gsd'
+            checkpoint_simulation = hoomd.util.make_example_simulation()
+            checkpoint_simulation.operations.writers.append(
+                hoomd.write.Checkpoint(trigger=1,
+                                       filename=checkpoint_filename))
+            checkpoint_simulation.run(1)
+            simulation = hoomd.Simulation(device=hoomd.device.CPU())
+
+        .. code-block:: python
+
+            simulation.create_state_from_checkpoint(
+                filename=checkpoint_filename)
+        """
+        if self._state is not None:
+            raise RuntimeError("Cannot initialize more than once\n")
+        filename = _hoomd.mpi_bcast_str(filename, self.device._cpp_exec_conf)
+        reader = _hoomd.CheckpointReader(self.device._cpp_exec_conf, filename)
         snapshot = Snapshot._from_cpp_snapshot(reader.getSnapshot(),
                                                self.device.communicator)
 
         step = reader.getTimeStep() if self.timestep is None else self.timestep
-        self._state = State(self, snapshot, domain_decomposition)
+        if self._seed is None:
+            self._seed = reader.getSeed()
+        self._pending_checkpoint_state = reader.getOperationState()
+        self._state = State(self, snapshot, domain_decomposition,
+                            bisect_domains)
 
         reader.clearSnapshot()
 
@@ -241,7 +334,8 @@ class Simulation(metaclass=Loggable):
 
     def create_state_from_snapshot(self,
                                    snapshot,
-                                   domain_decomposition=(None, None, None)):
+                                   domain_decomposition=(None, None, None),
+                                   bisect_domains=False):
         """Create the simulation state from a `Snapshot`.
 
         Args:
@@ -257,6 +351,11 @@ class Simulation(metaclass=Loggable):
                 to include in each domain. The sum of each list of floats must
                 be 1.0 (e.g. ``([0.25, 0.75], [0.2, 0.8], [1.0])``).
 
+            bisect_domains (bool): When `True`, place the domain boundaries
+                by recursive bisection of the particle positions so that
+                every slab of domains holds the same number of particles.
+                Use with a tuple of integers or `None` values.
+
         When `timestep` is `None` before calling, `create_state_from_snapshot`
         sets `timestep` to 0.
 
@@ -289,17 +388,20 @@ class Simulation(metaclass=Loggable):
 
         if isinstance(snapshot, Snapshot):
             # snapshot is hoomd.Snapshot
-            self._state = State(self, snapshot, domain_decomposition)
+            self._state = State(self, snapshot, domain_decomposition,
+                                bisect_domains)
         elif _match_class_path(snapshot, 'gsd.hoomd.Frame'):
             # snapshot is gsd.hoomd.Frame (gsd 2.8+, 3.x)
             snapshot = Snapshot.from_gsd_frame(snapshot,
                                                self._device.communicator)
-            self._state = State(self, snapshot, domain_decomposition)
+            self._state = State(self, snapshot, domain_decomposition,
+                                bisect_domains)
         elif _match_class_path(snapshot, 'gsd.hoomd.Snapshot'):
             # snapshot is gsd.hoomd.Snapshot (gsd 2.x)
             snapshot = Snapshot.from_gsd_snapshot(snapshot,
                                                   self._device.communicator)
-            self._state = State(self, snapshot, domain_decomposition)
+            self._state = State(self, snapshot, domain_decomposition,
+                                bisect_domains)
         else:
             raise TypeError(
                 "Snapshot must be a hoomd.Snapshot, gsd.hoomd.Snapshot, "
@@ -443,6 +545,52 @@ class Simulation(metaclass=Loggable):
         else:
             return self._cpp_sys.initial_timestep
 
+    @log(default=False)
+    def host_memory(self):
+        """int: Host memory held by the data arrays on this rank [bytes].
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=simulation, quantities=['host_memory'])
+
+        See Also:
+            `hoomd.device.Device.memory_usage`
+        """
+        return self._device.memory_total['host']
+
+    @log(default=False)
+    def device_memory(self):
+        """int: Device memory held by the data arrays on this rank [bytes].
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=simulation, quantities=['device_memory'])
+
+        See Also:
+            `hoomd.device.Device.memory_usage`
+        """
+        return self._device.memory_total['device']
+
+    @log(category='object', default=False)
+    def memory_usage(self):
+        """dict[str, dict[str, int]]: Memory held by each array owner on this \
+        rank [bytes].
+
+        The current and peak memory of each owner, as given by
+        `hoomd.device.Device.memory_usage`.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=simulation, quantities=['memory_usage'])
+        """
+        return self._device.memory_usage
+
     @property
     def always_compute_pressure(self):
         """bool: Always compute the virial and pressure (defaults to ``False``).
@@ -482,6 +630,174 @@ class Simulation(metaclass=Loggable):
             if value:
                 self._state._cpp_sys_def.getParticleData().setPressureFlag()
 
+    @property
+    def always_compute_energy(self):
+        """bool: Always compute the potential energy (defaults to ``True``).
+
+        By default, HOOMD computes the per particle potential energy on every
+        timestep. Set `always_compute_energy` to False to compute it only on
+        timesteps where it is needed (when a writer such as `hoomd.write.Table`
+        or `hoomd.write.GSD` logs data, or when using
+        `hoomd.md.minimize.FIRE`). MD pair potentials on the GPU then skip the
+        energy on the other timesteps, which makes them faster. Energies
+        queried by property on those timesteps may be incorrect.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.always_compute_energy = False
+        """
+        if not hasattr(self, '_cpp_sys'):
+            return True
+        else:
+            return self._cpp_sys.getEnergyFlag()
+
+    @always_compute_energy.setter
+    def always_compute_energy(self, value):
+        if not hasattr(self, '_cpp_sys'):
+            raise RuntimeError('Cannot set flag without state')
+        else:
+            self._cpp_sys.setEnergyFlag(value)
+
+            # if the flag is true, also set it in the particle data
+            if value:
+                self._state._cpp_sys_def.getParticleData().setEnergyFlag()
+
+    @property
+    def persistent_ghost_updates(self):
+        """bool: Reuse MPI requests for ghost updates (defaults to ``False``).
+
+        Between neighbor list builds, HOOMD sends the positions (and other
+        changing fields) of ghost particles to neighboring ranks on every time
+        step. Set `persistent_ghost_updates` to True to set up these sends and
+        receives once as persistent MPI requests each time the set of ghost
+        particles changes and restart them on every subsequent update. This
+        lowers the per step cost of the ghost update in MPI implementations
+        with large message setup overheads.
+
+        Note:
+            Only `hoomd.device.GPU` simulations implement persistent ghost
+            updates. The flag has no effect on the CPU or on a single rank.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.persistent_ghost_updates = True
+        """
+        return self._persistent_ghost_updates
+
+    @persistent_ghost_updates.setter
+    def persistent_ghost_updates(self, value):
+        self._persistent_ghost_updates = bool(value)
+        if getattr(self, '_system_communicator', None) is not None:
+            self._system_communicator.persistent_ghost_updates = \
+                self._persistent_ghost_updates
+
+    @property
+    def compress_ghost_updates(self):
+        """bool: Send ghost updates in reduced precision (defaults to ``False``).
+
+        Set `compress_ghost_updates` to True to send the positions and
+        orientations of ghost particles between neighbor list builds as single
+        precision offsets from the values sent when the ghosts were last
+        exchanged. Neighboring ranks add the offsets to their copy of those
+        values. In double precision builds, this halves the size of the
+        position and orientation messages. The offsets are bounded by the
+        distance particles move between neighbor list builds, so the ghost
+        positions remain accurate to about :math:`10^{-7}` times that
+        distance. Local particles are always integrated in full precision.
+
+        Note:
+            Only `hoomd.device.GPU` simulations implement compressed ghost
+            updates. The flag has no effect on the CPU or on a single rank.
+            Changes take effect at the next ghost exchange.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.compress_ghost_updates = True
+        """
+        return self._compress_ghost_updates
+
+    @compress_ghost_updates.setter
+    def compress_ghost_updates(self, value):
+        self._compress_ghost_updates = bool(value)
+        if getattr(self, '_system_communicator', None) is not None:
+            self._system_communicator.compress_ghost_updates = \
+                self._compress_ghost_updates
+
+    @property
+    def delta_ghost_updates(self):
+        """bool: Send only changed ghost values (defaults to ``False``).
+
+        Set `delta_ghost_updates` to True to send only the velocities and
+        orientations of ghost particles that changed since the last update.
+        Each rank keeps a copy of the ghost velocities and orientations it sent
+        to and received from its neighbors when the ghosts were last
+        exchanged. Between exchanges, it sends the indices and values of the
+        ghosts that differ from its copy. This reduces the ghost update
+        bandwidth when few velocities and orientations change, such as rigid
+        bodies that are at rest or anisotropic particles that are held fixed.
+        The ghosts receive the same values as with full updates.
+
+        Note:
+            Only `hoomd.device.CPU` simulations implement delta ghost updates.
+            The flag has no effect on the GPU or on a single rank. Changes take
+            effect at the next ghost exchange.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.delta_ghost_updates = True
+        """
+        return self._delta_ghost_updates
+
+    @delta_ghost_updates.setter
+    def delta_ghost_updates(self, value):
+        self._delta_ghost_updates = bool(value)
+        if getattr(self, '_system_communicator', None) is not None:
+            self._system_communicator.delta_ghost_updates = \
+                self._delta_ghost_updates
+
+    @property
+    def ghost_shell(self):
+        """float: Extra ghost layer width :math:`[\\mathrm{length}]`
+        (defaults to 0).
+
+        By default, MPI simulations migrate particles between ranks and
+        exchange ghost particles every time a neighbor list is rebuilt. Set
+        `ghost_shell` to a positive value to widen the ghost layer by
+        `ghost_shell` instead. Neighbor lists then rebuild locally with the
+        current ghost particles, and particles migrate only after some
+        particle has moved more than ``ghost_shell / 2`` since the last
+        exchange. A wider shell sends more ghost particles in every step in
+        exchange for less frequent migrations.
+
+        Note:
+            `ghost_shell` has no effect on a single rank. Changes take effect
+            at the next step, which migrates particles and exchanges ghosts.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.ghost_shell = 0.4
+        """
+        return self._ghost_shell
+
+    @ghost_shell.setter
+    def ghost_shell(self, value):
+        value = float(value)
+        if value < 0:
+            raise ValueError("ghost_shell must be non-negative.")
+        self._ghost_shell = value
+        if getattr(self, '_system_communicator', None) is not None:
+            self._system_communicator.ghost_shell = self._ghost_shell
+
     def run(self, steps, write_at_start=False):
         """Advance the simulation a number of steps.
 
@@ -535,6 +851,12 @@ class Simulation(metaclass=Loggable):
             Using ``write_at_start=True`` in subsequent
             calls to `run` will result in duplicate output frames.
 
+        Note:
+            `run` releases the Python global interpreter lock on time steps
+            where no custom Python operation runs, so other Python threads may
+            execute during the run. Do not access the simulation from other
+            threads while `run` executes.
+
         .. rubric:: Example:
 
         .. invisible-code-block: python
@@ -553,6 +875,15 @@ class Simulation(metaclass=Loggable):
                 "Cannot call run inside of a local snapshot context manager.")
         if not self.operations._scheduled:
             self.operations._schedule()
+        if self._pending_checkpoint_state is not None:
+            hoomd.write.checkpoint._apply_checkpoint_state(
+                self, self._pending_checkpoint_state)
+            self._pending_checkpoint_state = None
+
+        use_autotuner_cache = (isinstance(self.device, hoomd.device.GPU)
+                               and self.device.autotuner_cache is not None)
+        if use_autotuner_cache:
+            hoomd.tune.autotuner_cache._apply(self)
 
         steps_int = int(steps)
         if steps_int < 0 or steps_int > TIMESTEP_MAX - 1:
@@ -561,6 +892,9 @@ class Simulation(metaclass=Loggable):
 
         self._cpp_sys.run(steps_int, write_at_start)
 
+        if use_autotuner_cache:
+            hoomd.tune.autotuner_cache._store(self)
+
     def __del__(self):
         """Clean up dangling references to simulation."""
         # _operations may not be set, check before unscheduling
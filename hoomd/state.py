@@ -22,14 +22,19 @@ import math
 import collections.abc
 
 
-def _create_domain_decomposition(device, box, domain_decomposition):
+def _create_domain_decomposition(device,
+                                 snapshot,
+                                 domain_decomposition,
+                                 bisect_domains=False):
     """Create the domain decomposition.
 
     Args:
         device (Device): The simulation's device
-        box: The C++ global box object for the state being initialized
+        snapshot (Snapshot): The snapshot the state is being initialized from
         domain_decomposition: See Simulation.create_state_from_* for a
           description.
+        bisect_domains (bool): See Simulation.create_state_from_* for a
+          description.
     """
     if (not isinstance(domain_decomposition, collections.abc.Sequence)
             or len(domain_decomposition) != 3):
@@ -52,6 +57,9 @@ def _create_domain_decomposition(device, box, domain_decomposition):
     if initialize_grid and initialize_fractions:
         raise ValueError("Domain decomposition mixes integers and sequences.")
 
+    if bisect_domains and initialize_fractions:
+        raise ValueError("Cannot bisect domains with given fractions.")
+
     if not hoomd.version.mpi_enabled:
         return None
 
@@ -60,6 +68,7 @@ def _create_domain_decomposition(device, box, domain_decomposition):
     if device.communicator.num_ranks == 1:
         return None
 
+    box = snapshot._cpp_obj._global_box
     if initialize_fractions:
         fractions = [
             v[:-1] if v is not None else [] for v in domain_decomposition
@@ -67,9 +76,13 @@ def _create_domain_decomposition(device, box, domain_decomposition):
         result = _hoomd.DomainDecomposition(device._cpp_exec_conf, box.getL(),
                                             *fractions)
     else:
+        # when the grid is chosen automatically, keep the domains of the ranks
+        # on each node together so that most neighbors share memory
         grid = [v if v is not None else 0 for v in domain_decomposition]
         result = _hoomd.DomainDecomposition(device._cpp_exec_conf, box.getL(),
-                                            *grid, False)
+                                            *grid, True)
+        if bisect_domains:
+            result.bisectParticles(box, snapshot._cpp_obj.particles)
 
     return result
 
@@ -248,12 +261,17 @@ class State:
     .. _Kamberaj 2005: http://dx.doi.org/10.1063/1.1906216
     """
 
-    def __init__(self, simulation, snapshot, domain_decomposition):
+    def __init__(self,
+                 simulation,
+                 snapshot,
+                 domain_decomposition,
+                 bisect_domains=False):
         self._simulation = simulation
         snapshot._broadcast_box()
-        decomposition = _create_domain_decomposition(
-            simulation.device, snapshot._cpp_obj._global_box,
-            domain_decomposition)
+        decomposition = _create_domain_decomposition(simulation.device,
+                                                     snapshot,
+                                                     domain_decomposition,
+                                                     bisect_domains)
 
         if decomposition is not None:
             self._cpp_sys_def = _hoomd.SystemDefinition(
@@ -500,6 +500,37 @@ UP_TEST(counter)
     UP_ASSERT_EQUAL(e.getCounter()[3], 0xabcd);
     }
 
+//! Test that the batched generators reproduce the scalar streams, including past the batch
+UP_TEST(random_generator_batch)
+    {
+    hoomd::RandomGeneratorBatch<2> batch;
+    for (unsigned int i = 0; i < batch.width; ++i)
+        {
+        batch.setStream(
+            i,
+            hoomd::Seed(hoomd::RNGIdentifier::ATCollisionMethod, 0xabcdef12345 + i, 0x5eed),
+            hoomd::Counter(0x9876 * i, 0x5432, 0x10fe));
+        }
+    batch.generate();
+
+    for (unsigned int i = 0; i < batch.width; ++i)
+        {
+        hoomd::RandomGenerator rng(
+            hoomd::Seed(hoomd::RNGIdentifier::ATCollisionMethod, 0xabcdef12345 + i, 0x5eed),
+            hoomd::Counter(0x9876 * i, 0x5432, 0x10fe));
+        auto batch_rng = batch.getGenerator(i);
+        for (unsigned int j = 0; j < 4; ++j)
+            {
+            auto u = rng();
+            auto v = batch_rng();
+            for (unsigned int k = 0; k < 4; ++k)
+                {
+                UP_ASSERT_EQUAL(u.v[k], v.v[k]);
+                }
+            }
+        }
+    }
+
 UP_TEST(rng_seeding)
     {
     auto s = hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoShuffle, 0xabcdef1234567890, 0x5eed);
@@ -0,0 +1,178 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/Autotuner.h"
+#include "hoomd/ExecutionConfiguration.h"
+
+#include <array>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <vector>
+
+/*! \file test_autotuner.cc
+    \brief Unit tests for the Autotuner search modes
+    \ingroup unit_tests
+*/
+
+#include "upp11_config.h"
+
+using namespace hoomd;
+
+HOOMD_UP_MAIN();
+
+//! Autotuner that samples a cost function instead of timing kernel launches
+template<size_t n_dimensions> class CostAutotuner : public Autotuner<n_dimensions>
+    {
+    public:
+    using Autotuner<n_dimensions>::Autotuner;
+
+    //! Sample the cost of the current parameter as if a kernel was launched with it
+    template<class Cost> void launch(const Cost& cost)
+        {
+        if (this->m_state == Autotuner<n_dimensions>::SCANNING)
+            {
+            this->recordSample(cost(this->getParam()));
+            }
+        this->nextSample();
+        }
+    };
+
+//! Launch until the autotuner completes
+/*! \returns The number of launches
+ */
+template<size_t n_dimensions, class Cost>
+unsigned int tune(CostAutotuner<n_dimensions>& tuner, const Cost& cost)
+    {
+    unsigned int n_launches = 0;
+    while (!tuner.isComplete() && n_launches < 100000)
+        {
+        tuner.launch(cost);
+        n_launches++;
+        }
+    return n_launches;
+    }
+
+//! Separable cost with its minimum at (256, 4)
+float separable_cost(const std::array<unsigned int, 2>& p)
+    {
+    float x = std::log2(float(p[0])) - 8.0f;
+    float y = std::log2(float(p[1])) - 2.0f;
+    return 1.0f + x * x + 0.5f * y * y;
+    }
+
+std::shared_ptr<ExecutionConfiguration> make_exec_conf()
+    {
+    return std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+    }
+
+const std::vector<std::vector<unsigned int>> ranges_2d
+    = {{32, 64, 128, 256, 512, 1024}, {1, 2, 4, 8, 16}};
+
+//! Test that coordinate descent finds the optimum with fewer launches than the exhaustive scan
+UP_TEST(autotuner_coordinate_descent_converges)
+    {
+    CostAutotuner<2> tuner(ranges_2d, make_exec_conf(), "test");
+    tuner.setMode(Autotuner<2>::search_coordinate_descent);
+    UP_ASSERT(!tuner.isComplete());
+
+    unsigned int n_launches = tune(tuner, separable_cost);
+    UP_ASSERT(tuner.isComplete());
+    UP_ASSERT(tuner.isLocked());
+    UP_ASSERT(tuner.getParam() == (std::array<unsigned int, 2> {256, 4}));
+    UP_ASSERT(n_launches < 6 * 5 * 5);
+    MY_CHECK_CLOSE(tuner.getTunedTime(), 1.0f, 1e-4);
+
+    // a new scan starts from the optimum and confirms it
+    tuner.startScan();
+    UP_ASSERT(!tuner.isComplete());
+    tune(tuner, separable_cost);
+    UP_ASSERT(tuner.getParam() == (std::array<unsigned int, 2> {256, 4}));
+    }
+
+//! Test that the exhaustive scan samples every parameter and is restored by setMode
+UP_TEST(autotuner_exhaustive_fallback)
+    {
+    CostAutotuner<2> tuner(ranges_2d, make_exec_conf(), "test");
+    unsigned int n_launches = tune(tuner, separable_cost);
+    CHECK_EQUAL_UINT(n_launches, 6 * 5 * 5);
+    UP_ASSERT(tuner.getParam() == (std::array<unsigned int, 2> {256, 4}));
+
+    // switching back to the exhaustive mode in the middle of a descent restarts a full scan
+    tuner.setMode(Autotuner<2>::search_coordinate_descent);
+    tuner.startScan();
+    tuner.launch(separable_cost);
+    tuner.setMode(Autotuner<2>::search_exhaustive);
+    n_launches = tune(tuner, separable_cost);
+    CHECK_EQUAL_UINT(n_launches, 6 * 5 * 5);
+    UP_ASSERT(tuner.getParam() == (std::array<unsigned int, 2> {256, 4}));
+    }
+
+//! Test that slow parameters are rejected after the first round of samples
+UP_TEST(autotuner_coordinate_descent_rejects)
+    {
+    std::map<std::array<unsigned int, 2>, unsigned int> n_samples;
+    auto cost = [&n_samples](const std::array<unsigned int, 2>& p)
+    {
+        n_samples[p]++;
+        return separable_cost(p);
+    };
+
+    CostAutotuner<2> tuner(ranges_2d, make_exec_conf(), "test");
+    tuner.setMode(Autotuner<2>::search_coordinate_descent);
+    tune(tuner, cost);
+    UP_ASSERT(tuner.getParam() == (std::array<unsigned int, 2> {256, 4}));
+
+    // the first line scans dimension 0 from (32, 1), where only (128, 1), (256, 1) and (512, 1)
+    // are within 1.5 times the fastest after one sample
+    CHECK_EQUAL_UINT(n_samples[(std::array<unsigned int, 2> {32, 1})], 1);
+    CHECK_EQUAL_UINT(n_samples[(std::array<unsigned int, 2> {1024, 1})], 1);
+    UP_ASSERT(n_samples[(std::array<unsigned int, 2> {256, 1})] >= 5);
+
+    // parameters far from the optimum in both dimensions are never sampled
+    CHECK_EQUAL_UINT(n_samples.count(std::array<unsigned int, 2> {1024, 16}), 0);
+    }
+
+//! Test coordinate descent over a parameter space with invalid parameters
+UP_TEST(autotuner_coordinate_descent_invalid)
+    {
+    // the unconstrained optimum (256, 4) is not valid
+    auto is_valid = [](const std::array<unsigned int, 2>& p) -> bool { return p[0] * p[1] <= 512; };
+    CostAutotuner<2> tuner(ranges_2d, make_exec_conf(), "test", 5, false, is_valid);
+    tuner.setMode(Autotuner<2>::search_coordinate_descent);
+    tune(tuner, separable_cost);
+
+    // (256, 2) is the fastest valid parameter
+    UP_ASSERT(tuner.getParam() == (std::array<unsigned int, 2> {256, 2}));
+    }
+
+//! Test that coordinate descent completes without sampling when there is nothing to compare
+UP_TEST(autotuner_coordinate_descent_single)
+    {
+    CostAutotuner<2> tuner({{128}, {1, 2, 4}},
+                           make_exec_conf(),
+                           "test",
+                           5,
+                           false,
+                           [](const std::array<unsigned int, 2>& p) -> bool { return p[1] == 2; });
+    tuner.setMode(Autotuner<2>::search_coordinate_descent);
+    UP_ASSERT(tuner.isComplete());
+    UP_ASSERT(tuner.getParam() == (std::array<unsigned int, 2> {128, 2}));
+    }
+
+//! Test that coordinate descent over one dimension matches the exhaustive scan
+UP_TEST(autotuner_coordinate_descent_1d)
+    {
+    auto cost = [](const std::array<unsigned int, 1>& p)
+    {
+        float x = std::log2(float(p[0])) - 7.0f;
+        return 1.0f + x * x;
+    };
+
+    CostAutotuner<1> tuner({{32, 64, 128, 256, 512, 1024}}, make_exec_conf(), "test");
+    tuner.setMode(Autotuner<1>::search_coordinate_descent);
+    unsigned int n_launches = tune(tuner, cost);
+    UP_ASSERT(tuner.getParam() == (std::array<unsigned int, 1> {128}));
+    UP_ASSERT(n_launches <= 6 * 5);
+    }
@@ -415,6 +415,54 @@ UP_TEST(BoxDim_triclinic_test)
     UP_ASSERT_EQUAL(img.z, 0);
     }
 
+//! Test that the batched minimum image matches minImage
+UP_TEST(BoxDim_min_image_batch_test)
+    {
+    Scalar tol = Scalar(1e-4);
+    const Scalar3 dx[6] = {make_scalar3(3.0, 1.0, 2.0),
+                           make_scalar3(-3.0, -2.6, 1.5),
+                           make_scalar3(2.1, 1.5, 3.0),
+                           make_scalar3(2.1, 1.5, -3.0),
+                           make_scalar3(-4.0, 4.5, -2.0),
+                           make_scalar3(0.5, -0.5, 0.25)};
+
+    BoxDim triclinic(5.0, 1.0, 0.4, 0.9);
+    BoxDim orthorhombic(5.0, 6.0, 7.0);
+    BoxDim slab(5.0);
+    slab.setPeriodic(make_uchar3(1, 0, 1));
+    UP_ASSERT(!triclinic.isOrthorhombic());
+    UP_ASSERT(orthorhombic.isOrthorhombic());
+
+    for (const BoxDim& b : {triclinic, orthorhombic, slab})
+        {
+        Scalar x[6], y[6], z[6];
+        for (unsigned int i = 0; i < 6; ++i)
+            {
+            x[i] = dx[i].x;
+            y[i] = dx[i].y;
+            z[i] = dx[i].z;
+            }
+        if (b.isOrthorhombic())
+            b.minImageBatch<false>(x, y, z, 6);
+        else
+            b.minImageBatch<true>(x, y, z, 6);
+
+        for (unsigned int i = 0; i < 6; ++i)
+            {
+            const Scalar3 expected = b.minImage(dx[i]);
+            MY_CHECK_CLOSE(x[i] + Scalar(10.0), expected.x + Scalar(10.0), tol);
+            MY_CHECK_CLOSE(y[i] + Scalar(10.0), expected.y + Scalar(10.0), tol);
+            MY_CHECK_CLOSE(z[i] + Scalar(10.0), expected.z + Scalar(10.0), tol);
+            }
+        }
+
+    // unlike minImage, the batch wraps vectors by more than one image
+    Scalar x = 11.0, y = -13.0, z = 0.0;
+    orthorhombic.minImageBatch<false>(&x, &y, &z, 1);
+    MY_CHECK_CLOSE(x, 1.0, tol);
+    MY_CHECK_CLOSE(y, -1.0, tol);
+    }
+
 //! Test operation of the particle data class
 UP_TEST(ParticleData_test)
     {
@@ -615,6 +663,76 @@ UP_TEST(ParticleData_test)
         }
     }
 
+//! Test that the structure of arrays positions follow writes to the positions
+UP_TEST(ParticleData_positions_soa_test)
+    {
+    auto box = std::make_shared<BoxDim>(10.0);
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+    ParticleData pdata(3, box, 2, exec_conf);
+
+    Scalar tol = Scalar(1e-6);
+
+        {
+        ArrayHandle<Scalar4> h_pos(pdata.getPositions(),
+                                   access_location::host,
+                                   access_mode::overwrite);
+        for (unsigned int i = 0; i < 3; i++)
+            h_pos.data[i]
+                = make_scalar4(Scalar(i), Scalar(2 * i), Scalar(3 * i), __int_as_scalar(i % 2));
+        }
+
+        {
+        const GPUArray<Scalar>& pos_soa = pdata.getPositionsSoA();
+        size_t pitch = pos_soa.getPitch();
+        ArrayHandle<Scalar> h_pos_soa(pos_soa, access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_type_soa(pdata.getTypesSoA(),
+                                             access_location::host,
+                                             access_mode::read);
+        for (unsigned int i = 0; i < 3; i++)
+            {
+            MY_CHECK_CLOSE(h_pos_soa.data[i], Scalar(i), tol);
+            MY_CHECK_CLOSE(h_pos_soa.data[pitch + i], Scalar(2 * i), tol);
+            MY_CHECK_CLOSE(h_pos_soa.data[2 * pitch + i], Scalar(3 * i), tol);
+            UP_ASSERT_EQUAL(h_type_soa.data[i], i % 2);
+            }
+        }
+
+    // a write marks the mirror stale
+        {
+        ArrayHandle<Scalar4> h_pos(pdata.getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        h_pos.data[1].x = Scalar(4.0);
+        }
+
+        {
+        ArrayHandle<Scalar> h_pos_soa(pdata.getPositionsSoA(),
+                                      access_location::host,
+                                      access_mode::read);
+        MY_CHECK_CLOSE(h_pos_soa.data[1], 4.0, tol);
+        }
+
+    // so does swapping in reordered positions
+        {
+        ArrayHandle<Scalar4> h_pos(pdata.getPositions(), access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_pos_alt(pdata.getAltPositions(),
+                                       access_location::host,
+                                       access_mode::overwrite);
+        for (unsigned int i = 0; i < 3; i++)
+            h_pos_alt.data[i] = h_pos.data[2 - i];
+        }
+    pdata.swapPositions();
+
+        {
+        ArrayHandle<Scalar> h_pos_soa(pdata.getPositionsSoA(),
+                                      access_location::host,
+                                      access_mode::read);
+        MY_CHECK_CLOSE(h_pos_soa.data[0], 2.0, tol);
+        MY_CHECK_CLOSE(h_pos_soa.data[2], 0.0, tol);
+        }
+    }
+
 //! Tests the RandomParticleInitializer class
 UP_TEST(Random_test)
     {
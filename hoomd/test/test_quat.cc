@@ -263,3 +263,28 @@ UP_TEST(rotation_2)
     MY_CHECK_CLOSE(a.x, -1, tol);
     MY_CHECK_CLOSE(a.y, 1, tol);
     }
+
+UP_TEST(rotation_batch)
+    {
+    // a batch rotation should match rotating each vector with rotate, also for a quaternion that
+    // is not normalized
+    quat<Scalar> q(Scalar(0.3), vec3<Scalar>(-0.8, 1.2, 0.5));
+    Scalar x[5] = {1, -2, 0.5, 3, 0};
+    Scalar y[5] = {0, 1, -1.5, 2, 0};
+    Scalar z[5] = {-1, 0.25, 2, -3, 0};
+
+    vec3<Scalar> expected[5];
+    for (unsigned int i = 0; i < 5; ++i)
+        expected[i] = rotate(q, vec3<Scalar>(x[i], y[i], z[i]));
+
+    rotate_batch(q, x, y, z, 5);
+    for (unsigned int i = 0; i < 4; ++i)
+        {
+        MY_CHECK_CLOSE(x[i], expected[i].x, tol);
+        MY_CHECK_CLOSE(y[i], expected[i].y, tol);
+        MY_CHECK_CLOSE(z[i], expected[i].z, tol);
+        }
+    MY_CHECK_SMALL(x[4], tol_small);
+    MY_CHECK_SMALL(y[4], tol_small);
+    MY_CHECK_SMALL(z[4], tol_small);
+    }
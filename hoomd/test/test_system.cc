@@ -199,6 +199,48 @@ UP_TEST(getter_setter_tests)
     MY_ASSERT_EQUAL(sys.getIntegrator(), integrator2);
     }
 
+//! Tests that changing the parameters of a trigger between evaluations changes its schedule
+UP_TEST(trigger_schedule_tests)
+    {
+    // the evaluation on step 1 skips the steps before 10
+    auto periodic = std::make_shared<PeriodicTrigger>(10);
+    UP_ASSERT((*periodic)(0));
+    UP_ASSERT(!(*periodic)(1));
+    periodic->setPeriod(3);
+    UP_ASSERT(!(*periodic)(2));
+    UP_ASSERT((*periodic)(3));
+    periodic->setPhase(1);
+    UP_ASSERT((*periodic)(4));
+    UP_ASSERT(!(*periodic)(5));
+
+    // the result cached for the last step is discarded as well
+    periodic->setPhase(2);
+    UP_ASSERT((*periodic)(5));
+
+    // triggers that combine a changed trigger follow its new schedule
+    auto child = std::make_shared<PeriodicTrigger>(10);
+    auto combined = std::make_shared<AndTrigger>(std::vector<std::shared_ptr<Trigger>>({child}));
+    UP_ASSERT((*combined)(0));
+    UP_ASSERT(!(*combined)(1));
+    child->setPeriod(2);
+    UP_ASSERT((*combined)(2));
+
+    auto before = std::make_shared<BeforeTrigger>(1);
+    UP_ASSERT(!(*before)(1));
+    before->setTimestep(10);
+    UP_ASSERT((*before)(2));
+
+    auto on = std::make_shared<OnTrigger>(100);
+    UP_ASSERT(!(*on)(0));
+    on->setTimestep(5);
+    UP_ASSERT((*on)(5));
+
+    auto after = std::make_shared<AfterTrigger>(100);
+    UP_ASSERT(!(*after)(0));
+    after->setTimestep(5);
+    UP_ASSERT((*after)(6));
+    }
+
 // since there is no automatic verification, there is no reason to run this test all the time
 // this test can be uncommented only when it needs to be checked by a person
 
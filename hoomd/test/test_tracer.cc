@@ -0,0 +1,115 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/ExecutionConfiguration.h"
+#include "hoomd/Tracer.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+/*! \file test_tracer.cc
+    \brief Unit tests for Tracer
+    \ingroup unit_tests
+*/
+
+#include "upp11_config.h"
+
+using namespace hoomd;
+
+HOOMD_UP_MAIN();
+
+//! Read a file into a string
+std::string read_file(const std::string& fname)
+    {
+    std::ifstream f(fname);
+    std::stringstream s;
+    s << f.rdbuf();
+    return s.str();
+    }
+
+//! Count the occurrences of a substring
+unsigned int count(const std::string& s, const std::string& sub)
+    {
+    unsigned int n = 0;
+    for (size_t pos = s.find(sub); pos != std::string::npos; pos = s.find(sub, pos + 1))
+        n++;
+    return n;
+    }
+
+//! Test that spans are only recorded while the tracer is enabled
+UP_TEST(tracer_enable)
+    {
+    Tracer tracer(false);
+    UP_ASSERT(!tracer.isEnabled());
+        {
+        ScopedTrace trace(tracer, "ignored", "test");
+        }
+    UP_ASSERT_EQUAL(tracer.getNumEvents(), 0);
+
+    tracer.start(16, true);
+    UP_ASSERT(tracer.isEnabled());
+    UP_ASSERT(!tracer.gpuEventsEnabled());
+        {
+        ScopedTrace outer(tracer, "outer", "test");
+            {
+            ScopedTrace inner(tracer, typeid(tracer), "test");
+            }
+        }
+    tracer.stop();
+        {
+        ScopedTrace trace(tracer, "ignored", "test");
+        }
+    UP_ASSERT_EQUAL(tracer.getNumEvents(), 2);
+
+    const std::string fname = "test_tracer_enable.json";
+    tracer.writeChromeTrace(fname, 3);
+    std::string trace = read_file(fname);
+    UP_ASSERT_EQUAL(count(trace, "\"ph\":\"X\""), 2);
+    UP_ASSERT_EQUAL(count(trace, "\"name\":\"outer\""), 1);
+    UP_ASSERT_EQUAL(count(trace, "\"name\":\"Tracer\""), 1);
+    UP_ASSERT_EQUAL(count(trace, "\"ignored\""), 0);
+    UP_ASSERT(count(trace, "\"pid\":3") > 0);
+    std::remove(fname.c_str());
+
+    UP_ASSERT_EXCEPTION(std::invalid_argument, [&] { tracer.start(0, false); });
+    }
+
+//! Test that full buffers keep the most recent spans
+UP_TEST(tracer_ring)
+    {
+    Tracer tracer(false);
+    tracer.start(4, false);
+    const char* names[] = {"a", "b", "c", "d", "e", "f"};
+    for (auto name : names)
+        {
+        ScopedTrace trace(tracer, name, "test");
+        }
+    tracer.record(tracer.intern("g"), "test", tracer.getTime(), tracer.getTime());
+    UP_ASSERT_EQUAL(tracer.getNumEvents(), 4);
+
+    const std::string fname = "test_tracer_ring.json";
+    tracer.writeChromeTrace(fname, 0);
+    std::string trace = read_file(fname);
+    UP_ASSERT_EQUAL(count(trace, "\"ph\":\"X\""), 4);
+    UP_ASSERT_EQUAL(count(trace, "\"name\":\"c\""), 0);
+    UP_ASSERT_EQUAL(count(trace, "\"name\":\"d\""), 1);
+    UP_ASSERT_EQUAL(count(trace, "\"name\":\"g\""), 1);
+    std::remove(fname.c_str());
+
+    // restarting discards the previous events
+    tracer.start(4, false);
+    UP_ASSERT_EQUAL(tracer.getNumEvents(), 0);
+    }
+
+//! Test that the execution configuration provides a tracer
+UP_TEST(tracer_exec_conf)
+    {
+    auto exec_conf = std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU);
+    Tracer& tracer = exec_conf->getTracer();
+    UP_ASSERT(!tracer.isEnabled());
+    tracer.start(8, true);
+    UP_ASSERT(!tracer.gpuEventsEnabled());
+    tracer.stop();
+    }
@@ -58,6 +58,26 @@ class Trigger(_hoomd.Trigger):
             def compute(self, timestep):
                 return (timestep**(1 / 2)).is_integer()
 
+    Subclasses that depend only on the timestep may also override
+    `Trigger.next_timestep`. HOOMD-blue then calls `compute` only on the
+    timesteps that `next_timestep` returns, so one call into Python covers all
+    the timesteps until the trigger is next active. Subclasses whose schedule
+    depends on attributes must call `Trigger.invalidate_schedule` after
+    changing them:
+
+    .. code-block:: python
+
+        class CustomTrigger(hoomd.trigger.Trigger):
+
+            def __init__(self):
+                hoomd.trigger.Trigger.__init__(self)
+
+            def compute(self, timestep):
+                return (timestep**(1 / 2)).is_integer()
+
+            def next_timestep(self, timestep):
+                return math.ceil(timestep**(1 / 2))**2
+
     Methods:
         __call__(timestep):
             Evaluate the trigger.
@@ -81,6 +101,28 @@ class Trigger(_hoomd.Trigger):
 
             Returns:
                 bool: `True` when the trigger is active, `False` when it is not.
+
+        next_timestep(timestep):
+            Find the next timestep on which the trigger may be active.
+
+            Args:
+                timestep (int): The first timestep to consider.
+
+            Note:
+                `__call__` does not call `compute` on the timesteps before the
+                one returned. The default implementation returns *timestep*.
+
+            Returns:
+                int: A timestep no later than the first timestep at or after
+                *timestep* on which the trigger is active.
+
+        invalidate_schedule():
+            Discard the timesteps that `__call__` skips and the cached value.
+
+            Note:
+                `__call__` keeps the result of `next_timestep` until the
+                returned timestep, so call `invalidate_schedule` after changing
+                an attribute that its result depends on.
     """
 
     def __getstate__(self):
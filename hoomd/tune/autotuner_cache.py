@@ -0,0 +1,141 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement the persistent autotuner cache.
+
+The cache file stores the locked kernel parameters of the operations in a
+simulation so that later jobs can skip the autotuner scans. See
+`hoomd.device.GPU.autotuner_cache`.
+"""
+
+import json
+import math
+import os
+import re
+
+import hoomd
+from hoomd.operation import AutotunedObject
+
+_SCHEMA = 'hoomd-autotuner-cache'
+_SCHEMA_VERSION = 1
+
+
+def _read(filename):
+    """Read the entries of a cache file.
+
+    Returns an empty dictionary when the file does not exist or is not a valid
+    cache file.
+    """
+    try:
+        with open(filename) as f:
+            data = json.load(f)
+    except (OSError, ValueError):
+        return {}
+
+    if (not isinstance(data, dict) or data.get('schema') != _SCHEMA
+            or data.get('schema_version') != _SCHEMA_VERSION
+            or not isinstance(data.get('entries'), dict)):
+        return {}
+    return data['entries']
+
+
+def _write(filename, entries):
+    """Write the entries to a cache file, replacing it atomically."""
+    data = dict(schema=_SCHEMA,
+                schema_version=_SCHEMA_VERSION,
+                entries=entries)
+    temporary_filename = f'{filename}.{os.getpid()}.tmp'
+    with open(temporary_filename, 'w') as f:
+        json.dump(data, f, indent=1, sort_keys=True)
+    os.replace(temporary_filename, filename)
+
+
+def _problem_bucket(state):
+    """Classify the problem size.
+
+    Systems in the same bucket have a number of particles within a factor of
+    about 1.4, a density within a factor of about 1.4, and the same number of
+    particle types.
+    """
+    n = max(state.N_particles, 1)
+    volume = state.box.volume
+    density = n / volume if volume > 0 else 1.0
+    return (f'N{round(2 * math.log2(n))}'
+            f'-T{len(state.particle_types)}'
+            f'-D{round(2 * math.log2(density))}')
+
+
+def _prefix(simulation):
+    """Build the part of the cache key that is common to all operations."""
+    device = simulation.device
+    # remove the device id from the description
+    model = re.sub(r'^\s*\[\d+\]\s*', '', device.device).strip()
+    return '|'.join((model, hoomd.version.version,
+                     _problem_bucket(simulation.state)))
+
+
+def _tuned_operations(simulation):
+    """Iterate over the attached autotuned operations with their cache keys."""
+    # import here to avoid a circular import
+    from hoomd.write.checkpoint import _walk_operations
+
+    prefix = _prefix(simulation)
+    for key, operation in _walk_operations(simulation.operations):
+        if isinstance(operation, AutotunedObject) and operation._attached:
+            cls = type(operation)
+            yield (f'{prefix}|{key}|{cls.__module__}.{cls.__name__}',
+                   operation)
+
+
+def _apply(simulation):
+    """Set the cached kernel parameters of operations that are still tuning.
+
+    Operations that already completed tuning, or that have parameters set by
+    the user or a checkpoint, keep their parameters.
+    """
+    filename = simulation.device.autotuner_cache
+    entries = _read(filename)
+    if not entries:
+        return
+
+    for key, operation in _tuned_operations(simulation):
+        if key not in entries or operation.is_tuning_complete:
+            continue
+
+        for name, parameter in entries[key].items():
+            try:
+                operation.kernel_parameters = {name: tuple(parameter)}
+            except (RuntimeError, TypeError, ValueError) as error:
+                # invalid entries fall back to scanning
+                simulation.device._cpp_msg.notice(
+                    3, f"Ignoring cached kernel parameter {name} for "
+                    f"{key}: {error}\n")
+
+
+def _store(simulation):
+    """Add the locked kernel parameters to the cache file."""
+    filename = simulation.device.autotuner_cache
+
+    found = {}
+    for key, operation in _tuned_operations(simulation):
+        parameters = operation._cpp_obj.getLockedAutotunerParameters()
+        if parameters:
+            found[key] = {
+                name: list(value) for name, value in parameters.items()
+            }
+
+    if not found or simulation.device.communicator.rank != 0:
+        return
+
+    # merge with the file on disk, which other jobs may have updated
+    entries = _read(filename)
+    changed = False
+    for key, parameters in found.items():
+        entry = entries.setdefault(key, {})
+        for name, value in parameters.items():
+            if entry.get(name) != value:
+                entry[name] = value
+                changed = True
+
+    if changed:
+        _write(filename, entries)
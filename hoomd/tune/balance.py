@@ -4,6 +4,8 @@
 """Define LoadBalancer."""
 
 from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import OnlyFrom
+from hoomd.logging import log
 from hoomd.operation import Tuner
 from hoomd import _hoomd
 import hoomd
@@ -21,6 +23,9 @@ class LoadBalancer(Tuner):
         tolerance (float): Load imbalance tolerance.
         max_iterations (int): Maximum number of iterations to
             attempt in a single step.
+        objective (str): Load to balance: ``'particles'`` or ``'time'``.
+        damping (float): Weight of the previous cost per particle when
+            averaging the measured cost (``objective='time'`` only).
 
     `LoadBalancer` adjusts the boundaries of the MPI domains to distribute
     the particle load close to evenly between them. The load imbalance is
@@ -34,6 +39,26 @@ class LoadBalancer(Tuner):
     where :math:`N_i` is the number of particles on rank :math:`i`, :math:`N` is
     the total number of particles, and :math:`P` is the number of ranks.
 
+    When the cost per particle varies strongly between ranks (for example, in
+    wall regions, with rigid bodies, or with an MPCD solvent), balancing the
+    number of particles can leave some ranks much slower than others. Set
+    *objective* to ``'time'`` to balance the measured time instead. Each rank
+    measures the wall clock time it spends outside of MPI communication
+    between balancing steps, and divides it by the number of particles it owns
+    to obtain its cost per particle :math:`c_i`. The load imbalance is then
+
+    .. math::
+
+        I = \frac{c_i N_i}{\sum_j c_j N_j / P}.
+
+    To prevent oscillations, the cost per particle is an exponential moving
+    average of the measurements, where *damping* is the weight of the
+    previous average. The first balancing step of each `Simulation.run`
+    starts a new measurement and uses the previous cost (or balances the
+    particle counts when there is none). Measured times vary from step to
+    step, so use a *tolerance* above the typical noise (such as 1.1) and
+    balance over intervals of many steps.
+
     In order to adjust the load imbalance, `LoadBalancer` scales by the inverse
     of the imbalance factor. To reduce oscillations and communication overhead,
     it does not move a domain more than 5% of its current size in a single
@@ -83,6 +108,9 @@ class LoadBalancer(Tuner):
         tolerance (float): Load imbalance tolerance.
         max_iterations (int): Maximum number of iterations to
             attempt in a single step.
+        objective (str): Load to balance: ``'particles'`` or ``'time'``.
+        damping (float): Weight of the previous cost per particle when
+            averaging the measured cost (``objective='time'`` only).
     """
 
     def __init__(self,
@@ -91,19 +119,26 @@ class LoadBalancer(Tuner):
                  y=True,
                  z=True,
                  tolerance=1.02,
-                 max_iterations=1):
+                 max_iterations=1,
+                 objective='particles',
+                 damping=0.5):
         super().__init__(trigger)
 
         defaults = dict(x=x,
                         y=y,
                         z=z,
                         tolerance=tolerance,
-                        max_iterations=max_iterations)
-        load_balancer_params = ParameterDict(x=bool,
-                                             y=bool,
-                                             z=bool,
-                                             max_iterations=int,
-                                             tolerance=float)
+                        max_iterations=max_iterations,
+                        objective=objective,
+                        damping=damping)
+        load_balancer_params = ParameterDict(
+            x=bool,
+            y=bool,
+            z=bool,
+            max_iterations=int,
+            tolerance=float,
+            objective=OnlyFrom(['particles', 'time']),
+            damping=float)
         self._param_dict.update(load_balancer_params)
         self._param_dict.update(defaults)
 
@@ -115,3 +150,30 @@ class LoadBalancer(Tuner):
 
         self._cpp_obj = cpp_cls(self._simulation.state._cpp_sys_def,
                                 self.trigger)
+
+    @log(requires_run=True)
+    def imbalance(self):
+        """float: Maximum load imbalance at the last balancing step.
+
+        The imbalance is computed before the domains are adjusted.
+        """
+        return self._cpp_obj.imbalance
+
+    @log(requires_run=True)
+    def average_imbalance(self):
+        """float: Average load imbalance in the last run.
+
+        The average is taken over the values of `imbalance` at each balancing
+        step.
+        """
+        return self._cpp_obj.average_imbalance
+
+    @log(requires_run=True)
+    def peak_imbalance(self):
+        """float: Largest load imbalance during the last run."""
+        return self._cpp_obj.peak_imbalance
+
+    @log(requires_run=True)
+    def rebalances(self):
+        """int: Number of times the domains were adjusted in the last run."""
+        return self._cpp_obj.rebalances
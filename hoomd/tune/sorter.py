@@ -22,10 +22,16 @@ class ParticleSorter(Tuner):
             value of `None` sets ``grid=4096`` in 2D simulations and
             ``grid=256`` in 3D simulations.
 
+        sort_groups (bool): When `True`, also reorder the bonded groups by the
+            new order of their member particles. Defaults to `True`.
+
     `ParticleSorter` improves simulation performance by sorting the particles in
     memory along a space-filling curve. This takes particles that are close in
     space and places them close in memory, leading to a higher rate of
-    cache hits when computing pair potentials.
+    cache hits when computing pair potentials. With `sort_groups`, the bonds,
+    angles, dihedrals, impropers, constraints, and special pairs are then
+    reordered so that groups acting on nearby particles are also close in
+    memory.
 
     Note:
         New `hoomd.Operations` instances include a `ParticleSorter`
@@ -39,15 +45,19 @@ class ParticleSorter(Tuner):
             of `grid` provide more accurate space-filling curves, but consume
             more memory (``grid**D * 4`` bytes, where *D* is the dimensionality
             of the system).
+
+        sort_groups (bool): Set to `True` to reorder the bonded groups after
+            sorting the particles.
     """
 
-    def __init__(self, trigger=200, grid=None):
+    def __init__(self, trigger=200, grid=None, sort_groups=True):
         super().__init__(trigger)
         sorter_params = ParameterDict(
             grid=OnlyTypes(int,
                            postprocess=ParticleSorter._to_power_of_two,
                            preprocess=ParticleSorter._natural_number,
-                           allow_none=True))
+                           allow_none=True),
+            sort_groups=bool(sort_groups))
         self._param_dict.update(sorter_params)
         self.grid = grid
 
@@ -69,6 +69,11 @@ class BoxResize(Updater):
         \\vec{r_j} \\leftarrow \\mathrm{minimum\\_image}_{\\vec{a}_k}'
                                (\\vec{r}_j)
 
+    When the system has MPCD particles, `BoxResize` also scales all of them to
+    the new box and wraps them back into it, regardless of `filter`. The MPCD
+    cell list, virtual particle fillers, and streaming geometries are updated
+    for the new box.
+
     Note:
         For backward compatibility, you may set ``box1``, ``box2``, and
         ``variant`` which is equivalent to::
@@ -12,8 +12,10 @@ results to output files or streams:
 * Combine `GSD` with a `hoomd.logging.Logger` to save system properties or
   per-particle calculated results.
 * Use `HDF5Log` to store logged data in HDF5 resizable datasets.
+* Use `BinaryLog` to write scalar logged quantities frequently from C++.
 * Use `Table` to display the status of the simulation periodically to standard
   out.
+* Use `Checkpoint` to save the complete simulation state for restarts.
 * Implement custom output formats with `CustomWriter`.
 
 Writers do not modify the system state.
@@ -28,9 +30,11 @@ See Also:
     Tutorial: :doc:`tutorial/02-Logging/00-index`
 """
 
+from hoomd.write.checkpoint import Checkpoint
 from hoomd.write.custom_writer import CustomWriter
 from hoomd.write.gsd import GSD
 from hoomd.write.gsd_burst import Burst
 from hoomd.write.dcd import DCD
 from hoomd.write.table import Table
 from hoomd.write.hdf5 import HDF5Log
+from hoomd.write.binary_log import BinaryLog
@@ -0,0 +1,205 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement BinaryLog.
+
+.. invisible-code-block: python
+
+    if hoomd.version.md_built:
+        simulation = hoomd.util.make_example_simulation()
+        binary_filename = tmp_path / 'log.bin'
+        thermo = hoomd.md.compute.ThermodynamicQuantities(
+            filter=hoomd.filter.All())
+        simulation.operations.computes.append(thermo)
+
+.. skip: start if(not hoomd.version.md_built)
+"""
+
+import numpy as np
+
+from hoomd import _hoomd
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.logging import Logger, LoggerCategories
+from hoomd.operation import Writer
+
+_MAGIC = b'HOOMDLOG'
+_VERSION = 1
+
+
+class BinaryLog(Writer):
+    """Write scalar loggable quantities to a binary file from C++.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to write.
+        filename (str): File name to write.
+        logger (hoomd.logging.Logger): Scalar quantities to write.
+        buffer_size (int): Number of rows to buffer before writing them to the
+            file.
+
+    `BinaryLog` writes the quantities in *logger* without calling into Python.
+    When it attaches, it resolves each quantity to a C++ function once. On
+    each triggered timestep it evaluates these functions and appends the values
+    to a columnar buffer. When the buffer is full, a background thread writes it
+    to the file while the next buffer fills. Use `BinaryLog` in place of
+    `hoomd.write.Table` or `hoomd.write.HDF5Log` to log scalar quantities
+    frequently with little overhead.
+
+    `BinaryLog` supports the scalar quantities of ``md.compute`` thermodynamic
+    quantities and the ``energy`` of forces. It raises an error on attaching
+    when *logger* contains a quantity that is not available in C++. The logged
+    objects must be attached to the simulation before `BinaryLog`.
+
+    Use `BinaryLog.read` to read the file. `BinaryLog` overwrites an existing
+    file with the same name.
+
+    Note:
+        The rows in the buffer are written only when it is full, when you call
+        `flush`, and when `BinaryLog` is destroyed.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        logger = hoomd.logging.Logger(categories=['scalar'])
+        logger.add(thermo, quantities=['kinetic_temperature', 'pressure'])
+        binary_log = hoomd.write.BinaryLog(
+            trigger=hoomd.trigger.Periodic(100),
+            filename=binary_filename,
+            logger=logger)
+        simulation.operations.writers.append(binary_log)
+
+    Attributes:
+        filename (str): File name to write (*read only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                filename = binary_log.filename
+
+        buffer_size (int): Number of rows to buffer before writing them to the
+            file (*read only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                buffer_size = binary_log.buffer_size
+    """
+
+    def __init__(self, trigger, filename, logger, buffer_size=1000):
+        super().__init__(trigger)
+        self._param_dict.update(
+            ParameterDict(filename=str(filename), buffer_size=int(buffer_size)))
+        if not isinstance(logger, Logger):
+            raise ValueError("logger must be a hoomd.logging.Logger.")
+        self._logger = logger
+
+    @property
+    def logger(self):
+        """hoomd.logging.Logger: Scalar quantities to write (*read only*).
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger = binary_log.logger
+        """
+        return self._logger
+
+    def _attach_hook(self):
+        self._cpp_obj = _hoomd.BinaryLogWriter(
+            self._simulation.state._cpp_sys_def, self.trigger, self.filename,
+            self.buffer_size)
+
+        for key, entry in self._logger.items():
+            name = '/'.join(key)
+            if entry.category != LoggerCategories.scalar:
+                raise ValueError(f"BinaryLog cannot write {name}, which is "
+                                 "not a scalar quantity.")
+            cpp_obj = getattr(entry.obj, '_cpp_obj', None)
+            if not isinstance(cpp_obj, _hoomd.Compute):
+                raise ValueError(f"BinaryLog cannot write {name}. It must be "
+                                 "a quantity of a compute or force that is "
+                                 "attached to the simulation.")
+            self._cpp_obj.addQuantity(name, cpp_obj, entry.attr)
+
+    def _detach_hook(self):
+        self._cpp_obj.flush()
+
+    def flush(self):
+        """Write the buffered rows to the file.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            binary_log.flush()
+        """
+        if not self._attached:
+            raise RuntimeError("The binary log is unavailable until the "
+                               "simulation runs for 0 or more steps.")
+
+        self._cpp_obj.flush()
+
+    @staticmethod
+    def read(filename):
+        """Read a file written by `BinaryLog`.
+
+        Args:
+            filename (str): File name to read.
+
+        Returns:
+            dict[str, numpy.ndarray]: The logged quantities, keyed by their
+            namespaces joined by ``/``, and the timesteps, keyed by
+            ``'timestep'``.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.run(200)
+            binary_log.flush()
+            data = hoomd.write.BinaryLog.read(binary_filename)
+            kinetic_temperature = data[
+                'md/compute/ThermodynamicQuantities/kinetic_temperature']
+        """
+        with open(filename, 'rb') as f:
+            buffer = f.read()
+
+        if buffer[:len(_MAGIC)] != _MAGIC:
+            raise RuntimeError(f"{filename} is not a BinaryLog file.")
+        offset = len(_MAGIC)
+        version, num_columns = np.frombuffer(buffer, np.uint32, 2, offset)
+        if version != _VERSION:
+            raise RuntimeError(f"Unsupported BinaryLog version {version}.")
+        offset += 8
+
+        names = []
+        for _ in range(num_columns):
+            length = int(np.frombuffer(buffer, np.uint32, 1, offset)[0])
+            offset += 4
+            names.append(buffer[offset:offset + length].decode())
+            offset += length
+
+        timesteps = []
+        columns = [[] for _ in names]
+        while offset < len(buffer):
+            num_rows = int(np.frombuffer(buffer, np.uint32, 1, offset)[0])
+            offset += 4
+            timesteps.append(np.frombuffer(buffer, np.uint64, num_rows, offset))
+            offset += 8 * num_rows
+            for column in columns:
+                column.append(
+                    np.frombuffer(buffer, np.float64, num_rows, offset))
+                offset += 8 * num_rows
+
+        data = {
+            'timestep':
+                np.concatenate(timesteps)
+                if timesteps else np.zeros(0, np.uint64)
+        }
+        for name, column in zip(names, columns):
+            data[name] = (np.concatenate(column)
+                          if column else np.zeros(0, np.float64))
+        return data
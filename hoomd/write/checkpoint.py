@@ -0,0 +1,137 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement Checkpoint.
+
+.. invisible-code-block: python
+
+    simulation = hoomd.util.make_example_simulation()
+    checkpoint_filename = tmp_path / 'checkpoint.gsd'
+"""
+
+import json
+
+from hoomd import _hoomd
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.operation import Writer, AutotunedObject, _HOOMDBaseObject
+
+
+class Checkpoint(Writer):
+    """Write checkpoints that restart simulations.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to write.
+        filename (str): File name to write.
+
+    `Checkpoint` writes the complete simulation state to *filename*: the box,
+    every particle property (including accelerations), the bonds, angles,
+    dihedrals, impropers, constraints, special pairs, MPCD particles, and the
+    random number seed, all in double precision. It also stores the state of
+    the operations that is not part of their parameters, such as the barostat
+    and thermostat degrees of freedom and the tuned kernel parameters.
+
+    Each checkpoint replaces the previous one in *filename*. `Checkpoint` first
+    writes to a temporary file and then renames it, so an interrupted write
+    leaves the previous checkpoint intact.
+
+    Restart from a checkpoint with
+    `hoomd.Simulation.create_state_from_checkpoint` and add the same operations
+    to the simulation. The operation state in the checkpoint applies at the
+    start of the first `hoomd.Simulation.run`.
+
+    Note:
+        The checkpoint file uses the GSD format with the ``hoomd-checkpoint``
+        schema. Use `hoomd.write.GSD` to write trajectories for analysis.
+
+    Note:
+        Neighbor lists rebuild on the first step after a restart and MPCD
+        cell lists draw their grid shift from the seed and timestep, so no
+        state is needed to continue them.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        checkpoint = hoomd.write.Checkpoint(
+            trigger=hoomd.trigger.Periodic(1_000_000),
+            filename=checkpoint_filename)
+        simulation.operations.writers.append(checkpoint)
+
+    Attributes:
+        filename (str): File name to write (*read only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                filename = checkpoint.filename
+    """
+
+    def __init__(self, trigger, filename):
+        super().__init__(trigger)
+        self._param_dict.update(ParameterDict(filename=str(filename)))
+
+    def _attach_hook(self):
+        self._cpp_obj = _hoomd.CheckpointWriter(
+            self._simulation.state._cpp_sys_def, self.trigger, self.filename)
+        self._cpp_obj.state_writer = self
+
+    def _detach_hook(self):
+        self._cpp_obj.state_writer = None
+
+    def _checkpoint_state(self):
+        """Encode the state of the operations on this rank."""
+        state = {}
+        for key, operation in _walk_operations(self._simulation.operations):
+            entry = {}
+            if isinstance(operation, AutotunedObject) and operation._attached:
+                entry['kernel_parameters'] = operation.kernel_parameters
+            for name in operation._checkpoint_parameters:
+                entry[name] = getattr(operation, name)
+            if entry:
+                state[key] = entry
+        return json.dumps(state)
+
+
+def _walk_operations(operations):
+    """Iterate over the operations and their children with unique keys."""
+    for name in ('tuners', 'updaters', 'writers', 'computes'):
+        for i, operation in enumerate(getattr(operations, name)):
+            yield from _walk_operation(f'{name}[{i}]', operation)
+    if operations.integrator is not None:
+        yield from _walk_operation('integrator', operations.integrator)
+
+
+def _walk_operation(key, operation):
+    yield key, operation
+    for name in ('methods', 'forces', 'constraints'):
+        for i, child in enumerate(getattr(operation, name, None) or ()):
+            if isinstance(child, _HOOMDBaseObject):
+                yield from _walk_operation(f'{key}.{name}[{i}]', child)
+    for name in ('thermostat', 'nlist'):
+        child = getattr(operation, name, None)
+        if isinstance(child, _HOOMDBaseObject):
+            yield from _walk_operation(f'{key}.{name}', child)
+
+
+def _apply_checkpoint_state(simulation, state):
+    """Restore the state of the operations written by `Checkpoint`."""
+    state = json.loads(state) if state else {}
+    for key, operation in _walk_operations(simulation.operations):
+        if key not in state:
+            continue
+        for name, value in state[key].items():
+            if name == 'kernel_parameters':
+                if not isinstance(operation, AutotunedObject):
+                    continue
+                parameters = {k: tuple(v) for k, v in value.items()}
+                try:
+                    operation.kernel_parameters = parameters
+                except (RuntimeError, ValueError) as error:
+                    simulation.device._cpp_msg.warning(
+                        f"Cannot restore the kernel parameters of {key}: "
+                        f"{error}\n")
+            elif name in operation._checkpoint_parameters:
+                if isinstance(value, list):
+                    value = tuple(value)
+                setattr(operation, name, value)
@@ -148,7 +148,8 @@ class GSD(Writer):
         `GSD` buffers writes in memory. Abnormal exits (e.g. ``kill``,
         ``scancel``, reaching walltime limits) may cause loss of data. Ensure
         that your scripts exit cleanly and call `flush()` as needed to write
-        buffered frames to the file.
+        buffered frames to the file. `flush()` also waits for the frames in
+        the `async_queue_size` queue.
 
     See Also:
         See the `GSD documentation <https://gsd.readthedocs.io/>`__, `GSD HOOMD
@@ -251,6 +252,56 @@ class GSD(Writer):
             .. code-block:: python
 
                 gsd.maximum_write_buffer_size = 128 * 1024**2
+
+        async_queue_size (int): Number of frames that may wait in memory for
+            a background thread to write them to the file. When 0, write each
+            frame before the simulation continues. When greater than 0, the
+            simulation blocks only when the queue is full. Queued frames use
+            memory proportional to the number of particles.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                gsd.async_queue_size = 2
+
+        parallel_io (bool): When `True` in domain decomposed simulations, all
+            ranks write their particles directly to the file with collective
+            MPI-IO instead of gathering the frame onto the root rank. The file
+            is the same either way. Frames are written synchronously when
+            `parallel_io` is `True`, and the file system must support MPI-IO
+            from all ranks.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                gsd.parallel_io = True
+
+        position_precision (float): Precision of the written positions
+            :math:`[\mathrm{length}]`. When greater than 0, round the
+            positions to the nearest multiple of the largest power of two that
+            does not exceed `position_precision`. The positions are still
+            stored as floats, so any GSD reader can read the file, but the
+            trailing bits are zero and the file compresses well with file
+            system or external compression (e.g. ``zstd``). When 0, write the
+            positions at full precision.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                gsd.position_precision = 1e-3
+
+        velocity_precision (float): Precision of the written velocities
+            :math:`[\mathrm{velocity}]`. Works the same way as
+            `position_precision`.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                gsd.velocity_precision = 1e-2
     """
 
     def __init__(self,
@@ -295,6 +346,10 @@ class GSD(Writer):
                           dynamic=[dynamic_validation],
                           write_diameter=False,
                           maximum_write_buffer_size=64 * 1024 * 1024,
+                          async_queue_size=0,
+                          parallel_io=False,
+                          position_precision=0.0,
+                          velocity_precision=0.0,
                           _defaults=dict(filter=filter, dynamic=dynamic)))
 
         self._logger = None if logger is None else _GSDLogWriter(logger)
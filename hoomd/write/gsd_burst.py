@@ -39,6 +39,10 @@ class Burst(GSD):
         write_at_start (bool): When ``True`` **and** the file does not exist or
             has 0 frames: write one frame with the current state of the system
             when `hoomd.Simulation.run` is called. Defaults to ``False``.
+        device_buffer (bool): When ``True``, store the frames in
+            ``max_burst_size`` preallocated slots in device memory and copy them
+            to the host only in `dump`. Requires a positive
+            ``max_burst_size``. Defaults to ``False``.
 
     Warning:
         `Burst` errors when attempting to create a file or writing to one with
@@ -80,6 +84,15 @@ class Burst(GSD):
             .. code-block:: python
 
                 write_at_start = burst.write_at_start
+
+        device_buffer (bool): When ``True``, store the frames in device memory
+            (*read only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                device_buffer = burst.device_buffer
     """
 
     def __init__(self,
@@ -90,7 +103,8 @@ class Burst(GSD):
                  dynamic=None,
                  logger=None,
                  max_burst_size=-1,
-                 write_at_start=False):
+                 write_at_start=False,
+                 device_buffer=False):
         super().__init__(trigger=trigger,
                          filename=filename,
                          filter=filter,
@@ -99,10 +113,13 @@ class Burst(GSD):
                          logger=logger)
         self._param_dict.pop("truncate")
         self._param_dict.update(
-            ParameterDict(max_burst_size=int, write_at_start=bool))
+            ParameterDict(max_burst_size=int,
+                          write_at_start=bool,
+                          device_buffer=bool))
         self._param_dict.update({
             "max_burst_size": max_burst_size,
-            "write_at_start": write_at_start
+            "write_at_start": write_at_start,
+            "device_buffer": device_buffer
         })
 
     def _attach_hook(self):
@@ -112,7 +129,7 @@ class Burst(GSD):
                                               sim.state._get_group(self.filter),
                                               self.logger, self.max_burst_size,
                                               self.mode, self.write_at_start,
-                                              sim.timestep)
+                                              sim.timestep, self.device_buffer)
 
     def dump(self):
         """Write all currently stored frames to the file and empties the buffer.
@@ -75,6 +75,7 @@ class _HDF5LogInternal(custom._InternalAction):
         custom.Action.Flags.ROTATIONAL_KINETIC_ENERGY,
         custom.Action.Flags.PRESSURE_TENSOR,
         custom.Action.Flags.EXTERNAL_FIELD_VIRIAL,
+        custom.Action.Flags.POTENTIAL_ENERGY,
     )
 
     _reject_categories = logging.LoggerCategories.any((